@@ -179,12 +179,16 @@ class OneToOneFileRenderer:
             clang_format_bin: str,
             parse_extra_formats: bool = False,
             generate_serializer: bool = False,
+            generate_sax_parser: bool = False,
+            generate_binary_codec: bool = False,
     ) -> None:
         self._relative_to = relative_to
         self._vfilepath_to_relfilepath_map = vfilepath_to_relfilepath
         self._clang_format_bin = clang_format_bin
         self._parse_extra_formats = parse_extra_formats
         self._generate_serializer = generate_serializer
+        self._generate_sax_parser = generate_sax_parser
+        self._generate_binary_codec = generate_binary_codec
 
     @staticmethod
     def filepath_wo_ext(filepath: str) -> str:
@@ -277,6 +281,8 @@ class OneToOneFileRenderer:
                 'external_includes': external_includes,
                 'parse_formats': parse_formats,
                 'generate_serializer': self._generate_serializer,
+                'generate_sax_parser': self._generate_sax_parser,
+                'generate_binary_codec': self._generate_binary_codec,
             }
 
             tpl = JINJA_ENV.get_template('templates/type_fwd.hpp.jinja')
@@ -1,10 +1,12 @@
 # pylint: disable=too-many-lines
 import dataclasses
+import hashlib
 import itertools
 from typing import Any
 from typing import Dict
 from typing import List
 from typing import Optional
+from typing import Set
 from typing import Union
 
 from chaotic.back.cpp import keywords as cpp_keywords
@@ -662,6 +664,14 @@ class CppStructField:
         else:
             return f'std::optional<{type_}>'
 
+    def cpp_field_sax_parse_type(self) -> str:
+        # SAX parser keeps the default value of the field on null
+        type_ = self.schema.parser_type('TODO', self.name.title())
+        if self.required and self._default() is None:
+            return type_
+        else:
+            return f'std::optional<{type_}>'
+
 
 @dataclasses.dataclass
 class CppStruct(CppType):
@@ -769,13 +779,14 @@ class CppStruct(CppType):
         if self.extra_type:
             includes.append('string')
 
-            # for ExtractAdditionalProperties()
-            includes.append('userver/chaotic/object.hpp')
             if isinstance(self.extra_type, CppType):
                 extra_container = self.extra_container()
                 includes += self.get_include_by_cpp_type(extra_container)
                 includes.extend(self.extra_type.declaration_includes())
-        elif self.strict_parsing:
+
+        if self.fields or self.extra_type or self.strict_parsing:
+            # for ObjectProperties, ExtractAdditionalProperties()
+            # and ValidateNoAdditionalProperties()
             includes.append('userver/chaotic/object.hpp')
 
         if self._is_default_dict():
@@ -811,6 +822,16 @@ class CppStruct(CppType):
     def need_operator_eq(self) -> bool:
         return True
 
+    def binary_schema_hash(self) -> str:
+        """
+        C++ literal of the hash of the binary codec layout. Changes if the
+        fields of the struct or of the nested types change.
+        """
+        signature: List[str] = []
+        _append_binary_signature(self, signature, set())
+        digest = hashlib.sha256('\n'.join(signature).encode()).hexdigest()
+        return f'0x{digest[:16]}ULL'
+
 
 @dataclasses.dataclass
 class CppArrayValidator:
@@ -1037,3 +1058,40 @@ class CppVariantWithDiscriminator(CppType):
 
     def need_operator_lshift(self) -> bool:
         return False
+
+
+def _append_binary_signature(
+        type_: CppType, signature: List[str], seen: Set[int],
+) -> None:
+    if id(type_) in seen:
+        signature.append(f'seen {type_.raw_cpp_type}')
+        return
+    seen.add(id(type_))
+
+    if isinstance(type_, CppRef):
+        signature.append(f'ref {type_.indirect}')
+        _append_binary_signature(type_.orig_cpp_type, signature, seen)
+        return
+
+    signature.append(
+        f'{type_.get_py_type()} {type_.raw_cpp_type} '
+        f'{type_.user_cpp_type} {type_.nullable}',
+    )
+    if isinstance(type_, CppStruct):
+        for name, field in type_.fields.items():
+            signature.append(
+                f'field {name} {field.required} {field.is_optional()}',
+            )
+            _append_binary_signature(field.schema, signature, seen)
+        if isinstance(type_.extra_type, CppType):
+            signature.append('extra')
+            _append_binary_signature(type_.extra_type, signature, seen)
+        else:
+            signature.append(f'extra {type_.extra_type}')
+    elif isinstance(type_, CppVariantWithDiscriminator):
+        for name, variant in type_.variants.items():
+            signature.append(f'variant {name}')
+            _append_binary_signature(variant, signature, seen)
+    else:
+        for subtype in type_.subtypes():
+            _append_binary_signature(subtype, signature, seen)
@@ -86,6 +86,23 @@ def parse_args() -> argparse.Namespace:
         action='store_true',
         help='Generate JSON serializers for generated types',
     )
+    parser.add_argument(
+        '--generate-sax-parsers',
+        action='store_true',
+        help=(
+            'Generate SAX parsers for generated types, '
+            'see userver/chaotic/sax_parser.hpp'
+        ),
+    )
+    parser.add_argument(
+        '--generate-binary-codecs',
+        action='store_true',
+        help=(
+            'Generate compact binary codecs for generated types, '
+            'see userver/chaotic/binary.hpp. '
+            'Requires --generate-serializers'
+        ),
+    )
 
     parser.add_argument(
         '-o',
@@ -117,7 +134,13 @@ def parse_args() -> argparse.Namespace:
     parser.add_argument(
         'file', type=str, nargs='+', help='yaml/json input filename',
     )
-    return parser.parse_args()
+    args = parser.parse_args()
+    if args.generate_binary_codecs and not args.generate_serializers:
+        # Subschemas without a binary codec are stored as JSON
+        parser.error(
+            '--generate-binary-codecs requires --generate-serializers',
+        )
+    return args
 
 
 def generate_cpp_name_func(
@@ -269,6 +292,8 @@ def main() -> None:
         clang_format_bin=args.clang_format,
         parse_extra_formats=args.parse_extra_formats,
         generate_serializer=args.generate_serializers,
+        generate_sax_parser=args.generate_sax_parsers,
+        generate_binary_codec=args.generate_binary_codecs,
     ).render(types)
     for output in outputs:
         if output.filepath_wo_ext.startswith('/'):
@@ -27,9 +27,13 @@ ns::AllOf::Foo__P0 Parse(
 
   ns::AllOf::Foo__P0 res;
 
-  res.foo = value["foo"]
-                .template As<std::optional<
-                    USERVER_NAMESPACE::chaotic::Primitive<std::string>>>();
+  const USERVER_NAMESPACE::chaotic::ObjectProperties<
+      Value, kns__AllOf__Foo__P0_PropertiesNames.size()>
+      properties{value, kns__AllOf__Foo__P0_PropertiesNames};
+
+  res.foo = properties.template As<
+      std::optional<USERVER_NAMESPACE::chaotic::Primitive<std::string>>>(
+      0, "foo");
 
   res.extra = USERVER_NAMESPACE::chaotic::ExtractAdditionalPropertiesTrue(
       value, kns__AllOf__Foo__P0_PropertiesNames);
@@ -45,10 +49,12 @@ ns::AllOf::Foo__P1 Parse(
 
   ns::AllOf::Foo__P1 res;
 
-  res.bar =
-      value["bar"]
-          .template As<
-              std::optional<USERVER_NAMESPACE::chaotic::Primitive<int>>>();
+  const USERVER_NAMESPACE::chaotic::ObjectProperties<
+      Value, kns__AllOf__Foo__P1_PropertiesNames.size()>
+      properties{value, kns__AllOf__Foo__P1_PropertiesNames};
+
+  res.bar = properties.template As<
+      std::optional<USERVER_NAMESPACE::chaotic::Primitive<int>>>(0, "bar");
 
   res.extra = USERVER_NAMESPACE::chaotic::ExtractAdditionalPropertiesTrue(
       value, kns__AllOf__Foo__P1_PropertiesNames);
@@ -70,9 +76,13 @@ ns::AllOf Parse(Value value, USERVER_NAMESPACE::formats::parse::To<ns::AllOf>) {
 
   ns::AllOf res;
 
-  res.foo = value["foo"]
-                .template As<std::optional<
-                    USERVER_NAMESPACE::chaotic::Primitive<ns::AllOf::Foo>>>();
+  const USERVER_NAMESPACE::chaotic::ObjectProperties<
+      Value, kns__AllOf_PropertiesNames.size()>
+      properties{value, kns__AllOf_PropertiesNames};
+
+  res.foo = properties.template As<
+      std::optional<USERVER_NAMESPACE::chaotic::Primitive<ns::AllOf::Foo>>>(
+      0, "foo");
 
   USERVER_NAMESPACE::chaotic::ValidateNoAdditionalProperties(
       value, kns__AllOf_PropertiesNames);
@@ -38,9 +38,13 @@ ns::Enum Parse(Value value, USERVER_NAMESPACE::formats::parse::To<ns::Enum>) {
 
   ns::Enum res;
 
-  res.foo = value["foo"]
-                .template As<std::optional<
-                    USERVER_NAMESPACE::chaotic::Primitive<ns::Enum::Foo>>>();
+  const USERVER_NAMESPACE::chaotic::ObjectProperties<
+      Value, kns__Enum_PropertiesNames.size()>
+      properties{value, kns__Enum_PropertiesNames};
+
+  res.foo = properties.template As<
+      std::optional<USERVER_NAMESPACE::chaotic::Primitive<ns::Enum::Foo>>>(
+      0, "foo");
 
   USERVER_NAMESPACE::chaotic::ValidateNoAdditionalProperties(
       value, kns__Enum_PropertiesNames);
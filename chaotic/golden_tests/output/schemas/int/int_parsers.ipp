@@ -16,10 +16,12 @@ ns::Int Parse(Value value, USERVER_NAMESPACE::formats::parse::To<ns::Int>) {
 
   ns::Int res;
 
-  res.foo =
-      value["foo"]
-          .template As<
-              std::optional<USERVER_NAMESPACE::chaotic::Primitive<int>>>();
+  const USERVER_NAMESPACE::chaotic::ObjectProperties<
+      Value, kns__Int_PropertiesNames.size()>
+      properties{value, kns__Int_PropertiesNames};
+
+  res.foo = properties.template As<
+      std::optional<USERVER_NAMESPACE::chaotic::Primitive<int>>>(0, "foo");
 
   USERVER_NAMESPACE::chaotic::ValidateNoAdditionalProperties(
       value, kns__Int_PropertiesNames);
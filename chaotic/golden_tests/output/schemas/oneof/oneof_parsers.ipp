@@ -16,10 +16,14 @@ ns::OneOf Parse(Value value, USERVER_NAMESPACE::formats::parse::To<ns::OneOf>) {
 
   ns::OneOf res;
 
-  res.foo = value["foo"]
-                .template As<std::optional<USERVER_NAMESPACE::chaotic::Variant<
-                    USERVER_NAMESPACE::chaotic::Primitive<int>,
-                    USERVER_NAMESPACE::chaotic::Primitive<std::string>>>>();
+  const USERVER_NAMESPACE::chaotic::ObjectProperties<
+      Value, kns__OneOf_PropertiesNames.size()>
+      properties{value, kns__OneOf_PropertiesNames};
+
+  res.foo = properties.template As<
+      std::optional<USERVER_NAMESPACE::chaotic::Variant<
+          USERVER_NAMESPACE::chaotic::Primitive<int>,
+          USERVER_NAMESPACE::chaotic::Primitive<std::string>>>>(0, "foo");
 
   USERVER_NAMESPACE::chaotic::ValidateNoAdditionalProperties(
       value, kns__OneOf_PropertiesNames);
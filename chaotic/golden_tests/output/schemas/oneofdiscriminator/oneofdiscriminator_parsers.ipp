@@ -17,13 +17,15 @@ ns::A Parse(Value value, USERVER_NAMESPACE::formats::parse::To<ns::A>) {
 
   ns::A res;
 
-  res.type = value["type"]
-                 .template As<std::optional<
-                     USERVER_NAMESPACE::chaotic::Primitive<std::string>>>();
-  res.a_prop =
-      value["a_prop"]
-          .template As<
-              std::optional<USERVER_NAMESPACE::chaotic::Primitive<int>>>();
+  const USERVER_NAMESPACE::chaotic::ObjectProperties<
+      Value, kns__A_PropertiesNames.size()>
+      properties{value, kns__A_PropertiesNames};
+
+  res.type = properties.template As<
+      std::optional<USERVER_NAMESPACE::chaotic::Primitive<std::string>>>(
+      0, "type");
+  res.a_prop = properties.template As<
+      std::optional<USERVER_NAMESPACE::chaotic::Primitive<int>>>(1, "a_prop");
 
   res.extra = USERVER_NAMESPACE::chaotic::ExtractAdditionalPropertiesTrue(
       value, kns__A_PropertiesNames);
@@ -44,13 +46,15 @@ ns::B Parse(Value value, USERVER_NAMESPACE::formats::parse::To<ns::B>) {
 
   ns::B res;
 
-  res.type = value["type"]
-                 .template As<std::optional<
-                     USERVER_NAMESPACE::chaotic::Primitive<std::string>>>();
-  res.b_prop =
-      value["b_prop"]
-          .template As<
-              std::optional<USERVER_NAMESPACE::chaotic::Primitive<int>>>();
+  const USERVER_NAMESPACE::chaotic::ObjectProperties<
+      Value, kns__B_PropertiesNames.size()>
+      properties{value, kns__B_PropertiesNames};
+
+  res.type = properties.template As<
+      std::optional<USERVER_NAMESPACE::chaotic::Primitive<std::string>>>(
+      0, "type");
+  res.b_prop = properties.template As<
+      std::optional<USERVER_NAMESPACE::chaotic::Primitive<int>>>(1, "b_prop");
 
   res.extra = USERVER_NAMESPACE::chaotic::ExtractAdditionalPropertiesTrue(
       value, kns__B_PropertiesNames);
@@ -72,13 +76,15 @@ ns::OneOfDiscriminator Parse(
 
   ns::OneOfDiscriminator res;
 
-  res.foo =
-      value["foo"]
-          .template As<
-              std::optional<USERVER_NAMESPACE::chaotic::OneOfWithDiscriminator<
-                  &ns::impl::kns__OneOfDiscriminator__Foo_Settings,
-                  USERVER_NAMESPACE::chaotic::Primitive<ns::A>,
-                  USERVER_NAMESPACE::chaotic::Primitive<ns::B>>>>();
+  const USERVER_NAMESPACE::chaotic::ObjectProperties<
+      Value, kns__OneOfDiscriminator_PropertiesNames.size()>
+      properties{value, kns__OneOfDiscriminator_PropertiesNames};
+
+  res.foo = properties.template As<
+      std::optional<USERVER_NAMESPACE::chaotic::OneOfWithDiscriminator<
+          &ns::impl::kns__OneOfDiscriminator__Foo_Settings,
+          USERVER_NAMESPACE::chaotic::Primitive<ns::A>,
+          USERVER_NAMESPACE::chaotic::Primitive<ns::B>>>>(0, "foo");
 
   USERVER_NAMESPACE::chaotic::ValidateNoAdditionalProperties(
       value, kns__OneOfDiscriminator_PropertiesNames);
@@ -17,9 +17,13 @@ ns::String Parse(Value value,
 
   ns::String res;
 
-  res.foo = value["foo"]
-                .template As<std::optional<
-                    USERVER_NAMESPACE::chaotic::Primitive<std::string>>>();
+  const USERVER_NAMESPACE::chaotic::ObjectProperties<
+      Value, kns__String_PropertiesNames.size()>
+      properties{value, kns__String_PropertiesNames};
+
+  res.foo = properties.template As<
+      std::optional<USERVER_NAMESPACE::chaotic::Primitive<std::string>>>(
+      0, "foo");
 
   USERVER_NAMESPACE::chaotic::ValidateNoAdditionalProperties(
       value, kns__String_PropertiesNames);
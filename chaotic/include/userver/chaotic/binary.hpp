@@ -0,0 +1,375 @@
+#pragma once
+
+/// @file userver/chaotic/binary.hpp
+/// @brief Compact binary codecs for the types generated by chaotic
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include <userver/formats/common/meta.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/utils/box.hpp>
+#include <userver/utils/meta.hpp>
+
+#include <userver/chaotic/array.hpp>
+#include <userver/chaotic/convert/to.hpp>
+#include <userver/chaotic/primitive.hpp>
+#include <userver/chaotic/ref.hpp>
+#include <userver/chaotic/variant.hpp>
+#include <userver/chaotic/with_type.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// @brief Compact binary codecs for the types generated by chaotic
+///
+/// The codecs are generated with `--generate-binary-codecs` chaotic-gen flag.
+/// The fields are written in the schema order without their names: integers
+/// as zigzag varints, doubles as 8 bytes, strings and containers with a varint
+/// size prefix, optional fields with a presence byte. Subschemas that have no
+/// binary codec (allOf, enums, oneOf with a discriminator and the types from
+/// the schemas generated without the flag) are stored as JSON text.
+///
+/// Encode() prepends the hash of the schema of the type, including the
+/// schemas of the nested types, and Decode() rejects the data written for
+/// another schema. The validators of the schema are not run on decoding.
+///
+/// If userver/dump is available, the generated types are dumpable, see
+/// @ref scripts/docs/en/userver/cache_dumps.md
+namespace chaotic::binary {
+
+/// Thrown on malformed binary data or schema mismatch
+class Error final : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
+template <typename T>
+struct To final {};
+
+/// Appends the encoded values to a string
+class Writer final {
+ public:
+  explicit Writer(std::string& buffer) noexcept : buffer_(buffer) {}
+
+  void WriteVarint(std::uint64_t value);
+  void WriteSigned(std::int64_t value);
+  void WriteFixed64(std::uint64_t value);
+  void WriteDouble(double value);
+  void WriteBool(bool value);
+  void WriteBytes(std::string_view value);
+
+  /// Writes `value` as the chaotic parse type `ParseType`,
+  /// e.g. chaotic::Primitive<int>
+  template <typename ParseType, typename T>
+  void Write(const T& value);
+
+  template <typename ParseType, typename T>
+  void WriteOptional(const std::optional<T>& value);
+
+ private:
+  std::string& buffer_;
+};
+
+/// Reads the values written by chaotic::binary::Writer
+class Reader final {
+ public:
+  explicit Reader(std::string_view data) noexcept : data_(data) {}
+
+  std::uint64_t ReadVarint();
+  std::int64_t ReadSigned();
+  std::uint64_t ReadFixed64();
+  double ReadDouble();
+  bool ReadBool();
+  std::string_view ReadBytes();
+
+  /// Reads a value of the chaotic parse type `ParseType`
+  template <typename ParseType>
+  auto Read();
+
+  template <typename ParseType>
+  auto ReadOptional();
+
+  /// @throws chaotic::binary::Error if not all the data was read
+  void Finish() const;
+
+ private:
+  std::string_view Take(std::size_t size);
+
+  std::string_view data_;
+};
+
+namespace impl {
+
+template <typename T>
+using GeneratedWriteResult =
+    decltype(WriteBinary(std::declval<Writer&>(), std::declval<const T&>()));
+
+template <typename T>
+inline constexpr bool kHasGeneratedCodec =
+    meta::kIsDetected<GeneratedWriteResult, T>;
+
+template <typename ParseType>
+using ResultType = formats::common::ParseType<formats::json::Value, ParseType>;
+
+// Types without a binary codec are stored as JSON text
+template <typename ParseType>
+struct JsonCodec {
+  template <typename T>
+  static void Write(Writer& writer, const T& value) {
+    writer.WriteBytes(formats::json::ToString(
+        formats::json::ValueBuilder{ParseType{value}}.ExtractValue()));
+  }
+
+  static ResultType<ParseType> Read(Reader& reader) {
+    return formats::json::FromString(reader.ReadBytes())
+        .template As<ParseType>();
+  }
+};
+
+template <typename ParseType>
+struct Codec : JsonCodec<ParseType> {};
+
+template <typename RawType, typename... Validators>
+struct Codec<Primitive<RawType, Validators...>> {
+  static void Write(Writer& writer, const RawType& value) {
+    if constexpr (std::is_same_v<RawType, bool>) {
+      writer.WriteBool(value);
+    } else if constexpr (std::is_integral_v<RawType>) {
+      static_assert(sizeof(RawType) <= sizeof(std::int64_t));
+      if constexpr (std::is_signed_v<RawType>) {
+        writer.WriteSigned(value);
+      } else {
+        writer.WriteVarint(value);
+      }
+    } else if constexpr (std::is_floating_point_v<RawType>) {
+      writer.WriteDouble(value);
+    } else if constexpr (std::is_same_v<RawType, std::string>) {
+      writer.WriteBytes(value);
+    } else if constexpr (kHasGeneratedCodec<RawType>) {
+      WriteBinary(writer, value);
+    } else {
+      JsonCodec<Primitive<RawType, Validators...>>::Write(writer, value);
+    }
+  }
+
+  static RawType Read(Reader& reader) {
+    if constexpr (std::is_same_v<RawType, bool>) {
+      return reader.ReadBool();
+    } else if constexpr (std::is_integral_v<RawType>) {
+      if constexpr (std::is_signed_v<RawType>) {
+        return CheckedCast(reader.ReadSigned());
+      } else {
+        return CheckedCast(reader.ReadVarint());
+      }
+    } else if constexpr (std::is_floating_point_v<RawType>) {
+      return static_cast<RawType>(reader.ReadDouble());
+    } else if constexpr (std::is_same_v<RawType, std::string>) {
+      return std::string{reader.ReadBytes()};
+    } else if constexpr (kHasGeneratedCodec<RawType>) {
+      return ReadBinary(reader, To<RawType>{});
+    } else {
+      return JsonCodec<Primitive<RawType, Validators...>>::Read(reader);
+    }
+  }
+
+ private:
+  template <typename Integer>
+  static RawType CheckedCast(Integer value) {
+    const auto result = static_cast<RawType>(value);
+    if (static_cast<Integer>(result) != value) {
+      throw Error("Integer in binary data is out of the type range");
+    }
+    return result;
+  }
+};
+
+template <typename ItemType, typename UserType, typename... Validators>
+struct Codec<Array<ItemType, UserType, Validators...>> {
+  static void Write(Writer& writer, const UserType& value) {
+    writer.WriteVarint(std::size(value));
+    for (const auto& item : value) writer.Write<ItemType>(item);
+  }
+
+  static UserType Read(Reader& reader) {
+    const auto size = reader.ReadVarint();
+    UserType result;
+    if constexpr (meta::kIsReservable<UserType>) {
+      // The size comes from the data, do not preallocate much for a broken one
+      result.reserve(std::min<std::uint64_t>(
+          size, std::numeric_limits<std::uint16_t>::max()));
+    }
+    auto inserter = std::inserter(result, result.end());
+    for (std::uint64_t i = 0; i < size; ++i) {
+      *inserter = reader.Read<ItemType>();
+      ++inserter;
+    }
+    return result;
+  }
+};
+
+template <typename T>
+struct Codec<Ref<T>> {
+  static void Write(Writer& writer, const utils::Box<ResultType<T>>& value) {
+    writer.Write<T>(*value);
+  }
+
+  static utils::Box<ResultType<T>> Read(Reader& reader) {
+    return utils::Box<ResultType<T>>{reader.Read<T>()};
+  }
+};
+
+template <typename RawType, typename UserType>
+struct Codec<WithType<RawType, UserType>> {
+  static void Write(Writer& writer, const UserType& value) {
+    writer.Write<RawType>(
+        Convert(value, convert::To<std::decay_t<decltype(RawType::value)>>{}));
+  }
+
+  static UserType Read(Reader& reader) {
+    return Convert(reader.Read<RawType>(), convert::To<UserType>{});
+  }
+};
+
+template <typename... T>
+struct Codec<Variant<T...>> {
+  using Type = std::variant<ResultType<T>...>;
+
+  static void Write(Writer& writer, const Type& value) {
+    writer.WriteVarint(value.index());
+    WriteAlternative(writer, value, std::index_sequence_for<T...>{});
+  }
+
+  static Type Read(Reader& reader) {
+    const auto index = reader.ReadVarint();
+    if (index >= sizeof...(T)) {
+      throw Error("Invalid variant index in binary data");
+    }
+    return ReadAlternative(reader, index, std::index_sequence_for<T...>{});
+  }
+
+ private:
+  template <std::size_t... Indices>
+  static void WriteAlternative(Writer& writer, const Type& value,
+                               std::index_sequence<Indices...>) {
+    ((value.index() == Indices
+          ? writer.Write<T>(std::get<Indices>(value))
+          : void()),
+     ...);
+  }
+
+  template <std::size_t... Indices>
+  static Type ReadAlternative(Reader& reader, std::uint64_t index,
+                              std::index_sequence<Indices...>) {
+    std::optional<Type> result;
+    ((index == Indices
+          ? void(result.emplace(std::in_place_index<Indices>,
+                                reader.Read<T>()))
+          : void()),
+     ...);
+    return std::move(*result);
+  }
+};
+
+}  // namespace impl
+
+template <typename ParseType, typename T>
+void Writer::Write(const T& value) {
+  impl::Codec<ParseType>::Write(*this, value);
+}
+
+template <typename ParseType, typename T>
+void Writer::WriteOptional(const std::optional<T>& value) {
+  WriteBool(value.has_value());
+  if (value) Write<ParseType>(*value);
+}
+
+template <typename ParseType>
+auto Reader::Read() {
+  return impl::Codec<ParseType>::Read(*this);
+}
+
+template <typename ParseType>
+auto Reader::ReadOptional() {
+  std::optional<impl::ResultType<ParseType>> result;
+  if (ReadBool()) result.emplace(Read<ParseType>());
+  return result;
+}
+
+/// @brief Encodes a chaotic generated type with the schema hash
+template <typename T>
+std::string Encode(const T& value) {
+  static_assert(impl::kHasGeneratedCodec<T>,
+                "No binary codec for the type. Was the type generated with "
+                "`--generate-binary-codecs` chaotic-gen flag?");
+  std::string result;
+  Writer writer{result};
+  writer.WriteFixed64(GetBinarySchemaHash(To<T>{}));
+  WriteBinary(writer, value);
+  return result;
+}
+
+/// @brief Decodes the data written by chaotic::binary::Encode()
+/// @throws chaotic::binary::Error on malformed data or schema mismatch
+template <typename T>
+T Decode(std::string_view data) {
+  static_assert(impl::kHasGeneratedCodec<T>,
+                "No binary codec for the type. Was the type generated with "
+                "`--generate-binary-codecs` chaotic-gen flag?");
+  Reader reader{data};
+  if (reader.ReadFixed64() != GetBinarySchemaHash(To<T>{})) {
+    throw Error("Binary data was written for another schema of the type");
+  }
+  auto result = ReadBinary(reader, To<T>{});
+  reader.Finish();
+  return result;
+}
+
+}  // namespace chaotic::binary
+
+USERVER_NAMESPACE_END
+
+// Cache dumps of the generated types, if the userver/dump is available
+#if __has_include(<userver/dump/operations.hpp>)
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// @brief Dumping support for the types generated by chaotic with
+/// `--generate-binary-codecs`
+template <typename T>
+std::enable_if_t<chaotic::binary::impl::kHasGeneratedCodec<T>> Write(
+    Writer& writer, const T& value) {
+  writer.Write(chaotic::binary::Encode(value));
+}
+
+/// @brief Loading support for the types generated by chaotic with
+/// `--generate-binary-codecs`
+template <typename T>
+std::enable_if_t<chaotic::binary::impl::kHasGeneratedCodec<T>, T> Read(
+    Reader& reader, To<T>) {
+  try {
+    return chaotic::binary::Decode<T>(reader.Read<std::string>());
+  } catch (const chaotic::binary::Error& e) {
+    throw Error(e.what());
+  }
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
+#endif
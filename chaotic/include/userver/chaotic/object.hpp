@@ -1,12 +1,18 @@
 #pragma once
 
+#include <array>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <unordered_map>
 
 #include <fmt/format.h>
 
 #include <userver/formats/common/items.hpp>
 #include <userver/formats/json/value_builder.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/meta.hpp>
 #include <userver/utils/trivial_map.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -51,6 +57,62 @@ ExtractAdditionalProperties(
   return map;
 }
 
+/// @brief Lookup of the object properties known at compile time.
+///
+/// formats::json::Value::operator[] is a linear search over the object
+/// members, so looking up each property of a struct one by one is quadratic.
+/// For JSON the object members are iterated once and dispatched by name via
+/// utils::TrivialSet. Other formats are looked up with operator[] as is.
+template <typename Value, std::size_t Size>
+class ObjectProperties final {
+ public:
+  template <typename BuilderFunc>
+  ObjectProperties(const Value& value,
+                   const utils::TrivialSet<BuilderFunc>& names)
+      : value_(value) {
+    UASSERT(names.size() == Size);
+
+    if constexpr (kIsIndexed) {
+      for (auto it = value.begin(); it != value.end(); ++it) {
+        const auto index = names.GetIndex(it.GetNameView());
+        // operator[] returns the first of the duplicate members
+        if (index && !members_[*index]) members_[*index].emplace(*it);
+      }
+    }
+  }
+
+  /// Same as `value[name].As<T>(default_args...)`, where `index` is the
+  /// position of the `name` in the set of the property names.
+  template <typename T, typename... DefaultArgs>
+  auto As(std::size_t index, std::string_view name,
+          DefaultArgs&&... default_args) const {
+    if constexpr (kIsIndexed) {
+      UASSERT(index < Size);
+      const auto& member = members_[index];
+      if (member) {
+        return member->template As<T>(
+            std::forward<DefaultArgs>(default_args)...);
+      }
+
+      // A missing value is required only to report a missing field
+      if constexpr (sizeof...(DefaultArgs) != 0 || meta::kIsOptional<T>) {
+        return decltype(member->template As<T>())(
+            std::forward<DefaultArgs>(default_args)...);
+      }
+    }
+
+    return value_[name].template As<T>(
+        std::forward<DefaultArgs>(default_args)...);
+  }
+
+ private:
+  static constexpr bool kIsIndexed =
+      std::is_same_v<Value, formats::json::Value>;
+
+  const Value& value_;
+  std::array<std::optional<Value>, kIsIndexed ? Size : 0> members_;
+};
+
 }  // namespace chaotic
 
 USERVER_NAMESPACE_END
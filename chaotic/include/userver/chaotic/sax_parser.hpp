@@ -0,0 +1,585 @@
+#pragma once
+
+/// @file userver/chaotic/sax_parser.hpp
+/// @brief SAX parsers for the types generated by chaotic
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <userver/formats/json/parser/array_parser.hpp>
+#include <userver/formats/json/parser/bool_parser.hpp>
+#include <userver/formats/json/parser/int_parser.hpp>
+#include <userver/formats/json/parser/number_parser.hpp>
+#include <userver/formats/json/parser/parser_json.hpp>
+#include <userver/formats/json/parser/string_parser.hpp>
+#include <userver/formats/json/parser/typed_parser.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/parse/to.hpp>
+#include <userver/utils/box.hpp>
+#include <userver/utils/meta.hpp>
+
+#include <userver/chaotic/array.hpp>
+#include <userver/chaotic/primitive.hpp>
+#include <userver/chaotic/ref.hpp>
+#include <userver/chaotic/with_type.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// @brief SAX parsers for the types generated by chaotic
+///
+/// The parsers are generated with `--generate-sax-parsers` chaotic-gen flag.
+/// They parse JSON straight into the generated types and do the same
+/// validation as `formats::json::Value::As<T>()` does, without building a
+/// formats::json::Value first. Subschemas that have no SAX parser (oneOf,
+/// allOf, enums and the types from the schemas generated without the flag)
+/// are parsed via formats::json::Value.
+namespace chaotic::sax {
+
+namespace impl {
+
+namespace fjp = formats::json::parser;
+
+template <typename ParseType, typename = void>
+struct ParserFor;
+
+}  // namespace impl
+
+/// SAX parser for the chaotic parse type (e.g. chaotic::Primitive<int>)
+template <typename ParseType>
+using Parser = typename impl::ParserFor<ParseType>::Type;
+
+template <typename ParseType>
+using ResultType = typename Parser<ParseType>::ResultType;
+
+namespace impl {
+
+template <typename T>
+struct TypeTag final {
+  using Type = T;
+};
+
+template <typename T>
+using GeneratedParserPtr = decltype(MakeSaxParser(formats::parse::To<T>{}));
+
+template <typename T>
+inline constexpr bool kHasGeneratedParser =
+    meta::kIsDetected<GeneratedParserPtr, T>;
+
+// formats::json::parser::ArrayParser supports vectors and sets
+template <typename Container, typename Item>
+using InsertResult =
+    decltype(std::declval<Container&>().insert(std::declval<Item>()));
+
+// Parses the value into formats::json::Value and converts it with As<T>()
+template <typename ParseType>
+class DomParser final : public fjp::Subscriber<formats::json::Value> {
+ public:
+  using ResultType =
+      formats::common::ParseType<formats::json::Value, ParseType>;
+
+  DomParser() { parser_.Subscribe(*this); }
+
+  void Reset() { parser_.Reset(); }
+
+  void Subscribe(fjp::Subscriber<ResultType>& subscriber) {
+    subscriber_ = &subscriber;
+  }
+
+  fjp::TypedParser<formats::json::Value>& GetParser() { return parser_; }
+
+ private:
+  void OnSend(formats::json::Value&& value) override {
+    auto result = value.As<ParseType>();
+    if (subscriber_) subscriber_->OnSend(std::move(result));
+  }
+
+  fjp::JsonValueParser parser_;
+  fjp::Subscriber<ResultType>* subscriber_{nullptr};
+};
+
+template <typename RawType>
+struct ScalarParser;
+
+template <>
+struct ScalarParser<bool> {
+  using Type = fjp::BoolParser;
+};
+
+template <>
+struct ScalarParser<std::int32_t> {
+  using Type = fjp::Int32Parser;
+};
+
+template <>
+struct ScalarParser<std::int64_t> {
+  using Type = fjp::Int64Parser;
+};
+
+template <>
+struct ScalarParser<double> {
+  using Type = fjp::DoubleParser;
+};
+
+template <>
+struct ScalarParser<std::string> {
+  using Type = fjp::StringParser;
+};
+
+template <typename RawType>
+using ScalarParserType = typename ScalarParser<RawType>::Type;
+
+template <typename RawType, typename... Validators>
+class ValidatingParser final : public fjp::Subscriber<RawType> {
+ public:
+  using ResultType = RawType;
+
+  ValidatingParser() { parser_.Subscribe(*this); }
+
+  void Reset() { parser_.Reset(); }
+
+  void Subscribe(fjp::Subscriber<RawType>& subscriber) {
+    subscriber_ = &subscriber;
+  }
+
+  fjp::TypedParser<RawType>& GetParser() { return parser_; }
+
+ private:
+  void OnSend(RawType&& value) override {
+    (Validators::Validate(value), ...);
+    if (subscriber_) subscriber_->OnSend(std::move(value));
+  }
+
+  ScalarParserType<RawType> parser_;
+  fjp::Subscriber<RawType>* subscriber_{nullptr};
+};
+
+// Parser of a type with the generated SAX parser
+template <typename T>
+class GeneratedParser final {
+ public:
+  using ResultType = T;
+
+  void Reset() { GetParser().Reset(); }
+
+  void Subscribe(fjp::Subscriber<T>& subscriber) {
+    subscriber_ = &subscriber;
+    if (parser_) parser_->Subscribe(subscriber);
+  }
+
+  fjp::TypedParser<T>& GetParser() {
+    // Created on the first use, otherwise parsers of recursive types would
+    // create each other infinitely
+    if (!parser_) {
+      parser_ = MakeSaxParser(formats::parse::To<T>{});
+      if (subscriber_) parser_->Subscribe(*subscriber_);
+    }
+    return *parser_;
+  }
+
+ private:
+  std::unique_ptr<fjp::TypedParser<T>> parser_;
+  fjp::Subscriber<T>* subscriber_{nullptr};
+};
+
+template <typename RawType, typename UserType>
+class WithTypeParser final
+    : public fjp::Subscriber<sax::ResultType<RawType>> {
+ public:
+  using ResultType = UserType;
+
+  WithTypeParser() { parser_.Subscribe(*this); }
+
+  void Reset() { parser_.Reset(); }
+
+  void Subscribe(fjp::Subscriber<UserType>& subscriber) {
+    subscriber_ = &subscriber;
+  }
+
+  auto& GetParser() { return parser_.GetParser(); }
+
+ private:
+  void OnSend(sax::ResultType<RawType>&& value) override {
+    auto result = Convert(value, convert::To<UserType>{});
+    if (subscriber_) subscriber_->OnSend(std::move(result));
+  }
+
+  Parser<RawType> parser_;
+  fjp::Subscriber<UserType>* subscriber_{nullptr};
+};
+
+template <typename ItemType, typename UserType, typename... Validators>
+class ArrayParser final : public fjp::Subscriber<UserType> {
+ public:
+  using ResultType = UserType;
+
+  ArrayParser() { parser_.Subscribe(*this); }
+
+  void Reset() { parser_.Reset(); }
+
+  void Subscribe(fjp::Subscriber<UserType>& subscriber) {
+    subscriber_ = &subscriber;
+  }
+
+  fjp::TypedParser<UserType>& GetParser() { return parser_; }
+
+ private:
+  void OnSend(UserType&& value) override {
+    (Validators::Validate(value), ...);
+    if (subscriber_) subscriber_->OnSend(std::move(value));
+  }
+
+  Parser<ItemType> item_parser_;
+  fjp::ArrayParser<sax::ResultType<ItemType>, Parser<ItemType>, UserType>
+      parser_{item_parser_};
+  fjp::Subscriber<UserType>* subscriber_{nullptr};
+};
+
+template <typename T>
+class RefParser final : public fjp::Subscriber<sax::ResultType<T>> {
+ public:
+  using ResultType = utils::Box<sax::ResultType<T>>;
+
+  RefParser() { parser_.Subscribe(*this); }
+
+  void Reset() { parser_.Reset(); }
+
+  void Subscribe(fjp::Subscriber<ResultType>& subscriber) {
+    subscriber_ = &subscriber;
+  }
+
+  auto& GetParser() { return parser_.GetParser(); }
+
+ private:
+  void OnSend(sax::ResultType<T>&& value) override {
+    if (subscriber_) subscriber_->OnSend(ResultType{std::move(value)});
+  }
+
+  Parser<T> parser_;
+  fjp::Subscriber<ResultType>* subscriber_{nullptr};
+};
+
+// null is parsed as std::nullopt, anything else is passed to the T parser
+template <typename T>
+class OptionalParser final
+    : public fjp::TypedParser<std::optional<sax::ResultType<T>>>,
+      public fjp::Subscriber<sax::ResultType<T>> {
+ public:
+  OptionalParser() { parser_.Subscribe(*this); }
+
+ private:
+  void Null() override { this->SetResult(std::nullopt); }
+  void Bool(bool value) override { PushParser().Bool(value); }
+  void Int64(std::int64_t value) override { PushParser().Int64(value); }
+  void Uint64(std::uint64_t value) override { PushParser().Uint64(value); }
+  void Double(double value) override { PushParser().Double(value); }
+  void String(std::string_view value) override { PushParser().String(value); }
+  void StartObject() override { PushParser().StartObject(); }
+  void StartArray() override { PushParser().StartArray(); }
+
+  fjp::BaseParser& PushParser() {
+    parser_.Reset();
+    auto& parser = parser_.GetParser();
+    this->parser_state_->PushParser(parser);
+    return parser;
+  }
+
+  void OnSend(sax::ResultType<T>&& value) override {
+    this->SetResult(std::move(value));
+  }
+
+  std::string Expected() const override { return "value"; }
+
+  std::string GetPathItem() const override { return {}; }
+
+  Parser<T> parser_;
+};
+
+// Consumes a value of any type
+class ValueSkipper final : public fjp::BaseParser {
+ public:
+  void Reset() { level_ = 0; }
+
+ private:
+  void Null() override { MaybePopSelf(); }
+  void Bool(bool) override { MaybePopSelf(); }
+  void Int64(std::int64_t) override { MaybePopSelf(); }
+  void Uint64(std::uint64_t) override { MaybePopSelf(); }
+  void Double(double) override { MaybePopSelf(); }
+  void String(std::string_view) override { MaybePopSelf(); }
+  void StartObject() override { ++level_; }
+  void Key(std::string_view) override {}
+  void EndObject() override {
+    --level_;
+    MaybePopSelf();
+  }
+  void StartArray() override { ++level_; }
+  void EndArray() override {
+    --level_;
+    MaybePopSelf();
+  }
+
+  void MaybePopSelf() {
+    if (level_ == 0) parser_state_->PopMe(*this);
+  }
+
+  std::string Expected() const override { return "value"; }
+
+  std::string GetPathItem() const override { return {}; }
+
+  std::size_t level_{0};
+};
+
+template <typename RawType, typename... Validators>
+auto SelectPrimitiveParser() {
+  if constexpr (meta::kIsDetected<ScalarParserType, RawType>) {
+    if constexpr (sizeof...(Validators) == 0) {
+      return TypeTag<ScalarParserType<RawType>>{};
+    } else {
+      return TypeTag<ValidatingParser<RawType, Validators...>>{};
+    }
+  } else if constexpr (kHasGeneratedParser<RawType> &&
+                       sizeof...(Validators) == 0) {
+    return TypeTag<GeneratedParser<RawType>>{};
+  } else {
+    return TypeTag<DomParser<Primitive<RawType, Validators...>>>{};
+  }
+}
+
+template <typename ParseType, typename>
+struct ParserFor {
+  using Type = DomParser<ParseType>;
+};
+
+template <typename RawType, typename... Validators>
+struct ParserFor<Primitive<RawType, Validators...>> {
+  using Type = typename decltype(SelectPrimitiveParser<RawType,
+                                                       Validators...>())::Type;
+};
+
+template <typename RawType, typename UserType>
+struct ParserFor<WithType<RawType, UserType>> {
+  using Type = WithTypeParser<RawType, UserType>;
+};
+
+template <typename ItemType, typename UserType, typename... Validators>
+struct ParserFor<
+    Array<ItemType, UserType, Validators...>,
+    std::enable_if_t<meta::kIsVector<UserType> ||
+                     meta::kIsDetected<InsertResult, UserType,
+                                       ResultType<ItemType>>>> {
+  using Type = ArrayParser<ItemType, UserType, Validators...>;
+};
+
+template <typename T>
+struct ParserFor<Ref<T>> {
+  using Type = RefParser<T>;
+};
+
+template <typename T>
+struct ParserFor<std::optional<T>> {
+  using Type = OptionalParser<T>;
+};
+
+}  // namespace impl
+
+/// @brief Base class for the generated SAX parsers of objects
+///
+/// null is parsed as an empty object, the same way as the generated
+/// `Parse(formats::json::Value, To<T>)` does.
+template <typename T>
+class ObjectParser : public formats::json::parser::TypedParser<T> {
+ public:
+  void Reset() override {
+    state_ = State::kStart;
+    result_ = T{};
+  }
+
+ protected:
+  /// Returns the parser for the value of the property `name`, or nullptr if
+  /// the property is not allowed
+  virtual formats::json::parser::BaseParser* GetPropertyParser(
+      std::string_view name) = 0;
+
+  /// Checks the required properties and completes the result
+  virtual void Finish() {}
+
+  /// Returns the parser that drops the property value
+  formats::json::parser::BaseParser& SkipValue() {
+    skipper_.Reset();
+    return skipper_;
+  }
+
+  // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+  T result_;
+
+ private:
+  void Null() override {
+    if (state_ != State::kStart) this->Throw("null");
+    Complete();
+  }
+
+  void StartObject() override {
+    if (state_ != State::kStart) this->Throw("object");
+    state_ = State::kInside;
+  }
+
+  void Key(std::string_view key) override {
+    key_ = key;
+    auto* parser = GetPropertyParser(key);
+    if (!parser) {
+      throw std::runtime_error(fmt::format("Unknown property '{}'", key));
+    }
+    this->parser_state_->PushParser(*parser);
+  }
+
+  void EndObject() override {
+    key_.clear();
+    Complete();
+  }
+
+  void Complete() {
+    Finish();
+    this->SetResult(std::move(result_));
+  }
+
+  std::string Expected() const override { return "object"; }
+
+  std::string GetPathItem() const override { return key_; }
+
+  enum class State {
+    kStart,
+    kInside,
+  };
+
+  State state_{State::kStart};
+  std::string key_;
+  impl::ValueSkipper skipper_;
+};
+
+/// @brief Parser of an object property, stores the value into the field of
+/// the parsed object
+///
+/// If `ParseType` is std::optional and the field is not, null and missing
+/// values keep the default value of the field.
+template <typename ParseType, typename Field>
+class Property final
+    : public formats::json::parser::Subscriber<ResultType<ParseType>> {
+ public:
+  explicit Property(Field& field) : field_(field) { parser_.Subscribe(*this); }
+
+  void Reset() { is_set_ = false; }
+
+  formats::json::parser::BaseParser& Start(std::string_view name) {
+    if (is_set_) {
+      throw std::runtime_error(fmt::format("Duplicate key: {}", name));
+    }
+    parser_.Reset();
+    return parser_.GetParser();
+  }
+
+  void CheckRequired(std::string_view name) const {
+    if (!is_set_) {
+      throw std::runtime_error(fmt::format("Field '{}' is missing", name));
+    }
+  }
+
+ private:
+  void OnSend(ResultType<ParseType>&& value) override {
+    if constexpr (meta::kIsOptional<ResultType<ParseType>> &&
+                  !meta::kIsOptional<Field>) {
+      if (value) field_ = std::move(*value);
+    } else {
+      field_ = std::move(value);
+    }
+    is_set_ = true;
+  }
+
+  Parser<ParseType> parser_;
+  Field& field_;
+  bool is_set_{false};
+};
+
+/// Parser of `additionalProperties` of the given type
+template <typename ParseType, typename Map>
+class AdditionalProperties final
+    : public formats::json::parser::Subscriber<ResultType<ParseType>> {
+ public:
+  explicit AdditionalProperties(Map& extra) : extra_(extra) {
+    parser_.Subscribe(*this);
+  }
+
+  formats::json::parser::BaseParser& Start(std::string_view name) {
+    name_ = name;
+    parser_.Reset();
+    return parser_.GetParser();
+  }
+
+ private:
+  void OnSend(ResultType<ParseType>&& value) override {
+    extra_.emplace(std::move(name_), std::move(value));
+  }
+
+  Parser<ParseType> parser_;
+  Map& extra_;
+  std::string name_;
+};
+
+/// Parser of `additionalProperties: true`
+class AdditionalPropertiesTrue final
+    : public formats::json::parser::Subscriber<formats::json::Value> {
+ public:
+  explicit AdditionalPropertiesTrue(formats::json::Value& extra)
+      : extra_(extra) {
+    parser_.Subscribe(*this);
+  }
+
+  void Reset() { builder_ = formats::common::Type::kObject; }
+
+  formats::json::parser::BaseParser& Start(std::string_view name) {
+    name_ = name;
+    parser_.Reset();
+    return parser_;
+  }
+
+  void Finish() { extra_ = builder_.ExtractValue(); }
+
+ private:
+  void OnSend(formats::json::Value&& value) override {
+    builder_[name_] = std::move(value);
+  }
+
+  formats::json::parser::JsonValueParser parser_;
+  formats::json::Value& extra_;
+  formats::json::ValueBuilder builder_{formats::common::Type::kObject};
+  std::string name_;
+};
+
+/// @brief Parses JSON into T with the SAX parser
+/// @throws formats::json::parser::ParseError on invalid JSON and on schema
+/// violations
+template <typename T>
+T FromJsonString(std::string_view json) {
+  T result{};
+  Parser<Primitive<T>> parser;
+  parser.Reset();
+  formats::json::parser::SubscriberSink<T> sink(result);
+  parser.Subscribe(sink);
+
+  formats::json::parser::ParserState state;
+  state.PushParser(parser.GetParser());
+  state.ProcessInput(json);
+  return result;
+}
+
+}  // namespace chaotic::sax
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,59 @@
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/chaotic/binary.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+
+#include <schemas/sax.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+ns::SaxObject MakeObject(std::size_t items) {
+  ns::SaxObject object;
+  object.id = "object-id";
+  object.kind = ns::SaxObject::Kind::kFoo;
+  for (std::size_t i = 0; i < items; ++i) {
+    ns::SaxItem item;
+    item.name = "item-" + std::to_string(i);
+    item.price = 1.5;
+    item.children = std::vector<ns::SaxItem>{ns::SaxItem{"child"}};
+    object.items.push_back(std::move(item));
+  }
+  object.counters.emplace();
+  object.counters->extra = {{"x", 1}, {"y", 2}};
+  return object;
+}
+
+}  // namespace
+
+void ChaoticRoundTripJson(benchmark::State& state) {
+  const auto object = MakeObject(state.range(0));
+  std::size_t bytes = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    const auto str = formats::json::ToString(
+        formats::json::ValueBuilder{object}.ExtractValue());
+    bytes = str.size();
+    benchmark::DoNotOptimize(
+        formats::json::FromString(str).As<ns::SaxObject>());
+  }
+  state.counters["bytes"] = bytes;
+}
+BENCHMARK(ChaoticRoundTripJson)->RangeMultiplier(8)->Range(1, 4096);
+
+void ChaoticRoundTripBinary(benchmark::State& state) {
+  const auto object = MakeObject(state.range(0));
+  std::size_t bytes = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    const auto str = chaotic::binary::Encode(object);
+    bytes = str.size();
+    benchmark::DoNotOptimize(chaotic::binary::Decode<ns::SaxObject>(str));
+  }
+  state.counters["bytes"] = bytes;
+}
+BENCHMARK(ChaoticRoundTripBinary)->RangeMultiplier(8)->Range(1, 4096);
+
+USERVER_NAMESPACE_END
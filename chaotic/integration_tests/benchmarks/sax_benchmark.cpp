@@ -0,0 +1,44 @@
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/chaotic/sax_parser.hpp>
+#include <userver/formats/json/serialize.hpp>
+
+#include <schemas/sax.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string MakeSaxObject(std::size_t items) {
+  std::string str = R"({"id": "object-id", "kind": "foo", "items": [)";
+  for (std::size_t i = 0; i < items; ++i) {
+    if (i != 0) str += ',';
+    str += R"({"name": "item-)" + std::to_string(i) +
+           R"(", "price": 1.5, "children": [{"name": "child"}]})";
+  }
+  str += R"(], "counters": {"x": 1, "y": 2}})";
+  return str;
+}
+
+}  // namespace
+
+void ChaoticParseDom(benchmark::State& state) {
+  const auto str = MakeSaxObject(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(
+        formats::json::FromString(str).As<ns::SaxObject>());
+  }
+}
+BENCHMARK(ChaoticParseDom)->RangeMultiplier(8)->Range(1, 4096);
+
+void ChaoticParseSax(benchmark::State& state) {
+  const auto str = MakeSaxObject(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(chaotic::sax::FromJsonString<ns::SaxObject>(str));
+  }
+}
+BENCHMARK(ChaoticParseSax)->RangeMultiplier(8)->Range(1, 4096);
+
+USERVER_NAMESPACE_END
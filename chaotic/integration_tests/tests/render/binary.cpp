@@ -0,0 +1,87 @@
+#include <userver/utest/assert_macros.hpp>
+
+#include <userver/chaotic/binary.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+
+#include <schemas/custom_cpp_type.hpp>
+#include <schemas/oneofdiscriminator.hpp>
+#include <schemas/sax.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using chaotic::binary::Decode;
+using chaotic::binary::Encode;
+
+constexpr std::string_view kObject = R"({
+  "id": "object-id",
+  "count": 7,
+  "enabled": false,
+  "kind": "bar",
+  "tags": ["a", "b"],
+  "items": [
+    {"name": "first", "price": 1.5, "children": [{"name": "child"}]},
+    {"name": "second", "parent": {"name": "parent", "parent": {"name": "p"}}}
+  ],
+  "counters": {"x": 1, "y": 2},
+  "payload": {"nested": {"array": [1, {"key": null}]}, "string": "value"},
+  "variant": "string"
+})";
+
+}  // namespace
+
+TEST(Binary, RoundTrip) {
+  const auto obj = formats::json::FromString(kObject).As<ns::SaxObject>();
+  const auto data = Encode(obj);
+  EXPECT_EQ(Decode<ns::SaxObject>(data), obj);
+  EXPECT_LT(data.size(), formats::json::ToString(
+                             formats::json::ValueBuilder{obj}.ExtractValue())
+                             .size());
+
+  const ns::SaxObject empty{};
+  EXPECT_EQ(Decode<ns::SaxObject>(Encode(empty)), empty);
+}
+
+TEST(Binary, NoBinaryCodecSubtypes) {
+  // Custom types, allOf, oneOf with discriminator and enums
+  const auto json = formats::json::FromString(R"({
+    "integer": 12,
+    "sizet": 3,
+    "boolean": true,
+    "number": 1.23,
+    "string": "make love",
+    "decimal": "12.3456789",
+    "object": {"foo": "bar"},
+    "std_array": ["bar", "foo"],
+    "custom_array": ["foo", "bar"],
+    "allOf": {"field1": "foo", "field2": "bar"},
+    "oneOf": 5,
+    "oneOfWithDiscriminator": {"type": "CustomStruct1", "field1": 3}
+  })");
+  const auto custom = json.As<ns::ObjWithCustom>();
+  const auto decoded = Decode<ns::ObjWithCustom>(Encode(custom));
+  EXPECT_EQ(formats::json::ValueBuilder{decoded}.ExtractValue(), json);
+
+  const auto discriminator_json = formats::json::FromString(
+      R"({"foo": {"type": "bbb", "b_prop": 2, "extra": [1]}})");
+  const auto discriminator = discriminator_json.As<ns::OneOfDiscriminator>();
+  EXPECT_EQ(Decode<ns::OneOfDiscriminator>(Encode(discriminator)),
+            discriminator);
+}
+
+TEST(Binary, Errors) {
+  const auto data =
+      Encode(formats::json::FromString(kObject).As<ns::SaxObject>());
+
+  UEXPECT_THROW_MSG(Decode<ns::SaxObject>(data.substr(0, data.size() - 1)),
+                    chaotic::binary::Error, "Unexpected end of binary data");
+  UEXPECT_THROW_MSG(Decode<ns::SaxObject>(data + '\0'), chaotic::binary::Error,
+                    "Unexpected data after the binary value");
+  UEXPECT_THROW_MSG(Decode<ns::SaxItem>(data), chaotic::binary::Error,
+                    "another schema");
+  UEXPECT_THROW(Decode<ns::SaxObject>(""), chaotic::binary::Error);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,106 @@
+#include <userver/utest/assert_macros.hpp>
+
+#include <userver/chaotic/sax_parser.hpp>
+#include <userver/formats/json/parser/exception.hpp>
+#include <userver/formats/json/serialize.hpp>
+
+#include <schemas/sax.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using chaotic::sax::FromJsonString;
+using formats::json::parser::ParseError;
+
+constexpr std::string_view kObject = R"({
+  "id": "object-id",
+  "enabled": null,
+  "kind": "bar",
+  "tags": ["a", "b"],
+  "items": [
+    {"name": "first", "price": 1.5, "children": [{"name": "child"}]},
+    {"name": "second", "parent": {"name": "parent", "parent": {"name": "p"}}}
+  ],
+  "counters": {"x": 1, "y": 2},
+  "payload": {"nested": {"array": [1, {"key": null}]}, "string": "value"},
+  "variant": "string"
+})";
+
+}  // namespace
+
+TEST(Sax, Object) {
+  const auto obj = FromJsonString<ns::SaxObject>(kObject);
+  EXPECT_EQ(obj.id, "object-id");
+  EXPECT_EQ(obj.count, 10);
+  EXPECT_EQ(obj.enabled, std::nullopt);
+  EXPECT_EQ(obj.kind, ns::SaxObject::Kind::kBar);
+  ASSERT_EQ(obj.items.size(), 2);
+  EXPECT_EQ(obj.items[0].children->at(0).name, "child");
+  EXPECT_EQ((*obj.items[1].parent)->name, "parent");
+  EXPECT_EQ(obj.counters->extra.at("y"), 2);
+  EXPECT_EQ(obj.payload->extra["nested"]["array"][1],
+            formats::json::FromString(R"({"key": null})"));
+  EXPECT_EQ(std::get<std::string>(*obj.variant), "string");
+
+  EXPECT_EQ(obj, formats::json::FromString(kObject).As<ns::SaxObject>());
+}
+
+TEST(Sax, Defaults) {
+  auto obj = FromJsonString<ns::SaxObject>(R"({"id": "", "items": []})");
+  EXPECT_EQ(obj.count, 10);
+  EXPECT_EQ(obj.tags, std::nullopt);
+
+  obj = FromJsonString<ns::SaxObject>(
+      R"({"id": "", "items": [], "count": null, "enabled": false})");
+  EXPECT_EQ(obj.count, 10);
+  EXPECT_EQ(obj.enabled, false);
+
+  // null is parsed as an empty object
+  EXPECT_EQ(FromJsonString<ns::SaxLooseObject>("null"), ns::SaxLooseObject{});
+}
+
+TEST(Sax, Validation) {
+  UEXPECT_THROW_MSG(FromJsonString<ns::SaxObject>(R"({"items": []})"),
+                    ParseError, "Field 'id' is missing");
+  UEXPECT_THROW_MSG(
+      FromJsonString<ns::SaxObject>(R"({"id": "", "items": [], "count": -1})"),
+      ParseError, "path 'count': Invalid value, minimum=0, given=-1");
+  UEXPECT_THROW_MSG(
+      FromJsonString<ns::SaxObject>(R"({"id": "", "items": [{"name": ""}]})"),
+      ParseError, "path 'items.[0].name': Too short string");
+  UEXPECT_THROW_MSG(FromJsonString<ns::SaxObject>(
+                        R"({"id": "", "items": [], "tags": ["1", "2", "3", "4"]})"),
+                    ParseError, "path 'tags': Too long array");
+  UEXPECT_THROW_MSG(FromJsonString<ns::SaxObject>(
+                        R"({"id": "", "items": [], "counters": {"x": -1}})"),
+                    ParseError, "path 'counters.x': Invalid value");
+  UEXPECT_THROW_MSG(FromJsonString<ns::SaxObject>(
+                        R"({"id": "", "items": [], "kind": "unknown"})"),
+                    ParseError, "Invalid enum value (unknown)");
+  UEXPECT_THROW_MSG(
+      FromJsonString<ns::SaxObject>(R"({"id": 1, "items": []})"), ParseError,
+      "path 'id': string was expected, but integer found");
+}
+
+TEST(Sax, AdditionalProperties) {
+  UEXPECT_THROW_MSG(FromJsonString<ns::SaxObject>(
+                        R"({"id": "", "items": [], "unknown": {"a": 1}})"),
+                    ParseError, "Unknown property 'unknown'");
+  UEXPECT_THROW_MSG(FromJsonString<ns::SaxObject>(
+                        R"({"id": "", "items": [], "id": "other"})"),
+                    ParseError, "Duplicate key: id");
+
+  const auto obj = FromJsonString<ns::SaxLooseObject>(
+      R"({"a": {"b": [1, {}, []]}, "known": 1, "c": null})");
+  EXPECT_EQ(obj.known, 1);
+}
+
+TEST(Sax, InvalidJson) {
+  UEXPECT_THROW(FromJsonString<ns::SaxObject>(R"({"id": "", "items": [})"),
+                ParseError);
+  UEXPECT_THROW(FromJsonString<ns::SaxObject>(R"([])"), ParseError);
+  UEXPECT_THROW(FromJsonString<ns::SaxObject>(""), ParseError);
+}
+
+USERVER_NAMESPACE_END
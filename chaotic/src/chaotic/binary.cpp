@@ -0,0 +1,111 @@
+#include <userver/chaotic/binary.hpp>
+
+#include <cstring>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace chaotic::binary {
+
+namespace {
+
+constexpr std::size_t kMaxVarintSize = 10;
+
+}  // namespace
+
+void Writer::WriteVarint(std::uint64_t value) {
+  char data[kMaxVarintSize];
+  std::size_t size = 0;
+  while (value >= 0x80) {
+    data[size++] = static_cast<char>((value & 0x7f) | 0x80);
+    value >>= 7;
+  }
+  data[size++] = static_cast<char>(value);
+  buffer_.append(data, size);
+}
+
+void Writer::WriteSigned(std::int64_t value) {
+  // zigzag, so that small negative values are short too
+  const auto unsigned_value = static_cast<std::uint64_t>(value);
+  WriteVarint((unsigned_value << 1) ^ (value < 0 ? ~std::uint64_t{0} : 0));
+}
+
+void Writer::WriteFixed64(std::uint64_t value) {
+  char data[sizeof(value)];
+  for (auto& byte : data) {
+    byte = static_cast<char>(value & 0xff);
+    value >>= 8;
+  }
+  buffer_.append(data, sizeof(data));
+}
+
+void Writer::WriteDouble(double value) {
+  static_assert(sizeof(double) == sizeof(std::uint64_t));
+  std::uint64_t bits{};
+  std::memcpy(&bits, &value, sizeof(bits));
+  WriteFixed64(bits);
+}
+
+void Writer::WriteBool(bool value) { buffer_.push_back(value ? 1 : 0); }
+
+void Writer::WriteBytes(std::string_view value) {
+  WriteVarint(value.size());
+  buffer_.append(value);
+}
+
+std::uint64_t Reader::ReadVarint() {
+  std::uint64_t result = 0;
+  for (std::size_t shift = 0; shift < kMaxVarintSize * 7; shift += 7) {
+    const auto byte = static_cast<unsigned char>(Take(1)[0]);
+    result |= std::uint64_t{byte & 0x7fu} << shift;
+    if (!(byte & 0x80)) return result;
+  }
+  throw Error("Too long varint in binary data");
+}
+
+std::int64_t Reader::ReadSigned() {
+  const auto value = ReadVarint();
+  return static_cast<std::int64_t>((value >> 1) ^ (~(value & 1) + 1));
+}
+
+std::uint64_t Reader::ReadFixed64() {
+  const auto data = Take(sizeof(std::uint64_t));
+  std::uint64_t result = 0;
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    result |= std::uint64_t{static_cast<unsigned char>(data[i])} << (i * 8);
+  }
+  return result;
+}
+
+double Reader::ReadDouble() {
+  const auto bits = ReadFixed64();
+  double result{};
+  std::memcpy(&result, &bits, sizeof(result));
+  return result;
+}
+
+bool Reader::ReadBool() {
+  const auto byte = Take(1)[0];
+  if (byte != 0 && byte != 1) throw Error("Invalid bool in binary data");
+  return byte == 1;
+}
+
+std::string_view Reader::ReadBytes() {
+  const auto size = ReadVarint();
+  if (size > data_.size()) throw Error("Unexpected end of binary data");
+  return Take(size);
+}
+
+void Reader::Finish() const {
+  if (!data_.empty()) throw Error("Unexpected data after the binary value");
+}
+
+std::string_view Reader::Take(std::size_t size) {
+  if (size > data_.size()) throw Error("Unexpected end of binary data");
+  const auto result = data_.substr(0, size);
+  data_.remove_prefix(size);
+  return result;
+}
+
+}  // namespace chaotic::binary
+
+USERVER_NAMESPACE_END
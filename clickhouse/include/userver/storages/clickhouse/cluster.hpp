@@ -60,6 +60,29 @@ class Cluster final {
   ExecutionResult Execute(OptionalCommandControl, const Query& query,
                           const Args&... args) const;
 
+  /// @brief Execute a statement at some host of the cluster with args as
+  /// query parameters, handing each received block of the result to the
+  /// callback as soon as it arrives.
+  ///
+  /// The next blocks are read from the network while the callback processes
+  /// the current one. At most a couple of received blocks wait for the
+  /// callback, so the memory usage doesn't grow with the size of the result.
+  /// Blocks without rows are skipped.
+  /// @note The execute timeout of the command control limits the whole
+  /// streaming, including the time spent in the callback.
+  template <typename... Args>
+  void ExecuteStreaming(const BlockCallback& callback, const Query& query,
+                        const Args&... args) const;
+
+  /// @brief Execute a statement with specified command control settings
+  /// at some host of the cluster with args as query parameters, handing each
+  /// received block of the result to the callback as soon as it arrives.
+  ///
+  /// @see ExecuteStreaming
+  template <typename... Args>
+  void ExecuteStreaming(OptionalCommandControl, const BlockCallback& callback,
+                        const Query& query, const Args&... args) const;
+
   /// @brief Insert data at some host of the cluster;
   /// `T` is expected to be a struct of vectors of same length.
   /// @param table_name table to insert into
@@ -131,6 +154,9 @@ class Cluster final {
 
   ExecutionResult DoExecute(OptionalCommandControl, const Query& query) const;
 
+  void DoExecuteStreaming(OptionalCommandControl, const Query& query,
+                          const BlockCallback& callback) const;
+
   const impl::Pool& GetPool() const;
 
   std::vector<impl::Pool> pools_;
@@ -189,6 +215,20 @@ ExecutionResult Cluster::Execute(OptionalCommandControl optional_cc,
   return DoExecute(optional_cc, formatted_query);
 }
 
+template <typename... Args>
+void Cluster::ExecuteStreaming(const BlockCallback& callback,
+                               const Query& query, const Args&... args) const {
+  ExecuteStreaming(OptionalCommandControl{}, callback, query, args...);
+}
+
+template <typename... Args>
+void Cluster::ExecuteStreaming(OptionalCommandControl optional_cc,
+                               const BlockCallback& callback,
+                               const Query& query, const Args&... args) const {
+  const auto formatted_query = query.WithArgs(args...);
+  DoExecuteStreaming(optional_cc, formatted_query, callback);
+}
+
 }  // namespace storages::clickhouse
 
 USERVER_NAMESPACE_END
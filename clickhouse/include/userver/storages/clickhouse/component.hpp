@@ -49,8 +49,13 @@ namespace components {
 /// initial_pool_size     | number of connections created initially          | 5
 /// max_pool_size         | maximum number of created connections            | 10
 /// queue_timeout         | client waiting for a free connection time limit  | 1s
+/// insert_chunk_rows     | rows per part of an insert sent concurrently, 0 disables the splitting | 0
 /// use_secure_connection | whether to use TLS for connections               | true
-/// compression           | compression method to use (none / lz4)           | none
+/// compression           | compression method to use (none / lz4 / zstd)    | none
+///
+/// The parts of a split insert are inserted independently over different
+/// connections, so a failed insert may leave some of its parts inserted and
+/// temporary tables can't be inserted into this way.
 
 // clang-format on
 
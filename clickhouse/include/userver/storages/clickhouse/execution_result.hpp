@@ -3,6 +3,7 @@
 /// @file userver/storages/clickhouse/execution_result.hpp
 /// @brief Result accessor.
 
+#include <functional>
 #include <memory>
 #include <type_traits>
 
@@ -61,6 +62,9 @@ class ExecutionResult final {
   impl::BlockWrapperPtr block_;
 };
 
+/// Callback that is called with each received block of a streamed result
+using BlockCallback = std::function<void(ExecutionResult&&)>;
+
 template <typename T>
 T ExecutionResult::As() && {
   UASSERT(block_);
@@ -29,6 +29,9 @@ class Pool final {
 
   ExecutionResult Execute(OptionalCommandControl, const Query& query) const;
 
+  void ExecuteStreaming(OptionalCommandControl, const Query& query,
+                        const BlockCallback& callback) const;
+
   void Insert(OptionalCommandControl, const InsertionRequest& request) const;
 
   void WriteStatistics(
@@ -37,6 +40,9 @@ class Pool final {
   bool IsAvailable() const;
 
  private:
+  void InsertInParts(OptionalCommandControl, const InsertionRequest& request,
+                     size_t parts_count) const;
+
   std::shared_ptr<PoolImpl> impl_;
 };
 }  // namespace impl
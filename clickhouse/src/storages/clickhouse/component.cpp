@@ -68,13 +68,20 @@ properties:
         type: string
         description: client waiting for a free connection time limit
         defaultDescription: 1s
+    insert_chunk_rows:
+        type: integer
+        description: |
+            inserts of more rows are split into parts of at most that many
+            rows sent concurrently over several connections, 0 disables
+            the splitting
+        defaultDescription: 0
     use_secure_connection:
         type: boolean
         description: whether to use TLS for connections
         defaultDescription: true
     compression:
         type: string
-        description: compression method to use (none / lz4)
+        description: compression method to use (none / lz4 / zstd)
         defaultDescription: none
 )");
 }
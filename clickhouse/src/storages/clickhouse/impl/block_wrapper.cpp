@@ -23,6 +23,16 @@ void BlockWrapper::AppendColumn(std::string_view name,
 
 const clickhouse_cpp::Block& BlockWrapper::GetNative() const { return native_; }
 
+BlockWrapper BlockWrapper::Slice(size_t begin, size_t len) const {
+  const auto columns_count = native_.GetColumnCount();
+  clickhouse_cpp::Block block{columns_count, len};
+  for (size_t i = 0; i < columns_count; ++i) {
+    block.AppendColumn(native_.GetColumnName(i), native_[i]->Slice(begin, len));
+  }
+
+  return BlockWrapper{std::move(block)};
+}
+
 void BlockWrapperDeleter::operator()(BlockWrapper* ptr) const noexcept {
   std::default_delete<BlockWrapper>{}(ptr);
 }
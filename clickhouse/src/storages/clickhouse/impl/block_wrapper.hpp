@@ -25,6 +25,9 @@ class BlockWrapper final {
 
   const clickhouse_cpp::Block& GetNative() const;
 
+  /// Copies `len` rows starting from `begin` into a new block
+  BlockWrapper Slice(size_t begin, size_t len) const;
+
  private:
   clickhouse_cpp::Block native_;
 };
@@ -6,11 +6,13 @@
 #include <clickhouse/query.h>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
+#include <userver/concurrent/queue.hpp>
 #include <userver/engine/task/task.hpp>
 #include <userver/storages/clickhouse/impl/insertion_request.hpp>
 #include <userver/storages/clickhouse/query.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 
 #include <storages/clickhouse/impl/block_wrapper.hpp>
 #include <storages/clickhouse/impl/native_client_factory.hpp>
@@ -26,6 +28,12 @@ using NativeBlock = clickhouse_cpp::Block;
 
 constexpr std::chrono::milliseconds kDefaultExecuteTimeout{750};
 
+// The received blocks of a streamed result waiting to be processed, the reads
+// from the network stall once that many blocks are waiting
+constexpr std::size_t kStreamingQueueSize = 2;
+
+using BlocksQueue = concurrent::SpscQueue<BlockWrapperPtr>;
+
 void AppendToBlock(NativeBlock& result, const NativeBlock& new_data) {
   if (new_data.GetColumnCount() == 0) return;
   if (result.GetRowCount() == 0) {
@@ -76,9 +84,10 @@ class Connection::ConnectionBrokenGuard final {
 Connection::Connection(clients::dns::Resolver& resolver,
                        const EndpointSettings& endpoint,
                        const AuthSettings& auth,
-                       const ConnectionSettings& connection_settings)
+                       const ConnectionSettings& connection_settings,
+                       stats::PoolTrafficStatistics& traffic)
     : client_{NativeClientFactory::Create(resolver, endpoint, auth,
-                                          connection_settings)} {}
+                                          connection_settings, traffic)} {}
 
 ExecutionResult Connection::Execute(OptionalCommandControl optional_cc,
                                     const Query& query) {
@@ -104,13 +113,57 @@ ExecutionResult Connection::Execute(OptionalCommandControl optional_cc,
   return ExecutionResult{BlockWrapperPtr{result_ptr.release()}};
 }
 
+void Connection::ExecuteStreaming(OptionalCommandControl optional_cc,
+                                  const Query& query,
+                                  const BlockCallback& callback) {
+  auto queue = BlocksQueue::Create(kStreamingQueueSize);
+  auto consumer = queue->GetConsumer();
+
+  // the blocks are received in a separate task, so that the next block is
+  // read from the network while the callback processes the current one
+  auto reader_task = USERVER_NAMESPACE::utils::Async(
+      "clickhouse_streaming_read",
+      [this, optional_cc, &query,
+       producer_holder = queue->GetProducer()]() mutable {
+        // the consumer stops waiting for blocks once the producer is gone
+        const auto producer = std::move(producer_holder);
+        bool consumer_alive = true;
+
+        clickhouse_cpp::Query native_query{query.QueryText()};
+        native_query.OnData([&producer, &consumer_alive](
+                                const NativeBlock& data) {
+          if (data.GetRowCount() == 0 || !consumer_alive) return;
+          auto block_ptr = std::make_unique<BlockWrapper>(NativeBlock{data});
+          consumer_alive =
+              producer.Push(BlockWrapperPtr{block_ptr.release()});
+        });
+        native_query.OnDataCancelable(
+            [&consumer_alive]([[maybe_unused]] const auto& block) {
+              // we must return 'true' if we don't want to cancel query
+              return consumer_alive && !engine::current_task::ShouldCancel();
+            });
+
+        DoExecute(optional_cc, native_query);
+      });
+
+  BlockWrapperPtr block;
+  while (consumer.Pop(block)) {
+    callback(ExecutionResult{std::move(block)});
+  }
+
+  reader_task.Get();
+}
+
 void Connection::Insert(OptionalCommandControl optional_cc,
                         const InsertionRequest& request) {
-  const auto& block = request.GetBlock();
+  Insert(optional_cc, request.GetTableName(), request.GetBlock());
+}
 
+void Connection::Insert(OptionalCommandControl optional_cc,
+                        const std::string& table_name,
+                        const BlockWrapper& block) {
   auto guard = GetBrokenGuard();
-  client_.Insert(request.GetTableName(), block.GetNative(),
-                 GetDeadline(optional_cc));
+  client_.Insert(table_name, block.GetNative(), GetDeadline(optional_cc));
 }
 
 void Connection::Ping() {
@@ -7,6 +7,7 @@
 #include <userver/storages/clickhouse/options.hpp>
 
 #include <storages/clickhouse/impl/native_client_factory.hpp>
+#include <storages/clickhouse/stats/pool_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -20,16 +21,24 @@ struct EndpointSettings;
 struct AuthSettings;
 struct ConnectionSettings;
 class InsertionRequest;
+class BlockWrapper;
 
 class Connection final {
  public:
   Connection(clients::dns::Resolver&, const EndpointSettings&,
-             const AuthSettings&, const ConnectionSettings&);
+             const AuthSettings&, const ConnectionSettings&,
+             stats::PoolTrafficStatistics&);
 
   ExecutionResult Execute(OptionalCommandControl, const Query&);
 
+  void ExecuteStreaming(OptionalCommandControl, const Query&,
+                        const BlockCallback&);
+
   void Insert(OptionalCommandControl, const InsertionRequest&);
 
+  void Insert(OptionalCommandControl, const std::string& table_name,
+              const BlockWrapper& block);
+
   void Ping();
 
   bool IsBroken() const noexcept;
@@ -0,0 +1,119 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <userver/storages/clickhouse/impl/insertion_request.hpp>
+#include <userver/storages/clickhouse/io/columns/datetime64_column.hpp>
+#include <userver/storages/clickhouse/io/columns/string_column.hpp>
+#include <userver/storages/clickhouse/io/columns/uint64_column.hpp>
+
+#include <storages/clickhouse/impl/block_wrapper.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct TelemetryData final {
+  std::vector<uint64_t> ids;
+  std::vector<std::string> names;
+  std::vector<std::chrono::system_clock::time_point> timestamps;
+};
+
+struct TelemetryRow final {
+  uint64_t id;
+  std::string name;
+  std::chrono::system_clock::time_point timestamp;
+};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<TelemetryData> {
+  using mapped_type =
+      std::tuple<columns::UInt64Column, columns::StringColumn,
+                 columns::DateTime64ColumnNano>;
+};
+
+template <>
+struct CppToClickhouse<TelemetryRow> {
+  using mapped_type =
+      std::tuple<columns::UInt64Column, columns::StringColumn,
+                 columns::DateTime64ColumnNano>;
+};
+
+}  // namespace storages::clickhouse::io
+
+namespace {
+
+using storages::clickhouse::impl::InsertionRequest;
+
+const std::string kTableName = "telemetry";
+const std::vector<std::string_view> kColumnNames{"id", "name", "timestamp"};
+
+TelemetryData MakeData(std::size_t rows) {
+  TelemetryData data;
+  const auto now = std::chrono::system_clock::now();
+  for (std::size_t i = 0; i < rows; ++i) {
+    data.ids.push_back(i);
+    data.names.push_back("name_" + std::to_string(i % 100));
+    data.timestamps.push_back(now + std::chrono::seconds{i});
+  }
+  return data;
+}
+
+std::vector<TelemetryRow> MakeRows(std::size_t rows) {
+  const auto data = MakeData(rows);
+  std::vector<TelemetryRow> result;
+  result.reserve(rows);
+  for (std::size_t i = 0; i < rows; ++i) {
+    result.push_back({data.ids[i], data.names[i], data.timestamps[i]});
+  }
+  return result;
+}
+
+}  // namespace
+
+void ClickhouseInsertColumns(benchmark::State& state) {
+  const auto data = MakeData(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    auto request = InsertionRequest::Create(kTableName, kColumnNames, data);
+    benchmark::DoNotOptimize(request);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(ClickhouseInsertColumns)->RangeMultiplier(8)->Range(8, 1 << 18);
+
+void ClickhouseInsertRows(benchmark::State& state) {
+  const auto rows = MakeRows(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    auto request =
+        InsertionRequest::CreateFromRows(kTableName, kColumnNames, rows);
+    benchmark::DoNotOptimize(request);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(ClickhouseInsertRows)->RangeMultiplier(8)->Range(8, 1 << 18);
+
+void ClickhouseInsertSlice(benchmark::State& state) {
+  const auto data = MakeData(state.range(0));
+  const auto request = InsertionRequest::Create(kTableName, kColumnNames, data);
+  const auto& block = request.GetBlock();
+  const auto rows = block.GetRowsCount();
+  const auto part_rows = rows / 8;
+  for ([[maybe_unused]] auto _ : state) {
+    for (std::size_t begin = 0; begin < rows; begin += part_rows) {
+      auto part = block.Slice(begin, std::min(part_rows, rows - begin));
+      benchmark::DoNotOptimize(part);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(ClickhouseInsertSlice)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+USERVER_NAMESPACE_END
@@ -33,14 +33,16 @@ using TlsSocket = engine::io::TlsWrapper;
 
 using ConnectionMode = ConnectionSettings::ConnectionMode;
 using CompressionMethod = ConnectionSettings::CompressionMethod;
+using TrafficStatistics = stats::PoolTrafficStatistics;
 
 constexpr std::chrono::milliseconds kConnectTimeout{1500};
 
 template <typename T>
 class ClickhouseSocketInput final : public clickhouse_cpp::InputStream {
  public:
-  ClickhouseSocketInput(T& socket, engine::Deadline& deadline)
-      : socket_{socket}, deadline_{deadline} {}
+  ClickhouseSocketInput(T& socket, engine::Deadline& deadline,
+                        TrafficStatistics& traffic)
+      : socket_{socket}, deadline_{deadline}, traffic_{traffic} {}
   ~ClickhouseSocketInput() override = default;
 
  protected:
@@ -53,19 +55,22 @@ class ClickhouseSocketInput final : public clickhouse_cpp::InputStream {
 
     if (!read) throw engine::io::IoException{"socket reset by peer"};
 
+    traffic_.bytes_received += read;
     return read;
   }
 
  private:
   T& socket_;
   engine::Deadline& deadline_;
+  TrafficStatistics& traffic_;
 };
 
 template <typename T>
 class ClickhouseSocketOutput final : public clickhouse_cpp::OutputStream {
  public:
-  ClickhouseSocketOutput(T& socket, engine::Deadline& deadline)
-      : socket_{socket}, deadline_{deadline} {}
+  ClickhouseSocketOutput(T& socket, engine::Deadline& deadline,
+                         TrafficStatistics& traffic)
+      : socket_{socket}, deadline_{deadline}, traffic_{traffic} {}
   ~ClickhouseSocketOutput() override = default;
 
  protected:
@@ -75,12 +80,14 @@ class ClickhouseSocketOutput final : public clickhouse_cpp::OutputStream {
     const auto sent = socket_.SendAll(data, len, deadline_);
     if (sent != len) throw engine::io::IoException{"broken pipe?"};
 
+    traffic_.bytes_sent += sent;
     return sent;
   }
 
  private:
   T& socket_;
   engine::Deadline& deadline_;
+  TrafficStatistics& traffic_;
 };
 
 Socket CreateSocket(engine::io::Sockaddr addr, engine::Deadline deadline) {
@@ -93,48 +100,57 @@ Socket CreateSocket(engine::io::Sockaddr addr, engine::Deadline deadline) {
 
 class ClickhouseSocketAdapter : public clickhouse_cpp::SocketBase {
  public:
-  ClickhouseSocketAdapter(engine::io::Sockaddr addr, engine::Deadline& deadline)
-      : deadline_{deadline}, socket_{CreateSocket(addr, deadline_)} {}
+  ClickhouseSocketAdapter(engine::io::Sockaddr addr, engine::Deadline& deadline,
+                          TrafficStatistics& traffic)
+      : deadline_{deadline},
+        traffic_{traffic},
+        socket_{CreateSocket(addr, deadline_)} {}
 
   ~ClickhouseSocketAdapter() override { socket_.Close(); }
 
   std::unique_ptr<clickhouse_cpp::InputStream> makeInputStream()
       const override {
-    return std::make_unique<ClickhouseSocketInput<Socket>>(socket_, deadline_);
+    return std::make_unique<ClickhouseSocketInput<Socket>>(socket_, deadline_,
+                                                           traffic_);
   }
 
   std::unique_ptr<clickhouse_cpp::OutputStream> makeOutputStream()
       const override {
-    return std::make_unique<ClickhouseSocketOutput<Socket>>(socket_, deadline_);
+    return std::make_unique<ClickhouseSocketOutput<Socket>>(socket_, deadline_,
+                                                            traffic_);
   }
 
  private:
   engine::Deadline& deadline_;
+  TrafficStatistics& traffic_;
   mutable Socket socket_;
 };
 
 class ClickhouseTlsSocketAdapter : public clickhouse_cpp::SocketBase {
  public:
   ClickhouseTlsSocketAdapter(engine::io::Sockaddr addr,
-                             engine::Deadline& deadline)
+                             engine::Deadline& deadline,
+                             TrafficStatistics& traffic)
       : deadline_{deadline},
+        traffic_{traffic},
         tls_socket_{engine::io::TlsWrapper::StartTlsClient(
             CreateSocket(addr, deadline_), {}, deadline_)} {}
 
   std::unique_ptr<clickhouse_cpp::InputStream> makeInputStream()
       const override {
-    return std::make_unique<ClickhouseSocketInput<TlsSocket>>(tls_socket_,
-                                                              deadline_);
+    return std::make_unique<ClickhouseSocketInput<TlsSocket>>(
+        tls_socket_, deadline_, traffic_);
   }
 
   std::unique_ptr<clickhouse_cpp::OutputStream> makeOutputStream()
       const override {
-    return std::make_unique<ClickhouseSocketOutput<TlsSocket>>(tls_socket_,
-                                                               deadline_);
+    return std::make_unique<ClickhouseSocketOutput<TlsSocket>>(
+        tls_socket_, deadline_, traffic_);
   }
 
  private:
   engine::Deadline& deadline_;
+  TrafficStatistics& traffic_;
   mutable TlsSocket tls_socket_;
 };
 
@@ -168,10 +184,12 @@ class ClickhouseCppSocketFactoryHack : public clickhouse_cpp::SocketFactory {
 class ClickhouseSocketFactory final : public ClickhouseCppSocketFactoryHack {
  public:
   ClickhouseSocketFactory(clients::dns::Resolver& resolver, ConnectionMode mode,
-                          engine::Deadline& operations_deadline)
+                          engine::Deadline& operations_deadline,
+                          TrafficStatistics& traffic)
       : resolver_{resolver},
         mode_{mode},
-        operations_deadline_{operations_deadline} {}
+        operations_deadline_{operations_deadline},
+        traffic_{traffic} {}
 
   ~ClickhouseSocketFactory() override = default;
 
@@ -195,10 +213,10 @@ class ClickhouseSocketFactory final : public ClickhouseCppSocketFactoryHack {
         switch (mode_) {
           case ConnectionMode::kNonSecure:
             return std::make_unique<ClickhouseSocketAdapter>(
-                current_addr, operations_deadline_);
+                current_addr, operations_deadline_, traffic_);
           case ConnectionMode::kSecure:
             return std::make_unique<ClickhouseTlsSocketAdapter>(
-                current_addr, operations_deadline_);
+                current_addr, operations_deadline_, traffic_);
         }
       } catch (const std::exception&) {
       }
@@ -213,6 +231,7 @@ class ClickhouseSocketFactory final : public ClickhouseCppSocketFactoryHack {
   ConnectionMode mode_;
 
   engine::Deadline& operations_deadline_;
+  TrafficStatistics& traffic_;
 };
 
 clickhouse_cpp::CompressionMethod GetCompressionMethod(
@@ -222,6 +241,8 @@ clickhouse_cpp::CompressionMethod GetCompressionMethod(
       return clickhouse_cpp::CompressionMethod::None;
     case CompressionMethod::kLZ4:
       return clickhouse_cpp::CompressionMethod::LZ4;
+    case CompressionMethod::kZSTD:
+      return clickhouse_cpp::CompressionMethod::ZSTD;
   }
   UINVARIANT(false, "Invalid value of CompressionMethod enum");
 }
@@ -230,11 +251,12 @@ clickhouse_cpp::CompressionMethod GetCompressionMethod(
 
 NativeClientWrapper::NativeClientWrapper(
     clients::dns::Resolver& resolver,
-    const clickhouse_cpp::ClientOptions& options, ConnectionMode mode) {
+    const clickhouse_cpp::ClientOptions& options, ConnectionMode mode,
+    TrafficStatistics& traffic) {
   SetDeadline(engine::Deadline::FromDuration(kConnectTimeout));
 
   auto socket_factory = std::make_unique<ClickhouseSocketFactory>(
-      resolver, mode, operations_deadline_);
+      resolver, mode, operations_deadline_, traffic);
   native_client_ = std::make_unique<clickhouse_cpp::Client>(
       options, std::move(socket_factory));
 }
@@ -265,7 +287,8 @@ void NativeClientWrapper::SetDeadline(engine::Deadline deadline) {
 
 NativeClientWrapper NativeClientFactory::Create(
     clients::dns::Resolver& resolver, const EndpointSettings& endpoint,
-    const AuthSettings& auth, const ConnectionSettings& connection_settings) {
+    const AuthSettings& auth, const ConnectionSettings& connection_settings,
+    TrafficStatistics& traffic) {
   const auto options = clickhouse_cpp::ClientOptions{}
                            .SetHost(endpoint.host)
                            .SetPort(endpoint.port)
@@ -277,7 +300,7 @@ NativeClientWrapper NativeClientFactory::Create(
 
   tracing::Span span{scopes::kConnect};
   return NativeClientWrapper{resolver, options,
-                             connection_settings.connection_mode};
+                             connection_settings.connection_mode, traffic};
 }
 
 }  // namespace storages::clickhouse::impl
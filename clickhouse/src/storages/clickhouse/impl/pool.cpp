@@ -1,10 +1,17 @@
 #include <userver/storages/clickhouse/impl/pool.hpp>
 
+#include <algorithm>
+#include <vector>
+
+#include <userver/engine/get_all.hpp>
+#include <userver/storages/clickhouse/impl/insertion_request.hpp>
 #include <userver/storages/clickhouse/query.hpp>
+#include <userver/utils/async.hpp>
 
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tags.hpp>
 
+#include <storages/clickhouse/impl/block_wrapper.hpp>
 #include <storages/clickhouse/impl/connection.hpp>
 #include <storages/clickhouse/impl/connection_ptr.hpp>
 #include <storages/clickhouse/impl/pool_impl.hpp>
@@ -25,6 +32,18 @@ tracing::Span PrepareExecutionSpan(const std::string& scope,
   return span;
 }
 
+// A large insert is split into parts of at most `insert_chunk_rows` rows that
+// are sent concurrently, each over its own connection of the pool
+size_t GetInsertPartsCount(size_t rows, const PoolSettings& settings) {
+  if (!settings.insert_chunk_rows || rows <= settings.insert_chunk_rows) {
+    return 1;
+  }
+
+  const auto parts_count =
+      (rows + settings.insert_chunk_rows - 1) / settings.insert_chunk_rows;
+  return std::min(parts_count, std::max(settings.max_pool_size, size_t{1}));
+}
+
 }  // namespace
 
 Pool::Pool(clients::dns::Resolver& resolver, PoolSettings&& settings)
@@ -45,8 +64,28 @@ ExecutionResult Pool::Execute(OptionalCommandControl optional_cc,
   return conn_ptr->Execute(optional_cc, query);
 }
 
+void Pool::ExecuteStreaming(OptionalCommandControl optional_cc,
+                            const Query& query,
+                            const BlockCallback& callback) const {
+  auto conn_ptr = impl_->Acquire();
+
+  auto span = PrepareExecutionSpan(impl::scopes::kQuery, impl_->GetHostName());
+  query.FillSpanTags(span);
+
+  const auto timer = impl_->GetExecuteTimer();
+  conn_ptr->ExecuteStreaming(optional_cc, query, callback);
+}
+
 void Pool::Insert(OptionalCommandControl optional_cc,
                   const InsertionRequest& request) const {
+  const auto& block = request.GetBlock();
+  const auto rows = block.GetRowsCount();
+  const auto parts_count = GetInsertPartsCount(rows, impl_->GetSettings());
+  if (parts_count > 1) {
+    InsertInParts(optional_cc, request, parts_count);
+    return;
+  }
+
   auto conn_ptr = impl_->Acquire();
 
   auto span = PrepareExecutionSpan(impl::scopes::kInsert, impl_->GetHostName());
@@ -55,6 +94,34 @@ void Pool::Insert(OptionalCommandControl optional_cc,
   conn_ptr->Insert(optional_cc, request);
 }
 
+void Pool::InsertInParts(OptionalCommandControl optional_cc,
+                         const InsertionRequest& request,
+                         size_t parts_count) const {
+  auto span = PrepareExecutionSpan(impl::scopes::kInsert, impl_->GetHostName());
+  span.AddTag("parts_count", parts_count);
+
+  const auto timer = impl_->GetInsertTimer();
+
+  const auto& block = request.GetBlock();
+  const auto rows = block.GetRowsCount();
+  const auto part_rows = (rows + parts_count - 1) / parts_count;
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(parts_count);
+  for (size_t begin = 0; begin < rows; begin += part_rows) {
+    const auto len = std::min(part_rows, rows - begin);
+    tasks.push_back(USERVER_NAMESPACE::utils::Async(
+        "clickhouse_insert_part",
+        [this, optional_cc, &request, &block, begin, len] {
+          const auto part = block.Slice(begin, len);
+          auto conn_ptr = impl_->Acquire();
+          conn_ptr->Insert(optional_cc, request.GetTableName(), part);
+        }));
+  }
+
+  engine::GetAll(tasks);
+}
+
 void Pool::WriteStatistics(
     USERVER_NAMESPACE::utils::statistics::Writer& writer) const {
   writer.ValueWithLabels(impl_->GetStatistics(),
@@ -108,6 +108,8 @@ const std::string& PoolImpl::GetHostName() const {
   return pool_settings_.endpoint_settings.host;
 }
 
+const PoolSettings& PoolImpl::GetSettings() const { return pool_settings_; }
+
 stats::StatementTimer PoolImpl::GetInsertTimer() {
   return stats::StatementTimer{statistics_.inserts};
 }
@@ -142,7 +144,8 @@ PoolImpl::ConnectionUniquePtr PoolImpl::DoCreateConnection(engine::Deadline) {
   try {
     return std::make_unique<Connection>(
         resolver_, pool_settings_.endpoint_settings,
-        pool_settings_.auth_settings, pool_settings_.connection_settings);
+        pool_settings_.auth_settings, pool_settings_.connection_settings,
+        statistics_.traffic);
   } catch (const std::exception&) {
     availability_monitor_.AccountFailure();
     throw;
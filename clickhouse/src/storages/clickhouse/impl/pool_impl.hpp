@@ -56,6 +56,8 @@ class PoolImpl final
 
   const std::string& GetHostName() const;
 
+  const PoolSettings& GetSettings() const;
+
   void StartMaintenance();
 
   stats::StatementTimer GetInsertTimer();
@@ -46,7 +46,8 @@ static CompressionMethod Parse(const yaml_config::YamlConfig& value,
   static constexpr utils::TrivialBiMap kMap([](auto selector) {
     return selector()
         .Case(CompressionMethod::kNone, "none")
-        .Case(CompressionMethod::kLZ4, "lz4");
+        .Case(CompressionMethod::kLZ4, "lz4")
+        .Case(CompressionMethod::kZSTD, "zstd");
   });
 
   return utils::ParseFromValueString(value, kMap);
@@ -74,6 +75,7 @@ PoolSettings::PoolSettings(const components::ComponentConfig& config,
       max_pool_size{config["max_pool_size"].As<size_t>(10)},
       queue_timeout{config["queue_timeout"].As<std::chrono::milliseconds>(
           std::chrono::milliseconds{200})},
+      insert_chunk_rows{config["insert_chunk_rows"].As<size_t>(0)},
       endpoint_settings{endpoint},
       auth_settings{auth},
       connection_settings{config} {}
@@ -30,7 +30,7 @@ struct EndpointSettings final {
 struct ConnectionSettings final {
   enum class ConnectionMode { kNonSecure, kSecure };
 
-  enum class CompressionMethod { kNone, kLZ4 };
+  enum class CompressionMethod { kNone, kLZ4, kZSTD };
 
   ConnectionMode connection_mode{ConnectionMode::kSecure};
 
@@ -43,6 +43,7 @@ struct PoolSettings final {
   size_t initial_pool_size;
   size_t max_pool_size;
   std::chrono::milliseconds queue_timeout;
+  size_t insert_chunk_rows;
 
   EndpointSettings endpoint_settings;
   AuthSettings auth_settings;
@@ -13,6 +13,7 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
   writer["connections"] = stats.connections;
   writer["queries"] = stats.queries;
   writer["inserts"] = stats.inserts;
+  writer["traffic"] = stats.traffic;
 }
 
 void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
@@ -31,6 +32,12 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
   writer["busy"] = stats.busy;
 }
 
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const PoolTrafficStatistics& stats) {
+  writer["bytes-sent"] = stats.bytes_sent;
+  writer["bytes-received"] = stats.bytes_received;
+}
+
 }  // namespace storages::clickhouse::stats
 
 USERVER_NAMESPACE_END
@@ -30,10 +30,18 @@ struct PoolQueryStatistics final {
   RecentPeriod timings{};
 };
 
+// Bytes sent and received over the sockets of the connections, these are
+// the compressed sizes if the compression is enabled
+struct PoolTrafficStatistics final {
+  Counter bytes_sent{};
+  Counter bytes_received{};
+};
+
 struct PoolStatistics final {
   PoolConnectionStatistics connections{};
   PoolQueryStatistics queries{};
   PoolQueryStatistics inserts{};
+  PoolTrafficStatistics traffic{};
 };
 
 void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
@@ -45,6 +53,9 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
 void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
                 const PoolConnectionStatistics& stats);
 
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const PoolTrafficStatistics& stats);
+
 }  // namespace storages::clickhouse::stats
 
 USERVER_NAMESPACE_END
@@ -75,6 +75,45 @@ UTEST(Execute, MappingWorks) {
   EXPECT_EQ(sum, 10000 * (10000 - 1) / 2);
 }
 
+UTEST(Execute, StreamingWorks) {
+  ClusterWrapper cluster{};
+
+  const storages::clickhouse::Query q{
+      "SELECT c.number, randomString(10), c.number as t, NOW64(9) "
+      "FROM numbers(0, 100000) c SETTINGS max_block_size = 1000"};
+
+  /// [Sample ExecuteStreaming usage]
+  size_t blocks = 0;
+  uint64_t sum = 0;
+  cluster->ExecuteStreaming(
+      [&blocks, &sum](storages::clickhouse::ExecutionResult&& block) {
+        ++blocks;
+        for (const auto& row : std::move(block).AsRows<RowData>()) {
+          sum += row.number;
+        }
+      },
+      q);
+  /// [Sample ExecuteStreaming usage]
+
+  EXPECT_GT(blocks, 1);
+  EXPECT_EQ(sum, uint64_t{100000} * (100000 - 1) / 2);
+}
+
+UTEST(Execute, StreamingCallbackThrows) {
+  ClusterWrapper cluster{};
+
+  size_t blocks = 0;
+  EXPECT_ANY_THROW(cluster->ExecuteStreaming(
+      [&blocks](storages::clickhouse::ExecutionResult&&) {
+        if (++blocks == 3) throw std::runtime_error{"stop"};
+      },
+      "SELECT number FROM numbers(0, 100000) SETTINGS max_block_size = 1000"));
+  EXPECT_EQ(blocks, 3);
+
+  // the connection of the interrupted query is not reused
+  EXPECT_EQ(cluster->Execute("SELECT 1").GetRowsCount(), 1);
+}
+
 namespace {
 namespace io = storages::clickhouse::io;
 
@@ -144,6 +144,30 @@ UTEST(Insert, AsRowsWorks) {
   EXPECT_EQ(result[1], data[1]);
 }
 
+UTEST(Insert, SplitIntoParts) {
+  ClusterWrapper cluster{false, {{"localhost", GetClickhousePort()}}, 3};
+  // the parts are inserted over different connections, so the table can't be
+  // a temporary one
+  cluster->Execute("DROP TABLE IF EXISTS split_table");
+  cluster->Execute(
+      "CREATE TABLE split_table (id UInt64, value String, count UInt64, "
+      "tp DateTime64(9)) ENGINE = Memory");
+
+  const auto now = std::chrono::system_clock::now();
+  std::vector<SomeDataRow> data;
+  for (uint64_t i = 0; i < 10; ++i) {
+    data.push_back({i, std::to_string(i), i * 2, now});
+  }
+  cluster->InsertRows("split_table", {"id", "value", "count", "tp"}, data);
+
+  const auto result =
+      cluster
+          ->Execute("SELECT id, value, count, tp FROM split_table ORDER BY id")
+          .AsContainer<std::vector<SomeDataRow>>();
+  cluster->Execute("DROP TABLE split_table");
+  EXPECT_EQ(result, data);
+}
+
 UTEST(Query, AvoidUnexpectedCancellation) {
   ClusterWrapper cluster{};
   cluster->Execute(
@@ -22,7 +22,8 @@ clients::dns::Resolver MakeDnsResolver() {
   return clients::dns::Resolver{engine::current_task::GetTaskProcessor(), {}};
 }
 
-components::ComponentConfig GetConfig(bool use_compression) {
+components::ComponentConfig GetConfig(bool use_compression,
+                                      std::size_t insert_chunk_rows = 0) {
   USERVER_NAMESPACE::formats::yaml::ValueBuilder config_builder{
       USERVER_NAMESPACE::formats::yaml::FromString(
           R"(
@@ -34,6 +35,7 @@ use_compression: false)")};
   if (use_compression) {
     config_builder["compression"] = "lz4";
   }
+  config_builder["insert_chunk_rows"] = insert_chunk_rows;
 
   USERVER_NAMESPACE::yaml_config::YamlConfig yaml_config{
       config_builder.ExtractValue(), {}};
@@ -51,14 +53,14 @@ storages::clickhouse::impl::AuthSettings GetAuthSettings() {
 
 storages::clickhouse::Cluster MakeCluster(
     clients::dns::Resolver& resolver, bool use_compression,
-    const std::vector<storages::clickhouse::impl::EndpointSettings>&
-        endpoints) {
+    const std::vector<storages::clickhouse::impl::EndpointSettings>& endpoints,
+    std::size_t insert_chunk_rows) {
   storages::clickhouse::impl::ClickhouseSettings settings;
   settings.auth_settings = GetAuthSettings();
   settings.endpoints = endpoints;
 
-  return storages::clickhouse::Cluster{resolver, settings,
-                                       GetConfig(use_compression)};
+  return storages::clickhouse::Cluster{
+      resolver, settings, GetConfig(use_compression, insert_chunk_rows)};
 }
 
 }  // namespace
@@ -73,9 +75,11 @@ uint32_t GetClickhousePort() {
 
 ClusterWrapper::ClusterWrapper(
     bool use_compression,
-    const std::vector<storages::clickhouse::impl::EndpointSettings>& endpoints)
+    const std::vector<storages::clickhouse::impl::EndpointSettings>& endpoints,
+    std::size_t insert_chunk_rows)
     : resolver_{MakeDnsResolver()},
-      cluster_{MakeCluster(resolver_, use_compression, endpoints)} {
+      cluster_{MakeCluster(resolver_, use_compression, endpoints,
+                           insert_chunk_rows)} {
   stats_holder_ = statistics_storage_.RegisterWriter(
       "clickhouse", [this](utils::statistics::Writer& writer) {
         cluster_.WriteStatistics(writer);
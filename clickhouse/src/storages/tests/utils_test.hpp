@@ -18,7 +18,8 @@ class ClusterWrapper final {
   ClusterWrapper(
       bool use_compression = false,
       const std::vector<storages::clickhouse::impl::EndpointSettings>&
-          endpoints = {{"localhost", GetClickhousePort()}});
+          endpoints = {{"localhost", GetClickhousePort()}},
+      std::size_t insert_chunk_rows = 0);
 
   storages::clickhouse::Cluster* operator->();
   storages::clickhouse::Cluster& operator*();
@@ -34,6 +34,9 @@ if (USERVER_IMPL_FEATURE_JEMALLOC AND
     NOT CMAKE_SYSTEM_NAME MATCHES "Darwin")
   find_package(Jemalloc REQUIRED)
 endif()
+if (USERVER_IMPL_FEATURE_RE2)
+  find_package(Re2 REQUIRED)
+endif()
 
 include("${USERVER_CMAKE_DIR}/AddGoogleTests.cmake")
 include("${USERVER_CMAKE_DIR}/Sanitizers.cmake")
@@ -0,0 +1,18 @@
+_userver_module_begin(
+    NAME Re2
+    DEBIAN_NAMES libre2-dev
+    FORMULA_NAMES re2
+    RPM_NAMES re2-devel
+    PACMAN_NAMES re2
+    PKG_CONFIG_NAMES re2
+)
+
+_userver_module_find_include(
+    NAMES re2/re2.h
+)
+
+_userver_module_find_library(
+    NAMES re2
+)
+
+_userver_module_end()
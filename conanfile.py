@@ -30,6 +30,7 @@ class UserverConan(ConanFile):
         'fPIC': [True, False],
         'lto': [True, False],
         'with_jemalloc': [True, False],
+        'with_re2': [True, False],
         'with_mongodb': [True, False],
         'with_postgresql': [True, False],
         'with_postgresql_extra': [True, False],
@@ -49,6 +50,7 @@ class UserverConan(ConanFile):
         'fPIC': True,
         'lto': False,
         'with_jemalloc': True,
+        'with_re2': False,
         'with_mongodb': True,
         'with_postgresql': True,
         'with_postgresql_extra': False,
@@ -118,6 +120,8 @@ class UserverConan(ConanFile):
 
         if self.options.with_jemalloc:
             self.requires('jemalloc/5.3.0')
+        if self.options.with_re2:
+            self.requires('re2/20230301')
         if self.options.with_grpc:
             self.requires(
                 'grpc/1.48.4', transitive_headers=True, transitive_libs=True,
@@ -193,6 +197,7 @@ class UserverConan(ConanFile):
         tool_ch.variables[
             'USERVER_FEATURE_JEMALLOC'
         ] = self.options.with_jemalloc
+        tool_ch.variables['USERVER_FEATURE_RE2'] = self.options.with_re2
         tool_ch.variables[
             'USERVER_FEATURE_MONGODB'
         ] = self.options.with_mongodb
@@ -437,6 +442,9 @@ class UserverConan(ConanFile):
         def jemalloc():
             return ['jemalloc::jemalloc'] if self.options.with_jemalloc else []
 
+        def re2():
+            return ['re2::re2'] if self.options.with_re2 else []
+
         def grpc():
             return ['grpc::grpc'] if self.options.with_grpc else []
 
@@ -524,6 +532,7 @@ class UserverConan(ConanFile):
                         + yaml()
                         + cryptopp()
                         + jemalloc()
+                        + re2()
                         + openssl()
                         + zstd()
                     ),
@@ -0,0 +1,83 @@
+#include <userver/ubench/run_in_engine.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include <userver/concurrent/striped_counter.hpp>
+
+#if defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(memory_sanitizer) || \
+    __has_feature(thread_sanitizer)
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define USERVER_IMPL_UBENCH_HAS_SANITIZER
+#endif
+#elif defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define USERVER_IMPL_UBENCH_HAS_SANITIZER
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ubench::impl {
+
+namespace {
+
+// Null until the counting starts, so that the counter construction itself
+// does not recurse into it
+std::atomic<concurrent::StripedCounter*> allocations_counter{nullptr};
+
+[[maybe_unused]] void AccountAllocation() noexcept {
+  auto* counter = allocations_counter.load(std::memory_order_relaxed);
+  if (counter) counter->Add(1);
+}
+
+}  // namespace
+
+#ifdef USERVER_IMPL_UBENCH_HAS_SANITIZER
+
+// Sanitizers replace operator new themselves
+bool StartAllocationsCounting() { return false; }
+
+#else
+
+bool StartAllocationsCounting() {
+  if (!allocations_counter.load()) {
+    // Intentionally leaked, operator new may be called after static
+    // destructors
+    allocations_counter.store(new concurrent::StripedCounter());
+  }
+  return true;
+}
+
+#endif
+
+std::uint64_t GetAllocationsCount() noexcept {
+  const auto* counter = allocations_counter.load();
+  return counter ? counter->Read() : 0;
+}
+
+}  // namespace ubench::impl
+
+USERVER_NAMESPACE_END
+
+#ifndef USERVER_IMPL_UBENCH_HAS_SANITIZER
+
+// The nothrow and array forms from the standard library call this one and
+// the default operators delete call std::free. The aligned forms are not
+// counted.
+void* operator new(std::size_t size) {
+  USERVER_NAMESPACE::ubench::impl::AccountAllocation();
+
+  if (size == 0) size = 1;
+  while (true) {
+    void* result = std::malloc(size);
+    if (result) return result;
+
+    auto* handler = std::get_new_handler();
+    if (!handler) throw std::bad_alloc();
+    handler();
+  }
+}
+
+#endif
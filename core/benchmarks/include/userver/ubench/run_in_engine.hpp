@@ -0,0 +1,70 @@
+#pragma once
+
+/// @file userver/ubench/run_in_engine.hpp
+/// @brief @copybrief ubench::RunInEngine
+
+#include <cstddef>
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/engine/run_standalone.hpp>
+#include <userver/utils/function_ref.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// Benchmark helpers
+namespace ubench {
+
+/// @brief Config of the coroutine engine and of the measurement loop for
+/// ubench::RunInEngine.
+///
+/// The defaults are the same in all the benchmarks, so that their results are
+/// comparable between the runs and between each other.
+struct EngineBenchmarkConfig final {
+  /// TaskProcessor threads count
+  std::size_t worker_threads{1};
+
+  /// Coroutines that run the iteration concurrently. Only the iterations of
+  /// the first one are timed, the others are reported in the
+  /// `concurrent_iterations` counter.
+  std::size_t concurrency{1};
+
+  /// Iterations done before the measurement, to warm up the coroutine pools,
+  /// the allocator and the caches
+  std::size_t warmup_iterations{1000};
+
+  /// Config of the coroutine pools and of the ev threads
+  engine::TaskProcessorPoolsConfig pools{};
+};
+
+/// @brief Runs `iteration` in a loop for the `state` in a temporary coroutine
+/// engine, as engine::RunStandalone does.
+///
+/// Reports the following counters, averaged per a timed iteration:
+/// * `allocs` - `operator new` calls in all the threads, not reported for
+///   the builds with sanitizers;
+/// * `context_switches` - coroutine context switches in the TaskProcessor.
+///
+/// @snippet core/src/engine/task/task_benchmark.cpp  RunInEngine sample
+void RunInEngine(benchmark::State& state, const EngineBenchmarkConfig& config,
+                 utils::function_ref<void()> iteration);
+
+/// @overload
+void RunInEngine(benchmark::State& state,
+                 utils::function_ref<void()> iteration);
+
+namespace impl {
+
+/// Starts counting the `operator new` calls, returns false if the counting
+/// is not supported by the build
+bool StartAllocationsCounting();
+
+/// Returns the count of `operator new` calls since StartAllocationsCounting
+std::uint64_t GetAllocationsCount() noexcept;
+
+}  // namespace impl
+
+}  // namespace ubench
+
+USERVER_NAMESPACE_END
@@ -2,6 +2,24 @@
 
 #include <userver/logging/log.hpp>
 #include <userver/utils/impl/static_registration.hpp>
+#include <userver/utils/userver_info.hpp>
+
+namespace {
+
+// Stored in the JSON output, so that the results of the different builds are
+// not compared by mistake when tracking the regressions
+void AddBuildContext() {
+  ::benchmark::AddCustomContext(
+      "userver_vcs_revision",
+      USERVER_NAMESPACE::utils::GetUserverVcsRevision());
+#ifdef NDEBUG
+  ::benchmark::AddCustomContext("userver_build_type", "release");
+#else
+  ::benchmark::AddCustomContext("userver_build_type", "debug");
+#endif
+}
+
+}  // namespace
 
 int main(int argc, char** argv) {
   USERVER_NAMESPACE::utils::impl::FinishStaticRegistration();
@@ -11,5 +29,6 @@ int main(int argc, char** argv) {
 
   ::benchmark::Initialize(&argc, argv);
   if (::benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+  AddBuildContext();
   ::benchmark::RunSpecifiedBenchmarks();
 }
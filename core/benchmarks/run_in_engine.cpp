@@ -0,0 +1,79 @@
+#include <userver/ubench/run_in_engine.hpp>
+
+#include <atomic>
+
+#include <engine/task/task_processor.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fixed_array.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ubench {
+
+namespace {
+
+std::uint64_t GetContextSwitches() {
+  const auto& counter =
+      engine::current_task::GetTaskProcessor().GetTaskCounter();
+  return counter.GetTaskSwitchFast().value + counter.GetTaskSwitchSlow().value;
+}
+
+}  // namespace
+
+void RunInEngine(benchmark::State& state, const EngineBenchmarkConfig& config,
+                 utils::function_ref<void()> iteration) {
+  UINVARIANT(config.concurrency != 0, "Unable to run anything using 0 tasks");
+  const bool count_allocations = impl::StartAllocationsCounting();
+
+  engine::RunStandalone(config.worker_threads, config.pools, [&] {
+    for (std::size_t i = 0; i < config.warmup_iterations; ++i) iteration();
+
+    std::atomic<bool> keep_running{true};
+    std::atomic<std::uint64_t> concurrent_iterations{0};
+    auto concurrent_tasks = utils::GenerateFixedArray(
+        config.concurrency - 1, [&](std::size_t) {
+          return engine::CriticalAsyncNoSpan([&] {
+            std::uint64_t iterations = 0;
+            while (keep_running.load(std::memory_order_relaxed)) {
+              iteration();
+              ++iterations;
+            }
+            concurrent_iterations += iterations;
+          });
+        });
+
+    const auto allocations_before = impl::GetAllocationsCount();
+    const auto context_switches_before = GetContextSwitches();
+
+    for ([[maybe_unused]] auto _ : state) iteration();
+
+    const auto allocations = impl::GetAllocationsCount() - allocations_before;
+    const auto context_switches =
+        GetContextSwitches() - context_switches_before;
+
+    keep_running = false;
+    for (auto& task : concurrent_tasks) task.Get();
+
+    if (count_allocations) {
+      state.counters["allocs"] = benchmark::Counter(
+          allocations, benchmark::Counter::kAvgIterations);
+    }
+    state.counters["context_switches"] = benchmark::Counter(
+        context_switches, benchmark::Counter::kAvgIterations);
+    if (config.concurrency > 1) {
+      state.counters["concurrent_iterations"] = benchmark::Counter(
+          concurrent_iterations.load(), benchmark::Counter::kIsRate);
+    }
+  });
+}
+
+void RunInEngine(benchmark::State& state,
+                 utils::function_ref<void()> iteration) {
+  RunInEngine(state, EngineBenchmarkConfig{}, iteration);
+}
+
+}  // namespace ubench
+
+USERVER_NAMESPACE_END
@@ -40,6 +40,15 @@ class BaggageManager final {
   /// @brief Set new baggage value to task inherited variable
   void SetBaggage(std::string header) const;
 
+  /// @brief Set the baggage header of an incoming request to task inherited
+  /// variable without parsing it
+  ///
+  /// The header is parsed with the allowed keys of `config` on the first
+  /// TryGetBaggage() call, e.g. by an outgoing request, and the result is
+  /// cached. The requests that make no outgoing calls do not parse it at all.
+  static void SetRawBaggage(std::string header,
+                            const dynamic_config::Snapshot& config);
+
   /// @brief Delete header from task inherited variable
   static void ResetBaggage();
 
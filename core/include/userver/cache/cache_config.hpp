@@ -28,6 +28,7 @@ enum class FirstUpdateMode {
   kRequired,
   kBestEffort,
   kSkip,
+  kBackground,
 };
 
 FirstUpdateMode Parse(const yaml_config::YamlConfig& config,
@@ -76,6 +77,8 @@ struct Config final {
   bool is_strong_period{};
   std::optional<std::uint64_t> failed_updates_before_expiration;
   bool is_safe_data_lifetime{};
+  std::size_t full_update_concurrency{1};
+  std::optional<std::string> full_update_task_processor_name;
 
   FirstUpdateMode first_update_mode{};
   FirstUpdateType first_update_type{};
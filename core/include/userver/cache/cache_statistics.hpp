@@ -30,6 +30,10 @@ struct UpdateStatistics final {
   std::atomic<std::chrono::steady_clock::time_point>
       last_successful_update_start_time{{}};
   std::atomic<std::chrono::milliseconds> last_update_duration{{}};
+
+  // Progress of the current or the last partitioned update
+  std::atomic<std::size_t> parts_count{0};
+  std::atomic<std::size_t> parts_done{0};
 };
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -88,6 +92,15 @@ class UpdateStatisticsScope final {
   /// @param add the number of non-valid items newly received
   void IncreaseDocumentsParseFailures(std::size_t add);
 
+  /// @brief Sets the number of parts of a partitioned `Update`, for the
+  /// progress metrics
+  /// @see cache::CacheUpdateTrait::RunUpdateParts
+  void SetPartsCount(std::size_t parts_count);
+
+  /// @brief Each finished part of a partitioned `Update` should be accounted
+  /// with this function
+  void IncreasePartsDone(std::size_t add);
+
  private:
   void DoFinish(impl::UpdateState new_state);
 
@@ -3,8 +3,13 @@
 /// @file userver/cache/cache_update_trait.hpp
 /// @brief @copybrief cache::CacheUpdateTrait
 
+#include <cstddef>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include <userver/cache/cache_statistics.hpp>
 #include <userver/cache/update_type.hpp>
@@ -77,6 +82,34 @@ class CacheUpdateTrait {
   /// that the cached data has been modified
   void OnCacheModified();
 
+  /// @brief Runs `build_part(part_index)` for each `part_index` in
+  /// `[0, parts_count)` concurrently and waits for them
+  ///
+  /// Meant for the long full updates: fetch and parse the ranges of the data
+  /// source in parallel, then merge them into the final value. At most
+  /// `full-update-concurrency` parts are built at a time, in the
+  /// `full-update-task-processor`. The progress is reported in the `parts`
+  /// metrics of the update.
+  ///
+  /// @throws the exception of a failed part, the other parts are cancelled
+  void RunUpdateParts(std::size_t parts_count,
+                      const std::function<void(std::size_t)>& build_part,
+                      UpdateStatisticsScope& stats_scope);
+
+  /// @brief Same as RunUpdateParts, but collects the parts
+  /// @returns the results of `build_part(part_index)` ordered by `part_index`
+  ///
+  /// @code
+  /// auto parts = BuildUpdateParts(kParts, [&](std::size_t part) {
+  ///   return FetchRange(part * kRangeSize, (part + 1) * kRangeSize);
+  /// }, stats_scope);
+  /// auto data = std::make_unique<Data>();
+  /// for (auto& part : parts) data->merge(part);
+  /// @endcode
+  template <typename BuildPart>
+  auto BuildUpdateParts(std::size_t parts_count, BuildPart build_part,
+                        UpdateStatisticsScope& stats_scope);
+
   /// @cond
   // For internal use only
   rcu::ReadablePtr<Config> GetConfig() const;
@@ -146,10 +179,34 @@ class CacheUpdateTrait {
 
   virtual void ReadAndSet(dump::Reader& reader);
 
+  virtual bool GetAndWriteDelta(dump::Writer& writer);
+
+  virtual void ReadAndSetWithDeltas(dump::Reader& reader,
+                                    dump::DeltaSequence& deltas);
+
   class Impl;
   std::unique_ptr<Impl> impl_;
 };
 
+template <typename BuildPart>
+auto CacheUpdateTrait::BuildUpdateParts(std::size_t parts_count,
+                                        BuildPart build_part,
+                                        UpdateStatisticsScope& stats_scope) {
+  using Part = std::invoke_result_t<BuildPart&, std::size_t>;
+  std::vector<std::optional<Part>> built(parts_count);
+  RunUpdateParts(
+      parts_count,
+      [&](std::size_t part_index) {
+        built[part_index].emplace(build_part(part_index));
+      },
+      stats_scope);
+
+  std::vector<Part> parts;
+  parts.reserve(parts_count);
+  for (auto& part : built) parts.push_back(std::move(*part));
+  return parts;
+}
+
 }  // namespace cache
 
 USERVER_NAMESPACE_END
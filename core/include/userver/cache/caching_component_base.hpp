@@ -3,9 +3,12 @@
 /// @file userver/cache/caching_component_base.hpp
 /// @brief @copybrief components::CachingComponentBase
 
+#include <iterator>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -15,10 +18,12 @@
 #include <userver/components/component_base.hpp>
 #include <userver/components/component_fwd.hpp>
 #include <userver/concurrent/async_event_channel.hpp>
+#include <userver/dump/dumper.hpp>
 #include <userver/dump/helpers.hpp>
 #include <userver/dump/meta.hpp>
 #include <userver/dump/operations.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/mutex.hpp>
 #include <userver/rcu/rcu.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/impl/wait_token_storage.hpp>
@@ -72,6 +77,8 @@ namespace components {
 /// failed-updates-before-expiration | the number of consecutive failed updates for data expiration | --
 /// has-pre-assign-check | enables the check before changing the value in the cache, by default it is the check that the new value is not empty | false
 /// alert-on-failing-to-update-times | fire an alert if the cache update failed specified amount of times in a row. If zero - alerts are disabled. Value from dynamic config takes priority over static | 0
+/// full-update-concurrency | max number of parts of a partitioned update built concurrently, see cache::CacheUpdateTrait::RunUpdateParts | 1
+/// full-update-task-processor | the name of the TaskProcessor for building the parts of a partitioned update | value of `task-processor`
 /// safe-data-lifetime | enables awaiting data destructors in the component's destructor. Can be set to `false` if the stored data does not refer to the component and its dependencies. | true
 /// dump.* | Manages cache behavior after dump load | -
 /// dump.first-update-mode | Behavior of update after successful load from dump. See info on modes below | skip
@@ -131,6 +138,23 @@ namespace components {
 /// `skip`        | after successful load from dump, do nothing
 /// `required`    | make a synchronous update of type `first-update-type`, stop the service on failure
 /// `best-effort` | make a synchronous update of type `first-update-type`, keep working and use data from dump on failure
+/// `background`  | start with the data from dump, immediately start an update of type `first-update-type` in background, keep using data from dump until it succeeds
+///
+/// `background` mode does not delay the service start by a cache update. With
+/// `first-update-type: incremental-then-async-full` the background update is
+/// full. If periodic updates are disabled (e.g. in testsuite), `background`
+/// works as `best-effort`. Until the cache data is updated after loading a dump,
+/// the `cache.dump.is-current-from-dump` metric is `1`.
+///
+/// ### Incremental dumps
+///
+/// With `dump.incremental` in the static config, caches of maps may write
+/// only the entries changed by the incremental updates on top of the previous
+/// dump, see @ref dump::Dumper. For that, set the result of an incremental
+/// update via @ref SetIncremental. The full dumps are still written after
+/// @ref Set, and periodically to compact the deltas. The dumps with deltas are
+/// read with dump::Read of `T`, so `WriteContents` and `ReadContents` must not
+/// be overridden.
 ///
 /// ### testsuite-force-periodic-update
 ///  use it to enable periodic cache update for a component in testsuite environment
@@ -196,6 +220,16 @@ class CachingComponentBase : public ComponentBase,
   template <typename... Args>
   void Emplace(Args&&... args);
 
+  /// @brief Sets the new value of cache after an incremental update
+  ///
+  /// Same as @ref Set, but the incremental cache dumps then write only the
+  /// entries of `changed_keys` on top of the previous dump.
+  ///
+  /// @param changed_keys the keys inserted, modified or erased by the update
+  /// @note Requires a map `T` that is dumpable, e.g. `std::unordered_map`
+  void SetIncremental(std::unique_ptr<const T> value_ptr,
+                      std::vector<meta::MapKeyType<T>> changed_keys);
+
   /// Clears the content of the cache by string a default constructed T.
   void Clear();
 
@@ -224,15 +258,66 @@ class CachingComponentBase : public ComponentBase,
 
   void GetAndWrite(dump::Writer& writer) const final;
   void ReadAndSet(dump::Reader& reader) final;
+  bool GetAndWriteDelta(dump::Writer& writer) final;
+  void ReadAndSetWithDeltas(dump::Reader& reader,
+                            dump::DeltaSequence& deltas) final;
+
+  // The changes since the last written or read dump, for the incremental dumps
+  struct DumpDelta final {
+    // false if the changes can't be written as a delta, e.g. after Set
+    bool is_complete{false};
+    std::vector<meta::MapKeyType<T>> changed_keys;
+  };
+
+  template <typename UpdateDumpDelta>
+  void DoSet(std::unique_ptr<const T> value_ptr,
+             UpdateDumpDelta update_dump_delta);
 
   std::shared_ptr<const T> TransformNewValue(
       std::unique_ptr<const T> new_value);
 
   rcu::Variable<std::shared_ptr<const T>> cache_;
+  // Protects `dump_delta_` and orders it with the assignments of `cache_`
+  mutable engine::Mutex dump_delta_mutex_;
+  mutable DumpDelta dump_delta_;
   concurrent::AsyncEventChannel<const std::shared_ptr<const T>&> event_channel_;
   utils::impl::WaitTokenStorage wait_token_storage_;
 };
 
+namespace impl {
+
+template <typename T>
+inline constexpr bool kSupportsDumpDeltas =
+    meta::kIsUniqueMap<T> && dump::kIsDumpable<T>;
+
+template <typename T>
+void WriteDumpDelta(dump::Writer& writer, const T& contents,
+                    const std::vector<meta::MapKeyType<T>>& changed_keys) {
+  writer.Write(changed_keys.size());
+  for (const auto& key : changed_keys) {
+    writer.Write(key);
+    const auto it = contents.find(key);
+    writer.Write(it != contents.end());
+    if (it != contents.end()) writer.Write(it->second);
+  }
+}
+
+template <typename T>
+void ReadDumpDelta(dump::Reader& reader, T& contents) {
+  const auto size = reader.Read<std::size_t>();
+  for (std::size_t i = 0; i < size; ++i) {
+    auto key = reader.Read<meta::MapKeyType<T>>();
+    if (reader.Read<bool>()) {
+      contents.insert_or_assign(std::move(key),
+                                reader.Read<meta::MapValueType<T>>());
+    } else {
+      contents.erase(key);
+    }
+  }
+}
+
+}  // namespace impl
+
 template <typename T>
 CachingComponentBase<T>::CachingComponentBase(const ComponentConfig& config,
                                               const ComponentContext& context)
@@ -288,6 +373,30 @@ utils::SharedReadablePtr<T> CachingComponentBase<T>::GetUnsafe() const {
 
 template <typename T>
 void CachingComponentBase<T>::Set(std::unique_ptr<const T> value_ptr) {
+  DoSet(std::move(value_ptr), [](DumpDelta& delta) {
+    delta.is_complete = false;
+    delta.changed_keys.clear();
+  });
+}
+
+template <typename T>
+void CachingComponentBase<T>::SetIncremental(
+    std::unique_ptr<const T> value_ptr,
+    std::vector<meta::MapKeyType<T>> changed_keys) {
+  static_assert(impl::kSupportsDumpDeltas<T>,
+                "SetIncremental requires a dumpable map");
+  DoSet(std::move(value_ptr), [&changed_keys](DumpDelta& delta) {
+    if (!delta.is_complete) return;
+    delta.changed_keys.insert(delta.changed_keys.end(),
+                              std::make_move_iterator(changed_keys.begin()),
+                              std::make_move_iterator(changed_keys.end()));
+  });
+}
+
+template <typename T>
+template <typename UpdateDumpDelta>
+void CachingComponentBase<T>::DoSet(std::unique_ptr<const T> value_ptr,
+                                    UpdateDumpDelta update_dump_delta) {
   const std::shared_ptr<const T> new_value =
       TransformNewValue(std::move(value_ptr));
 
@@ -296,7 +405,11 @@ void CachingComponentBase<T>::Set(std::unique_ptr<const T> value_ptr) {
     PreAssignCheck(old_value->get(), new_value.get());
   }
 
-  cache_.Assign(new_value);
+  {
+    std::lock_guard lock(dump_delta_mutex_);
+    cache_.Assign(new_value);
+    update_dump_delta(dump_delta_);
+  }
   event_channel_.SendEvent(new_value);
   OnCacheModified();
 }
@@ -314,7 +427,10 @@ void CachingComponentBase<T>::Emplace(Args&&... args) {
 
 template <typename T>
 void CachingComponentBase<T>::Clear() {
+  std::lock_guard lock(dump_delta_mutex_);
   cache_.Assign(std::make_unique<const T>());
+  dump_delta_.is_complete = false;
+  dump_delta_.changed_keys.clear();
 }
 
 template <typename T>
@@ -324,7 +440,13 @@ bool CachingComponentBase<T>::MayReturnNull() const {
 
 template <typename T>
 void CachingComponentBase<T>::GetAndWrite(dump::Writer& writer) const {
-  const auto contents = GetUnsafe();
+  const auto contents = [this] {
+    std::lock_guard lock(dump_delta_mutex_);
+    // The next delta is written on top of this snapshot
+    dump_delta_.is_complete = true;
+    dump_delta_.changed_keys.clear();
+    return GetUnsafe();
+  }();
   if (!contents) throw cache::EmptyCacheError(Name());
   WriteContents(writer, *contents);
 }
@@ -337,7 +459,49 @@ void CachingComponentBase<T>::ReadAndSet(dump::Reader& reader) {
       SetDataSizeStatistic(std::size(*data));
     }
   }
-  Set(std::move(data));
+  DoSet(std::move(data), [](DumpDelta& delta) {
+    delta.is_complete = true;
+    delta.changed_keys.clear();
+  });
+}
+
+template <typename T>
+bool CachingComponentBase<T>::GetAndWriteDelta(dump::Writer& writer) {
+  if constexpr (impl::kSupportsDumpDeltas<T>) {
+    std::shared_ptr<const T> contents;
+    std::vector<meta::MapKeyType<T>> changed_keys;
+    {
+      std::lock_guard lock(dump_delta_mutex_);
+      contents = cache_.ReadCopy();
+      if (!dump_delta_.is_complete || !contents) return false;
+      changed_keys = std::exchange(dump_delta_.changed_keys, {});
+    }
+    impl::WriteDumpDelta(writer, *contents, changed_keys);
+    return true;
+  } else {
+    return false;
+  }
+}
+
+template <typename T>
+void CachingComponentBase<T>::ReadAndSetWithDeltas(
+    dump::Reader& reader, dump::DeltaSequence& deltas) {
+  if constexpr (impl::kSupportsDumpDeltas<T>) {
+    // The deltas are applied in place, see "Incremental dumps" in the docs
+    std::unique_ptr<T> data{new T(reader.Read<T>())};
+    while (auto* delta = deltas.Next()) {
+      impl::ReadDumpDelta(*delta, *data);
+    }
+    SetDataSizeStatistic(std::size(*data));
+    DoSet(std::move(data), [](DumpDelta& delta) {
+      delta.is_complete = true;
+      delta.changed_keys.clear();
+    });
+  } else {
+    throw dump::Error(
+        fmt::format("{}: incremental dumps of {} are not supported", Name(),
+                    compiler::GetTypeName<T>()));
+  }
 }
 
 template <typename T>
@@ -0,0 +1,555 @@
+#pragma once
+
+/// @file userver/cache/clock_lru_cache.hpp
+/// @brief @copybrief cache::ClockLru
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <boost/container_hash/hash.hpp>
+
+#include <userver/concurrent/impl/asymmetric_fence.hpp>
+#include <userver/concurrent/impl/striped_read_indicator.hpp>
+#include <userver/dump/dumper.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @ingroup userver_containers
+/// @brief Sharded cache with lock-free reads and CLOCK eviction
+///
+/// A drop-in alternative to cache::NWayLRU for read-heavy workloads. Lookups
+/// never take a mutex and do not reorder anything on a hit: they only set the
+/// "referenced" bit of the entry if it is not set yet, so a hot key is read
+/// concurrently without bouncing cache lines between the cores. Writers are
+/// serialized by a mutex per way and evict the first entry without the
+/// "referenced" bit, clearing the bits they pass (the CLOCK approximation of
+/// LRU).
+///
+/// The entries are immutable once inserted, the replaced and evicted ones are
+/// freed after all the readers that could observe them are gone.
+template <typename T, typename U, typename Hash = std::hash<T>,
+          typename Equal = std::equal_to<T>>
+class ClockLru final {
+ public:
+  /// For the description of `ways` and `way_size`,
+  /// see the cache::NWayLRU::NWayLRU constructor.
+  ClockLru(size_t ways, size_t way_size, const Hash& hash = Hash(),
+           const Equal& equal = Equal());
+
+  ClockLru(ClockLru&&) = delete;
+  ClockLru& operator=(ClockLru&&) = delete;
+
+  void Put(const T& key, U value);
+
+  /// Same as Put(), but if the way is full and the key is not in it,
+  /// `admit(victim_key)` decides whether the CLOCK victim should give way to
+  /// the new item.
+  /// @returns whether the value was stored
+  template <typename Admit>
+  bool Put(const T& key, U value, Admit admit);
+
+  template <typename Validator>
+  std::optional<U> Get(const T& key, Validator validator);
+
+  std::optional<U> Get(const T& key) {
+    return Get(key, [](const U&) { return true; });
+  }
+
+  U GetOr(const T& key, const U& default_value);
+
+  void Invalidate();
+
+  void InvalidateByKey(const T& key);
+
+  /// Iterates over all items. May be slow for big caches.
+  template <typename Function>
+  void VisitAll(Function func) const;
+
+  size_t GetSize() const;
+
+  /// For the description of `way_size`,
+  /// see the cache::NWayLRU::NWayLRU constructor.
+  void UpdateWaySize(size_t way_size);
+
+  void Write(dump::Writer& writer) const;
+  void Read(dump::Reader& reader);
+
+  /// The dump::Dumper will be notified of any cache updates. This method is not
+  /// thread-safe.
+  void SetDumper(std::shared_ptr<dump::Dumper> dumper);
+
+ private:
+  struct Node {
+    Node(std::size_t hash, const T& key, U&& value)
+        : hash(hash), key(key), value(std::move(value)) {}
+
+    const std::size_t hash;
+    const T key;
+    const U value;
+    std::atomic<Node*> next{nullptr};
+    mutable std::atomic<bool> referenced{false};
+    // Position in Way::nodes, only accessed by the writers
+    std::size_t index{0};
+  };
+
+  struct Table {
+    explicit Table(std::size_t bucket_count)
+        : buckets(std::make_unique<std::atomic<Node*>[]>(bucket_count)),
+          mask(bucket_count - 1) {}
+
+    std::atomic<Node*>& GetBucket(std::size_t hash) const {
+      // The low bits of the hash are used for the way selection
+      boost::hash_combine(hash, 1);
+      return buckets[hash & mask];
+    }
+
+    const std::unique_ptr<std::atomic<Node*>[]> buckets;
+    const std::size_t mask;
+  };
+
+  struct Retired {
+    std::vector<std::unique_ptr<Node>> nodes;
+    std::vector<std::unique_ptr<Table>> tables;
+  };
+
+  struct Way {
+    explicit Way(std::size_t max_size);
+
+    // The returned lock keeps the current table and nodes from being freed
+    concurrent::impl::StripedReadIndicatorLock LockForReading() const noexcept;
+
+    const Table& GetTable() const noexcept {
+      return *table.load(std::memory_order_acquire);
+    }
+
+    mutable concurrent::impl::StripedReadIndicator indicators[2];
+    std::atomic<std::size_t> epoch{0};
+    std::atomic<Table*> table{nullptr};
+
+    // The rest is guarded by the mutex
+    mutable engine::Mutex mutex;
+    std::unique_ptr<Table> table_holder;
+    std::vector<std::unique_ptr<Node>> nodes;
+    std::size_t hand{0};
+    std::size_t max_size;
+    Retired retired[2];
+    // Retired nodes and tables of both epochs
+    std::size_t retired_count{0};
+  };
+
+  static std::size_t GetBucketCount(std::size_t way_size);
+
+  Way& GetWay(std::size_t hash) const;
+  Node* FindNode(const Table& table, std::size_t hash, const T& key) const;
+
+  // All of the following require the way mutex to be locked
+  static void Insert(Way& way, std::unique_ptr<Node> node);
+  // Replaces `node` with `replacement` if it is not null, otherwise removes
+  // `node`. The old node is retired.
+  static void Replace(Way& way, Node& node, std::unique_ptr<Node> replacement);
+  static Node& FindVictim(Way& way);
+  static void Evict(Way& way);
+  static void Rebuild(Way& way, std::vector<std::unique_ptr<Node>> nodes);
+  static void Retire(Way& way, std::unique_ptr<Node> node);
+  static void TryReclaim(Way& way);
+
+  void NotifyDumper();
+
+  std::vector<std::unique_ptr<Way>> ways_;
+  Hash hash_fn_;
+  Equal equal_;
+  std::shared_ptr<dump::Dumper> dumper_{nullptr};
+};
+
+namespace impl {
+
+// Enough to amortize the heavy fence of a reclamation attempt
+inline constexpr std::size_t kClockLruRetiredBatch = 64;
+
+}  // namespace impl
+
+template <typename T, typename U, typename Hash, typename Eq>
+ClockLru<T, U, Hash, Eq>::Way::Way(std::size_t max_size)
+    : table_holder(std::make_unique<Table>(GetBucketCount(max_size))),
+      max_size(max_size) {
+  table.store(table_holder.get(), std::memory_order_release);
+  nodes.reserve(max_size);
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+concurrent::impl::StripedReadIndicatorLock
+ClockLru<T, U, Hash, Eq>::Way::LockForReading() const noexcept {
+  auto current = epoch.load();
+
+  while (true) {
+    auto lock = indicators[current].Lock();
+
+    // Same as in rcu::ReadablePtr: grants seq_cst to the lock together with
+    // the AsymmetricThreadFenceHeavy in TryReclaim
+    concurrent::impl::AsymmetricThreadFenceLight();
+
+    const auto new_current = epoch.load(std::memory_order_seq_cst);
+    if (new_current == current) return lock;
+
+    current = new_current;
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+ClockLru<T, U, Hash, Eq>::ClockLru(size_t ways, size_t way_size,
+                                   const Hash& hash, const Eq& equal)
+    : hash_fn_(hash), equal_(equal) {
+  if (ways == 0) throw std::logic_error("Ways must be positive");
+
+  ways_.reserve(ways);
+  for (size_t i = 0; i < ways; ++i) {
+    ways_.push_back(std::make_unique<Way>(way_size == 0 ? 1 : way_size));
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void ClockLru<T, U, Hash, Eq>::Put(const T& key, U value) {
+  Put(key, std::move(value), [](const T&) { return true; });
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+template <typename Admit>
+bool ClockLru<T, U, Hash, Eq>::Put(const T& key, U value, Admit admit) {
+  const auto hash = hash_fn_(key);
+  auto& way = GetWay(hash);
+  {
+    std::unique_lock<engine::Mutex> lock(way.mutex);
+
+    auto* old_node = FindNode(*way.table_holder, hash, key);
+    if (!old_node && way.nodes.size() >= way.max_size) {
+      auto& victim = FindVictim(way);
+      if (!admit(std::as_const(victim.key))) return false;
+      Replace(way, victim, nullptr);
+    }
+
+    auto node = std::make_unique<Node>(hash, key, std::move(value));
+    if (old_node) {
+      node->referenced.store(
+          old_node->referenced.load(std::memory_order_relaxed),
+          std::memory_order_relaxed);
+      Replace(way, *old_node, std::move(node));
+    } else {
+      Insert(way, std::move(node));
+    }
+    TryReclaim(way);
+  }
+  NotifyDumper();
+  return true;
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+template <typename Validator>
+std::optional<U> ClockLru<T, U, Hash, Eq>::Get(const T& key,
+                                               Validator validator) {
+  const auto hash = hash_fn_(key);
+  auto& way = GetWay(hash);
+  {
+    const auto read_lock = way.LockForReading();
+    const auto* node = FindNode(way.GetTable(), hash, key);
+    if (!node) return std::nullopt;
+
+    if (validator(node->value)) {
+      // Avoid writing to the shared cache line if the bit is already set
+      if (!node->referenced.load(std::memory_order_relaxed)) {
+        node->referenced.store(true, std::memory_order_relaxed);
+      }
+      return node->value;
+    }
+  }
+
+  std::unique_lock<engine::Mutex> lock(way.mutex);
+  // The node could have been replaced while we were not holding the lock
+  auto* node = FindNode(*way.table_holder, hash, key);
+  if (node && !validator(node->value)) {
+    Replace(way, *node, nullptr);
+    TryReclaim(way);
+  }
+  return std::nullopt;
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+U ClockLru<T, U, Hash, Eq>::GetOr(const T& key, const U& default_value) {
+  auto value = Get(key);
+  if (value) return std::move(*value);
+  return default_value;
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void ClockLru<T, U, Hash, Eq>::InvalidateByKey(const T& key) {
+  const auto hash = hash_fn_(key);
+  auto& way = GetWay(hash);
+  {
+    std::unique_lock<engine::Mutex> lock(way.mutex);
+    auto* node = FindNode(*way.table_holder, hash, key);
+    if (node) {
+      Replace(way, *node, nullptr);
+      TryReclaim(way);
+    }
+  }
+  NotifyDumper();
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void ClockLru<T, U, Hash, Eq>::Invalidate() {
+  for (auto& way : ways_) {
+    std::unique_lock<engine::Mutex> lock(way->mutex);
+    Rebuild(*way, {});
+    TryReclaim(*way);
+  }
+  NotifyDumper();
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+template <typename Function>
+void ClockLru<T, U, Hash, Eq>::VisitAll(Function func) const {
+  for (const auto& way : ways_) {
+    std::unique_lock<engine::Mutex> lock(way->mutex);
+    for (const auto& node : way->nodes) func(node->key, node->value);
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+size_t ClockLru<T, U, Hash, Eq>::GetSize() const {
+  size_t size{0};
+  for (const auto& way : ways_) {
+    std::unique_lock<engine::Mutex> lock(way->mutex);
+    size += way->nodes.size();
+  }
+  return size;
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void ClockLru<T, U, Hash, Eq>::UpdateWaySize(size_t way_size) {
+  if (way_size == 0) way_size = 1;
+
+  for (auto& way : ways_) {
+    std::unique_lock<engine::Mutex> lock(way->mutex);
+    way->max_size = way_size;
+    while (way->nodes.size() > way_size) Evict(*way);
+
+    if (GetBucketCount(way_size) != way->table_holder->mask + 1) {
+      // The readers may be walking the old buckets, so the nodes are copied
+      // instead of being relinked
+      std::vector<std::unique_ptr<Node>> nodes;
+      nodes.reserve(way_size);
+      for (const auto& node : way->nodes) {
+        nodes.push_back(
+            std::make_unique<Node>(node->hash, node->key, U{node->value}));
+        nodes.back()->referenced.store(
+            node->referenced.load(std::memory_order_relaxed),
+            std::memory_order_relaxed);
+      }
+      Rebuild(*way, std::move(nodes));
+    }
+    TryReclaim(*way);
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+std::size_t ClockLru<T, U, Hash, Eq>::GetBucketCount(std::size_t way_size) {
+  std::size_t bucket_count = 1;
+  while (bucket_count < way_size) bucket_count *= 2;
+  return bucket_count;
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+typename ClockLru<T, U, Hash, Eq>::Way& ClockLru<T, U, Hash, Eq>::GetWay(
+    std::size_t hash) const {
+  // See NWayLRU::GetWay
+  boost::hash_combine(hash, 0);
+  return *ways_[hash % ways_.size()];
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+typename ClockLru<T, U, Hash, Eq>::Node* ClockLru<T, U, Hash, Eq>::FindNode(
+    const Table& table, std::size_t hash, const T& key) const {
+  auto* node = table.GetBucket(hash).load(std::memory_order_acquire);
+  while (node) {
+    if (node->hash == hash && equal_(node->key, key)) return node;
+    node = node->next.load(std::memory_order_acquire);
+  }
+  return nullptr;
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void ClockLru<T, U, Hash, Eq>::Insert(Way& way, std::unique_ptr<Node> node) {
+  auto& bucket = way.table_holder->GetBucket(node->hash);
+  auto* raw_node = node.get();
+  raw_node->index = way.nodes.size();
+  raw_node->next.store(bucket.load(std::memory_order_relaxed),
+                       std::memory_order_relaxed);
+  way.nodes.push_back(std::move(node));
+
+  bucket.store(raw_node, std::memory_order_release);
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void ClockLru<T, U, Hash, Eq>::Replace(Way& way, Node& node,
+                                       std::unique_ptr<Node> replacement) {
+  auto* link = &way.table_holder->GetBucket(node.hash);
+  while (link->load(std::memory_order_relaxed) != &node) {
+    link = &link->load(std::memory_order_relaxed)->next;
+  }
+
+  auto* const next = node.next.load(std::memory_order_relaxed);
+  const auto index = node.index;
+
+  if (replacement) {
+    replacement->index = index;
+    replacement->next.store(next, std::memory_order_relaxed);
+    link->store(replacement.get(), std::memory_order_release);
+    Retire(way, std::exchange(way.nodes[index], std::move(replacement)));
+    return;
+  }
+
+  link->store(next, std::memory_order_release);
+  auto removed = std::move(way.nodes[index]);
+  if (index + 1 != way.nodes.size()) {
+    way.nodes[index] = std::move(way.nodes.back());
+    way.nodes[index]->index = index;
+  }
+  way.nodes.pop_back();
+  Retire(way, std::move(removed));
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+typename ClockLru<T, U, Hash, Eq>::Node& ClockLru<T, U, Hash, Eq>::FindVictim(
+    Way& way) {
+  UASSERT(!way.nodes.empty());
+
+  // The readers may keep setting the bits, so the second lap evicts anyway
+  for (std::size_t step = 0; step < 2 * way.nodes.size(); ++step) {
+    if (way.hand >= way.nodes.size()) way.hand = 0;
+
+    auto& node = *way.nodes[way.hand];
+    if (!node.referenced.load(std::memory_order_relaxed)) break;
+
+    node.referenced.store(false, std::memory_order_relaxed);
+    ++way.hand;
+  }
+
+  if (way.hand >= way.nodes.size()) way.hand = 0;
+  return *way.nodes[way.hand];
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void ClockLru<T, U, Hash, Eq>::Evict(Way& way) {
+  Replace(way, FindVictim(way), nullptr);
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void ClockLru<T, U, Hash, Eq>::Rebuild(
+    Way& way, std::vector<std::unique_ptr<Node>> nodes) {
+  auto table = std::make_unique<Table>(GetBucketCount(way.max_size));
+  for (std::size_t i = 0; i < nodes.size(); ++i) {
+    auto& bucket = table->GetBucket(nodes[i]->hash);
+    nodes[i]->index = i;
+    nodes[i]->next.store(bucket.load(std::memory_order_relaxed),
+                         std::memory_order_relaxed);
+    bucket.store(nodes[i].get(), std::memory_order_relaxed);
+  }
+
+  auto& retired = way.retired[way.epoch.load(std::memory_order_relaxed)];
+  retired.tables.reserve(retired.tables.size() + 1);
+  retired.nodes.reserve(retired.nodes.size() + way.nodes.size());
+
+  way.table.store(table.get(), std::memory_order_release);
+  retired.tables.push_back(std::exchange(way.table_holder, std::move(table)));
+  way.retired_count += 1 + way.nodes.size();
+  for (auto& node : way.nodes) retired.nodes.push_back(std::move(node));
+
+  way.nodes = std::move(nodes);
+  way.nodes.reserve(way.max_size);
+  way.hand = 0;
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void ClockLru<T, U, Hash, Eq>::Retire(Way& way, std::unique_ptr<Node> node) {
+  way.retired[way.epoch.load(std::memory_order_relaxed)].nodes.push_back(
+      std::move(node));
+  ++way.retired_count;
+}
+
+// Two-epoch reclamation: the readers lock the indicator of the current epoch,
+// the retired objects are freed once the epoch they were retired in has been
+// switched away from and its indicator has been drained.
+template <typename T, typename U, typename Hash, typename Eq>
+void ClockLru<T, U, Hash, Eq>::TryReclaim(Way& way) {
+  if (way.retired_count < impl::kClockLruRetiredBatch) return;
+
+  concurrent::impl::AsymmetricThreadFenceHeavy();
+
+  const auto current = way.epoch.load(std::memory_order_relaxed);
+  const auto previous = 1 - current;
+  if (!way.indicators[previous].IsFree()) return;
+
+  way.retired[previous] = Retired{};
+  way.retired_count = way.retired[current].nodes.size() +
+                      way.retired[current].tables.size();
+
+  way.epoch.store(previous, std::memory_order_seq_cst);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void ClockLru<T, U, Hash, Equal>::Write(dump::Writer& writer) const {
+  writer.Write(ways_.size());
+
+  for (const auto& way : ways_) {
+    std::unique_lock<engine::Mutex> lock(way->mutex);
+
+    writer.Write(way->nodes.size());
+    for (const auto& node : way->nodes) {
+      writer.Write(node->key);
+      writer.Write(node->value);
+    }
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void ClockLru<T, U, Hash, Equal>::Read(dump::Reader& reader) {
+  Invalidate();
+
+  const auto ways = reader.Read<std::size_t>();
+  for (std::size_t i = 0; i < ways; ++i) {
+    const auto elements_in_way = reader.Read<std::size_t>();
+    for (std::size_t j = 0; j < elements_in_way; ++j) {
+      auto key = reader.Read<T>();
+      auto value = reader.Read<U>();
+      Put(std::move(key), std::move(value));
+    }
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void ClockLru<T, U, Hash, Equal>::NotifyDumper() {
+  if (dumper_ != nullptr) {
+    dumper_->OnUpdateCompleted();
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void ClockLru<T, U, Hash, Equal>::SetDumper(
+    std::shared_ptr<dump::Dumper> dumper) {
+  dumper_ = std::move(dumper);
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
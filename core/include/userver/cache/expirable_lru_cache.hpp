@@ -5,18 +5,30 @@
 
 #include <atomic>
 #include <chrono>
+#include <cmath>
+#include <memory>
 #include <optional>
+#include <unordered_map>
+#include <variant>
+#include <vector>
 
+#include <userver/cache/clock_lru_cache.hpp>
+#include <userver/cache/impl/frequency_sketch.hpp>
 #include <userver/cache/lru_cache_config.hpp>
 #include <userver/cache/lru_cache_statistics.hpp>
 #include <userver/cache/nway_lru_cache.hpp>
 #include <userver/concurrent/mutex_set.hpp>
+#include <userver/concurrent/variable.hpp>
 #include <userver/dump/common.hpp>
 #include <userver/dump/dumper.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/task/shared_task_with_result.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/datetime.hpp>
 #include <userver/utils/impl/cached_time.hpp>
 #include <userver/utils/impl/wait_token_storage.hpp>
+#include <userver/utils/rand.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -28,6 +40,8 @@ template <typename Value>
 struct ExpirableValue final {
   Value value;
   std::chrono::steady_clock::time_point update_time;
+  // How long the update function took, not dumped
+  std::chrono::steady_clock::duration update_duration{};
 };
 
 template <typename Value>
@@ -47,6 +61,96 @@ impl::ExpirableValue<Value> Read(dump::Reader& reader,
       reader.Read<std::chrono::system_clock::time_point>() - now + steady_now};
 }
 
+// NWayLRU or ClockLru, chosen at runtime
+template <typename Key, typename Value, typename Hash, typename Equal>
+class LruEngine final {
+ public:
+  LruEngine(LruCacheEngine engine, size_t ways, size_t way_size,
+            const Hash& hash, const Equal& equal) {
+    switch (engine) {
+      case LruCacheEngine::kNWayLru:
+        impl_.template emplace<NWay>(ways, way_size, hash, equal);
+        return;
+      case LruCacheEngine::kClock:
+        impl_.template emplace<Clock>(ways, way_size, hash, equal);
+        return;
+    }
+    UINVARIANT(false, "Unexpected LRU cache engine");
+  }
+
+  void Put(const Key& key, Value value) {
+    Visit([&](auto& lru) { lru.Put(key, std::move(value)); });
+  }
+
+  template <typename Admit>
+  bool Put(const Key& key, Value value, Admit admit) {
+    return Visit(
+        [&](auto& lru) { return lru.Put(key, std::move(value), admit); });
+  }
+
+  std::optional<Value> Get(const Key& key) {
+    return Visit([&](auto& lru) { return lru.Get(key); });
+  }
+
+  std::vector<std::optional<Value>> GetMany(const std::vector<Key>& keys) {
+    if (auto* nway = std::get_if<NWay>(&impl_)) return nway->GetMany(keys);
+
+    // ClockLru reads take no locks, nothing to group
+    std::vector<std::optional<Value>> result;
+    result.reserve(keys.size());
+    auto& clock = std::get<Clock>(impl_);
+    for (const auto& key : keys) result.push_back(clock.Get(key));
+    return result;
+  }
+
+  void Invalidate() {
+    Visit([](auto& lru) { lru.Invalidate(); });
+  }
+
+  void InvalidateByKey(const Key& key) {
+    Visit([&](auto& lru) { lru.InvalidateByKey(key); });
+  }
+
+  size_t GetSize() const {
+    return Visit([](const auto& lru) { return lru.GetSize(); });
+  }
+
+  void UpdateWaySize(size_t way_size) {
+    Visit([&](auto& lru) { lru.UpdateWaySize(way_size); });
+  }
+
+  void Write(dump::Writer& writer) const {
+    Visit([&](const auto& lru) { lru.Write(writer); });
+  }
+
+  void Read(dump::Reader& reader) {
+    Visit([&](auto& lru) { lru.Read(reader); });
+  }
+
+  void SetDumper(std::shared_ptr<dump::Dumper> dumper) {
+    Visit([&](auto& lru) { lru.SetDumper(std::move(dumper)); });
+  }
+
+ private:
+  using NWay = NWayLRU<Key, Value, Hash, Equal>;
+  using Clock = ClockLru<Key, Value, Hash, Equal>;
+
+  // std::visit is not used to keep the dispatch a single branch
+  template <typename Func>
+  decltype(auto) Visit(Func&& func) {
+    if (auto* clock = std::get_if<Clock>(&impl_)) return func(*clock);
+    return func(std::get<NWay>(impl_));
+  }
+
+  template <typename Func>
+  decltype(auto) Visit(Func&& func) const {
+    if (const auto* clock = std::get_if<Clock>(&impl_)) return func(*clock);
+    return func(std::get<NWay>(impl_));
+  }
+
+  std::variant<std::monostate, NWay, Clock> impl_;
+};
+
 }  // namespace impl
 
 /// @ingroup userver_containers
@@ -62,6 +166,10 @@ class ExpirableLruCache final {
  public:
   using UpdateValueFunc = std::function<Value(const Key&)>;
 
+  /// Returns the values for all the `keys`, in the same order
+  using UpdateManyValuesFunc =
+      std::function<std::vector<Value>(const std::vector<Key>&)>;
+
   /// Cache read mode
   enum class ReadMode {
     kSkipCache,  ///< Do not cache value got from update function
@@ -73,6 +181,10 @@ class ExpirableLruCache final {
   ExpirableLruCache(size_t ways, size_t way_size, const Hash& hash = Hash(),
                     const Equal& equal = Equal());
 
+  /// Same as above, `engine` selects the implementation of the LRU.
+  ExpirableLruCache(size_t ways, size_t way_size, LruCacheEngine engine,
+                    const Hash& hash = Hash(), const Equal& equal = Equal());
+
   ~ExpirableLruCache();
 
   /// For the description of `way_size`,
@@ -90,6 +202,32 @@ class ExpirableLruCache final {
    */
   void SetBackgroundUpdate(BackgroundUpdateMode background_update);
 
+  /// Sets the admission policy for the new items. With
+  /// LruCacheAdmission::kTinyLfu the cache tracks the access frequencies of
+  /// the keys and does not let a new item evict a more popular one.
+  void SetAdmission(LruCacheAdmission admission);
+
+  /**
+   * Enables single-flight updates: concurrent Get() calls with
+   * ReadMode::kUseCache that miss the same key share one call of
+   * "update_func", its result or exception is delivered to all of them.
+   */
+  void SetSingleFlight(bool single_flight);
+
+  /**
+   * With a positive "beta", the background updates start at a random moment
+   * before the expiry ("XFetch"): the longer the update function runs and the
+   * closer the expiry, the more likely the refresh. Larger "beta" refreshes
+   * earlier. With 0 the update starts after a half of the lifetime.
+   */
+  void SetEarlyRefreshBeta(double beta);
+
+  /**
+   * For "stale_while_revalidate" after the expiry GetOptional() and Get()
+   * return the expired value and update it in background.
+   */
+  void SetStaleWhileRevalidate(std::chrono::milliseconds stale_while_revalidate);
+
   /**
    * @returns GetOptional("key", update_func) if it is not std::nullopt.
    * Otherwise the result of update_func(key) is returned, and additionally
@@ -98,6 +236,16 @@ class ExpirableLruCache final {
   Value Get(const Key& key, const UpdateValueFunc& update_func,
             ReadMode read_mode = ReadMode::kUseCache);
 
+  /**
+   * Same as Get() for each of the `keys`, but the lookups are grouped by way
+   * of the LRU, and all the missing or expired keys are passed to a single
+   * call of "update_many_func". Single-flight mode does not apply.
+   * @returns the values in the order of `keys`
+   */
+  std::vector<Value> GetMany(const std::vector<Key>& keys,
+                             const UpdateManyValuesFunc& update_many_func,
+                             ReadMode read_mode = ReadMode::kUseCache);
+
   /**
    * Update value in cache by "update_func" if background update mode is
    * kEnabled and "key" is in cache and not expired but its lifetime ends soon.
@@ -144,6 +292,12 @@ class ExpirableLruCache final {
   /// Add async task for updating value by update_func(key)
   void UpdateInBackground(const Key& key, UpdateValueFunc update_func);
 
+  /// Add async task that puts into the cache the values of the `keys` that
+  /// GetOptionalNoUpdate() would not return, by a single call of
+  /// update_many_func(missing_keys)
+  void PrefetchInBackground(std::vector<Key> keys,
+                            UpdateManyValuesFunc update_many_func);
+
   void Write(dump::Writer& writer) const;
 
   void Read(dump::Reader& reader);
@@ -156,10 +310,31 @@ class ExpirableLruCache final {
   bool IsExpired(std::chrono::steady_clock::time_point update_time,
                  std::chrono::steady_clock::time_point now) const;
 
-  bool ShouldUpdate(std::chrono::steady_clock::time_point update_time,
+  bool ShouldUpdate(const impl::ExpirableValue<Value>& value,
                     std::chrono::steady_clock::time_point now) const;
 
-  cache::NWayLRU<Key, impl::ExpirableValue<Value>, Hash, Equal> lru_;
+  bool CanServeStale(std::chrono::steady_clock::time_point update_time,
+                     std::chrono::steady_clock::time_point now) const;
+
+  Value GetSingleFlight(const Key& key, const UpdateValueFunc& update_func);
+
+  void UpdateManyInBackground(std::vector<Key> keys,
+                              UpdateManyValuesFunc update_many_func);
+
+  void UpdateMany(const std::vector<Key>& keys,
+                  const UpdateManyValuesFunc& update_many_func,
+                  ReadMode read_mode, std::vector<Value>& values);
+
+  impl::ExpirableValue<Value> Update(const Key& key,
+                                     const UpdateValueFunc& update_func);
+
+  using FrequencySketch = impl::FrequencySketch<Key, Hash>;
+
+  FrequencySketch* GetFrequencySketch() const noexcept;
+  void RecordAccess(const Key& key) noexcept;
+  void DoPut(const Key& key, impl::ExpirableValue<Value>&& value);
+
+  impl::LruEngine<Key, impl::ExpirableValue<Value>, Hash, Equal> lru_;
   std::atomic<std::chrono::milliseconds> max_lifetime_{
       std::chrono::milliseconds(0)};
   std::atomic<BackgroundUpdateMode> background_update_mode_{
@@ -167,21 +342,53 @@ class ExpirableLruCache final {
   impl::ExpirableLruCacheStatistics stats_;
   concurrent::MutexSet<Key, Hash, Equal> mutex_set_;
   utils::impl::WaitTokenStorage wait_token_storage_;
+
+  const Hash hash_;
+  const size_t ways_;
+  std::atomic<size_t> way_size_;
+  std::atomic<LruCacheAdmission> admission_{LruCacheAdmission::kAll};
+  // Created on the first SetAdmission(kTinyLfu) and kept until destruction,
+  // so the readers need no synchronization
+  std::atomic<FrequencySketch*> frequency_sketch_{nullptr};
+
+  std::atomic<bool> single_flight_{false};
+  std::atomic<double> early_refresh_beta_{0};
+  std::atomic<std::chrono::milliseconds> stale_while_revalidate_{
+      std::chrono::milliseconds(0)};
+
+  using SharedUpdate = engine::SharedTaskWithResult<Value>;
+  // Destroyed first, the updates in flight use the other members
+  concurrent::Variable<std::unordered_map<Key, std::shared_ptr<SharedUpdate>,
+                                          Hash, Equal>>
+      updates_in_flight_;
 };
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 ExpirableLruCache<Key, Value, Hash, Equal>::ExpirableLruCache(
     size_t ways, size_t way_size, const Hash& hash, const Equal& equal)
-    : lru_(ways, way_size, hash, equal),
-      mutex_set_{ways, way_size, hash, equal} {}
+    : ExpirableLruCache(ways, way_size, LruCacheEngine::kNWayLru, hash,
+                        equal) {}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+ExpirableLruCache<Key, Value, Hash, Equal>::ExpirableLruCache(
+    size_t ways, size_t way_size, LruCacheEngine engine, const Hash& hash,
+    const Equal& equal)
+    : lru_(engine, ways, way_size, hash, equal),
+      mutex_set_{ways, way_size, hash, equal},
+      hash_(hash),
+      ways_(ways),
+      way_size_(way_size),
+      updates_in_flight_(0, hash, equal) {}
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 ExpirableLruCache<Key, Value, Hash, Equal>::~ExpirableLruCache() {
   wait_token_storage_.WaitForAllTokens();
+  delete frequency_sketch_.load();
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 void ExpirableLruCache<Key, Value, Hash, Equal>::SetWaySize(size_t way_size) {
+  way_size_ = way_size;
   lru_.UpdateWaySize(way_size);
 }
 
@@ -203,6 +410,40 @@ void ExpirableLruCache<Key, Value, Hash, Equal>::SetBackgroundUpdate(
   background_update_mode_ = background_update;
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetAdmission(
+    LruCacheAdmission admission) {
+  if (admission == LruCacheAdmission::kTinyLfu && !frequency_sketch_.load()) {
+    // The sketch keeps the size the cache had when the policy was enabled
+    auto sketch =
+        std::make_unique<FrequencySketch>(ways_ * way_size_.load(), hash_);
+    FrequencySketch* expected = nullptr;
+    if (frequency_sketch_.compare_exchange_strong(expected, sketch.get())) {
+      // Now owned by frequency_sketch_
+      sketch.release();
+    }
+  }
+  admission_ = admission;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetSingleFlight(
+    bool single_flight) {
+  single_flight_ = single_flight;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetEarlyRefreshBeta(
+    double beta) {
+  early_refresh_beta_ = beta;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetStaleWhileRevalidate(
+    std::chrono::milliseconds stale_while_revalidate) {
+  stale_while_revalidate_ = stale_while_revalidate;
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 Value ExpirableLruCache<Key, Value, Hash, Equal>::Get(
     const Key& key, const UpdateValueFunc& update_func, ReadMode read_mode) {
@@ -212,6 +453,10 @@ Value ExpirableLruCache<Key, Value, Hash, Equal>::Get(
     return std::move(*opt_old_value);
   }
 
+  if (read_mode == ReadMode::kUseCache && single_flight_.load()) {
+    return GetSingleFlight(key, update_func);
+  }
+
   auto mutex = mutex_set_.GetMutexForKey(key);
   std::lock_guard lock(mutex);
   // Test one more time - concurrent ExpirableLruCache::Get()
@@ -221,16 +466,70 @@ Value ExpirableLruCache<Key, Value, Hash, Equal>::Get(
     return std::move(old_value->value);
   }
 
+  const auto update_start = utils::datetime::SteadyNow();
   auto value = update_func(key);
   if (read_mode == ReadMode::kUseCache) {
-    lru_.Put(key, {value, now});
+    DoPut(key, {value, now, utils::datetime::SteadyNow() - update_start});
   }
   return value;
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::vector<Value> ExpirableLruCache<Key, Value, Hash, Equal>::GetMany(
+    const std::vector<Key>& keys, const UpdateManyValuesFunc& update_many_func,
+    ReadMode read_mode) {
+  for (const auto& key : keys) RecordAccess(key);
+  const auto now = utils::datetime::SteadyNow();
+  auto old_values = lru_.GetMany(keys);
+
+  std::vector<Key> missing_keys;
+  std::vector<Key> refreshed_keys;
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    auto& old_value = old_values[i];
+    if (old_value) {
+      if (!IsExpired(old_value->update_time, now)) {
+        impl::CacheHit(stats_);
+        if (ShouldUpdate(*old_value, now)) refreshed_keys.push_back(keys[i]);
+        continue;
+      }
+
+      impl::CacheStale(stats_);
+      if (CanServeStale(old_value->update_time, now)) {
+        refreshed_keys.push_back(keys[i]);
+        continue;
+      }
+      old_value.reset();
+    }
+    impl::CacheMiss(stats_);
+    missing_keys.push_back(keys[i]);
+  }
+
+  if (!refreshed_keys.empty()) {
+    UpdateManyInBackground(std::move(refreshed_keys), update_many_func);
+  }
+
+  std::vector<Value> missing_values;
+  if (!missing_keys.empty()) {
+    UpdateMany(missing_keys, update_many_func, read_mode, missing_values);
+  }
+
+  std::vector<Value> result;
+  result.reserve(keys.size());
+  auto missing_it = missing_values.begin();
+  for (auto& old_value : old_values) {
+    if (old_value) {
+      result.push_back(std::move(old_value->value));
+    } else {
+      result.push_back(std::move(*missing_it++));
+    }
+  }
+  return result;
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 std::optional<Value> ExpirableLruCache<Key, Value, Hash, Equal>::GetOptional(
     const Key& key, const UpdateValueFunc& update_func) {
+  RecordAccess(key);
   auto now = utils::datetime::SteadyNow();
   auto old_value = lru_.Get(key);
 
@@ -238,13 +537,17 @@ std::optional<Value> ExpirableLruCache<Key, Value, Hash, Equal>::GetOptional(
     if (!IsExpired(old_value->update_time, now)) {
       impl::CacheHit(stats_);
 
-      if (ShouldUpdate(old_value->update_time, now)) {
+      if (ShouldUpdate(*old_value, now)) {
         UpdateInBackground(key, update_func);
       }
 
       return std::move(old_value->value);
-    } else {
-      impl::CacheStale(stats_);
+    }
+
+    impl::CacheStale(stats_);
+    if (CanServeStale(old_value->update_time, now)) {
+      UpdateInBackground(key, update_func);
+      return std::move(old_value->value);
     }
   }
   impl::CacheMiss(stats_);
@@ -256,6 +559,7 @@ template <typename Key, typename Value, typename Hash, typename Equal>
 std::optional<Value>
 ExpirableLruCache<Key, Value, Hash, Equal>::GetOptionalUnexpirable(
     const Key& key) {
+  RecordAccess(key);
   auto old_value = lru_.Get(key);
 
   if (old_value) {
@@ -271,13 +575,14 @@ template <typename Key, typename Value, typename Hash, typename Equal>
 std::optional<Value>
 ExpirableLruCache<Key, Value, Hash, Equal>::GetOptionalUnexpirableWithUpdate(
     const Key& key, const UpdateValueFunc& update_func) {
+  RecordAccess(key);
   auto now = utils::datetime::SteadyNow();
   auto old_value = lru_.Get(key);
 
   if (old_value) {
     impl::CacheHit(stats_);
 
-    if (ShouldUpdate(old_value->update_time, now)) {
+    if (ShouldUpdate(*old_value, now)) {
       UpdateInBackground(key, update_func);
     }
 
@@ -292,6 +597,7 @@ template <typename Key, typename Value, typename Hash, typename Equal>
 std::optional<Value>
 ExpirableLruCache<Key, Value, Hash, Equal>::GetOptionalNoUpdate(
     const Key& key) {
+  RecordAccess(key);
   auto now = utils::datetime::SteadyNow();
   auto old_value = lru_.Get(key);
 
@@ -312,13 +618,13 @@ ExpirableLruCache<Key, Value, Hash, Equal>::GetOptionalNoUpdate(
 template <typename Key, typename Value, typename Hash, typename Equal>
 void ExpirableLruCache<Key, Value, Hash, Equal>::Put(const Key& key,
                                                      const Value& value) {
-  lru_.Put(key, {value, utils::datetime::SteadyNow()});
+  DoPut(key, {value, utils::datetime::SteadyNow()});
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 void ExpirableLruCache<Key, Value, Hash, Equal>::Put(const Key& key,
                                                      Value&& value) {
-  lru_.Put(key, {std::move(value), utils::datetime::SteadyNow()});
+  DoPut(key, {std::move(value), utils::datetime::SteadyNow()});
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
@@ -359,9 +665,40 @@ void ExpirableLruCache<Key, Value, Hash, Equal>::UpdateInBackground(
       return;
     }
 
-    auto now = utils::datetime::SteadyNow();
-    auto value = update_func(key);
-    lru_.Put(key, {value, now});
+    DoPut(key, Update(key, update_func));
+  }).Detach();
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::PrefetchInBackground(
+    std::vector<Key> keys, UpdateManyValuesFunc update_many_func) {
+  const auto now = utils::datetime::SteadyNow();
+  const auto old_values = lru_.GetMany(keys);
+
+  std::vector<Key> missing_keys;
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    const auto& old_value = old_values[i];
+    if (!old_value || IsExpired(old_value->update_time, now)) {
+      missing_keys.push_back(std::move(keys[i]));
+    }
+  }
+  if (missing_keys.empty()) return;
+
+  UpdateManyInBackground(std::move(missing_keys), std::move(update_many_func));
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::UpdateManyInBackground(
+    std::vector<Key> keys, UpdateManyValuesFunc update_many_func) {
+  stats_.total.background_updates += keys.size();
+  stats_.recent.GetCurrentCounter().background_updates += keys.size();
+
+  // cache will wait for all detached tasks in ~ExpirableLruCache()
+  engine::AsyncNoSpan([token = wait_token_storage_.GetToken(), this,
+                       keys = std::move(keys),
+                       update_many_func = std::move(update_many_func)] {
+    std::vector<Value> values;
+    UpdateMany(keys, update_many_func, ReadMode::kUseCache, values);
   }).Detach();
 }
 
@@ -375,11 +712,149 @@ bool ExpirableLruCache<Key, Value, Hash, Equal>::IsExpired(
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 bool ExpirableLruCache<Key, Value, Hash, Equal>::ShouldUpdate(
-    std::chrono::steady_clock::time_point update_time,
+    const impl::ExpirableValue<Value>& value,
     std::chrono::steady_clock::time_point now) const {
   auto max_lifetime = max_lifetime_.load();
-  return (background_update_mode_.load() == BackgroundUpdateMode::kEnabled) &&
-         max_lifetime.count() != 0 && update_time + max_lifetime / 2 < now;
+  if (background_update_mode_.load() != BackgroundUpdateMode::kEnabled ||
+      max_lifetime.count() == 0) {
+    return false;
+  }
+
+  const auto beta = early_refresh_beta_.load();
+  if (beta <= 0 || value.update_duration.count() <= 0) {
+    return value.update_time + max_lifetime / 2 < now;
+  }
+
+  // XFetch, see "Optimal Probabilistic Cache Stampede Prevention"
+  // by A. Vattani et al. -log(rand) is exponentially distributed.
+  const auto random = 1.0 - utils::RandRange(1.0);
+  const std::chrono::duration<double> until_expiry =
+      value.update_time + max_lifetime - now;
+  return until_expiry <= std::chrono::duration<double>(value.update_duration) *
+                             beta * -std::log(random);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+bool ExpirableLruCache<Key, Value, Hash, Equal>::CanServeStale(
+    std::chrono::steady_clock::time_point update_time,
+    std::chrono::steady_clock::time_point now) const {
+  const auto max_lifetime = max_lifetime_.load();
+  const auto stale_while_revalidate = stale_while_revalidate_.load();
+  return max_lifetime.count() != 0 && stale_while_revalidate.count() != 0 &&
+         now <= update_time + max_lifetime + stale_while_revalidate;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+impl::ExpirableValue<Value> ExpirableLruCache<Key, Value, Hash, Equal>::Update(
+    const Key& key, const UpdateValueFunc& update_func) {
+  const auto now = utils::datetime::SteadyNow();
+  auto value = update_func(key);
+  return {std::move(value), now, utils::datetime::SteadyNow() - now};
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+Value ExpirableLruCache<Key, Value, Hash, Equal>::GetSingleFlight(
+    const Key& key, const UpdateValueFunc& update_func) {
+  std::shared_ptr<SharedUpdate> update;
+  bool is_leader = false;
+  {
+    auto updates = updates_in_flight_.Lock();
+    auto& current = (*updates)[key];
+    if (!current) {
+      current = std::make_shared<SharedUpdate>(
+          utils::SharedAsync("lru_cache_single_flight_update",
+                             [this, key, update_func] {
+                               // A previous update might have put the value
+                               auto old_value = lru_.Get(key);
+                               if (old_value &&
+                                   !IsExpired(old_value->update_time,
+                                              utils::datetime::SteadyNow())) {
+                                 return std::move(old_value->value);
+                               }
+
+                               auto value = Update(key, update_func);
+                               auto result = value.value;
+                               DoPut(key, std::move(value));
+                               return result;
+                             }));
+      is_leader = true;
+    }
+    update = current;
+  }
+
+  // The first caller forgets the update when it is done, so that the failed
+  // or rejected updates are not shared with the later calls
+  const auto forget = [&] {
+    if (!is_leader) return;
+    auto updates = updates_in_flight_.Lock();
+    const auto it = updates->find(key);
+    if (it != updates->end() && it->second == update) updates->erase(it);
+  };
+
+  try {
+    Value value = update->Get();
+    forget();
+    return value;
+  } catch (...) {
+    forget();
+    throw;
+  }
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::UpdateMany(
+    const std::vector<Key>& keys, const UpdateManyValuesFunc& update_many_func,
+    ReadMode read_mode, std::vector<Value>& values) {
+  const auto update_start = utils::datetime::SteadyNow();
+  values = update_many_func(keys);
+  UINVARIANT(values.size() == keys.size(),
+             "The update function must return a value for each of the keys");
+  if (read_mode != ReadMode::kUseCache) return;
+
+  // The batch duration is what a refresh of any of the keys takes
+  const auto update_duration = utils::datetime::SteadyNow() - update_start;
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    DoPut(keys[i], {values[i], update_start, update_duration});
+  }
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+typename ExpirableLruCache<Key, Value, Hash, Equal>::FrequencySketch*
+ExpirableLruCache<Key, Value, Hash, Equal>::GetFrequencySketch()
+    const noexcept {
+  if (admission_.load(std::memory_order_relaxed) !=
+      LruCacheAdmission::kTinyLfu) {
+    return nullptr;
+  }
+  return frequency_sketch_.load(std::memory_order_acquire);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::RecordAccess(
+    const Key& key) noexcept {
+  if (auto* sketch = GetFrequencySketch()) sketch->Increment(key);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::DoPut(
+    const Key& key, impl::ExpirableValue<Value>&& value) {
+  auto* sketch = GetFrequencySketch();
+  if (!sketch) {
+    lru_.Put(key, std::move(value));
+    return;
+  }
+
+  lru_.Put(key, std::move(value), [&](const Key& victim) {
+    // Ties go to the victim, so a scan of the new keys does not wash out
+    // the cache
+    const bool admitted = sketch->Estimate(key) > sketch->Estimate(victim);
+    if (admitted) {
+      impl::CacheAdmitted(stats_);
+    } else {
+      impl::CacheRejected(stats_);
+    }
+    return admitted;
+  });
 }
 
 template <typename Key, typename Value, typename Hash = std::hash<Key>,
@@ -393,6 +868,15 @@ class LruCacheWrapper final {
                   typename Cache::UpdateValueFunc update_func)
       : cache_(std::move(cache)), update_func_(std::move(update_func)) {}
 
+  /// Same as above, "update_many_func" is used by GetMany() and
+  /// PrefetchInBackground() instead of calling "update_func" for each key
+  LruCacheWrapper(std::shared_ptr<Cache> cache,
+                  typename Cache::UpdateValueFunc update_func,
+                  typename Cache::UpdateManyValuesFunc update_many_func)
+      : cache_(std::move(cache)),
+        update_func_(std::move(update_func)),
+        update_many_func_(std::move(update_many_func)) {}
+
   /// Get cached value or evaluates if "key" is missing in cache
   Value Get(const Key& key, ReadMode read_mode = ReadMode::kUseCache) {
     return cache_->Get(key, update_func_, read_mode);
@@ -403,6 +887,13 @@ class LruCacheWrapper final {
     return cache_->GetOptional(key, update_func_);
   }
 
+  /// Get cached values or evaluates the ones missing in cache, see
+  /// ExpirableLruCache::GetMany()
+  std::vector<Value> GetMany(const std::vector<Key>& keys,
+                             ReadMode read_mode = ReadMode::kUseCache) {
+    return cache_->GetMany(keys, GetUpdateManyFunc(), read_mode);
+  }
+
   void InvalidateByKey(const Key& key) { cache_->InvalidateByKey(key); }
 
   /// Update cached value in background
@@ -410,12 +901,29 @@ class LruCacheWrapper final {
     cache_->UpdateInBackground(key, update_func_);
   }
 
+  /// Put the values missing in cache in background, see
+  /// ExpirableLruCache::PrefetchInBackground()
+  void PrefetchInBackground(std::vector<Key> keys) {
+    cache_->PrefetchInBackground(std::move(keys), GetUpdateManyFunc());
+  }
+
   /// Get raw cache. For internal use.
   std::shared_ptr<Cache> GetCache() { return cache_; }
 
  private:
+  typename Cache::UpdateManyValuesFunc GetUpdateManyFunc() const {
+    if (update_many_func_) return update_many_func_;
+    return [update_func = update_func_](const std::vector<Key>& keys) {
+      std::vector<Value> values;
+      values.reserve(keys.size());
+      for (const auto& key : keys) values.push_back(update_func(key));
+      return values;
+    };
+  }
+
   std::shared_ptr<Cache> cache_;
   typename Cache::UpdateValueFunc update_func_;
+  typename Cache::UpdateManyValuesFunc update_many_func_;
 };
 
 template <typename Key, typename Value, typename Hash, typename Equal>
@@ -0,0 +1,138 @@
+#pragma once
+
+/// @file userver/cache/huge_page_allocator.hpp
+/// @brief @copybrief cache::HugePageAllocator
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @brief Monotonic memory arena on huge pages, used by
+/// cache::HugePageAllocator
+///
+/// The memory is mapped in chunks of 2 MiB multiples, each next chunk is
+/// twice as big as the previous one. The chunks are mapped with MAP_HUGETLB
+/// if the system has reserved huge pages, otherwise they are aligned to 2 MiB
+/// and advised with MADV_HUGEPAGE for the transparent huge pages.
+///
+/// Deallocations do nothing, all the memory is unmapped at once on the arena
+/// destruction. The arena is not thread-safe.
+class HugePageArena final {
+ public:
+  HugePageArena() noexcept = default;
+  HugePageArena(HugePageArena&&) = delete;
+  HugePageArena& operator=(HugePageArena&&) = delete;
+  ~HugePageArena();
+
+  /// @throws std::bad_alloc if the memory could not be mapped
+  void* Allocate(std::size_t size, std::size_t alignment);
+
+  /// Memory mapped by the arena
+  std::size_t GetMappedBytes() const noexcept { return mapped_bytes_; }
+
+  /// Memory given out by Allocate(), including the deallocated one
+  std::size_t GetAllocatedBytes() const noexcept { return allocated_bytes_; }
+
+ private:
+  struct Chunk final {
+    void* data;
+    std::size_t size;
+  };
+
+  void MapChunk(std::size_t min_size);
+
+  std::vector<Chunk> chunks_;
+  std::byte* free_begin_{nullptr};
+  std::size_t free_size_{0};
+  std::size_t mapped_bytes_{0};
+  std::size_t allocated_bytes_{0};
+};
+
+/// @ingroup userver_containers
+///
+/// @brief Allocator of the cache containers that backs them with huge pages
+///
+/// The huge caches spend a noticeable share of the lookup time on TLB misses,
+/// huge pages reduce the number of the TLB entries required for the data.
+///
+/// A default-constructed allocator creates a new cache::HugePageArena, the
+/// copies of the allocator share it. So each container gets an arena of its
+/// own, and the memory is released as a whole when the container, e.g. a
+/// retired cache snapshot, is destroyed. The containers with this allocator
+/// may be restored from cache dumps as usual.
+///
+/// As the arena never reuses the deallocated memory, use the allocator only
+/// for the large containers that are filled once, e.g. a hash map of a full
+/// cache update, and reserve their size beforehand. Do not use it for the
+/// small nested containers, each of them would map at least 2 MiB. A container
+/// must not be modified concurrently with the other containers sharing its
+/// arena.
+///
+/// @code
+/// using Map = std::unordered_map<
+///     Key, Value, std::hash<Key>, std::equal_to<Key>,
+///     cache::HugePageAllocator<std::pair<const Key, Value>>>;
+/// @endcode
+///
+/// See a benchmark in cache/huge_page_allocator_benchmark.cpp
+template <typename T>
+class HugePageAllocator {
+ public:
+  using value_type = T;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  HugePageAllocator() : arena_(std::make_shared<HugePageArena>()) {}
+
+  // Not movable, the moved-from containers must still have an arena
+  HugePageAllocator(const HugePageAllocator&) noexcept = default;
+  HugePageAllocator& operator=(const HugePageAllocator&) noexcept = default;
+
+  template <typename U>
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  HugePageAllocator(const HugePageAllocator<U>& other) noexcept
+      : arena_(other.GetArena()) {}
+
+  T* allocate(std::size_t n) {
+    if (n > static_cast<std::size_t>(-1) / sizeof(T)) throw std::bad_alloc();
+    return static_cast<T*>(arena_->Allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T*, std::size_t) noexcept {}
+
+  /// A copy of a container gets a new arena, so that distinct containers
+  /// could be modified from different threads
+  HugePageAllocator select_on_container_copy_construction() const {
+    return HugePageAllocator{};
+  }
+
+  const std::shared_ptr<HugePageArena>& GetArena() const noexcept {
+    return arena_;
+  }
+
+ private:
+  std::shared_ptr<HugePageArena> arena_;
+};
+
+template <typename T, typename U>
+bool operator==(const HugePageAllocator<T>& lhs,
+                const HugePageAllocator<U>& rhs) noexcept {
+  return lhs.GetArena() == rhs.GetArena();
+}
+
+template <typename T, typename U>
+bool operator!=(const HugePageAllocator<T>& lhs,
+                const HugePageAllocator<U>& rhs) noexcept {
+  return !(lhs == rhs);
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -57,7 +57,13 @@ yaml_config::Schema GetLruCacheComponentBaseSchema();
 /// ---- | ----------- | -------------
 /// size | max amount of items to store in cache | --
 /// ways | number of ways for associative cache | --
+/// engine | `nway-lru` (cache::NWayLRU) or `clock` (cache::ClockLru, lock-free reads) | nway-lru
 /// lifetime | TTL for cache entries (0 is unlimited) | 0
+/// background-update | enables asynchronous updates for expiring values | false
+/// admission | `none` or `tiny-lfu`, see cache::LruCacheAdmission | none
+/// single-flight | concurrent misses of a key wait for a single update | false
+/// early-refresh-beta | a positive value starts the background updates at a random moment before the expiry, see cache::ExpirableLruCache::SetEarlyRefreshBeta | 0
+/// stale-while-revalidate | for how long the expired values are returned while being updated in background | 0
 /// config-settings | enables dynamic reconfiguration with CacheConfigSet | true
 ///
 /// ## Example usage:
@@ -129,7 +135,8 @@ LruCacheComponent<Key, Value, Hash, Equal>::LruCacheComponent(
       name_(components::GetCurrentComponentName(config)),
       static_config_(config),
       cache_(std::make_shared<Cache>(static_config_.ways,
-                                     static_config_.GetWaySize())) {
+                                     static_config_.GetWaySize(),
+                                     static_config_.engine)) {
   if (impl::IsDumpSupportEnabled(config)) {
     dumper_ = std::make_shared<dump::Dumper>(
         config, context, static_cast<dump::DumpableEntity&>(*this));
@@ -139,6 +146,10 @@ LruCacheComponent<Key, Value, Hash, Equal>::LruCacheComponent(
 
   cache_->SetMaxLifetime(static_config_.config.lifetime);
   cache_->SetBackgroundUpdate(static_config_.config.background_update);
+  cache_->SetAdmission(static_config_.config.admission);
+  cache_->SetSingleFlight(static_config_.config.single_flight);
+  cache_->SetEarlyRefreshBeta(static_config_.config.early_refresh_beta);
+  cache_->SetStaleWhileRevalidate(static_config_.config.stale_while_revalidate);
 
   if (static_config_.use_dynamic_config) {
     LOG_INFO() << "Dynamic LRU cache config is enabled, subscribing on "
@@ -206,6 +217,10 @@ void LruCacheComponent<Key, Value, Hash, Equal>::UpdateConfig(
   cache_->SetWaySize(config.GetWaySize(static_config_.ways));
   cache_->SetMaxLifetime(config.lifetime);
   cache_->SetBackgroundUpdate(config.background_update);
+  cache_->SetAdmission(config.admission);
+  cache_->SetSingleFlight(config.single_flight);
+  cache_->SetEarlyRefreshBeta(config.early_refresh_beta);
+  cache_->SetStaleWhileRevalidate(config.stale_while_revalidate);
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
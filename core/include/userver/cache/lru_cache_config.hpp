@@ -3,6 +3,7 @@
 #include <chrono>
 #include <cstddef>
 #include <optional>
+#include <string_view>
 #include <unordered_map>
 
 #include <userver/components/component_fwd.hpp>
@@ -19,6 +20,25 @@ enum class BackgroundUpdateMode {
   kDisabled,
 };
 
+/// Which new items are let into a full LRU cache
+enum class LruCacheAdmission {
+  kAll,      ///< every new item evicts the least recently used one
+  kTinyLfu,  ///< a new item evicts only a less frequently accessed one
+};
+
+std::string_view ToString(LruCacheAdmission admission);
+
+/// The implementation behind the LRU cache components
+enum class LruCacheEngine {
+  kNWayLru,  ///< cache::NWayLRU, a mutex per way, exact LRU
+  kClock,    ///< cache::ClockLru, lock-free reads, CLOCK eviction
+};
+
+LruCacheEngine Parse(const yaml_config::YamlConfig& config,
+                     formats::parse::To<LruCacheEngine>);
+
+std::string_view ToString(LruCacheEngine engine);
+
 struct LruCacheConfig final {
   explicit LruCacheConfig(const yaml_config::YamlConfig& config);
   explicit LruCacheConfig(const components::ComponentConfig& config);
@@ -30,6 +50,10 @@ struct LruCacheConfig final {
   std::size_t size;
   std::chrono::milliseconds lifetime;
   BackgroundUpdateMode background_update;
+  LruCacheAdmission admission;
+  bool single_flight;
+  double early_refresh_beta;
+  std::chrono::milliseconds stale_while_revalidate;
 };
 
 LruCacheConfig Parse(const formats::json::Value& value,
@@ -43,6 +67,7 @@ struct LruCacheConfigStatic final {
 
   LruCacheConfig config;
   std::size_t ways;
+  LruCacheEngine engine;
   bool use_dynamic_config;
 };
 
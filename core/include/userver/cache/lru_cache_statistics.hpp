@@ -16,6 +16,8 @@ struct ExpirableLruCacheStatisticsBase final {
   std::atomic<std::size_t> misses{0};
   std::atomic<std::size_t> stale{0};
   std::atomic<std::size_t> background_updates{0};
+  std::atomic<std::size_t> admitted{0};
+  std::atomic<std::size_t> rejected{0};
 
   ExpirableLruCacheStatisticsBase();
 
@@ -40,6 +42,10 @@ void CacheMiss(ExpirableLruCacheStatistics& stats);
 
 void CacheStale(ExpirableLruCacheStatistics& stats);
 
+void CacheAdmitted(ExpirableLruCacheStatistics& stats);
+
+void CacheRejected(ExpirableLruCacheStatistics& stats);
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const ExpirableLruCacheStatistics& stats);
 
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <algorithm>
 #include <functional>
 #include <optional>
+#include <utility>
 #include <vector>
 
 #include <boost/container_hash/hash.hpp>
@@ -38,6 +40,13 @@ class NWayLRU final {
 
   void Put(const T& key, U value);
 
+  /// Same as Put(), but if the way is full and the key is not in it,
+  /// `admit(victim_key)` decides whether the least recently used item should
+  /// give way to the new one.
+  /// @returns whether the value was stored
+  template <typename Admit>
+  bool Put(const T& key, U value, Admit admit);
+
   template <typename Validator>
   std::optional<U> Get(const T& key, Validator validator);
 
@@ -45,6 +54,11 @@ class NWayLRU final {
     return Get(key, [](const U&) { return true; });
   }
 
+  /// Same as Get() for each of the `keys`, but the keys are grouped by way,
+  /// so that the lock of each way is taken once.
+  /// @returns the values in the order of `keys`
+  std::vector<std::optional<U>> GetMany(const std::vector<T>& keys);
+
   U GetOr(const T& key, const U& default_value);
 
   void Invalidate();
@@ -79,6 +93,7 @@ class NWayLRU final {
     LruMap<T, U, Hash, Equal> cache;
   };
 
+  std::size_t GetWayIndex(const T& key) const;
   Way& GetWay(const T& key);
 
   void NotifyDumper();
@@ -109,6 +124,23 @@ void NWayLRU<T, U, Hash, Eq>::Put(const T& key, U value) {
   NotifyDumper();
 }
 
+template <typename T, typename U, typename Hash, typename Eq>
+template <typename Admit>
+bool NWayLRU<T, U, Hash, Eq>::Put(const T& key, U value, Admit admit) {
+  auto& way = GetWay(key);
+  {
+    std::unique_lock<engine::Mutex> lock(way.mutex);
+    if (way.cache.GetSize() >= way.cache.GetCapacity() &&
+        !way.cache.Get(key)) {
+      const auto* victim = way.cache.GetLeastUsedKey();
+      if (victim && !admit(*victim)) return false;
+    }
+    way.cache.Put(key, std::move(value));
+  }
+  NotifyDumper();
+  return true;
+}
+
 template <typename T, typename U, typename Hash, typename Eq>
 template <typename Validator>
 std::optional<U> NWayLRU<T, U, Hash, Eq>::Get(const T& key,
@@ -135,6 +167,31 @@ void NWayLRU<T, U, Hash, Eq>::InvalidateByKey(const T& key) {
   NotifyDumper();
 }
 
+template <typename T, typename U, typename Hash, typename Eq>
+std::vector<std::optional<U>> NWayLRU<T, U, Hash, Eq>::GetMany(
+    const std::vector<T>& keys) {
+  // (way index, key index), sorted to visit each way once
+  std::vector<std::pair<std::size_t, std::size_t>> order;
+  order.reserve(keys.size());
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    order.emplace_back(GetWayIndex(keys[i]), i);
+  }
+  std::sort(order.begin(), order.end());
+
+  std::vector<std::optional<U>> result(keys.size());
+  for (auto it = order.begin(); it != order.end();) {
+    const auto way_index = it->first;
+    auto& way = caches_[way_index];
+    std::unique_lock<engine::Mutex> lock(way.mutex);
+    for (; it != order.end() && it->first == way_index; ++it) {
+      if (auto* value = way.cache.Get(keys[it->second])) {
+        result[it->second] = *value;
+      }
+    }
+  }
+  return result;
+}
+
 template <typename T, typename U, typename Hash, typename Eq>
 U NWayLRU<T, U, Hash, Eq>::GetOr(const T& key, const U& default_value) {
   auto& way = GetWay(key);
@@ -179,16 +236,20 @@ void NWayLRU<T, U, Hash, Eq>::UpdateWaySize(size_t way_size) {
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
-typename NWayLRU<T, U, Hash, Eq>::Way& NWayLRU<T, U, Hash, Eq>::GetWay(
-    const T& key) {
+std::size_t NWayLRU<T, U, Hash, Eq>::GetWayIndex(const T& key) const {
   /// It is needed to twist hash because there is hash map in LruMap. Otherwise
   /// nodes will fall into one bucket. According to
   /// https://www.boost.org/doc/libs/1_83_0/libs/container_hash/doc/html/hash.html#notes_hash_combine
   /// hash_combine can be treated as hash itself
   auto seed = hash_fn_(key);
   boost::hash_combine(seed, 0);
-  auto n = seed % caches_.size();
-  return caches_[n];
+  return seed % caches_.size();
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+typename NWayLRU<T, U, Hash, Eq>::Way& NWayLRU<T, U, Hash, Eq>::GetWay(
+    const T& key) {
+  return caches_[GetWayIndex(key)];
 }
 
 template <typename T, typename U, typename Hash, typename Equal>
@@ -0,0 +1,426 @@
+#pragma once
+
+/// @file userver/cache/persistent_map.hpp
+/// @brief @copybrief cache::PersistentMap
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <userver/dump/operations.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @ingroup userver_containers
+///
+/// @brief Hash map with O(1) copies, the copies share the unchanged parts
+///
+/// A hash array mapped trie (HAMT): a modification copies only the path from
+/// the root to the changed item, i.e. O(log64(size)) nodes, the rest of the
+/// trie stays shared with the other copies. The nodes owned solely by the
+/// map are modified in place, so a series of modifications of a fresh copy
+/// costs O(changes) time and memory.
+///
+/// Meant for the huge caches with incremental updates: instead of copying
+/// the whole container on each UpdateType::kIncremental update, copy the
+/// current snapshot, apply the delta to the copy and Set() it:
+///
+/// @code
+/// auto data = std::make_unique<Map>(*Get());  // O(1)
+/// for (auto& [key, value] : changed) data->Put(key, std::move(value));
+/// for (const auto& key : removed) data->Erase(key);
+/// Set(std::move(data));
+/// @endcode
+///
+/// The snapshots given out to the readers are never modified. Like with the
+/// standard containers, a single map must not be modified concurrently with
+/// other accesses to it, while distinct copies may be used from any threads.
+/// Modifications invalidate the iterators and the pointers to the values.
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename Equal = std::equal_to<Key>>
+class PersistentMap final {
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = std::pair<const Key, Value>;
+  using size_type = std::size_t;
+
+  class const_iterator;
+  using iterator = const_iterator;
+
+  explicit PersistentMap(const Hash& hash = Hash(),
+                         const Equal& equal = Equal());
+
+  /// Adds or replaces the value
+  /// @returns true if the key was not in the map
+  bool Put(const Key& key, Value value);
+
+  /// @returns true if the key was in the map
+  bool Erase(const Key& key);
+
+  /// @returns pointer to the value or nullptr
+  const Value* Get(const Key& key) const;
+
+  bool Contains(const Key& key) const { return Get(key) != nullptr; }
+
+  void Clear() noexcept;
+
+  std::size_t size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  const_iterator begin() const { return const_iterator{root_.get()}; }
+  const_iterator end() const { return const_iterator{}; }
+
+ private:
+  struct Leaf;
+  struct Node;
+  using LeafPtr = std::shared_ptr<Leaf>;
+  using NodePtr = std::shared_ptr<Node>;
+  using Child = std::variant<LeafPtr, NodePtr>;
+
+  static constexpr unsigned kBitsPerLevel = 6;
+  static constexpr unsigned kHashBits = 64;
+  static constexpr std::uint64_t kLevelMask = (1 << kBitsPerLevel) - 1;
+  // The levels of 64-way nodes plus the level of the collision nodes
+  static constexpr std::size_t kMaxDepth =
+      (kHashBits + kBitsPerLevel - 1) / kBitsPerLevel + 1;
+
+  struct Leaf final {
+    template <typename... Args>
+    explicit Leaf(std::uint64_t hash, Args&&... args)
+        : hash(hash), value(std::forward<Args>(args)...) {}
+
+    const std::uint64_t hash;
+    value_type value;
+  };
+
+  // At the depths with the hash bits left the children are ordered by
+  // their bits in the bitmap, deeper the children are leaves with
+  // the same hash in no particular order.
+  struct Node final {
+    std::uint64_t bitmap{0};
+    std::vector<Child> children;
+  };
+
+  std::uint64_t GetHash(const Key& key) const;
+
+  static std::uint64_t GetBit(std::uint64_t hash, unsigned shift) noexcept;
+  static std::size_t GetPosition(std::uint64_t bitmap,
+                                 std::uint64_t bit) noexcept;
+
+  template <typename T>
+  static void MakeUnique(std::shared_ptr<T>& ptr);
+
+  static void AddLeaf(Node& node, unsigned shift, LeafPtr leaf);
+
+  bool Put(NodePtr& node, unsigned shift, std::uint64_t hash, const Key& key,
+           Value&& value);
+
+  void Erase(NodePtr& node, unsigned shift, std::uint64_t hash,
+             const Key& key);
+
+  Hash hash_;
+  Equal equal_;
+  NodePtr root_;
+  std::size_t size_{0};
+};
+
+/// Forward iterator over the items in an unspecified order
+template <typename Key, typename Value, typename Hash, typename Equal>
+class PersistentMap<Key, Value, Hash, Equal>::const_iterator final {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = PersistentMap::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const value_type*;
+  using reference = const value_type&;
+
+  const_iterator() = default;
+
+  reference operator*() const { return *current_; }
+  pointer operator->() const { return current_; }
+
+  const_iterator& operator++() {
+    Next();
+    return *this;
+  }
+
+  const_iterator operator++(int) {
+    auto copy = *this;
+    Next();
+    return copy;
+  }
+
+  bool operator==(const const_iterator& other) const {
+    return current_ == other.current_;
+  }
+  bool operator!=(const const_iterator& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  friend class PersistentMap;
+
+  struct Frame final {
+    const Node* node{nullptr};
+    std::size_t index{0};
+  };
+
+  explicit const_iterator(const Node* root) {
+    if (!root) return;
+    stack_[depth_++] = Frame{root, 0};
+    Next();
+  }
+
+  void Next() {
+    while (depth_ != 0) {
+      auto& frame = stack_[depth_ - 1];
+      if (frame.index == frame.node->children.size()) {
+        --depth_;
+        continue;
+      }
+
+      const auto& child = frame.node->children[frame.index++];
+      if (const auto* leaf = std::get_if<LeafPtr>(&child)) {
+        current_ = &(*leaf)->value;
+        return;
+      }
+      stack_[depth_++] = Frame{std::get<NodePtr>(child).get(), 0};
+    }
+    current_ = nullptr;
+  }
+
+  std::array<Frame, kMaxDepth> stack_{};
+  std::size_t depth_{0};
+  const value_type* current_{nullptr};
+};
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+PersistentMap<Key, Value, Hash, Equal>::PersistentMap(const Hash& hash,
+                                                      const Equal& equal)
+    : hash_(hash), equal_(equal) {}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+bool PersistentMap<Key, Value, Hash, Equal>::Put(const Key& key, Value value) {
+  if (!root_) root_ = std::make_shared<Node>();
+  const bool inserted = Put(root_, 0, GetHash(key), key, std::move(value));
+  if (inserted) ++size_;
+  return inserted;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+bool PersistentMap<Key, Value, Hash, Equal>::Erase(const Key& key) {
+  // Do not copy the path to a missing key
+  if (!Contains(key)) return false;
+
+  if (--size_ == 0) {
+    root_.reset();
+  } else {
+    Erase(root_, 0, GetHash(key), key);
+  }
+  return true;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+const Value* PersistentMap<Key, Value, Hash, Equal>::Get(
+    const Key& key) const {
+  if (!root_) return nullptr;
+
+  const auto hash = GetHash(key);
+  const Node* node = root_.get();
+  for (unsigned shift = 0; shift < kHashBits; shift += kBitsPerLevel) {
+    const auto bit = GetBit(hash, shift);
+    if ((node->bitmap & bit) == 0) return nullptr;
+
+    const auto& child = node->children[GetPosition(node->bitmap, bit)];
+    if (const auto* leaf = std::get_if<LeafPtr>(&child)) {
+      const auto& [leaf_key, leaf_value] = (*leaf)->value;
+      if ((*leaf)->hash != hash || !equal_(leaf_key, key)) return nullptr;
+      return &leaf_value;
+    }
+    node = std::get<NodePtr>(child).get();
+  }
+
+  for (const auto& child : node->children) {
+    const auto& [leaf_key, leaf_value] = std::get<LeafPtr>(child)->value;
+    if (equal_(leaf_key, key)) return &leaf_value;
+  }
+  return nullptr;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void PersistentMap<Key, Value, Hash, Equal>::Clear() noexcept {
+  root_.reset();
+  size_ = 0;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::uint64_t PersistentMap<Key, Value, Hash, Equal>::GetHash(
+    const Key& key) const {
+  // The user hash may be an identity, spread it over all the bits
+  auto hash = static_cast<std::uint64_t>(hash_(key));
+  hash *= 0x9E3779B97F4A7C15ULL;
+  return hash ^ (hash >> 29);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::uint64_t PersistentMap<Key, Value, Hash, Equal>::GetBit(
+    std::uint64_t hash, unsigned shift) noexcept {
+  return std::uint64_t{1} << ((hash >> shift) & kLevelMask);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::size_t PersistentMap<Key, Value, Hash, Equal>::GetPosition(
+    std::uint64_t bitmap, std::uint64_t bit) noexcept {
+  return __builtin_popcountll(bitmap & (bit - 1));
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+template <typename T>
+void PersistentMap<Key, Value, Hash, Equal>::MakeUnique(
+    std::shared_ptr<T>& ptr) {
+  if (ptr.use_count() == 1) {
+    // Synchronizes with the release of the other owners that are gone,
+    // their reads happen before our writes
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return;
+  }
+  ptr = std::make_shared<T>(*ptr);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void PersistentMap<Key, Value, Hash, Equal>::AddLeaf(Node& node,
+                                                     unsigned shift,
+                                                     LeafPtr leaf) {
+  if (shift >= kHashBits) {
+    node.children.push_back(std::move(leaf));
+    return;
+  }
+
+  const auto bit = GetBit(leaf->hash, shift);
+  const auto position = GetPosition(node.bitmap, bit);
+  node.bitmap |= bit;
+  node.children.insert(node.children.begin() + position, std::move(leaf));
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+bool PersistentMap<Key, Value, Hash, Equal>::Put(NodePtr& node, unsigned shift,
+                                                 std::uint64_t hash,
+                                                 const Key& key,
+                                                 Value&& value) {
+  MakeUnique(node);
+
+  if (shift >= kHashBits) {
+    for (auto& child : node->children) {
+      auto& leaf = std::get<LeafPtr>(child);
+      if (!equal_(leaf->value.first, key)) continue;
+
+      MakeUnique(leaf);
+      leaf->value.second = std::move(value);
+      return false;
+    }
+    AddLeaf(*node, shift, std::make_shared<Leaf>(hash, key, std::move(value)));
+    return true;
+  }
+
+  const auto bit = GetBit(hash, shift);
+  if ((node->bitmap & bit) == 0) {
+    AddLeaf(*node, shift, std::make_shared<Leaf>(hash, key, std::move(value)));
+    return true;
+  }
+
+  auto& child = node->children[GetPosition(node->bitmap, bit)];
+  if (auto* subnode = std::get_if<NodePtr>(&child)) {
+    return Put(*subnode, shift + kBitsPerLevel, hash, key, std::move(value));
+  }
+
+  auto& leaf = std::get<LeafPtr>(child);
+  if (leaf->hash == hash && equal_(leaf->value.first, key)) {
+    MakeUnique(leaf);
+    leaf->value.second = std::move(value);
+    return false;
+  }
+
+  // Push the leaf one level down and put the new one next to it
+  auto subnode = std::make_shared<Node>();
+  AddLeaf(*subnode, shift + kBitsPerLevel, std::move(leaf));
+  child = std::move(subnode);
+  return Put(std::get<NodePtr>(child), shift + kBitsPerLevel, hash, key,
+             std::move(value));
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void PersistentMap<Key, Value, Hash, Equal>::Erase(NodePtr& node,
+                                                   unsigned shift,
+                                                   std::uint64_t hash,
+                                                   const Key& key) {
+  MakeUnique(node);
+
+  if (shift >= kHashBits) {
+    auto& children = node->children;
+    for (auto it = children.begin(); it != children.end(); ++it) {
+      if (equal_(std::get<LeafPtr>(*it)->value.first, key)) {
+        children.erase(it);
+        return;
+      }
+    }
+    return;
+  }
+
+  const auto bit = GetBit(hash, shift);
+  const auto position = GetPosition(node->bitmap, bit);
+  auto& child = node->children[position];
+
+  if (auto* subnode = std::get_if<NodePtr>(&child)) {
+    Erase(*subnode, shift + kBitsPerLevel, hash, key);
+
+    // Pull a lone leaf up, so that the trie stays as shallow as possible
+    auto& grandchildren = (*subnode)->children;
+    if (grandchildren.size() == 1 &&
+        std::holds_alternative<LeafPtr>(grandchildren.front())) {
+      child = LeafPtr{std::get<LeafPtr>(grandchildren.front())};
+    }
+    return;
+  }
+
+  node->bitmap &= ~bit;
+  node->children.erase(node->children.begin() + position);
+}
+
+/// @brief cache::PersistentMap serialization support
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::enable_if_t<dump::kIsWritable<Key> && dump::kIsWritable<Value>> Write(
+    dump::Writer& writer, const PersistentMap<Key, Value, Hash, Equal>& map) {
+  writer.Write(map.size());
+  for (const auto& [key, value] : map) {
+    writer.Write(key);
+    writer.Write(value);
+  }
+}
+
+/// @brief cache::PersistentMap deserialization support
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::enable_if_t<dump::kIsReadable<Key> && dump::kIsReadable<Value>,
+                 PersistentMap<Key, Value, Hash, Equal>>
+Read(dump::Reader& reader, dump::To<PersistentMap<Key, Value, Hash, Equal>>) {
+  PersistentMap<Key, Value, Hash, Equal> map;
+  const auto size = reader.Read<std::size_t>();
+  for (std::size_t i = 0; i < size; ++i) {
+    auto key = reader.Read<Key>();
+    map.Put(key, reader.Read<Value>());
+  }
+  return map;
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,101 @@
+#pragma once
+
+/// @file userver/clients/balancing/endpoint_balancer.hpp
+/// @brief @copybrief clients::balancing::EndpointBalancer
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::balancing {
+
+/// Settings of clients::balancing::EndpointBalancer
+struct EndpointBalancerSettings final {
+  /// Weight of the latest reply time in the moving average of an endpoint
+  double ewma_weight{0.2};
+
+  /// Number of consecutive failures that ejects an endpoint
+  std::uint32_t ejection_failures{5};
+
+  /// How long an ejected endpoint is not picked
+  std::chrono::milliseconds ejection_time{10000};
+};
+
+/// @brief Picks one of the endpoints (e.g. resolved IP addresses) of
+/// a destination by power of two choices.
+///
+/// Two random endpoints are compared by their in-flight requests count
+/// multiplied by the exponentially weighted moving average of their reply
+/// time, the least loaded one wins. Endpoints that were not picked before are
+/// preferred, so new endpoints get their share of load quickly.
+///
+/// An endpoint that fails `ejection_failures` times in a row is ejected and
+/// is not picked for `ejection_time`, unless all the endpoints are ejected.
+///
+/// The state of the endpoints is shared by all the destinations and is kept
+/// while the EndpointBalancer is alive. All the methods are thread-safe.
+///
+/// ## Example usage:
+/// @snippet clients/balancing/endpoint_balancer_test.cpp  Sample EndpointBalancer
+class EndpointBalancer final {
+ public:
+  class Lease;
+
+  explicit EndpointBalancer(EndpointBalancerSettings settings = {});
+
+  EndpointBalancer(EndpointBalancer&&) = delete;
+  EndpointBalancer& operator=(EndpointBalancer&&) = delete;
+  ~EndpointBalancer();
+
+  /// @brief Picks one of `endpoints` and accounts a request to it.
+  /// @pre `endpoints` is not empty
+  Lease Pick(utils::span<const std::string> endpoints);
+
+ private:
+  struct EndpointState;
+
+  const EndpointBalancerSettings settings_;
+  rcu::RcuMap<std::string, EndpointState> endpoints_;
+};
+
+/// @brief A request to the picked endpoint.
+///
+/// Call Finish when the request is complete. A Lease that is destroyed
+/// without Finish only stops counting the request as in-flight.
+class EndpointBalancer::Lease final {
+ public:
+  Lease() noexcept;
+  Lease(Lease&&) noexcept;
+  Lease& operator=(Lease&&) noexcept;
+  ~Lease();
+
+  /// Returns the index of the picked endpoint in the `endpoints` passed to
+  /// EndpointBalancer::Pick
+  std::size_t GetIndex() const noexcept { return index_; }
+
+  /// Accounts the outcome and the reply time of the request.
+  void Finish(bool success) noexcept;
+
+ private:
+  friend class EndpointBalancer;
+
+  Lease(const EndpointBalancerSettings& settings,
+        std::shared_ptr<EndpointState> state, std::size_t index) noexcept;
+
+  void Release() noexcept;
+
+  const EndpointBalancerSettings* settings_{nullptr};
+  std::shared_ptr<EndpointState> state_;
+  std::size_t index_{0};
+  std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace clients::balancing
+
+USERVER_NAMESPACE_END
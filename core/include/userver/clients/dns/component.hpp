@@ -33,6 +33,8 @@ namespace clients::dns {
 /// cache-size-per-way | size of each way of network cache | 256
 /// cache-max-reply-ttl | TTL limit for network replies caching | 5m
 /// cache-failure-ttl | TTL for network failures caching | 5s
+/// cache-max-stale-time | how long expired network replies may be served while being updated | 1h
+/// cache-prefetch-interval | interval of frequently requested names update before expiration, 0 to disable | 1s
 ///
 /// ## Static configuration example:
 ///
@@ -39,6 +39,14 @@ struct ResolverConfig {
 
   /// Network cache failure TTL
   std::chrono::milliseconds cache_failure_ttl{std::chrono::seconds{5}};
+
+  /// How long an expired network reply may be served while it is being
+  /// updated or when name servers fail
+  std::chrono::milliseconds cache_max_stale_time{std::chrono::hours{1}};
+
+  /// Interval of the background update of the frequently requested names
+  /// before they expire (disabled if zero)
+  std::chrono::milliseconds cache_prefetch_interval{std::chrono::seconds{1}};
 };
 
 }  // namespace clients::dns
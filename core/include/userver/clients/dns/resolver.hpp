@@ -47,6 +47,10 @@ class Resolver {
   ///  - Cached network resolution results
   ///  - Network name servers
   ///
+  /// Cached network results that are about to expire or have expired are
+  /// returned right away and are updated in the background. Names that are
+  /// requested repeatedly are updated in the background before they expire.
+  ///
   /// @throws clients::dns::NotResolvedException if none of the sources provide
   /// a result within the specified deadline.
   AddrVector Resolve(const std::string& name, engine::Deadline deadline);
@@ -65,7 +69,7 @@ class Resolver {
 
  private:
   class Impl;
-  constexpr static size_t kSize = 1728;
+  constexpr static size_t kSize = 1920;
   constexpr static size_t kAlignment = 16;
   utils::FastPimpl<Impl, kSize, kAlignment> impl_;
 };
@@ -36,6 +36,7 @@ class HeadersPropagator;
 namespace curl {
 class easy;
 class multi;
+class share;
 class ConnectRateLimiter;
 }  // namespace curl
 
@@ -43,6 +44,10 @@ namespace engine::ev {
 class ThreadPool;
 }  // namespace engine::ev
 
+namespace clients::balancing {
+class EndpointBalancer;
+}  // namespace clients::balancing
+
 namespace clients::http {
 namespace impl {
 class EasyWrapper;
@@ -89,6 +94,12 @@ class Client final {
   // For internal use only.
   void SetMaxHostConnections(size_t max_host_connections);
 
+  // For internal use only.
+  void SetDestinationAffinityEnabled(bool enabled);
+
+  // For internal use only.
+  void SetEndpointBalancingEnabled(bool enabled);
+
   // For internal use only.
   PoolStatistics GetPoolStatistics() const;
 
@@ -99,6 +110,14 @@ class Client final {
   // For internal use only.
   const http::DestinationStatistics& GetDestinationStatistics() const;
 
+  // Accounts a request that was served by another in-flight or batch request.
+  // For internal use only.
+  void AccountCoalescedRequest(const std::string& destination);
+
+  // Accounts an extra request sent by hedging.
+  // For internal use only.
+  void AccountHedgedRequest(const std::string& destination);
+
   // For internal use only.
   void SetTestsuiteConfig(const TestsuiteConfig& config);
 
@@ -142,6 +161,10 @@ class Client final {
   void IncPending() noexcept { ++pending_tasks_; }
   void DecPending() noexcept { --pending_tasks_; }
   void PushIdleEasy(std::shared_ptr<curl::easy>&& easy) noexcept;
+  void BindToDestination(curl::easy& easy,
+                         std::size_t destination_hash) noexcept;
+
+  clients::balancing::EndpointBalancer* GetEndpointBalancer() noexcept;
 
   std::shared_ptr<curl::easy> TryDequeueIdle() noexcept;
 
@@ -149,11 +172,16 @@ class Client final {
 
   const DeadlinePropagationConfig deadline_propagation_config_;
   CancellationPolicy cancellation_policy_;
+  std::atomic<bool> destination_affinity_;
+  std::atomic<bool> endpoint_balancing_;
+  std::unique_ptr<clients::balancing::EndpointBalancer> endpoint_balancer_;
 
   std::shared_ptr<DestinationStatistics> destination_statistics_;
   std::unique_ptr<engine::ev::ThreadPool> thread_pool_;
   std::vector<Statistics> statistics_;
   std::vector<std::unique_ptr<curl::multi>> multis_;
+  // TLS sessions, DNS and maybe connections shared by the multis
+  std::shared_ptr<curl::share> share_;
 
   static constexpr size_t kIdleQueueSize = 616;
   static constexpr size_t kIdleQueueAlignment = 8;
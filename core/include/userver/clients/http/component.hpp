@@ -37,8 +37,12 @@ namespace components {
 /// pool-statistics-disable | set to true to disable statistics for connection pool | false
 /// thread-name-prefix | set OS thread name to this value | ''
 /// threads | number of threads to process low level HTTP related IO system calls | 8
+/// destination-affinity | send all the requests to a host through the same IO thread, so that they share the connections and HTTP/2 streams instead of opening connections in each thread | false
+/// endpoint-balancing | if the host resolves to several addresses, pick one by power of two choices on in-flight requests and reply times, keeping separate connections to each address and ejecting the failing ones; requires dns_resolver 'async' | false
+/// shared-caches | share the TLS sessions and the DNS cache between the IO threads, so that a TLS session to a host established in one thread is resumed in the others instead of a full handshake | false
+/// shared-connections | share the connection cache between the IO threads too, a connection to a host is reused by the requests of any thread | false
 /// fs-task-processor | task processor to run blocking HTTP related calls, like DNS resolving or hosts reading | -
-/// destination-metrics-auto-max-size | set max number of automatically created destination metrics | 100
+/// destination-metrics-auto-max-size | set max number of automatically created destination metrics, the less used destinations are accounted as "other" | 100
 /// user-agent | User-Agent HTTP header to show on all requests, result of utils::GetUserverIdentifier() if empty | empty
 /// bootstrap-http-proxy | HTTP proxy to use at service start. Will be overridden by @ref USERVER_HTTP_PROXY at runtime config update | ''
 /// testsuite-enabled | enable testsuite testing support | false
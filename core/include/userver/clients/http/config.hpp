@@ -40,6 +40,12 @@ struct ClientSettings final {
   const clients::http::plugins::headers_propagator::HeadersPropagator*
       headers_propagator{nullptr};
   CancellationPolicy cancellation_policy{CancellationPolicy::kCancel};
+  bool destination_affinity{false};
+  bool endpoint_balancing{false};
+  // Share the TLS sessions and the DNS cache between the IO threads
+  bool shared_caches{false};
+  // Also share the connections between the IO threads
+  bool shared_connections{false};
 };
 
 ClientSettings Parse(const yaml_config::YamlConfig& value,
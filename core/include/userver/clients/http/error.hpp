@@ -57,6 +57,13 @@ class CancelException : public BaseException {
   ~CancelException() override = default;
 };
 
+/// Request was rejected by a plugin before it was sent
+class RejectedByPluginException : public BaseException {
+ public:
+  RejectedByPluginException(std::string_view message, const LocalStats& stats);
+  ~RejectedByPluginException() override = default;
+};
+
 class SSLException : public BaseCodeException {
  public:
   using BaseCodeException::BaseCodeException;
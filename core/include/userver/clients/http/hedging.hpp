@@ -0,0 +1,100 @@
+#pragma once
+
+/// @file userver/clients/http/hedging.hpp
+/// @brief @copybrief clients::http::AdaptiveHedging
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <userver/clients/http/response.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+class RetryBudget;
+}  // namespace utils
+
+namespace clients::http {
+
+class Client;
+class Request;
+
+/// Settings of clients::http::AdaptiveHedging
+struct AdaptiveHedgingSettings final {
+  /// Maximum number of requests, including the first one
+  std::size_t max_attempts{2};
+
+  /// Percentile of the recent timings of the destination that is used as
+  /// the hedging delay
+  double delay_percentile{95};
+
+  /// Lower bound of the hedging delay
+  std::chrono::milliseconds min_delay{10};
+
+  /// Upper bound of the hedging delay, also used while the destination has
+  /// no timings
+  std::chrono::milliseconds max_delay{1000};
+
+  /// Max time to wait for all the requests
+  std::chrono::milliseconds timeout_all{5000};
+};
+
+/// @brief Performs hedged HTTP requests with a delay that follows the recent
+/// timings of the destination.
+///
+/// If the first request has not replied within the hedging delay, one more
+/// identical request is sent and the first reply wins; the other requests are
+/// cancelled. A request that fails or replies with 5xx is retried right away.
+///
+/// The extra requests are sent only if `budget` allows a retry, so during an
+/// incident hedging does not multiply the load. Share the budget with the
+/// other retries to the destination. The extra requests are reported as
+/// `hedged-requests` in the metrics of the `destination`.
+///
+/// The delay is the `delay_percentile` of the destination timings over the
+/// last minute, clamped to [min_delay, max_delay], and is recalculated at most
+/// once a second.
+///
+/// ## Example usage:
+/// @snippet clients/http/hedging_test.cpp  Sample AdaptiveHedging
+class AdaptiveHedging final {
+ public:
+  /// Sets up a request: the URL, the method, the body, the timeout...
+  using RequestSetup = std::function<void(Request&)>;
+
+  /// @param destination name of the destination metrics, its timings are used
+  /// for the hedging delay
+  /// @param budget must outlive the AdaptiveHedging
+  AdaptiveHedging(Client& client, std::string destination,
+                  AdaptiveHedgingSettings settings, utils::RetryBudget& budget);
+
+  AdaptiveHedging(AdaptiveHedging&&) = delete;
+  AdaptiveHedging& operator=(AdaptiveHedging&&) = delete;
+  ~AdaptiveHedging();
+
+  /// @brief Performs the request set up by `setup`, sending extra copies of it
+  /// as described above.
+  /// @returns the first response that is not a 5xx, or the last 5xx response
+  /// @throws the exception of the last request if no request replied;
+  /// clients::http::TimeoutException if `timeout_all` has expired
+  std::shared_ptr<Response> Perform(const RequestSetup& setup);
+
+  /// Returns the current hedging delay
+  std::chrono::milliseconds GetDelay() const;
+
+ private:
+  Client& client_;
+  const std::string destination_;
+  const AdaptiveHedgingSettings settings_;
+  utils::RetryBudget& budget_;
+
+  mutable std::atomic<std::chrono::milliseconds> delay_;
+  mutable std::atomic<std::chrono::steady_clock::time_point> delay_deadline_{};
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
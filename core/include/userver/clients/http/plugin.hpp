@@ -30,6 +30,14 @@ class PluginRequest final {
 
   void SetTimeout(std::chrono::milliseconds ms);
 
+  /// @brief Returns the destination of the request, the one its metrics are
+  /// accounted for
+  const std::string& GetDestination() const;
+
+  /// @brief Fails the request with clients::http::RejectedByPluginException
+  /// without sending it. Only takes effect in Plugin::HookPerformRequest.
+  void Reject(std::string reason);
+
  private:
   RequestState& state_;
 };
@@ -45,8 +53,10 @@ class Plugin {
   const std::string& GetName() const;
 
   /// @brief The hook is called before actual HTTP request sending and before
-  ///        DNS name resolution. You might want to use the hook for most of the
-  ///        hook job.
+  ///        DNS name resolution, for each attempt. You might want to use the
+  ///        hook for most of the hook job.
+  ///
+  /// @warning The hook is called in libev thread for the retries.
   virtual void HookPerformRequest(PluginRequest& request) = 0;
 
   /// @brief The hook is called just after the "external" Span is created.
@@ -0,0 +1,66 @@
+#pragma once
+
+/// @file userver/clients/http/plugins/adaptive_throttling/component.hpp
+/// @brief @copybrief clients::http::plugins::adaptive_throttling::Component
+
+#include <memory>
+
+#include <userver/clients/http/plugin_component.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// Client-side adaptive throttling plugin
+namespace clients::http::plugins::adaptive_throttling {
+
+class Plugin;
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief HTTP client plugin that rejects the requests locally while their
+/// destination is overloaded, see congestion_control::ClientThrottler.
+///
+/// A request is accepted by the destination unless it failed with a network
+/// error or got 429, 503 or 504 status code. The requests rejected locally
+/// fail with clients::http::RejectedByPluginException and are reported as
+/// `rejected-by-plugins` metric of the destination.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// accepts-multiplier | requests are rejected locally once they exceed the accepted ones that many times | 2.0
+/// window | time the requests and the accepts are counted over | 60s
+
+// clang-format on
+
+class Component final : public plugin::ComponentBase {
+ public:
+  /// @ingroup userver_component_names
+  /// @brief The default name of
+  /// clients::http::plugins::adaptive_throttling::Component component
+  static constexpr std::string_view kName =
+      "http-client-plugin-adaptive-throttling";
+
+  Component(const components::ComponentConfig&,
+            const components::ComponentContext&);
+
+  ~Component() override;
+
+  http::Plugin& GetPlugin() override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  std::unique_ptr<adaptive_throttling::Plugin> plugin_;
+  utils::statistics::Entry statistics_holder_;
+};
+
+}  // namespace clients::http::plugins::adaptive_throttling
+
+template <>
+inline constexpr bool components::kHasValidate<
+    clients::http::plugins::adaptive_throttling::Component> = true;
+
+USERVER_NAMESPACE_END
@@ -36,6 +36,7 @@ class ConnectTo;
 class Form;
 struct DeadlinePropagationConfig;
 class RequestStats;
+class RequestTemplate;
 class DestinationStatistics;
 struct TestsuiteConfig;
 
@@ -99,6 +100,10 @@ class Request final {
                    const tracing::TracingManagerBase& tracing_manager);
   /// @endcond
 
+  /// Applies the prebuilt setup, call before setting the per-request headers
+  Request& ApplyTemplate(const RequestTemplate& request_template) &;
+  Request ApplyTemplate(const RequestTemplate& request_template) &&;
+
   /// Specifies method
   Request& method(HttpMethod method) &;
   Request method(HttpMethod method) &&;
@@ -157,6 +162,11 @@ class Request final {
   /// data for POST request
   Request& data(std::string data) &;
   Request data(std::string data) &&;
+  /// data for POST request, sent without copying. Useful to send the same
+  /// body in many requests, the buffer is held until the request is reused
+  /// or destroyed.
+  Request& data(std::shared_ptr<const std::string> data) &;
+  Request data(std::shared_ptr<const std::string> data) &&;
   /// form for POST request
   Request& form(Form&& form) &;
   Request form(Form&& form) &&;
@@ -0,0 +1,114 @@
+#pragma once
+
+/// @file userver/clients/http/request_coalescer.hpp
+/// @brief @copybrief clients::http::RequestCoalescer
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/clients/http/response.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+class Client;
+class Request;
+
+/// @brief Coalesces identical in-flight GET requests.
+///
+/// A GET request with the same URL and headers as an in-flight one is not
+/// sent, the caller waits for the in-flight request and gets the same
+/// response. The request is sent by a separate task, so it is not cancelled
+/// while anyone is waiting for it.
+///
+/// The number of requests that were not sent is reported as
+/// `coalesced-requests` in the metrics of the `destination`, see
+/// Request::SetDestinationMetricName.
+///
+/// RequestCoalescer must outlive all the Get calls.
+///
+/// ## Example usage:
+/// @snippet clients/http/request_coalescer_test.cpp  Sample RequestCoalescer
+class RequestCoalescer final {
+ public:
+  /// @param destination name of the destination metrics
+  RequestCoalescer(Client& client, std::string destination);
+
+  RequestCoalescer(RequestCoalescer&&) = delete;
+  RequestCoalescer& operator=(RequestCoalescer&&) = delete;
+  ~RequestCoalescer();
+
+  /// @brief Performs a GET request or waits for an identical in-flight one.
+  ///
+  /// The `timeout` and `retries` of the request that is actually sent are
+  /// used for all the callers.
+  ///
+  /// @throws the exceptions of Request::perform
+  std::shared_ptr<const Response> Get(const std::string& url,
+                                      const Headers& headers,
+                                      std::chrono::milliseconds timeout,
+                                      short retries = 1);
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// Settings of clients::http::BatchCoalescer
+struct BatchSettings final {
+  /// How long to wait for more keys before sending a batch
+  std::chrono::milliseconds window{2};
+
+  /// A batch is sent without waiting for the window when it has that many
+  /// keys
+  std::size_t max_batch_size{100};
+};
+
+/// @brief Merges point requests that arrive within a small window into
+/// a single batch request and fans the results out back to the callers.
+///
+/// The batch request is made by the user-provided `BatchFunction`, that
+/// receives a Request with the destination metric name already set,
+/// configures and performs it, and splits the response into the results of
+/// each key. Duplicate keys within a batch are requested once.
+///
+/// The number of point requests that did not result in a separate request
+/// is reported as `coalesced-requests` in the metrics of the `destination`.
+///
+/// BatchCoalescer must outlive all the Get calls.
+///
+/// ## Example usage:
+/// @snippet clients/http/request_coalescer_test.cpp  Sample BatchCoalescer
+class BatchCoalescer final {
+ public:
+  using Keys = std::vector<std::string>;
+  using Results = std::unordered_map<std::string, std::string>;
+  using BatchFunction = std::function<Results(Request& request, const Keys&)>;
+
+  /// @param destination name of the destination metrics
+  BatchCoalescer(Client& client, std::string destination,
+                 BatchSettings settings, BatchFunction batch_function);
+
+  BatchCoalescer(BatchCoalescer&&) = delete;
+  BatchCoalescer& operator=(BatchCoalescer&&) = delete;
+  ~BatchCoalescer();
+
+  /// @brief Adds the key to the current batch and waits for its result.
+  /// @returns std::nullopt if the batch response has no result for the key
+  /// @throws the exceptions of `BatchFunction`
+  std::optional<std::string> Get(std::string key);
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
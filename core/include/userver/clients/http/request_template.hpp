@@ -0,0 +1,97 @@
+#pragma once
+
+/// @file userver/clients/http/request_template.hpp
+/// @brief @copybrief clients::http::RequestTemplate
+
+#include <chrono>
+#include <initializer_list>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <userver/clients/http/request.hpp>
+#include <userver/clients/http/response.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+/// @brief Prebuilt setup of the requests that are sent many times with only
+/// the body and a few headers changing.
+///
+/// The headers are formatted once into the lines that are sent to curl, so
+/// applying the template to a request does no formatting and, for the pooled
+/// connections, no allocations for the headers. Apply it with
+/// Request::ApplyTemplate() before setting the per-request headers.
+///
+/// @code
+/// const auto request_template = clients::http::RequestTemplate{}
+///     .post()
+///     .url("http://example.com/v1/events")
+///     .headers({{"Content-Type", "application/json"}})
+///     .timeout(std::chrono::milliseconds{100})
+///     .retry(2);
+///
+/// auto response = http_client.CreateRequest()
+///     .ApplyTemplate(request_template)
+///     .data(std::move(body))
+///     .perform();
+/// @endcode
+class RequestTemplate final {
+ public:
+  /// Specifies method
+  RequestTemplate& method(HttpMethod method) &;
+  RequestTemplate method(HttpMethod method) &&;
+  /// POST request
+  RequestTemplate& post() &;
+  RequestTemplate post() &&;
+  /// url of the requests
+  RequestTemplate& url(std::string url) &;
+  RequestTemplate url(std::string url) &&;
+  /// Headers for requests as map
+  RequestTemplate& headers(const Headers& headers) &;
+  RequestTemplate headers(const Headers& headers) &&;
+  /// Headers for requests as list
+  RequestTemplate& headers(const std::initializer_list<
+                           std::pair<std::string_view, std::string_view>>&
+                               headers) &;
+  RequestTemplate headers(const std::initializer_list<
+                          std::pair<std::string_view, std::string_view>>&
+                              headers) &&;
+  /// Sets the User-Agent header
+  RequestTemplate& user_agent(std::string value) &;
+  RequestTemplate user_agent(std::string value) &&;
+  /// Set timeout for requests
+  RequestTemplate& timeout(std::chrono::milliseconds timeout) &;
+  RequestTemplate timeout(std::chrono::milliseconds timeout) &&;
+  /// @copydoc Request::retry
+  RequestTemplate& retry(short retries = 3, bool on_fails = true) &;
+  RequestTemplate retry(short retries = 3, bool on_fails = true) &&;
+  /// Set HTTP version
+  RequestTemplate& http_version(HttpVersion version) &;
+  RequestTemplate http_version(HttpVersion version) &&;
+
+ private:
+  friend class Request;
+
+  struct Retry final {
+    short retries;
+    bool on_fails;
+  };
+
+  void AddHeader(std::string_view name, std::string_view value);
+
+  std::optional<HttpMethod> method_;
+  std::optional<std::string> url_;
+  std::vector<std::string> header_lines_;
+  std::optional<std::string> user_agent_;
+  std::optional<std::chrono::milliseconds> timeout_;
+  std::optional<Retry> retry_;
+  std::optional<HttpVersion> http_version_;
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -21,6 +21,10 @@ class RequestState;
 /// Call Request::async_perform_stream_body()
 /// to get one.  You can use it for fast proxying backend response body
 /// to a remote Application.
+///
+/// JSON bodies can be parsed chunk by chunk with formats::json::FromChunks,
+/// without joining them into a single string:
+/// @snippet clients/http/client_test.cpp  HTTP Client - stream JSON
 class StreamedResponse final {
  public:
   StreamedResponse(StreamedResponse&&) = default;
@@ -3,6 +3,7 @@
 /// @file userver/components/component_context.hpp
 /// @brief @copybrief components::ComponentContext
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <stdexcept>
@@ -192,6 +193,10 @@ class ComponentContext final {
 
   RawComponentBase* DoFindComponent(std::string_view name) const;
 
+  void WriteStartupTimeline(
+      const std::string& path,
+      std::chrono::steady_clock::time_point start_time) const;
+
   std::unique_ptr<impl::ComponentContextImpl> impl_;
 };
 
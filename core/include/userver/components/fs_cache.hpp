@@ -24,6 +24,7 @@ namespace components {
 /// dir               | directory to cache files from                        | /var/www
 /// update-period     | Update period (0 - fill the cache only at startup)   | 0
 /// fs-task-processor | task processor to do filesystem operations           | fs-task-processor
+/// use-mmap          | map the files into memory instead of reading them, see fs::SettingsReadFile::kMmap | false
 
 // clang-format on
 
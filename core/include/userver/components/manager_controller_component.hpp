@@ -34,6 +34,9 @@ class Manager;
 /// coro_pool.max_size | max amount of coroutines to keep preallocated | 4000
 /// coro_pool.stack_size | size of a single coroutine | 256 * 1024
 /// coro_pool.local_cache_size | local coroutine cache size per thread | 32
+/// coro_pool.stack_mode | 'fixed' or 'growable'; 'growable' reserves stack_size, but commits the stack pages on demand | fixed
+/// coro_pool.initial_stack_size | committed size of a new coroutine stack, only for stack_mode=growable | 32 * 1024
+/// coro_pool.stack_trim_threshold | stacks grown past this size are trimmed back to initial_stack_size on return to the pool, 0 disables trimming; only for stack_mode=growable | 128 * 1024
 /// event_thread_pool.threads | number of threads to process low level IO system calls (number of ev loops to start in libev) | 2
 /// event_thread_pool.thread_name | set OS thread name to this value | 'event-worker'
 /// components | dictionary of "component name": "options" | -
@@ -51,6 +54,15 @@ class Manager;
 /// worker_threads | threads count for the task processor | -
 /// os-scheduling | OS scheduling mode for the task processor threads. 'idle' sets the lowest priority. 'low-priority' sets the priority below 'normal' but higher than 'idle'. | normal
 /// spinning-iterations | tunes the number of spin-wait iterations in case of an empty task queue before threads go to sleep | 1000
+/// spinning-policy | 'fixed' always spins for 'spinning-iterations'. 'adaptive' uses 'spinning-iterations' as an upper bound, spins longer while the tasks keep arriving and parks sooner when the task processor is idle; see 'worker-idle' in the task processor statistics | fixed
+/// task-queue | task queue implementation. 'global' is a single queue shared by all the workers. 'work-stealing' gives each worker its own run queue, other workers steal from it when idle. Tasks scheduled from outside of the task processor go to the shared queue. 'priority' runs tasks in the order of their engine::TaskBase::Priority class, background tasks are cancelled first on overload. | global
+/// numa-aware | split the workers between NUMA nodes and pin them to the CPUs of their node; workers steal tasks from the workers of their own node first. Requires 'task-queue: work-stealing' | false
+/// earliest-deadline-first | order the tasks of a priority class by the propagated deadline of the request they work for (see server::request::TaskInheritedData), tasks without one go after them. Tasks whose request deadline has expired in the queue are cancelled. Requires 'task-queue: priority' | false
+/// jemalloc-arena | optional dictionary of options of a dedicated jemalloc arena for the worker threads, its memory is reported in the 'jemalloc-arena' task processor statistics. Does nothing without jemalloc | empty (disabled)
+/// jemalloc-arena.enabled | whether the workers allocate from the dedicated arena | true
+/// jemalloc-arena.dirty-decay | time for the unused dirty pages of the arena to be purged, see 'dirty_decay_ms' of jemalloc | jemalloc default
+/// jemalloc-arena.muzzy-decay | time for the unused muzzy pages of the arena to be purged, see 'muzzy_decay_ms' of jemalloc | jemalloc default
+/// jemalloc-arena.tcache | whether the workers use jemalloc thread caches | true
 /// task-trace | optional dictionary of tracing options | empty (disabled)
 /// task-trace.every | set N to trace each Nth task | 1000
 /// task-trace.max-context-switch-count | set upper limit of context switches to trace for a single task | 1000
@@ -23,6 +23,10 @@ struct InMemoryConfig : utils::StrongTypedef<InMemoryConfig, std::string> {
 /// Starts a server with the provided component list and config loaded from
 /// file. Reopens the logging files on SIGUSR1.
 ///
+/// If the `USERVER_STATIC_CONFIG_SNAPSHOT_DIR` environment variable is set,
+/// the parsed config and config_vars files are stored in that directory in a
+/// binary form and following starts with the same files skip the YAML parsing.
+///
 /// @see utils::DaemonMain
 void Run(const std::string& config_path,
          const std::optional<std::string>& config_vars_path,
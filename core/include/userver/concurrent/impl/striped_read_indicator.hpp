@@ -8,6 +8,10 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace engine {
+class StripedSharedMutex;
+}  // namespace engine
+
 namespace concurrent::impl {
 
 class StripedReadIndicatorLock;
@@ -92,6 +96,8 @@ class StripedReadIndicator final {
 
  private:
   friend class StripedReadIndicatorLock;
+  // Keeps the reader marks across lock_shared() and unlock_shared() calls
+  friend class engine::StripedSharedMutex;
 
   void DoLock() noexcept;
   void DoUnlock() noexcept;
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <iterator>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include <moodycamel/concurrentqueue.h>
 
@@ -240,6 +243,21 @@ class GenericQueue final
     return producer_side_.PushNoblock(token, std::move(value), value_size);
   }
 
+  template <typename Token>
+  [[nodiscard]] bool PushBatch(Token& token, std::vector<T>& values,
+                               engine::Deadline deadline) {
+    if (values.empty()) return !NoMoreConsumers();
+    const std::size_t batch_size = GetBatchSize(values);
+    return producer_side_.PushBatch(token, values, deadline, batch_size);
+  }
+
+  template <typename Token>
+  [[nodiscard]] bool PushBatchNoblock(Token& token, std::vector<T>& values) {
+    if (values.empty()) return !NoMoreConsumers();
+    const std::size_t batch_size = GetBatchSize(values);
+    return producer_side_.PushBatchNoblock(token, values, batch_size);
+  }
+
   template <typename Token>
   [[nodiscard]] bool Pop(Token& token, T& value, engine::Deadline deadline) {
     return consumer_side_.Pop(token, value, deadline);
@@ -250,6 +268,32 @@ class GenericQueue final
     return consumer_side_.PopNoblock(token, value);
   }
 
+  template <typename Token>
+  [[nodiscard]] std::size_t PopBatch(Token& token, std::vector<T>& values,
+                                     std::size_t max_count,
+                                     engine::Deadline deadline) {
+    UASSERT(max_count > 0);
+    return consumer_side_.PopBatch(token, values, max_count, deadline);
+  }
+
+  template <typename Token>
+  [[nodiscard]] std::size_t PopBatchNoblock(Token& token,
+                                            std::vector<T>& values,
+                                            std::size_t max_count) {
+    UASSERT(max_count > 0);
+    return consumer_side_.PopBatchNoblock(token, values, max_count);
+  }
+
+  static std::size_t GetBatchSize(const std::vector<T>& values) {
+    std::size_t batch_size = 0;
+    for (const auto& value : values) {
+      const std::size_t value_size = QueuePolicy::GetElementSize(value);
+      UASSERT(value_size > 0);
+      batch_size += value_size;
+    }
+    return batch_size;
+  }
+
   void PrepareProducer() {
     std::size_t old_producers_count{};
     utils::AtomicUpdate(producers_count_, [&](auto old_value) {
@@ -323,6 +367,25 @@ class GenericQueue final
     consumer_side_.OnElementPushed();
   }
 
+  template <typename Token>
+  void DoPushBatch(Token& token, std::vector<T>& values) {
+    const auto first = std::make_move_iterator(values.begin());
+    if constexpr (std::is_same_v<Token, moodycamel::ProducerToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      queue_.enqueue_bulk(token, first, values.size());
+    } else if constexpr (std::is_same_v<Token, MultiProducerToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      queue_.enqueue_bulk(first, values.size());
+    } else {
+      static_assert(std::is_same_v<Token, impl::NoToken>);
+      static_assert(!QueuePolicy::kIsMultipleProducer);
+      queue_.enqueue_bulk(single_producer_token_, first, values.size());
+    }
+
+    consumer_side_.OnElementsPushed(values.size());
+    values.clear();
+  }
+
   template <typename Token>
   [[nodiscard]] bool DoPop(Token& token, T& value) {
     bool success{};
@@ -347,6 +410,38 @@ class GenericQueue final
     return false;
   }
 
+  // Appends up to `max_count` elements to `values`
+  template <typename Token>
+  [[nodiscard]] std::size_t DoPopBatch(Token& token, std::vector<T>& values,
+                                       std::size_t max_count) {
+    const std::size_t old_size = values.size();
+    values.resize(old_size + max_count);
+    const auto first = values.begin() + old_size;
+    std::size_t popped{};
+
+    if constexpr (std::is_same_v<Token, moodycamel::ConsumerToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      popped = queue_.try_dequeue_bulk(token, first, max_count);
+    } else if constexpr (std::is_same_v<Token, impl::MultiToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      popped = queue_.try_dequeue_bulk(first, max_count);
+    } else {
+      static_assert(std::is_same_v<Token, impl::NoToken>);
+      static_assert(!QueuePolicy::kIsMultipleProducer);
+      popped = queue_.try_dequeue_bulk_from_producer(single_producer_token_,
+                                                     first, max_count);
+    }
+
+    std::size_t released_capacity = 0;
+    for (auto it = first; it != first + popped; ++it) {
+      released_capacity += QueuePolicy::GetElementSize(*it);
+    }
+    values.resize(old_size + popped);
+
+    if (popped) producer_side_.OnElementPopped(released_capacity);
+    return popped;
+  }
+
   moodycamel::ConcurrentQueue<T> queue_{1};
   std::atomic<std::size_t> consumers_count_{0};
   std::atomic<std::size_t> producers_count_{0};
@@ -395,6 +490,28 @@ class GenericQueue<T, QueuePolicy>::SingleProducerSide final {
            DoPush(token, std::move(value), value_size);
   }
 
+  template <typename Token>
+  [[nodiscard]] bool PushBatch(Token& token, std::vector<T>& values,
+                               engine::Deadline deadline,
+                               std::size_t batch_size) {
+    bool no_more_consumers = false;
+    const bool success = non_full_event_.WaitUntil(deadline, [&] {
+      if (queue_.NoMoreConsumers()) {
+        no_more_consumers = true;
+        return true;
+      }
+      return DoPushBatch(token, values, batch_size);
+    });
+    return success && !no_more_consumers;
+  }
+
+  template <typename Token>
+  [[nodiscard]] bool PushBatchNoblock(Token& token, std::vector<T>& values,
+                                      std::size_t batch_size) {
+    return !queue_.NoMoreConsumers() &&
+           DoPushBatch(token, values, batch_size);
+  }
+
   void OnElementPopped(std::size_t released_capacity) {
     used_capacity_.fetch_sub(released_capacity);
     non_full_event_.Send();
@@ -427,6 +544,18 @@ class GenericQueue<T, QueuePolicy>::SingleProducerSide final {
     return true;
   }
 
+  template <typename Token>
+  [[nodiscard]] bool DoPushBatch(Token& token, std::vector<T>& values,
+                                 std::size_t batch_size) {
+    if (used_capacity_.load() + batch_size > total_capacity_.load()) {
+      return false;
+    }
+
+    used_capacity_.fetch_add(batch_size);
+    queue_.DoPushBatch(token, values);
+    return true;
+  }
+
   GenericQueue& queue_;
   engine::SingleConsumerEvent non_full_event_;
   std::atomic<std::size_t> used_capacity_;
@@ -459,6 +588,22 @@ class GenericQueue<T, QueuePolicy>::MultiProducerSide final {
            DoPush(token, std::move(value), value_size);
   }
 
+  template <typename Token>
+  [[nodiscard]] bool PushBatch(Token& token, std::vector<T>& values,
+                               engine::Deadline deadline,
+                               std::size_t batch_size) {
+    return remaining_capacity_.try_lock_shared_until_count(deadline,
+                                                           batch_size) &&
+           DoPushBatch(token, values, batch_size);
+  }
+
+  template <typename Token>
+  [[nodiscard]] bool PushBatchNoblock(Token& token, std::vector<T>& values,
+                                      std::size_t batch_size) {
+    return remaining_capacity_.try_lock_shared_count(batch_size) &&
+           DoPushBatch(token, values, batch_size);
+  }
+
   void OnElementPopped(std::size_t value_size) {
     remaining_capacity_.unlock_shared_count(value_size);
   }
@@ -495,6 +640,18 @@ class GenericQueue<T, QueuePolicy>::MultiProducerSide final {
     return true;
   }
 
+  template <typename Token>
+  [[nodiscard]] bool DoPushBatch(Token& token, std::vector<T>& values,
+                                 std::size_t batch_size) {
+    if (queue_.NoMoreConsumers()) {
+      remaining_capacity_.unlock_shared_count(batch_size);
+      return false;
+    }
+
+    queue_.DoPushBatch(token, values);
+    return true;
+  }
+
   GenericQueue& queue_;
   engine::CancellableSemaphore remaining_capacity_;
   concurrent::impl::SemaphoreCapacityControl remaining_capacity_control_;
@@ -534,11 +691,43 @@ class GenericQueue<T, QueuePolicy>::SingleConsumerSide final {
     return DoPop(token, value);
   }
 
+  // Blocks only if queue is empty
+  template <typename Token>
+  [[nodiscard]] std::size_t PopBatch(Token& token, std::vector<T>& values,
+                                     std::size_t max_count,
+                                     engine::Deadline deadline) {
+    std::size_t popped = 0;
+    [[maybe_unused]] const bool success =
+        nonempty_event_.WaitUntil(deadline, [&] {
+          popped = DoPopBatch(token, values, max_count);
+          if (popped) return true;
+          if (queue_.NoMoreProducers()) {
+            // Check twice to avoid TOCTOU, see Pop
+            popped = DoPopBatch(token, values, max_count);
+            return true;
+          }
+          return false;
+        });
+    return popped;
+  }
+
+  template <typename Token>
+  [[nodiscard]] std::size_t PopBatchNoblock(Token& token,
+                                            std::vector<T>& values,
+                                            std::size_t max_count) {
+    return DoPopBatch(token, values, max_count);
+  }
+
   void OnElementPushed() {
     ++element_count_;
     nonempty_event_.Send();
   }
 
+  void OnElementsPushed(std::size_t count) {
+    element_count_ += count;
+    nonempty_event_.Send();
+  }
+
   void StopBlockingOnPop() { nonempty_event_.Send(); }
 
   void ResumeBlockingOnPop() {}
@@ -556,6 +745,17 @@ class GenericQueue<T, QueuePolicy>::SingleConsumerSide final {
     return false;
   }
 
+  template <typename Token>
+  [[nodiscard]] std::size_t DoPopBatch(Token& token, std::vector<T>& values,
+                                       std::size_t max_count) {
+    const std::size_t popped = queue_.DoPopBatch(token, values, max_count);
+    if (popped) {
+      element_count_ -= popped;
+      nonempty_event_.Reset();
+    }
+    return popped;
+  }
+
   GenericQueue& queue_;
   engine::SingleConsumerEvent nonempty_event_;
   std::atomic<std::size_t> element_count_;
@@ -587,8 +787,29 @@ class GenericQueue<T, QueuePolicy>::MultiConsumerSide final {
     return element_count_.try_lock_shared() && DoPop(token, value);
   }
 
+  // Blocks only if queue is empty
+  template <typename Token>
+  [[nodiscard]] std::size_t PopBatch(Token& token, std::vector<T>& values,
+                                     std::size_t max_count,
+                                     engine::Deadline deadline) {
+    if (!element_count_.try_lock_shared_until(deadline)) return 0;
+    return DoPopBatch(token, values, 1 + TryLockSharedUpTo(max_count - 1));
+  }
+
+  template <typename Token>
+  [[nodiscard]] std::size_t PopBatchNoblock(Token& token,
+                                            std::vector<T>& values,
+                                            std::size_t max_count) {
+    if (!element_count_.try_lock_shared()) return 0;
+    return DoPopBatch(token, values, 1 + TryLockSharedUpTo(max_count - 1));
+  }
+
   void OnElementPushed() { element_count_.unlock_shared(); }
 
+  void OnElementsPushed(std::size_t count) {
+    element_count_.unlock_shared_count(count);
+  }
+
   void StopBlockingOnPop() {
     element_count_control_.SetCapacityOverride(kUnbounded +
                                                kSemaphoreUnlockValue);
@@ -624,6 +845,32 @@ class GenericQueue<T, QueuePolicy>::MultiConsumerSide final {
     }
   }
 
+  // Takes up to `max_count` elements without blocking, returns the number of
+  // the taken elements
+  std::size_t TryLockSharedUpTo(std::size_t max_count) {
+    std::size_t count = std::min(max_count, GetElementCount());
+    // Other consumers may take the elements concurrently
+    while (count > 0 && !element_count_.try_lock_shared_count(count)) {
+      count /= 2;
+    }
+    return count;
+  }
+
+  template <typename Token>
+  [[nodiscard]] std::size_t DoPopBatch(Token& token, std::vector<T>& values,
+                                       std::size_t count) {
+    std::size_t popped = 0;
+    while (popped < count) {
+      popped += queue_.DoPopBatch(token, values, count - popped);
+      if (popped < count && queue_.NoMoreProducers()) {
+        element_count_.unlock_shared_count(count - popped);
+        break;
+      }
+      // See DoPop
+    }
+    return popped;
+  }
+
   GenericQueue& queue_;
   engine::CancellableSemaphore element_count_;
   concurrent::impl::SemaphoreCapacityControl element_count_control_;
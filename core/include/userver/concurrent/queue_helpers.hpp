@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <vector>
 
 #include <userver/engine/deadline.hpp>
 
@@ -67,6 +69,30 @@ class Producer final {
     return queue_->PushNoblock(token_, std::move(value));
   }
 
+  /// Push all the `values` into queue at once. May wait asynchronously until
+  /// the queue has enough space for the whole batch. The space is reserved
+  /// once for the whole batch, and the elements are pushed with a single bulk
+  /// operation. Leaves the `values` unmodified if the operation does not
+  /// succeed, otherwise leaves `values` empty, so that the vector may be
+  /// reused for the next batch.
+  /// @returns whether push succeeded before the deadline and before the task
+  /// was canceled.
+  /// @note A batch that is bigger than the max size of the queue never fits.
+  [[nodiscard]] bool PushBatch(std::vector<ValueType>&& values,
+                               engine::Deadline deadline = {}) const {
+    UASSERT(queue_);
+    return queue_->PushBatch(token_, values, deadline);
+  }
+
+  /// Try to push all the `values` into queue at once without blocking. May be
+  /// used in non-coroutine environment. Leaves the `values` unmodified if the
+  /// operation does not succeed, otherwise leaves `values` empty.
+  /// @returns whether push succeeded.
+  [[nodiscard]] bool PushBatchNoblock(std::vector<ValueType>&& values) const {
+    UASSERT(queue_);
+    return queue_->PushBatchNoblock(token_, values);
+  }
+
   void Reset() && {
     if (queue_) queue_->MarkProducerIsDead();
     queue_.reset();
@@ -136,6 +162,28 @@ class Consumer final {
     return queue_->PopNoblock(token_, value);
   }
 
+  /// Pop up to `max_count` elements from queue with a single bulk operation
+  /// and append them to `values`. May wait asynchronously if the queue is
+  /// empty, but the producer is alive. Does not wait for more elements once
+  /// some are available.
+  /// @returns the number of popped elements, 0 if nothing was popped before
+  /// the deadline.
+  /// @note 0 can be returned before the deadline when the producer is no
+  /// longer alive.
+  [[nodiscard]] std::size_t PopBatch(std::vector<ValueType>& values,
+                                     std::size_t max_count,
+                                     engine::Deadline deadline = {}) const {
+    return queue_->PopBatch(token_, values, max_count, deadline);
+  }
+
+  /// Try to pop up to `max_count` elements from queue without blocking and
+  /// append them to `values`. May be used in non-coroutine environment
+  /// @return the number of popped elements.
+  [[nodiscard]] std::size_t PopBatchNoblock(std::vector<ValueType>& values,
+                                            std::size_t max_count) const {
+    return queue_->PopBatchNoblock(token_, values, max_count);
+  }
+
   void Reset() && {
     if (queue_) queue_->MarkConsumerIsDead();
     queue_.reset();
@@ -0,0 +1,47 @@
+#pragma once
+
+/// @file userver/congestion_control/adaptive_concurrency_limiter_config.hpp
+/// @brief @copybrief congestion_control::AdaptiveConcurrencyLimiterConfig
+
+#include <chrono>
+#include <cstddef>
+
+#include <userver/formats/parse/to.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control {
+
+/// @brief Settings of the adaptive in-flight requests limit of a handler.
+///
+/// The limit is tuned every `window` by comparing the average latency of the
+/// window with the long-term average latency (Gradient2 algorithm): the limit
+/// shrinks while the latency grows and grows by about its square root while
+/// the latency is stable.
+struct AdaptiveConcurrencyLimiterConfig final {
+  std::size_t initial_limit{20};
+  std::size_t min_limit{10};
+  std::size_t max_limit{1000};
+
+  /// Short-term latency may exceed the long-term one that many times before
+  /// the limit starts to shrink
+  double tolerance{1.5};
+
+  /// Part of the newly computed limit that is applied at each update
+  double smoothing{0.2};
+
+  /// How often the limit is updated
+  std::chrono::milliseconds window{100};
+
+  /// Time the long-term latency averages over
+  std::chrono::milliseconds long_window{60'000};
+};
+
+AdaptiveConcurrencyLimiterConfig Parse(
+    const yaml_config::YamlConfig& value,
+    formats::parse::To<AdaptiveConcurrencyLimiterConfig>);
+
+}  // namespace congestion_control
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,73 @@
+#pragma once
+
+/// @file userver/congestion_control/client_throttler.hpp
+/// @brief @copybrief congestion_control::ClientThrottler
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include <userver/formats/parse/to.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control {
+
+struct ClientThrottlerConfig final {
+  /// Requests are rejected locally once they exceed the requests accepted
+  /// by the destination that many times
+  double accepts_multiplier{2.0};
+
+  /// Time the requests and the accepts are counted over
+  std::chrono::seconds window{60};
+};
+
+ClientThrottlerConfig Parse(const yaml_config::YamlConfig& value,
+                            formats::parse::To<ClientThrottlerConfig>);
+
+/// @brief Client-side adaptive throttling of the requests to a single
+/// destination.
+///
+/// The requests are rejected locally with the probability
+/// `(requests - accepts_multiplier * accepts) / (requests + 1)`, where the
+/// requests and the requests accepted by the destination (i.e. not failed
+/// because of its overload) are counted over the recent window. The locally
+/// rejected requests are counted as not accepted, so the probability goes
+/// down only as the destination recovers.
+///
+/// Thread-safe.
+class ClientThrottler final {
+ public:
+  explicit ClientThrottler(const ClientThrottlerConfig& config);
+  ~ClientThrottler();
+
+  /// Accounts a request, returns false if it should be rejected locally
+  bool TryStart();
+
+  /// Accounts a request accepted by the destination
+  void AccountAccepted() noexcept;
+
+  /// Returns the current probability of a local rejection
+  double GetRejectProbability() const noexcept;
+
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const ClientThrottler& throttler);
+
+ private:
+  struct Bucket;
+
+  Bucket& GetCurrentBucket() noexcept;
+
+  const ClientThrottlerConfig config_;
+  const std::size_t buckets_count_;
+  std::unique_ptr<Bucket[]> buckets_;
+  utils::statistics::RateCounter rejected_;
+};
+
+}  // namespace congestion_control
+
+USERVER_NAMESPACE_END
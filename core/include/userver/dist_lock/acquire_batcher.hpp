@@ -0,0 +1,85 @@
+#pragma once
+
+/// @file userver/dist_lock/acquire_batcher.hpp
+/// @brief @copybrief dist_lock::AcquireBatcher
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/mutex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dist_lock {
+
+/// A single lock acquisition or prolongation of dist_lock::AcquireBatcher
+struct AcquireRequest final {
+  std::string lock_name;
+  std::string owner;
+  std::chrono::milliseconds lock_ttl;
+};
+
+/// @ingroup userver_concurrency
+///
+/// @brief Coalesces the concurrent DistLockStrategyBase::Acquire() calls of
+/// the distributed locks sharing a backend into a single backend request
+///
+/// Every dist-locked worker prolongs its lock each `prolong_interval`. When a
+/// batch is executed, all of its lockers wake up at once and come back after
+/// their prolong intervals, so the lockers with equal settings soon end up in
+/// the same batch and the backend serves a single request per interval
+/// instead of one per lock.
+///
+/// The first caller of Acquire() gathers a batch for a jittered window of
+/// [window / 2, window * 3 / 2), so that the batches of different hosts do
+/// not hit the backend simultaneously, and then executes it with its own
+/// BatchFunc. All the strategies sharing an AcquireBatcher must thus provide
+/// interchangeable functions.
+///
+/// @see storages::postgres::DistLockStrategy
+class AcquireBatcher final {
+ public:
+  /// Acquires or prolongs the locks, returns the names of the locks that are
+  /// now held by the requested owners. Lock names in a batch are unique.
+  using BatchFunc = std::function<std::unordered_set<std::string>(
+      const std::vector<AcquireRequest>&)>;
+
+  explicit AcquireBatcher(std::chrono::milliseconds window);
+
+  AcquireBatcher(const AcquireBatcher&) = delete;
+  AcquireBatcher& operator=(const AcquireBatcher&) = delete;
+  ~AcquireBatcher();
+
+  /// Waits for the batch with the request to be executed. The wait is not
+  /// interrupted by the task cancellation, as a batch may acquire the lock
+  /// regardless of it.
+  ///
+  /// @throws LockIsAcquiredByAnotherHostException if the lock is busy
+  /// @throws anything thrown by the BatchFunc that executed the batch
+  void Acquire(AcquireRequest request, const BatchFunc& func);
+
+  /// Number of the executed batches
+  std::size_t GetBatchesCount() const;
+
+ private:
+  struct Batch;
+
+  std::unordered_set<std::string> ExecuteBatch(std::shared_ptr<Batch> batch,
+                                               const BatchFunc& func);
+
+  const std::chrono::milliseconds window_;
+
+  mutable engine::Mutex mutex_;
+  engine::ConditionVariable batch_done_cv_;
+  std::shared_ptr<Batch> current_batch_;
+  std::size_t batches_count_{0};
+};
+
+}  // namespace dist_lock
+
+USERVER_NAMESPACE_END
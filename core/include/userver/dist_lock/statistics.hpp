@@ -1,7 +1,10 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 
+#include <userver/utils/statistics/min_max_avg.hpp>
+#include <userver/utils/statistics/recentperiod.hpp>
 #include <userver/utils/statistics/relaxed_counter.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -14,6 +17,11 @@ struct Statistics {
   utils::statistics::RelaxedCounter<size_t> watchdog_triggers{0};
   utils::statistics::RelaxedCounter<size_t> brain_splits{0};
   utils::statistics::RelaxedCounter<size_t> task_failures{0};
+
+  /// Durations of the lock acquisition and prolongation attempts
+  utils::statistics::RecentPeriod<utils::statistics::MinMaxAvg<std::int64_t>,
+                                  utils::statistics::MinMaxAvg<std::int64_t>>
+      acquire_timings_ms;
 };
 
 }  // namespace dist_lock
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -32,6 +33,23 @@ struct ConfigPatch final {
 ConfigPatch Parse(const formats::json::Value& value,
                   formats::parse::To<ConfigPatch>);
 
+/// Settings of the compressed dump format, see dump::CompressedWriter
+struct CompressionConfig final {
+  /// Chunks are decompressed into memory, corrupted sizes must not make us
+  /// allocate too much
+  static constexpr std::size_t kMaxChunkSize = 256 * 1024 * 1024;
+
+  int level;
+  std::size_t chunk_size;
+  std::size_t concurrency;
+  std::string task_processor;
+};
+
+/// Settings of the incremental dumps, see dump::Dumper
+struct IncrementalConfig final {
+  std::size_t max_deltas;
+};
+
 struct Config final {
   Config(std::string name, const yaml_config::YamlConfig& config,
          std::string_view dump_root);
@@ -45,6 +63,9 @@ struct Config final {
   std::optional<std::chrono::milliseconds> max_dump_age;
   bool max_dump_age_set;
   bool dump_is_encrypted;
+  bool use_mmap;
+  std::optional<CompressionConfig> compression;
+  std::optional<IncrementalConfig> incremental;
 
   bool static_dumps_enabled;
   std::chrono::milliseconds static_min_dump_interval;
@@ -33,6 +33,17 @@ struct Config;
 class OperationsFactory;
 extern const std::string_view kDump;
 
+/// The deltas of an incremental dump, see DumpableEntity::ReadAndSetWithDeltas
+class DeltaSequence {
+ public:
+  virtual ~DeltaSequence();
+
+  /// @returns the reader of the next delta in the write order, `nullptr` after
+  /// the last one
+  /// @note Reading of the previous delta or of the base dump must be complete
+  virtual Reader* Next() = 0;
+};
+
 /// A dynamically dispatched equivalent of `kDumpable` "concept". Unlike
 /// with ADL-found `Write`/`Read`, the methods are guaranteed not to be called
 /// in parallel.
@@ -43,6 +54,19 @@ class DumpableEntity {
   virtual void GetAndWrite(dump::Writer& writer) const = 0;
 
   virtual void ReadAndSet(dump::Reader& reader) = 0;
+
+  /// @brief Writes the changes made since the previous successful
+  /// `GetAndWrite`, `GetAndWriteDelta`, `ReadAndSet` or `ReadAndSetWithDeltas`
+  /// for the `incremental` dumps
+  /// @returns `false` without writing anything if the changes can't be written
+  /// as a delta, then `GetAndWrite` is used. Returns `false` by default.
+  virtual bool GetAndWriteDelta(dump::Writer& writer);
+
+  /// @brief Reads the base dump and applies the deltas written on top of it by
+  /// `GetAndWriteDelta`, in order
+  /// @throws dump::Error by default
+  virtual void ReadAndSetWithDeltas(dump::Reader& reader,
+                                    DeltaSequence& deltas);
 };
 
 enum class UpdateType {
@@ -85,6 +109,28 @@ enum class UpdateType {
 /// `min-interval` | `string` (duration) | `WriteDumpAsync` calls performed in a fast succession are ignored | `0s`
 /// `fs-task-processor` | `string` | `TaskProcessor` for blocking disk IO | `fs-task-processor`
 /// `encrypted` | `boolean` | Whether to encrypt the dump | `false`
+/// `mmap` | `boolean` | Whether to memory-map the dump for reading, the data of dump::FlatArray is then used in place without copying. Not supported for `encrypted` dumps | `false`
+/// `compression` | optional `object` | Enables the compressed dump format, see below | null
+/// `compression.level` | `integer` | zstd compression level | `3`
+/// `compression.chunk-size` | `integer` | Size of the uncompressed chunk in bytes | `4194304`
+/// `compression.concurrency` | `integer` | Max number of chunks compressed or decompressed at once | `4`
+/// `compression.task-processor` | `string` | `TaskProcessor` for the compression | `main-task-processor`
+/// `incremental` | optional `object` | Enables the incremental dumps, see below | null
+/// `incremental.max-deltas` | `integer` | Max number of deltas on top of a dump before a new full dump is written | `16`
+///
+/// With `compression` the dump is split into chunks, which are compressed with
+/// zstd in parallel while the data is being serialized, and decompressed ahead
+/// while it is being deserialized. Each chunk is protected by a checksum.
+/// Not supported for `encrypted` and `mmap` dumps.
+///
+/// With `incremental` only the changes since the previous write are written
+/// by DumpableEntity::GetAndWriteDelta, as a delta in the `{dump}.deltas`
+/// directory next to the dump. Once there are `incremental.max-deltas` deltas,
+/// or they take more space than the dump itself, the next write is a full
+/// dump, and the old dump is removed with its deltas as usual. The dump is
+/// loaded together with its deltas by DumpableEntity::ReadAndSetWithDeltas.
+/// components::CachingComponentBase supports the incremental dumps of maps,
+/// see components::CachingComponentBase::SetIncremental.
 ///
 /// ## Sample usage
 /// @snippet core/src/dump/dumper_test.cpp  Sample Dumper usage
@@ -166,7 +212,7 @@ class Dumper final {
          const components::ComponentContext& context, DumpableEntity& dumpable);
 
   class Impl;
-  utils::FastPimpl<Impl, 1088, 16> impl_;
+  utils::FastPimpl<Impl, 1376, 16> impl_;
 };
 
 }  // namespace dump
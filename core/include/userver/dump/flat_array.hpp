@@ -0,0 +1,144 @@
+#pragma once
+
+/// @file userver/dump/flat_array.hpp
+/// @brief @copybrief dump::FlatArray
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/dump/unsafe.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// @ingroup userver_containers
+///
+/// @brief Immutable array of trivially copyable items that is restored from
+/// a dump without deserialization
+///
+/// The items are written to the dump as raw bytes. When the dump is read
+/// with dump::MmapFileReader (`mmap: true` in the static config of the
+/// dumper), the restored array points into the mapped dump file and keeps the
+/// mapping alive, so restoring takes O(1) and the pages are read from the disk
+/// on the first access. Other readers copy the data.
+///
+/// Use it for the flat parts of the huge caches, e.g. the sorted keys and
+/// the values referenced by index:
+///
+/// @code
+/// struct Data {
+///   dump::FlatArray<std::uint64_t> sorted_ids;
+///   dump::FlatArray<Item> items;
+/// };
+/// @endcode
+///
+/// @warning The dumps are not portable: the items are stored in the memory
+/// layout of the writing platform. Change the `format-version` of the dumper
+/// after changing the items type.
+template <typename T>
+class FlatArray final {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "FlatArray items are dumped as raw bytes");
+
+ public:
+  using value_type = T;
+  using const_iterator = const T*;
+  using iterator = const_iterator;
+
+  FlatArray() = default;
+
+  explicit FlatArray(std::vector<T> items);
+
+  /// @cond
+  // For internal use only
+  FlatArray(std::shared_ptr<const T> data, std::size_t size) noexcept
+      : data_(std::move(data)), size_(size) {}
+  /// @endcond
+
+  const T* data() const noexcept { return data_.get(); }
+  std::size_t size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  const T& operator[](std::size_t index) const noexcept {
+    return data_.get()[index];
+  }
+
+  const_iterator begin() const noexcept { return data_.get(); }
+  const_iterator end() const noexcept { return data_.get() + size_; }
+
+ private:
+  std::shared_ptr<const T> data_;
+  std::size_t size_{0};
+};
+
+template <typename T>
+FlatArray<T>::FlatArray(std::vector<T> items) : size_(items.size()) {
+  auto storage = std::make_shared<const std::vector<T>>(std::move(items));
+  data_ = std::shared_ptr<const T>(storage, storage->data());
+}
+
+namespace impl {
+
+// Aligns the items in the dump, so that they can be used in place
+inline std::size_t GetFlatArrayPadding(std::size_t position,
+                                       std::size_t alignment) noexcept {
+  return (alignment - position % alignment) % alignment;
+}
+
+}  // namespace impl
+
+/// @brief dump::FlatArray serialization support
+template <typename T>
+void Write(Writer& writer, const FlatArray<T>& array) {
+  writer.Write(array.size());
+
+  static constexpr char kZeros[alignof(T)]{};
+  const auto padding =
+      impl::GetFlatArrayPadding(GetPositionUnsafe(writer), alignof(T));
+  WriteStringViewUnsafe(writer, std::string_view{kZeros, padding});
+
+  WriteStringViewUnsafe(
+      writer, std::string_view{reinterpret_cast<const char*>(array.data()),
+                               array.size() * sizeof(T)});
+}
+
+/// @brief dump::FlatArray deserialization support
+template <typename T>
+FlatArray<T> Read(Reader& reader, To<FlatArray<T>>) {
+  const auto size = reader.Read<std::size_t>();
+  ReadStringViewUnsafe(
+      reader, impl::GetFlatArrayPadding(GetPositionUnsafe(reader), alignof(T)));
+  if (size == 0) return {};
+
+  const auto bytes_size = size * sizeof(T);
+  if (auto shared = ReadSharedUnsafe(reader, bytes_size)) {
+    if (reinterpret_cast<std::uintptr_t>(shared.get()) % alignof(T) == 0) {
+      return FlatArray<T>{
+          std::shared_ptr<const T>(shared,
+                                   reinterpret_cast<const T*>(shared.get())),
+          size};
+    }
+
+    std::vector<T> items(size);
+    std::memcpy(items.data(), shared.get(), bytes_size);
+    return FlatArray<T>{std::move(items)};
+  }
+
+  std::vector<T> items(size);
+  const auto bytes = ReadStringViewUnsafe(reader, bytes_size);
+  std::memcpy(items.data(), bytes.data(), bytes_size);
+  return FlatArray<T>{std::move(items)};
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
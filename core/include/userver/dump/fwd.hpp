@@ -1,7 +1,8 @@
 #pragma once
 
 /// @file userver/dump/fwd.hpp
-/// @brief Forward declarations of dump::Reader, dump::Writer and dump::To
+/// @brief Forward declarations of dump::Reader, dump::Writer, dump::To and
+/// dump::DeltaSequence
 
 #include <userver/dump/to.hpp>
 
@@ -11,6 +12,7 @@ namespace dump {
 
 class Writer;
 class Reader;
+class DeltaSequence;
 
 }  // namespace dump
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -42,6 +44,10 @@ class Writer {
   virtual void WriteRaw(std::string_view data) = 0;
 
   friend void WriteStringViewUnsafe(Writer& writer, std::string_view value);
+  friend std::size_t GetPositionUnsafe(const Writer& writer) noexcept;
+
+ private:
+  std::size_t position_{0};
 };
 
 /// A general interface for binary data input
@@ -68,7 +74,20 @@ class Reader {
   /// @throws `Error` on read operation failure
   virtual std::string_view ReadRaw(std::size_t max_size) = 0;
 
+  /// @brief Reads binary data without copying it
+  /// @returns exactly `size` bytes that stay valid for the lifetime of the
+  /// returned pointer, or `nullptr` without reading anything if the `Reader`
+  /// does not support it
+  /// @throws `Error` on read operation failure
+  virtual std::shared_ptr<const char> ReadRawShared(std::size_t size);
+
   friend std::string_view ReadUnsafeAtMost(Reader& reader, std::size_t size);
+  friend std::shared_ptr<const char> ReadSharedUnsafe(Reader& reader,
+                                                      std::size_t size);
+  friend std::size_t GetPositionUnsafe(const Reader& reader) noexcept;
+
+ private:
+  std::size_t position_{0};
 };
 
 namespace impl {
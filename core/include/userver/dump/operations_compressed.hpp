@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/dump/config.hpp>
+#include <userver/dump/factory.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/dump/operations_file.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// @brief A handle to a compressed dump file. File operations block the
+/// thread.
+///
+/// The data is split into chunks of `chunk_size` bytes. Up to `concurrency`
+/// chunks are compressed with zstd in parallel on `task_processor`, while the
+/// serialization goes on. Each chunk stores a checksum of its data.
+class CompressedWriter final : public Writer {
+ public:
+  /// @brief Creates a new dump file and opens it
+  /// @throws `Error` on a filesystem error
+  CompressedWriter(std::string path, boost::filesystem::perms perms,
+                   tracing::ScopeTime& scope, const CompressionConfig& config,
+                   engine::TaskProcessor& task_processor);
+
+  ~CompressedWriter() override;
+
+  void Finish() override;
+
+ private:
+  struct Chunk final {
+    std::uint64_t raw_size;
+    std::string compressed;
+  };
+
+  void WriteRaw(std::string_view data) override;
+
+  void CompressChunk();
+  void WriteCompressedChunk();
+
+  FileWriter file_;
+  const int level_;
+  const std::size_t chunk_size_;
+  const std::size_t concurrency_;
+  engine::TaskProcessor& task_processor_;
+  std::string chunk_;
+  std::deque<engine::TaskWithResult<Chunk>> pending_;
+  std::uint64_t chunks_written_{0};
+};
+
+/// @brief A handle to a dump file written by dump::CompressedWriter. File
+/// operations block the thread.
+///
+/// Up to `concurrency` chunks are read ahead and decompressed in parallel on
+/// `task_processor`, while the deserialization goes on.
+class CompressedReader final : public Reader {
+ public:
+  /// @brief Opens an existing dump file
+  /// @throws `Error` on a filesystem error or if the file is not a compressed
+  /// dump
+  CompressedReader(std::string path, std::size_t concurrency,
+                   engine::TaskProcessor& task_processor);
+
+  ~CompressedReader() override;
+
+  void Finish() override;
+
+ private:
+  std::string_view ReadRaw(std::size_t max_size) override;
+
+  void StartDecompression();
+  bool NextChunk();
+
+  FileReader file_;
+  const std::string path_;
+  engine::TaskProcessor& task_processor_;
+  std::deque<engine::TaskWithResult<std::string>> pending_;
+  bool is_file_read_{false};
+  std::uint64_t chunks_read_{0};
+  std::uint64_t chunks_decompressed_{0};
+  std::string chunk_;
+  std::size_t chunk_offset_{0};
+  std::string spill_;
+};
+
+class CompressedOperationsFactory final : public OperationsFactory {
+ public:
+  /// @param task_processor the `TaskProcessor` for compression, the one of
+  /// the calling task is used if `nullptr`
+  CompressedOperationsFactory(boost::filesystem::perms perms,
+                              CompressionConfig config,
+                              engine::TaskProcessor* task_processor);
+
+  std::unique_ptr<Reader> CreateReader(std::string full_path) override;
+
+  std::unique_ptr<Writer> CreateWriter(std::string full_path,
+                                       tracing::ScopeTime& scope) override;
+
+ private:
+  engine::TaskProcessor& GetTaskProcessor() const;
+
+  const boost::filesystem::perms perms_;
+  const CompressionConfig config_;
+  engine::TaskProcessor* const task_processor_;
+};
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
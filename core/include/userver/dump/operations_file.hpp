@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <memory>
 
 #include <boost/filesystem/operations.hpp>
 
@@ -52,9 +53,35 @@ class FileReader final : public Reader {
   std::string curr_chunk_;
 };
 
+/// @brief A handle to a memory-mapped dump file.
+///
+/// The data is paged in on demand. ReadRaw does not copy the data and
+/// ReadSharedUnsafe gives out the parts of the mapping, which stays alive
+/// while they are used, e.g. see dump::FlatArray.
+class MmapFileReader final : public Reader {
+ public:
+  /// @brief Opens and maps an existing dump file
+  /// @throws `Error` on a filesystem error
+  explicit MmapFileReader(std::string path);
+
+  void Finish() override;
+
+ private:
+  std::string_view ReadRaw(std::size_t max_size) override;
+
+  std::shared_ptr<const char> ReadRawShared(std::size_t size) override;
+
+  std::string path_;
+  std::shared_ptr<const char> mapping_;
+  std::size_t size_{0};
+  std::size_t offset_{0};
+};
+
 class FileOperationsFactory final : public OperationsFactory {
  public:
-  explicit FileOperationsFactory(boost::filesystem::perms perms);
+  /// @param use_mmap whether to read the dumps with dump::MmapFileReader
+  explicit FileOperationsFactory(boost::filesystem::perms perms,
+                                 bool use_mmap = false);
 
   std::unique_ptr<Reader> CreateReader(std::string full_path) override;
 
@@ -63,6 +90,7 @@ class FileOperationsFactory final : public OperationsFactory {
 
  private:
   const boost::filesystem::perms perms_;
+  const bool use_mmap_;
 };
 
 }  // namespace dump
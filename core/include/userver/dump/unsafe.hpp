@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <memory>
 #include <string_view>
 
 #include <userver/dump/operations.hpp>
@@ -27,6 +29,18 @@ std::string_view ReadStringViewUnsafe(Reader& reader, std::size_t size);
 /// @warning The `string_view` will be invalidated on the next `Read` operation
 std::string_view ReadUnsafeAtMost(Reader& reader, std::size_t max_size);
 
+/// @brief Reads a non-size-prefixed binary data without copying it, if
+/// the `Reader` supports it
+/// @returns `size` bytes that stay valid while the pointer is alive, or
+/// `nullptr` without reading anything
+std::shared_ptr<const char> ReadSharedUnsafe(Reader& reader, std::size_t size);
+
+/// @brief The number of bytes written so far
+std::size_t GetPositionUnsafe(const Writer& writer) noexcept;
+
+/// @brief The number of bytes read so far
+std::size_t GetPositionUnsafe(const Reader& reader) noexcept;
+
 }  // namespace dump
 
 USERVER_NAMESPACE_END
@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <exception>
 #include <functional>
+#include <memory>
 #include <string>
 #include <type_traits>
 #include <typeindex>
@@ -56,6 +57,12 @@ class SnapshotData final {
   SnapshotData(const SnapshotData& defaults,
                const std::vector<KeyValue>& overrides);
 
+  // Parses only the configs that depend on the docs that differ between
+  // `docs_map` and `previous_docs_map`, the other configs are copied from
+  // `previous`, which must have been built from `previous_docs_map`.
+  SnapshotData(const DocsMap& docs_map, const DocsMap& previous_docs_map,
+               const SnapshotData& previous);
+
   SnapshotData(SnapshotData&&) noexcept = default;
   SnapshotData& operator=(SnapshotData&&) noexcept = default;
 
@@ -71,9 +78,16 @@ class SnapshotData final {
   bool IsEmpty() const noexcept;
 
  private:
+  using Dependencies = std::shared_ptr<const std::vector<std::string>>;
+
   const std::any& DoGet(ConfigId id) const;
 
+  void Parse(ConfigId id, const DocsMap& docs_map);
+
   std::vector<std::any> user_configs_;
+  // Names of the docs each config was parsed from, nullptr for the configs
+  // that were not parsed from a DocsMap
+  std::vector<Dependencies> dependencies_;
 };
 
 class StorageData;
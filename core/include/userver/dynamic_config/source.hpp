@@ -3,6 +3,7 @@
 /// @file userver/dynamic_config/source.hpp
 /// @brief @copybrief dynamic_config::Source
 
+#include <cstdint>
 #include <optional>
 #include <string_view>
 #include <utility>
@@ -102,6 +103,15 @@ class Source final {
     return snapshot[key];
   }
 
+  /// @brief Returns the number of config updates so far.
+  ///
+  /// Reading the version is a single atomic load, unlike GetSnapshot. Values
+  /// that are computed from a config snapshot may be stored together with the
+  /// version and recomputed only when the version changes. A snapshot that
+  /// is obtained after reading the version is at least as new as that
+  /// version.
+  std::uint64_t GetVersion() const noexcept;
+
   /// Subscribes to dynamic-config updates using a member function. Also
   /// immediately invokes the function with the current config snapshot (this
   /// invocation will be executed synchronously).
@@ -207,6 +217,44 @@ class Source final {
                              std::move(wrapper));
   }
 
+  /// @brief Subscribes to updates of a single config.
+  ///
+  /// Subscribes to dynamic-config updates using a member function, named
+  /// `OnConfigUpdate` by convention. The function is invoked with the new
+  /// value of the config only if it has been changed since the previous
+  /// invocation, other configs updates are ignored. At the first time
+  /// immediately invokes the function with the current value (this
+  /// invocation will be executed synchronously).
+  ///
+  /// @warning To use this function, the config must have the `operator==`.
+  ///
+  /// Example usage:
+  /// @snippet dynamic_config/config_test.cpp Single config subscription
+  ///
+  /// @param obj the subscriber, which is the owner of the listener method, and
+  /// is also used as the unique identifier of the subscription
+  /// @param name the name of the subscriber, for diagnostic purposes
+  /// @param func the listener method, named `OnConfigUpdate` by convention.
+  /// @param key config object, a specialization of `dynamic_config::Key`,
+  /// which should outlive the subscription.
+  /// @returns a `concurrent::AsyncEventSubscriberScope` controlling the
+  /// subscription, which should be stored as a member in the subscriber;
+  /// `Unsubscribe` should be called explicitly
+  ///
+  /// @see based on concurrent::AsyncEventSource engine
+  template <typename Class, typename VariableType>
+  concurrent::AsyncEventSubscriberScope UpdateAndListen(
+      Class* obj, std::string_view name,
+      void (Class::*func)(const VariableType& value),
+      const Key<VariableType>& key) {
+    auto wrapper = [obj, func, &key](const Diff& diff) {
+      if (!HasChanged(diff, key)) return;
+      (obj->*func)(diff.current[key]);
+    };
+    return DoUpdateAndListen(concurrent::FunctionId(obj), name,
+                             std::move(wrapper));
+  }
+
   SnapshotEventSource& GetEventChannel();
 
  private:
@@ -3,6 +3,7 @@
 #include <optional>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #include <userver/formats/json/value.hpp>
 #include <userver/formats/parse/common_containers.hpp>
@@ -45,11 +46,20 @@ class DocsMap final {
   // For internal use only.
   const utils::impl::TransparentSet<std::string>& GetConfigsExpectedToBeUsed(
       utils::impl::InternalTag) const;
+
+  // For internal use only.
+  // While set, names passed to 'Get' and 'Has' methods are appended to
+  // 'accessed_names'. Used to find out which configs a parser depends on.
+  void SetAccessedNamesRecorder(std::vector<std::string>* accessed_names,
+                                utils::impl::InternalTag) const;
   /// @endcond
 
  private:
+  void RecordAccess(std::string_view name) const;
+
   utils::impl::TransparentMap<std::string, formats::json::Value> docs_;
   mutable utils::impl::TransparentSet<std::string> configs_to_be_used_;
+  mutable std::vector<std::string>* accessed_names_{nullptr};
 };
 
 template <typename ValueType>
@@ -0,0 +1,124 @@
+#pragma once
+
+/// @file userver/engine/adaptive_mutex.hpp
+/// @brief @copybrief engine::AdaptiveMutex
+
+#include <chrono>
+#include <mutex>  // for std locks
+
+#include <userver/engine/deadline.hpp>
+#include <userver/utils/fast_pimpl.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/// @brief Contention statistics of engine::AdaptiveMutex
+struct MutexStatistics final {
+  /// Successful locks
+  utils::statistics::Rate acquisitions;
+
+  /// Locks that have found the mutex locked by another task
+  utils::statistics::Rate contended_acquisitions;
+
+  /// Contended locks that have not succeeded while spinning and have put the
+  /// task to sleep
+  utils::statistics::Rate parked_acquisitions;
+
+  /// Total time of waiting in the contended locks, in microseconds
+  utils::statistics::Rate wait_us;
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const MutexStatistics& stats);
+
+/// @brief Whether engine::AdaptiveMutex collects the contention statistics
+enum class MutexStatisticsMode {
+  kDisabled,
+  kEnabled,
+};
+
+/// @ingroup userver_concurrency
+///
+/// @brief engine::Mutex that spins for a while before putting the task to
+/// sleep.
+///
+/// For critical sections that last tens of nanoseconds, putting the task
+/// to sleep and scheduling it again costs far more than the section itself.
+/// On contention the mutex spins waiting for the owner to unlock it. The spin
+/// budget adapts to the observed hold times of the mutex, and the spinning
+/// stops early if some tasks are already sleeping on the mutex. Prefer
+/// engine::Mutex for long critical sections.
+///
+/// Ignores task cancellations (succeeds even if the current task is cancelled).
+///
+/// With MutexStatisticsMode::kEnabled the mutex counts the contention, which
+/// may be registered in utils::statistics::Storage:
+///
+/// @code
+/// writer_holder_ = storage.RegisterWriter(
+///     "my-component.mutex",
+///     [this](utils::statistics::Writer& writer) {
+///       writer = mutex_.GetStatistics();
+///     });
+/// @endcode
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+class AdaptiveMutex final {
+ public:
+  AdaptiveMutex();
+  explicit AdaptiveMutex(MutexStatisticsMode statistics_mode);
+  ~AdaptiveMutex();
+
+  AdaptiveMutex(const AdaptiveMutex&) = delete;
+  AdaptiveMutex(AdaptiveMutex&&) = delete;
+  AdaptiveMutex& operator=(const AdaptiveMutex&) = delete;
+  AdaptiveMutex& operator=(AdaptiveMutex&&) = delete;
+
+  /// @copydoc engine::Mutex::lock
+  void lock();
+
+  /// @copydoc engine::Mutex::unlock
+  void unlock();
+
+  /// @copydoc engine::Mutex::try_lock
+  [[nodiscard]] bool try_lock() noexcept;
+
+  /// @copydoc engine::Mutex::try_lock_for
+  template <typename Rep, typename Period>
+  [[nodiscard]] bool try_lock_for(const std::chrono::duration<Rep, Period>&);
+
+  /// @copydoc engine::Mutex::try_lock_until
+  template <typename Clock, typename Duration>
+  [[nodiscard]] bool try_lock_until(
+      const std::chrono::time_point<Clock, Duration>&);
+
+  /// @overload
+  [[nodiscard]] bool try_lock_until(Deadline deadline);
+
+  /// @brief Returns the contention statistics, zeros if they are disabled
+  MutexStatistics GetStatistics() const noexcept;
+
+ private:
+  class Impl;
+
+  utils::FastPimpl<Impl, 144, alignof(void*)> impl_;
+};
+
+template <typename Rep, typename Period>
+bool AdaptiveMutex::try_lock_for(
+    const std::chrono::duration<Rep, Period>& duration) {
+  return try_lock_until(Deadline::FromDuration(duration));
+}
+
+template <typename Clock, typename Duration>
+bool AdaptiveMutex::try_lock_until(
+    const std::chrono::time_point<Clock, Duration>& until) {
+  return try_lock_until(Deadline::FromTimePoint(until));
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -3,6 +3,9 @@
 /// @file userver/engine/async.hpp
 /// @brief TaskWithResult creation helpers
 
+#include <cstddef>
+#include <vector>
+
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/impl/task_context_factory.hpp>
 #include <userver/engine/task/shared_task_with_result.hpp>
@@ -18,21 +21,78 @@ namespace impl {
 
 template <template <typename> typename TaskType, typename Function,
           typename... Args>
-[[nodiscard]] auto MakeTaskWithResult(TaskProcessor& task_processor,
-                                      Task::Importance importance,
-                                      Deadline deadline, Function&& f,
-                                      Args&&... args) {
+[[nodiscard]] auto MakePrioritizedTaskWithResult(
+    TaskProcessor& task_processor, Task::Importance importance,
+    Deadline deadline, Task::Priority priority, Function&& f, Args&&... args) {
   using ResultType =
       typename utils::impl::WrappedCallImplType<Function, Args...>::ResultType;
   constexpr auto kWaitMode = TaskType<ResultType>::kWaitMode;
 
   return TaskType<ResultType>{
-      MakeTask({task_processor, importance, kWaitMode, deadline},
+      MakeTask({task_processor, importance, kWaitMode, deadline, priority},
                std::forward<Function>(f), std::forward<Args>(args)...)};
 }
 
+template <template <typename> typename TaskType, typename Function,
+          typename... Args>
+[[nodiscard]] auto MakeTaskWithResult(TaskProcessor& task_processor,
+                                      Task::Importance importance,
+                                      Deadline deadline, Function&& f,
+                                      Args&&... args) {
+  return MakePrioritizedTaskWithResult<TaskType>(
+      task_processor, importance, deadline, Task::Priority::kNormal,
+      std::forward<Function>(f), std::forward<Args>(args)...);
+}
+
+template <template <typename> typename TaskType, typename WrappedCallType,
+          typename PlacementNewPayload>
+[[nodiscard]] auto MakeTaskBatchWithResult(
+    TaskProcessor& task_processor, Task::Importance importance,
+    Deadline deadline, std::size_t count,
+    PlacementNewPayload&& placement_new_payload) {
+  using ResultType = typename WrappedCallType::ResultType;
+  constexpr auto kWaitMode = TaskType<ResultType>::kWaitMode;
+
+  std::vector<TaskType<ResultType>> tasks;
+  tasks.reserve(count);
+  MakeTaskBatch<WrappedCallType>(
+      {task_processor, importance, kWaitMode, deadline}, count,
+      placement_new_payload, [&tasks](TaskContextHolder&& context) noexcept {
+        tasks.emplace_back(std::move(context));
+      });
+  return tasks;
+}
+
 }  // namespace impl
 
+/// @brief Runs `count` asynchronous calls `f(index)`, index in `[0, count)`,
+/// using specified task processor
+///
+/// The tasks are allocated at once and are pushed into the task queue at once,
+/// which is cheaper than starting them one by one. The result can be awaited
+/// with engine::WaitAllChecked or engine::GetAll.
+///
+/// `f` is copied into each of the tasks.
+template <typename Function>
+[[nodiscard]] auto SpawnManyNoSpan(TaskProcessor& task_processor,
+                                   std::size_t count, const Function& f) {
+  using WrappedCallType =
+      utils::impl::WrappedCallImplType<const Function&, std::size_t>;
+  return impl::MakeTaskBatchWithResult<TaskWithResult, WrappedCallType>(
+      task_processor, Task::Importance::kNormal, {}, count,
+      [&f](std::byte* storage, std::size_t index) -> WrappedCallType& {
+        return utils::impl::PlacementNewWrapCall(storage, f, index);
+      });
+}
+
+/// @brief Runs `count` asynchronous calls `f(index)`, index in `[0, count)`,
+/// using task processor of the caller
+/// @see SpawnManyNoSpan
+template <typename Function>
+[[nodiscard]] auto SpawnManyNoSpan(std::size_t count, const Function& f) {
+  return SpawnManyNoSpan(current_task::GetTaskProcessor(), count, f);
+}
+
 /// Runs an asynchronous function call using specified task processor
 template <typename Function, typename... Args>
 [[nodiscard]] auto AsyncNoSpan(TaskProcessor& task_processor, Function&& f,
@@ -159,6 +219,40 @@ template <typename Function, typename... Args>
       std::forward<Function>(f), std::forward<Args>(args)...);
 }
 
+/// @brief Runs an asynchronous function call with the specified priority class
+/// using specified task processor
+/// @see Task::Priority
+template <typename Function, typename... Args>
+[[nodiscard]] auto AsyncNoSpan(TaskProcessor& task_processor,
+                               Task::Priority priority, Function&& f,
+                               Args&&... args) {
+  return impl::MakePrioritizedTaskWithResult<TaskWithResult>(
+      task_processor, Task::Importance::kNormal, {}, priority,
+      std::forward<Function>(f), std::forward<Args>(args)...);
+}
+
+/// @brief Runs an asynchronous function call with the specified priority class
+/// and deadline using specified task processor
+/// @see Task::Priority
+template <typename Function, typename... Args>
+[[nodiscard]] auto AsyncNoSpan(TaskProcessor& task_processor,
+                               Task::Priority priority, Deadline deadline,
+                               Function&& f, Args&&... args) {
+  return impl::MakePrioritizedTaskWithResult<TaskWithResult>(
+      task_processor, Task::Importance::kNormal, deadline, priority,
+      std::forward<Function>(f), std::forward<Args>(args)...);
+}
+
+/// @brief Runs an asynchronous function call with the specified priority class
+/// using task processor of the caller
+/// @see Task::Priority
+template <typename Function, typename... Args>
+[[nodiscard]] auto AsyncNoSpan(Task::Priority priority, Function&& f,
+                               Args&&... args) {
+  return AsyncNoSpan(current_task::GetTaskProcessor(), priority,
+                     std::forward<Function>(f), std::forward<Args>(args)...);
+}
+
 }  // namespace engine
 
 USERVER_NAMESPACE_END
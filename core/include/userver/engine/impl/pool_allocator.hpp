@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+inline constexpr std::size_t kPoolAlignment = 16;
+
+// Allocates from the thread-local freelists of fixed size classes, falls back
+// to the global allocator for the big sizes. Never returns nullptr, may throw.
+//
+// Unlike the thread caches of general purpose allocators, the freelists stay
+// efficient when the blocks are freed on some other thread: a thread that has
+// too many idle blocks hands them over to the global pool, where they are
+// picked up by the threads that allocate.
+void* PoolAllocate(std::size_t size);
+
+void PoolDeallocate(void* ptr) noexcept;
+
+// An std-compatible allocator over PoolAllocate, e.g. for std::allocate_shared
+template <typename T>
+class PoolAllocator final {
+ public:
+  static_assert(alignof(T) <= kPoolAlignment);
+
+  using value_type = T;
+
+  PoolAllocator() noexcept = default;
+
+  template <typename U>
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  PoolAllocator(const PoolAllocator<U>&) noexcept {}
+
+  T* allocate(std::size_t n) {
+    return static_cast<T*>(PoolAllocate(n * sizeof(T)));
+  }
+
+  void deallocate(T* ptr, std::size_t /*n*/) noexcept { PoolDeallocate(ptr); }
+
+  template <typename U>
+  bool operator==(const PoolAllocator<U>&) const noexcept {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(const PoolAllocator<U>&) const noexcept {
+    return false;
+  }
+};
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
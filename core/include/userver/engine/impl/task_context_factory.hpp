@@ -24,6 +24,7 @@ struct TaskConfig final {
   Task::Importance importance{Task::Importance::kNormal};
   Task::WaitMode wait_mode{Task::WaitMode::kSingleWaiter};
   engine::Deadline deadline;
+  Task::Priority priority{Task::Priority::kNormal};
 };
 
 [[nodiscard]] TaskContext& PlacementNewTaskContext(
@@ -35,6 +36,29 @@ std::byte* AllocateFusedTaskContext(std::size_t total_size);
 
 void DeleteFusedTaskContext(std::byte* storage) noexcept;
 
+// A single allocation for multiple fused TaskContexts, see MakeTaskBatch.
+class FusedTaskBatch;
+
+// Never returns nullptr, may throw. `slot_size` must be a multiple of
+// kTaskContextAlignment.
+FusedTaskBatch& AllocateFusedTaskBatch(std::size_t count,
+                                       std::size_t slot_size);
+
+std::byte* GetFusedTaskBatchSlot(FusedTaskBatch& batch,
+                                 std::size_t index) noexcept;
+
+// Makes the context release its slot instead of deleting its own allocation.
+void AttachToFusedTaskBatch(FusedTaskBatch& batch, std::size_t index,
+                            TaskContext& context) noexcept;
+
+// Bootstraps the first `count` tasks of the batch and pushes them into the
+// task queue at once.
+void ScheduleFusedTaskBatch(FusedTaskBatch& batch, std::size_t count) noexcept;
+
+// The whole allocation is freed once all the slots are released.
+void ReleaseFusedTaskBatchSlots(FusedTaskBatch& batch,
+                                std::size_t count) noexcept;
+
 // The allocations for TaskContext and WrappedCall are manually fused. The
 // layout is as follows:
 // 1. TaskContext, guaranteed to be at the beginning of the allocation
@@ -75,6 +99,52 @@ TaskContextHolder MakeTask(TaskConfig config, Function&& f, Args&&... args) {
   return TaskContextHolder::Adopt(context);
 }
 
+// Same as MakeTask, but makes `count` tasks in a single allocation.
+// `placement_new_payload(storage, index)` must construct the WrappedCallType of
+// the task number `index` at `storage`, see utils::impl::PlacementNewWrapCall.
+//
+// The tasks are passed to `consumer` as they are made, it must not throw.
+// Unlike MakeTask, the tasks are only scheduled on return from this function,
+// with a single push into the task queue. That happens even if an exception
+// is thrown midway, because the tasks that are already made might be awaited
+// by the consumer.
+template <typename WrappedCallType, typename PlacementNewPayload,
+          typename Consumer>
+void MakeTaskBatch(TaskConfig config, std::size_t count,
+                   PlacementNewPayload&& placement_new_payload,
+                   Consumer&& consumer) {
+  static_assert(alignof(WrappedCallType) <= kTaskContextAlignment);
+  if (count == 0) return;
+
+  const auto task_context_size = GetTaskContextSize();
+  const auto slot_size =
+      (task_context_size + sizeof(WrappedCallType) + kTaskContextAlignment -
+       1) /
+      kTaskContextAlignment * kTaskContextAlignment;
+
+  auto& batch = AllocateFusedTaskBatch(count, slot_size);
+  std::size_t made_count = 0;
+  utils::FastScopeGuard schedule_guard{[&]() noexcept {
+    ScheduleFusedTaskBatch(batch, made_count);
+    ReleaseFusedTaskBatchSlots(batch, count - made_count);
+  }};
+
+  for (; made_count < count; ++made_count) {
+    std::byte* const storage = GetFusedTaskBatchSlot(batch, made_count);
+
+    WrappedCallType& payload =
+        placement_new_payload(storage + task_context_size, made_count);
+    utils::FastScopeGuard destroy_payload_guard{
+        [&]() noexcept { std::destroy_at(&payload); }};
+
+    auto& context = PlacementNewTaskContext(storage, config, payload);
+    destroy_payload_guard.Release();
+
+    AttachToFusedTaskBatch(batch, made_count, context);
+    consumer(TaskContextHolder::AdoptDeferred(context));
+  }
+}
+
 }  // namespace engine::impl
 
 USERVER_NAMESPACE_END
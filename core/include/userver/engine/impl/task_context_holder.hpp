@@ -17,14 +17,21 @@ class TaskContextHolder final {
 
   static TaskContextHolder Adopt(TaskContext& context) noexcept;
 
+  // The task is not scheduled by engine::TaskBase on construction, whoever
+  // made it is responsible for scheduling it.
+  static TaskContextHolder AdoptDeferred(TaskContext& context) noexcept;
+
   TaskContextHolder(TaskContextHolder&&) noexcept = default;
   TaskContextHolder& operator=(TaskContextHolder&&) = delete;
   ~TaskContextHolder();
 
   boost::intrusive_ptr<TaskContext>&& Extract() && noexcept;
 
+  bool IsBootstrapDeferred() const noexcept { return is_bootstrap_deferred_; }
+
  private:
   boost::intrusive_ptr<TaskContext> context_;
+  bool is_bootstrap_deferred_{false};
 };
 
 }  // namespace engine::impl
@@ -42,13 +42,15 @@ class ReadableBase {
                                        Deadline deadline) = 0;
 
   /// For internal use only
-  impl::ContextAccessor* TryGetContextAccessor() { return ca_; }
+  engine::impl::ContextAccessor* TryGetContextAccessor() { return ca_; }
 
  protected:
-  void SetReadableContextAccessor(impl::ContextAccessor* ca) { ca_ = ca; }
+  void SetReadableContextAccessor(engine::impl::ContextAccessor* ca) {
+    ca_ = ca;
+  }
 
  private:
-  impl::ContextAccessor* ca_{nullptr};
+  engine::impl::ContextAccessor* ca_{nullptr};
 };
 
 /// IoData for vector send
@@ -82,13 +84,15 @@ class WritableBase {
   }
 
   /// For internal use only
-  impl::ContextAccessor* TryGetContextAccessor() { return ca_; }
+  engine::impl::ContextAccessor* TryGetContextAccessor() { return ca_; }
 
  protected:
-  void SetWritableContextAccessor(impl::ContextAccessor* ca) { ca_ = ca; }
+  void SetWritableContextAccessor(engine::impl::ContextAccessor* ca) {
+    ca_ = ca;
+  }
 
  private:
-  impl::ContextAccessor* ca_{nullptr};
+  engine::impl::ContextAccessor* ca_{nullptr};
 };
 
 /// @ingroup userver_base_classes
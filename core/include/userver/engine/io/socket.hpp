@@ -41,6 +41,26 @@ class [[nodiscard]] Socket final : public RwBase {
     Sockaddr src_addr;
   };
 
+  /// A datagram for SendMany
+  struct SendDatagram {
+    IoData data{nullptr, 0};
+    /// Destination address, the datagram is sent to the connected peer if null
+    const Sockaddr* dest_addr{nullptr};
+  };
+
+  /// A buffer for a datagram received by RecvMany
+  struct RecvDatagram {
+    void* buf{nullptr};
+    size_t len{0};
+
+    /// Filled by RecvMany
+    size_t bytes_received{0};
+    /// Filled by RecvMany
+    Sockaddr src_addr;
+    /// Filled by RecvMany, whether the datagram did not fit into the buffer
+    bool is_truncated{false};
+  };
+
   /// Constructs an invalid socket.
   Socket() = default;
 
@@ -127,6 +147,26 @@ class [[nodiscard]] Socket final : public RwBase {
   [[nodiscard]] size_t SendAllTo(const Sockaddr& dest_addr, const void* buf,
                                  size_t len, Deadline deadline);
 
+  /// @brief Sends the datagrams with as few syscalls as possible
+  /// (`sendmmsg` where available).
+  /// @returns the number of sent datagrams, less than count only if the
+  /// socket is closed by peer.
+  /// @throws IoTimeout, IoCancelled with `bytes_transferred` holding the
+  /// number of sent datagrams.
+  /// @note Sockaddr domains must match the socket's domain.
+  /// @note With UDP GSO enabled by `SetOption(SOL_UDP, UDP_SEGMENT, size)`
+  /// the kernel splits each datagram into the segments of `size` bytes.
+  [[nodiscard]] size_t SendMany(const SendDatagram* datagrams, size_t count,
+                                Deadline deadline);
+
+  /// @brief Receives at least one datagram and at most count datagrams that
+  /// are already available, with as few syscalls as possible (`recvmmsg`
+  /// where available).
+  /// @returns the number of received datagrams, the rest of the datagrams
+  /// are left untouched.
+  [[nodiscard]] size_t RecvMany(RecvDatagram* datagrams, size_t count,
+                                Deadline deadline);
+
   /// File descriptor corresponding to this socket.
   int Fd() const;
 
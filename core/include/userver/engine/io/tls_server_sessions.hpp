@@ -0,0 +1,94 @@
+#pragma once
+
+/// @file userver/engine/io/tls_server_sessions.hpp
+/// @brief @copybrief engine::io::TlsServerSessions
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <userver/utils/strong_typedef.hpp>
+
+struct ssl_ctx_st;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io {
+
+class TlsWrapper;
+
+/// @brief TLS session resumption state of the servers, shared by the
+/// connections of all the listeners that use it.
+///
+/// Holds a bounded sharded cache of the sessions for the clients that resume
+/// by the session id, and the keys of the session tickets for the stateless
+/// resumption. The instances behind a balancer resume each other's tickets if
+/// they have the same ticket keys. Without the keys set, the tickets are
+/// encrypted with a random key of this instance.
+///
+/// Thread-safe.
+class TlsServerSessions final {
+ public:
+  /// Size of a ticket key: 16 bytes of the key name, 32 bytes of the HMAC key
+  /// and 32 bytes of the AES key
+  static constexpr std::size_t kTicketKeySize = 80;
+
+  using TicketKey = utils::NonLoggable<class TicketKeyTag, std::string>;
+
+  struct Settings final {
+    /// Maximum number of the cached sessions
+    std::size_t cache_size{20480};
+
+    /// Lifetime of the cached sessions and of the tickets
+    std::chrono::seconds session_timeout{300};
+  };
+
+  struct Stats final {
+    /// Handshakes that have resumed a session, by the id or by a ticket
+    std::uint64_t resumed_handshakes{0};
+    /// Handshakes that have created a new session
+    std::uint64_t full_handshakes{0};
+    /// Session ids found in the cache
+    std::uint64_t cache_hits{0};
+    /// Session ids missing in the cache, e.g. evicted or expired
+    std::uint64_t cache_misses{0};
+    /// Tickets with an unknown key name, e.g. of a rotated out key
+    std::uint64_t unknown_ticket_keys{0};
+    std::size_t cached_sessions{0};
+  };
+
+  explicit TlsServerSessions(Settings settings);
+  ~TlsServerSessions();
+
+  TlsServerSessions(TlsServerSessions&&) = delete;
+  TlsServerSessions& operator=(TlsServerSessions&&) = delete;
+
+  /// @brief Replaces the ticket keys.
+  ///
+  /// The first key encrypts the new tickets, the others only decrypt the
+  /// tickets issued before the rotation, and such tickets are renewed. An
+  /// empty list restores the random key of the instance.
+  /// @throws std::invalid_argument if a key is not kTicketKeySize bytes long
+  void SetTicketKeys(const std::vector<TicketKey>& keys);
+
+  Stats GetStats() const;
+
+ private:
+  friend class TlsWrapper;
+
+  class Impl;
+
+  // Makes the connections of the context use the sessions
+  void SetUp(ssl_ctx_st* ssl_ctx) const;
+
+  void AccountHandshake(bool is_resumed) const noexcept;
+
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace engine::io
+
+USERVER_NAMESPACE_END
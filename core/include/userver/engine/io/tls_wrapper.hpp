@@ -11,12 +11,23 @@
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/io/common.hpp>
 #include <userver/engine/io/socket.hpp>
+#include <userver/engine/io/tls_server_sessions.hpp>
 #include <userver/utils/fast_pimpl.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::io {
 
+/// Where the TLS records are encrypted and decrypted
+enum class TlsOffload {
+  /// In user space by OpenSSL
+  kNone,
+  /// By the kernel TLS (kTLS) after the handshake, for the directions that
+  /// the kernel, OpenSSL and the negotiated cipher support. The other
+  /// directions stay in user space.
+  kKernel,
+};
+
 /// Class for TLS communications over a Socket.
 ///
 /// Not thread safe. E.g. you MAY NOT read and write concurrently from multiple
@@ -36,13 +47,24 @@ class [[nodiscard]] TlsWrapper final : public RwBase {
       Socket&& socket, const std::string& server_name,
       const crypto::Certificate& cert, const crypto::PrivateKey& key,
       Deadline deadline,
-      const std::vector<crypto::Certificate>& extra_cert_authorities = {});
-
-  /// Starts a TLS server on an opened socket
+      const std::vector<crypto::Certificate>& extra_cert_authorities = {},
+      TlsOffload offload = TlsOffload::kNone);
+
+  /// @brief Starts a TLS server on an opened socket
+  /// @param alpn_protocols application protocols to negotiate with ALPN, in
+  /// the order of preference; the selected one is returned by
+  /// GetAlpnProtocol()
+  /// @param offload whether to hand the established session to the kernel
+  /// @param sessions the session cache and ticket keys to resume the sessions
+  /// with, shared by the connections; without them every handshake is a full
+  /// one
   static TlsWrapper StartTlsServer(
       Socket&& socket, const crypto::Certificate& cert,
       const crypto::PrivateKey& key, Deadline deadline,
-      const std::vector<crypto::Certificate>& extra_cert_authorities = {});
+      const std::vector<crypto::Certificate>& extra_cert_authorities = {},
+      const std::vector<std::string>& alpn_protocols = {},
+      TlsOffload offload = TlsOffload::kNone,
+      const TlsServerSessions* sessions = nullptr);
 
   ~TlsWrapper() override;
 
@@ -106,6 +128,16 @@ class [[nodiscard]] TlsWrapper final : public RwBase {
 
   int GetRawFd();
 
+  /// @brief Returns the application protocol negotiated with ALPN, or an
+  /// empty string if there was no negotiation
+  std::string GetAlpnProtocol() const;
+
+  /// Whether the sent data is encrypted by the kernel, see TlsOffload
+  bool IsKernelTlsSend() const;
+
+  /// Whether the received data is decrypted by the kernel, see TlsOffload
+  bool IsKernelTlsRecv() const;
+
  private:
   explicit TlsWrapper(Socket&&);
 
@@ -0,0 +1,167 @@
+#pragma once
+
+/// @file userver/engine/striped_shared_mutex.hpp
+/// @brief @copybrief engine::StripedSharedMutex
+
+#include <atomic>
+#include <chrono>
+#include <mutex>  // for std locks
+
+#include <userver/concurrent/impl/striped_read_indicator.hpp>
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/// @ingroup userver_concurrency
+///
+/// @brief engine::SharedMutex with per-CPU reader counters for read-mostly
+/// data.
+///
+/// engine::SharedMutex keeps a single reader counter, and the cache line with
+/// it bounces between the CPUs under concurrent read locking. This mutex
+/// counts the readers in a concurrent::impl::StripedReadIndicator, so that
+/// lock_shared() and unlock_shared() only touch the counter of the current
+/// CPU. In return, a writer has to scan the counters of all CPUs and to wait
+/// for them to drain, which makes unique locking considerably slower than
+/// in engine::SharedMutex.
+///
+/// Each instance allocates `16 * N_CORES` bytes. Use it sparingly, only for
+/// a few hot mutexes with rare writes, and measure with
+/// `shared_mutex_benchmark`.
+///
+/// Ignores task cancellations (succeeds even if the current task is cancelled).
+///
+/// Writers (unique locks) have priority over readers (shared locks),
+/// thus new shared lock waits for the pending writes to finish, which in turn
+/// waits for existing shared locks to unlock first.
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+class StripedSharedMutex final {
+ public:
+  StripedSharedMutex();
+  ~StripedSharedMutex();
+
+  StripedSharedMutex(const StripedSharedMutex&) = delete;
+  StripedSharedMutex(StripedSharedMutex&&) = delete;
+  StripedSharedMutex& operator=(const StripedSharedMutex&) = delete;
+  StripedSharedMutex& operator=(StripedSharedMutex&&) = delete;
+
+  /// Locks the mutex for unique ownership. Blocks current coroutine if the
+  /// mutex is locked by another coroutine for reading or writing.
+  ///
+  /// @note The method waits for the mutex even if the current task is
+  /// cancelled.
+  void lock();
+
+  /// Unlocks the mutex for unique ownership. Before calling this method the
+  /// the mutex should be locked for unique ownership by current coroutine.
+  void unlock();
+
+  /// Tries to lock the mutex for unique ownership without blocking the
+  /// coroutine, returns true if succeeded.
+  [[nodiscard]] bool try_lock();
+
+  /// Tries to lock the mutex for unique ownership in specified duration.
+  ///
+  /// @returns true if the locking succeeded
+  template <typename Rep, typename Period>
+  [[nodiscard]] bool try_lock_for(const std::chrono::duration<Rep, Period>&);
+
+  /// Tries to lock the mutex for unique ownership till specified time point.
+  ///
+  /// @returns true if the locking succeeded
+  template <typename Clock, typename Duration>
+  [[nodiscard]] bool try_lock_until(
+      const std::chrono::time_point<Clock, Duration>&);
+
+  /// @overload
+  [[nodiscard]] bool try_lock_until(Deadline deadline);
+
+  /// Locks the mutex for shared ownership. Blocks current coroutine if the
+  /// mutex is locked or awaited by another coroutine for writing.
+  ///
+  /// @note The method waits for the mutex even if the current task is
+  /// cancelled.
+  void lock_shared();
+
+  /// Unlocks the mutex for shared ownership. Before calling this method the
+  /// mutex should be locked for shared ownership by current coroutine.
+  void unlock_shared();
+
+  /// Tries to lock the mutex for shared ownership without blocking the
+  /// coroutine, returns true if succeeded.
+  [[nodiscard]] bool try_lock_shared();
+
+  /// Tries to lock the mutex for shared ownership in specified duration.
+  ///
+  /// @returns true if the locking succeeded
+  template <typename Rep, typename Period>
+  [[nodiscard]] bool try_lock_shared_for(
+      const std::chrono::duration<Rep, Period>&);
+
+  /// Tries to lock the mutex for shared ownership till specified time point.
+  ///
+  /// @returns true if the locking succeeded
+  template <typename Clock, typename Duration>
+  [[nodiscard]] bool try_lock_shared_until(
+      const std::chrono::time_point<Clock, Duration>&);
+
+  /// @overload
+  [[nodiscard]] bool try_lock_shared_until(Deadline deadline);
+
+ private:
+  bool TryEnterReader();
+  void LeaveReader();
+
+  bool WaitForNoWriter(Deadline deadline);
+  void ReleaseWriter();
+
+  concurrent::impl::StripedReadIndicator readers_;
+
+  /* Set while a writer waits for the readers to leave or holds the lock.
+   * Readers that see it step back and wait on writer_released_cv_.
+   */
+  std::atomic<bool> writer_active_{false};
+
+  /* Serializes the writers, held for the whole unique ownership */
+  Mutex writers_mutex_;
+
+  /* The writer that holds writers_mutex_ waits on it for the readers */
+  SingleConsumerEvent readers_left_event_;
+
+  Mutex writer_released_mutex_;
+  ConditionVariable writer_released_cv_;
+};
+
+template <typename Rep, typename Period>
+bool StripedSharedMutex::try_lock_for(
+    const std::chrono::duration<Rep, Period>& duration) {
+  return try_lock_until(Deadline::FromDuration(duration));
+}
+
+template <typename Rep, typename Period>
+bool StripedSharedMutex::try_lock_shared_for(
+    const std::chrono::duration<Rep, Period>& duration) {
+  return try_lock_shared_until(Deadline::FromDuration(duration));
+}
+
+template <typename Clock, typename Duration>
+bool StripedSharedMutex::try_lock_until(
+    const std::chrono::time_point<Clock, Duration>& until) {
+  return try_lock_until(Deadline::FromTimePoint(until));
+}
+
+template <typename Clock, typename Duration>
+bool StripedSharedMutex::try_lock_shared_until(
+    const std::chrono::time_point<Clock, Duration>& until) {
+  return try_lock_shared_until(Deadline::FromTimePoint(until));
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -19,6 +19,11 @@ namespace engine {
 /// These are like engine::TaskLocalVariable, but the variable instances are
 /// inherited by child tasks created via utils::Async.
 ///
+/// The instances are not copied on inheritance: a child task shares them with
+/// the parent in O(1). `Set`, `Emplace` or `Erase` in a task that shares the
+/// variables copies the pointers to the instances, not the instances
+/// themselves.
+///
 /// The order of destruction of task-inherited variables is unspecified.
 template <typename T>
 class TaskInheritedVariable final {
@@ -48,6 +48,25 @@ class [[nodiscard]] TaskBase {
     kCritical,
   };
 
+  /// @brief Task priority class
+  ///
+  /// Only affects the order of execution on task processors with
+  /// `task-queue: priority`, see components::ManagerControllerComponent.
+  /// Under overload with `OverloadAction::kCancel` such task processors cancel
+  /// background tasks before the others.
+  enum class Priority {
+    /// Latency sensitive task, runs before the normal ones
+    kHigh,
+
+    /// Normal task
+    kNormal,
+
+    /// Background task, e.g. a cache update. Runs when there are no other
+    /// tasks to run, with a small share of the task processor reserved to
+    /// avoid starvation
+    kBackground,
+  };
+
   /// Task state
   enum class State {
     kInvalid,    ///< Unusable
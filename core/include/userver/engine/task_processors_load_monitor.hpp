@@ -17,6 +17,10 @@ namespace engine {
 /// @brief Component to monitor CPU usage for every TaskProcessor present in
 /// the service, and dump per-thread stats into metrics.
 ///
+/// For task processors with `task-queue: work-stealing` it also dumps the
+/// queue sizes and the steal counters of every NUMA node the workers are
+/// split between (a single node unless `numa-aware` is enabled).
+///
 /// ## Static options:
 /// Inherits all the options from components::ComponentBase and adds the
 /// following ones:
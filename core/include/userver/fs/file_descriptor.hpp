@@ -0,0 +1,93 @@
+#pragma once
+
+/// @file userver/fs/file_descriptor.hpp
+/// @brief @copybrief fs::FileDescriptor
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/fs/blocking/open_mode.hpp>
+#include <userver/utils/not_null.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace fs {
+
+/// @ingroup userver_containers
+///
+/// @brief A file descriptor wrapper for the asynchronous positioned reads and
+/// writes. The file is closed in the destructor.
+///
+/// On a task processor with `io_backend: io_uring` the operations are
+/// submitted to the io_uring of the current worker thread and the coroutine
+/// waits for their completion, no thread is blocked. On the other task
+/// processors the operations are run as blocking calls on
+/// `fs_task_processor`, like the rest of the functions in `fs`.
+///
+/// The operations are not interrupted by the task cancellation, as the data
+/// of a partially completed write could not be recovered anyway.
+///
+/// @note The positioned operations do not use the file offset, so they may be
+/// performed concurrently on the same file. Open, FSync and Close may not.
+class FileDescriptor final {
+ public:
+  /// @brief Open a file
+  /// @throws std::runtime_error
+  static FileDescriptor Open(
+      engine::TaskProcessor& fs_task_processor, const std::string& path,
+      blocking::OpenMode flags,
+      boost::filesystem::perms perms = boost::filesystem::perms::owner_read |
+                                       boost::filesystem::perms::owner_write);
+
+  FileDescriptor() = delete;
+  FileDescriptor(FileDescriptor&& other) noexcept = default;
+  FileDescriptor& operator=(FileDescriptor&& other) noexcept = default;
+  ~FileDescriptor();
+
+  /// @brief Checks if the file is open
+  bool IsOpen() const;
+
+  /// @brief Closes the file manually
+  /// @throws std::runtime_error
+  void Close() &&;
+
+  /// Returns the native file handle
+  int GetNative() const;
+
+  /// @brief Reads up to `max_size` bytes starting at `offset`
+  /// @returns The amount of bytes actually read, which is less than
+  /// `max_size` only on end-of-file
+  /// @throws std::runtime_error
+  std::size_t ReadAt(char* buffer, std::size_t max_size, std::uint64_t offset);
+
+  /// @brief Writes the whole `contents` starting at `offset`
+  /// @warning Unless `FSync` is called, there is no guarantee the data
+  /// is stored on disk safely.
+  /// @throws std::runtime_error
+  void WriteAt(std::string_view contents, std::uint64_t offset);
+
+  /// @brief Makes sure the written data is actually stored on disk
+  /// @throws std::runtime_error
+  void FSync();
+
+  /// @brief Fetches the file size
+  /// @throws std::runtime_error
+  std::size_t GetSize() const;
+
+ private:
+  FileDescriptor(engine::TaskProcessor& fs_task_processor,
+                 blocking::FileDescriptor fd);
+
+  utils::NotNull<engine::TaskProcessor*> fs_task_processor_;
+  blocking::FileDescriptor fd_;
+};
+
+}  // namespace fs
+
+USERVER_NAMESPACE_END
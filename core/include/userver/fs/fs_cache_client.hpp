@@ -23,8 +23,11 @@ class FsCacheClient final {
   /// @param update_period time (0 - fill the cache only at startup), not used
   /// in Linux
   /// @param tp task processor to do filesystem operations
+  /// @param flags settings read files, see fs::SettingsReadFile::kMmap
   FsCacheClient(std::string_view dir, std::chrono::milliseconds update_period,
-                engine::TaskProcessor& tp);
+                engine::TaskProcessor& tp,
+                utils::Flags<SettingsReadFile> flags = {
+                    SettingsReadFile::kSkipHidden});
 
   /// @brief get file from memory
   /// @param path to file
@@ -53,6 +56,7 @@ class FsCacheClient final {
   const std::string dir_;
   const std::chrono::milliseconds update_period_;
   engine::TaskProcessor& tp_;
+  const utils::Flags<SettingsReadFile> flags_;
 #ifndef __linux__
   utils::PeriodicTask cache_updater_;
 #endif
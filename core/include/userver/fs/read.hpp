@@ -3,8 +3,10 @@
 /// @file userver/fs/read.hpp
 /// @brief functions for asynchronous file read operations
 
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 #include <userver/engine/task/task_processor_fwd.hpp>
@@ -17,8 +19,20 @@ namespace fs {
 
 /// @brief Struct file with load data
 struct FileInfoWithData {
+  /// The contents of the file, empty if the file is mapped into memory
   std::string data;
   std::string extension;
+  /// Quoted strong ETag of the file, made of its modification time and size
+  std::string etag;
+  /// The file mapped into memory with SettingsReadFile::kMmap
+  std::shared_ptr<const char> mapping;
+  std::size_t mapping_size{0};
+
+  /// Returns the contents of the file, whether it is read or mapped
+  std::string_view GetContents() const {
+    return mapping ? std::string_view{mapping.get(), mapping_size}
+                   : std::string_view{data};
+  }
 };
 
 using FileInfoWithDataConstPtr = std::shared_ptr<const FileInfoWithData>;
@@ -29,6 +43,11 @@ enum class SettingsReadFile {
   kNone = 0,
   /// Skip hidden files,
   kSkipHidden = 1 << 0,
+  /// Map the files into memory instead of reading them. The pages are shared
+  /// with the page cache and the other processes mapping the files.
+  /// @warning The files must be replaced atomically, e.g. renamed over, and
+  /// never rewritten or truncated in place while mapped.
+  kMmap = 1 << 1,
 };
 
 /// @brief Returns relative path from full path
@@ -49,6 +68,16 @@ FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
     engine::TaskProcessor& async_tp, const std::string& path,
     utils::Flags<SettingsReadFile> flags = {SettingsReadFile::kSkipHidden});
 
+/// @brief Reads file contents, or maps the file with
+/// SettingsReadFile::kMmap, asynchronously
+/// @param async_tp TaskProcessor for synchronous waiting
+/// @param path file to open
+/// @param flags settings read files
+/// @throws std::runtime_error if read fails for any reason
+FileInfoWithData ReadFileInfoWithData(
+    engine::TaskProcessor& async_tp, const std::string& path,
+    utils::Flags<SettingsReadFile> flags = {});
+
 /// @brief Reads file contents asynchronously
 /// @param async_tp TaskProcessor for synchronous waiting
 /// @param path file to open
@@ -43,12 +43,15 @@ namespace components {
 /// ---- | ----------- | -------------
 /// file_path | path to the log file | -
 /// level | log verbosity | info
-/// format | log output format, either `tskv` or `ltsv` | tskv
+/// format | log output format, either `tskv`, `ltsv` or `json`; `binary` captures raw values on the hot path and renders them as `tskv` in the logger task | tskv
 /// flush_level | messages of this and higher levels get flushed to the file immediately | warning
 /// message_queue_size | the size of internal message queue, must be a power of 2 | 65536
 /// overflow_behavior | message handling policy while the queue is full: `discard` drops messages, `block` waits until message gets into the queue | discard
+/// queue_mode | `shared` pushes the messages of all the threads into a single queue, `per-thread` pushes them into per-thread queues of message_queue_size divided by the CPU count each, keeping the order of the messages of each thread only | shared
 /// testsuite-capture | if exists, setups additional TCP log sink for testing purposes | {}
 /// fs-task-processor | task processor for disk I/O operations for this logger | fs-task-processor of the loggers component
+/// sampling_budget | records per second of each level; once exceeded, the log locations that produce more than 1/16 of the budget are sampled down proportionally to their volume, and `suppressed N records from file:line` records are written with the first record of the next second; 0 disables sampling | 0
+/// write_batch | if exists, records to a file are coalesced in memory and written with a single `writev` per batch | -
 ///
 /// ### Logs output
 /// You can specify logger output, in `file_path` option:
@@ -64,6 +67,15 @@ namespace components {
 /// host | testsuite hostname, e.g. localhost | -
 /// port | testsuite port | -
 ///
+/// ### write_batch options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// size_bytes | the batch is written once it grows to that size | 1048576
+/// max_delay | the batch is written on the next record once its oldest record is that old; the periodic flush writes it when there are no new records | 100ms
+///
+/// Write syscalls and bytes written through the batches are reported in the
+/// logger statistics as `write_syscalls` and `written_bytes`.
+///
 /// ## Static configuration example:
 ///
 /// @snippet components/common_component_list_test.cpp Sample logging component config
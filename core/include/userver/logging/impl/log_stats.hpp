@@ -2,6 +2,7 @@
 
 #include <array>
 #include <atomic>
+#include <cstdint>
 
 #include <userver/logging/level.hpp>
 #include <userver/utils/statistics/rate_counter.hpp>
@@ -18,6 +19,13 @@ struct LogStatistics final {
 
   std::array<Counter, kLevelMax + 1> by_level{};
   std::atomic<bool> has_reopening_error{false};
+
+  // Records waiting in the async queue, updated on each statistics read
+  std::atomic<std::int64_t> queue_size{0};
+
+  // Only updated by the sinks that batch the records, see `write_batch`
+  Counter write_syscalls{};
+  Counter written_bytes{};
 };
 
 void DumpMetric(utils::statistics::Writer& writer, const LogStatistics& stats);
@@ -4,8 +4,11 @@
 /// @brief @copybrief rcu::Variable
 
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <optional>
+#include <type_traits>
 #include <utility>
 
 #include <userver/concurrent/impl/asymmetric_fence.hpp>
@@ -17,6 +20,7 @@
 #include <userver/rcu/fwd.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/impl/wait_token_storage.hpp>
+#include <userver/utils/meta_light.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -35,6 +39,8 @@ struct SnapshotRecord final {
   concurrent::impl::StripedReadIndicator indicator;
   concurrent::impl::SinglyLinkedHook<SnapshotRecord> free_list_hook;
   SnapshotRecord* next_retired{nullptr};
+  // Only used with rcu::EpochReclamation
+  std::uint64_t retire_epoch{0};
 };
 
 // Used instead of concurrent::impl::MemberHook to avoid instantiating
@@ -82,16 +88,76 @@ class SnapshotRecordRetiredList final {
   SnapshotRecord<T>* head_{nullptr};
 };
 
+struct NoEpochState final {};
+
+struct EpochState final {
+  std::atomic<std::uint64_t> epoch{0};
+  // The readers of the epoch `e` lock `indicators[e % 2]`
+  concurrent::impl::StripedReadIndicator indicators[2];
+};
+
 }  // namespace impl
 
+/// @brief Reclamation policy of rcu::Variable, where each snapshot has its own
+/// read indicator. Writers check the read indicators of all the retired
+/// snapshots. Used by default.
+/// @tparam BatchSize the number of commits between two reclamation passes
+template <std::size_t BatchSize = 1>
+struct SnapshotReclamation final {
+  static_assert(BatchSize > 0);
+
+  static constexpr bool kIsEpochBased = false;
+  static constexpr std::size_t kBatchSize = BatchSize;
+};
+
+/// @brief Epoch-based reclamation policy of rcu::Variable.
+///
+/// Readers lock the read indicator of the current epoch instead of the one of
+/// the snapshot. A reclamation pass advances the epoch once no readers of the
+/// previous epoch remain, and frees the snapshots retired two epochs ago. So
+/// a pass checks at most two read indicators, however many snapshots are
+/// retired, which makes writers much cheaper with many reader threads.
+///
+/// The drawback is that a long-living rcu::ReadablePtr delays the
+/// reclamation of all the snapshots retired after it was obtained.
+/// @tparam BatchSize the number of commits between two reclamation passes,
+/// up to `BatchSize + 1` old snapshots are kept alive between the passes
+template <std::size_t BatchSize = 16>
+struct EpochReclamation final {
+  static_assert(BatchSize > 0);
+
+  static constexpr bool kIsEpochBased = true;
+  static constexpr std::size_t kBatchSize = BatchSize;
+};
+
 /// Default Rcu traits.
 /// - `MutexType` is a writer's mutex type that has to be used to protect
 /// structure on update
+/// - `ReclamationPolicy` (optional) is rcu::SnapshotReclamation (the default)
+/// or rcu::EpochReclamation
 template <typename T>
 struct DefaultRcuTraits {
   using MutexType = engine::Mutex;
 };
 
+/// Rcu traits for the epoch-based reclamation, see rcu::EpochReclamation
+template <typename T>
+struct EpochRcuTraits {
+  using MutexType = engine::Mutex;
+  using ReclamationPolicy = EpochReclamation<>;
+};
+
+namespace impl {
+
+template <typename RcuTraits>
+using HasReclamationPolicy = typename RcuTraits::ReclamationPolicy;
+
+template <typename RcuTraits>
+using ReclamationPolicyOf =
+    meta::DetectedOr<SnapshotReclamation<>, HasReclamationPolicy, RcuTraits>;
+
+}  // namespace impl
+
 /// Reader smart pointer for rcu::Variable<T>. You may use operator*() or
 /// operator->() to do something with the stored value. Once created,
 /// ReadablePtr references the same immutable value: if Variable's value is
@@ -101,6 +167,11 @@ template <typename T, typename RcuTraits>
 class [[nodiscard]] ReadablePtr final {
  public:
   explicit ReadablePtr(const Variable<T, RcuTraits>& ptr) {
+    if constexpr (impl::ReclamationPolicyOf<RcuTraits>::kIsEpochBased) {
+      LockEpoch(ptr);
+      return;
+    }
+
     auto* record = ptr.current_.load();
 
     while (true) {
@@ -168,6 +239,29 @@ class [[nodiscard]] ReadablePtr final {
     std::abort();
   }
 
+  void LockEpoch(const Variable<T, RcuTraits>& ptr) {
+    auto& state = ptr.epoch_state_;
+    auto epoch = state.epoch.load();
+
+    while (true) {
+      lock_ = state.indicators[epoch % 2].Lock();
+
+      // The same reasoning as for the snapshot indicators above applies to
+      // 'epoch' and Variable::TryAdvanceEpoch.
+      concurrent::impl::AsymmetricThreadFenceLight();
+
+      const auto new_epoch = state.epoch.load(std::memory_order_seq_cst);
+      if (new_epoch == epoch) break;
+
+      // The epoch has advanced, try again
+      epoch = new_epoch;
+    }
+
+    // Snapshots retired in 'epoch' or later are not freed until the lock is
+    // released, and the snapshot we load now is retired no earlier than that.
+    ptr_ = &*ptr.current_.load(std::memory_order_seq_cst)->data;
+  }
+
   const T* ptr_;
   concurrent::impl::StripedReadIndicatorLock lock_;
 };
@@ -278,6 +372,8 @@ enum class DestructionType { kSync, kAsync };
 /// @see @ref scripts/docs/en/userver/synchronization.md
 template <typename T, typename RcuTraits>
 class Variable final {
+  using ReclamationPolicy = impl::ReclamationPolicyOf<RcuTraits>;
+
  public:
   using MutexType = typename RcuTraits::MutexType;
 
@@ -312,6 +408,12 @@ class Variable final {
   Variable& operator=(Variable&&) = delete;
 
   ~Variable() {
+    if constexpr (ReclamationPolicy::kIsEpochBased) {
+      UASSERT_MSG(epoch_state_.indicators[0].IsFree() &&
+                      epoch_state_.indicators[1].IsFree(),
+                  "RCU variable is destroyed while being used");
+    }
+
     {
       auto* record = current_.load();
       UASSERT_MSG(record->indicator.IsFree(),
@@ -374,6 +476,8 @@ class Variable final {
         .Commit();
   }
 
+  /// Frees the old values that are no longer used. Is called automatically
+  /// once per `ReclamationPolicy::kBatchSize` commits.
   void Cleanup() {
     std::unique_lock lock(mutex_, std::try_to_lock);
     if (!lock.owns_lock()) {
@@ -397,8 +501,15 @@ class Variable final {
     current_.store(&new_snapshot, std::memory_order_seq_cst);
 
     UASSERT(old_snapshot);
+    if constexpr (ReclamationPolicy::kIsEpochBased) {
+      old_snapshot->retire_epoch =
+          epoch_state_.epoch.load(std::memory_order_relaxed);
+    }
     retired_list_.Push(*old_snapshot);
-    ScanRetiredList(lock);
+
+    if (++commits_since_scan_ >= ReclamationPolicy::kBatchSize) {
+      ScanRetiredList(lock);
+    }
   }
 
   template <typename... Args>
@@ -426,15 +537,43 @@ class Variable final {
 
   void ScanRetiredList(std::unique_lock<MutexType>& lock) noexcept {
     UASSERT(lock.owns_lock());
+    commits_since_scan_ = 0;
     if (retired_list_.IsEmpty()) return;
 
     concurrent::impl::AsymmetricThreadFenceHeavy();
 
-    retired_list_.RemoveAndDisposeIf(
-        [](impl::SnapshotRecord<T>& record) {
-          return record.indicator.IsFree();
-        },
-        [&](impl::SnapshotRecord<T>& record) { DeleteSnapshot(record); });
+    if constexpr (ReclamationPolicy::kIsEpochBased) {
+      const auto epoch = TryAdvanceEpoch();
+      retired_list_.RemoveAndDisposeIf(
+          [epoch](impl::SnapshotRecord<T>& record) {
+            return record.retire_epoch + 2 <= epoch;
+          },
+          [&](impl::SnapshotRecord<T>& record) { DeleteSnapshot(record); });
+    } else {
+      retired_list_.RemoveAndDisposeIf(
+          [](impl::SnapshotRecord<T>& record) {
+            return record.indicator.IsFree();
+          },
+          [&](impl::SnapshotRecord<T>& record) { DeleteSnapshot(record); });
+    }
+  }
+
+  // Invariant: at the epoch 'e' there are no readers of the epochs before
+  // 'e - 1', so the snapshots retired before 'e - 1' are unreachable.
+  // Must be called under 'mutex_' after AsymmetricThreadFenceHeavy.
+  std::uint64_t TryAdvanceEpoch() noexcept {
+    auto epoch = epoch_state_.epoch.load(std::memory_order_relaxed);
+
+    // Advancing twice allows to free the snapshots retired in this batch
+    for (int i = 0; i < 2; ++i) {
+      if (!epoch_state_.indicators[(epoch - 1) % 2].IsFree()) break;
+
+      ++epoch;
+      epoch_state_.epoch.store(epoch, std::memory_order_seq_cst);
+      // Makes the locks of the readers of the new epoch visible to IsFree
+      if (i == 0) concurrent::impl::AsymmetricThreadFenceHeavy();
+    }
+    return epoch;
   }
 
   void DeleteSnapshot(impl::SnapshotRecord<T>& record) {
@@ -462,6 +601,10 @@ class Variable final {
   impl::SnapshotRecordFreeList<T> free_list_;
   impl::SnapshotRecordRetiredList<T> retired_list_;
   std::atomic<impl::SnapshotRecord<T>*> current_;
+  std::size_t commits_since_scan_{0};
+  mutable std::conditional_t<ReclamationPolicy::kIsEpochBased,
+                             impl::EpochState, impl::NoEpochState>
+      epoch_state_;
   utils::impl::WaitTokenStorage wait_token_storage_;
 };
 
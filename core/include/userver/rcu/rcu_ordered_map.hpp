@@ -0,0 +1,286 @@
+#pragma once
+
+/// @file userver/rcu/rcu_ordered_map.hpp
+/// @brief @copybrief rcu::RcuOrderedMap
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <userver/rcu/rcu.hpp>
+#include <userver/rcu/rcu_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace rcu {
+
+/// Default RcuOrderedMap traits.
+/// Member types:
+/// - `Compare` is a functor type that orders the keys
+/// - `MutexType` is a writer's mutex type that has to be used to protect
+/// structure on update
+/// - `ReclamationPolicy` (optional) is rcu::SnapshotReclamation (the default)
+/// or rcu::EpochReclamation
+template <typename Key, typename Value>
+struct DefaultRcuOrderedMapTraits {
+  using Compare = std::less<Key>;
+  using MutexType = engine::Mutex;
+};
+
+namespace impl {
+template <typename RawMap>
+struct VersionedMap final {
+  RawMap map;
+  std::uint64_t version{0};
+};
+}  // namespace impl
+
+/// @ingroup userver_concurrency userver_containers
+///
+/// @brief Ordered concurrent map with versioned snapshots
+///
+/// Each change publishes a new version of the whole map, so a snapshot is
+/// a consistent view of the map that may be iterated over or scanned by key
+/// ranges, while the writers go on. The version number of the map grows on
+/// each publication, so consumers may skip the snapshots that they have
+/// already processed.
+///
+/// The values are immutable, as they are shared between the versions.
+///
+/// Like rcu::RcuMap, the map is copied on each change. Use `Assign` or
+/// `StartWrite` to apply a batch of changes with a single copy and
+/// publication.
+///
+/// @see @ref md_en_userver_synchronization
+template <typename Key, typename Value,
+          typename RcuMapTraits = DefaultRcuOrderedMapTraits<Key, Value>>
+class RcuOrderedMap final {
+  static_assert(!std::is_reference_v<Key>);
+  static_assert(!std::is_reference_v<Value>);
+  static_assert(!std::is_const_v<Key>);
+
+  using Compare = typename RcuMapTraits::Compare;
+  using RcuTraits = impl::RcuTraitsFromRcuMapTraits<RcuMapTraits>;
+
+ public:
+  using ValuePtr = std::shared_ptr<const Value>;
+  using RawMap = std::map<Key, ValuePtr, Compare>;
+
+  class Snapshot;
+  class Transaction;
+
+  RcuOrderedMap() = default;
+
+  RcuOrderedMap(const RcuOrderedMap&) = delete;
+  RcuOrderedMap& operator=(const RcuOrderedMap&) = delete;
+
+  /// @brief Returns the version of the current snapshot
+  std::uint64_t GetVersion() const;
+
+  /// @brief Returns an estimated size of the map at some point in time
+  std::size_t SizeApprox() const;
+
+  /// @brief Returns the current consistent snapshot of the map
+  /// @note The snapshot holds the version of the map alive, don't keep it for
+  /// a long time.
+  Snapshot GetSnapshot() const;
+
+  /// @brief Returns a value pointer by its key or an empty pointer
+  ValuePtr Get(const Key& key) const;
+
+  /// @brief Inserts a new element or replaces the existing one
+  void InsertOrAssign(Key key, ValuePtr value);
+
+  /// @brief Removes the key from the map
+  /// @returns whether the key was present
+  bool Erase(const Key& key);
+
+  /// @brief Removes all the elements from the map
+  void Clear();
+
+  /// @brief Replaces the contents of the map with a single publication
+  /// @details The current map is not copied.
+  void Assign(RawMap new_map);
+
+  /// @brief Starts a transaction, used to perform a series of arbitrary changes
+  /// to the map.
+  /// @details The map is copied. Don't forget to `Commit` to publish the
+  /// changes as a single version.
+  Transaction StartWrite();
+
+ private:
+  using Data = impl::VersionedMap<RawMap>;
+
+  rcu::Variable<Data, RcuTraits> rcu_;
+};
+
+/// @brief A consistent read-only view of a version of rcu::RcuOrderedMap
+template <typename Key, typename Value, typename RcuMapTraits>
+class RcuOrderedMap<Key, Value, RcuMapTraits>::Snapshot final {
+ public:
+  using ConstIterator = typename RawMap::const_iterator;
+
+  /// @brief A half-open range of the snapshot elements
+  class Range final {
+   public:
+    ConstIterator begin() const { return begin_; }
+    ConstIterator end() const { return end_; }
+    bool empty() const { return begin_ == end_; }
+
+   private:
+    friend class Snapshot;
+
+    Range(ConstIterator begin, ConstIterator end) : begin_(begin), end_(end) {}
+
+    ConstIterator begin_;
+    ConstIterator end_;
+  };
+
+  /// @brief Returns the version of the map at the time of the snapshot
+  std::uint64_t GetVersion() const { return ptr_->version; }
+
+  std::size_t size() const { return ptr_->map.size(); }
+  bool empty() const { return ptr_->map.empty(); }
+
+  ConstIterator begin() const { return ptr_->map.begin(); }
+  ConstIterator end() const { return ptr_->map.end(); }
+
+  /// @brief Returns a value pointer by its key or an empty pointer
+  ValuePtr Get(const Key& key) const;
+
+  /// @brief Returns the first element not less than `key`
+  ConstIterator LowerBound(const Key& key) const {
+    return ptr_->map.lower_bound(key);
+  }
+
+  /// @brief Returns the first element greater than `key`
+  ConstIterator UpperBound(const Key& key) const {
+    return ptr_->map.upper_bound(key);
+  }
+
+  /// @brief Returns the elements with the keys in `[from, to)`
+  Range GetRange(const Key& from, const Key& to) const;
+
+  /// @brief Returns the underlying map of the snapshot
+  const RawMap& GetRawMap() const { return ptr_->map; }
+
+ private:
+  friend class RcuOrderedMap;
+
+  explicit Snapshot(rcu::ReadablePtr<Data, RcuTraits>&& ptr)
+      : ptr_(std::move(ptr)) {}
+
+  rcu::ReadablePtr<Data, RcuTraits> ptr_;
+};
+
+/// @brief A batch of changes to rcu::RcuOrderedMap, published as a single
+/// version on `Commit`
+template <typename Key, typename Value, typename RcuMapTraits>
+class RcuOrderedMap<Key, Value, RcuMapTraits>::Transaction final {
+ public:
+  Transaction(Transaction&&) noexcept = default;
+
+  RawMap& operator*() { return ptr_->map; }
+  RawMap* operator->() { return &ptr_->map; }
+
+  /// @brief Publishes the changes as the next version of the map
+  void Commit() {
+    ++ptr_->version;
+    ptr_.Commit();
+  }
+
+ private:
+  friend class RcuOrderedMap;
+
+  explicit Transaction(rcu::WritablePtr<Data, RcuTraits>&& ptr)
+      : ptr_(std::move(ptr)) {}
+
+  rcu::WritablePtr<Data, RcuTraits> ptr_;
+};
+
+template <typename K, typename V, typename RcuMapTraits>
+std::uint64_t RcuOrderedMap<K, V, RcuMapTraits>::GetVersion() const {
+  auto ptr = rcu_.Read();
+  return ptr->version;
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+std::size_t RcuOrderedMap<K, V, RcuMapTraits>::SizeApprox() const {
+  auto ptr = rcu_.Read();
+  return ptr->map.size();
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+auto RcuOrderedMap<K, V, RcuMapTraits>::GetSnapshot() const -> Snapshot {
+  return Snapshot{rcu_.Read()};
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+auto RcuOrderedMap<K, V, RcuMapTraits>::Get(const K& key) const -> ValuePtr {
+  return GetSnapshot().Get(key);
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+void RcuOrderedMap<K, V, RcuMapTraits>::InsertOrAssign(K key, ValuePtr value) {
+  auto txn = StartWrite();
+  txn->insert_or_assign(std::move(key), std::move(value));
+  txn.Commit();
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+bool RcuOrderedMap<K, V, RcuMapTraits>::Erase(const K& key) {
+  if (!Get(key)) return false;
+
+  auto txn = StartWrite();
+  if (!txn->erase(key)) return false;
+  txn.Commit();
+  return true;
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+void RcuOrderedMap<K, V, RcuMapTraits>::Clear() {
+  Assign({});
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+void RcuOrderedMap<K, V, RcuMapTraits>::Assign(RawMap new_map) {
+  auto txn = rcu_.StartWriteEmplace(Data{std::move(new_map), 0});
+  {
+    // The writer lock is held, so the current version is the latest one
+    auto current = rcu_.Read();
+    txn->version = current->version + 1;
+  }
+  txn.Commit();
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+auto RcuOrderedMap<K, V, RcuMapTraits>::StartWrite() -> Transaction {
+  return Transaction{rcu_.StartWrite()};
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+auto RcuOrderedMap<K, V, RcuMapTraits>::Snapshot::Get(const K& key) const
+    -> ValuePtr {
+  const auto it = ptr_->map.find(key);
+  if (it == ptr_->map.end()) return {};
+  return it->second;
+}
+
+template <typename K, typename V, typename RcuMapTraits>
+auto RcuOrderedMap<K, V, RcuMapTraits>::Snapshot::GetRange(const K& from,
+                                                          const K& to) const
+    -> Range {
+  auto first = ptr_->map.lower_bound(from);
+  auto last = ptr_->map.lower_bound(to);
+  // An inverted range is empty
+  if (ptr_->map.key_comp()(to, from)) last = first;
+  return Range{first, last};
+}
+
+}  // namespace rcu
+
+USERVER_NAMESPACE_END
@@ -66,6 +66,9 @@ namespace components {
 /// tls.cert | path to TLS server certificate | -
 /// tls.private-key | path to TLS server certificate private key | -
 /// tls.private-key-passphrase-name | passphrase name located in secdist's "passphrases" section | -
+/// tls.kernel-offload | hand the established TLS sessions to the kernel TLS (kTLS) where supported | false
+/// tls.session-cache-size | max count of the TLS sessions cached for the resumption, shared by the TLS listeners; the session ticket keys are taken from secdist's "tls_session_ticket_keys" section | 20480
+/// tls.session-timeout | lifetime in seconds of the cached TLS sessions and of the session tickets | 300
 /// handler-defaults.max_url_size | max path/URL size or empty to not limit | 8192
 /// handler-defaults.max_request_size | max size of the whole request | 1024 * 1024
 /// handler-defaults.max_headers_size | max request headers size | 65536
@@ -78,6 +81,7 @@ namespace components {
 /// connection.keepalive_timeout | timeout in seconds to drop connection if there's not data received from it | 600
 /// connection.stream_close_check_delay | delay in microseconds of the start of stream close check routine; do not set if not sure what it is doing | 20ms
 /// shards | how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing | -
+/// thread_per_core | run a shard per task processor of components::SingleThreadedTaskProcessors, a connection and the handlers of its requests stay on the task processor of its shard; `task_processor` is not used | false
 /// middleware-pipeline-builder | name of a component to build a server-wide middleware pipeline | default-server-middleware-pipeline-builder
 ///
 /// @see @ref scripts/docs/en/userver/http_server.md
@@ -0,0 +1,79 @@
+#pragma once
+
+/// @file userver/server/handlers/cpu_profiler.hpp
+/// @brief @copybrief server::handlers::CpuProfiler
+
+#include <map>
+#include <string>
+
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/server/handlers/http_handler_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers
+///
+/// @brief Handler that controls the sampling CPU profiler of the task
+/// processors.
+///
+/// The profiler samples the stacks of the code running on the task processor
+/// workers at the specified frequency of CPU time and aggregates them per
+/// task processor and per name of the root span of the task. The result is
+/// served in the 'folded stacks' format that is accepted by flamegraph.pl
+/// and most of the flamegraph viewers.
+///
+/// The profiler is available on Linux only. The component is not a part of
+/// components::CommonServerComponentList(), append it to the component list
+/// explicitly to enable the profiling of a service.
+///
+/// The component has no service configuration except the
+/// @ref userver_http_handlers "common handler options".
+///
+/// ## Static configuration example:
+///
+/// @snippet components/common_server_component_list_test.cpp  Sample handler cpu profiler component config
+///
+/// ## Schema
+/// Set an URL path argument `command` to one of the following values:
+/// * `enable` - to start the sampling, an optional `frequency` argument sets
+///   the number of samples per second of CPU time of each worker (99 by
+///   default)
+/// * `disable` - to stop the sampling, the collected samples are kept
+/// * `dump` - to get the collected samples in the folded stacks format
+/// * `reset` - to drop the collected samples
+/// * `stat` - to get the sampling frequency and the number of samples
+///
+/// An optional `task_processor` argument limits the command to a single
+/// task processor, all the task processors are affected otherwise.
+
+// clang-format on
+
+class CpuProfiler final : public HttpHandlerBase {
+ public:
+  CpuProfiler(const components::ComponentConfig&,
+              const components::ComponentContext&);
+
+  /// @ingroup userver_component_names
+  /// @brief The default name of server::handlers::CpuProfiler
+  static constexpr std::string_view kName = "handler-cpu-profiler";
+
+  std::string HandleRequestThrow(const http::HttpRequest&,
+                                 request::RequestContext&) const override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  const std::map<std::string, engine::TaskProcessor*> task_processors_;
+};
+
+}  // namespace server::handlers
+
+template <>
+inline constexpr bool components::kHasValidate<server::handlers::CpuProfiler> =
+    true;
+
+USERVER_NAMESPACE_END
@@ -36,13 +36,19 @@ namespace server::handlers {
 /// request_body_size_log_limit | trim request to this size before logging | 512
 /// response_data_size_log_limit | trim responses to this size before logging | 512
 /// max_requests_per_second | integer to limit RPS to this handler | <no limit>
+/// adaptive_concurrency_limit | limits the requests in flight of this handler, the limit follows the latency of the requests (Gradient2 algorithm); options: initial_limit, min_limit, max_limit, tolerance, smoothing, window, long_window | <no limit>
 /// decompress_request | allow decompression of the requests | true
+/// compress_response | compress the responses with gzip or zstd, as negotiated with `Accept-Encoding` of the request | false
+/// response_compression_min_size | do not compress the responses with bodies smaller than this size | 1024
+/// response_compression_level | compression level to use, its meaning depends on the negotiated encoding | 6 for gzip, 3 for zstd
 /// throttling_enabled | allow throttling of the requests by components::Server , for more info see its `max_response_size_in_flight` and `requests_queue_size_threshold` options | true
 /// set-response-server-hostname | set to true to add the `X-YaTaxi-Server-Hostname` header with instance name, set to false to not add the header | <takes the value from components::Server config>
 /// monitor-handler | Overrides the in-code `is_monitor` flag that makes the handler run either on `server.listener` or on `server.listener-monitor` | --
 /// set_tracing_headers | whether to set http tracing headers (X-YaTraceId, X-YaSpanId, X-RequestId) | true
 /// deadline_propagation_enabled | when `false`, disables HTTP handler @ref scripts/docs/en/userver/deadline_propagation.md "deadline propagation" | true
 /// deadline_expired_status_code | the HTTP status code to return if the request @ref scripts/docs/en/userver/deadline_propagation.md "deadline expires" | 498
+/// request_stages_statistics | write the `request-stages` histograms of the time the requests spend in accept, TLS handshake, reading, dispatching, task processor queue, middlewares, handler, response queue and sending; each stage takes a per-CPU histogram | false
+/// request_stages_access_log | append the durations of the request stages in microseconds to the access logs | false
 
 // clang-format on
 class HandlerBase : public components::ComponentBase {
@@ -5,6 +5,7 @@
 #include <variant>
 #include <vector>
 
+#include <userver/congestion_control/adaptive_concurrency_limiter_config.hpp>
 #include <userver/server/handlers/auth/handler_auth_config.hpp>
 #include <userver/server/handlers/fallback_handlers.hpp>
 #include <userver/server/http/http_status.hpp>
@@ -37,13 +38,22 @@ struct HandlerConfig {
   UrlTrailingSlashOption url_trailing_slash{UrlTrailingSlashOption::kDefault};
   std::optional<size_t> max_requests_in_flight;
   std::optional<size_t> max_requests_per_second;
+  std::optional<
+      USERVER_NAMESPACE::congestion_control::AdaptiveConcurrencyLimiterConfig>
+      adaptive_concurrency_limit;
   bool decompress_request{true};
+  bool compress_response{false};
+  size_t response_compression_min_size{1024};
+  std::optional<int> response_compression_level;
   bool throttling_enabled{true};
   bool response_body_stream{false};
+  bool request_body_stream{false};
   std::optional<bool> set_response_server_hostname;
   bool set_tracing_headers{true};
   bool deadline_propagation_enabled{true};
   http::HttpStatus deadline_expired_status_code{498};
+  bool request_stages_statistics{false};
+  bool request_stages_access_log{false};
 };
 
 HandlerConfig ParseHandlerConfigsWithDefaults(
@@ -26,6 +26,10 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace congestion_control {
+class AdaptiveConcurrencyLimiter;
+}  // namespace congestion_control
+
 namespace server::middlewares {
 class HttpMiddlewareBase;
 class HandlerAdapter;
@@ -37,6 +41,7 @@ namespace server::handlers {
 
 class HttpHandlerStatistics;
 class HttpRequestStatistics;
+class HttpRequestStagesStatistics;
 class HttpHandlerMethodStatistics;
 class HttpHandlerStatisticsScope;
 
@@ -87,6 +92,13 @@ class HttpHandlerBase : public HandlerBase {
 
   // For internal use only.
   HttpRequestStatistics& GetRequestStatistics() const;
+
+  // For internal use only, nullptr if the stages statistics are disabled.
+  HttpRequestStagesStatistics* GetRequestStagesStatistics() const;
+
+  // For internal use only, nullptr if the limit is not configured.
+  USERVER_NAMESPACE::congestion_control::AdaptiveConcurrencyLimiter*
+  GetConcurrencyLimiter() const;
   /// @endcond
 
   /// Override it if you need a custom logging level for messages about finish
@@ -212,6 +224,10 @@ class HttpHandlerBase : public HandlerBase {
 
   std::unique_ptr<HttpHandlerStatistics> handler_statistics_;
   std::unique_ptr<HttpRequestStatistics> request_statistics_;
+  std::unique_ptr<HttpRequestStagesStatistics> request_stages_statistics_;
+  std::unique_ptr<USERVER_NAMESPACE::congestion_control::
+                      AdaptiveConcurrencyLimiter>
+      concurrency_limiter_;
 
   bool set_response_server_hostname_;
   bool is_body_streamed_;
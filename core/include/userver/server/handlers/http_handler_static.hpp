@@ -3,13 +3,21 @@
 /// @file userver/server/handlers/http_handler_static.hpp
 /// @brief @copybrief server::handlers::HttpHandlerStatic
 
+#include <memory>
+#include <string>
+
 #include <userver/components/fs_cache.hpp>
 #include <userver/dynamic_config/source.hpp>
 #include <userver/fs/fs_cache_client.hpp>
+#include <userver/rcu/rcu_map.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
+namespace server::middlewares {
+enum class ResponseEncoding;
+}  // namespace server::middlewares
+
 namespace server::handlers {
 
 // clang-format off
@@ -32,6 +40,15 @@ namespace server::handlers {
 /// ------------------ | ----------------------------- | -------------
 /// fs-cache-component | Name of the FsCache component | fs-cache-component
 ///
+/// With `compress_response` the compressed variants of the files are cached,
+/// so each file is compressed once per encoding and per its version in the
+/// FsCache. A precompressed variant found next to the file in the FsCache,
+/// e.g. `app.js.gz` or `app.js.zst`, is sent as is instead.
+///
+/// The responses carry the ETag of the sent variant, a request with a
+/// matching `If-None-Match` gets an empty 304 response. The files of an
+/// FsCache with `use-mmap: true` are sent straight from the mapping.
+///
 /// ## Example usage:
 ///
 /// @snippet samples/static_service/static_service.cpp Static service sample - main
@@ -55,8 +72,20 @@ class HttpHandlerStatic final : public HttpHandlerBase {
   static yaml_config::Schema GetStaticConfigSchema();
 
  private:
+  struct CompressedFile final {
+    // The variant is stale once FsCache replaces the file
+    std::weak_ptr<const fs::FileInfoWithData> source;
+    // Empty if the compressed file is not smaller than the original one
+    std::string data;
+  };
+
+  std::shared_ptr<const CompressedFile> GetCompressedFile(
+      const std::string& path, const fs::FileInfoWithDataConstPtr& file,
+      middlewares::ResponseEncoding encoding) const;
+
   dynamic_config::Source config_;
   const fs::FsCacheClient& storage_;
+  mutable rcu::RcuMap<std::string, const CompressedFile> compressed_files_;
 };
 
 }  // namespace server::handlers
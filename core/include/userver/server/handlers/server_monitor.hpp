@@ -3,6 +3,11 @@
 /// @file userver/server/handlers/server_monitor.hpp
 /// @brief @copybrief server::handlers::ServerMonitor
 
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include <userver/concurrent/variable.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
 #include <userver/utils/statistics/fwd.hpp>
 
@@ -43,6 +48,10 @@ enum class StatsFormat;
 ///   be a JSON dictionary in the form '{"label1":"value1", "label2":"value2"}'.
 /// * path - return metrics on for the following path
 /// * prefix - return metrics whose path starts from the specified prefix.
+/// * delta-consumer - an arbitrary consumer name, return only the metrics that
+///   changed since the previous request with the same name, see
+///   utils::statistics::MetricsDelta. The consumer should always send the same
+///   request. At most 16 distinct consumer names are remembered.
 
 // clang-format on
 class ServerMonitor final : public HttpHandlerBase {
@@ -50,6 +59,8 @@ class ServerMonitor final : public HttpHandlerBase {
   ServerMonitor(const components::ComponentConfig& config,
                 const components::ComponentContext& component_context);
 
+  ~ServerMonitor() override;
+
   /// @ingroup userver_component_names
   /// @brief The default name of server::handlers::ServerMonitor
   static constexpr std::string_view kName = "handler-server-monitor";
@@ -64,11 +75,19 @@ class ServerMonitor final : public HttpHandlerBase {
       const http::HttpRequest& request, request::RequestContext& context,
       const std::string& response_data) const override;
 
+  utils::statistics::MetricsDelta& GetMetricsDelta(
+      const std::string& consumer) const;
+
   utils::statistics::Storage& statistics_storage_;
 
   using CommonLabels = std::unordered_map<std::string, std::string>;
   const CommonLabels common_labels_;
   const std::optional<impl::StatsFormat> default_format_;
+
+  using DeltaConsumers =
+      std::unordered_map<std::string,
+                         std::unique_ptr<utils::statistics::MetricsDelta>>;
+  mutable concurrent::Variable<DeltaConsumers> delta_consumers_;
 };
 
 }  // namespace server::handlers
@@ -32,6 +32,7 @@ class HttpHandlerBase;
 namespace server::http {
 
 class HttpRequestImpl;
+class RequestBodyStream;
 
 /// @brief HTTP Request data
 class HttpRequest final {
@@ -205,6 +206,11 @@ class HttpRequest final {
   /// @return HTTP body.
   const std::string& RequestBody() const;
 
+  /// @brief Returns the stream to read the body in parts, see
+  /// server::http::RequestBodyStream for the `request-body-stream` handler
+  /// option.
+  RequestBodyStream& GetBodyStream() const;
+
   /// @return HTTP headers.
   const HeadersMap& RequestHeaders() const;
 
@@ -0,0 +1,102 @@
+#pragma once
+
+/// @file userver/server/http/http_request_body_stream.hpp
+/// @brief @copybrief server::http::RequestBodyStream
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace compression::zstd {
+class Decompressor;
+}  // namespace compression::zstd
+
+namespace server::http {
+
+/// @brief Reads the body of an HTTP request in parts, as they arrive from the
+/// client.
+///
+/// For the handlers with `request-body-stream: true` in the static config
+/// the handler is started as soon as the HTTP/1.1 request headers are
+/// received, and the body is not stored in HttpRequest::RequestBody().
+/// While the handler does not read the parts, the server does not read the
+/// connection, so a large upload never sits in memory as a whole.
+///
+/// The `max_request_size` limit still applies, the body is not parsed as
+/// `multipart/form-data` or as arguments. `Content-Encoding: zstd` bodies are
+/// decompressed part by part if the `decompress_request` option is on.
+///
+/// For the other requests, and for HTTP/2, the whole body is returned as the
+/// only part.
+///
+/// @snippet core/src/server/http/http_request_body_stream_test.cpp  Sample
+class RequestBodyStream final {
+ public:
+  using Queue = concurrent::StringStreamQueue;
+
+  RequestBodyStream(RequestBodyStream&&) = delete;
+  RequestBodyStream& operator=(RequestBodyStream&&) = delete;
+  ~RequestBodyStream();
+
+  /// @brief Reads the next part of the body into `output`. Any previous data
+  /// in `output` is dropped.
+  /// @returns false after the last part of the body
+  /// @throws handlers::RequestParseError if the client sent an incomplete
+  /// body or the body failed to decompress
+  /// @throws handlers::ClientError with HandlerErrorCode::kPayloadTooLarge if
+  /// the body exceeds the `max_request_size` of the handler
+  /// @throws engine::WaitInterruptedException if the deadline is reached or
+  /// the task is cancelled
+  bool ReadChunk(std::string& output, engine::Deadline deadline = {});
+
+  /// Returns true if the body is read from the connection while the handler
+  /// runs, false if the body was received before the handler started.
+  bool IsStreamed() const noexcept { return is_streamed_; }
+
+  /// @brief Decompresses the parts that are not read yet with zstd, no more
+  /// than `max_size` bytes in total.
+  ///
+  /// Called by the decompression middleware for the streamed bodies.
+  /// @throws compression::DecompressionError
+  void SetZstdDecompression(std::size_t max_size);
+
+  /// @cond
+  // The receiving side, used by the server internals
+  enum class Result { kIncomplete, kComplete, kTooLarge };
+
+  // Bytes of the body buffered between the connection and the handler
+  static constexpr std::size_t kBufferSize = 256 * 1024;
+
+  explicit RequestBodyStream(const std::string& buffered_body);
+
+  Queue::Producer StartStreaming();
+
+  // Must be called before the producer is destroyed
+  void SetResult(Result result) noexcept;
+
+  // The handler is done, the rest of the body is not needed
+  void Close() noexcept;
+  /// @endcond
+
+ private:
+  [[noreturn]] void ThrowIncomplete(engine::Deadline deadline) const;
+  bool Decompress(std::string& output);
+
+  const std::string& buffered_body_;
+  bool is_streamed_{false};
+  bool is_buffered_body_read_{false};
+  std::optional<Queue::Consumer> consumer_;
+  std::atomic<Result> result_{Result::kIncomplete};
+  std::unique_ptr<compression::zstd::Decompressor> decompressor_;
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
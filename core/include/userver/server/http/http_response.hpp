@@ -4,8 +4,12 @@
 /// @brief @copybrief server::http::HttpResponse
 
 #include <chrono>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <userver/concurrent/queue.hpp>
 #include <userver/engine/single_consumer_event.hpp>
@@ -30,6 +34,7 @@ void OutputHeader(USERVER_NAMESPACE::http::headers::HeadersString& header,
 }  // namespace impl
 
 class HttpRequestImpl;
+class Http2Session;
 
 /// @brief HTTP Response data
 class HttpResponse final : public request::ResponseBase {
@@ -113,6 +118,13 @@ class HttpResponse final : public request::ResponseBase {
   bool HasHeader(const USERVER_NAMESPACE::http::headers::PredefinedHeader&
                      header_name) const;
 
+  /// @brief Sets the response body to `data` owned by `owner`, e.g. to a file
+  /// of fs::FsCacheClient, to send it without copying.
+  ///
+  /// The body is not visible through GetData(), and a non-empty SetData()
+  /// takes precedence over it.
+  void SetSharedData(std::shared_ptr<const void> owner, std::string_view data);
+
   /// @return List of cookies names.
   CookiesMapKeys GetCookieNames() const;
 
@@ -152,6 +164,18 @@ class HttpResponse final : public request::ResponseBase {
       engine::io::RwBase& socket,
       USERVER_NAMESPACE::http::headers::HeadersString& header);
 
+  std::string_view GetBodyToSend() const;
+
+  friend class Http2Session;
+
+  // HTTP/2 frames the body on its own, so a streamed body is read to the end
+  void ReadStreamedBodyToData();
+
+  // Fills the HTTP/2 header block, starting with :status, and returns the body
+  // to send
+  std::string_view PrepareHttp2Response(
+      std::vector<std::pair<std::string, std::string>>& headers);
+
   const HttpRequestImpl& request_;
   HttpStatus status_ = HttpStatus::kOk;
   HeadersMap headers_;
@@ -161,6 +185,8 @@ class HttpResponse final : public request::ResponseBase {
       engine::SingleConsumerEvent::NoAutoReset()};
   std::optional<Queue::Consumer> body_stream_;
   std::optional<Queue::Producer> body_stream_producer_;
+  std::shared_ptr<const void> shared_data_owner_;
+  std::string_view shared_data_;
 };
 
 void SetThrottleReason(http::HttpResponse& http_response,
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <memory>
 #include <string>
 
+#include <userver/compression/zstd.hpp>
 #include <userver/server/http/http_response.hpp>
 #include <userver/server/request/response_base.hpp>
 
@@ -16,6 +18,7 @@ namespace server::http {
 class ResponseBodyStream final {
  public:
   ResponseBodyStream(ResponseBodyStream&&) = default;
+  ~ResponseBodyStream();
 
   // Send a chunk of response data. It may NOT generate
   // exactly one HTTP chunk per call to PushBodyChunk().
@@ -31,6 +34,14 @@ class ResponseBodyStream final {
 
   void SetStatusCode(HttpStatus status);
 
+  /// @brief Compresses the chunks pushed after the call with zstd and sets
+  /// the `Content-Encoding: zstd` header.
+  ///
+  /// Each chunk is flushed, so the client is able to decompress it as soon as
+  /// it arrives. Must be called before SetEndOfHeaders() and only if the
+  /// `Accept-Encoding` header of the request allows zstd.
+  void SetZstdCompression(int level);
+
  private:
   friend class server::handlers::HttpHandlerBase;
 
@@ -41,6 +52,7 @@ class ResponseBodyStream final {
   bool headers_ended_{false};
   HttpResponse::Queue::Producer queue_producer_;
   server::http::HttpResponse& http_response_;
+  std::unique_ptr<compression::zstd::Compressor> compressor_;
 };
 
 }  // namespace server::http
@@ -22,6 +22,8 @@ inline constexpr std::string_view kDeadlinePropagation =
     "userver-deadline-propagation-middleware";
 inline constexpr std::string_view kBaggage = "userver-baggage-middleware";
 inline constexpr std::string_view kAuth = "userver-auth-middleware";
+inline constexpr std::string_view kCompression =
+    "userver-compression-middleware";
 inline constexpr std::string_view kDecompression =
     "userver-decompression-middleware";
 inline constexpr std::string_view kExceptionsHandling =
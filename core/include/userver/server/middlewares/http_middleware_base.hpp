@@ -4,8 +4,10 @@
 /// @brief Base classes for implementing custom middlewares
 
 #include <memory>
+#include <string>
 
 #include <userver/components/component_base.hpp>
+#include <userver/utils/meta_light.hpp>
 #include <userver/yaml_config/schema.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
@@ -31,6 +33,12 @@ namespace middlewares {
 /// @ingroup userver_middlewares userver_base_classes
 ///
 /// @brief Base class for a http middleware
+///
+/// The pipeline of a handler is built once at the handler start, the
+/// middlewares that have nothing to do for the handler are left out of it.
+/// With `middlewares.profile: true` in the static config of the handler,
+/// the time of every middleware is measured with a tracing::ScopeTime named
+/// `http_middleware_<name>`. That time includes the rest of the pipeline.
 class HttpMiddlewareBase {
  public:
   HttpMiddlewareBase();
@@ -47,7 +55,12 @@ class HttpMiddlewareBase {
  private:
   friend class handlers::HttpHandlerBase;
 
+  void Invoke(http::HttpRequest& request,
+              request::RequestContext& context) const;
+
   std::unique_ptr<HttpMiddlewareBase> next_{nullptr};
+  // the name of the scope time of the middleware, empty if not profiled
+  std::string scope_time_name_;
 };
 
 /// @ingroup userver_middlewares userver_base_classes
@@ -58,6 +71,8 @@ class HttpMiddlewareFactoryBase : public components::ComponentBase {
   HttpMiddlewareFactoryBase(const components::ComponentConfig&,
                             const components::ComponentContext&);
 
+  /// @brief Validates the config and creates an instance of a middleware,
+  /// returns nullptr if the middleware is not applicable to the handler.
   std::unique_ptr<HttpMiddlewareBase> CreateChecked(
       const handlers::HttpHandlerBase& handler,
       yaml_config::YamlConfig middleware_config) const;
@@ -69,15 +84,36 @@ class HttpMiddlewareFactoryBase : public components::ComponentBase {
     return yaml_config::Schema::EmptyObject();
   }
 
+  /// @brief Override this method to leave the middleware out of the
+  /// pipeline of a handler it has nothing to do for. Called once, when the
+  /// pipeline of the handler is built
+  virtual bool IsApplicable(
+      const handlers::HttpHandlerBase&,
+      const yaml_config::YamlConfig& /*middleware_config*/) const {
+    return true;
+  }
+
   /// @brief Override this method to create an instance of a middleware
   virtual std::unique_ptr<HttpMiddlewareBase> Create(
       const handlers::HttpHandlerBase&,
       yaml_config::YamlConfig middleware_config) const = 0;
 };
 
+namespace impl {
+
+template <typename Middleware>
+using HasIsApplicable = decltype(Middleware::IsApplicable(
+    std::declval<const handlers::HttpHandlerBase&>()));
+
+}  // namespace impl
+
 /// @ingroup userver_middlewares
 ///
 /// @brief A short-cut for defining a middleware-factory
+///
+/// The middleware is left out of the pipeline of a handler if it has a
+/// `static bool IsApplicable(const handlers::HttpHandlerBase&)` that returns
+/// false for the handler.
 template <typename Middleware>
 class SimpleHttpMiddlewareFactory final : public HttpMiddlewareFactoryBase {
  public:
@@ -86,6 +122,15 @@ class SimpleHttpMiddlewareFactory final : public HttpMiddlewareFactoryBase {
   using HttpMiddlewareFactoryBase::HttpMiddlewareFactoryBase;
 
  private:
+  bool IsApplicable(const handlers::HttpHandlerBase& handler,
+                    const yaml_config::YamlConfig&) const override {
+    if constexpr (meta::kIsDetected<impl::HasIsApplicable, Middleware>) {
+      return Middleware::IsApplicable(handler);
+    } else {
+      return true;
+    }
+  }
+
   std::unique_ptr<HttpMiddlewareBase> Create(
       const handlers::HttpHandlerBase& handler,
       yaml_config::YamlConfig) const override {
@@ -36,9 +36,15 @@ class RequestBase {
 
   virtual const std::string& GetRequestPath() const = 0;
 
+  void SetConnectionTimes(std::chrono::steady_clock::time_point accept_time,
+                          std::chrono::steady_clock::time_point start_time,
+                          std::chrono::steady_clock::time_point ready_time);
+  void SetParseFinishTime();
   void SetTaskCreateTime();
   void SetTaskStartTime();
   void SetResponseNotifyTime();
+  void SetHandlerStartTime();
+  void SetHandlerFinishTime();
   void SetResponseNotifyTime(std::chrono::steady_clock::time_point now);
   void SetStartSendResponseTime();
   void SetFinishSendResponseTime();
@@ -56,11 +62,24 @@ class RequestBase {
  protected:
   // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
   std::chrono::steady_clock::time_point start_time_;
+  // Set for the first request of a connection only
+  // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+  std::chrono::steady_clock::time_point connection_accept_time_;
+  // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+  std::chrono::steady_clock::time_point connection_start_time_;
+  // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+  std::chrono::steady_clock::time_point connection_ready_time_;
+  // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+  std::chrono::steady_clock::time_point parse_finish_time_;
   // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
   std::chrono::steady_clock::time_point task_create_time_;
   // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
   std::chrono::steady_clock::time_point task_start_time_;
   // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+  std::chrono::steady_clock::time_point handler_start_time_;
+  // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+  std::chrono::steady_clock::time_point handler_finish_time_;
+  // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
   std::chrono::steady_clock::time_point response_notify_time_;
   // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
   std::chrono::steady_clock::time_point start_send_response_time_;
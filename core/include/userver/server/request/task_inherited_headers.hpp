@@ -5,6 +5,8 @@
 /// TaskInheritedVariable.
 
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <boost/range/iterator_range.hpp>
 
@@ -24,6 +26,15 @@ GetTaskInheritedHeaders();
 /// @brief Set a headers that is handled by the current task hierarchy.
 void SetTaskInheritedHeaders(HeadersToPropagate headers);
 
+/// @brief Set a headers that is handled by the current task hierarchy
+/// without building HeadersToPropagate.
+///
+/// HeadersToPropagate are built on the first GetTaskInheritedHeaders() call,
+/// e.g. by an outgoing request, and cached. For duplicate names the first
+/// header wins, as in HeadersToPropagate::emplace.
+void SetTaskInheritedRawHeaders(
+    std::vector<std::pair<std::string, std::string>> headers);
+
 }  // namespace server::request
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,110 @@
+#pragma once
+
+/// @file userver/server/websocket/broadcast_group.hpp
+/// @brief @copybrief server::websocket::BroadcastGroup
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <userver/server/websocket/server.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket {
+
+/// @brief What to do with a message for a member whose send queue is full
+enum class SlowConsumerPolicy {
+  kDropNewest,  ///< the new message is dropped
+  kDropOldest,  ///< the oldest queued message is dropped
+  kClose,  ///< the connection is closed with CloseStatus::kPolicyViolation
+};
+
+struct BroadcastGroupConfig final {
+  /// Max messages waiting to be sent to a single member
+  std::size_t max_queue_size{64};
+
+  /// What to do with a member that does not keep up with the messages
+  SlowConsumerPolicy slow_consumer_policy{SlowConsumerPolicy::kDropOldest};
+};
+
+/// @brief Group of WebSocket connections to send the same messages to.
+///
+/// A message is serialized into a PreparedMessage once and its frames are
+/// shared by the send queues of all the members. Each member has a task
+/// that writes its queue to the connection, so a slow client does not delay
+/// the rest of the group; once its queue is full the SlowConsumerPolicy is
+/// applied.
+///
+/// Metrics of the group are written by DumpMetric() and should be
+/// registered by the owner of the group.
+///
+/// ## Example usage:
+/// @code
+/// void Handle(server::websocket::WebSocketConnection& websocket,
+///             server::request::RequestContext&) const override {
+///   const auto membership = group_.Join(websocket);
+///   server::websocket::Message message;
+///   while (!message.close_status) websocket.Recv(message);
+/// }
+///
+/// // from any other task
+/// group_.Broadcast(handler.PrepareMessage(update, /*is_text=*/true));
+/// @endcode
+class BroadcastGroup final {
+  struct Impl;
+  struct Member;
+
+ public:
+  /// @brief RAII membership of a connection in the group, leaves the group
+  /// and stops sending to the connection in the destructor.
+  /// @warning Must not outlive the connection.
+  class Membership final {
+   public:
+    Membership(Membership&&) noexcept;
+    Membership& operator=(Membership&&) noexcept;
+    ~Membership();
+
+   private:
+    friend class BroadcastGroup;
+
+    Membership(std::shared_ptr<Impl> group, std::uint64_t id,
+               std::shared_ptr<Member> member);
+
+    void Leave() noexcept;
+
+    std::shared_ptr<Impl> group_;
+    std::uint64_t id_{0};
+    std::shared_ptr<Member> member_;
+  };
+
+  explicit BroadcastGroup(const BroadcastGroupConfig& config = {});
+  ~BroadcastGroup();
+
+  BroadcastGroup(BroadcastGroup&&) = delete;
+  BroadcastGroup& operator=(BroadcastGroup&&) = delete;
+
+  /// @brief Adds the connection to the group, the messages are sent to it
+  /// by a task started on the current task processor.
+  /// @note The messages are sent interleaved with the messages sent to the
+  /// connection directly.
+  [[nodiscard]] Membership Join(WebSocketConnection& connection);
+
+  /// @brief Enqueues the message to every member, does not wait for the
+  /// messages to be sent.
+  void Broadcast(const PreparedMessage& message);
+
+  /// @brief The number of connections in the group
+  std::size_t GetMembersCount() const;
+
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const BroadcastGroup& group);
+
+ private:
+  std::shared_ptr<Impl> impl_;
+};
+
+}  // namespace server::websocket
+
+USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <optional>
+#include <string_view>
 
 #include <userver/engine/io/socket.hpp>
 #include <userver/server/http/http_request.hpp>
@@ -45,9 +46,28 @@ struct Message {
 
 class WebSocketConnectionImpl;
 
+/// @brief permessage-deflate extension settings, see
+/// https://datatracker.ietf.org/doc/html/rfc7692
+struct DeflateConfig final {
+  /// Agree on the extension if the client offers it
+  bool enabled = false;
+  /// Do not keep the compression context between the sent messages
+  bool server_no_context_takeover = false;
+  /// Ask the client not to keep the compression context between its messages
+  bool client_no_context_takeover = false;
+  /// zlib compression level from 1 (fastest) to 9 (best)
+  int compression_level = 1;
+  /// The smaller messages are sent uncompressed
+  unsigned min_compress_size = 256;
+};
+
+DeflateConfig Parse(const yaml_config::YamlConfig&,
+                    formats::parse::To<DeflateConfig>);
+
 struct Config final {
   unsigned max_remote_payload = 65536;
   unsigned fragment_size = 65536;  // 0 - do not fragment
+  DeflateConfig deflate;
 };
 
 Config Parse(const yaml_config::YamlConfig&, formats::parse::To<Config>);
@@ -59,6 +79,26 @@ struct Statistics final {
   std::atomic<int64_t> bytes_recv{0};
 };
 
+/// @brief A message serialized into WebSocket frames once, to be sent to many
+/// connections without re-encoding, see WebSocketConnection::SendPrepared().
+///
+/// If permessage-deflate is enabled in the config, the message is also
+/// compressed once and the compressed frames are sent to the connections that
+/// agreed on the extension. Copying is cheap, the frames are shared.
+class PreparedMessage final {
+ public:
+  PreparedMessage(std::string_view data, bool is_text, const Config& config);
+
+  /// @brief The size of the message payload before compression
+  std::size_t GetPayloadSize() const noexcept;
+
+ private:
+  friend class WebSocketConnectionImpl;
+
+  struct Frames;
+  std::shared_ptr<const Frames> frames_;
+};
+
 /// @brief Main class for Websocket connection
 class WebSocketConnection {
  public:
@@ -91,6 +131,12 @@ class WebSocketConnection {
   virtual void Send(const Message& message) = 0;
   virtual void SendText(std::string_view message) = 0;
 
+  /// @brief Send a message serialized in advance, e.g. the same message to
+  /// many connections.
+  /// @throws engine::io::IoException in case of socket errors
+  /// @note Has the same thread-safety guarantees as Send()
+  virtual void SendPrepared(const PreparedMessage& message) = 0;
+
   template <typename ContiguousContainer>
   void SendBinary(const ContiguousContainer& message) {
     static_assert(sizeof(typename ContiguousContainer::value_type) == 1,
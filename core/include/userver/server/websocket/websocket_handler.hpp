@@ -28,6 +28,11 @@ namespace server::websocket {
 /// status-codes-log-level | map of "status": log_level items to override span log level for specific status codes | {}
 /// max-remote-payload | max remote payload size | 65536
 /// fragment-size | max output fragment size | 65536
+/// permessage-deflate.enabled | agree on the permessage-deflate extension if the client offers it | false
+/// permessage-deflate.server-no-context-takeover | do not keep the compression context between the sent messages | false
+/// permessage-deflate.client-no-context-takeover | ask the client not to keep the compression context between its messages | false
+/// permessage-deflate.compression-level | zlib compression level from 1 (fastest) to 9 (best) | 1
+/// permessage-deflate.min-compress-size | the smaller messages are sent uncompressed | 256
 ///
 /// ## Example usage:
 ///
@@ -51,6 +56,10 @@ class WebsocketHandlerBase : public server::handlers::HttpHandlerBase {
     return true;
   }
 
+  /// @brief Serializes the message once to send it to many connections with
+  /// WebSocketConnection::SendPrepared(), according to the handler settings.
+  PreparedMessage PrepareMessage(std::string_view data, bool is_text) const;
+
   /// @cond
   void WriteMetrics(utils::statistics::Writer& writer) const;
 
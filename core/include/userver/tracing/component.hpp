@@ -5,6 +5,7 @@
 
 #include <userver/components/component_fwd.hpp>
 #include <userver/components/raw_component_base.hpp>
+#include <userver/utils/statistics/entry.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -26,6 +27,21 @@ namespace components {
 /// ---- | ----------- | -------------
 /// service-name | name of the service to write in traces | ''
 /// tracer | type of the tracer to trace, currently supported only 'native' | 'native'
+/// tail-sampling | if exists, the span records of each trace are kept in memory until the root span finishes, and the whole trace is written only if it is slow, has an error or wins a random sample | -
+///
+/// ### tail-sampling options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// latency-threshold | the traces with the root span at least that long are kept | 500ms
+/// sample-probability | the share of the fast traces without errors to keep, in [0, 1] | 0.01
+/// max-spans-per-trace | a trace with more spans is written out as is | 256
+/// max-bytes-per-trace | a trace with larger records is written out as is | 262144
+/// max-total-bytes | while the buffered traces use that much memory, the new traces are written out as is | 67108864
+///
+/// A trace is kept if any of its spans has the `error` tag set to true or
+/// has a level of error or higher. The spans that finish after the root span
+/// follow its decision. The statistics are reported under
+/// `tracing.tail-sampling`.
 ///
 /// ## Static configuration example:
 ///
@@ -39,8 +55,12 @@ class Tracer final : public RawComponentBase {
   static constexpr std::string_view kName = "tracer";
 
   Tracer(const ComponentConfig& config, const ComponentContext& context);
+  ~Tracer() override;
 
   static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  utils::statistics::Entry statistics_holder_;
 };
 
 template <>
@@ -8,6 +8,7 @@
 #include <utility>
 
 #include <userver/engine/async.hpp>
+#include <userver/engine/deadline.hpp>
 #include <userver/utils/fast_pimpl.hpp>
 #include <userver/utils/lazy_prvalue.hpp>
 
@@ -41,11 +42,26 @@ struct SpanWrapCall {
 
   struct Impl;
 
-  static constexpr std::size_t kImplSize = 4264;
+  static constexpr std::size_t kImplSize = 4416;
   static constexpr std::size_t kImplAlign = 8;
   utils::FastPimpl<Impl, kImplSize, kImplAlign> pimpl_;
 };
 
+// Keeps the tasks started within the scope from inheriting the request
+// deadline of the current task, which orders the tasks in the task queues with
+// `earliest-deadline-first`.
+class [[nodiscard]] RequestDeadlineBlocker final {
+ public:
+  RequestDeadlineBlocker() noexcept;
+
+  RequestDeadlineBlocker(RequestDeadlineBlocker&&) = delete;
+  RequestDeadlineBlocker& operator=(RequestDeadlineBlocker&&) = delete;
+  ~RequestDeadlineBlocker();
+
+ private:
+  engine::Deadline old_deadline_;
+};
+
 // Note: 'name' must outlive the result of this function
 inline auto SpanLazyPrvalue(std::string&& name) {
   return utils::LazyPrvalue([&name] {
@@ -94,6 +110,13 @@ inline auto SpanLazyPrvalue(std::string&& name) {
 ///   the function is guaranteed to start regardless of engine::TaskProcessor
 ///   load limits
 ///
+/// By engine::TaskBase::Priority:
+///
+/// * By default, tasks have the normal priority class.
+/// * `utils::Async` and `engine::AsyncNoSpan` overloads that accept
+///   engine::Task::Priority start high priority or background tasks. The class
+///   only matters on task processors with `task-queue: priority`.
+///
 /// By tracing::Span:
 ///
 /// * Functions from `utils::*Async*` family (which you should use by default)
@@ -463,10 +486,51 @@ template <typename Function, typename... Args>
 /// @param f Function to execute asynchronously
 /// @param args Arguments to pass to the function
 /// @returns engine::TaskWithResult
+/// @overload
+/// @ingroup userver_concurrency
+///
+/// The task is scheduled with the specified priority class, see
+/// engine::TaskBase::Priority.
+///
+/// @param task_processor Task processor to run on
+/// @param name Name of the task to show in logs
+/// @param priority Priority class of the task
+/// @param f Function to execute asynchronously
+/// @param args Arguments to pass to the function
+/// @returns engine::TaskWithResult
+template <typename Function, typename... Args>
+[[nodiscard]] auto Async(engine::TaskProcessor& task_processor,
+                         std::string name, engine::Task::Priority priority,
+                         Function&& f, Args&&... args) {
+  return engine::AsyncNoSpan(
+      task_processor, priority, impl::SpanLazyPrvalue(std::move(name)),
+      std::forward<Function>(f), std::forward<Args>(args)...);
+}
+
+/// @overload
+/// @ingroup userver_concurrency
+///
+/// The task is scheduled with the specified priority class, see
+/// engine::TaskBase::Priority.
+///
+/// @param name Name of the task to show in logs
+/// @param priority Priority class of the task
+/// @param f Function to execute asynchronously
+/// @param args Arguments to pass to the function
+/// @returns engine::TaskWithResult
+template <typename Function, typename... Args>
+[[nodiscard]] auto Async(std::string name, engine::Task::Priority priority,
+                         Function&& f, Args&&... args) {
+  return utils::Async(engine::current_task::GetTaskProcessor(),
+                      std::move(name), priority, std::forward<Function>(f),
+                      std::forward<Args>(args)...);
+}
+
 template <typename Function, typename... Args>
 [[nodiscard]] auto AsyncBackground(std::string name,
                                    engine::TaskProcessor& task_processor,
                                    Function&& f, Args&&... args) {
+  const impl::RequestDeadlineBlocker request_deadline_blocker;
   return engine::AsyncNoSpan(
       task_processor, utils::LazyPrvalue([&] {
         return impl::SpanWrapCall(std::move(name),
@@ -492,6 +556,7 @@ template <typename Function, typename... Args>
 [[nodiscard]] auto CriticalAsyncBackground(
     std::string name, engine::TaskProcessor& task_processor, Function&& f,
     Args&&... args) {
+  const impl::RequestDeadlineBlocker request_deadline_blocker;
   return engine::CriticalAsyncNoSpan(
       task_processor, utils::LazyPrvalue([&] {
         return impl::SpanWrapCall(std::move(name),
@@ -500,6 +565,58 @@ template <typename Function, typename... Args>
       std::forward<Function>(f), std::forward<Args>(args)...);
 }
 
+/// @ingroup userver_concurrency
+///
+/// @brief Starts `count` asynchronous tasks running `f(index)`, index in
+/// `[0, count)`.
+///
+/// Behaves like `count` calls to utils::Async, each task gets its own
+/// tracing::Span with the specified name and inherits all
+/// engine::TaskInheritedVariable instances from the current task. But the tasks
+/// are allocated at once and are pushed into the task queue at once, which
+/// makes fan-outs to tens and hundreds of subtasks cheaper.
+///
+/// @code
+/// auto tasks = utils::AsyncBatch("fetch", keys.size(), [&keys](std::size_t i) {
+///   return Fetch(keys[i]);
+/// });
+/// auto values = engine::GetAll(tasks);
+/// @endcode
+///
+/// @param task_processor Task processor to run on
+/// @param name Name of the tasks to show in logs
+/// @param count Number of the tasks to start
+/// @param f Function to execute asynchronously, copied into each of the tasks
+/// @returns std::vector of engine::TaskWithResult, to be awaited with
+/// engine::WaitAllChecked or engine::GetAll
+template <typename Function>
+[[nodiscard]] auto AsyncBatch(engine::TaskProcessor& task_processor,
+                              const std::string& name, std::size_t count,
+                              const Function& f) {
+  using WrappedCallType =
+      utils::impl::WrappedCallImplType<decltype(impl::SpanLazyPrvalue("")),
+                                       const Function&, std::size_t>;
+  return engine::impl::MakeTaskBatchWithResult<engine::TaskWithResult,
+                                               WrappedCallType>(
+      task_processor, engine::Task::Importance::kNormal, {}, count,
+      [&name, &f](std::byte* storage, std::size_t index) -> WrappedCallType& {
+        std::string task_name = name;
+        return utils::impl::PlacementNewWrapCall(
+            storage, impl::SpanLazyPrvalue(std::move(task_name)), f, index);
+      });
+}
+
+/// @overload
+/// @ingroup userver_concurrency
+///
+/// The tasks are started on the current engine::TaskProcessor.
+template <typename Function>
+[[nodiscard]] auto AsyncBatch(const std::string& name, std::size_t count,
+                              const Function& f) {
+  return utils::AsyncBatch(engine::current_task::GetTaskProcessor(), name,
+                           count, f);
+}
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,87 @@
+#pragma once
+
+/// @file userver/utils/statistics/hdr_histogram.hpp
+/// @brief @copybrief utils::statistics::HdrHistogram
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace impl::hdr_histogram {
+struct CounterLine;
+}  // namespace impl::hdr_histogram
+
+/// @brief A histogram with log-linear ("HDR") buckets and per-CPU counters.
+///
+/// Each power of two between `lowest_bound` and `highest_bound` is split into
+/// `2^precision_bits` buckets of equal width, so the relative error of any
+/// value is below `2^-precision_bits`. The bucket of a value is computed from
+/// the bits of its `double` representation in O(1), and the counters are
+/// striped by the current CPU, so Account() is lock-free and does not bounce
+/// cache lines between the CPUs.
+///
+/// The semantics of the buckets are the same as in
+/// utils::statistics::Histogram: values on the bucket borders fall into the
+/// lower bucket, values that are not greater than the first bucket bound
+/// (including zero and negative values) fall into the first bucket, and
+/// values greater than the last bucket bound fall into the "infinity" bucket.
+/// The given bounds are rounded up to the nearest bucket borders.
+///
+/// HdrHistogram is written to utils::statistics::Writer as a histogram
+/// metric. The counters of all CPUs are summed up on each write, use
+/// @ref Collect for custom processing.
+///
+/// Each instance allocates about `8 * (bucket count + 1) * N_CORES` bytes,
+/// use it only for the hot metrics. Solomon accepts at most 50 buckets, e.g.
+/// `precision_bits = 2` covers a range of `2^12`.
+///
+/// Usage example:
+/// @snippet utils/statistics/hdr_histogram_test.cpp  sample
+class HdrHistogram final {
+ public:
+  /// @param lowest_bound the upper bound of the first bucket, positive
+  /// @param highest_bound the upper bound of the last bucket before "infinity"
+  /// @param precision_bits log2 of the buckets count per a power of two,
+  /// at most 10
+  HdrHistogram(double lowest_bound, double highest_bound,
+               std::size_t precision_bits);
+
+  HdrHistogram(HdrHistogram&&) noexcept;
+  HdrHistogram& operator=(HdrHistogram&&) noexcept;
+  ~HdrHistogram();
+
+  /// Atomically increment the bucket corresponding to the given value.
+  void Account(double value, std::uint64_t count = 1) noexcept;
+
+  /// Sums up the counters of all CPUs.
+  Histogram Collect() const;
+
+  /// Returns the number of "normal" (non-"infinity") buckets.
+  std::size_t GetBucketCount() const noexcept;
+
+  /// Atomically reset all counters to zero.
+  friend void ResetMetric(HdrHistogram& histogram) noexcept;
+
+ private:
+  std::size_t shift_;
+  std::uint64_t lowest_key_;
+  std::size_t lines_per_shard_;
+  std::size_t shard_count_;
+  std::vector<double> upper_bounds_;
+  std::unique_ptr<impl::hdr_histogram::CounterLine[]> lines_;
+};
+
+/// Metric serialization support for HdrHistogram.
+void DumpMetric(Writer& writer, const HdrHistogram& histogram);
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
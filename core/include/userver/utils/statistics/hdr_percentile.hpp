@@ -0,0 +1,165 @@
+#pragma once
+
+/// @file userver/utils/statistics/hdr_percentile.hpp
+/// @brief @copybrief utils::statistics::HdrPercentile
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+
+#include <userver/utils/statistics/percentile.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+/// @brief A compact equivalent of utils::statistics::Percentile with
+/// log-linear ("HDR") buckets.
+///
+/// The values below `2^PrecisionBits` are counted exactly, each next power of
+/// two is split into `2^(PrecisionBits - 1)` buckets of equal width, so the
+/// relative error of a bigger value is below `2^(1 - PrecisionBits)`. The
+/// values of `2^MaxValueBits` and above fall into the last bucket.
+///
+/// For example, `HdrPercentile<6, 22>` counts the timings in milliseconds up to
+/// 70 minutes with an error below 3.2% in 576 buckets, while
+/// `Percentile<2048, std::uint32_t, 120>` needs 2168 buckets to count them
+/// exactly up to 2 seconds and with 0.5 second steps up to a minute.
+///
+/// GetPercentile() returns the biggest value of the found bucket. The type is
+/// safe to read/write concurrently from different threads/coroutines.
+template <std::size_t PrecisionBits, std::size_t MaxValueBits,
+          typename Counter = std::uint32_t>
+class HdrPercentile final {
+  static_assert(PrecisionBits >= 1 && PrecisionBits < MaxValueBits);
+  static_assert(MaxValueBits < sizeof(std::size_t) * 8);
+  static_assert(std::atomic<Counter>::is_always_lock_free,
+                "`std::atomic<Counter>` is not lock-free. Please choose some "
+                "other `Counter` type");
+
+  static constexpr std::size_t kExactValues = std::size_t{1} << PrecisionBits;
+  static constexpr std::size_t kSubBuckets = kExactValues / 2;
+
+ public:
+  /// The total count of the buckets
+  static constexpr std::size_t kBuckets =
+      kExactValues + (MaxValueBits - PrecisionBits) * kSubBuckets;
+
+  HdrPercentile() noexcept {
+    for (auto& value : values_) value.store(0, std::memory_order_relaxed);
+    count_.store(0, std::memory_order_release);
+  }
+
+  HdrPercentile(const HdrPercentile& other) noexcept { *this = other; }
+
+  HdrPercentile& operator=(const HdrPercentile& rhs) noexcept {
+    if (this == &rhs) return *this;
+
+    std::size_t sum = 0;
+    for (std::size_t i = 0; i < values_.size(); ++i) {
+      const auto value = rhs.values_[i].load(std::memory_order_relaxed);
+      values_[i].store(value, std::memory_order_relaxed);
+      sum += value;
+    }
+    count_ = sum;
+    return *this;
+  }
+
+  /// @brief Account for another value.
+  ///
+  /// `1` is added to the bucket corresponding to `value`
+  void Account(std::size_t value) noexcept {
+    values_[ValueToBucket(value)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_release);
+  }
+
+  /// @brief Get X percentile - min value P so that total number
+  /// of elements in buckets is no less than X percent.
+  ///
+  /// @param percent - value in [0..100] - requested percentile.
+  /// If outside of 100, then returns last bucket that has any element in it.
+  std::size_t GetPercentile(double percent) const {
+    if (count_ == 0) return 0;
+
+    std::size_t sum = 0;
+    std::size_t want_sum = count_.load(std::memory_order_acquire) * percent;
+    std::size_t max_value = 0;
+    for (std::size_t i = 0; i < values_.size(); ++i) {
+      const auto value = values_[i].load(std::memory_order_relaxed);
+      sum += value;
+      if (sum * 100 > want_sum) return BucketToValue(i);
+
+      if (value) max_value = BucketToValue(i);
+    }
+    return max_value;
+  }
+
+  template <class Duration = std::chrono::seconds>
+  void Add(const HdrPercentile& other,
+           [[maybe_unused]] Duration this_epoch_duration = Duration(),
+           [[maybe_unused]] Duration before_this_epoch_duration = Duration()) {
+    std::size_t sum = 0;
+    for (std::size_t i = 0; i < values_.size(); ++i) {
+      const auto value = other.values_[i].load(std::memory_order_relaxed);
+      if (!value) continue;
+      sum += value;
+      values_[i].fetch_add(value, std::memory_order_relaxed);
+    }
+    count_.fetch_add(sum, std::memory_order_release);
+  }
+
+  /// @brief Zero out all the buckets and total number of elements.
+  void Reset() noexcept {
+    for (auto& value : values_) value.store(0, std::memory_order_relaxed);
+    count_ = 0;
+  }
+
+  /// @brief Total number of elements
+  Counter Count() const noexcept { return count_; }
+
+ private:
+  static std::size_t ValueToBucket(std::size_t value) noexcept {
+    if (value < kExactValues) return value;
+    if (value >> MaxValueBits) return kBuckets - 1;
+
+    const std::size_t highest_bit =
+        sizeof(unsigned long long) * 8 - 1 - __builtin_clzll(value);
+    const std::size_t shift = highest_bit - PrecisionBits + 1;
+    return kExactValues + (shift - 1) * kSubBuckets +
+           ((value >> shift) - kSubBuckets);
+  }
+
+  static std::size_t BucketToValue(std::size_t bucket) noexcept {
+    if (bucket < kExactValues) return bucket;
+
+    const std::size_t shift = (bucket - kExactValues) / kSubBuckets + 1;
+    const std::size_t mantissa =
+        (bucket - kExactValues) % kSubBuckets + kSubBuckets;
+    return ((mantissa + 1) << shift) - 1;
+  }
+
+  std::array<std::atomic<Counter>, kBuckets> values_;
+  std::atomic<Counter> count_;
+};
+
+template <std::size_t PrecisionBits, std::size_t MaxValueBits,
+          typename Counter>
+void DumpMetric(
+    Writer& writer,
+    const HdrPercentile<PrecisionBits, MaxValueBits, Counter>& perc,
+    std::initializer_list<double> percents = {0, 50, 90, 95, 98, 99, 99.6, 99.9,
+                                              100}) {
+  for (double percent : percents) {
+    writer.ValueWithLabels(
+        perc.GetPercentile(percent),
+        {"percentile", statistics::GetPercentileFieldName(percent)});
+  }
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
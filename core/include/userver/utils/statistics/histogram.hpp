@@ -58,6 +58,10 @@ struct BoundsBlock;
 /// Histogram metrics can be summed using
 /// utils::statistics::HistogramAggregator.
 ///
+/// For hot metrics with a wide range of values see
+/// utils::statistics::HdrHistogram, it picks the bounds automatically,
+/// accounts values in O(1) and does not contend between the CPUs.
+///
 /// Histogram can be used in utils::statistics::MetricTag:
 /// @snippet utils/statistics/histogram_test.cpp  metric tag
 class Histogram final {
@@ -0,0 +1,57 @@
+#pragma once
+
+/// @file userver/utils/statistics/metrics_delta.hpp
+/// @brief @copybrief utils::statistics::MetricsDelta
+
+#include <cstdint>
+#include <unordered_map>
+
+#include <userver/engine/mutex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace impl {
+class DeltaFormatBuilder;
+}  // namespace impl
+
+/// @brief Remembers the metrics returned to a consumer, so that the next
+/// request only returns the metrics that have changed since then.
+///
+/// Pass it to utils::statistics::Request::WithDelta. Only the hashes of the
+/// metric paths, labels and values are kept, about 32 bytes per metric.
+/// The metrics that disappear from the storage are forgotten.
+///
+/// Use a separate MetricsDelta for each consumer and each kind of request,
+/// otherwise the consumers would miss each other's changes. Requests with
+/// the same MetricsDelta are serialized.
+///
+/// @note The consumer must keep the last received value of each metric,
+/// e.g. Prometheus would consider the unchanged metrics stale.
+class MetricsDelta final {
+ public:
+  MetricsDelta();
+  MetricsDelta(MetricsDelta&&) = delete;
+  MetricsDelta& operator=(MetricsDelta&&) = delete;
+  ~MetricsDelta();
+
+  /// Forgets all the metrics, so that the next request returns all of them.
+  void Reset();
+
+ private:
+  friend class impl::DeltaFormatBuilder;
+
+  struct MetricState final {
+    std::uint64_t value_hash;
+    std::uint64_t generation;
+  };
+
+  engine::Mutex mutex_;
+  std::uint64_t generation_{0};
+  std::unordered_map<std::uint64_t, MetricState> metrics_;
+};
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
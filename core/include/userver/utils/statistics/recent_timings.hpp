@@ -0,0 +1,93 @@
+#pragma once
+
+/// @file userver/utils/statistics/recent_timings.hpp
+/// @brief @copybrief utils::statistics::RecentTimings
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/hdr_percentile.hpp>
+#include <userver/utils/statistics/recentperiod.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+/// @brief Timings percentile of the last minute, for the metrics kept per
+/// handler or per method.
+///
+/// The epochs of the percentile are allocated on the first Account(), so the
+/// methods without requests take a single pointer and cost nothing on the
+/// metrics scrape. The timings are kept in utils::statistics::HdrPercentile
+/// buckets.
+///
+/// Written to utils::statistics::Writer the same way as
+/// utils::statistics::RecentPeriod of a utils::statistics::Percentile.
+class RecentTimings final {
+ public:
+  using Percentile = HdrPercentile<6, 22>;
+
+  RecentTimings() noexcept = default;
+  ~RecentTimings();
+
+  RecentTimings(RecentTimings&&) = delete;
+  RecentTimings& operator=(RecentTimings&&) = delete;
+
+  void Account(std::chrono::milliseconds timing) noexcept;
+
+  /// Returns the timings of the last minute without the current epoch, empty
+  /// if nothing was accounted yet
+  Percentile GetStatsForPeriod() const;
+
+  /// Resets the accounted timings, keeping the memory allocated
+  friend void ResetMetric(RecentTimings& timings) noexcept;
+
+ private:
+  using Timings = RecentPeriod<Percentile, Percentile>;
+
+  Timings& GetOrCreateTimings() noexcept;
+
+  std::atomic<Timings*> timings_{nullptr};
+};
+
+void DumpMetric(Writer& writer, const RecentTimings& timings);
+
+/// @brief utils::statistics::RecentTimings for the metrics accounted from many
+/// threads at once, e.g. the timings of the high-RPS gRPC methods.
+///
+/// The timings are accounted into up to kMaxStripes per-CPU stripes and are
+/// summed only when read. Each stripe is allocated on the first Account() on
+/// its CPUs, so the memory grows with the actual concurrency of the metric.
+class StripedRecentTimings final {
+ public:
+  using Percentile = RecentTimings::Percentile;
+
+  static constexpr std::size_t kMaxStripes = 8;
+
+  StripedRecentTimings() noexcept = default;
+  ~StripedRecentTimings();
+
+  StripedRecentTimings(StripedRecentTimings&&) = delete;
+  StripedRecentTimings& operator=(StripedRecentTimings&&) = delete;
+
+  void Account(std::chrono::milliseconds timing) noexcept;
+
+  /// Returns the sum of the stripes timings of the last minute without the
+  /// current epoch, empty if nothing was accounted yet
+  Percentile GetStatsForPeriod() const;
+
+  /// Resets the accounted timings, keeping the memory allocated
+  friend void ResetMetric(StripedRecentTimings& timings) noexcept;
+
+ private:
+  std::array<RecentTimings, kMaxStripes> stripes_;
+};
+
+void DumpMetric(Writer& writer, const StripedRecentTimings& timings);
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -16,6 +16,7 @@
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/statistics/entry.hpp>
+#include <userver/utils/statistics/fwd.hpp>
 #include <userver/utils/statistics/metric_value.hpp>
 #include <userver/utils/statistics/writer.hpp>
 
@@ -76,9 +77,19 @@ class Request final {
   /// Add those labels to each returned metric
   const AddLabels add_labels{};
 
+  /// Return only the metrics that changed since the previous request with
+  /// the same `delta`, if set
+  MetricsDelta* const delta{nullptr};
+
+  /// Makes a copy of the request that only returns the metrics that changed
+  /// since the previous request with the same `delta`.
+  /// @see utils::statistics::MetricsDelta
+  Request WithDelta(MetricsDelta& delta) const;
+
  private:
   Request(std::string prefix_in, PrefixMatch path_match_type_in,
-          std::vector<Label> require_labels_in, AddLabels add_labels_in);
+          std::vector<Label> require_labels_in, AddLabels add_labels_in,
+          MetricsDelta* delta_in = nullptr);
 };
 
 using ExtenderFunc =
@@ -152,7 +163,11 @@ class Storage final {
  private:
   Entry DoRegisterExtender(impl::MetricsSource&& source);
 
+  void DoVisitMetrics(BaseFormatBuilder& out, const Request& request) const;
+
   std::atomic<bool> may_register_extenders_;
+  // Legacy extenders are rare, don't build the JSON for them if there are none
+  std::size_t extenders_count_{0};
   impl::StorageData metrics_sources_;
   mutable engine::SharedMutex mutex_;
 };
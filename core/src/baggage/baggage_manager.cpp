@@ -7,6 +7,8 @@
 #include <userver/utils/assert.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
+#include <baggage/raw_baggage.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace baggage {
@@ -71,7 +73,11 @@ void BaggageManager::AddEntry(std::string key, std::string value,
 }
 
 const Baggage* BaggageManager::TryGetBaggage() {
-  return kInheritedBaggage.GetOptional();
+  if (const auto* baggage = kInheritedBaggage.GetOptional()) return baggage;
+  if (const auto* raw_baggage = impl::kInheritedRawBaggage.GetOptional()) {
+    return raw_baggage->Get();
+  }
+  return nullptr;
 }
 
 void BaggageManager::SetBaggage(std::string header) const {
@@ -89,7 +95,16 @@ void BaggageManager::SetBaggage(std::string header) const {
   }
 }
 
-void BaggageManager::ResetBaggage() { kInheritedBaggage.Erase(); }
+void BaggageManager::SetRawBaggage(std::string header,
+                                   const dynamic_config::Snapshot& config) {
+  kInheritedBaggage.Erase();
+  impl::kInheritedRawBaggage.Emplace(std::move(header), config);
+}
+
+void BaggageManager::ResetBaggage() {
+  kInheritedBaggage.Erase();
+  impl::kInheritedRawBaggage.Erase();
+}
 
 }  // namespace baggage
 
@@ -2,6 +2,7 @@
 
 #include <userver/dynamic_config/storage_mock.hpp>
 #include <userver/formats/json.hpp>
+#include <userver/utils/async.hpp>
 
 #include <userver/baggage/baggage_manager.hpp>
 
@@ -92,4 +93,34 @@ UTEST_F(BaggageManagerTest, ResetBaggage) {
   ASSERT_EQ(baggage, nullptr);
 }
 
+// Test lazy parsing of an incoming header
+UTEST_F(BaggageManagerTest, SetRawBaggage) {
+  baggage::BaggageManager::SetRawBaggage("key1=value1,key9=value9",
+                                         storage_.GetSnapshot());
+
+  const auto* baggage = baggage::BaggageManager::TryGetBaggage();
+  ASSERT_NE(baggage, nullptr);
+  EXPECT_EQ(baggage->ToString(), "key1=value1");
+  EXPECT_EQ(baggage::BaggageManager::TryGetBaggage(), baggage);
+
+  auto child_baggage = utils::Async("child", [] {
+                         return baggage::BaggageManager::TryGetBaggage();
+                       }).Get();
+  EXPECT_EQ(child_baggage, baggage);
+
+  baggage_manager_.SetBaggage("key2=value2");
+  baggage = baggage::BaggageManager::TryGetBaggage();
+  ASSERT_NE(baggage, nullptr);
+  EXPECT_EQ(baggage->ToString(), "key2=value2");
+
+  baggage::BaggageManager::SetRawBaggage("key3=value3",
+                                         storage_.GetSnapshot());
+  baggage = baggage::BaggageManager::TryGetBaggage();
+  ASSERT_NE(baggage, nullptr);
+  EXPECT_EQ(baggage->ToString(), "key3=value3");
+
+  baggage::BaggageManager::ResetBaggage();
+  EXPECT_EQ(baggage::BaggageManager::TryGetBaggage(), nullptr);
+}
+
 USERVER_NAMESPACE_END
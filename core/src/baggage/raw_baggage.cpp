@@ -0,0 +1,23 @@
+#include <baggage/raw_baggage.hpp>
+
+#include <userver/baggage/baggage_settings.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace baggage::impl {
+
+RawBaggage::RawBaggage(std::string header, dynamic_config::Snapshot config)
+    : header_(std::move(header)), config_(std::move(config)) {}
+
+const Baggage* RawBaggage::Get() const {
+  std::call_once(parse_once_, [this] {
+    auto baggage = TryMakeBaggage(std::move(header_),
+                                  config_[kBaggageSettings].allowed_keys);
+    if (baggage) baggage_.emplace(std::move(*baggage));
+  });
+  return baggage_ ? &*baggage_ : nullptr;
+}
+
+}  // namespace baggage::impl
+
+USERVER_NAMESPACE_END
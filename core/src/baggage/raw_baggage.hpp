@@ -0,0 +1,36 @@
+#pragma once
+
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include <userver/baggage/baggage.hpp>
+#include <userver/dynamic_config/snapshot.hpp>
+#include <userver/engine/task/inherited_variable.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace baggage::impl {
+
+// Baggage header of an incoming request that is parsed on the first access.
+// The parsed baggage is cached and shared by the whole task hierarchy.
+class RawBaggage final {
+ public:
+  RawBaggage(std::string header, dynamic_config::Snapshot config);
+
+  // Returns nullptr if the header is invalid
+  const Baggage* Get() const;
+
+ private:
+  mutable std::string header_;
+  const dynamic_config::Snapshot config_;
+  mutable std::once_flag parse_once_;
+  mutable std::optional<Baggage> baggage_;
+};
+
+// Takes effect only while baggage::kInheritedBaggage is not set
+inline engine::TaskInheritedVariable<RawBaggage> kInheritedRawBaggage;
+
+}  // namespace baggage::impl
+
+USERVER_NAMESPACE_END
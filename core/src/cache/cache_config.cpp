@@ -50,6 +50,10 @@ constexpr std::string_view kAlertOnFailingToUpdateTimes =
 
 constexpr std::string_view kSafeDataLifetime = "safe-data-lifetime";
 
+constexpr std::string_view kFullUpdateConcurrency = "full-update-concurrency";
+constexpr std::string_view kFullUpdateTaskProcessor =
+    "full-update-task-processor";
+
 constexpr auto kDefaultCleanupInterval = std::chrono::seconds{10};
 
 std::chrono::milliseconds GetDefaultJitter(std::chrono::milliseconds interval) {
@@ -73,7 +77,8 @@ constexpr utils::TrivialBiMap kFirstUpdateModeMap([](auto selector) {
   return selector()
       .Case(FirstUpdateMode::kRequired, "required")
       .Case(FirstUpdateMode::kBestEffort, "best-effort")
-      .Case(FirstUpdateMode::kSkip, "skip");
+      .Case(FirstUpdateMode::kSkip, "skip")
+      .Case(FirstUpdateMode::kBackground, "background");
 });
 
 constexpr utils::TrivialBiMap kFirstUpdateTypeMap([](auto selector) {
@@ -154,6 +159,10 @@ Config::Config(const yaml_config::YamlConfig& config,
       failed_updates_before_expiration(config[kFailedUpdatesBeforeExpiration]
                                            .As<std::optional<std::uint64_t>>()),
       is_safe_data_lifetime(config[kSafeDataLifetime].As<bool>(true)),
+      full_update_concurrency(
+          config[kFullUpdateConcurrency].As<std::size_t>(1)),
+      full_update_task_processor_name(
+          config[kFullUpdateTaskProcessor].As<std::optional<std::string>>()),
       first_update_mode(
           config[dump::kDump][kFirstUpdateMode].As<FirstUpdateMode>(
               FirstUpdateMode::kSkip)),
@@ -173,6 +182,11 @@ Config::Config(const yaml_config::YamlConfig& config,
       updates_enabled(config[kUpdatesEnabled].As<bool>(true)),
       alert_on_failing_to_update_times(
           config[kAlertOnFailingToUpdateTimes].As<size_t>(0)) {
+  if (full_update_concurrency == 0) {
+    throw ConfigError(fmt::format("{} must be positive for cache at '{}'",
+                                  kFullUpdateConcurrency, config.GetPath()));
+  }
+
   switch (allowed_update_types) {
     case AllowedUpdateTypes::kFullAndIncremental:
       if (!update_interval.count() || !full_update_interval.count()) {
@@ -29,6 +29,14 @@ engine::TaskProcessor& FindTaskProcessor(
              : engine::current_task::GetTaskProcessor();
 }
 
+engine::TaskProcessor& FindFullUpdateTaskProcessor(
+    const components::ComponentContext& context, const Config& static_config) {
+  return static_config.full_update_task_processor_name
+             ? context.GetTaskProcessor(
+                   *static_config.full_update_task_processor_name)
+             : FindTaskProcessor(context, static_config);
+}
+
 std::optional<dynamic_config::Source> FindDynamicConfig(
     const components::ComponentContext& context, const Config& static_config) {
   return static_config.config_updates_enabled
@@ -50,6 +58,7 @@ CacheDependencies CacheDependencies::Make(
       config.Name(),
       static_config,
       FindTaskProcessor(context, static_config),
+      FindFullUpdateTaskProcessor(context, static_config),
       FindDynamicConfig(context, static_config),
       context.FindComponent<components::StatisticsStorage>().GetStorage(),
       context.FindComponent<alerts::StorageComponent>().GetStorage(),
@@ -23,6 +23,7 @@ struct CacheDependencies final {
   std::string name;
   Config config;
   engine::TaskProcessor& task_processor;
+  engine::TaskProcessor& full_update_task_processor;
   std::optional<dynamic_config::Source> config_source;
   utils::statistics::Storage& statistics_storage;
   alerts::Storage& alerts_storage_;
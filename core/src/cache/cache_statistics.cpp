@@ -47,6 +47,8 @@ void CombineStatistics(const impl::UpdateStatistics& a,
                b.last_successful_update_start_time.load());
   result.last_update_duration =
       std::max(a.last_update_duration.load(), b.last_update_duration.load());
+  result.parts_count = a.parts_count.load() + b.parts_count.load();
+  result.parts_done = a.parts_done.load() + b.parts_done.load();
 }
 
 }  // namespace
@@ -87,6 +89,11 @@ void DumpMetric(utils::statistics::Writer& writer,
             stats.last_update_duration.load())
             .count();
   }
+
+  if (auto parts = writer["parts"]) {
+    parts["total"] = stats.parts_count.load();
+    parts["done"] = stats.parts_done.load();
+  }
 }
 
 void DumpMetric(utils::statistics::Writer& writer, const Statistics& stats) {
@@ -114,6 +121,8 @@ UpdateStatisticsScope::UpdateStatisticsScope(impl::Statistics& stats,
       update_start_time_(utils::datetime::SteadyNow()) {
   update_stats_.last_update_start_time = update_start_time_;
   ++update_stats_.update_attempt_count;
+  update_stats_.parts_count = 0;
+  update_stats_.parts_done = 0;
 }
 
 UpdateStatisticsScope::~UpdateStatisticsScope() {
@@ -150,6 +159,14 @@ void UpdateStatisticsScope::IncreaseDocumentsParseFailures(std::size_t add) {
   update_stats_.documents_parse_failures += utils::statistics::Rate{add};
 }
 
+void UpdateStatisticsScope::SetPartsCount(std::size_t parts_count) {
+  update_stats_.parts_count = parts_count;
+}
+
+void UpdateStatisticsScope::IncreasePartsDone(std::size_t add) {
+  update_stats_.parts_done += add;
+}
+
 void UpdateStatisticsScope::DoFinish(impl::UpdateState new_state) {
   UASSERT(new_state != impl::UpdateState::kNotFinished);
   // TODO Some production caches call Finish multiple times. We should fix those
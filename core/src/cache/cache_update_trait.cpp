@@ -2,9 +2,12 @@
 
 #include <utility>
 
+#include <fmt/format.h>
+
 #include <cache/cache_dependencies.hpp>
 #include <cache/cache_update_trait_impl.hpp>
 #include <userver/dump/helpers.hpp>
+#include <userver/dump/operations.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -45,6 +48,12 @@ void CacheUpdateTrait::AssertPeriodicUpdateStarted() {
 
 void CacheUpdateTrait::OnCacheModified() { impl_->OnCacheModified(); }
 
+void CacheUpdateTrait::RunUpdateParts(
+    std::size_t parts_count, const std::function<void(std::size_t)>& build_part,
+    UpdateStatisticsScope& stats_scope) {
+  impl_->RunUpdateParts(parts_count, build_part, stats_scope);
+}
+
 bool CacheUpdateTrait::HasPreAssignCheck() const {
   return impl_->HasPreAssignCheck();
 }
@@ -75,6 +84,14 @@ void CacheUpdateTrait::ReadAndSet(dump::Reader&) {
   dump::ThrowDumpUnimplemented(Name());
 }
 
+bool CacheUpdateTrait::GetAndWriteDelta(dump::Writer&) { return false; }
+
+void CacheUpdateTrait::ReadAndSetWithDeltas(dump::Reader&,
+                                            dump::DeltaSequence&) {
+  throw dump::Error(
+      fmt::format("{}: incremental dumps are not supported", Name()));
+}
+
 }  // namespace cache
 
 USERVER_NAMESPACE_END
@@ -1,10 +1,14 @@
 #include <cache/cache_update_trait_impl.hpp>
 
+#include <algorithm>
+#include <vector>
+
 #include <fmt/format.h>
 
 #include <userver/components/component.hpp>
 #include <userver/components/dump_configurator.hpp>
 #include <userver/dynamic_config/source.hpp>
+#include <userver/engine/get_all.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/testsuite/cache_control.hpp>
@@ -95,6 +99,7 @@ CacheUpdateTrait::Impl::Impl(CacheDependencies&& dependencies,
       name_(std::move(dependencies.name)),
       update_task_name_("update-task/" + name_),
       task_processor_(dependencies.task_processor),
+      full_update_task_processor_(dependencies.full_update_task_processor),
       periodic_update_enabled_(
           dependencies.cache_control.IsPeriodicUpdateEnabled(static_config_,
                                                              name_)),
@@ -169,7 +174,13 @@ void CacheUpdateTrait::Impl::StartPeriodicUpdates(
               : UpdateType::kIncremental;
     }
 
-    if ((last_update_ == std::chrono::system_clock::time_point{} ||
+    // The first update is performed by the periodic task, see below
+    const bool is_first_update_in_background =
+        dump_time && periodic_update_enabled_ &&
+        config->first_update_mode == FirstUpdateMode::kBackground;
+
+    if (!is_first_update_in_background &&
+        (last_update_ == std::chrono::system_clock::time_point{} ||
          config->first_update_mode != FirstUpdateMode::kSkip) &&
         (!(flags & CacheUpdateTrait::Flag::kNoFirstUpdate) ||
          !periodic_update_enabled_)) {
@@ -205,6 +216,8 @@ void CacheUpdateTrait::Impl::StartPeriodicUpdates(
                          FirstUpdateType::kIncrementalThenAsyncFull) {
       dump_first_update_type_ = UpdateType::kFull;
       periodic_task_flags_ |= utils::PeriodicTask::Flags::kNow;
+    } else if (is_first_update_in_background) {
+      periodic_task_flags_ |= utils::PeriodicTask::Flags::kNow;
     }
 
     if (config->is_strong_period) {
@@ -395,6 +408,40 @@ engine::TaskProcessor& CacheUpdateTrait::Impl::GetCacheTaskProcessor() const {
   return task_processor_;
 }
 
+void CacheUpdateTrait::Impl::RunUpdateParts(
+    std::size_t parts_count, const std::function<void(std::size_t)>& build_part,
+    UpdateStatisticsScope& stats_scope) {
+  stats_scope.SetPartsCount(parts_count);
+  if (parts_count == 0) return;
+
+  // Each worker takes the next unbuilt part, so the slow parts do not hold up
+  // the rest
+  std::atomic<std::size_t> next_part{0};
+  const auto work = [&] {
+    for (auto part = next_part++; part < parts_count; part = next_part++) {
+      build_part(part);
+      stats_scope.IncreasePartsDone(1);
+    }
+  };
+
+  const auto workers_count =
+      std::min(static_config_.full_update_concurrency, parts_count);
+  std::vector<engine::TaskWithResult<void>> workers;
+  workers.reserve(workers_count);
+  for (std::size_t i = 0; i < workers_count; ++i) {
+    workers.push_back(
+        utils::Async(full_update_task_processor_, "cache-update-part", work));
+  }
+
+  try {
+    engine::GetAll(workers);
+  } catch (...) {
+    // Do not start new parts, the running ones are cancelled with the tasks
+    next_part = parts_count;
+    throw;
+  }
+}
+
 void CacheUpdateTrait::Impl::DoUpdate(UpdateType update_type,
                                       const Config& config) {
   const auto steady_now = utils::datetime::SteadyNow();
@@ -481,6 +528,16 @@ void CacheUpdateTrait::Impl::DumpableEntityProxy::ReadAndSet(
   cache_.ReadAndSet(reader);
 }
 
+bool CacheUpdateTrait::Impl::DumpableEntityProxy::GetAndWriteDelta(
+    dump::Writer& writer) {
+  return cache_.GetAndWriteDelta(writer);
+}
+
+void CacheUpdateTrait::Impl::DumpableEntityProxy::ReadAndSetWithDeltas(
+    dump::Reader& reader, dump::DeltaSequence& deltas) {
+  cache_.ReadAndSetWithDeltas(reader, deltas);
+}
+
 }  // namespace cache
 
 USERVER_NAMESPACE_END
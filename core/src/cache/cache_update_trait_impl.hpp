@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <stdexcept>
@@ -64,6 +65,10 @@ class CacheUpdateTrait::Impl final {
 
   engine::TaskProcessor& GetCacheTaskProcessor() const;
 
+  void RunUpdateParts(std::size_t parts_count,
+                      const std::function<void(std::size_t)>& build_part,
+                      UpdateStatisticsScope& stats_scope);
+
  private:
   class DumpableEntityProxy final : public dump::DumpableEntity {
    public:
@@ -73,6 +78,11 @@ class CacheUpdateTrait::Impl final {
 
     void ReadAndSet(dump::Reader& reader) override;
 
+    bool GetAndWriteDelta(dump::Writer& writer) override;
+
+    void ReadAndSetWithDeltas(dump::Reader& reader,
+                              dump::DeltaSequence& deltas) override;
+
    private:
     CacheUpdateTrait& cache_;
   };
@@ -110,6 +120,7 @@ class CacheUpdateTrait::Impl final {
   const std::string name_;
   const std::string update_task_name_;
   engine::TaskProcessor& task_processor_;
+  engine::TaskProcessor& full_update_task_processor_;
   const bool periodic_update_enabled_;
   std::atomic<bool> is_running_{false};
   bool first_update_attempted_{false};
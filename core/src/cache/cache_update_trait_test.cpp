@@ -1,7 +1,10 @@
 #include <userver/cache/cache_update_trait.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <exception>
+#include <numeric>
 #include <optional>
 #include <utility>
 #include <vector>
@@ -83,6 +86,88 @@ UTEST(CacheUpdateTrait, FirstIsFull) {
   EXPECT_EQ(cache::UpdateType::kFull, test_cache.LastUpdateType());
 }
 
+namespace {
+
+class PartitionedCache final : public cache::CacheMockBase {
+ public:
+  static constexpr std::string_view kName = "partitioned-cache";
+  static constexpr std::size_t kPartsCount = 10;
+
+  PartitionedCache(const yaml_config::YamlConfig& config,
+                   cache::MockEnvironment& environment,
+                   std::optional<std::size_t> failed_part = {})
+      : CacheMockBase(kName, config, environment), failed_part_(failed_part) {
+    StartPeriodicUpdates();
+  }
+
+  ~PartitionedCache() final { StopPeriodicUpdates(); }
+
+  const std::vector<std::size_t>& GetParts() const { return parts_; }
+
+  std::size_t GetMaxConcurrency() const { return max_concurrency_; }
+
+ private:
+  void Update(cache::UpdateType,
+              const std::chrono::system_clock::time_point&,
+              const std::chrono::system_clock::time_point&,
+              cache::UpdateStatisticsScope& stats_scope) override {
+    parts_ = BuildUpdateParts(
+        kPartsCount,
+        [this](std::size_t part) {
+          const auto concurrency = ++concurrency_;
+          max_concurrency_ = std::max(max_concurrency_.load(), concurrency);
+          engine::SleepFor(std::chrono::milliseconds{5});
+          --concurrency_;
+
+          if (part == failed_part_) throw cache::MockError();
+          return part;
+        },
+        stats_scope);
+    OnCacheModified();
+    stats_scope.Finish(parts_.size());
+  }
+
+  const std::optional<std::size_t> failed_part_;
+  std::vector<std::size_t> parts_;
+  std::atomic<std::size_t> concurrency_{0};
+  std::atomic<std::size_t> max_concurrency_{0};
+};
+
+const std::string kPartitionedCacheConfig = R"(
+update-interval: 10h
+additional-cleanup-interval: 10h
+full-update-concurrency: 3
+first-update-fail-ok: true
+)";
+
+}  // namespace
+
+UTEST_MT(CacheUpdateTrait, UpdateParts, 4) {
+  const yaml_config::YamlConfig config{
+      formats::yaml::FromString(kPartitionedCacheConfig), {}};
+  cache::MockEnvironment environment;
+
+  PartitionedCache cache(config, environment);
+
+  std::vector<std::size_t> expected(PartitionedCache::kPartsCount);
+  std::iota(expected.begin(), expected.end(), 0);
+  EXPECT_EQ(cache.GetParts(), expected);
+  EXPECT_GT(cache.GetMaxConcurrency(), 1);
+  EXPECT_LE(cache.GetMaxConcurrency(), 3);
+}
+
+UTEST_MT(CacheUpdateTrait, UpdatePartsFailure, 4) {
+  const yaml_config::YamlConfig config{
+      formats::yaml::FromString(kPartitionedCacheConfig), {}};
+  cache::MockEnvironment environment;
+
+  PartitionedCache cache(config, environment, 4);
+
+  EXPECT_TRUE(cache.GetParts().empty());
+  UEXPECT_THROW(cache.UpdateSyncDebug(cache::UpdateType::kFull),
+                cache::MockError);
+}
+
 using cache::AllowedUpdateTypes;
 using cache::FirstUpdateMode;
 using cache::FirstUpdateType;
@@ -164,7 +249,7 @@ const auto kAnyAllowedUpdateType =
 
 const auto kAnyFirstUpdateMode =
     Values(FirstUpdateMode::kRequired, FirstUpdateMode::kBestEffort,
-           FirstUpdateMode::kSkip);
+           FirstUpdateMode::kSkip, FirstUpdateMode::kBackground);
 
 const auto kAnyFirstUpdateType =
     Values(FirstUpdateType::kFull, FirstUpdateType::kIncremental,
@@ -272,8 +357,42 @@ class CacheUpdateTraitDumpedIncrementalThenAsyncFull
   }
 };
 
+class CacheUpdateTraitDumpedBackground : public CacheUpdateTraitDumped {
+ public:
+  CacheUpdateTraitDumpedBackground()
+      : CacheUpdateTraitDumped(testsuite::impl::PeriodicUpdatesMode::kEnabled) {
+  }
+};
+
 }  // namespace
 
+UTEST_P(CacheUpdateTraitDumpedBackground, Test) {
+  DumpedCache cache(Config(), GetEnvironment(), GetDataSource());
+
+  // The cache starts with the data from dump, the update is not awaited
+  EXPECT_EQ(cache.Get(), 10) << ParamsString();
+
+  // There will be no data race because only one thread is using
+  while (cache.GetUpdatesLog().empty()) {
+    engine::Yield();
+  }
+
+  EXPECT_EQ(cache.GetUpdatesLog()[0], UpdateType::kFull) << ParamsString();
+  EXPECT_EQ(cache.Get(), 20) << ParamsString();
+}
+
+// 1. Loads data from dump
+// 2. The cache starts with the data from dump
+// 3. Performs a full update in background, because first-update-mode:
+//    background
+INSTANTIATE_UTEST_SUITE_P(
+    FullUpdate, CacheUpdateTraitDumpedBackground,
+    Combine(Values(AllowedUpdateTypes::kFullAndIncremental),
+            Values(FirstUpdateMode::kBackground),
+            Values(FirstUpdateType::kFull,
+                   FirstUpdateType::kIncrementalThenAsyncFull),
+            Values(DumpAvailable{true}), Values(DataSourceAvailable{true})));
+
 UTEST_P(CacheUpdateTraitDumpedIncrementalThenAsyncFull, Test) {
   DumpedCache cache(Config(), GetEnvironment(), GetDataSource());
 
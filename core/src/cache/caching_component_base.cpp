@@ -80,6 +80,20 @@ properties:
             takes priority over static
         defaultDescription: 0
         minimum: 0
+    full-update-concurrency:
+        type: integer
+        description: |
+            max number of parts of a partitioned update (see
+            cache::CacheUpdateTrait::RunUpdateParts) that are built
+            concurrently
+        defaultDescription: 1
+        minimum: 1
+    full-update-task-processor:
+        type: string
+        description: |
+            the name of the TaskProcessor for building the parts of
+            a partitioned update
+        defaultDescription: the value of task-processor
     safe-data-lifetime:
         type: boolean
         description: |
@@ -101,11 +115,15 @@ properties:
                     `first-update-type`, stop the service on failure;
                     `best-effort` - make a synchronous update of type
                     `first-update-type`, keep working and use data from dump
-                    on failure.
+                    on failure;
+                    `background` - start with the data from dump and
+                    immediately start an update of type `first-update-type`
+                    in background.
                 enum:
                   - skip
                   - required
                   - best-effort
+                  - background
             first-update-type:
                 type: string
                 description: |
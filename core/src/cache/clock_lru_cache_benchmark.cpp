@@ -0,0 +1,103 @@
+#include <userver/cache/clock_lru_cache.hpp>
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/cache/nway_lru_cache.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kWays = 16;
+constexpr std::size_t kCacheSize = 1 << 14;
+constexpr std::size_t kKeysCount = 1 << 16;
+constexpr std::size_t kSamplesCount = 1 << 16;
+
+// Keys in [0, kKeysCount) with P(k) ~ 1 / (k + 1)^skew
+std::vector<std::uint32_t> MakeZipfianKeys(double skew, unsigned seed) {
+  std::vector<double> weights(kKeysCount);
+  for (std::size_t i = 0; i < kKeysCount; ++i) {
+    weights[i] = 1.0 / std::pow(static_cast<double>(i + 1), skew);
+  }
+
+  std::mt19937 rng{seed};
+  std::discrete_distribution<std::uint32_t> distribution(weights.begin(),
+                                                         weights.end());
+  std::vector<std::uint32_t> keys(kSamplesCount);
+  for (auto& key : keys) key = distribution(rng);
+  return keys;
+}
+
+// Each thread looks the Zipfian keys up and puts the missing ones, the same
+// way ExpirableLruCache does.
+//
+// state.range(0) - the number of threads
+// state.range(1) - the skew of the distribution multiplied by 100
+template <typename Cache>
+void lru_cache_zipfian_get(benchmark::State& state) {
+  const auto threads = static_cast<std::size_t>(state.range(0));
+  const auto skew = static_cast<double>(state.range(1)) / 100;
+
+  engine::RunStandalone(threads, [&] {
+    Cache cache(kWays, kCacheSize / kWays);
+    for (std::size_t i = 0; i < kCacheSize; ++i) cache.Put(i, i);
+
+    std::atomic<bool> keep_running{true};
+    const auto run = [&](const std::vector<std::uint32_t>& keys,
+                         std::size_t& offset) {
+      const auto key = keys[offset++ % keys.size()];
+      auto value = cache.Get(key);
+      if (!value) cache.Put(key, key);
+      benchmark::DoNotOptimize(value);
+    };
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(threads);
+    for (std::size_t i = 1; i < threads; ++i) {
+      tasks.push_back(engine::AsyncNoSpan([&, i] {
+        const auto keys = MakeZipfianKeys(skew, i);
+        std::size_t offset = 0;
+        while (keep_running) run(keys, offset);
+      }));
+    }
+
+    const auto keys = MakeZipfianKeys(skew, 0);
+    std::size_t offset = 0;
+    std::size_t misses = 0;
+    for ([[maybe_unused]] auto _ : state) {
+      const auto key = keys[offset++ % keys.size()];
+      auto value = cache.Get(key);
+      if (!value) {
+        ++misses;
+        cache.Put(key, key);
+      }
+      benchmark::DoNotOptimize(value);
+    }
+    state.counters["miss_ratio"] =
+        static_cast<double>(misses) / state.iterations();
+
+    keep_running = false;
+    for (auto& task : tasks) task.Get();
+  });
+}
+
+using NWayCache = cache::NWayLRU<std::uint64_t, std::uint64_t>;
+using ClockCache = cache::ClockLru<std::uint64_t, std::uint64_t>;
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(lru_cache_zipfian_get, NWayCache)
+    ->ArgsProduct({{1, 2, 4, 8}, {80, 99, 120}});
+BENCHMARK_TEMPLATE(lru_cache_zipfian_get, ClockCache)
+    ->ArgsProduct({{1, 2, 4, 8}, {80, 99, 120}});
+
+USERVER_NAMESPACE_END
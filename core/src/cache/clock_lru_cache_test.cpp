@@ -0,0 +1,174 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <userver/cache/clock_lru_cache.hpp>
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations_mock.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+using Cache = cache::ClockLru<int, int>;
+
+UTEST(ClockLru, Ctr) {
+  UEXPECT_NO_THROW(Cache(1, 10));
+  UEXPECT_NO_THROW(Cache(10, 10));
+  UEXPECT_THROW(Cache(0, 10), std::logic_error);
+}
+
+UTEST(ClockLru, Set) {
+  Cache cache(1, 1);
+  EXPECT_EQ(0, cache.GetSize());
+
+  cache.Put(1, 1);
+  EXPECT_EQ(1, cache.GetSize());
+
+  cache.Put(2, 2);
+
+  EXPECT_EQ(2, cache.Get(2));
+  EXPECT_EQ(1, cache.GetSize());
+  EXPECT_FALSE(cache.Get(1).has_value());
+
+  cache.Put(2, 3);
+  EXPECT_EQ(3, cache.Get(2));
+  EXPECT_EQ(1, cache.GetSize());
+}
+
+UTEST(ClockLru, EvictsUnreferenced) {
+  Cache cache(1, 3);
+  cache.Put(1, 1);
+  cache.Put(2, 2);
+  cache.Put(3, 3);
+
+  EXPECT_EQ(1, cache.Get(1));
+  EXPECT_EQ(3, cache.Get(3));
+
+  cache.Put(4, 4);
+  EXPECT_FALSE(cache.Get(2).has_value());
+  EXPECT_EQ(1, cache.Get(1));
+  EXPECT_EQ(3, cache.Get(3));
+  EXPECT_EQ(4, cache.Get(4));
+}
+
+UTEST(ClockLru, GetExpired) {
+  Cache cache(1, 2);
+  cache.Put(1, 1);
+  cache.Put(2, 2);
+
+  EXPECT_EQ(1, cache.Get(1));
+  EXPECT_EQ(2, cache.GetSize());
+
+  EXPECT_FALSE(cache.Get(1, [](int) { return false; }).has_value());
+  EXPECT_EQ(1, cache.GetSize());
+
+  EXPECT_FALSE(cache.Get(2, [](int) { return false; }).has_value());
+  EXPECT_EQ(0, cache.GetSize());
+
+  EXPECT_FALSE(cache.Get(1).has_value());
+  EXPECT_EQ(0, cache.GetSize());
+}
+
+UTEST(ClockLru, SetMultipleWays) {
+  Cache cache(2, 1);
+  cache.Put(1, 1);
+  cache.Put(2, 2);
+
+  EXPECT_EQ(2, cache.GetSize());
+  EXPECT_EQ(2, cache.Get(2));
+  EXPECT_EQ(1, cache.Get(1));
+}
+
+UTEST(ClockLru, Invalidate) {
+  Cache cache(2, 100);
+  for (int i = 0; i < 100; ++i) cache.Put(i, i);
+  EXPECT_EQ(100, cache.GetSize());
+
+  cache.InvalidateByKey(42);
+  EXPECT_FALSE(cache.Get(42).has_value());
+  EXPECT_EQ(99, cache.GetSize());
+  EXPECT_EQ(43, cache.GetOr(43, -1));
+  EXPECT_EQ(-1, cache.GetOr(42, -1));
+
+  cache.Invalidate();
+  EXPECT_EQ(0, cache.GetSize());
+  EXPECT_FALSE(cache.Get(43).has_value());
+}
+
+UTEST(ClockLru, UpdateWaySize) {
+  Cache cache(1, 10);
+  for (int i = 0; i < 10; ++i) cache.Put(i, i);
+
+  cache.UpdateWaySize(100);
+  EXPECT_EQ(10, cache.GetSize());
+  for (int i = 0; i < 10; ++i) EXPECT_EQ(i, cache.Get(i));
+
+  for (int i = 10; i < 1000; ++i) cache.Put(i, i);
+  EXPECT_EQ(100, cache.GetSize());
+
+  cache.UpdateWaySize(5);
+  EXPECT_EQ(5, cache.GetSize());
+
+  int visited = 0;
+  cache.VisitAll([&](int key, int value) {
+    EXPECT_EQ(key, value);
+    ++visited;
+  });
+  EXPECT_EQ(5, visited);
+}
+
+UTEST(ClockLru, Dump) {
+  Cache cache(4, 10);
+  for (int i = 0; i < 20; ++i) cache.Put(i, i * 2);
+
+  dump::MockWriter writer;
+  cache.Write(writer);
+  writer.Finish();
+
+  Cache restored(2, 20);
+  dump::MockReader reader(std::move(writer).Extract());
+  restored.Read(reader);
+  reader.Finish();
+
+  EXPECT_EQ(cache.GetSize(), restored.GetSize());
+  cache.VisitAll([&](int key, int value) {
+    EXPECT_EQ(value, restored.Get(key));
+  });
+}
+
+UTEST_MT(ClockLru, ConcurrentReadsAndWrites, 4) {
+  constexpr int kKeys = 500;
+  cache::ClockLru<int, std::string> cache(4, 64);
+  std::atomic<bool> keep_running{true};
+
+  std::vector<engine::TaskWithResult<void>> readers;
+  for (int i = 0; i < 3; ++i) {
+    readers.push_back(engine::AsyncNoSpan([&, i] {
+      for (int key = i; keep_running; key = (key + 7) % kKeys) {
+        const auto value = cache.Get(key);
+        if (value) {
+          ASSERT_EQ(*value, std::to_string(key));
+        }
+      }
+    }));
+  }
+
+  for (int i = 0; i < 100000; ++i) {
+    const auto key = i * 31 % kKeys;
+    if (i % 100 == 0) {
+      cache.InvalidateByKey(key);
+    } else {
+      cache.Put(key, std::to_string(key));
+    }
+    if (i % 20000 == 0) cache.UpdateWaySize(32 + i % 3 * 40);
+    if (i % 1000 == 0) engine::Yield();
+  }
+
+  keep_running = false;
+  for (auto& reader : readers) reader.Get();
+}
+
+USERVER_NAMESPACE_END
@@ -1,9 +1,12 @@
 #include <string>
+#include <vector>
 
 #include <userver/utest/utest.hpp>
 
 #include <userver/cache/expirable_lru_cache.hpp>
 #include <userver/dump/operations_mock.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/utils/mock_now.hpp>
 
@@ -82,6 +85,20 @@ std::function<SimpleCacheValue(SimpleCacheKey)> UpdateValue(
   };
 }
 
+// Returns the lengths of the keys, remembers the requested keys
+SimpleCache::UpdateManyValuesFunc UpdateMany(
+    std::shared_ptr<std::vector<SimpleCacheKey>> requested_keys) {
+  return [requested_keys = std::move(requested_keys)](
+             const std::vector<SimpleCacheKey>& keys) {
+    std::vector<SimpleCacheValue> values;
+    for (const auto& key : keys) {
+      requested_keys->push_back(key);
+      values.push_back(static_cast<SimpleCacheValue>(key.size()));
+    }
+    return values;
+  };
+}
+
 SimpleCache CreateSimpleCache() { return SimpleCache(1, 1); }
 
 std::shared_ptr<SimpleCache> CreateSimpleCachePtr() {
@@ -295,6 +312,57 @@ UTEST(ExpirableLruCache, InvalidateByKey) {
   EXPECT_EQ(Counter::One(), *counter);
 }
 
+UTEST(ExpirableLruCache, ClockEngine) {
+  auto counter = std::make_shared<Counter>();
+
+  SimpleCache cache(1, 1, cache::LruCacheEngine::kClock);
+  const SimpleCacheKey key = "my-key";
+
+  counter->Flush();
+  EXPECT_EQ(1, cache.Get(key, UpdateValue(counter, 1)));
+  EXPECT_EQ(Counter::One(), *counter);
+
+  WriteAndReadFromDump(cache);
+  EXPECT_EQ(1, cache.Get(key, UpdateNever()));
+
+  counter->Flush();
+  EXPECT_EQ(2, cache.Get("other-key", UpdateValue(counter, 2)));
+  EXPECT_EQ(Counter::One(), *counter);
+  EXPECT_EQ(1, cache.GetSizeApproximate());
+  EXPECT_EQ(std::nullopt, cache.GetOptionalNoUpdate(key));
+}
+
+UTEST(ExpirableLruCache, TinyLfuAdmission) {
+  SimpleCache cache(1, 10);
+  cache.SetAdmission(cache::LruCacheAdmission::kTinyLfu);
+
+  for (int i = 0; i < 10; ++i) {
+    const auto key = std::to_string(i);
+    for (int j = 0; j < 3; ++j) cache.Get(key, [i](const auto&) { return i; });
+  }
+  EXPECT_EQ(10, cache.GetSizeApproximate());
+
+  // A scan over the new keys does not evict the hot set
+  for (int i = 100; i < 200; ++i) {
+    EXPECT_EQ(i, cache.Get(std::to_string(i), [i](const auto&) { return i; }));
+  }
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(i, cache.GetOptionalNoUpdate(std::to_string(i)));
+  }
+
+  const auto& stats = cache.GetStatistics();
+  EXPECT_EQ(0, stats.total.admitted);
+  EXPECT_EQ(100, stats.total.rejected);
+
+  // A key that gets popular is let in
+  const std::string popular = "popular";
+  for (int j = 0; j < 10; ++j) {
+    cache.Get(popular, [](const auto&) { return 42; });
+  }
+  EXPECT_EQ(42, cache.GetOptionalNoUpdate(popular));
+  EXPECT_EQ(1, stats.total.admitted);
+}
+
 UTEST(ExpirableLruCache, BackgroundUpdate) {
   auto counter = std::make_shared<Counter>();
 
@@ -330,6 +398,104 @@ UTEST(ExpirableLruCache, BackgroundUpdate) {
   EXPECT_EQ(2, cache.Get(key, UpdateNever()));
 }
 
+UTEST_MT(ExpirableLruCache, SingleFlight, 4) {
+  auto cache = CreateSimpleCache();
+  cache.SetSingleFlight(true);
+
+  std::atomic<int> updates{0};
+  engine::SingleConsumerEvent release;
+  const auto update = [&](const SimpleCacheKey&) {
+    ++updates;
+    EXPECT_TRUE(release.WaitForEvent());
+    return 42;
+  };
+
+  std::vector<engine::TaskWithResult<SimpleCacheValue>> tasks;
+  for (int i = 0; i < 10; ++i) {
+    tasks.push_back(
+        engine::AsyncNoSpan([&] { return cache.Get("key", update); }));
+  }
+  engine::SleepFor(std::chrono::milliseconds(50));
+  release.Send();
+
+  for (auto& task : tasks) EXPECT_EQ(42, task.Get());
+  EXPECT_EQ(1, updates);
+  EXPECT_EQ(42, cache.Get("key", UpdateNever()));
+}
+
+UTEST(ExpirableLruCache, SingleFlightException) {
+  auto cache = CreateSimpleCache();
+  cache.SetSingleFlight(true);
+
+  const auto update = [](const SimpleCacheKey&) -> SimpleCacheValue {
+    throw std::runtime_error("update failed");
+  };
+  UEXPECT_THROW(cache.Get("key", update), std::runtime_error);
+
+  // Failed updates are not cached
+  auto counter = std::make_shared<Counter>();
+  EXPECT_EQ(1, cache.Get("key", UpdateValue(counter, 1)));
+  EXPECT_EQ(Counter::One(), *counter);
+}
+
+UTEST(ExpirableLruCache, StaleWhileRevalidate) {
+  auto counter = std::make_shared<Counter>();
+
+  auto cache = CreateSimpleCache();
+  cache.SetMaxLifetime(std::chrono::seconds(2));
+  cache.SetStaleWhileRevalidate(std::chrono::seconds(2));
+
+  SimpleCacheKey key = "my-key";
+
+  utils::datetime::MockNowSet(std::chrono::system_clock::now());
+
+  EXPECT_EQ(1, cache.Get(key, UpdateValue(counter, 1)));
+
+  utils::datetime::MockSleep(std::chrono::seconds(3));
+
+  counter->Flush();
+  EXPECT_EQ(1, cache.Get(key, UpdateValue(counter, 2)));
+  EngineYield();
+  EXPECT_EQ(Counter::One(), *counter);
+  EXPECT_EQ(2, cache.Get(key, UpdateNever()));
+
+  // Too stale
+  utils::datetime::MockSleep(std::chrono::seconds(5));
+
+  counter->Flush();
+  EXPECT_EQ(3, cache.Get(key, UpdateValue(counter, 3)));
+  EXPECT_EQ(Counter::One(), *counter);
+}
+
+UTEST(ExpirableLruCache, EarlyRefresh) {
+  auto counter = std::make_shared<Counter>();
+
+  auto cache = CreateSimpleCache();
+  cache.SetMaxLifetime(std::chrono::seconds(10));
+  cache.SetBackgroundUpdate(cache::BackgroundUpdateMode::kEnabled);
+  cache.SetEarlyRefreshBeta(1e6);
+
+  SimpleCacheKey key = "my-key";
+
+  utils::datetime::MockNowSet(std::chrono::system_clock::now());
+
+  const auto slow_update = [counter](const SimpleCacheKey&) {
+    ++(*counter);
+    utils::datetime::MockSleep(std::chrono::seconds(1));
+    return 1;
+  };
+  EXPECT_EQ(1, cache.Get(key, slow_update));
+  EXPECT_EQ(Counter::One(), *counter);
+
+  // A slow update with a huge beta is refreshed long before the half of
+  // the lifetime
+  counter->Flush();
+  EXPECT_EQ(1, cache.Get(key, UpdateValue(counter, 2)));
+  EngineYield();
+  EXPECT_EQ(Counter::One(), *counter);
+  EXPECT_EQ(2, cache.Get(key, UpdateNever()));
+}
+
 UTEST(ExpirableLruCache, Example) {
   /// [Sample ExpirableLruCache]
   using Key = std::string;
@@ -357,6 +523,89 @@ UTEST(ExpirableLruCache, Example) {
   /// [Sample ExpirableLruCache]
 }
 
+UTEST(ExpirableLruCache, GetMany) {
+  auto requested_keys = std::make_shared<std::vector<SimpleCacheKey>>();
+
+  SimpleCache cache(4, 10);
+  cache.Put("cached", 42);
+
+  const std::vector<SimpleCacheKey> keys{"a", "cached", "bbb", "cc"};
+  EXPECT_EQ(cache.GetMany(keys, UpdateMany(requested_keys)),
+            (std::vector<SimpleCacheValue>{1, 42, 3, 2}));
+  // The missing keys are requested with a single call, in the order of 'keys'
+  EXPECT_EQ(*requested_keys, (std::vector<SimpleCacheKey>{"a", "bbb", "cc"}));
+
+  requested_keys->clear();
+  EXPECT_EQ(cache.GetMany(keys, UpdateMany(requested_keys)),
+            (std::vector<SimpleCacheValue>{1, 42, 3, 2}));
+  EXPECT_TRUE(requested_keys->empty());
+
+  const auto& stats = cache.GetStatistics();
+  EXPECT_EQ(5, stats.total.hits);
+  EXPECT_EQ(3, stats.total.misses);
+}
+
+UTEST(ExpirableLruCache, GetManySkipCache) {
+  auto requested_keys = std::make_shared<std::vector<SimpleCacheKey>>();
+  auto cache = CreateSimpleCache();
+
+  EXPECT_EQ(cache.GetMany({"a"}, UpdateMany(requested_keys),
+                          SimpleCache::ReadMode::kSkipCache),
+            std::vector<SimpleCacheValue>{1});
+  EXPECT_EQ(std::nullopt, cache.GetOptionalNoUpdate("a"));
+}
+
+UTEST(ExpirableLruCache, GetManyExpire) {
+  utils::datetime::MockNowSet(std::chrono::system_clock::now());
+  auto requested_keys = std::make_shared<std::vector<SimpleCacheKey>>();
+
+  SimpleCache cache(1, 10);
+  cache.SetMaxLifetime(std::chrono::seconds(3));
+
+  cache.GetMany({"a", "bb"}, UpdateMany(requested_keys));
+  utils::datetime::MockSleep(std::chrono::seconds(2));
+  cache.Put("a", 100);
+  utils::datetime::MockSleep(std::chrono::seconds(2));
+
+  requested_keys->clear();
+  EXPECT_EQ(cache.GetMany({"a", "bb"}, UpdateMany(requested_keys)),
+            (std::vector<SimpleCacheValue>{100, 2}));
+  EXPECT_EQ(*requested_keys, std::vector<SimpleCacheKey>{"bb"});
+}
+
+UTEST(ExpirableLruCache, PrefetchInBackground) {
+  auto requested_keys = std::make_shared<std::vector<SimpleCacheKey>>();
+
+  SimpleCache cache(4, 10);
+  cache.Put("cached", 42);
+
+  cache.PrefetchInBackground({"a", "cached", "bbb"},
+                             UpdateMany(requested_keys));
+  EngineYield();
+
+  EXPECT_EQ(*requested_keys, (std::vector<SimpleCacheKey>{"a", "bbb"}));
+  EXPECT_EQ(1, cache.GetOptionalNoUpdate("a"));
+  EXPECT_EQ(42, cache.GetOptionalNoUpdate("cached"));
+  EXPECT_EQ(3, cache.GetOptionalNoUpdate("bbb"));
+}
+
+UTEST(LruCacheWrapper, GetManyWrapper) {
+  auto counter = std::make_shared<Counter>();
+  auto requested_keys = std::make_shared<std::vector<SimpleCacheKey>>();
+
+  // Without a batch function the single-key one is called for each key
+  SimpleWrapper wrapper(CreateSimpleCachePtr(), UpdateValue(counter, 1));
+  EXPECT_EQ(wrapper.GetMany({"a", "b"}),
+            (std::vector<SimpleCacheValue>{1, 1}));
+  EXPECT_EQ(Counter(2), *counter);
+
+  SimpleWrapper batch_wrapper(std::make_shared<SimpleCache>(1, 10),
+                              UpdateNever(), UpdateMany(requested_keys));
+  EXPECT_EQ(batch_wrapper.GetMany({"a", "bb"}),
+            (std::vector<SimpleCacheValue>{1, 2}));
+  EXPECT_EQ(*requested_keys, (std::vector<SimpleCacheKey>{"a", "bb"}));
+}
+
 UTEST(LruCacheWrapper, HitWrapper) {
   auto counter = std::make_shared<Counter>();
 
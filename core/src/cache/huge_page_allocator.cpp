@@ -0,0 +1,101 @@
+#include <userver/cache/huge_page_allocator.hpp>
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+namespace {
+
+constexpr std::size_t kHugePageSize = 2 * 1024 * 1024;
+// Do not double the chunks endlessly, a few GiB cache would map twice of it
+constexpr std::size_t kMaxChunkSize = 512 * kHugePageSize;
+
+std::size_t RoundUp(std::size_t size, std::size_t alignment) noexcept {
+  return (size + alignment - 1) / alignment * alignment;
+}
+
+void* MapHugeTlb(std::size_t size) noexcept {
+#ifdef MAP_HUGETLB
+  void* data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  if (data != MAP_FAILED) return data;
+#else
+  static_cast<void>(size);
+#endif
+  return nullptr;
+}
+
+// Maps the regular pages aligned to a huge page, so that the transparent huge
+// pages could back the whole chunk
+void* MapTransparentHugePages(std::size_t size) {
+  const auto mapping_size = size + kHugePageSize;
+  void* mapping = ::mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (mapping == MAP_FAILED) throw std::bad_alloc();
+
+  auto* const begin = static_cast<std::byte*>(mapping);
+  const auto address = reinterpret_cast<std::uintptr_t>(begin);
+  const auto head = RoundUp(address, kHugePageSize) - address;
+  auto* const data = begin + head;
+  if (head != 0) ::munmap(begin, head);
+  if (mapping_size - head - size != 0) {
+    ::munmap(data + size, mapping_size - head - size);
+  }
+
+#ifdef MADV_HUGEPAGE
+  // Not fatal, e.g. the transparent huge pages are disabled
+  ::madvise(data, size, MADV_HUGEPAGE);
+#endif
+  return data;
+}
+
+}  // namespace
+
+HugePageArena::~HugePageArena() {
+  for (const auto& chunk : chunks_) ::munmap(chunk.data, chunk.size);
+}
+
+void* HugePageArena::Allocate(std::size_t size, std::size_t alignment) {
+  UASSERT(alignment != 0 && (alignment & (alignment - 1)) == 0);
+  UASSERT(alignment <= kHugePageSize);
+
+  const auto address = reinterpret_cast<std::uintptr_t>(free_begin_);
+  auto padding = RoundUp(address, alignment) - address;
+  if (free_begin_ == nullptr || padding + size > free_size_) {
+    MapChunk(size);
+    padding = 0;
+  }
+
+  auto* const result = free_begin_ + padding;
+  free_begin_ += padding + size;
+  free_size_ -= padding + size;
+  allocated_bytes_ += size;
+  return result;
+}
+
+void HugePageArena::MapChunk(std::size_t min_size) {
+  auto size = chunks_.empty()
+                  ? kHugePageSize
+                  : std::min(chunks_.back().size * 2, kMaxChunkSize);
+  size = std::max(size, RoundUp(min_size, kHugePageSize));
+  chunks_.reserve(chunks_.size() + 1);
+
+  void* data = MapHugeTlb(size);
+  if (!data) data = MapTransparentHugePages(size);
+
+  chunks_.push_back({data, size});
+  free_begin_ = static_cast<std::byte*>(data);
+  free_size_ = size;
+  mapped_bytes_ += size;
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
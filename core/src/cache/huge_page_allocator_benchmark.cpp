@@ -0,0 +1,54 @@
+#include <userver/cache/huge_page_allocator.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Item = std::pair<const std::uint64_t, std::uint64_t>;
+
+template <typename Allocator>
+using Map = std::unordered_map<std::uint64_t, std::uint64_t,
+                               std::hash<std::uint64_t>,
+                               std::equal_to<std::uint64_t>, Allocator>;
+
+using StdMap = Map<std::allocator<Item>>;
+using HugePageMap = Map<cache::HugePageAllocator<Item>>;
+
+// Random lookups in a cache snapshot, the TLB misses dominate for the big
+// ones
+//
+// state.range(0) - the size of the cache
+template <typename Map>
+void huge_page_allocator_lookup(benchmark::State& state) {
+  const auto size = static_cast<std::uint64_t>(state.range(0));
+
+  Map map;
+  map.reserve(size);
+  for (std::uint64_t i = 0; i < size; ++i) map.emplace(i, i);
+
+  std::uint64_t key = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    // A full period walk over the keys in a pseudo-random order
+    key = (key + 7919) % size;
+    benchmark::DoNotOptimize(map.find(key));
+  }
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(huge_page_allocator_lookup, StdMap)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 10'000'000);
+BENCHMARK_TEMPLATE(huge_page_allocator_lookup, HugePageMap)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 10'000'000);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,64 @@
+#include <userver/cache/huge_page_allocator.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/dump/common_containers.hpp>
+#include <userver/dump/test_helpers.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Map = std::unordered_map<
+    std::uint64_t, std::uint64_t, std::hash<std::uint64_t>,
+    std::equal_to<std::uint64_t>,
+    cache::HugePageAllocator<std::pair<const std::uint64_t, std::uint64_t>>>;
+
+}  // namespace
+
+TEST(HugePageAllocator, Map) {
+  constexpr std::uint64_t kSize = 100'000;
+  Map map;
+  map.reserve(kSize);
+  for (std::uint64_t i = 0; i < kSize; ++i) map.emplace(i, i * 2);
+
+  for (std::uint64_t i = 0; i < kSize; ++i) EXPECT_EQ(map.at(i), i * 2);
+
+  const auto& arena = *map.get_allocator().GetArena();
+  EXPECT_GE(arena.GetAllocatedBytes(), kSize * 2 * sizeof(std::uint64_t));
+  EXPECT_GE(arena.GetMappedBytes(), arena.GetAllocatedBytes());
+}
+
+TEST(HugePageAllocator, CopyGetsOwnArena) {
+  std::vector<int, cache::HugePageAllocator<int>> vector{1, 2, 3};
+  auto copy = vector;
+  EXPECT_EQ(copy, vector);
+  EXPECT_NE(copy.get_allocator(), vector.get_allocator());
+
+  auto moved = std::move(vector);
+  EXPECT_EQ(moved, copy);
+}
+
+TEST(HugePageAllocator, Alignment) {
+  cache::HugePageArena arena;
+  arena.Allocate(1, 1);
+  auto* const aligned = arena.Allocate(64, 64);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(aligned) % 64, 0);
+
+  // Bigger than a chunk
+  auto* const big = static_cast<char*>(arena.Allocate(5 << 20, 8));
+  big[(5 << 20) - 1] = 1;
+  EXPECT_GE(arena.GetMappedBytes(), 5 << 20);
+}
+
+TEST(HugePageAllocator, Dump) {
+  Map map;
+  for (std::uint64_t i = 0; i < 1000; ++i) map.emplace(i, i + 1);
+  dump::TestWriteReadCycle(map);
+}
+
+USERVER_NAMESPACE_END
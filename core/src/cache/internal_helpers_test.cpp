@@ -25,6 +25,7 @@ CacheDependencies MakeDependencies(std::string_view name,
       std::string{name},
       Config{config, dump_config},
       engine::current_task::GetTaskProcessor(),
+      engine::current_task::GetTaskProcessor(),
       environment.config_storage.GetSource(),
       environment.statistics_storage,
       environment.alerts_storage,
@@ -53,6 +53,16 @@ properties:
     ways:
         type: integer
         description: number of ways for associative cache
+    engine:
+        type: string
+        description: |
+            cache implementation: `nway-lru` - a mutex per way with exact LRU
+            eviction, `clock` - lock-free reads with CLOCK eviction, for
+            read-heavy caches with hot keys
+        enum:
+          - nway-lru
+          - clock
+        defaultDescription: nway-lru
     lifetime:
         type: string
         description: TTL for cache entries (0 is unlimited)
@@ -61,6 +71,37 @@ properties:
         type: boolean
         description: enables asynchronous updates for expiring values
         defaultDescription: false
+    admission:
+        type: string
+        description: |
+            admission of new items into a full cache: `none` - always evict
+            the least recently used item, `tiny-lfu` - evict it only if the
+            new item is accessed more frequently (protects the hot items
+            from scans)
+        enum:
+          - none
+          - tiny-lfu
+        defaultDescription: none
+    single-flight:
+        type: boolean
+        description: |
+            concurrent misses of the same key wait for a single update and
+            share its result
+        defaultDescription: false
+    early-refresh-beta:
+        type: number
+        description: |
+            a positive value makes the background updates start at a random
+            moment before the expiry, the larger the value the earlier;
+            0 starts them after a half of the lifetime
+        minimum: 0
+        defaultDescription: 0
+    stale-while-revalidate:
+        type: string
+        description: |
+            for how long after the expiry the cached value is returned while
+            being updated in background (0 is disabled)
+        defaultDescription: 0
     config-settings:
         type: boolean
         description: enables dynamic reconfiguration with CacheConfigSet
@@ -6,6 +6,8 @@
 #include <userver/dump/config.hpp>
 #include <userver/dynamic_config/value.hpp>
 #include <userver/utils/algo.hpp>
+#include <userver/utils/trivial_map.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -14,21 +16,71 @@ namespace cache {
 namespace {
 
 constexpr std::string_view kWays = "ways";
+constexpr std::string_view kEngine = "engine";
 constexpr std::string_view kSize = "size";
 constexpr std::string_view kLifetime = "lifetime";
 constexpr std::string_view kBackgroundUpdate = "background-update";
 constexpr std::string_view kLifetimeMs = "lifetime-ms";
+constexpr std::string_view kAdmission = "admission";
+constexpr std::string_view kSingleFlight = "single-flight";
+constexpr std::string_view kEarlyRefreshBeta = "early-refresh-beta";
+constexpr std::string_view kStaleWhileRevalidate = "stale-while-revalidate";
+constexpr std::string_view kStaleWhileRevalidateMs =
+    "stale-while-revalidate-ms";
+
+constexpr utils::TrivialBiMap kLruCacheAdmissionMap([](auto selector) {
+  return selector()
+      .Case(LruCacheAdmission::kAll, "none")
+      .Case(LruCacheAdmission::kTinyLfu, "tiny-lfu");
+});
+
+template <typename Value>
+LruCacheAdmission ParseAdmission(const Value& value) {
+  if (value.IsMissing()) return LruCacheAdmission::kAll;
+  return utils::ParseFromValueString(value, kLruCacheAdmissionMap);
+}
+
+template <typename Value>
+double ParseEarlyRefreshBeta(const Value& value) {
+  const auto beta = value.template As<double>(0);
+  if (beta < 0) throw std::runtime_error("early-refresh-beta is negative");
+  return beta;
+}
+
+constexpr utils::TrivialBiMap kLruCacheEngineMap([](auto selector) {
+  return selector()
+      .Case(LruCacheEngine::kNWayLru, "nway-lru")
+      .Case(LruCacheEngine::kClock, "clock");
+});
 
 }  // namespace
 
 using dump::impl::ParseMs;
 
+std::string_view ToString(LruCacheAdmission admission) {
+  return utils::impl::EnumToStringView(admission, kLruCacheAdmissionMap);
+}
+
+LruCacheEngine Parse(const yaml_config::YamlConfig& config,
+                     formats::parse::To<LruCacheEngine>) {
+  return utils::ParseFromValueString(config, kLruCacheEngineMap);
+}
+
+std::string_view ToString(LruCacheEngine engine) {
+  return utils::impl::EnumToStringView(engine, kLruCacheEngineMap);
+}
+
 LruCacheConfig::LruCacheConfig(const yaml_config::YamlConfig& config)
     : size(config[kSize].As<std::size_t>()),
       lifetime(config[kLifetime].As<std::chrono::milliseconds>(0)),
       background_update(config[kBackgroundUpdate].As<bool>(false)
                             ? BackgroundUpdateMode::kEnabled
-                            : BackgroundUpdateMode::kDisabled) {
+                            : BackgroundUpdateMode::kDisabled),
+      admission(ParseAdmission(config[kAdmission])),
+      single_flight(config[kSingleFlight].As<bool>(false)),
+      early_refresh_beta(ParseEarlyRefreshBeta(config[kEarlyRefreshBeta])),
+      stale_while_revalidate(
+          config[kStaleWhileRevalidate].As<std::chrono::milliseconds>(0)) {
   if (size == 0) throw std::runtime_error("cache-size is non-positive");
 }
 
@@ -40,7 +92,12 @@ LruCacheConfig::LruCacheConfig(const formats::json::Value& value)
       lifetime(ParseMs(value[kLifetimeMs])),
       background_update(value[kBackgroundUpdate].As<bool>(false)
                             ? BackgroundUpdateMode::kEnabled
-                            : BackgroundUpdateMode::kDisabled) {
+                            : BackgroundUpdateMode::kDisabled),
+      admission(ParseAdmission(value[kAdmission])),
+      single_flight(value[kSingleFlight].As<bool>(false)),
+      early_refresh_beta(ParseEarlyRefreshBeta(value[kEarlyRefreshBeta])),
+      stale_while_revalidate(ParseMs(value[kStaleWhileRevalidateMs],
+                                     std::chrono::milliseconds::zero())) {
   if (size == 0) throw std::runtime_error("cache-size is non-positive");
 }
 
@@ -58,6 +115,7 @@ LruCacheConfigStatic::LruCacheConfigStatic(
     const yaml_config::YamlConfig& config)
     : config(config),
       ways(config[kWays].As<std::size_t>()),
+      engine(config[kEngine].As<LruCacheEngine>(LruCacheEngine::kNWayLru)),
       use_dynamic_config(config["config-settings"].As<bool>(true)) {
   if (ways <= 0) throw std::runtime_error("cache-ways is non-positive");
 }
@@ -13,13 +13,17 @@ ExpirableLruCacheStatisticsBase::ExpirableLruCacheStatisticsBase(
     : hits(other.hits.load()),
       misses(other.misses.load()),
       stale(other.stale.load()),
-      background_updates(other.background_updates.load()) {}
+      background_updates(other.background_updates.load()),
+      admitted(other.admitted.load()),
+      rejected(other.rejected.load()) {}
 
 void ExpirableLruCacheStatisticsBase::Reset() {
   hits = 0;
   misses = 0;
   stale = 0;
   background_updates = 0;
+  admitted = 0;
+  rejected = 0;
 }
 
 ExpirableLruCacheStatisticsBase& ExpirableLruCacheStatisticsBase::operator+=(
@@ -28,6 +32,8 @@ ExpirableLruCacheStatisticsBase& ExpirableLruCacheStatisticsBase::operator+=(
   misses += other.misses.load();
   stale += other.stale.load();
   background_updates += other.background_updates.load();
+  admitted += other.admitted.load();
+  rejected += other.rejected.load();
   return *this;
 }
 
@@ -49,12 +55,25 @@ void CacheStale(ExpirableLruCacheStatistics& stats) {
   LOG_TRACE() << "stale cache";
 }
 
+void CacheAdmitted(ExpirableLruCacheStatistics& stats) {
+  ++stats.total.admitted;
+  ++stats.recent.GetCurrentCounter().admitted;
+}
+
+void CacheRejected(ExpirableLruCacheStatistics& stats) {
+  ++stats.total.rejected;
+  ++stats.recent.GetCurrentCounter().rejected;
+  LOG_TRACE() << "cache admission rejected";
+}
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const ExpirableLruCacheStatistics& stats) {
   writer["hits"] = stats.total.hits.load();
   writer["misses"] = stats.total.misses.load();
   writer["stale"] = stats.total.stale.load();
   writer["background-updates"] = stats.total.background_updates.load();
+  writer["admission"]["admitted"] = stats.total.admitted.load();
+  writer["admission"]["rejected"] = stats.total.rejected.load();
 
   auto s1min = stats.recent.GetStatsForPeriod();
   double s1min_hits = s1min.hits.load();
@@ -54,6 +54,17 @@ UTEST(NWayLRU, SetMultipleWays) {
   EXPECT_EQ(1, cache.Get(1));
 }
 
+UTEST(NWayLRU, GetMany) {
+  Cache cache(4, 10);
+  for (int i = 0; i < 10; ++i) cache.Put(i, i * 10);
+
+  const std::vector<int> keys{7, 100, 0, 3, 3, -1};
+  const std::vector<std::optional<int>> expected{70, std::nullopt, 0,
+                                                 30, 30, std::nullopt};
+  EXPECT_EQ(expected, cache.GetMany(keys));
+  EXPECT_TRUE(cache.GetMany({}).empty());
+}
+
 UTEST(NWayLRU, HashCombine) {
   for (const auto seed : std::vector<std::size_t>{0, 1, 7, 42, 100, 1000}) {
     /// @note: checking for seed used in way selection to not be equal after
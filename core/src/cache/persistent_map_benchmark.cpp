@@ -0,0 +1,57 @@
+#include <userver/cache/persistent_map.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::uint64_t kDeltaSize = 100;
+
+using StdMap = std::unordered_map<std::uint64_t, std::uint64_t>;
+using PersistentMap = cache::PersistentMap<std::uint64_t, std::uint64_t>;
+
+void Put(StdMap& map, std::uint64_t key, std::uint64_t value) {
+  map[key] = value;
+}
+
+void Put(PersistentMap& map, std::uint64_t key, std::uint64_t value) {
+  map.Put(key, value);
+}
+
+// An incremental cache update: a new snapshot with a few changed items
+//
+// state.range(0) - the size of the cache
+template <typename Map>
+void persistent_map_incremental_update(benchmark::State& state) {
+  const auto size = static_cast<std::uint64_t>(state.range(0));
+
+  Map snapshot;
+  for (std::uint64_t i = 0; i < size; ++i) Put(snapshot, i, i);
+
+  std::uint64_t offset = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    auto copy = snapshot;
+    for (std::uint64_t i = 0; i < kDeltaSize; ++i) {
+      Put(copy, (offset + i * 7919) % size, offset);
+    }
+    ++offset;
+    snapshot = std::move(copy);
+    benchmark::DoNotOptimize(snapshot);
+  }
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(persistent_map_incremental_update, StdMap)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000);
+BENCHMARK_TEMPLATE(persistent_map_incremental_update, PersistentMap)
+    ->RangeMultiplier(10)
+    ->Range(1'000, 1'000'000);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,151 @@
+#include <userver/cache/persistent_map.hpp>
+
+#include <map>
+#include <random>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations_mock.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Map = cache::PersistentMap<int, std::string>;
+
+// All the keys collide, exercises the deepest level of the trie
+struct BadHash final {
+  std::size_t operator()(int) const noexcept { return 42; }
+};
+
+template <typename PMap>
+std::map<int, std::string> ToStdMap(const PMap& map) {
+  std::map<int, std::string> result;
+  for (const auto& [key, value] : map) {
+    EXPECT_TRUE(result.emplace(key, value).second);
+  }
+  EXPECT_EQ(result.size(), map.size());
+  return result;
+}
+
+}  // namespace
+
+TEST(PersistentMap, PutGetErase) {
+  Map map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.Get(1), nullptr);
+  EXPECT_FALSE(map.Erase(1));
+  EXPECT_EQ(map.begin(), map.end());
+
+  EXPECT_TRUE(map.Put(1, "one"));
+  EXPECT_TRUE(map.Put(2, "two"));
+  EXPECT_FALSE(map.Put(1, "uno"));
+  EXPECT_EQ(map.size(), 2);
+  ASSERT_NE(map.Get(1), nullptr);
+  EXPECT_EQ(*map.Get(1), "uno");
+  EXPECT_EQ(*map.Get(2), "two");
+  EXPECT_FALSE(map.Contains(3));
+
+  EXPECT_TRUE(map.Erase(1));
+  EXPECT_FALSE(map.Erase(1));
+  EXPECT_EQ(map.size(), 1);
+  EXPECT_FALSE(map.Contains(1));
+  EXPECT_TRUE(map.Contains(2));
+
+  map.Clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_FALSE(map.Contains(2));
+}
+
+TEST(PersistentMap, CopiesAreIndependent) {
+  Map original;
+  for (int i = 0; i < 1000; ++i) original.Put(i, std::to_string(i));
+  const auto original_items = ToStdMap(original);
+
+  auto copy = original;
+  EXPECT_FALSE(copy.Put(10, "ten"));
+  EXPECT_TRUE(copy.Put(1000, "1000"));
+  EXPECT_TRUE(copy.Erase(20));
+
+  EXPECT_EQ(ToStdMap(original), original_items);
+  EXPECT_EQ(*original.Get(10), "10");
+  EXPECT_FALSE(original.Contains(1000));
+  EXPECT_TRUE(original.Contains(20));
+
+  EXPECT_EQ(*copy.Get(10), "ten");
+  EXPECT_EQ(*copy.Get(1000), "1000");
+  EXPECT_FALSE(copy.Contains(20));
+  EXPECT_EQ(copy.size(), 1000);
+}
+
+TEST(PersistentMap, MatchesStdMap) {
+  std::minstd_rand rng{42};
+  std::uniform_int_distribution<int> keys{0, 5000};
+
+  Map map;
+  std::map<int, std::string> expected;
+  auto snapshot = map;
+  auto expected_snapshot = expected;
+
+  for (int i = 0; i < 50000; ++i) {
+    const auto key = keys(rng);
+    if (i % 3 == 0) {
+      EXPECT_EQ(map.Erase(key), expected.erase(key) == 1);
+    } else {
+      const auto value = std::to_string(i);
+      EXPECT_EQ(map.Put(key, value), !expected.count(key));
+      expected[key] = value;
+    }
+
+    if (i % 5000 == 0) {
+      EXPECT_EQ(ToStdMap(snapshot), expected_snapshot);
+      snapshot = map;
+      expected_snapshot = expected;
+    }
+  }
+
+  EXPECT_EQ(ToStdMap(map), expected);
+  for (int key = 0; key <= 5000; ++key) {
+    const auto* value = map.Get(key);
+    const auto it = expected.find(key);
+    ASSERT_EQ(value != nullptr, it != expected.end());
+    if (value) {
+      EXPECT_EQ(*value, it->second);
+    }
+  }
+}
+
+TEST(PersistentMap, HashCollisions) {
+  cache::PersistentMap<int, std::string, BadHash> map;
+  for (int i = 0; i < 10; ++i) EXPECT_TRUE(map.Put(i, std::to_string(i)));
+  EXPECT_FALSE(map.Put(5, "five"));
+
+  auto copy = map;
+  EXPECT_TRUE(copy.Erase(3));
+  EXPECT_FALSE(copy.Contains(3));
+  EXPECT_TRUE(map.Contains(3));
+  EXPECT_EQ(*copy.Get(5), "five");
+
+  for (int i = 0; i < 10; ++i) copy.Erase(i);
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(ToStdMap(map).size(), 10);
+}
+
+TEST(PersistentMap, Dump) {
+  Map map;
+  for (int i = 0; i < 100; ++i) map.Put(i, std::to_string(i));
+
+  dump::MockWriter writer;
+  writer.Write(map);
+  writer.Finish();
+
+  dump::MockReader reader(std::move(writer).Extract());
+  const auto restored = reader.Read<Map>();
+  reader.Finish();
+
+  EXPECT_EQ(ToStdMap(restored), ToStdMap(map));
+}
+
+USERVER_NAMESPACE_END
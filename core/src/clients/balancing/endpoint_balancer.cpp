@@ -0,0 +1,169 @@
+#include <userver/clients/balancing/endpoint_balancer.hpp>
+
+#include <atomic>
+#include <utility>
+
+#include <boost/container/small_vector.hpp>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::balancing {
+
+namespace {
+
+using Clock = utils::datetime::SteadyClock;
+
+constexpr std::size_t kInlineEndpoints = 16;
+
+std::int64_t ToMicroseconds(Clock::time_point time_point) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             time_point.time_since_epoch())
+      .count();
+}
+
+}  // namespace
+
+struct EndpointBalancer::EndpointState final {
+  std::atomic<std::int64_t> in_flight{0};
+  // 0 if the endpoint has not replied yet
+  std::atomic<double> ewma_reply_time_us{0};
+  std::atomic<std::uint32_t> consecutive_failures{0};
+  std::atomic<std::int64_t> ejected_until_us{0};
+
+  // Endpoints without replies yet are compared by the in-flight count only
+  std::pair<double, std::int64_t> GetLoad() const noexcept {
+    const auto requests = in_flight.load(std::memory_order_relaxed);
+    return {ewma_reply_time_us.load(std::memory_order_relaxed) *
+                static_cast<double>(requests + 1),
+            requests};
+  }
+
+  bool IsEjected(std::int64_t now_us) const noexcept {
+    return ejected_until_us.load(std::memory_order_relaxed) > now_us;
+  }
+};
+
+EndpointBalancer::EndpointBalancer(EndpointBalancerSettings settings)
+    : settings_(settings) {
+  UINVARIANT(settings_.ewma_weight > 0 && settings_.ewma_weight <= 1,
+             "ewma_weight must be in (0, 1]");
+}
+
+EndpointBalancer::~EndpointBalancer() = default;
+
+EndpointBalancer::Lease EndpointBalancer::Pick(
+    utils::span<const std::string> endpoints) {
+  UINVARIANT(!endpoints.empty(), "No endpoints to pick from");
+
+  using Candidate = std::pair<std::size_t, std::shared_ptr<EndpointState>>;
+  boost::container::small_vector<Candidate, kInlineEndpoints> candidates;
+  candidates.reserve(endpoints.size());
+
+  const auto now_us = ToMicroseconds(Clock::now());
+  for (std::size_t i = 0; i < endpoints.size(); ++i) {
+    auto state = endpoints_[endpoints[i]];
+    if (!state->IsEjected(now_us)) {
+      candidates.emplace_back(i, std::move(state));
+    }
+  }
+  if (candidates.empty()) {
+    // All the endpoints are ejected, ejection makes no sense then
+    for (std::size_t i = 0; i < endpoints.size(); ++i) {
+      candidates.emplace_back(i, endpoints_[endpoints[i]]);
+    }
+  }
+
+  auto* picked = &candidates.front();
+  if (candidates.size() > 1) {
+    const auto first = utils::RandRange(candidates.size());
+    auto second = utils::RandRange(candidates.size() - 1);
+    if (second >= first) ++second;
+
+    picked = &candidates[first];
+    if (candidates[second].second->GetLoad() < picked->second->GetLoad()) {
+      picked = &candidates[second];
+    }
+  }
+
+  return Lease{settings_, std::move(picked->second), picked->first};
+}
+
+EndpointBalancer::Lease::Lease() noexcept = default;
+
+EndpointBalancer::Lease::Lease(const EndpointBalancerSettings& settings,
+                               std::shared_ptr<EndpointState> state,
+                               std::size_t index) noexcept
+    : settings_(&settings),
+      state_(std::move(state)),
+      index_(index),
+      start_(Clock::now()) {
+  state_->in_flight.fetch_add(1, std::memory_order_relaxed);
+}
+
+EndpointBalancer::Lease::Lease(Lease&& other) noexcept
+    : settings_(other.settings_),
+      state_(std::move(other.state_)),
+      index_(other.index_),
+      start_(other.start_) {}
+
+EndpointBalancer::Lease& EndpointBalancer::Lease::operator=(
+    Lease&& other) noexcept {
+  if (this == &other) return *this;
+  Release();
+  settings_ = other.settings_;
+  state_ = std::move(other.state_);
+  index_ = other.index_;
+  start_ = other.start_;
+  return *this;
+}
+
+EndpointBalancer::Lease::~Lease() { Release(); }
+
+void EndpointBalancer::Lease::Finish(bool success) noexcept {
+  if (!state_) return;
+  UASSERT(settings_);
+  const auto now = Clock::now();
+
+  if (success) {
+    state_->consecutive_failures.store(0, std::memory_order_relaxed);
+
+    const auto reply_time_us = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::microseconds>(now - start_)
+            .count());
+    auto average = state_->ewma_reply_time_us.load(std::memory_order_relaxed);
+    double updated = 0;
+    do {
+      updated = average == 0 ? reply_time_us
+                             : average + settings_->ewma_weight *
+                                             (reply_time_us - average);
+    } while (!state_->ewma_reply_time_us.compare_exchange_weak(
+        average, updated, std::memory_order_relaxed));
+  } else {
+    // Fast failures must not attract the load, so the reply time of failed
+    // requests is not accounted
+    const auto failures =
+        state_->consecutive_failures.fetch_add(1, std::memory_order_relaxed);
+    if (failures + 1 >= settings_->ejection_failures) {
+      state_->consecutive_failures.store(0, std::memory_order_relaxed);
+      state_->ejected_until_us.store(
+          ToMicroseconds(now + settings_->ejection_time),
+          std::memory_order_relaxed);
+    }
+  }
+
+  Release();
+}
+
+void EndpointBalancer::Lease::Release() noexcept {
+  if (!state_) return;
+  state_->in_flight.fetch_sub(1, std::memory_order_relaxed);
+  state_.reset();
+}
+
+}  // namespace clients::balancing
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,109 @@
+#include <userver/clients/balancing/endpoint_balancer.hpp>
+
+#include <vector>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using clients::balancing::EndpointBalancer;
+using clients::balancing::EndpointBalancerSettings;
+
+const std::vector<std::string> kEndpoints{"10.0.0.1:80", "10.0.0.2:80",
+                                          "10.0.0.3:80"};
+
+}  // namespace
+
+UTEST(EndpointBalancer, Sample) {
+  /// [Sample EndpointBalancer]
+  EndpointBalancer balancer;
+
+  auto lease = balancer.Pick(kEndpoints);
+  const auto& endpoint = kEndpoints[lease.GetIndex()];
+  // ... send the request to `endpoint` ...
+  const bool success = !endpoint.empty();
+  lease.Finish(success);
+  /// [Sample EndpointBalancer]
+}
+
+UTEST(EndpointBalancer, SingleEndpoint) {
+  EndpointBalancer balancer;
+  const std::vector<std::string> endpoints{"10.0.0.1:80"};
+
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(balancer.Pick(endpoints).GetIndex(), 0);
+  }
+}
+
+UTEST(EndpointBalancer, PrefersLessRequestsInFlight) {
+  EndpointBalancer balancer;
+  const std::vector<std::string> endpoints{kEndpoints[0], kEndpoints[1]};
+
+  // Two endpoints are always compared with each other
+  for (int i = 0; i < 10; ++i) {
+    const auto first = balancer.Pick(endpoints);
+    const auto second = balancer.Pick(endpoints);
+    EXPECT_NE(first.GetIndex(), second.GetIndex());
+  }
+}
+
+UTEST(EndpointBalancer, PrefersFasterEndpoint) {
+  EndpointBalancer balancer;
+  const std::vector<std::string> endpoints{kEndpoints[0], kEndpoints[1]};
+
+  auto first = balancer.Pick(endpoints);
+  auto second = balancer.Pick(endpoints);
+  ASSERT_NE(first.GetIndex(), second.GetIndex());
+  const auto fast_index = first.GetIndex();
+  first.Finish(true);
+  engine::SleepFor(std::chrono::milliseconds{20});
+  second.Finish(true);
+
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(balancer.Pick(endpoints).GetIndex(), fast_index);
+  }
+}
+
+UTEST(EndpointBalancer, EjectsFailingEndpoint) {
+  EndpointBalancerSettings settings;
+  settings.ejection_failures = 2;
+  settings.ejection_time = utest::kMaxTestWaitTime;
+  EndpointBalancer balancer{settings};
+
+  // Fail the first endpoint that gets picked
+  auto lease = balancer.Pick(kEndpoints);
+  const auto failing_index = lease.GetIndex();
+  lease.Finish(false);
+  for (int failures = 1; failures < 2;) {
+    auto next = balancer.Pick(kEndpoints);
+    if (next.GetIndex() == failing_index) {
+      next.Finish(false);
+      ++failures;
+    }
+  }
+
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_NE(balancer.Pick(kEndpoints).GetIndex(), failing_index);
+  }
+}
+
+UTEST(EndpointBalancer, AllEjected) {
+  EndpointBalancerSettings settings;
+  settings.ejection_failures = 1;
+  settings.ejection_time = utest::kMaxTestWaitTime;
+  EndpointBalancer balancer{settings};
+  const std::vector<std::string> endpoints{kEndpoints[0], kEndpoints[1]};
+
+  balancer.Pick(endpoints).Finish(false);
+  balancer.Pick(endpoints).Finish(false);
+
+  // Both endpoints are still picked
+  auto first = balancer.Pick(endpoints);
+  auto second = balancer.Pick(endpoints);
+  EXPECT_NE(first.GetIndex(), second.GetIndex());
+}
+
+USERVER_NAMESPACE_END
@@ -39,6 +39,12 @@ ResolverConfig ParseResolverConfig(
   config.cache_failure_ttl =
       component_config["cache_failure_ttl"].As<std::chrono::milliseconds>(
           config.cache_failure_ttl);
+  config.cache_max_stale_time =
+      component_config["cache-max-stale-time"].As<std::chrono::milliseconds>(
+          config.cache_max_stale_time);
+  config.cache_prefetch_interval =
+      component_config["cache-prefetch-interval"]
+          .As<std::chrono::milliseconds>(config.cache_prefetch_interval);
   return config;
 }
 
@@ -119,6 +125,14 @@ properties:
         type: string
         description: TTL for network failures caching
         defaultDescription: 5s
+    cache-max-stale-time:
+        type: string
+        description: how long expired network replies may be served while being updated
+        defaultDescription: 1h
+    cache-prefetch-interval:
+        type: string
+        description: interval of frequently requested names update before expiration, 0 to disable
+        defaultDescription: 1s
 )");
 }
 
@@ -2,22 +2,26 @@
 
 #include <arpa/inet.h>
 #include <netinet/in.h>
+#include <atomic>
 #include <cctype>
 #include <chrono>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include <clients/dns/file_resolver.hpp>
 #include <clients/dns/helpers.hpp>
 #include <clients/dns/net_resolver.hpp>
-#include <userver/cache/nway_lru_cache.hpp>
 #include <userver/clients/dns/exception.hpp>
 #include <userver/concurrent/mutex_set.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/rcu/rcu_map.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/from_string.hpp>
 #include <userver/utils/impl/wait_token_storage.hpp>
 #include <userver/utils/mock_now.hpp>
+#include <userver/utils/periodic_task.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -112,6 +116,11 @@ const AddrVector& LocalhostAddrs() {
   return kLocalhostAddrs;
 }
 
+std::chrono::steady_clock::rep ToTicks(
+    std::chrono::steady_clock::time_point time_point) {
+  return time_point.time_since_epoch().count();
+}
+
 }  // namespace
 
 enum class FailureMode { kIgnore, kCache };
@@ -145,6 +154,8 @@ class Resolver::Impl {
   auto GetUpdateMutex(const std::string& name);
   void AccountNetUpdateFailure();
 
+  void Prefetch();
+
   template <typename Mutex>
   AddrVector DoForegroundQuery(std::unique_lock<Mutex>& lock, Mutex&& mutex,
                                const std::string& name,
@@ -156,11 +167,30 @@ class Resolver::Impl {
 
  private:
   struct NetCacheEntry {
-    AddrVector addrs;
-    std::chrono::steady_clock::time_point expiration;
-    bool is_failure{false};
+    NetCacheEntry(AddrVector addrs,
+                  std::chrono::steady_clock::time_point expiration,
+                  bool is_failure)
+        : addrs(std::move(addrs)),
+          expiration(expiration),
+          is_failure(is_failure),
+          updated_at(utils::datetime::MockSteadyNow()),
+          last_used(ToTicks(updated_at)) {}
+
+    bool IsUsedSinceUpdate() const {
+      return last_used.load(std::memory_order_relaxed) > ToTicks(updated_at);
+    }
+
+    const AddrVector addrs;
+    const std::chrono::steady_clock::time_point expiration;
+    const bool is_failure;
+    const std::chrono::steady_clock::time_point updated_at;
+    // For LRU eviction and prefetch of popular names
+    std::atomic<std::chrono::steady_clock::rep> last_used;
   };
 
+  void PutNetCache(const std::string& name,
+                   std::shared_ptr<NetCacheEntry> entry);
+
   template <typename Mutex>
   void MoveQueryToBackground(std::unique_lock<Mutex>& lock, Mutex&& mutex,
                              engine::Future<NetResolver::Response>&& future,
@@ -178,9 +208,14 @@ class Resolver::Impl {
   const std::chrono::milliseconds net_cache_update_margin_;
   const std::chrono::milliseconds net_cache_max_reply_ttl_;
   const std::chrono::milliseconds net_cache_failure_ttl_;
-  cache::NWayLRU<std::string, NetCacheEntry> net_cache_;
+  const std::chrono::milliseconds net_cache_max_stale_time_;
+  const std::chrono::milliseconds net_cache_prefetch_interval_;
+  const size_t net_cache_max_size_;
+  // Lookups only read the current snapshot and never wait for updates
+  rcu::RcuMap<std::string, NetCacheEntry> net_cache_;
   concurrent::MutexSet<std::string> net_cache_update_mutexes_;
   utils::impl::WaitTokenStorage wait_token_storage_;
+  utils::PeriodicTask prefetch_task_;
 };
 
 Resolver::Impl::Impl(engine::TaskProcessor& fs_task_processor,
@@ -192,10 +227,23 @@ Resolver::Impl::Impl(engine::TaskProcessor& fs_task_processor,
       net_cache_update_margin_{config.network_timeout},
       net_cache_max_reply_ttl_{config.cache_max_reply_ttl},
       net_cache_failure_ttl_{config.cache_failure_ttl},
-      net_cache_{config.cache_ways, config.cache_size_per_way},
-      net_cache_update_mutexes_(config.cache_ways) {}
+      net_cache_max_stale_time_{config.cache_max_stale_time},
+      net_cache_prefetch_interval_{config.cache_prefetch_interval},
+      net_cache_max_size_{config.cache_ways * config.cache_size_per_way},
+      net_cache_update_mutexes_(config.cache_ways) {
+  UINVARIANT(net_cache_max_size_ > 0, "Network cache size must be positive");
+  if (net_cache_prefetch_interval_.count() > 0) {
+    prefetch_task_.Start(
+        "dns-resolver-prefetch",
+        utils::PeriodicTask::Settings{net_cache_prefetch_interval_, {}},
+        [this] { Prefetch(); });
+  }
+}
 
-Resolver::Impl::~Impl() { wait_token_storage_.WaitForAllTokens(); }
+Resolver::Impl::~Impl() {
+  prefetch_task_.Stop();
+  wait_token_storage_.WaitForAllTokens();
+}
 
 const Resolver::LookupSourceCounters& Resolver::Impl::GetLookupSourceCounters()
     const {
@@ -204,10 +252,10 @@ const Resolver::LookupSourceCounters& Resolver::Impl::GetLookupSourceCounters()
 
 void Resolver::Impl::ReloadHosts() { file_resolver_.ReloadHosts(); }
 
-void Resolver::Impl::FlushNetworkCache() { net_cache_.Invalidate(); }
+void Resolver::Impl::FlushNetworkCache() { net_cache_.Clear(); }
 
 void Resolver::Impl::FlushNetworkCache(const std::string& name) {
-  net_cache_.InvalidateByKey(name);
+  net_cache_.Erase(name);
 }
 
 AddrVector Resolver::Impl::QueryFileCache(const std::string& name) {
@@ -225,6 +273,7 @@ Resolver::Impl::NetCacheResult Resolver::Impl::QueryNetCache(
   const auto now = utils::datetime::MockSteadyNow();
   const auto cached = net_cache_.Get(name);
   if (!cached) return result;
+  cached->last_used.store(ToTicks(now), std::memory_order_relaxed);
 
   if (cached->is_failure) {
     if (cached->expiration >= now) {
@@ -234,6 +283,11 @@ Resolver::Impl::NetCacheResult Resolver::Impl::QueryNetCache(
     return result;
   }
 
+  if (cached->expiration + net_cache_max_stale_time_ < now) {
+    // too stale to be served even if the name servers are unavailable
+    return result;
+  }
+
   result.addrs = cached->addrs;
   if (cached->expiration >= now) {
     ++source_counters_.cached;
@@ -258,6 +312,61 @@ void Resolver::Impl::AccountNetUpdateFailure() {
   ++source_counters_.network_failure;
 }
 
+// Refreshes the names that were looked up since their last update before they
+// expire, and drops the entries that can no longer be served.
+void Resolver::Impl::Prefetch() {
+  const auto now = utils::datetime::MockSteadyNow();
+  const auto prefetch_margin =
+      net_cache_update_margin_ + net_cache_prefetch_interval_;
+
+  std::vector<std::pair<std::string, std::shared_ptr<const NetCacheEntry>>>
+      expired;
+  for (const auto& [name, entry] : std::as_const(net_cache_)) {
+    const auto max_stale_time =
+        entry->is_failure ? std::chrono::milliseconds::zero()
+                          : net_cache_max_stale_time_;
+    if (entry->expiration + max_stale_time < now) {
+      expired.emplace_back(name, entry);
+      continue;
+    }
+
+    if (entry->is_failure || !entry->IsUsedSinceUpdate() ||
+        entry->expiration - now >= prefetch_margin) {
+      continue;
+    }
+    auto mutex = GetUpdateMutex(name);
+    std::unique_lock lock{mutex, std::defer_lock};
+    StartBackgroundQuery(lock, std::move(mutex), name);
+  }
+
+  if (expired.empty()) return;
+  auto txn = net_cache_.StartWrite();
+  for (const auto& [name, entry] : expired) {
+    const auto it = txn->find(name);
+    // the entry might have been updated in the meantime
+    if (it != txn->end() && it->second == entry) txn->erase(it);
+  }
+  txn.Commit();
+}
+
+void Resolver::Impl::PutNetCache(const std::string& name,
+                                 std::shared_ptr<NetCacheEntry> entry) {
+  auto txn = net_cache_.StartWrite();
+  if (txn->size() >= net_cache_max_size_ && !txn->count(name)) {
+    auto lru = txn->begin();
+    for (auto it = txn->begin(); it != txn->end(); ++it) {
+      if (it->second->last_used.load(std::memory_order_relaxed) <
+          lru->second->last_used.load(std::memory_order_relaxed)) {
+        lru = it;
+      }
+    }
+    LOG_TRACE() << "Evicting '" << lru->first << "' from cache";
+    txn->erase(lru);
+  }
+  txn->insert_or_assign(name, std::move(entry));
+  txn.Commit();
+}
+
 template <typename Mutex>
 AddrVector Resolver::Impl::DoForegroundQuery(std::unique_lock<Mutex>& lock,
                                              Mutex&& mutex,
@@ -336,10 +445,11 @@ void Resolver::Impl::FinishNetUpdate(
     LOG_LIMITED_ERROR() << "Resolving of '" << name << "' failed: " << ex;
     if (failure_mode == FailureMode::kCache) {
       LOG_TRACE() << "Caching failure for '" << name << '\'';
-      net_cache_.Put(name, NetCacheEntry{{},
-                                         utils::datetime::MockSteadyNow() +
-                                             net_cache_failure_ttl_,
-                                         true});
+      PutNetCache(name, std::make_shared<NetCacheEntry>(
+                            AddrVector{},
+                            utils::datetime::MockSteadyNow() +
+                                net_cache_failure_ttl_,
+                            true));
     }
     ++source_counters_.network_failure;
     throw;
@@ -352,9 +462,10 @@ void Resolver::Impl::FinishNetUpdate(
   if (addrs) *addrs = response.addrs;
   if (effective_ttl.count() > 0) {
     LOG_TRACE() << "Updating cache for '" << name << '\'';
-    net_cache_.Put(
-        name, NetCacheEntry{std::move(response.addrs),
-                            utils::datetime::MockSteadyNow() + effective_ttl});
+    PutNetCache(name, std::make_shared<NetCacheEntry>(
+                          std::move(response.addrs),
+                          utils::datetime::MockSteadyNow() + effective_ttl,
+                          false));
   } else {
     LOG_TRACE() << "Skipping cache update for '" << name << '\'';
   }
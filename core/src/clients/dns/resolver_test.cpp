@@ -58,7 +58,9 @@ constexpr auto kNetV6String{"2a02:6b8:a::a"};
 struct MockedResolver {
   using ServerMock = utest::DnsServerMock;
 
-  MockedResolver(size_t cache_max_ttl, size_t cache_size_per_way)
+  MockedResolver(size_t cache_max_ttl, size_t cache_size_per_way,
+                 std::chrono::milliseconds prefetch_interval =
+                     utest::kMaxTestWaitTime)
       : hosts_file{[] {
           auto file = fs::blocking::TempFile::Create();
           fs::blocking::RewriteFileContents(file.GetPath(), kTestHosts);
@@ -87,6 +89,7 @@ struct MockedResolver {
               config.cache_failure_ttl = std::chrono::seconds{cache_max_ttl},
               config.cache_ways = 1;
               config.cache_size_per_way = cache_size_per_way;
+              config.cache_prefetch_interval = prefetch_interval;
               config.network_custom_servers = {server_mock.GetServerAddress()};
               return config;
             }()} {}
@@ -399,6 +402,64 @@ UTEST(Resolver, CacheStale) {
   EXPECT_EQ(counters.network_failure, 0);
 }
 
+UTEST(Resolver, CacheStaleLimit) {
+  const auto test_deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  MockedResolver resolver{1, 1};
+
+  utils::datetime::MockNowSet({});
+
+  EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("first", test_deadline),
+                      (Expected{kNetV6String, kNetV4String}));
+
+  // default max stale time is exceeded, the name is resolved in foreground
+  utils::datetime::MockSleep(std::chrono::hours{2});
+
+  EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("first", test_deadline),
+                      (Expected{kNetV6String, kNetV4String}));
+
+  const auto& counters = resolver->GetLookupSourceCounters();
+  EXPECT_EQ(counters.cached, 0);
+  EXPECT_EQ(counters.cached_stale, 0);
+  EXPECT_EQ(counters.network, 2);
+  EXPECT_EQ(counters.network_failure, 0);
+}
+
+UTEST(Resolver, CachePrefetch) {
+  const auto test_deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  MockedResolver resolver{1000, 1, std::chrono::milliseconds{10}};
+
+  utils::datetime::MockNowSet({});
+
+  EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("first", test_deadline),
+                      (Expected{kNetV6String, kNetV4String}));
+
+  // the name is requested again, so it is updated before the expiration
+  utils::datetime::MockSleep(std::chrono::seconds{1});
+  EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("first", test_deadline),
+                      (Expected{kNetV6String, kNetV4String}));
+  utils::datetime::MockSleep(std::chrono::seconds{998});
+
+  const auto& counters = resolver->GetLookupSourceCounters();
+  while (counters.network < 2 && !test_deadline.IsReached()) {
+    engine::SleepFor(std::chrono::milliseconds{10});
+  }
+  EXPECT_EQ(counters.network, 2);
+
+  utils::datetime::MockSleep(std::chrono::seconds{2});
+  EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("first", test_deadline),
+                      (Expected{kNetV6String, kNetV4String}));
+
+  EXPECT_EQ(counters.file, 0);
+  EXPECT_EQ(counters.cached, 2);
+  EXPECT_EQ(counters.cached_stale, 0);
+  EXPECT_EQ(counters.cached_failure, 0);
+  EXPECT_EQ(counters.network_failure, 0);
+}
+
 UTEST(Resolver, CacheFailures) {
   const auto test_deadline =
       engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
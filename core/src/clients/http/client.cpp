@@ -6,6 +6,7 @@
 
 #include <moodycamel/concurrentqueue.h>
 
+#include <userver/clients/balancing/endpoint_balancer.hpp>
 #include <userver/crypto/openssl.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/manager.hpp>
@@ -19,6 +20,7 @@
 #include <clients/http/testsuite.hpp>
 #include <curl-ev/multi.hpp>
 #include <curl-ev/ratelimit.hpp>
+#include <curl-ev/share.hpp>
 #include <engine/ev/thread_pool.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -48,6 +50,10 @@ Client::Client(ClientSettings settings,
                impl::PluginPipeline&& plugin_pipeline)
     : deadline_propagation_config_(settings.deadline_propagation),
       cancellation_policy_(settings.cancellation_policy),
+      destination_affinity_(settings.destination_affinity),
+      endpoint_balancing_(settings.endpoint_balancing),
+      endpoint_balancer_(
+          std::make_unique<clients::balancing::EndpointBalancer>()),
       destination_statistics_(std::make_shared<DestinationStatistics>()),
       statistics_(settings.io_threads),
       fs_task_processor_(fs_task_processor),
@@ -70,6 +76,13 @@ Client::Client(ClientSettings settings,
 
   multis_.reserve(io_threads);
 
+  if (settings.shared_caches || settings.shared_connections) {
+    share_ = std::make_shared<curl::share>();
+    share_->set_share_ssl_session(true);
+    share_->set_share_dns(true);
+    share_->set_share_connect(settings.shared_connections);
+  }
+
   // libcurl synchronously reads some of /etc/* files.
   // As we want httpclient to be non-blocking, we have to shift curl's init code
   // to a fs task processor.
@@ -115,6 +128,7 @@ Request Client::CreateRequest() {
   auto request = [this] {
     auto easy = TryDequeueIdle();
     if (easy) {
+      if (share_) easy->set_share(share_);
       auto idx = FindMultiIndex(easy->GetMulti());
       auto wrapper = impl::EasyWrapper{std::move(easy), *this};
       return Request{
@@ -127,8 +141,9 @@ Request Client::CreateRequest() {
 
       try {
         auto wrapper = engine::AsyncNoSpan(fs_task_processor_, [this, &multi] {
-                         return impl::EasyWrapper{
-                             easy_.Get()->GetBoundBlocking(*multi), *this};
+                         auto easy = easy_.Get()->GetBoundBlocking(*multi);
+                         if (share_) easy->set_share(share_);
+                         return impl::EasyWrapper{std::move(easy), *this};
                        }).Get();
         return Request{
             std::move(wrapper),      statistics_[i].CreateRequestStats(),
@@ -180,6 +195,19 @@ void Client::SetMaxHostConnections(size_t max_host_connections) {
   }
 }
 
+void Client::SetDestinationAffinityEnabled(bool enabled) {
+  destination_affinity_ = enabled;
+}
+
+void Client::SetEndpointBalancingEnabled(bool enabled) {
+  endpoint_balancing_ = enabled;
+}
+
+clients::balancing::EndpointBalancer* Client::GetEndpointBalancer() noexcept {
+  if (!endpoint_balancing_.load(std::memory_order_relaxed)) return nullptr;
+  return endpoint_balancer_.get();
+}
+
 std::string Client::GetProxy() const { return proxy_.ReadCopy(); }
 
 void Client::SetDnsResolver(clients::dns::Resolver* resolver) {
@@ -233,6 +261,14 @@ const DestinationStatistics& Client::GetDestinationStatistics() const {
   return *destination_statistics_;
 }
 
+void Client::AccountCoalescedRequest(const std::string& destination) {
+  destination_statistics_->AccountCoalescedRequest(destination);
+}
+
+void Client::AccountHedgedRequest(const std::string& destination) {
+  destination_statistics_->AccountHedgedRequest(destination);
+}
+
 void Client::PushIdleEasy(std::shared_ptr<curl::easy>&& easy) noexcept {
   try {
     easy->reset();
@@ -244,6 +280,17 @@ void Client::PushIdleEasy(std::shared_ptr<curl::easy>&& easy) noexcept {
   DecPending();
 }
 
+void Client::BindToDestination(curl::easy& easy,
+                               std::size_t destination_hash) noexcept {
+  if (!destination_affinity_.load(std::memory_order_relaxed)) return;
+
+  // All the requests to a destination go through a single multi, so they
+  // share its connections (and HTTP/2 streams) instead of opening a
+  // connection per multi.
+  auto& multi = *multis_[destination_hash % multis_.size()];
+  if (easy.GetMulti() != &multi) easy.Rebind(multi);
+}
+
 std::shared_ptr<curl::easy> Client::TryDequeueIdle() noexcept {
   std::shared_ptr<curl::easy> result;
   if (!idle_queue_->try_dequeue(result)) {
@@ -11,6 +11,7 @@
 #include <engine/task/task_processor.hpp>
 #include <userver/clients/dns/resolver.hpp>
 #include <userver/clients/http/connect_to.hpp>
+#include <userver/clients/http/request_template.hpp>
 #include <userver/clients/http/request_tracing_editor.hpp>
 #include <userver/clients/http/streamed_response.hpp>
 #include <userver/concurrent/queue.hpp>
@@ -19,6 +20,7 @@
 #include <userver/engine/async.hpp>
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
+#include <userver/formats/json/serialize.hpp>
 #include <userver/fs/blocking/temp_file.hpp>
 #include <userver/fs/blocking/write.hpp>
 #include <userver/http/common_headers.hpp>
@@ -757,6 +759,36 @@ UTEST(HttpClient, CancelRetries) {
          "cancellation";
 }
 
+UTEST(HttpClient, StreamJson) {
+  const utest::SimpleServer http_server{EchoCallback{}};
+  auto http_client_ptr = utest::CreateHttpClient();
+
+  std::string data = R"({"items":[)";
+  for (unsigned i = 0; i < 10000; ++i) {
+    data += fmt::format(R"({{"id":{},"name":"item-{}"}},)", i, i);
+  }
+  data += R"({"id":-1}]})";
+
+  /// [HTTP Client - stream JSON]
+  auto queue = concurrent::StringStreamQueue::Create();
+  auto stream_response = http_client_ptr->CreateRequest()
+                             .post(http_server.GetBaseUrl(), data)
+                             .retry(1)
+                             .http_version(clients::http::HttpVersion::k11)
+                             .timeout(kTimeout)
+                             .async_perform_stream_body(queue);
+  ASSERT_EQ(stream_response.StatusCode(), clients::http::Status::OK);
+
+  const auto deadline = engine::Deadline::FromDuration(kTimeout);
+  const auto json = formats::json::FromChunks([&](std::string& chunk) {
+    return stream_response.ReadChunk(chunk, deadline);
+  });
+  /// [HTTP Client - stream JSON]
+
+  EXPECT_EQ(json["items"].GetSize(), 10001);
+  EXPECT_EQ(json["items"][9999]["name"].As<std::string>(), "item-9999");
+}
+
 UTEST(HttpClient, PostShutdownWithPendingRequest) {
   const utest::SimpleServer http_server{&sleep_callback};
   auto http_client_ptr = utest::CreateHttpClient();
@@ -1088,6 +1120,49 @@ UTEST(HttpClient, HeadersUserAgent) {
   EXPECT_TRUE(response->IsOk());
 }
 
+UTEST(HttpClient, RequestTemplate) {
+  const utest::SimpleServer http_server{&header_validate_callback};
+  const utest::SimpleServer http_server_ua{&user_agent_validate_callback};
+  const utest::SimpleServer http_echo_server{EchoCallback{}};
+  auto http_client_ptr = utest::CreateHttpClient();
+
+  const auto request_template =
+      clients::http::RequestTemplate{}
+          .post()
+          .url(http_server.GetBaseUrl())
+          .headers({{kTestHeader, "test"},
+                    {http::headers::kUserAgent, kTestUserAgent}})
+          .retry(1)
+          .http_version(clients::http::HttpVersion::k11)
+          .timeout(kTimeout);
+  const auto data = std::make_shared<const std::string>(kTestData);
+
+  for (unsigned i = 0; i < kRepetitions; ++i) {
+    auto response = http_client_ptr->CreateRequest()
+                        .ApplyTemplate(request_template)
+                        .data(data)
+                        .perform();
+    EXPECT_TRUE(response->IsOk());
+
+    response = http_client_ptr->CreateRequest()
+                   .ApplyTemplate(request_template)
+                   .url(http_server_ua.GetBaseUrl())
+                   .data(data)
+                   .perform();
+    EXPECT_TRUE(response->IsOk());
+
+    auto request = http_client_ptr->CreateRequest()
+                       .ApplyTemplate(request_template)
+                       .url(http_echo_server.GetBaseUrl())
+                       .data(data);
+    EXPECT_EQ(request.perform()->body(), kTestData);
+    EXPECT_EQ(request.GetData(), kTestData);
+    EXPECT_EQ(request.ExtractData(), kTestData);
+  }
+
+  EXPECT_EQ(*data, kTestData);
+}
+
 UTEST(HttpClient, Cookies) {
   const auto test = [](const clients::http::Request::Cookies& cookies,
                        std::set<std::string> expected) {
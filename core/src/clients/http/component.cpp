@@ -203,12 +203,28 @@ properties:
         type: integer
         description: number of threads to process low level HTTP related IO system calls
         defaultDescription: 8
+    destination-affinity:
+        type: boolean
+        description: send all the requests to a host through the same IO thread, so that they share the connections and HTTP/2 streams instead of opening connections in each thread
+        defaultDescription: false
+    endpoint-balancing:
+        type: boolean
+        description: if the host resolves to several addresses, pick one by power of two choices on in-flight requests and reply times, keeping separate connections to each address and ejecting the failing ones; requires dns_resolver 'async'
+        defaultDescription: false
+    shared-caches:
+        type: boolean
+        description: share the TLS sessions and the DNS cache between the IO threads, so that a TLS session to a host established in one thread is resumed in the others instead of a full handshake
+        defaultDescription: false
+    shared-connections:
+        type: boolean
+        description: share the connection cache between the IO threads too, a connection to a host is reused by the requests of any thread
+        defaultDescription: false
     fs-task-processor:
         type: string
         description: task processor to run blocking HTTP related calls, like DNS resolving or hosts reading
     destination-metrics-auto-max-size:
         type: integer
-        description: set max number of automatically created destination metrics
+        description: set max number of automatically created destination metrics, the less used destinations are accounted as "other"
         defaultDescription: 100
     user-agent:
         type: string
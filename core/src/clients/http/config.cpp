@@ -54,6 +54,14 @@ ClientSettings Parse(const yaml_config::YamlConfig& value,
       value["thread-name-prefix"].As<std::string>(result.thread_name_prefix);
   result.io_threads = value["threads"].As<size_t>(result.io_threads);
   result.deadline_propagation = ParseDeadlinePropagationConfig(value);
+  result.destination_affinity =
+      value["destination-affinity"].As<bool>(result.destination_affinity);
+  result.endpoint_balancing =
+      value["endpoint-balancing"].As<bool>(result.endpoint_balancing);
+  result.shared_caches =
+      value["shared-caches"].As<bool>(result.shared_caches);
+  result.shared_connections =
+      value["shared-connections"].As<bool>(result.shared_connections);
   return result;
 }
 
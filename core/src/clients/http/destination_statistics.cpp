@@ -1,5 +1,11 @@
 #include <clients/http/destination_statistics.hpp>
 
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
 #include <userver/logging/log.hpp>
 #include <userver/utils/statistics/writer.hpp>
 
@@ -7,6 +13,16 @@ USERVER_NAMESPACE_BEGIN
 
 namespace clients::http {
 
+namespace {
+
+// Misses of rcu_map_ between the rebalances, per automatic destination
+constexpr std::uint64_t kWindowMissesPerDestination = 64;
+
+// Space-Saving candidates per automatic destination
+constexpr std::size_t kCandidatesPerDestination = 2;
+
+}  // namespace
+
 std::shared_ptr<RequestStats>
 DestinationStatistics::GetStatisticsForDestination(
     const std::string& destination) {
@@ -19,19 +35,17 @@ DestinationStatistics::GetStatisticsForDestination(
 std::shared_ptr<RequestStats>
 DestinationStatistics::CreateStatisticsForDestination(
     const std::string& destination) {
-  return std::make_shared<RequestStats>(*rcu_map_[destination]);
+  return std::make_shared<RequestStats>(rcu_map_[destination]);
 }
 
 std::shared_ptr<RequestStats>
 DestinationStatistics::GetExistingStatisticsForDestination(
     const std::string& destination) {
-  /*
-   * It's safe to return RequestStats holding a reference to Statistics as
-   * RequestStats lifetime is less than clients::http::Client's one.
-   */
+  // RequestStats holds the automatic destination statistics alive in case
+  // they are evicted by Rebalance()
   auto stats = rcu_map_.Get(destination);
   if (stats)
-    return std::make_shared<RequestStats>(*stats);
+    return std::make_shared<RequestStats>(std::move(stats));
   else
     return {};
 }
@@ -42,25 +56,127 @@ DestinationStatistics::GetStatisticsForDestinationAuto(
   auto ptr = GetExistingStatisticsForDestination(destination);
   if (ptr) return ptr;
 
-  // atomic [current++ iff current < max]
-  auto current_auto_destinations = current_auto_destinations_.load();
-  do {
-    if (current_auto_destinations >= max_auto_destinations_) {
-      if (max_auto_destinations_ != 0) {
-        LOG_LIMITED_WARNING()
-            << "Too many httpclient metrics destinations used ("
-            << max_auto_destinations_
-            << "), either increase "
-               "components.http-client.destination-metrics-auto-max-size "
-               "or explicitly set destination via "
-               "Request::SetDestinationMetricName().";
-      }
-      return {};
-    }
-  } while (!current_auto_destinations_.compare_exchange_strong(
-      current_auto_destinations, current_auto_destinations + 1));
+  if (max_auto_destinations_ == 0) return {};
+  return AccountAutoMiss(destination);
+}
 
-  return CreateStatisticsForDestination(destination);
+std::shared_ptr<RequestStats> DestinationStatistics::AccountAutoMiss(
+    const std::string& destination) {
+  std::unique_lock lock{auto_mutex_, std::try_to_lock};
+  // The long tail does not wait for the other misses, so a contended miss
+  // is not sampled
+  if (!lock) return std::make_shared<RequestStats>(other_);
+
+  if (auto stats = rcu_map_.Get(destination)) {
+    return std::make_shared<RequestStats>(std::move(stats));
+  }
+  if (auto_destinations_.size() < max_auto_destinations_) {
+    return CreateAutoDestination(destination);
+  }
+
+  LOG_LIMITED_WARNING()
+      << "Too many httpclient metrics destinations used ("
+      << max_auto_destinations_
+      << "), the less used ones are accounted as '" << kOtherDestination
+      << "'. Either increase "
+         "components.http-client.destination-metrics-auto-max-size "
+         "or explicitly set destination via "
+         "Request::SetDestinationMetricName().";
+
+  AccountCandidate(destination);
+  ++window_misses_;
+  if (window_misses_ >= max_auto_destinations_ * kWindowMissesPerDestination) {
+    Rebalance();
+  }
+  return std::make_shared<RequestStats>(other_);
+}
+
+std::shared_ptr<RequestStats> DestinationStatistics::CreateAutoDestination(
+    const std::string& destination) {
+  auto stats = rcu_map_[destination];
+  auto_destinations_.emplace(destination,
+                             AutoDestination{stats, /*window_start=*/0});
+  return std::make_shared<RequestStats>(std::move(stats));
+}
+
+void DestinationStatistics::AccountCandidate(const std::string& destination) {
+  const auto it = candidates_.find(destination);
+  if (it != candidates_.end()) {
+    ++it->second.count;
+    return;
+  }
+
+  if (candidates_.size() <
+      max_auto_destinations_ * kCandidatesPerDestination) {
+    candidates_.emplace(destination, Candidate{1, 0});
+    return;
+  }
+
+  // Space-Saving: the new destination replaces the least counted one and
+  // inherits its count as the possible overestimation
+  const auto min_it = std::min_element(
+      candidates_.begin(), candidates_.end(),
+      [](const auto& lhs, const auto& rhs) {
+        return lhs.second.count < rhs.second.count;
+      });
+  const auto min_count = min_it->second.count;
+  candidates_.erase(min_it);
+  candidates_.emplace(destination, Candidate{min_count + 1, min_count});
+}
+
+void DestinationStatistics::Rebalance() {
+  using Entry = std::pair<std::uint64_t, std::string>;
+
+  std::vector<Entry> coldest;
+  coldest.reserve(auto_destinations_.size());
+  for (const auto& [name, destination] : auto_destinations_) {
+    coldest.emplace_back(destination.stats->GetFinishedRequests() -
+                             destination.window_start_requests,
+                         name);
+  }
+  std::sort(coldest.begin(), coldest.end());
+
+  std::vector<Entry> hottest;
+  hottest.reserve(candidates_.size());
+  for (const auto& [name, candidate] : candidates_) {
+    hottest.emplace_back(candidate.count - candidate.error, name);
+  }
+  std::sort(hottest.begin(), hottest.end(), std::greater<>{});
+
+  const auto swaps = std::min(coldest.size(), hottest.size());
+  for (std::size_t i = 0; i < swaps; ++i) {
+    if (hottest[i].first <= coldest[i].first) break;
+    // Explicit destination with the same name was created meanwhile
+    if (rcu_map_.Get(hottest[i].second)) continue;
+
+    rcu_map_.Erase(coldest[i].second);
+    auto_destinations_.erase(coldest[i].second);
+    CreateAutoDestination(hottest[i].second);
+  }
+
+  candidates_.clear();
+  window_misses_ = 0;
+  for (auto& [name, destination] : auto_destinations_) {
+    destination.window_start_requests =
+        destination.stats->GetFinishedRequests();
+  }
+}
+
+void DestinationStatistics::AccountCoalescedRequest(
+    const std::string& destination) {
+  rcu_map_[destination]->AccountCoalescedRequest();
+}
+
+void DestinationStatistics::AccountHedgedRequest(
+    const std::string& destination) {
+  rcu_map_[destination]->AccountHedgedRequest();
+}
+
+std::optional<std::size_t> DestinationStatistics::GetTimingsPercentile(
+    const std::string& destination, double percent) const {
+  const auto stats = rcu_map_.Get(destination);
+  if (!stats) return std::nullopt;
+  return stats->GetTimingsPercentile(percent);
 }
 
 void DestinationStatistics::SetAutoMaxSize(size_t max_auto_destinations) {
@@ -84,6 +200,15 @@ void DumpMetric(utils::statistics::Writer& writer,
     writer.ValueWithLabels(DestinationStatisticsView{instance_stat},
                            {{"http_destination", url}, {"version", "2"}});
   }
+
+  const auto& other = stats.GetOtherStatistics();
+  if (other.GetFinishedRequests() != 0) {
+    const InstanceStatistics instance_stat{other};
+    writer.ValueWithLabels(
+        DestinationStatisticsView{instance_stat},
+        {{"http_destination", DestinationStatistics::kOtherDestination},
+         {"version", "2"}});
+  }
 }
 
 }  // namespace clients::http
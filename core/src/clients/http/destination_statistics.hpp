@@ -1,8 +1,13 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
 #include <unordered_map>
 
+#include <userver/engine/mutex.hpp>
 #include <userver/rcu/rcu_map.hpp>
 #include <userver/utils/statistics/fwd.hpp>
 
@@ -18,13 +23,29 @@ class DestinationStatistics final {
   std::shared_ptr<RequestStats> GetStatisticsForDestination(
       const std::string& destination);
 
-  // If max_auto_destinations reached, return nullptr, pointer to related
-  // RequestStats otherwise
+  // Returns nullptr if automatic destinations are disabled. Keeps at most
+  // max_auto_destinations of the heaviest automatic destinations, the requests
+  // to the rest are accounted in the kOtherDestination statistics.
   std::shared_ptr<RequestStats> GetStatisticsForDestinationAuto(
       const std::string& destination);
 
   void SetAutoMaxSize(size_t max_auto_destinations);
 
+  void AccountCoalescedRequest(const std::string& destination);
+
+  void AccountHedgedRequest(const std::string& destination);
+
+  // Returns the recent timings percentile of the destination in milliseconds,
+  // std::nullopt if there is no such destination or it had no requests
+  std::optional<std::size_t> GetTimingsPercentile(
+      const std::string& destination, double percent) const;
+
+  // Returns the statistics of the automatic destinations that did not fit
+  // into max_auto_destinations
+  const Statistics& GetOtherStatistics() const { return *other_; }
+
+  static constexpr std::string_view kOtherDestination = "other";
+
   using DestinationsMap = rcu::RcuMap<std::string, Statistics>;
 
   DestinationsMap::ConstIterator begin() const;
@@ -37,9 +58,41 @@ class DestinationStatistics final {
   std::shared_ptr<RequestStats> CreateStatisticsForDestination(
       const std::string& destination);
 
+  struct AutoDestination final {
+    std::shared_ptr<Statistics> stats;
+    // Finished requests at the start of the current window
+    std::uint64_t window_start_requests{0};
+  };
+
+  // Space-Saving counter of a destination missing in rcu_map_
+  struct Candidate final {
+    std::uint64_t count{0};
+    // Upper bound of the overestimation of the count
+    std::uint64_t error{0};
+  };
+
+  std::shared_ptr<RequestStats> AccountAutoMiss(
+      const std::string& destination);
+
+  void AccountCandidate(const std::string& destination);
+
+  // Replaces the coldest automatic destinations with the candidates that had
+  // more requests in the window
+  void Rebalance();
+
+  std::shared_ptr<RequestStats> CreateAutoDestination(
+      const std::string& destination);
+
   rcu::RcuMap<std::string, Statistics> rcu_map_;
   size_t max_auto_destinations_{0};
-  std::atomic<size_t> current_auto_destinations_{0};
+
+  const std::shared_ptr<Statistics> other_{std::make_shared<Statistics>()};
+
+  // Only the misses of rcu_map_ take the mutex
+  engine::Mutex auto_mutex_;
+  std::unordered_map<std::string, AutoDestination> auto_destinations_;
+  std::unordered_map<std::string, Candidate> candidates_;
+  std::uint64_t window_misses_{0};
 };
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -4,6 +4,7 @@
 #include <userver/engine/sleep.hpp>
 
 #include <userver/clients/http/client.hpp>
+#include <userver/tracing/manager.hpp>
 #include <userver/utest/http_client.hpp>
 #include <userver/utest/simple_server.hpp>
 #include <userver/utest/utest.hpp>
@@ -23,6 +24,13 @@ static HttpResponse Callback(int code, const HttpRequest& request) {
           HttpResponse::kWriteAndClose};
 }
 
+static HttpResponse KeepAliveCallback(const HttpRequest& request) {
+  LOG_INFO() << "HTTP Server receive: " << request;
+
+  return {"HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n",
+          HttpResponse::kWriteAndContinue};
+}
+
 UTEST(DestinationStatistics, Empty) {
   auto client = utest::CreateHttpClient();
 
@@ -134,4 +142,121 @@ UTEST(DestinationStatistics, Multiple) {
   }
 }
 
+UTEST(DestinationStatistics, DestinationAffinity) {
+  constexpr std::size_t kRequests = 16;
+  const utest::SimpleServer http_server{&KeepAliveCallback};
+  const auto url = http_server.GetBaseUrl();
+
+  static const tracing::GenericTracingManager kTracingManager{
+      tracing::Format::kYandexTaxi, tracing::Format::kYandexTaxi};
+  clients::http::ClientSettings settings;
+  settings.io_threads = 4;
+  settings.tracing_manager = &kTracingManager;
+  settings.destination_affinity = true;
+  clients::http::Client client{
+      std::move(settings), engine::current_task::GetTaskProcessor(),
+      std::vector<utils::NotNull<clients::http::Plugin*>>{}};
+
+  // Create all the requests beforehand, so that they do not reuse a single
+  // easy handle and get bound to random IO threads
+  std::vector<clients::http::Request> requests;
+  for (std::size_t i = 0; i < kRequests; ++i) {
+    requests.push_back(client.CreateRequest());
+    requests.back().get(url).retry(1).timeout(utest::kMaxTestWaitTime);
+  }
+  for (auto& request : requests) {
+    EXPECT_EQ(request.perform()->status_code(), 200);
+  }
+
+  EXPECT_EQ(http_server.GetConnectionsOpenedCount(), 1);
+
+  const auto& dest_stats = client.GetDestinationStatistics();
+  size_t size = 0;
+  for (const auto& [stat_url, stat_ptr] : dest_stats) {
+    ASSERT_EQ(1, ++size);
+    EXPECT_EQ(url, stat_url);
+    ASSERT_NE(nullptr, stat_ptr);
+
+    const auto stats = clients::http::InstanceStatistics(*stat_ptr);
+    EXPECT_EQ(utils::statistics::Rate{1}, stats.multi.socket_open);
+    EXPECT_EQ(utils::statistics::Rate{kRequests - 1},
+              stats.multi.socket_reused);
+  }
+}
+
+UTEST(DestinationStatistics, SharedCaches) {
+  constexpr std::size_t kRequests = 16;
+  const utest::SimpleServer http_server{&KeepAliveCallback};
+  const auto url = http_server.GetBaseUrl();
+
+  static const tracing::GenericTracingManager kTracingManager{
+      tracing::Format::kYandexTaxi, tracing::Format::kYandexTaxi};
+  clients::http::ClientSettings settings;
+  settings.io_threads = 4;
+  settings.tracing_manager = &kTracingManager;
+  settings.shared_caches = true;
+  settings.shared_connections = true;
+  clients::http::Client client{
+      std::move(settings), engine::current_task::GetTaskProcessor(),
+      std::vector<utils::NotNull<clients::http::Plugin*>>{}};
+
+  std::vector<clients::http::Request> requests;
+  for (std::size_t i = 0; i < kRequests; ++i) {
+    requests.push_back(client.CreateRequest());
+    requests.back().get(url).retry(1).timeout(utest::kMaxTestWaitTime);
+  }
+  for (auto& request : requests) {
+    EXPECT_EQ(request.perform()->status_code(), 200);
+  }
+  // The easy handles return to the idle queue detached from the share
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_EQ(client.CreateRequest()
+                  .get(url)
+                  .retry(1)
+                  .timeout(utest::kMaxTestWaitTime)
+                  .perform()
+                  ->status_code(),
+              200);
+  }
+
+  const auto& dest_stats = client.GetDestinationStatistics();
+  for (const auto& [stat_url, stat_ptr] : dest_stats) {
+    EXPECT_EQ(url, stat_url);
+    ASSERT_NE(nullptr, stat_ptr);
+
+    const auto stats = clients::http::InstanceStatistics(*stat_ptr);
+    EXPECT_EQ(stats.multi.socket_open.value + stats.multi.socket_reused.value,
+              kRequests + 2);
+    // Plain HTTP
+    EXPECT_EQ(utils::statistics::Rate{0}, stats.tls_handshakes);
+  }
+}
+
+UTEST(DestinationStatistics, AutoHeavyHitters) {
+  clients::http::DestinationStatistics dest_stats;
+  dest_stats.SetAutoMaxSize(2);
+
+  const auto request = [&dest_stats](const std::string& destination) {
+    auto request_stats =
+        dest_stats.GetStatisticsForDestinationAuto(destination);
+    ASSERT_TRUE(request_stats);
+    request_stats->Start();
+    request_stats->FinishOk(200, 1);
+  };
+
+  request("cold");
+  for (int i = 0; i < 200; ++i) {
+    request("hot");
+    request("heavy");
+    if (i % 2 == 0) request("tail-" + std::to_string(i));
+  }
+
+  std::unordered_set<std::string> destinations;
+  for (const auto& [stat_url, stat_ptr] : dest_stats) {
+    destinations.insert(stat_url);
+  }
+  EXPECT_EQ(destinations, (std::unordered_set<std::string>{"hot", "heavy"}));
+  EXPECT_GT(dest_stats.GetOtherStatistics().GetFinishedRequests(), 0);
+}
+
 USERVER_NAMESPACE_END
@@ -25,6 +25,15 @@ curl::easy& EasyWrapper::Easy() { return *easy_; }
 
 const curl::easy& EasyWrapper::Easy() const { return *easy_; }
 
+void EasyWrapper::BindToDestination(std::size_t destination_hash) noexcept {
+  client_.BindToDestination(*easy_, destination_hash);
+}
+
+clients::balancing::EndpointBalancer*
+EasyWrapper::GetEndpointBalancer() noexcept {
+  return client_.GetEndpointBalancer();
+}
+
 }  // namespace clients::http::impl
 
 USERVER_NAMESPACE_END
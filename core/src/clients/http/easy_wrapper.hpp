@@ -10,6 +10,10 @@ namespace clients::http {
 class Client;
 }  // namespace clients::http
 
+namespace clients::balancing {
+class EndpointBalancer;
+}  // namespace clients::balancing
+
 namespace clients::http::impl {
 
 class EasyWrapper final {
@@ -26,6 +30,13 @@ class EasyWrapper final {
   curl::easy& Easy();
   const curl::easy& Easy() const;
 
+  /// Moves the easy to the multi that owns the destination, if the client
+  /// has destination affinity enabled. Must not be called during a request.
+  void BindToDestination(std::size_t destination_hash) noexcept;
+
+  /// Returns nullptr if the client has endpoint balancing disabled
+  clients::balancing::EndpointBalancer* GetEndpointBalancer() noexcept;
+
  private:
   std::shared_ptr<curl::easy> easy_;
   Client& client_;
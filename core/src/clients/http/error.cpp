@@ -75,6 +75,10 @@ TimeoutException::TimeoutException(std::string_view message,
                                    const LocalStats& stats)
     : BaseException(std::string(message), stats, ErrorKind::kTimeout) {}
 
+RejectedByPluginException::RejectedByPluginException(std::string_view message,
+                                                     const LocalStats& stats)
+    : BaseException(std::string(message), stats, ErrorKind::kServer) {}
+
 BaseCodeException::BaseCodeException(std::error_code ec,
                                      std::string_view message,
                                      std::string_view url,
@@ -0,0 +1,131 @@
+#include <userver/clients/http/hedging.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <optional>
+
+#include <clients/http/destination_statistics.hpp>
+#include <userver/clients/http/client.hpp>
+#include <userver/clients/http/error.hpp>
+#include <userver/clients/http/response_future.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/hedged_request.hpp>
+#include <userver/utils/retry_budget.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace {
+
+constexpr std::chrono::seconds kDelayUpdatePeriod{1};
+
+class HedgingStrategy final {
+ public:
+  HedgingStrategy(Client& client, const std::string& destination,
+                  utils::RetryBudget& budget,
+                  const AdaptiveHedging::RequestSetup& setup,
+                  std::exception_ptr& exception)
+      : client_(client),
+        destination_(destination),
+        budget_(budget),
+        setup_(setup),
+        exception_(exception) {}
+
+  std::optional<ResponseFuture> Create(std::size_t attempt) {
+    if (attempt > 0) {
+      if (!budget_.CanRetry()) return std::nullopt;
+      client_.AccountHedgedRequest(destination_);
+    }
+
+    auto request = client_.CreateRequest();
+    setup_(request);
+    request.SetDestinationMetricName(destination_);
+    return request.async_perform();
+  }
+
+  std::optional<std::chrono::milliseconds> ProcessReply(
+      ResponseFuture&& future) {
+    try {
+      auto response = future.Get();
+      if (static_cast<int>(response->status_code()) < 500) {
+        budget_.AccountOk();
+        reply_ = std::move(response);
+        return std::nullopt;
+      }
+      budget_.AccountFail();
+      last_error_reply_ = std::move(response);
+    } catch (const std::exception&) {
+      budget_.AccountFail();
+      exception_ = std::current_exception();
+    }
+    // Retry the failed request right away
+    return std::chrono::milliseconds::zero();
+  }
+
+  std::optional<std::shared_ptr<Response>> ExtractReply() {
+    if (reply_) return std::move(reply_);
+    if (last_error_reply_) return std::move(last_error_reply_);
+    return std::nullopt;
+  }
+
+  void Finish(ResponseFuture&& future) { future.Cancel(); }
+
+ private:
+  Client& client_;
+  const std::string& destination_;
+  utils::RetryBudget& budget_;
+  const AdaptiveHedging::RequestSetup& setup_;
+
+  std::exception_ptr& exception_;
+
+  std::shared_ptr<Response> reply_;
+  std::shared_ptr<Response> last_error_reply_;
+};
+
+}  // namespace
+
+AdaptiveHedging::AdaptiveHedging(Client& client, std::string destination,
+                                 AdaptiveHedgingSettings settings,
+                                 utils::RetryBudget& budget)
+    : client_(client),
+      destination_(std::move(destination)),
+      settings_(settings),
+      budget_(budget),
+      delay_(settings_.max_delay) {}
+
+AdaptiveHedging::~AdaptiveHedging() = default;
+
+std::shared_ptr<Response> AdaptiveHedging::Perform(const RequestSetup& setup) {
+  std::exception_ptr exception;
+  const utils::hedging::HedgingSettings hedging_settings{
+      settings_.max_attempts, GetDelay(), settings_.timeout_all};
+  auto reply = utils::hedging::HedgeRequest(
+      HedgingStrategy{client_, destination_, budget_, setup, exception},
+      hedging_settings);
+  if (reply) return std::move(*reply);
+
+  if (exception) std::rethrow_exception(exception);
+  throw TimeoutException("Hedged request timeout", {});
+}
+
+std::chrono::milliseconds AdaptiveHedging::GetDelay() const {
+  const auto now = utils::datetime::SteadyClock::now();
+  if (now < delay_deadline_.load()) return delay_.load();
+
+  const auto percentile =
+      client_.GetDestinationStatistics().GetTimingsPercentile(
+          destination_, settings_.delay_percentile);
+  const auto delay =
+      percentile ? std::clamp(std::chrono::milliseconds{*percentile},
+                              settings_.min_delay, settings_.max_delay)
+                 : settings_.max_delay;
+
+  delay_ = delay;
+  delay_deadline_ = now + kDelayUpdatePeriod;
+  return delay;
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,135 @@
+#include <userver/clients/http/hedging.hpp>
+
+#include <atomic>
+
+#include <clients/http/destination_statistics.hpp>
+#include <userver/clients/http/client.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/http_client.hpp>
+#include <userver/utest/simple_server.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/retry_budget.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using HttpResponse = utest::SimpleServer::Response;
+using HttpRequest = utest::SimpleServer::Request;
+
+constexpr std::string_view kDestination = "hedged-destination";
+constexpr std::chrono::milliseconds kSlowReply{300};
+
+// The first request is slow, the others are fast
+struct SlowFirstCallback {
+  std::shared_ptr<std::atomic<std::size_t>> requests =
+      std::make_shared<std::atomic<std::size_t>>(0);
+
+  HttpResponse operator()(const HttpRequest&) const {
+    if (requests->fetch_add(1) == 0) {
+      engine::SleepFor(kSlowReply);
+    }
+    return {"HTTP/1.1 200 OK\r\nContent-Length: 2\r\n\r\nok",
+            HttpResponse::kWriteAndContinue};
+  }
+};
+
+utils::statistics::Rate GetHedgedRequests(clients::http::Client& client) {
+  for (const auto& [name, stats] : client.GetDestinationStatistics()) {
+    if (name == kDestination) {
+      return clients::http::InstanceStatistics(*stats).hedged_requests;
+    }
+  }
+  return {};
+}
+
+}  // namespace
+
+UTEST_MT(AdaptiveHedging, HedgesSlowRequest, 2) {
+  const SlowFirstCallback callback;
+  const utest::SimpleServer http_server{callback};
+  auto client = utest::CreateHttpClient();
+  const auto url = http_server.GetBaseUrl();
+
+  /// [Sample AdaptiveHedging]
+  utils::RetryBudget budget;
+  clients::http::AdaptiveHedgingSettings settings;
+  settings.min_delay = std::chrono::milliseconds{10};
+  settings.max_delay = std::chrono::milliseconds{50};
+  clients::http::AdaptiveHedging hedging{*client, std::string{kDestination},
+                                         settings, budget};
+
+  const auto response =
+      hedging.Perform([&url](clients::http::Request& request) {
+        request.get(url).retry(1).timeout(utest::kMaxTestWaitTime);
+      });
+  /// [Sample AdaptiveHedging]
+
+  EXPECT_EQ(response->status_code(), clients::http::Status::OK);
+  EXPECT_EQ(response->body_view(), "ok");
+  EXPECT_EQ(callback.requests->load(), 2);
+  EXPECT_EQ(GetHedgedRequests(*client), utils::statistics::Rate{1});
+}
+
+UTEST_MT(AdaptiveHedging, NoHedgingWithoutBudget, 2) {
+  const SlowFirstCallback callback;
+  const utest::SimpleServer http_server{callback};
+  auto client = utest::CreateHttpClient();
+  const auto url = http_server.GetBaseUrl();
+
+  utils::RetryBudget budget;
+  for (int i = 0; i < 100; ++i) budget.AccountFail();
+  ASSERT_FALSE(budget.CanRetry());
+
+  clients::http::AdaptiveHedgingSettings settings;
+  settings.max_delay = std::chrono::milliseconds{10};
+  clients::http::AdaptiveHedging hedging{*client, std::string{kDestination},
+                                         settings, budget};
+
+  const auto response =
+      hedging.Perform([&url](clients::http::Request& request) {
+        request.get(url).retry(1).timeout(utest::kMaxTestWaitTime);
+      });
+
+  EXPECT_EQ(response->status_code(), clients::http::Status::OK);
+  EXPECT_EQ(callback.requests->load(), 1);
+  EXPECT_EQ(GetHedgedRequests(*client), utils::statistics::Rate{0});
+}
+
+UTEST(AdaptiveHedging, DelayFollowsTimings) {
+  const utest::SimpleServer http_server{[](const HttpRequest&) {
+    return HttpResponse{"HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n",
+                        HttpResponse::kWriteAndContinue};
+  }};
+  auto client = utest::CreateHttpClient();
+  const auto url = http_server.GetBaseUrl();
+
+  utils::RetryBudget budget;
+  clients::http::AdaptiveHedgingSettings settings;
+  settings.min_delay = std::chrono::milliseconds{20};
+  settings.max_delay = utest::kMaxTestWaitTime;
+  clients::http::AdaptiveHedging hedging{*client, std::string{kDestination},
+                                         settings, budget};
+
+  // No timings yet
+  EXPECT_EQ(hedging.GetDelay(), settings.max_delay);
+
+  for (int i = 0; i < 10; ++i) {
+    const auto response =
+        client->CreateRequest()
+            .get(url)
+            .retry(1)
+            .timeout(utest::kMaxTestWaitTime)
+            .SetDestinationMetricName(std::string{kDestination})
+            .perform();
+    EXPECT_EQ(response->status_code(), clients::http::Status::OK);
+  }
+
+  // The delay is not recalculated more often than once a second
+  EXPECT_EQ(hedging.GetDelay(), settings.max_delay);
+  engine::SleepFor(std::chrono::milliseconds{1100});
+  // A local server replies faster than min_delay
+  EXPECT_EQ(hedging.GetDelay(), settings.min_delay);
+}
+
+USERVER_NAMESPACE_END
@@ -28,6 +28,14 @@ void PluginRequest::SetTimeout(std::chrono::milliseconds ms) {
   state_.SetEasyTimeout(ms);
 }
 
+const std::string& PluginRequest::GetDestination() const {
+  return state_.GetDestinationMetricName();
+}
+
+void PluginRequest::Reject(std::string reason) {
+  state_.RejectByPlugin(std::move(reason));
+}
+
 Plugin::Plugin(std::string name) : name_(std::move(name)) {}
 
 const std::string& Plugin::GetName() const { return name_; }
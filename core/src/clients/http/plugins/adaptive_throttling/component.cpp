@@ -0,0 +1,48 @@
+#include <userver/clients/http/plugins/adaptive_throttling/component.hpp>
+
+#include <clients/http/plugins/adaptive_throttling/plugin.hpp>
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::adaptive_throttling {
+
+Component::Component(const components::ComponentConfig& config,
+                     const components::ComponentContext& context)
+    : ComponentBase(config, context),
+      plugin_(std::make_unique<adaptive_throttling::Plugin>(
+          config.As<congestion_control::ClientThrottlerConfig>())) {
+  auto& storage =
+      context.FindComponent<components::StatisticsStorage>().GetStorage();
+  statistics_holder_ = storage.RegisterWriter(
+      "httpclient.adaptive-throttling",
+      [this](utils::statistics::Writer& writer) { writer = *plugin_; });
+}
+
+Component::~Component() { statistics_holder_.Unregister(); }
+
+http::Plugin& Component::GetPlugin() { return *plugin_; }
+
+yaml_config::Schema Component::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<components::ComponentBase>(R"(
+type: object
+description: HTTP client plugin for client-side adaptive throttling
+additionalProperties: false
+properties:
+    accepts-multiplier:
+        type: number
+        description: requests are rejected locally once they exceed the accepted ones that many times
+        defaultDescription: 2.0
+    window:
+        type: string
+        description: time the requests and the accepts are counted over
+        defaultDescription: 60s
+)");
+}
+
+}  // namespace clients::http::plugins::adaptive_throttling
+
+USERVER_NAMESPACE_END
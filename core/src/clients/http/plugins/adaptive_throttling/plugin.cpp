@@ -0,0 +1,56 @@
+#include <clients/http/plugins/adaptive_throttling/plugin.hpp>
+
+#include <userver/clients/http/response.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::adaptive_throttling {
+
+namespace {
+
+const std::string kName = "adaptive-throttling";
+
+// The destination fails the requests because of its overload
+bool IsOverloadStatus(Status status) {
+  return status == Status::kTooManyRequests ||
+         status == Status::kServiceUnavailable ||
+         status == Status::kGatewayTimeout;
+}
+
+}  // namespace
+
+Plugin::Plugin(const congestion_control::ClientThrottlerConfig& config)
+    : http::Plugin(kName), config_(config) {}
+
+void Plugin::HookPerformRequest(PluginRequest& request) {
+  const auto& destination = request.GetDestination();
+  auto throttler = throttlers_.Get(destination);
+  if (!throttler) {
+    throttler = throttlers_.TryEmplace(destination, config_).value;
+  }
+
+  if (!throttler->TryStart()) {
+    request.Reject("adaptive throttling of an overloaded destination");
+  }
+}
+
+void Plugin::HookCreateSpan(PluginRequest&) {}
+
+void Plugin::HookOnCompleted(PluginRequest& request, Response& response) {
+  if (IsOverloadStatus(response.status_code())) return;
+
+  // The throttler was created when the request was performed
+  const auto throttler = throttlers_.Get(request.GetDestination());
+  if (throttler) throttler->AccountAccepted();
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const Plugin& plugin) {
+  for (const auto& [destination, throttler] : plugin.throttlers_) {
+    writer.ValueWithLabels(*throttler, {"http_destination", destination});
+  }
+}
+
+}  // namespace clients::http::plugins::adaptive_throttling
+
+USERVER_NAMESPACE_END
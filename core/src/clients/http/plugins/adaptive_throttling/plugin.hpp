@@ -0,0 +1,44 @@
+#pragma once
+
+#include <mutex>
+#include <string>
+
+#include <userver/clients/http/plugin.hpp>
+#include <userver/congestion_control/client_throttler.hpp>
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http::plugins::adaptive_throttling {
+
+class Plugin final : public http::Plugin {
+ public:
+  explicit Plugin(const congestion_control::ClientThrottlerConfig& config);
+
+  void HookPerformRequest(PluginRequest& request) override;
+
+  void HookCreateSpan(PluginRequest& request) override;
+
+  void HookOnCompleted(PluginRequest& request, Response& response) override;
+
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const Plugin& plugin);
+
+ private:
+  // The retries are performed outside of coroutines
+  struct ThrottlersTraits
+      : rcu::DefaultRcuMapTraits<std::string,
+                                 congestion_control::ClientThrottler> {
+    using MutexType = std::mutex;
+  };
+
+  const congestion_control::ClientThrottlerConfig config_;
+  rcu::RcuMap<std::string, congestion_control::ClientThrottler,
+              ThrottlersTraits>
+      throttlers_;
+};
+
+}  // namespace clients::http::plugins::adaptive_throttling
+
+USERVER_NAMESPACE_END
@@ -10,6 +10,7 @@
 #include <userver/clients/http/connect_to.hpp>
 #include <userver/clients/http/error.hpp>
 #include <userver/clients/http/form.hpp>
+#include <userver/clients/http/request_template.hpp>
 #include <userver/clients/http/response_future.hpp>
 #include <userver/clients/http/streamed_response.hpp>
 #include <userver/concurrent/queue.hpp>
@@ -377,6 +378,18 @@ Request Request::data(std::string data) && {
   return std::move(this->data(std::move(data)));
 }
 
+Request& Request::data(std::shared_ptr<const std::string> data) & {
+  UINVARIANT(data, "Request body must not be null");
+  if (!data->empty())
+    pimpl_->easy().add_header(kHeaderExpect, "",
+                              curl::easy::EmptyHeaderAction::kDoNotSend);
+  pimpl_->easy().set_shared_post_fields(std::move(data));
+  return *this;
+}
+Request Request::data(std::shared_ptr<const std::string> data) && {
+  return std::move(this->data(std::move(data)));
+}
+
 Request& Request::form(Form&& form) & {
   pimpl_->easy().set_http_post(std::move(form).GetNative());
   pimpl_->easy().add_header(kHeaderExpect, "",
@@ -482,6 +495,27 @@ Request Request::cookies(
   return std::move(this->cookies(cookies));
 }
 
+Request& Request::ApplyTemplate(const RequestTemplate& request_template) & {
+  if (request_template.method_) method(*request_template.method_);
+  if (request_template.url_) url(*request_template.url_);
+  for (const auto& line : request_template.header_lines_) {
+    // The lines are already formatted, no per-header formatting and lookups
+    pimpl_->easy().add_header(line);
+  }
+  if (request_template.user_agent_) user_agent(*request_template.user_agent_);
+  if (request_template.timeout_) timeout(*request_template.timeout_);
+  if (request_template.retry_) {
+    retry(request_template.retry_->retries, request_template.retry_->on_fails);
+  }
+  if (request_template.http_version_) {
+    http_version(*request_template.http_version_);
+  }
+  return *this;
+}
+Request Request::ApplyTemplate(const RequestTemplate& request_template) && {
+  return std::move(this->ApplyTemplate(request_template));
+}
+
 Request& Request::method(HttpMethod method) & {
   switch (method) {
     case HttpMethod::kDelete:
@@ -502,7 +536,7 @@ Request& Request::method(HttpMethod method) & {
     case HttpMethod::kPatch:
       pimpl_->easy().set_custom_request(ToString(method));
       // ensure a body as we should send Content-Length for this method
-      if (!pimpl_->easy().has_post_data()) data({});
+      if (!pimpl_->easy().has_post_data()) data(std::string{});
       break;
   };
   return *this;
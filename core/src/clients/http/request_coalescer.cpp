@@ -0,0 +1,184 @@
+#include <userver/clients/http/request_coalescer.hpp>
+
+#include <algorithm>
+#include <unordered_set>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/shared_task_with_result.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/scope_guard.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace {
+
+std::string MakeKey(const std::string& url, const Headers& headers) {
+  std::vector<std::pair<std::string_view, std::string_view>> sorted_headers;
+  sorted_headers.reserve(headers.size());
+  for (const auto& [name, value] : headers) {
+    sorted_headers.emplace_back(name, value);
+  }
+  std::sort(sorted_headers.begin(), sorted_headers.end());
+
+  std::string key = url;
+  for (const auto& [name, value] : sorted_headers) {
+    key.append("\r\n").append(name).append(": ").append(value);
+  }
+  return key;
+}
+
+}  // namespace
+
+struct RequestCoalescer::Impl final {
+  using Task = engine::SharedTaskWithResult<std::shared_ptr<const Response>>;
+
+  Impl(Client& client, std::string destination)
+      : client(client), destination(std::move(destination)) {}
+
+  Client& client;
+  const std::string destination;
+  concurrent::Variable<std::unordered_map<std::string, std::shared_ptr<Task>>>
+      in_flight{};
+};
+
+RequestCoalescer::RequestCoalescer(Client& client, std::string destination)
+    : impl_(std::make_unique<Impl>(client, std::move(destination))) {}
+
+RequestCoalescer::~RequestCoalescer() = default;
+
+std::shared_ptr<const Response> RequestCoalescer::Get(
+    const std::string& url, const Headers& headers,
+    std::chrono::milliseconds timeout, short retries) {
+  auto key = MakeKey(url, headers);
+
+  std::shared_ptr<Impl::Task> task;
+  {
+    auto in_flight = impl_->in_flight.Lock();
+    auto& entry = (*in_flight)[key];
+    if (entry) {
+      impl_->client.AccountCoalescedRequest(impl_->destination);
+    } else {
+      // The request is sent from a separate task, so that it is not
+      // cancelled together with the first caller.
+      entry = std::make_shared<Impl::Task>(utils::SharedAsync(
+          "http_coalesced_get", [&client = impl_->client,
+                                 &destination = impl_->destination, url,
+                                 headers, timeout, retries] {
+            return std::shared_ptr<const Response>{
+                client.CreateRequest()
+                    .get(url)
+                    .headers(headers)
+                    .timeout(timeout)
+                    .retry(retries)
+                    .SetDestinationMetricName(destination)
+                    .perform()};
+          }));
+    }
+    task = entry;
+  }
+
+  // The first caller to get the response makes the next requests go to the
+  // server, as the response may already be outdated for them.
+  const utils::ScopeGuard erase_guard{[&] {
+    auto in_flight = impl_->in_flight.Lock();
+    const auto it = in_flight->find(key);
+    if (it != in_flight->end() && it->second == task) in_flight->erase(it);
+  }};
+
+  return task->Get();
+}
+
+struct BatchCoalescer::Impl final {
+  struct Batch final {
+    Keys keys;
+    std::unordered_set<std::string> unique_keys;
+    engine::SingleConsumerEvent full;
+    bool closed{false};
+  };
+
+  struct Pending final {
+    std::shared_ptr<Batch> batch;
+    engine::SharedTaskWithResult<Results> task;
+  };
+
+  Impl(Client& client, std::string destination, BatchSettings settings,
+       BatchFunction batch_function)
+      : client(client),
+        destination(std::move(destination)),
+        settings(settings),
+        batch_function(std::move(batch_function)) {}
+
+  Results Run(const std::shared_ptr<Batch>& batch);
+
+  Client& client;
+  const std::string destination;
+  const BatchSettings settings;
+  const BatchFunction batch_function;
+  concurrent::Variable<std::optional<Pending>> pending{};
+};
+
+BatchCoalescer::Results BatchCoalescer::Impl::Run(
+    const std::shared_ptr<Batch>& batch) {
+  [[maybe_unused]] const bool is_full =
+      batch->full.WaitForEventFor(settings.window);
+
+  {
+    // The keys are not modified after the batch is closed. The task handle
+    // stays in `pending` until the next Get, a task must not destroy its own
+    // handle.
+    auto lock = pending.Lock();
+    batch->closed = true;
+  }
+
+  auto request = client.CreateRequest();
+  request.SetDestinationMetricName(destination);
+  return batch_function(request, batch->keys);
+}
+
+BatchCoalescer::BatchCoalescer(Client& client, std::string destination,
+                               BatchSettings settings,
+                               BatchFunction batch_function)
+    : impl_(std::make_unique<Impl>(client, std::move(destination), settings,
+                                   std::move(batch_function))) {}
+
+BatchCoalescer::~BatchCoalescer() = default;
+
+std::optional<std::string> BatchCoalescer::Get(std::string key) {
+  std::optional<engine::SharedTaskWithResult<Results>> task;
+  {
+    auto pending = impl_->pending.Lock();
+    if (!*pending || (*pending)->batch->closed) {
+      auto batch = std::make_shared<Impl::Batch>();
+      auto batch_task =
+          utils::SharedAsync("http_batch", [impl = impl_.get(), batch] {
+            return impl->Run(batch);
+          });
+      pending->emplace(Impl::Pending{std::move(batch), std::move(batch_task)});
+    } else {
+      impl_->client.AccountCoalescedRequest(impl_->destination);
+    }
+
+    auto& batch = *(*pending)->batch;
+    if (batch.unique_keys.insert(key).second) {
+      batch.keys.push_back(key);
+    }
+    if (batch.keys.size() >= impl_->settings.max_batch_size) {
+      batch.closed = true;
+      batch.full.Send();
+    }
+    task.emplace((*pending)->task);
+  }
+
+  const auto& results = task->Get();
+  const auto it = results.find(key);
+  if (it == results.end()) return std::nullopt;
+  return it->second;
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,198 @@
+#include <userver/clients/http/request_coalescer.hpp>
+
+#include <atomic>
+
+#include <clients/http/destination_statistics.hpp>
+#include <userver/clients/http/client.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/http_client.hpp>
+#include <userver/utest/simple_server.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/text_light.hpp>
+
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using HttpResponse = utest::SimpleServer::Response;
+using HttpRequest = utest::SimpleServer::Request;
+
+constexpr std::string_view kDestination = "coalesced-destination";
+
+// Answers with the request body
+HttpResponse EchoCallback(const HttpRequest& request) {
+  const auto body_pos = request.find("\r\n\r\n");
+  const auto body = body_pos == std::string::npos
+                        ? std::string{}
+                        : request.substr(body_pos + 4);
+
+  return {"HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(body.size()) +
+              "\r\n\r\n" + body,
+          HttpResponse::kWriteAndContinue};
+}
+
+utils::statistics::Rate GetCoalescedRequests(clients::http::Client& client) {
+  for (const auto& [name, stats] : client.GetDestinationStatistics()) {
+    if (name == kDestination) {
+      return clients::http::InstanceStatistics(*stats).coalesced_requests;
+    }
+  }
+  return {};
+}
+
+}  // namespace
+
+UTEST_MT(RequestCoalescer, Coalesces, 4) {
+  constexpr std::size_t kCallers = 8;
+
+  std::atomic<std::size_t> requests{0};
+  engine::SingleConsumerEvent release;
+  const utest::SimpleServer http_server{[&](const HttpRequest& request) {
+    ++requests;
+    EXPECT_TRUE(release.WaitForEventFor(utest::kMaxTestWaitTime));
+    return EchoCallback(request);
+  }};
+  auto client = utest::CreateHttpClient();
+
+  /// [Sample RequestCoalescer]
+  clients::http::RequestCoalescer coalescer{*client,
+                                            std::string{kDestination}};
+
+  std::vector<engine::TaskWithResult<std::string>> tasks;
+  for (std::size_t i = 0; i < kCallers; ++i) {
+    tasks.push_back(utils::Async("caller", [&] {
+      const auto response =
+          coalescer.Get(http_server.GetBaseUrl() + "/config",
+                        {{"X-Tenant", "test"}}, utest::kMaxTestWaitTime);
+      return response->body();
+    }));
+  }
+  /// [Sample RequestCoalescer]
+
+  // Wait for all the callers to join the in-flight request
+  while (GetCoalescedRequests(*client).value < kCallers - 1) {
+    engine::Yield();
+  }
+  release.Send();
+
+  for (auto& task : tasks) {
+    EXPECT_EQ(task.Get(), "");
+  }
+  EXPECT_EQ(requests.load(), 1);
+
+  // The next request is sent again
+  release.Send();
+  coalescer.Get(http_server.GetBaseUrl() + "/config", {{"X-Tenant", "test"}},
+                utest::kMaxTestWaitTime);
+  EXPECT_EQ(requests.load(), 2);
+}
+
+UTEST(RequestCoalescer, DifferentHeaders) {
+  std::atomic<std::size_t> requests{0};
+  const utest::SimpleServer http_server{[&](const HttpRequest& request) {
+    ++requests;
+    return EchoCallback(request);
+  }};
+  auto client = utest::CreateHttpClient();
+
+  clients::http::RequestCoalescer coalescer{*client,
+                                            std::string{kDestination}};
+  coalescer.Get(http_server.GetBaseUrl(), {{"X-Tenant", "first"}},
+                utest::kMaxTestWaitTime);
+  coalescer.Get(http_server.GetBaseUrl(), {{"X-Tenant", "second"}},
+                utest::kMaxTestWaitTime);
+
+  EXPECT_EQ(requests.load(), 2);
+  EXPECT_EQ(GetCoalescedRequests(*client), utils::statistics::Rate{0});
+}
+
+UTEST_MT(BatchCoalescer, Batches, 4) {
+  std::atomic<std::size_t> requests{0};
+  const utest::SimpleServer http_server{[&](const HttpRequest& request) {
+    ++requests;
+    return EchoCallback(request);
+  }};
+  auto client = utest::CreateHttpClient();
+  const auto url = http_server.GetBaseUrl() + "/batch";
+
+  /// [Sample BatchCoalescer]
+  using clients::http::BatchCoalescer;
+  BatchCoalescer coalescer{
+      *client, std::string{kDestination},
+      clients::http::BatchSettings{utest::kMaxTestWaitTime, 3},
+      [&url](clients::http::Request& request,
+             const BatchCoalescer::Keys& keys) {
+        const auto response =
+            request.post(url, fmt::format("{}", fmt::join(keys, ",")))
+                .timeout(utest::kMaxTestWaitTime)
+                .perform();
+        response->raise_for_status();
+
+        BatchCoalescer::Results results;
+        for (auto& key : utils::text::Split(response->body(), ",")) {
+          results.emplace(key, "value-" + key);
+        }
+        return results;
+      }};
+
+  std::vector<engine::TaskWithResult<std::optional<std::string>>> tasks;
+  // The batch is sent as soon as it has 3 unique keys
+  for (const auto* key : {"a", "b", "a", "c"}) {
+    tasks.push_back(utils::Async("caller", [&coalescer, key] {
+      return coalescer.Get(key);
+    }));
+  }
+  /// [Sample BatchCoalescer]
+
+  EXPECT_EQ(tasks[0].Get(), "value-a");
+  EXPECT_EQ(tasks[1].Get(), "value-b");
+  EXPECT_EQ(tasks[2].Get(), "value-a");
+  EXPECT_EQ(tasks[3].Get(), "value-c");
+  EXPECT_EQ(requests.load(), 1);
+  EXPECT_EQ(GetCoalescedRequests(*client), utils::statistics::Rate{3});
+}
+
+UTEST_MT(BatchCoalescer, MaxBatchSize, 4) {
+  constexpr std::size_t kKeys = 5;
+
+  std::atomic<std::size_t> requests{0};
+  const utest::SimpleServer http_server{[&](const HttpRequest& request) {
+    ++requests;
+    return EchoCallback(request);
+  }};
+  auto client = utest::CreateHttpClient();
+  const auto url = http_server.GetBaseUrl();
+
+  using clients::http::BatchCoalescer;
+  BatchCoalescer coalescer{
+      *client, std::string{kDestination},
+      clients::http::BatchSettings{std::chrono::milliseconds{100}, 2},
+      [&url](clients::http::Request& request,
+             const BatchCoalescer::Keys& keys) {
+        EXPECT_LE(keys.size(), 2);
+        const auto response =
+            request.post(url, fmt::format("{}", fmt::join(keys, ",")))
+                .timeout(utest::kMaxTestWaitTime)
+                .perform();
+        EXPECT_EQ(response->status_code(), 200);
+        return BatchCoalescer::Results{};
+      }};
+
+  std::vector<engine::TaskWithResult<std::optional<std::string>>> tasks;
+  for (std::size_t i = 0; i < kKeys; ++i) {
+    tasks.push_back(utils::Async("caller", [&coalescer, i] {
+      return coalescer.Get(std::to_string(i));
+    }));
+  }
+  for (auto& task : tasks) {
+    EXPECT_EQ(task.Get(), std::nullopt);
+  }
+
+  EXPECT_EQ(requests.load(), 3);
+}
+
+USERVER_NAMESPACE_END
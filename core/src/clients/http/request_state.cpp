@@ -10,11 +10,12 @@
 #include <fmt/format.h>
 #include <openssl/ssl.h>
 #include <openssl/x509.h>
+#include <boost/container_hash/hash.hpp>
 #include <boost/range/adaptor/map.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 
 #include <curl-ev/error_code.hpp>
-#include <userver/baggage/baggage.hpp>
+#include <userver/baggage/baggage_manager.hpp>
 #include <userver/clients/dns/resolver.hpp>
 #include <userver/clients/http/connect_to.hpp>
 #include <userver/clients/http/plugins/headers_propagator/plugin.hpp>
@@ -107,7 +108,7 @@ char* rfind_not_space(char* ptr, size_t size) {
 
 // TODO: very low-level, do it in another place
 void SetBaggageHeader(curl::easy& e) {
-  const auto* baggage = baggage::kInheritedBaggage.GetOptional();
+  const auto* baggage = baggage::BaggageManager::TryGetBaggage();
   if (baggage != nullptr) {
     LOG_DEBUG() << fmt::format("Send baggage: {}", baggage->ToString());
     e.add_header(USERVER_NAMESPACE::http::headers::kXBaggage,
@@ -356,6 +357,7 @@ void RequestState::connect_to(const ConnectTo& connect_to) {
   curl::native::curl_slist* ptr = connect_to.GetUnderlying();
   if (ptr) {
     easy().set_connect_to(ptr);
+    has_connect_to_ = true;
   }
 }
 
@@ -387,9 +389,18 @@ void RequestState::SetDestinationMetricNameAuto(std::string destination) {
 }
 
 void RequestState::SetDestinationMetricName(const std::string& destination) {
+  destination_metric_name_ = destination;
   dest_req_stats_ = dest_stats_->GetStatisticsForDestination(destination);
 }
 
+const std::string& RequestState::GetDestinationMetricName() const noexcept {
+  return destination_metric_name_;
+}
+
+void RequestState::RejectByPlugin(std::string reason) {
+  plugin_reject_reason_ = std::move(reason);
+}
+
 void RequestState::SetTestsuiteConfig(
     const std::shared_ptr<const TestsuiteConfig>& config) {
   testsuite_config_ = config;
@@ -485,9 +496,20 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder,
   }
 
   holder->AccountResponse(err);
+  holder->endpoint_lease_.Finish(!err && static_cast<int>(status_code) < 500);
   const auto sockets = easy.get_num_connects();
-  holder->WithRequestStats(
-      [sockets](RequestStats& stats) { stats.AccountOpenSockets(sockets); });
+  const bool reused_socket = sockets == 0 && !err;
+  const bool http2 =
+      easy.get_http_version() == curl::native::CURL_HTTP_VERSION_2_0;
+  // The application layer connect time is only set for a new TLS connection
+  const bool tls_handshake =
+      sockets != 0 && easy.get_appconnect_time_usec() > 0;
+  holder->WithRequestStats([&](RequestStats& stats) {
+    stats.AccountOpenSockets(sockets);
+    if (reused_socket) stats.AccountReusedSocket();
+    if (http2) stats.AccountHttp2Stream();
+    if (tls_handshake) stats.AccountTlsHandshake();
+  });
 
   span.AddTag(tracing::kAttempts, holder->retry_.current);
   if (holder->deadline_propagation_config_.update_header) {
@@ -741,7 +763,14 @@ void RequestState::perform_request(curl::easy::handler_type handler) {
 
   UpdateTimeoutHeader();
 
+  plugin_reject_reason_.reset();
   plugin_pipeline_.HookPerformRequest(*this);
+  if (plugin_reject_reason_) {
+    HandleRejectedByPlugin();
+    return;
+  }
+
+  if (retry_.current == 1) BindToDestination();
 
   if (resolver_ && retry_.current == 1) {
     engine::AsyncNoSpan([this, holder = shared_from_this(),
@@ -849,6 +878,36 @@ void RequestState::HandleDeadlineAlreadyPassed() {
   std::visit(visitor, data_);
 }
 
+void RequestState::HandleRejectedByPlugin() {
+  UASSERT(plugin_reject_reason_);
+  auto& span = span_storage_->Get();
+  span.AddTag(tracing::kAttempts, retry_.current);
+  span.AddTag(tracing::kErrorFlag, true);
+  span.AddTag(tracing::kErrorMessage, *plugin_reject_reason_);
+
+  WithRequestStats([](RequestStats& stats) { stats.AccountRejectedByPlugin(); });
+
+  auto exc = std::make_exception_ptr(RejectedByPluginException(
+      fmt::format("Request rejected by a plugin: {}, url: {}",
+                  *plugin_reject_reason_, GetLoggedOriginalUrl()),
+      easy().get_local_stats()));
+
+  const utils::Overloaded visitor{
+      [&exc](FullBufferedData& buffered_data) {
+        auto promise = std::move(buffered_data.promise_);
+        // The task will wake up and may reuse RequestState.
+        promise.set_exception(std::move(exc));
+      },
+      [&exc](StreamData& stream_data) {
+        if (!stream_data.headers_promise_set.exchange(true)) {
+          auto promise = std::move(stream_data.headers_promise);
+          // The task will wake up and may reuse RequestState.
+          promise.set_exception(std::move(exc));
+        }
+      }};
+  std::visit(visitor, data_);
+}
+
 void RequestState::CheckResponseDeadline(std::error_code& err,
                                          Status status_code) {
   const std::chrono::microseconds attempt_time{easy().get_total_time_usec()};
@@ -1062,6 +1121,25 @@ void RequestState::WithRequestStats(const Func& func) {
   if (dest_req_stats_) func(*dest_req_stats_);
 }
 
+void RequestState::BindToDestination() noexcept {
+  // The connections are made to the proxy if there is one
+  if (!proxy_url_.empty()) {
+    easy_.BindToDestination(std::hash<std::string>{}(proxy_url_));
+    return;
+  }
+
+  const auto& url = easy().get_easy_url();
+  std::error_code ec;
+  const auto host = url.GetHostPtr(ec);
+  if (ec || !host) return;
+  const auto port = url.GetPortPtr(ec);
+  if (ec || !port) return;
+
+  auto hash = std::hash<std::string_view>{}(host.get());
+  boost::hash_combine(hash, std::hash<std::string_view>{}(port.get()));
+  easy_.BindToDestination(hash);
+}
+
 void RequestState::ResolveTargetAddress(clients::dns::Resolver& resolver) {
   const auto deadline = engine::Deadline::FromDuration(remote_timeout_);
 
@@ -1076,8 +1154,31 @@ void RequestState::ResolveTargetAddress(clients::dns::Resolver& resolver) {
       addrs | boost::adaptors::transformed(
                   [](const auto& addr) { return addr.PrimaryAddressString(); });
 
-  easy().add_resolve(hostname, target.Get().GetPortPtr().get(),
+  const std::string port = target.Get().GetPortPtr().get();
+  easy().add_resolve(hostname, port,
                      fmt::to_string(fmt::join(addr_strings, ",")));
+
+  // With a proxy the connections are made to the proxy address
+  auto* balancer = easy_.GetEndpointBalancer();
+  if (!balancer || addrs.size() < 2 || has_connect_to_ || !proxy_url_.empty()) {
+    return;
+  }
+
+  // CURLOPT_CONNECT_TO makes curl keep separate connections to each address,
+  // while with CURLOPT_RESOLVE all the connections to a host are shared.
+  std::vector<std::string> endpoints;
+  endpoints.reserve(addrs.size());
+  for (const auto& addr : addrs) {
+    const auto addr_string = addr.PrimaryAddressString();
+    endpoints.push_back(
+        addr.Domain() == engine::io::AddrDomain::kInet6
+            ? fmt::format("[{}]:{}", addr_string, port)
+            : fmt::format("{}:{}", addr_string, port));
+  }
+  endpoint_lease_ = balancer->Pick(endpoints);
+  balanced_connect_to_.emplace(fmt::format(
+      "{}:{}:{}", hostname, port, endpoints[endpoint_lease_.GetIndex()]));
+  easy().set_connect_to(balanced_connect_to_->GetUnderlying());
 }
 
 void RequestState::SetTracingManager(const tracing::TracingManagerBase& m) {
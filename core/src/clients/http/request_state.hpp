@@ -7,8 +7,10 @@
 #include <string>
 #include <system_error>
 
+#include <userver/clients/balancing/endpoint_balancer.hpp>
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/clients/http/config.hpp>
+#include <userver/clients/http/connect_to.hpp>
 #include <userver/clients/http/error.hpp>
 #include <userver/clients/http/form.hpp>
 #include <userver/clients/http/plugin.hpp>
@@ -110,6 +112,11 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
 
   void SetDestinationMetricName(const std::string& destination);
 
+  const std::string& GetDestinationMetricName() const noexcept;
+
+  /// fail the current attempt without sending it, see PluginRequest::Reject
+  void RejectByPlugin(std::string reason);
+
   void SetTestsuiteConfig(const std::shared_ptr<const TestsuiteConfig>& config);
 
   void SetAllowedUrlsExtra(const std::vector<std::string>& urls);
@@ -162,6 +169,7 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
       std::chrono::milliseconds backoff = {});
   void UpdateTimeoutHeader();
   void HandleDeadlineAlreadyPassed();
+  void HandleRejectedByPlugin();
   void CheckResponseDeadline(std::error_code& err, Status status_code);
   bool IsDeadlineExpiredResponse(Status status_code);
   bool ShouldRetryResponse();
@@ -184,6 +192,7 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
   void WithRequestStats(const Func& func);
 
   void ResolveTargetAddress(clients::dns::Resolver& resolver);
+  void BindToDestination() noexcept;
 
   /// curl handler wrapper
   impl::EasyWrapper easy_;
@@ -214,6 +223,8 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
   engine::Deadline deadline_;
   bool timeout_updated_by_deadline_{false};
   bool deadline_expired_{false};
+  /// set by a plugin to fail the current attempt
+  std::optional<std::string> plugin_reject_reason_;
 
   utils::NotNull<const tracing::TracingManagerBase*> tracing_manager_;
   const clients::http::plugins::headers_propagator::HeadersPropagator*
@@ -237,6 +248,10 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
   std::array<char, CURL_ERROR_SIZE> errorbuffer_{};
 
   clients::dns::Resolver* resolver_{nullptr};
+  /// set by connect_to(), the endpoint balancing must not override it
+  bool has_connect_to_{false};
+  std::optional<ConnectTo> balanced_connect_to_;
+  balancing::EndpointBalancer::Lease endpoint_lease_;
   std::string proxy_url_;
   impl::PluginPipeline& plugin_pipeline_;
 
@@ -0,0 +1,100 @@
+#include <userver/clients/http/request_template.hpp>
+
+#include <userver/http/common_headers.hpp>
+#include <userver/utils/algo.hpp>
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+RequestTemplate& RequestTemplate::method(HttpMethod method) & {
+  method_ = method;
+  return *this;
+}
+RequestTemplate RequestTemplate::method(HttpMethod method) && {
+  return std::move(this->method(method));
+}
+
+RequestTemplate& RequestTemplate::post() & { return method(HttpMethod::kPost); }
+RequestTemplate RequestTemplate::post() && { return std::move(this->post()); }
+
+RequestTemplate& RequestTemplate::url(std::string url) & {
+  url_ = std::move(url);
+  return *this;
+}
+RequestTemplate RequestTemplate::url(std::string url) && {
+  return std::move(this->url(std::move(url)));
+}
+
+RequestTemplate& RequestTemplate::headers(const Headers& headers) & {
+  for (const auto& [name, value] : headers) AddHeader(name, value);
+  return *this;
+}
+RequestTemplate RequestTemplate::headers(const Headers& headers) && {
+  return std::move(this->headers(headers));
+}
+
+RequestTemplate& RequestTemplate::headers(
+    const std::initializer_list<std::pair<std::string_view, std::string_view>>&
+        headers) & {
+  for (const auto& [name, value] : headers) AddHeader(name, value);
+  return *this;
+}
+RequestTemplate RequestTemplate::headers(
+    const std::initializer_list<std::pair<std::string_view, std::string_view>>&
+        headers) && {
+  return std::move(this->headers(headers));
+}
+
+RequestTemplate& RequestTemplate::user_agent(std::string value) & {
+  user_agent_ = std::move(value);
+  return *this;
+}
+RequestTemplate RequestTemplate::user_agent(std::string value) && {
+  return std::move(this->user_agent(std::move(value)));
+}
+
+RequestTemplate& RequestTemplate::timeout(std::chrono::milliseconds timeout) & {
+  timeout_ = timeout;
+  return *this;
+}
+RequestTemplate RequestTemplate::timeout(
+    std::chrono::milliseconds timeout) && {
+  return std::move(this->timeout(timeout));
+}
+
+RequestTemplate& RequestTemplate::retry(short retries, bool on_fails) & {
+  retry_ = Retry{retries, on_fails};
+  return *this;
+}
+RequestTemplate RequestTemplate::retry(short retries, bool on_fails) && {
+  return std::move(this->retry(retries, on_fails));
+}
+
+RequestTemplate& RequestTemplate::http_version(HttpVersion version) & {
+  http_version_ = version;
+  return *this;
+}
+RequestTemplate RequestTemplate::http_version(HttpVersion version) && {
+  return std::move(this->http_version(version));
+}
+
+void RequestTemplate::AddHeader(std::string_view name, std::string_view value) {
+  if (utils::StrIcaseEqual{}(name,
+                             USERVER_NAMESPACE::http::headers::kUserAgent)) {
+    user_agent_ = std::string{value};
+    return;
+  }
+
+  // Same as curl::easy::add_header does for each request
+  if (value.empty()) {
+    header_lines_.push_back(utils::StrCat(name, ";"));
+  } else {
+    header_lines_.push_back(utils::StrCat(name, ": ", value));
+  }
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
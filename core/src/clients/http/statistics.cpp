@@ -28,6 +28,11 @@ RequestStats::RequestStats(Statistics& stats) : stats_(&stats) {
   stats_->easy_handles_++;
 }
 
+RequestStats::RequestStats(std::shared_ptr<Statistics> stats)
+    : RequestStats(*stats) {
+  stats_holder_ = std::move(stats);
+}
+
 RequestStats::~RequestStats() {
   if (stats_) {
     stats_->easy_handles_--;
@@ -35,7 +40,8 @@ RequestStats::~RequestStats() {
 }
 
 RequestStats::RequestStats(RequestStats&& other) noexcept
-    : stats_{std::exchange(other.stats_, nullptr)} {}
+    : stats_{std::exchange(other.stats_, nullptr)},
+      stats_holder_{std::move(other.stats_holder_)} {}
 
 void RequestStats::Start() { start_time_ = std::chrono::steady_clock::now(); }
 
@@ -77,6 +83,21 @@ void RequestStats::AccountOpenSockets(size_t sockets) noexcept {
   stats_->socket_open_ += utils::statistics::Rate{sockets};
 }
 
+void RequestStats::AccountReusedSocket() noexcept {
+  UASSERT(stats_);
+  ++stats_->socket_reused_;
+}
+
+void RequestStats::AccountHttp2Stream() noexcept {
+  UASSERT(stats_);
+  ++stats_->http2_streams_;
+}
+
+void RequestStats::AccountTlsHandshake() noexcept {
+  UASSERT(stats_);
+  ++stats_->tls_handshakes_;
+}
+
 void RequestStats::AccountTimeoutUpdatedByDeadline() noexcept {
   UASSERT(stats_);
   ++stats_->timeout_updated_by_deadline_;
@@ -87,6 +108,11 @@ void RequestStats::AccountCancelledByDeadline() noexcept {
   ++stats_->cancelled_by_deadline_;
 }
 
+void RequestStats::AccountRejectedByPlugin() noexcept {
+  UASSERT(stats_);
+  ++stats_->rejected_by_plugins_;
+}
+
 Statistics::ErrorGroup Statistics::ErrorCodeToGroup(std::error_code ec) {
   using ErrorCode = curl::errc::EasyErrorCode;
 
@@ -156,6 +182,25 @@ void Statistics::AccountError(ErrorGroup error) {
 
 void Statistics::AccountStatus(int code) { reply_status_.Account(code); }
 
+void Statistics::AccountCoalescedRequest() noexcept { ++coalesced_requests_; }
+
+void Statistics::AccountHedgedRequest() noexcept { ++hedged_requests_; }
+
+std::optional<std::size_t> Statistics::GetTimingsPercentile(
+    double percent) const {
+  using Duration = decltype(timings_percentile_)::Duration;
+  const auto timings = timings_percentile_.GetStatsForPeriod(
+      Duration::min(), /*with_current_epoch=*/true);
+  if (timings.Count() == 0) return std::nullopt;
+  return timings.GetPercentile(percent);
+}
+
+std::uint64_t Statistics::GetFinishedRequests() const noexcept {
+  std::uint64_t result = 0;
+  for (const auto& counter : error_count_) result += counter.Load().value;
+  return result;
+}
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const DestinationStatisticsView& view) {
   const auto& stats = view.stats;
@@ -176,8 +221,17 @@ void DumpMetric(utils::statistics::Writer& writer,
 
   writer["timeout-updated-by-deadline"] = stats.timeout_updated_by_deadline;
   writer["cancelled-by-deadline"] = stats.cancelled_by_deadline;
+  writer["rejected-by-plugins"] = stats.rejected_by_plugins;
 
   writer["sockets"]["open"] = stats.multi.socket_open;
+  // Requests that were sent over an already established connection and
+  // did not pay for a TCP/TLS handshake
+  writer["sockets"]["reused"] = stats.multi.socket_reused;
+  writer["http2-streams"] = stats.http2_streams;
+  // New TLS connections, full handshakes and the resumed ones
+  writer["tls-handshakes"] = stats.tls_handshakes;
+  writer["coalesced-requests"] = stats.coalesced_requests;
+  writer["hedged-requests"] = stats.hedged_requests;
 }
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -216,10 +270,16 @@ InstanceStatistics::InstanceStatistics(const Statistics& other)
       retries(other.retries_.Load()),
       timeout_updated_by_deadline(other.timeout_updated_by_deadline_.Load()),
       cancelled_by_deadline(other.cancelled_by_deadline_.Load()),
+      rejected_by_plugins(other.rejected_by_plugins_.Load()),
+      http2_streams(other.http2_streams_.Load()),
+      tls_handshakes(other.tls_handshakes_.Load()),
+      coalesced_requests(other.coalesced_requests_.Load()),
+      hedged_requests(other.hedged_requests_.Load()),
       reply_status(other.reply_status_) {
   for (size_t i = 0; i < error_count.size(); i++)
     error_count[i] = other.error_count_[i].Load();
   multi.socket_open = other.socket_open_.Load();
+  multi.socket_reused = other.socket_reused_.Load();
 }
 
 uint64_t InstanceStatistics::GetNotOkErrorCount() const {
@@ -250,6 +310,11 @@ InstanceStatistics& InstanceStatistics::operator+=(
 
   timeout_updated_by_deadline += stat.timeout_updated_by_deadline;
   cancelled_by_deadline += stat.cancelled_by_deadline;
+  rejected_by_plugins += stat.rejected_by_plugins;
+  http2_streams += stat.http2_streams;
+  tls_handshakes += stat.tls_handshakes;
+  coalesced_requests += stat.coalesced_requests;
+  hedged_requests += stat.hedged_requests;
   reply_status += stat.reply_status;
 
   multi += stat.multi;
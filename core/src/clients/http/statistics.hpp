@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
@@ -22,6 +23,8 @@ class Statistics;
 class RequestStats final {
  public:
   explicit RequestStats(Statistics& stats);
+  // Keeps the stats alive, for the ones that may be dropped by their owner
+  explicit RequestStats(std::shared_ptr<Statistics> stats);
   ~RequestStats();
 
   RequestStats(const RequestStats&) = delete;
@@ -37,14 +40,20 @@ class RequestStats final {
   void StoreTimeToStart(std::chrono::microseconds micro_seconds) noexcept;
 
   void AccountOpenSockets(size_t sockets) noexcept;
+  void AccountReusedSocket() noexcept;
+  void AccountHttp2Stream() noexcept;
+  void AccountTlsHandshake() noexcept;
 
   void AccountTimeoutUpdatedByDeadline() noexcept;
   void AccountCancelledByDeadline() noexcept;
 
+  void AccountRejectedByPlugin() noexcept;
+
  private:
   void StoreTiming() noexcept;
 
   Statistics* stats_;
+  std::shared_ptr<Statistics> stats_holder_;
   std::chrono::steady_clock::time_point start_time_;
 };
 
@@ -52,10 +61,12 @@ struct MultiStats {
   utils::statistics::Rate socket_open;
   utils::statistics::Rate socket_close;
   utils::statistics::Rate socket_ratelimit;
+  utils::statistics::Rate socket_reused;
   double current_load{0};
 
   MultiStats& operator+=(const MultiStats& other) {
     socket_open += other.socket_open;
+    socket_reused += other.socket_reused;
     socket_close += other.socket_close;
     socket_ratelimit += other.socket_ratelimit;
     current_load += other.current_load;
@@ -96,6 +107,17 @@ class Statistics {
 
   void AccountStatus(int);
 
+  void AccountCoalescedRequest() noexcept;
+
+  void AccountHedgedRequest() noexcept;
+
+  // Returns the percentile of the recent timings in milliseconds,
+  // std::nullopt if there were no requests
+  std::optional<std::size_t> GetTimingsPercentile(double percent) const;
+
+  // Returns the count of the finished requests, both successful and not
+  std::uint64_t GetFinishedRequests() const noexcept;
+
  private:
   std::atomic<uint64_t> easy_handles_{0};
   std::atomic<uint64_t> last_time_to_start_us_{0};
@@ -105,8 +127,14 @@ class Statistics {
   std::array<utils::statistics::RateCounter, kErrorGroupCount> error_count_;
   utils::statistics::RateCounter retries_;
   utils::statistics::RateCounter socket_open_{0};
+  utils::statistics::RateCounter socket_reused_{0};
+  utils::statistics::RateCounter http2_streams_{0};
+  utils::statistics::RateCounter tls_handshakes_{0};
+  utils::statistics::RateCounter coalesced_requests_{0};
+  utils::statistics::RateCounter hedged_requests_{0};
   utils::statistics::RateCounter timeout_updated_by_deadline_;
   utils::statistics::RateCounter cancelled_by_deadline_;
+  utils::statistics::RateCounter rejected_by_plugins_;
   utils::statistics::HttpCodes reply_status_;
 
   friend struct InstanceStatistics;
@@ -134,6 +162,11 @@ struct InstanceStatistics {
 
   utils::statistics::Rate timeout_updated_by_deadline;
   utils::statistics::Rate cancelled_by_deadline;
+  utils::statistics::Rate rejected_by_plugins;
+  utils::statistics::Rate http2_streams;
+  utils::statistics::Rate tls_handshakes;
+  utils::statistics::Rate coalesced_requests;
+  utils::statistics::Rate hedged_requests;
   utils::statistics::HttpCodes::Snapshot reply_status;
 
   MultiStats multi;
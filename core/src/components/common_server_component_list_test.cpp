@@ -9,6 +9,7 @@
 #include <userver/fs/blocking/write.hpp>  // for fs::blocking::RewriteFileContents
 #include <userver/internal/net/net_listener.hpp>
 #include <userver/logging/impl/mem_logger.hpp>
+#include <userver/server/handlers/cpu_profiler.hpp>
 #include <userver/server/handlers/ping.hpp>
 #include <userver/utest/utest.hpp>
 
@@ -200,6 +201,13 @@ components_manager:
         method: POST
         task_processor: monitor-task-processor
 # /// [Sample handler jemalloc component config]
+# /// [Sample handler cpu profiler component config]
+# yaml
+    handler-cpu-profiler:
+        path: /service/cpu-profiler/{command}
+        method: GET,POST
+        task_processor: monitor-task-processor
+# /// [Sample handler cpu profiler component config]
 # /// [Sample handler dns client control component config]
 # yaml
     handler-dns-client-control:
@@ -284,6 +292,7 @@ TEST_F(CommonServerComponentList, Smoke) {
                                  GetConfigVarsPath()},
       components::CommonComponentList()
           .AppendComponentList(components::CommonServerComponentList())
+          .Append<server::handlers::CpuProfiler>()
           .Append<server::handlers::Ping>());
 }
 
@@ -302,6 +311,7 @@ TEST_F(CommonServerComponentList, Logger) {
                                  GetConfigVarsPath()},
       components::CommonComponentList()
           .AppendComponentList(components::CommonServerComponentList())
+          .Append<server::handlers::CpuProfiler>()
           .Append<server::handlers::Ping>());
 
   logging::SetDefaultLoggerLevel(logging::Level::kInfo);
@@ -322,6 +332,7 @@ TEST_F(CommonServerComponentList, TraceLogging) {
                                  GetConfigVarsPath()},
       components::CommonComponentList()
           .AppendComponentList(components::CommonServerComponentList())
+          .Append<server::handlers::CpuProfiler>()
           .Append<server::handlers::Ping>());
 }
 
@@ -337,6 +348,7 @@ TEST_F(CommonServerComponentList, NullLogging) {
                                  GetConfigVarsPath()},
       components::CommonComponentList()
           .AppendComponentList(components::CommonServerComponentList())
+          .Append<server::handlers::CpuProfiler>()
           .Append<server::handlers::Ping>());
 }
 
@@ -72,6 +72,12 @@ RawComponentBase* ComponentContext::DoFindComponent(
   return impl_->DoFindComponent(name);
 }
 
+void ComponentContext::WriteStartupTimeline(
+    const std::string& path,
+    std::chrono::steady_clock::time_point start_time) const {
+  impl_->WriteStartupTimeline(path, start_time);
+}
+
 }  // namespace components
 
 USERVER_NAMESPACE_END
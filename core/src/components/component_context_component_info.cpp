@@ -28,6 +28,7 @@ void ComponentInfo::SetComponent(
     std::lock_guard lock{mutex_};
     component_ = std::move(component);
     stage_ = ComponentLifetimeStage::kCreated;
+    load_timings_.ready = std::chrono::steady_clock::now();
     if (stage_switching_cancelled_) call_on_loading_cancelled = true;
   }
   if (call_on_loading_cancelled) OnLoadingCancelled();
@@ -168,6 +169,22 @@ std::string ComponentInfo::GetDependencies() const {
                      fmt::join(it_depends_on_, delimiter));
 }
 
+void ComponentInfo::OnLoadingStarted() {
+  std::lock_guard lock{mutex_};
+  load_timings_.load_start = std::chrono::steady_clock::now();
+}
+
+void ComponentInfo::AddDependenciesWaitTime(
+    std::chrono::steady_clock::duration wait_time) {
+  std::lock_guard lock{mutex_};
+  load_timings_.dependencies_wait += wait_time;
+}
+
+ComponentLoadTimings ComponentInfo::GetLoadTimings() const {
+  std::lock_guard lock{mutex_};
+  return load_timings_;
+}
+
 bool ComponentInfo::HasComponent() const {
   std::lock_guard lock{mutex_};
   return !!component_;
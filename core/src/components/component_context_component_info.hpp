@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <set>
 #include <string>
@@ -27,6 +28,12 @@ class StageSwitchingCancelledException : public std::runtime_error {
   explicit StageSwitchingCancelledException(const std::string& message);
 };
 
+struct ComponentLoadTimings final {
+  std::chrono::steady_clock::time_point load_start{};
+  std::chrono::steady_clock::duration dependencies_wait{};
+  std::chrono::steady_clock::time_point ready{};
+};
+
 class ComponentInfo final {
  public:
   explicit ComponentInfo(std::string name);
@@ -97,6 +104,10 @@ class ComponentInfo final {
 
   std::string GetDependencies() const;
 
+  void OnLoadingStarted();
+  void AddDependenciesWaitTime(std::chrono::steady_clock::duration wait_time);
+  ComponentLoadTimings GetLoadTimings() const;
+
  private:
   bool HasComponent() const;
   std::unique_ptr<RawComponentBase> ExtractComponent();
@@ -109,6 +120,7 @@ class ComponentInfo final {
   std::set<ComponentNameFromInfo> it_depends_on_;
   std::set<ComponentNameFromInfo> depends_on_it_;
   ComponentLifetimeStage stage_ = ComponentLifetimeStage::kNull;
+  ComponentLoadTimings load_timings_;
   bool stage_switching_cancelled_{false};
   std::atomic<bool> on_loading_cancelled_called_{false};
 };
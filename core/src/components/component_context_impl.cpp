@@ -1,6 +1,7 @@
 #include <components/component_context_impl.hpp>
 
 #include <algorithm>
+#include <optional>
 #include <queue>
 
 #include <fmt/format.h>
@@ -8,6 +9,9 @@
 #include <userver/compiler/demangle.hpp>
 #include <userver/concurrent/variable.hpp>
 #include <userver/engine/task/task_with_result.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/fs/blocking/write.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/assert.hpp>
@@ -44,6 +48,11 @@ std::string JoinNamesFromInfo(const Container& container,
   return chain;
 }
 
+std::int64_t ToMilliseconds(std::chrono::steady_clock::duration duration) {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(duration)
+      .count();
+}
+
 }  // namespace
 
 ComponentContextImpl::TaskToComponentMapScope::TaskToComponentMapScope(
@@ -118,6 +127,7 @@ RawComponentBase* ComponentContextImpl::AddComponent(
     throw std::runtime_error("trying to add component " + std::string{name} +
                              " multiple times");
 
+  component_info.OnLoadingStarted();
   component_info.SetComponent(factory(context));
   auto* component = component_info.GetComponent();
   if (component) {
@@ -410,7 +420,91 @@ RawComponentBase* ComponentContextImpl::DoFindComponent(std::string_view name) {
   }
   SearchingComponentScope finder(*this, this_component_name);
 
-  return component_info.WaitAndGetComponent();
+  const auto wait_start = std::chrono::steady_clock::now();
+  auto* const found_component = component_info.WaitAndGetComponent();
+  components_.at(this_component_name)
+      .AddDependenciesWaitTime(std::chrono::steady_clock::now() - wait_start);
+  return found_component;
+}
+
+void ComponentContextImpl::WriteStartupTimeline(
+    const std::string& path,
+    std::chrono::steady_clock::time_point start_time) const {
+  using ComponentTimings =
+      std::pair<impl::ComponentNameFromInfo, impl::ComponentLoadTimings>;
+  std::vector<ComponentTimings> timings;
+  timings.reserve(components_.size());
+  for (const auto& [name, component_info] : components_) {
+    timings.emplace_back(name, component_info.GetLoadTimings());
+  }
+  std::sort(timings.begin(), timings.end(), [](const auto& x, const auto& y) {
+    return x.second.ready < y.second.ready;
+  });
+
+  formats::json::ValueBuilder components(formats::common::Type::kArray);
+  for (const auto& [name, component_timings] : timings) {
+    formats::json::ValueBuilder item;
+    item["name"] = name.StringViewName();
+    item["load-start-ms"] =
+        ToMilliseconds(component_timings.load_start - start_time);
+    item["dependencies-wait-ms"] =
+        ToMilliseconds(component_timings.dependencies_wait);
+    item["ready-ms"] = ToMilliseconds(component_timings.ready - start_time);
+
+    formats::json::ValueBuilder dependencies(formats::common::Type::kArray);
+    components_.at(name).ForEachItDependsOn(
+        [&](impl::ComponentNameFromInfo dependency) {
+          dependencies.PushBack(dependency.StringViewName());
+        });
+    item["dependencies"] = std::move(dependencies);
+
+    components.PushBack(std::move(item));
+  }
+
+  formats::json::ValueBuilder critical_path(formats::common::Type::kArray);
+  for (const auto name : FindStartupCriticalPath()) {
+    critical_path.PushBack(name.StringViewName());
+  }
+
+  formats::json::ValueBuilder timeline;
+  timeline["components"] = std::move(components);
+  timeline["critical-path"] = std::move(critical_path);
+
+  fs::blocking::RewriteFileContents(
+      path, formats::json::ToPrettyString(timeline.ExtractValue()));
+  LOG_INFO() << "Wrote the components startup timeline to " << path;
+}
+
+std::vector<impl::ComponentNameFromInfo>
+ComponentContextImpl::FindStartupCriticalPath() const {
+  const auto ready_time = [this](impl::ComponentNameFromInfo name) {
+    return components_.at(name).GetLoadTimings().ready;
+  };
+
+  // The component that is ready last, then the dependency of each component
+  // that is ready last, down to a component without dependencies
+  std::vector<impl::ComponentNameFromInfo> path;
+  for (const auto& [name, component_info] : components_) {
+    if (path.empty() || ready_time(path.front()) < ready_time(name)) {
+      path.assign({name});
+    }
+  }
+
+  while (!path.empty()) {
+    std::optional<impl::ComponentNameFromInfo> slowest_dependency;
+    components_.at(path.back())
+        .ForEachItDependsOn([&](impl::ComponentNameFromInfo dependency) {
+          if (!slowest_dependency ||
+              ready_time(*slowest_dependency) < ready_time(dependency)) {
+            slowest_dependency = dependency;
+          }
+        });
+    if (!slowest_dependency) break;
+    path.push_back(*slowest_dependency);
+  }
+
+  std::reverse(path.begin(), path.end());
+  return path;
 }
 
 void ComponentContextImpl::AddDependency(impl::ComponentNameFromInfo name) {
@@ -3,6 +3,7 @@
 #include <userver/components/component_context.hpp>
 
 #include <atomic>
+#include <chrono>
 #include <set>
 #include <stdexcept>
 #include <unordered_map>
@@ -62,6 +63,10 @@ class ComponentContextImpl {
 
   RawComponentBase* DoFindComponent(std::string_view name);
 
+  void WriteStartupTimeline(
+      const std::string& path,
+      std::chrono::steady_clock::time_point start_time) const;
+
  private:
   class TaskToComponentMapScope final {
    public:
@@ -148,6 +153,8 @@ class ComponentContextImpl {
   static impl::ComponentNameFromInfo GetLoadingComponentName(
       const ProtectedData&);
 
+  std::vector<impl::ComponentNameFromInfo> FindStartupCriticalPath() const;
+
   void StartPrintAddingComponentsTask();
   void StopPrintAddingComponentsTask();
   void PrintAddingComponents() const;
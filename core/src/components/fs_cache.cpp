@@ -1,12 +1,27 @@
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/components/fs_cache.hpp>
+
+#include <userver/utils/flags.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace components {
 
+namespace {
+
+utils::Flags<fs::SettingsReadFile> GetReadFlags(
+    const components::ComponentConfig& config) {
+  utils::Flags<fs::SettingsReadFile> flags{fs::SettingsReadFile::kSkipHidden};
+  if (config["use-mmap"].As<bool>(false)) {
+    flags |= fs::SettingsReadFile::kMmap;
+  }
+  return flags;
+}
+
+}  // namespace
+
 const FsCache::Client& FsCache::GetClient() const { return client_; }
 
 FsCache::FsCache(const components::ComponentConfig& config,
@@ -16,7 +31,8 @@ FsCache::FsCache(const components::ComponentConfig& config,
           config["dir"].As<std::string>("/var/www"),
           config["update-period"].As<std::chrono::milliseconds>(0),
           context.GetTaskProcessor(config["fs-task-processor"].As<std::string>(
-              "fs-task-processor"))) {}
+              "fs-task-processor")),
+          GetReadFlags(config)) {}
 
 yaml_config::Schema FsCache::GetStaticConfigSchema() {
   return yaml_config::MergeSchemas<components::ComponentBase>(R"(
@@ -37,6 +53,12 @@ properties:
         type: string
         description: task processor to do filesystem operations
         defaultDescription: fs-task-processor
+    use-mmap:
+        type: boolean
+        description: |
+            map the files into memory instead of reading them, the files must
+            be replaced atomically and never rewritten in place
+        defaultDescription: false
 )");
 }
 
@@ -389,6 +389,15 @@ void Manager::AddComponents(const ComponentList& component_list) {
       stop_time - start_time);
 
   LOG_INFO() << "All components loaded";
+
+  if (config_->startup_timeline_file) {
+    try {
+      component_context_.WriteStartupTimeline(*config_->startup_timeline_file,
+                                              start_time);
+    } catch (const std::exception& ex) {
+      LOG_ERROR() << "Failed to write the components startup timeline: " << ex;
+    }
+  }
 }
 
 void Manager::AddComponentImpl(
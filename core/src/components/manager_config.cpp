@@ -1,11 +1,17 @@
 #include <components/manager_config.hpp>
 
+#include <cstdlib>
 #include <fstream>
+#include <iterator>
+
+#include <fmt/format.h>
 
 #include <userver/components/static_config_validator.hpp>
 #include <userver/formats/parse/common_containers.hpp>
+#include <userver/formats/yaml/impl/snapshot.hpp>
 #include <userver/formats/yaml/serialize.hpp>
 #include <userver/formats/yaml/value_builder.hpp>
+#include <userver/fs/blocking/read.hpp>
 #include <userver/utils/impl/userver_experiments.hpp>
 #include <userver/yaml_config/impl/validate_static_config.hpp>
 #include <userver/yaml_config/map_to_array.hpp>
@@ -17,14 +23,42 @@ namespace components {
 
 namespace {
 
+constexpr const char* kSnapshotDirEnv = "USERVER_STATIC_CONFIG_SNAPSHOT_DIR";
+
+std::optional<std::string> GetSnapshotDir() {
+  // NOLINTNEXTLINE(concurrency-mt-unsafe)
+  const char* snapshot_dir = std::getenv(kSnapshotDirEnv);
+  if (!snapshot_dir || !*snapshot_dir) return std::nullopt;
+  return snapshot_dir;
+}
+
 formats::yaml::Value ParseYaml(const std::string& doc) {
+  if (const auto snapshot_dir = GetSnapshotDir()) {
+    return formats::yaml::impl::FromStringWithSnapshot(doc, *snapshot_dir);
+  }
   return formats::yaml::FromString(doc);
 }
 
 formats::yaml::Value ParseYaml(std::istream& is) {
+  if (is && GetSnapshotDir()) {
+    return ParseYaml(std::string{std::istreambuf_iterator<char>(is), {}});
+  }
   return formats::yaml::FromStream(is);
 }
 
+formats::yaml::Value ParseYamlFile(const std::string& path) {
+  const auto snapshot_dir = GetSnapshotDir();
+  if (!snapshot_dir) return formats::yaml::blocking::FromFile(path);
+
+  try {
+    return formats::yaml::impl::FromStringWithSnapshot(
+        fs::blocking::ReadFileContents(path), *snapshot_dir);
+  } catch (const std::exception& e) {
+    throw formats::yaml::ParseException(
+        fmt::format("Parsing '{}' failed. {}", path, e.what()));
+  }
+}
+
 template <typename T>
 ManagerConfig ParseFromAny(
     T&& source, const std::string& source_desc,
@@ -51,14 +85,13 @@ ManagerConfig ParseFromAny(
   }
   formats::yaml::Value config_vars;
   if (config_vars_path) {
-    config_vars = formats::yaml::blocking::FromFile(*config_vars_path);
+    config_vars = ParseYamlFile(*config_vars_path);
   }
 
   if (user_config_vars_override_path) {
     formats::yaml::ValueBuilder builder = config_vars;
 
-    auto local_config_vars =
-        formats::yaml::blocking::FromFile(*user_config_vars_override_path);
+    auto local_config_vars = ParseYamlFile(*user_config_vars_override_path);
     for (const auto& [name, value] : Items(local_config_vars)) {
       builder[name] = value;
     }
@@ -115,6 +148,31 @@ properties:
                     lead to inaccuracy in coro pool size estimation.
                     local_cache_size=0 disables local cache.
                 defaultDescription: 8
+            stack_mode:
+                type: string
+                description: |
+                    'fixed' commits the whole stack_size from the start,
+                    'growable' reserves stack_size of address space with
+                    MAP_NORESERVE, the kernel commits the stack pages on the
+                    first touch
+                defaultDescription: fixed
+                enum:
+                  - fixed
+                  - growable
+            initial_stack_size:
+                type: integer
+                description: |
+                    part of a coroutine stack that is kept on trimming,
+                    bytes; only used with stack_mode=growable
+                defaultDescription: 32 * 1024
+            stack_trim_threshold:
+                type: integer
+                description: |
+                    stacks that have grown past this size are trimmed back
+                    to initial_stack_size with madvise(MADV_DONTNEED) on
+                    return to the pool, bytes; 0 disables the trimming;
+                    only used with stack_mode=growable
+                defaultDescription: 128 * 1024
     event_thread_pool:
         type: object
         description: event thread pool options
@@ -173,6 +231,94 @@ properties:
                         tunes the number of spin-wait iterations in case of
                         an empty task queue before threads go to sleep
                     defaultDescription: 10000
+                spinning-policy:
+                    type: string
+                    description: |
+                        `fixed` always spins for `spinning-iterations`.
+                        `adaptive` uses `spinning-iterations` as an upper
+                        bound, spins longer while the tasks keep arriving and
+                        parks sooner when the task processor is idle
+                    defaultDescription: fixed
+                    enum:
+                      - fixed
+                      - adaptive
+                task-queue:
+                    type: string
+                    description: |
+                        task queue implementation. `global` is a single
+                        queue shared by all the workers. `work-stealing` gives
+                        each worker its own run queue, other workers steal
+                        from it when idle. `priority` runs tasks in the order
+                        of their engine::Task::Priority class.
+                    defaultDescription: global
+                    enum:
+                      - global
+                      - work-stealing
+                      - priority
+                numa-aware:
+                    type: boolean
+                    description: |
+                        split the workers between NUMA nodes and pin them to
+                        the CPUs of their node. Workers steal tasks from the
+                        workers of their own node first. Requires
+                        `task-queue: work-stealing`
+                    defaultDescription: false
+                earliest-deadline-first:
+                    type: boolean
+                    description: |
+                        order the tasks of a priority class by the deadline
+                        of the request they work for (see
+                        server::request::TaskInheritedData), tasks without
+                        one go after them. Tasks whose request deadline has
+                        expired in the queue are cancelled. Requires
+                        `task-queue: priority`
+                    defaultDescription: false
+                io-backend:
+                    type: string
+                    description: |
+                        how the sockets wait for I/O: on the ev threads or
+                        with the io_uring rings of the worker threads. Falls
+                        back to libev if io_uring is not available
+                    defaultDescription: libev
+                    enum:
+                      - libev
+                      - io-uring
+                ev-loops-in-workers:
+                    type: boolean
+                    description: |
+                        give each worker an ev loop of its own, that the worker
+                        runs between the task steps. The timers and the
+                        sockets of the tasks are then served without a
+                        handoff to the ev threads
+                    defaultDescription: false
+                jemalloc-arena:
+                    type: object
+                    description: |
+                        a dedicated jemalloc arena for the worker threads
+                    additionalProperties: false
+                    properties:
+                        enabled:
+                            type: boolean
+                            description: |
+                                whether the workers allocate from the arena
+                            defaultDescription: true
+                        dirty-decay:
+                            type: string
+                            description: |
+                                time for the unused dirty pages of the arena
+                                to be purged
+                            defaultDescription: jemalloc default
+                        muzzy-decay:
+                            type: string
+                            description: |
+                                time for the unused muzzy pages of the arena
+                                to be purged
+                            defaultDescription: jemalloc default
+                        tcache:
+                            type: boolean
+                            description: |
+                                whether the workers use jemalloc thread caches
+                            defaultDescription: true
                 task-trace:
                     type: object
                     description: .
@@ -205,6 +351,14 @@ properties:
         type: boolean
         description: whether to collect a dummy stacktrace at server start up
         defaultDescription: true
+    startup_timeline_file:
+        type: string
+        description: |
+            path to write the components startup timeline to, in JSON. For each
+            component it contains the time its constructor started, the time
+            spent waiting for its dependencies, and the time it became ready,
+            along with the chain of components that took the longest to start
+        defaultDescription: the timeline is not written
     static_config_validation:
         type: object
         description: settings for basic syntax validation in config.yaml
@@ -248,6 +402,8 @@ ManagerConfig Parse(const yaml_config::YamlConfig& value,
   config.preheat_stacktrace_collector =
       value["preheat_stacktrace_collector"].As<bool>(
           config.preheat_stacktrace_collector);
+  config.startup_timeline_file =
+      value["startup_timeline_file"].As<std::optional<std::string>>();
   return config;
 }
 
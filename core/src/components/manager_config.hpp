@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -29,6 +30,7 @@ struct ManagerConfig {
   bool mlock_debug_info{true};
   bool disable_phdr_cache{false};
   bool preheat_stacktrace_collector{true};
+  std::optional<std::string> startup_timeline_file;
 
   static ManagerConfig FromString(
       const std::string&, const std::optional<std::string>& config_vars_path,
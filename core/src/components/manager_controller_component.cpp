@@ -4,6 +4,7 @@
 #include <components/manager_controller_component_config.hpp>
 #include <engine/task/task_processor.hpp>
 #include <engine/task/task_processor_pools.hpp>
+#include <utils/jemalloc.hpp>
 #include <userver/components/statistics_storage.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
@@ -48,6 +49,41 @@ void DumpMetric(utils::statistics::Writer& writer,
     context_switch["no_overloaded"] = counter.GetTasksNoOverloadSensor().value;
   }
 
+  const auto idle = task_processor.GetIdleStats();
+  if (auto worker_idle = writer["worker-idle"]) {
+    worker_idle["spin-wakeups"] = idle.spin_wakeups.value;
+    worker_idle["parks"] = idle.parks.value;
+    worker_idle["short-parks"] = idle.short_parks.value;
+    worker_idle["spin-iterations"] = idle.spin_iterations.value;
+    worker_idle["spin-budget"] = idle.spin_budget;
+  }
+
+  if (task_processor.ShouldAccountWaitTime()) {
+    if (auto off_cpu = writer["off-cpu"]) {
+      for (std::size_t i = 0; i < impl::kWaitKindCount; ++i) {
+        const auto kind = static_cast<impl::WaitKind>(i);
+        off_cpu["waits"].ValueWithLabels(counter.GetWaits(kind).value,
+                                         {{"wait_kind", ToString(kind)}});
+        off_cpu["time-us"].ValueWithLabels(counter.GetWaitTime(kind).value,
+                                           {{"wait_kind", ToString(kind)}});
+      }
+    }
+  }
+
+  if (const auto arena = task_processor.GetJemallocArena()) {
+    utils::jemalloc::ArenaStats stats;
+    if (!utils::jemalloc::GetArenaStats(*arena, stats)) {
+      if (auto arena_writer = writer["jemalloc-arena"]) {
+        arena_writer["allocated-bytes"] = stats.allocated_bytes;
+        arena_writer["active-bytes"] = stats.active_bytes;
+        arena_writer["dirty-bytes"] = stats.dirty_bytes;
+        arena_writer["muzzy-bytes"] = stats.muzzy_bytes;
+        arena_writer["mapped-bytes"] = stats.mapped_bytes;
+        arena_writer["resident-bytes"] = stats.resident_bytes;
+      }
+    }
+  }
+
   writer["worker-threads"] = task_processor.GetWorkerCount();
 }
 
@@ -113,6 +149,10 @@ void ManagerControllerComponent::WriteStatistics(
       stack_usage_stats["is-monitor-active"] =
           stats.is_stack_usage_monitor_active;
     }
+    if (auto stack_memory_stats = coro_pool["stack-memory"]) {
+      stack_memory_stats["reserved-bytes"] = stats.stack_reserved_bytes;
+      stack_memory_stats["committed-bytes"] = stats.stack_committed_bytes;
+    }
   }
 
   // misc
@@ -62,6 +62,10 @@ ManagerControllerDynamicConfig ManagerControllerDynamicConfig::Parse(
               value["execution-slice-threshold-us"].As<int>()};
       tp_settings.profiler_force_stacktrace =
           value["profiler-force-stacktrace"].As<bool>(false);
+      tp_settings.profiler_wait_time_accounting =
+          value["wait-time-accounting"].As<bool>(false);
+      tp_settings.profiler_cpu_time_accounting =
+          value["cpu-time-accounting"].As<bool>(false);
     }
   }
 
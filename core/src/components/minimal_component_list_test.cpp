@@ -3,6 +3,8 @@
 #include <fmt/format.h>
 
 #include <userver/components/run.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value.hpp>
 #include <userver/fs/blocking/temp_directory.hpp>
 #include <userver/fs/blocking/write.hpp>
 
@@ -32,4 +34,33 @@ TEST_F(ComponentList, Minimal) {
                       components::MinimalComponentList());
 }
 
+TEST_F(ComponentList, MinimalStartupTimeline) {
+  const auto temp_root = fs::blocking::TempDirectory::Create();
+  const std::string config_vars_path =
+      temp_root.GetPath() + "/config_vars.yaml";
+  const std::string timeline_path = temp_root.GetPath() + "/timeline.json";
+
+  std::string static_config =
+      std::string{tests::kMinimalStaticConfig} + config_vars_path + '\n';
+  const std::string_view kManagerSection = "components_manager:\n";
+  static_config.insert(
+      static_config.find(kManagerSection) + kManagerSection.size(),
+      "  startup_timeline_file: " + timeline_path + '\n');
+
+  fs::blocking::RewriteFileContents(config_vars_path, kConfigVarsTemplate);
+
+  components::RunOnce(components::InMemoryConfig{static_config},
+                      components::MinimalComponentList());
+
+  const auto timeline = formats::json::blocking::FromFile(timeline_path);
+  bool has_logging = false;
+  for (const auto& component : timeline["components"]) {
+    EXPECT_LE(component["load-start-ms"].As<std::int64_t>(),
+              component["ready-ms"].As<std::int64_t>());
+    if (component["name"].As<std::string>() == "logging") has_logging = true;
+  }
+  EXPECT_TRUE(has_logging);
+  EXPECT_FALSE(timeline["critical-path"].IsEmpty());
+}
+
 USERVER_NAMESPACE_END
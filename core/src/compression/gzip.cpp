@@ -1,5 +1,6 @@
 #include <compression/gzip.hpp>
 
+#include <boost/iostreams/device/back_inserter.hpp>
 #include <boost/iostreams/filter/gzip.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
 
@@ -42,6 +43,25 @@ std::string Decompress(std::string_view compressed, size_t max_size) {
   return decompressed;
 }
 
+std::string Compress(std::string_view data, int level) {
+  std::string compressed;
+
+  namespace bio = boost::iostreams;
+
+  try {
+    bio::filtering_ostream stream;
+    stream.push(bio::gzip_compressor(bio::gzip_params(level)));
+    stream.push(bio::back_inserter(compressed));
+    stream.write(data.data(), data.size());
+    // Flushes the gzip trailer
+    stream.reset();
+  } catch (const std::exception& e) {
+    throw CompressionError(fmt::format("Compression failed: {}", e.what()));
+  }
+
+  return compressed;
+}
+
 }  // namespace compression::gzip
 
 USERVER_NAMESPACE_END
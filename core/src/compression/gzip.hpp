@@ -12,6 +12,10 @@ namespace compression::gzip {
 /// @throws DecompressionError
 std::string Decompress(std::string_view compressed, size_t max_size);
 
+/// Compresses the string with the `level` from 1 (fastest) to 9 (best).
+/// @throws CompressionError
+std::string Compress(std::string_view data, int level);
+
 }  // namespace compression::gzip
 
 USERVER_NAMESPACE_END
@@ -52,4 +52,16 @@ static void GzipDecompress(benchmark::State& state) {
 }
 BENCHMARK(GzipDecompress)->RangeMultiplier(2)->Range(1 << 10, 1 << 15);
 
+static void GzipCompress(benchmark::State& state) {
+  const auto data = GenerateRandomData(state.range(0));
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(
+        compression::gzip::Compress(data, static_cast<int>(state.range(1))));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(GzipCompress)
+    ->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 15, 2), {1, 6}});
+
 USERVER_NAMESPACE_END
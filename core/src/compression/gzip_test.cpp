@@ -29,4 +29,19 @@ TEST(Gzip, TestOverflow) {
                compression::TooBigError);
 }
 
+TEST(Gzip, CompressRoundTrip) {
+  constexpr std::size_t kSize = 16'000;
+  const std::string str(kSize, 'a');
+
+  const auto compressed = compression::gzip::Compress(str, 6);
+  EXPECT_LT(compressed.size(), str.size());
+
+  EXPECT_EQ(compression::gzip::Decompress(compressed, kSize), str);
+}
+
+TEST(Gzip, CompressEmpty) {
+  const auto compressed = compression::gzip::Compress({}, 6);
+  EXPECT_EQ(compression::gzip::Decompress(compressed, 0), "");
+}
+
 USERVER_NAMESPACE_END
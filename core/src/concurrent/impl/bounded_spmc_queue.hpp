@@ -0,0 +1,89 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <concurrent/impl/interference_shield.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent::impl {
+
+// A bounded single-producer, multiple-consumer FIFO queue of pointers.
+//
+// The producer (the "owner") never blocks and never spins. Consumers only
+// retry if another consumer has concurrently taken an item.
+//
+// Mostly useful as a per-thread run queue that other threads steal from,
+// see engine::WorkStealingTaskQueue. It is essentially the Chase-Lev deque
+// without the owner-side LIFO pop, which makes the owner side wait-free and
+// keeps the items in FIFO order for fairness.
+template <typename T, std::size_t Capacity>
+class BoundedSpmcQueue final {
+  static_assert(std::is_pointer_v<T>);
+  static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                "Capacity must be a power of 2");
+
+ public:
+  constexpr BoundedSpmcQueue() = default;
+
+  BoundedSpmcQueue(BoundedSpmcQueue&&) = delete;
+  BoundedSpmcQueue& operator=(BoundedSpmcQueue&&) = delete;
+
+  static constexpr std::size_t GetCapacity() noexcept { return Capacity; }
+
+  // Returns `false` if the queue is full, in which case the item is not
+  // pushed. Can only be called from one thread at a time.
+  [[nodiscard]] bool TryPush(T item) noexcept {
+    const auto tail = tail_->load(std::memory_order_relaxed);
+    const auto head = head_->load(std::memory_order_acquire);
+    if (tail - head >= Capacity) return false;
+
+    Slot(tail).store(item, std::memory_order_relaxed);
+    tail_->store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Returns the oldest item, or `nullptr` if the queue is empty.
+  // Can be called from multiple threads concurrently.
+  T TryPop() noexcept {
+    auto head = head_->load(std::memory_order_acquire);
+    while (true) {
+      const auto tail = tail_->load(std::memory_order_acquire);
+      if (head >= tail) return nullptr;
+
+      // If `head` is stale, the slot may have been overwritten by the producer,
+      // but then the CAS below fails and the value is dropped.
+      T item = Slot(head).load(std::memory_order_relaxed);
+      if (head_->compare_exchange_weak(head, head + 1,
+                                       std::memory_order_acq_rel,
+                                       std::memory_order_acquire)) {
+        return item;
+      }
+    }
+  }
+
+  // Can be called from any thread.
+  std::size_t GetSizeApproximate() const noexcept {
+    const auto head = head_->load(std::memory_order_relaxed);
+    const auto tail = tail_->load(std::memory_order_relaxed);
+    return tail > head ? tail - head : 0;
+  }
+
+ private:
+  std::atomic<T>& Slot(std::size_t index) noexcept {
+    return buffer_[index & (Capacity - 1)];
+  }
+
+  // Consumers contend on head_, the producer mostly works with tail_.
+  InterferenceShield<std::atomic<std::size_t>> head_{0};
+  InterferenceShield<std::atomic<std::size_t>> tail_{0};
+  std::array<std::atomic<T>, Capacity> buffer_{};
+};
+
+}  // namespace concurrent::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,94 @@
+#include <concurrent/impl/bounded_spmc_queue.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kCapacity = 8;
+
+using SpmcQueue = concurrent::impl::BoundedSpmcQueue<int*, kCapacity>;
+
+}  // namespace
+
+TEST(BoundedSpmcQueue, Empty) {
+  SpmcQueue queue;
+  EXPECT_EQ(queue.TryPop(), nullptr);
+  EXPECT_EQ(queue.TryPop(), nullptr);
+  EXPECT_EQ(queue.GetSizeApproximate(), 0);
+}
+
+TEST(BoundedSpmcQueue, Fifo) {
+  SpmcQueue queue;
+  int values[3]{};
+  for (auto& value : values) ASSERT_TRUE(queue.TryPush(&value));
+  EXPECT_EQ(queue.GetSizeApproximate(), 3);
+
+  EXPECT_EQ(queue.TryPop(), &values[0]);
+  EXPECT_EQ(queue.TryPop(), &values[1]);
+  EXPECT_EQ(queue.TryPop(), &values[2]);
+  EXPECT_EQ(queue.TryPop(), nullptr);
+}
+
+TEST(BoundedSpmcQueue, Overflow) {
+  SpmcQueue queue;
+  int values[kCapacity + 1]{};
+  for (std::size_t i = 0; i < kCapacity; ++i) {
+    ASSERT_TRUE(queue.TryPush(&values[i]));
+  }
+  EXPECT_FALSE(queue.TryPush(&values[kCapacity]));
+
+  EXPECT_EQ(queue.TryPop(), &values[0]);
+  EXPECT_TRUE(queue.TryPush(&values[kCapacity]));
+  EXPECT_EQ(queue.GetSizeApproximate(), kCapacity);
+
+  for (std::size_t i = 1; i <= kCapacity; ++i) {
+    EXPECT_EQ(queue.TryPop(), &values[i]);
+  }
+  EXPECT_EQ(queue.TryPop(), nullptr);
+}
+
+TEST(BoundedSpmcQueue, StressEveryItemIsTakenOnce) {
+  constexpr std::size_t kItems = 200'000;
+  constexpr std::size_t kConsumers = 3;
+
+  concurrent::impl::BoundedSpmcQueue<std::size_t*, 64> queue;
+  std::vector<std::size_t> items(kItems);
+  std::vector<std::atomic<int>> taken(kItems);
+  std::atomic<bool> producer_done{false};
+
+  const auto take = [&](std::size_t* item) { taken[*item].fetch_add(1); };
+
+  std::vector<std::thread> consumers;
+  consumers.reserve(kConsumers);
+  for (std::size_t i = 0; i < kConsumers; ++i) {
+    consumers.emplace_back([&] {
+      while (!producer_done.load() || queue.GetSizeApproximate() != 0) {
+        if (auto* item = queue.TryPop()) take(item);
+      }
+    });
+  }
+
+  for (std::size_t i = 0; i < kItems; ++i) {
+    items[i] = i;
+    while (!queue.TryPush(&items[i])) {
+      if (auto* item = queue.TryPop()) take(item);
+    }
+  }
+  producer_done = true;
+
+  for (auto& consumer : consumers) consumer.join();
+  while (auto* item = queue.TryPop()) take(item);
+
+  for (const auto& counter : taken) {
+    ASSERT_EQ(counter.load(), 1);
+  }
+}
+
+USERVER_NAMESPACE_END
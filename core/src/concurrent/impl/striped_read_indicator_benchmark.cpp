@@ -3,12 +3,14 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 
 #include <benchmark/benchmark.h>
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/sleep.hpp>
+#include <userver/rcu/rcu.hpp>
 #include <userver/utils/fixed_array.hpp>
 #include <utils/impl/parallelize_benchmark.hpp>
 
@@ -42,6 +44,12 @@ class SimpleRefcount {
   std::atomic<std::size_t> counter_{0};
 };
 
+template <typename Policy>
+struct PolicyRcuTraits {
+  using MutexType = engine::Mutex;
+  using ReclamationPolicy = Policy;
+};
+
 }  // namespace
 
 template <typename ReadIndicator>
@@ -109,4 +117,54 @@ BENCHMARK_TEMPLATE(ReadIndicatorIsFree, concurrent::impl::StripedReadIndicator)
     ->RangeMultiplier(2)
     ->Range(1, 32);
 
+// Readers and a writer of rcu::Variable run concurrently, the throughput of
+// both is reported
+template <typename ReclamationPolicy>
+void RcuReadWriteThroughput(benchmark::State& state) {
+  engine::RunStandalone(state.range(0) + 1, [&] {
+    rcu::Variable<std::uint64_t, PolicyRcuTraits<ReclamationPolicy>> var{0};
+    std::atomic<bool> keep_running{true};
+    std::atomic<std::uint64_t> total_reads{0};
+    std::uint64_t total_writes = 0;
+
+    auto writer_task = engine::CriticalAsyncNoSpan([&] {
+      while (keep_running) {
+        var.Assign(total_writes);
+        ++total_writes;
+      }
+    });
+
+    RunParallelBenchmark(state, [&](auto& range) {
+      std::uint64_t reads = 0;
+      for ([[maybe_unused]] auto _ : range) {
+        const auto reader = var.Read();
+        benchmark::DoNotOptimize(*reader);
+        ++reads;
+      }
+      total_reads += reads;
+    });
+
+    keep_running = false;
+    writer_task.Get();
+
+    state.counters["reads"] =
+        benchmark::Counter(total_reads.load(), benchmark::Counter::kIsRate);
+    state.counters["writes"] =
+        benchmark::Counter(total_writes, benchmark::Counter::kIsRate);
+  });
+}
+
+BENCHMARK_TEMPLATE(RcuReadWriteThroughput, rcu::SnapshotReclamation<>)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+BENCHMARK_TEMPLATE(RcuReadWriteThroughput, rcu::SnapshotReclamation<16>)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+BENCHMARK_TEMPLATE(RcuReadWriteThroughput, rcu::EpochReclamation<1>)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+BENCHMARK_TEMPLATE(RcuReadWriteThroughput, rcu::EpochReclamation<>)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+
 USERVER_NAMESPACE_END
@@ -83,6 +83,35 @@ TYPED_TEST(NonCoroutineTest, PushPopNoblock) {
   EXPECT_EQ(value, 2);
 }
 
+TYPED_TEST(NonCoroutineTest, PushPopBatchNoblock) {
+  auto queue = TypeParam::Create(4);
+
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+
+  std::vector<std::size_t> batch{0, 1, 2};
+  EXPECT_TRUE(producer.PushBatchNoblock(std::move(batch)));
+  EXPECT_TRUE(batch.empty());
+
+  // The whole batch does not fit, nothing is pushed
+  batch = {3, 4};
+  EXPECT_FALSE(producer.PushBatchNoblock(std::move(batch)));
+  EXPECT_EQ(batch, (std::vector<std::size_t>{3, 4}));
+  EXPECT_EQ(queue->GetSizeApproximate(), 3);
+
+  std::vector<std::size_t> values{42};
+  EXPECT_EQ(consumer.PopBatchNoblock(values, 2), 2);
+  EXPECT_EQ(values, (std::vector<std::size_t>{42, 0, 1}));
+
+  EXPECT_TRUE(producer.PushBatchNoblock(std::move(batch)));
+
+  values.clear();
+  EXPECT_EQ(consumer.PopBatchNoblock(values, 10), 3);
+  EXPECT_EQ(values, (std::vector<std::size_t>{2, 3, 4}));
+  EXPECT_EQ(consumer.PopBatchNoblock(values, 10), 0);
+  EXPECT_EQ(queue->GetSizeApproximate(), 0);
+}
+
 UTEST(NonFifoMpmcQueue, ConsumerIsDead) {
   auto queue = concurrent::NonFifoMpmcQueue<int>::Create();
   auto producer = queue->GetProducer();
@@ -393,4 +422,116 @@ UTEST_MT(QueueFixture, MultiConsumerToken, kProducersCount + kConsumersCount) {
       << "Likely missing messages";
 }
 
+UTEST_MT(NonFifoMpmcQueue, MpmcBatch, kProducersCount + kConsumersCount) {
+  constexpr std::size_t kBatchSize = 16;
+  auto queue =
+      concurrent::NonFifoMpmcQueue<std::size_t>::Create(kBatchSize * 4);
+
+  std::vector<concurrent::NonFifoMpmcQueue<std::size_t>::Producer> producers;
+  producers.reserve(kProducersCount);
+  for (std::size_t i = 0; i < kProducersCount; ++i) {
+    producers.emplace_back(queue->GetProducer());
+  }
+
+  std::vector<engine::TaskWithResult<void>> producers_tasks;
+  producers_tasks.reserve(kProducersCount);
+  for (std::size_t i = 0; i < kProducersCount; ++i) {
+    producers_tasks.push_back(
+        utils::Async("producer", [&producer = producers[i], i] {
+          std::vector<std::size_t> batch;
+          for (std::size_t message = i * kMessageCount;
+               message < (i + 1) * kMessageCount; ++message) {
+            batch.push_back(message);
+            if (batch.size() == kBatchSize) {
+              ASSERT_TRUE(producer.PushBatch(std::move(batch)));
+            }
+          }
+          ASSERT_TRUE(producer.PushBatch(std::move(batch)));
+        }));
+  }
+
+  std::vector<int> consumed_messages(kMessageCount * kProducersCount, 0);
+  engine::Mutex mutex;
+
+  std::vector<engine::TaskWithResult<void>> consumers_tasks;
+  consumers_tasks.reserve(kConsumersCount);
+  for (std::size_t i = 0; i < kConsumersCount; ++i) {
+    consumers_tasks.push_back(utils::Async(
+        "consumer",
+        [consumer = queue->GetConsumer(), &consumed_messages, &mutex] {
+          std::vector<std::size_t> values;
+          while (consumer.PopBatch(values, kBatchSize)) {
+            const std::lock_guard lock(mutex);
+            for (const auto value : values) ++consumed_messages[value];
+            values.clear();
+          }
+        }));
+  }
+
+  for (auto& task : producers_tasks) {
+    task.Get();
+  }
+  producers.clear();
+
+  for (auto& task : consumers_tasks) {
+    task.Get();
+  }
+
+  ASSERT_TRUE(std::all_of(consumed_messages.begin(), consumed_messages.end(),
+                          [](int item) { return item == 1; }));
+  EXPECT_EQ(queue->GetSizeApproximate(), 0);
+}
+
+UTEST(NonFifoMpmcQueue, PushBatchWaitsForCapacity) {
+  auto queue = concurrent::NonFifoMpmcQueue<int>::Create(3);
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+
+  ASSERT_TRUE(producer.Push(0));
+  std::vector<int> batch{1, 2, 3};
+  EXPECT_FALSE(producer.PushBatch(
+      std::move(batch), engine::Deadline::FromDuration(
+                            std::chrono::milliseconds{10})));
+  EXPECT_EQ(batch.size(), 3);
+
+  auto task = utils::Async("producer", [&producer, &batch] {
+    return producer.PushBatch(std::move(batch));
+  });
+  int value{};
+  ASSERT_TRUE(consumer.Pop(value));
+  EXPECT_TRUE(task.Get());
+
+  std::vector<int> values;
+  EXPECT_EQ(consumer.PopBatch(values, 10), 3);
+  EXPECT_EQ(values, (std::vector<int>{1, 2, 3}));
+}
+
+UTEST(SpscQueue, PopBatchProducerIsDead) {
+  auto queue = concurrent::SpscQueue<int>::Create();
+  auto consumer = queue->GetConsumer();
+  {
+    auto producer = queue->GetProducer();
+    ASSERT_TRUE(producer.PushBatch({1, 2}));
+  }
+
+  std::vector<int> values;
+  EXPECT_EQ(consumer.PopBatch(values, 10), 2);
+  EXPECT_EQ(consumer.PopBatch(values, 10), 0);
+  EXPECT_EQ(values, (std::vector<int>{1, 2}));
+}
+
+UTEST(NonFifoMpmcQueue, PopBatchProducerIsDead) {
+  auto queue = concurrent::NonFifoMpmcQueue<int>::Create();
+  auto consumer = queue->GetConsumer();
+  {
+    auto producer = queue->GetProducer();
+    ASSERT_TRUE(producer.PushBatch({1, 2}));
+  }
+
+  std::vector<int> values;
+  EXPECT_EQ(consumer.PopBatch(values, 10), 2);
+  EXPECT_EQ(consumer.PopBatch(values, 10), 0);
+  EXPECT_EQ(values, (std::vector<int>{1, 2}));
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,160 @@
+#include <congestion_control/adaptive_concurrency_limiter.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control {
+
+namespace {
+
+// The limit shrinks at most twice at a single update
+constexpr double kMinGradient = 0.5;
+
+// Long-term latency that is that many times greater than the short-term one
+// is decayed faster, so that the limit recovers after a latency spike
+constexpr double kLongLatencyDecayThreshold = 2.0;
+constexpr double kLongLatencyDecay = 0.95;
+
+std::chrono::steady_clock::rep ToRep(
+    std::chrono::steady_clock::time_point tp) noexcept {
+  return tp.time_since_epoch().count();
+}
+
+}  // namespace
+
+AdaptiveConcurrencyLimiter::Token::Token(AdaptiveConcurrencyLimiter& limiter)
+    : limiter_(&limiter), start_(utils::datetime::SteadyNow()) {}
+
+AdaptiveConcurrencyLimiter::Token::Token(Token&& other) noexcept
+    : limiter_(std::exchange(other.limiter_, nullptr)), start_(other.start_) {}
+
+AdaptiveConcurrencyLimiter::Token&
+AdaptiveConcurrencyLimiter::Token::operator=(Token&& other) noexcept {
+  if (this == &other) return *this;
+  if (limiter_) limiter_->Release();
+  limiter_ = std::exchange(other.limiter_, nullptr);
+  start_ = other.start_;
+  return *this;
+}
+
+AdaptiveConcurrencyLimiter::Token::~Token() {
+  if (limiter_) limiter_->Release();
+}
+
+void AdaptiveConcurrencyLimiter::Token::Finish() {
+  if (!limiter_) return;
+  auto* limiter = std::exchange(limiter_, nullptr);
+  limiter->Release();
+  limiter->Account(utils::datetime::SteadyNow() - start_);
+}
+
+AdaptiveConcurrencyLimiter::AdaptiveConcurrencyLimiter(
+    const AdaptiveConcurrencyLimiterConfig& config)
+    : config_(config),
+      limit_(config.initial_limit),
+      window_start_(ToRep(utils::datetime::SteadyNow())),
+      precise_limit_(config.initial_limit) {}
+
+std::optional<AdaptiveConcurrencyLimiter::Token>
+AdaptiveConcurrencyLimiter::TryAcquire() {
+  const auto in_flight = in_flight_.fetch_add(1) + 1;
+  if (in_flight > limit_.load()) {
+    in_flight_.fetch_sub(1);
+    ++rejected_;
+    return std::nullopt;
+  }
+
+  auto max_in_flight = window_max_in_flight_.load();
+  while (max_in_flight < in_flight &&
+         !window_max_in_flight_.compare_exchange_weak(max_in_flight,
+                                                      in_flight)) {
+  }
+  return Token{*this};
+}
+
+std::size_t AdaptiveConcurrencyLimiter::GetLimit() const noexcept {
+  return limit_.load();
+}
+
+std::size_t AdaptiveConcurrencyLimiter::GetInFlight() const noexcept {
+  return in_flight_.load();
+}
+
+void AdaptiveConcurrencyLimiter::Release() noexcept { in_flight_.fetch_sub(1); }
+
+void AdaptiveConcurrencyLimiter::Account(
+    std::chrono::steady_clock::duration latency) noexcept {
+  const auto latency_us =
+      std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+  window_latency_sum_us_ += std::max<std::int64_t>(latency_us, 1);
+  ++window_samples_;
+
+  const auto now = utils::datetime::SteadyNow();
+  const auto window_start = std::chrono::steady_clock::time_point{
+      std::chrono::steady_clock::duration{window_start_.load()}};
+  if (now - window_start < config_.window) return;
+
+  std::unique_lock lock{update_mutex_, std::try_to_lock};
+  if (lock.owns_lock()) Update(now);
+}
+
+void AdaptiveConcurrencyLimiter::Update(
+    std::chrono::steady_clock::time_point now) noexcept {
+  const auto window = now - std::chrono::steady_clock::time_point{
+                                std::chrono::steady_clock::duration{
+                                    window_start_.load()}};
+  if (window < config_.window) return;  // updated concurrently
+
+  window_start_ = ToRep(now);
+  const auto samples = window_samples_.exchange(0);
+  const auto latency_sum_us = window_latency_sum_us_.exchange(0);
+  const auto max_in_flight = window_max_in_flight_.exchange(in_flight_.load());
+  if (!samples) return;
+
+  const auto short_latency_us =
+      static_cast<double>(latency_sum_us) / static_cast<double>(samples);
+  if (long_latency_us_ <= 0) {
+    long_latency_us_ = short_latency_us;
+  } else {
+    const auto factor =
+        std::min(1.0, std::chrono::duration<double>(window).count() /
+                          std::chrono::duration<double>(config_.long_window)
+                              .count());
+    long_latency_us_ += (short_latency_us - long_latency_us_) * factor;
+    if (long_latency_us_ / short_latency_us > kLongLatencyDecayThreshold) {
+      long_latency_us_ *= kLongLatencyDecay;
+    }
+  }
+
+  const auto gradient = std::clamp(
+      config_.tolerance * long_latency_us_ / short_latency_us, kMinGradient,
+      1.0);
+  auto new_limit = precise_limit_ * gradient + std::sqrt(precise_limit_);
+  // Do not grow the limit that is not reached by the load
+  if (static_cast<double>(max_in_flight) < precise_limit_ / 2) {
+    new_limit = std::min(new_limit, precise_limit_);
+  }
+
+  precise_limit_ = std::clamp(
+      precise_limit_ * (1 - config_.smoothing) + new_limit * config_.smoothing,
+      static_cast<double>(config_.min_limit),
+      static_cast<double>(config_.max_limit));
+  limit_ = static_cast<std::size_t>(precise_limit_);
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const AdaptiveConcurrencyLimiter& limiter) {
+  writer["limit"] = limiter.GetLimit();
+  writer["in-flight"] = limiter.GetInFlight();
+  writer["rejected"] = limiter.rejected_;
+}
+
+}  // namespace congestion_control
+
+USERVER_NAMESPACE_END
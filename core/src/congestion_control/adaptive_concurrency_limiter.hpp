@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+
+#include <userver/congestion_control/adaptive_concurrency_limiter_config.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control {
+
+/// Limits the requests processed concurrently, the limit follows the latency
+/// of the requests (Gradient2 algorithm).
+class AdaptiveConcurrencyLimiter final {
+ public:
+  /// Holds a place among the requests in flight
+  class Token final {
+   public:
+    Token(Token&& other) noexcept;
+    Token& operator=(Token&& other) noexcept;
+    ~Token();
+
+    /// Accounts the latency of the request, a token that is destroyed without
+    /// that only frees the place
+    void Finish();
+
+   private:
+    friend class AdaptiveConcurrencyLimiter;
+
+    explicit Token(AdaptiveConcurrencyLimiter& limiter);
+
+    AdaptiveConcurrencyLimiter* limiter_;
+    std::chrono::steady_clock::time_point start_;
+  };
+
+  explicit AdaptiveConcurrencyLimiter(
+      const AdaptiveConcurrencyLimiterConfig& config);
+
+  /// Returns a token if the limit is not reached
+  std::optional<Token> TryAcquire();
+
+  std::size_t GetLimit() const noexcept;
+
+  std::size_t GetInFlight() const noexcept;
+
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const AdaptiveConcurrencyLimiter& limiter);
+
+ private:
+  void Release() noexcept;
+  void Account(std::chrono::steady_clock::duration latency) noexcept;
+  void Update(std::chrono::steady_clock::time_point now) noexcept;
+
+  const AdaptiveConcurrencyLimiterConfig config_;
+
+  std::atomic<std::size_t> limit_;
+  std::atomic<std::size_t> in_flight_{0};
+  std::atomic<std::size_t> window_max_in_flight_{0};
+  std::atomic<std::uint64_t> window_latency_sum_us_{0};
+  std::atomic<std::uint64_t> window_samples_{0};
+  std::atomic<std::chrono::steady_clock::rep> window_start_;
+  utils::statistics::RateCounter rejected_;
+
+  // Update is skipped by the concurrent samples while the lock is held
+  std::mutex update_mutex_;
+  double precise_limit_;
+  double long_latency_us_{0};
+};
+
+}  // namespace congestion_control
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,45 @@
+#include <userver/congestion_control/adaptive_concurrency_limiter_config.hpp>
+
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control {
+
+AdaptiveConcurrencyLimiterConfig Parse(
+    const yaml_config::YamlConfig& value,
+    formats::parse::To<AdaptiveConcurrencyLimiterConfig>) {
+  AdaptiveConcurrencyLimiterConfig config;
+  config.initial_limit =
+      value["initial_limit"].As<std::size_t>(config.initial_limit);
+  config.min_limit = value["min_limit"].As<std::size_t>(config.min_limit);
+  config.max_limit = value["max_limit"].As<std::size_t>(config.max_limit);
+  config.tolerance = value["tolerance"].As<double>(config.tolerance);
+  config.smoothing = value["smoothing"].As<double>(config.smoothing);
+  config.window = value["window"].As<std::chrono::milliseconds>(config.window);
+  config.long_window =
+      value["long_window"].As<std::chrono::milliseconds>(config.long_window);
+
+  if (config.min_limit == 0 || config.min_limit > config.initial_limit ||
+      config.initial_limit > config.max_limit) {
+    throw std::runtime_error(fmt::format(
+        "Invalid adaptive concurrency limits at '{}', "
+        "0 < min_limit <= initial_limit <= max_limit is required",
+        value.GetPath()));
+  }
+  if (config.tolerance < 1 || config.smoothing <= 0 || config.smoothing > 1) {
+    throw std::runtime_error(fmt::format(
+        "Invalid adaptive concurrency limiter settings at '{}', "
+        "tolerance >= 1 and 0 < smoothing <= 1 are required",
+        value.GetPath()));
+  }
+  return config;
+}
+
+}  // namespace congestion_control
+
+USERVER_NAMESPACE_END
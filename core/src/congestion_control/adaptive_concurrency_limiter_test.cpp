@@ -0,0 +1,99 @@
+#include <congestion_control/adaptive_concurrency_limiter.hpp>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <userver/utils/mock_now.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using congestion_control::AdaptiveConcurrencyLimiter;
+
+// Processes `count` requests at once with the same latency
+void ProcessBatch(AdaptiveConcurrencyLimiter& limiter, std::size_t count,
+                  std::chrono::milliseconds latency) {
+  std::vector<AdaptiveConcurrencyLimiter::Token> tokens;
+  for (std::size_t i = 0; i < count; ++i) {
+    auto token = limiter.TryAcquire();
+    if (!token) break;
+    tokens.push_back(std::move(*token));
+  }
+  utils::datetime::MockSleep(latency);
+  for (auto& token : tokens) token.Finish();
+}
+
+// Keeps the limiter fully loaded for the duration
+void ProcessFullLoad(AdaptiveConcurrencyLimiter& limiter,
+                     std::chrono::milliseconds duration,
+                     std::chrono::milliseconds latency) {
+  for (auto passed = std::chrono::milliseconds{0}; passed < duration;
+       passed += latency) {
+    ProcessBatch(limiter, limiter.GetLimit(), latency);
+  }
+}
+
+}  // namespace
+
+TEST(AdaptiveConcurrencyLimiter, RejectsOverLimit) {
+  utils::datetime::MockNowSet(std::chrono::system_clock::now());
+  AdaptiveConcurrencyLimiter limiter{{}};
+  ASSERT_EQ(limiter.GetLimit(), 20);
+
+  std::vector<AdaptiveConcurrencyLimiter::Token> tokens;
+  for (std::size_t i = 0; i < limiter.GetLimit(); ++i) {
+    auto token = limiter.TryAcquire();
+    ASSERT_TRUE(token);
+    tokens.push_back(std::move(*token));
+  }
+  EXPECT_EQ(limiter.GetInFlight(), 20);
+  EXPECT_FALSE(limiter.TryAcquire());
+
+  tokens.pop_back();
+  EXPECT_EQ(limiter.GetInFlight(), 19);
+  EXPECT_TRUE(limiter.TryAcquire());
+  EXPECT_EQ(limiter.GetInFlight(), 19);
+}
+
+TEST(AdaptiveConcurrencyLimiter, GrowsUnderStableLatency) {
+  utils::datetime::MockNowSet(std::chrono::system_clock::now());
+  AdaptiveConcurrencyLimiter limiter{{}};
+
+  ProcessFullLoad(limiter, std::chrono::seconds{10},
+                  std::chrono::milliseconds{10});
+  EXPECT_GT(limiter.GetLimit(), 100);
+}
+
+TEST(AdaptiveConcurrencyLimiter, NoGrowthWithoutLoad) {
+  utils::datetime::MockNowSet(std::chrono::system_clock::now());
+  AdaptiveConcurrencyLimiter limiter{{}};
+
+  for (int i = 0; i < 500; ++i) {
+    ProcessBatch(limiter, 2, std::chrono::milliseconds{10});
+  }
+  EXPECT_EQ(limiter.GetLimit(), 20);
+}
+
+TEST(AdaptiveConcurrencyLimiter, ShrinksOnLatencyGrowth) {
+  utils::datetime::MockNowSet(std::chrono::system_clock::now());
+  congestion_control::AdaptiveConcurrencyLimiterConfig config;
+  config.max_limit = 100;
+  AdaptiveConcurrencyLimiter limiter{config};
+
+  ProcessFullLoad(limiter, std::chrono::seconds{10},
+                  std::chrono::milliseconds{10});
+  EXPECT_EQ(limiter.GetLimit(), 100);
+
+  ProcessFullLoad(limiter, std::chrono::seconds{5},
+                  std::chrono::milliseconds{100});
+  EXPECT_EQ(limiter.GetLimit(), config.min_limit);
+
+  // recovers once the latency is back to normal
+  ProcessFullLoad(limiter, std::chrono::seconds{30},
+                  std::chrono::milliseconds{10});
+  EXPECT_EQ(limiter.GetLimit(), 100);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,115 @@
+#include <userver/congestion_control/client_throttler.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/rand.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control {
+
+namespace {
+
+std::int64_t CurrentSecond() noexcept {
+  return std::chrono::duration_cast<std::chrono::seconds>(
+             utils::datetime::SteadyNow().time_since_epoch())
+      .count();
+}
+
+}  // namespace
+
+// Requests and accepts of a single second of the window
+struct ClientThrottler::Bucket final {
+  std::atomic<std::int64_t> second{-1};
+  std::atomic<std::uint64_t> requests{0};
+  std::atomic<std::uint64_t> accepts{0};
+};
+
+ClientThrottlerConfig Parse(const yaml_config::YamlConfig& value,
+                            formats::parse::To<ClientThrottlerConfig>) {
+  ClientThrottlerConfig config;
+  config.accepts_multiplier =
+      value["accepts-multiplier"].As<double>(config.accepts_multiplier);
+  config.window = value["window"].As<std::chrono::seconds>(config.window);
+
+  if (config.accepts_multiplier < 1 ||
+      config.window < std::chrono::seconds{1}) {
+    throw std::runtime_error(fmt::format(
+        "Invalid client throttling settings at '{}', accepts-multiplier >= 1 "
+        "and window >= 1s are required",
+        value.GetPath()));
+  }
+  return config;
+}
+
+ClientThrottler::ClientThrottler(const ClientThrottlerConfig& config)
+    : config_(config),
+      buckets_count_(std::max<std::size_t>(config.window.count(), 1)),
+      buckets_(std::make_unique<Bucket[]>(buckets_count_)) {}
+
+ClientThrottler::~ClientThrottler() = default;
+
+bool ClientThrottler::TryStart() {
+  const auto reject_probability = GetRejectProbability();
+  GetCurrentBucket().requests.fetch_add(1, std::memory_order_relaxed);
+
+  if (reject_probability > 0 && utils::RandRange(1.0) < reject_probability) {
+    ++rejected_;
+    return false;
+  }
+  return true;
+}
+
+void ClientThrottler::AccountAccepted() noexcept {
+  GetCurrentBucket().accepts.fetch_add(1, std::memory_order_relaxed);
+}
+
+double ClientThrottler::GetRejectProbability() const noexcept {
+  const auto now = CurrentSecond();
+  const auto window = static_cast<std::int64_t>(buckets_count_);
+  std::uint64_t requests = 0;
+  std::uint64_t accepts = 0;
+  for (std::size_t i = 0; i < buckets_count_; ++i) {
+    const auto& bucket = buckets_[i];
+    const auto second = bucket.second.load();
+    if (second < 0 || now - second >= window) continue;
+    requests += bucket.requests.load(std::memory_order_relaxed);
+    accepts += bucket.accepts.load(std::memory_order_relaxed);
+  }
+
+  const auto excess = static_cast<double>(requests) -
+                      config_.accepts_multiplier * static_cast<double>(accepts);
+  return std::max(0.0, excess / static_cast<double>(requests + 1));
+}
+
+ClientThrottler::Bucket& ClientThrottler::GetCurrentBucket() noexcept {
+  const auto now = CurrentSecond();
+  auto& bucket = buckets_[now % buckets_count_];
+
+  auto second = bucket.second.load();
+  while (second < now) {
+    if (bucket.second.compare_exchange_weak(second, now)) {
+      // A few concurrent increments of the new second may be lost
+      bucket.requests.store(0, std::memory_order_relaxed);
+      bucket.accepts.store(0, std::memory_order_relaxed);
+      break;
+    }
+  }
+  return bucket;
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ClientThrottler& throttler) {
+  writer["rejected"] = throttler.rejected_;
+  writer["reject-probability"] = throttler.GetRejectProbability();
+}
+
+}  // namespace congestion_control
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,66 @@
+#include <userver/congestion_control/client_throttler.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/utils/mock_now.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Returns the number of the requests rejected locally
+std::size_t StartRequests(congestion_control::ClientThrottler& throttler,
+                          std::size_t count, bool accepted) {
+  std::size_t rejected = 0;
+  for (std::size_t i = 0; i < count; ++i) {
+    if (!throttler.TryStart()) {
+      ++rejected;
+    } else if (accepted) {
+      throttler.AccountAccepted();
+    }
+  }
+  return rejected;
+}
+
+}  // namespace
+
+TEST(ClientThrottler, HealthyDestination) {
+  utils::datetime::MockNowSet(std::chrono::system_clock::now());
+  congestion_control::ClientThrottler throttler{{}};
+
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(StartRequests(throttler, 100, true), 0);
+    utils::datetime::MockSleep(std::chrono::seconds{1});
+  }
+  EXPECT_EQ(throttler.GetRejectProbability(), 0);
+}
+
+TEST(ClientThrottler, OverloadedDestination) {
+  utils::datetime::MockNowSet(std::chrono::system_clock::now());
+  congestion_control::ClientThrottler throttler{{}};
+
+  EXPECT_EQ(StartRequests(throttler, 1000, true), 0);
+  utils::datetime::MockSleep(std::chrono::seconds{1});
+
+  // up to `accepts_multiplier * accepts` requests pass without rejections
+  EXPECT_EQ(StartRequests(throttler, 1000, false), 0);
+  const auto rejected = StartRequests(throttler, 10000, false);
+  EXPECT_GT(rejected, 5000);
+  EXPECT_GT(throttler.GetRejectProbability(), 0.7);
+  EXPECT_LT(throttler.GetRejectProbability(), 1);
+}
+
+TEST(ClientThrottler, Recovery) {
+  utils::datetime::MockNowSet(std::chrono::system_clock::now());
+  congestion_control::ClientThrottler throttler{{}};
+
+  StartRequests(throttler, 1000, false);
+  EXPECT_GT(throttler.GetRejectProbability(), 0.99);
+
+  // the failures leave the window
+  utils::datetime::MockSleep(std::chrono::seconds{60});
+  EXPECT_EQ(throttler.GetRejectProbability(), 0);
+  EXPECT_EQ(StartRequests(throttler, 100, true), 0);
+}
+
+USERVER_NAMESPACE_END
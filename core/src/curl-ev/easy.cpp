@@ -9,6 +9,7 @@
 #include <sys/socket.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <istream>
 #include <utility>
 
@@ -36,6 +37,9 @@ USERVER_NAMESPACE_BEGIN
 namespace curl {
 namespace {
 
+// Limits the memory reserved for a body by a malicious Content-Length
+constexpr std::size_t kMaxBodyReserve = 64 * 1024 * 1024;
+
 bool IsHeaderMatchingName(std::string_view header, std::string_view name) {
   return header.size() > name.size() &&
          utils::StrIcaseEqual()(header.substr(0, name.size()), name) &&
@@ -140,6 +144,11 @@ std::shared_ptr<easy> easy::GetBoundBlocking(multi& multi_handle) const {
   return std::make_shared<easy>(cloned, &multi_handle);
 }
 
+void easy::Rebind(multi& multi_handle) noexcept {
+  UASSERT_MSG(!multi_registered_, "Rebinding an easy that is being performed");
+  multi_ = &multi_handle;
+}
+
 easy* easy::from_native(native::CURL* native_easy) {
   easy* easy_handle = nullptr;
   native::curl_easy_getinfo(native_easy, native::CURLINFO_PRIVATE,
@@ -235,12 +244,14 @@ void easy::reset() {
 
   orig_url_str_.clear();
   std::string{}.swap(post_fields_);  // forced memory freeing
+  shared_post_fields_.reset();
   form_.reset();
   if (headers_) headers_->clear();
   if (proxy_headers_) proxy_headers_->clear();
   if (http200_aliases_) http200_aliases_->clear();
   if (resolved_hosts_) resolved_hosts_->clear();
-  share_.reset();
+  // curl_easy_reset() keeps the share, detach before releasing it
+  if (share_) set_share(nullptr);
   retries_count_ = 0;
   sockets_opened_ = 0;
   rate_limit_error_.clear();
@@ -348,6 +359,7 @@ void easy::set_post_fields(std::string&& post_fields) {
 
 void easy::set_post_fields(std::string&& post_fields, std::error_code& ec) {
   post_fields_ = std::move(post_fields);
+  shared_post_fields_.reset();
   ec =
       std::error_code{static_cast<errc::EasyErrorCode>(native::curl_easy_setopt(
           handle_, native::CURLOPT_POSTFIELDS, post_fields_.c_str()))};
@@ -357,6 +369,27 @@ void easy::set_post_fields(std::string&& post_fields, std::error_code& ec) {
         static_cast<native::curl_off_t>(post_fields_.length()), ec);
 }
 
+void easy::set_shared_post_fields(
+    std::shared_ptr<const std::string> post_fields) {
+  std::error_code ec;
+  set_shared_post_fields(std::move(post_fields), ec);
+  throw_error(ec, "set_shared_post_fields");
+}
+
+void easy::set_shared_post_fields(
+    std::shared_ptr<const std::string> post_fields, std::error_code& ec) {
+  UASSERT(post_fields);
+  std::string{}.swap(post_fields_);
+  shared_post_fields_ = std::move(post_fields);
+  ec =
+      std::error_code{static_cast<errc::EasyErrorCode>(native::curl_easy_setopt(
+          handle_, native::CURLOPT_POSTFIELDS, shared_post_fields_->c_str()))};
+
+  if (!ec)
+    set_post_field_size_large(
+        static_cast<native::curl_off_t>(shared_post_fields_->length()), ec);
+}
+
 void easy::set_http_post(std::unique_ptr<form> form) {
   std::error_code ec;
   set_http_post(std::move(form), ec);
@@ -567,7 +600,7 @@ void easy::add_resolve(const std::string& host, const std::string& port,
     UASSERT_MSG(
         !host_port_addr.empty(),
         "ReplaceFirstIf moved the string out, when it shouldn't have done so.");
-    resolved_hosts_->add(std::move(host_port_addr));
+    resolved_hosts_->add(host_port_addr);
   }
 
   ec =
@@ -604,7 +637,7 @@ void easy::set_share(std::shared_ptr<share> share) {
 void easy::set_share(std::shared_ptr<share> share, std::error_code& ec) {
   share_ = std::move(share);
 
-  if (share) {
+  if (share_) {
     ec = std::error_code{
         static_cast<errc::EasyErrorCode>(native::curl_easy_setopt(
             handle_, native::CURLOPT_SHARE, share_->native_handle()))};
@@ -614,12 +647,16 @@ void easy::set_share(std::shared_ptr<share> share, std::error_code& ec) {
   }
 }
 
-bool easy::has_post_data() const { return !post_fields_.empty() || form_; }
+bool easy::has_post_data() const { return !get_post_data().empty() || form_; }
 
-const std::string& easy::get_post_data() const { return post_fields_; }
+const std::string& easy::get_post_data() const {
+  return shared_post_fields_ ? *shared_post_fields_ : post_fields_;
+}
 
 std::string easy::extract_post_data() {
-  auto data = std::move(post_fields_);
+  auto data = shared_post_fields_ ? std::string{*shared_post_fields_}
+                                  : std::move(post_fields_);
+  shared_post_fields_.reset();
   set_post_fields({});
   return data;
 }
@@ -687,6 +724,18 @@ size_t easy::write_function(char* ptr, size_t size, size_t nmemb,
   }
 
   try {
+    if (self->sink_->empty()) {
+      // Avoid reallocations of big bodies. The Content-Length of a compressed
+      // body is less than its decoded size, but still a good lower bound.
+      native::curl_off_t content_length = -1;
+      if (native::curl_easy_getinfo(self->handle_,
+                                    native::CURLINFO_CONTENT_LENGTH_DOWNLOAD_T,
+                                    &content_length) == native::CURLE_OK &&
+          content_length > 0) {
+        self->sink_->reserve(std::min(static_cast<std::size_t>(content_length),
+                                      kMaxBodyReserve));
+      }
+    }
     self->sink_->append(ptr, actual_size);
   } catch (const std::exception&) {
     // out of memory
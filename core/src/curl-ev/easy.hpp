@@ -222,6 +222,10 @@ class easy final : public std::enable_shared_from_this<easy> {
 
   const multi* GetMulti() const { return multi_; }
 
+  // Moves an easy that is not being performed to another multi, e.g. to
+  // share the connections of the other multi.
+  void Rebind(multi&) noexcept;
+
   inline native::CURL* native_handle() { return handle_; }
   engine::ev::ThreadControl& GetThreadControl();
 
@@ -444,6 +448,10 @@ class easy final : public std::enable_shared_from_this<easy> {
   IMPLEMENT_CURL_OPTION_BOOLEAN(set_put, native::CURLOPT_PUT);
   void set_post_fields(std::string&& post_fields);
   void set_post_fields(std::string&& post_fields, std::error_code& ec);
+  // Sends the buffer without copying it, it is held until reset()
+  void set_shared_post_fields(std::shared_ptr<const std::string> post_fields);
+  void set_shared_post_fields(std::shared_ptr<const std::string> post_fields,
+                              std::error_code& ec);
   IMPLEMENT_CURL_OPTION(set_post_fields, native::CURLOPT_POSTFIELDS, void*);
   IMPLEMENT_CURL_OPTION(set_post_field_size, native::CURLOPT_POSTFIELDSIZE,
                         long);
@@ -846,6 +854,7 @@ class easy final : public std::enable_shared_from_this<easy> {
   std::shared_ptr<std::istream> source_;
   std::string* sink_{nullptr};
   std::string post_fields_;
+  std::shared_ptr<const std::string> shared_post_fields_;
   std::shared_ptr<form> form_;
   std::shared_ptr<string_list> headers_;
   std::shared_ptr<string_list> proxy_headers_;
@@ -10,6 +10,8 @@
 #include <curl-ev/share.hpp>
 #include <curl-ev/wrappers.hpp>
 
+#include <userver/utils/assert.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace curl {
@@ -62,6 +64,15 @@ void share::set_share_ssl_session(bool enabled) {
   throw_error(ec, __func__);
 }
 
+void share::set_share_connect(bool enabled) {
+  std::error_code ec{
+      static_cast<errc::ShareErrorCode>(native::curl_share_setopt(
+          handle_,
+          enabled ? native::CURLSHOPT_SHARE : native::CURLSHOPT_UNSHARE,
+          native::CURL_LOCK_DATA_CONNECT))};
+  throw_error(ec, __func__);
+}
+
 void share::set_lock_function(lock_function_t lock_function) {
   std::error_code ec{
       static_cast<errc::ShareErrorCode>(native::curl_share_setopt(
@@ -83,15 +94,18 @@ void share::set_user_data(void* user_data) {
   throw_error(ec, __func__);
 }
 
-void share::lock(native::CURL*, native::curl_lock_data,
+void share::lock(native::CURL*, native::curl_lock_data data,
                  native::curl_lock_access, void* userptr) {
   auto* self = static_cast<share*>(userptr);
-  self->mutex_.lock();
+  UASSERT(data < native::CURL_LOCK_DATA_LAST);
+  self->mutexes_[data].lock();
 }
 
-void share::unlock(native::CURL*, native::curl_lock_data, void* userptr) {
+void share::unlock(native::CURL*, native::curl_lock_data data,
+                   void* userptr) {
   auto* self = static_cast<share*>(userptr);
-  self->mutex_.unlock();
+  UASSERT(data < native::CURL_LOCK_DATA_LAST);
+  self->mutexes_[data].unlock();
 }
 
 }  // namespace curl
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <mutex>
 
@@ -26,6 +27,8 @@ class share final : public std::enable_shared_from_this<share> {
   void set_share_cookies(bool enabled);
   void set_share_dns(bool enabled);
   void set_share_ssl_session(bool enabled);
+  // The connections are taken by the easy handles of any multi
+  void set_share_connect(bool enabled);
 
   using lock_function_t = void (*)(native::CURL* handle,
                                    native::curl_lock_data data,
@@ -47,7 +50,9 @@ class share final : public std::enable_shared_from_this<share> {
                      void* userptr);
 
   native::CURLSH* handle_;
-  std::mutex mutex_;
+  // A mutex per the kind of the shared data, so that e.g. DNS lookups do not
+  // wait for the TLS session cache
+  std::array<std::mutex, native::CURL_LOCK_DATA_LAST> mutexes_;
 };
 }  // namespace curl
 
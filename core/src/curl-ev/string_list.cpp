@@ -12,25 +12,54 @@ USERVER_NAMESPACE_BEGIN
 
 namespace curl {
 
-string_list::Elem::Elem(std::string new_value) : value(std::move(new_value)) {
+namespace {
+
+// Larger values are not kept on clear(), a single huge header should not pin
+// the memory of an idle handle
+constexpr std::size_t kMaxRetainedCapacity = 1024;
+
+}  // namespace
+
+string_list::Elem::Elem(std::string_view new_value) : value(new_value) {
   list_node.data = value.data();
   list_node.next = nullptr;
 }
 
-void string_list::add(std::string str) {
+void string_list::add(std::string_view str) {
   native::curl_slist* prev =
-      list_elements_.empty() ? nullptr : &list_elements_.back().list_node;
-  auto& last = list_elements_.emplace_back(std::move(str));
-  if (prev) prev->next = &last.list_node;
+      size_ == 0 ? nullptr : &list_elements_[size_ - 1].list_node;
+
+  Elem* last = nullptr;
+  if (size_ < list_elements_.size()) {
+    last = &list_elements_[size_];
+    ReplaceValue(*last, str);
+    last->list_node.next = nullptr;
+  } else {
+    last = &list_elements_.emplace_back(str);
+  }
+  ++size_;
+
+  if (prev) prev->next = &last->list_node;
 }
 
-void string_list::clear() noexcept { list_elements_.clear(); }
+void string_list::clear() noexcept {
+  for (std::size_t i = 0; i < size_; ++i) {
+    auto& value = list_elements_[i].value;
+    if (value.capacity() > kMaxRetainedCapacity) std::string{}.swap(value);
+  }
+  size_ = 0;
+}
 
 void string_list::ReplaceValue(Elem& list_elem, std::string&& new_value) {
   list_elem.value = std::move(new_value);
   list_elem.list_node.data = list_elem.value.data();
 }
 
+void string_list::ReplaceValue(Elem& list_elem, std::string_view new_value) {
+  list_elem.value.assign(new_value);
+  list_elem.list_node.data = list_elem.value.data();
+}
+
 }  // namespace curl
 
 USERVER_NAMESPACE_END
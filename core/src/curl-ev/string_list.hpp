@@ -12,6 +12,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <utility>
 
 #include "native.hpp"
 
@@ -28,20 +29,23 @@ class string_list {
   string_list& operator=(string_list&&) = delete;
 
   inline native::curl_slist* native_handle() {
-    return list_elements_.empty() ? nullptr : &list_elements_.front().list_node;
+    return size_ == 0 ? nullptr : &list_elements_.front().list_node;
   }
 
   inline const native::curl_slist* native_handle() const {
-    return list_elements_.empty() ? nullptr : &list_elements_.front().list_node;
+    return size_ == 0 ? nullptr : &list_elements_.front().list_node;
   }
 
-  void add(std::string str);
+  void add(std::string_view str);
+
+  // Keeps the storage of the elements, so that a list of a reused handle is
+  // refilled without allocations
   void clear() noexcept;
 
   template <typename Pred>
   std::optional<std::string_view> FindIf(const Pred& pred) const {
-    for (const auto& list_elem : list_elements_) {
-      const auto& value = list_elem.value;
+    for (std::size_t i = 0; i < size_; ++i) {
+      const auto& value = list_elements_[i].value;
       if (pred(value)) return value;
     }
     return std::nullopt;
@@ -49,9 +53,9 @@ class string_list {
 
   template <typename Pred>
   bool ReplaceFirstIf(const Pred& pred, std::string&& new_value) {
-    for (auto& list_elem : list_elements_) {
-      const auto& value = list_elem.value;
-      if (pred(value)) {
+    for (std::size_t i = 0; i < size_; ++i) {
+      auto& list_elem = list_elements_[i];
+      if (pred(std::as_const(list_elem.value))) {
         ReplaceValue(list_elem, std::move(new_value));
         return true;
       }
@@ -61,10 +65,10 @@ class string_list {
 
   template <typename Pred>
   bool ReplaceFirstIf(const Pred& pred, const char* new_value) {
-    for (auto& list_elem : list_elements_) {
-      const auto& value = list_elem.value;
-      if (pred(value)) {
-        ReplaceValue(list_elem, std::string{new_value});
+    for (std::size_t i = 0; i < size_; ++i) {
+      auto& list_elem = list_elements_[i];
+      if (pred(std::as_const(list_elem.value))) {
+        ReplaceValue(list_elem, std::string_view{new_value});
         return true;
       }
     }
@@ -73,15 +77,18 @@ class string_list {
 
  private:
   struct Elem {
-    explicit Elem(std::string new_value);
+    explicit Elem(std::string_view new_value);
 
     std::string value{};
     native::curl_slist list_node{};
   };
 
   static void ReplaceValue(Elem& list_elem, std::string&& new_value);
+  static void ReplaceValue(Elem& list_elem, std::string_view new_value);
 
   std::deque<Elem> list_elements_;
+  // Elements past the size are kept for reuse
+  std::size_t size_{0};
 };
 
 }  // namespace curl
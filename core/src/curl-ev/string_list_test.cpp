@@ -45,6 +45,38 @@ TEST(CurlStringList, Clear) {
   EXPECT_EQ(ToVector(list), expected);
 }
 
+TEST(CurlStringList, ClearKeepsStorage) {
+  curl::string_list list;
+
+  // 100 just to avoid SSO
+  list.add(std::string(100, 'a'));
+  list.add("bbb");
+  list.add("ccc");
+  const auto* first_data = list.native_handle()->data;
+
+  list.clear();
+  EXPECT_EQ(list.native_handle(), nullptr);
+  EXPECT_FALSE(
+      list.FindIf([](std::string_view value) { return value == "bbb"; }));
+
+  list.add(std::string(50, 'd'));
+  list.add("eee");
+  std::vector<std::string> expected{std::string(50, 'd'), "eee"};
+  EXPECT_EQ(ToVector(list), expected);
+  EXPECT_EQ(list.native_handle()->data, first_data);
+
+  EXPECT_FALSE(
+      list.FindIf([](std::string_view value) { return value == "ccc"; }));
+  EXPECT_FALSE(list.ReplaceFirstIf(
+      [](std::string_view value) { return value == "ccc"; }, "fff"));
+
+  list.add("ggg");
+  list.add("hhh");
+  std::vector<std::string> expected_grown{std::string(50, 'd'), "eee", "ggg",
+                                          "hhh"};
+  EXPECT_EQ(ToVector(list), expected_grown);
+}
+
 TEST(CurlStringList, FindIf) {
   curl::string_list list;
 
@@ -0,0 +1,116 @@
+#include <userver/dist_lock/acquire_batcher.hpp>
+
+#include <algorithm>
+#include <exception>
+
+#include <userver/dist_lock/dist_lock_strategy.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dist_lock {
+
+struct AcquireBatcher::Batch final {
+  bool Contains(const std::string& lock_name) const {
+    return std::any_of(requests.begin(), requests.end(),
+                       [&](const AcquireRequest& request) {
+                         return request.lock_name == lock_name;
+                       });
+  }
+
+  std::vector<AcquireRequest> requests;
+  bool is_done{false};
+  std::unordered_set<std::string> acquired;
+  std::exception_ptr error;
+};
+
+AcquireBatcher::AcquireBatcher(std::chrono::milliseconds window)
+    : window_(window) {}
+
+AcquireBatcher::~AcquireBatcher() { UASSERT(!current_batch_); }
+
+void AcquireBatcher::Acquire(AcquireRequest request, const BatchFunc& func) {
+  engine::TaskCancellationBlocker cancel_blocker;
+  const auto lock_name = request.lock_name;
+
+  std::unique_lock lock(mutex_);
+  if (current_batch_ && current_batch_->Contains(lock_name)) {
+    // The same lock twice in a request would conflict with itself
+    lock.unlock();
+    if (!func({std::move(request)}).count(lock_name)) {
+      throw LockIsAcquiredByAnotherHostException();
+    }
+    return;
+  }
+
+  if (current_batch_) {
+    auto batch = current_batch_;
+    batch->requests.push_back(std::move(request));
+    [[maybe_unused]] const bool is_done =
+        batch_done_cv_.Wait(lock, [&batch] { return batch->is_done; });
+    UASSERT(is_done);
+
+    if (batch->error) std::rethrow_exception(batch->error);
+    if (!batch->acquired.count(lock_name)) {
+      throw LockIsAcquiredByAnotherHostException();
+    }
+    return;
+  }
+
+  current_batch_ = std::make_shared<Batch>();
+  current_batch_->requests.push_back(std::move(request));
+  auto batch = current_batch_;
+  lock.unlock();
+
+  if (!ExecuteBatch(std::move(batch), func).count(lock_name)) {
+    throw LockIsAcquiredByAnotherHostException();
+  }
+}
+
+std::size_t AcquireBatcher::GetBatchesCount() const {
+  std::lock_guard lock(mutex_);
+  return batches_count_;
+}
+
+std::unordered_set<std::string> AcquireBatcher::ExecuteBatch(
+    std::shared_ptr<Batch> batch, const BatchFunc& func) {
+  const auto window_us = std::chrono::microseconds{window_}.count();
+  if (window_us > 0) {
+    engine::SleepFor(std::chrono::microseconds{
+        window_us / 2 + utils::RandRange(window_us)});
+  }
+
+  {
+    std::lock_guard lock(mutex_);
+    UASSERT(current_batch_ == batch);
+    // No more requests are appended to the batch from now on
+    current_batch_.reset();
+    ++batches_count_;
+  }
+
+  std::unordered_set<std::string> acquired;
+  std::exception_ptr error;
+  try {
+    acquired = func(batch->requests);
+  } catch (const std::exception&) {
+    error = std::current_exception();
+  }
+
+  {
+    std::lock_guard lock(mutex_);
+    batch->acquired = acquired;
+    batch->error = error;
+    batch->is_done = true;
+  }
+  batch_done_cv_.NotifyAll();
+
+  if (error) std::rethrow_exception(error);
+  return acquired;
+}
+
+}  // namespace dist_lock
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,120 @@
+#include <userver/dist_lock/acquire_batcher.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+
+#include <userver/dist_lock/dist_lock_strategy.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::chrono::milliseconds kWindow{50};
+constexpr std::chrono::milliseconds kLockTtl{100};
+constexpr std::size_t kLockers = 8;
+
+dist_lock::AcquireRequest MakeRequest(std::size_t i) {
+  return {"lock-" + std::to_string(i), "owner", kLockTtl};
+}
+
+}  // namespace
+
+UTEST_MT(AcquireBatcher, SingleBatch, 4) {
+  dist_lock::AcquireBatcher batcher{kWindow};
+  std::atomic<std::size_t> max_batch_size{0};
+  const dist_lock::AcquireBatcher::BatchFunc func =
+      [&](const std::vector<dist_lock::AcquireRequest>& batch) {
+        max_batch_size = std::max(max_batch_size.load(), batch.size());
+        std::unordered_set<std::string> acquired;
+        for (const auto& request : batch) acquired.insert(request.lock_name);
+        return acquired;
+      };
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (std::size_t i = 0; i < kLockers; ++i) {
+    tasks.push_back(utils::Async("locker", [&, i] {
+      batcher.Acquire(MakeRequest(i), func);
+    }));
+  }
+  UEXPECT_NO_THROW(engine::WaitAllChecked(tasks));
+
+  EXPECT_EQ(batcher.GetBatchesCount(), 1);
+  EXPECT_EQ(max_batch_size.load(), kLockers);
+}
+
+UTEST(AcquireBatcher, Busy) {
+  dist_lock::AcquireBatcher batcher{kWindow};
+  const dist_lock::AcquireBatcher::BatchFunc func =
+      [](const std::vector<dist_lock::AcquireRequest>& batch) {
+        std::unordered_set<std::string> acquired;
+        for (const auto& request : batch) {
+          if (request.lock_name != "lock-1") acquired.insert(request.lock_name);
+        }
+        return acquired;
+      };
+
+  auto busy = utils::Async("locker", [&] {
+    batcher.Acquire(MakeRequest(1), func);
+  });
+  UEXPECT_NO_THROW(batcher.Acquire(MakeRequest(0), func));
+  UEXPECT_THROW(busy.Get(), dist_lock::LockIsAcquiredByAnotherHostException);
+}
+
+UTEST(AcquireBatcher, Error) {
+  dist_lock::AcquireBatcher batcher{kWindow};
+  const dist_lock::AcquireBatcher::BatchFunc func =
+      [](const std::vector<dist_lock::AcquireRequest>&)
+      -> std::unordered_set<std::string> {
+    throw std::runtime_error("backend failure");
+  };
+
+  auto other = utils::Async("locker", [&] {
+    batcher.Acquire(MakeRequest(1), func);
+  });
+  UEXPECT_THROW(batcher.Acquire(MakeRequest(0), func), std::runtime_error);
+  UEXPECT_THROW(other.Get(), std::runtime_error);
+}
+
+UTEST(AcquireBatcher, SameLockIsNotBatched) {
+  dist_lock::AcquireBatcher batcher{kWindow};
+  std::atomic<std::size_t> calls{0};
+  const dist_lock::AcquireBatcher::BatchFunc func =
+      [&](const std::vector<dist_lock::AcquireRequest>& batch) {
+        ++calls;
+        EXPECT_EQ(batch.size(), 1);
+        return std::unordered_set<std::string>{batch.front().lock_name};
+      };
+
+  auto first = utils::Async("locker", [&] {
+    batcher.Acquire(MakeRequest(0), func);
+  });
+  engine::Yield();
+  UEXPECT_NO_THROW(batcher.Acquire(MakeRequest(0), func));
+  UEXPECT_NO_THROW(first.Get());
+  EXPECT_EQ(calls.load(), 2);
+  EXPECT_EQ(batcher.GetBatchesCount(), 1);
+}
+
+UTEST(AcquireBatcher, Cancelled) {
+  dist_lock::AcquireBatcher batcher{kWindow};
+  const dist_lock::AcquireBatcher::BatchFunc func =
+      [](const std::vector<dist_lock::AcquireRequest>& batch) {
+        return std::unordered_set<std::string>{batch.front().lock_name};
+      };
+
+  auto task = utils::Async("locker", [&] {
+    batcher.Acquire(MakeRequest(0), func);
+  });
+  engine::Yield();
+  task.RequestCancel();
+  // The batch is executed anyway, as it may acquire the lock
+  UEXPECT_NO_THROW(task.Get());
+  EXPECT_EQ(batcher.GetBatchesCount(), 1);
+}
+
+USERVER_NAMESPACE_END
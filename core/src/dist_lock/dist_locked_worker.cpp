@@ -108,6 +108,7 @@ void DumpMetric(utils::statistics::Writer& writer,
   writer["watchdog-triggers"] = stats.watchdog_triggers.Load();
   writer["brain-splits"] = stats.brain_splits.Load();
   writer["task-failures"] = stats.task_failures.Load();
+  writer["acquire-timings-ms"] = stats.acquire_timings_ms;
 }
 
 }  // namespace dist_lock
@@ -133,6 +133,10 @@ void Locker::Run(LockerMode mode, dist_lock::DistLockWaitingMode waiting_mode,
       stats_.lock_failures++;
       LOG_WARNING() << "Lock acquisition failed: " << ex;
     }
+    stats_.acquire_timings_ms.GetCurrentCounter().Account(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            utils::datetime::SteadyNow() - attempt_start)
+            .count());
 
     if (engine::current_task::ShouldCancel()) break;
 
@@ -18,9 +18,58 @@ constexpr std::string_view kDumpFormatVersion = "format-version";
 constexpr std::string_view kMaxDumpCount = "max-count";
 constexpr std::string_view kWorldReadable = "world-readable";
 constexpr std::string_view kEncrypted = "encrypted";
+constexpr std::string_view kMmap = "mmap";
+constexpr std::string_view kCompression = "compression";
+constexpr std::string_view kCompressionLevel = "level";
+constexpr std::string_view kChunkSize = "chunk-size";
+constexpr std::string_view kConcurrency = "concurrency";
+constexpr std::string_view kTaskProcessor = "task-processor";
+constexpr std::string_view kIncremental = "incremental";
+constexpr std::string_view kMaxDeltas = "max-deltas";
 
 constexpr auto kDefaultFsTaskProcessor = std::string_view{"fs-task-processor"};
 constexpr auto kDefaultMaxDumpCount = uint64_t{1};
+constexpr int kDefaultCompressionLevel = 3;
+constexpr uint64_t kDefaultChunkSize = 4 * 1024 * 1024;
+constexpr uint64_t kDefaultCompressionConcurrency = 4;
+constexpr auto kDefaultCompressionTaskProcessor =
+    std::string_view{"main-task-processor"};
+constexpr uint64_t kDefaultMaxDeltas = 16;
+
+std::optional<CompressionConfig> ParseCompression(
+    const std::string& name, const yaml_config::YamlConfig& config) {
+  if (config.IsMissing()) return std::nullopt;
+
+  CompressionConfig result{
+      config[kCompressionLevel].As<int>(kDefaultCompressionLevel),
+      config[kChunkSize].As<uint64_t>(kDefaultChunkSize),
+      config[kConcurrency].As<uint64_t>(kDefaultCompressionConcurrency),
+      config[kTaskProcessor].As<std::string>(kDefaultCompressionTaskProcessor),
+  };
+  if (result.chunk_size == 0 ||
+      result.chunk_size > CompressionConfig::kMaxChunkSize) {
+    throw std::logic_error(fmt::format("{}: {}.{} must be in [1, {}]", name,
+                                       kCompression, kChunkSize,
+                                       CompressionConfig::kMaxChunkSize));
+  }
+  if (result.concurrency == 0) {
+    throw std::logic_error(fmt::format("{}: {}.{} must not be 0", name,
+                                       kCompression, kConcurrency));
+  }
+  return result;
+}
+
+std::optional<IncrementalConfig> ParseIncremental(
+    const std::string& name, const yaml_config::YamlConfig& config) {
+  if (config.IsMissing()) return std::nullopt;
+
+  IncrementalConfig result{config[kMaxDeltas].As<uint64_t>(kDefaultMaxDeltas)};
+  if (result.max_deltas == 0) {
+    throw std::logic_error(fmt::format("{}: {}.{} must not be 0", name,
+                                       kIncremental, kMaxDeltas));
+  }
+  return result;
+}
 
 }  // namespace
 
@@ -67,6 +116,9 @@ Config::Config(std::string name, const yaml_config::YamlConfig& config,
           config[kMaxDumpAge].As<std::optional<std::chrono::milliseconds>>()),
       max_dump_age_set(config.HasMember(kMaxDumpAge)),
       dump_is_encrypted(config[kEncrypted].As<bool>(false)),
+      use_mmap(config[kMmap].As<bool>(false)),
+      compression(ParseCompression(this->name, config[kCompression])),
+      incremental(ParseIncremental(this->name, config[kIncremental])),
       static_dumps_enabled(config[kDumpsEnabled].As<bool>()),
       static_min_dump_interval(
           config[kMinDumpInterval].As<std::chrono::milliseconds>(0)) {
@@ -78,6 +130,15 @@ Config::Config(std::string name, const yaml_config::YamlConfig& config,
     throw std::logic_error(
         fmt::format("{}: {} must not be 0", this->name, kMaxDumpCount));
   }
+  if (use_mmap && dump_is_encrypted) {
+    throw std::logic_error(fmt::format("{}: {} is not supported for {} dumps",
+                                       this->name, kMmap, kEncrypted));
+  }
+  if (compression && (dump_is_encrypted || use_mmap)) {
+    throw std::logic_error(
+        fmt::format("{}: {} is not supported for {} or {} dumps", this->name,
+                    kCompression, kEncrypted, kMmap));
+  }
 }
 
 DynamicConfig::DynamicConfig(const Config& config, ConfigPatch&& patch)
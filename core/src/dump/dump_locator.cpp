@@ -12,6 +12,7 @@
 #include <userver/utils/assert.hpp>
 #include <userver/utils/datetime.hpp>
 #include <userver/utils/from_string.hpp>
+#include <userver/utils/text_light.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -21,6 +22,14 @@ namespace {
 
 const std::string kTimeZone = "UTC";
 
+// Deltas of an incremental dump are stored in "{dump}.deltas/" and are named
+// the same way as the dumps
+constexpr std::string_view kDeltasSuffix = ".deltas";
+
+std::string GetDeltasDirectory(const std::string& dump_path) {
+  return fmt::format(FMT_COMPILE("{}{}"), dump_path, kDeltasSuffix);
+}
+
 }  // namespace
 
 DumpLocator::DumpLocator(Config static_config)
@@ -48,6 +57,31 @@ DumpFileStats DumpLocator::RegisterNewDump(TimePoint update_time) {
   return {update_time, std::move(dump_path), config_.dump_format_version};
 }
 
+DumpFileStats DumpLocator::RegisterNewDelta(const DumpFileStats& dump,
+                                            TimePoint update_time) {
+  const auto deltas_directory = GetDeltasDirectory(dump.full_path);
+  std::string delta_path =
+      fmt::format(FMT_COMPILE("{}/{}"), deltas_directory,
+                  GenerateDumpFilename(update_time));
+
+  if (boost::filesystem::exists(delta_path)) {
+    throw std::runtime_error(fmt::format(
+        "{}: could not write a delta to \"{}\", because the file already "
+        "exists",
+        config_.name, delta_path));
+  }
+
+  try {
+    fs::blocking::CreateDirectories(deltas_directory);
+  } catch (const std::exception& ex) {
+    throw std::runtime_error(
+        fmt::format("{}: error while creating delta at \"{}\". Cause: {}",
+                    config_.name, delta_path, ex.what()));
+  }
+
+  return {update_time, std::move(delta_path), config_.dump_format_version};
+}
+
 std::optional<DumpFileStats> DumpLocator::GetLatestDump() const {
   try {
     std::optional<DumpFileStats> stats = GetLatestDumpImpl();
@@ -70,6 +104,14 @@ std::optional<DumpFileStats> DumpLocator::GetLatestDump() const {
 
 bool DumpLocator::BumpDumpTime(TimePoint old_update_time,
                                TimePoint new_update_time) {
+  DumpFileStats dump{old_update_time, GenerateDumpPath(old_update_time),
+                     config_.dump_format_version};
+  return BumpDumpTime(dump, new_update_time);
+}
+
+bool DumpLocator::BumpDumpTime(DumpFileStats& dump,
+                               TimePoint new_update_time) {
+  const auto old_update_time = dump.update_time;
   if (new_update_time < old_update_time) {
     LOG_WARNING() << config_.name << ": new_update_time < old_update_time, new="
                   << utils::datetime::Timestring(new_update_time, kTimeZone,
@@ -79,8 +121,14 @@ bool DumpLocator::BumpDumpTime(TimePoint old_update_time,
                                                  kFilenameDateFormat);
   }
 
-  const std::string old_name = GenerateDumpPath({old_update_time});
-  const std::string new_name = GenerateDumpPath({new_update_time});
+  // The update time of an incremental dump is the one of its last delta
+  const bool is_delta = !dump.delta_paths.empty();
+  std::string& old_name = is_delta ? dump.delta_paths.back() : dump.full_path;
+  std::string new_name =
+      is_delta ? fmt::format(FMT_COMPILE("{}/{}"),
+                             GetDeltasDirectory(dump.full_path),
+                             GenerateDumpFilename(new_update_time))
+               : GenerateDumpPath(new_update_time);
 
   try {
     if (!boost::filesystem::is_regular_file(old_name)) {
@@ -90,14 +138,21 @@ bool DumpLocator::BumpDumpTime(TimePoint old_update_time,
       return false;
     }
     boost::filesystem::rename(old_name, new_name);
+    if (!is_delta) {
+      // There are no deltas, but there may be leftover tmp files
+      boost::filesystem::remove_all(GetDeltasDirectory(old_name));
+    }
     LOG_INFO() << config_.name << ": renamed dump \"" << old_name << "\" to \""
                << new_name << "\"";
-    return true;
   } catch (const boost::filesystem::filesystem_error& ex) {
     LOG_ERROR() << config_.name << ": error while trying to rename dump \""
                 << old_name << " to \"" << new_name << "\". Reason: " << ex;
     return false;
   }
+
+  old_name = std::move(new_name);
+  dump.update_time = new_update_time;
+  return true;
 }
 
 void DumpLocator::Cleanup() {
@@ -133,6 +188,7 @@ void DumpLocator::Cleanup() {
                       << file.path().string() << "\"";
         continue;
       }
+      FindDeltas(*dump);
 
       if (dump->format_version < config_.dump_format_version ||
           dump->update_time < min_update_time) {
@@ -157,6 +213,33 @@ void DumpLocator::Cleanup() {
                   << dumps[i].full_path << "\"";
       boost::filesystem::remove(dumps[i].full_path);
     }
+
+    // Deltas of the removed dumps and leftover tmp files of the deltas
+    for (const auto& directory :
+         boost::filesystem::directory_iterator{config_.dump_directory}) {
+      const auto path = directory.path().string();
+      if (!boost::filesystem::is_directory(directory.status()) ||
+          !utils::text::EndsWith(path, kDeltasSuffix)) {
+        continue;
+      }
+
+      const auto dump_path = path.substr(0, path.size() - kDeltasSuffix.size());
+      if (!boost::filesystem::is_regular_file(dump_path)) {
+        LOG_DEBUG() << config_.name << ": removing the deltas of a removed "
+                    << "dump, path=\"" << path << "\"";
+        boost::filesystem::remove_all(directory);
+        continue;
+      }
+
+      for (const auto& file : boost::filesystem::directory_iterator{path}) {
+        if (utils::regex_match(file.path().filename().string(),
+                               tmp_filename_regex_)) {
+          LOG_DEBUG() << "Removing a leftover tmp file \""
+                      << file.path().string() << "\"";
+          boost::filesystem::remove(file);
+        }
+      }
+    }
   } catch (const std::exception& ex) {
     LOG_ERROR() << config_.name
                 << ": error while cleaning up old dumps. Cause: " << ex;
@@ -229,6 +312,8 @@ std::optional<DumpFileStats> DumpLocator::GetLatestDumpImpl() const {
         continue;
       }
 
+      FindDeltas(*curr_dump);
+
       if (curr_dump->update_time < min_update_time && config_.max_dump_age) {
         LOG_DEBUG() << "Ignoring dump \"" << curr_dump->full_path
                     << "\", because its age is greater than the maximum "
@@ -250,9 +335,50 @@ std::optional<DumpFileStats> DumpLocator::GetLatestDumpImpl() const {
   return best_dump ? std::optional{std::move(best_dump)} : std::nullopt;
 }
 
+void DumpLocator::FindDeltas(DumpFileStats& dump) const {
+  const auto deltas_directory = GetDeltasDirectory(dump.full_path);
+  if (!boost::filesystem::is_directory(deltas_directory)) return;
+
+  std::vector<DumpFileStats> deltas;
+  for (const auto& file :
+       boost::filesystem::directory_iterator{deltas_directory}) {
+    if (!boost::filesystem::is_regular_file(file.status())) continue;
+
+    // Leftover tmp files are removed on Cleanup
+    auto delta = ParseDumpName(file.path().string());
+    if (!delta) continue;
+
+    if (delta->format_version != dump.format_version ||
+        delta->update_time <= dump.update_time) {
+      LOG_WARNING() << config_.name << ": ignoring a mismatching delta \""
+                    << delta->full_path << "\"";
+      continue;
+    }
+    deltas.push_back(std::move(*delta));
+  }
+  if (deltas.empty()) return;
+
+  std::sort(deltas.begin(), deltas.end(),
+            [](const DumpFileStats& a, const DumpFileStats& b) {
+              return a.update_time < b.update_time;
+            });
+
+  dump.update_time = deltas.back().update_time;
+  dump.delta_paths.clear();
+  dump.delta_paths.reserve(deltas.size());
+  for (auto& delta : deltas) {
+    dump.delta_paths.push_back(std::move(delta.full_path));
+  }
+}
+
 std::string DumpLocator::GenerateDumpPath(TimePoint update_time) const {
+  return fmt::format(FMT_COMPILE("{}/{}"), config_.dump_directory,
+                     GenerateDumpFilename(update_time));
+}
+
+std::string DumpLocator::GenerateDumpFilename(TimePoint update_time) const {
   return fmt::format(
-      FMT_COMPILE("{}/{}-v{}"), config_.dump_directory,
+      FMT_COMPILE("{}-v{}"),
       utils::datetime::Timestring(update_time, kTimeZone, kFilenameDateFormat),
       config_.dump_format_version);
 }
@@ -4,6 +4,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include <userver/dump/config.hpp>
 #include <userver/dump/helpers.hpp>
@@ -20,6 +21,9 @@ struct DumpFileStats final {
   TimePoint update_time;
   std::string full_path;
   uint64_t format_version;
+  /// Deltas of an incremental dump in the write order. If there are any,
+  /// `update_time` is the update time of the last delta.
+  std::vector<std::string> delta_paths{};
 };
 
 /// @brief Manages dump files on disk. Encapsulates file paths and naming scheme
@@ -35,7 +39,14 @@ class DumpLocator final {
   /// @throws On a filesystem error
   DumpFileStats RegisterNewDump(TimePoint update_time);
 
-  /// @brief Finds the latest suitable dump
+  /// @brief Prepare the place for a new delta on top of `dump`
+  /// @note The operation is blocking, and should run in FS TaskProcessor
+  /// @note The actual creation of the file is a caller's responsibility
+  /// @throws On a filesystem error
+  DumpFileStats RegisterNewDelta(const DumpFileStats& dump,
+                                 TimePoint update_time);
+
+  /// @brief Finds the latest suitable dump together with its deltas
   /// @note The operation is blocking, and should run in FS TaskProcessor
   /// @returns The full path of the dump if available and fresh enough,
   /// or `nullopt` otherwise
@@ -46,7 +57,12 @@ class DumpLocator final {
   /// @return `true` on success, `false` if the dump is not available
   bool BumpDumpTime(TimePoint old_update_time, TimePoint new_update_time);
 
-  /// @brief Removes old dumps and tmp files
+  /// @brief Modifies the update time of `dump`, or of its last delta
+  /// @note The operation is blocking, and should run in FS TaskProcessor
+  /// @return `true` on success, `false` if the dump is not available
+  bool BumpDumpTime(DumpFileStats& dump, TimePoint new_update_time);
+
+  /// @brief Removes old dumps with their deltas and tmp files
   /// @note The operation is blocking, and should run in FS TaskProcessor
   /// @warning Must not be called concurrently with `RegisterNewDump`
   void Cleanup();
@@ -58,8 +74,13 @@ class DumpLocator final {
 
   std::optional<DumpFileStats> GetLatestDumpImpl() const;
 
+  /// Fills `delta_paths` and `update_time` from the deltas directory of `dump`
+  void FindDeltas(DumpFileStats& dump) const;
+
   std::string GenerateDumpPath(TimePoint update_time) const;
 
+  std::string GenerateDumpFilename(TimePoint update_time) const;
+
   TimePoint MinAcceptableUpdateTime() const;
 
   static std::string GenerateFilenameRegex(FileFormatType type);
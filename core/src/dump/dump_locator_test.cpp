@@ -2,6 +2,8 @@
 
 #include <set>
 
+#include <fmt/format.h>
+
 #include <dump/internal_helpers_test.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/fs/blocking/temp_directory.hpp>
@@ -221,6 +223,67 @@ max-age: null
   EXPECT_EQ(dump::FilenamesInDirectory(dir, kDumperName), expected_files);
 }
 
+UTEST(DumpLocator, Deltas) {
+  using namespace std::chrono_literals;
+
+  const std::string kConfig = R"(
+enable: true
+world-readable: false
+format-version: 5
+max-count: 1
+max-age: null
+)";
+  const auto dir = fs::blocking::TempDirectory::Create();
+
+  const dump::Config config{dump::ConfigFromYaml(kConfig, dir, kDumperName)};
+  dump::DumpLocator locator{config};
+
+  auto dump_stats = locator.RegisterNewDump(BaseTime());
+  fs::blocking::RewriteFileContents(dump_stats.full_path, "dump");
+  for (int i = 1; i <= 2; ++i) {
+    const auto delta_stats =
+        locator.RegisterNewDelta(dump_stats, BaseTime() + i * 1s);
+    fs::blocking::RewriteFileContents(delta_stats.full_path,
+                                      "delta" + std::to_string(i));
+  }
+  // A leftover of a failed delta write
+  const std::string kDeltasDirectory = "2015-03-22T090000.000000Z-v5.deltas";
+  fs::blocking::RewriteFileContents(
+      dump_stats.full_path + ".deltas/2015-03-22T090003.000000Z-v5.tmp", "");
+
+  auto dump_info = locator.GetLatestDump();
+  ASSERT_TRUE(dump_info);
+  EXPECT_EQ(fs::blocking::ReadFileContents(dump_info->full_path), "dump");
+  EXPECT_EQ(dump_info->update_time, BaseTime() + 2s);
+  ASSERT_EQ(dump_info->delta_paths.size(), 2);
+  EXPECT_EQ(fs::blocking::ReadFileContents(dump_info->delta_paths[0]),
+            "delta1");
+  EXPECT_EQ(fs::blocking::ReadFileContents(dump_info->delta_paths[1]),
+            "delta2");
+
+  // Bumps rename the last delta
+  EXPECT_TRUE(locator.BumpDumpTime(*dump_info, BaseTime() + 5s));
+  EXPECT_EQ(Filename(dump_info->delta_paths[1]),
+            "2015-03-22T090005.000000Z-v5");
+  EXPECT_EQ(locator.GetLatestDump()->update_time, BaseTime() + 5s);
+
+  locator.Cleanup();
+  EXPECT_EQ(dump::FilenamesInDirectory(dir, kDumperName),
+            (std::set<std::string>{"2015-03-22T090000.000000Z-v5",
+                                   kDeltasDirectory}));
+  EXPECT_EQ(dump::FilenamesInDirectory(
+                dir, fmt::format("{}/{}", kDumperName, kDeltasDirectory)),
+            (std::set<std::string>{"2015-03-22T090001.000000Z-v5",
+                                   "2015-03-22T090005.000000Z-v5"}));
+
+  // A new full dump replaces the dump together with its deltas
+  const auto new_dump_stats = locator.RegisterNewDump(BaseTime() + 6s);
+  fs::blocking::RewriteFileContents(new_dump_stats.full_path, "new dump");
+  locator.Cleanup();
+  EXPECT_EQ(dump::FilenamesInDirectory(dir, kDumperName),
+            (std::set<std::string>{"2015-03-22T090006.000000Z-v5"}));
+}
+
 UTEST(DumpLocator, LegacyFilenames) {
   using namespace std::chrono_literals;
   using namespace std::string_literals;
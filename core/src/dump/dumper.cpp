@@ -46,8 +46,16 @@ void ThrowDumpUnimplemented(const std::string& name) {
                                 name));
 }
 
+DeltaSequence::~DeltaSequence() = default;
+
 DumpableEntity::~DumpableEntity() = default;
 
+bool DumpableEntity::GetAndWriteDelta(dump::Writer&) { return false; }
+
+void DumpableEntity::ReadAndSetWithDeltas(dump::Reader&, DeltaSequence&) {
+  throw Error("Incremental dumps are not supported for the dumpable entity");
+}
+
 namespace {
 
 struct UpdateTime final {
@@ -69,8 +77,62 @@ struct DumpData {
   DumpableEntity& dumpable;
   DumpLocator locator;
   std::optional<UpdateTime> dumped_update_time;
+  // The files of the last written or loaded dump, new deltas go on top of it
+  std::optional<DumpFileStats> dumped_files;
+};
+
+// Opens the deltas one by one, finishing the previous reader
+class DeltaFiles final : public DeltaSequence {
+ public:
+  DeltaFiles(OperationsFactory& rw_factory, Reader& base_reader,
+             const std::vector<std::string>& paths)
+      : rw_factory_(rw_factory), paths_(paths), current_(&base_reader) {}
+
+  Reader* Next() override {
+    if (!current_) return nullptr;
+    current_->Finish();
+    if (next_index_ == paths_.size()) {
+      current_ = nullptr;
+      return nullptr;
+    }
+    delta_reader_ = rw_factory_.CreateReader(paths_[next_index_++]);
+    current_ = delta_reader_.get();
+    return current_;
+  }
+
+  /// @throws std::exception if not all the deltas have been read
+  void Finish() {
+    if (current_ || next_index_ != paths_.size()) {
+      throw Error(fmt::format("Only {} of {} deltas have been read",
+                              next_index_, paths_.size()));
+    }
+  }
+
+ private:
+  OperationsFactory& rw_factory_;
+  const std::vector<std::string>& paths_;
+  Reader* current_;
+  std::unique_ptr<Reader> delta_reader_;
+  std::size_t next_index_{0};
 };
 
+// Replaying many deltas, or the deltas larger than the dump itself, is slower
+// than reading a new full dump
+bool IsCompactionNeeded(const DumpFileStats& dump, std::size_t max_deltas) {
+  if (dump.delta_paths.size() >= max_deltas) return true;
+  try {
+    std::uintmax_t deltas_size = 0;
+    for (const auto& path : dump.delta_paths) {
+      deltas_size += boost::filesystem::file_size(path);
+    }
+    return deltas_size > boost::filesystem::file_size(dump.full_path);
+  } catch (const boost::filesystem::filesystem_error& ex) {
+    LOG_WARNING() << "Failed to get the size of the dump \"" << dump.full_path
+                  << "\" or its deltas: " << ex;
+    return true;
+  }
+}
+
 struct UpdateData {
   explicit UpdateData(Statistics& statistics)
       : is_current_from_dump(statistics.is_current_from_dump) {}
@@ -141,6 +203,11 @@ class Dumper::Impl {
   void DoWriteDump(TimePoint update_time, tracing::ScopeTime& scope,
                    DumpData& dump_data);
 
+  /// @returns `false` if a full dump should be written instead
+  /// @throws std::exception on failure
+  bool TryWriteDelta(TimePoint update_time, tracing::ScopeTime& scope,
+                     DumpData& dump_data);
+
   enum class DumpOperation { kNewDump, kBumpTime };
 
   /// @returns `update_time` of the loaded dump on success, `null` otherwise
@@ -190,6 +257,7 @@ Dumper::Impl::Impl(const Config& initial_config,
       dump_data_(static_config_, std::move(rw_factory), dumpable),
       update_data_(statistics_),
       testsuite_registration_(std::in_place, dump_control, self) {
+  statistics_.is_incremental = static_config_.incremental.has_value();
   statistics_holder_ = statistics_storage.RegisterWriter(
       fmt::format("cache.dump"), [this](utils::statistics::Writer& writer) {
         writer.ValueWithLabels(statistics_, {{"cache_name", Name()}});
@@ -353,13 +421,16 @@ void Dumper::Impl::WriteDump(DumpData& dump_data) {
 
   switch (operation_type) {
     case DumpOperation::kNewDump: {
-      dump_data.locator.Cleanup();
-      DoWriteDump(update_time.last_update, scope_time, dump_data);
+      if (!TryWriteDelta(update_time.last_update, scope_time, dump_data)) {
+        dump_data.locator.Cleanup();
+        DoWriteDump(update_time.last_update, scope_time, dump_data);
+      }
       break;
     }
     case DumpOperation::kBumpTime: {
       UASSERT(dumped_update_time);
-      if (!dump_data.locator.BumpDumpTime(dumped_update_time->last_update,
+      if (!dump_data.dumped_files ||
+          !dump_data.locator.BumpDumpTime(*dump_data.dumped_files,
                                           update_time.last_update)) {
         DoWriteDump(update_time.last_update, scope_time, dump_data);
       }
@@ -422,8 +493,10 @@ void Dumper::Impl::DoWriteDump(TimePoint update_time, tracing::ScopeTime& scope,
                                DumpData& dump_data) {
   const auto dump_start = std::chrono::steady_clock::now();
 
-  const auto dump_stats = dump_data.locator.RegisterNewDump(update_time);
+  auto dump_stats = dump_data.locator.RegisterNewDump(update_time);
   const auto& dump_path = dump_stats.full_path;
+  // The entity forgets the changes for the deltas even if the write fails
+  dump_data.dumped_files.reset();
   auto writer = dump_data.rw_factory->CreateWriter(dump_path, scope);
   dump_data.dumpable.GetAndWrite(*writer);
   writer->Finish();
@@ -431,12 +504,63 @@ void Dumper::Impl::DoWriteDump(TimePoint update_time, tracing::ScopeTime& scope,
 
   LOG_INFO() << Name() << ": a new dump has been written at \"" << dump_path
              << '"';
+  dump_data.dumped_files = std::move(dump_stats);
 
   statistics_.last_written_size = dump_size;
+  statistics_.deltas_count = 0;
+  statistics_.last_nontrivial_write_duration =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - dump_start);
+  statistics_.last_nontrivial_write_start_time = dump_start;
+}
+
+bool Dumper::Impl::TryWriteDelta(TimePoint update_time,
+                                 tracing::ScopeTime& scope,
+                                 DumpData& dump_data) {
+  if (!static_config_.incremental || !dump_data.dumped_files ||
+      update_time <= dump_data.dumped_files->update_time) {
+    return false;
+  }
+
+  const auto& dumped_files = *dump_data.dumped_files;
+  const auto deltas_count = dumped_files.delta_paths.size();
+  if (IsCompactionNeeded(dumped_files,
+                         static_config_.incremental->max_deltas)) {
+    LOG_INFO() << Name() << ": compacting the dump and its " << deltas_count
+               << " deltas into a new dump";
+    return false;
+  }
+
+  const auto dump_start = std::chrono::steady_clock::now();
+
+  auto delta_stats =
+      dump_data.locator.RegisterNewDelta(dumped_files, update_time);
+  auto files = std::move(dump_data.dumped_files);
+  dump_data.dumped_files.reset();
+
+  auto writer =
+      dump_data.rw_factory->CreateWriter(delta_stats.full_path, scope);
+  if (!dump_data.dumpable.GetAndWriteDelta(*writer)) {
+    // The unfinished tmp file is removed by Cleanup
+    LOG_DEBUG() << Name() << ": the changes can't be written as a delta";
+    return false;
+  }
+  writer->Finish();
+  const auto delta_size = boost::filesystem::file_size(delta_stats.full_path);
+
+  LOG_INFO() << Name() << ": a new dump delta has been written at \""
+             << delta_stats.full_path << '"';
+  files->delta_paths.push_back(std::move(delta_stats.full_path));
+  files->update_time = update_time;
+  dump_data.dumped_files = std::move(files);
+
+  statistics_.last_written_size = delta_size;
+  statistics_.deltas_count = deltas_count + 1;
   statistics_.last_nontrivial_write_duration =
       std::chrono::duration_cast<std::chrono::milliseconds>(
           std::chrono::steady_clock::now() - dump_start);
   statistics_.last_nontrivial_write_start_time = dump_start;
+  return true;
 }
 
 std::optional<TimePoint> Dumper::Impl::LoadFromDump(
@@ -451,30 +575,40 @@ std::optional<TimePoint> Dumper::Impl::LoadFromDump(
 
   const auto load_start = std::chrono::steady_clock::now();
 
-  const std::optional<TimePoint> update_time =
+  std::optional<DumpFileStats> loaded_files =
       utils::CriticalAsync(fs_task_processor_, read_span_name_, [&] {
         auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime();
 
         try {
           auto dump_stats = dump_data.locator.GetLatestDump();
-          if (!dump_stats) return std::optional<TimePoint>{};
+          if (!dump_stats) return std::optional<DumpFileStats>{};
 
           auto reader =
               dump_data.rw_factory->CreateReader(dump_stats->full_path);
-          dump_data.dumpable.ReadAndSet(*reader);
-          reader->Finish();
+          if (dump_stats->delta_paths.empty()) {
+            dump_data.dumpable.ReadAndSet(*reader);
+            reader->Finish();
+          } else {
+            DeltaFiles deltas{*dump_data.rw_factory, *reader,
+                              dump_stats->delta_paths};
+            dump_data.dumpable.ReadAndSetWithDeltas(*reader, deltas);
+            deltas.Finish();
+          }
 
           LOG_INFO() << Name() << ": a dump has been loaded successfully";
-          return std::optional{dump_stats->update_time};
+          return dump_stats;
         } catch (const std::exception& ex) {
           LOG_ERROR() << Name()
                       << ": error while reading a dump. Reason: " << ex;
-          return std::optional<TimePoint>{};
+          return std::optional<DumpFileStats>{};
         }
       }).Get();
 
-  if (!update_time) return {};
-  const UpdateTime update_times{*update_time, *update_time};
+  if (!loaded_files) return {};
+  const auto update_time = loaded_files->update_time;
+  statistics_.deltas_count = loaded_files->delta_paths.size();
+  dump_data.dumped_files = std::move(loaded_files);
+  const UpdateTime update_times{update_time, update_time};
 
   {
     auto update_data = update_data_.Lock();
@@ -574,6 +708,51 @@ properties:
                 type: boolean
                 description: Whether to encrypt the dump
                 defaultDescription: false
+            mmap:
+                type: boolean
+                description: |
+                    Whether to memory-map the dump for reading, the data
+                    of dump::FlatArray is then used in place
+                defaultDescription: false
+            incremental:
+                type: object
+                description: |
+                    Enables the incremental dumps, only the changes since
+                    the previous write are written as a delta on top of it
+                additionalProperties: false
+                properties:
+                    max-deltas:
+                        type: integer
+                        description: |
+                            max number of deltas on top of a dump before
+                            a new full dump is written
+                        defaultDescription: 16
+                        minimum: 1
+            compression:
+                type: object
+                description: |
+                    Enables the compressed dump format, the dump is split into
+                    chunks that are compressed and decompressed in parallel
+                additionalProperties: false
+                properties:
+                    level:
+                        type: integer
+                        description: zstd compression level
+                        defaultDescription: 3
+                    chunk-size:
+                        type: integer
+                        description: size of the uncompressed chunk in bytes
+                        defaultDescription: 4194304
+                        minimum: 1
+                    concurrency:
+                        type: integer
+                        description: max number of chunks processed at once
+                        defaultDescription: 4
+                        minimum: 1
+                    task-processor:
+                        type: string
+                        description: "`TaskProcessor` for the compression"
+                        defaultDescription: main-task-processor
 )");
 }
 
@@ -3,6 +3,7 @@
 #include <atomic>
 #include <chrono>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <dump/internal_helpers_test.hpp>
@@ -16,6 +17,7 @@
 #include <userver/engine/mutex.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/task_with_result.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
 #include <userver/rcu/rcu_map.hpp>
 #include <userver/testsuite/dump_control.hpp>
 #include <userver/utest/assert_macros.hpp>
@@ -351,6 +353,130 @@ UTEST_F(DumperFixtureNonPeriodic, ForcedReadsEnabled) {
 
 namespace {
 
+struct IncrementalEntity final : public dump::DumpableEntity {
+  void GetAndWrite(dump::Writer& writer) const override {
+    writer.Write(values);
+    changes.clear();
+    ++write_count;
+  }
+
+  void ReadAndSet(dump::Reader& reader) override {
+    values = reader.Read<std::vector<int>>();
+  }
+
+  bool GetAndWriteDelta(dump::Writer& writer) override {
+    writer.Write(std::exchange(changes, {}));
+    ++delta_write_count;
+    return true;
+  }
+
+  void ReadAndSetWithDeltas(dump::Reader& reader,
+                            dump::DeltaSequence& deltas) override {
+    values = reader.Read<std::vector<int>>();
+    while (auto* delta = deltas.Next()) {
+      for (const auto value : delta->Read<std::vector<int>>()) {
+        values.push_back(value);
+      }
+    }
+  }
+
+  void Add(int value) {
+    values.push_back(value);
+    changes.push_back(value);
+  }
+
+  std::vector<int> values;
+  mutable std::vector<int> changes;
+  mutable int write_count{0};
+  int delta_write_count{0};
+};
+
+const std::string kIncrementalConfig = R"(
+enable: true
+world-readable: true
+format-version: 0
+max-age:  # unlimited
+max-count: 1
+incremental:
+  max-deltas: 2
+)";
+
+class DumperIncrementalFixture : public ::testing::Test {
+ protected:
+  dump::Dumper MakeDumper(IncrementalEntity& dumpable,
+                          testsuite::DumpControl& control) {
+    return dump::Dumper{
+        config_,
+        dump::CreateDefaultOperationsFactory(config_),
+        engine::current_task::GetTaskProcessor(),
+        config_storage_.GetSource(),
+        statistics_storage_,
+        control,
+        dumpable,
+    };
+  }
+
+  std::vector<int> ReadValues() {
+    IncrementalEntity dumpable;
+    testsuite::DumpControl control{
+        testsuite::DumpControl::PeriodicsMode::kDisabled};
+    auto dumper = MakeDumper(dumpable, control);
+    dumper.ReadDumpDebug();
+    return dumpable.values;
+  }
+
+ private:
+  fs::blocking::TempDirectory root_ = fs::blocking::TempDirectory::Create();
+  dump::Config config_{
+      dump::ConfigFromYaml(kIncrementalConfig, root_, "incremental")};
+  utils::statistics::Storage statistics_storage_;
+  dynamic_config::StorageMock config_storage_{{dump::kConfigSet, {}}};
+};
+
+}  // namespace
+
+UTEST_F(DumperIncrementalFixture, DeltasAndCompaction) {
+  IncrementalEntity dumpable;
+  testsuite::DumpControl control{
+      testsuite::DumpControl::PeriodicsMode::kDisabled};
+  auto dumper = MakeDumper(dumpable, control);
+  dumper.ReadDump();
+
+  auto update_time = Now();
+  const auto update = [&](int value) {
+    dumpable.Add(value);
+    update_time += 1s;
+    dumper.OnUpdateCompleted(update_time, dump::UpdateType::kModified);
+    dumper.WriteDumpSyncDebug();
+  };
+
+  update(1);
+  update(2);
+  update(3);
+  EXPECT_EQ(dumpable.write_count, 1);
+  EXPECT_EQ(dumpable.delta_write_count, 2);
+  EXPECT_EQ(ReadValues(), (std::vector{1, 2, 3}));
+
+  // max-deltas is reached, the deltas are compacted into a new full dump
+  update(4);
+  EXPECT_EQ(dumpable.write_count, 2);
+  EXPECT_EQ(dumpable.delta_write_count, 2);
+
+  update(5);
+  EXPECT_EQ(dumpable.write_count, 2);
+  EXPECT_EQ(dumpable.delta_write_count, 3);
+  EXPECT_EQ(ReadValues(), (std::vector{1, 2, 3, 4, 5}));
+
+  // The bumps of the update time rename the last delta
+  dumper.OnUpdateCompleted(update_time + 1s,
+                           dump::UpdateType::kAlreadyUpToDate);
+  dumper.WriteDumpSyncDebug();
+  EXPECT_EQ(dumpable.delta_write_count, 3);
+  EXPECT_EQ(ReadValues(), (std::vector{1, 2, 3, 4, 5}));
+}
+
+namespace {
+
 /// [Sample Dumper usage]
 // NOLINTNEXTLINE(fuchsia-multiple-inheritance)
 class SampleComponentWithDumps final : public components::ComponentBase,
@@ -0,0 +1,90 @@
+#include <userver/dump/flat_array.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <userver/dump/operations_file.hpp>
+#include <userver/dump/operations_mock.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct Item final {
+  std::uint64_t id;
+  double value;
+  std::uint8_t flags;
+};
+
+std::vector<Item> MakeItems(std::size_t count) {
+  std::vector<Item> items(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    items[i] = {i, i * 0.5, static_cast<std::uint8_t>(i)};
+  }
+  return items;
+}
+
+void ExpectItems(const dump::FlatArray<Item>& array, std::size_t count) {
+  ASSERT_EQ(array.size(), count);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(array.data()) % alignof(Item), 0);
+  for (std::size_t i = 0; i < count; ++i) {
+    EXPECT_EQ(array[i].id, i);
+    EXPECT_EQ(array[i].value, i * 0.5);
+    EXPECT_EQ(array[i].flags, static_cast<std::uint8_t>(i));
+  }
+}
+
+}  // namespace
+
+TEST(DumpFlatArray, WriteRead) {
+  dump::MockWriter writer;
+  // Misaligns the array
+  writer.Write(std::string{"abc"});
+  writer.Write(dump::FlatArray<Item>{MakeItems(100)});
+  writer.Write(dump::FlatArray<Item>{});
+  writer.Write(42);
+  writer.Finish();
+
+  dump::MockReader reader(std::move(writer).Extract());
+  EXPECT_EQ(reader.Read<std::string>(), "abc");
+  const auto array = reader.Read<dump::FlatArray<Item>>();
+  EXPECT_TRUE(reader.Read<dump::FlatArray<Item>>().empty());
+  EXPECT_EQ(reader.Read<int>(), 42);
+  reader.Finish();
+
+  ExpectItems(array, 100);
+}
+
+UTEST(DumpFlatArray, Mmap) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/dump";
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::FileWriter writer(path, boost::filesystem::perms::owner_read,
+                          scope_time);
+  writer.Write(std::string{"abc"});
+  writer.Write(dump::FlatArray<Item>{MakeItems(10000)});
+  writer.Write(dump::FlatArray<std::uint16_t>{{1, 2, 3}});
+  writer.Finish();
+
+  dump::FlatArray<Item> items;
+  dump::FlatArray<std::uint16_t> numbers;
+  {
+    dump::MmapFileReader reader(path);
+    EXPECT_EQ(reader.Read<std::string>(), "abc");
+    items = reader.Read<dump::FlatArray<Item>>();
+    numbers = reader.Read<dump::FlatArray<std::uint16_t>>();
+    reader.Finish();
+  }
+
+  // The arrays keep the mapping alive after the reader is gone
+  ExpectItems(items, 10000);
+  EXPECT_EQ(std::vector<std::uint16_t>(numbers.begin(), numbers.end()),
+            (std::vector<std::uint16_t>{1, 2, 3}));
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,13 @@
+#include <userver/dump/operations.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+std::shared_ptr<const char> Reader::ReadRawShared(std::size_t /*size*/) {
+  return nullptr;
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
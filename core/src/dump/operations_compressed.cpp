@@ -0,0 +1,215 @@
+#include <userver/dump/operations_compressed.hpp>
+
+#include <algorithm>
+#include <string_view>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <userver/compression/error.hpp>
+#include <userver/compression/zstd.hpp>
+#include <userver/dump/common.hpp>
+#include <userver/dump/unsafe.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+// File layout:
+// 1. kMagic
+// 2. chunks: raw size, compressed size, zstd frame with a checksum
+// 3. terminator: 0, the number of chunks
+
+namespace {
+constexpr std::string_view kMagic = "udmpzst1";
+}
+
+CompressedWriter::CompressedWriter(std::string path,
+                                   boost::filesystem::perms perms,
+                                   tracing::ScopeTime& scope,
+                                   const CompressionConfig& config,
+                                   engine::TaskProcessor& task_processor)
+    : file_(std::move(path), perms, scope),
+      level_(config.level),
+      chunk_size_(config.chunk_size),
+      concurrency_(config.concurrency),
+      task_processor_(task_processor) {
+  WriteStringViewUnsafe(file_, kMagic);
+  chunk_.reserve(chunk_size_);
+}
+
+CompressedWriter::~CompressedWriter() = default;
+
+void CompressedWriter::WriteRaw(std::string_view data) {
+  while (!data.empty()) {
+    const auto part = std::min(data.size(), chunk_size_ - chunk_.size());
+    chunk_.append(data.data(), part);
+    data.remove_prefix(part);
+    if (chunk_.size() == chunk_size_) CompressChunk();
+  }
+}
+
+void CompressedWriter::Finish() {
+  CompressChunk();
+  while (!pending_.empty()) WriteCompressedChunk();
+
+  file_.Write(std::uint64_t{0});
+  file_.Write(chunks_written_);
+  file_.Finish();
+}
+
+void CompressedWriter::CompressChunk() {
+  if (chunk_.empty()) return;
+  if (pending_.size() >= concurrency_) WriteCompressedChunk();
+
+  pending_.push_back(engine::AsyncNoSpan(
+      task_processor_, [data = std::move(chunk_), level = level_] {
+        auto compressed =
+            compression::zstd::Compress(data, level, /*with_checksum=*/true);
+        return Chunk{data.size(), std::move(compressed)};
+      }));
+
+  chunk_ = std::string{};
+  chunk_.reserve(chunk_size_);
+}
+
+void CompressedWriter::WriteCompressedChunk() {
+  auto task = std::move(pending_.front());
+  pending_.pop_front();
+  const auto chunk = task.Get();
+
+  file_.Write(chunk.raw_size);
+  file_.Write(std::uint64_t{chunk.compressed.size()});
+  WriteStringViewUnsafe(file_, chunk.compressed);
+  ++chunks_written_;
+}
+
+CompressedReader::CompressedReader(std::string path, std::size_t concurrency,
+                                   engine::TaskProcessor& task_processor)
+    : file_(path), path_(std::move(path)), task_processor_(task_processor) {
+  if (ReadUnsafeAtMost(file_, kMagic.size()) != kMagic) {
+    throw Error(fmt::format("The dump file \"{}\" is not a compressed dump",
+                            path_));
+  }
+  for (std::size_t i = 0; i < concurrency; ++i) StartDecompression();
+}
+
+CompressedReader::~CompressedReader() = default;
+
+std::string_view CompressedReader::ReadRaw(std::size_t max_size) {
+  while (chunk_offset_ == chunk_.size()) {
+    if (!NextChunk()) return {};
+  }
+
+  if (chunk_.size() - chunk_offset_ >= max_size) {
+    const std::string_view result{chunk_.data() + chunk_offset_, max_size};
+    chunk_offset_ += max_size;
+    return result;
+  }
+
+  // The data spans several chunks
+  spill_.assign(chunk_, chunk_offset_);
+  chunk_offset_ = chunk_.size();
+  while (spill_.size() < max_size && NextChunk()) {
+    const auto part = std::min(max_size - spill_.size(), chunk_.size());
+    spill_.append(chunk_.data(), part);
+    chunk_offset_ = part;
+  }
+  return spill_;
+}
+
+void CompressedReader::Finish() {
+  if (chunk_offset_ != chunk_.size() || !pending_.empty() || !is_file_read_) {
+    throw Error(fmt::format(
+        "Unexpected extra data at the end of the compressed dump file \"{}\"",
+        path_));
+  }
+  file_.Finish();
+}
+
+void CompressedReader::StartDecompression() {
+  if (is_file_read_) return;
+
+  const auto raw_size = file_.Read<std::uint64_t>();
+  if (raw_size == 0) {
+    const auto chunks_count = file_.Read<std::uint64_t>();
+    if (chunks_count != chunks_read_) {
+      throw Error(fmt::format(
+          "Broken compressed dump file \"{}\": expected {} chunks, found {}",
+          path_, chunks_count, chunks_read_));
+    }
+    is_file_read_ = true;
+    return;
+  }
+
+  const auto compressed_size = file_.Read<std::uint64_t>();
+  if (raw_size > CompressionConfig::kMaxChunkSize ||
+      compressed_size > 2 * CompressionConfig::kMaxChunkSize) {
+    throw Error(fmt::format(
+        "Broken compressed dump file \"{}\": chunk #{} is too big, "
+        "raw-size={}, compressed-size={}",
+        path_, chunks_read_, raw_size, compressed_size));
+  }
+
+  std::string compressed{ReadStringViewUnsafe(file_, compressed_size)};
+  ++chunks_read_;
+
+  pending_.push_back(engine::AsyncNoSpan(
+      task_processor_, [compressed = std::move(compressed), raw_size] {
+        auto data = compression::zstd::Decompress(compressed, raw_size);
+        if (data.size() != raw_size) {
+          throw compression::DecompressionError("Unexpected chunk size");
+        }
+        return data;
+      }));
+}
+
+bool CompressedReader::NextChunk() {
+  if (pending_.empty()) return false;
+
+  auto task = std::move(pending_.front());
+  pending_.pop_front();
+  // Keep reading ahead while the chunk is being decompressed
+  StartDecompression();
+
+  try {
+    chunk_ = task.Get();
+  } catch (const compression::DecompressionError& ex) {
+    throw Error(fmt::format(
+        "Broken compressed dump file \"{}\": chunk #{} is corrupted: {}", path_,
+        chunks_decompressed_, ex.what()));
+  }
+  chunk_offset_ = 0;
+  ++chunks_decompressed_;
+  return true;
+}
+
+CompressedOperationsFactory::CompressedOperationsFactory(
+    boost::filesystem::perms perms, CompressionConfig config,
+    engine::TaskProcessor* task_processor)
+    : perms_(perms),
+      config_(std::move(config)),
+      task_processor_(task_processor) {}
+
+std::unique_ptr<Reader> CompressedOperationsFactory::CreateReader(
+    std::string full_path) {
+  return std::make_unique<CompressedReader>(
+      std::move(full_path), config_.concurrency, GetTaskProcessor());
+}
+
+std::unique_ptr<Writer> CompressedOperationsFactory::CreateWriter(
+    std::string full_path, tracing::ScopeTime& scope) {
+  return std::make_unique<CompressedWriter>(std::move(full_path), perms_, scope,
+                                            config_, GetTaskProcessor());
+}
+
+engine::TaskProcessor& CompressedOperationsFactory::GetTaskProcessor() const {
+  return task_processor_ ? *task_processor_
+                         : engine::current_task::GetTaskProcessor();
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,145 @@
+#include <userver/dump/operations_compressed.hpp>
+
+#include <string>
+#include <vector>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/common_containers.hpp>
+#include <userver/dump/unsafe.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+dump::CompressionConfig MakeConfig(std::size_t chunk_size) {
+  return {3, chunk_size, 2, "main-task-processor"};
+}
+
+std::string DumpFilePath(const fs::blocking::TempDirectory& dir) {
+  return dir.GetPath() + "/dump";
+}
+
+void WriteDump(const std::string& path, std::size_t chunk_size,
+               const std::vector<std::string>& data) {
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::CompressedWriter writer(path, boost::filesystem::perms::owner_read,
+                                scope_time, MakeConfig(chunk_size),
+                                engine::current_task::GetTaskProcessor());
+  writer.Write(data);
+  writer.Finish();
+}
+
+dump::CompressedReader MakeReader(const std::string& path) {
+  return dump::CompressedReader(path, 2,
+                                engine::current_task::GetTaskProcessor());
+}
+
+}  // namespace
+
+UTEST_MT(DumpOperationsCompressed, WriteRead, 4) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+
+  std::vector<std::string> data;
+  for (std::size_t i = 0; i < 1000; ++i) data.push_back(std::string(i, 'a'));
+
+  // The strings span several chunks
+  for (const std::size_t chunk_size : {100, 4096, 1 << 20}) {
+    WriteDump(path, chunk_size, data);
+
+    auto reader = MakeReader(path);
+    EXPECT_EQ(reader.Read<std::vector<std::string>>(), data);
+    reader.Finish();
+    fs::blocking::RemoveSingleFile(path);
+  }
+}
+
+UTEST(DumpOperationsCompressed, Compresses) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+
+  const std::vector<std::string> data(100, std::string(10000, 'a'));
+  WriteDump(path, 64 * 1024, data);
+
+  EXPECT_LT(fs::blocking::ReadFileContents(path).size(), 100 * 10000 / 10);
+}
+
+UTEST(DumpOperationsCompressed, EmptyDump) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::CompressedWriter writer(path, boost::filesystem::perms::owner_read,
+                                scope_time, MakeConfig(16),
+                                engine::current_task::GetTaskProcessor());
+  writer.Finish();
+
+  auto reader = MakeReader(path);
+  EXPECT_EQ(ReadUnsafeAtMost(reader, 1), "");
+  reader.Finish();
+}
+
+UTEST(DumpOperationsCompressed, UnreadData) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+
+  WriteDump(path, 16, {"abc", "def", std::string(100, 'x')});
+
+  auto reader = MakeReader(path);
+  EXPECT_EQ(reader.Read<std::size_t>(), 3);
+  EXPECT_EQ(reader.Read<std::string>(), "abc");
+  UEXPECT_THROW(reader.Finish(), dump::Error);
+}
+
+UTEST(DumpOperationsCompressed, Corrupted) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+
+  WriteDump(path, 1024, {std::string(10000, 'a')});
+
+  auto contents = fs::blocking::ReadFileContents(path);
+  fs::blocking::RemoveSingleFile(path);
+  // Damages the checksum of the last chunk
+  contents[contents.size() - 4] ^= 1;
+  fs::blocking::RewriteFileContents(path, contents);
+
+  auto reader = MakeReader(path);
+  UEXPECT_THROW(reader.Read<std::string>(), dump::Error);
+}
+
+UTEST(DumpOperationsCompressed, Truncated) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+
+  WriteDump(path, 1024, {std::string(10000, 'a')});
+
+  auto contents = fs::blocking::ReadFileContents(path);
+  fs::blocking::RemoveSingleFile(path);
+  contents.resize(contents.size() - 2);
+  fs::blocking::RewriteFileContents(path, contents);
+
+  UEXPECT_THROW(
+      {
+        auto reader = MakeReader(path);
+        reader.Read<std::vector<std::string>>();
+        reader.Finish();
+      },
+      dump::Error);
+}
+
+UTEST(DumpOperationsCompressed, NotCompressed) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+
+  fs::blocking::RewriteFileContents(path, "plain dump data");
+
+  UEXPECT_THROW(MakeReader(path), dump::Error);
+}
+
+USERVER_NAMESPACE_END
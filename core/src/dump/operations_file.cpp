@@ -1,12 +1,17 @@
 #include <userver/dump/operations_file.hpp>
 
+#include <sys/mman.h>
+#include <cerrno>
+
 #include <algorithm>
 #include <stdexcept>
 #include <utility>
 
 #include <fmt/format.h>
 
+#include <userver/fs/blocking/file_descriptor.hpp>
 #include <userver/fs/blocking/write.hpp>
+#include <userver/utils/strerror.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -116,11 +121,71 @@ void FileReader::Finish() {
   }
 }
 
-FileOperationsFactory::FileOperationsFactory(boost::filesystem::perms perms)
-    : perms_(perms) {}
+MmapFileReader::MmapFileReader(std::string path) : path_(std::move(path)) {
+  try {
+    const auto file =
+        fs::blocking::FileDescriptor::Open(path_, fs::blocking::OpenFlag::kRead);
+    size_ = file.GetSize();
+    // mmap fails on empty files
+    if (size_ == 0) return;
+
+    void* const data =
+        ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file.GetNative(), 0);
+    if (data == MAP_FAILED) {
+      throw std::runtime_error(
+          fmt::format("mmap failed: {}", utils::strerror(errno)));
+    }
+    mapping_ = std::shared_ptr<const char>(
+        static_cast<const char*>(data),
+        [size = size_](const char* ptr) {
+          ::munmap(const_cast<char*>(ptr), size);
+        });
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format(
+        "Failed to map the dump file for reading \"{}\". Reason: {}", path_,
+        ex.what()));
+  }
+}
+
+std::string_view MmapFileReader::ReadRaw(std::size_t max_size) {
+  const auto size = std::min(max_size, size_ - offset_);
+  const std::string_view result{mapping_.get() + offset_, size};
+  offset_ += size;
+  return result;
+}
+
+std::shared_ptr<const char> MmapFileReader::ReadRawShared(std::size_t size) {
+  if (size > size_ - offset_) {
+    throw Error(
+        fmt::format("Unexpected end-of-file while trying to read from the dump "
+                    "file \"{}\": requested-size={}",
+                    path_, size));
+  }
+
+  // Shares the ownership of the whole mapping
+  std::shared_ptr<const char> result{mapping_, mapping_.get() + offset_};
+  offset_ += size;
+  return result;
+}
+
+void MmapFileReader::Finish() {
+  if (offset_ != size_) {
+    throw Error(
+        fmt::format("Unexpected extra data at the end of the dump file \"{}\": "
+                    "file-size={}, position={}, unread-size={}",
+                    path_, size_, offset_, size_ - offset_));
+  }
+  // The data given out by ReadSharedUnsafe keeps the mapping alive
+  mapping_.reset();
+}
+
+FileOperationsFactory::FileOperationsFactory(boost::filesystem::perms perms,
+                                             bool use_mmap)
+    : perms_(perms), use_mmap_(use_mmap) {}
 
 std::unique_ptr<Reader> FileOperationsFactory::CreateReader(
     std::string full_path) {
+  if (use_mmap_) return std::make_unique<MmapFileReader>(std::move(full_path));
   return std::make_unique<FileReader>(std::move(full_path));
 }
 
@@ -113,4 +113,55 @@ TEST(DumpOperationsFile, Underread) {
   FAIL();
 }
 
+UTEST(DumpOperationsFile, MmapWriteReadRaw) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::FileWriter writer(path, boost::filesystem::perms::owner_read,
+                          scope_time);
+  WriteStringViewUnsafe(writer, "abc");
+  WriteStringViewUnsafe(writer, "defgh");
+  writer.Finish();
+
+  dump::MmapFileReader reader(path);
+  EXPECT_EQ(ReadStringViewUnsafe(reader, 3), "abc");
+  const auto shared = ReadSharedUnsafe(reader, 5);
+  ASSERT_TRUE(shared);
+  reader.Finish();
+  EXPECT_EQ(std::string_view(shared.get(), 5), "defgh");
+}
+
+UTEST(DumpOperationsFile, MmapEmptyDump) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::FileWriter writer(path, boost::filesystem::perms::owner_read,
+                          scope_time);
+  writer.Finish();
+
+  dump::MmapFileReader reader(path);
+  EXPECT_EQ(ReadStringViewUnsafe(reader, 0), "");
+  reader.Finish();
+}
+
+TEST(DumpOperationsFile, MmapOverread) {
+  const auto file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(file.GetPath(), std::string(10, 'a'));
+
+  dump::MmapFileReader reader(file.GetPath());
+  EXPECT_THROW(ReadStringViewUnsafe(reader, 11), dump::Error);
+  EXPECT_THROW(ReadSharedUnsafe(reader, 11), dump::Error);
+}
+
+TEST(DumpOperationsFile, MmapUnderread) {
+  const auto file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(file.GetPath(), std::string(10, 'a'));
+
+  dump::MmapFileReader reader(file.GetPath());
+  EXPECT_EQ(ReadStringViewUnsafe(reader, 9), std::string(9, 'a'));
+  EXPECT_THROW(reader.Finish(), dump::Error);
+}
+
 USERVER_NAMESPACE_END
@@ -26,6 +26,9 @@ void DumpMetric(utils::statistics::Writer& writer, const Statistics& stats) {
     write["duration-ms"] = stats.last_nontrivial_write_duration.load().count();
     write["size-kb"] = stats.last_written_size.load() / 1024;
   }
+  if (stats.is_incremental) {
+    writer["deltas-count"] = stats.deltas_count.load();
+  }
 }
 
 }  // namespace dump
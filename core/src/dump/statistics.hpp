@@ -21,6 +21,9 @@ struct Statistics {
       last_nontrivial_write_start_time{{}};
   std::atomic<std::chrono::milliseconds> last_nontrivial_write_duration{{}};
   std::atomic<std::size_t> last_written_size{0};
+
+  bool is_incremental{false};
+  std::atomic<std::size_t> deltas_count{0};
 };
 
 void DumpMetric(utils::statistics::Writer& writer, const Statistics& stats);
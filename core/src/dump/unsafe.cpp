@@ -11,6 +11,7 @@ namespace dump {
 
 void WriteStringViewUnsafe(Writer& writer, std::string_view value) {
   writer.WriteRaw(value);
+  writer.position_ += value.size();
 }
 
 std::string_view ReadStringViewUnsafe(Reader& reader) {
@@ -34,9 +35,24 @@ std::string_view ReadStringViewUnsafe(Reader& reader, std::size_t size) {
 std::string_view ReadUnsafeAtMost(Reader& reader, std::size_t max_size) {
   const auto result = reader.ReadRaw(max_size);
   UASSERT(result.size() <= max_size);
+  reader.position_ += result.size();
   return result;
 }
 
+std::shared_ptr<const char> ReadSharedUnsafe(Reader& reader, std::size_t size) {
+  auto result = reader.ReadRawShared(size);
+  if (result) reader.position_ += size;
+  return result;
+}
+
+std::size_t GetPositionUnsafe(const Writer& writer) noexcept {
+  return writer.position_;
+}
+
+std::size_t GetPositionUnsafe(const Reader& reader) noexcept {
+  return reader.position_;
+}
+
 }  // namespace dump
 
 USERVER_NAMESPACE_END
@@ -415,6 +415,53 @@ UTEST(DynamicConfig, SubsetSubscription) {
   EXPECT_EQ(subscribers[1].GetCounter(), 3);
 }
 
+/// [Single config subscription]
+class IntConfigSubscriber final {
+ public:
+  explicit IntConfigSubscriber(dynamic_config::Source source)
+      : subscriber_scope_(source.UpdateAndListen(
+            this, "int-config-subscriber",
+            &IntConfigSubscriber::OnConfigUpdate, kIntConfig)) {}
+
+  ~IntConfigSubscriber() { subscriber_scope_.Unsubscribe(); }
+
+  void OnConfigUpdate(const int& value) { values_.push_back(value); }
+
+  const std::vector<int>& GetValues() const { return values_; }
+
+ private:
+  std::vector<int> values_;
+  concurrent::AsyncEventSubscriberScope subscriber_scope_;
+};
+/// [Single config subscription]
+
+UTEST(DynamicConfig, SingleConfigSubscription) {
+  dynamic_config::StorageMock storage{{kIntConfig, 1}, {kBoolConfig, false}};
+  const IntConfigSubscriber subscriber{storage.GetSource()};
+  EXPECT_EQ(subscriber.GetValues(), std::vector<int>{1});
+
+  storage.Extend({{kBoolConfig, true}});
+  EXPECT_EQ(subscriber.GetValues(), std::vector<int>{1});
+
+  storage.Extend({{kIntConfig, 2}});
+  EXPECT_EQ(subscriber.GetValues(), (std::vector<int>{1, 2}));
+
+  storage.Extend({{kIntConfig, 2}, {kBoolConfig, false}});
+  EXPECT_EQ(subscriber.GetValues(), (std::vector<int>{1, 2}));
+}
+
+UTEST(DynamicConfig, Version) {
+  dynamic_config::StorageMock storage{{kIntConfig, 1}};
+  const auto source = storage.GetSource();
+
+  const auto version = source.GetVersion();
+  EXPECT_EQ(source.GetVersion(), version);
+
+  storage.Extend({{kIntConfig, 2}});
+  EXPECT_EQ(source.GetVersion(), version + 1);
+  EXPECT_EQ(source.GetCopy(kIntConfig), 2);
+}
+
 class CustomSubscriber final {
  public:
   void OnConfigUpdate(const dynamic_config::Diff&) { counter_++; }
@@ -1,5 +1,7 @@
 #include <userver/dynamic_config/impl/snapshot.hpp>
 
+#include <algorithm>
+
 #include <fmt/format.h>
 
 #include <userver/compiler/demangle.hpp>
@@ -7,6 +9,7 @@
 #include <userver/dynamic_config/storage_mock.hpp>
 #include <userver/utils/cpu_relax.hpp>
 #include <userver/utils/enumerate.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 #include <userver/utils/impl/static_registration.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -34,6 +37,14 @@ bool IsValidJson(std::string_view json_string) {
   }
 }
 
+bool HasChanged(const DocsMap& docs_map, const DocsMap& previous_docs_map,
+                const std::string& name) {
+  const bool has_doc = docs_map.Has(name);
+  if (has_doc != previous_docs_map.Has(name)) return true;
+  // Unchanged docs usually share the JSON value, which is compared in O(1)
+  return has_doc && docs_map.Get(name) != previous_docs_map.Get(name);
+}
+
 }  // namespace
 
 [[noreturn]] void WrapGetError(const std::exception& ex, std::type_index type) {
@@ -110,6 +121,7 @@ DocsMap MakeDefaultDocsMap() {
 SnapshotData::SnapshotData(const std::vector<KeyValue>& config_variables) {
   utils::impl::AssertStaticRegistrationFinished();
   user_configs_.resize(Registry().size());
+  dependencies_.resize(Registry().size());
 
   for (const auto& config_variable : config_variables) {
     user_configs_[config_variable.GetId()] = config_variable.GetValue();
@@ -120,16 +132,10 @@ SnapshotData::SnapshotData(const DocsMap& defaults,
                            const std::vector<KeyValue>& overrides)
     : SnapshotData(overrides) {
   utils::StreamingCpuRelax relax(1, nullptr);
-  for (const auto [id, metadata] : utils::enumerate(Registry())) {
+  for (ConfigId id = 0; id < user_configs_.size(); ++id) {
     if (!user_configs_[id].has_value()) {
       relax.Relax(1);
-      try {
-        user_configs_[id] = metadata.factory(defaults);
-      } catch (const std::exception& ex) {
-        throw ConfigParseError(
-            fmt::format("{} while parsing dynamic config values. {}",
-                        compiler::GetTypeName(typeid(ex)), ex.what()));
-      }
+      Parse(id, defaults);
     }
   }
 }
@@ -142,7 +148,54 @@ SnapshotData::SnapshotData(const SnapshotData& defaults,
   for (const auto [id, factory] : utils::enumerate(Registry())) {
     if (user_configs_[id].has_value()) continue;
     user_configs_[id] = defaults.user_configs_[id];
+    dependencies_[id] = defaults.dependencies_[id];
+  }
+}
+
+SnapshotData::SnapshotData(const DocsMap& docs_map,
+                           const DocsMap& previous_docs_map,
+                           const SnapshotData& previous)
+    : SnapshotData(std::vector<KeyValue>{}) {
+  UASSERT(previous.IsEmpty() ||
+          previous.user_configs_.size() == user_configs_.size());
+
+  utils::StreamingCpuRelax relax(1, nullptr);
+  for (ConfigId id = 0; id < user_configs_.size(); ++id) {
+    relax.Relax(1);
+    const auto& dependencies =
+        previous.IsEmpty() ? nullptr : previous.dependencies_[id];
+    const bool is_changed =
+        !dependencies ||
+        std::any_of(dependencies->begin(), dependencies->end(),
+                    [&](const std::string& name) {
+                      return HasChanged(docs_map, previous_docs_map, name);
+                    });
+
+    if (is_changed) {
+      Parse(id, docs_map);
+    } else {
+      user_configs_[id] = previous.user_configs_[id];
+      dependencies_[id] = dependencies;
+    }
+  }
+}
+
+void SnapshotData::Parse(ConfigId id, const DocsMap& docs_map) {
+  auto dependencies = std::make_shared<std::vector<std::string>>();
+  docs_map.SetAccessedNamesRecorder(dependencies.get(),
+                                    utils::impl::InternalTag{});
+  const utils::FastScopeGuard recorder_guard([&docs_map]() noexcept {
+    docs_map.SetAccessedNamesRecorder(nullptr, utils::impl::InternalTag{});
+  });
+
+  try {
+    user_configs_[id] = Registry()[id].factory(docs_map);
+  } catch (const std::exception& ex) {
+    throw ConfigParseError(
+        fmt::format("{} while parsing dynamic config values. {}",
+                    compiler::GetTypeName(typeid(ex)), ex.what()));
   }
+  dependencies_[id] = std::move(dependencies);
 }
 
 bool SnapshotData::IsEmpty() const noexcept { return user_configs_.empty(); }
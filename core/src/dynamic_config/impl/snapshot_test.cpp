@@ -0,0 +1,83 @@
+#include <userver/dynamic_config/impl/snapshot.hpp>
+
+#include <userver/dynamic_config/snapshot.hpp>
+#include <userver/dynamic_config/storage_mock.hpp>
+#include <userver/dynamic_config/value.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using dynamic_config::impl::ConfigIdGetter;
+using dynamic_config::impl::SnapshotData;
+
+std::size_t first_parse_count = 0;
+std::size_t second_parse_count = 0;
+
+int ParseFirst(const formats::json::Value& value) {
+  ++first_parse_count;
+  return value.As<int>();
+}
+
+int ParseSecond(const formats::json::Value& value) {
+  ++second_parse_count;
+  return value.As<int>();
+}
+
+const dynamic_config::Key<int> kFirstConfig{
+    "SNAPSHOT_DATA_TEST_FIRST", &ParseFirst,
+    dynamic_config::DefaultAsJsonString{"1"}};
+
+const dynamic_config::Key<int> kSecondConfig{
+    "SNAPSHOT_DATA_TEST_SECOND", &ParseSecond,
+    dynamic_config::DefaultAsJsonString{"2"}};
+
+template <typename VariableType>
+const VariableType& Get(const SnapshotData& data,
+                        const dynamic_config::Key<VariableType>& key) {
+  return data.Get<VariableType>(ConfigIdGetter::Get(key));
+}
+
+}  // namespace
+
+UTEST(DynamicConfigSnapshotData, ParsesOnlyChangedConfigs) {
+  const auto docs_map = dynamic_config::impl::MakeDefaultDocsMap();
+  const SnapshotData first{docs_map, {}};
+  EXPECT_EQ(Get(first, kFirstConfig), 1);
+  EXPECT_EQ(Get(first, kSecondConfig), 2);
+
+  const auto first_parsed = first_parse_count;
+  const auto second_parsed = second_parse_count;
+
+  auto changed_docs_map = docs_map;
+  changed_docs_map.Set("SNAPSHOT_DATA_TEST_SECOND",
+                       formats::json::ValueBuilder{3}.ExtractValue());
+  const SnapshotData second{changed_docs_map, docs_map, first};
+
+  EXPECT_EQ(Get(second, kFirstConfig), 1);
+  EXPECT_EQ(Get(second, kSecondConfig), 3);
+  EXPECT_EQ(first_parse_count, first_parsed);
+  EXPECT_EQ(second_parse_count, second_parsed + 1);
+
+  // Equal values from different documents are not parsed again
+  auto equal_docs_map = changed_docs_map;
+  equal_docs_map.Set("SNAPSHOT_DATA_TEST_SECOND",
+                     formats::json::ValueBuilder{3}.ExtractValue());
+  const SnapshotData third{equal_docs_map, changed_docs_map, second};
+
+  EXPECT_EQ(Get(third, kSecondConfig), 3);
+  EXPECT_EQ(second_parse_count, second_parsed + 1);
+}
+
+UTEST(DynamicConfigSnapshotData, ParsesAllWithoutPrevious) {
+  const auto docs_map = dynamic_config::impl::MakeDefaultDocsMap();
+  const auto first_parsed = first_parse_count;
+
+  const SnapshotData data{docs_map, docs_map, SnapshotData{}};
+  EXPECT_EQ(Get(data, kFirstConfig), 1);
+  EXPECT_EQ(first_parse_count, first_parsed + 1);
+}
+
+USERVER_NAMESPACE_END
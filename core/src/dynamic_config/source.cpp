@@ -12,6 +12,10 @@ Source::Source(impl::StorageData& storage) : storage_(&storage) {}
 
 Snapshot Source::GetSnapshot() const { return Snapshot{*storage_}; }
 
+std::uint64_t Source::GetVersion() const noexcept {
+  return storage_->GetVersion();
+}
+
 Source::SnapshotEventSource& Source::GetEventChannel() {
   return storage_->GetChannel();
 }
@@ -86,6 +86,8 @@ class DynamicConfig::Impl final {
   engine::TaskProcessor* fs_task_processor_;
 
   dynamic_config::impl::StorageData cache_;
+  // The source of the current cache_ value, to only parse the changed configs
+  dynamic_config::DocsMap cache_docs_map_;
   std::string fs_loading_error_msg_;
   dynamic_config::DocsMap fallback_config_;
 
@@ -180,7 +182,9 @@ void DynamicConfig::Impl::NotifyLoadingFailed(std::string_view updater,
 dynamic_config::impl::SnapshotData DynamicConfig::Impl::ParseConfig(
     const dynamic_config::DocsMap& value) {
   try {
-    dynamic_config::impl::SnapshotData config(value, {});
+    const auto previous = cache_.Read();
+    dynamic_config::impl::SnapshotData config(value, cache_docs_map_,
+                                              *previous);
     stats_.was_last_parse_successful = true;
     alert_storage_.StopAlertNow("config_parse_error");
     return config;
@@ -211,6 +215,7 @@ void DynamicConfig::Impl::DoSetConfig(const dynamic_config::DocsMap& value) {
     loaded_cv_.NotifyAll();
   };
   cache_.Update(std::move(config), std::move(after_assign_hook));
+  cache_docs_map_ = value;
 }
 
 void DynamicConfig::Impl::SetConfig(std::string_view updater,
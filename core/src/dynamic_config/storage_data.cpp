@@ -43,6 +43,7 @@ void StorageData::Update(SnapshotData config,
   }
 
   config_.Assign(std::move(config));
+  version_.fetch_add(1, std::memory_order_release);
   after_assign_hook();
 
   const Diff diff{std::move(previous_config), GetSnapshot()};
@@ -50,6 +51,10 @@ void StorageData::Update(SnapshotData config,
   snapshot_channel_.SendEvent(GetSnapshot());
 }
 
+std::uint64_t StorageData::GetVersion() const noexcept {
+  return version_.load(std::memory_order_acquire);
+}
+
 StorageData::SnapshotChannel& StorageData::GetChannel() {
   return snapshot_channel_;
 }
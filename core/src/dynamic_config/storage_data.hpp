@@ -1,5 +1,8 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+
 #include <userver/concurrent/async_event_channel.hpp>
 #include <userver/dynamic_config/impl/snapshot.hpp>
 #include <userver/dynamic_config/snapshot.hpp>
@@ -24,6 +27,8 @@ class StorageData final {
 
   void Update(SnapshotData config, AfterAssignHook after_assign_hook);
 
+  std::uint64_t GetVersion() const noexcept;
+
   SnapshotChannel& GetChannel();
 
   concurrent::AsyncEventSubscriberScope DoUpdateAndListen(
@@ -38,6 +43,7 @@ class StorageData final {
   Snapshot GetSnapshot() { return Snapshot{*this}; }
 
   rcu::Variable<SnapshotData> config_;
+  std::atomic<std::uint64_t> version_{0};
   SnapshotChannel snapshot_channel_;
   DiffChannel diff_channel_;
 
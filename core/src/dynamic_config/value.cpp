@@ -12,6 +12,7 @@ USERVER_NAMESPACE_BEGIN
 namespace dynamic_config {
 
 formats::json::Value DocsMap::Get(std::string_view name) const {
+  RecordAccess(name);
   const auto it = utils::impl::FindTransparent(docs_, name);
   if (it == docs_.end()) {
     throw std::runtime_error(fmt::format("Can't find doc for '{}'", name));
@@ -27,6 +28,7 @@ formats::json::Value DocsMap::Get(std::string_view name) const {
 }
 
 bool DocsMap::Has(std::string_view name) const {
+  RecordAccess(name);
   return utils::impl::FindTransparent(docs_, name) != docs_.end();
 }
 
@@ -92,6 +94,15 @@ DocsMap::GetConfigsExpectedToBeUsed(utils::impl::InternalTag) const {
   return configs_to_be_used_;
 }
 
+void DocsMap::SetAccessedNamesRecorder(
+    std::vector<std::string>* accessed_names, utils::impl::InternalTag) const {
+  accessed_names_ = accessed_names;
+}
+
+void DocsMap::RecordAccess(std::string_view name) const {
+  if (accessed_names_) accessed_names_->emplace_back(name);
+}
+
 }  // namespace dynamic_config
 
 USERVER_NAMESPACE_END
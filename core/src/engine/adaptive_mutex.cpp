@@ -0,0 +1,153 @@
+#include <userver/engine/adaptive_mutex.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+#include <compiler/relax_cpu.hpp>
+#include <engine/impl/mutex_impl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+// A spin iteration takes from a few to a hundred of nanoseconds depending on
+// the CPU, while putting a task to sleep and waking it up takes microseconds.
+constexpr std::size_t kMinSpinBudget = 16;
+constexpr std::size_t kMaxSpinBudget = 1024;
+constexpr std::size_t kInitialSpinBudget = 128;
+
+}  // namespace
+
+class AdaptiveMutex::Impl final {
+ public:
+  explicit Impl(MutexStatisticsMode statistics_mode)
+      : is_statistics_enabled_(statistics_mode ==
+                               MutexStatisticsMode::kEnabled) {}
+
+  void unlock() { mutex_.unlock(); }
+
+  bool try_lock() {
+    const bool result = mutex_.try_lock();
+    if (result) AccountAcquisition();
+    return result;
+  }
+
+  bool try_lock_until(Deadline deadline) {
+    if (mutex_.try_lock()) {
+      AccountAcquisition();
+      return true;
+    }
+
+    const auto wait_start = is_statistics_enabled_
+                                ? std::chrono::steady_clock::now()
+                                : std::chrono::steady_clock::time_point{};
+
+    bool result = SpinLock();
+    const bool is_parked = !result;
+    if (is_parked) result = mutex_.try_lock_until(deadline);
+
+    if (is_statistics_enabled_) {
+      ++contended_acquisitions_;
+      if (is_parked) ++parked_acquisitions_;
+      if (result) ++acquisitions_;
+      const auto wait_time =
+          std::chrono::duration_cast<std::chrono::microseconds>(
+              std::chrono::steady_clock::now() - wait_start);
+      wait_us_ += utils::statistics::Rate{
+          static_cast<utils::statistics::Rate::ValueType>(wait_time.count())};
+    }
+    return result;
+  }
+
+  MutexStatistics GetStatistics() const noexcept {
+    return {acquisitions_.Load(), contended_acquisitions_.Load(),
+            parked_acquisitions_.Load(), wait_us_.Load()};
+  }
+
+ private:
+  void AccountAcquisition() noexcept {
+    if (is_statistics_enabled_) ++acquisitions_;
+  }
+
+  bool SpinLock() {
+    const auto budget = spin_budget_.load(std::memory_order_relaxed);
+    compiler::RelaxCpu relax;
+
+    for (std::size_t i = 0; i < budget; ++i) {
+      // The sleeping tasks will get the mutex first, the critical section is
+      // likely too long for spinning
+      if (mutex_.HasWaitersRelaxed()) return false;
+
+      relax();
+      if (!mutex_.IsLockedRelaxed() && mutex_.try_lock()) {
+        // Keep the budget about twice as long as the typical wait
+        UpdateSpinBudget(budget, (i + 1) * 2);
+        return true;
+      }
+    }
+
+    UpdateSpinBudget(budget, 0);
+    return false;
+  }
+
+  // Updated with plain stores, concurrent updates may be lost, which is fine
+  // for a heuristic
+  void UpdateSpinBudget(std::size_t budget, std::size_t target) noexcept {
+    spin_budget_.store(
+        std::clamp((budget * 3 + target) / 4, kMinSpinBudget, kMaxSpinBudget),
+        std::memory_order_relaxed);
+  }
+
+  impl::MutexImpl<impl::WaitList> mutex_;
+  std::atomic<std::size_t> spin_budget_{kInitialSpinBudget};
+  const bool is_statistics_enabled_;
+
+  utils::statistics::RateCounter acquisitions_;
+  utils::statistics::RateCounter contended_acquisitions_;
+  utils::statistics::RateCounter parked_acquisitions_;
+  utils::statistics::RateCounter wait_us_;
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const MutexStatistics& stats) {
+  writer["acquisitions"] = stats.acquisitions;
+  writer["contended_acquisitions"] = stats.contended_acquisitions;
+  writer["parked_acquisitions"] = stats.parked_acquisitions;
+  writer["wait_us"] = stats.wait_us;
+}
+
+AdaptiveMutex::AdaptiveMutex()
+    : AdaptiveMutex(MutexStatisticsMode::kDisabled) {}
+
+AdaptiveMutex::AdaptiveMutex(MutexStatisticsMode statistics_mode)
+    : impl_(statistics_mode) {}
+
+AdaptiveMutex::~AdaptiveMutex() = default;
+
+void AdaptiveMutex::lock() {
+  [[maybe_unused]] const bool result = impl_->try_lock_until(Deadline{});
+  UASSERT(result);
+}
+
+void AdaptiveMutex::unlock() { impl_->unlock(); }
+
+bool AdaptiveMutex::try_lock() noexcept { return impl_->try_lock(); }
+
+bool AdaptiveMutex::try_lock_until(Deadline deadline) {
+  return impl_->try_lock_until(deadline);
+}
+
+MutexStatistics AdaptiveMutex::GetStatistics() const noexcept {
+  return impl_->GetStatistics();
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,103 @@
+#include <userver/engine/adaptive_mutex.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(AdaptiveMutex, StatisticsDisabled) {
+  engine::AdaptiveMutex mutex;
+  {
+    const std::lock_guard lock(mutex);
+  }
+
+  const auto stats = mutex.GetStatistics();
+  EXPECT_EQ(stats.acquisitions.value, 0);
+  EXPECT_EQ(stats.contended_acquisitions.value, 0);
+}
+
+UTEST(AdaptiveMutex, Statistics) {
+  engine::AdaptiveMutex mutex{engine::MutexStatisticsMode::kEnabled};
+  {
+    const std::lock_guard lock(mutex);
+  }
+  EXPECT_TRUE(mutex.try_lock());
+  EXPECT_FALSE(engine::AsyncNoSpan([&mutex] {
+                 return mutex.try_lock_for(std::chrono::milliseconds{1});
+               }).Get());
+  mutex.unlock();
+
+  auto stats = mutex.GetStatistics();
+  EXPECT_EQ(stats.acquisitions.value, 2);
+  EXPECT_EQ(stats.contended_acquisitions.value, 1);
+  EXPECT_EQ(stats.parked_acquisitions.value, 1);
+  EXPECT_GE(stats.wait_us.value, 1000);
+
+  // The owner sleeps for longer than the spinning lasts
+  std::unique_lock lock(mutex);
+  auto task =
+      engine::AsyncNoSpan([&mutex] { const std::lock_guard lock(mutex); });
+  engine::SleepFor(std::chrono::milliseconds{10});
+  lock.unlock();
+  task.Get();
+
+  stats = mutex.GetStatistics();
+  EXPECT_EQ(stats.acquisitions.value, 4);
+  EXPECT_EQ(stats.contended_acquisitions.value, 2);
+  EXPECT_EQ(stats.parked_acquisitions.value, 2);
+}
+
+UTEST_MT(AdaptiveMutex, Contention, 4) {
+  constexpr std::size_t kTasks = 4;
+  constexpr std::size_t kIterations = 10000;
+
+  engine::AdaptiveMutex mutex{engine::MutexStatisticsMode::kEnabled};
+  std::size_t counter = 0;
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(kTasks);
+  for (std::size_t i = 0; i < kTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&mutex, &counter] {
+      for (std::size_t j = 0; j < kIterations; ++j) {
+        const std::lock_guard lock(mutex);
+        ++counter;
+      }
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+
+  EXPECT_EQ(counter, kTasks * kIterations);
+  const auto stats = mutex.GetStatistics();
+  EXPECT_EQ(stats.acquisitions.value, kTasks * kIterations);
+  EXPECT_LE(stats.parked_acquisitions.value,
+            stats.contended_acquisitions.value);
+}
+
+UTEST(AdaptiveMutex, StatisticsStorage) {
+  utils::statistics::Storage storage;
+  engine::AdaptiveMutex mutex{engine::MutexStatisticsMode::kEnabled};
+  {
+    const std::lock_guard lock(mutex);
+  }
+
+  const auto holder = storage.RegisterWriter(
+      "mutex", [&mutex](utils::statistics::Writer& writer) {
+        writer = mutex.GetStatistics();
+      });
+
+  const utils::statistics::Snapshot snapshot{storage, "mutex"};
+  EXPECT_EQ(snapshot.SingleMetric("acquisitions").AsRate().value, 1)
+      << testing::PrintToString(snapshot);
+  EXPECT_EQ(snapshot.SingleMetric("contended_acquisitions").AsRate().value, 0);
+  EXPECT_EQ(snapshot.SingleMetric("parked_acquisitions").AsRate().value, 0);
+  EXPECT_EQ(snapshot.SingleMetric("wait_us").AsRate().value, 0);
+}
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,7 @@
 #include <userver/engine/condition_variable.hpp>
 
 #include <atomic>
+#include <vector>
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/sleep.hpp>
@@ -84,6 +85,37 @@ UTEST_MT(ConditionVariable, SatisfyMultiple, 10) {
   for (auto& task : tasks) task.Get();
 }
 
+UTEST_MT(ConditionVariable, NotifyAllWakesUpEveryone, 4) {
+  // More than fits in a single batch of wakeups
+  constexpr std::size_t kWaiters = 200;
+  engine::Mutex mutex;
+  engine::ConditionVariable cv;
+  std::size_t waiting = 0;
+  bool ok = false;
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(kWaiters);
+  for (std::size_t i = 0; i < kWaiters; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&] {
+      std::unique_lock<engine::Mutex> lock(mutex);
+      ++waiting;
+      EXPECT_TRUE(cv.Wait(lock, [&ok] { return ok; }));
+    }));
+  }
+
+  std::unique_lock<engine::Mutex> lock(mutex);
+  while (waiting != kWaiters) {
+    lock.unlock();
+    engine::Yield();
+    lock.lock();
+  }
+  ok = true;
+  cv.NotifyAll();
+  lock.unlock();
+
+  for (auto& task : tasks) task.Get();
+}
+
 UTEST(ConditionVariable, WaitStatus) {
   engine::Mutex mutex;
   engine::ConditionVariable cv;
@@ -0,0 +1,151 @@
+#include <engine/coro/growable_stack.hpp>
+
+#include <sys/mman.h>
+#include <cerrno>
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+#include <engine/coro/stack_usage_monitor.hpp>
+#include <engine/task/task_context.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/strerror.hpp>
+#include <utils/sys_info.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::coro {
+
+namespace {
+
+constexpr std::uint64_t kMagic = 0x6b63617453776f72ULL;   // "rowStack"
+constexpr std::uint64_t kCanary = 0x7972616e61436b53ULL;  // "SkCanary"
+
+const auto kPageSize = utils::sys_info::GetPageSize();
+
+// Lives at the very top of every growable stack, above the coroutine control
+// block
+struct Header final {
+  std::uint64_t magic;
+  // Without the guard page
+  std::size_t stack_size;
+  std::size_t initial_size;
+  // Counted from the top of the stack
+  std::size_t canary_depth;
+  bool trim;
+  bool grown;
+  std::atomic<std::size_t>* pool_committed_bytes;
+};
+
+// Keeps the stack pointer 64-byte aligned, as boost expects
+constexpr std::size_t kHeaderSize = 64;
+static_assert(sizeof(Header) <= kHeaderSize);
+
+std::uintptr_t RoundUpToPageSize(std::uintptr_t address) noexcept {
+  return (address + kPageSize - 1) & ~(kPageSize - 1);
+}
+
+std::uintptr_t GetStackTop(const void* cb_ptr) noexcept {
+  return RoundUpToPageSize(reinterpret_cast<std::uintptr_t>(cb_ptr));
+}
+
+volatile std::uint64_t& GetCanary(std::uintptr_t stack_top,
+                                  const Header& header) noexcept {
+  return *reinterpret_cast<volatile std::uint64_t*>(stack_top -
+                                                    header.canary_depth);
+}
+
+}  // namespace
+
+GrowableStackAllocator::GrowableStackAllocator(
+    std::size_t stack_size, std::size_t initial_size,
+    std::size_t trim_threshold,
+    std::atomic<std::size_t>& committed_bytes) noexcept
+    : stack_size_(stack_size),
+      initial_size_(initial_size),
+      trim_threshold_(trim_threshold),
+      committed_bytes_(&committed_bytes) {
+  UASSERT(stack_size_ % kPageSize == 0);
+  UASSERT(initial_size_ % kPageSize == 0);
+  UASSERT(kHeaderSize < initial_size_ && initial_size_ <= stack_size_);
+}
+
+boost::context::stack_context GrowableStackAllocator::allocate() {
+  // One page at the bottom is the guard page
+  const auto mapping_size = stack_size_ + kPageSize;
+  void* vp = ::mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  if (vp == MAP_FAILED) throw std::bad_alloc();
+
+  if (::mprotect(vp, kPageSize, PROT_NONE) == -1) {
+    ::munmap(vp, mapping_size);
+    throw std::bad_alloc();
+  }
+
+  auto* const top = static_cast<char*>(vp) + mapping_size;
+  const auto canary_depth =
+      std::min(stack_size_, std::max(initial_size_, trim_threshold_));
+  auto* const header = new (top - kHeaderSize)
+      Header{kMagic, stack_size_, initial_size_, canary_depth,
+             /*trim=*/trim_threshold_ != 0, /*grown=*/false,
+             committed_bytes_};
+  GetCanary(reinterpret_cast<std::uintptr_t>(top), *header) = kCanary;
+  committed_bytes_->fetch_add(initial_size_, std::memory_order_relaxed);
+
+  boost::context::stack_context sctx;
+  sctx.size = mapping_size - kHeaderSize;
+  sctx.sp = top - kHeaderSize;
+  return sctx;
+}
+
+void GrowableStackAllocator::deallocate(
+    boost::context::stack_context& sctx) noexcept {
+  UASSERT(sctx.sp);
+  auto* const header = static_cast<Header*>(sctx.sp);
+  UASSERT(header->magic == kMagic);
+  committed_bytes_->fetch_sub(
+      header->grown ? header->stack_size : header->initial_size,
+      std::memory_order_relaxed);
+  header->~Header();
+
+  auto* const top = static_cast<char*>(sctx.sp) + kHeaderSize;
+  const auto mapping_size = sctx.size + kHeaderSize;
+  ::munmap(top - mapping_size, mapping_size);
+}
+
+std::size_t GrowableStackAllocator::Trim(
+    const boost::coroutines2::coroutine<impl::TaskContext*>::push_type&
+        coro) noexcept {
+  const auto top = GetStackTop(GetCoroCbPtr(coro));
+  auto* const header = reinterpret_cast<Header*>(top - kHeaderSize);
+  UASSERT(header->magic == kMagic);
+
+  if (!header->grown) {
+    if (GetCanary(top, *header) == kCanary) return 0;
+    header->grown = true;
+    header->pool_committed_bytes->fetch_add(
+        header->stack_size - header->initial_size, std::memory_order_relaxed);
+  }
+  if (!header->trim) return 0;
+
+  // A coroutine in the pool is suspended at the top of its stack, the memory
+  // below the initial size holds nothing of value
+  const auto released = header->stack_size - header->initial_size;
+  if (::madvise(reinterpret_cast<void*>(top - header->stack_size), released,
+                MADV_DONTNEED) == -1) {
+    LOG_LIMITED_WARNING() << "Failed to trim a coroutine stack: "
+                          << utils::strerror(errno);
+    return 0;
+  }
+
+  GetCanary(top, *header) = kCanary;
+  header->grown = false;
+  header->pool_committed_bytes->fetch_sub(released, std::memory_order_relaxed);
+  return released;
+}
+
+}  // namespace engine::coro
+
+USERVER_NAMESPACE_END
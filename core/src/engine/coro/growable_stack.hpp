@@ -0,0 +1,63 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+#include <coroutines/coroutine.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+class TaskContext;
+}  // namespace engine::impl
+
+namespace engine::coro {
+
+// A stack allocator for boost::coroutines2 that reserves `stack_size` bytes of
+// address space with MAP_NORESERVE and returns the pages of the stacks that
+// have grown deep to the kernel when they are back in the pool.
+//
+// The whole stack is readable and writable, and the kernel commits the pages
+// on the first touch, be it by the coroutine itself or by a syscall writing
+// into a buffer on the stack. Only the guard page at the bottom is
+// inaccessible. MAP_NORESERVE keeps the untouched part of the stacks out of
+// the commit charge, unless the overcommit is disabled
+// (vm.overcommit_memory=2).
+//
+// A stack is considered grown when the canary word at the depth of
+// max(initial_size, trim_threshold) is overwritten. The committed bytes are
+// an estimate: `initial_size` for a stack that has not grown and `stack_size`
+// for a grown one. A deep frame that skips the canary word goes unnoticed
+// until some later frame overwrites it.
+//
+// The memory layout is the same as for protected_fixedsize_stack: the stack
+// begins at the end of the mapping and the lowest page is the guard page, so
+// StackUsageMonitor works for both of them.
+class GrowableStackAllocator final {
+ public:
+  // `committed_bytes` accounts the estimated committed bytes of all the stacks
+  // and must outlive them. `trim_threshold` of 0 disables the trimming.
+  GrowableStackAllocator(std::size_t stack_size, std::size_t initial_size,
+                         std::size_t trim_threshold,
+                         std::atomic<std::size_t>& committed_bytes) noexcept;
+
+  boost::context::stack_context allocate();
+  void deallocate(boost::context::stack_context& sctx) noexcept;
+
+  // Accounts the growth of the stack of `coro` and shrinks it back to the
+  // initial size, if it has grown past the trim threshold. Must not be called
+  // for a running coroutine. Returns the number of released bytes.
+  static std::size_t Trim(
+      const boost::coroutines2::coroutine<impl::TaskContext*>::push_type&
+          coro) noexcept;
+
+ private:
+  std::size_t stack_size_;
+  std::size_t initial_size_;
+  std::size_t trim_threshold_;
+  std::atomic<std::size_t>* committed_bytes_;
+};
+
+}  // namespace engine::coro
+
+USERVER_NAMESPACE_END
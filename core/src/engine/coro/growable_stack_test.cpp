@@ -0,0 +1,151 @@
+#include <engine/coro/growable_stack.hpp>
+
+#include <unistd.h>
+
+#include <array>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <engine/coro/pool_config.hpp>
+#include <engine/ev/thread_pool_config.hpp>
+#include <engine/impl/standalone.hpp>
+#include <engine/task/task_processor_pools.hpp>
+#include <userver/engine/task/task.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kStackSize = 2 * 1024 * 1024ULL;
+constexpr std::size_t kInitialStackSize = 32 * 1024ULL;
+constexpr std::size_t kTrimThreshold = 256 * 1024ULL;
+constexpr std::size_t kFrameSize = 4096;
+
+std::shared_ptr<engine::impl::TaskProcessorPools> MakeGrowablePools(
+    std::size_t trim_threshold = kTrimThreshold) {
+  engine::coro::PoolConfig coro_config;
+  coro_config.initial_size = 2;
+  coro_config.max_size = 4;
+  coro_config.stack_size = kStackSize;
+  coro_config.stack_mode = engine::coro::StackMode::kGrowable;
+  coro_config.initial_stack_size = kInitialStackSize;
+  coro_config.stack_trim_threshold = trim_threshold;
+
+  engine::ev::ThreadPoolConfig ev_config;
+  ev_config.threads = 1;
+
+  return std::make_shared<engine::impl::TaskProcessorPools>(
+      std::move(coro_config), std::move(ev_config));
+}
+
+__attribute__((noinline)) std::size_t UseStack(std::size_t depth) {
+  std::array<volatile unsigned char, kFrameSize> frame{};
+  frame.front() = 1;
+  frame.back() = 1;
+  if (depth == 0) return frame.front();
+  return frame.back() + UseStack(depth - 1);
+}
+
+// Larger than the initial stack, so the kernel writes into the stack pages
+// that were never touched by the coroutine itself
+constexpr std::size_t kReadSize = kInitialStackSize + 16 * 1024;
+
+__attribute__((noinline)) std::size_t ReadIntoStack(int fd) {
+  std::array<char, kReadSize> buffer;
+  std::size_t total = 0;
+  while (total < buffer.size()) {
+    const auto res = ::read(fd, buffer.data() + total, buffer.size() - total);
+    if (res <= 0) break;
+    total += res;
+  }
+  EXPECT_EQ(buffer.front(), 'x');
+  EXPECT_EQ(buffer.back(), 'x');
+  return total;
+}
+
+#if defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define SKIP_UNDER_ASAN() \
+  GTEST_SKIP() << "ASAN fake stacks do not use the coroutine stack"
+#endif
+#endif
+#ifndef SKIP_UNDER_ASAN
+#define SKIP_UNDER_ASAN()
+#endif
+
+}  // namespace
+
+TEST(GrowableStack, GrowsOnDemandAndTrims) {
+  SKIP_UNDER_ASAN();
+
+  const auto pools = MakeGrowablePools();
+  auto& coro_pool = pools->GetCoroPool();
+
+  auto stats = coro_pool.GetStats();
+  EXPECT_EQ(stats.stack_reserved_bytes, stats.total_coroutines * kStackSize);
+  EXPECT_EQ(stats.stack_committed_bytes,
+            stats.total_coroutines * kInitialStackSize);
+
+  auto task_processor =
+      engine::impl::TaskProcessorHolder::Make(1, "growable", pools);
+  engine::impl::RunOnTaskProcessorSync(*task_processor, [&] {
+    EXPECT_EQ(engine::current_task::GetStackSize(), kStackSize);
+
+    // About a half of the stack
+    constexpr std::size_t kDepth = kStackSize / 2 / kFrameSize;
+    EXPECT_GT(UseStack(kDepth), kDepth);
+  });
+
+  // The stack of the previous task is trimmed on return to the pool
+  engine::impl::RunOnTaskProcessorSync(*task_processor, [&] {
+    stats = coro_pool.GetStats();
+    EXPECT_EQ(stats.stack_committed_bytes,
+              stats.total_coroutines * kInitialStackSize);
+  });
+}
+
+TEST(GrowableStack, AccountsGrowthWithoutTrimming) {
+  SKIP_UNDER_ASAN();
+
+  const auto pools = MakeGrowablePools(/*trim_threshold=*/0);
+  auto& coro_pool = pools->GetCoroPool();
+
+  auto task_processor =
+      engine::impl::TaskProcessorHolder::Make(1, "growable", pools);
+  engine::impl::RunOnTaskProcessorSync(*task_processor, [&] {
+    constexpr std::size_t kDepth = kStackSize / 2 / kFrameSize;
+    EXPECT_GT(UseStack(kDepth), kDepth);
+  });
+
+  // The grown stack is accounted as a whole on return to the pool
+  engine::impl::RunOnTaskProcessorSync(*task_processor, [&] {
+    const auto stats = coro_pool.GetStats();
+    EXPECT_EQ(stats.stack_committed_bytes,
+              stats.total_coroutines * kInitialStackSize + kStackSize -
+                  kInitialStackSize);
+  });
+}
+
+TEST(GrowableStack, SyscallWritesBelowInitialSize) {
+  SKIP_UNDER_ASAN();
+
+  std::array<int, 2> fds{};
+  ASSERT_EQ(::pipe(fds.data()), 0);
+  std::array<char, kReadSize> data;
+  data.fill('x');
+  // Fits into the default pipe buffer of 64KiB
+  ASSERT_EQ(::write(fds[1], data.data(), data.size()),
+            static_cast<ssize_t>(data.size()));
+  ::close(fds[1]);
+
+  const auto pools = MakeGrowablePools();
+  auto task_processor =
+      engine::impl::TaskProcessorHolder::Make(1, "growable", pools);
+  engine::impl::RunOnTaskProcessorSync(*task_processor, [&] {
+    EXPECT_EQ(ReadIntoStack(fds[0]), kReadSize);
+  });
+  ::close(fds[0]);
+}
+
+USERVER_NAMESPACE_END
@@ -7,20 +7,38 @@
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <utils/numa.hpp>
 #include <utils/sys_info.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::coro {
 
+namespace {
+
+struct CoroutineMover {
+  std::optional<Pool::Coroutine>& result;
+
+  CoroutineMover& operator=(Pool::Coroutine&& coro) {
+    result.emplace(std::move(coro));
+    return *this;
+  }
+};
+
+}  // namespace
+
 Pool::Pool(PoolConfig config, Executor executor)
     : config_(FixupConfig(std::move(config))),
       executor_(executor),
       local_coroutine_move_size_((config_.local_cache_size + 1) / 2),
       stack_allocator_(config_.stack_size),
+      growable_stack_allocator_(config_.stack_size, config_.initial_stack_size,
+                                config_.stack_trim_threshold,
+                                committed_stack_bytes_),
       stack_usage_monitor_(config_.stack_size),
       initial_coroutines_(config_.initial_size),
-      used_coroutines_(config_.max_size),
+      used_coroutines_(utils::numa::GetTopology().size(),
+                       config_.max_size / utils::numa::GetTopology().size()),
       idle_coroutines_num_(config_.initial_size),
       total_coroutines_num_(0) {
   UASSERT(local_coroutine_move_size_ <= config_.local_cache_size);
@@ -38,14 +56,6 @@ Pool::Pool(PoolConfig config, Executor executor)
 Pool::~Pool() = default;
 
 typename Pool::CoroutinePtr Pool::GetCoroutine() {
-  struct CoroutineMover {
-    std::optional<Coroutine>& result;
-
-    CoroutineMover& operator=(Coroutine&& coro) {
-      result.emplace(std::move(coro));
-      return *this;
-    }
-  };
   std::optional<Coroutine> coroutine;
   CoroutineMover mover{coroutine};
 
@@ -55,7 +65,8 @@ typename Pool::CoroutinePtr Pool::GetCoroutine() {
   if (!local_coro_buffer_.empty() || TryPopulateLocalCache()) {
     coroutine = std::move(local_coro_buffer_.back());
     local_coro_buffer_.pop_back();
-  } else if (initial_coroutines_.try_dequeue(mover)) {
+  } else if (initial_coroutines_.try_dequeue(mover) ||
+             TryStealFromOtherNodes(coroutine)) {
     --idle_coroutines_num_;
   } else {
     coroutine.emplace(CreateCoroutine());
@@ -65,11 +76,16 @@ typename Pool::CoroutinePtr Pool::GetCoroutine() {
 }
 
 void Pool::PutCoroutine(CoroutinePtr&& coroutine_ptr) {
+  if (config_.stack_mode == StackMode::kGrowable) {
+    GrowableStackAllocator::Trim(coroutine_ptr.Get());
+  }
+
   if (config_.local_cache_size == 0) {
     const bool ok =
         // We only ever return coroutines into our 'working set'.
-        used_coroutines_.enqueue(GetUsedPoolToken<moodycamel::ProducerToken>(),
-                                 std::move(coroutine_ptr.Get()));
+        GetLocalNodeUsedCoroutines().enqueue(
+            GetUsedPoolToken<moodycamel::ProducerToken>(),
+            std::move(coroutine_ptr.Get()));
     if (ok) {
       ++idle_coroutines_num_;
     }
@@ -85,13 +101,19 @@ void Pool::PutCoroutine(CoroutinePtr&& coroutine_ptr) {
 
 PoolStats Pool::GetStats() const {
   PoolStats stats;
-  stats.active_coroutines =
-      total_coroutines_num_.load() -
-      (used_coroutines_.size_approx() + initial_coroutines_.size_approx());
+  std::size_t idle_coroutines = initial_coroutines_.size_approx();
+  for (const auto& node_coroutines : used_coroutines_) {
+    idle_coroutines += node_coroutines.size_approx();
+  }
+  stats.active_coroutines = total_coroutines_num_.load() - idle_coroutines;
   stats.total_coroutines =
       std::max(total_coroutines_num_.load(), stats.active_coroutines);
   stats.max_stack_usage_pct = stack_usage_monitor_.GetMaxStackUsagePct();
   stats.is_stack_usage_monitor_active = stack_usage_monitor_.IsActive();
+  stats.stack_reserved_bytes = stats.total_coroutines * config_.stack_size;
+  stats.stack_committed_bytes = config_.stack_mode == StackMode::kGrowable
+                                    ? committed_stack_bytes_.load()
+                                    : stats.stack_reserved_bytes;
   return stats;
 }
 
@@ -108,7 +130,7 @@ void Pool::ClearLocalCache() {
         std::min(config_.max_size - current_idle_coroutines_num,
                  local_coro_buffer_.size());
 
-    const bool ok = used_coroutines_.enqueue_bulk(
+    const bool ok = GetLocalNodeUsedCoroutines().enqueue_bulk(
         GetUsedPoolToken<moodycamel::ProducerToken>(),
         std::make_move_iterator(local_coro_buffer_.begin()),
         return_to_pool_from_local_cache_num);
@@ -126,7 +148,7 @@ void Pool::ClearLocalCache() {
 
 Pool::Coroutine Pool::CreateCoroutine(bool quiet) {
   try {
-    Coroutine coroutine(stack_allocator_, executor_);
+    Coroutine coroutine = CreateCoroutineWithStack();
     const auto new_total = ++total_coroutines_num_;
     if (!quiet) {
       LOG_DEBUG() << "Created a coroutine #" << new_total << '/'
@@ -153,12 +175,27 @@ Pool::Coroutine Pool::CreateCoroutine(bool quiet) {
   }
 }
 
+Pool::Coroutine Pool::CreateCoroutineWithStack() {
+  if (config_.stack_mode == StackMode::kGrowable) {
+    return Coroutine(growable_stack_allocator_, executor_);
+  }
+  return Coroutine(stack_allocator_, executor_);
+}
+
 void Pool::OnCoroutineDestruction() noexcept { --total_coroutines_num_; }
 
+moodycamel::ConcurrentQueue<Pool::Coroutine>&
+Pool::GetLocalNodeUsedCoroutines() {
+  const auto node = utils::numa::GetCurrentThreadNode();
+  UASSERT(node < used_coroutines_.size());
+  return used_coroutines_[node];
+}
+
 bool Pool::TryPopulateLocalCache() {
   if (local_coroutine_move_size_ == 0) return false;
 
-  const std::size_t dequeued_num = used_coroutines_.try_dequeue_bulk(
+  auto& used_coroutines = GetLocalNodeUsedCoroutines();
+  const std::size_t dequeued_num = used_coroutines.try_dequeue_bulk(
       GetUsedPoolToken<moodycamel::ConsumerToken>(),
       std::back_inserter(local_coro_buffer_), local_coroutine_move_size_);
   if (dequeued_num == 0) return false;
@@ -167,6 +204,19 @@ bool Pool::TryPopulateLocalCache() {
   return true;
 }
 
+bool Pool::TryStealFromOtherNodes(std::optional<Coroutine>& coroutine) {
+  if (used_coroutines_.size() == 1) return false;
+
+  const auto local_node = utils::numa::GetCurrentThreadNode();
+  for (std::size_t i = 1; i < used_coroutines_.size(); ++i) {
+    auto& node_coroutines =
+        used_coroutines_[(local_node + i) % used_coroutines_.size()];
+    CoroutineMover mover{coroutine};
+    if (node_coroutines.try_dequeue(mover)) return true;
+  }
+  return false;
+}
+
 void Pool::DepopulateLocalCache() {
   const std::size_t current_idle_coroutines_num = idle_coroutines_num_.load();
   std::size_t return_to_pool_from_local_cache_num = 0;
@@ -176,7 +226,7 @@ void Pool::DepopulateLocalCache() {
         std::min(config_.max_size - current_idle_coroutines_num,
                  local_coroutine_move_size_);
 
-    const bool ok = used_coroutines_.enqueue_bulk(
+    const bool ok = GetLocalNodeUsedCoroutines().enqueue_bulk(
         GetUsedPoolToken<moodycamel::ProducerToken>(),
         std::make_move_iterator(local_coro_buffer_.end() -
                                 return_to_pool_from_local_cache_num),
@@ -201,6 +251,15 @@ PoolConfig Pool::FixupConfig(PoolConfig&& config) {
   const auto page_size = utils::sys_info::GetPageSize();
   config.stack_size = (config.stack_size + page_size - 1) & ~(page_size - 1);
 
+  // The coroutine control block and the frames of a coroutine waiting in
+  // the pool should fit into the initial stack of StackMode::kGrowable
+  constexpr std::size_t kMinInitialStackPages = 4;
+  config.initial_stack_size =
+      (config.initial_stack_size + page_size - 1) & ~(page_size - 1);
+  config.initial_stack_size = std::min(
+      std::max(config.initial_stack_size, kMinInitialStackPages * page_size),
+      config.stack_size);
+
   return std::move(config);
 }
 
@@ -210,7 +269,8 @@ void Pool::AccountStackUsage() { stack_usage_monitor_.AccountStackUsage(); }
 
 template <typename Token>
 Token& Pool::GetUsedPoolToken() {
-  thread_local Token token(used_coroutines_);
+  // The node of a thread does not change once it starts using the pool
+  thread_local Token token(GetLocalNodeUsedCoroutines());
   return token;
 }
 
@@ -1,10 +1,14 @@
 #pragma once
 
 #include <atomic>
+#include <optional>
 #include <vector>
 
 #include <moodycamel/concurrentqueue.h>
 
+#include <userver/utils/fixed_array.hpp>
+
+#include <engine/coro/growable_stack.hpp>
 #include <engine/coro/pool_config.hpp>
 #include <engine/coro/pool_stats.hpp>
 #include <engine/coro/stack_usage_monitor.hpp>
@@ -39,9 +43,12 @@ class Pool final {
   static PoolConfig FixupConfig(PoolConfig&& config);
 
   Coroutine CreateCoroutine(bool quiet = false);
+  Coroutine CreateCoroutineWithStack();
   void OnCoroutineDestruction() noexcept;
 
+  moodycamel::ConcurrentQueue<Coroutine>& GetLocalNodeUsedCoroutines();
   bool TryPopulateLocalCache();
+  bool TryStealFromOtherNodes(std::optional<Coroutine>& coroutine);
   void DepopulateLocalCache();
 
   template <typename Token>
@@ -65,6 +72,11 @@ class Pool final {
   // If you change the allocator, adjust the math there accordingly.
   static_assert(std::is_same_v<decltype(stack_allocator_),
                                boost::coroutines2::protected_fixedsize_stack>);
+  // Estimated committed bytes of the growable stacks, must outlive them
+  std::atomic<std::size_t> committed_stack_bytes_{0};
+  // Used instead of stack_allocator_ for StackMode::kGrowable, keeps the same
+  // memory layout.
+  GrowableStackAllocator growable_stack_allocator_;
   StackUsageMonitor stack_usage_monitor_;
 
   // We aim to reuse coroutines as much as possible,
@@ -74,7 +86,13 @@ class Pool final {
   // The same could've been achieved with some LIFO container, but apparently
   // we don't have a container handy enough to not just use 2 queues.
   moodycamel::ConcurrentQueue<Coroutine> initial_coroutines_;
-  moodycamel::ConcurrentQueue<Coroutine> used_coroutines_;
+  //
+  // Used coroutines are kept per NUMA node of the worker that released them
+  // (see utils::numa::GetCurrentThreadNode()): the stack pages are faulted in
+  // on the node of the worker that first touched them, so reusing the
+  // coroutine on the same node keeps the stack node-local. Coroutines of other
+  // nodes are taken only when there are neither local nor initial ones.
+  utils::FixedArray<moodycamel::ConcurrentQueue<Coroutine>> used_coroutines_;
 
   std::atomic<std::size_t> idle_coroutines_num_;
   std::atomic<std::size_t> total_coroutines_num_;
@@ -1,9 +1,22 @@
 #include "pool_config.hpp"
 
+#include <userver/utils/trivial_map.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::coro {
 
+StackMode Parse(const yaml_config::YamlConfig& value,
+                formats::parse::To<StackMode>) {
+  static constexpr utils::TrivialBiMap kMap([](auto selector) {
+    return selector()
+        .Case(StackMode::kFixed, "fixed")
+        .Case(StackMode::kGrowable, "growable");
+  });
+
+  return utils::ParseFromValueString(value, kMap);
+}
+
 PoolConfig Parse(const yaml_config::YamlConfig& value,
                  formats::parse::To<PoolConfig>) {
   PoolConfig config;
@@ -12,6 +25,11 @@ PoolConfig Parse(const yaml_config::YamlConfig& value,
   config.stack_size = value["stack_size"].As<size_t>(config.stack_size);
   config.local_cache_size =
       value["local_cache_size"].As<size_t>(config.local_cache_size);
+  config.stack_mode = value["stack_mode"].As<StackMode>(config.stack_mode);
+  config.initial_stack_size =
+      value["initial_stack_size"].As<size_t>(config.initial_stack_size);
+  config.stack_trim_threshold =
+      value["stack_trim_threshold"].As<size_t>(config.stack_trim_threshold);
   return config;
 }
 
@@ -9,11 +9,30 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::coro {
 
+enum class StackMode {
+  // The whole stack is accessible from the start
+  kFixed,
+  // The stack_size is reserved without the commit charge, the pages of the
+  // stacks that have grown deep are released on return to the pool, see
+  // GrowableStackAllocator
+  kGrowable,
+};
+
+StackMode Parse(const yaml_config::YamlConfig& value,
+                formats::parse::To<StackMode>);
+
 struct PoolConfig {
   std::size_t initial_size = 1000;
   std::size_t max_size = 4000;
   std::size_t stack_size = 256 * 1024ULL;
   std::size_t local_cache_size = 8;
+  StackMode stack_mode = StackMode::kFixed;
+  // Only used with StackMode::kGrowable
+  std::size_t initial_stack_size = 32 * 1024ULL;
+  // Only used with StackMode::kGrowable, stacks that have grown past this size
+  // are shrunk back to initial_stack_size on return to the pool. 0 disables
+  // the trimming.
+  std::size_t stack_trim_threshold = 128 * 1024ULL;
 };
 
 PoolConfig Parse(const yaml_config::YamlConfig& value,
@@ -12,6 +12,12 @@ struct PoolStats {
   size_t total_coroutines = 0;
   std::uint16_t max_stack_usage_pct = 0;
   bool is_stack_usage_monitor_active = false;
+  // Address space of the coroutine stacks
+  std::size_t stack_reserved_bytes = 0;
+  // Committed part of stack_reserved_bytes, less than it only with
+  // StackMode::kGrowable, where it is an estimate, see
+  // GrowableStackAllocator. Pages are not resident until touched.
+  std::size_t stack_committed_bytes = 0;
 };
 
 inline PoolStats& operator+=(PoolStats& lhs, const PoolStats& rhs) {
@@ -21,6 +27,8 @@ inline PoolStats& operator+=(PoolStats& lhs, const PoolStats& rhs) {
     lhs.max_stack_usage_pct = rhs.max_stack_usage_pct;
   }
   lhs.is_stack_usage_monitor_active |= rhs.is_stack_usage_monitor_active;
+  lhs.stack_reserved_bytes += rhs.stack_reserved_bytes;
+  lhs.stack_committed_bytes += rhs.stack_committed_bytes;
   return lhs;
 }
 
@@ -43,6 +43,12 @@ class StackUsageMonitor final {
 
 std::size_t GetCurrentTaskStackUsageBytes() noexcept;
 
+// The control block of a coroutine resides at the beginning (the top) of its
+// stack
+const void* GetCoroCbPtr(
+    const boost::coroutines2::coroutine<impl::TaskContext*>::push_type&
+        coro) noexcept;
+
 }  // namespace engine::coro
 
 USERVER_NAMESPACE_END
@@ -62,6 +62,8 @@ void EventLoop::RunOnce() noexcept {
   ev_run(loop_, EVRUN_ONCE);
 }
 
+void EventLoop::RunNoWait() noexcept { ev_run(loop_, EVRUN_NOWAIT); }
+
 void EventLoop::RunInEvLoopAsync(AsyncPayloadBase& payload) noexcept {
   UASSERT(DebugIsSameOsThread());
   payload.PerformAndRelease();
@@ -25,6 +25,11 @@ class EventLoop final {
 
   void RunOnce() noexcept;
 
+  // Runs the ready callbacks without waiting for the events. Unlike RunOnce(),
+  // may be called by different threads, as long as they do not run the loop
+  // concurrently.
+  void RunNoWait() noexcept;
+
   // Callbacks passed to RunInEvLoopAsync() are serialized.
   // All callbacks are guaranteed to execute.
   void RunInEvLoopAsync(AsyncPayloadBase& payload) noexcept;
@@ -42,20 +42,26 @@ const auto kCpuStatsThrottle =
 
 Thread::Thread(const std::string& thread_name,
                RegisterEventMode register_event_mode)
-    : Thread(thread_name, EventLoop::EvLoopType::kNewLoop,
-             register_event_mode) {}
+    : Thread(thread_name, EventLoop::EvLoopType::kNewLoop, register_event_mode,
+             false) {}
 
 Thread::Thread(const std::string& thread_name, UseDefaultEvLoop,
                RegisterEventMode register_event_mode)
     : Thread(thread_name, EventLoop::EvLoopType::kDefaultLoop,
-             register_event_mode) {}
+             register_event_mode, false) {}
+
+Thread::Thread(const std::string& thread_name, DrivenByWorker)
+    : Thread(thread_name, EventLoop::EvLoopType::kNewLoop,
+             RegisterEventMode::kImmediate, true) {}
 
 Thread::Thread(const std::string& thread_name,
                EventLoop::EvLoopType ev_loop_type,
-               RegisterEventMode register_event_mode)
+               RegisterEventMode register_event_mode, bool is_driven_by_worker)
     : register_event_mode_(register_event_mode),
       event_loop_(ev_loop_type),
+      timer_wheel_(event_loop_.GetEvLoop()),
       lock_(loop_mutex_, std::defer_lock),
+      is_driven_by_worker_(is_driven_by_worker),
       name_{thread_name},
       cpu_stats_storage_{kCpuStatsCollectInterval, kCpuStatsThrottle} {
   UASSERT_MSG(kDeferedInterval > std::chrono::milliseconds{4},
@@ -110,9 +116,49 @@ void Thread::RegisterInEvLoop(AsyncPayloadBase& payload) {
 }
 
 bool Thread::IsInEvThread() const {
+  if (is_driven_by_worker_) {
+    return std::this_thread::get_id() ==
+           loop_owner_.load(std::memory_order_relaxed);
+  }
   return (std::this_thread::get_id() == thread_.get_id());
 }
 
+void Thread::PollFromWorker() noexcept {
+  UASSERT(is_driven_by_worker_);
+  if (!is_worker_driving_) {
+    if (driver_.load() != Driver::kWorker) return;
+    AcquireImpl();
+    is_worker_driving_ = true;
+  }
+
+  UpdateLoopWatcherImpl();
+  event_loop_.RunNoWait();
+}
+
+void Thread::ReclaimFromWorker() noexcept {
+  UASSERT(is_driven_by_worker_);
+  auto expected = Driver::kOwnThread;
+  if (driver_.compare_exchange_strong(expected, Driver::kReturning)) {
+    // Wakes up the own thread if it sleeps in the loop
+    ev_async_send(GetEvLoop(), &watch_update_);
+  }
+}
+
+void Thread::LendFromWorker() noexcept {
+  UASSERT(is_driven_by_worker_);
+  if (is_worker_driving_) {
+    UpdateLoopWatcherImpl();
+    ReleaseImpl();
+    is_worker_driving_ = false;
+  }
+
+  {
+    std::lock_guard lock(driver_mutex_);
+    driver_ = Driver::kOwnThread;
+  }
+  driver_cv_.notify_one();
+}
+
 std::uint8_t Thread::GetCurrentLoadPercent() const {
   return cpu_stats_storage_.GetCurrentLoadPercent();
 }
@@ -157,6 +203,16 @@ void Thread::Start() {
 }
 
 void Thread::StopEventLoop() {
+  if (is_driven_by_worker_) {
+    UASSERT_MSG(!is_worker_driving_, "The worker still holds the loop");
+    // Makes sure that the own thread is there to process the break
+    {
+      std::lock_guard lock(driver_mutex_);
+      driver_ = Driver::kOwnThread;
+    }
+    driver_cv_.notify_one();
+  }
+
   ev_async_send(GetEvLoop(), &watch_break_);
   if (thread_.joinable()) thread_.join();
 
@@ -167,6 +223,7 @@ void Thread::StopEventLoop() {
 
 void Thread::RunEvLoop() {
   while (is_running_) {
+    if (is_driven_by_worker_) WaitForLoopLent();
     AcquireImpl();
     event_loop_.RunOnce();
     UpdateLoopWatcherImpl();
@@ -179,6 +236,15 @@ void Thread::RunEvLoop() {
   ev_timer_stop(GetEvLoop(), &defer_timer_);
 }
 
+void Thread::WaitForLoopLent() {
+  // The loop iteration is over, give the loop away if the worker has asked
+  auto expected = Driver::kReturning;
+  driver_.compare_exchange_strong(expected, Driver::kWorker);
+
+  std::unique_lock lock(driver_mutex_);
+  driver_cv_.wait(lock, [this] { return driver_ == Driver::kOwnThread; });
+}
+
 void Thread::UpdateLoopWatcher(struct ev_loop* loop, ev_async*, int) noexcept {
   auto* ev_thread = static_cast<Thread*>(ev_userdata(loop));
   UASSERT(ev_thread != nullptr);
@@ -228,8 +294,19 @@ void Thread::Release(struct ev_loop* loop) noexcept {
   ev_thread->ReleaseImpl();
 }
 
-void Thread::AcquireImpl() noexcept { lock_.lock(); }
-void Thread::ReleaseImpl() noexcept { lock_.unlock(); }
+void Thread::AcquireImpl() noexcept {
+  lock_.lock();
+  if (is_driven_by_worker_) {
+    loop_owner_.store(std::this_thread::get_id(), std::memory_order_relaxed);
+  }
+}
+
+void Thread::ReleaseImpl() noexcept {
+  if (is_driven_by_worker_) {
+    loop_owner_.store(std::thread::id{}, std::memory_order_relaxed);
+  }
+  lock_.unlock();
+}
 
 }  // namespace engine::ev
 
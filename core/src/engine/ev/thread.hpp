@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -13,6 +14,7 @@
 #include <concurrent/impl/intrusive_mpsc_queue.hpp>
 #include <engine/ev/async_payload_base.hpp>
 #include <engine/ev/event_loop.hpp>
+#include <engine/ev/timer_wheel.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -38,8 +40,15 @@ class Thread final {
     kDedicatedDeferred
   };
 
+  // The loop is run by a TaskProcessor worker between its task steps. The own
+  // thread of the Thread only runs the loop while the worker lends it, e.g.
+  // while the worker sleeps waiting for tasks.
+  struct DrivenByWorker {};
+  static constexpr DrivenByWorker kDrivenByWorker{};
+
   Thread(const std::string& thread_name, RegisterEventMode);
   Thread(const std::string& thread_name, UseDefaultEvLoop, RegisterEventMode);
+  Thread(const std::string& thread_name, DrivenByWorker);
 
   ~Thread();
 
@@ -57,12 +66,36 @@ class Thread final {
 
   bool IsInEvThread() const;
 
+  // For the timeouts that are not expected to fire, must be used from the ev
+  // thread only
+  TimerWheel& GetTimerWheel() noexcept { return timer_wheel_; }
+
+  // The following functions are for kDrivenByWorker only, and must be called
+  // by the same worker thread.
+
+  // Runs the ready callbacks without blocking. Takes the loop first, if
+  // the own thread has given it back after ReclaimFromWorker().
+  void PollFromWorker() noexcept;
+  // Asks the own thread to give the loop back to the worker
+  void ReclaimFromWorker() noexcept;
+  // Lets the own thread run the loop until the next ReclaimFromWorker()
+  void LendFromWorker() noexcept;
+
   std::uint8_t GetCurrentLoadPercent() const;
   const std::string& GetName() const;
 
  private:
+  // Who runs the loop of a kDrivenByWorker Thread
+  enum class Driver {
+    kOwnThread,
+    // The worker has asked for the loop, the own thread gives it away after
+    // the current iteration
+    kReturning,
+    kWorker,
+  };
+
   Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type,
-         RegisterEventMode register_event_mode);
+         RegisterEventMode register_event_mode, bool is_driven_by_worker);
 
   void RegisterInEvLoop(AsyncPayloadBase& payload);
 
@@ -70,6 +103,7 @@ class Thread final {
 
   void StopEventLoop();
   void RunEvLoop();
+  void WaitForLoopLent();
 
   static void UpdateLoopWatcher(struct ev_loop*, ev_async* w, int) noexcept;
   static void UpdateTimersWatcher(struct ev_loop*, ev_timer* w, int) noexcept;
@@ -87,10 +121,20 @@ class Thread final {
   RegisterEventMode register_event_mode_;
 
   EventLoop event_loop_;
+  TimerWheel timer_wheel_;
 
   std::thread thread_{};
   std::mutex loop_mutex_{};
   std::unique_lock<std::mutex> lock_{loop_mutex_, std::defer_lock};
+  // Whoever holds lock_ of a kDrivenByWorker Thread
+  std::atomic<std::thread::id> loop_owner_{};
+
+  const bool is_driven_by_worker_;
+  std::atomic<Driver> driver_{Driver::kOwnThread};
+  std::mutex driver_mutex_{};
+  std::condition_variable driver_cv_{};
+  // Accessed by the worker only
+  bool is_worker_driving_{false};
 
   ev_timer defer_timer_{};
   ev_async watch_update_{};
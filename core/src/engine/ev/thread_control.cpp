@@ -77,6 +77,19 @@ void ThreadControlBase::DoStop(ev_io& w) noexcept {
   ev_io_stop(GetEvLoop(), &w);
 }
 
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void ThreadControlBase::DoStart(TimerWheelEntry& w,
+                                Deadline::Duration time_left) noexcept {
+  UASSERT(IsInEvThread());
+  thread_.GetTimerWheel().Start(w, time_left);
+}
+
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void ThreadControlBase::DoStop(TimerWheelEntry& w) noexcept {
+  UASSERT(IsInEvThread());
+  thread_.GetTimerWheel().Stop(w);
+}
+
 TimerThreadControl::TimerThreadControl(Thread& thread) noexcept
     : ThreadControlBase{thread} {}
 
@@ -89,6 +102,15 @@ void TimerThreadControl::Stop(ev_timer& w) noexcept { DoStop(w); }
 // NOLINTNEXTLINE(readability-make-member-function-const)
 void TimerThreadControl::Again(ev_timer& w) noexcept { DoAgain(w); }
 
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void TimerThreadControl::Start(TimerWheelEntry& w,
+                               Deadline::Duration time_left) noexcept {
+  DoStart(w, time_left);
+}
+
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void TimerThreadControl::Stop(TimerWheelEntry& w) noexcept { DoStop(w); }
+
 ThreadControl::ThreadControl(Thread& thread) noexcept
     : ThreadControlBase{thread} {}
 
@@ -0,0 +1,208 @@
+#include <engine/ev/timer_wheel.hpp>
+
+#include <algorithm>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+TimerWheel::TimerWheel(struct ev_loop* loop) noexcept
+    : loop_(loop), origin_(Clock::now()) {
+  ev_timer_.data = this;
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+  ev_init(&ev_timer_, OnEvTimer);
+}
+
+void TimerWheel::Start(TimerWheelEntry& entry,
+                       Clock::duration time_left) noexcept {
+  Stop(entry);
+
+  const auto now = Clock::now();
+  // Nothing is scheduled, the skipped ticks need no processing
+  if (size_ == 0) current_tick_ = ToTick(now);
+
+  const auto expiry = std::chrono::ceil<std::chrono::milliseconds>(
+      now + std::max(time_left, Clock::duration::zero()) - origin_);
+  entry.expiry_tick_ =
+      std::max<std::uint64_t>(expiry / kTick, current_tick_ + 1);
+
+  Insert(entry);
+  ++size_;
+
+  const auto event_tick = entry.level_ == kOverflowLevel
+                              ? GetNextEventTick()
+                              : GetSlotTick(entry.level_, entry.slot_);
+  if (event_tick < ev_timer_tick_) ArmEvTimer(event_tick);
+}
+
+void TimerWheel::Stop(TimerWheelEntry& entry) noexcept {
+  if (!entry.IsArmed()) return;
+
+  auto& list = GetList(entry);
+  list.erase(List::s_iterator_to(entry));
+  if (entry.level_ != kOverflowLevel && list.empty()) {
+    occupied_slots_[entry.level_] &= ~(std::uint64_t{1} << entry.slot_);
+  }
+
+  UASSERT(size_ > 0);
+  if (--size_ == 0) {
+    ev_timer_stop(loop_, &ev_timer_);
+    ev_timer_tick_ = kNoTick;
+  }
+  // Otherwise the ev_timer may wake the loop up for nothing, that is cheaper
+  // than looking for the next occupied slot here
+}
+
+std::uint64_t TimerWheel::ToTick(Clock::time_point time_point) const noexcept {
+  UASSERT(time_point >= origin_);
+  return std::chrono::floor<std::chrono::milliseconds>(time_point - origin_) /
+         kTick;
+}
+
+TimerWheel::List& TimerWheel::GetList(const TimerWheelEntry& entry) noexcept {
+  if (entry.level_ == kOverflowLevel) return overflow_;
+  return slots_[entry.level_][entry.slot_];
+}
+
+void TimerWheel::Insert(TimerWheelEntry& entry) noexcept {
+  const auto tick = entry.expiry_tick_;
+  UASSERT(tick >= current_tick_);
+
+  // The entry goes to the lowest level, where its tick shares the slot
+  // sequence with current_tick_. So the occupied slots of a level always follow
+  // the current one.
+  for (std::size_t level = 0; level < kLevels; ++level) {
+    const auto level_shift = level * kSlotBits;
+    const auto upper_shift = level_shift + kSlotBits;
+    if ((tick >> upper_shift) != (current_tick_ >> upper_shift)) continue;
+
+    const auto slot = (tick >> level_shift) & (kSlots - 1);
+    entry.level_ = static_cast<std::uint8_t>(level);
+    entry.slot_ = static_cast<std::uint8_t>(slot);
+    slots_[level][slot].push_back(entry);
+    occupied_slots_[level] |= std::uint64_t{1} << slot;
+    return;
+  }
+
+  entry.level_ = kOverflowLevel;
+  overflow_.push_back(entry);
+}
+
+std::uint64_t TimerWheel::GetSlotTick(std::size_t level,
+                                      std::size_t slot) const noexcept {
+  const auto level_shift = level * kSlotBits;
+  const auto upper_shift = level_shift + kSlotBits;
+  return ((current_tick_ >> upper_shift) << upper_shift) +
+         (std::uint64_t{slot} << level_shift);
+}
+
+std::uint64_t TimerWheel::GetNextEventTick() const noexcept {
+  for (std::size_t level = 0; level < kLevels; ++level) {
+    const auto current_slot =
+        (current_tick_ >> (level * kSlotBits)) & (kSlots - 1);
+    // The slots after the current one, the shift by 64 gives 0 as desired
+    const auto mask = occupied_slots_[level] &
+                      ~((std::uint64_t{2} << current_slot) - 1);
+    if (mask) {
+      return GetSlotTick(level, __builtin_ctzll(mask));
+    }
+  }
+
+  if (!overflow_.empty()) {
+    constexpr auto kTopShift = kLevels * kSlotBits;
+    return ((current_tick_ >> kTopShift) + 1) << kTopShift;
+  }
+  return kNoTick;
+}
+
+void TimerWheel::Advance(std::uint64_t now_tick) noexcept {
+  while (size_ != 0) {
+    const auto next_tick = GetNextEventTick();
+    if (next_tick > now_tick) break;
+
+    current_tick_ = next_tick;
+    RunTick(next_tick);
+  }
+  current_tick_ = std::max(current_tick_, now_tick);
+}
+
+void TimerWheel::RunTick(std::uint64_t tick) noexcept {
+  constexpr auto kTopShift = kLevels * kSlotBits;
+  if ((tick & ((std::uint64_t{1} << kTopShift) - 1)) == 0) {
+    Cascade(overflow_);
+  }
+
+  // The upper levels go first, their timers may land in the lower ones
+  for (std::size_t level = kLevels - 1; level > 0; --level) {
+    const auto level_shift = level * kSlotBits;
+    if ((tick & ((std::uint64_t{1} << level_shift) - 1)) != 0) continue;
+
+    const auto slot = (tick >> level_shift) & (kSlots - 1);
+    if (!(occupied_slots_[level] & (std::uint64_t{1} << slot))) continue;
+    occupied_slots_[level] &= ~(std::uint64_t{1} << slot);
+    Cascade(slots_[level][slot]);
+  }
+
+  const auto slot = tick & (kSlots - 1);
+  occupied_slots_[0] &= ~(std::uint64_t{1} << slot);
+  List expired;
+  expired.splice(expired.end(), slots_[0][slot]);
+
+  // The callbacks may start and stop any timers, including the expired ones
+  while (!expired.empty()) {
+    auto& entry = expired.front();
+    expired.pop_front();
+    --size_;
+    entry.callback_(entry.data_);
+  }
+}
+
+void TimerWheel::Cascade(List& list) noexcept {
+  List cascaded;
+  cascaded.splice(cascaded.end(), list);
+  while (!cascaded.empty()) {
+    auto& entry = cascaded.front();
+    cascaded.pop_front();
+    Insert(entry);
+  }
+}
+
+void TimerWheel::ArmEvTimer(std::uint64_t tick) noexcept {
+  using LibEvDuration = std::chrono::duration<double>;
+  const auto time_left =
+      origin_ + kTick * static_cast<std::int64_t>(tick) - Clock::now();
+
+  ev_timer_tick_ = tick;
+  ev_timer_stop(loop_, &ev_timer_);
+  ev_now_update(loop_);
+  ev_timer_set(&ev_timer_,
+               std::max(std::chrono::duration_cast<LibEvDuration>(time_left),
+                        LibEvDuration::zero())
+                   .count(),
+               0.0);
+  ev_timer_start(loop_, &ev_timer_);
+}
+
+void TimerWheel::UpdateEvTimer() noexcept {
+  const auto next_tick = GetNextEventTick();
+  if (next_tick == kNoTick) {
+    ev_timer_stop(loop_, &ev_timer_);
+    ev_timer_tick_ = kNoTick;
+    return;
+  }
+  ArmEvTimer(next_tick);
+}
+
+void TimerWheel::OnEvTimer(struct ev_loop*, ev_timer* w, int) noexcept {
+  auto* self = static_cast<TimerWheel*>(w->data);
+  UASSERT(self != nullptr);
+
+  self->Advance(self->ToTick(Clock::now()));
+  self->UpdateEvTimer();
+}
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <boost/intrusive/list.hpp>
+
+#include <ev.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+// A timer of TimerWheel, the callback is called with the data in the ev thread
+class TimerWheelEntry final {
+ public:
+  using Callback = void (*)(void* data) noexcept;
+
+  TimerWheelEntry(Callback callback, void* data) noexcept
+      : callback_(callback), data_(data) {}
+
+  TimerWheelEntry(TimerWheelEntry&&) = delete;
+  TimerWheelEntry& operator=(TimerWheelEntry&&) = delete;
+
+  bool IsArmed() const noexcept { return hook_.is_linked(); }
+
+ private:
+  friend class TimerWheel;
+
+  boost::intrusive::list_member_hook<
+      boost::intrusive::link_mode<boost::intrusive::safe_link>>
+      hook_;
+  const Callback callback_;
+  void* const data_;
+  std::uint64_t expiry_tick_{0};
+  std::uint8_t level_{0};
+  std::uint8_t slot_{0};
+};
+
+// Hierarchical timer wheel of an ev loop for the timeouts, that mostly get
+// stopped before they fire. Starting and stopping a timer is O(1) and does not
+// touch the libev timers heap, a single ev_timer wakes the loop up for the
+// nearest occupied slot.
+//
+// The timers fire with kTick resolution, never earlier than requested. Must be
+// used from the ev thread only.
+class TimerWheel final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  static constexpr std::chrono::milliseconds kTick{1};
+
+  explicit TimerWheel(struct ev_loop* loop) noexcept;
+
+  TimerWheel(TimerWheel&&) = delete;
+  TimerWheel& operator=(TimerWheel&&) = delete;
+
+  // Restarts the entry if it is armed
+  void Start(TimerWheelEntry& entry, Clock::duration time_left) noexcept;
+
+  // Does nothing for a not armed entry
+  void Stop(TimerWheelEntry& entry) noexcept;
+
+  std::size_t GetSize() const noexcept { return size_; }
+
+ private:
+  static constexpr std::size_t kSlotBits = 6;
+  static constexpr std::size_t kSlots = std::size_t{1} << kSlotBits;
+  static constexpr std::size_t kLevels = 5;
+  // Timers beyond kSlots^kLevels ticks, they are rescheduled on the wraparound
+  // of the top level
+  static constexpr std::uint8_t kOverflowLevel = kLevels;
+  static constexpr std::uint64_t kNoTick = ~std::uint64_t{0};
+
+  using List = boost::intrusive::list<
+      TimerWheelEntry,
+      boost::intrusive::member_hook<TimerWheelEntry,
+                                    decltype(TimerWheelEntry::hook_),
+                                    &TimerWheelEntry::hook_>,
+      boost::intrusive::constant_time_size<false>>;
+
+  std::uint64_t ToTick(Clock::time_point time_point) const noexcept;
+  List& GetList(const TimerWheelEntry& entry) noexcept;
+
+  void Insert(TimerWheelEntry& entry) noexcept;
+  // The tick at which the slot is expired or cascaded
+  std::uint64_t GetSlotTick(std::size_t level,
+                            std::size_t slot) const noexcept;
+  std::uint64_t GetNextEventTick() const noexcept;
+
+  void Advance(std::uint64_t now_tick) noexcept;
+  void RunTick(std::uint64_t tick) noexcept;
+  void Cascade(List& list) noexcept;
+
+  void ArmEvTimer(std::uint64_t tick) noexcept;
+  void UpdateEvTimer() noexcept;
+  static void OnEvTimer(struct ev_loop*, ev_timer* w, int) noexcept;
+
+  struct ev_loop* const loop_;
+  const Clock::time_point origin_;
+  // All the ticks up to current_tick_ are processed
+  std::uint64_t current_tick_{0};
+  std::size_t size_{0};
+
+  std::array<std::array<List, kSlots>, kLevels> slots_;
+  std::array<std::uint64_t, kLevels> occupied_slots_{};
+  List overflow_;
+
+  ev_timer ev_timer_{};
+  std::uint64_t ev_timer_tick_{kNoTick};
+};
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
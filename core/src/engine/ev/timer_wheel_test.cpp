@@ -0,0 +1,100 @@
+#include <engine/ev/timer_wheel.hpp>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Clock = engine::ev::TimerWheel::Clock;
+using engine::ev::TimerWheel;
+using engine::ev::TimerWheelEntry;
+
+struct Timer final {
+  explicit Timer(std::vector<int>& fired_ids, int id)
+      : fired_ids(fired_ids), id(id) {}
+
+  static void OnTimer(void* data) noexcept {
+    auto& self = *static_cast<Timer*>(data);
+    self.fired_at = Clock::now();
+    self.fired_ids.push_back(self.id);
+  }
+
+  std::vector<int>& fired_ids;
+  const int id;
+  Clock::time_point fired_at{};
+  TimerWheelEntry entry{&OnTimer, this};
+};
+
+class TimerWheelTest : public ::testing::Test {
+ protected:
+  TimerWheelTest() : loop_(ev_loop_new(EVFLAG_AUTO)), wheel_(loop_) {}
+
+  ~TimerWheelTest() override { ev_loop_destroy(loop_); }
+
+  TimerWheel& GetWheel() { return wheel_; }
+
+  void RunUntilEmpty(std::chrono::milliseconds limit) {
+    const auto deadline = Clock::now() + limit;
+    while (wheel_.GetSize() != 0 && Clock::now() < deadline) {
+      ev_run(loop_, EVRUN_ONCE);
+    }
+  }
+
+ private:
+  struct ev_loop* loop_;
+  TimerWheel wheel_;
+};
+
+}  // namespace
+
+TEST_F(TimerWheelTest, FiresInOrderNotEarlier) {
+  const std::vector<std::chrono::milliseconds> timeouts{
+      std::chrono::milliseconds{150}, std::chrono::milliseconds{3},
+      std::chrono::milliseconds{70}, std::chrono::milliseconds{20}};
+
+  std::vector<int> fired_ids;
+  std::vector<std::unique_ptr<Timer>> timers;
+  const auto start = Clock::now();
+  for (std::size_t i = 0; i < timeouts.size(); ++i) {
+    timers.push_back(std::make_unique<Timer>(fired_ids, static_cast<int>(i)));
+    GetWheel().Start(timers.back()->entry, timeouts[i]);
+  }
+  EXPECT_EQ(GetWheel().GetSize(), timeouts.size());
+
+  RunUntilEmpty(std::chrono::seconds{5});
+  EXPECT_EQ(fired_ids, (std::vector<int>{1, 3, 2, 0}));
+  for (std::size_t i = 0; i < timeouts.size(); ++i) {
+    EXPECT_FALSE(timers[i]->entry.IsArmed());
+    EXPECT_GE(timers[i]->fired_at - start, timeouts[i]);
+  }
+}
+
+TEST_F(TimerWheelTest, StopAndRestart) {
+  std::vector<int> fired_ids;
+  Timer stopped{fired_ids, 1};
+  Timer restarted{fired_ids, 2};
+  Timer far{fired_ids, 3};
+
+  GetWheel().Start(stopped.entry, std::chrono::milliseconds{5});
+  GetWheel().Start(restarted.entry, std::chrono::hours{1});
+  GetWheel().Start(far.entry, std::chrono::hours{24 * 365});
+  EXPECT_EQ(GetWheel().GetSize(), 3);
+
+  GetWheel().Stop(stopped.entry);
+  GetWheel().Stop(stopped.entry);
+  EXPECT_FALSE(stopped.entry.IsArmed());
+
+  GetWheel().Start(restarted.entry, std::chrono::milliseconds{10});
+  EXPECT_EQ(GetWheel().GetSize(), 2);
+
+  GetWheel().Stop(far.entry);
+  RunUntilEmpty(std::chrono::seconds{5});
+  EXPECT_EQ(fired_ids, std::vector<int>{2});
+}
+
+USERVER_NAMESPACE_END
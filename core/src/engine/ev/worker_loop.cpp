@@ -0,0 +1,53 @@
+#include <engine/ev/worker_loop.hpp>
+
+#include <userver/compiler/thread_local.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+namespace {
+
+// Every poll is a syscall, tiny task steps share it. The readiness of a socket
+// is not lost in between, just noticed a bit later.
+constexpr std::chrono::microseconds kMinPollInterval{10};
+
+compiler::ThreadLocal current_loop = [] {
+  return static_cast<WorkerLoop*>(nullptr);
+};
+
+}  // namespace
+
+WorkerLoop::WorkerLoop(const std::string& thread_name)
+    : thread_(thread_name, Thread::kDrivenByWorker),
+      control_(thread_),
+      timer_control_(thread_) {}
+
+WorkerLoop* WorkerLoop::GetForCurrentThread() noexcept {
+  auto loop = current_loop.Use();
+  return *loop;
+}
+
+void WorkerLoop::SetForCurrentThread(WorkerLoop* loop) noexcept {
+  auto current = current_loop.Use();
+  *current = loop;
+}
+
+void WorkerLoop::Poll() noexcept {
+  const auto now = std::chrono::steady_clock::now();
+  if (now - last_poll_ < kMinPollInterval) return;
+  last_poll_ = now;
+  thread_.PollFromWorker();
+}
+
+void WorkerLoop::Lend() noexcept { thread_.LendFromWorker(); }
+
+void WorkerLoop::Reclaim() noexcept {
+  thread_.ReclaimFromWorker();
+  // Lets the next step take the loop
+  last_poll_ = {};
+}
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+
+#include <engine/ev/thread.hpp>
+#include <engine/ev/thread_control.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+// The ev loop of a TaskProcessor worker, an alternative to the shared ev
+// threads for the timers and the sockets of the worker's tasks.
+//
+// The worker runs the loop between its task steps, so the watchers are started
+// and stopped in place, and the I/O readiness resumes the coroutines on
+// the worker that is going to run them. While the worker sleeps waiting for
+// tasks, the loop is lent to a helper thread that sleeps in the loop instead.
+//
+// The loop must outlive all the watchers started in it, so the sockets
+// created by the tasks of a TaskProcessor must not outlive the TaskProcessor.
+class WorkerLoop final {
+ public:
+  explicit WorkerLoop(const std::string& thread_name);
+
+  WorkerLoop(WorkerLoop&&) = delete;
+  WorkerLoop& operator=(WorkerLoop&&) = delete;
+
+  // Returns nullptr if the current thread has no loop of its own
+  static WorkerLoop* GetForCurrentThread() noexcept;
+  static void SetForCurrentThread(WorkerLoop* loop) noexcept;
+
+  ThreadControl& GetControl() noexcept { return control_; }
+  TimerThreadControl& GetTimerControl() noexcept { return timer_control_; }
+
+  // Must be called by the owning worker between the task steps
+  void Poll() noexcept;
+
+  // The loop is lent to the helper thread from the start. The owning worker
+  // must reclaim it when it starts and after sleeping, and lend it before
+  // sleeping and before exiting.
+  void Lend() noexcept;
+  void Reclaim() noexcept;
+
+ private:
+  Thread thread_;
+  ThreadControl control_;
+  TimerThreadControl timer_control_;
+  std::chrono::steady_clock::time_point last_poll_{};
+};
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,150 @@
+#include <engine/ev/worker_loop.hpp>
+
+#include <array>
+#include <chrono>
+#include <string_view>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/internal/net/net_listener.hpp>
+#include <userver/utest/utest.hpp>
+
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Deadline = engine::Deadline;
+
+constexpr std::size_t kWorkers = 2;
+constexpr std::chrono::milliseconds kShortTimeout{10};
+
+engine::TaskProcessorConfig MakeWorkerLoopsConfig() {
+  engine::TaskProcessorConfig config;
+  config.name = "worker-loops";
+  config.thread_name = "loop-worker";
+  config.worker_threads = kWorkers;
+  config.ev_loops_in_workers = true;
+  return config;
+}
+
+class WorkerLoopsTaskProcessor final {
+ public:
+  WorkerLoopsTaskProcessor()
+      : task_processor_(
+            MakeWorkerLoopsConfig(),
+            engine::current_task::GetTaskProcessor().GetTaskProcessorPools()) {}
+
+  template <typename Func>
+  void Run(Func func) {
+    engine::AsyncNoSpan(task_processor_, [func = std::move(func)] {
+      ASSERT_NE(engine::ev::WorkerLoop::GetForCurrentThread(), nullptr);
+      func();
+    }).Get();
+  }
+
+ private:
+  engine::TaskProcessor task_processor_;
+};
+
+}  // namespace
+
+UTEST(WorkerLoop, NoLoopByDefault) {
+  EXPECT_EQ(engine::ev::WorkerLoop::GetForCurrentThread(), nullptr);
+}
+
+UTEST(WorkerLoop, Sleep) {
+  WorkerLoopsTaskProcessor tp;
+
+  tp.Run([] {
+    for (int i = 0; i < 10; ++i) {
+      const auto start = std::chrono::steady_clock::now();
+      engine::InterruptibleSleepFor(kShortTimeout);
+      EXPECT_GE(std::chrono::steady_clock::now() - start, kShortTimeout);
+    }
+  });
+}
+
+UTEST(WorkerLoop, ManySleepers) {
+  WorkerLoopsTaskProcessor tp;
+
+  tp.Run([] {
+    // The timers are started by all the workers and fire while the workers
+    // are either busy or asleep
+    std::vector<engine::TaskWithResult<void>> sleepers;
+    for (int i = 0; i < 1000; ++i) {
+      sleepers.push_back(engine::AsyncNoSpan([i] {
+        engine::InterruptibleSleepFor(std::chrono::microseconds{i % 50});
+      }));
+    }
+    for (auto& sleeper : sleepers) sleeper.Get();
+  });
+}
+
+UTEST(WorkerLoop, CancelSleep) {
+  WorkerLoopsTaskProcessor tp;
+
+  tp.Run([] {
+    auto sleeper = engine::AsyncNoSpan([] {
+      engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+      return engine::current_task::ShouldCancel();
+    });
+    engine::SleepFor(kShortTimeout);
+    sleeper.RequestCancel();
+    EXPECT_TRUE(sleeper.Get());
+  });
+}
+
+UTEST(WorkerLoop, PingPong) {
+  WorkerLoopsTaskProcessor tp;
+
+  tp.Run([] {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    internal::net::TcpListener listener;
+    auto [server, client] = listener.MakeSocketPair(deadline);
+
+    auto echo = engine::AsyncNoSpan([&server = server, deadline] {
+      std::array<char, 16> buf{};
+      while (const auto size = server.RecvSome(buf.data(), buf.size(),
+                                               deadline)) {
+        EXPECT_EQ(server.SendAll(buf.data(), size, deadline), size);
+      }
+    });
+
+    constexpr std::string_view kMessage = "ping";
+    for (int i = 0; i < 100; ++i) {
+      // Waiting in the loop of another worker or of the helper thread
+      if (i % 2) engine::InterruptibleSleepFor(std::chrono::microseconds{100});
+      ASSERT_EQ(client.SendAll(kMessage.data(), kMessage.size(), deadline),
+                kMessage.size());
+      std::array<char, kMessage.size()> buf{};
+      ASSERT_EQ(client.RecvAll(buf.data(), buf.size(), deadline), buf.size());
+      EXPECT_EQ(std::string_view(buf.data(), buf.size()), kMessage);
+    }
+
+    client.Close();
+    echo.Get();
+  });
+}
+
+UTEST(WorkerLoop, ReadTimeout) {
+  WorkerLoopsTaskProcessor tp;
+
+  tp.Run([] {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    internal::net::TcpListener listener;
+    auto [server, client] = listener.MakeSocketPair(deadline);
+
+    EXPECT_FALSE(server.WaitReadable(Deadline::FromDuration(kShortTimeout)));
+    ASSERT_EQ(client.SendAll("test", 4, deadline), 4);
+    EXPECT_TRUE(server.WaitReadable(deadline));
+  });
+}
+
+USERVER_NAMESPACE_END
@@ -76,7 +76,8 @@ CvStatus ConditionVariableAny<MutexType>::WaitUntil(
   auto wakeup_source = TaskContext::WakeupSource::kNone;
   {
     CvWaitStrategy<MutexType> wait_manager(*waiters_, current, lock);
-    wakeup_source = current.Sleep(wait_manager, deadline);
+    wakeup_source = current.Sleep(wait_manager, deadline,
+                                  WaitKind::kConditionVariable);
   }
   // re-lock the mutex after it's been released in SetupWakeups()
   // lock.owns_lock() can occur on an immediate cancellation
@@ -1,11 +1,16 @@
 #include <userver/engine/impl/detached_tasks_sync_block.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <optional>
+#include <thread>
 
+#include <userver/compiler/thread_local.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/fixed_array.hpp>
 #include <userver/utils/impl/wait_token_storage.hpp>
 
+#include <concurrent/impl/interference_shield.hpp>
 #include <concurrent/intrusive_walkable_pool.hpp>
 #include <engine/task/task_context.hpp>
 
@@ -13,10 +18,35 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
+namespace {
+
+// Enough to make the contention negligible, while keeping the memory footprint
+// of a DetachedTasksSyncBlock small
+constexpr std::size_t kMaxShardCount = 16;
+
+std::size_t GetShardCount() noexcept {
+  return std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1,
+                                 kMaxShardCount);
+}
+
+std::atomic<std::size_t> next_thread_index{0};
+
+// Threads are spread over the shards in a round-robin manner
+compiler::ThreadLocal local_thread_index = [] {
+  return next_thread_index.fetch_add(1, std::memory_order_relaxed);
+};
+
+std::size_t GetLocalThreadIndex() noexcept {
+  auto thread_index = local_thread_index.Use();
+  return *thread_index;
+}
+
+}  // namespace
+
 struct DetachedTasksSyncBlock::Token final {
-  explicit Token(DetachedTasksSyncBlock& owner) : owner(owner) {}
+  explicit Token(Shard& shard) : shard(shard) {}
 
-  DetachedTasksSyncBlock& owner;
+  Shard& shard;
 
   concurrent::impl::IntrusiveWalkablePoolHook<Token> pool_hook{};
 
@@ -27,32 +57,42 @@ struct DetachedTasksSyncBlock::Token final {
   utils::impl::WaitTokenStorage::Token wait_token{};
 };
 
-struct DetachedTasksSyncBlock::Impl final {
+struct DetachedTasksSyncBlock::Shard final {
   std::optional<utils::impl::WaitTokenStorage> wait_tokens{};
   concurrent::impl::IntrusiveWalkablePool<
       Token, concurrent::impl::MemberHook<&Token::pool_hook>>
       cancel_tokens{};
+};
+
+struct DetachedTasksSyncBlock::Impl final {
+  // Detached tasks are registered in the shard of the current thread to avoid
+  // the contention on a single pool
+  utils::FixedArray<concurrent::impl::InterferenceShield<Shard>> shards{
+      GetShardCount()};
   std::atomic<TaskCancellationReason> cancel_new_tasks{
       TaskCancellationReason::kNone};
 };
 
 DetachedTasksSyncBlock::DetachedTasksSyncBlock(StopMode stop_mode) {
   if (stop_mode == StopMode::kCancelAndWait) {
-    impl_->wait_tokens.emplace();
+    for (auto& shard : impl_->shards) {
+      shard->wait_tokens.emplace();
+    }
   }
 }
 
 DetachedTasksSyncBlock::~DetachedTasksSyncBlock() = default;
 
 void DetachedTasksSyncBlock::Add(TaskContext& context) {
-  auto& token = impl_->cancel_tokens.Acquire([this] { return Token(*this); });
+  auto& shard = *impl_->shards[GetLocalThreadIndex() % impl_->shards.size()];
+  auto& token = shard.cancel_tokens.Acquire([&shard] { return Token(shard); });
   UASSERT(token.task == nullptr);
 
   boost::intrusive_ptr<TaskContext> context_copy(&context);
 
   token.task.store(context_copy.detach());
-  if (impl_->wait_tokens) {
-    token.wait_token = impl_->wait_tokens->GetToken();
+  if (shard.wait_tokens) {
+    token.wait_token = shard.wait_tokens->GetToken();
   }
 
   context.SetDetached(token);
@@ -75,40 +115,47 @@ void DetachedTasksSyncBlock::Dispose(Token& token) noexcept {
                                                     /*add_ref=*/false);
   }
   [[maybe_unused]] const auto wait_token = std::move(token.wait_token);
-  token.owner.impl_->cancel_tokens.Release(token);
+  token.shard.cancel_tokens.Release(token);
 }
 
 void DetachedTasksSyncBlock::RequestCancellation(
     TaskCancellationReason reason) noexcept {
   impl_->cancel_new_tasks.store(reason);
 
-  impl_->cancel_tokens.Walk([&](Token& token) {
-    auto* const context_ptr = token.task.exchange(nullptr);
-
-    if (context_ptr != nullptr) {
-      boost::intrusive_ptr<TaskContext> context(context_ptr,
-                                                /*add_ref=*/false);
-      context->RequestCancel(reason);
-    }
-  });
+  for (auto& shard : impl_->shards) {
+    shard->cancel_tokens.Walk([&](Token& token) {
+      auto* const context_ptr = token.task.exchange(nullptr);
 
-  if (impl_->wait_tokens) {
-    impl_->wait_tokens->WaitForAllTokens();
+      if (context_ptr != nullptr) {
+        boost::intrusive_ptr<TaskContext> context(context_ptr,
+                                                  /*add_ref=*/false);
+        context->RequestCancel(reason);
+      }
+    });
   }
+
+  WaitAllTasksCompleteDebug();
 }
 
 void DetachedTasksSyncBlock::WaitAllTasksCompleteDebug() noexcept {
-  if (impl_->wait_tokens) {
-    impl_->wait_tokens->WaitForAllTokens();
+  for (auto& shard : impl_->shards) {
+    if (shard->wait_tokens) {
+      shard->wait_tokens->WaitForAllTokens();
+    }
   }
 }
 
 std::int64_t DetachedTasksSyncBlock::ActiveTasksApprox() const noexcept {
-  UASSERT_MSG(impl_->wait_tokens,
+  UASSERT_MSG(impl_->shards[0]->wait_tokens,
               "Task count is only available for StopMode::kCancelAndWait");
-  if (!impl_->wait_tokens) return 0;
 
-  return impl_->wait_tokens->AliveTokensApprox();
+  std::int64_t result = 0;
+  for (const auto& shard : impl_->shards) {
+    if (shard->wait_tokens) {
+      result += shard->wait_tokens->AliveTokensApprox();
+    }
+  }
+  return result;
 }
 
 }  // namespace engine::impl
@@ -27,7 +27,8 @@ FutureStatus FutureStateBase::WaitUntil(Deadline deadline) {
   auto& context = current_task::GetCurrentTaskContext();
 
   FutureWaitStrategy wait_strategy{*this, context};
-  const auto wakeup_source = context.Sleep(wait_strategy, deadline);
+  const auto wakeup_source = context.Sleep(wait_strategy, deadline,
+                                           WaitKind::kFuture);
   return ToFutureStatus(wakeup_source);
 }
 
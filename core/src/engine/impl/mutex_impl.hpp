@@ -34,6 +34,10 @@ class MutexImpl {
 
   bool try_lock_until(Deadline deadline);
 
+  // Hints for spin-waiting, may be outdated by the time they are used
+  bool IsLockedRelaxed() const noexcept;
+  bool HasWaitersRelaxed() noexcept;
+
  private:
   class MutexWaitStrategy;
 
@@ -130,7 +134,8 @@ bool MutexImpl<Waiters>::LockSlowPath(TaskContext& current, Deadline deadline) {
     UINVARIANT(expected != &current,
                "MutexImpl is locked twice from the same task");
 
-    const auto wakeup_source = current.Sleep(wait_manager, deadline);
+    const auto wakeup_source = current.Sleep(wait_manager, deadline,
+                                             WaitKind::kMutex);
     if (!HasWaitSucceeded(wakeup_source)) {
       return false;
     }
@@ -204,6 +209,21 @@ bool MutexImpl<Waiters>::try_lock_until(Deadline deadline) {
   return result;
 }
 
+template <class Waiters>
+bool MutexImpl<Waiters>::IsLockedRelaxed() const noexcept {
+  return owner_.load(std::memory_order_relaxed) != nullptr;
+}
+
+template <class Waiters>
+bool MutexImpl<Waiters>::HasWaitersRelaxed() noexcept {
+  if constexpr (std::is_same_v<Waiters, WaitList>) {
+    return lock_waiters_.GetCountOfSleepies() != 0;
+  } else {
+    static_assert(std::is_same_v<Waiters, WaitListLight>);
+    return !lock_waiters_.IsEmptyRelaxed();
+  }
+}
+
 }  // namespace engine::impl
 
 USERVER_NAMESPACE_END
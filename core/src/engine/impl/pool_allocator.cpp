@@ -0,0 +1,228 @@
+#include <userver/engine/impl/pool_allocator.hpp>
+
+#include <array>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include <userver/compiler/thread_local.hpp>
+#include <userver/utils/assert.hpp>
+
+#if defined(__has_feature)
+#if __has_feature(address_sanitizer)
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define USERVER_IMPL_POOL_HAS_ASAN
+#endif
+#elif defined(__SANITIZE_ADDRESS__)
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define USERVER_IMPL_POOL_HAS_ASAN
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+namespace {
+
+#ifdef USERVER_IMPL_POOL_HAS_ASAN
+// Caching would hide use-after-free from the sanitizer
+constexpr bool kIsCachingEnabled = false;
+#else
+constexpr bool kIsCachingEnabled = true;
+#endif
+
+// About 1.5x apart, so that a typical fused TaskContext does not waste much
+constexpr std::array<std::size_t, 13> kClassSizes{
+    128, 192, 256, 384, 512, 768, 1024, 1536, 2048, 3072, 4096, 6144, 8192};
+constexpr std::size_t kClassCount = kClassSizes.size();
+constexpr std::size_t kUncachedClass = kClassCount;
+
+// Blocks travel between the thread-local freelists and the global pool in
+// chains of this many blocks
+constexpr std::size_t kChainSize = 16;
+constexpr std::size_t kMaxLocalBlocks = 2 * kChainSize;
+constexpr std::size_t kMaxGlobalBytesPerClass = 16 * 1024 * 1024;
+
+// Precedes each block, keeps the user part aligned
+struct alignas(kPoolAlignment) Header final {
+  std::size_t size_class;
+};
+
+static_assert(sizeof(Header) == kPoolAlignment);
+
+// Overlays the Header of an idle block
+struct FreeBlock final {
+  FreeBlock* next;
+};
+
+struct Chain final {
+  FreeBlock* head{nullptr};
+  std::size_t size{0};
+};
+
+std::size_t GetSizeClass(std::size_t size) noexcept {
+  std::size_t size_class = 0;
+  while (size_class < kClassCount && kClassSizes[size_class] < size) {
+    ++size_class;
+  }
+  return size_class;
+}
+
+void* AllocateFromSystem(std::size_t size_class, std::size_t size) {
+  const auto user_size =
+      size_class == kUncachedClass ? size : kClassSizes[size_class];
+  void* const block = ::operator new(sizeof(Header) + user_size,
+                                     std::align_val_t{kPoolAlignment});
+  return new (block) Header{size_class} + 1;
+}
+
+void DeallocateToSystem(void* block) noexcept {
+  ::operator delete(block, std::align_val_t{kPoolAlignment});
+}
+
+void DeallocateToSystem(Chain chain) noexcept {
+  while (chain.head) {
+    auto* const block = chain.head;
+    chain.head = block->next;
+    DeallocateToSystem(block);
+  }
+}
+
+// Idle blocks that no thread keeps locally
+class GlobalPool final {
+ public:
+  // Returns an empty Chain if there are no idle blocks
+  Chain TryPop(std::size_t size_class) noexcept {
+    auto& chains = chains_[size_class];
+    std::lock_guard lock(mutex_);
+    if (chains.empty()) return {};
+    const auto chain = chains.back();
+    chains.pop_back();
+    return chain;
+  }
+
+  // Frees the blocks if the pool is full
+  void Push(std::size_t size_class, Chain chain) noexcept {
+    UASSERT(chain.head);
+    auto& chains = chains_[size_class];
+    {
+      std::lock_guard lock(mutex_);
+      if (chains.size() < GetMaxChains(size_class)) {
+        try {
+          chains.push_back(chain);
+          return;
+        } catch (const std::bad_alloc&) {
+          // fall through
+        }
+      }
+    }
+    DeallocateToSystem(chain);
+  }
+
+ private:
+  static std::size_t GetMaxChains(std::size_t size_class) noexcept {
+    return kMaxGlobalBytesPerClass / (kClassSizes[size_class] * kChainSize);
+  }
+
+  std::mutex mutex_;
+  std::array<std::vector<Chain>, kClassCount> chains_;
+};
+
+GlobalPool& GetGlobalPool() {
+  // Intentionally leaked, the thread-local caches may be flushed after
+  // the destruction of static objects.
+  static auto& pool = *new GlobalPool();
+  return pool;
+}
+
+class LocalCache final {
+ public:
+  LocalCache() = default;
+  LocalCache(LocalCache&&) = delete;
+  LocalCache& operator=(LocalCache&&) = delete;
+
+  ~LocalCache() {
+    for (std::size_t size_class = 0; size_class < kClassCount; ++size_class) {
+      auto& chain = lists_[size_class];
+      if (chain.head) GetGlobalPool().Push(size_class, chain);
+      chain = {};
+    }
+    // Blocks freed by the destructors of the other thread-local variables go
+    // straight to the system.
+    is_alive_ = false;
+  }
+
+  void* Allocate(std::size_t size_class) {
+    if (!is_alive_) return AllocateFromSystem(size_class, 0);
+
+    auto& chain = lists_[size_class];
+    if (!chain.head) {
+      chain = GetGlobalPool().TryPop(size_class);
+      if (!chain.head) return AllocateFromSystem(size_class, 0);
+    }
+
+    auto* const block = chain.head;
+    chain.head = block->next;
+    --chain.size;
+    return new (block) Header{size_class} + 1;
+  }
+
+  void Deallocate(std::size_t size_class, void* block) noexcept {
+    if (!is_alive_) {
+      DeallocateToSystem(block);
+      return;
+    }
+
+    auto& chain = lists_[size_class];
+    if (chain.size == kMaxLocalBlocks) {
+      // The rest of the blocks are the most recently used ones, and they stay
+      Chain released{chain.head, kChainSize};
+      auto* last = chain.head;
+      for (std::size_t i = 1; i < kChainSize; ++i) last = last->next;
+      chain.head = last->next;
+      chain.size -= kChainSize;
+      last->next = nullptr;
+      GetGlobalPool().Push(size_class, released);
+    }
+
+    chain.head = new (block) FreeBlock{chain.head};
+    ++chain.size;
+  }
+
+ private:
+  std::array<Chain, kClassCount> lists_{};
+  bool is_alive_{true};
+};
+
+compiler::ThreadLocal local_cache = [] { return LocalCache{}; };
+
+}  // namespace
+
+void* PoolAllocate(std::size_t size) {
+  const auto size_class = kIsCachingEnabled ? GetSizeClass(size)
+                                            : kUncachedClass;
+  if (size_class == kUncachedClass) {
+    return AllocateFromSystem(size_class, size);
+  }
+
+  auto cache = local_cache.Use();
+  return cache->Allocate(size_class);
+}
+
+void PoolDeallocate(void* ptr) noexcept {
+  UASSERT(ptr);
+  auto* const header = static_cast<Header*>(ptr) - 1;
+  const auto size_class = header->size_class;
+  UASSERT(size_class <= kUncachedClass);
+  if (size_class == kUncachedClass) {
+    DeallocateToSystem(header);
+    return;
+  }
+
+  auto cache = local_cache.Use();
+  cache->Deallocate(size_class, header);
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,84 @@
+#include <userver/engine/impl/pool_allocator.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+bool IsAligned(const void* ptr) {
+  return reinterpret_cast<std::uintptr_t>(ptr) % engine::impl::kPoolAlignment ==
+         0;
+}
+
+}  // namespace
+
+TEST(PoolAllocator, Sizes) {
+  for (const std::size_t size : {1, 16, 128, 129, 700, 5000, 8192, 8193,
+                                 1024 * 1024}) {
+    void* const ptr = engine::impl::PoolAllocate(size);
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_TRUE(IsAligned(ptr));
+    std::memset(ptr, 0xAB, size);
+    engine::impl::PoolDeallocate(ptr);
+  }
+}
+
+TEST(PoolAllocator, ManyBlocks) {
+  constexpr std::size_t kCount = 1000;
+  std::vector<void*> blocks;
+  for (int round = 0; round < 3; ++round) {
+    for (std::size_t i = 0; i < kCount; ++i) {
+      auto* const block = static_cast<std::size_t*>(
+          engine::impl::PoolAllocate(sizeof(std::size_t) * (i % 5 + 1)));
+      *block = i;
+      blocks.push_back(block);
+    }
+    for (std::size_t i = 0; i < kCount; ++i) {
+      EXPECT_EQ(*static_cast<std::size_t*>(blocks[i]), i);
+      engine::impl::PoolDeallocate(blocks[i]);
+    }
+    blocks.clear();
+  }
+}
+
+TEST(PoolAllocator, CrossThread) {
+  constexpr std::size_t kCount = 10000;
+  std::vector<void*> blocks(kCount);
+
+  for (int round = 0; round < 3; ++round) {
+    std::thread([&blocks] {
+      for (auto& block : blocks) block = engine::impl::PoolAllocate(700);
+    }).join();
+
+    // Freed on another thread, most of the blocks go to the global pool
+    std::thread([&blocks] {
+      for (auto* block : blocks) engine::impl::PoolDeallocate(block);
+    }).join();
+  }
+}
+
+TEST(PoolAllocator, SharedPtr) {
+  struct Value final {
+    std::string string;
+    std::size_t number;
+  };
+
+  auto ptr = std::allocate_shared<Value>(
+      engine::impl::PoolAllocator<Value>{}, Value{"value", 42});
+  EXPECT_EQ(ptr->string, "value");
+  EXPECT_EQ(ptr->number, 42);
+
+  auto copy = ptr;
+  ptr.reset();
+  EXPECT_EQ(copy->number, 42);
+}
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,10 @@
 #include <userver/engine/impl/task_context_factory.hpp>
 
+#include <atomic>
+
 #include <engine/task/task_context.hpp>
+#include <engine/task/task_processor.hpp>
+#include <userver/engine/impl/pool_allocator.hpp>
 #include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -11,21 +15,113 @@ std::size_t GetTaskContextSize() noexcept { return sizeof(TaskContext); }
 
 static_assert(kTaskContextAlignment >= alignof(TaskContext));
 static_assert(sizeof(TaskContext) % kTaskContextAlignment == 0);
+static_assert(kPoolAlignment >= kTaskContextAlignment);
 
 TaskContext& PlacementNewTaskContext(std::byte* storage, TaskConfig config,
                                      utils::impl::WrappedCallBase& payload) {
-  return *new (storage) TaskContext{config.task_processor, config.importance,
-                                    config.wait_mode, config.deadline, payload};
+  return *new (storage)
+      TaskContext{config.task_processor, config.importance, config.wait_mode,
+                  config.deadline, config.priority, payload};
 }
 
 std::byte* AllocateFusedTaskContext(std::size_t total_size) {
-  return static_cast<std::byte*>(
-      ::operator new[](total_size, std::align_val_t{kTaskContextAlignment}));
+  return static_cast<std::byte*>(PoolAllocate(total_size));
 }
 
 void DeleteFusedTaskContext(std::byte* storage) noexcept {
   UASSERT(storage);
-  ::operator delete[](storage, std::align_val_t{kTaskContextAlignment});
+  PoolDeallocate(storage);
+}
+
+// The layout of the allocation is as follows:
+// 1. FusedTaskBatch
+// 2. `count` pointers to the TaskContexts for TaskProcessor::ScheduleBatch
+// 3. `count` slots of `slot_size` bytes, each holding a fused TaskContext
+class FusedTaskBatch final {
+ public:
+  FusedTaskBatch(std::size_t count, std::size_t slot_size)
+      : alive_slots_(count), count_(count), slot_size_(slot_size) {}
+
+  static std::size_t GetSlotsOffset(std::size_t count) noexcept {
+    const auto contexts_end = sizeof(FusedTaskBatch) + count * sizeof(void*);
+    return (contexts_end + kTaskContextAlignment - 1) / kTaskContextAlignment *
+           kTaskContextAlignment;
+  }
+
+  TaskContext** GetContexts() noexcept {
+    return reinterpret_cast<TaskContext**>(reinterpret_cast<std::byte*>(this) +
+                                           sizeof(FusedTaskBatch));
+  }
+
+  std::byte* GetSlot(std::size_t index) noexcept {
+    UASSERT(index < count_);
+    return reinterpret_cast<std::byte*>(this) + GetSlotsOffset(count_) +
+           index * slot_size_;
+  }
+
+  std::size_t GetCount() const noexcept { return count_; }
+
+  bool ReleaseSlots(std::size_t count) noexcept {
+    return alive_slots_.fetch_sub(count, std::memory_order_acq_rel) == count;
+  }
+
+ private:
+  std::atomic<std::size_t> alive_slots_;
+  const std::size_t count_;
+  const std::size_t slot_size_;
+};
+
+static_assert(alignof(FusedTaskBatch) <= kTaskContextAlignment);
+static_assert(sizeof(FusedTaskBatch) % alignof(TaskContext*) == 0);
+
+FusedTaskBatch& AllocateFusedTaskBatch(std::size_t count,
+                                       std::size_t slot_size) {
+  UASSERT(count > 0);
+  UASSERT(slot_size % kTaskContextAlignment == 0);
+  UASSERT(slot_size >= sizeof(TaskContext));
+
+  auto* const storage = AllocateFusedTaskContext(
+      FusedTaskBatch::GetSlotsOffset(count) + count * slot_size);
+  return *new (storage) FusedTaskBatch(count, slot_size);
+}
+
+std::byte* GetFusedTaskBatchSlot(FusedTaskBatch& batch,
+                                 std::size_t index) noexcept {
+  return batch.GetSlot(index);
+}
+
+void AttachToFusedTaskBatch(FusedTaskBatch& batch, std::size_t index,
+                            TaskContext& context) noexcept {
+  UASSERT(reinterpret_cast<std::byte*>(&context) == batch.GetSlot(index));
+  context.SetFusedTaskBatch(batch);
+  batch.GetContexts()[index] = &context;
+}
+
+void ScheduleFusedTaskBatch(FusedTaskBatch& batch, std::size_t count) noexcept {
+  UASSERT(count <= batch.GetCount());
+  if (count == 0) return;
+
+  auto* const contexts = batch.GetContexts();
+  std::size_t scheduled_count = 0;
+  for (std::size_t i = 0; i < count; ++i) {
+    if (contexts[i]->TryWakeupForBatch(TaskContext::WakeupSource::kBootstrap,
+                                       TaskContext::NoEpoch{})) {
+      contexts[scheduled_count++] = contexts[i];
+    }
+  }
+
+  // All the tasks of a batch share the TaskProcessor
+  contexts[0]->GetTaskProcessor().ScheduleBatch(
+      utils::span<TaskContext* const>{contexts, contexts + scheduled_count});
+  // NOTE: the tasks may be executed at this point
+}
+
+void ReleaseFusedTaskBatchSlots(FusedTaskBatch& batch,
+                                std::size_t count) noexcept {
+  if (count == 0 || !batch.ReleaseSlots(count)) return;
+
+  std::destroy_at(&batch);
+  DeleteFusedTaskContext(reinterpret_cast<std::byte*>(&batch));
 }
 
 }  // namespace engine::impl
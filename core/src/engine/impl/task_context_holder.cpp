@@ -18,6 +18,13 @@ TaskContextHolder TaskContextHolder::Adopt(TaskContext& context) noexcept {
       boost::intrusive_ptr<TaskContext>{&context, /*add_ref=*/false});
 }
 
+TaskContextHolder TaskContextHolder::AdoptDeferred(
+    TaskContext& context) noexcept {
+  auto result = Adopt(context);
+  result.is_bootstrap_deferred_ = true;
+  return result;
+}
+
 TaskContextHolder::~TaskContextHolder() = default;
 
 boost::intrusive_ptr<TaskContext>&& TaskContextHolder::Extract() && noexcept {
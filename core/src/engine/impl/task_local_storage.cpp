@@ -1,10 +1,9 @@
 #include <userver/engine/impl/task_local_storage.hpp>
 
 #include <fmt/format.h>
-#include <boost/intrusive/list.hpp>
 #include <boost/intrusive/list_hook.hpp>
 #include <boost/intrusive/slist.hpp>
-#include <boost/range/adaptor/reversed.hpp>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
 
 #include <engine/task/task_context.hpp>
 #include <userver/compiler/demangle.hpp>
@@ -47,10 +46,55 @@ using NormalDataList = boost::intrusive::slist<
     boost::intrusive::constant_time_size<false>, boost::intrusive::linear<true>,
     boost::intrusive::cache_last<false>>;
 
-using InheritedDataList = boost::intrusive::list<
-    DataPtr,
-    boost::intrusive::member_hook<DataPtr, ListHook, &DataPtr::list_hook>,
-    boost::intrusive::constant_time_size<false>>;
+// Pointers to the inherited variables. Spawned tasks share the table of the
+// parent, a shared table is copied before the modification. Thus an inherited
+// variable is copied by a pointer on a write only, and never by a value.
+class InheritedTable final {
+ public:
+  InheritedTable()
+      : data_(std::make_unique<InheritedDataBase*[]>(variable_count)) {}
+
+  InheritedTable(const InheritedTable& other) : InheritedTable() {
+    for (Key key = 0; key < variable_count; ++key) {
+      auto* const node = other.data_[key];
+      if (!node) continue;
+      node->AddRef();
+      data_[key] = node;
+    }
+  }
+
+  InheritedTable& operator=(const InheritedTable&) = delete;
+
+  ~InheritedTable() {
+    for (Key key = 0; key < variable_count; ++key) {
+      if (auto* const node = data_[key]) node->DeleteSelf();
+    }
+  }
+
+  InheritedDataBase* Get(Key key) const noexcept { return data_[key]; }
+
+  void Set(Key key, InheritedDataBase* node) noexcept { data_[key] = node; }
+
+  // Only the owning task can share the table further, so a table that is not
+  // shared stays so until the owner shares it
+  bool IsShared() const noexcept {
+    return ref_counter_.load(std::memory_order_acquire) != 1;
+  }
+
+  friend void intrusive_ptr_add_ref(InheritedTable* table) noexcept {
+    table->ref_counter_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  friend void intrusive_ptr_release(InheritedTable* table) noexcept {
+    if (table->ref_counter_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete table;
+    }
+  }
+
+ private:
+  std::atomic<std::size_t> ref_counter_{0};
+  const std::unique_ptr<InheritedDataBase*[]> data_;
+};
 
 }  // namespace
 
@@ -71,9 +115,12 @@ void ReportVariableNotSet(const std::type_info& type) {
 struct Storage::Impl final {
   std::unique_ptr<DataPtr[]> data;
   NormalDataList normal_data_storage;
-  InheritedDataList inherited_data_storage;
+  boost::intrusive_ptr<InheritedTable> inherited;
 
   void DoSetGeneric(Key key, DataBase& node);
+
+  // Copies the table if it is shared
+  InheritedTable& GetMutableInherited();
 };
 
 Storage::Storage() { utils::impl::AssertStaticRegistrationFinished(); }
@@ -91,68 +138,46 @@ Storage::~Storage() {
     impl_->normal_data_storage.pop_front_and_dispose(disposer);
   }
 
-  while (!impl_->inherited_data_storage.empty()) {
-    impl_->inherited_data_storage.pop_front_and_dispose(disposer);
-  }
+  impl_->inherited.reset();
 }
 
 void Storage::InheritFrom(Storage& other) {
   UASSERT(impl_->normal_data_storage.empty());
-  UASSERT(impl_->inherited_data_storage.empty());
+  UASSERT(!impl_->inherited);
 
-  if (!other.impl_->inherited_data_storage.empty() && !impl_->data) {
-    impl_->data = std::make_unique<DataPtr[]>(variable_count);
-  }
-
-  for (DataPtr& their_ptr :
-       other.impl_->inherited_data_storage | boost::adaptors::reversed) {
-    UASSERT(their_ptr.ptr);
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
-    auto& node = static_cast<InheritedDataBase&>(*their_ptr.ptr);
-
-    InheritNode(node);
-  }
+  impl_->inherited = other.impl_->inherited;
 }
 
 void Storage::InheritNodeIfExists(Storage& other, Key key) {
   UASSERT(key < variable_count);
 
   // we want to stop asap if there is nothing to copy
-  if (!other.impl_->data) {
+  if (!other.impl_->inherited) {
     return;
   }
-  auto& their_ptr = other.impl_->data[key];
-  if (!their_ptr.ptr) {
+  auto* const node = other.impl_->inherited->Get(key);
+  if (!node) {
     return;
   }
 
-  if (!impl_->data) {
-    impl_->data = std::make_unique<DataPtr[]>(variable_count);
-  }
-  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
-  auto& node = static_cast<InheritedDataBase&>(*their_ptr.ptr);
-
-  InheritNode(node);
-}
-
-void Storage::InheritNode(InheritedDataBase& node) {
-  UASSERT(node.GetKey() < variable_count);
-
-  auto& our_ptr = impl_->data[node.GetKey()];
-  UASSERT(!our_ptr.ptr);
-  our_ptr.ptr = &node;
-  impl_->inherited_data_storage.push_front(our_ptr);
-  node.AddRef();
+  auto& table = impl_->GetMutableInherited();
+  UASSERT(!table.Get(key));
+  node->AddRef();
+  table.Set(key, node);
 }
 
 void Storage::InitializeFrom(Storage&& other) noexcept {
   UASSERT(impl_->normal_data_storage.empty());
-  UASSERT(impl_->inherited_data_storage.empty());
+  UASSERT(!impl_->inherited);
   impl_ = std::move(other.impl_);
 }
 
-DataBase* Storage::GetGeneric(Key key) noexcept {
+DataBase* Storage::GetGeneric(Key key, VariableKind kind) noexcept {
   UASSERT(key < variable_count);
+  if (kind == VariableKind::kInherited) {
+    if (!impl_->inherited) return nullptr;
+    return impl_->inherited->Get(key);
+  }
   if (!impl_->data) return nullptr;
   return impl_->data[key].ptr;
 }
@@ -163,6 +188,15 @@ void Storage::Impl::DoSetGeneric(Key key, DataBase& node) {
   data[key].ptr = &node;
 }
 
+InheritedTable& Storage::Impl::GetMutableInherited() {
+  if (!inherited) {
+    inherited = new InheritedTable();
+  } else if (inherited->IsShared()) {
+    inherited = new InheritedTable(*inherited);
+  }
+  return *inherited;
+}
+
 void Storage::SetGeneric(Key key, NormalDataBase& node,
                          bool has_existing_variable) {
   impl_->DoSetGeneric(key, node);
@@ -172,24 +206,21 @@ void Storage::SetGeneric(Key key, NormalDataBase& node,
 }
 
 void Storage::SetGeneric(Key key, InheritedDataBase& node,
-                         bool has_existing_variable) {
-  impl_->DoSetGeneric(key, node);
-  if (!has_existing_variable) {
-    impl_->inherited_data_storage.push_front(impl_->data[key]);
-  }
+                         bool /*has_existing_variable*/) {
+  UASSERT(key < variable_count);
+  // The copy of a shared table holds a reference to the old variable, which
+  // is then released by the caller
+  impl_->GetMutableInherited().Set(key, &node);
 }
 
-void Storage::EraseInherited(Key key) noexcept {
+void Storage::EraseInherited(Key key) {
   UASSERT(key < variable_count);
-  if (!impl_->data) return;
+  if (!impl_->inherited) return;
 
-  auto& data_ptr = impl_->data[key];
-  auto* const data = data_ptr.ptr;
+  auto* const data = impl_->inherited->Get(key);
   if (!data) return;
 
-  data_ptr.ptr = nullptr;
-  impl_->inherited_data_storage.erase(
-      InheritedDataList::s_iterator_to(data_ptr));
+  impl_->GetMutableInherited().Set(key, nullptr);
   data->DeleteSelf();
 }
 
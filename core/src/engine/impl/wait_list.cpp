@@ -2,6 +2,7 @@
 
 #include <boost/intrusive/list.hpp>
 
+#include <engine/impl/wakeup_batch.hpp>
 #include <engine/task/task_context.hpp>
 
 #include <userver/utils/assert.hpp>
@@ -74,13 +75,13 @@ void WaitList::WakeupOne(Lock& lock) {
 
 void WaitList::WakeupAll(Lock& lock) {
   UASSERT(lock);
+  WakeupBatch batch;
   while (!waiting_contexts_->empty()) {
     boost::intrusive_ptr<impl::TaskContext> context(&waiting_contexts_->front(),
                                                     kAdopt);
     context->wait_list_hook.unlink();
 
-    context->Wakeup(impl::TaskContext::WakeupSource::kWaitList,
-                    impl::TaskContext::NoEpoch{});
+    batch.Wakeup(std::move(context));
   }
 }
 
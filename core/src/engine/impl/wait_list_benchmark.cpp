@@ -4,8 +4,12 @@
 #include <thread>
 
 #include <userver/engine/async.hpp>
+#include <userver/engine/condition_variable.hpp>
 #include <userver/engine/impl/task_context_holder.hpp>
+#include <userver/engine/mutex.hpp>
 #include <userver/engine/run_standalone.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/wait_all_checked.hpp>
 
 #include <engine/impl/wait_list.hpp>
 #include <engine/task/task_context.hpp>
@@ -197,4 +201,47 @@ BENCHMARK(wait_list_add_remove_contention_unbalanced)
     ->Unit(benchmark::kMillisecond)
     ->UseRealTime();
 
+// Measures the time from NotifyAll to the completion of all the waiters, that
+// are woken up by a single WaitList::WakeupAll.
+void wait_list_wakeup_all(benchmark::State& state) {
+  engine::RunStandalone(state.range(1), [&] {
+    const auto waiters_count = static_cast<std::size_t>(state.range(0));
+    engine::Mutex mutex;
+    engine::ConditionVariable cv;
+
+    for ([[maybe_unused]] auto _ : state) {
+      state.PauseTiming();
+      std::size_t waiting = 0;
+      bool notified = false;
+      std::vector<engine::TaskWithResult<void>> tasks;
+      tasks.reserve(waiters_count);
+      for (std::size_t i = 0; i < waiters_count; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([&] {
+          std::unique_lock lock(mutex);
+          ++waiting;
+          [[maybe_unused]] const bool success =
+              cv.Wait(lock, [&] { return notified; });
+        }));
+      }
+
+      // A waiter releases the mutex only once it is in the wait list
+      std::unique_lock lock(mutex);
+      while (waiting != waiters_count) {
+        lock.unlock();
+        engine::Yield();
+        lock.lock();
+      }
+      notified = true;
+      state.ResumeTiming();
+
+      cv.NotifyAll();
+      lock.unlock();
+      engine::WaitAllChecked(tasks);
+    }
+  });
+}
+BENCHMARK(wait_list_wakeup_all)
+    ->ArgsProduct({{8, 64, 512}, {1, 4}})
+    ->UseRealTime();
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,47 @@
+#include "wakeup_batch.hpp"
+
+#include <engine/task/task_context.hpp>
+#include <engine/task/task_processor.hpp>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/scope_guard.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+WakeupBatch::~WakeupBatch() { Flush(); }
+
+void WakeupBatch::Wakeup(boost::intrusive_ptr<TaskContext>&& context) {
+  UASSERT(context);
+  if (!context->TryWakeupForBatch(TaskContext::WakeupSource::kWaitList,
+                                  TaskContext::NoEpoch{})) {
+    return;
+  }
+
+  auto* const task_processor = &context->GetTaskProcessor();
+  if (size_ == kMaxBatchSize || task_processor != task_processor_) {
+    Flush();
+    task_processor_ = task_processor;
+  }
+  contexts_[size_++] = context.detach();
+}
+
+void WakeupBatch::Flush() {
+  if (size_ == 0) return;
+
+  const utils::span<TaskContext* const> contexts{contexts_.data(),
+                                                 contexts_.data() + size_};
+  utils::ScopeGuard release_guard([this, contexts] {
+    for (auto* const context : contexts) intrusive_ptr_release(context);
+    size_ = 0;
+  });
+
+  UASSERT(task_processor_);
+  task_processor_->ScheduleBatch(contexts);
+  // NOTE: the tasks may be executed at this point
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+class TaskProcessor;
+}  // namespace engine
+
+namespace engine::impl {
+
+class TaskContext;
+
+/// Collects the tasks woken up by a WaitList and pushes them into their
+/// task processor queues at once, instead of doing a separate push and a
+/// separate worker wakeup for each of them.
+///
+/// Tasks of the same TaskProcessor that follow each other are pushed together,
+/// everything is pushed on Flush() or destruction.
+class WakeupBatch final {
+ public:
+  WakeupBatch() noexcept = default;
+
+  WakeupBatch(const WakeupBatch&) = delete;
+  WakeupBatch& operator=(const WakeupBatch&) = delete;
+
+  ~WakeupBatch();
+
+  /// Same as context->Wakeup(WakeupSource::kWaitList, NoEpoch{}), but the
+  /// push into the task queue may be delayed until Flush().
+  void Wakeup(boost::intrusive_ptr<TaskContext>&& context);
+
+  void Flush();
+
+ private:
+  static constexpr std::size_t kMaxBatchSize = 64;
+
+  // Hold a reference each
+  std::array<TaskContext*, kMaxBatchSize> contexts_{};
+  std::size_t size_{0};
+  TaskProcessor* task_processor_{nullptr};
+};
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,7 @@
 #include "fd_control.hpp"
 
 #include <fcntl.h>
+#include <poll.h>
 #include <sys/resource.h>
 #include <unistd.h>
 
@@ -10,6 +11,7 @@
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 
 #include <engine/task/task_context.hpp>
 #include <utils/check_syscall.hpp>
@@ -41,6 +43,18 @@ int SetCloexec(int fd) {
   return fd;
 }
 
+unsigned GetPollEvents(FdPoller::Kind kind) {
+  switch (kind) {
+    case FdPoller::Kind::kRead:
+      return POLLIN;
+    case FdPoller::Kind::kWrite:
+      return POLLOUT;
+    case FdPoller::Kind::kReadWrite:
+      return POLLIN | POLLOUT;
+  }
+  UINVARIANT(false, "Invalid kind: " + std::to_string(static_cast<int>(kind)));
+}
+
 int ReduceSigpipe(int fd) {
 #ifdef F_SETNOSIGPIPE
   // may fail for all we care, SIGPIPE is ignored anyway
@@ -70,8 +84,31 @@ Direction::Direction(Kind kind, const ev::ThreadControl& control)
 
 Direction::~Direction() = default;
 
-bool Direction::Wait(Deadline deadline) {
-  return poller_.Wait(deadline).has_value();
+bool Direction::Wait(Deadline deadline) { return WaitReady(deadline); }
+
+bool Direction::WaitReady(Deadline deadline) {
+  auto* const reactor = UringReactor::GetForCurrentThread();
+  if (!reactor) return poller_.Wait(deadline).has_value();
+
+  const auto result = PerformUring(
+      *reactor,
+      {UringReactor::OpCode::kPoll, Fd(), nullptr, 0, GetPollEvents(kind_)},
+      deadline);
+  // Errors and hangups are reported by the subsequent syscall
+  return !result.is_interrupted || result.value > 0;
+}
+
+UringReactor::Result Direction::PerformUring(
+    UringReactor& reactor, const UringReactor::Request& request,
+    Deadline deadline) {
+  uring_reactor_.store(&reactor);
+  const utils::FastScopeGuard reset_guard(
+      [this]() noexcept { uring_reactor_.store(nullptr); });
+  return reactor.Perform(request, deadline);
+}
+
+void Direction::CancelUring() noexcept {
+  if (auto* const reactor = uring_reactor_.load()) reactor->CancelAll(Fd());
 }
 
 void Direction::ResetReady() noexcept { poller_.ResetReady(); }
@@ -113,6 +150,10 @@ void FdControl::Close() {
   if (!IsValid()) return;
   Invalidate();
 
+  // The in-flight io_uring operations hold the file open
+  read_.CancelUring();
+  write_.CancelUring();
+
   const auto fd = Fd();
   if (::close(fd) == -1) {
     const auto error_code = errno;
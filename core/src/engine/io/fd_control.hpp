@@ -12,6 +12,7 @@
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <engine/io/uring_reactor.hpp>
 #include <engine/task/task_context.hpp>
 #include <userver/engine/impl/wait_list_fwd.hpp>
 
@@ -82,12 +83,30 @@ class Direction final {
                    size_t len, TransferMode mode, Deadline deadline,
                    const Context&... context);
 
+  // Like PerformIo, but if the fd is not ready and the current worker has
+  // an io_uring reactor, submits the `op` itself instead of waiting for
+  // the readiness.
+  template <typename IoFunc, typename... Context>
+  size_t PerformCompletionIo(SingleUserGuard& guard, IoFunc&& io_func,
+                             UringReactor::OpCode op, unsigned op_flags,
+                             void* buf, size_t len, TransferMode mode,
+                             Deadline deadline, const Context&... context);
+
   template <typename IoFunc, typename... Context>
   size_t PerformIoV(SingleUserGuard& guard, IoFunc&& io_func,
                     struct iovec* list, std::size_t list_size,
                     TransferMode mode, Deadline deadline,
                     const Context&... context);
 
+  // Like PerformIo, but transfers an array of messages, e.g. with sendmmsg.
+  // (IoFunc*)(int, Message*, size_t) returns the number of transferred
+  // messages, the `bytes_transferred` of the exceptions counts messages too.
+  template <typename IoFunc, typename Message, typename... Context>
+  size_t PerformIoBatch(SingleUserGuard& guard, IoFunc&& io_func,
+                        Message* messages, std::size_t count,
+                        TransferMode mode, Deadline deadline,
+                        const Context&... context);
+
   engine::impl::ContextAccessor* TryGetContextAccessor() noexcept;
 
  private:
@@ -100,6 +119,20 @@ class Direction final {
   // does not notify
   void Invalidate();
 
+  // Waits with the io_uring reactor of the current worker if there is one
+  bool WaitReady(Deadline deadline);
+
+  UringReactor::Result PerformUring(UringReactor& reactor,
+                                    const UringReactor::Request& request,
+                                    Deadline deadline);
+
+  // Wakes up the io_uring operation in progress, if any
+  void CancelUring() noexcept;
+
+  template <typename... Context>
+  [[noreturn]] static void ThrowInterrupted(size_t processed_bytes,
+                                            const Context&... context);
+
   template <typename... Context>
   ErrorMode TryHandleError(int error_code, size_t processed_bytes,
                            TransferMode mode, Deadline deadline,
@@ -107,6 +140,8 @@ class Direction final {
 
   FdPoller poller_;
   Kind kind_;
+  // The reactor of the io_uring operation in progress
+  std::atomic<UringReactor*> uring_reactor_{nullptr};
 };
 
 class FdControl final {
@@ -141,6 +176,17 @@ class FdControl final {
   Direction write_;
 };
 
+template <typename... Context>
+void Direction::ThrowInterrupted(size_t processed_bytes,
+                                 const Context&... context) {
+  if (current_task::ShouldCancel()) {
+    throw(IoCancelled(/*bytes_transferred =*/processed_bytes)
+          << ... << context);
+  } else {
+    throw(IoTimeout(/*bytes_transferred =*/processed_bytes) << ... << context);
+  }
+}
+
 template <typename... Context>
 ErrorMode Direction::TryHandleError(int error_code, size_t processed_bytes,
                                     TransferMode mode, Deadline deadline,
@@ -159,14 +205,8 @@ ErrorMode Direction::TryHandleError(int error_code, size_t processed_bytes,
       throw(IoCancelled(/*bytes_transferred =*/processed_bytes)
             << ... << context);
     }
-    if (!poller_.Wait(deadline)) {
-      if (current_task::ShouldCancel()) {
-        throw(IoCancelled(/*bytes_transferred =*/processed_bytes)
-              << ... << context);
-      } else {
-        throw(IoTimeout(/*bytes_transferred =*/processed_bytes)
-              << ... << context);
-      }
+    if (!WaitReady(deadline)) {
+      ThrowInterrupted(processed_bytes, context...);
     }
     if (!IsValid()) {
       throw((IoException() << "Fd closed during ") << ... << context);
@@ -228,6 +268,28 @@ size_t Direction::PerformIoV(SingleUserGuard&, IoFunc&& io_func,
   return processed_bytes;
 }
 
+template <typename IoFunc, typename Message, typename... Context>
+size_t Direction::PerformIoBatch(SingleUserGuard&, IoFunc&& io_func,
+                                 Message* messages, std::size_t count,
+                                 TransferMode mode, Deadline deadline,
+                                 const Context&... context) {
+  std::size_t processed = 0;
+  while (processed < count) {
+    auto chunk_size = io_func(Fd(), messages + processed, count - processed);
+
+    if (chunk_size > 0) {
+      processed += chunk_size;
+      if (mode == TransferMode::kOnce) {
+        break;
+      }
+    } else if (!chunk_size || TryHandleError(errno, processed, mode, deadline,
+                                             context...) == ErrorMode::kFatal) {
+      break;
+    }
+  }
+  return processed;
+}
+
 template <typename IoFunc, typename... Context>
 size_t Direction::PerformIo(SingleUserGuard&, IoFunc&& io_func, void* buf,
                             size_t len, TransferMode mode, Deadline deadline,
@@ -253,6 +315,61 @@ size_t Direction::PerformIo(SingleUserGuard&, IoFunc&& io_func, void* buf,
   return pos - begin;
 }
 
+template <typename IoFunc, typename... Context>
+size_t Direction::PerformCompletionIo(SingleUserGuard&, IoFunc&& io_func,
+                                      UringReactor::OpCode op,
+                                      unsigned op_flags, void* buf, size_t len,
+                                      TransferMode mode, Deadline deadline,
+                                      const Context&... context) {
+  char* const begin = static_cast<char*>(buf);
+  char* const end = begin + len;
+
+  char* pos = begin;
+
+  while (pos < end) {
+    // Optimistic path, the data is often already there
+    auto chunk_size = io_func(Fd(), pos, end - pos);
+    bool is_interrupted = false;
+
+    if (chunk_size < 0 && (errno == EWOULDBLOCK || errno == EAGAIN)) {
+      auto* const reactor = UringReactor::GetForCurrentThread();
+      if (reactor && (pos == begin || mode == TransferMode::kWhole)) {
+        if (current_task::ShouldCancel()) {
+          throw(IoCancelled(/*bytes_transferred =*/pos - begin)
+                << ... << context);
+        }
+        const auto result = PerformUring(
+            *reactor, {op, Fd(), pos, static_cast<size_t>(end - pos), op_flags},
+            deadline);
+        chunk_size = result.value;
+        is_interrupted = result.is_interrupted;
+        if (chunk_size < 0) {
+          if (!IsValid()) {
+            throw((IoException() << "Fd closed during ") << ... << context);
+          }
+          if (is_interrupted) ThrowInterrupted(pos - begin, context...);
+          errno = -chunk_size;
+        }
+      }
+    }
+
+    if (chunk_size > 0) {
+      pos += chunk_size;
+      if (mode == TransferMode::kOnce) {
+        break;
+      }
+      if (is_interrupted) {
+        if (pos == end) break;
+        ThrowInterrupted(pos - begin, context...);
+      }
+    } else if (!chunk_size || TryHandleError(errno, pos - begin, mode, deadline,
+                                             context...) == ErrorMode::kFatal) {
+      break;
+    }
+  }
+  return pos - begin;
+}
+
 }  // namespace engine::io::impl
 
 USERVER_NAMESPACE_END
@@ -2,9 +2,15 @@
 
 #include <unistd.h>
 
+#include <userver/engine/async.hpp>
 #include <userver/engine/run_standalone.hpp>
+#include <userver/utils/function_ref.hpp>
 #include <utils/check_syscall.hpp>
 
+#include <engine/impl/standalone.hpp>
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+
 #include "fd_control.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -30,6 +36,47 @@ namespace io = engine::io;
 using Deadline = engine::Deadline;
 using FdControl = io::impl::FdControl;
 
+// See the `io-backend` option of the task processor config
+template <engine::IoBackend IoBackend>
+void RunWithIoBackend(benchmark::State& state,
+                      utils::function_ref<void()> payload) {
+  if (IoBackend == engine::IoBackend::kIoUring &&
+      !io::impl::UringReactor::IsSupported()) {
+    state.SkipWithError("io_uring is not supported");
+    return;
+  }
+
+  engine::TaskProcessorConfig config;
+  config.name = "benchmark";
+  config.thread_name = "bench-worker";
+  config.worker_threads = 1;
+  config.io_backend = IoBackend;
+
+  engine::impl::TaskProcessorHolder task_processor{
+      std::make_unique<engine::TaskProcessor>(
+          std::move(config), engine::impl::MakeTaskProcessorPools({}))};
+  engine::impl::RunOnTaskProcessorSync(*task_processor, payload);
+}
+
+// Passes a byte back and forth, each side waits for the readiness of its pipe
+void PingPong(FdControl& in, FdControl& out) {
+  char byte = 0;
+  auto& read_dir = in.Read();
+  auto& write_dir = out.Write();
+  io::impl::Direction::SingleUserGuard read_guard(read_dir);
+  io::impl::Direction::SingleUserGuard write_guard(write_dir);
+  while (read_dir.PerformIo(read_guard, &::read, &byte, 1,
+                            io::impl::TransferMode::kWhole, {}, "ping")) {
+    if (!byte) break;
+    [[maybe_unused]] auto written = write_dir.PerformIo(
+        write_guard, &::write, &byte, 1, io::impl::TransferMode::kWhole, {},
+        "pong");
+  }
+}
+
+constexpr auto kLibev = engine::IoBackend::kLibev;
+constexpr auto kIoUring = engine::IoBackend::kIoUring;
+
 }  // namespace
 
 void fd_control_destroy(benchmark::State& state) {
@@ -94,4 +141,40 @@ void fd_control_construct_wait_destroy(benchmark::State& state) {
 }
 BENCHMARK(fd_control_construct_wait_destroy);
 
+template <engine::IoBackend IoBackend>
+void fd_control_ping_pong(benchmark::State& state) {
+  RunWithIoBackend<IoBackend>(state, [&] {
+    Pipe ping;
+    Pipe pong;
+    auto ping_in = FdControl::Adopt(ping.ExtractIn());
+    auto ping_out = FdControl::Adopt(ping.ExtractOut());
+    auto pong_in = FdControl::Adopt(pong.ExtractIn());
+    auto pong_out = FdControl::Adopt(pong.ExtractOut());
+
+    auto echo = engine::AsyncNoSpan([&] { PingPong(*ping_in, *pong_out); });
+
+    auto& write_dir = ping_out->Write();
+    auto& read_dir = pong_in->Read();
+    io::impl::Direction::SingleUserGuard write_guard(write_dir);
+    io::impl::Direction::SingleUserGuard read_guard(read_dir);
+    char byte = 1;
+    for ([[maybe_unused]] auto _ : state) {
+      [[maybe_unused]] auto written =
+          write_dir.PerformIo(write_guard, &::write, &byte, 1,
+                              io::impl::TransferMode::kWhole, {}, "ping");
+      [[maybe_unused]] auto read =
+          read_dir.PerformIo(read_guard, &::read, &byte, 1,
+                             io::impl::TransferMode::kWhole, {}, "pong");
+    }
+
+    byte = 0;
+    [[maybe_unused]] auto written =
+        write_dir.PerformIo(write_guard, &::write, &byte, 1,
+                            io::impl::TransferMode::kWhole, {}, "stop");
+    echo.Get();
+  });
+}
+BENCHMARK_TEMPLATE(fd_control_ping_pong, kLibev);
+BENCHMARK_TEMPLATE(fd_control_ping_pong, kIoUring);
+
 USERVER_NAMESPACE_END
@@ -130,7 +130,8 @@ engine::impl::TaskContext::WakeupSource FdPoller::Impl::DoWait(
   auto& current = current_task::GetCurrentTaskContext();
 
   engine::impl::FutureWaitStrategy wait_strategy{*this, current};
-  auto ret = current.Sleep(wait_strategy, deadline);
+  auto ret =
+      current.Sleep(wait_strategy, deadline, engine::impl::WaitKind::kIo);
 
   /*
    * Manually call Stop() here to be sure that after DoWait() no waiter_'s
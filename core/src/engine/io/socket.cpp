@@ -5,6 +5,8 @@
 #include <sys/uio.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <array>
 #include <cerrno>
 #include <string>
 #include <vector>
@@ -60,13 +62,15 @@ Sockaddr& MemoizeAddr(Sockaddr& addr, decltype(&::getpeername) getter,
   return ::recv(fd, buf, len, 0);
 }
 
-[[nodiscard]] ssize_t SendWrapper(int fd, const void* buf, size_t len) {
-  return ::send(fd, buf, len,
 // MAC_COMPAT: does not support MSG_NOSIGNAL
 #ifdef MSG_NOSIGNAL
-                MSG_NOSIGNAL |
+constexpr int kSendFlags = MSG_NOSIGNAL;
+#else
+constexpr int kSendFlags = 0;
 #endif
-                    0);
+
+[[nodiscard]] ssize_t SendWrapper(int fd, const void* buf, size_t len) {
+  return ::send(fd, buf, len, kSendFlags);
 }
 
 class RecvFromWrapper {
@@ -93,19 +97,112 @@ class SendToWrapper {
   SendToWrapper(const Sockaddr& dest_addr) : dest_addr_(dest_addr) {}
 
   [[nodiscard]] ssize_t operator()(int fd, const void* buf, size_t len) const {
-    return ::sendto(fd, buf, len,
-// MAC_COMPAT: does not support MSG_NOSIGNAL
-#ifdef MSG_NOSIGNAL
-                    MSG_NOSIGNAL |
-#endif
-                        0,
-                    dest_addr_.Data(), dest_addr_.Size());
+    return ::sendto(fd, buf, len, kSendFlags, dest_addr_.Data(),
+                    dest_addr_.Size());
   }
 
  private:
   const Sockaddr& dest_addr_;
 };
 
+void CheckDomain(AddrDomain socket_domain, const Sockaddr& addr) {
+  if (addr.Domain() != socket_domain) {
+    throw AddrException(fmt::format(
+        "Socket address domain ({}) does not match address domain ({})",
+        static_cast<int>(socket_domain), static_cast<int>(addr.Domain())));
+  }
+}
+
+void CheckSourceAddrlen(const Sockaddr& src_addr, socklen_t addrlen) {
+  if (addrlen > src_addr.Capacity()) {
+    throw IoException() << "Peer address does not fit into AddrStorage, family="
+                        << src_addr.Data()->sa_family
+                        << ", addrlen=" << addrlen;
+  }
+}
+
+// IoFunc wrappers for Direction::PerformIoBatch, a syscall per datagram
+// without sendmmsg and recvmmsg
+
+[[nodiscard]] ssize_t SendManyWrapper(int fd,
+                                      const Socket::SendDatagram* datagrams,
+                                      std::size_t count) {
+#ifdef HAVE_SENDMMSG
+  count = std::min(count, kMaxStackSizeVector);
+  std::array<struct ::mmsghdr, kMaxStackSizeVector> messages{};
+  std::array<struct ::iovec, kMaxStackSizeVector> data{};
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto& datagram = datagrams[i];
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    data[i].iov_base = const_cast<void*>(datagram.data.data);
+    data[i].iov_len = datagram.data.len;
+
+    auto& header = messages[i].msg_hdr;
+    header.msg_iov = &data[i];
+    header.msg_iovlen = 1;
+    if (datagram.dest_addr) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      header.msg_name =
+          const_cast<struct sockaddr*>(datagram.dest_addr->Data());
+      header.msg_namelen = datagram.dest_addr->Size();
+    }
+  }
+  return ::sendmmsg(fd, messages.data(), count, kSendFlags);
+#else
+  const auto& datagram = *datagrams;
+  UASSERT(count > 0);
+  const auto ret = datagram.dest_addr
+                       ? ::sendto(fd, datagram.data.data, datagram.data.len,
+                                  kSendFlags, datagram.dest_addr->Data(),
+                                  datagram.dest_addr->Size())
+                       : ::send(fd, datagram.data.data, datagram.data.len,
+                                kSendFlags);
+  return ret < 0 ? ret : 1;
+#endif
+}
+
+[[nodiscard]] ssize_t RecvManyWrapper(int fd, Socket::RecvDatagram* datagrams,
+                                      std::size_t count) {
+#ifdef HAVE_RECVMMSG
+  count = std::min(count, kMaxStackSizeVector);
+  std::array<struct ::mmsghdr, kMaxStackSizeVector> messages{};
+  std::array<struct ::iovec, kMaxStackSizeVector> data{};
+  for (std::size_t i = 0; i < count; ++i) {
+    auto& datagram = datagrams[i];
+    data[i].iov_base = datagram.buf;
+    data[i].iov_len = datagram.len;
+
+    auto& header = messages[i].msg_hdr;
+    header.msg_iov = &data[i];
+    header.msg_iovlen = 1;
+    header.msg_name = datagram.src_addr.Data();
+    header.msg_namelen = datagram.src_addr.Capacity();
+  }
+
+  const auto ret = ::recvmmsg(fd, messages.data(), count, 0, nullptr);
+  for (int i = 0; i < ret; ++i) {
+    auto& datagram = datagrams[i];
+    const auto& header = messages[i].msg_hdr;
+    CheckSourceAddrlen(datagram.src_addr, header.msg_namelen);
+    datagram.bytes_received = messages[i].msg_len;
+    datagram.is_truncated = header.msg_flags & MSG_TRUNC;
+  }
+  return ret;
+#else
+  auto& datagram = *datagrams;
+  UASSERT(count > 0);
+  socklen_t addrlen = datagram.src_addr.Capacity();
+  // MSG_TRUNC makes Linux return the real size of the datagram
+  const auto ret = ::recvfrom(fd, datagram.buf, datagram.len, MSG_TRUNC,
+                              datagram.src_addr.Data(), &addrlen);
+  if (ret < 0) return ret;
+  CheckSourceAddrlen(datagram.src_addr, addrlen);
+  datagram.is_truncated = static_cast<std::size_t>(ret) > datagram.len;
+  datagram.bytes_received = std::min<std::size_t>(ret, datagram.len);
+  return 1;
+#endif
+}
+
 void FillIoSendData(const IoData* data, struct iovec* dst, std::size_t count) {
   UASSERT(data);
   UASSERT(count > 0);
@@ -226,8 +323,10 @@ size_t Socket::RecvSome(void* buf, size_t len, Deadline deadline) {
   auto& dir = fd_control_->Read();
   dir.ResetReady();
   impl::Direction::SingleUserGuard guard(dir);
-  return dir.PerformIo(guard, &RecvWrapper, buf, len, impl::TransferMode::kOnce,
-                       deadline, "RecvSome from ", peername_);
+  return dir.PerformCompletionIo(guard, &RecvWrapper,
+                                 impl::UringReactor::OpCode::kRecv, 0, buf, len,
+                                 impl::TransferMode::kOnce, deadline,
+                                 "RecvSome from ", peername_);
 }
 
 size_t Socket::RecvAll(void* buf, size_t len, Deadline deadline) {
@@ -237,9 +336,10 @@ size_t Socket::RecvAll(void* buf, size_t len, Deadline deadline) {
   auto& dir = fd_control_->Read();
   dir.ResetReady();
   impl::Direction::SingleUserGuard guard(dir);
-  return dir.PerformIo(guard, &RecvWrapper, buf, len,
-                       impl::TransferMode::kWhole, deadline, "RecvAll from ",
-                       peername_);
+  return dir.PerformCompletionIo(guard, &RecvWrapper,
+                                 impl::UringReactor::OpCode::kRecv, 0, buf, len,
+                                 impl::TransferMode::kWhole, deadline,
+                                 "RecvAll from ", peername_);
 }
 
 size_t Socket::SendAll(std::initializer_list<IoData> list, Deadline deadline) {
@@ -286,9 +386,10 @@ size_t Socket::SendAll(const void* buf, size_t len, Deadline deadline) {
   dir.ResetReady();
   impl::Direction::SingleUserGuard guard(dir);
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-  return dir.PerformIo(guard, &SendWrapper, const_cast<void*>(buf), len,
-                       impl::TransferMode::kWhole, deadline, "SendAll to ",
-                       peername_);
+  return dir.PerformCompletionIo(
+      guard, &SendWrapper, impl::UringReactor::OpCode::kSend, kSendFlags,
+      const_cast<void*>(buf), len, impl::TransferMode::kWhole, deadline,
+      "SendAll to ", peername_);
 }
 
 Socket::RecvFromResult Socket::RecvSomeFrom(void* buf, size_t len,
@@ -330,6 +431,48 @@ size_t Socket::SendAllTo(const Sockaddr& dest_addr, const void* buf, size_t len,
                        "SendAllTo to ", dest_addr);
 }
 
+size_t Socket::SendMany(const SendDatagram* datagrams, size_t count,
+                        Deadline deadline) {
+  if (!IsValid()) {
+    throw IoException("Attempt to SendMany to closed socket");
+  }
+  UASSERT(datagrams || !count);
+  for (size_t i = 0; i < count; ++i) {
+    if (datagrams[i].dest_addr) CheckDomain(domain_, *datagrams[i].dest_addr);
+  }
+  if (!count) return 0;
+
+  auto& dir = fd_control_->Write();
+  dir.ResetReady();
+  impl::Direction::SingleUserGuard guard(dir);
+  return dir.PerformIoBatch(guard, &SendManyWrapper, datagrams, count,
+                            impl::TransferMode::kWhole, deadline, "SendMany");
+}
+
+size_t Socket::RecvMany(RecvDatagram* datagrams, size_t count,
+                        Deadline deadline) {
+  if (!IsValid()) {
+    throw IoException("Attempt to RecvMany from closed socket");
+  }
+  UASSERT(datagrams || !count);
+  if (!count) return 0;
+
+  auto& dir = fd_control_->Read();
+  dir.ResetReady();
+  impl::Direction::SingleUserGuard guard(dir);
+  auto received =
+      dir.PerformIoBatch(guard, &RecvManyWrapper, datagrams, count,
+                         impl::TransferMode::kOnce, deadline, "RecvMany");
+  // Picks up the datagrams that are already there
+  while (received < count) {
+    const auto ret =
+        RecvManyWrapper(dir.Fd(), datagrams + received, count - received);
+    if (ret <= 0) break;
+    received += ret;
+  }
+  return received;
+}
+
 Socket Socket::Accept(Deadline deadline) {
   if (!IsValid()) {
     throw IoException("Attempt to Accept from closed socket");
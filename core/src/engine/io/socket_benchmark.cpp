@@ -2,7 +2,10 @@
 
 #include <array>
 #include <chrono>
+#include <cstdint>
+#include <functional>
 #include <string>
+#include <vector>
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/condition_variable.hpp>
@@ -12,8 +15,15 @@
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/internal/net/net_listener.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/function_ref.hpp>
+
+#include <engine/impl/standalone.hpp>
+#include <engine/io/uring_reactor.hpp>
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -23,6 +33,34 @@ namespace {
 
 constexpr auto kDeadlineMaxTime = std::chrono::seconds{60};
 
+// Compares waiting for I/O on the ev threads with the io_uring reactors and
+// the ev loops of the workers, see the `io-backend` and `ev-loops-in-workers`
+// options of the task processor config.
+template <engine::IoBackend IoBackend, bool EvLoopsInWorkers = false>
+void RunWithIoBackend(benchmark::State& state, std::size_t worker_threads,
+                      utils::function_ref<void()> payload) {
+  if (IoBackend == engine::IoBackend::kIoUring &&
+      !engine::io::impl::UringReactor::IsSupported()) {
+    state.SkipWithError("io_uring is not supported");
+    return;
+  }
+
+  engine::TaskProcessorConfig config;
+  config.name = "benchmark";
+  config.thread_name = "bench-worker";
+  config.worker_threads = worker_threads;
+  config.io_backend = IoBackend;
+  config.ev_loops_in_workers = EvLoopsInWorkers;
+
+  engine::impl::TaskProcessorHolder task_processor{
+      std::make_unique<engine::TaskProcessor>(
+          std::move(config), engine::impl::MakeTaskProcessorPools({}))};
+  engine::impl::RunOnTaskProcessorSync(*task_processor, payload);
+}
+
+constexpr auto kLibev = engine::IoBackend::kLibev;
+constexpr auto kIoUring = engine::IoBackend::kIoUring;
+
 }  // namespace
 
 void socket_send_all(benchmark::State& state) {
@@ -138,4 +176,114 @@ BENCHMARK(socket_send_all_v);
 // TODO(TAXICOMMON-5510) flaky, sometimes throws engine::io::IoTimeout
 // BENCHMARK(socket_send_all_range)->RangeMultiplier(10)->Range(10, 10000);
 
+// Sends the datagrams one by one with SendAllTo or in batches with SendMany,
+// the receiver drains them with RecvMany
+template <bool IsBatched>
+void socket_udp_send(benchmark::State& state) {
+  engine::RunStandalone(2, [&] {
+    const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
+    const auto batch_size = static_cast<std::size_t>(state.range(0));
+    internal::net::UdpListener listener;
+    engine::io::Socket client{listener.addr.Domain(),
+                              internal::net::UdpListener::kType};
+    std::atomic<bool> reading{true};
+    auto task_reader = engine::AsyncNoSpan([&] {
+      std::array<std::array<char, 64>, 32> buffers{};
+      std::array<engine::io::Socket::RecvDatagram, 32> datagrams{};
+      for (std::size_t i = 0; i < datagrams.size(); ++i) {
+        datagrams[i].buf = buffers[i].data();
+        datagrams[i].len = buffers[i].size();
+      }
+      while (reading) {
+        try {
+          [[maybe_unused]] auto received = listener.socket.RecvMany(
+              datagrams.data(), datagrams.size(),
+              Deadline::FromDuration(std::chrono::milliseconds{100}));
+        } catch (const engine::io::IoTimeout&) {
+        }
+      }
+    });
+
+    const std::string payload(32, 'a');
+    const std::vector<engine::io::Socket::SendDatagram> datagrams(
+        batch_size, {{payload.data(), payload.size()}, &listener.addr});
+    for ([[maybe_unused]] auto _ : state) {
+      if constexpr (IsBatched) {
+        [[maybe_unused]] auto sent =
+            client.SendMany(datagrams.data(), datagrams.size(), test_deadline);
+      } else {
+        for (const auto& datagram : datagrams) {
+          [[maybe_unused]] auto sent =
+              client.SendAllTo(listener.addr, datagram.data.data,
+                               datagram.data.len, test_deadline);
+        }
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * batch_size);
+
+    reading = false;
+    task_reader.Get();
+  });
+}
+BENCHMARK_TEMPLATE(socket_udp_send, false)->RangeMultiplier(4)->Range(1, 64);
+BENCHMARK_TEMPLATE(socket_udp_send, true)->RangeMultiplier(4)->Range(1, 64);
+
+// Every round trip waits for the readiness of the sockets, the ping-pong
+// pairs run in parallel to let the io_uring reactors batch the submissions.
+template <engine::IoBackend IoBackend, bool EvLoopsInWorkers = false>
+void socket_ping_pong(benchmark::State& state) {
+  RunWithIoBackend<IoBackend, EvLoopsInWorkers>(state, state.range(0), [&] {
+    const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
+    const auto pairs_count = state.range(1);
+    internal::net::TcpListener listener;
+    std::vector<engine::TaskWithResult<void>> echo_tasks;
+    std::vector<engine::io::Socket> clients;
+    for (std::int64_t i = 0; i < pairs_count; ++i) {
+      auto [server, client] = listener.MakeSocketPair(test_deadline);
+      clients.push_back(std::move(client));
+      echo_tasks.push_back(engine::AsyncNoSpan(
+          [test_deadline](auto&& server) {
+            std::array<char, 16> buf{};
+            while (const auto size =
+                       server.RecvSome(buf.data(), buf.size(), test_deadline)) {
+              [[maybe_unused]] auto sent =
+                  server.SendAll(buf.data(), size, test_deadline);
+            }
+          },
+          std::move(server)));
+    }
+
+    auto round_trip = [test_deadline](engine::io::Socket& client) {
+      std::array<char, 4> buf{'p', 'i', 'n', 'g'};
+      [[maybe_unused]] auto sent =
+          client.SendAll(buf.data(), buf.size(), test_deadline);
+      [[maybe_unused]] auto received =
+          client.RecvAll(buf.data(), buf.size(), test_deadline);
+    };
+
+    std::vector<engine::TaskWithResult<void>> round_trips(pairs_count - 1);
+    for ([[maybe_unused]] auto _ : state) {
+      for (std::int64_t i = 1; i < pairs_count; ++i) {
+        round_trips[i - 1] =
+            engine::AsyncNoSpan(round_trip, std::ref(clients[i]));
+      }
+      round_trip(clients[0]);
+      for (auto& task : round_trips) task.Get();
+    }
+    state.SetItemsProcessed(state.iterations() * pairs_count);
+
+    clients.clear();
+    for (auto& task : echo_tasks) task.Get();
+  });
+}
+BENCHMARK_TEMPLATE(socket_ping_pong, kLibev)
+    ->ArgsProduct({{1, 4}, {1, 16}})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(socket_ping_pong, kIoUring)
+    ->ArgsProduct({{1, 4}, {1, 16}})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE2(socket_ping_pong, kLibev, /*EvLoopsInWorkers=*/true)
+    ->ArgsProduct({{1, 4}, {1, 16}})
+    ->UseRealTime();
+
 USERVER_NAMESPACE_END
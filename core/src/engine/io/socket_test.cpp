@@ -442,6 +442,51 @@ UTEST(Socket, DgramUnbound) {
   listen_task.Get();
 }
 
+UTEST(Socket, DgramMany) {
+  const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  UdpListener listener;
+  auto& server = listener.socket;
+  engine::io::Socket client{listener.addr.Domain(), UdpListener::kType};
+
+  const std::array<io::Socket::SendDatagram, 3> datagrams{{
+      {{"1", 1}, &listener.addr},
+      {{"22", 2}, &listener.addr},
+      {{"333", 3}, &listener.addr},
+  }};
+  EXPECT_EQ(3, client.SendMany(datagrams.data(), datagrams.size(),
+                               test_deadline));
+
+  std::array<std::array<char, 2>, 4> buffers{};
+  std::array<io::Socket::RecvDatagram, 4> received{};
+  for (std::size_t i = 0; i < received.size(); ++i) {
+    received[i].buf = buffers[i].data();
+    received[i].len = buffers[i].size();
+  }
+  ASSERT_EQ(3, server.RecvMany(received.data(), received.size(),
+                               test_deadline));
+
+  EXPECT_EQ("1", std::string_view(buffers[0].data(),
+                                   received[0].bytes_received));
+  EXPECT_FALSE(received[0].is_truncated);
+  EXPECT_EQ("22", std::string_view(buffers[1].data(),
+                                    received[1].bytes_received));
+  EXPECT_FALSE(received[1].is_truncated);
+  EXPECT_EQ("33", std::string_view(buffers[2].data(),
+                                    received[2].bytes_received));
+  EXPECT_TRUE(received[2].is_truncated);
+  EXPECT_EQ(client.Getsockname().Port(), received[0].src_addr.Port());
+
+  // Replies to the connected peer
+  client.Connect(listener.addr, test_deadline);
+  server.Connect(received[0].src_addr, test_deadline);
+  const io::Socket::SendDatagram reply{{"4", 1}, nullptr};
+  EXPECT_EQ(1, server.SendMany(&reply, 1, test_deadline));
+  EXPECT_EQ(1, client.RecvMany(received.data(), received.size(),
+                               test_deadline));
+  EXPECT_EQ('4', buffers[0][0]);
+}
+
 UTEST_MT(Socket, ConcurrentReadWriteUdp, 2) {
   const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
 
@@ -0,0 +1,367 @@
+#include <userver/engine/io/tls_server_sessions.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+
+#include <fmt/format.h>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+#include <openssl/ssl.h>
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+#include <openssl/core_names.h>
+#else
+#include <openssl/hmac.h>
+#endif
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/crypto/openssl.hpp>
+#include <userver/engine/io/exception.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/datetime/steady_coarse_clock.hpp>
+#include <userver/utils/fixed_array.hpp>
+
+#include <crypto/helpers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io {
+namespace {
+
+constexpr std::size_t kShards = 16;
+constexpr std::string_view kSessionIdContext = "userver-tls-server";
+
+struct TicketKeyData final {
+  std::array<unsigned char, 16> name{};
+  std::array<unsigned char, 32> hmac_key{};
+  std::array<unsigned char, 32> aes_key{};
+};
+
+static_assert(sizeof(TicketKeyData) == TlsServerSessions::kTicketKeySize);
+
+TicketKeyData ParseTicketKey(std::string_view key) {
+  if (key.size() != TlsServerSessions::kTicketKeySize) {
+    throw std::invalid_argument(
+        fmt::format("TLS ticket key must be {} bytes long, got {} bytes",
+                    TlsServerSessions::kTicketKeySize, key.size()));
+  }
+  TicketKeyData result;
+  std::memcpy(result.name.data(), key.data(), result.name.size());
+  key.remove_prefix(result.name.size());
+  std::memcpy(result.hmac_key.data(), key.data(), result.hmac_key.size());
+  key.remove_prefix(result.hmac_key.size());
+  std::memcpy(result.aes_key.data(), key.data(), result.aes_key.size());
+  return result;
+}
+
+TicketKeyData MakeRandomTicketKey() {
+  crypto::Openssl::Init();
+
+  TicketKeyData result;
+  if (1 != RAND_bytes(reinterpret_cast<unsigned char*>(&result),
+                      sizeof(result))) {
+    throw TlsException(
+        crypto::FormatSslError("Failed to generate a TLS ticket key"));
+  }
+  return result;
+}
+
+struct CachedSession final {
+  std::string der;
+  utils::datetime::SteadyCoarseClock::time_point expires_at;
+};
+
+struct SessionCacheShard final {
+  explicit SessionCacheShard(std::size_t max_size) : sessions(max_size) {}
+
+  engine::Mutex mutex;
+  cache::LruMap<std::string, CachedSession> sessions;
+};
+
+}  // namespace
+
+class TlsServerSessions::Impl final {
+ public:
+  explicit Impl(Settings settings)
+      : settings_(settings),
+        shards_(kShards, std::max<std::size_t>(
+                             settings.cache_size / kShards, std::size_t{1})),
+        random_ticket_key_(MakeRandomTicketKey()) {}
+
+  static Impl& Get(SSL* ssl) noexcept {
+    auto* impl = static_cast<Impl*>(SSL_CTX_get_app_data(SSL_get_SSL_CTX(ssl)));
+    UASSERT(impl);
+    return *impl;
+  }
+
+  const Settings& GetSettings() const noexcept { return settings_; }
+
+  void SetTicketKeys(const std::vector<TicketKey>& keys) {
+    std::vector<TicketKeyData> parsed_keys;
+    parsed_keys.reserve(keys.size());
+    for (const auto& key : keys) {
+      parsed_keys.push_back(ParseTicketKey(key.GetUnderlying()));
+    }
+    ticket_keys_.Assign(std::move(parsed_keys));
+  }
+
+  void StoreSession(std::string id, std::string der) {
+    auto& shard = GetShard(id);
+    const std::lock_guard lock{shard.mutex};
+    shard.sessions.Put(
+        std::move(id),
+        {std::move(der),
+         utils::datetime::SteadyCoarseClock::now() +
+             settings_.session_timeout});
+  }
+
+  std::optional<std::string> FindSession(const std::string& id) {
+    auto& shard = GetShard(id);
+    {
+      const std::lock_guard lock{shard.mutex};
+      auto* session = shard.sessions.Get(id);
+      if (session &&
+          session->expires_at > utils::datetime::SteadyCoarseClock::now()) {
+        ++cache_hits_;
+        return session->der;
+      }
+      if (session) shard.sessions.Erase(id);
+    }
+    ++cache_misses_;
+    return std::nullopt;
+  }
+
+  void EraseSession(const std::string& id) {
+    auto& shard = GetShard(id);
+    const std::lock_guard lock{shard.mutex};
+    shard.sessions.Erase(id);
+  }
+
+  // Calls func(key, is_current) with the key for the new tickets if the name
+  // is nullptr, with the key of the name otherwise. Returns 0 for the unknown
+  // names.
+  template <typename Func>
+  int WithTicketKey(const unsigned char* name, Func&& func) {
+    const auto keys = ticket_keys_.Read();
+    if (!name) {
+      return func(keys->empty() ? random_ticket_key_ : keys->front(), true);
+    }
+
+    const auto has_name = [name](const TicketKeyData& key) {
+      return std::memcmp(key.name.data(), name, key.name.size()) == 0;
+    };
+    const auto it = std::find_if(keys->begin(), keys->end(), has_name);
+    if (it != keys->end()) return func(*it, it == keys->begin());
+    // The tickets issued before the keys were set
+    if (has_name(random_ticket_key_)) {
+      return func(random_ticket_key_, keys->empty());
+    }
+
+    ++unknown_ticket_keys_;
+    return 0;
+  }
+
+  void AccountHandshake(bool is_resumed) noexcept {
+    ++(is_resumed ? resumed_handshakes_ : full_handshakes_);
+  }
+
+  Stats GetStats() {
+    Stats stats;
+    stats.resumed_handshakes = resumed_handshakes_.load();
+    stats.full_handshakes = full_handshakes_.load();
+    stats.cache_hits = cache_hits_.load();
+    stats.cache_misses = cache_misses_.load();
+    stats.unknown_ticket_keys = unknown_ticket_keys_.load();
+    for (auto& shard : shards_) {
+      const std::lock_guard lock{shard.mutex};
+      stats.cached_sessions += shard.sessions.GetSize();
+    }
+    return stats;
+  }
+
+  // OpenSSL callbacks, the context is found by SSL_CTX app data
+
+  static int NewSessionCallback(SSL* ssl, SSL_SESSION* session) noexcept {
+    try {
+      const int der_size = i2d_SSL_SESSION(session, nullptr);
+      if (der_size <= 0) return 0;
+
+      std::string der(der_size, '\0');
+      auto* der_out = reinterpret_cast<unsigned char*>(der.data());
+      i2d_SSL_SESSION(session, &der_out);
+      Get(ssl).StoreSession(GetSessionId(session), std::move(der));
+    } catch (const std::exception& ex) {
+      LOG_LIMITED_WARNING() << "Failed to cache a TLS session: " << ex;
+    }
+    // The cache keeps a copy, not the session itself
+    return 0;
+  }
+
+#if OPENSSL_VERSION_NUMBER >= 0x010100000L
+  static SSL_SESSION* GetSessionCallback(SSL* ssl, const unsigned char* id,
+                                         int id_length, int* copy) noexcept {
+#else
+  static SSL_SESSION* GetSessionCallback(SSL* ssl, unsigned char* id,
+                                         int id_length, int* copy) noexcept {
+#endif
+    *copy = 0;
+    try {
+      const auto der = Get(ssl).FindSession(
+          std::string(reinterpret_cast<const char*>(id), id_length));
+      if (!der) return nullptr;
+
+      const auto* der_in = reinterpret_cast<const unsigned char*>(der->data());
+      return d2i_SSL_SESSION(nullptr, &der_in, static_cast<long>(der->size()));
+    } catch (const std::exception& ex) {
+      LOG_LIMITED_WARNING() << "Failed to find a cached TLS session: " << ex;
+      return nullptr;
+    }
+  }
+
+  static void RemoveSessionCallback(SSL_CTX* ssl_ctx,
+                                    SSL_SESSION* session) noexcept {
+    auto* impl = static_cast<Impl*>(SSL_CTX_get_app_data(ssl_ctx));
+    UASSERT(impl);
+    try {
+      impl->EraseSession(GetSessionId(session));
+    } catch (const std::exception& ex) {
+      LOG_LIMITED_WARNING() << "Failed to remove a cached TLS session: " << ex;
+    }
+  }
+
+  // Returns -1 on errors, 0 to do a full handshake, 1 to use the ticket and
+  // 2 to also renew it
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  static int TicketKeyCallback(SSL* ssl, unsigned char* key_name,
+                               unsigned char* iv, EVP_CIPHER_CTX* cipher_ctx,
+                               EVP_MAC_CTX* mac_ctx, int enc) noexcept {
+    const auto init_mac = [mac_ctx](const TicketKeyData& key) {
+      // NOLINTBEGIN(cppcoreguidelines-pro-type-const-cast)
+      const std::array params{
+          OSSL_PARAM_construct_octet_string(
+              OSSL_MAC_PARAM_KEY,
+              const_cast<unsigned char*>(key.hmac_key.data()),
+              key.hmac_key.size()),
+          OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST,
+                                           const_cast<char*>("SHA256"), 0),
+          OSSL_PARAM_construct_end(),
+      };
+      // NOLINTEND(cppcoreguidelines-pro-type-const-cast)
+      return 1 == EVP_MAC_CTX_set_params(mac_ctx, params.data());
+    };
+#else
+  static int TicketKeyCallback(SSL* ssl, unsigned char* key_name,
+                               unsigned char* iv, EVP_CIPHER_CTX* cipher_ctx,
+                               HMAC_CTX* hmac_ctx, int enc) noexcept {
+    const auto init_mac = [hmac_ctx](const TicketKeyData& key) {
+      return 1 == HMAC_Init_ex(hmac_ctx, key.hmac_key.data(),
+                               key.hmac_key.size(), EVP_sha256(), nullptr);
+    };
+#endif
+    auto& impl = Get(ssl);
+    const auto* cipher = EVP_aes_256_cbc();
+
+    if (enc) {
+      return impl.WithTicketKey(nullptr, [&](const TicketKeyData& key, bool) {
+        if (1 != RAND_bytes(iv, EVP_CIPHER_iv_length(cipher))) return -1;
+        std::memcpy(key_name, key.name.data(), key.name.size());
+        if (1 != EVP_EncryptInit_ex(cipher_ctx, cipher, nullptr,
+                                    key.aes_key.data(), iv) ||
+            !init_mac(key)) {
+          return -1;
+        }
+        return 1;
+      });
+    }
+
+    return impl.WithTicketKey(
+        key_name, [&](const TicketKeyData& key, bool is_current) {
+          if (!init_mac(key) ||
+              1 != EVP_DecryptInit_ex(cipher_ctx, cipher, nullptr,
+                                      key.aes_key.data(), iv)) {
+            return -1;
+          }
+          return is_current ? 1 : 2;
+        });
+  }
+
+ private:
+  static std::string GetSessionId(const SSL_SESSION* session) {
+    unsigned int id_length = 0;
+    const auto* id = SSL_SESSION_get_id(session, &id_length);
+    return std::string(reinterpret_cast<const char*>(id), id_length);
+  }
+
+  SessionCacheShard& GetShard(std::string_view id) noexcept {
+    return shards_[std::hash<std::string_view>{}(id) % kShards];
+  }
+
+  const Settings settings_;
+  utils::FixedArray<SessionCacheShard> shards_;
+  const TicketKeyData random_ticket_key_;
+  rcu::Variable<std::vector<TicketKeyData>> ticket_keys_;
+
+  std::atomic<std::uint64_t> resumed_handshakes_{0};
+  std::atomic<std::uint64_t> full_handshakes_{0};
+  std::atomic<std::uint64_t> cache_hits_{0};
+  std::atomic<std::uint64_t> cache_misses_{0};
+  std::atomic<std::uint64_t> unknown_ticket_keys_{0};
+};
+
+TlsServerSessions::TlsServerSessions(Settings settings)
+    : impl_(std::make_unique<Impl>(settings)) {}
+
+TlsServerSessions::~TlsServerSessions() = default;
+
+void TlsServerSessions::SetTicketKeys(const std::vector<TicketKey>& keys) {
+  impl_->SetTicketKeys(keys);
+}
+
+TlsServerSessions::Stats TlsServerSessions::GetStats() const {
+  return impl_->GetStats();
+}
+
+void TlsServerSessions::SetUp(ssl_ctx_st* ssl_ctx) const {
+  UASSERT(ssl_ctx);
+  if (1 != SSL_CTX_set_app_data(ssl_ctx, impl_.get())) {
+    throw TlsException(crypto::FormatSslError(
+        "Failed to set up TLS sessions: SSL_CTX_set_app_data"));
+  }
+  if (1 != SSL_CTX_set_session_id_context(
+               ssl_ctx,
+               reinterpret_cast<const unsigned char*>(kSessionIdContext.data()),
+               kSessionIdContext.size())) {
+    throw TlsException(crypto::FormatSslError(
+        "Failed to set up TLS sessions: SSL_CTX_set_session_id_context"));
+  }
+
+  SSL_CTX_set_timeout(ssl_ctx, impl_->GetSettings().session_timeout.count());
+  SSL_CTX_set_session_cache_mode(
+      ssl_ctx, SSL_SESS_CACHE_SERVER | SSL_SESS_CACHE_NO_INTERNAL);
+  SSL_CTX_sess_set_new_cb(ssl_ctx, &Impl::NewSessionCallback);
+  SSL_CTX_sess_set_get_cb(ssl_ctx, &Impl::GetSessionCallback);
+  SSL_CTX_sess_set_remove_cb(ssl_ctx, &Impl::RemoveSessionCallback);
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  SSL_CTX_set_tlsext_ticket_key_evp_cb(ssl_ctx, &Impl::TicketKeyCallback);
+#else
+  // cast in openssl1.x macro expansion
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+  SSL_CTX_set_tlsext_ticket_key_cb(ssl_ctx, &Impl::TicketKeyCallback);
+#endif
+}
+
+void TlsServerSessions::AccountHandshake(bool is_resumed) const noexcept {
+  impl_->AccountHandshake(is_resumed);
+}
+
+}  // namespace engine::io
+
+USERVER_NAMESPACE_END
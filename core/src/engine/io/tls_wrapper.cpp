@@ -10,6 +10,7 @@
 
 #include <userver/crypto/openssl.hpp>
 #include <userver/engine/io/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
@@ -263,6 +264,32 @@ void AddCertAuthorities(
   }
 }
 
+std::string MakeAlpnWireProtocols(const std::vector<std::string>& protocols) {
+  std::string result;
+  for (const auto& protocol : protocols) {
+    if (protocol.empty() || protocol.size() > 255) {
+      throw TlsException(
+          fmt::format("Invalid ALPN protocol name '{}'", protocol));
+    }
+    result += static_cast<char>(protocol.size());
+    result += protocol;
+  }
+  return result;
+}
+
+int SelectAlpnProtocol(SSL*, const unsigned char** out, unsigned char* outlen,
+                       const unsigned char* in, unsigned int inlen,
+                       void* arg) noexcept {
+  const auto& protocols = *static_cast<const std::string*>(arg);
+  // The server preference wins
+  const auto ret = SSL_select_next_proto(
+      const_cast<unsigned char**>(out), outlen,
+      reinterpret_cast<const unsigned char*>(protocols.data()),
+      protocols.size(), in, inlen);
+  return ret == OPENSSL_NPN_NEGOTIATED ? SSL_TLSEXT_ERR_OK
+                                       : SSL_TLSEXT_ERR_NOACK;
+}
+
 }  // namespace
 
 class TlsWrapper::ReadContextAccessor final
@@ -295,13 +322,20 @@ class TlsWrapper::Impl {
       : bio_data(std::move(other.bio_data)),
         ssl(std::move(other.ssl)),
         read_accessor(*this),
-        is_in_shutdown(other.is_in_shutdown) {
+        is_in_shutdown(other.is_in_shutdown),
+        is_fd_bio(other.is_fd_bio) {
     UASSERT(ssl);
     UASSERT(SSL_get_rbio(ssl.get()) == SSL_get_wbio(ssl.get()));
-    SyncBioData(SSL_get_rbio(ssl.get()), &other.bio_data);
+    // The fd BIO only knows the descriptor, which stays the same
+    if (!is_fd_bio) SyncBioData(SSL_get_rbio(ssl.get()), &other.bio_data);
   }
 
-  void SetUp(SslCtx&& ssl_ctx) {
+  void SetUp(SslCtx&& ssl_ctx, TlsOffload offload) {
+    if (offload == TlsOffload::kKernel) {
+      SetUpKernelOffload(std::move(ssl_ctx));
+      return;
+    }
+
     Bio socket_bio{BIO_new(GetSocketBioMethod())};
     if (!socket_bio) {
       throw TlsException(
@@ -323,6 +357,74 @@ class TlsWrapper::Impl {
     [[maybe_unused]] const auto* disowned_bio = socket_bio.release();
   }
 
+  // OpenSSL passes the session keys to the kernel only through its own fd
+  // BIO. That BIO does non-blocking I/O, so the socket is waited for on
+  // SSL_ERROR_WANT_READ/SSL_ERROR_WANT_WRITE, see WaitFdBio().
+  void SetUpKernelOffload([[maybe_unused]] SslCtx&& ssl_ctx) {
+#ifdef SSL_OP_ENABLE_KTLS
+    ssl.reset(SSL_new(ssl_ctx.get()));
+    if (!ssl) {
+      throw TlsException(
+          crypto::FormatSslError("Failed to set up TLS wrapper: SSL_new"));
+    }
+    if (1 != SSL_set_fd(ssl.get(), bio_data.socket.Fd())) {
+      throw TlsException(
+          crypto::FormatSslError("Failed to set up TLS wrapper: SSL_set_fd"));
+    }
+    SSL_set_options(ssl.get(), SSL_OP_ENABLE_KTLS);
+    is_fd_bio = true;
+#else
+    throw TlsException("Kernel TLS offload requires OpenSSL 3.0 or newer");
+#endif
+  }
+
+  // Returns false and stores the interruption the same way the socket BIO
+  // does if the wait has failed
+  bool WaitFdBio(int ssl_error, std::size_t bytes_transferred) {
+    UASSERT(is_fd_bio);
+    const auto deadline = bio_data.current_deadline;
+    const bool is_ready = ssl_error == SSL_ERROR_WANT_READ
+                              ? bio_data.socket.WaitReadable(deadline)
+                              : bio_data.socket.WaitWriteable(deadline);
+    if (is_ready) return true;
+
+    try {
+      if (engine::current_task::ShouldCancel()) {
+        throw IoCancelled(bytes_transferred);
+      }
+      throw IoTimeout(bytes_transferred);
+    } catch (const IoInterrupted&) {
+      bio_data.last_exception = std::current_exception();
+    }
+    return false;
+  }
+
+  template <typename HandshakeFunc>
+  int DoHandshake(HandshakeFunc&& handshake_func) {
+    if (is_fd_bio) bio_data.last_exception = {};
+    while (true) {
+      const int ret = handshake_func(ssl.get());
+      if (ret == 1 || !is_fd_bio) return ret;
+
+      const int ssl_error = SSL_get_error(ssl.get(), ret);
+      if (ssl_error != SSL_ERROR_WANT_READ &&
+          ssl_error != SSL_ERROR_WANT_WRITE) {
+        return ret;
+      }
+      if (!WaitFdBio(ssl_error, 0)) return ret;
+    }
+  }
+
+  bool IsKernelOffloaded([[maybe_unused]] bool is_send) const {
+#ifdef SSL_OP_ENABLE_KTLS
+    if (!ssl || !is_fd_bio) return false;
+    return is_send ? BIO_get_ktls_send(SSL_get_wbio(ssl.get()))
+                   : BIO_get_ktls_recv(SSL_get_rbio(ssl.get()));
+#else
+    return false;
+#endif
+  }
+
   void ClientConnect(const std::string& server_name, Deadline deadline) {
     if (!server_name.empty()) {
       // cast in openssl1.0 macro expansion
@@ -335,7 +437,7 @@ class TlsWrapper::Impl {
 
     bio_data.current_deadline = deadline;
 
-    auto ret = SSL_connect(ssl.get());
+    auto ret = DoHandshake(&SSL_connect);
     if (1 != ret) {
       if (bio_data.last_exception) {
         std::rethrow_exception(bio_data.last_exception);
@@ -366,6 +468,7 @@ class TlsWrapper::Impl {
 #endif
 
     bio_data.current_deadline = deadline;
+    if (is_fd_bio) bio_data.last_exception = {};
 
     char* const begin = static_cast<char*>(buf);
     char* const end = begin + len;
@@ -386,6 +489,8 @@ class TlsWrapper::Impl {
           // timeout, cancel, EOF, or just a spurious wakeup
           case SSL_ERROR_WANT_READ:
           case SSL_ERROR_WANT_WRITE:
+            if (is_fd_bio && WaitFdBio(ssl_error, pos - begin)) continue;
+            break;
           case SSL_ERROR_ZERO_RETURN:
             break;
 
@@ -429,6 +534,8 @@ class TlsWrapper::Impl {
   Ssl ssl;
   ReadContextAccessor read_accessor;
   bool is_in_shutdown{false};
+  // Whether OpenSSL does the socket I/O itself, for the kernel TLS offload
+  bool is_fd_bio{false};
   std::atomic<int> ssl_usage_level{0};
 
  private:
@@ -487,7 +594,7 @@ TlsWrapper TlsWrapper::StartTlsClient(Socket&& socket,
   SetServerName(ssl_ctx, server_name);
 
   TlsWrapper wrapper{std::move(socket)};
-  wrapper.impl_->SetUp(std::move(ssl_ctx));
+  wrapper.impl_->SetUp(std::move(ssl_ctx), TlsOffload::kNone);
   wrapper.impl_->ClientConnect(server_name, deadline);
   return wrapper;
 }
@@ -496,7 +603,8 @@ TlsWrapper TlsWrapper::StartTlsClient(
     Socket&& socket, const std::string& server_name,
     const crypto::Certificate& cert, const crypto::PrivateKey& key,
     Deadline deadline,
-    const std::vector<crypto::Certificate>& extra_cert_authorities) {
+    const std::vector<crypto::Certificate>& extra_cert_authorities,
+    TlsOffload offload) {
   auto ssl_ctx = MakeSslCtx();
   SetServerName(ssl_ctx, server_name);
 
@@ -519,7 +627,7 @@ TlsWrapper TlsWrapper::StartTlsClient(
   }
 
   TlsWrapper wrapper{std::move(socket)};
-  wrapper.impl_->SetUp(std::move(ssl_ctx));
+  wrapper.impl_->SetUp(std::move(ssl_ctx), offload);
   wrapper.impl_->ClientConnect(server_name, deadline);
   return wrapper;
 }
@@ -527,8 +635,19 @@ TlsWrapper TlsWrapper::StartTlsClient(
 TlsWrapper TlsWrapper::StartTlsServer(
     Socket&& socket, const crypto::Certificate& cert,
     const crypto::PrivateKey& key, Deadline deadline,
-    const std::vector<crypto::Certificate>& extra_cert_authorities) {
+    const std::vector<crypto::Certificate>& extra_cert_authorities,
+    const std::vector<std::string>& alpn_protocols, TlsOffload offload,
+    const TlsServerSessions* sessions) {
   auto ssl_ctx = MakeSslCtx();
+  if (sessions) sessions->SetUp(ssl_ctx.get());
+
+  // Only used during the handshake, the callback is reset right after it
+  std::string alpn_wire_protocols;
+  if (!alpn_protocols.empty()) {
+    alpn_wire_protocols = MakeAlpnWireProtocols(alpn_protocols);
+    SSL_CTX_set_alpn_select_cb(ssl_ctx.get(), &SelectAlpnProtocol,
+                               &alpn_wire_protocols);
+  }
 
   if (!extra_cert_authorities.empty()) {
     AddCertAuthorities(ssl_ctx, extra_cert_authorities);
@@ -551,10 +670,14 @@ TlsWrapper TlsWrapper::StartTlsServer(
   }
 
   TlsWrapper wrapper{std::move(socket)};
-  wrapper.impl_->SetUp(std::move(ssl_ctx));
+  wrapper.impl_->SetUp(std::move(ssl_ctx), offload);
   wrapper.impl_->bio_data.current_deadline = deadline;
 
-  auto ret = SSL_accept(wrapper.impl_->ssl.get());
+  auto ret = wrapper.impl_->DoHandshake(&SSL_accept);
+  if (!alpn_protocols.empty()) {
+    SSL_CTX_set_alpn_select_cb(SSL_get_SSL_CTX(wrapper.impl_->ssl.get()),
+                               nullptr, nullptr);
+  }
   if (1 != ret) {
     if (wrapper.impl_->bio_data.last_exception) {
       std::rethrow_exception(wrapper.impl_->bio_data.last_exception);
@@ -566,6 +689,9 @@ TlsWrapper TlsWrapper::StartTlsServer(
   }
 
   UASSERT(wrapper.impl_->ssl);
+  if (sessions) {
+    sessions->AccountHandshake(SSL_session_reused(wrapper.impl_->ssl.get()));
+  }
   return wrapper;
 }
 
@@ -678,6 +804,7 @@ Socket TlsWrapper::StopTls(Deadline deadline) {
   if (impl_->ssl) {
     impl_->is_in_shutdown = true;
     impl_->bio_data.current_deadline = deadline;
+    if (impl_->is_fd_bio) impl_->bio_data.last_exception = {};
     int shutdown_ret = 0;
     while (shutdown_ret != 1) {
       shutdown_ret = SSL_shutdown(impl_->ssl.get());
@@ -687,6 +814,7 @@ Socket TlsWrapper::StopTls(Deadline deadline) {
           // this is fine
           case SSL_ERROR_WANT_READ:
           case SSL_ERROR_WANT_WRITE:
+            if (impl_->is_fd_bio) impl_->WaitFdBio(ssl_error, 0);
             break;
 
           // connection breaking errors
@@ -713,6 +841,24 @@ Socket TlsWrapper::StopTls(Deadline deadline) {
 
 int TlsWrapper::GetRawFd() { return impl_->bio_data.socket.Fd(); }
 
+bool TlsWrapper::IsKernelTlsSend() const {
+  return impl_->IsKernelOffloaded(/*is_send=*/true);
+}
+
+bool TlsWrapper::IsKernelTlsRecv() const {
+  return impl_->IsKernelOffloaded(/*is_send=*/false);
+}
+
+std::string TlsWrapper::GetAlpnProtocol() const {
+  if (!impl_->ssl) return {};
+
+  const unsigned char* protocol = nullptr;
+  unsigned int size = 0;
+  SSL_get0_alpn_selected(impl_->ssl.get(), &protocol, &size);
+  if (!protocol) return {};
+  return std::string{reinterpret_cast<const char*>(protocol), size};
+}
+
 }  // namespace engine::io
 
 USERVER_NAMESPACE_END
@@ -181,4 +181,53 @@ BENCHMARK(tls_write_all_default)
     ->Range(1 << 6, 1 << 12)
     ->Unit(benchmark::kNanosecond);
 
+// Bulk transfer from the server, arg 0 is the chunk size and arg 1 tells
+// whether to offload the TLS to the kernel
+[[maybe_unused]] void tls_throughput(benchmark::State& state) {
+  const auto offload =
+      state.range(1) ? io::TlsOffload::kKernel : io::TlsOffload::kNone;
+  engine::RunStandalone(2, [&]() {
+    const auto deadline = Deadline::FromDuration(kDeadlineMaxTime);
+
+    TcpListener tcp_listener;
+    auto [server, client] = tcp_listener.MakeSocketPair(deadline);
+
+    std::atomic<bool> reading{true};
+    auto client_task = engine::AsyncNoSpan(
+        [&reading, deadline, offload](auto&& client) {
+          auto tls_client = io::TlsWrapper::StartTlsClient(
+              std::forward<decltype(client)>(client), {}, {}, {}, deadline, {},
+              offload);
+
+          std::array<std::byte, 16'384> buf{};
+          while (tls_client.RecvSome(buf.data(), buf.size(), deadline) > 0 &&
+                 reading) {
+            /* receiving msgs */
+          }
+        },
+        std::move(client));
+
+    auto tls_server = io::TlsWrapper::StartTlsServer(
+        std::move(server), crypto::Certificate::LoadFromString(cert),
+        crypto::PrivateKey::LoadFromString(key), deadline, {}, {}, offload);
+    state.SetLabel(tls_server.IsKernelTlsSend() ? "ktls" : "user space");
+
+    const std::string payload(state.range(0), 'x');
+    for ([[maybe_unused]] auto _ : state) {
+      benchmark::DoNotOptimize(
+          tls_server.SendAll(payload.data(), payload.size(), deadline));
+    }
+    state.SetBytesProcessed(state.iterations() * payload.size());
+
+    reading.store(false);
+    // Wakes up the reader
+    [[maybe_unused]] auto sent = tls_server.SendAll("x", 1, deadline);
+    client_task.Get();
+  });
+}
+
+BENCHMARK(tls_throughput)
+    ->ArgsProduct({{1 << 14, 1 << 16, 1 << 20}, {0, 1}})
+    ->Unit(benchmark::kMicrosecond);
+
 USERVER_NAMESPACE_END
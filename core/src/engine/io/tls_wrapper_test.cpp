@@ -9,6 +9,7 @@
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/io/socket.hpp>
+#include <userver/engine/io/tls_server_sessions.hpp>
 #include <userver/engine/io/tls_wrapper.hpp>
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
@@ -686,4 +687,100 @@ UTEST(TlsWrapper, PeerDisconnect) {
   server_task.Get();
 }
 
+UTEST_MT(TlsWrapper, KernelOffload, 2) {
+  const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  TcpListener tcp_listener;
+  auto [server, client] = tcp_listener.MakeSocketPair(test_deadline);
+
+  // Larger than a TLS record and a socket buffer
+  const std::string payload(1 << 20, 'x');
+
+  engine::SingleConsumerEvent timeout_happened;
+  auto server_task = engine::AsyncNoSpan(
+      [test_deadline, &payload, &timeout_happened](auto&& server) {
+        auto tls_server = io::TlsWrapper::StartTlsServer(
+            std::forward<decltype(server)>(server),
+            crypto::Certificate::LoadFromString(cert),
+            crypto::PrivateKey::LoadFromString(key), test_deadline, {}, {},
+            io::TlsOffload::kKernel);
+        // Falls back to user space where kTLS is unavailable
+        LOG_INFO() << "kTLS send: " << tls_server.IsKernelTlsSend()
+                   << ", recv: " << tls_server.IsKernelTlsRecv();
+
+        std::string received(payload.size(), '\0');
+        EXPECT_EQ(received.size(), tls_server.RecvAll(received.data(),
+                                                      received.size(),
+                                                      test_deadline));
+        EXPECT_EQ(received, payload);
+        EXPECT_EQ(payload.size(), tls_server.SendAll(payload.data(),
+                                                     payload.size(),
+                                                     test_deadline));
+
+        char c = 0;
+        UEXPECT_THROW(static_cast<void>(tls_server.RecvSome(
+                          &c, 1, Deadline::FromDuration(kShortTimeout))),
+                      io::IoTimeout);
+        timeout_happened.Send();
+        EXPECT_EQ(1, tls_server.RecvSome(&c, 1, test_deadline));
+        EXPECT_EQ('1', c);
+      },
+      std::move(server));
+
+  auto tls_client =
+      io::TlsWrapper::StartTlsClient(std::move(client), {}, test_deadline);
+  EXPECT_EQ(payload.size(),
+            tls_client.SendAll(payload.data(), payload.size(), test_deadline));
+  std::string received(payload.size(), '\0');
+  EXPECT_EQ(received.size(), tls_client.RecvAll(received.data(),
+                                                received.size(), test_deadline));
+  EXPECT_EQ(received, payload);
+
+  ASSERT_TRUE(timeout_happened.WaitForEventUntil(test_deadline));
+  EXPECT_EQ(1, tls_client.SendAll("1", 1, test_deadline));
+  server_task.Get();
+}
+
+UTEST(TlsWrapper, ServerSessions) {
+  const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+  const io::TlsServerSessions sessions{io::TlsServerSessions::Settings{}};
+
+  TcpListener tcp_listener;
+  auto [server, client] = tcp_listener.MakeSocketPair(deadline);
+
+  auto server_task = utils::Async(
+      "tls-server",
+      [deadline, &sessions](auto&& server) {
+        auto tls_server = io::TlsWrapper::StartTlsServer(
+            std::forward<decltype(server)>(server),
+            crypto::Certificate::LoadFromString(cert),
+            crypto::PrivateKey::LoadFromString(key), deadline, {}, {},
+            io::TlsOffload::kNone, &sessions);
+        EXPECT_EQ(1, tls_server.SendAll("1", 1, deadline));
+      },
+      std::move(server));
+
+  auto tls_client =
+      io::TlsWrapper::StartTlsClient(std::move(client), {}, deadline);
+  char c = 0;
+  EXPECT_EQ(1, tls_client.RecvAll(&c, 1, deadline));
+  server_task.Get();
+
+  const auto stats = sessions.GetStats();
+  EXPECT_EQ(stats.full_handshakes, 1);
+  EXPECT_EQ(stats.resumed_handshakes, 0);
+}
+
+UTEST(TlsWrapper, ServerSessionsTicketKeys) {
+  io::TlsServerSessions sessions{io::TlsServerSessions::Settings{}};
+  using TicketKey = io::TlsServerSessions::TicketKey;
+
+  UEXPECT_NO_THROW(sessions.SetTicketKeys(
+      {TicketKey{std::string(io::TlsServerSessions::kTicketKeySize, 'a')},
+       TicketKey{std::string(io::TlsServerSessions::kTicketKeySize, 'b')}}));
+  UEXPECT_THROW(sessions.SetTicketKeys({TicketKey{std::string(48, 'a')}}),
+                std::invalid_argument);
+  UEXPECT_NO_THROW(sessions.SetTicketKeys({}));
+}
+
 USERVER_NAMESPACE_END
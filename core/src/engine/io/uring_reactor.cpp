@@ -0,0 +1,552 @@
+#include <engine/io/uring_reactor.hpp>
+
+#include <stdexcept>
+
+#include <userver/utils/assert.hpp>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// Comes from <linux/fs.h>, clashes with the names in the third party headers
+#undef BLOCK_SIZE
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+#include <system_error>
+#include <thread>
+
+#include <fmt/format.h>
+
+#include <userver/compiler/thread_local.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+
+#include <engine/impl/wait_list_light.hpp>
+#include <engine/task/task_context.hpp>
+#include <utils/check_syscall.hpp>
+
+// Not available on the host pre-Linux 5.1 headers, but may be supported by
+// the target kernel
+#ifndef __NR_io_uring_setup
+#define __NR_io_uring_setup 425
+#endif
+#ifndef __NR_io_uring_enter
+#define __NR_io_uring_enter 426
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io::impl {
+
+namespace {
+
+// Completions of the operations that nobody waits for, e.g. of cancellations
+constexpr std::uint64_t kIgnoredUserData = 0;
+
+int SysSetup(unsigned entries, io_uring_params& params) noexcept {
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+}
+
+int SysEnter(int fd, unsigned to_submit, unsigned min_complete,
+             unsigned flags) noexcept {
+  return static_cast<int>(::syscall(__NR_io_uring_enter, fd, to_submit,
+                                    min_complete, flags, nullptr, 0));
+}
+
+unsigned LoadAcquire(const unsigned* ptr) noexcept {
+  return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+
+void StoreRelease(unsigned* ptr, unsigned value) noexcept {
+  __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+}
+
+// The kernel features that the reactor relies on
+constexpr unsigned kRequiredFeatures =
+    IORING_FEAT_NODROP | IORING_FEAT_FAST_POLL;
+
+compiler::ThreadLocal current_reactor = [] {
+  return static_cast<UringReactor*>(nullptr);
+};
+
+// A submitted operation, lives on the stack of the waiting coroutine until
+// its completion
+class Operation final {
+ public:
+  class WaitStrategy;
+
+  bool IsCompleted() const noexcept { return waiters_.IsSignaled(); }
+
+  int GetResult() const noexcept {
+    UASSERT(IsCompleted());
+    return result_;
+  }
+
+  void Complete(int result) noexcept {
+    result_ = result;
+    waiters_.SetSignalAndWakeupOne();
+  }
+
+  // Returns false on deadline or cancellation
+  bool Wait(Deadline deadline);
+
+ private:
+  engine::impl::WaitListLight waiters_;
+  int result_{0};
+};
+
+class Operation::WaitStrategy final : public engine::impl::WaitStrategy {
+ public:
+  WaitStrategy(Operation& operation, engine::impl::TaskContext& current)
+      : operation_(operation), current_(current) {}
+
+  engine::impl::EarlyWakeup SetupWakeups() override {
+    return engine::impl::EarlyWakeup{
+        operation_.waiters_.GetSignalOrAppend(&current_)};
+  }
+
+  void DisableWakeups() noexcept override {
+    operation_.waiters_.Remove(current_);
+  }
+
+ private:
+  Operation& operation_;
+  engine::impl::TaskContext& current_;
+};
+
+bool Operation::Wait(Deadline deadline) {
+  auto& current = current_task::GetCurrentTaskContext();
+  WaitStrategy wait_strategy{*this, current};
+  while (!IsCompleted()) {
+    const auto wakeup_source =
+        current.Sleep(wait_strategy, deadline, engine::impl::WaitKind::kIo);
+    if (!engine::impl::HasWaitSucceeded(wakeup_source)) return IsCompleted();
+  }
+  return true;
+}
+
+void PrepareRequest(io_uring_sqe& sqe, const UringReactor::Request& request) {
+  sqe.fd = request.fd;
+  sqe.addr = reinterpret_cast<std::uintptr_t>(request.buf);
+  switch (request.op) {
+    case UringReactor::OpCode::kRecv:
+      sqe.opcode = IORING_OP_RECV;
+      sqe.len = static_cast<std::uint32_t>(request.len);
+      sqe.msg_flags = request.flags;
+      return;
+    case UringReactor::OpCode::kSend:
+      sqe.opcode = IORING_OP_SEND;
+      sqe.len = static_cast<std::uint32_t>(request.len);
+      sqe.msg_flags = request.flags;
+      return;
+    case UringReactor::OpCode::kPoll:
+      sqe.opcode = IORING_OP_POLL_ADD;
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+      sqe.poll32_events = __builtin_bswap32(request.flags);
+#else
+      sqe.poll32_events = request.flags;
+#endif
+      return;
+    case UringReactor::OpCode::kRead:
+      sqe.opcode = IORING_OP_READ;
+      sqe.len = static_cast<std::uint32_t>(request.len);
+      sqe.off = request.offset;
+      return;
+    case UringReactor::OpCode::kWrite:
+      sqe.opcode = IORING_OP_WRITE;
+      sqe.len = static_cast<std::uint32_t>(request.len);
+      sqe.off = request.offset;
+      return;
+    case UringReactor::OpCode::kFsync:
+      sqe.opcode = IORING_OP_FSYNC;
+      sqe.fsync_flags = request.flags;
+      return;
+    case UringReactor::OpCode::kOpenAt:
+      sqe.opcode = IORING_OP_OPENAT;
+      sqe.len = static_cast<std::uint32_t>(request.len);
+      sqe.open_flags = request.flags;
+      return;
+    case UringReactor::OpCode::kClose:
+      sqe.opcode = IORING_OP_CLOSE;
+      sqe.addr = 0;
+      return;
+  }
+  UINVARIANT(false, "Unknown io_uring operation");
+}
+
+}  // namespace
+
+class UringReactor::Impl final {
+ public:
+  explicit Impl(unsigned entries);
+  ~Impl();
+
+  // Returns the prepared but not yet submitted entry, submits the pending
+  // entries if the submission queue is full.
+  io_uring_sqe& PrepareSqe(std::unique_lock<std::mutex>& sq_lock);
+
+  void Submit(std::unique_lock<std::mutex>& sq_lock) noexcept;
+  void Reap() noexcept;
+
+  bool HasUnsubmitted() const noexcept;
+  bool HasCompletions() const noexcept;
+
+  void SubmitCancel(std::uint64_t user_data) noexcept;
+  void SubmitCancelFd(int fd) noexcept;
+
+  std::mutex sq_mutex_;
+
+ private:
+  void RunReaper() noexcept;
+  void SubmitNop(std::uint64_t user_data) noexcept;
+
+  int ring_fd_{-1};
+
+  void* sq_ring_{nullptr};
+  std::size_t sq_ring_size_{0};
+  void* cq_ring_{nullptr};
+  std::size_t cq_ring_size_{0};
+  io_uring_sqe* sqes_{nullptr};
+  std::size_t sqes_size_{0};
+
+  unsigned* sq_head_{nullptr};
+  unsigned* sq_tail_{nullptr};
+  unsigned sq_mask_{0};
+  unsigned sq_entries_{0};
+  unsigned* sq_array_{nullptr};
+  // Includes the prepared entries that have not been published yet, only
+  // modified under sq_mutex_
+  std::atomic<unsigned> sq_local_tail_{0};
+
+  unsigned* cq_head_{nullptr};
+  unsigned* cq_tail_{nullptr};
+  unsigned cq_mask_{0};
+  io_uring_cqe* cqes_{nullptr};
+  std::mutex cq_mutex_;
+
+  std::atomic<bool> is_stopping_{false};
+  std::thread reaper_;
+};
+
+UringReactor::Impl::Impl(unsigned entries) {
+  io_uring_params params{};
+  ring_fd_ = utils::CheckSyscall(
+      SysSetup(entries, params), "setting up io_uring");
+  try {
+    if ((params.features & kRequiredFeatures) != kRequiredFeatures) {
+      throw std::runtime_error("io_uring of the kernel is too old");
+    }
+
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size_ =
+        params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool is_single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (is_single_mmap) {
+      sq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+      cq_ring_size_ = 0;
+    }
+
+    sq_ring_ = ::mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+    if (sq_ring_ == MAP_FAILED) {
+      sq_ring_ = nullptr;
+      throw std::system_error(errno, std::system_category(),
+                              "mapping io_uring submission queue");
+    }
+    if (is_single_mmap) {
+      cq_ring_ = sq_ring_;
+    } else {
+      cq_ring_ =
+          ::mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE,
+                 MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING);
+      if (cq_ring_ == MAP_FAILED) {
+        cq_ring_ = nullptr;
+        throw std::system_error(errno, std::system_category(),
+                                "mapping io_uring completion queue");
+      }
+    }
+
+    sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+    void* const sqes =
+        ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE,
+               MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) {
+      throw std::system_error(errno, std::system_category(),
+                              "mapping io_uring submission entries");
+    }
+    sqes_ = static_cast<io_uring_sqe*>(sqes);
+  } catch (const std::exception&) {
+    if (sq_ring_) ::munmap(sq_ring_, sq_ring_size_);
+    if (cq_ring_ && cq_ring_ != sq_ring_) ::munmap(cq_ring_, cq_ring_size_);
+    ::close(ring_fd_);
+    throw;
+  }
+
+  auto* const sq = static_cast<char*>(sq_ring_);
+  sq_head_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+  sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+  sq_mask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+  sq_entries_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_entries);
+  sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+
+  auto* const cq = static_cast<char*>(cq_ring_);
+  cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+  cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+  cq_mask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+  cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+  reaper_ = std::thread([this] { RunReaper(); });
+}
+
+UringReactor::Impl::~Impl() {
+  is_stopping_ = true;
+  // Wakes up the reaper
+  SubmitNop(kIgnoredUserData);
+  reaper_.join();
+
+  ::munmap(sqes_, sqes_size_);
+  if (cq_ring_ != sq_ring_) ::munmap(cq_ring_, cq_ring_size_);
+  ::munmap(sq_ring_, sq_ring_size_);
+  ::close(ring_fd_);
+}
+
+io_uring_sqe& UringReactor::Impl::PrepareSqe(
+    std::unique_lock<std::mutex>& sq_lock) {
+  UASSERT(sq_lock.owns_lock());
+  while (true) {
+    const auto tail = sq_local_tail_.load(std::memory_order_relaxed);
+    if (tail - LoadAcquire(sq_head_) < sq_entries_) {
+      const auto index = tail & sq_mask_;
+      auto& sqe = sqes_[index];
+      std::memset(&sqe, 0, sizeof(sqe));
+      sq_array_[index] = index;
+      sq_local_tail_.store(tail + 1, std::memory_order_relaxed);
+      return sqe;
+    }
+    Submit(sq_lock);
+  }
+}
+
+bool UringReactor::Impl::HasUnsubmitted() const noexcept {
+  return sq_local_tail_.load(std::memory_order_relaxed) !=
+         LoadAcquire(sq_head_);
+}
+
+bool UringReactor::Impl::HasCompletions() const noexcept {
+  return LoadAcquire(cq_head_) != LoadAcquire(cq_tail_);
+}
+
+void UringReactor::Impl::Submit(
+    std::unique_lock<std::mutex>& sq_lock) noexcept {
+  UASSERT(sq_lock.owns_lock());
+  const auto tail = sq_local_tail_.load(std::memory_order_relaxed);
+  StoreRelease(sq_tail_, tail);
+
+  // The kernel consumes the published entries during the syscall
+  while (const auto to_submit = tail - LoadAcquire(sq_head_)) {
+    if (SysEnter(ring_fd_, to_submit, 0, 0) >= 0) continue;
+
+    const auto error_code = errno;
+    if (error_code == EAGAIN || error_code == EBUSY) {
+      // Out of memory for the completions, wait for the reaper to make room
+      sq_lock.unlock();
+      std::this_thread::yield();
+      sq_lock.lock();
+    } else if (error_code != EINTR) {
+      utils::impl::AbortWithStacktrace(
+          fmt::format("io_uring submission failed: {}",
+                      std::system_category().message(error_code)));
+    }
+  }
+}
+
+void UringReactor::Impl::Reap() noexcept {
+  std::unique_lock lock(cq_mutex_, std::try_to_lock);
+  if (!lock.owns_lock()) return;
+
+  auto head = *cq_head_;
+  const auto tail = LoadAcquire(cq_tail_);
+  for (; head != tail; ++head) {
+    const auto& cqe = cqes_[head & cq_mask_];
+    if (cqe.user_data != kIgnoredUserData) {
+      // NOLINTNEXTLINE(performance-no-int-to-ptr)
+      reinterpret_cast<Operation*>(cqe.user_data)->Complete(cqe.res);
+    }
+  }
+  StoreRelease(cq_head_, head);
+}
+
+void UringReactor::Impl::RunReaper() noexcept {
+  while (!is_stopping_) {
+    if (SysEnter(ring_fd_, 0, 1, IORING_ENTER_GETEVENTS) < 0) {
+      const auto error_code = errno;
+      if (error_code != EINTR && error_code != EBUSY) {
+        utils::impl::AbortWithStacktrace(
+            fmt::format("io_uring wait failed: {}",
+                        std::system_category().message(error_code)));
+      }
+    }
+    Reap();
+  }
+}
+
+void UringReactor::Impl::SubmitCancel(std::uint64_t user_data) noexcept {
+  std::unique_lock lock(sq_mutex_);
+  try {
+    auto& sqe = PrepareSqe(lock);
+    sqe.opcode = IORING_OP_ASYNC_CANCEL;
+    sqe.fd = -1;
+    sqe.addr = user_data;
+    sqe.user_data = kIgnoredUserData;
+  } catch (const std::exception& e) {
+    LOG_LIMITED_ERROR() << "Failed to cancel an io_uring operation: " << e;
+    return;
+  }
+  // The cancellation may come from a thread of another reactor, do not wait
+  // for the owner to flush
+  Submit(lock);
+}
+
+void UringReactor::Impl::SubmitCancelFd(int fd) noexcept {
+#ifdef IORING_ASYNC_CANCEL_FD
+  std::unique_lock lock(sq_mutex_);
+  try {
+    auto& sqe = PrepareSqe(lock);
+    sqe.opcode = IORING_OP_ASYNC_CANCEL;
+    sqe.fd = fd;
+    sqe.cancel_flags = IORING_ASYNC_CANCEL_FD | IORING_ASYNC_CANCEL_ALL;
+    sqe.user_data = kIgnoredUserData;
+  } catch (const std::exception& e) {
+    LOG_LIMITED_ERROR() << "Failed to cancel io_uring operations on fd=" << fd
+                        << ": " << e;
+    return;
+  }
+  Submit(lock);
+#else
+  // Pre-Linux 5.19 headers, the pending operations finish on their own
+  static_cast<void>(fd);
+#endif
+}
+
+void UringReactor::Impl::SubmitNop(std::uint64_t user_data) noexcept {
+  std::unique_lock lock(sq_mutex_);
+  try {
+    auto& sqe = PrepareSqe(lock);
+    sqe.opcode = IORING_OP_NOP;
+    sqe.fd = -1;
+    sqe.user_data = user_data;
+  } catch (const std::exception& e) {
+    utils::impl::AbortWithStacktrace(
+        fmt::format("Failed to stop io_uring reactor: {}", e.what()));
+  }
+  Submit(lock);
+}
+
+UringReactor::UringReactor(unsigned entries)
+    : impl_(std::make_unique<Impl>(entries)) {}
+
+UringReactor::~UringReactor() = default;
+
+bool UringReactor::IsSupported() noexcept {
+  static const bool is_supported = [] {
+    io_uring_params params{};
+    const int fd = SysSetup(1, params);
+    if (fd < 0) return false;
+    ::close(fd);
+    return (params.features & kRequiredFeatures) == kRequiredFeatures;
+  }();
+  return is_supported;
+}
+
+UringReactor* UringReactor::GetForCurrentThread() noexcept {
+  auto reactor = current_reactor.Use();
+  return *reactor;
+}
+
+void UringReactor::SetForCurrentThread(UringReactor* reactor) noexcept {
+  auto current = current_reactor.Use();
+  *current = reactor;
+}
+
+UringReactor::Result UringReactor::Perform(const Request& request,
+                                           Deadline deadline) {
+  Operation operation;
+  {
+    std::unique_lock lock(impl_->sq_mutex_);
+    auto& sqe = impl_->PrepareSqe(lock);
+    PrepareRequest(sqe, request);
+    sqe.user_data = reinterpret_cast<std::uintptr_t>(&operation);
+  }
+  // Submitted by Flush after the current task step, together with the
+  // requests of the other tasks
+
+  if (operation.Wait(deadline)) {
+    return {operation.GetResult(), false};
+  }
+
+  impl_->SubmitCancel(reinterpret_cast<std::uintptr_t>(&operation));
+  {
+    // The kernel may still write into the buffers
+    TaskCancellationBlocker block_cancel;
+    const bool is_completed = operation.Wait({});
+    UINVARIANT(is_completed, "io_uring operation was not completed");
+  }
+  return {operation.GetResult(), true};
+}
+
+void UringReactor::CancelAll(int fd) noexcept { impl_->SubmitCancelFd(fd); }
+
+void UringReactor::Flush() noexcept {
+  if (impl_->HasUnsubmitted()) {
+    std::unique_lock lock(impl_->sq_mutex_);
+    impl_->Submit(lock);
+  }
+  // Saves the reaper a wakeup under load
+  if (impl_->HasCompletions()) impl_->Reap();
+}
+
+}  // namespace engine::io::impl
+
+USERVER_NAMESPACE_END
+
+#else
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io::impl {
+
+class UringReactor::Impl final {};
+
+UringReactor::UringReactor(unsigned /*entries*/) {
+  throw std::runtime_error("io_uring is not available on this platform");
+}
+
+UringReactor::~UringReactor() = default;
+
+bool UringReactor::IsSupported() noexcept { return false; }
+
+UringReactor* UringReactor::GetForCurrentThread() noexcept { return nullptr; }
+
+void UringReactor::SetForCurrentThread(UringReactor* /*reactor*/) noexcept {}
+
+UringReactor::Result UringReactor::Perform(const Request& /*request*/,
+                                           Deadline /*deadline*/) {
+  UINVARIANT(false, "io_uring is not available on this platform");
+}
+
+void UringReactor::CancelAll(int /*fd*/) noexcept {}
+
+void UringReactor::Flush() noexcept {}
+
+}  // namespace engine::io::impl
+
+USERVER_NAMESPACE_END
+
+#endif
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io::impl {
+
+// An io_uring reactor of a TaskProcessor worker thread, an alternative to
+// waiting for the fd readiness on the ev threads.
+//
+// A coroutine prepares a submission in the ring of its current worker and
+// goes to sleep. The worker submits all the prepared requests at once after
+// the task step, then the completions are picked up either by the worker after
+// its next steps, or by a helper thread that sleeps in the kernel while
+// the worker is busy or idle. The completion wakes up the coroutine directly,
+// along with the result of the operation.
+//
+// Only available on Linux, on the other platforms there is never a reactor.
+class UringReactor final {
+ public:
+  enum class OpCode {
+    kRecv,
+    kSend,
+    kPoll,
+    // Positioned file operations, do not move the file offset
+    kRead,
+    kWrite,
+    kFsync,
+    kOpenAt,
+    kClose,
+  };
+
+  struct Request final {
+    OpCode op;
+    // The directory fd for kOpenAt, e.g. AT_FDCWD
+    int fd;
+    // The data for kRecv, kSend, kRead and kWrite, the null-terminated path
+    // for kOpenAt
+    void* buf{nullptr};
+    // The data size, the mode of a created file for kOpenAt
+    std::size_t len{0};
+    // MSG_* for kRecv and kSend, POLL* for kPoll, IORING_FSYNC_* for kFsync,
+    // O_* for kOpenAt
+    unsigned flags{0};
+    // The file offset for kRead and kWrite
+    std::uint64_t offset{0};
+  };
+
+  struct Result final {
+    // Non-negative on success, -errno on error
+    int value;
+    // The deadline has expired or the task has been cancelled. The value is
+    // -ECANCELED, unless the operation has managed to complete.
+    bool is_interrupted;
+  };
+
+  explicit UringReactor(unsigned entries);
+  ~UringReactor();
+
+  UringReactor(UringReactor&&) = delete;
+  UringReactor& operator=(UringReactor&&) = delete;
+
+  // Checks that the kernel allows io_uring
+  static bool IsSupported() noexcept;
+
+  // Returns nullptr if the current thread does not use io_uring
+  static UringReactor* GetForCurrentThread() noexcept;
+  static void SetForCurrentThread(UringReactor* reactor) noexcept;
+
+  // Must be called from a coroutine
+  Result Perform(const Request& request, Deadline deadline);
+
+  // Requests the cancellation of all the operations on `fd`
+  void CancelAll(int fd) noexcept;
+
+  // Submits the prepared requests and runs the completions, must be called
+  // by the owning worker thread between the task steps.
+  void Flush() noexcept;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace engine::io::impl
+
+USERVER_NAMESPACE_END
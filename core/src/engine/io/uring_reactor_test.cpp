@@ -0,0 +1,221 @@
+#include <engine/io/uring_reactor.hpp>
+
+#include <unistd.h>
+
+#include <array>
+#include <chrono>
+#include <string_view>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/io/exception.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/internal/net/net_listener.hpp>
+#include <userver/utest/utest.hpp>
+#include <utils/check_syscall.hpp>
+
+#include <engine/io/fd_control.hpp>
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace io = engine::io;
+using Deadline = engine::Deadline;
+
+constexpr std::size_t kWorkers = 2;
+constexpr std::chrono::milliseconds kShortTimeout{50};
+
+engine::TaskProcessorConfig MakeUringConfig() {
+  engine::TaskProcessorConfig config;
+  config.name = "io-uring";
+  config.thread_name = "uring-worker";
+  config.worker_threads = kWorkers;
+  config.io_backend = engine::IoBackend::kIoUring;
+  return config;
+}
+
+class UringTaskProcessor final {
+ public:
+  UringTaskProcessor()
+      : task_processor_(
+            MakeUringConfig(),
+            engine::current_task::GetTaskProcessor().GetTaskProcessorPools()) {}
+
+  engine::TaskProcessor& Get() { return task_processor_; }
+
+ private:
+  engine::TaskProcessor task_processor_;
+};
+
+template <typename Func>
+void RunOnUring(UringTaskProcessor& tp, Func func) {
+  engine::AsyncNoSpan(tp.Get(), [func = std::move(func)] {
+    ASSERT_NE(io::impl::UringReactor::GetForCurrentThread(), nullptr);
+    func();
+  }).Get();
+}
+
+class Pipe final {
+ public:
+  Pipe() { utils::CheckSyscall(::pipe(fd_), "creating pipe"); }
+  ~Pipe() {
+    if (fd_[0] != -1) ::close(fd_[0]);
+    if (fd_[1] != -1) ::close(fd_[1]);
+  }
+
+  int ExtractIn() { return std::exchange(fd_[0], -1); }
+  int ExtractOut() { return std::exchange(fd_[1], -1); }
+
+ private:
+  int fd_[2]{};
+};
+
+}  // namespace
+
+UTEST(UringReactor, NoReactorByDefault) {
+  EXPECT_EQ(io::impl::UringReactor::GetForCurrentThread(), nullptr);
+}
+
+UTEST(UringReactor, PingPong) {
+  if (!io::impl::UringReactor::IsSupported()) {
+    GTEST_SKIP() << "io_uring is not supported";
+  }
+  UringTaskProcessor tp;
+
+  RunOnUring(tp, [] {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    internal::net::TcpListener listener;
+    auto [server, client] = listener.MakeSocketPair(deadline);
+
+    auto echo = engine::AsyncNoSpan([&server = server, deadline] {
+      std::array<char, 16> buf{};
+      while (const auto size = server.RecvSome(buf.data(), buf.size(),
+                                               deadline)) {
+        EXPECT_EQ(server.SendAll(buf.data(), size, deadline), size);
+      }
+    });
+
+    constexpr std::string_view kMessage = "ping";
+    for (int i = 0; i < 100; ++i) {
+      // Sleeping in io_uring before the data arrives
+      engine::Yield();
+      ASSERT_EQ(client.SendAll(kMessage.data(), kMessage.size(), deadline),
+                kMessage.size());
+      std::array<char, kMessage.size()> buf{};
+      ASSERT_EQ(client.RecvAll(buf.data(), buf.size(), deadline), buf.size());
+      EXPECT_EQ(std::string_view(buf.data(), buf.size()), kMessage);
+    }
+
+    client.Close();
+    echo.Get();
+  });
+}
+
+UTEST(UringReactor, Timeout) {
+  if (!io::impl::UringReactor::IsSupported()) {
+    GTEST_SKIP() << "io_uring is not supported";
+  }
+  UringTaskProcessor tp;
+
+  RunOnUring(tp, [] {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    internal::net::TcpListener listener;
+    auto [server, client] = listener.MakeSocketPair(deadline);
+
+    std::array<char, 16> buf{};
+    UEXPECT_THROW([[maybe_unused]] auto size = server.RecvSome(
+                      buf.data(), buf.size(),
+                      Deadline::FromDuration(kShortTimeout)),
+                  io::IoTimeout);
+    EXPECT_FALSE(server.WaitReadable(Deadline::FromDuration(kShortTimeout)));
+
+    // The socket stays usable
+    ASSERT_EQ(client.SendAll("test", 4, deadline), 4);
+    EXPECT_EQ(server.RecvAll(buf.data(), 4, deadline), 4);
+  });
+}
+
+UTEST(UringReactor, Cancel) {
+  if (!io::impl::UringReactor::IsSupported()) {
+    GTEST_SKIP() << "io_uring is not supported";
+  }
+  UringTaskProcessor tp;
+
+  RunOnUring(tp, [] {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    internal::net::TcpListener listener;
+    auto [server, client] = listener.MakeSocketPair(deadline);
+
+    auto reader = engine::AsyncNoSpan([&server = server, deadline] {
+      std::array<char, 16> buf{};
+      UEXPECT_THROW([[maybe_unused]] auto size =
+                        server.RecvSome(buf.data(), buf.size(), deadline),
+                    io::IoCancelled);
+    });
+    engine::SleepFor(kShortTimeout);
+    reader.SyncCancel();
+  });
+}
+
+UTEST(UringReactor, CloseWakesUpWaiter) {
+  if (!io::impl::UringReactor::IsSupported()) {
+    GTEST_SKIP() << "io_uring is not supported";
+  }
+  UringTaskProcessor tp;
+
+  RunOnUring(tp, [] {
+    Pipe pipe;
+    auto read_control = io::impl::FdControl::Adopt(pipe.ExtractIn());
+
+    auto waiter = engine::AsyncNoSpan([&read_control] {
+      auto& read_dir = read_control->Read();
+      EXPECT_TRUE(
+          read_dir.Wait(Deadline::FromDuration(utest::kMaxTestWaitTime)));
+      EXPECT_FALSE(read_dir.IsValid());
+    });
+    engine::SleepFor(kShortTimeout);
+    read_control->Close();
+    waiter.Get();
+  });
+}
+
+UTEST(UringReactor, ManyWaiters) {
+  if (!io::impl::UringReactor::IsSupported()) {
+    GTEST_SKIP() << "io_uring is not supported";
+  }
+  UringTaskProcessor tp;
+
+  RunOnUring(tp, [] {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    internal::net::TcpListener listener;
+    // More than a submission queue holds
+    constexpr std::size_t kPairs = 300;
+
+    std::vector<engine::io::Socket> clients;
+    std::vector<engine::TaskWithResult<std::size_t>> readers;
+    for (std::size_t i = 0; i < kPairs; ++i) {
+      auto [server, client] = listener.MakeSocketPair(deadline);
+      clients.push_back(std::move(client));
+      readers.push_back(engine::AsyncNoSpan(
+          [deadline](auto&& server) {
+            std::array<char, 16> buf{};
+            return server.RecvSome(buf.data(), buf.size(), deadline);
+          },
+          std::move(server)));
+    }
+
+    engine::SleepFor(kShortTimeout);
+    for (auto& client : clients) {
+      ASSERT_EQ(client.SendAll("x", 1, deadline), 1);
+    }
+    for (auto& reader : readers) EXPECT_EQ(reader.Get(), 1);
+  });
+}
+
+USERVER_NAMESPACE_END
@@ -7,6 +7,7 @@
 #include <vector>
 
 #include <concurrent/impl/interference_shield.hpp>
+#include <userver/engine/adaptive_mutex.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/mutex.hpp>
 #include <userver/engine/run_standalone.hpp>
@@ -144,6 +145,10 @@ void single_waiting_task_mutex_lock(benchmark::State& state) {
       [&] { generic_lock<engine::SingleWaitingTaskMutex>(state); });
 }
 
+void adaptive_mutex_lock(benchmark::State& state) {
+  engine::RunStandalone([&] { generic_lock<engine::AdaptiveMutex>(state); });
+}
+
 void mutex_coro_unlock(benchmark::State& state) {
   engine::RunStandalone([&] { generic_unlock<engine::Mutex>(state); });
 }
@@ -157,6 +162,10 @@ void single_waiting_task_mutex_unlock(benchmark::State& state) {
       [&] { generic_unlock<engine::SingleWaitingTaskMutex>(state); });
 }
 
+void adaptive_mutex_unlock(benchmark::State& state) {
+  engine::RunStandalone([&] { generic_unlock<engine::AdaptiveMutex>(state); });
+}
+
 void mutex_coro_contention(benchmark::State& state) {
   engine::RunStandalone(state.range(0),
                         [&] { generic_contention<engine::Mutex>(state); });
@@ -172,6 +181,12 @@ void single_waiting_task_mutex_contention(benchmark::State& state) {
   });
 }
 
+void adaptive_mutex_contention(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    generic_contention<engine::AdaptiveMutex>(state);
+  });
+}
+
 void mutex_coro_contention_with_payload(benchmark::State& state) {
   engine::RunStandalone(state.range(0), [&] {
     generic_contention_with_payload<engine::Mutex>(state);
@@ -189,22 +204,34 @@ void single_waiting_task_mutex_contention_with_payload(
   });
 }
 
+void adaptive_mutex_contention_with_payload(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    generic_contention_with_payload<engine::AdaptiveMutex>(state);
+  });
+}
+
 }  // namespace
 
 BENCHMARK(mutex_coro_lock);
 BENCHMARK(mutex_std_lock);
 BENCHMARK(single_waiting_task_mutex_lock);
+BENCHMARK(adaptive_mutex_lock);
 
 BENCHMARK(mutex_coro_unlock);
 BENCHMARK(mutex_std_unlock);
 BENCHMARK(single_waiting_task_mutex_unlock);
+BENCHMARK(adaptive_mutex_unlock);
 
 BENCHMARK(mutex_coro_contention)->RangeMultiplier(2)->Range(1, 32);
 BENCHMARK(mutex_std_contention)->RangeMultiplier(2)->Range(1, 32);
 BENCHMARK(single_waiting_task_mutex_contention)->Range(1, 2);
+BENCHMARK(adaptive_mutex_contention)->RangeMultiplier(2)->Range(1, 32);
 
 BENCHMARK(mutex_coro_contention_with_payload)->RangeMultiplier(2)->Range(1, 32);
 BENCHMARK(mutex_std_contention_with_payload)->RangeMultiplier(2)->Range(1, 32);
 BENCHMARK(single_waiting_task_mutex_contention_with_payload)->Range(1, 2);
+BENCHMARK(adaptive_mutex_contention_with_payload)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
 
 USERVER_NAMESPACE_END
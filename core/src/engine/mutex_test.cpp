@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <userver/engine/adaptive_mutex.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/mutex.hpp>
 #include <userver/engine/shared_mutex.hpp>
@@ -174,5 +175,7 @@ INSTANTIATE_TYPED_UTEST_SUITE_P(EngineMutex, Mutex, engine::Mutex);
 INSTANTIATE_TYPED_UTEST_SUITE_P(EngineSharedMutex, Mutex, engine::SharedMutex);
 INSTANTIATE_TYPED_UTEST_SUITE_P(EngineSingleWaitingTaskMutex, Mutex,
                                 engine::SingleWaitingTaskMutex);
+INSTANTIATE_TYPED_UTEST_SUITE_P(EngineAdaptiveMutex, Mutex,
+                                engine::AdaptiveMutex);
 
 USERVER_NAMESPACE_END
@@ -151,7 +151,8 @@ bool CancellableSemaphore::LockSlowPath(Deadline deadline,
       return status == TryLockStatus::kSuccess;
     }
 
-    const auto wakeup_source = current.Sleep(wait_strategy, deadline);
+    const auto wakeup_source = current.Sleep(wait_strategy, deadline,
+                                             impl::WaitKind::kSemaphore);
     if (!impl::HasWaitSucceeded(wakeup_source)) {
       return false;
     }
@@ -1,16 +1,23 @@
 #include <benchmark/benchmark.h>
 
+#include <atomic>
+#include <vector>
+
 #include <userver/engine/async.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/shared_mutex.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/striped_shared_mutex.hpp>
+#include <userver/engine/wait_all_checked.hpp>
 #include <utils/impl/parallelize_benchmark.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
+template <typename Mutex>
 void shared_mutex_benchmark(benchmark::State& state) {
   engine::RunStandalone(state.range(0), [&] {
     int variable = 0;
-    engine::SharedMutex mutex;
+    Mutex mutex;
 
     auto initial_lock_holder = engine::AsyncNoSpan([&] {
       // ensure the locks are actually needed
@@ -26,6 +33,67 @@ void shared_mutex_benchmark(benchmark::State& state) {
     });
   });
 }
-BENCHMARK(shared_mutex_benchmark)->DenseRange(1, 6);
+BENCHMARK_TEMPLATE(shared_mutex_benchmark, engine::SharedMutex)
+    ->DenseRange(1, 6);
+BENCHMARK_TEMPLATE(shared_mutex_benchmark, engine::StripedSharedMutex)
+    ->DenseRange(1, 6);
+
+// Rare writers among a crowd of readers, shows the price of the writer side
+template <typename Mutex>
+void shared_mutex_read_mostly(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    int variable = 0;
+    Mutex mutex;
+
+    RunParallelBenchmark(state, [&](auto& range) {
+      std::size_t iteration = 0;
+      for ([[maybe_unused]] auto _ : range) {
+        if (++iteration % 1024 == 0) {
+          std::unique_lock lock(mutex);
+          ++variable;
+        } else {
+          std::shared_lock lock(mutex);
+          benchmark::DoNotOptimize(variable);
+        }
+      }
+    });
+  });
+}
+BENCHMARK_TEMPLATE(shared_mutex_read_mostly, engine::SharedMutex)
+    ->DenseRange(1, 6);
+BENCHMARK_TEMPLATE(shared_mutex_read_mostly, engine::StripedSharedMutex)
+    ->DenseRange(1, 6);
+
+// A writer unlock that releases a crowd of readers at once
+void shared_mutex_writer_releases_readers(benchmark::State& state) {
+  engine::RunStandalone(state.range(1), [&] {
+    const auto readers_count = static_cast<std::size_t>(state.range(0));
+    engine::SharedMutex mutex;
+
+    for ([[maybe_unused]] auto _ : state) {
+      state.PauseTiming();
+      std::unique_lock writer_lock(mutex);
+      std::atomic<std::size_t> started{0};
+      std::vector<engine::TaskWithResult<void>> readers;
+      readers.reserve(readers_count);
+      for (std::size_t i = 0; i < readers_count; ++i) {
+        readers.push_back(engine::AsyncNoSpan([&] {
+          ++started;
+          std::shared_lock lock(mutex);
+        }));
+      }
+      // Let the readers go to sleep on the mutex
+      while (started != readers_count) engine::Yield();
+      engine::Yield();
+      state.ResumeTiming();
+
+      writer_lock.unlock();
+      engine::WaitAllChecked(readers);
+    }
+  });
+}
+BENCHMARK(shared_mutex_writer_releases_readers)
+    ->ArgsProduct({{8, 64, 512}, {1, 4}})
+    ->UseRealTime();
 
 USERVER_NAMESPACE_END
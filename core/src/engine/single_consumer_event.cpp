@@ -57,7 +57,8 @@ bool SingleConsumerEvent::WaitForEventUntil(Deadline deadline) {
 
     LOG_TRACE() << "iteration()";
 
-    const auto wakeup_source = current.Sleep(wait_manager, deadline);
+    const auto wakeup_source = current.Sleep(wait_manager, deadline,
+                                             impl::WaitKind::kEvent);
     if (!impl::HasWaitSucceeded(wakeup_source)) {
       LOG_TRACE() << "failure";
       return false;
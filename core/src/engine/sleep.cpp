@@ -24,7 +24,7 @@ class CommonSleepWaitStrategy final : public WaitStrategy {
 void InterruptibleSleepUntil(Deadline deadline) {
   auto& current = current_task::GetCurrentTaskContext();
   impl::CommonSleepWaitStrategy wait_manager{};
-  current.Sleep(wait_manager, deadline);
+  current.Sleep(wait_manager, deadline, impl::WaitKind::kSleep);
 }
 
 void SleepUntil(Deadline deadline) {
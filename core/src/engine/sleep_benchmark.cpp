@@ -1,5 +1,7 @@
 #include <benchmark/benchmark.h>
 
+#include <vector>
+
 #include <engine/ev/thread_control.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/run_standalone.hpp>
@@ -67,4 +69,30 @@ BENCHMARK_CAPTURE(unreached_task_deadline_benchmark, no_task_deadline, false);
 BENCHMARK_CAPTURE(unreached_task_deadline_benchmark, unreached_task_deadline,
                   true);
 
+// Unreached timeouts, while state.range(0) other timeouts are pending
+void unreached_wait_for_with_pending_timers_benchmark(
+    benchmark::State& state) {
+  engine::RunStandalone([&] {
+    std::vector<engine::TaskWithResult<void>> sleepers;
+    sleepers.reserve(state.range(0));
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+      sleepers.push_back(engine::AsyncNoSpan(
+          [] { engine::InterruptibleSleepFor(std::chrono::hours{1}); }));
+    }
+    engine::Yield();
+
+    for ([[maybe_unused]] auto _ : state) {
+      auto task = engine::AsyncNoSpan([] { engine::Yield(); });
+      task.WaitFor(20s);
+
+      if (!task.IsFinished()) abort();
+    }
+
+    for (auto& sleeper : sleepers) sleeper.SyncCancel();
+  });
+}
+BENCHMARK(unreached_wait_for_with_pending_timers_benchmark)
+    ->RangeMultiplier(16)
+    ->Range(1, 16 * 1024);
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,115 @@
+#include <userver/engine/striped_shared_mutex.hpp>
+
+#include <atomic>
+
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+StripedSharedMutex::StripedSharedMutex() = default;
+
+StripedSharedMutex::~StripedSharedMutex() {
+  UASSERT_MSG(!writer_active_.load(), "StripedSharedMutex is destroyed locked");
+}
+
+void StripedSharedMutex::lock() {
+  const auto ok = try_lock_until(Deadline{});
+  UASSERT(ok);
+}
+
+void StripedSharedMutex::unlock() {
+  UASSERT_MSG(writer_active_.load(), "unlock without lock");
+  ReleaseWriter();
+}
+
+bool StripedSharedMutex::try_lock() {
+  if (!writers_mutex_.try_lock()) return false;
+
+  writer_active_.store(true);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (readers_.IsFree()) return true;
+
+  ReleaseWriter();
+  return false;
+}
+
+bool StripedSharedMutex::try_lock_until(Deadline deadline) {
+  TaskCancellationBlocker blocker;
+  if (!writers_mutex_.try_lock_until(deadline)) return false;
+
+  /*
+   * Dekker-style handshake with the readers, both sides use seq_cst:
+   * - the writer sets writer_active_, then checks readers_;
+   * - a reader marks readers_, then checks writer_active_.
+   * At least one of them sees the other. A reader that sees the writer
+   * leaves and signals readers_left_event_, so the wakeup is not lost.
+   */
+  writer_active_.store(true);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  if (readers_left_event_.WaitUntil(deadline,
+                                    [this] { return readers_.IsFree(); })) {
+    return true;
+  }
+
+  ReleaseWriter();
+  return false;
+}
+
+void StripedSharedMutex::lock_shared() {
+  const auto ok = try_lock_shared_until(Deadline{});
+  UASSERT(ok);
+}
+
+void StripedSharedMutex::unlock_shared() { LeaveReader(); }
+
+bool StripedSharedMutex::try_lock_shared() { return TryEnterReader(); }
+
+bool StripedSharedMutex::try_lock_shared_until(Deadline deadline) {
+  TaskCancellationBlocker blocker;
+  while (!TryEnterReader()) {
+    if (!WaitForNoWriter(deadline)) return false;
+  }
+  return true;
+}
+
+bool StripedSharedMutex::TryEnterReader() {
+  /* Fast path, don't even touch readers_ while a writer is there */
+  if (writer_active_.load(std::memory_order_relaxed)) return false;
+
+  readers_.DoLock();
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (!writer_active_.load()) return true;
+
+  LeaveReader();
+  return false;
+}
+
+void StripedSharedMutex::LeaveReader() {
+  readers_.DoUnlock();
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (writer_active_.load()) readers_left_event_.Send();
+}
+
+bool StripedSharedMutex::WaitForNoWriter(Deadline deadline) {
+  std::unique_lock lock(writer_released_mutex_);
+  return writer_released_cv_.WaitUntil(lock, deadline, [this] {
+    return !writer_active_.load(std::memory_order_relaxed);
+  });
+}
+
+void StripedSharedMutex::ReleaseWriter() {
+  {
+    std::lock_guard lock(writer_released_mutex_);
+    writer_active_.store(false);
+  }
+  writer_released_cv_.NotifyAll();
+  writers_mutex_.unlock();
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
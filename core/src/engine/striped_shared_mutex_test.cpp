@@ -0,0 +1,159 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <shared_mutex>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/striped_shared_mutex.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(StripedSharedMutex, SharedLockUnlockDouble) {
+  engine::StripedSharedMutex mutex;
+  mutex.lock_shared();
+  mutex.lock_shared();
+  mutex.unlock_shared();
+  mutex.unlock_shared();
+
+  mutex.lock();
+  mutex.unlock();
+}
+
+UTEST(StripedSharedMutex, SharedAndUniqueLock) {
+  engine::StripedSharedMutex mutex;
+
+  std::unique_lock lock(mutex);
+  auto reader = utils::Async("", [&mutex] { std::shared_lock lock(mutex); });
+
+  reader.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_FALSE(reader.IsFinished());
+
+  lock.unlock();
+
+  reader.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_TRUE(reader.IsFinished());
+  UEXPECT_NO_THROW(reader.Get());
+}
+
+UTEST(StripedSharedMutex, UniqueAndSharedLock) {
+  engine::StripedSharedMutex mutex;
+
+  std::shared_lock lock(mutex);
+  auto writer = utils::Async("", [&mutex] { std::unique_lock lock(mutex); });
+
+  writer.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_FALSE(writer.IsFinished());
+
+  lock.unlock();
+
+  writer.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_TRUE(writer.IsFinished());
+  UEXPECT_NO_THROW(writer.Get());
+}
+
+UTEST_MT(StripedSharedMutex, WritersDontStarve, 2) {
+  engine::StripedSharedMutex mutex;
+  std::atomic<int> counter{0};
+  std::atomic<int> loaded{-1};
+
+  std::shared_lock lock(mutex);
+  auto writer = utils::Async("", [&] {
+    std::unique_lock lock(mutex);
+    loaded = counter.load();
+  });
+
+  writer.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_FALSE(writer.IsFinished());
+
+  std::vector<engine::TaskWithResult<void>> readers;
+  readers.reserve(10);
+  for (int i = 0; i < 10; i++) {
+    readers.push_back(utils::Async("", [&] {
+      std::shared_lock lock(mutex);
+      counter++;
+    }));
+  }
+
+  writer.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_FALSE(writer.IsFinished());
+
+  lock.unlock();
+
+  UEXPECT_NO_THROW(writer.Get());
+  EXPECT_EQ(loaded.load(), 0);
+  for (auto& reader : readers) reader.Get();
+  EXPECT_EQ(counter.load(), 10);
+}
+
+UTEST(StripedSharedMutex, TryLock) {
+  engine::StripedSharedMutex mutex;
+
+  for (int i = 0; i < 10; i++) {
+    ASSERT_TRUE(mutex.try_lock());
+    mutex.unlock();
+  }
+
+  ASSERT_TRUE(mutex.try_lock_shared());
+  EXPECT_FALSE(mutex.try_lock());
+  EXPECT_FALSE(mutex.try_lock_for(std::chrono::milliseconds(10)));
+  mutex.unlock_shared();
+
+  ASSERT_TRUE(mutex.try_lock());
+  EXPECT_FALSE(mutex.try_lock_shared());
+  EXPECT_FALSE(mutex.try_lock_shared_for(std::chrono::milliseconds(10)));
+  mutex.unlock();
+
+  // mutex must be free of writers
+  ASSERT_TRUE(mutex.try_lock_shared());
+  mutex.unlock_shared();
+}
+
+UTEST(StripedSharedMutex, LockWhileCancelled) {
+  engine::StripedSharedMutex mutex;
+  std::unique_lock lock(mutex);
+
+  auto reader = utils::Async("", [&mutex] {
+    engine::current_task::GetCancellationToken().RequestCancel();
+    std::shared_lock lock(mutex);
+  });
+  engine::Yield();
+  lock.unlock();
+
+  UEXPECT_NO_THROW(reader.Get());
+}
+
+UTEST_MT(StripedSharedMutex, Stress, 4) {
+  engine::StripedSharedMutex mutex;
+  std::int64_t value = 0;
+  std::atomic<bool> torn{false};
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (int i = 0; i < 8; ++i) {
+    tasks.push_back(utils::Async("", [&, i] {
+      for (int j = 0; j < 1000; ++j) {
+        if (i % 4 == 0) {
+          std::unique_lock lock(mutex);
+          value += 2;
+          engine::Yield();
+          value -= 1;
+        } else {
+          std::shared_lock lock(mutex);
+          const auto before = value;
+          engine::Yield();
+          if (value != before) torn = true;
+        }
+      }
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+
+  EXPECT_FALSE(torn);
+  EXPECT_EQ(value, 2 * 1000);
+}
+
+USERVER_NAMESPACE_END
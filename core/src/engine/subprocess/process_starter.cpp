@@ -1,13 +1,18 @@
 #include <userver/engine/subprocess/process_starter.hpp>
 
+#include <fcntl.h>
+#include <sched.h>
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <csignal>
 #include <cstdio>
 #include <cstring>
 #include <iostream>
+#include <memory>
+#include <string_view>
 
 #include <fmt/format.h>
 #include <boost/range/adaptor/transformed.hpp>
@@ -31,8 +36,174 @@ USERVER_NAMESPACE_BEGIN
 namespace engine::subprocess {
 namespace {
 
-void DoExec(const std::string& command, const std::vector<std::string>& args,
-            const EnvironmentVariables& env,
+// The arguments for exec are prepared before starting the child process,
+// so that the child does not allocate
+class ExecArgs final {
+ public:
+  ExecArgs(const std::string& command, const std::vector<std::string>& args,
+           const EnvironmentVariables& env) {
+    argv_ptrs_.reserve(args.size() + 2);
+    envp_buf_.reserve(env.size());
+    envp_ptrs_.reserve(env.size() + 1);
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    argv_ptrs_.push_back(const_cast<char*>(command.c_str()));
+    for (const auto& arg : args) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      argv_ptrs_.push_back(const_cast<char*>(arg.c_str()));
+    }
+    argv_ptrs_.push_back(nullptr);
+
+    for (const auto& [key, value] : env) {
+      envp_buf_.emplace_back(utils::StrCat(key, "=", value));
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      envp_ptrs_.push_back(const_cast<char*>(envp_buf_.back().c_str()));
+    }
+    envp_ptrs_.push_back(nullptr);
+  }
+
+  char* const* Argv() const noexcept { return argv_ptrs_.data(); }
+  char** Envp() noexcept { return envp_ptrs_.data(); }
+
+ private:
+  std::vector<char*> argv_ptrs_;
+  std::vector<std::string> envp_buf_;
+  std::vector<char*> envp_ptrs_;
+};
+
+#ifdef __linux__
+
+constexpr std::string_view kStartMethod = "clone";
+
+// Paths to try with execve, in the order of execvp
+std::vector<std::string> GetExecPaths(const std::string& command,
+                                      const EnvironmentVariables& env,
+                                      bool use_path) {
+  if (!use_path || command.find('/') != std::string::npos) return {command};
+
+  const auto* path_variable = env.GetValueOptional("PATH");
+  // The default of execvp
+  const std::string_view path =
+      path_variable ? std::string_view{*path_variable} : "/bin:/usr/bin";
+
+  std::vector<std::string> paths;
+  std::size_t begin = 0;
+  while (true) {
+    const auto end = std::min(path.find(':', begin), path.size());
+    const auto dir = path.substr(begin, end - begin);
+    paths.push_back(dir.empty() ? command : utils::StrCat(dir, "/", command));
+    if (end == path.size()) break;
+    begin = end + 1;
+  }
+  return paths;
+}
+
+// The child shares the memory with the parent, which is suspended until
+// the child calls execve or dies. So the child must not allocate or take
+// locks, only async-signal-safe calls are allowed.
+struct ChildContext final {
+  const std::vector<std::string>& paths;
+  char* const* argv;
+  char* const* envp;
+  const char* stdout_file;
+  const char* stderr_file;
+  sigset_t sigmask;
+};
+
+void WriteToStderr(std::string_view message) noexcept {
+  [[maybe_unused]] const auto res =
+      write(STDERR_FILENO, message.data(), message.size());
+}
+
+// Reports the failure as the failed fork + exec did, the child is killed by
+// SIGABRT
+[[noreturn]] void AbortChild(std::string_view message) noexcept {
+  WriteToStderr("Cannot execute child: ");
+  WriteToStderr(message);
+  WriteToStderr("\n");
+  kill(getpid(), SIGABRT);
+  _exit(127);
+}
+
+bool RedirectOutput(const char* path, int fd) noexcept {
+  if (!path) return true;
+
+  // Same as freopen(path, "a")
+  const int file = open(path, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0666);
+  if (file == -1) return false;
+  const bool redirected = dup2(file, fd) != -1;
+  close(file);
+  return redirected;
+}
+
+int RunChild(void* arg) noexcept {
+  const auto& context = *static_cast<const ChildContext*>(arg);
+
+  // The handlers of the parent must not run in the shared memory
+  struct sigaction default_action {};
+  default_action.sa_handler = SIG_DFL;
+  sigemptyset(&default_action.sa_mask);
+  for (int signal = 1; signal < NSIG; ++signal) {
+    struct sigaction action {};
+    if (sigaction(signal, nullptr, &action) != 0) continue;
+    if (action.sa_handler != SIG_DFL && action.sa_handler != SIG_IGN) {
+      sigaction(signal, &default_action, nullptr);
+    }
+  }
+  sigprocmask(SIG_SETMASK, &context.sigmask, nullptr);
+
+  if (!RedirectOutput(context.stdout_file, STDOUT_FILENO)) {
+    AbortChild("can't redirect stdout");
+  }
+  if (!RedirectOutput(context.stderr_file, STDERR_FILENO)) {
+    AbortChild("can't redirect stderr");
+  }
+
+  for (const auto& path : context.paths) {
+    execve(path.c_str(), context.argv, context.envp);
+    if (errno != ENOENT && errno != ENOTDIR && errno != EACCES) break;
+  }
+  AbortChild("execve failed");
+}
+
+// Unlike fork(), clone(CLONE_VM | CLONE_VFORK) does not copy the page tables,
+// which takes tens of milliseconds for the processes with a big RSS. It is
+// what posix_spawn does, but the failed exec is reported in the same way as
+// with fork.
+pid_t StartChild(const std::string& command, ExecArgs& exec_args,
+                 const EnvironmentVariables& env, const ExecOptions& options) {
+  // The child only does the syscalls
+  constexpr std::size_t kChildStackSize = 64 * 1024;
+  const auto stack = std::make_unique<char[]>(kChildStackSize);
+
+  const auto paths = GetExecPaths(command, env, options.use_path);
+  ChildContext context{
+      paths,
+      exec_args.Argv(),
+      exec_args.Envp(),
+      options.stdout_file ? options.stdout_file->c_str() : nullptr,
+      options.stderr_file ? options.stderr_file->c_str() : nullptr,
+      {}};
+
+  sigset_t all_signals;
+  sigfillset(&all_signals);
+  pthread_sigmask(SIG_BLOCK, &all_signals, &context.sigmask);
+
+  // The stack grows down on all the supported platforms
+  const auto pid = clone(&RunChild, stack.get() + kChildStackSize,
+                         CLONE_VM | CLONE_VFORK | SIGCHLD, &context);
+  const auto clone_errno = errno;
+
+  pthread_sigmask(SIG_SETMASK, &context.sigmask, nullptr);
+  errno = clone_errno;
+  return utils::CheckSyscall(pid, "clone");
+}
+
+#else
+
+constexpr std::string_view kStartMethod = "fork";
+
+void DoExec(ExecArgs& exec_args, const std::string& command,
             const std::optional<std::string>& stdout_file,
             const std::optional<std::string>& stderr_file, bool use_path) {
   if (stdout_file) {
@@ -45,38 +216,40 @@ void DoExec(const std::string& command, const std::vector<std::string>& args,
       utils::CheckSyscall(-1, "freopen stderr to {}", *stdout_file);
     }
   }
-  std::vector<char*> argv_ptrs;
-  std::vector<std::string> envp_buf;
-  std::vector<char*> envp_ptrs;
-  argv_ptrs.reserve(args.size() + 2);
-  envp_buf.reserve(env.size());
-  envp_ptrs.reserve(env.size() + 1);
-
-  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-  argv_ptrs.push_back(const_cast<char*>(command.c_str()));
-  for (const auto& arg : args) {
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-    argv_ptrs.push_back(const_cast<char*>(arg.c_str()));
-  }
-  argv_ptrs.push_back(nullptr);
 
-  for (const auto& [key, value] : env) {
-    envp_buf.emplace_back(utils::StrCat(key, "=", value));
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-    envp_ptrs.push_back(const_cast<char*>(envp_buf.back().c_str()));
-  }
-  envp_ptrs.push_back(nullptr);
-
-  environ = envp_ptrs.data();  // The variable is assigned to the environment to
-                               // use the execv, execvp functions
+  environ = exec_args.Envp();  // The variable is assigned to the environment
+                               // to use the execv, execvp functions
 
   if (!use_path) {
-    utils::CheckSyscall(execv(command.c_str(), argv_ptrs.data()), "execv");
+    utils::CheckSyscall(execv(command.c_str(), exec_args.Argv()), "execv");
   } else {
-    utils::CheckSyscall(execvp(command.c_str(), argv_ptrs.data()), "execvp");
+    utils::CheckSyscall(execvp(command.c_str(), exec_args.Argv()), "execvp");
   }
 }
 
+pid_t StartChild(const std::string& command, ExecArgs& exec_args,
+                 const EnvironmentVariables&, const ExecOptions& options) {
+  const auto pid = utils::CheckSyscall(fork(), "fork");
+  if (pid) return pid;
+
+  // in child process
+  try {
+    try {
+      DoExec(exec_args, command, options.stdout_file, options.stderr_file,
+             options.use_path);
+    } catch (const std::exception& ex) {
+      std::cerr << "Cannot execute child: " << ex.what();
+    }
+  } catch (...) {
+    // must not do anything in a child
+    std::abort();
+  }
+  // on success execve or execvp does not return
+  std::abort();
+}
+
+#endif
+
 EnvironmentVariables ApplyEnviromentUpdate(
     std::optional<EnvironmentVariables>&& env,
     std::optional<EnvironmentVariablesUpdate>&& env_update) {
@@ -126,43 +299,27 @@ ChildProcess ProcessStarter::Exec(const std::string& command,
           return key_value.first + '=' + key_value.second;
         });
     LOG_DEBUG() << fmt::format(
-        "do fork() + {}(), command={}, args=[\'{}\'], env=[]",
-        options.use_path ? "execv" : "execvp", fmt::join(args, "' '"),
+        "do {}() + {}(), command={}, args=[\'{}\'], env=[]", kStartMethod,
+        options.use_path ? "execvp" : "execv", command, fmt::join(args, "' '"),
         fmt::join(keys, ", "));
 
-    const auto pid = utils::CheckSyscall(fork(), "fork");
-    if (pid) {
-      // in parent thread
-      span.AddTag("child-process-pid", pid);
-      LOG_DEBUG() << "Started child process with pid=" << pid;
-      Promise<ChildProcessStatus> exec_result_promise;
-      auto res = ChildProcessMapSet(
-          pid, ev::ChildProcessMapValue(std::move(exec_result_promise)));
-      if (res.second) {
-        promise.set_value(ChildProcess{
-            ChildProcessImpl{pid, res.first->status_promise.get_future()}});
-      } else {
-        const auto msg = fmt::format(
-            "process with pid={} already exists in child_process_map", pid);
-        LOG_ERROR() << msg << ", send SIGKILL";
-        ChildProcessImpl(pid, Future<ChildProcessStatus>{}).SendSignal(SIGKILL);
-        promise.set_exception(std::make_exception_ptr(std::runtime_error(msg)));
-      }
+    ExecArgs exec_args{command, args, env};
+    const auto pid = StartChild(command, exec_args, env, options);
+
+    span.AddTag("child-process-pid", pid);
+    LOG_DEBUG() << "Started child process with pid=" << pid;
+    Promise<ChildProcessStatus> exec_result_promise;
+    auto res = ChildProcessMapSet(
+        pid, ev::ChildProcessMapValue(std::move(exec_result_promise)));
+    if (res.second) {
+      promise.set_value(ChildProcess{
+          ChildProcessImpl{pid, res.first->status_promise.get_future()}});
     } else {
-      // in child thread
-      try {
-        try {
-          DoExec(command, args, env, options.stdout_file, options.stderr_file,
-                 options.use_path);
-        } catch (const std::exception& ex) {
-          std::cerr << "Cannot execute child: " << ex.what();
-        }
-      } catch (...) {
-        // must not do anything in a child
-        std::abort();
-      }
-      // on success execve or execvp does not return
-      std::abort();
+      const auto msg = fmt::format(
+          "process with pid={} already exists in child_process_map", pid);
+      LOG_ERROR() << msg << ", send SIGKILL";
+      ChildProcessImpl(pid, Future<ChildProcessStatus>{}).SendSignal(SIGKILL);
+      promise.set_exception(std::make_exception_ptr(std::runtime_error(msg)));
     }
   });
 
@@ -2,8 +2,10 @@
 
 #include <array>
 #include <thread>
+#include <vector>
 
 #include <userver/engine/async.hpp>
+#include <userver/engine/wait_all_checked.hpp>
 #include <userver/engine/impl/task_local_storage.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/utils/async.hpp>
@@ -99,4 +101,60 @@ void async_comparisons_coro_spanned(benchmark::State& state) {
 }
 BENCHMARK(async_comparisons_coro_spanned)->RangeMultiplier(2)->Range(1, 32);
 
+void async_fan_out_loop(benchmark::State& state) {
+  engine::RunStandalone(4, [&] {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+      std::vector<engine::TaskWithResult<void>> tasks;
+      tasks.reserve(count);
+      for (std::size_t i = 0; i < count; ++i) {
+        tasks.push_back(utils::Async("", [] {}));
+      }
+      engine::WaitAllChecked(tasks);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+  });
+}
+BENCHMARK(async_fan_out_loop)->RangeMultiplier(10)->Range(10, 1000);
+
+void async_fan_out_batch(benchmark::State& state) {
+  engine::RunStandalone(4, [&] {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+      auto tasks = utils::AsyncBatch("", count, [](std::size_t) {});
+      engine::WaitAllChecked(tasks);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+  });
+}
+BENCHMARK(async_fan_out_batch)->RangeMultiplier(10)->Range(10, 1000);
+
+void async_fan_out_loop_no_span(benchmark::State& state) {
+  engine::RunStandalone(4, [&] {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+      std::vector<engine::TaskWithResult<void>> tasks;
+      tasks.reserve(count);
+      for (std::size_t i = 0; i < count; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([] {}));
+      }
+      engine::WaitAllChecked(tasks);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+  });
+}
+BENCHMARK(async_fan_out_loop_no_span)->RangeMultiplier(10)->Range(10, 1000);
+
+void async_fan_out_batch_no_span(benchmark::State& state) {
+  engine::RunStandalone(4, [&] {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+      auto tasks = engine::SpawnManyNoSpan(count, [](std::size_t) {});
+      engine::WaitAllChecked(tasks);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+  });
+}
+BENCHMARK(async_fan_out_batch_no_span)->RangeMultiplier(10)->Range(10, 1000);
+
 USERVER_NAMESPACE_END
@@ -3,6 +3,7 @@
 #include <atomic>
 
 #include <userver/engine/async.hpp>
+#include <userver/engine/get_all.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/utils/lazy_prvalue.hpp>
@@ -286,6 +287,52 @@ UTEST(Async, FromNonWorkerThread) {
   task.Wait();
 }
 
+UTEST_MT(Async, SpawnMany, 4) {
+  constexpr std::size_t kCount = 100;
+  auto tasks = engine::SpawnManyNoSpan(kCount, [](std::size_t index) {
+    return index * 2;
+  });
+  ASSERT_EQ(tasks.size(), kCount);
+
+  const auto results = engine::GetAll(tasks);
+  ASSERT_EQ(results.size(), kCount);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    EXPECT_EQ(results[i], i * 2);
+  }
+
+  EXPECT_TRUE(engine::SpawnManyNoSpan(0, [](std::size_t) {}).empty());
+}
+
+UTEST(Async, SpawnManyResourceDeallocation) {
+  const CountingConstructions function{};
+  auto tasks = engine::SpawnManyNoSpan(
+      10, [function](std::size_t index) { return index; });
+
+  // The allocation of the batch must survive the release of most of its tasks
+  auto last_task = std::move(tasks.back());
+  tasks.clear();
+  EXPECT_EQ(last_task.Get(), 9);
+
+  EXPECT_EQ(CountingConstructions::constructions,
+            CountingConstructions::destructions + 1);
+}
+
+UTEST(Async, SpawnManyCancelledBeforeStart) {
+  std::atomic<std::size_t> started{0};
+  auto tasks =
+      engine::SpawnManyNoSpan(10, [&started](std::size_t) { ++started; });
+
+  // The tasks cannot start before we yield on a single-threaded TaskProcessor
+  for (auto& task : tasks) {
+    task.RequestCancel();
+  }
+  for (auto& task : tasks) {
+    task.Wait();
+    EXPECT_EQ(task.GetState(), engine::Task::State::kCancelled);
+  }
+  EXPECT_EQ(started, 0);
+}
+
 UTEST_MT(Async, CancelNotifyRace, 4) {
   // Stable reproduction of the race was achieved after ~10 seconds
   // (around 10'000'000 iterations) under Asan + Release + LTO.
@@ -7,6 +7,7 @@
 #include <userver/utils/assert.hpp>
 
 #include <engine/ev/data_pipe_to_ev.hpp>
+#include <engine/ev/thread.hpp>
 #include <engine/task/task_context.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -65,13 +66,17 @@ class ContextTimer::Impl final : public TimerArmer<Impl>,
   void StopTimerInEvThread() noexcept;
 
   static void OnTimer(struct ev_loop*, ev_timer* w, int) noexcept;
+  static void OnWheelTimer(void* data) noexcept;
   static void InvokeTimerFunction(const Params& params, TaskContext& context);
   void DoOnTimer();
 
   boost::intrusive_ptr<TaskContext> context_;
   ev::TimerThreadControl* thread_control_ = nullptr;
   Params params_;
+  // Precise timer for the short waits
   ev_timer timer_{};
+  // Coarse timer for the longer ones, mostly deadlines that never fire
+  ev::TimerWheelEntry wheel_timer_{&OnWheelTimer, this};
   ev::DataPipeToEv<Params> params_pipe_to_ev_;
 };
 
@@ -84,6 +89,7 @@ ContextTimer::Impl::Impl() {
 ContextTimer::Impl::~Impl() {
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
   UASSERT(!ev_is_active(&timer_));
+  UASSERT(!wheel_timer_.IsArmed());
 }
 
 bool ContextTimer::Impl::WasStarted() const noexcept {
@@ -136,20 +142,26 @@ void ContextTimer::Impl::DoArmTimerInEvThread() {
 
   params_ = std::move(*params);
 
-  using LibEvDuration = std::chrono::duration<double>;
-  const auto time_left =
-      std::chrono::duration_cast<LibEvDuration>(params_.deadline.TimeLeft())
-          .count();
-
+  const auto time_left = params_.deadline.TimeLeft();
   LOG_TRACE() << "time_left=" << time_left;
-  if (time_left <= 0.0) {
+  if (time_left <= Deadline::Duration::zero()) {
     // Optimization for small deadlines or high load
     DoOnTimer();
     return;
   }
 
-  timer_.repeat = time_left;
   UASSERT(thread_control_);
+  if (time_left >= ev::kMinDurationToDefer) {
+    // Avoids the libev timers heap, the ~1ms resolution is fine here
+    thread_control_->Stop(timer_);
+    thread_control_->Start(wheel_timer_, time_left);
+    return;
+  }
+
+  using LibEvDuration = std::chrono::duration<double>;
+  thread_control_->Stop(wheel_timer_);
+  timer_.repeat =
+      std::chrono::duration_cast<LibEvDuration>(time_left).count();
   thread_control_->Again(timer_);
 }
 
@@ -171,6 +183,7 @@ void ContextTimer::Impl::InvokeTimerFunction(const Params& params,
 void ContextTimer::Impl::StopTimerInEvThread() noexcept {
   UASSERT(!engine::current_task::IsTaskProcessorThread());
   thread_control_->Stop(timer_);
+  thread_control_->Stop(wheel_timer_);
 }
 
 void ContextTimer::Impl::DoFinalizeInEvThread() {
@@ -193,6 +206,14 @@ void ContextTimer::Impl::OnTimer(struct ev_loop*, ev_timer* w, int) noexcept {
   ev_timer->DoOnTimer();
 }
 
+void ContextTimer::Impl::OnWheelTimer(void* data) noexcept {
+  UASSERT(!engine::current_task::IsTaskProcessorThread());
+
+  auto* ev_timer = static_cast<Impl*>(data);
+  UASSERT(ev_timer != nullptr);
+  ev_timer->DoOnTimer();
+}
+
 void ContextTimer::Impl::DoOnTimer() {
   UASSERT(!engine::current_task::IsTaskProcessorThread());
 
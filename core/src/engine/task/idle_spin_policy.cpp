@@ -0,0 +1,127 @@
+#include <engine/task/idle_spin_policy.hpp>
+
+#include <algorithm>
+
+#include <moodycamel/concurrentqueue.h>
+#include <moodycamel/lightweightsemaphore.h>
+
+#include <engine/ev/worker_loop.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+// Lets a budget that has dropped to zero recover in a few steps
+constexpr std::size_t kMinGrowth = 16;
+
+// Current thread handles only a single TaskProcessor, so it's safe to store
+// the state of its worker in a thread-local variable.
+thread_local bool is_after_park = false;
+
+}  // namespace
+
+IdleSpinPolicy::IdleSpinPolicy(const TaskProcessorConfig& config)
+    : max_budget_(
+          static_cast<std::size_t>(std::max(config.spinning_iterations, 0))),
+      is_adaptive_(config.spinning_policy == SpinningPolicy::kAdaptive),
+      budget_(max_budget_) {}
+
+void IdleSpinPolicy::AccountSpin(std::size_t iterations,
+                                 bool found_task) noexcept {
+  spin_iterations_.Add(utils::statistics::Rate{iterations});
+  if (!found_task) return;
+
+  ++spin_wakeups_;
+  if (!is_adaptive_) return;
+
+  // The task has arrived close to the end of the budget, a slightly later
+  // task would have made us park.
+  const auto budget = GetSpinBudget();
+  if (iterations * 2 > budget) Grow(budget);
+}
+
+void IdleSpinPolicy::AccountPark(
+    std::chrono::steady_clock::duration parked_for) noexcept {
+  ++parks_;
+  is_after_park = true;
+  const bool is_short = parked_for < kShortPark;
+  if (is_short) ++short_parks_;
+  if (!is_adaptive_) return;
+
+  const auto budget = GetSpinBudget();
+  if (is_short) {
+    Grow(budget);
+  } else {
+    Shrink(budget);
+  }
+}
+
+void IdleSpinPolicy::AccountQueueWait(
+    std::chrono::steady_clock::time_point queued_at) noexcept {
+  if (!is_after_park) return;
+  is_after_park = false;
+  if (!is_adaptive_ || queued_at == std::chrono::steady_clock::time_point{}) {
+    return;
+  }
+
+  if (std::chrono::steady_clock::now() - queued_at >= kShortPark) {
+    Grow(GetSpinBudget());
+  }
+}
+
+void IdleSpinPolicy::WaitBlocking(moodycamel::LightweightSemaphore& semaphore) {
+  if (semaphore.tryWait()) return;
+
+  // Same as the spinning in moodycamel::LightweightSemaphore, but with a
+  // budget that may change between the waits.
+  const auto budget = GetSpinBudget();
+  for (std::size_t i = 0; i < budget; ++i) {
+    if (semaphore.tryWait()) {
+      AccountSpin(i + 1, /*found_task=*/true);
+      return;
+    }
+    // Prevent the compiler from collapsing the loop
+    std::atomic_signal_fence(std::memory_order_acquire);
+  }
+  AccountSpin(budget, /*found_task=*/false);
+
+  Park(semaphore);
+}
+
+void IdleSpinPolicy::Park(moodycamel::LightweightSemaphore& semaphore) {
+  auto* const worker_loop = ev::WorkerLoop::GetForCurrentThread();
+  if (worker_loop) worker_loop->Lend();
+
+  const auto park_start = std::chrono::steady_clock::now();
+  semaphore.wait();
+  AccountPark(std::chrono::steady_clock::now() - park_start);
+
+  if (worker_loop) worker_loop->Reclaim();
+}
+
+IdleSpinPolicy::Stats IdleSpinPolicy::GetStats() const noexcept {
+  Stats stats;
+  stats.spin_wakeups = spin_wakeups_.Load();
+  stats.parks = parks_.Load();
+  stats.short_parks = short_parks_.Load();
+  stats.spin_iterations = spin_iterations_.Load();
+  stats.spin_budget = GetSpinBudget();
+  return stats;
+}
+
+void IdleSpinPolicy::Grow(std::size_t budget) noexcept {
+  const auto new_budget = std::min(max_budget_, budget * 2 + kMinGrowth);
+  if (new_budget != budget) {
+    budget_.store(new_budget, std::memory_order_relaxed);
+  }
+}
+
+void IdleSpinPolicy::Shrink(std::size_t budget) noexcept {
+  if (budget != 0) budget_.store(budget / 2, std::memory_order_relaxed);
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
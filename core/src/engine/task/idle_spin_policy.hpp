@@ -0,0 +1,96 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+#include <engine/task/task_processor_config.hpp>
+#include <userver/utils/statistics/rate.hpp>
+#include <userver/utils/statistics/striped_rate_counter.hpp>
+
+namespace moodycamel {
+class LightweightSemaphore;
+}  // namespace moodycamel
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+// Decides how long an idle worker spins waiting for a task before parking.
+//
+// With SpinningPolicy::kFixed the budget is always
+// TaskProcessorConfig::spinning_iterations. With SpinningPolicy::kAdaptive it
+// is an upper bound: the budget grows when tasks arrive while spinning or
+// shortly after the worker has parked, or when the first task a worker takes
+// after a park has waited in the queue for long, and shrinks when the parked
+// workers stay asleep for a long time. The budget is shared by all the workers
+// of a TaskProcessor.
+class IdleSpinPolicy final {
+ public:
+  struct Stats final {
+    // Idle periods that ended with a task found while spinning
+    utils::statistics::Rate spin_wakeups;
+    // Idle periods that ended with the worker going to sleep
+    utils::statistics::Rate parks;
+    // Parks that were woken up sooner than kShortPark, each of them paid for
+    // a futex wakeup that spinning would have avoided
+    utils::statistics::Rate short_parks;
+    // Total spin-wait iterations, the CPU spent on waiting for tasks
+    utils::statistics::Rate spin_iterations;
+    std::size_t spin_budget{0};
+  };
+
+  // A park that is woken up sooner than this costs more than spinning for
+  // the same time would.
+  static constexpr std::chrono::microseconds kShortPark{50};
+
+  explicit IdleSpinPolicy(const TaskProcessorConfig& config);
+
+  std::size_t GetSpinBudget() const noexcept {
+    return budget_.load(std::memory_order_relaxed);
+  }
+
+  // Acquires the semaphore, spinning for the current budget before parking
+  void WaitBlocking(moodycamel::LightweightSemaphore& semaphore);
+
+  // Acquires the semaphore without spinning. Lends the ev loop of the worker,
+  // if any, for the time of the park.
+  void Park(moodycamel::LightweightSemaphore& semaphore);
+
+  // Should be called after spinning for `iterations` iterations
+  void AccountSpin(std::size_t iterations, bool found_task) noexcept;
+
+  // Should be called after the worker has been woken up from a park
+  void AccountPark(std::chrono::steady_clock::duration parked_for) noexcept;
+
+  // Should be called for each task the worker takes from the queue, with
+  // the time the task was queued at or the zero time point if unknown. Only
+  // the first task after a park counts: if it has waited in the queue for
+  // longer than kShortPark, the wakeup itself was the bottleneck, however long
+  // the park was.
+  void AccountQueueWait(
+      std::chrono::steady_clock::time_point queued_at) noexcept;
+
+  Stats GetStats() const noexcept;
+
+ private:
+  void Grow(std::size_t budget) noexcept;
+
+  void Shrink(std::size_t budget) noexcept;
+
+  const std::size_t max_budget_;
+  const bool is_adaptive_;
+
+  // Updated with plain stores, concurrent updates from several workers may
+  // be lost, which is fine for a heuristic.
+  std::atomic<std::size_t> budget_;
+
+  utils::statistics::StripedRateCounter spin_wakeups_;
+  utils::statistics::StripedRateCounter parks_;
+  utils::statistics::StripedRateCounter short_parks_;
+  utils::statistics::StripedRateCounter spin_iterations_;
+};
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,107 @@
+#include <engine/task/idle_spin_policy.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr int kMaxSpins = 1000;
+constexpr auto kShortPark = engine::IdleSpinPolicy::kShortPark / 2;
+constexpr auto kLongPark = std::chrono::milliseconds{10};
+
+engine::TaskProcessorConfig MakeConfig(engine::SpinningPolicy policy) {
+  engine::TaskProcessorConfig config;
+  config.spinning_iterations = kMaxSpins;
+  config.spinning_policy = policy;
+  return config;
+}
+
+}  // namespace
+
+TEST(IdleSpinPolicy, FixedNeverChanges) {
+  engine::IdleSpinPolicy policy{MakeConfig(engine::SpinningPolicy::kFixed)};
+  EXPECT_EQ(policy.GetSpinBudget(), kMaxSpins);
+
+  for (int i = 0; i < 10; ++i) policy.AccountPark(kLongPark);
+  EXPECT_EQ(policy.GetSpinBudget(), kMaxSpins);
+
+  const auto stats = policy.GetStats();
+  EXPECT_EQ(stats.parks.value, 10);
+  EXPECT_EQ(stats.short_parks.value, 0);
+  EXPECT_EQ(stats.spin_budget, kMaxSpins);
+}
+
+TEST(IdleSpinPolicy, AdaptiveShrinksWhenIdle) {
+  engine::IdleSpinPolicy policy{MakeConfig(engine::SpinningPolicy::kAdaptive)};
+  EXPECT_EQ(policy.GetSpinBudget(), kMaxSpins);
+
+  policy.AccountPark(kLongPark);
+  EXPECT_EQ(policy.GetSpinBudget(), kMaxSpins / 2);
+
+  for (int i = 0; i < 20; ++i) {
+    policy.AccountSpin(policy.GetSpinBudget(), /*found_task=*/false);
+    policy.AccountPark(kLongPark);
+  }
+  EXPECT_EQ(policy.GetSpinBudget(), 0);
+}
+
+TEST(IdleSpinPolicy, AdaptiveGrowsOnShortParks) {
+  engine::IdleSpinPolicy policy{MakeConfig(engine::SpinningPolicy::kAdaptive)};
+  for (int i = 0; i < 20; ++i) policy.AccountPark(kLongPark);
+  ASSERT_EQ(policy.GetSpinBudget(), 0);
+
+  policy.AccountPark(kShortPark);
+  const auto grown = policy.GetSpinBudget();
+  EXPECT_GT(grown, 0);
+
+  for (int i = 0; i < 20; ++i) policy.AccountPark(kShortPark);
+  EXPECT_EQ(policy.GetSpinBudget(), kMaxSpins);
+  EXPECT_EQ(policy.GetStats().short_parks.value, 21);
+}
+
+TEST(IdleSpinPolicy, AdaptiveGrowsOnLateSpinWakeups) {
+  engine::IdleSpinPolicy policy{MakeConfig(engine::SpinningPolicy::kAdaptive)};
+  policy.AccountPark(kLongPark);
+  policy.AccountPark(kLongPark);
+  const auto budget = policy.GetSpinBudget();
+
+  // A task found early in the spin does not change anything
+  policy.AccountSpin(1, /*found_task=*/true);
+  EXPECT_EQ(policy.GetSpinBudget(), budget);
+
+  policy.AccountSpin(budget, /*found_task=*/true);
+  EXPECT_GT(policy.GetSpinBudget(), budget);
+
+  const auto stats = policy.GetStats();
+  EXPECT_EQ(stats.spin_wakeups.value, 2);
+  EXPECT_EQ(stats.spin_iterations.value, budget + 1);
+}
+
+TEST(IdleSpinPolicy, AdaptiveGrowsOnSlowWakeups) {
+  engine::IdleSpinPolicy policy{MakeConfig(engine::SpinningPolicy::kAdaptive)};
+  for (int i = 0; i < 20; ++i) policy.AccountPark(kLongPark);
+  ASSERT_EQ(policy.GetSpinBudget(), 0);
+
+  // Not sampled
+  policy.AccountQueueWait({});
+  EXPECT_EQ(policy.GetSpinBudget(), 0);
+
+  const auto long_ago = std::chrono::steady_clock::now() - kLongPark;
+  policy.AccountPark(kLongPark);
+  policy.AccountQueueWait(long_ago);
+  const auto grown = policy.GetSpinBudget();
+  EXPECT_GT(grown, 0);
+
+  // Only the first task after a park counts
+  policy.AccountQueueWait(long_ago);
+  EXPECT_EQ(policy.GetSpinBudget(), grown);
+
+  // A task that has not waited for long does not change anything
+  policy.AccountPark(kShortPark);
+  const auto budget = policy.GetSpinBudget();
+  policy.AccountQueueWait(std::chrono::steady_clock::now());
+  EXPECT_EQ(policy.GetSpinBudget(), budget);
+}
+
+USERVER_NAMESPACE_END
@@ -151,6 +151,35 @@ UTEST(TaskInheritedVariable, SameObjectIsInherited) {
   }).Get();
 }
 
+UTEST_MT(TaskInheritedVariable, SiblingsIndependence, 2) {
+  kStringVariable.Set("parent");
+  kStringVariable2.Set("untouched");
+  const auto* const kParentVariablePtr = &kStringVariable2.Get();
+
+  engine::SingleConsumerEvent modified;
+
+  auto writer = utils::Async("writer", [&] {
+    kStringVariable.Set("writer");
+    kStringVariable2.Erase();
+    modified.Send();
+
+    EXPECT_EQ(kStringVariable.Get(), "writer");
+    EXPECT_FALSE(kStringVariable2.GetOptional());
+  });
+
+  auto reader = utils::Async("reader", [&] {
+    ASSERT_TRUE(modified.WaitForEvent());
+
+    EXPECT_EQ(kStringVariable.Get(), "parent");
+    EXPECT_EQ(&kStringVariable2.Get(), kParentVariablePtr);
+  });
+
+  writer.Get();
+  reader.Get();
+  EXPECT_EQ(kStringVariable.Get(), "parent");
+  EXPECT_EQ(&kStringVariable2.Get(), kParentVariablePtr);
+}
+
 UTEST_MT(TaskInheritedVariable, VariablesAfterParentTaskDeath, 4) {
   using Event = engine::SingleConsumerEvent;
   Event assigned_a{Event::NoAutoReset{}};
@@ -0,0 +1,218 @@
+#include <engine/task/priority_task_queue.hpp>
+
+#include <algorithm>
+
+#include <engine/task/task_context.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+constexpr std::size_t kSemaphoreInitialCount = 0;
+// Spinning is done by IdleSpinPolicy::WaitBlocking
+constexpr int kSemaphoreMaxSpins = 0;
+
+// Every N-th pop checks the priority classes in the reverse order, otherwise
+// a constant stream of high priority tasks would starve the background ones.
+constexpr std::size_t kReversePopInterval = 32;
+
+// Turns std::*_heap into a min-heap by deadline
+constexpr auto kIsLater = [](const auto& lhs, const auto& rhs) {
+  return rhs.deadline < lhs.deadline;
+};
+
+static_assert(static_cast<std::size_t>(Task::Priority::kHigh) == 0);
+static_assert(static_cast<std::size_t>(Task::Priority::kBackground) == 2);
+
+}  // namespace
+
+void PriorityTaskQueue::DeadlineQueue::Push(Deadline deadline,
+                                            impl::TaskContext* context) {
+  std::lock_guard lock(mutex_);
+  heap_.push_back({deadline, context});
+  std::push_heap(heap_.begin(), heap_.end(), kIsLater);
+  size_.store(heap_.size(), std::memory_order_relaxed);
+}
+
+impl::TaskContext* PriorityTaskQueue::DeadlineQueue::TryPop() {
+  if (GetSizeApproximate() == 0) return nullptr;
+
+  std::lock_guard lock(mutex_);
+  if (heap_.empty()) return nullptr;
+
+  std::pop_heap(heap_.begin(), heap_.end(), kIsLater);
+  auto* const context = heap_.back().context;
+  heap_.pop_back();
+  size_.store(heap_.size(), std::memory_order_relaxed);
+  return context;
+}
+
+PriorityTaskQueue::PriorityTaskQueue(const TaskProcessorConfig& config)
+    : semaphore_(kSemaphoreInitialCount, kSemaphoreMaxSpins),
+      idle_policy_(config),
+      earliest_deadline_first_(config.earliest_deadline_first) {}
+
+void PriorityTaskQueue::Push(
+    boost::intrusive_ptr<impl::TaskContext>&& context) {
+  UASSERT(context);
+  DoPush(GetClass(context->GetPriority()), context.get());
+  context.detach();
+  semaphore_.signal();
+}
+
+void PriorityTaskQueue::PushBulk(
+    utils::span<impl::TaskContext* const> contexts) {
+  for (auto* const context : contexts) {
+    UASSERT(context);
+    intrusive_ptr_add_ref(context);
+    DoPush(GetClass(context->GetPriority()), context);
+  }
+  semaphore_.signal(contexts.size());
+}
+
+boost::intrusive_ptr<impl::TaskContext> PriorityTaskQueue::PopBlocking() {
+  boost::intrusive_ptr<impl::TaskContext> context{DoPopBlocking(),
+                                                  /* add_ref= */ false};
+
+  if (!context) {
+    // return "stop" token back
+    DoPush(GetClass(Task::Priority::kHigh), nullptr);
+    semaphore_.signal();
+  }
+
+  return context;
+}
+
+void PriorityTaskQueue::StopProcessing() {
+  DoPush(GetClass(Task::Priority::kHigh), nullptr);
+  semaphore_.signal();
+}
+
+std::size_t PriorityTaskQueue::GetSizeApproximate() const noexcept {
+  std::size_t size = 0;
+  for (const auto& priority_class : classes_) {
+    size += priority_class.fifo.size_approx() +
+            priority_class.by_deadline.GetSizeApproximate();
+  }
+  return size;
+}
+
+std::size_t PriorityTaskQueue::GetSizeApproximate(
+    Task::Priority priority) const noexcept {
+  const auto& priority_class = classes_[ToIndex(priority)];
+  return priority_class.fifo.size_approx() +
+         priority_class.by_deadline.GetSizeApproximate();
+}
+
+IdleSpinPolicy::Stats PriorityTaskQueue::GetIdleStats() const noexcept {
+  return idle_policy_.GetStats();
+}
+
+std::size_t PriorityTaskQueue::CancelBackgroundTasks(
+    TaskCancellationReason reason) {
+  auto& background = GetClass(Task::Priority::kBackground);
+  auto& high = GetClass(Task::Priority::kHigh);
+
+  // The tasks are moved between the classes without touching the semaphore,
+  // a consumer that misses a task in transit retries in DoPopBlocking.
+  std::size_t cancelled = 0;
+  const auto move_task = [&](impl::TaskContext* context) {
+    UASSERT(context);
+    if (context->IsCritical()) {
+      background.fifo.enqueue(context);
+      return;
+    }
+    context->RequestCancel(reason);
+    high.fifo.enqueue(context);
+    ++cancelled;
+  };
+
+  // Limited by the current size, new background tasks may keep arriving
+  impl::TaskContext* context = nullptr;
+  for (auto left = background.fifo.size_approx(); left != 0; --left) {
+    if (!background.fifo.try_dequeue(context)) break;
+    move_task(context);
+  }
+  for (auto left = background.by_deadline.GetSizeApproximate(); left != 0;
+       --left) {
+    context = background.by_deadline.TryPop();
+    if (!context) break;
+    move_task(context);
+  }
+
+  return cancelled;
+}
+
+std::size_t PriorityTaskQueue::ToIndex(Task::Priority priority) noexcept {
+  const auto index = static_cast<std::size_t>(priority);
+  UASSERT(index < kPriorityCount);
+  return index;
+}
+
+PriorityTaskQueue::PriorityClass& PriorityTaskQueue::GetClass(
+    Task::Priority priority) noexcept {
+  return classes_[ToIndex(priority)];
+}
+
+void PriorityTaskQueue::DoPush(PriorityClass& priority_class,
+                               impl::TaskContext* context) {
+  const auto deadline =
+      (context && earliest_deadline_first_) ? context->GetRequestDeadline()
+                                            : Deadline{};
+  if (deadline.IsReachable()) {
+    priority_class.by_deadline.Push(deadline, context);
+  } else {
+    priority_class.fifo.enqueue(context);
+  }
+}
+
+bool PriorityTaskQueue::TryPop(PriorityClass& priority_class, bool fifo_first,
+                               impl::TaskContext*& context) {
+  if (fifo_first && priority_class.fifo.try_dequeue(context)) return true;
+
+  context = priority_class.by_deadline.TryPop();
+  if (context) {
+    // Nobody waits for the result anymore
+    if (!context->IsCritical() &&
+        context->GetRequestDeadline().IsSurelyReachedApprox()) {
+      context->RequestCancel(TaskCancellationReason::kDeadline);
+    }
+    return true;
+  }
+
+  return !fifo_first && priority_class.fifo.try_dequeue(context);
+}
+
+impl::TaskContext* PriorityTaskQueue::DoPopBlocking() {
+  // Current thread handles only a single TaskProcessor, so it's safe to store
+  // the pop counter for the task processor in a thread-local variable.
+  thread_local std::size_t pop_count = 0;
+  const bool is_reversed = ++pop_count % kReversePopInterval == 0;
+
+  idle_policy_.WaitBlocking(semaphore_);
+
+  impl::TaskContext* context{};
+  while (true) {
+    // The semaphore guarantees that there is a task for us in one of
+    // the classes, but another consumer may take 'our' task in exchange for
+    // a task in a class we have already checked.
+    if (is_reversed) {
+      for (auto it = classes_.rbegin(); it != classes_.rend(); ++it) {
+        if (TryPop(*it, /*fifo_first=*/true, context)) return context;
+      }
+    } else {
+      for (auto& priority_class : classes_) {
+        if (TryPop(priority_class, /*fifo_first=*/false, context)) {
+          return context;
+        }
+      }
+    }
+  }
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
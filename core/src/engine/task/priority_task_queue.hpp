@@ -0,0 +1,120 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include <moodycamel/concurrentqueue.h>
+#include <moodycamel/lightweightsemaphore.h>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+
+#include <engine/task/idle_spin_policy.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace impl {
+class TaskContext;
+}  // namespace impl
+
+// A task queue with a separate queue per Task::Priority.
+//
+// Tasks of a higher priority class are taken first. Once in a while the
+// classes are checked in the reverse order, so that background tasks get a
+// small share of the workers even under a constant load.
+//
+// With TaskProcessorConfig::earliest_deadline_first the tasks that work for
+// a request with a propagated deadline (see TaskContext::GetRequestDeadline)
+// are ordered by it within their class, the tasks without one go after them
+// in FIFO order. The tasks whose request deadline has expired while they
+// waited in the queue are cancelled on dequeue, so the non-critical ones that
+// have not started yet do not run at all.
+class PriorityTaskQueue final {
+ public:
+  explicit PriorityTaskQueue(const TaskProcessorConfig& config);
+
+  void Push(boost::intrusive_ptr<impl::TaskContext>&& context);
+
+  // Pushes all the contexts at once, taking a reference to each of them
+  void PushBulk(utils::span<impl::TaskContext* const> contexts);
+
+  // Returns nullptr as a stop signal
+  boost::intrusive_ptr<impl::TaskContext> PopBlocking();
+
+  void StopProcessing();
+
+  std::size_t GetSizeApproximate() const noexcept;
+
+  std::size_t GetSizeApproximate(Task::Priority priority) const noexcept;
+
+  IdleSpinPolicy::Stats GetIdleStats() const noexcept;
+
+  IdleSpinPolicy& GetIdlePolicy() noexcept { return idle_policy_; }
+
+  // Cancels the background tasks that have not started yet, and moves them to
+  // the high priority class to let them finish without waiting for
+  // the others. Returns the number of cancelled tasks.
+  std::size_t CancelBackgroundTasks(TaskCancellationReason reason);
+
+ private:
+  static constexpr std::size_t kPriorityCount = 3;
+
+  class DeadlineQueue final {
+   public:
+    void Push(Deadline deadline, impl::TaskContext* context);
+
+    // Returns nullptr if empty
+    impl::TaskContext* TryPop();
+
+    std::size_t GetSizeApproximate() const noexcept {
+      return size_.load(std::memory_order_relaxed);
+    }
+
+   private:
+    struct Entry final {
+      Deadline deadline;
+      impl::TaskContext* context;
+    };
+
+    std::mutex mutex_;
+    // A min-heap by deadline, guarded by mutex_
+    std::vector<Entry> heap_;
+    std::atomic<std::size_t> size_{0};
+  };
+
+  struct PriorityClass final {
+    moodycamel::ConcurrentQueue<impl::TaskContext*> fifo;
+    DeadlineQueue by_deadline;
+  };
+
+  static std::size_t ToIndex(Task::Priority priority) noexcept;
+
+  PriorityClass& GetClass(Task::Priority priority) noexcept;
+
+  // Does not signal the semaphore
+  void DoPush(PriorityClass& priority_class, impl::TaskContext* context);
+
+  // Returns false if the class is empty, `context` may be set to nullptr
+  // (the stop signal) on success
+  bool TryPop(PriorityClass& priority_class, bool fifo_first,
+              impl::TaskContext*& context);
+
+  impl::TaskContext* DoPopBlocking();
+
+  std::array<PriorityClass, kPriorityCount> classes_;
+  moodycamel::LightweightSemaphore semaphore_;
+  IdleSpinPolicy idle_policy_;
+  const bool earliest_deadline_first_;
+};
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
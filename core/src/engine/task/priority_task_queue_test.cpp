@@ -0,0 +1,222 @@
+#include <engine/task/priority_task_queue.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include <engine/task/task_context.hpp>
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Priority = engine::Task::Priority;
+
+engine::TaskProcessorConfig MakePriorityConfig(bool earliest_deadline_first) {
+  engine::TaskProcessorConfig config;
+  config.name = "priority";
+  config.thread_name = "prio-worker";
+  // A single worker makes the order of execution observable
+  config.worker_threads = 1;
+  config.task_queue = engine::TaskQueueType::kPriorityTaskQueue;
+  config.earliest_deadline_first = earliest_deadline_first;
+  return config;
+}
+
+class PriorityTaskProcessor final {
+ public:
+  explicit PriorityTaskProcessor(bool earliest_deadline_first = false)
+      : task_processor_(
+            MakePriorityConfig(earliest_deadline_first),
+            engine::current_task::GetTaskProcessor().GetTaskProcessorPools()) {}
+
+  engine::TaskProcessor& Get() { return task_processor_; }
+
+  // Occupies the only worker until Unblock is called, so that the tasks
+  // pushed in between pile up in the queue
+  void Block() {
+    blocker_ = engine::AsyncNoSpan(task_processor_, [this] {
+      is_blocked_ = true;
+      while (!should_unblock_) {
+      }
+    });
+    while (!is_blocked_) engine::Yield();
+  }
+
+  void Unblock() {
+    should_unblock_ = true;
+    blocker_.Get();
+  }
+
+ private:
+  engine::TaskProcessor task_processor_;
+  engine::TaskWithResult<void> blocker_;
+  std::atomic<bool> is_blocked_{false};
+  std::atomic<bool> should_unblock_{false};
+};
+
+class ExecutionOrder final {
+ public:
+  auto Record(int id) {
+    return [this, id] {
+      std::lock_guard lock(mutex_);
+      order_.push_back(id);
+    };
+  }
+
+  std::vector<int> Get() {
+    std::lock_guard lock(mutex_);
+    return order_;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<int> order_;
+};
+
+}  // namespace
+
+UTEST(PriorityTaskQueue, RunsAllPriorities) {
+  PriorityTaskProcessor tp;
+  constexpr std::size_t kTasks = 300;
+
+  std::atomic<std::size_t> counter{0};
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(kTasks);
+  for (std::size_t i = 0; i < kTasks; ++i) {
+    const auto priority = static_cast<Priority>(i % 3);
+    tasks.push_back(
+        engine::AsyncNoSpan(tp.Get(), priority, [&counter] { ++counter; }));
+  }
+  engine::WaitAllChecked(tasks);
+
+  EXPECT_EQ(counter, kTasks);
+  EXPECT_EQ(tp.Get().GetTaskQueueSize(), 0);
+}
+
+UTEST(PriorityTaskQueue, HighPriorityFirst) {
+  PriorityTaskProcessor tp;
+  constexpr int kTasksPerClass = 8;
+  ExecutionOrder order;
+
+  tp.Block();
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (int i = 0; i < kTasksPerClass; ++i) {
+    tasks.push_back(engine::AsyncNoSpan(tp.Get(), Priority::kBackground,
+                                        order.Record(2)));
+    tasks.push_back(engine::AsyncNoSpan(tp.Get(), order.Record(1)));
+    tasks.push_back(
+        utils::Async(tp.Get(), "high", Priority::kHigh, order.Record(0)));
+  }
+  tp.Unblock();
+  engine::WaitAllChecked(tasks);
+
+  const auto result = order.Get();
+  ASSERT_EQ(result.size(), kTasksPerClass * 3);
+  // Allow for a single pop that checks the classes in the reverse order
+  int misplaced = 0;
+  for (int i = 0; i < kTasksPerClass; ++i) {
+    if (result[i] != 0) ++misplaced;
+  }
+  EXPECT_LE(misplaced, 1);
+}
+
+UTEST(PriorityTaskQueue, EarliestDeadlineFirst) {
+  PriorityTaskProcessor tp{/*earliest_deadline_first=*/true};
+  constexpr int kTasks = 10;
+  ExecutionOrder order;
+
+  auto& current = engine::current_task::GetCurrentTaskContext();
+  tp.Block();
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (int i = kTasks; i > 0; --i) {
+    // Subtasks inherit the request deadline, as set by deadline propagation
+    current.SetRequestDeadline(
+        engine::Deadline::FromDuration(std::chrono::seconds{100 + i}));
+    tasks.push_back(engine::AsyncNoSpan(tp.Get(), order.Record(i)));
+  }
+  current.SetRequestDeadline({});
+  tp.Unblock();
+  engine::WaitAllChecked(tasks);
+
+  const auto result = order.Get();
+  ASSERT_EQ(result.size(), kTasks);
+  for (int i = 0; i < kTasks; ++i) {
+    EXPECT_EQ(result[i], i + 1);
+  }
+}
+
+UTEST(PriorityTaskQueue, CancelsTasksOfExpiredRequests) {
+  PriorityTaskProcessor tp{/*earliest_deadline_first=*/true};
+  auto& current = engine::current_task::GetCurrentTaskContext();
+  std::atomic<bool> expired_ran{false};
+  std::atomic<bool> background_ran{false};
+
+  tp.Block();
+  current.SetRequestDeadline(engine::Deadline::FromTimePoint(
+      engine::Deadline::Clock::now() - std::chrono::seconds{1}));
+  auto expired = utils::Async(tp.Get(), "expired", [&] { expired_ran = true; });
+  // Background tasks do not inherit the request deadline
+  auto background = utils::AsyncBackground("background", tp.Get(),
+                                           [&] { background_ran = true; });
+  current.SetRequestDeadline({});
+  tp.Unblock();
+
+  expired.Wait();
+  EXPECT_EQ(expired.GetState(), engine::Task::State::kCancelled);
+  EXPECT_FALSE(expired_ran);
+  UEXPECT_NO_THROW(background.Get());
+  EXPECT_TRUE(background_ran);
+}
+
+UTEST(PriorityTaskQueue, OverloadCancelsBackgroundFirst) {
+  PriorityTaskProcessor tp;
+  constexpr std::size_t kBackgroundTasks = 10;
+
+  engine::TaskProcessorSettings settings;
+  settings.wait_queue_length_limit = 1;
+  settings.overload_action =
+      engine::TaskProcessorSettings::OverloadAction::kCancel;
+
+  std::atomic<std::size_t> background_runs{0};
+  std::vector<engine::TaskWithResult<void>> background;
+
+  tp.Block();
+  for (std::size_t i = 0; i < kBackgroundTasks; ++i) {
+    background.push_back(engine::AsyncNoSpan(
+        tp.Get(), Priority::kBackground, [&] { ++background_runs; }));
+  }
+  tp.Get().SetSettings(settings);
+
+  // The overload is detected on a random push, go on until the background
+  // tasks are dropped.
+  std::vector<engine::TaskWithResult<void>> normal;
+  const auto& counter = tp.Get().GetTaskCounter();
+  while (counter.GetCancelledTasksOverload().value == 0) {
+    normal.push_back(engine::AsyncNoSpan(tp.Get(), [] {}));
+  }
+  tp.Get().SetSettings({});
+  tp.Unblock();
+
+  for (auto& task : background) {
+    task.Wait();
+    EXPECT_EQ(task.GetState(), engine::Task::State::kCancelled);
+  }
+  EXPECT_EQ(background_runs, 0);
+
+  // The normal task that has hit the overload was spared
+  for (auto& task : normal) {
+    task.Wait();
+    EXPECT_EQ(task.GetState(), engine::Task::State::kCompleted);
+  }
+}
+
+USERVER_NAMESPACE_END
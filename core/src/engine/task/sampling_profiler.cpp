@@ -0,0 +1,426 @@
+#include <engine/task/sampling_profiler.hpp>
+
+#if defined(__linux__)
+#define HAS_SAMPLING_PROFILER
+#endif
+
+#ifdef HAS_SAMPLING_PROFILER
+
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#include <csignal>
+#include <ctime>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <boost/stacktrace.hpp>
+
+#include <tracing/span_impl.hpp>
+#include <userver/compiler/thread_local.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/strerror.hpp>
+
+// Not exposed by glibc before 2.35
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+#ifdef HAS_SAMPLING_PROFILER
+
+namespace {
+
+constexpr auto kSamplingSignal = SIGPROF;
+
+constexpr std::size_t kMaxFrames = 64;
+constexpr std::size_t kMaxSpanNameSize = 64;
+// Samples that may be taken during a single task step without being dropped
+constexpr std::size_t kRingSize = 64;
+// The signal handler and the signal trampoline
+constexpr std::size_t kSkipFrames = 2;
+
+constexpr std::string_view kNoSpan = "[no span]";
+
+using FramePtr = boost::stacktrace::frame::native_frame_ptr_t;
+
+// Span name and the frames starting from the leaf one
+using StackKey = std::pair<std::string, std::vector<FramePtr>>;
+using Profile = std::map<StackKey, std::uint64_t>;
+
+struct Sample final {
+  std::array<FramePtr, kMaxFrames> frames;
+  std::size_t frame_count;
+  std::array<char, kMaxSpanNameSize> span_name;
+  std::size_t span_name_size;
+};
+
+struct Worker final {
+  // Is called from the signal handler, must be async-signal-safe
+  void TakeSample() noexcept;
+
+  // Is called from the worker thread when it's not in the signal handler
+  void Collect() noexcept;
+
+  // The ring is filled by the signal handler and drained by Collect(), both
+  // run on the worker thread, so only the compiler reordering matters.
+  std::array<Sample, kRingSize> ring{};
+  std::atomic<std::size_t> written{0};
+  std::atomic<std::size_t> read{0};
+
+  std::atomic<std::uint64_t> samples{0};
+  std::atomic<std::uint64_t> dropped{0};
+
+  mutable std::mutex profile_mutex;
+  Profile profile;
+
+  // Guarded by SamplingProfiler::Impl::timers_mutex_
+  pid_t tid{0};
+  clockid_t clock{};
+  std::optional<timer_t> timer;
+};
+
+void Worker::TakeSample() noexcept {
+  const auto written_value = written.load(std::memory_order_relaxed);
+  if (written_value - read.load(std::memory_order_relaxed) == kRingSize) {
+    dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  auto& sample = ring[written_value % kRingSize];
+  // Boost.Stacktrace terminates the frames with a nullptr
+  auto frame_count = boost::stacktrace::safe_dump_to(
+      kSkipFrames, sample.frames.data(), sizeof(sample.frames));
+  while (frame_count != 0 && !sample.frames[frame_count - 1]) --frame_count;
+  sample.frame_count = frame_count;
+  sample.span_name_size =
+      tracing::CopyRootSpanNameOfCurrentTask(sample.span_name);
+
+  std::atomic_signal_fence(std::memory_order_release);
+  written.store(written_value + 1, std::memory_order_relaxed);
+}
+
+void Worker::Collect() noexcept {
+  const auto written_value = written.load(std::memory_order_relaxed);
+  auto read_value = read.load(std::memory_order_relaxed);
+  if (read_value == written_value) return;
+  std::atomic_signal_fence(std::memory_order_acquire);
+
+  const auto count = written_value - read_value;
+  try {
+    std::lock_guard lock(profile_mutex);
+    for (; read_value != written_value; ++read_value) {
+      const auto& sample = ring[read_value % kRingSize];
+      StackKey key{
+          std::string{sample.span_name.data(), sample.span_name_size},
+          std::vector<FramePtr>(sample.frames.begin(),
+                                sample.frames.begin() + sample.frame_count)};
+      ++profile[std::move(key)];
+    }
+    samples.fetch_add(count, std::memory_order_relaxed);
+  } catch (const std::exception&) {
+    dropped.fetch_add(written_value - read_value, std::memory_order_relaxed);
+  }
+
+  std::atomic_signal_fence(std::memory_order_release);
+  read.store(written_value, std::memory_order_relaxed);
+}
+
+compiler::ThreadLocal current_worker = [] {
+  return static_cast<Worker*>(nullptr);
+};
+
+void SamplingSignalHandler(int, siginfo_t*, void*) noexcept {
+  const auto saved_errno = errno;
+
+  Worker* worker = nullptr;
+  {
+    auto scope = current_worker.Use();
+    worker = *scope;
+  }
+  if (worker) worker->TakeSample();
+
+  errno = saved_errno;
+}
+
+void InstallSignalHandler() {
+  static std::once_flag once;
+  std::call_once(once, [] {
+    struct sigaction sa {};
+    sa.sa_flags = SA_ONSTACK | SA_RESTART | SA_SIGINFO;
+    sa.sa_sigaction = &SamplingSignalHandler;
+    sigemptyset(&sa.sa_mask);
+    if (sigaction(kSamplingSignal, &sa, nullptr) == -1) {
+      LOG_ERROR() << "Failed to install the sampling profiler signal handler: "
+                  << utils::strerror(errno);
+    }
+  });
+}
+
+std::string_view GetFrameName(
+    std::unordered_map<FramePtr, std::string>& names_cache, FramePtr frame) {
+  auto [it, inserted] = names_cache.try_emplace(frame);
+  if (inserted) {
+    auto name = boost::stacktrace::frame{frame}.name();
+    if (name.empty()) name = fmt::format("{}", frame);
+    std::replace(name.begin(), name.end(), ';', ':');
+    it->second = std::move(name);
+  }
+  return it->second;
+}
+
+}  // namespace
+
+class SamplingProfiler::Impl final {
+ public:
+  explicit Impl(std::size_t worker_count)
+      : workers_(std::make_unique<Worker[]>(worker_count)),
+        worker_count_(worker_count) {}
+
+  ~Impl() {
+    std::lock_guard lock(timers_mutex_);
+    for (std::size_t i = 0; i < worker_count_; ++i) DeleteTimer(workers_[i]);
+  }
+
+  void SetFrequency(std::uint32_t frequency_hz) {
+    if (frequency_hz != 0) InstallSignalHandler();
+
+    std::lock_guard lock(timers_mutex_);
+    frequency_hz_.store(frequency_hz, std::memory_order_relaxed);
+    for (std::size_t i = 0; i < worker_count_; ++i) UpdateTimer(workers_[i]);
+  }
+
+  std::uint32_t GetFrequency() const noexcept {
+    return frequency_hz_.load(std::memory_order_relaxed);
+  }
+
+  void RegisterWorker(std::size_t index) noexcept {
+    UASSERT(index < worker_count_);
+    auto& worker = workers_[index];
+
+    std::lock_guard lock(timers_mutex_);
+    worker.tid = static_cast<pid_t>(::syscall(SYS_gettid));
+    const auto error = ::pthread_getcpuclockid(::pthread_self(), &worker.clock);
+    if (error != 0) {
+      LOG_ERROR() << "Failed to get the CPU clock of a worker thread: "
+                  << utils::strerror(error);
+      worker.tid = 0;
+      return;
+    }
+    {
+      auto scope = current_worker.Use();
+      *scope = &worker;
+    }
+    UpdateTimer(worker);
+  }
+
+  void UnregisterWorker() noexcept {
+    Worker* worker = nullptr;
+    {
+      auto scope = current_worker.Use();
+      worker = std::exchange(*scope, nullptr);
+    }
+    if (!worker) return;
+
+    std::lock_guard lock(timers_mutex_);
+    DeleteTimer(*worker);
+    worker->tid = 0;
+  }
+
+  void Collect() noexcept {
+    Worker* worker = nullptr;
+    {
+      auto scope = current_worker.Use();
+      worker = *scope;
+    }
+    if (worker) worker->Collect();
+  }
+
+  void AppendFoldedStacks(std::string_view prefix, std::string& out) const {
+    Profile merged;
+    for (std::size_t i = 0; i < worker_count_; ++i) {
+      const auto& worker = workers_[i];
+      std::lock_guard lock(worker.profile_mutex);
+      for (const auto& [key, count] : worker.profile) merged[key] += count;
+    }
+
+    // Different addresses within the same function are merged by name
+    std::map<std::string, std::uint64_t> folded;
+    std::unordered_map<FramePtr, std::string> names_cache;
+    for (const auto& [key, count] : merged) {
+      const auto& [span_name, frames] = key;
+      std::string stack{prefix};
+      stack += ';';
+      if (span_name.empty()) {
+        stack.append(kNoSpan);
+      } else {
+        const auto span_name_begin = stack.size();
+        stack.append(span_name);
+        std::replace(stack.begin() + span_name_begin, stack.end(), ';', ':');
+      }
+      for (auto it = frames.rbegin(); it != frames.rend(); ++it) {
+        stack += ';';
+        stack.append(GetFrameName(names_cache, *it));
+      }
+      folded[std::move(stack)] += count;
+    }
+
+    for (const auto& [stack, count] : folded) {
+      fmt::format_to(std::back_inserter(out), "{} {}\n", stack, count);
+    }
+  }
+
+  void Reset() {
+    for (std::size_t i = 0; i < worker_count_; ++i) {
+      auto& worker = workers_[i];
+      std::lock_guard lock(worker.profile_mutex);
+      worker.profile.clear();
+      worker.samples.store(0, std::memory_order_relaxed);
+      worker.dropped.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  Stats GetStats() const noexcept {
+    Stats stats;
+    for (std::size_t i = 0; i < worker_count_; ++i) {
+      stats.samples += workers_[i].samples.load(std::memory_order_relaxed);
+      stats.dropped += workers_[i].dropped.load(std::memory_order_relaxed);
+    }
+    return stats;
+  }
+
+ private:
+  // Must be called with timers_mutex_ locked
+  void UpdateTimer(Worker& worker) noexcept {
+    const auto frequency_hz = GetFrequency();
+    if (frequency_hz == 0 || worker.tid == 0) {
+      DeleteTimer(worker);
+      return;
+    }
+
+    if (!worker.timer) {
+      struct sigevent event {};
+      event.sigev_notify = SIGEV_THREAD_ID;
+      event.sigev_signo = kSamplingSignal;
+      event.sigev_notify_thread_id = worker.tid;
+
+      timer_t timer{};
+      if (::timer_create(worker.clock, &event, &timer) == -1) {
+        LOG_ERROR() << "Failed to create the sampling profiler timer: "
+                    << utils::strerror(errno);
+        return;
+      }
+      worker.timer = timer;
+    }
+
+    const auto period = std::chrono::nanoseconds{std::chrono::seconds{1}} /
+                        static_cast<std::int64_t>(frequency_hz);
+    struct itimerspec spec {};
+    spec.it_interval.tv_sec = period.count() / 1'000'000'000;
+    spec.it_interval.tv_nsec = period.count() % 1'000'000'000;
+    spec.it_value = spec.it_interval;
+    if (::timer_settime(*worker.timer, 0, &spec, nullptr) == -1) {
+      LOG_ERROR() << "Failed to start the sampling profiler timer: "
+                  << utils::strerror(errno);
+    }
+  }
+
+  // Must be called with timers_mutex_ locked
+  static void DeleteTimer(Worker& worker) noexcept {
+    if (!worker.timer) return;
+    ::timer_delete(*worker.timer);
+    worker.timer.reset();
+  }
+
+  const std::unique_ptr<Worker[]> workers_;
+  const std::size_t worker_count_;
+
+  std::mutex timers_mutex_;
+  std::atomic<std::uint32_t> frequency_hz_{0};
+};
+
+#else
+
+class SamplingProfiler::Impl final {
+ public:
+  explicit Impl(std::size_t) {}
+
+  void SetFrequency(std::uint32_t) {}
+  std::uint32_t GetFrequency() const noexcept { return 0; }
+
+  void RegisterWorker(std::size_t) noexcept {}
+  void UnregisterWorker() noexcept {}
+
+  void Collect() noexcept {}
+
+  void AppendFoldedStacks(std::string_view, std::string&) const {}
+
+  void Reset() {}
+
+  Stats GetStats() const noexcept { return {}; }
+};
+
+#endif
+
+SamplingProfiler::SamplingProfiler(std::size_t worker_count)
+    : impl_(std::make_unique<Impl>(worker_count)) {}
+
+SamplingProfiler::~SamplingProfiler() = default;
+
+void SamplingProfiler::SetFrequency(std::uint32_t frequency_hz) {
+  impl_->SetFrequency(frequency_hz);
+}
+
+std::uint32_t SamplingProfiler::GetFrequency() const noexcept {
+  return impl_->GetFrequency();
+}
+
+void SamplingProfiler::RegisterWorker(std::size_t index) noexcept {
+  impl_->RegisterWorker(index);
+}
+
+void SamplingProfiler::UnregisterWorker() noexcept {
+  impl_->UnregisterWorker();
+}
+
+void SamplingProfiler::Collect() noexcept { impl_->Collect(); }
+
+void SamplingProfiler::AppendFoldedStacks(std::string_view prefix,
+                                          std::string& out) const {
+  impl_->AppendFoldedStacks(prefix, out);
+}
+
+void SamplingProfiler::Reset() { impl_->Reset(); }
+
+SamplingProfiler::Stats SamplingProfiler::GetStats() const noexcept {
+  return impl_->GetStats();
+}
+
+bool SamplingProfiler::IsSupported() noexcept {
+#ifdef HAS_SAMPLING_PROFILER
+  return true;
+#else
+  return false;
+#endif
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
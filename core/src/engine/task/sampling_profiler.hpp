@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+// A sampling CPU profiler for the workers of a single TaskProcessor.
+//
+// Each worker gets a timer that ticks on the CPU time of the worker thread.
+// On each tick the worker interrupts itself with a signal and stores the
+// stacktrace of the running code along with the name of the root span of the
+// current task into a thread-local buffer. The buffer is drained by
+// the worker itself between the task steps, so no locking is done on the hot
+// path.
+//
+// Only available on Linux, does nothing on the other platforms.
+class SamplingProfiler final {
+ public:
+  struct Stats final {
+    std::uint64_t samples{0};
+    std::uint64_t dropped{0};
+  };
+
+  explicit SamplingProfiler(std::size_t worker_count);
+  ~SamplingProfiler();
+
+  // Sets the sampling frequency in samples per second of CPU time of each
+  // worker, 0 stops the sampling.
+  void SetFrequency(std::uint32_t frequency_hz);
+  std::uint32_t GetFrequency() const noexcept;
+
+  // Must be called from the worker thread
+  void RegisterWorker(std::size_t index) noexcept;
+  void UnregisterWorker() noexcept;
+
+  // Must be called from the worker thread, moves the samples taken since
+  // the previous call into the aggregated profile.
+  void Collect() noexcept;
+
+  // Appends the profile in the 'folded stacks' format, the input format of
+  // flamegraph.pl: `prefix;span;frame;...;frame count`, one line per unique
+  // stack, the root frame goes first.
+  void AppendFoldedStacks(std::string_view prefix, std::string& out) const;
+
+  void Reset();
+
+  Stats GetStats() const noexcept;
+
+  static bool IsSupported() noexcept;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
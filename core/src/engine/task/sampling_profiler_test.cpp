@@ -0,0 +1,58 @@
+#include <engine/task/sampling_profiler.hpp>
+
+#include <atomic>
+#include <chrono>
+
+#include <engine/task/task_processor.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::uint32_t kFrequency = 999;
+constexpr auto kBusyFor = std::chrono::milliseconds{300};
+
+void BusyLoop(std::chrono::steady_clock::duration duration) {
+  std::atomic<std::uint64_t> counter{0};
+  const auto deadline = std::chrono::steady_clock::now() + duration;
+  while (std::chrono::steady_clock::now() < deadline) {
+    for (int i = 0; i < 1000; ++i) ++counter;
+  }
+}
+
+}  // namespace
+
+UTEST(SamplingProfiler, SamplesRootSpanOfTask) {
+  if (!engine::SamplingProfiler::IsSupported()) {
+    GTEST_SKIP() << "The sampling profiler is not supported on this platform";
+  }
+
+  auto& profiler =
+      engine::current_task::GetTaskProcessor().GetSamplingProfiler();
+  profiler.SetFrequency(kFrequency);
+  EXPECT_EQ(profiler.GetFrequency(), kFrequency);
+
+  utils::Async("busy-span", [] {
+    BusyLoop(kBusyFor);
+    // The samples are collected between the task steps
+    engine::Yield();
+  }).Get();
+
+  profiler.SetFrequency(0);
+  EXPECT_GT(profiler.GetStats().samples, 0);
+
+  std::string folded;
+  profiler.AppendFoldedStacks("tp", folded);
+  EXPECT_NE(folded.find("tp;busy-span;"), std::string::npos) << folded;
+
+  profiler.Reset();
+  folded.clear();
+  profiler.AppendFoldedStacks("tp", folded);
+  EXPECT_EQ(folded, "");
+  EXPECT_EQ(profiler.GetStats().samples, 0);
+}
+
+USERVER_NAMESPACE_END
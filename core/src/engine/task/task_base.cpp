@@ -26,6 +26,7 @@ static_assert(
 
 TaskBase::TaskBase(impl::TaskContextHolder&& context)
     : context_(std::move(context).Extract()) {
+  if (context.IsBootstrapDeferred()) return;
   context_->Wakeup(impl::TaskContext::WakeupSource::kBootstrap,
                    impl::SleepState::Epoch{0});
 }
@@ -183,7 +184,7 @@ std::size_t GetStackSize() {
 }
 
 ev::ThreadControl& GetEventThread() {
-  return GetTaskProcessor().EventThreadPool().NextThread();
+  return GetTaskProcessor().GetEventThread();
 }
 
 }  // namespace current_task
@@ -10,6 +10,7 @@
 #include <userver/engine/task/cancel.hpp>
 #include <userver/engine/task/single_threaded_task_processors_pool.hpp>
 #include <userver/engine/task/task_with_result.hpp>
+#include <userver/ubench/run_in_engine.hpp>
 #include <utils/impl/parallelize_benchmark.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -107,21 +108,16 @@ void thread_yield(benchmark::State& state) {
 }
 BENCHMARK(thread_yield)->RangeMultiplier(2)->ThreadRange(1, 32);
 
+/// [RunInEngine sample]
 void engine_multiple_tasks_multiple_threads(benchmark::State& state) {
-  engine::RunStandalone(state.range(0), [&] {
-    std::atomic<std::uint64_t> tasks_count_total = 0;
-    RunParallelBenchmark(state, [&](auto& range) {
-      std::uint64_t tasks_count = 0;
-      for ([[maybe_unused]] auto _ : range) {
-        engine::AsyncNoSpan([] {}).Wait();
-        tasks_count++;
-      }
-      tasks_count_total += tasks_count;
-      benchmark::DoNotOptimize(tasks_count);
-    });
-    benchmark::DoNotOptimize(tasks_count_total);
-  });
+  ubench::EngineBenchmarkConfig config;
+  config.worker_threads = state.range(0);
+  config.concurrency = state.range(0);
+
+  ubench::RunInEngine(state, config,
+                      [] { engine::AsyncNoSpan([] {}).Wait(); });
 }
+/// [RunInEngine sample]
 BENCHMARK(engine_multiple_tasks_multiple_threads)
     ->RangeMultiplier(2)
     ->Range(1, 32)
@@ -1,5 +1,7 @@
 #include "task_context.hpp"
 
+#include <time.h>
+
 #include <exception>
 #include <utility>
 
@@ -105,18 +107,31 @@ constexpr SleepState MakeNextEpochSleepState(SleepState::Epoch current) {
 auto* const kFinishedDetachedToken =
     reinterpret_cast<DetachedTasksSyncBlock::Token*>(1);
 
+std::chrono::nanoseconds GetThreadCpuTime() noexcept {
+  struct timespec ts {};
+  ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return std::chrono::seconds{ts.tv_sec} + std::chrono::nanoseconds{ts.tv_nsec};
+}
+
+Deadline GetSpawningTaskRequestDeadline() noexcept {
+  const auto* const parent = current_task::GetCurrentTaskContextUnchecked();
+  return parent ? parent->GetRequestDeadline() : Deadline{};
+}
+
 }  // namespace
 
 TaskContext::TaskContext(TaskProcessor& task_processor,
                          Task::Importance importance, Task::WaitMode wait_type,
-                         Deadline deadline,
+                         Deadline deadline, Task::Priority priority,
                          utils::impl::WrappedCallBase& payload)
     : task_processor_(task_processor),
       task_counter_token_(task_processor_.GetTaskCounter()),
       is_critical_(importance == Task::Importance::kCritical),
+      priority_(priority),
       payload_(&payload),
       finish_waiters_(wait_type),
       cancel_deadline_(deadline),
+      request_deadline_(GetSpawningTaskRequestDeadline()),
       trace_csw_left_(task_processor_.GetTaskTraceMaxCswForNewTask()) {
   UASSERT(payload_);
   LOG_TRACE() << "task with task_id="
@@ -190,7 +205,7 @@ void TaskContext::WaitUntil(Deadline deadline) const {
       // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
       /*target=*/const_cast<TaskContext&>(*this), current};
 
-  current.Sleep(wait_strategy, deadline);
+  current.Sleep(wait_strategy, deadline, WaitKind::kTask);
 
   if (!IsFinished() && current.ShouldCancel()) {
     throw WaitInterruptedException(current.cancellation_reason_);
@@ -292,7 +307,8 @@ bool TaskContext::SetCancellable(bool value) {
 }
 
 TaskContext::WakeupSource TaskContext::Sleep(WaitStrategy& wait_strategy,
-                                             Deadline deadline) {
+                                             Deadline deadline,
+                                             WaitKind wait_kind) {
   UASSERT(IsCurrent());
   UASSERT(state_ == Task::State::kRunning);
   UASSERT_MSG(compiler::impl::AreCoroutineSwitchesAllowed(),
@@ -328,11 +344,23 @@ TaskContext::WakeupSource TaskContext::Sleep(WaitStrategy& wait_strategy,
   TraceStateTransition(Task::State::kSuspended);
   ProfilerStopExecution();
 
+  // Includes the time spent in the task queue after the wakeup
+  const bool should_account_wait = task_processor_.ShouldAccountWaitTime();
+  const auto sleep_start = should_account_wait
+                               ? std::chrono::steady_clock::now()
+                               : std::chrono::steady_clock::time_point{};
+
   auto& task_pipe_ref = *task_pipe_;
   TsanAcquireBarrier();
   [[maybe_unused]] TaskContext* context = task_pipe_ref().get();
   TsanReleaseBarrier();
 
+  if (should_account_wait) {
+    const auto wait_time = std::chrono::steady_clock::now() - sleep_start;
+    wait_times_[ToIndex(wait_kind)] += wait_time;
+    task_processor_.GetTaskCounter().AccountWait(wait_kind, wait_time);
+  }
+
   ProfilerStartExecution();
   TraceStateTransition(Task::State::kRunning);
   UASSERT(context == this);
@@ -355,7 +383,7 @@ void TaskContext::ArmDeadlineTimer(Deadline deadline,
   } else {
     deadline_timer_.StartWakeup(
         boost::intrusive_ptr{this},
-        task_processor_.EventThreadPool().NextTimerThread(), deadline,
+        task_processor_.GetTimerThread(), deadline,
         sleep_epoch);
   }
 }
@@ -370,7 +398,7 @@ void TaskContext::ArmCancellationTimer() {
   } else {
     deadline_timer_.StartCancel(
         boost::intrusive_ptr{this},
-        task_processor_.EventThreadPool().NextTimerThread(), cancel_deadline_);
+        task_processor_.GetTimerThread(), cancel_deadline_);
   }
 }
 
@@ -466,6 +494,21 @@ void TaskContext::Wakeup(WakeupSource source, NoEpoch) {
   }
 }
 
+bool TaskContext::TryWakeupForBatch(WakeupSource source, NoEpoch) {
+  UASSERT(source != WakeupSource::kDeadlineTimer);
+  UASSERT(source != WakeupSource::kCancelRequest);
+
+  if (IsFinished()) return false;
+
+  const auto prev_sleep_state =
+      sleep_state_.FetchOrFlags<std::memory_order_seq_cst>(
+          static_cast<SleepFlags>(source));
+  if (!ShouldSchedule(prev_sleep_state.flags, source)) return false;
+
+  MarkQueued();
+  return true;
+}
+
 void TaskContext::WakeupCurrent() {
   UASSERT(IsCurrent());
   UASSERT(GetState() == Task::State::kRunning);
@@ -542,6 +585,11 @@ void TaskContext::SetCancelDeadline(Deadline deadline) {
   ArmCancellationTimer();
 }
 
+void TaskContext::SetRequestDeadline(Deadline deadline) noexcept {
+  UASSERT(IsCurrent());
+  request_deadline_ = deadline;
+}
+
 bool TaskContext::HasLocalStorage() const noexcept {
   return local_storage_.has_value();
 }
@@ -613,14 +661,29 @@ void TaskContext::SetState(Task::State new_state) {
 }
 
 void TaskContext::Schedule() {
+  MarkQueued();
+  task_processor_.Schedule(this);
+  // NOTE: may be executed at this point
+}
+
+void TaskContext::MarkQueued() {
   UASSERT(state_ != Task::State::kQueued);
   SetState(Task::State::kQueued);
   TraceStateTransition(Task::State::kQueued);
-  task_processor_.Schedule(this);
-  // NOTE: may be executed at this point
+}
+
+std::chrono::nanoseconds TaskContext::GetCpuTime() const noexcept {
+  if (cpu_slice_start_ && IsCurrent()) {
+    return cpu_time_ + (GetThreadCpuTime() - *cpu_slice_start_);
+  }
+  return cpu_time_;
 }
 
 void TaskContext::ProfilerStartExecution() {
+  if (task_processor_.ShouldAccountCpuTime()) {
+    cpu_slice_start_ = GetThreadCpuTime();
+  }
+
   auto threshold_us = task_processor_.GetProfilerThreshold();
   if (threshold_us.count() > 0) {
     execute_started_ = std::chrono::steady_clock::now();
@@ -630,6 +693,11 @@ void TaskContext::ProfilerStartExecution() {
 }
 
 void TaskContext::ProfilerStopExecution() {
+  if (cpu_slice_start_) {
+    cpu_time_ += GetThreadCpuTime() - *cpu_slice_start_;
+    cpu_slice_start_.reset();
+  }
+
   auto threshold_us = task_processor_.GetProfilerThreshold();
   if (threshold_us.count() <= 0) return;
 
@@ -702,9 +770,14 @@ void intrusive_ptr_release(TaskContext* p) noexcept {
   if (p->intrusive_refcount_.fetch_sub(1, std::memory_order_seq_cst) == 1) {
     p->ResetPayload();
 
+    auto* const fused_batch = p->fused_batch_;
     std::destroy_at(p);
 
-    DeleteFusedTaskContext(reinterpret_cast<std::byte*>(p));
+    if (fused_batch) {
+      ReleaseFusedTaskBatchSlots(*fused_batch, 1);
+    } else {
+      DeleteFusedTaskContext(reinterpret_cast<std::byte*>(p));
+    }
   }
 }
 
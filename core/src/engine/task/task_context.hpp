@@ -1,8 +1,10 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include <ev.h>
@@ -15,6 +17,7 @@
 #include <engine/task/counted_coroutine_ptr.hpp>
 #include <engine/task/cxxabi_eh_globals.hpp>
 #include <engine/task/sleep_state.hpp>
+#include <engine/task/wait_kind.hpp>
 #include <engine/task/task_counter.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/impl/context_accessor.hpp>
@@ -33,6 +36,7 @@ namespace engine {
 namespace impl {
 
 class TaskContextHolder;
+class FusedTaskBatch;
 
 [[noreturn]] void ReportDeadlock();
 
@@ -80,7 +84,7 @@ class TaskContext final : public ContextAccessor {
   };
 
   TaskContext(TaskProcessor&, Task::Importance, Task::WaitMode, Deadline,
-              utils::impl::WrappedCallBase& payload);
+              Task::Priority, utils::impl::WrappedCallBase& payload);
 
   ~TaskContext() noexcept;
 
@@ -101,6 +105,8 @@ class TaskContext final : public ContextAccessor {
   // exceeding these limits causes task to become cancelled
   bool IsCritical() const;
 
+  Task::Priority GetPriority() const noexcept { return priority_; }
+
   // whether task is allowed to be awaited from multiple coroutines
   // simultaneously
   bool IsSharedWaitAllowed() const;
@@ -141,7 +147,9 @@ class TaskContext final : public ContextAccessor {
   // causes this to yield and wait for wakeup
   // must only be called from this context
   // "spurious wakeups" may be caused by wakeup queueing
-  WakeupSource Sleep(WaitStrategy& wait_strategy, Deadline deadline);
+  // `wait_kind` tells what the time spent in the sleep is attributed to
+  WakeupSource Sleep(WaitStrategy& wait_strategy, Deadline deadline,
+                     WaitKind wait_kind = WaitKind::kOther);
 
   // sleep epoch increments after each wakeup
   SleepState::Epoch GetEpoch() noexcept;
@@ -153,8 +161,20 @@ class TaskContext final : public ContextAccessor {
   void Wakeup(WakeupSource, NoEpoch);
   void WakeupCurrent();
 
+  // Same as Wakeup(source, NoEpoch{}), but on success leaves the push into
+  // the task queue to the caller, see TaskProcessor::ScheduleBatch().
+  // Returns true if the task has to be pushed. Also used to bootstrap the tasks
+  // made by MakeTaskBatch().
+  [[nodiscard]] bool TryWakeupForBatch(WakeupSource, NoEpoch);
+
   static void CoroFunc(TaskPipe& task_pipe);
 
+  // The context releases its slot of the batch instead of deleting its own
+  // allocation on destruction, see MakeTaskBatch().
+  void SetFusedTaskBatch(FusedTaskBatch& batch) noexcept {
+    fused_batch_ = &batch;
+  }
+
   // C++ ABI support, not to be used by anyone
   EhGlobals* GetEhGlobals() { return &eh_globals_; }
 
@@ -170,6 +190,29 @@ class TaskContext final : public ContextAccessor {
 
   void SetCancelDeadline(Deadline deadline);
 
+  // must not be called concurrently with SetCancelDeadline, e.g. on a task
+  // that is being scheduled
+  Deadline GetCancelDeadline() const noexcept { return cancel_deadline_; }
+
+  // The deadline of the request the task works for, see
+  // server::request::TaskInheritedData::deadline. Tasks inherit it from
+  // the task that starts them. Orders the task queue with
+  // TaskProcessorConfig::earliest_deadline_first.
+  void SetRequestDeadline(Deadline deadline) noexcept;
+
+  // must not be called concurrently with SetRequestDeadline, e.g. on a task
+  // that is being scheduled
+  Deadline GetRequestDeadline() const noexcept { return request_deadline_; }
+
+  // The time spent in Sleep() per WaitKind, only accounted if enabled for
+  // the TaskProcessor
+  const WaitTimes& GetWaitTimes() const noexcept { return wait_times_; }
+
+  // The thread CPU time spent running the task, only accounted if enabled for
+  // the TaskProcessor. Includes the current execution slice, so should only
+  // be called by the task itself.
+  std::chrono::nanoseconds GetCpuTime() const noexcept;
+
   bool HasLocalStorage() const noexcept;
   task_local::Storage& GetLocalStorage() noexcept;
 
@@ -202,6 +245,7 @@ class TaskContext final : public ContextAccessor {
   void SetState(Task::State);
 
   void Schedule();
+  void MarkQueued();
   static bool ShouldSchedule(SleepState::Flags flags, WakeupSource source);
 
   void ProfilerStartExecution();
@@ -216,6 +260,7 @@ class TaskContext final : public ContextAccessor {
   TaskProcessor& task_processor_;
   TaskCounter::Token task_counter_token_;
   const bool is_critical_;
+  const Task::Priority priority_;
   bool is_cancellable_{true};
   bool within_sleep_{false};
   EhGlobals eh_globals_;
@@ -230,6 +275,7 @@ class TaskContext final : public ContextAccessor {
 
   ContextTimer deadline_timer_;
   engine::Deadline cancel_deadline_;
+  engine::Deadline request_deadline_;
 
   // {} if not defined
   std::chrono::steady_clock::time_point task_queue_wait_timepoint_;
@@ -238,6 +284,12 @@ class TaskContext final : public ContextAccessor {
 
   std::size_t trace_csw_left_;
 
+  WaitTimes wait_times_{};
+  std::chrono::nanoseconds cpu_time_{0};
+  // The thread CPU clock at the start of the current execution slice, if
+  // accounted
+  std::optional<std::chrono::nanoseconds> cpu_slice_start_;
+
   AtomicSleepState sleep_state_{
       SleepState{SleepFlags::kSleeping, SleepState::Epoch{0}}};
   WakeupSource wakeup_source_{WakeupSource::kNone};
@@ -251,6 +303,9 @@ class TaskContext final : public ContextAccessor {
   // refcounter for task abandoning (cancellation) in engine::SharedTask
   std::atomic<std::size_t> shared_task_usages_{1};
 
+  // nullptr if the context has an allocation of its own
+  FusedTaskBatch* fused_batch_{nullptr};
+
   // refcounter for resources and memory deallocation
   std::atomic<std::size_t> intrusive_refcount_{1};
   friend void intrusive_ptr_add_ref(TaskContext* p) noexcept;
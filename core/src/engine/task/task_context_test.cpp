@@ -2,7 +2,9 @@
 
 #include <engine/task/sleep_state.hpp>
 #include <engine/task/task_context.hpp>
+#include <engine/task/task_processor.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/mutex.hpp>
 #include <userver/engine/sleep.hpp>
 
 #include <userver/engine/task/task_base.hpp>
@@ -95,4 +97,69 @@ UTEST(TaskContext, WaitListWakeupRace) {
             engine::impl::TaskContext::WakeupSource::kWaitList);
 }
 
+UTEST(TaskContext, WaitTimeAccounting) {
+  using engine::impl::WaitKind;
+  constexpr auto kSleepTime = std::chrono::milliseconds{10};
+
+  auto& task_processor = engine::current_task::GetTaskProcessor();
+  const auto& counter = task_processor.GetTaskCounter();
+  auto& context = engine::current_task::GetCurrentTaskContext();
+  const auto wait_times = [&context](WaitKind kind) {
+    return context.GetWaitTimes()[engine::impl::ToIndex(kind)];
+  };
+
+  engine::SleepFor(kSleepTime);
+  EXPECT_EQ(wait_times(WaitKind::kSleep).count(), 0);
+
+  engine::TaskProcessorSettings settings;
+  settings.profiler_wait_time_accounting = true;
+  task_processor.SetSettings(settings);
+
+  engine::SleepFor(kSleepTime);
+  EXPECT_GE(wait_times(WaitKind::kSleep), kSleepTime);
+  EXPECT_EQ(counter.GetWaits(WaitKind::kSleep).value, 1);
+
+  engine::Mutex mutex;
+  std::unique_lock lock(mutex);
+  auto task = engine::AsyncNoSpan([&mutex] { const std::lock_guard _(mutex); });
+  engine::SleepFor(kSleepTime);
+  lock.unlock();
+  task.Get();
+  EXPECT_GE(counter.GetWaitTime(WaitKind::kMutex).value, 1);
+  EXPECT_EQ(counter.GetWaits(WaitKind::kMutex).value, 1);
+
+  task_processor.SetSettings({});
+}
+
+UTEST(TaskContext, CpuTimeAccounting) {
+  auto& task_processor = engine::current_task::GetTaskProcessor();
+  auto& context = engine::current_task::GetCurrentTaskContext();
+
+  const auto burn_cpu = [] {
+    const auto until =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds{5};
+    while (std::chrono::steady_clock::now() < until) {
+    }
+  };
+
+  burn_cpu();
+  EXPECT_EQ(context.GetCpuTime().count(), 0);
+
+  engine::TaskProcessorSettings settings;
+  settings.profiler_cpu_time_accounting = true;
+  task_processor.SetSettings(settings);
+  // Starts the accounted execution slice
+  engine::Yield();
+
+  burn_cpu();
+  const auto cpu_time = context.GetCpuTime();
+  EXPECT_GT(cpu_time.count(), 0);
+
+  // Sleeping takes no CPU time of the task
+  engine::SleepFor(std::chrono::milliseconds{10});
+  EXPECT_LT(context.GetCpuTime() - cpu_time, std::chrono::milliseconds{5});
+
+  task_processor.SetSettings({});
+}
+
 USERVER_NAMESPACE_END
@@ -113,6 +113,14 @@ Rate TaskCounter::GetSpuriousWakeups() const noexcept {
   return GetApproximate(LocalCounterId::kSpuriousWakeups);
 }
 
+Rate TaskCounter::GetWaits(WaitKind kind) const noexcept {
+  return GetApproximate(ForWaitKind(LocalCounterId::kWaits, kind));
+}
+
+Rate TaskCounter::GetWaitTime(WaitKind kind) const noexcept {
+  return GetApproximate(ForWaitKind(LocalCounterId::kWaitTimeUs, kind));
+}
+
 void TaskCounter::AccountTaskCancel() noexcept {
   Increment(LocalCounterId::kCancelled);
 }
@@ -145,6 +153,15 @@ void TaskCounter::AccountSpuriousWakeup() noexcept {
   Increment(LocalCounterId::kSpuriousWakeups);
 }
 
+void TaskCounter::AccountWait(WaitKind kind,
+                              std::chrono::nanoseconds duration) noexcept {
+  Increment(ForWaitKind(LocalCounterId::kWaits, kind));
+  const auto duration_us =
+      std::chrono::duration_cast<std::chrono::microseconds>(duration);
+  Add(ForWaitKind(LocalCounterId::kWaitTimeUs, kind),
+      Rate{static_cast<Rate::ValueType>(duration_us.count())});
+}
+
 Rate TaskCounter::GetApproximate(LocalCounterId id) const noexcept {
   Rate total;
   for (const auto& local_counters_block : local_counters_) {
@@ -158,12 +175,22 @@ Rate TaskCounter::GetApproximate(GlobalCounterId id) const noexcept {
   return total;
 }
 
-void TaskCounter::Increment(LocalCounterId id) noexcept {
+TaskCounter::LocalCounterId TaskCounter::ForWaitKind(LocalCounterId first,
+                                                     WaitKind kind) noexcept {
+  UASSERT(first == LocalCounterId::kWaits ||
+          first == LocalCounterId::kWaitTimeUs);
+  return static_cast<LocalCounterId>(static_cast<std::size_t>(first) +
+                                     ToIndex(kind));
+}
+
+void TaskCounter::Increment(LocalCounterId id) noexcept { Add(id, Rate{1}); }
+
+void TaskCounter::Add(LocalCounterId id, Rate value) noexcept {
   auto local_data = local_task_counter_data.Use();
   UASSERT(local_data->local_counter == this);
   auto& counter = (*local_counters_[local_data->task_processor_thread_index])
       [static_cast<std::size_t>(id)];
-  counter.Store(counter.Load() + Rate{1});
+  counter.Store(counter.Load() + value);
 }
 
 void TaskCounter::Increment(GlobalCounterId id) noexcept {
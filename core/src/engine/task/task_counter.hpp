@@ -1,11 +1,13 @@
 #pragma once
 
 #include <array>
+#include <chrono>
 #include <cstddef>
 
 #include <boost/range/adaptor/transformed.hpp>
 
 #include <concurrent/impl/interference_shield.hpp>
+#include <engine/task/wait_kind.hpp>
 #include <userver/concurrent/impl/asymmetric_fence.hpp>
 #include <userver/concurrent/impl/striped_read_indicator.hpp>
 #include <userver/concurrent/striped_counter.hpp>
@@ -69,6 +71,11 @@ class TaskCounter final {
 
   Rate GetSpuriousWakeups() const noexcept;
 
+  Rate GetWaits(WaitKind kind) const noexcept;
+
+  // In microseconds
+  Rate GetWaitTime(WaitKind kind) const noexcept;
+
   void AccountTaskCancel() noexcept;
 
   void AccountTaskCancelOverload() noexcept;
@@ -85,6 +92,8 @@ class TaskCounter final {
 
   void AccountSpuriousWakeup() noexcept;
 
+  void AccountWait(WaitKind kind, std::chrono::nanoseconds duration) noexcept;
+
  private:
   // Counters that may be mutated from outside the bound TaskProcessor.
   enum class GlobalCounterId : std::size_t {
@@ -105,7 +114,11 @@ class TaskCounter final {
     kOverloadSensor,
     kNoOverloadSensor,
 
-    kCountersSize,
+    // A counter per WaitKind
+    kWaits,
+    kWaitTimeUs = kWaits + kWaitKindCount,
+
+    kCountersSize = kWaitTimeUs + kWaitKindCount,
   };
 
   static constexpr auto kLocalCountersSize =
@@ -125,8 +138,13 @@ class TaskCounter final {
 
   Rate GetApproximate(GlobalCounterId) const noexcept;
 
+  static LocalCounterId ForWaitKind(LocalCounterId first,
+                                    WaitKind kind) noexcept;
+
   void Increment(LocalCounterId) noexcept;
 
+  void Add(LocalCounterId, Rate value) noexcept;
+
   void Increment(GlobalCounterId) noexcept;
 
   GlobalCounterPack global_counters_;
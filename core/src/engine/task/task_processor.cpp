@@ -6,6 +6,8 @@
 #include <fmt/format.h>
 
 #include <concurrent/impl/latch.hpp>
+#include <engine/ev/thread_pool.hpp>
+#include <engine/ev/worker_loop.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/impl/static_registration.hpp>
@@ -13,6 +15,7 @@
 #include <userver/utils/rand.hpp>
 #include <userver/utils/thread_name.hpp>
 #include <userver/utils/threads.hpp>
+#include <utils/jemalloc.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
 #include <engine/task/counted_coroutine_ptr.hpp>
@@ -24,6 +27,10 @@ USERVER_NAMESPACE_BEGIN
 namespace engine {
 namespace {
 
+// Enough to submit all the requests of a task step at once, the completions
+// ring is twice as big and the kernel keeps the overflowing completions
+constexpr unsigned kUringEntries = 256;
+
 template <class Value>
 struct OverloadActionAndValue final {
   TaskProcessorSettings::OverloadAction action;
@@ -85,8 +92,9 @@ void TaskProcessorThreadStartedHook() {
 
 TaskProcessor::TaskProcessor(TaskProcessorConfig config,
                              std::shared_ptr<impl::TaskProcessorPools> pools)
-    : task_queue_(config),
+    : task_queue_(MakeTaskQueue(config)),
       task_counter_(config.worker_threads),
+      sampling_profiler_(config.worker_threads),
       config_(std::move(config)),
       pools_(std::move(pools)) {
   utils::impl::FinishStaticRegistration();
@@ -97,12 +105,25 @@ TaskProcessor::TaskProcessor(TaskProcessorConfig config,
     concurrent::impl::Latch workers_left{
         static_cast<std::ptrdiff_t>(config_.worker_threads)};
     workers_.reserve(config_.worker_threads);
+    if (config_.jemalloc_arena) {
+      InitJemallocArena();
+    }
+    if (config_.io_backend == IoBackend::kIoUring) {
+      uring_reactors_.resize(config_.worker_threads);
+    }
+    if (config_.ev_loops_in_workers) {
+      worker_loops_.reserve(config_.worker_threads);
+      for (std::size_t i = 0; i < config_.worker_threads; ++i) {
+        worker_loops_.push_back(std::make_unique<ev::WorkerLoop>(
+            fmt::format("{}-ev_{}", config_.thread_name, i)));
+      }
+    }
     for (std::size_t i = 0; i < config_.worker_threads; ++i) {
       workers_.emplace_back([this, i, &workers_left] {
         PrepareWorkerThread(i);
         workers_left.count_down();
         ProcessTasks();
-        FinalizeWorkerThread();
+        FinalizeWorkerThread(i);
       });
     }
 
@@ -118,19 +139,67 @@ TaskProcessor::TaskProcessor(TaskProcessorConfig config,
 
 TaskProcessor::~TaskProcessor() { Cleanup(); }
 
+TaskProcessor::TaskQueueVariant TaskProcessor::MakeTaskQueue(
+    const TaskProcessorConfig& config) {
+  // Neither of the queues is movable, rely on the guaranteed copy elision
+  switch (config.task_queue) {
+    case TaskQueueType::kGlobalTaskQueue:
+      return TaskQueueVariant{std::in_place_type<TaskQueue>, config};
+    case TaskQueueType::kWorkStealingTaskQueue:
+      return TaskQueueVariant{std::in_place_type<WorkStealingTaskQueue>,
+                              config};
+    case TaskQueueType::kPriorityTaskQueue:
+      return TaskQueueVariant{std::in_place_type<PriorityTaskQueue>, config};
+  }
+
+  UINVARIANT(false, "Unexpected task queue type");
+}
+
 void TaskProcessor::Cleanup() noexcept {
   InitiateShutdown();
 
   // Some tasks may be bound but not scheduled yet
   task_counter_.WaitForExhaustionBlocking();
 
-  task_queue_.StopProcessing();
+  std::visit([](auto& queue) { queue.StopProcessing(); }, task_queue_);
 
   for (auto& w : workers_) {
     w.join();
   }
 
   UASSERT(!task_counter_.MayHaveTasksAlive());
+  // No timers or watchers of the tasks are left in the loops
+  worker_loops_.clear();
+}
+
+void TaskProcessor::InitJemallocArena() {
+  unsigned arena_index = 0;
+  if (auto ec = utils::jemalloc::CreateArena(arena_index)) {
+    LOG_WARNING() << "Workers of task processor " << Name()
+                  << " use the default jemalloc arenas, failed to create an "
+                     "arena: "
+                  << ec.message();
+    return;
+  }
+
+  if (config_.jemalloc_dirty_decay) {
+    if (auto ec = utils::jemalloc::SetArenaDirtyDecay(
+            arena_index, *config_.jemalloc_dirty_decay)) {
+      LOG_WARNING() << "Failed to set the dirty decay of jemalloc arena "
+                    << arena_index << ": " << ec.message();
+    }
+  }
+  if (config_.jemalloc_muzzy_decay) {
+    if (auto ec = utils::jemalloc::SetArenaMuzzyDecay(
+            arena_index, *config_.jemalloc_muzzy_decay)) {
+      LOG_WARNING() << "Failed to set the muzzy decay of jemalloc arena "
+                    << arena_index << ": " << ec.message();
+    }
+  }
+
+  LOG_INFO() << "Workers of task processor " << Name()
+             << " allocate from jemalloc arena " << arena_index;
+  jemalloc_arena_ = arena_index;
 }
 
 void TaskProcessor::InitiateShutdown() {
@@ -140,25 +209,22 @@ void TaskProcessor::InitiateShutdown() {
 
 void TaskProcessor::Schedule(impl::TaskContext* context) {
   UASSERT(context);
-  const auto [action, max_queue_length] =
-      GetOverloadActionAndValue(action_bit_and_max_task_queue_wait_length_);
-  if (max_queue_length && !context->IsCritical()) {
-    UASSERT(max_queue_length > 0);
-    if (const auto overload_size = GetOverloadByLength(max_queue_length)) {
-      LOG_LIMITED_WARNING()
-          << "failed to enqueue task: task_queue_size_approximate="
-          << overload_size << " >= "
-          << "task_queue_size_threshold=" << max_queue_length
-          << " task_processor=" << Name();
-      HandleOverload(*context, action);
-    }
-  }
-  if (is_shutting_down_)
-    context->RequestCancel(TaskCancellationReason::kShutdown);
+  PrepareForQueue(*context);
+
+  std::visit([context](auto& queue) { queue.Push(context); }, task_queue_);
+}
+
+void TaskProcessor::ScheduleBatch(
+    utils::span<impl::TaskContext* const> contexts) {
+  if (contexts.empty()) return;
 
-  SetTaskQueueWaitTimepoint(context);
+  for (auto* const context : contexts) {
+    UASSERT(context);
+    PrepareForQueue(*context);
+  }
 
-  task_queue_.Push(context);
+  std::visit([contexts](auto& queue) { queue.PushBulk(contexts); },
+             task_queue_);
 }
 
 void TaskProcessor::Adopt(impl::TaskContext& context) {
@@ -169,6 +235,20 @@ ev::ThreadPool& TaskProcessor::EventThreadPool() {
   return pools_->EventThreadPool();
 }
 
+ev::ThreadControl& TaskProcessor::GetEventThread() {
+  if (auto* const loop = ev::WorkerLoop::GetForCurrentThread()) {
+    return loop->GetControl();
+  }
+  return EventThreadPool().NextThread();
+}
+
+ev::TimerThreadControl& TaskProcessor::GetTimerThread() {
+  if (auto* const loop = ev::WorkerLoop::GetForCurrentThread()) {
+    return loop->GetTimerControl();
+  }
+  return EventThreadPool().NextTimerThread();
+}
+
 impl::CountedCoroutinePtr TaskProcessor::GetCoroutine() {
   return {pools_->GetCoroPool().GetCoroutine(), *this};
 }
@@ -222,6 +302,10 @@ void TaskProcessor::SetSettings(const TaskProcessorSettings& settings) {
     }
   }
   profiler_force_stacktrace_.store(settings.profiler_force_stacktrace);
+  wait_time_accounting_.store(settings.profiler_wait_time_accounting,
+                              std::memory_order_relaxed);
+  cpu_time_accounting_.store(settings.profiler_cpu_time_accounting,
+                             std::memory_order_relaxed);
 }
 
 std::chrono::microseconds TaskProcessor::GetProfilerThreshold() const {
@@ -265,6 +349,18 @@ std::vector<std::uint8_t> TaskProcessor::CollectCurrentLoadPct() const {
   return cpu_stats_storage_->CollectCurrentLoadPct();
 }
 
+std::vector<WorkStealingTaskQueue::NodeStats>
+TaskProcessor::CollectNodeStats() const {
+  std::vector<WorkStealingTaskQueue::NodeStats> result;
+  if (const auto* queue = std::get_if<WorkStealingTaskQueue>(&task_queue_)) {
+    result.reserve(queue->GetNodeCount());
+    for (std::size_t node = 0; node < queue->GetNodeCount(); ++node) {
+      result.push_back(queue->GetNodeStats(node));
+    }
+  }
+  return result;
+}
+
 void RegisterThreadStartedHook(std::function<void()> func) {
   utils::impl::AssertStaticRegistrationAllowed(
       "Calling engine::RegisterThreadStartedHook()");
@@ -283,27 +379,77 @@ void TaskProcessor::PrepareWorkerThread(std::size_t index) noexcept {
       break;
   }
 
+  if (jemalloc_arena_) {
+    // Errors are not expected once the arena is created, the worker just keeps
+    // allocating from the automatic arenas on failure
+    [[maybe_unused]] const auto bind_ec =
+        utils::jemalloc::BindThreadToArena(*jemalloc_arena_);
+    UASSERT_MSG(!bind_ec, bind_ec.message());
+    if (!config_.jemalloc_tcache) {
+      utils::jemalloc::SetThreadTcacheEnabled(false);
+    }
+  }
+
   pools_->GetCoroPool().PrepareLocalCache();
 
   utils::SetCurrentThreadName(fmt::format("{}_{}", config_.thread_name, index));
 
   impl::SetLocalTaskCounterData(task_counter_, index);
 
+  if (auto* queue = std::get_if<WorkStealingTaskQueue>(&task_queue_)) {
+    queue->PrepareWorker(index);
+  }
+
   pools_->GetCoroPool().RegisterThread();
+  sampling_profiler_.RegisterWorker(index);
+
+  if (!uring_reactors_.empty()) {
+    try {
+      uring_reactors_[index] =
+          std::make_unique<io::impl::UringReactor>(kUringEntries);
+      io::impl::UringReactor::SetForCurrentThread(uring_reactors_[index].get());
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "Falling back to libev for I/O in worker " << index
+                    << " of task processor " << Name() << ": " << ex;
+    }
+  }
+
+  if (!worker_loops_.empty()) {
+    ev::WorkerLoop::SetForCurrentThread(worker_loops_[index].get());
+    worker_loops_[index]->Reclaim();
+  }
 
   TaskProcessorThreadStartedHook();
 }
 
-void TaskProcessor::FinalizeWorkerThread() noexcept {
+void TaskProcessor::FinalizeWorkerThread(std::size_t index) noexcept {
+  if (!worker_loops_.empty()) {
+    worker_loops_[index]->Lend();
+    ev::WorkerLoop::SetForCurrentThread(nullptr);
+  }
+  if (!uring_reactors_.empty()) {
+    io::impl::UringReactor::SetForCurrentThread(nullptr);
+    uring_reactors_[index].reset();
+  }
+  sampling_profiler_.UnregisterWorker();
   pools_->GetCoroPool().ClearLocalCache();
 }
 
 void TaskProcessor::ProcessTasks() noexcept {
+  auto* const uring_reactor = io::impl::UringReactor::GetForCurrentThread();
+  auto* const worker_loop = ev::WorkerLoop::GetForCurrentThread();
   while (true) {
-    auto context = task_queue_.PopBlocking();
+    auto context = std::visit([](auto& queue) { return queue.PopBlocking(); },
+                              task_queue_);
     if (!context) break;
 
     GetTaskCounter().AccountTaskSwitchSlow();
+    std::visit(
+        [&context](auto& queue) {
+          queue.GetIdlePolicy().AccountQueueWait(
+              context->GetQueueWaitTimepoint());
+        },
+        task_queue_);
     CheckWaitTime(*context);
 
     bool has_failed = false;
@@ -314,7 +460,12 @@ void TaskProcessor::ProcessTasks() noexcept {
       has_failed = true;
     }
 
+    // The I/O requests of the task step go to the kernel in one syscall
+    if (uring_reactor) uring_reactor->Flush();
+    // Starts the watchers of the task step and runs the ready callbacks
+    if (worker_loop) worker_loop->Poll();
     pools_->GetCoroPool().AccountStackUsage();
+    sampling_profiler_.Collect();
 
     if (has_failed || context->IsFinished()) {
       context->FinishDetached();
@@ -371,7 +522,12 @@ void TaskProcessor::HandleOverload(
   GetTaskCounter().AccountTaskOverload();
 
   if (action == TaskProcessorSettings::OverloadAction::kCancel) {
-    if (!context.IsCritical()) {
+    if (IsSparedByBackgroundShedding(context)) {
+      LOG_TRACE() << "Task with task_id="
+                  << logging::HexShort(context.GetTaskId())
+                  << " was waiting in queue for too long, background tasks "
+                     "were cancelled instead.";
+    } else if (!context.IsCritical()) {
       LOG_LIMITED_WARNING()
           << "Task with task_id=" << logging::HexShort(context.GetTaskId())
           << " was waiting in queue for too long, cancelling.";
@@ -387,6 +543,46 @@ void TaskProcessor::HandleOverload(
   }
 }
 
+bool TaskProcessor::IsSparedByBackgroundShedding(impl::TaskContext& context) {
+  auto* const queue = std::get_if<PriorityTaskQueue>(&task_queue_);
+  if (!queue) return false;
+
+  const auto cancelled =
+      queue->CancelBackgroundTasks(TaskCancellationReason::kOverload);
+  for (std::size_t i = 0; i < cancelled; ++i) {
+    GetTaskCounter().AccountTaskCancelOverload();
+  }
+
+  // Background and already expired tasks are cancelled anyway, the rest only
+  // when there is no background work left to drop.
+  if (context.GetPriority() == Task::Priority::kBackground ||
+      context.GetCancelDeadline().IsReached() ||
+      context.GetRequestDeadline().IsReached()) {
+    return false;
+  }
+  return cancelled != 0;
+}
+
+void TaskProcessor::PrepareForQueue(impl::TaskContext& context) {
+  const auto [action, max_queue_length] =
+      GetOverloadActionAndValue(action_bit_and_max_task_queue_wait_length_);
+  if (max_queue_length && !context.IsCritical()) {
+    UASSERT(max_queue_length > 0);
+    if (const auto overload_size = GetOverloadByLength(max_queue_length)) {
+      LOG_LIMITED_WARNING()
+          << "failed to enqueue task: task_queue_size_approximate="
+          << overload_size << " >= "
+          << "task_queue_size_threshold=" << max_queue_length
+          << " task_processor=" << Name();
+      HandleOverload(context, action);
+    }
+  }
+  if (is_shutting_down_)
+    context.RequestCancel(TaskCancellationReason::kShutdown);
+
+  SetTaskQueueWaitTimepoint(&context);
+}
+
 TaskProcessor::OverloadByLength TaskProcessor::GetOverloadByLength(
     const std::size_t max_queue_length) noexcept {
   const auto old_overload_by_length =
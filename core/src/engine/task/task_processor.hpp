@@ -4,19 +4,27 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <thread>
+#include <variant>
 #include <vector>
 
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
 #include <concurrent/impl/interference_shield.hpp>
+#include <engine/io/uring_reactor.hpp>
+#include <engine/task/idle_spin_policy.hpp>
+#include <engine/task/priority_task_queue.hpp>
+#include <engine/task/sampling_profiler.hpp>
 #include <engine/task/task_counter.hpp>
 #include <engine/task/task_processor_config.hpp>
 #include <engine/task/task_queue.hpp>
+#include <engine/task/work_stealing_task_queue.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
 #include <userver/engine/impl/detached_tasks_sync_block.hpp>
 #include <userver/logging/logger.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -30,6 +38,9 @@ class CountedCoroutinePtr;
 
 namespace ev {
 class ThreadPool;
+class ThreadControl;
+class TimerThreadControl;
+class WorkerLoop;
 }  // namespace ev
 
 class TaskProcessor final {
@@ -41,12 +52,22 @@ class TaskProcessor final {
 
   void Schedule(impl::TaskContext*);
 
+  // Same as calling Schedule() for each of the contexts, but pushes them into
+  // the task queue at once and wakes up the workers once
+  void ScheduleBatch(utils::span<impl::TaskContext* const> contexts);
+
   void Adopt(impl::TaskContext& context);
 
   impl::CountedCoroutinePtr GetCoroutine();
 
   ev::ThreadPool& EventThreadPool();
 
+  // The ev loop of the current worker with `ev-loops-in-workers`, the next
+  // thread of EventThreadPool() otherwise. Must be called by a worker of this
+  // TaskProcessor.
+  ev::ThreadControl& GetEventThread();
+  ev::TimerThreadControl& GetTimerThread();
+
   std::shared_ptr<impl::TaskProcessorPools> GetTaskProcessorPools() {
     return pools_;
   }
@@ -58,17 +79,40 @@ class TaskProcessor final {
   const impl::TaskCounter& GetTaskCounter() const { return task_counter_; }
 
   std::size_t GetTaskQueueSize() const {
-    return task_queue_.GetSizeApproximate();
+    return std::visit(
+        [](const auto& queue) { return queue.GetSizeApproximate(); },
+        task_queue_);
+  }
+
+  IdleSpinPolicy::Stats GetIdleStats() const {
+    return std::visit([](const auto& queue) { return queue.GetIdleStats(); },
+                      task_queue_);
   }
 
   std::size_t GetWorkerCount() const { return workers_.size(); }
 
+  SamplingProfiler& GetSamplingProfiler() noexcept {
+    return sampling_profiler_;
+  }
+
+  const SamplingProfiler& GetSamplingProfiler() const noexcept {
+    return sampling_profiler_;
+  }
+
   void SetSettings(const TaskProcessorSettings& settings);
 
   std::chrono::microseconds GetProfilerThreshold() const;
 
   bool ShouldProfilerForceStacktrace() const;
 
+  bool ShouldAccountWaitTime() const noexcept {
+    return wait_time_accounting_.load(std::memory_order_relaxed);
+  }
+
+  bool ShouldAccountCpuTime() const noexcept {
+    return cpu_time_accounting_.load(std::memory_order_relaxed);
+  }
+
   std::size_t GetTaskTraceMaxCswForNewTask() const;
 
   const std::string& GetTaskTraceLoggerName() const;
@@ -79,20 +123,36 @@ class TaskProcessor final {
 
   std::vector<std::uint8_t> CollectCurrentLoadPct() const;
 
+  // Per NUMA node statistics of the work-stealing task queue, empty for the
+  // global task queue.
+  std::vector<WorkStealingTaskQueue::NodeStats> CollectNodeStats() const;
+
+  // The jemalloc arena of the workers with `jemalloc-arena`, if it was created
+  std::optional<unsigned> GetJemallocArena() const noexcept {
+    return jemalloc_arena_;
+  }
+
  private:
   // Contains queue size cache when overloaded by length, 0 otherwise.
   using OverloadByLength = std::size_t;
 
+  using TaskQueueVariant =
+      std::variant<TaskQueue, WorkStealingTaskQueue, PriorityTaskQueue>;
+
   struct OverloadedCache final {
     std::atomic<bool> overloaded_by_wait_time{false};
     std::atomic<OverloadByLength> overload_by_length{0};
   };
 
+  static TaskQueueVariant MakeTaskQueue(const TaskProcessorConfig& config);
+
   void Cleanup() noexcept;
 
+  void InitJemallocArena();
+
   void PrepareWorkerThread(std::size_t index) noexcept;
 
-  void FinalizeWorkerThread() noexcept;
+  void FinalizeWorkerThread(std::size_t index) noexcept;
 
   void ProcessTasks() noexcept;
 
@@ -103,6 +163,13 @@ class TaskProcessor final {
   void HandleOverload(impl::TaskContext& context,
                       TaskProcessorSettings::OverloadAction);
 
+  // With the priority task queue, cancels the queued background tasks and
+  // returns whether that is enough to let the `context` run.
+  bool IsSparedByBackgroundShedding(impl::TaskContext& context);
+
+  // The part of Schedule() done before the push into the task queue
+  void PrepareForQueue(impl::TaskContext& context);
+
   OverloadByLength GetOverloadByLength(std::size_t max_queue_length) noexcept;
 
   OverloadByLength ComputeOverloadByLength(
@@ -112,13 +179,19 @@ class TaskProcessor final {
   concurrent::impl::InterferenceShield<impl::DetachedTasksSyncBlock>
       detached_contexts_{impl::DetachedTasksSyncBlock::StopMode::kCancel};
   concurrent::impl::InterferenceShield<OverloadedCache> overloaded_cache_;
-  TaskQueue task_queue_;
+  TaskQueueVariant task_queue_;
   impl::TaskCounter task_counter_;
+  SamplingProfiler sampling_profiler_;
 
   const TaskProcessorConfig config_;
   const std::shared_ptr<impl::TaskProcessorPools> pools_;
   std::vector<std::thread> workers_;
+  // Per worker, empty unless `io-backend: io-uring`
+  std::vector<std::unique_ptr<io::impl::UringReactor>> uring_reactors_;
+  // Per worker, empty unless `ev-loops-in-workers: true`
+  std::vector<std::unique_ptr<ev::WorkerLoop>> worker_loops_;
   logging::LoggerPtr task_trace_logger_{nullptr};
+  std::optional<unsigned> jemalloc_arena_;
 
   std::atomic<std::chrono::microseconds> task_profiler_threshold_{{}};
   std::atomic<std::chrono::microseconds> sensor_task_queue_wait_time_{{}};
@@ -128,6 +201,8 @@ class TaskProcessor final {
   std::atomic<std::int64_t> action_bit_and_max_task_queue_wait_length_{0};
 
   std::atomic<bool> profiler_force_stacktrace_{false};
+  std::atomic<bool> wait_time_accounting_{false};
+  std::atomic<bool> cpu_time_accounting_{false};
   std::atomic<bool> is_shutting_down_{false};
   std::atomic<bool> task_trace_logger_set_{false};
 
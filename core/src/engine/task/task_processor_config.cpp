@@ -45,6 +45,40 @@ OsScheduling Parse(const yaml_config::YamlConfig& value,
   return utils::ParseFromValueString(value, kMap);
 }
 
+TaskQueueType Parse(const yaml_config::YamlConfig& value,
+                    formats::parse::To<TaskQueueType>) {
+  static constexpr utils::TrivialBiMap kMap([](auto selector) {
+    return selector()
+        .Case(TaskQueueType::kGlobalTaskQueue, "global")
+        .Case(TaskQueueType::kWorkStealingTaskQueue, "work-stealing")
+        .Case(TaskQueueType::kPriorityTaskQueue, "priority");
+  });
+
+  return utils::ParseFromValueString(value, kMap);
+}
+
+SpinningPolicy Parse(const yaml_config::YamlConfig& value,
+                     formats::parse::To<SpinningPolicy>) {
+  static constexpr utils::TrivialBiMap kMap([](auto selector) {
+    return selector()
+        .Case(SpinningPolicy::kFixed, "fixed")
+        .Case(SpinningPolicy::kAdaptive, "adaptive");
+  });
+
+  return utils::ParseFromValueString(value, kMap);
+}
+
+IoBackend Parse(const yaml_config::YamlConfig& value,
+                formats::parse::To<IoBackend>) {
+  static constexpr utils::TrivialBiMap kMap([](auto selector) {
+    return selector()
+        .Case(IoBackend::kLibev, "libev")
+        .Case(IoBackend::kIoUring, "io-uring");
+  });
+
+  return utils::ParseFromValueString(value, kMap);
+}
+
 TaskProcessorConfig Parse(const yaml_config::YamlConfig& value,
                           formats::parse::To<TaskProcessorConfig>) {
   TaskProcessorConfig config;
@@ -56,6 +90,41 @@ TaskProcessorConfig Parse(const yaml_config::YamlConfig& value,
       value["os-scheduling"].As<OsScheduling>(config.os_scheduling);
   config.spinning_iterations =
       value["spinning-iterations"].As<int>(config.spinning_iterations);
+  config.spinning_policy =
+      value["spinning-policy"].As<SpinningPolicy>(config.spinning_policy);
+  config.task_queue =
+      value["task-queue"].As<TaskQueueType>(config.task_queue);
+  config.numa_aware = value["numa-aware"].As<bool>(config.numa_aware);
+  if (config.numa_aware &&
+      config.task_queue != TaskQueueType::kWorkStealingTaskQueue) {
+    throw std::runtime_error(fmt::format(
+        "'numa-aware' requires 'task-queue: work-stealing' at '{}'",
+        value.GetPath()));
+  }
+  config.earliest_deadline_first = value["earliest-deadline-first"].As<bool>(
+      config.earliest_deadline_first);
+  if (config.earliest_deadline_first &&
+      config.task_queue != TaskQueueType::kPriorityTaskQueue) {
+    throw std::runtime_error(fmt::format(
+        "'earliest-deadline-first' requires 'task-queue: priority' at '{}'",
+        value.GetPath()));
+  }
+  config.io_backend = value["io-backend"].As<IoBackend>(config.io_backend);
+  config.ev_loops_in_workers =
+      value["ev-loops-in-workers"].As<bool>(config.ev_loops_in_workers);
+
+  const auto jemalloc_arena = value["jemalloc-arena"];
+  if (!jemalloc_arena.IsMissing()) {
+    config.jemalloc_arena = jemalloc_arena["enabled"].As<bool>(true);
+    config.jemalloc_dirty_decay =
+        jemalloc_arena["dirty-decay"]
+            .As<std::optional<std::chrono::milliseconds>>();
+    config.jemalloc_muzzy_decay =
+        jemalloc_arena["muzzy-decay"]
+            .As<std::optional<std::chrono::milliseconds>>();
+    config.jemalloc_tcache =
+        jemalloc_arena["tcache"].As<bool>(config.jemalloc_tcache);
+  }
 
   const auto task_trace = value["task-trace"];
   if (!task_trace.IsMissing()) {
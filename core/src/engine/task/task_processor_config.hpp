@@ -3,6 +3,7 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <string>
 
 #include <userver/formats/json_fwd.hpp>
@@ -21,6 +22,31 @@ enum class OsScheduling {
 OsScheduling Parse(const yaml_config::YamlConfig& value,
                    formats::parse::To<OsScheduling>);
 
+enum class TaskQueueType {
+  kGlobalTaskQueue,
+  kWorkStealingTaskQueue,
+  kPriorityTaskQueue,
+};
+
+TaskQueueType Parse(const yaml_config::YamlConfig& value,
+                    formats::parse::To<TaskQueueType>);
+
+enum class SpinningPolicy {
+  kFixed,
+  kAdaptive,
+};
+
+SpinningPolicy Parse(const yaml_config::YamlConfig& value,
+                     formats::parse::To<SpinningPolicy>);
+
+enum class IoBackend {
+  kLibev,
+  kIoUring,
+};
+
+IoBackend Parse(const yaml_config::YamlConfig& value,
+                formats::parse::To<IoBackend>);
+
 struct TaskProcessorConfig {
   std::string name;
 
@@ -29,6 +55,18 @@ struct TaskProcessorConfig {
   std::string thread_name;
   OsScheduling os_scheduling{OsScheduling::kNormal};
   int spinning_iterations{1000};
+  SpinningPolicy spinning_policy{SpinningPolicy::kFixed};
+  TaskQueueType task_queue{TaskQueueType::kGlobalTaskQueue};
+  bool numa_aware{false};
+  bool earliest_deadline_first{false};
+  IoBackend io_backend{IoBackend::kLibev};
+  bool ev_loops_in_workers{false};
+
+  // Workers allocate from a jemalloc arena of the task processor
+  bool jemalloc_arena{false};
+  std::optional<std::chrono::milliseconds> jemalloc_dirty_decay;
+  std::optional<std::chrono::milliseconds> jemalloc_muzzy_decay;
+  bool jemalloc_tcache{true};
 
   std::size_t task_trace_every{1000};
   std::size_t task_trace_max_csw{0};
@@ -50,6 +88,10 @@ struct TaskProcessorSettings {
 
   std::chrono::microseconds profiler_execution_slice_threshold{0};
   bool profiler_force_stacktrace{false};
+  // Measure the time the tasks spend sleeping per the waited primitive
+  bool profiler_wait_time_accounting{false};
+  // Measure the thread CPU time the tasks spend running
+  bool profiler_cpu_time_accounting{false};
 };
 
 TaskProcessorSettings::OverloadAction Parse(
@@ -1,11 +1,15 @@
 #include <engine/task/task_processor.hpp>
 
 #include <engine/task/task_processor_config.hpp>
+#include <utils/jemalloc.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/task/task_base.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/utest/utest.hpp>
 
+#include <memory>
+#include <vector>
+
 USERVER_NAMESPACE_BEGIN
 
 UTEST(TaskProcessor, Overload) {
@@ -47,4 +51,30 @@ UTEST(TaskProcessor, Overload) {
   }
 }
 
+UTEST(TaskProcessor, JemallocArena) {
+  engine::TaskProcessorConfig config;
+  config.name = "arena";
+  config.thread_name = "arena-worker";
+  config.worker_threads = 1;
+  config.jemalloc_arena = true;
+  config.jemalloc_dirty_decay = std::chrono::milliseconds{0};
+  engine::TaskProcessor task_processor{
+      std::move(config),
+      engine::current_task::GetTaskProcessor().GetTaskProcessorPools()};
+
+  constexpr std::size_t kAllocationSize = 1 << 20;
+  auto memory = engine::AsyncNoSpan(task_processor, [] {
+                  return std::make_unique<char[]>(kAllocationSize);
+                }).Get();
+  ASSERT_TRUE(memory);
+
+  // Without jemalloc the workers silently use the default allocator
+  const auto arena = task_processor.GetJemallocArena();
+  if (!arena) return;
+
+  utils::jemalloc::ArenaStats stats;
+  ASSERT_FALSE(utils::jemalloc::GetArenaStats(*arena, stats));
+  EXPECT_GE(stats.allocated_bytes, kAllocationSize);
+}
+
 USERVER_NAMESPACE_END
@@ -8,10 +8,13 @@ namespace engine {
 
 namespace {
 constexpr std::size_t kSemaphoreInitialCount = 0;
-}
+// Spinning is done by IdleSpinPolicy::WaitBlocking
+constexpr int kSemaphoreMaxSpins = 0;
+}  // namespace
 
 TaskQueue::TaskQueue(const TaskProcessorConfig& config)
-    : queue_semaphore_(kSemaphoreInitialCount, config.spinning_iterations) {}
+    : queue_semaphore_(kSemaphoreInitialCount, kSemaphoreMaxSpins),
+      idle_policy_(config) {}
 
 void TaskQueue::Push(boost::intrusive_ptr<impl::TaskContext>&& context) {
   UASSERT(context);
@@ -19,6 +22,15 @@ void TaskQueue::Push(boost::intrusive_ptr<impl::TaskContext>&& context) {
   context.detach();
 }
 
+void TaskQueue::PushBulk(utils::span<impl::TaskContext* const> contexts) {
+  for (auto* const context : contexts) {
+    UASSERT(context);
+    intrusive_ptr_add_ref(context);
+  }
+  queue_.enqueue_bulk(contexts.begin(), contexts.size());
+  queue_semaphore_.signal(contexts.size());
+}
+
 boost::intrusive_ptr<impl::TaskContext> TaskQueue::PopBlocking() {
   // Current thread handles only a single TaskProcessor, so it's safe to store
   // a token for the task processor in a thread-local variable.
@@ -41,6 +53,10 @@ std::size_t TaskQueue::GetSizeApproximate() const noexcept {
   return queue_.size_approx();
 }
 
+IdleSpinPolicy::Stats TaskQueue::GetIdleStats() const noexcept {
+  return idle_policy_.GetStats();
+}
+
 void TaskQueue::DoPush(impl::TaskContext* context) {
   // This piece of code is copy-pasted from
   // moodycamel::BlockingConcurrentQueue::enqueue
@@ -53,7 +69,7 @@ impl::TaskContext* TaskQueue::DoPopBlocking(moodycamel::ConsumerToken& token) {
 
   // This piece of code is copy-pasted from
   // moodycamel::BlockingConcurrentQueue::wait_dequeue
-  queue_semaphore_.wait();
+  idle_policy_.WaitBlocking(queue_semaphore_);
   while (!queue_.try_dequeue(token, context)) {
     // Can happen when another consumer steals our item in exchange for another
     // item in a Moodycamel sub-queue that we have already passed.
@@ -4,7 +4,9 @@
 #include <moodycamel/lightweightsemaphore.h>
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
+#include <engine/task/idle_spin_policy.hpp>
 #include <engine/task/task_processor_config.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -20,6 +22,9 @@ class TaskQueue final {
 
   void Push(boost::intrusive_ptr<impl::TaskContext>&& context);
 
+  // Pushes all the contexts at once, taking a reference to each of them
+  void PushBulk(utils::span<impl::TaskContext* const> contexts);
+
   // Returns nullptr as a stop signal
   boost::intrusive_ptr<impl::TaskContext> PopBlocking();
 
@@ -27,6 +32,10 @@ class TaskQueue final {
 
   std::size_t GetSizeApproximate() const noexcept;
 
+  IdleSpinPolicy::Stats GetIdleStats() const noexcept;
+
+  IdleSpinPolicy& GetIdlePolicy() noexcept { return idle_policy_; }
+
  private:
   void DoPush(impl::TaskContext* context);
 
@@ -34,6 +43,7 @@ class TaskQueue final {
 
   moodycamel::ConcurrentQueue<impl::TaskContext*> queue_;
   moodycamel::LightweightSemaphore queue_semaphore_;
+  IdleSpinPolicy idle_policy_;
 };
 
 }  // namespace engine
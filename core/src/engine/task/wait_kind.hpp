@@ -0,0 +1,64 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+// The synchronization primitive a task is sleeping in, used to attribute
+// the off-CPU time of tasks
+enum class WaitKind : std::uint8_t {
+  kOther,
+  kMutex,
+  kSemaphore,
+  kConditionVariable,
+  kEvent,
+  kFuture,
+  kTask,
+  kIo,
+  kSleep,
+};
+
+inline constexpr std::size_t kWaitKindCount = 9;
+
+// Accumulated off-CPU time per WaitKind
+using WaitTimes = std::array<std::chrono::nanoseconds, kWaitKindCount>;
+
+constexpr std::size_t ToIndex(WaitKind kind) noexcept {
+  return static_cast<std::size_t>(kind);
+}
+
+constexpr std::string_view ToString(WaitKind kind) noexcept {
+  switch (kind) {
+    case WaitKind::kOther:
+      return "other";
+    case WaitKind::kMutex:
+      return "mutex";
+    case WaitKind::kSemaphore:
+      return "semaphore";
+    case WaitKind::kConditionVariable:
+      return "condition_variable";
+    case WaitKind::kEvent:
+      return "event";
+    case WaitKind::kFuture:
+      return "future";
+    case WaitKind::kTask:
+      return "task";
+    case WaitKind::kIo:
+      return "io";
+    case WaitKind::kSleep:
+      return "sleep";
+  }
+  return "unknown";
+}
+
+static_assert(ToIndex(WaitKind::kSleep) + 1 == kWaitKindCount);
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,388 @@
+#include <engine/task/work_stealing_task_queue.hpp>
+
+#include <algorithm>
+#include <array>
+
+#include <compiler/relax_cpu.hpp>
+#include <engine/task/task_context.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+#include <utils/numa.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+// Limits the number of tasks in a row taken from the LIFO slot, otherwise
+// two tasks that wake each other up could starve the rest of the run queue.
+constexpr std::size_t kMaxLifoStreak = 3;
+
+// The global queue is checked first once in a while, otherwise tasks from
+// outside of the TaskProcessor could starve while the workers are busy with
+// their own run queues.
+constexpr std::size_t kGlobalQueueCheckInterval = 61;
+
+// How many tasks to take from the global queue at once.
+constexpr std::size_t kGlobalQueueBatch = 8;
+
+}  // namespace
+
+WorkStealingTaskQueue::WorkStealingTaskQueue(const TaskProcessorConfig& config)
+    : consumers_(config.worker_threads, *this),
+      idle_policy_(config) {
+  UINVARIANT(!consumers_.empty(), "Unable to run anything using 0 threads");
+  InitNodes(config);
+  parked_.reserve(consumers_.size());
+}
+
+WorkStealingTaskQueue::~WorkStealingTaskQueue() = default;
+
+void WorkStealingTaskQueue::Push(
+    boost::intrusive_ptr<impl::TaskContext>&& context) {
+  UASSERT(context);
+  auto* const raw_context = context.detach();
+
+  if (auto* const consumer = GetLocalConsumer()) {
+    PushToLocal(*consumer, raw_context);
+  } else {
+    global_queue_.enqueue(raw_context);
+  }
+
+  WakeUpOneIfNeeded();
+}
+
+void WorkStealingTaskQueue::PushBulk(
+    utils::span<impl::TaskContext* const> contexts) {
+  for (auto* const context : contexts) {
+    UASSERT(context);
+    intrusive_ptr_add_ref(context);
+  }
+
+  if (auto* const consumer = GetLocalConsumer()) {
+    for (auto* const context : contexts) PushToLocal(*consumer, context);
+  } else {
+    global_queue_.enqueue_bulk(contexts.begin(), contexts.size());
+  }
+
+  // Does nothing once there are spinning workers to pick up the rest
+  const auto wakeups = std::min(contexts.size(), consumers_.size());
+  for (std::size_t i = 0; i < wakeups; ++i) WakeUpOneIfNeeded();
+}
+
+void WorkStealingTaskQueue::PrepareWorker(std::size_t index) noexcept {
+  UASSERT(index < consumers_.size());
+  auto& consumer = consumers_[index];
+  LocalConsumer() = &consumer;
+  // Nodes are indexed the same way as utils::numa::GetTopology()
+  utils::numa::SetCurrentThreadNode(consumer.node);
+
+  try {
+    utils::numa::SetCurrentThreadAffinity(nodes_[consumer.node].cpus);
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "Failed to pin worker " << index << " to NUMA node "
+                  << consumer.node << ": " << ex;
+  }
+}
+
+boost::intrusive_ptr<impl::TaskContext> WorkStealingTaskQueue::PopBlocking() {
+  auto* const consumer = GetLocalConsumer();
+  UASSERT_MSG(consumer, "PrepareWorker was not called for the current thread");
+
+  return {DoPopBlocking(*consumer), /* add_ref= */ false};
+}
+
+void WorkStealingTaskQueue::StopProcessing() {
+  is_stopped_ = true;
+  WakeUpAll();
+}
+
+std::size_t WorkStealingTaskQueue::GetSizeApproximate() const noexcept {
+  std::size_t size = global_queue_.size_approx();
+  for (const auto& consumer : consumers_) {
+    size += consumer.local_queue.GetSizeApproximate();
+    if (consumer.lifo_slot.load(std::memory_order_relaxed)) ++size;
+  }
+  return size;
+}
+
+IdleSpinPolicy::Stats WorkStealingTaskQueue::GetIdleStats() const noexcept {
+  return idle_policy_.GetStats();
+}
+
+WorkStealingTaskQueue::NodeStats WorkStealingTaskQueue::GetNodeStats(
+    std::size_t node) const noexcept {
+  UASSERT(node < nodes_.size());
+  const auto& state = nodes_[node];
+
+  NodeStats stats;
+  for (const auto* consumer : state.consumers) {
+    stats.queue_size += consumer->local_queue.GetSizeApproximate();
+    if (consumer->lifo_slot.load(std::memory_order_relaxed)) {
+      ++stats.queue_size;
+    }
+  }
+  stats.local_steals = state.local_steals.load(std::memory_order_relaxed);
+  stats.remote_steals = state.remote_steals.load(std::memory_order_relaxed);
+  return stats;
+}
+
+void WorkStealingTaskQueue::InitNodes(const TaskProcessorConfig& config) {
+  static const std::vector<utils::numa::Node> kNoNuma{utils::numa::Node{}};
+  const auto& topology =
+      config.numa_aware ? utils::numa::GetTopology() : kNoNuma;
+
+  const auto workers = consumers_.size();
+  const auto nodes_count = std::min(topology.size(), workers);
+  nodes_ = utils::FixedArray<Node>(nodes_count);
+
+  for (std::size_t i = 0; i < workers; ++i) {
+    // Contiguous ranges of workers per node
+    const auto node = i * nodes_count / workers;
+    consumers_[i].node = node;
+    nodes_[node].consumers.push_back(&consumers_[i]);
+  }
+  for (std::size_t i = 0; i < nodes_count; ++i) {
+    nodes_[i].cpus = topology[i].cpus;
+  }
+
+  if (config.numa_aware) {
+    LOG_INFO() << "Task processor " << config.name << " workers are split "
+               << "between " << nodes_count << " NUMA node(s)";
+  }
+}
+
+WorkStealingTaskQueue::Consumer*&
+WorkStealingTaskQueue::LocalConsumer() noexcept {
+  // Current thread handles only a single TaskProcessor, so it's safe to store
+  // a consumer for the task processor in a thread-local variable.
+  thread_local Consumer* consumer = nullptr;
+  return consumer;
+}
+
+WorkStealingTaskQueue::Consumer*
+WorkStealingTaskQueue::GetLocalConsumer() noexcept {
+  auto* const consumer = LocalConsumer();
+  return (consumer && &consumer->owner == this) ? consumer : nullptr;
+}
+
+void WorkStealingTaskQueue::PushToLocal(Consumer& consumer,
+                                        impl::TaskContext* context) {
+  auto* const displaced =
+      consumer.lifo_slot.exchange(context, std::memory_order_acq_rel);
+  if (!displaced || consumer.local_queue.TryPush(displaced)) return;
+
+  // The run queue is full, move half of it to the global queue at once, so
+  // that the next pushes do not hit the global queue again.
+  std::array<impl::TaskContext*, kLocalQueueCapacity / 2 + 1> batch{};
+  std::size_t batch_size = 0;
+  while (batch_size < kLocalQueueCapacity / 2) {
+    auto* const task = consumer.local_queue.TryPop();
+    if (!task) break;
+    batch[batch_size++] = task;
+  }
+  batch[batch_size++] = displaced;
+  global_queue_.enqueue_bulk(batch.data(), batch_size);
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TryPop(Consumer& consumer) {
+  if (++consumer.pop_count % kGlobalQueueCheckInterval == 0) {
+    if (auto* const context = TryPopGlobal(consumer)) return context;
+  }
+
+  if (auto* const context = TryPopLocal(consumer)) return context;
+  if (auto* const context = TryPopGlobal(consumer)) return context;
+  return TrySteal(consumer);
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TryPopLocal(
+    Consumer& consumer) noexcept {
+  if (consumer.lifo_streak < kMaxLifoStreak) {
+    if (auto* const context =
+            consumer.lifo_slot.exchange(nullptr, std::memory_order_acq_rel)) {
+      ++consumer.lifo_streak;
+      return context;
+    }
+  }
+  consumer.lifo_streak = 0;
+
+  if (auto* const context = consumer.local_queue.TryPop()) return context;
+  return consumer.lifo_slot.exchange(nullptr, std::memory_order_acq_rel);
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TryPopGlobal(Consumer& consumer) {
+  std::array<impl::TaskContext*, kGlobalQueueBatch> batch{};
+  const auto batch_size = global_queue_.try_dequeue_bulk(
+      consumer.global_token, batch.data(), batch.size());
+  if (batch_size == 0) return nullptr;
+
+  for (std::size_t i = 1; i < batch_size; ++i) {
+    if (!consumer.local_queue.TryPush(batch[i])) {
+      global_queue_.enqueue_bulk(batch.data() + i, batch_size - i);
+      break;
+    }
+  }
+  return batch[0];
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TrySteal(Consumer& consumer) {
+  auto& own_node = nodes_[consumer.node];
+  if (auto* const context = TryStealFromNode(consumer, own_node)) {
+    own_node.local_steals.fetch_add(1, std::memory_order_relaxed);
+    return context;
+  }
+
+  // Cross-node stealing is the last resort, the task is likely to touch
+  // the memory of the other node.
+  const auto count = nodes_.size();
+  const auto start = utils::RandRange(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    auto& node = nodes_[(start + i) % count];
+    if (&node == &own_node) continue;
+    if (auto* const context = TryStealFromNode(consumer, node)) {
+      own_node.remote_steals.fetch_add(1, std::memory_order_relaxed);
+      return context;
+    }
+  }
+  return nullptr;
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TryStealFromNode(Consumer& consumer,
+                                                           Node& node) {
+  const auto count = node.consumers.size();
+  const auto start = utils::RandRange(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    auto& victim = *node.consumers[(start + i) % count];
+    if (&victim == &consumer) continue;
+    if (auto* const context = TryStealFrom(consumer, victim)) return context;
+  }
+  return nullptr;
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TryStealFrom(Consumer& consumer,
+                                                       Consumer& victim) {
+  auto* const context = victim.local_queue.TryPop();
+  if (!context) {
+    // The victim is busy with some long task, don't let the task in its LIFO
+    // slot wait for it.
+    return victim.lifo_slot.exchange(nullptr, std::memory_order_acq_rel);
+  }
+
+  // Take up to a half of the victim's run queue, so that the victim is not
+  // robbed on every task.
+  const auto steal_count = victim.local_queue.GetSizeApproximate() / 2;
+  for (std::size_t i = 0; i < steal_count; ++i) {
+    auto* const task = victim.local_queue.TryPop();
+    if (!task) break;
+    if (!consumer.local_queue.TryPush(task)) {
+      global_queue_.enqueue(task);
+      break;
+    }
+  }
+  return context;
+}
+
+impl::TaskContext* WorkStealingTaskQueue::DoPopBlocking(Consumer& consumer) {
+  compiler::RelaxCpu relax;
+
+  while (true) {
+    if (auto* const context = TryPop(consumer)) return context;
+
+    spinning_count_->fetch_add(1);
+    impl::TaskContext* context = nullptr;
+    const auto budget = idle_policy_.GetSpinBudget();
+    std::size_t iterations = 0;
+    while (iterations < budget && !context) {
+      ++iterations;
+      relax();
+      // Cheap checks only, the full scan is done before parking.
+      context = TryPopGlobal(consumer);
+      const auto& neighbours = nodes_[consumer.node].consumers;
+      if (!context && neighbours.size() > 1) {
+        auto& victim = *neighbours[utils::RandRange(neighbours.size())];
+        if (&victim != &consumer) context = TryStealFrom(consumer, victim);
+        if (context) {
+          nodes_[consumer.node].local_steals.fetch_add(
+              1, std::memory_order_relaxed);
+        }
+      }
+    }
+    const auto spinning_left = spinning_count_->fetch_sub(1) - 1;
+    idle_policy_.AccountSpin(iterations, context != nullptr);
+    if (context) {
+      // We were the last one searching for work, and there is more work to
+      // do. Wake up someone to take over.
+      if (spinning_left == 0 &&
+          consumer.local_queue.GetSizeApproximate() != 0) {
+        WakeUpOneIfNeeded();
+      }
+      return context;
+    }
+
+    {
+      std::lock_guard lock(parked_mutex_);
+      parked_.push_back(&consumer);
+      parked_count_->fetch_add(1);
+    }
+
+    // Pairs with the fence in WakeUpOneIfNeeded: either the pusher sees us
+    // parked, or we see the pushed task.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    const bool is_stopped = is_stopped_.load();
+    context = TryPop(consumer);
+    if (context || is_stopped) {
+      if (!Unpark(consumer)) {
+        // Someone has already removed us from the parked list and is going to
+        // signal us, consume a wakeup to keep the semaphore balanced.
+        consumer.wakeup.wait();
+      }
+      return context;
+    }
+
+    idle_policy_.Park(consumer.wakeup);
+  }
+}
+
+void WorkStealingTaskQueue::WakeUpOneIfNeeded() noexcept {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  // A spinning consumer is going to find the task
+  if (spinning_count_->load() != 0) return;
+  if (parked_count_->load() == 0) return;
+
+  Consumer* consumer = nullptr;
+  {
+    std::lock_guard lock(parked_mutex_);
+    if (parked_.empty()) return;
+    consumer = parked_.back();
+    parked_.pop_back();
+    parked_count_->fetch_sub(1);
+  }
+  consumer->wakeup.signal();
+}
+
+void WorkStealingTaskQueue::WakeUpAll() noexcept {
+  std::vector<Consumer*> parked;
+  {
+    std::lock_guard lock(parked_mutex_);
+    parked.swap(parked_);
+    parked_count_->store(0);
+  }
+  for (auto* const consumer : parked) consumer->wakeup.signal();
+}
+
+bool WorkStealingTaskQueue::Unpark(Consumer& consumer) noexcept {
+  std::lock_guard lock(parked_mutex_);
+  const auto it = std::find(parked_.begin(), parked_.end(), &consumer);
+  if (it == parked_.end()) return false;
+  parked_.erase(it);
+  parked_count_->fetch_sub(1);
+  return true;
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
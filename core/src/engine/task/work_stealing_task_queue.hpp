@@ -0,0 +1,155 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <moodycamel/concurrentqueue.h>
+#include <moodycamel/lightweightsemaphore.h>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+
+#include <concurrent/impl/bounded_spmc_queue.hpp>
+#include <concurrent/impl/interference_shield.hpp>
+#include <engine/task/idle_spin_policy.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace impl {
+class TaskContext;
+}  // namespace impl
+
+// A task queue with a run queue per worker.
+//
+// Tasks scheduled from a worker of the owning TaskProcessor go to the run
+// queue of that worker, the most recently scheduled task is kept in a LIFO
+// slot and is usually the next one to run. Tasks scheduled from other threads
+// go to the global queue. Idle workers steal tasks from the other workers.
+//
+// With TaskProcessorConfig::numa_aware the workers are split between NUMA
+// nodes, each worker is pinned to the CPUs of its node and steals from the
+// workers of its own node first. coro::Pool keeps the coroutines released on
+// a node for the workers of that node.
+class WorkStealingTaskQueue final {
+ public:
+  struct NodeStats final {
+    std::size_t queue_size{0};
+    std::uint64_t local_steals{0};
+    std::uint64_t remote_steals{0};
+  };
+
+  explicit WorkStealingTaskQueue(const TaskProcessorConfig& config);
+  ~WorkStealingTaskQueue();
+
+  void Push(boost::intrusive_ptr<impl::TaskContext>&& context);
+
+  // Pushes all the contexts at once, taking a reference to each of them
+  void PushBulk(utils::span<impl::TaskContext* const> contexts);
+
+  // Binds the current thread to the worker with the specified index and to
+  // the CPUs of its NUMA node. Must be called on each worker thread before
+  // PopBlocking.
+  void PrepareWorker(std::size_t index) noexcept;
+
+  // Returns nullptr as a stop signal
+  boost::intrusive_ptr<impl::TaskContext> PopBlocking();
+
+  void StopProcessing();
+
+  std::size_t GetSizeApproximate() const noexcept;
+
+  IdleSpinPolicy::Stats GetIdleStats() const noexcept;
+
+  IdleSpinPolicy& GetIdlePolicy() noexcept { return idle_policy_; }
+
+  // The number of NUMA nodes the workers are split between, 1 if the queue is
+  // not NUMA-aware.
+  std::size_t GetNodeCount() const noexcept { return nodes_.size(); }
+
+  NodeStats GetNodeStats(std::size_t node) const noexcept;
+
+ private:
+  // Run queue size of a single worker, tasks that do not fit go to the global
+  // queue.
+  static constexpr std::size_t kLocalQueueCapacity = 256;
+
+  struct alignas(concurrent::impl::kDestructiveInterferenceSize) Consumer final {
+    explicit Consumer(WorkStealingTaskQueue& owner)
+        : owner(owner), global_token(owner.global_queue_) {}
+
+    WorkStealingTaskQueue& owner;
+    std::atomic<impl::TaskContext*> lifo_slot{nullptr};
+    concurrent::impl::BoundedSpmcQueue<impl::TaskContext*, kLocalQueueCapacity>
+        local_queue;
+    moodycamel::LightweightSemaphore wakeup{0, 0};
+
+    std::size_t node{0};
+
+    // Only accessed by the owning worker thread
+    moodycamel::ConsumerToken global_token;
+    std::size_t lifo_streak{0};
+    std::size_t pop_count{0};
+  };
+
+  struct alignas(concurrent::impl::kDestructiveInterferenceSize) Node final {
+    std::vector<std::size_t> cpus;
+    std::vector<Consumer*> consumers;
+    // Steals by the workers of this node from the same and from other nodes
+    std::atomic<std::uint64_t> local_steals{0};
+    std::atomic<std::uint64_t> remote_steals{0};
+  };
+
+  void InitNodes(const TaskProcessorConfig& config);
+
+  static Consumer*& LocalConsumer() noexcept;
+
+  Consumer* GetLocalConsumer() noexcept;
+
+  void PushToLocal(Consumer& consumer, impl::TaskContext* context);
+
+  impl::TaskContext* TryPop(Consumer& consumer);
+
+  impl::TaskContext* TryPopLocal(Consumer& consumer) noexcept;
+
+  impl::TaskContext* TryPopGlobal(Consumer& consumer);
+
+  impl::TaskContext* TrySteal(Consumer& consumer);
+
+  impl::TaskContext* TryStealFromNode(Consumer& consumer, Node& node);
+
+  impl::TaskContext* TryStealFrom(Consumer& consumer, Consumer& victim);
+
+  impl::TaskContext* DoPopBlocking(Consumer& consumer);
+
+  void WakeUpOneIfNeeded() noexcept;
+
+  void WakeUpAll() noexcept;
+
+  bool Unpark(Consumer& consumer) noexcept;
+
+  moodycamel::ConcurrentQueue<impl::TaskContext*> global_queue_;
+  utils::FixedArray<Consumer> consumers_;
+  utils::FixedArray<Node> nodes_;
+
+  concurrent::impl::InterferenceShield<std::atomic<std::size_t>>
+      spinning_count_{0};
+  concurrent::impl::InterferenceShield<std::atomic<std::size_t>>
+      parked_count_{0};
+  std::atomic<bool> is_stopped_{false};
+
+  // Parked consumers, only accessed on the slow path
+  std::mutex parked_mutex_;
+  std::vector<Consumer*> parked_;
+
+  IdleSpinPolicy idle_policy_;
+};
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,116 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+
+#include <engine/impl/standalone.hpp>
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/function_ref.hpp>
+#include <utils/impl/parallelize_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Compares the global task queue with the work-stealing one, see the
+// `task-queue` option of the task processor config.
+template <engine::TaskQueueType TaskQueue>
+engine::TaskProcessorConfig MakeConfig(std::size_t worker_threads) {
+  engine::TaskProcessorConfig config;
+  config.name = "benchmark";
+  config.thread_name = "bench-worker";
+  config.worker_threads = worker_threads;
+  config.task_queue = TaskQueue;
+  return config;
+}
+
+template <engine::TaskQueueType TaskQueue>
+void RunWithTaskQueue(std::size_t worker_threads,
+                      utils::function_ref<void()> payload) {
+  engine::impl::TaskProcessorHolder task_processor{
+      std::make_unique<engine::TaskProcessor>(
+          MakeConfig<TaskQueue>(worker_threads),
+          engine::impl::MakeTaskProcessorPools({}))};
+  engine::impl::RunOnTaskProcessorSync(*task_processor, payload);
+}
+
+constexpr auto kGlobal = engine::TaskQueueType::kGlobalTaskQueue;
+constexpr auto kWorkStealing = engine::TaskQueueType::kWorkStealingTaskQueue;
+
+}  // namespace
+
+// Spawns tasks from within the task processor, the most common pattern of
+// handlers doing parallel requests.
+template <engine::TaskQueueType TaskQueue>
+void task_queue_fan_out(benchmark::State& state) {
+  RunWithTaskQueue<TaskQueue>(state.range(0), [&] {
+    constexpr std::size_t kFanOut = 16;
+    for ([[maybe_unused]] auto _ : state) {
+      auto tasks = utils::GenerateFixedArray(kFanOut, [](std::size_t) {
+        return engine::AsyncNoSpan([] {});
+      });
+      for (auto& task : tasks) task.Wait();
+    }
+    state.SetItemsProcessed(state.iterations() * kFanOut);
+  });
+}
+BENCHMARK_TEMPLATE(task_queue_fan_out, kGlobal)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+BENCHMARK_TEMPLATE(task_queue_fan_out, kWorkStealing)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+
+// Every worker constantly reschedules its tasks.
+template <engine::TaskQueueType TaskQueue>
+void task_queue_yield(benchmark::State& state) {
+  RunWithTaskQueue<TaskQueue>(state.range(0), [&] {
+    std::atomic<std::uint64_t> total_yields{0};
+
+    RunParallelBenchmark(state, [&](auto& range) {
+      std::uint64_t yields_performed = 0;
+      for ([[maybe_unused]] auto _ : range) {
+        engine::Yield();
+        ++yields_performed;
+      }
+      total_yields += yields_performed;
+    });
+
+    state.counters["yields"] =
+        benchmark::Counter(total_yields, benchmark::Counter::kIsRate);
+  });
+}
+BENCHMARK_TEMPLATE(task_queue_yield, kGlobal)->RangeMultiplier(2)->Range(1, 32);
+BENCHMARK_TEMPLATE(task_queue_yield, kWorkStealing)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+
+// Tasks are spawned from a thread outside of the task processor, and only go
+// through the global queue.
+template <engine::TaskQueueType TaskQueue>
+void task_queue_spawn_from_outside(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    engine::TaskProcessor task_processor{
+        MakeConfig<TaskQueue>(state.range(0)),
+        engine::current_task::GetTaskProcessor().GetTaskProcessorPools()};
+
+    for ([[maybe_unused]] auto _ : state) {
+      engine::AsyncNoSpan(task_processor, [] {}).Wait();
+    }
+  });
+}
+BENCHMARK_TEMPLATE(task_queue_spawn_from_outside, kGlobal)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+BENCHMARK_TEMPLATE(task_queue_spawn_from_outside, kWorkStealing)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+
+USERVER_NAMESPACE_END
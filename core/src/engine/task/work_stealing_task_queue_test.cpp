@@ -0,0 +1,189 @@
+#include <engine/task/work_stealing_task_queue.hpp>
+
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kWorkers = 4;
+
+engine::TaskProcessorConfig MakeWorkStealingConfig() {
+  engine::TaskProcessorConfig config;
+  config.name = "work-stealing";
+  config.thread_name = "ws-worker";
+  config.worker_threads = kWorkers;
+  config.task_queue = engine::TaskQueueType::kWorkStealingTaskQueue;
+  return config;
+}
+
+class WorkStealingTaskProcessor final {
+ public:
+  WorkStealingTaskProcessor()
+      : task_processor_(
+            MakeWorkStealingConfig(),
+            engine::current_task::GetTaskProcessor().GetTaskProcessorPools()) {}
+
+  engine::TaskProcessor& Get() { return task_processor_; }
+
+ private:
+  engine::TaskProcessor task_processor_;
+};
+
+}  // namespace
+
+UTEST(WorkStealingTaskQueue, TasksFromOutside) {
+  WorkStealingTaskProcessor tp;
+  constexpr std::size_t kTasks = 1000;
+
+  std::atomic<std::size_t> counter{0};
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(kTasks);
+  for (std::size_t i = 0; i < kTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan(tp.Get(), [&counter] { ++counter; }));
+  }
+  engine::WaitAllChecked(tasks);
+
+  EXPECT_EQ(counter, kTasks);
+  EXPECT_EQ(tp.Get().GetTaskQueueSize(), 0);
+}
+
+UTEST(WorkStealingTaskQueue, TasksFromInside) {
+  WorkStealingTaskProcessor tp;
+  constexpr std::size_t kTasks = 10'000;
+
+  const auto counter =
+      engine::AsyncNoSpan(tp.Get(), [] {
+        std::atomic<std::size_t> counter{0};
+        std::vector<engine::TaskWithResult<void>> tasks;
+        tasks.reserve(kTasks);
+        for (std::size_t i = 0; i < kTasks; ++i) {
+          tasks.push_back(engine::AsyncNoSpan([&counter] { ++counter; }));
+        }
+        engine::WaitAllChecked(tasks);
+        return counter.load();
+      }).Get();
+
+  EXPECT_EQ(counter, kTasks);
+}
+
+UTEST(WorkStealingTaskQueue, IdleWorkersSteal) {
+  WorkStealingTaskProcessor tp;
+
+  const auto thread_ids =
+      engine::AsyncNoSpan(tp.Get(), [] {
+        std::vector<engine::TaskWithResult<std::thread::id>> tasks;
+        tasks.reserve(kWorkers * 4);
+        // All the tasks land in the run queue of the current worker, and block
+        // their thread. The rest of the workers have to steal them.
+        for (std::size_t i = 0; i < kWorkers * 4; ++i) {
+          tasks.push_back(engine::AsyncNoSpan([] {
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+            return std::this_thread::get_id();
+          }));
+        }
+
+        std::set<std::thread::id> result;
+        for (auto& task : tasks) result.insert(task.Get());
+        return result;
+      }).Get();
+
+  EXPECT_GT(thread_ids.size(), 1);
+}
+
+UTEST(WorkStealingTaskQueue, YieldingTasksDoNotStarve) {
+  WorkStealingTaskProcessor tp;
+  constexpr std::size_t kTasks = kWorkers * 8;
+  constexpr std::size_t kYields = 1000;
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(kTasks);
+  for (std::size_t i = 0; i < kTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan(tp.Get(), [] {
+      for (std::size_t j = 0; j < kYields; ++j) engine::Yield();
+    }));
+  }
+  engine::WaitAllChecked(tasks);
+}
+
+UTEST(WorkStealingTaskQueue, PingPong) {
+  WorkStealingTaskProcessor tp;
+  constexpr std::size_t kIterations = 10'000;
+
+  engine::AsyncNoSpan(tp.Get(), [] {
+    for (std::size_t i = 0; i < kIterations; ++i) {
+      engine::AsyncNoSpan([] {}).Get();
+    }
+  }).Get();
+}
+
+UTEST(WorkStealingTaskQueue, SleepingWorkersWakeUp) {
+  WorkStealingTaskProcessor tp;
+
+  for (std::size_t i = 0; i < 10; ++i) {
+    // Let the workers park
+    engine::SleepFor(std::chrono::milliseconds{5});
+    engine::AsyncNoSpan(tp.Get(), [] {
+      engine::SleepFor(std::chrono::milliseconds{1});
+    }).Get();
+  }
+}
+
+UTEST(WorkStealingTaskQueue, NodeStats) {
+  WorkStealingTaskProcessor tp;
+
+  const auto stats = tp.Get().CollectNodeStats();
+  ASSERT_EQ(stats.size(), 1);
+  EXPECT_EQ(stats[0].remote_steals, 0);
+}
+
+UTEST(WorkStealingTaskQueue, NumaAware) {
+  auto config = MakeWorkStealingConfig();
+  config.numa_aware = true;
+  engine::TaskProcessor tp{
+      std::move(config),
+      engine::current_task::GetTaskProcessor().GetTaskProcessorPools()};
+
+  const auto nodes = tp.CollectNodeStats().size();
+  EXPECT_GE(nodes, 1);
+  EXPECT_LE(nodes, kWorkers);
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (std::size_t i = 0; i < 100; ++i) {
+    tasks.push_back(engine::AsyncNoSpan(tp, [] {
+      engine::AsyncNoSpan([] {}).Get();
+    }));
+  }
+  engine::WaitAllChecked(tasks);
+}
+
+UTEST(WorkStealingTaskQueue, AdaptiveSpinning) {
+  auto config = MakeWorkStealingConfig();
+  config.spinning_policy = engine::SpinningPolicy::kAdaptive;
+  engine::TaskProcessor tp{
+      std::move(config),
+      engine::current_task::GetTaskProcessor().GetTaskProcessorPools()};
+
+  for (std::size_t i = 0; i < 10; ++i) {
+    // Let the workers park
+    engine::SleepFor(std::chrono::milliseconds{5});
+    engine::AsyncNoSpan(tp, [] {}).Get();
+  }
+
+  const auto stats = tp.GetIdleStats();
+  EXPECT_GT(stats.parks.value, 0);
+  EXPECT_LT(stats.spin_budget, 1000);
+}
+
+USERVER_NAMESPACE_END
@@ -89,9 +89,15 @@ class TaskProcessorsLoadMonitor::Impl final {
     statistics_holder_ = storage.RegisterWriter(
         "engine.task-processors-load-percent",
         [this](utils::statistics::Writer& writer) { ExtendWriter(writer); });
+    numa_statistics_holder_ = storage.RegisterWriter(
+        "engine.task-processors-numa-nodes",
+        [this](utils::statistics::Writer& writer) {
+          ExtendNumaWriter(writer);
+        });
   }
 
   ~Impl() {
+    numa_statistics_holder_.Unregister();
     statistics_holder_.Unregister();
     collector_.Stop();
   }
@@ -133,9 +139,29 @@ class TaskProcessorsLoadMonitor::Impl final {
     }
   }
 
+  void ExtendNumaWriter(utils::statistics::Writer& writer) const {
+    for (const auto& tp_meta : task_processors_) {
+      const utils::statistics::LabelView task_processor_label{
+          "task_processor", tp_meta.task_processor.Name()};
+
+      for (const auto& [index, stats] :
+           utils::enumerate(tp_meta.task_processor.CollectNodeStats())) {
+        const auto node = std::to_string(index);
+        const std::initializer_list<utils::statistics::LabelView> labels{
+            task_processor_label, {"numa_node", node}};
+
+        writer["queue-size"].ValueWithLabels(stats.queue_size, labels);
+        writer["steals"]["local"].ValueWithLabels(stats.local_steals, labels);
+        writer["steals"]["remote"].ValueWithLabels(stats.remote_steals,
+                                                   labels);
+      }
+    }
+  }
+
   std::vector<TaskProcessorMeta> task_processors_;
 
   utils::statistics::Entry statistics_holder_;
+  utils::statistics::Entry numa_statistics_holder_;
   utils::PeriodicTask collector_;
 };
 
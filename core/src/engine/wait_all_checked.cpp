@@ -30,7 +30,7 @@ FutureStatus DoWaitAllChecked(utils::span<ContextAccessor*> targets,
     }
     if (all_completed) break;
 
-    auto sleep_status = current.Sleep(wait_strategy, deadline);
+    auto sleep_status = current.Sleep(wait_strategy, deadline, WaitKind::kTask);
 
     for (const auto& target : targets) {
       if (target) target->AfterWait();
@@ -26,7 +26,7 @@ std::optional<std::size_t> DoWaitAny(utils::span<ContextAccessor*> targets,
 
   auto& current = current_task::GetCurrentTaskContext();
   WaitAnyWaitStrategy wait_strategy{targets, current};
-  current.Sleep(wait_strategy, deadline);
+  current.Sleep(wait_strategy, deadline, WaitKind::kTask);
 
   for (const auto& target : targets) {
     if (target) target->AfterWait();
@@ -0,0 +1,201 @@
+#include <userver/fs/file_descriptor.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <system_error>
+
+#include <fmt/format.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <engine/io/uring_reactor.hpp>
+#include <fs/blocking/open_flags.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace fs {
+
+namespace {
+
+using engine::io::impl::UringReactor;
+
+// The length of an io_uring operation is 32-bit
+constexpr std::size_t kMaxUringChunkSize = std::size_t{1} << 30;
+
+[[noreturn]] void ThrowSystemError(int error_code, const std::string& what) {
+  throw std::system_error(std::make_error_code(std::errc{error_code}), what);
+}
+
+std::size_t PerformOnUring(UringReactor& reactor,
+                           const UringReactor::Request& request,
+                           const char* what) {
+  engine::TaskCancellationBlocker block_cancel;
+  const auto result = reactor.Perform(request, {});
+  if (result.value < 0) ThrowSystemError(-result.value, what);
+  return static_cast<std::size_t>(result.value);
+}
+
+template <typename Func>
+auto RunBlocking(engine::TaskProcessor& fs_task_processor, Func func) {
+  engine::TaskCancellationBlocker block_cancel;
+  return engine::AsyncNoSpan(fs_task_processor, std::move(func)).Get();
+}
+
+std::size_t BlockingReadAt(int fd, char* buffer, std::size_t max_size,
+                           std::uint64_t offset) {
+  std::size_t total = 0;
+  while (total < max_size) {
+    const ::ssize_t s =
+        ::pread(fd, buffer + total, max_size - total, offset + total);
+    if (s < 0) {
+      if (errno == EAGAIN || errno == EINTR) continue;
+      ThrowSystemError(errno, "calling ::pread");
+    }
+    if (s == 0) break;
+    total += s;
+  }
+  return total;
+}
+
+void BlockingWriteAt(int fd, std::string_view contents, std::uint64_t offset) {
+  std::size_t total = 0;
+  while (total < contents.size()) {
+    const ::ssize_t s = ::pwrite(fd, contents.data() + total,
+                                 contents.size() - total, offset + total);
+    if (s < 0) {
+      if (errno == EAGAIN || errno == EINTR) continue;
+      ThrowSystemError(errno, "calling ::pwrite");
+    }
+    total += s;
+  }
+}
+
+}  // namespace
+
+FileDescriptor::FileDescriptor(engine::TaskProcessor& fs_task_processor,
+                               blocking::FileDescriptor fd)
+    : fs_task_processor_(fs_task_processor), fd_(std::move(fd)) {}
+
+FileDescriptor FileDescriptor::Open(engine::TaskProcessor& fs_task_processor,
+                                    const std::string& path,
+                                    blocking::OpenMode flags,
+                                    boost::filesystem::perms perms) {
+  UASSERT(!path.empty());
+  auto* const reactor = UringReactor::GetForCurrentThread();
+  if (!reactor) {
+    return {fs_task_processor, RunBlocking(fs_task_processor, [&] {
+              return blocking::FileDescriptor::Open(path, flags, perms);
+            })};
+  }
+
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  const UringReactor::Request request{
+      UringReactor::OpCode::kOpenAt, AT_FDCWD, const_cast<char*>(path.c_str()),
+      static_cast<std::size_t>(perms),
+      static_cast<unsigned>(blocking::impl::ToNative(flags))};
+  const auto fd = PerformOnUring(
+      *reactor, request, fmt::format("opening file '{}'", path).c_str());
+  return {fs_task_processor,
+          blocking::FileDescriptor::AdoptFd(static_cast<int>(fd))};
+}
+
+FileDescriptor::~FileDescriptor() {
+  if (IsOpen()) {
+    try {
+      std::move(*this).Close();
+    } catch (const std::exception& e) {
+      LOG_ERROR() << e;
+    }
+  }
+}
+
+bool FileDescriptor::IsOpen() const { return fd_.IsOpen(); }
+
+void FileDescriptor::Close() && {
+  UASSERT(IsOpen());
+  auto* const reactor = UringReactor::GetForCurrentThread();
+  if (!reactor) {
+    RunBlocking(*fs_task_processor_, [this] { std::move(fd_).Close(); });
+    return;
+  }
+
+  const auto fd = std::move(fd_).Release();
+  PerformOnUring(*reactor, {UringReactor::OpCode::kClose, fd},
+                 "closing file");
+}
+
+int FileDescriptor::GetNative() const { return fd_.GetNative(); }
+
+std::size_t FileDescriptor::ReadAt(char* buffer, std::size_t max_size,
+                                   std::uint64_t offset) {
+  UASSERT(IsOpen());
+  const auto fd = fd_.GetNative();
+  auto* const reactor = UringReactor::GetForCurrentThread();
+  if (!reactor) {
+    return RunBlocking(*fs_task_processor_, [&] {
+      return BlockingReadAt(fd, buffer, max_size, offset);
+    });
+  }
+
+  std::size_t total = 0;
+  while (total < max_size) {
+    const auto len = std::min(max_size - total, kMaxUringChunkSize);
+    const auto read = PerformOnUring(
+        *reactor,
+        {UringReactor::OpCode::kRead, fd, buffer + total, len, 0,
+         offset + total},
+        "reading file");
+    if (read == 0) break;
+    total += read;
+  }
+  return total;
+}
+
+void FileDescriptor::WriteAt(std::string_view contents, std::uint64_t offset) {
+  UASSERT(IsOpen());
+  const auto fd = fd_.GetNative();
+  auto* const reactor = UringReactor::GetForCurrentThread();
+  if (!reactor) {
+    RunBlocking(*fs_task_processor_,
+                [&] { BlockingWriteAt(fd, contents, offset); });
+    return;
+  }
+
+  std::size_t total = 0;
+  while (total < contents.size()) {
+    const auto len = std::min(contents.size() - total, kMaxUringChunkSize);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    auto* const data = const_cast<char*>(contents.data() + total);
+    total += PerformOnUring(
+        *reactor,
+        {UringReactor::OpCode::kWrite, fd, data, len, 0, offset + total},
+        "writing file");
+  }
+}
+
+void FileDescriptor::FSync() {
+  UASSERT(IsOpen());
+  auto* const reactor = UringReactor::GetForCurrentThread();
+  if (!reactor) {
+    RunBlocking(*fs_task_processor_, [this] { fd_.FSync(); });
+    return;
+  }
+
+  PerformOnUring(*reactor, {UringReactor::OpCode::kFsync, fd_.GetNative()},
+                 "syncing file");
+}
+
+std::size_t FileDescriptor::GetSize() const {
+  // fstat of an open file does not wait for the disk
+  return fd_.GetSize();
+}
+
+}  // namespace fs
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,90 @@
+#include <userver/utest/utest.hpp>
+
+#include <string>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/temp_file.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/fs/file_descriptor.hpp>
+#include <userver/fs/read.hpp>
+#include <userver/fs/write.hpp>
+
+#include <engine/io/uring_reactor.hpp>
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using fs::blocking::OpenFlag;
+
+engine::TaskProcessorConfig MakeUringConfig() {
+  engine::TaskProcessorConfig config;
+  config.name = "io-uring";
+  config.thread_name = "uring-worker";
+  config.worker_threads = 1;
+  config.io_backend = engine::IoBackend::kIoUring;
+  return config;
+}
+
+void CheckPositionedIo(engine::TaskProcessor& fs_task_processor) {
+  const auto temp_file = fs::blocking::TempFile::Create();
+  const auto& path = temp_file.GetPath();
+
+  {
+    auto file = fs::FileDescriptor::Open(fs_task_processor, path,
+                                         {OpenFlag::kWrite, OpenFlag::kRead});
+    file.WriteAt("world", 6);
+    file.WriteAt("hello ", 0);
+    file.FSync();
+    EXPECT_EQ(file.GetSize(), 11);
+
+    std::string buffer(16, '\0');
+    EXPECT_EQ(file.ReadAt(buffer.data(), 5, 6), 5);
+    EXPECT_EQ(buffer.substr(0, 5), "world");
+    // Stops at the end of file
+    EXPECT_EQ(file.ReadAt(buffer.data(), buffer.size(), 3), 8);
+    EXPECT_EQ(buffer.substr(0, 8), "lo world");
+
+    std::move(file).Close();
+  }
+  EXPECT_EQ(fs::blocking::ReadFileContents(path), "hello world");
+
+  const std::string big(100'000, 'x');
+  fs::RewriteFileContents(fs_task_processor, path, big);
+  EXPECT_EQ(fs::ReadFileContents(fs_task_processor, path), big);
+
+  fs::RewriteFileContents(fs_task_processor, path, "");
+  EXPECT_EQ(fs::ReadFileContents(fs_task_processor, path), "");
+
+  UEXPECT_THROW(fs::FileDescriptor::Open(fs_task_processor, path + "-missing",
+                                         OpenFlag::kRead),
+                std::runtime_error);
+}
+
+}  // namespace
+
+UTEST(FileDescriptor, Blocking) {
+  CheckPositionedIo(engine::current_task::GetTaskProcessor());
+}
+
+UTEST(FileDescriptor, Uring) {
+  if (!engine::io::impl::UringReactor::IsSupported()) {
+    GTEST_SKIP() << "io_uring is not supported";
+  }
+
+  engine::TaskProcessor uring_task_processor(
+      MakeUringConfig(),
+      engine::current_task::GetTaskProcessor().GetTaskProcessorPools());
+  auto& fs_task_processor = engine::current_task::GetTaskProcessor();
+
+  engine::AsyncNoSpan(uring_task_processor, [&fs_task_processor] {
+    ASSERT_NE(engine::io::impl::UringReactor::GetForCurrentThread(), nullptr);
+    CheckPositionedIo(fs_task_processor);
+  }).Get();
+}
+
+USERVER_NAMESPACE_END
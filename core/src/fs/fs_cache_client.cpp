@@ -42,8 +42,12 @@ bool IsFilepathHidden(const std::string& path) {
 
 FsCacheClient::FsCacheClient(std::string_view dir,
                              std::chrono::milliseconds update_period,
-                             engine::TaskProcessor& tp)
-    : dir_(GetNormalizeDirectory(dir)), update_period_(update_period), tp_(tp) {
+                             engine::TaskProcessor& tp,
+                             utils::Flags<SettingsReadFile> flags)
+    : dir_(GetNormalizeDirectory(dir)),
+      update_period_(update_period),
+      tp_(tp),
+      flags_(flags) {
   UpdateCache();
 
   if (update_period_ == std::chrono::milliseconds(0)) {
@@ -61,8 +65,7 @@ FsCacheClient::FsCacheClient(std::string_view dir,
 }
 
 void FsCacheClient::UpdateCache() {
-  auto map = fs::ReadRecursiveFilesInfoWithData(
-      tp_, dir_, {fs::SettingsReadFile::kSkipHidden});
+  auto map = fs::ReadRecursiveFilesInfoWithData(tp_, dir_, flags_);
   data_.Assign(std::move(map));
 }
 
@@ -110,11 +113,11 @@ void FsCacheClient::HandleDeleteDirectory(
 }
 
 void FsCacheClient::HandleCreate(const std::string& path) {
-  if (IsFilepathHidden(path)) return;
+  if ((flags_ & SettingsReadFile::kSkipHidden) && IsFilepathHidden(path)) {
+    return;
+  }
 
-  FileInfoWithData info{};
-  info.extension = boost::filesystem::path(path).extension().string();
-  info.data = ReadFileContents(tp_, path);
+  auto info = ReadFileInfoWithData(tp_, path, flags_);
   data_.InsertOrAssign(
       GetLexicallyRelative(path, dir_),
       std::make_shared<const FileInfoWithData>(std::move(info)));
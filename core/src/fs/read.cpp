@@ -1,10 +1,21 @@
 #include <userver/fs/read.hpp>
 
+#include <sys/mman.h>
+
+#include <cerrno>
+#include <stdexcept>
+
 #include <boost/filesystem.hpp>
+#include <fmt/format.h>
 
 #include <userver/engine/async.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
 #include <userver/fs/blocking/read.hpp>
+#include <userver/fs/file_descriptor.hpp>
 #include <userver/utils/async.hpp>
+#include <userver/utils/strerror.hpp>
+
+#include <engine/io/uring_reactor.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -18,6 +29,46 @@ bool IsHiddenFile(const boost::filesystem::path& path) {
   return name != ".." && name != "." && name[0] == '.';
 }
 
+void MapFile(const std::string& path, FileInfoWithData& info) {
+  const auto file =
+      fs::blocking::FileDescriptor::Open(path, fs::blocking::OpenFlag::kRead);
+  const auto size = file.GetSize();
+  // mmap fails on empty files
+  if (size == 0) return;
+
+  void* const data =
+      ::mmap(nullptr, size, PROT_READ, MAP_SHARED, file.GetNative(), 0);
+  if (data == MAP_FAILED) {
+    throw std::runtime_error(fmt::format("Failed to map file '{}': {}", path,
+                                         utils::strerror(errno)));
+  }
+  info.mapping = std::shared_ptr<const char>(
+      static_cast<const char*>(data), [size](const char* ptr) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        ::munmap(const_cast<char*>(ptr), size);
+      });
+  info.mapping_size = size;
+}
+
+FileInfoWithData ReadFileInfoWithDataBlocking(
+    const std::string& path, utils::Flags<SettingsReadFile> flags) {
+  const boost::filesystem::path fs_path{path};
+
+  FileInfoWithData info{};
+  info.extension = fs_path.extension().string();
+  // Taken before the contents, so a concurrent change is never hidden
+  // behind a fresh ETag
+  info.etag = fmt::format(R"("{:x}-{:x}")",
+                          boost::filesystem::last_write_time(fs_path),
+                          boost::filesystem::file_size(fs_path));
+  if (flags & SettingsReadFile::kMmap) {
+    MapFile(path, info);
+  } else {
+    info.data = fs::blocking::ReadFileContents(path);
+  }
+  return info;
+}
+
 }  // namespace
 
 std::string GetLexicallyRelative(std::string_view path, std::string_view dir) {
@@ -27,10 +78,35 @@ std::string GetLexicallyRelative(std::string_view path, std::string_view dir) {
   return std::string{rel};
 }
 
+FileInfoWithData ReadFileInfoWithData(engine::TaskProcessor& async_tp,
+                                      const std::string& path,
+                                      utils::Flags<SettingsReadFile> flags) {
+  return engine::AsyncNoSpan(async_tp, &ReadFileInfoWithDataBlocking, path,
+                             flags)
+      .Get();
+}
+
 std::string ReadFileContents(engine::TaskProcessor& async_tp,
                              const std::string& path) {
-  return engine::AsyncNoSpan(async_tp, &fs::blocking::ReadFileContents, path)
-      .Get();
+  if (!engine::io::impl::UringReactor::GetForCurrentThread()) {
+    return engine::AsyncNoSpan(async_tp, &fs::blocking::ReadFileContents, path)
+        .Get();
+  }
+
+  // Every operation is a separate thread hop without io_uring, so the file is
+  // read in a single blocking call above
+  auto file = FileDescriptor::Open(async_tp, path, blocking::OpenFlag::kRead);
+  // One more byte to see the end of file in a single read, the file might
+  // also be growing or report no size at all
+  std::string contents(file.GetSize() + 1, '\0');
+  std::size_t size = 0;
+  while (true) {
+    size += file.ReadAt(contents.data() + size, contents.size() - size, size);
+    if (size < contents.size()) break;
+    contents.resize(contents.size() * 2);
+  }
+  contents.resize(size);
+  return contents;
 }
 
 FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
@@ -50,9 +126,7 @@ FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
     if (it->status().type() != boost::filesystem::regular_file) continue;
     if ((flags & SettingsReadFile::kSkipHidden) && IsHiddenFile(it->path()))
       continue;
-    FileInfoWithData info{};
-    info.extension = it->path().extension().string();
-    info.data = ReadFileContents(async_tp, it->path().string());
+    auto info = ReadFileInfoWithData(async_tp, it->path().string(), flags);
     data[GetLexicallyRelative(it->path().string(), path)] =
         std::make_shared<const FileInfoWithData>(std::move(info));
   }
@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <userver/engine/task/task.hpp>
+#include <userver/fs/blocking/temp_file.hpp>
+#include <userver/fs/blocking/write.hpp>
 #include <userver/fs/read.hpp>
+#include <userver/utest/utest.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -9,4 +13,32 @@ TEST(Fs, GetLexicallyRelative) {
   EXPECT_EQ(fs::GetLexicallyRelative("/path/to/file", "/path"), "/to/file");
 }
 
+UTEST(Fs, ReadFileInfoWithData) {
+  const auto file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(file.GetPath(), "contents");
+  auto& async_tp = engine::current_task::GetTaskProcessor();
+
+  const auto read = fs::ReadFileInfoWithData(async_tp, file.GetPath());
+  EXPECT_EQ(read.data, "contents");
+  EXPECT_EQ(read.GetContents(), "contents");
+  EXPECT_FALSE(read.mapping);
+
+  const auto mapped = fs::ReadFileInfoWithData(async_tp, file.GetPath(),
+                                               fs::SettingsReadFile::kMmap);
+  EXPECT_TRUE(mapped.data.empty());
+  EXPECT_EQ(mapped.GetContents(), "contents");
+  EXPECT_EQ(mapped.etag, read.etag);
+  EXPECT_EQ(mapped.etag.front(), '"');
+  EXPECT_EQ(mapped.etag.back(), '"');
+
+  fs::blocking::RewriteFileContents(file.GetPath(), "new contents");
+  EXPECT_NE(fs::ReadFileInfoWithData(async_tp, file.GetPath()).etag, read.etag);
+
+  fs::blocking::RewriteFileContents(file.GetPath(), "");
+  EXPECT_EQ(fs::ReadFileInfoWithData(async_tp, file.GetPath(),
+                                     fs::SettingsReadFile::kMmap)
+                .GetContents(),
+            "");
+}
+
 USERVER_NAMESPACE_END
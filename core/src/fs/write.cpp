@@ -4,6 +4,9 @@
 
 #include <userver/engine/async.hpp>
 #include <userver/fs/blocking/write.hpp>
+#include <userver/fs/file_descriptor.hpp>
+
+#include <engine/io/uring_reactor.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -24,9 +27,19 @@ void CreateDirectories(engine::TaskProcessor& async_tp, std::string_view path) {
 
 void RewriteFileContents(engine::TaskProcessor& async_tp,
                          const std::string& path, std::string_view contents) {
-  engine::AsyncNoSpan(async_tp, &fs::blocking::RewriteFileContents, path,
-                      contents)
-      .Get();
+  if (!engine::io::impl::UringReactor::GetForCurrentThread()) {
+    engine::AsyncNoSpan(async_tp, &fs::blocking::RewriteFileContents, path,
+                        contents)
+        .Get();
+    return;
+  }
+
+  constexpr blocking::OpenMode flags{blocking::OpenFlag::kWrite,
+                                     blocking::OpenFlag::kCreateIfNotExists,
+                                     blocking::OpenFlag::kTruncate};
+  auto file = FileDescriptor::Open(async_tp, path, flags);
+  file.WriteAt(contents, 0);
+  std::move(file).Close();
 }
 
 void SyncDirectoryContents(engine::TaskProcessor& async_tp,
@@ -102,7 +102,8 @@ void Logging::Init(const ComponentConfig& config,
 
     logger->StartConsumerTask(context.GetTaskProcessor(tp_name),
                               logger_config.message_queue_size,
-                              logger_config.queue_overflow_behavior);
+                              logger_config.queue_overflow_behavior,
+                              logger_config.queue_mode);
 
     auto insertion_result =
         loggers_.emplace(logger_config.logger_name, std::move(logger));
@@ -281,6 +282,8 @@ properties:
                       - tskv
                       - ltsv
                       - raw
+                      - json
+                      - binary
                 flush_level:
                     type: string
                     description: messages of this and higher levels get flushed to the file immediately
@@ -296,10 +299,34 @@ properties:
                     enum:
                       - discard
                       - block
+                queue_mode:
+                    type: string
+                    description: "`shared` pushes the messages of all the threads into a single queue, `per-thread` pushes them into per-thread queues of message_queue_size divided by the CPU count each, keeping the order of the messages of each thread only"
+                    defaultDescription: shared
+                    enum:
+                      - shared
+                      - per-thread
                 fs-task-processor:
                     type: string
                     description: task processor for disk I/O operations for this logger
                     defaultDescription: fs-task-processor of the loggers component
+                sampling_budget:
+                    type: integer
+                    description: records per second of each level; once exceeded, the noisy log locations are sampled down and the suppressed records are reported with the first record of the next second; 0 disables sampling
+                    defaultDescription: 0
+                write_batch:
+                    type: object
+                    description: if exists, records to a file are coalesced in memory and written with a single writev per batch
+                    additionalProperties: false
+                    properties:
+                        size_bytes:
+                            type: integer
+                            description: the batch is written once it grows to that size
+                            defaultDescription: 1048576
+                        max_delay:
+                            type: string
+                            description: the batch is written on the next record once its oldest record is that old
+                            defaultDescription: 100ms
                 testsuite-capture:
                     type: object
                     description: if exists, setups additional TCP log sink for testing purposes
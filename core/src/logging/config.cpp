@@ -18,6 +18,16 @@ QueueOverflowBehavior Parse(const yaml_config::YamlConfig& value,
   return utils::ParseFromValueString(value, kMap);
 }
 
+QueueMode Parse(const yaml_config::YamlConfig& value,
+                formats::parse::To<QueueMode>) {
+  static constexpr utils::TrivialBiMap kMap([](auto selector) {
+    return selector()
+        .Case(QueueMode::kShared, "shared")
+        .Case(QueueMode::kPerThread, "per-thread");
+  });
+  return utils::ParseFromValueString(value, kMap);
+}
+
 Format Parse(const yaml_config::YamlConfig& value, formats::parse::To<Format>) {
   const auto format_str = value.As<std::string>("tskv");
   return FormatFromString(format_str);
@@ -31,6 +41,15 @@ TestsuiteCaptureConfig Parse(const yaml_config::YamlConfig& value,
   return config;
 }
 
+WriteBatchConfig Parse(const yaml_config::YamlConfig& value,
+                       formats::parse::To<WriteBatchConfig>) {
+  WriteBatchConfig config;
+  config.size_bytes = value["size_bytes"].As<std::size_t>(config.size_bytes);
+  config.max_delay =
+      value["max_delay"].As<std::chrono::milliseconds>(config.max_delay);
+  return config;
+}
+
 void LoggerConfig::SetName(std::string name) { logger_name = std::move(name); }
 
 LoggerConfig Parse(const yaml_config::YamlConfig& value,
@@ -52,9 +71,17 @@ LoggerConfig Parse(const yaml_config::YamlConfig& value,
       value["overflow_behavior"].As<QueueOverflowBehavior>(
           config.queue_overflow_behavior);
 
+  config.queue_mode = value["queue_mode"].As<QueueMode>(config.queue_mode);
+
   config.fs_task_processor =
       value["fs-task-processor"].As<std::optional<std::string>>();
 
+  config.write_batch =
+      value["write_batch"].As<std::optional<WriteBatchConfig>>();
+
+  config.sampling_budget =
+      value["sampling_budget"].As<size_t>(config.sampling_budget);
+
   config.testsuite_capture =
       value["testsuite-capture"].As<std::optional<TestsuiteCaptureConfig>>();
 
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <chrono>
+#include <cstddef>
+#include <optional>
 #include <string>
 #include <unordered_map>
 
@@ -24,6 +27,24 @@ enum class QueueOverflowBehavior { kDiscard, kBlock };
 QueueOverflowBehavior Parse(const yaml_config::YamlConfig& value,
                             formats::parse::To<QueueOverflowBehavior>);
 
+// kShared pushes the records of all the threads into a single queue,
+// kPerThread pushes them into the rings of the threads that the logger task
+// drains round-robin, keeping the order of the records of each thread only
+enum class QueueMode { kShared, kPerThread };
+
+QueueMode Parse(const yaml_config::YamlConfig& value,
+                formats::parse::To<QueueMode>);
+
+struct WriteBatchConfig final {
+  // Records are written once that many bytes are buffered
+  std::size_t size_bytes{1 << 20};
+  // Buffered records are written on the next record after that delay
+  std::chrono::milliseconds max_delay{100};
+};
+
+WriteBatchConfig Parse(const yaml_config::YamlConfig& value,
+                       formats::parse::To<WriteBatchConfig>);
+
 struct LoggerConfig final {
   static constexpr size_t kDefaultMessageQueueSize = 1 << 16;
 
@@ -40,9 +61,15 @@ struct LoggerConfig final {
   size_t message_queue_size = kDefaultMessageQueueSize;
   QueueOverflowBehavior queue_overflow_behavior =
       QueueOverflowBehavior::kDiscard;
+  QueueMode queue_mode = QueueMode::kShared;
 
   std::optional<std::string> fs_task_processor;
 
+  std::optional<WriteBatchConfig> write_batch;
+
+  // records per second of each level, 0 disables sampling
+  size_t sampling_budget = 0;
+
   std::optional<TestsuiteCaptureConfig> testsuite_capture;
 };
 
@@ -0,0 +1,114 @@
+#include "batched_file_sink.hpp"
+
+#include <sys/uio.h>
+
+#include <cerrno>
+#include <system_error>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+
+#include "open_file_helper.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+BatchedFileSink::BatchedFileSink(const std::string& filename,
+                                 const WriteBatchConfig& config,
+                                 LogStatistics& stats)
+    : filename_(filename),
+      config_(config),
+      stats_(stats),
+      fd_(OpenFile<fs::blocking::FileDescriptor>(filename)) {
+  UINVARIANT(config_.size_bytes > 0, "Write batch size must be positive");
+  buffer_.reserve(config_.size_bytes);
+  if (fd_.GetSize() > 0) {
+    fd_.Write("\n");
+  }
+}
+
+BatchedFileSink::~BatchedFileSink() {
+  try {
+    WriteBatch();
+  } catch (const std::exception&) {
+    // The sink is being destroyed, there is no one to report the error to
+  }
+}
+
+void BatchedFileSink::Flush() {
+  if (fd_.IsOpen()) {
+    WriteBatch();
+  }
+}
+
+void BatchedFileSink::Reopen(ReopenMode mode) {
+  WriteBatch();
+  fd_.FSync();
+  std::move(fd_).Close();
+  fd_ = OpenFile<fs::blocking::FileDescriptor>(filename_, mode);
+}
+
+void BatchedFileSink::Write(std::string_view log) {
+  if (buffer_.size() + log.size() > config_.size_bytes) {
+    // Don't copy large records, write them right after the buffer
+    WriteBatch(log);
+    return;
+  }
+
+  if (buffer_.empty()) oldest_record_time_ = Clock::now();
+  buffer_.append(log);
+
+  if (buffer_.size() == config_.size_bytes ||
+      Clock::now() - oldest_record_time_ >= config_.max_delay) {
+    WriteBatch();
+  }
+}
+
+void BatchedFileSink::WriteBatch(std::string_view tail) {
+  // On errors the batch is dropped, so that the buffer does not grow
+  const utils::FastScopeGuard clear_buffer([this]() noexcept {
+    buffer_.clear();
+  });
+
+  ::iovec parts[2]{{buffer_.data(), buffer_.size()},
+                   {const_cast<char*>(tail.data()), tail.size()}};
+  ::iovec* current = parts;
+  int parts_count = 2;
+
+  while (parts_count > 0) {
+    if (current->iov_len == 0) {
+      ++current;
+      --parts_count;
+      continue;
+    }
+
+    const auto written = ::writev(fd_.GetNative(), current, parts_count);
+    if (written < 0) {
+      if (errno == EAGAIN || errno == EINTR) continue;
+
+      const auto code = std::make_error_code(std::errc{errno});
+      throw std::system_error(code, "calling ::writev");
+    }
+
+    ++stats_.write_syscalls;
+    stats_.written_bytes +=
+        utils::statistics::Rate{static_cast<std::uint64_t>(written)};
+
+    // Skip the written parts, then the written prefix of a partial write
+    auto left = static_cast<std::size_t>(written);
+    while (parts_count > 0 && left >= current->iov_len) {
+      left -= current->iov_len;
+      ++current;
+      --parts_count;
+    }
+    if (parts_count > 0) {
+      current->iov_base = static_cast<char*>(current->iov_base) + left;
+      current->iov_len -= left;
+    }
+  }
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -3,6 +3,7 @@
 #include <userver/fs/blocking/temp_directory.hpp>
 #include <userver/utils/rand.hpp>
 
+#include "batched_file_sink.hpp"
 #include "buffered_file_sink.hpp"
 #include "file_sink.hpp"
 
@@ -38,4 +39,27 @@ void check_buffered_file_sink(benchmark::State& state) {
 }
 BENCHMARK(check_buffered_file_sink);
 
+void check_batched_file_sink(benchmark::State& state) {
+  const auto temp_root = fs::blocking::TempDirectory::Create();
+  const std::string filename =
+      temp_root.GetPath() + "/temp_file_" + std::to_string(utils::Rand());
+  logging::WriteBatchConfig config;
+  config.size_bytes = state.range(0);
+  logging::impl::LogStatistics stats;
+  auto sink = logging::impl::BatchedFileSink(filename, config, stats);
+  for ([[maybe_unused]] auto _ : state) {
+    for (auto i = 0; i < kCountLogs; ++i) {
+      sink.Log({"message\n", logging::Level::kWarning});
+    }
+  }
+  sink.Flush();
+
+  const auto syscalls = stats.write_syscalls.Load().value;
+  state.counters["bytes_per_syscall"] =
+      syscalls ? static_cast<double>(stats.written_bytes.Load().value) /
+                     static_cast<double>(syscalls)
+               : 0.0;
+}
+BENCHMARK(check_batched_file_sink)->RangeMultiplier(16)->Range(4096, 1 << 20);
+
 USERVER_NAMESPACE_END
@@ -8,6 +8,7 @@
 #include <userver/utest/parameter_names.hpp>
 #include <userver/utest/utest.hpp>
 
+#include "batched_file_sink.hpp"
 #include "buffered_file_sink.hpp"
 #include "sink_helper_test.hpp"
 
@@ -30,6 +31,12 @@ SinkPtr MakeBufferedFileSink(const std::string& filename) {
   return std::make_unique<logging::impl::BufferedFileSink>(filename);
 }
 
+SinkPtr MakeBatchedFileSink(const std::string& filename) {
+  static logging::impl::LogStatistics stats;
+  return std::make_unique<logging::impl::BatchedFileSink>(
+      filename, logging::WriteBatchConfig{}, stats);
+}
+
 class FileSinks : public testing::TestWithParam<SinkFactory> {
  protected:
   const std::string& GetTempRootPath() const { return temp_root_.GetPath(); }
@@ -191,7 +198,55 @@ UTEST_P(FileSinks, TestValidWriteMultiInFile) {
 INSTANTIATE_UTEST_SUITE_P(/* no prefix */, FileSinks,
                           testing::Values(SinkFactory{"FileSink", MakeFileSink},
                                           SinkFactory{"BufferedFileSink",
-                                                      MakeBufferedFileSink}),
+                                                      MakeBufferedFileSink},
+                                          SinkFactory{"BatchedFileSink",
+                                                      MakeBatchedFileSink}),
                           utest::PrintTestName());
 
+UTEST(BatchedFileSink, CoalescesRecords) {
+  const auto temp_root = fs::blocking::TempDirectory::Create();
+  const auto filename = temp_root.GetPath() + "/temp_file";
+  logging::impl::LogStatistics stats;
+  logging::impl::BatchedFileSink sink{
+      filename, {/*size_bytes=*/20, /*max_delay=*/std::chrono::hours{1}},
+      stats};
+
+  sink.Log({"message 1\n", logging::Level::kInfo});
+  EXPECT_EQ(test::ReadFromFile(filename), test::Messages());
+  EXPECT_EQ(stats.write_syscalls.Load().value, 0u);
+
+  // The batch is full
+  sink.Log({"message 2\n", logging::Level::kInfo});
+  EXPECT_EQ(test::ReadFromFile(filename),
+            test::Messages("message 1", "message 2"));
+  EXPECT_EQ(stats.write_syscalls.Load().value, 1u);
+  EXPECT_EQ(stats.written_bytes.Load().value, 20u);
+
+  // Does not fit, written together with the buffered record
+  sink.Log({"message 3\n", logging::Level::kInfo});
+  sink.Log({"a long message 4\n", logging::Level::kInfo});
+  EXPECT_EQ(test::ReadFromFile(filename),
+            test::Messages("message 1", "message 2", "message 3",
+                           "a long message 4"));
+  EXPECT_EQ(stats.write_syscalls.Load().value, 2u);
+
+  sink.Log({"message 5\n", logging::Level::kInfo});
+  sink.Flush();
+  EXPECT_EQ(test::ReadFromFile(filename),
+            test::Messages("message 1", "message 2", "message 3",
+                           "a long message 4", "message 5"));
+  EXPECT_EQ(stats.write_syscalls.Load().value, 3u);
+}
+
+UTEST(BatchedFileSink, WritesOnDelay) {
+  const auto temp_root = fs::blocking::TempDirectory::Create();
+  const auto filename = temp_root.GetPath() + "/temp_file";
+  logging::impl::LogStatistics stats;
+  logging::impl::BatchedFileSink sink{
+      filename, {/*size_bytes=*/1 << 20, /*max_delay=*/{}}, stats};
+
+  sink.Log({"message\n", logging::Level::kInfo});
+  EXPECT_EQ(test::ReadFromFile(filename), test::Messages("message"));
+}
+
 USERVER_NAMESPACE_END
@@ -21,6 +21,13 @@ void DumpMetric(utils::statistics::Writer& writer,
 
   writer["total"] = total;
   writer["has_reopening_error"] = stats.has_reopening_error.load();
+  writer["queue_size"] = stats.queue_size.load();
+
+  // Bytes per syscall is written_bytes / write_syscalls
+  if (const auto write_syscalls = stats.write_syscalls.Load()) {
+    writer["write_syscalls"] = write_syscalls;
+    writer["written_bytes"] = stats.written_bytes.Load();
+  }
 }
 
 }  // namespace logging::impl
@@ -0,0 +1,130 @@
+#include <logging/impl/thread_log_rings.hpp>
+
+#include <algorithm>
+
+#include <userver/compiler/thread_local.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+namespace {
+
+constexpr std::size_t kDefaultRingCapacity = 1024;
+
+std::size_t RoundUpToPowerOf2(std::size_t value) noexcept {
+  std::size_t result = 1;
+  while (result < value) result <<= 1;
+  return result;
+}
+
+}  // namespace
+
+struct ThreadLogRings::Registry final {
+  std::atomic<std::size_t> ring_capacity{kDefaultRingCapacity};
+
+  mutable std::mutex mutex;
+  std::vector<std::shared_ptr<LogRing>> rings;
+  std::atomic<std::uint64_t> version{0};
+
+  std::shared_ptr<LogRing> AcquireRing() {
+    const std::lock_guard lock{mutex};
+    for (const auto& ring : rings) {
+      if (ring->TryAcquire()) return ring;
+    }
+
+    auto ring = std::make_shared<LogRing>(ring_capacity.load());
+    rings.push_back(ring);
+    version.fetch_add(1, std::memory_order_release);
+    return ring;
+  }
+};
+
+namespace {
+
+struct ThreadRingEntry final {
+  const void* registry_key{nullptr};
+  std::weak_ptr<const void> registry;
+  std::shared_ptr<LogRing> ring;
+};
+
+struct ThreadRings final {
+  ThreadRings() = default;
+  ThreadRings(ThreadRings&&) = default;
+
+  ~ThreadRings() {
+    for (const auto& entry : entries) entry.ring->Release();
+  }
+
+  std::vector<ThreadRingEntry> entries;
+};
+
+compiler::ThreadLocal local_thread_rings = [] { return ThreadRings{}; };
+
+}  // namespace
+
+LogRing::LogRing(std::size_t capacity)
+    : mask_(RoundUpToPowerOf2(capacity) - 1), buffer_(mask_ + 1) {}
+
+ThreadLogRings::ThreadLogRings() : registry_(std::make_shared<Registry>()) {}
+
+ThreadLogRings::~ThreadLogRings() = default;
+
+void ThreadLogRings::SetRingCapacity(std::size_t capacity) noexcept {
+  UASSERT(capacity != 0);
+  registry_->ring_capacity.store(capacity);
+}
+
+LogRing& ThreadLogRings::GetThreadRing() {
+  auto thread_rings = local_thread_rings.Use();
+  for (const auto& entry : thread_rings->entries) {
+    if (entry.registry_key == registry_.get() && !entry.registry.expired()) {
+      return *entry.ring;
+    }
+  }
+
+  // The first record of the thread, or the logger has been recreated at the
+  // same address
+  auto& entries = thread_rings->entries;
+  entries.erase(std::remove_if(entries.begin(), entries.end(),
+                               [](const ThreadRingEntry& entry) {
+                                 if (!entry.registry.expired()) return false;
+                                 entry.ring->Release();
+                                 return true;
+                               }),
+                entries.end());
+
+  auto ring = registry_->AcquireRing();
+  entries.push_back(ThreadRingEntry{registry_.get(), registry_, ring});
+  return *ring;
+}
+
+bool ThreadLogRings::HasNodes() noexcept {
+  UpdateConsumerRings();
+  return std::any_of(
+      consumer_rings_.begin(), consumer_rings_.end(),
+      [](const auto& ring) { return ring->GetSizeApproximate() != 0; });
+}
+
+std::size_t ThreadLogRings::GetSizeApproximate() const {
+  const std::lock_guard lock{registry_->mutex};
+  std::size_t result = 0;
+  for (const auto& ring : registry_->rings) {
+    result += ring->GetSizeApproximate();
+  }
+  return result;
+}
+
+void ThreadLogRings::UpdateConsumerRings() noexcept {
+  const auto version = registry_->version.load(std::memory_order_acquire);
+  if (version == consumer_rings_version_) return;
+
+  const std::lock_guard lock{registry_->mutex};
+  consumer_rings_ = registry_->rings;
+  consumer_rings_version_ = registry_->version.load();
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
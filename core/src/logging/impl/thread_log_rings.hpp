@@ -0,0 +1,154 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+#include <concurrent/impl/interference_shield.hpp>
+#include <userver/concurrent/impl/intrusive_hooks.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+// A bounded single-producer, single-consumer FIFO ring of nodes. The producer
+// is the thread that owns the ring, the consumer is the owner of the logger
+// queue.
+class LogRing final {
+ public:
+  using Node = concurrent::impl::SinglyLinkedBaseHook;
+
+  explicit LogRing(std::size_t capacity);
+
+  LogRing(LogRing&&) = delete;
+  LogRing& operator=(LogRing&&) = delete;
+
+  // Returns `false` if the ring is full, in which case the node is not pushed.
+  // Can only be called by the owning thread.
+  [[nodiscard]] bool TryPush(Node& node) noexcept {
+    const auto tail = tail_->load(std::memory_order_relaxed);
+    if (tail - cached_head_ >= buffer_.size()) {
+      cached_head_ = head_->load(std::memory_order_acquire);
+      if (tail - cached_head_ >= buffer_.size()) return false;
+    }
+
+    buffer_[tail & mask_].store(&node, std::memory_order_relaxed);
+    tail_->store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Returns the oldest node, or `nullptr` if the ring is empty.
+  // Can only be called by the consumer.
+  Node* TryPop() noexcept {
+    const auto head = head_->load(std::memory_order_relaxed);
+    if (head == tail_->load(std::memory_order_acquire)) return nullptr;
+
+    auto* const node = buffer_[head & mask_].load(std::memory_order_relaxed);
+    head_->store(head + 1, std::memory_order_release);
+    return node;
+  }
+
+  // Can be called from any thread.
+  bool HasFreeCapacity() const noexcept {
+    return GetSizeApproximate() < buffer_.size();
+  }
+
+  // Can be called from any thread.
+  std::size_t GetSizeApproximate() const noexcept {
+    const auto head = head_->load(std::memory_order_acquire);
+    const auto tail = tail_->load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0;
+  }
+
+  // Returns `true` if the ring had no owning thread and now is owned by
+  // the current one.
+  bool TryAcquire() noexcept {
+    return !owned_.exchange(true, std::memory_order_acquire);
+  }
+
+  // Called by the owning thread on its exit.
+  void Release() noexcept { owned_.store(false, std::memory_order_release); }
+
+ private:
+  const std::size_t mask_;
+  std::vector<std::atomic<Node*>> buffer_;
+  std::atomic<bool> owned_{true};
+
+  // Only used by the producer
+  std::size_t cached_head_{0};
+
+  concurrent::impl::InterferenceShield<std::atomic<std::size_t>> head_{0};
+  concurrent::impl::InterferenceShield<std::atomic<std::size_t>> tail_{0};
+};
+
+// Per-thread LogRing instances of a logger. The rings of the exited threads
+// are reused by the new ones.
+//
+// The consumer drains the rings round-robin, so the records of a single thread
+// keep their order, while the records of different threads may interleave
+// differently from the order of the Log calls. A coroutine that migrates
+// between threads is a different producer after the migration.
+class ThreadLogRings final {
+ public:
+  ThreadLogRings();
+  ~ThreadLogRings();
+
+  ThreadLogRings(ThreadLogRings&&) = delete;
+  ThreadLogRings& operator=(ThreadLogRings&&) = delete;
+
+  // Sets the capacity of the rings created afterwards. Must be called before
+  // any GetThreadRing().
+  void SetRingCapacity(std::size_t capacity) noexcept;
+
+  // Returns the ring of the current thread, registering it on the first use.
+  // The reference must not be used across coroutine context switches.
+  LogRing& GetThreadRing();
+
+  // Pops all the nodes pushed before the call, ring after ring. Returns the
+  // number of consumed nodes. Can only be called by the consumer.
+  template <typename Func>
+  std::size_t ConsumeAll(Func&& func) noexcept;
+
+  // Returns `true` if there is a ring with nodes. Can only be called by the
+  // consumer.
+  bool HasNodes() noexcept;
+
+  // Can be called from any thread.
+  std::size_t GetSizeApproximate() const;
+
+ private:
+  struct Registry;
+
+  void UpdateConsumerRings() noexcept;
+
+  const std::shared_ptr<Registry> registry_;
+  // The copy of Registry::rings that is only used by the consumer
+  std::vector<std::shared_ptr<LogRing>> consumer_rings_;
+  std::uint64_t consumer_rings_version_{0};
+};
+
+template <typename Func>
+std::size_t ThreadLogRings::ConsumeAll(Func&& func) noexcept {
+  static_assert(std::is_nothrow_invocable_v<Func&, LogRing::Node&>);
+  UpdateConsumerRings();
+
+  std::size_t consumed = 0;
+  for (const auto& ring : consumer_rings_) {
+    // Nodes pushed concurrently to the ring are taken by the next call
+    for (auto size = ring->GetSizeApproximate(); size != 0; --size) {
+      auto* const node = ring->TryPop();
+      if (!node) break;
+      func(*node);
+      ++consumed;
+    }
+  }
+  return consumed;
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+
+#include <logging/binary_record.hpp>
+#include <logging/logging_test.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/logging/log_extra.hpp>
+#include <userver/utest/assert_macros.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST_F(LoggingBinaryTest, Basic) {
+  constexpr auto kTextToLog = "This is the text to log";
+  LOG_INFO() << kTextToLog;
+
+  EXPECT_EQ(LoggedText(), kTextToLog);
+
+  const auto str = GetStreamString();
+  EXPECT_EQ(str.rfind("tskv\ttimestamp=", 0), 0) << str;
+  EXPECT_NE(str.find("\tlevel=INFO\t"), std::string::npos) << str;
+  EXPECT_NE(str.find("\tmodule="), std::string::npos) << str;
+  EXPECT_NE(str.find("\tthread_id="), std::string::npos) << str;
+  EXPECT_EQ(GetRecordsCount(), 1);
+}
+
+TEST_F(LoggingBinaryTest, TypedValues) {
+  EXPECT_EQ(ToStringViaLogging(42), "42");
+  EXPECT_EQ(ToStringViaLogging(-42L), "-42");
+  EXPECT_EQ(ToStringViaLogging(42U), "42");
+  EXPECT_EQ(ToStringViaLogging(0.5), "0.5");
+  EXPECT_EQ(ToStringViaLogging(0.1F), "0.1");
+  EXPECT_EQ(ToStringViaLogging(true), "true");
+  EXPECT_EQ(ToStringViaLogging(std::chrono::milliseconds{5}), "5ms");
+
+  LOG_INFO() << "a" << 1 << 'b' << 2.5 << "c";
+  EXPECT_EQ(LoggedText(), "a1b2.5c");
+}
+
+TEST_F(LoggingBinaryTest, Escaping) {
+  LOG_INFO() << "line\nbreak\ttab"
+             << logging::LogExtra{{"some\tkey", "some\nvalue"}};
+
+  const auto str = GetStreamString();
+  EXPECT_EQ(LoggedText(), "line\\nbreak\\ttab");
+  EXPECT_NE(str.find("\tsome\\tkey=some\\nvalue"), std::string::npos) << str;
+}
+
+TEST_F(LoggingBinaryTest, LogExtra) {
+  LOG_INFO() << "text" << logging::LogExtra{{"int", 1}, {"str", "value"}};
+
+  const auto str = GetStreamString();
+  EXPECT_NE(str.find("\tint=1"), std::string::npos) << str;
+  EXPECT_NE(str.find("\tstr=value"), std::string::npos) << str;
+}
+
+namespace {
+
+template <typename T>
+void AppendRaw(std::string& out, T value) {
+  out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+std::string MakeRecord(std::string_view key, std::int64_t value) {
+  using logging::impl::binary::ItemType;
+
+  std::string body;
+  AppendRaw(body, logging::impl::binary::kVersion);
+  AppendRaw(body, static_cast<std::uint8_t>(logging::Level::kWarning));
+  AppendRaw(body, std::int64_t{0});
+  AppendRaw(body, ItemType::kKey);
+  AppendRaw(body, static_cast<std::uint16_t>(key.size()));
+  body.append(key);
+  AppendRaw(body, ItemType::kSigned);
+  AppendRaw(body, value);
+
+  std::string record;
+  AppendRaw(record, static_cast<std::uint32_t>(body.size()));
+  return record + body;
+}
+
+}  // namespace
+
+TEST(LoggingBinaryRecord, ReadOneByOne) {
+  const auto records = MakeRecord("key", 1) + MakeRecord("key", 2);
+
+  std::string_view data = records;
+  std::string out;
+  data.remove_prefix(logging::impl::binary::AppendAsTskv(data, out));
+  data.remove_prefix(logging::impl::binary::AppendAsTskv(data, out));
+  EXPECT_TRUE(data.empty());
+
+  EXPECT_NE(out.find("\tlevel=WARNING\tkey=1\n"), std::string::npos) << out;
+  EXPECT_NE(out.find("\tlevel=WARNING\tkey=2\n"), std::string::npos) << out;
+
+  UEXPECT_THROW(
+      logging::impl::binary::AppendAsTskv(records.substr(0, 10), out),
+      std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include <logging/logging_test.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/logging/log_extra.hpp>
+#include <userver/logging/stacktrace_cache.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+formats::json::Value ParseSingleRecord(const std::string& log) {
+  EXPECT_EQ(std::count(log.begin(), log.end(), '\n'), 1) << log;
+  EXPECT_EQ(log.back(), '\n') << log;
+  return formats::json::FromString(log);
+}
+
+}  // namespace
+
+TEST_F(LoggingJsonTest, Basic) {
+  constexpr auto kTextToLog = "This is the JSON text to log";
+  LOG_INFO() << kTextToLog;
+  logging::LogFlush();
+
+  const auto record = ParseSingleRecord(GetStreamString());
+  EXPECT_EQ(record["text"].As<std::string>(), kTextToLog);
+  EXPECT_EQ(record["level"].As<std::string>(), "INFO");
+  EXPECT_TRUE(record.HasMember("timestamp"));
+  EXPECT_TRUE(record.HasMember("module"));
+  EXPECT_TRUE(record.HasMember("thread_id"));
+}
+
+TEST_F(LoggingJsonTest, Escaping) {
+  LOG_INFO() << "quote\" backslash\\ newline\n tab\t bell\a"
+             << logging::LogExtra{{"some\"key", "some\nvalue"}};
+  logging::LogFlush();
+
+  const auto record = ParseSingleRecord(GetStreamString());
+  EXPECT_EQ(record["text"].As<std::string>(),
+            "quote\" backslash\\ newline\n tab\t bell\a");
+  EXPECT_EQ(record["some\"key"].As<std::string>(), "some\nvalue");
+}
+
+TEST_F(LoggingJsonTest, TypedValues) {
+  LOG_INFO() << "a" << 1 << 'b' << 2.5 << true
+             << logging::LogExtra{{"int", 42}, {"double", 0.5}};
+  logging::LogFlush();
+
+  const auto record = ParseSingleRecord(GetStreamString());
+  EXPECT_EQ(record["text"].As<std::string>(), "a1b2.5true");
+  EXPECT_EQ(record["int"].As<std::string>(), "42");
+  EXPECT_EQ(record["double"].As<std::string>(), "0.5");
+}
+
+TEST_F(LoggingJsonTest, Stacktrace) {
+  logging::stacktrace_cache::StacktraceGuard guard(true);
+  LOG_INFO() << logging::LogExtra::Stacktrace();
+  logging::LogFlush();
+
+  const auto record = ParseSingleRecord(GetStreamString());
+  const auto stacktrace = record["stacktrace"].As<std::string>();
+  EXPECT_EQ(stacktrace.rfind(" 0# ", 0), 0) << stacktrace;
+  EXPECT_NE(stacktrace.find('\n'), std::string::npos) << stacktrace;
+}
+
+TEST_F(LoggingJsonTest, EmptyText) {
+  LOG_INFO();
+  logging::LogFlush();
+
+  const auto record = ParseSingleRecord(GetStreamString());
+  EXPECT_EQ(record["text"].As<std::string>(), "");
+}
+
+USERVER_NAMESPACE_END
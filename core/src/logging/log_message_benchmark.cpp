@@ -1,10 +1,12 @@
 #include <benchmark/benchmark.h>
 
+#include <cstdint>
 #include <ostream>
 
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/logging/log_extra.hpp>
 #include <userver/logging/logger.hpp>
 
 #include <utils/gbench_auxilary.hpp>
@@ -15,7 +17,8 @@ namespace {
 
 class NoopLogger : public logging::impl::LoggerBase {
  public:
-  NoopLogger() noexcept : LoggerBase(logging::Format::kRaw) {
+  explicit NoopLogger(logging::Format format = logging::Format::kRaw) noexcept
+      : LoggerBase(format) {
     SetLevel(logging::Level::kInfo);
   }
   void Log(logging::Level, std::string_view) override {}
@@ -24,6 +27,8 @@ class NoopLogger : public logging::impl::LoggerBase {
 
 class PrependedTagLogger final : public NoopLogger {
  public:
+  using NoopLogger::NoopLogger;
+
   void PrependCommonTags(logging::impl::TagWriter writer) const override {
     writer.PutTag("aaaaaaaaaaaaaaaaaa", "value");
     writer.PutTag("bbbbbbbbbb", 42);
@@ -153,14 +158,36 @@ BENCHMARK_REGISTER_F(LogHelperBenchmark, LogMultipleStrings)
     ->Ranges({{4, 32}, {4, 32}});
 
 void LogPrependedTags(benchmark::State& state) {
-  const logging::DefaultLoggerGuard guard{
-      std::make_shared<PrependedTagLogger>()};
+  const logging::DefaultLoggerGuard guard{std::make_shared<PrependedTagLogger>(
+      static_cast<logging::Format>(state.range(0)))};
 
   for ([[maybe_unused]] auto _ : state) {
     LOG_INFO() << "";
   }
 }
-BENCHMARK(LogPrependedTags);
+BENCHMARK(LogPrependedTags)
+    ->Arg(static_cast<int>(logging::Format::kTskv))
+    ->Arg(static_cast<int>(logging::Format::kJson))
+    ->Arg(static_cast<int>(logging::Format::kBinary));
+
+// The hot path cost of a typical record, kBinary defers the formatting
+void LogTypedValues(benchmark::State& state) {
+  const auto format = static_cast<logging::Format>(state.range(0));
+  const logging::DefaultLoggerGuard guard{std::make_shared<NoopLogger>(format)};
+  const auto str = Launder(std::string(32, '*'));
+  const auto integer = Launder(std::int64_t{1234567});
+  const auto floating = Launder(3.1415926);
+
+  for ([[maybe_unused]] auto _ : state) {
+    LOG_INFO() << "request " << str << " took " << floating << "ms, "
+               << integer << " bytes"
+               << logging::LogExtra{{"int_tag", integer}, {"str_tag", str}};
+  }
+}
+BENCHMARK(LogTypedValues)
+    ->Arg(static_cast<int>(logging::Format::kTskv))
+    ->Arg(static_cast<int>(logging::Format::kJson))
+    ->Arg(static_cast<int>(logging::Format::kBinary));
 
 }  // namespace
 
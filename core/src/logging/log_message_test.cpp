@@ -16,6 +16,7 @@
 #include <userver/decimal64/decimal64.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/logging/null_logger.hpp>
+#include <userver/logging/stacktrace_cache.hpp>
 #include <userver/utils/regex.hpp>
 #include <userver/utils/traceful_exception.hpp>
 #include <utils/encoding/tskv_testdata_bin.hpp>
@@ -195,6 +196,17 @@ TEST_F(LoggingTest, AttachedException) {
       << "traceful exception missing its trace";
 }
 
+TEST_F(LoggingTest, LogExtraStacktrace) {
+  logging::stacktrace_cache::StacktraceGuard guard(true);
+  LOG_INFO() << "with stacktrace" << logging::LogExtra::Stacktrace();
+  logging::LogFlush();
+
+  // The stacktrace is symbolized by the logger task
+  EXPECT_THAT(GetStreamString(), testing::HasSubstr("\tstacktrace= 0# "));
+  EXPECT_THAT(GetStreamString(),
+              testing::Not(testing::HasSubstr("<userver-stacktrace:")));
+}
+
 TEST_F(LoggingTest, IfExpressionWithoutBraces) {
   bool true_flag = true;
   if (true_flag)
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include <logging/logging_test.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/mock_now.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kBudget = 32;
+
+class LoggingSamplingTest : public LoggingTest {
+ protected:
+  LoggingSamplingTest() {
+    utils::datetime::MockNowSet(utils::datetime::Now());
+    GetStreamLogger()->SetSamplingBudget(kBudget);
+  }
+
+  ~LoggingSamplingTest() override { utils::datetime::MockNowUnset(); }
+
+  std::size_t CountRecordsWith(std::string_view text) const {
+    logging::LogFlush();
+    const auto logs = GetStreamString();
+    std::size_t count = 0;
+    for (auto pos = logs.find(text); pos != std::string::npos;
+         pos = logs.find(text, pos + text.size())) {
+      ++count;
+    }
+    return count;
+  }
+};
+
+}  // namespace
+
+TEST_F(LoggingSamplingTest, WithinBudget) {
+  for (std::size_t i = 0; i < kBudget; ++i) {
+    LOG_INFO() << "noisy";
+  }
+  EXPECT_EQ(CountRecordsWith("noisy"), kBudget);
+}
+
+TEST_F(LoggingSamplingTest, NoisyLocationIsSampled) {
+  constexpr std::size_t kRecords = 1000;
+  for (std::size_t i = 0; i < kRecords; ++i) {
+    LOG_INFO() << "noisy";
+    if (i == kRecords / 2) LOG_INFO() << "rare";
+  }
+
+  const auto noisy_count = CountRecordsWith("noisy");
+  EXPECT_GE(noisy_count, kBudget);
+  EXPECT_LT(noisy_count, kRecords / 4);
+  EXPECT_EQ(CountRecordsWith("rare"), 1);
+
+  // Other levels have their own budgets
+  LOG_WARNING() << "warning";
+  EXPECT_EQ(CountRecordsWith("warning"), 1);
+
+  utils::datetime::MockSleep(std::chrono::seconds{1});
+  LOG_INFO() << "next period";
+  EXPECT_EQ(CountRecordsWith("next period"), 1);
+  EXPECT_EQ(CountRecordsWith(fmt::format("suppressed {} records from ",
+                                         kRecords - noisy_count)),
+            1);
+}
+
+TEST_F(LoggingSamplingTest, BudgetIsRestored) {
+  for (std::size_t i = 0; i < 10 * kBudget; ++i) {
+    LOG_INFO() << "noisy";
+  }
+  ClearLog();
+
+  utils::datetime::MockSleep(std::chrono::seconds{1});
+  for (std::size_t i = 0; i < kBudget; ++i) {
+    LOG_INFO() << "noisy";
+  }
+  EXPECT_EQ(CountRecordsWith("noisy"), kBudget);
+}
+
+USERVER_NAMESPACE_END
@@ -136,4 +136,18 @@ class LoggingLtsvTest : public LoggingTestBase {
   }
 };
 
+class LoggingJsonTest : public LoggingTestBase {
+ protected:
+  LoggingJsonTest() : LoggingTestBase(logging::Format::kJson) {
+    SetDefaultLogger(GetStreamLogger());
+  }
+};
+
+class LoggingBinaryTest : public LoggingTestBase {
+ protected:
+  LoggingBinaryTest() : LoggingTestBase(logging::Format::kBinary) {
+    SetDefaultLogger(GetStreamLogger());
+  }
+};
+
 USERVER_NAMESPACE_END
@@ -1,8 +1,13 @@
 #include "tp_logger.hpp"
 
+#include <algorithm>
+#include <thread>
+
 #include <fmt/format.h>
 
 #include <engine/task/task_context.hpp>
+#include <logging/binary_record.hpp>
+#include <logging/deferred_stacktrace.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
@@ -15,6 +20,12 @@ USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
 
+namespace {
+
+constexpr std::size_t kMinThreadRingCapacity = 256;
+
+}  // namespace
+
 struct TpLogger::ActionVisitor final {
   TpLogger& logger;
 
@@ -52,11 +63,20 @@ TpLogger::TpLogger(Format format, std::string logger_name)
 
 void TpLogger::StartConsumerTask(engine::TaskProcessor& task_processor,
                                  std::size_t max_queue_size,
-                                 QueueOverflowBehavior overflow_policy) {
+                                 QueueOverflowBehavior overflow_policy,
+                                 QueueMode queue_mode) {
   UINVARIANT(max_queue_size != 0 && max_queue_size <= (std::size_t{1} << 31),
              "Invalid max queue size");
   max_queue_size_.store(max_queue_size);
   overflow_policy_.store(overflow_policy);
+  queue_mode_.store(queue_mode);
+
+  // The queue size is split between the threads that log concurrently
+  const std::size_t cpus = std::max(std::thread::hardware_concurrency(), 1U);
+  rings_.SetRingCapacity(
+      std::clamp(max_queue_size / cpus,
+                 std::min(kMinThreadRingCapacity, max_queue_size),
+                 max_queue_size));
 
   auto expected = State::kSync;
   const bool success = state_.compare_exchange_strong(expected, State::kAsync);
@@ -86,6 +106,13 @@ TpLogger::~TpLogger() {
   UASSERT_MSG(!consuming_task_.IsValid(),
               "We may be in non coroutine context, async logger must be in "
               "sync mode and consuming task must be stopped");
+
+  // The records that were logged concurrently with StopConsumerTask and were
+  // not followed by any other record or Flush
+  rings_.ConsumeAll([](concurrent::impl::SinglyLinkedBaseHook& node) noexcept {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+    delete &static_cast<impl::async::ActionNode&>(node);
+  });
 }
 
 void TpLogger::StopConsumerTask() {
@@ -124,7 +151,13 @@ void TpLogger::Flush() {
   }
 }
 
-impl::LogStatistics& TpLogger::GetStatistics() noexcept { return stats_; }
+impl::LogStatistics& TpLogger::GetStatistics() noexcept {
+  const auto ring_records =
+      static_cast<QueueSize>(rings_.GetSizeApproximate());
+  stats_.queue_size.store(produced_->load() - consumed_->load() + ring_records,
+                          std::memory_order_relaxed);
+  return stats_;
+}
 
 void TpLogger::Log(Level level, std::string_view msg) {
   ++stats_.by_level[static_cast<std::size_t>(level)];
@@ -133,6 +166,12 @@ void TpLogger::Log(Level level, std::string_view msg) {
     return;
   }
 
+  if (queue_mode_.load() == QueueMode::kPerThread &&
+      state_.load() == State::kAsync) {
+    LogToThreadRing(level, msg);
+    return;
+  }
+
   if (TryWaitFreeQueueCapacity()) {
     // The queue might have concurrently become full, in which case the size
     // will temporarily go over the max size. The actual number of log actions
@@ -155,6 +194,8 @@ void TpLogger::PrependCommonTags(TagWriter writer) const {
   impl::default_::PrependCommonTags(writer);
 }
 
+bool TpLogger::SymbolizesDeferredStacktraces() const noexcept { return true; }
+
 bool TpLogger::DoShouldLog(Level level) const noexcept {
   return impl::default_::DoShouldLog(level);
 }
@@ -194,6 +235,7 @@ void TpLogger::ProcessingLoop() {
       UASSERT(state_ == State::kStoppingAsync);
       break;
     }
+    if (!TryStartRingConsumerSleep()) continue;
     queue_.WaitWhileEmpty(queue_consumer_);
   }
 
@@ -238,6 +280,107 @@ void TpLogger::Push(impl::async::Action&& action) {
   DoPush(*node.release());
 }
 
+void TpLogger::LogToThreadRing(Level level, std::string_view msg) {
+  auto node = std::make_unique<impl::async::ActionNode>();
+  node->action = impl::async::Log{level, std::string{msg}};
+
+  while (!rings_.GetThreadRing().TryPush(*node)) {
+    if (!TryWaitFreeThreadRingCapacity()) {
+      ++stats_.dropped;
+      return;
+    }
+    if (state_.load() != State::kAsync) {
+      // The async task has stopped while we were waiting
+      produced_->fetch_add(1);
+      DoPush(*node.release());
+      return;
+    }
+  }
+  node.release();
+
+  WakeUpRingConsumer();
+}
+
+bool TpLogger::TryWaitFreeThreadRingCapacity() {
+  // Do not do blocking push if we are not in a coroutine context.
+  if (overflow_policy_.load() != QueueOverflowBehavior::kBlock ||
+      !engine::current_task::IsTaskProcessorThread()) {
+    return false;
+  }
+
+  // The task may migrate to another thread while waiting, so the ring of
+  // the current thread is checked each time.
+  const engine::TaskCancellationBlocker block_cancel;
+  std::unique_lock lock{capacity_waiters_mutex_};
+  [[maybe_unused]] const bool success = capacity_waiters_cv_.Wait(lock, [this] {
+    return rings_.GetThreadRing().HasFreeCapacity() ||
+           state_.load() != State::kAsync;
+  });
+  UASSERT(success);
+  return true;
+}
+
+void TpLogger::WakeUpRingConsumer() noexcept {
+  // Pairs with the fence in TryStartRingConsumerSleep: either the async task
+  // sees the pushed record, or we see it sleeping.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  if (state_.load() == State::kAsync) {
+    auto expected = RingConsumerState::kSleeping;
+    if (ring_consumer_state_.load(std::memory_order_relaxed) != expected ||
+        !ring_consumer_state_.compare_exchange_strong(
+            expected, RingConsumerState::kWaking)) {
+      return;
+    }
+  } else if (ring_consumer_state_.exchange(RingConsumerState::kWaking) ==
+             RingConsumerState::kWaking) {
+    // The async task has stopped, whoever consumes wake_node_ also consumes
+    // our record
+    return;
+  }
+
+  DoPush(wake_node_);
+}
+
+bool TpLogger::TryStartRingConsumerSleep() noexcept {
+  if (queue_mode_.load() != QueueMode::kPerThread) return true;
+
+  auto expected = RingConsumerState::kAwake;
+  if (!ring_consumer_state_.compare_exchange_strong(
+          expected, RingConsumerState::kSleeping)) {
+    // Either still sleeping after another wakeup, or wake_node_ is on its way
+    return true;
+  }
+
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (!rings_.HasNodes()) return true;
+
+  // If that fails, a producer is pushing wake_node_
+  expected = RingConsumerState::kSleeping;
+  return !ring_consumer_state_.compare_exchange_strong(
+      expected, RingConsumerState::kAwake);
+}
+
+void TpLogger::ConsumeThreadRings() noexcept {
+  const auto consumed = rings_.ConsumeAll(
+      [this](concurrent::impl::SinglyLinkedBaseHook& node) noexcept {
+        // Balances the AccountLogConsumed call, the producers of the rings do
+        // not touch the shared counters
+        produced_->fetch_add(1, std::memory_order_relaxed);
+        PerformNode(node);
+      });
+
+  if (consumed != 0 &&
+      overflow_policy_.load() == QueueOverflowBehavior::kBlock) {
+    {
+      // See AccountLogConsumed
+      const std::lock_guard lock{capacity_waiters_mutex_};
+    }
+    // The waiters wait for different rings
+    capacity_waiters_cv_.NotifyAll();
+  }
+}
+
 void TpLogger::DoPush(concurrent::impl::SinglyLinkedBaseHook& node) noexcept {
   auto consumer = queue_.PushAndTryStartConsuming(node);
   if (consumer.IsValid()) {
@@ -263,15 +406,28 @@ void TpLogger::AccountLogConsumed() noexcept {
 
 void TpLogger::ConsumeNode(
     concurrent::impl::SinglyLinkedBaseHook& node) noexcept {
+  if (&node == &wake_node_) {
+    // Acquires the records of the producers that have seen kWaking
+    ring_consumer_state_.exchange(RingConsumerState::kAwake);
+  }
+
+  // The records that the threads have logged before pushing the node
+  ConsumeThreadRings();
+
+  if (&node == &stop_node_ || &node == &wake_node_) return;
+  PerformNode(node);
+}
+
+void TpLogger::PerformNode(
+    concurrent::impl::SinglyLinkedBaseHook& node) noexcept {
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
   auto& action_node = static_cast<impl::async::ActionNode&>(node);
-  if (&action_node == &stop_node_) return;
-
   BackendPerform(std::move(action_node.action));
   delete &action_node;
 }
 
 void TpLogger::ConsumeQueueOnce(Queue::Consumer& consumer) noexcept {
+  ConsumeThreadRings();
   while (auto* const node_base = consumer.TryPop()) {
     ConsumeNode(*node_base);
   }
@@ -287,6 +443,19 @@ void TpLogger::BackendLog(impl::async::Log&& action) const {
   message.payload = action.payload;
   message.level = action.level;
 
+  if (GetFormat() == Format::kBinary) {
+    // Text rendering was deferred from LogHelper to the consumer task
+    render_buffer_.clear();
+    impl::binary::AppendAsTskv(action.payload, render_buffer_);
+    message.payload = render_buffer_;
+  }
+
+  // Stacktraces are symbolized here rather than on the logging coroutine
+  if (stacktrace_cache::impl::SymbolizeDeferredStacktraces(
+          message.payload, GetFormat(), symbolize_buffer_)) {
+    message.payload = symbolize_buffer_;
+  }
+
   for (const auto& sink : GetSinks()) {
     try {
       sink->Log(message);
@@ -21,6 +21,7 @@
 #include <logging/config.hpp>
 #include <logging/impl/base_sink.hpp>
 #include <logging/impl/reopen_mode.hpp>
+#include <logging/impl/thread_log_rings.hpp>
 #include <userver/concurrent/impl/intrusive_hooks.hpp>
 #include <userver/logging/impl/log_stats.hpp>
 
@@ -35,7 +36,6 @@ namespace async {
 struct Log {
   Level level{};
   std::string payload{};
-  std::chrono::system_clock::time_point time{std::chrono::system_clock::now()};
 };
 
 struct FlushCoro {
@@ -69,13 +69,15 @@ class TpLogger final : public LoggerBase {
 
   void StartConsumerTask(engine::TaskProcessor& task_processor,
                          std::size_t max_queue_size,
-                         QueueOverflowBehavior overflow_policy);
+                         QueueOverflowBehavior overflow_policy,
+                         QueueMode queue_mode = QueueMode::kShared);
 
   void StopConsumerTask();
 
   void Log(Level level, std::string_view msg) override;
   void Flush() override;
   void PrependCommonTags(TagWriter writer) const override;
+  bool SymbolizesDeferredStacktraces() const noexcept override;
 
   void AddSink(impl::SinkPtr&& sink);
   const std::vector<impl::SinkPtr>& GetSinks() const;
@@ -97,6 +99,13 @@ class TpLogger final : public LoggerBase {
     kStoppingAsync,
   };
 
+  // Whether the logger task waits for wake_node_ in QueueMode::kPerThread
+  enum class RingConsumerState {
+    kAwake,
+    kSleeping,
+    kWaking,
+  };
+
   using Queue = engine::impl::AsyncFlatCombiningQueue;
   using QueueSize = std::int64_t;
 
@@ -104,6 +113,12 @@ class TpLogger final : public LoggerBase {
   bool HasFreeQueueCapacity() noexcept;
   bool TryWaitFreeQueueCapacity();
   void Push(impl::async::Action&& action);
+  void LogToThreadRing(Level level, std::string_view msg);
+  bool TryWaitFreeThreadRingCapacity();
+  void WakeUpRingConsumer() noexcept;
+  bool TryStartRingConsumerSleep() noexcept;
+  void ConsumeThreadRings() noexcept;
+  void PerformNode(concurrent::impl::SinglyLinkedBaseHook& node) noexcept;
   void DoPush(concurrent::impl::SinglyLinkedBaseHook& node) noexcept;
   void ConsumeNode(concurrent::impl::SinglyLinkedBaseHook& node) noexcept;
   void ConsumeQueueOnce(Queue::Consumer& consumer) noexcept;
@@ -117,6 +132,10 @@ class TpLogger final : public LoggerBase {
   const std::string logger_name_;
   std::vector<impl::SinkPtr> sinks_;
   mutable impl::LogStatistics stats_{};
+  // Only used by the consumer to render Format::kBinary records
+  mutable std::string render_buffer_;
+  // Only used by the consumer to symbolize the deferred stacktraces
+  mutable std::string symbolize_buffer_;
 
   engine::Mutex capacity_waiters_mutex_;
   engine::ConditionVariable capacity_waiters_cv_;
@@ -124,15 +143,23 @@ class TpLogger final : public LoggerBase {
   std::atomic<QueueSize> max_queue_size_{std::numeric_limits<QueueSize>::max()};
   std::atomic<QueueOverflowBehavior> overflow_policy_{
       QueueOverflowBehavior::kDiscard};
+  std::atomic<QueueMode> queue_mode_{QueueMode::kShared};
   // State changes rarely, no need for an InterferenceShield.
   std::atomic<State> state_{State::kSync};
   Queue::Consumer queue_consumer_;
   // A dummy action used for notifying the async task during stopping.
   impl::async::ActionNode stop_node_;
+  // A dummy action used for waking up the async task in
+  // QueueMode::kPerThread.
+  impl::async::ActionNode wake_node_;
+  std::atomic<RingConsumerState> ring_consumer_state_{
+      RingConsumerState::kAwake};
 
   Queue queue_;
   concurrent::impl::InterferenceShield<std::atomic<QueueSize>> produced_{0};
   concurrent::impl::InterferenceShield<std::atomic<QueueSize>> consumed_{0};
+  // Only used in QueueMode::kPerThread
+  impl::ThreadLogRings rings_;
 };
 
 }  // namespace logging::impl
@@ -2,7 +2,10 @@
 
 #include <benchmark/benchmark.h>
 
+#include <vector>
+
 #include <logging/impl/null_sink.hpp>
+#include <userver/engine/async.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/logging/logger.hpp>
@@ -96,4 +99,75 @@ BENCHMARK_DEFINE_F(TpLoggerBenchmark, LogCheckSpan)
 }
 BENCHMARK_REGISTER_F(TpLoggerBenchmark, LogCheckSpan);
 
+// The time spent by the logging task, the consumer renders kBinary records
+void TpLoggerLogTypedValues(benchmark::State& state) {
+  auto logger =
+      MakeLoggerFromSink("test", std::make_unique<logging::impl::NullSink>(),
+                         static_cast<logging::Format>(state.range(0)));
+  logger->SetLevel(logging::Level::kInfo);
+  const logging::DefaultLoggerGuard guard{logger};
+
+  engine::RunStandalone(2, [&] {
+    logger->StartConsumerTask(engine::current_task::GetTaskProcessor(),
+                              1 << 30,
+                              logging::QueueOverflowBehavior::kDiscard);
+    const utils::FastScopeGuard stop_guard(
+        [&]() noexcept { logger->StopConsumerTask(); });
+
+    const auto str = Launder(std::string(32, '*'));
+    const auto integer = Launder(std::int64_t{1234567});
+    const auto floating = Launder(3.1415926);
+    for ([[maybe_unused]] auto _ : state) {
+      LOG_INFO() << "request " << str << " took " << floating << "ms, "
+                 << integer << " bytes";
+    }
+  });
+}
+BENCHMARK(TpLoggerLogTypedValues)
+    ->Arg(static_cast<int>(logging::Format::kTskv))
+    ->Arg(static_cast<int>(logging::Format::kBinary));
+
+// Throughput of the tasks that log concurrently from every worker thread,
+// with the shared queue and with the per-thread rings
+void TpLoggerLogMultiThread(benchmark::State& state) {
+  constexpr std::size_t kRecordsPerTask = 1000;
+  const auto threads = static_cast<std::size_t>(state.range(0));
+  const auto queue_mode = static_cast<logging::QueueMode>(state.range(1));
+
+  auto logger =
+      MakeLoggerFromSink("test", std::make_unique<logging::impl::NullSink>(),
+                         logging::Format::kTskv);
+  logger->SetLevel(logging::Level::kInfo);
+
+  // One more thread for the consumer task
+  engine::RunStandalone(threads + 1, [&] {
+    logger->StartConsumerTask(engine::current_task::GetTaskProcessor(),
+                              1 << 20, logging::QueueOverflowBehavior::kDiscard,
+                              queue_mode);
+    const utils::FastScopeGuard stop_guard(
+        [&]() noexcept { logger->StopConsumerTask(); });
+
+    const auto msg = Launder(std::string(64, '*'));
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(threads);
+    for ([[maybe_unused]] auto _ : state) {
+      for (std::size_t i = 0; i < threads; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([&] {
+          for (std::size_t j = 0; j < kRecordsPerTask; ++j) {
+            LOG_INFO_TO(logger) << msg;
+          }
+        }));
+      }
+      for (auto& task : tasks) task.Get();
+      tasks.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * threads * kRecordsPerTask);
+  });
+}
+BENCHMARK(TpLoggerLogMultiThread)
+    ->ArgsProduct({{1, 4, 16, 64},
+                   {static_cast<int>(logging::QueueMode::kShared),
+                    static_cast<int>(logging::QueueMode::kPerThread)}})
+    ->UseRealTime();
+
 USERVER_NAMESPACE_END
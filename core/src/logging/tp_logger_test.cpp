@@ -15,6 +15,7 @@ USERVER_NAMESPACE_BEGIN
 namespace {
 
 using QueueOverflowBehavior = logging::QueueOverflowBehavior;
+using QueueMode = logging::QueueMode;
 
 constexpr std::size_t kLoggingTestIterations = 400;
 constexpr std::size_t kLoggingRecursionDepth = 5;
@@ -47,7 +48,8 @@ class LoggingTestCoro : public LoggingTestBase {
 
   std::shared_ptr<logging::impl::TpLogger> StartAsyncLogger(
       std::size_t queue_size_max = 10,
-      QueueOverflowBehavior on_overflow = QueueOverflowBehavior::kDiscard) {
+      QueueOverflowBehavior on_overflow = QueueOverflowBehavior::kDiscard,
+      QueueMode queue_mode = QueueMode::kShared) {
     UASSERT_MSG(engine::current_task::IsTaskProcessorThread(),
                 "Misconfigured test. Should be run in coroutine environment");
 
@@ -59,7 +61,7 @@ class LoggingTestCoro : public LoggingTestBase {
         });
 
     logger->StartConsumerTask(engine::current_task::GetTaskProcessor(),
-                              queue_size_max, on_overflow);
+                              queue_size_max, on_overflow, queue_mode);
 
     // Tracing should not break the TpLogger
     logger->SetLevel(logging::Level::kTrace);
@@ -784,4 +786,61 @@ UTEST_F_MT(LoggingTestCoro, TpLoggerLogMultipleStdThreadFlushSyncCancelMT, 4) {
   EXPECT_EQ(GetRecordsCount(), message_count);
 }
 
+UTEST_F_MT(LoggingTestCoro, TpLoggerLogMultiplePerThreadMT, 4) {
+  const std::size_t message_count =
+      kLoggingTestIterations * (GetThreadCount() - 1);
+  auto logger = StartAsyncLogger(message_count * 10,
+                                 QueueOverflowBehavior::kDiscard,
+                                 QueueMode::kPerThread);
+  LogTestMT(logger, GetThreadCount(), kTestLogging);
+  EXPECT_EQ(GetRecordsCount(), message_count);
+}
+
+UTEST_F_MT(LoggingTestCoro, TpLoggerLogMultiplePerThreadFlushSyncCancelMT, 4) {
+  const std::size_t message_count = kLoggingTestIterations * GetThreadCount();
+  auto logger = StartAsyncLogger(message_count * 10,
+                                 QueueOverflowBehavior::kDiscard,
+                                 QueueMode::kPerThread);
+  LogTestMT(logger, GetThreadCount(), kTestLogFlushSyncCancel);
+  EXPECT_EQ(GetRecordsCount(), message_count);
+}
+
+UTEST_F_MT(LoggingTestCoro, TpLoggerLogMultiplePerThreadBlockingMT, 4) {
+  const std::size_t message_count =
+      kLoggingTestIterations * (GetThreadCount() - 1);
+  // Rings of the minimal size, so that the producers wait for the consumer
+  auto logger = StartAsyncLogger(1, QueueOverflowBehavior::kBlock,
+                                 QueueMode::kPerThread);
+  LogTestMT(logger, GetThreadCount(), kTestLogging);
+  EXPECT_EQ(GetRecordsCount(), message_count);
+}
+
+UTEST_F_MT(LoggingTestCoro, TpLoggerLogMultiplePerThreadStdThreadMT, 4) {
+  const std::size_t message_count = kLoggingTestIterations * GetThreadCount();
+  auto logger = StartAsyncLogger(message_count * 10,
+                                 QueueOverflowBehavior::kDiscard,
+                                 QueueMode::kPerThread);
+  LogTestMT(logger, GetThreadCount(), kTestLogStdThreadFlushSyncCancel);
+  EXPECT_EQ(GetRecordsCount(), message_count);
+}
+
+UTEST_F_MT(LoggingTestCoro, TpLoggerPerThreadOrder, 4) {
+  auto logger = StartAsyncLogger(kLoggingTestIterations * 10,
+                                 QueueOverflowBehavior::kDiscard,
+                                 QueueMode::kPerThread);
+  for (std::size_t i = 0; i < kLoggingTestIterations; ++i) {
+    LOG_INFO_TO(logger) << "ordered " << fmt::format("{:04}", i);
+  }
+  logger->StopConsumerTask();
+
+  const auto logs = GetStreamString();
+  std::size_t prev_pos = 0;
+  for (std::size_t i = 0; i < kLoggingTestIterations; ++i) {
+    const auto pos = logs.find(fmt::format("text=ordered {:04}", i));
+    ASSERT_NE(pos, std::string::npos);
+    EXPECT_GE(pos, prev_pos);
+    prev_pos = pos;
+  }
+}
+
 USERVER_NAMESPACE_END
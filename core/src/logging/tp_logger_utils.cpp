@@ -8,6 +8,7 @@
 #include <boost/filesystem/operations.hpp>
 #include <boost/range/algorithm/find_if.hpp>
 
+#include <logging/impl/batched_file_sink.hpp>
 #include <logging/impl/buffered_file_sink.hpp>
 #include <logging/impl/tcp_socket_sink.hpp>
 #include <logging/impl/unix_socket_sink.hpp>
@@ -48,7 +49,7 @@ SinkPtr GetSinkFromFilename(const std::string& file_path) {
   }
 }
 
-SinkPtr MakeOptionalSink(const LoggerConfig& config) {
+SinkPtr MakeOptionalSink(const LoggerConfig& config, LogStatistics& stats) {
   if (config.file_path == "@null") {
     return nullptr;
   } else if (config.file_path == "@stderr") {
@@ -57,6 +58,11 @@ SinkPtr MakeOptionalSink(const LoggerConfig& config) {
     return std::make_unique<logging::impl::BufferedUnownedFileSink>(stdout);
   } else {
     CreateLogDirectory(config.logger_name, config.file_path);
+    if (config.write_batch &&
+        !utils::text::StartsWith(config.file_path, kUnixSocketPrefix)) {
+      return std::make_unique<BatchedFileSink>(config.file_path,
+                                               *config.write_batch, stats);
+    }
     return GetSinkFromFilename(config.file_path);
   }
 }
@@ -73,8 +79,11 @@ std::shared_ptr<TpLogger> MakeTpLogger(const LoggerConfig& config) {
   auto logger = std::make_shared<TpLogger>(config.format, config.logger_name);
   logger->SetLevel(config.level);
   logger->SetFlushOn(config.flush_level);
+  if (config.sampling_budget != 0) {
+    logger->SetSamplingBudget(config.sampling_budget);
+  }
 
-  if (auto basic_sink = MakeOptionalSink(config)) {
+  if (auto basic_sink = MakeOptionalSink(config, logger->GetStatistics())) {
     logger->AddSink(std::move(basic_sink));
   }
 
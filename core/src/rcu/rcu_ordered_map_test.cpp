@@ -0,0 +1,140 @@
+#include <userver/rcu/rcu_ordered_map.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Map = rcu::RcuOrderedMap<int, std::string>;
+
+std::vector<int> Keys(const Map::Snapshot::Range& range) {
+  std::vector<int> keys;
+  for (const auto& [key, value] : range) keys.push_back(key);
+  return keys;
+}
+
+}  // namespace
+
+UTEST(RcuOrderedMap, Empty) {
+  Map map;
+  EXPECT_EQ(map.GetVersion(), 0);
+  EXPECT_EQ(map.SizeApprox(), 0);
+  EXPECT_FALSE(map.Get(1));
+  EXPECT_FALSE(map.Erase(1));
+  EXPECT_EQ(map.GetVersion(), 0);
+
+  const auto snapshot = map.GetSnapshot();
+  EXPECT_TRUE(snapshot.empty());
+  EXPECT_EQ(snapshot.begin(), snapshot.end());
+}
+
+UTEST(RcuOrderedMap, Versions) {
+  Map map;
+  map.InsertOrAssign(1, std::make_shared<const std::string>("a"));
+  EXPECT_EQ(map.GetVersion(), 1);
+
+  const auto snapshot = map.GetSnapshot();
+  map.InsertOrAssign(2, std::make_shared<const std::string>("b"));
+  EXPECT_TRUE(map.Erase(1));
+  EXPECT_EQ(map.GetVersion(), 3);
+
+  // The snapshot is not affected by the changes
+  EXPECT_EQ(snapshot.GetVersion(), 1);
+  ASSERT_EQ(snapshot.size(), 1);
+  EXPECT_EQ(*snapshot.Get(1), "a");
+  EXPECT_FALSE(snapshot.Get(2));
+
+  EXPECT_FALSE(map.Get(1));
+  EXPECT_EQ(*map.Get(2), "b");
+
+  map.Clear();
+  EXPECT_EQ(map.GetVersion(), 4);
+  EXPECT_EQ(map.SizeApprox(), 0);
+}
+
+UTEST(RcuOrderedMap, Ranges) {
+  Map map;
+  Map::RawMap raw;
+  for (int i = 0; i < 10; ++i) {
+    raw.emplace(i * 10, std::make_shared<const std::string>(std::to_string(i)));
+  }
+  map.Assign(std::move(raw));
+  EXPECT_EQ(map.GetVersion(), 1);
+
+  const auto snapshot = map.GetSnapshot();
+  EXPECT_EQ(Keys(snapshot.GetRange(15, 45)), (std::vector<int>{20, 30, 40}));
+  EXPECT_EQ(Keys(snapshot.GetRange(20, 40)), (std::vector<int>{20, 30}));
+  EXPECT_EQ(Keys(snapshot.GetRange(85, 1000)), (std::vector<int>{90}));
+  EXPECT_TRUE(snapshot.GetRange(41, 49).empty());
+  EXPECT_TRUE(snapshot.GetRange(50, 10).empty());
+
+  EXPECT_EQ(snapshot.LowerBound(30)->first, 30);
+  EXPECT_EQ(snapshot.UpperBound(30)->first, 40);
+  EXPECT_EQ(snapshot.LowerBound(91), snapshot.end());
+}
+
+UTEST(RcuOrderedMap, Transaction) {
+  Map map;
+  map.InsertOrAssign(1, std::make_shared<const std::string>("a"));
+
+  {
+    auto txn = map.StartWrite();
+    txn->emplace(2, std::make_shared<const std::string>("b"));
+    txn->erase(1);
+    // Not committed
+  }
+  EXPECT_EQ(map.GetVersion(), 1);
+  EXPECT_TRUE(map.Get(1));
+
+  auto txn = map.StartWrite();
+  txn->emplace(2, std::make_shared<const std::string>("b"));
+  txn->emplace(3, std::make_shared<const std::string>("c"));
+  txn->erase(1);
+  txn.Commit();
+
+  // A batch of changes is a single version
+  EXPECT_EQ(map.GetVersion(), 2);
+  EXPECT_EQ(map.SizeApprox(), 2);
+  EXPECT_FALSE(map.Get(1));
+}
+
+UTEST_MT(RcuOrderedMap, ConsistentSnapshots, 4) {
+  Map map;
+  std::atomic<bool> stop{false};
+
+  // Each version contains the keys [0, version)
+  auto writer = utils::Async("writer", [&map, &stop] {
+    for (int i = 0; !stop; ++i) {
+      map.InsertOrAssign(
+          i, std::make_shared<const std::string>(std::to_string(i)));
+      engine::Yield();
+    }
+  });
+
+  std::uint64_t last_version = 0;
+  for (int i = 0; i < 1000; ++i) {
+    const auto snapshot = map.GetSnapshot();
+    ASSERT_GE(snapshot.GetVersion(), last_version);
+    last_version = snapshot.GetVersion();
+
+    ASSERT_EQ(snapshot.size(), snapshot.GetVersion());
+    int expected_key = 0;
+    for (const auto& [key, value] : snapshot) {
+      ASSERT_EQ(key, expected_key++);
+      ASSERT_EQ(*value, std::to_string(key));
+    }
+  }
+
+  stop = true;
+  writer.Get();
+}
+
+USERVER_NAMESPACE_END
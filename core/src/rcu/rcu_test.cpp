@@ -21,6 +21,11 @@ struct StdMutexRcuTraits {
   using MutexType = std::mutex;
 };
 
+struct BatchedEpochRcuTraits {
+  using MutexType = engine::Mutex;
+  using ReclamationPolicy = rcu::EpochReclamation<4>;
+};
+
 }  // namespace
 
 UTEST(Rcu, Ctr) { rcu::Variable<X> ptr; }
@@ -414,14 +419,13 @@ constexpr std::size_t kSleeperTask = 1;
 constexpr std::size_t kTotalTasks =
     kReadablePtrPingPongTasks + kReadingTasks + kWritingTasks + kSleeperTask;
 
-}  // namespace
-
-UTEST_MT(Rcu, TortureTest, kTotalTasks) {
-  rcu::Variable<CleaningUpInt> data{1};
+template <typename RcuTraits>
+void RunTortureTest() {
+  rcu::Variable<CleaningUpInt, RcuTraits> data{1};
   std::atomic<bool> keep_running{true};
 
   engine::Mutex ping_pong_mutex;
-  rcu::ReadablePtr<CleaningUpInt> ptr = data.Read();
+  rcu::ReadablePtr<CleaningUpInt, RcuTraits> ptr = data.Read();
 
   std::vector<engine::TaskWithResult<void>> tasks;
 
@@ -461,6 +465,63 @@ UTEST_MT(Rcu, TortureTest, kTotalTasks) {
   keep_running = false;
 }
 
+}  // namespace
+
+UTEST_MT(Rcu, TortureTest, kTotalTasks) {
+  RunTortureTest<rcu::DefaultRcuTraits<CleaningUpInt>>();
+}
+
+UTEST_MT(Rcu, EpochTortureTest, kTotalTasks) {
+  RunTortureTest<rcu::EpochRcuTraits<CleaningUpInt>>();
+}
+
+UTEST_MT(Rcu, BatchedEpochTortureTest, kTotalTasks) {
+  RunTortureTest<BatchedEpochRcuTraits>();
+}
+
+UTEST(Rcu, EpochChangeRead) {
+  rcu::Variable<X, rcu::EpochRcuTraits<X>> ptr(1, 2);
+
+  auto reader = ptr.Read();
+  {
+    auto writer = ptr.StartWrite();
+    writer->second = 3;
+    writer.Commit();
+  }
+
+  EXPECT_EQ(std::make_pair(1, 2), *reader);
+  EXPECT_EQ(std::make_pair(1, 3), ptr.ReadCopy());
+}
+
+UTEST(Rcu, EpochReclamationBatches) {
+  using Counted = Counted<struct EpochReclamationTag>;
+
+  rcu::Variable<Counted, BatchedEpochRcuTraits> var{
+      rcu::DestructionType::kSync};
+  const auto commit = [&var] {
+    auto writer = var.StartWrite();
+    writer.Commit();
+  };
+  EXPECT_EQ(Counted::counter, 1);
+
+  // The old values are kept until the end of the batch
+  for (int i = 0; i < 3; ++i) commit();
+  EXPECT_EQ(Counted::counter, 4);
+  commit();
+  EXPECT_EQ(Counted::counter, 1);
+
+  // A reader holds back the values retired after it was obtained
+  std::optional<rcu::ReadablePtr<Counted, BatchedEpochRcuTraits>> reader;
+  reader.emplace(var.Read());
+  for (int i = 0; i < 4; ++i) commit();
+  EXPECT_EQ(Counted::counter, 5);
+  EXPECT_EQ((*reader)->value, 1);
+
+  reader.reset();
+  var.Cleanup();
+  EXPECT_EQ(Counted::counter, 1);
+}
+
 UTEST(Rcu, WritablePtrUnlocksInCommit) {
   rcu::Variable<int> var{1};
 
@@ -134,6 +134,25 @@ properties:
                     private-key-passphrase-name:
                         type: string
                         description: passphrase name located in secdist
+                    kernel-offload:
+                        type: boolean
+                        description: |
+                            hand the established TLS sessions to the kernel
+                            TLS (kTLS) where the kernel, OpenSSL and the
+                            cipher support it
+                        defaultDescription: false
+                    session-cache-size:
+                        type: integer
+                        description: |
+                            max count of the TLS sessions cached for the
+                            resumption, shared by the TLS listeners
+                        defaultDescription: 20480
+                    session-timeout:
+                        type: integer
+                        description: |
+                            lifetime in seconds of the cached TLS sessions and
+                            of the session tickets
+                        defaultDescription: 300
             handler-defaults:
                 type: object
                 description: handler defaults options
@@ -184,13 +203,39 @@ properties:
                         type: integer
                         description: timeout in seconds to drop connection if there's not data received from it
                         defaultDescription: 600
+                    max_concurrent_pipelined_requests:
+                        type: integer
+                        description: how many pipelined HTTP/1.1 requests of a connection are handled concurrently; responses are sent in order, batched into a single write
+                        defaultDescription: 1
+                        minimum: 1
                     stream_close_check_delay:
                         type: integer
                         description: delay in microseconds of the start of abort check routine
                         defaultDescription: 20ms
+                    http2_enabled:
+                        type: boolean
+                        description: accept HTTP/2, negotiated via ALPN over TLS or with prior knowledge over plain TCP
+                        defaultDescription: false
+                    http2_max_concurrent_streams:
+                        type: integer
+                        description: max number of concurrently processed HTTP/2 streams of a connection
+                        defaultDescription: 100
+                        minimum: 1
             shards:
                 type: integer
                 description: how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing
+            thread_per_core:
+                type: boolean
+                description: run a shard per task processor of components::SingleThreadedTaskProcessors, a connection and its handlers stay on the task processor of its shard
+                defaultDescription: false
+            shards_steering:
+                type: string
+                description: how the kernel distributes new connections between the SO_REUSEPORT sockets of the shards
+                defaultDescription: none
+                enum:
+                  - none
+                  - incoming-cpu
+                  - bpf-cpu
     listener-monitor:
         type: object
         description: describes the special monitoring socket, used for getting statistics and processing utility requests that should succeed even is the main socket is under heavy pressure
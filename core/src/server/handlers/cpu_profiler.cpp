@@ -0,0 +1,122 @@
+#include <userver/server/handlers/cpu_profiler.hpp>
+
+#include <fmt/format.h>
+
+#include <userver/components/component_context.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/yaml_config/schema.hpp>
+
+#include <components/manager.hpp>
+#include <engine/task/sampling_profiler.hpp>
+#include <engine/task/task_processor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+constexpr std::uint32_t kDefaultFrequency = 99;
+constexpr std::uint32_t kMaxFrequency = 10'000;
+
+std::map<std::string, engine::TaskProcessor*> GetTaskProcessors(
+    const components::ComponentContext& context) {
+  std::map<std::string, engine::TaskProcessor*> result;
+  for (const auto& [name, task_processor] :
+       context.GetManager().GetTaskProcessorsMap()) {
+    result.emplace(name, task_processor.get());
+  }
+  return result;
+}
+
+}  // namespace
+
+CpuProfiler::CpuProfiler(const components::ComponentConfig& config,
+                         const components::ComponentContext& component_context)
+    : HttpHandlerBase(config, component_context, /*is_monitor = */ true),
+      task_processors_(GetTaskProcessors(component_context)) {}
+
+std::string CpuProfiler::HandleRequestThrow(const http::HttpRequest& request,
+                                            request::RequestContext&) const {
+  if (!engine::SamplingProfiler::IsSupported()) {
+    request.SetResponseStatus(server::http::HttpStatus::kNotImplemented);
+    return "CPU profiler is not supported on this platform\n";
+  }
+
+  std::vector<engine::TaskProcessor*> task_processors;
+  if (request.HasArg("task_processor")) {
+    const auto& name = request.GetArg("task_processor");
+    const auto it = task_processors_.find(name);
+    if (it == task_processors_.end()) {
+      request.SetResponseStatus(server::http::HttpStatus::kNotFound);
+      return fmt::format("unknown task processor '{}'\n", name);
+    }
+    task_processors.push_back(it->second);
+  } else {
+    for (const auto& [name, task_processor] : task_processors_) {
+      task_processors.push_back(task_processor);
+    }
+  }
+
+  const auto& command = request.GetPathArg("command");
+  if (command == "enable") {
+    auto frequency = kDefaultFrequency;
+    if (request.HasArg("frequency")) {
+      try {
+        frequency =
+            utils::FromString<std::uint32_t>(request.GetArg("frequency"));
+      } catch (const std::exception& ex) {
+        request.SetResponseStatus(server::http::HttpStatus::kBadRequest);
+        return std::string{"invalid 'frequency' value: "} + ex.what();
+      }
+      if (frequency == 0 || frequency > kMaxFrequency) {
+        request.SetResponseStatus(server::http::HttpStatus::kBadRequest);
+        return fmt::format("'frequency' must be in [1, {}]\n", kMaxFrequency);
+      }
+    }
+    for (auto* task_processor : task_processors) {
+      task_processor->GetSamplingProfiler().SetFrequency(frequency);
+    }
+    return "OK\n";
+  } else if (command == "disable") {
+    for (auto* task_processor : task_processors) {
+      task_processor->GetSamplingProfiler().SetFrequency(0);
+    }
+    return "OK\n";
+  } else if (command == "dump") {
+    std::string result;
+    for (auto* task_processor : task_processors) {
+      task_processor->GetSamplingProfiler().AppendFoldedStacks(
+          task_processor->Name(), result);
+    }
+    return result;
+  } else if (command == "reset") {
+    for (auto* task_processor : task_processors) {
+      task_processor->GetSamplingProfiler().Reset();
+    }
+    return "OK\n";
+  } else if (command == "stat") {
+    std::string result;
+    for (auto* task_processor : task_processors) {
+      const auto& profiler = task_processor->GetSamplingProfiler();
+      const auto stats = profiler.GetStats();
+      fmt::format_to(std::back_inserter(result),
+                     "{}: frequency={} samples={} dropped={}\n",
+                     task_processor->Name(), profiler.GetFrequency(),
+                     stats.samples, stats.dropped);
+    }
+    return result;
+  } else {
+    return "Unsupported command";
+  }
+}
+
+yaml_config::Schema CpuProfiler::GetStaticConfigSchema() {
+  auto schema = HttpHandlerBase::GetStaticConfigSchema();
+  schema.UpdateDescription("handler-cpu-profiler config");
+  return schema;
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
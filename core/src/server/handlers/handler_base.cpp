@@ -91,10 +91,63 @@ properties:
         type: integer
         description: integer to limit RPS to this handler
         defaultDescription: <no limit>
+    adaptive_concurrency_limit:
+        type: object
+        description: |
+            limits the requests in flight of this handler, the limit follows
+            the latency of the requests (Gradient2 algorithm); the requests
+            over the limit are rejected before the handler task is started
+        defaultDescription: <no limit>
+        additionalProperties: false
+        properties:
+            initial_limit:
+                type: integer
+                description: limit to start with
+                defaultDescription: 20
+                minimum: 1
+            min_limit:
+                type: integer
+                description: minimal limit
+                defaultDescription: 10
+                minimum: 1
+            max_limit:
+                type: integer
+                description: maximal limit
+                defaultDescription: 1000
+                minimum: 1
+            tolerance:
+                type: number
+                description: short-term latency may exceed the long-term one that many times before the limit starts to shrink
+                defaultDescription: 1.5
+            smoothing:
+                type: number
+                description: part of the newly computed limit that is applied at each update
+                defaultDescription: 0.2
+            window:
+                type: string
+                description: how often the limit is updated
+                defaultDescription: 100ms
+            long_window:
+                type: string
+                description: time the long-term latency averages over
+                defaultDescription: 1m
     decompress_request:
         type: boolean
         description: allow decompression of the requests
         defaultDescription: false
+    compress_response:
+        type: boolean
+        description: compress the responses with gzip or zstd, as negotiated with `Accept-Encoding` of the request
+        defaultDescription: false
+    response_compression_min_size:
+        type: integer
+        description: do not compress the responses with bodies smaller than this size
+        defaultDescription: 1024
+        minimum: 0
+    response_compression_level:
+        type: integer
+        description: compression level to use, its meaning depends on the negotiated encoding
+        defaultDescription: 6 for gzip, 3 for zstd
     throttling_enabled:
         type: boolean
         description: allow throttling of the requests by components::Server , for more info see its `max_response_size_in_flight` and `requests_queue_size_threshold` options
@@ -107,6 +160,10 @@ properties:
         type: boolean
         description: TODO
         defaultDescription: false
+    request-body-stream:
+        type: boolean
+        description: start the handler right after the HTTP/1.1 request headers and read the body in parts with server::http::RequestBodyStream
+        defaultDescription: false
     monitor-handler:
         type: boolean
         description: overrides the in-code `is_monitor` flag that makes the handler run either on 'server.listener' or on 'server.listener-monitor'
@@ -138,6 +195,18 @@ properties:
         defaultDescription: taken from server.listener.handler-defaults.deadline_expired_status_code
         minimum: 400
         maximum: 599
+    request_stages_statistics:
+        type: boolean
+        description: |
+            write the `request-stages` histograms of the time the requests
+            spend in accept, TLS handshake, reading, dispatching, task
+            processor queue, middlewares, handler, response queue and sending;
+            each stage takes a per-CPU histogram
+        defaultDescription: false
+    request_stages_access_log:
+        type: boolean
+        description: append the durations of the request stages in microseconds to the access logs
+        defaultDescription: false
 )");
 }
 
@@ -82,12 +82,23 @@ HandlerConfig ParseHandlerConfigsWithDefaults(
           kLogRequestDataSizeDefaultLimit);
   config.max_requests_per_second =
       value["max_requests_per_second"].As<std::optional<size_t>>();
+  config.adaptive_concurrency_limit =
+      value["adaptive_concurrency_limit"]
+          .As<std::optional<USERVER_NAMESPACE::congestion_control::
+                                AdaptiveConcurrencyLimiterConfig>>();
   config.decompress_request = value["decompress_request"].As<bool>(true);
+  config.compress_response = value["compress_response"].As<bool>(false);
+  config.response_compression_min_size =
+      value["response_compression_min_size"].As<size_t>(
+          config.response_compression_min_size);
+  config.response_compression_level =
+      value["response_compression_level"].As<std::optional<int>>();
   config.throttling_enabled = value["throttling_enabled"].As<bool>(true);
   config.set_response_server_hostname =
       value["set-response-server-hostname"].As<std::optional<bool>>();
 
   config.response_body_stream = value["response-body-stream"].As<bool>(false);
+  config.request_body_stream = value["request-body-stream"].As<bool>(false);
 
   if (config.max_requests_per_second &&
       config.max_requests_per_second.value() <= 0) {
@@ -107,6 +118,11 @@ HandlerConfig ParseHandlerConfigsWithDefaults(
       value["deadline_expired_status_code"].As<http::HttpStatus>(
           handler_defaults.deadline_expired_status_code);
 
+  config.request_stages_statistics =
+      value["request_stages_statistics"].As<bool>(false);
+  config.request_stages_access_log =
+      value["request_stages_access_log"].As<bool>(false);
+
   return config;
 }
 
@@ -4,6 +4,7 @@
 #include <boost/algorithm/string/split.hpp>
 #include <boost/container/small_vector.hpp>
 
+#include <congestion_control/adaptive_concurrency_limiter.hpp>
 #include <server/handlers/http_handler_base_statistics.hpp>
 #include <server/http/http_request_impl.hpp>
 #include <server/middlewares/handler_adapter.hpp>
@@ -95,6 +96,7 @@ std::unordered_map<int, logging::Level> ParseStatusCodesLogLevel(
 }
 
 constexpr std::string_view kMiddlePipelineBuilderKey{"pipeline-builder"};
+constexpr std::string_view kMiddlewaresProfileKey{"profile"};
 
 void ValidateMiddlewaresConfiguration(
     const yaml_config::YamlConfig& middlewares_config,
@@ -117,7 +119,7 @@ void ValidateMiddlewaresConfiguration(
   middlewares_config.CheckObjectOrNull();
 
   for (const auto& [name, _] : yaml_config::Items(middlewares_config)) {
-    if (name == kMiddlePipelineBuilderKey) {
+    if (name == kMiddlePipelineBuilderKey || name == kMiddlewaresProfileKey) {
       continue;
     }
 
@@ -130,6 +132,16 @@ void ValidateMiddlewaresConfiguration(
   }
 }
 
+using ConcurrencyLimiter =
+    USERVER_NAMESPACE::congestion_control::AdaptiveConcurrencyLimiter;
+
+std::unique_ptr<ConcurrencyLimiter> MakeConcurrencyLimiter(
+    const HandlerConfig& config) {
+  if (!config.adaptive_concurrency_limit) return nullptr;
+  return std::make_unique<ConcurrencyLimiter>(
+      *config.adaptive_concurrency_limit);
+}
+
 }  // namespace
 
 HttpHandlerBase::HttpHandlerBase(const components::ComponentConfig& config,
@@ -146,6 +158,11 @@ HttpHandlerBase::HttpHandlerBase(const components::ComponentConfig& config,
               .As<std::unordered_map<std::string, std::string>>({}))),
       handler_statistics_(std::make_unique<HttpHandlerStatistics>()),
       request_statistics_(std::make_unique<HttpRequestStatistics>()),
+      request_stages_statistics_(
+          GetConfig().request_stages_statistics
+              ? std::make_unique<HttpRequestStagesStatistics>()
+              : nullptr),
+      concurrency_limiter_(MakeConcurrencyLimiter(GetConfig())),
       is_body_streamed_(config["response-body-stream"].As<bool>(false)) {
   if (allowed_methods_.empty()) {
     LOG_WARNING() << "empty allowed methods list in " << config.Name();
@@ -185,6 +202,13 @@ HttpHandlerBase::HttpHandlerBase(const components::ComponentConfig& config,
       std::move(prefix),
       [this](utils::statistics::Writer& result) {
         FormatStatistics(result["handler"], *handler_statistics_);
+        if (concurrency_limiter_) {
+          result["handler"]["adaptive-concurrency-limit"] =
+              *concurrency_limiter_;
+        }
+        if (request_stages_statistics_) {
+          result["request-stages"] = *request_stages_statistics_;
+        }
         if constexpr (kIncludeServerHttpMetrics) {
           FormatStatistics(result["request"], *request_statistics_);
         }
@@ -258,6 +282,10 @@ void HttpHandlerBase::HandleHttpRequest(
   // Don't hold the config snapshot for too long, especially with streaming.
   context.GetInternalContext().ResetConfigSnapshot();
 
+  request.impl_.SetHandlerStartTime();
+  const utils::ScopeGuard handler_finish_scope{
+      [&request] { request.impl_.SetHandlerFinishTime(); }};
+
   const auto scope_time =
       tracing::ScopeTime::CreateOptionalScopeTime("http_handle_request");
   if (response.IsBodyStreamed()) {
@@ -279,7 +307,7 @@ void HttpHandlerBase::HandleRequest(request::RequestBase& request,
   context.GetInternalContext().SetConfigSnapshot(config_source_.GetSnapshot());
   try {
     UASSERT(first_middleware_);
-    first_middleware_->HandleRequest(http_request, context);
+    first_middleware_->Invoke(http_request, context);
   } catch (const std::exception& ex) {
     UASSERT_MSG(false,
                 "Middlewares should handle exceptions by themselves and not "
@@ -350,6 +378,15 @@ HttpRequestStatistics& HttpHandlerBase::GetRequestStatistics() const {
   return *request_statistics_;
 }
 
+HttpRequestStagesStatistics* HttpHandlerBase::GetRequestStagesStatistics()
+    const {
+  return request_stages_statistics_.get();
+}
+
+ConcurrencyLimiter* HttpHandlerBase::GetConcurrencyLimiter() const {
+  return concurrency_limiter_.get();
+}
+
 logging::Level HttpHandlerBase::GetLogLevelForResponseStatus(
     http::HttpStatus status) const {
   const auto status_code = static_cast<int>(status);
@@ -511,12 +548,24 @@ void HttpHandlerBase::BuildMiddlewarePipeline(
 
   ValidateMiddlewaresConfiguration(middlewares_config, handler_middlewares);
 
+  const auto profile =
+      middlewares_config[kMiddlewaresProfileKey].As<bool>(false);
+
   auto* next_middleware_ptr_{&first_middleware_};
-  const auto add_middleware = [this, &middlewares_config, &context,
+  const auto add_middleware = [this, &middlewares_config, &context, profile,
                                &next_middleware_ptr_](std::string_view name) {
-    *next_middleware_ptr_ =
+    auto middleware =
         context.FindComponent<middlewares::HttpMiddlewareFactoryBase>(name)
             .CreateChecked(*this, middlewares_config[name]);
+    if (!middleware) {
+      LOG_DEBUG() << "Middleware '" << name
+                  << "' is not applicable to the handler, skipping it";
+      return;
+    }
+    if (profile) {
+      middleware->scope_time_name_ = fmt::format("http_middleware_{}", name);
+    }
+    *next_middleware_ptr_ = std::move(middleware);
     next_middleware_ptr_ = &(*next_middleware_ptr_)->next_;
   };
 
@@ -552,6 +601,10 @@ properties:
                 type: string
                 description: name of a component to build a middleware pipeline for this particular handler
                 defaultDescription: default-handler-middleware-pipeline-builder
+            profile:
+                type: boolean
+                description: measure the time of every middleware with a tracing::ScopeTime named http_middleware_<name>
+                defaultDescription: false
         additionalProperties:
             type: object
             properties: {}
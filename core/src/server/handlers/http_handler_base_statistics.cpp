@@ -1,7 +1,9 @@
 #include <server/handlers/http_handler_base_statistics.hpp>
 
 #include <algorithm>
+#include <cstdint>
 
+#include <engine/task/task_context.hpp>
 #include <userver/server/request/task_inherited_data.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -10,6 +12,17 @@ namespace server::handlers {
 
 namespace {
 
+// From 10us to 10s, about 40 buckets
+constexpr double kStageLowestBoundUs = 10;
+constexpr double kStageHighestBoundUs = 10'000'000;
+constexpr std::size_t kStagePrecisionBits = 1;
+
+std::chrono::nanoseconds GetCurrentTaskCpuTime() noexcept {
+  const auto* const context =
+      engine::current_task::GetCurrentTaskContextUnchecked();
+  return context ? context->GetCpuTime() : std::chrono::nanoseconds{0};
+}
+
 struct HttpHandlerStatisticsHelper {
   const HttpHandlerStatisticsSnapshot& snapshot;
 };
@@ -25,6 +38,8 @@ void DumpMetric(utils::statistics::Writer& writer,
   writer["deadline-received"] = stats.deadline_received;
   writer["cancelled-by-deadline"] = stats.cancelled_by_deadline;
   writer["timings"] = stats.timings;
+  // Not written unless the CPU time accounting is enabled
+  if (stats.cpu_time_us.value != 0) writer["cpu-time-us"] = stats.cpu_time_us;
 }
 
 }  // namespace
@@ -33,9 +48,14 @@ void HttpHandlerMethodStatistics::Account(
     const HttpHandlerStatisticsEntry& stats) noexcept {
   reply_codes_.Account(
       static_cast<utils::statistics::HttpCodes::Code>(stats.code));
-  timings_.GetCurrentCounter().Account(stats.timing.count());
+  timings_.Account(stats.timing);
   if (stats.deadline.IsReachable()) ++deadline_received_;
   if (stats.cancelled_by_deadline) ++cancelled_by_deadline_;
+  if (stats.cpu_time.count() != 0) {
+    cpu_time_us_ += utils::statistics::Rate{static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(stats.cpu_time)
+            .count())};
+  }
 }
 
 std::size_t HttpHandlerMethodStatistics::GetInFlight() const noexcept {
@@ -59,7 +79,8 @@ HttpHandlerStatisticsSnapshot::HttpHandlerStatisticsSnapshot(
       too_many_requests_in_flight(stats.too_many_requests_in_flight_.Load()),
       rate_limit_reached(stats.rate_limit_reached_.Load()),
       deadline_received(stats.deadline_received_.Load()),
-      cancelled_by_deadline(stats.cancelled_by_deadline_.Load()) {}
+      cancelled_by_deadline(stats.cancelled_by_deadline_.Load()),
+      cpu_time_us(stats.cpu_time_us_.Load()) {}
 
 void HttpHandlerStatisticsSnapshot::Add(
     const HttpHandlerStatisticsSnapshot& other) {
@@ -71,6 +92,7 @@ void HttpHandlerStatisticsSnapshot::Add(
   rate_limit_reached += other.rate_limit_reached;
   deadline_received += other.deadline_received;
   cancelled_by_deadline += other.cancelled_by_deadline;
+  cpu_time_us += other.cpu_time_us;
 }
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -80,7 +102,36 @@ void DumpMetric(utils::statistics::Writer& writer,
 
 void HttpRequestMethodStatistics::Account(
     const HttpRequestStatisticsEntry& stats) noexcept {
-  timings_.GetCurrentCounter().Account(stats.timing.count());
+  timings_.Account(stats.timing);
+}
+
+HttpRequestStagesStatistics::HttpRequestStagesStatistics() {
+  stages_.reserve(request::kRequestStagesCount);
+  for (std::size_t i = 0; i < request::kRequestStagesCount; ++i) {
+    stages_.emplace_back(kStageLowestBoundUs, kStageHighestBoundUs,
+                         kStagePrecisionBits);
+  }
+}
+
+void HttpRequestStagesStatistics::Account(
+    const request::RequestStageTimings& timings) noexcept {
+  for (std::size_t i = 0; i < request::kRequestStagesCount; ++i) {
+    const auto& duration = timings[static_cast<request::RequestStage>(i)];
+    if (!duration) continue;
+    stages_[i].Account(static_cast<double>(
+        std::chrono::duration_cast<std::chrono::microseconds>(*duration)
+            .count()));
+  }
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const HttpRequestStagesStatistics& stats) {
+  for (std::size_t i = 0; i < request::kRequestStagesCount; ++i) {
+    writer.ValueWithLabels(
+        stats.stages_[i],
+        {"http_request_stage",
+         request::ToString(static_cast<request::RequestStage>(i))});
+  }
 }
 
 bool IsOkMethod(http::HttpMethod method) noexcept {
@@ -98,6 +149,7 @@ HttpHandlerStatisticsScope::HttpHandlerStatisticsScope(
     : stats_(stats),
       method_(method),
       start_time_(std::chrono::steady_clock::now()),
+      start_cpu_time_(GetCurrentTaskCpuTime()),
       response_(response) {
   stats_.ForMethod(method).IncrementInFlight();
 }
@@ -112,6 +164,7 @@ HttpHandlerStatisticsScope::~HttpHandlerStatisticsScope() {
       finish_time - start_time_);
   stats.deadline = data ? data->deadline : engine::Deadline{};
   stats.cancelled_by_deadline = cancelled_by_deadline_;
+  stats.cpu_time = GetCurrentTaskCpuTime() - start_cpu_time_;
   stats_.ForMethod(method_).Account(stats);
   stats_.ForMethod(method_).DecrementInFlight();
 }
@@ -4,15 +4,17 @@
 #include <chrono>
 #include <cstddef>
 #include <type_traits>
+#include <vector>
 
 #include <server/http/handler_methods.hpp>
+#include <server/request/request_stages.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
 #include <userver/server/http/http_status.hpp>
-#include <userver/utils/statistics/percentile.hpp>
+#include <userver/utils/statistics/hdr_histogram.hpp>
 #include <userver/utils/statistics/rate.hpp>
 #include <userver/utils/statistics/rate_counter.hpp>
-#include <userver/utils/statistics/recentperiod.hpp>
+#include <userver/utils/statistics/recent_timings.hpp>
 #include <utils/statistics/http_codes.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -25,6 +27,8 @@ struct HttpHandlerStatisticsEntry final {
   std::chrono::milliseconds timing{};
   engine::Deadline deadline{};
   bool cancelled_by_deadline{false};
+  // Only accounted if enabled for the task processor of the handler
+  std::chrono::nanoseconds cpu_time{};
 };
 
 struct HttpHandlerStatisticsSnapshot;
@@ -50,12 +54,10 @@ class HttpHandlerMethodStatistics final {
  private:
   friend struct HttpHandlerStatisticsSnapshot;
 
-  using Percentile = utils::statistics::Percentile<2048, unsigned int, 120>;
-  using RecentPeriod =
-      utils::statistics::RecentPeriod<Percentile, Percentile,
-                                      utils::datetime::SteadyClock>;
+  using Percentile = utils::statistics::RecentTimings::Percentile;
 
-  RecentPeriod timings_;
+  // Most of the handlers serve a single method, the others take no memory
+  utils::statistics::RecentTimings timings_;
   utils::statistics::HttpCodes reply_codes_;
   utils::statistics::RateCounter started_;
   utils::statistics::RateCounter finished_;
@@ -63,6 +65,7 @@ class HttpHandlerMethodStatistics final {
   utils::statistics::RateCounter rate_limit_reached_;
   utils::statistics::RateCounter deadline_received_;
   utils::statistics::RateCounter cancelled_by_deadline_;
+  utils::statistics::RateCounter cpu_time_us_;
 };
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -84,6 +87,7 @@ struct HttpHandlerStatisticsSnapshot final {
   utils::statistics::Rate rate_limit_reached;
   utils::statistics::Rate deadline_received;
   utils::statistics::Rate cancelled_by_deadline;
+  utils::statistics::Rate cpu_time_us;
 };
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -101,16 +105,33 @@ class HttpRequestMethodStatistics final {
 
   void Account(const HttpRequestStatisticsEntry& stats) noexcept;
 
-  using Percentile = utils::statistics::Percentile<2048, unsigned int, 120>;
+  using Percentile = utils::statistics::RecentTimings::Percentile;
 
   Percentile GetTimings() const { return timings_.GetStatsForPeriod(); }
 
  private:
-  utils::statistics::RecentPeriod<Percentile, Percentile,
-                                  utils::datetime::SteadyClock>
-      timings_;
+  utils::statistics::RecentTimings timings_;
 };
 
+// Histograms of the request stages durations in microseconds, kept only for
+// the handlers with the `request_stages_statistics` option, as each stage
+// takes a per-CPU histogram.
+class HttpRequestStagesStatistics final {
+ public:
+  HttpRequestStagesStatistics();
+
+  void Account(const request::RequestStageTimings& timings) noexcept;
+
+ private:
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const HttpRequestStagesStatistics& stats);
+
+  std::vector<utils::statistics::HdrHistogram> stages_;
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const HttpRequestStagesStatistics& stats);
+
 bool IsOkMethod(http::HttpMethod method) noexcept;
 
 std::size_t HttpMethodToIndex(http::HttpMethod method) noexcept;
@@ -154,6 +175,7 @@ class HttpHandlerStatisticsScope final {
   HttpHandlerStatistics& stats_;
   const http::HttpMethod method_;
   const std::chrono::steady_clock::time_point start_time_;
+  const std::chrono::nanoseconds start_cpu_time_;
   server::http::HttpResponse& response_;
   bool cancelled_by_deadline_{false};
 };
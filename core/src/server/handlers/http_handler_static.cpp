@@ -4,8 +4,11 @@
 #include <userver/components/component_context.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
+#include <userver/http/common_headers.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
+#include <server/middlewares/compression.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::handlers {
@@ -33,6 +36,51 @@ const dynamic_config::Key<dynamic_config::ValueDict<std::string>>
 )"},
     };
 
+std::string_view TrimSpaces(std::string_view value) {
+  constexpr std::string_view kSpaces = " \t";
+  const auto begin = value.find_first_not_of(kSpaces);
+  if (begin == std::string_view::npos) return {};
+  const auto end = value.find_last_not_of(kSpaces);
+  return value.substr(begin, end - begin + 1);
+}
+
+// RFC 9110, 13.1.2: If-None-Match uses the weak comparison
+bool MatchesIfNoneMatch(std::string_view if_none_match, std::string_view etag) {
+  if (etag.empty()) return false;
+  while (!if_none_match.empty()) {
+    const auto pos = if_none_match.find(',');
+    auto item = TrimSpaces(if_none_match.substr(0, pos));
+    if_none_match = pos == std::string_view::npos
+                        ? std::string_view{}
+                        : if_none_match.substr(pos + 1);
+
+    if (item == "*") return true;
+    if (item.substr(0, 2) == "W/") item.remove_prefix(2);
+    if (item == etag) return true;
+  }
+  return false;
+}
+
+// Each representation of a file needs a distinct strong ETag
+std::string MakeEncodedETag(std::string_view etag,
+                            middlewares::ResponseEncoding encoding) {
+  if (etag.size() < 2) return {};
+  return fmt::format(R"({}-{}")", etag.substr(0, etag.size() - 1),
+                     middlewares::ToString(encoding));
+}
+
+// The suffix of the precompressed variant of a file, e.g. `app.js.gz`
+std::string_view GetPrecompressedSuffix(
+    middlewares::ResponseEncoding encoding) {
+  switch (encoding) {
+    case middlewares::ResponseEncoding::kGzip:
+      return ".gz";
+    case middlewares::ResponseEncoding::kZstd:
+      return ".zst";
+  }
+  return {};
+}
+
 }  // namespace
 
 HttpHandlerStatic::HttpHandlerStatic(
@@ -49,15 +97,83 @@ HttpHandlerStatic::HttpHandlerStatic(
 std::string HttpHandlerStatic::HandleRequestThrow(
     const http::HttpRequest& request, request::RequestContext&) const {
   LOG_DEBUG() << "Handler: " << request.GetRequestPath();
-  const auto file = storage_.TryGetFile(request.GetRequestPath());
-  if (file) {
-    const auto config = config_.GetSnapshot();
-    request.GetHttpResponse().SetContentType(
-        config[kContentTypeMap][file->extension]);
-    return file->data;
+  const auto& path = request.GetRequestPath();
+  const auto file = storage_.TryGetFile(path);
+  if (!file) {
+    request.GetResponse().SetStatusNotFound();
+    return "File not found";
   }
-  request.GetResponse().SetStatusNotFound();
-  return "File not found";
+
+  const auto config = config_.GetSnapshot();
+  auto& response = request.GetHttpResponse();
+  response.SetContentType(config[kContentTypeMap][file->extension]);
+
+  // The chosen representation is sent straight from the cache
+  std::shared_ptr<const void> owner = file;
+  std::string_view data = file->GetContents();
+  std::string etag = file->etag;
+
+  const auto& handler_config = GetConfig();
+  if (handler_config.compress_response &&
+      data.size() >= handler_config.response_compression_min_size) {
+    middlewares::AddVaryAcceptEncoding(response);
+    const auto encoding = middlewares::NegotiateResponseEncoding(
+        request.GetHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding));
+    if (encoding) {
+      const auto precompressed = storage_.TryGetFile(
+          fmt::format("{}{}", path, GetPrecompressedSuffix(*encoding)));
+      if (precompressed) {
+        data = precompressed->GetContents();
+        etag = precompressed->etag;
+        owner = precompressed;
+        response.SetContentEncoding(
+            std::string{middlewares::ToString(*encoding)});
+      } else if (auto compressed = GetCompressedFile(path, file, *encoding);
+                 !compressed->data.empty()) {
+        data = compressed->data;
+        etag = MakeEncodedETag(etag, *encoding);
+        owner = std::move(compressed);
+        response.SetContentEncoding(
+            std::string{middlewares::ToString(*encoding)});
+      }
+    }
+  }
+
+  if (!etag.empty()) {
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kETag, etag);
+    if (MatchesIfNoneMatch(
+            request.GetHeader(USERVER_NAMESPACE::http::headers::kIfNoneMatch),
+            etag)) {
+      response.SetStatus(http::HttpStatus::kNotModified);
+      return {};
+    }
+  }
+
+  response.SetSharedData(std::move(owner), data);
+  return {};
+}
+
+std::shared_ptr<const HttpHandlerStatic::CompressedFile>
+HttpHandlerStatic::GetCompressedFile(
+    const std::string& path, const fs::FileInfoWithDataConstPtr& file,
+    middlewares::ResponseEncoding encoding) const {
+  auto key = fmt::format("{}:{}", middlewares::ToString(encoding), path);
+  std::shared_ptr<const CompressedFile> compressed = compressed_files_.Get(key);
+  if (compressed && compressed->source.lock() == file) return compressed;
+
+  std::string data;
+  try {
+    data = middlewares::CompressResponseBody(
+        file->GetContents(), encoding, GetConfig().response_compression_level);
+  } catch (const std::exception& e) {
+    LOG_WARNING() << "Failed to compress file " << path << ": " << e;
+  }
+  if (data.size() >= file->GetContents().size()) data.clear();
+
+  compressed = std::make_shared<const CompressedFile>(
+      CompressedFile{file, std::move(data)});
+  compressed_files_.InsertOrAssign(std::move(key), compressed);
+  return compressed;
 }
 
 yaml_config::Schema HttpHandlerStatic::GetStaticConfigSchema() {
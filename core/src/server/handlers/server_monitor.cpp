@@ -6,6 +6,7 @@
 #include <userver/server/handlers/exceptions.hpp>
 #include <userver/utils/statistics/graphite.hpp>
 #include <userver/utils/statistics/json.hpp>
+#include <userver/utils/statistics/metrics_delta.hpp>
 #include <userver/utils/statistics/pretty_format.hpp>
 #include <userver/utils/statistics/prometheus.hpp>
 #include <userver/utils/statistics/solomon.hpp>
@@ -34,6 +35,8 @@ namespace {
 
 using impl::StatsFormat;
 
+constexpr std::size_t kMaxDeltaConsumers = 16;
+
 std::optional<StatsFormat> ParseFormat(std::string_view format) {
   if (format.empty()) return {};
 
@@ -70,6 +73,8 @@ ServerMonitor::ServerMonitor(
       common_labels_{config["common-labels"].As<CommonLabels>({})},
       default_format_{ParseFormat(config["format"].As<std::string>({}))} {}
 
+ServerMonitor::~ServerMonitor() = default;
+
 std::string ServerMonitor::HandleRequestThrow(const http::HttpRequest& request,
                                               request::RequestContext&) const {
   const auto& prefix = request.GetArg("prefix");
@@ -101,11 +106,16 @@ std::string ServerMonitor::HandleRequestThrow(const http::HttpRequest& request,
   using utils::statistics::Request;
   auto common_labels =
       format == StatsFormat::kSolomon ? Request::AddLabels{} : common_labels_;
-  const auto statistics_request =
+  const auto full_request =
       (path.empty() ? Request::MakeWithPrefix(prefix, std::move(common_labels),
                                               std::move(labels))
                     : Request::MakeWithPath(path, std::move(common_labels),
                                             std::move(labels)));
+  const auto& delta_consumer = request.GetArg("delta-consumer");
+  const auto statistics_request =
+      delta_consumer.empty()
+          ? full_request
+          : full_request.WithDelta(GetMetricsDelta(delta_consumer));
 
   request.GetHttpResponse().SetContentType("text/plain; charset=utf-8");
   switch (format) {
@@ -145,6 +155,23 @@ std::string ServerMonitor::HandleRequestThrow(const http::HttpRequest& request,
   UINVARIANT(false, "Unexpected 'format' value");
 }
 
+utils::statistics::MetricsDelta& ServerMonitor::GetMetricsDelta(
+    const std::string& consumer) const {
+  auto consumers = delta_consumers_.Lock();
+  auto& delta = (*consumers)[consumer];
+  if (!delta) {
+    if (consumers->size() > kMaxDeltaConsumers) {
+      consumers->erase(consumer);
+      throw handlers::ClientError(handlers::ExternalBody{
+          fmt::format("Too many distinct 'delta-consumer' values, at most {} "
+                      "are supported",
+                      kMaxDeltaConsumers)});
+    }
+    delta = std::make_unique<utils::statistics::MetricsDelta>();
+  }
+  return *delta;
+}
+
 std::string ServerMonitor::GetResponseDataForLogging(const http::HttpRequest&,
                                                      request::RequestContext&,
                                                      const std::string&) const {
@@ -0,0 +1,395 @@
+#include "http2_session.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <nghttp2/nghttp2.h>
+
+#include <userver/logging/log.hpp>
+#include <userver/server/http/http_method.hpp>
+#include <userver/server/request/request_base.hpp>
+#include <userver/utils/assert.hpp>
+
+#include "http_request_impl.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+constexpr std::string_view kMethodHeader = ":method";
+constexpr std::string_view kPathHeader = ":path";
+constexpr std::string_view kAuthorityHeader = ":authority";
+constexpr std::string_view kHostHeader = "host";
+
+std::string_view AsStringView(const std::uint8_t* data, std::size_t size) {
+  return {reinterpret_cast<const char*>(data), size};
+}
+
+HttpResponse& GetHttpResponse(request::RequestBase& request) {
+  return static_cast<HttpRequestImpl&>(request).GetHttpResponse();
+}
+
+}  // namespace
+
+struct Http2Session::Stream final {
+  // Set until the request is passed to the handlers
+  std::optional<HttpRequestConstructor> constructor;
+  bool is_headers_complete{false};
+
+  // Set once the response is submitted
+  std::shared_ptr<request::RequestBase> request;
+  std::string_view body_left;
+  std::size_t sent_bytes{0};
+  bool is_sent{false};
+};
+
+struct Http2Session::Callbacks final {
+  static Http2Session& GetSession(void* user_data) {
+    return *static_cast<Http2Session*>(user_data);
+  }
+
+  static int OnBeginHeaders(nghttp2_session*, const nghttp2_frame* frame,
+                            void* user_data) noexcept {
+    if (frame->hd.type != NGHTTP2_HEADERS ||
+        frame->headers.cat != NGHTTP2_HCAT_REQUEST) {
+      return 0;
+    }
+
+    auto& session = GetSession(user_data);
+    try {
+      auto stream = std::make_unique<Stream>();
+      stream->constructor.emplace(session.request_constructor_config_,
+                                  session.handler_info_index_,
+                                  session.data_accounter_);
+      session.stats_.parsing_request_count.Add(1);
+      session.streams_[frame->hd.stream_id] = std::move(stream);
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "can't start HTTP/2 stream: " << ex;
+      return NGHTTP2_ERR_TEMPORAL_CALLBACK_FAILURE;
+    }
+    return 0;
+  }
+
+  static int OnHeader(nghttp2_session*, const nghttp2_frame* frame,
+                      const std::uint8_t* name, std::size_t namelen,
+                      const std::uint8_t* value, std::size_t valuelen,
+                      std::uint8_t /*flags*/, void* user_data) noexcept {
+    auto& session = GetSession(user_data);
+    auto* stream = session.FindStream(frame->hd.stream_id);
+    // Trailers are ignored
+    if (!stream || !stream->constructor || stream->is_headers_complete) {
+      return 0;
+    }
+
+    const auto header_name = AsStringView(name, namelen);
+    const auto header_value = AsStringView(value, valuelen);
+    LOG_TRACE() << "header: '" << header_name << "': '" << header_value << "'";
+    try {
+      auto& constructor = *stream->constructor;
+      if (header_name == kMethodHeader) {
+        constructor.SetMethod(HttpMethodFromString(header_value));
+      } else if (header_name == kPathHeader) {
+        constructor.AppendUrl(header_value.data(), header_value.size());
+      } else if (header_name == kAuthorityHeader) {
+        constructor.AppendHeaderField(kHostHeader.data(), kHostHeader.size());
+        constructor.AppendHeaderValue(header_value.data(), header_value.size());
+      } else if (!header_name.empty() && header_name[0] != ':') {
+        constructor.AppendHeaderField(header_name.data(), header_name.size());
+        constructor.AppendHeaderValue(header_value.data(), header_value.size());
+      }
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "can't append HTTP/2 header: " << ex;
+      session.FinalizeRequest(frame->hd.stream_id, *stream);
+    }
+    return 0;
+  }
+
+  static int OnFrameRecv(nghttp2_session*, const nghttp2_frame* frame,
+                         void* user_data) noexcept {
+    if (frame->hd.type != NGHTTP2_HEADERS && frame->hd.type != NGHTTP2_DATA) {
+      return 0;
+    }
+
+    auto& session = GetSession(user_data);
+    auto* stream = session.FindStream(frame->hd.stream_id);
+    if (!stream || !stream->constructor) return 0;
+
+    if (frame->hd.type == NGHTTP2_HEADERS && !stream->is_headers_complete) {
+      stream->is_headers_complete = true;
+      try {
+        auto& constructor = *stream->constructor;
+        constructor.AppendHeaderField("", 0);
+        constructor.SetHttpMajor(2);
+        constructor.SetHttpMinor(0);
+        constructor.ParseUrl();
+      } catch (const std::exception& ex) {
+        LOG_WARNING() << "can't parse HTTP/2 request headers: " << ex;
+        session.FinalizeRequest(frame->hd.stream_id, *stream);
+        return 0;
+      }
+    }
+
+    if (frame->hd.flags & NGHTTP2_FLAG_END_STREAM) {
+      session.FinalizeRequest(frame->hd.stream_id, *stream);
+    }
+    return 0;
+  }
+
+  static int OnDataChunkRecv(nghttp2_session*, std::uint8_t /*flags*/,
+                             std::int32_t stream_id, const std::uint8_t* data,
+                             std::size_t len, void* user_data) noexcept {
+    auto& session = GetSession(user_data);
+    auto* stream = session.FindStream(stream_id);
+    if (!stream || !stream->constructor) return 0;
+
+    try {
+      stream->constructor->AppendBody(reinterpret_cast<const char*>(data),
+                                      len);
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "can't append HTTP/2 body: " << ex;
+      session.FinalizeRequest(stream_id, *stream);
+    }
+    return 0;
+  }
+
+  static int OnFrameSend(nghttp2_session*, const nghttp2_frame* frame,
+                         void* user_data) noexcept {
+    if (frame->hd.type != NGHTTP2_HEADERS && frame->hd.type != NGHTTP2_DATA) {
+      return 0;
+    }
+
+    auto& session = GetSession(user_data);
+    auto* stream = session.FindStream(frame->hd.stream_id);
+    if (!stream || !stream->request) return 0;
+
+    stream->sent_bytes += frame->hd.length;
+    if (frame->hd.flags & NGHTTP2_FLAG_END_STREAM) session.MarkSent(*stream);
+    return 0;
+  }
+
+  static int OnStreamClose(nghttp2_session*, std::int32_t stream_id,
+                           std::uint32_t error_code, void* user_data) noexcept {
+    auto& session = GetSession(user_data);
+    const auto it = session.streams_.find(stream_id);
+    if (it == session.streams_.end()) return 0;
+
+    auto stream = std::move(it->second);
+    session.streams_.erase(it);
+    if (stream->constructor) session.stats_.parsing_request_count.Subtract(1);
+
+    if (error_code != NGHTTP2_NO_ERROR) {
+      LOG_DEBUG() << "HTTP/2 stream " << stream_id << " was closed with "
+                  << nghttp2_http2_strerror(error_code);
+    }
+
+    const bool is_sent = stream->is_sent;
+    try {
+      session.on_stream_close_cb_(stream_id, std::move(stream->request),
+                                  is_sent);
+    } catch (const std::exception& ex) {
+      LOG_ERROR() << "Failed to close HTTP/2 stream: " << ex;
+      return NGHTTP2_ERR_CALLBACK_FAILURE;
+    }
+    return 0;
+  }
+
+  static ssize_t ReadBody(nghttp2_session*, std::int32_t stream_id,
+                          std::uint8_t* buf, std::size_t length,
+                          std::uint32_t* data_flags, nghttp2_data_source*,
+                          void* user_data) noexcept {
+    auto& session = GetSession(user_data);
+    auto* stream = session.FindStream(stream_id);
+    if (!stream) return NGHTTP2_ERR_TEMPORAL_CALLBACK_FAILURE;
+
+    auto& body = stream->body_left;
+    const auto size = std::min(length, body.size());
+    std::memcpy(buf, body.data(), size);
+    body.remove_prefix(size);
+    if (body.empty()) *data_flags |= NGHTTP2_DATA_FLAG_EOF;
+    return static_cast<ssize_t>(size);
+  }
+};
+
+Http2Session::Http2Session(const Http2Config& config,
+                           const HandlerInfoIndex& handler_info_index,
+                           const request::HttpRequestConfig& request_config,
+                           OnNewRequestCb&& on_new_request_cb,
+                           OnStreamCloseCb&& on_stream_close_cb,
+                           net::ParserStats& stats,
+                           request::ResponseDataAccounter& data_accounter)
+    : handler_info_index_(handler_info_index),
+      request_constructor_config_{request_config},
+      on_new_request_cb_(std::move(on_new_request_cb)),
+      on_stream_close_cb_(std::move(on_stream_close_cb)),
+      stats_(stats),
+      data_accounter_(data_accounter) {
+  nghttp2_session_callbacks* callbacks = nullptr;
+  if (nghttp2_session_callbacks_new(&callbacks) != 0) {
+    throw std::bad_alloc();
+  }
+  nghttp2_session_callbacks_set_on_begin_headers_callback(
+      callbacks, &Callbacks::OnBeginHeaders);
+  nghttp2_session_callbacks_set_on_header_callback(callbacks,
+                                                   &Callbacks::OnHeader);
+  nghttp2_session_callbacks_set_on_frame_recv_callback(
+      callbacks, &Callbacks::OnFrameRecv);
+  nghttp2_session_callbacks_set_on_data_chunk_recv_callback(
+      callbacks, &Callbacks::OnDataChunkRecv);
+  nghttp2_session_callbacks_set_on_frame_send_callback(
+      callbacks, &Callbacks::OnFrameSend);
+  nghttp2_session_callbacks_set_on_stream_close_callback(
+      callbacks, &Callbacks::OnStreamClose);
+
+  const auto rv = nghttp2_session_server_new(&session_, callbacks, this);
+  nghttp2_session_callbacks_del(callbacks);
+  if (rv != 0) {
+    throw std::runtime_error(fmt::format("Failed to create HTTP/2 session: {}",
+                                         nghttp2_strerror(rv)));
+  }
+
+  const std::array<nghttp2_settings_entry, 1> settings{{
+      {NGHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS, config.max_concurrent_streams},
+  }};
+  nghttp2_submit_settings(session_, NGHTTP2_FLAG_NONE, settings.data(),
+                          settings.size());
+}
+
+Http2Session::~Http2Session() {
+  // Streams that are still in flight are reported as closed, so that
+  // the waiting requests are accounted
+  auto streams = std::move(streams_);
+  streams_.clear();
+  for (auto& [stream_id, stream] : streams) {
+    if (stream->constructor) stats_.parsing_request_count.Subtract(1);
+    if (!stream->request) continue;
+    try {
+      on_stream_close_cb_(stream_id, std::move(stream->request),
+                          stream->is_sent);
+    } catch (const std::exception& ex) {
+      LOG_ERROR() << "Failed to close HTTP/2 stream: " << ex;
+    }
+  }
+
+  nghttp2_session_del(session_);
+}
+
+bool Http2Session::Parse(const char* data, size_t size) {
+  const auto rv = nghttp2_session_mem_recv(
+      session_, reinterpret_cast<const std::uint8_t*>(data), size);
+  if (rv < 0) {
+    LOG_WARNING() << "HTTP/2 connection error: "
+                  << nghttp2_strerror(static_cast<int>(rv));
+    nghttp2_session_terminate_session(session_, NGHTTP2_PROTOCOL_ERROR);
+    return false;
+  }
+  UASSERT(static_cast<size_t>(rv) == size);
+  return true;
+}
+
+void Http2Session::SubmitResponse(
+    std::int32_t stream_id, std::shared_ptr<request::RequestBase>&& request) {
+  UASSERT(request);
+  auto* stream = FindStream(stream_id);
+  UASSERT_MSG(stream && !stream->request,
+              "Response for a closed or an already responded stream");
+  if (!stream || stream->request) return;
+
+  std::vector<std::pair<std::string, std::string>> headers;
+  const auto body = GetHttpResponse(*request).PrepareHttp2Response(headers);
+
+  std::vector<nghttp2_nv> nva;
+  nva.reserve(headers.size());
+  for (auto& [name, value] : headers) {
+    nva.push_back({reinterpret_cast<std::uint8_t*>(name.data()),
+                   reinterpret_cast<std::uint8_t*>(value.data()), name.size(),
+                   value.size(), NGHTTP2_NV_FLAG_NONE});
+  }
+
+  nghttp2_data_provider provider{};
+  provider.read_callback = &Callbacks::ReadBody;
+
+  const auto rv = nghttp2_submit_response(session_, stream_id, nva.data(),
+                                          nva.size(),
+                                          body.empty() ? nullptr : &provider);
+  if (rv != 0) {
+    throw std::runtime_error(fmt::format(
+        "Failed to submit HTTP/2 response: {}", nghttp2_strerror(rv)));
+  }
+  // The body is read once the frames are serialized
+  stream->body_left = body;
+  stream->request = std::move(request);
+}
+
+void Http2Session::CollectOutput(std::string& output) {
+  while (true) {
+    const std::uint8_t* data = nullptr;
+    const auto size = nghttp2_session_mem_send(session_, &data);
+    if (size < 0) {
+      throw std::runtime_error(
+          fmt::format("Failed to serialize HTTP/2 frames: {}",
+                      nghttp2_strerror(static_cast<int>(size))));
+    }
+    if (size == 0) break;
+    output.append(reinterpret_cast<const char*>(data),
+                  static_cast<std::size_t>(size));
+  }
+}
+
+bool Http2Session::IsAlive() const {
+  return nghttp2_session_want_read(session_) ||
+         nghttp2_session_want_write(session_);
+}
+
+void Http2Session::PrepareResponse(request::RequestBase& request) {
+  GetHttpResponse(request).ReadStreamedBodyToData();
+}
+
+Http2Session::Stream* Http2Session::FindStream(std::int32_t stream_id) {
+  const auto it = streams_.find(stream_id);
+  return it == streams_.end() ? nullptr : it->second.get();
+}
+
+void Http2Session::FinalizeRequest(std::int32_t stream_id,
+                                   Stream& stream) noexcept {
+  UASSERT(stream.constructor);
+  try {
+    auto request = stream.constructor->Finalize();
+    stream.constructor.reset();
+    stats_.parsing_request_count.Subtract(1);
+
+    if (!request) {
+      LOG_ERROR() << "request is null after Finalize()";
+    } else {
+      on_new_request_cb_(stream_id, std::move(request));
+      return;
+    }
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "Failed to start HTTP/2 request: " << ex;
+    if (stream.constructor) {
+      stream.constructor.reset();
+      stats_.parsing_request_count.Subtract(1);
+    }
+  }
+  nghttp2_submit_rst_stream(session_, NGHTTP2_FLAG_NONE, stream_id,
+                            NGHTTP2_INTERNAL_ERROR);
+}
+
+void Http2Session::MarkSent(Stream& stream) {
+  UASSERT(stream.request);
+  stream.is_sent = true;
+  GetHttpResponse(*stream.request)
+      .SetSent(stream.sent_bytes, std::chrono::steady_clock::now());
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <server/net/stats.hpp>
+#include <server/request/request_parser.hpp>
+
+#include <userver/server/request/request_config.hpp>
+
+#include "http_request_constructor.hpp"
+
+struct nghttp2_session;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+/// The client connection preface of HTTP/2 with prior knowledge (h2c)
+inline constexpr std::string_view kHttp2Preface =
+    "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n";
+
+/// The ALPN identifier of HTTP/2 over TLS
+inline constexpr std::string_view kHttp2AlpnProtocol = "h2";
+
+struct Http2Config {
+  std::uint32_t max_concurrent_streams{100};
+};
+
+// Server side of an HTTP/2 connection on top of nghttp2.
+//
+// Each stream becomes a separate request::RequestBase, so the requests of
+// a connection are handled concurrently. The session does no I/O: the received
+// bytes are fed with Parse(), the frames to send are taken with
+// CollectOutput(). Not thread safe.
+class Http2Session final : public request::RequestParser {
+ public:
+  using OnNewRequestCb = std::function<void(
+      std::int32_t stream_id, std::shared_ptr<request::RequestBase>&&)>;
+
+  // `request` is null if the stream was closed before a response was
+  // submitted, otherwise `is_sent` tells whether the whole response has
+  // reached the socket
+  using OnStreamCloseCb = std::function<void(
+      std::int32_t stream_id, std::shared_ptr<request::RequestBase>&& request,
+      bool is_sent)>;
+
+  Http2Session(const Http2Config& config,
+               const HandlerInfoIndex& handler_info_index,
+               const request::HttpRequestConfig& request_config,
+               OnNewRequestCb&& on_new_request_cb,
+               OnStreamCloseCb&& on_stream_close_cb, net::ParserStats& stats,
+               request::ResponseDataAccounter& data_accounter);
+
+  Http2Session(Http2Session&&) = delete;
+  Http2Session& operator=(Http2Session&&) = delete;
+  ~Http2Session() override;
+
+  // Returns false on a connection error, the session sends GOAWAY and
+  // stops wanting any I/O
+  bool Parse(const char* data, size_t size) override;
+
+  // The response must be ready, streamed bodies must be read with
+  // PrepareResponse() beforehand
+  void SubmitResponse(std::int32_t stream_id,
+                      std::shared_ptr<request::RequestBase>&& request);
+
+  // Appends the serialized frames to `output`
+  void CollectOutput(std::string& output);
+
+  // Whether the connection should be kept open
+  bool IsAlive() const;
+
+  // Reads the streamed body of the response to the end, may wait for the
+  // handler. Must be called without the session being locked.
+  static void PrepareResponse(request::RequestBase& request);
+
+ private:
+  struct Stream;
+  struct Callbacks;
+
+  Stream* FindStream(std::int32_t stream_id);
+  void FinalizeRequest(std::int32_t stream_id, Stream& stream) noexcept;
+  void MarkSent(Stream& stream);
+
+  const HandlerInfoIndex& handler_info_index_;
+  const HttpRequestConstructor::Config request_constructor_config_;
+  OnNewRequestCb on_new_request_cb_;
+  OnStreamCloseCb on_stream_close_cb_;
+  net::ParserStats& stats_;
+  request::ResponseDataAccounter& data_accounter_;
+
+  std::unordered_map<std::int32_t, std::unique_ptr<Stream>> streams_;
+  nghttp2_session* session_{nullptr};
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
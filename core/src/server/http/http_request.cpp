@@ -164,6 +164,10 @@ const std::string& HttpRequest::RequestBody() const {
   return impl_.RequestBody();
 }
 
+RequestBodyStream& HttpRequest::GetBodyStream() const {
+  return impl_.GetBodyStream();
+}
+
 const HttpRequest::HeadersMap& HttpRequest::RequestHeaders() const {
   return impl_.GetHeaders();
 }
@@ -0,0 +1,97 @@
+#include <userver/server/http/http_request_body_stream.hpp>
+
+#include <fmt/format.h>
+
+#include <userver/compression/zstd.hpp>
+#include <userver/engine/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/server/handlers/exceptions.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+RequestBodyStream::RequestBodyStream(const std::string& buffered_body)
+    : buffered_body_(buffered_body) {}
+
+RequestBodyStream::~RequestBodyStream() = default;
+
+bool RequestBodyStream::ReadChunk(std::string& output,
+                                  engine::Deadline deadline) {
+  output.clear();
+  if (!is_streamed_) {
+    if (is_buffered_body_read_ || buffered_body_.empty()) return false;
+    is_buffered_body_read_ = true;
+    output = buffered_body_;
+    return true;
+  }
+
+  // Closed after the handler is done
+  if (!consumer_) return false;
+
+  while (consumer_->Pop(output, deadline)) {
+    if (!decompressor_ || Decompress(output)) return true;
+  }
+
+  if (result_.load(std::memory_order_acquire) != Result::kComplete) {
+    ThrowIncomplete(deadline);
+  }
+  if (decompressor_ && !decompressor_->IsFrameComplete()) {
+    throw handlers::RequestParseError{handlers::InternalMessage{
+        "Failed to decompress request body: the zstd frame is incomplete"}};
+  }
+  return false;
+}
+
+void RequestBodyStream::SetZstdDecompression(std::size_t max_size) {
+  UASSERT_MSG(is_streamed_, "The body is not streamed");
+  decompressor_ = std::make_unique<compression::zstd::Decompressor>(max_size);
+}
+
+RequestBodyStream::Queue::Producer RequestBodyStream::StartStreaming() {
+  UASSERT(!is_streamed_);
+  is_streamed_ = true;
+  const auto queue = Queue::Create(kBufferSize);
+  consumer_.emplace(queue->GetConsumer());
+  return queue->GetProducer();
+}
+
+void RequestBodyStream::SetResult(Result result) noexcept {
+  result_.store(result, std::memory_order_release);
+}
+
+void RequestBodyStream::Close() noexcept { consumer_.reset(); }
+
+void RequestBodyStream::ThrowIncomplete(engine::Deadline deadline) const {
+  if (result_.load(std::memory_order_acquire) == Result::kTooLarge) {
+    throw handlers::ClientError{handlers::HandlerErrorCode::kPayloadTooLarge};
+  }
+  if (engine::current_task::ShouldCancel()) {
+    throw engine::WaitInterruptedException(
+        engine::current_task::CancellationReason());
+  }
+  if (deadline.IsReached()) {
+    throw engine::WaitInterruptedException(
+        engine::TaskCancellationReason::kDeadline);
+  }
+  throw handlers::RequestParseError{
+      handlers::InternalMessage{"The request body is incomplete"}};
+}
+
+bool RequestBodyStream::Decompress(std::string& output) {
+  try {
+    output = decompressor_->Decompress(output);
+  } catch (const compression::TooBigError&) {
+    throw handlers::ClientError{handlers::HandlerErrorCode::kPayloadTooLarge};
+  } catch (const compression::DecompressionError& e) {
+    throw handlers::RequestParseError{handlers::InternalMessage{
+        fmt::format("Failed to decompress request body: {}", e.what())}};
+  }
+  // A part may end inside a zstd block
+  return !output.empty();
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
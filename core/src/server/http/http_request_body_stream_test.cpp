@@ -0,0 +1,143 @@
+#include <userver/server/http/http_request_body_stream.hpp>
+
+#include <string>
+
+#include <userver/compression/zstd.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/server/handlers/exceptions.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::RequestBodyStream;
+
+std::string ReadAll(RequestBodyStream& stream) {
+  /// [Sample]
+  std::string body;
+  std::string chunk;
+  while (stream.ReadChunk(chunk)) body += chunk;
+  /// [Sample]
+  return body;
+}
+
+}  // namespace
+
+UTEST(RequestBodyStream, BufferedBody) {
+  const std::string body = "body";
+  RequestBodyStream stream{body};
+
+  EXPECT_FALSE(stream.IsStreamed());
+  EXPECT_EQ(ReadAll(stream), body);
+  EXPECT_EQ(ReadAll(stream), "");
+}
+
+UTEST(RequestBodyStream, Streamed) {
+  const std::string buffered_body;
+  RequestBodyStream stream{buffered_body};
+
+  auto task = engine::AsyncNoSpan([&stream] { return ReadAll(stream); });
+  {
+    auto producer = stream.StartStreaming();
+    ASSERT_TRUE(producer.Push("first ", {}));
+    ASSERT_TRUE(producer.Push("second", {}));
+    stream.SetResult(RequestBodyStream::Result::kComplete);
+  }
+  EXPECT_EQ(task.Get(), "first second");
+}
+
+UTEST(RequestBodyStream, Backpressure) {
+  const std::string buffered_body;
+  RequestBodyStream stream{buffered_body};
+  auto producer = stream.StartStreaming();
+
+  ASSERT_TRUE(producer.PushNoblock(
+      std::string(RequestBodyStream::kBufferSize, 'a')));
+  EXPECT_FALSE(producer.PushNoblock("b"));
+
+  std::string chunk;
+  ASSERT_TRUE(stream.ReadChunk(chunk));
+  EXPECT_TRUE(producer.PushNoblock("b"));
+}
+
+UTEST(RequestBodyStream, Incomplete) {
+  const std::string buffered_body;
+  RequestBodyStream stream{buffered_body};
+  {
+    auto producer = stream.StartStreaming();
+    ASSERT_TRUE(producer.Push("part", {}));
+  }
+
+  std::string chunk;
+  ASSERT_TRUE(stream.ReadChunk(chunk));
+  EXPECT_EQ(chunk, "part");
+  UEXPECT_THROW(stream.ReadChunk(chunk),
+                server::handlers::RequestParseError);
+}
+
+UTEST(RequestBodyStream, TooLarge) {
+  const std::string buffered_body;
+  RequestBodyStream stream{buffered_body};
+  {
+    auto producer = stream.StartStreaming();
+    stream.SetResult(RequestBodyStream::Result::kTooLarge);
+  }
+
+  std::string chunk;
+  try {
+    stream.ReadChunk(chunk);
+    FAIL() << "The body exceeds the limit";
+  } catch (const server::handlers::ClientError& e) {
+    EXPECT_EQ(e.GetCode(),
+              server::handlers::HandlerErrorCode::kPayloadTooLarge);
+  }
+}
+
+UTEST(RequestBodyStream, Closed) {
+  const std::string buffered_body;
+  RequestBodyStream stream{buffered_body};
+  auto producer = stream.StartStreaming();
+
+  stream.Close();
+  EXPECT_FALSE(producer.Push("part", {}));
+
+  std::string chunk;
+  EXPECT_FALSE(stream.ReadChunk(chunk));
+}
+
+UTEST(RequestBodyStream, ZstdDecompression) {
+  const std::string body(100'000, 'x');
+  const auto compressed = compression::zstd::Compress(body, 3);
+
+  const std::string buffered_body;
+  RequestBodyStream stream{buffered_body};
+  {
+    auto producer = stream.StartStreaming();
+    stream.SetZstdDecompression(body.size());
+    const auto middle = compressed.size() / 2;
+    ASSERT_TRUE(producer.Push(compressed.substr(0, middle), {}));
+    ASSERT_TRUE(producer.Push(compressed.substr(middle), {}));
+    stream.SetResult(RequestBodyStream::Result::kComplete);
+  }
+
+  EXPECT_EQ(ReadAll(stream), body);
+}
+
+UTEST(RequestBodyStream, ZstdTooLarge) {
+  const std::string body(100'000, 'x');
+
+  const std::string buffered_body;
+  RequestBodyStream stream{buffered_body};
+  {
+    auto producer = stream.StartStreaming();
+    stream.SetZstdDecompression(body.size() - 1);
+    ASSERT_TRUE(producer.Push(compression::zstd::Compress(body, 3), {}));
+    stream.SetResult(RequestBodyStream::Result::kComplete);
+  }
+
+  std::string chunk;
+  UEXPECT_THROW(stream.ReadChunk(chunk), server::handlers::ClientError);
+}
+
+USERVER_NAMESPACE_END
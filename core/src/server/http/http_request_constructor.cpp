@@ -4,6 +4,7 @@
 
 #include <algorithm>
 
+#include <userver/engine/impl/pool_allocator.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/server/http/http_status.hpp>
@@ -24,21 +25,16 @@ inline void Strip(const char*& begin, const char*& end) {
   while (begin < end && isspace(end[-1])) --end;
 }
 
-void StripDuplicateStartingSlashes(std::string& s) {
-  if (s.empty() || s[0] != '/') return;
+std::string_view StripDuplicateStartingSlashes(std::string_view s) {
+  if (s.empty() || s[0] != '/') return s;
 
   size_t non_slash_pos = s.find_first_not_of('/');
-  if (non_slash_pos == std::string::npos) {
+  if (non_slash_pos == std::string_view::npos) {
     // all symbols are slashes
     non_slash_pos = s.size();
   }
 
-  if (non_slash_pos == 1) {
-    // fast path, no strip
-    return;
-  }
-
-  s = s.substr(non_slash_pos - 1);
+  return s.substr(non_slash_pos - 1);
 }
 
 }  // namespace
@@ -52,7 +48,11 @@ HttpRequestConstructor::HttpRequestConstructor(
     request::ResponseDataAccounter& data_accounter)
     : config_(config),
       handler_info_index_(handler_info_index),
-      request_(std::make_shared<HttpRequestImpl>(data_accounter)) {}
+      // The request, its response and their inline maps are a single block
+      // taken from the thread-local pool, so that a worker reuses the same
+      // memory for every request instead of going to the global allocator
+      request_(std::allocate_shared<HttpRequestImpl>(
+          engine::impl::PoolAllocator<HttpRequestImpl>{}, data_accounter)) {}
 
 HttpRequestConstructor::~HttpRequestConstructor() = default;
 
@@ -91,8 +91,9 @@ void HttpRequestConstructor::ParseUrl() {
     const auto& str_info = parsed_url_pimpl_->parsed_url
                                .field_data[http_parser_url_fields::UF_PATH];
 
-    request_->request_path_ = request_->url_.substr(str_info.off, str_info.len);
-    StripDuplicateStartingSlashes(request_->request_path_);
+    // The path is copied out of the url only once
+    request_->request_path_ = StripDuplicateStartingSlashes(
+        std::string_view{request_->url_}.substr(str_info.off, str_info.len));
     LOG_TRACE() << "path='" << request_->request_path_ << '\'';
   } else {
     SetStatus(Status::kParseUrlError);
@@ -121,11 +122,14 @@ void HttpRequestConstructor::ParseUrl() {
     config_.parse_args_from_body =
         handler_config.request_config.parse_args_from_body;
     if (handler_config.decompress_request) config_.decompress_request = true;
+    is_body_stream_requested_ = handler_config.request_body_stream;
 
     request_->SetTaskProcessor(handler_info->task_processor);
     request_->SetHttpHandler(handler_info->handler);
     request_->SetHttpHandlerStatistics(
         handler_info->handler.GetRequestStatistics());
+    request_->SetRequestStagesStatistics(
+        handler_info->handler.GetRequestStagesStatistics());
   } else {
     if (match_result.status == MatchRequestResult::Status::kMethodNotAllowed) {
       SetStatus(Status::kMethodNotAllowed);
@@ -167,20 +171,61 @@ void HttpRequestConstructor::AppendHeaderValue(const char* data, size_t size) {
 
 void HttpRequestConstructor::AppendBody(const char* data, size_t size) {
   AccountRequestSize(size);
-  request_->request_body_.append(data, size);
+  if (is_body_streamed_) {
+    PushBody(data, size);
+  } else {
+    request_->request_body_.append(data, size);
+  }
 }
 
 void HttpRequestConstructor::SetIsFinal(bool is_final) {
   request_->is_final_ = is_final;
 }
 
+void HttpRequestConstructor::SetIsMessageComplete() {
+  is_message_complete_ = true;
+}
+
+std::shared_ptr<request::RequestBase>
+HttpRequestConstructor::FinalizeHeaders() {
+  if (!is_body_stream_requested_ || status_ != Status::kOk) return nullptr;
+
+  // The body parts of the finalization are skipped for the streamed body
+  is_body_streamed_ = true;
+  FinalizeImpl();
+  if (status_ != Status::kOk) {
+    is_body_streamed_ = false;
+    return nullptr;
+  }
+
+  LOG_TRACE() << "method=" << request_->GetMethodStr() << ", streamed body";
+  body_producer_.emplace(request_->body_stream_.StartStreaming());
+  CheckStatus();
+  request_->SetParseFinishTime();
+  return request_;
+}
+
 std::shared_ptr<request::RequestBase> HttpRequestConstructor::Finalize() {
+  if (is_body_streamed_) {
+    // The handler is already running, only the end of the body is reported
+    auto result = RequestBodyStream::Result::kIncomplete;
+    if (status_ == Status::kRequestTooLarge) {
+      result = RequestBodyStream::Result::kTooLarge;
+    } else if (is_message_complete_) {
+      result = RequestBodyStream::Result::kComplete;
+    }
+    request_->body_stream_.SetResult(result);
+    body_producer_.reset();
+    return std::move(request_);
+  }
+
   LOG_TRACE() << "method=" << request_->GetMethodStr();
 
   FinalizeImpl();
 
   CheckStatus();
 
+  request_->SetParseFinishTime();
   return std::move(request_);  // request_ is left empty
 }
 
@@ -197,7 +242,7 @@ void HttpRequestConstructor::FinalizeImpl() {
 
   try {
     ParseArgs(*parsed_url_pimpl_);
-    if (config_.parse_args_from_body) {
+    if (config_.parse_args_from_body && !is_body_streamed_) {
       if (!config_.decompress_request || !request_->IsBodyCompressed())
         ParseArgs(request_->request_body_.data(),
                   request_->request_body_.size());
@@ -227,7 +272,7 @@ void HttpRequestConstructor::FinalizeImpl() {
 
   const auto& content_type =
       request_->GetHeader(USERVER_NAMESPACE::http::headers::kContentType);
-  if (IsMultipartFormDataContentType(content_type)) {
+  if (!is_body_streamed_ && IsMultipartFormDataContentType(content_type)) {
     if (!ParseMultipartFormData(content_type, request_->RequestBody(),
                                 request_->form_data_args_)) {
       SetStatus(Status::kParseMultipartFormDataError);
@@ -314,6 +359,22 @@ void HttpRequestConstructor::ParseCookies() {
   }
 }
 
+void HttpRequestConstructor::PushBody(const char* data, size_t size) {
+  // The handler is done and does not read the rest of the body
+  if (!body_producer_) return;
+
+  while (size != 0) {
+    // A part larger than the queue would never fit into it
+    const auto part_size = std::min(size, RequestBodyStream::kBufferSize);
+    if (!body_producer_->Push(std::string(data, part_size), {})) {
+      body_producer_.reset();
+      return;
+    }
+    data += part_size;
+    size -= part_size;
+  }
+}
+
 void HttpRequestConstructor::SetStatus(HttpRequestConstructor::Status status) {
   status_ = status;
 }
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 
 #include <userver/http/parser/http_request_parse_args.hpp>
 #include <userver/server/http/http_method.hpp>
+#include <userver/server/http/http_request_body_stream.hpp>
 #include <userver/server/request/request_config.hpp>
 
 #include <server/request/request_constructor.hpp>
@@ -53,6 +55,12 @@ class HttpRequestConstructor final : public request::RequestConstructor {
   void AppendBody(const char* data, size_t size);
 
   void SetIsFinal(bool is_final);
+  void SetIsMessageComplete();
+
+  // Finalizes the request before its body for the handlers that read the body
+  // as a stream, the body is then pushed to the handler by AppendBody.
+  // Returns nullptr if the body is not streamed.
+  std::shared_ptr<request::RequestBase> FinalizeHeaders();
 
   std::shared_ptr<request::RequestBase> Finalize() override;
 
@@ -65,6 +73,7 @@ class HttpRequestConstructor final : public request::RequestConstructor {
   void ParseArgs(const char* data, size_t size);
   void AddHeader();
   void ParseCookies();
+  void PushBody(const char* data, size_t size);
 
   void SetStatus(Status status);
   void AccountRequestSize(size_t size);
@@ -86,8 +95,13 @@ class HttpRequestConstructor final : public request::RequestConstructor {
   size_t url_size_ = 0;
   size_t headers_size_ = 0;
   bool url_parsed_ = false;
+  bool is_body_stream_requested_ = false;
+  bool is_body_streamed_ = false;
+  bool is_message_complete_ = false;
   Status status_ = Status::kOk;
 
+  std::optional<RequestBodyStream::Queue::Producer> body_producer_;
+
   std::shared_ptr<HttpRequestImpl> request_;
 };
 
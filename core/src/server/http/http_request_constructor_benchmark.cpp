@@ -1,12 +1,62 @@
 #include <benchmark/benchmark.h>
 
+#include <cstdlib>
+#include <new>
+
 #include <server/http/http_request_constructor.hpp>
+#include <server/http/http_request_parser.hpp>
 #include <utils/gbench_auxilary.hpp>
 
+namespace {
+
+thread_local bool is_counting_allocations = false;
+thread_local std::size_t allocations_count = 0;
+
+void* CountedAllocate(std::size_t size, std::size_t alignment) {
+  if (is_counting_allocations) ++allocations_count;
+  if (size == 0) size = 1;
+  void* const ptr =
+      alignment <= alignof(std::max_align_t)
+          ? std::malloc(size)
+          : std::aligned_alloc(alignment,
+                               (size + alignment - 1) / alignment * alignment);
+  if (!ptr) throw std::bad_alloc{};
+  return ptr;
+}
+
+}  // namespace
+
+// Counting the global allocations made while parsing the requests
+void* operator new(std::size_t size) {
+  return CountedAllocate(size, alignof(std::max_align_t));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  return CountedAllocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+  std::free(ptr);
+}
+
 USERVER_NAMESPACE_BEGIN
 
 namespace {
 
+constexpr std::string_view kHttpRequestData =
+    "POST /hello?arg1=value1&arg2=value2 HTTP/1.1\r\n"
+    "Host: localhost:11235\r\nUser-Agent: curl/7.58.0\r\nAccept: */*\r\n"
+    "X-YaRequestId: 4e1cc9b0d5a44e8a8c8d7f3e9e2a1b6c\r\n"
+    "Cookie: session=0123456789abcdef; lang=en\r\n"
+    "Content-type: application/json\r\nContent-Length: 18\r\n\r\n"
+    "{\"hello\": \"world\"}";
+
 void http_request_constructor_url_decode(benchmark::State& state) {
   std::string tmp = "1";
   std::string input;
@@ -16,9 +66,44 @@ void http_request_constructor_url_decode(benchmark::State& state) {
   for ([[maybe_unused]] auto _ : state)
     benchmark::DoNotOptimize(USERVER_NAMESPACE::http::parser::UrlDecode(input));
 }
+
+void http_request_constructor_allocations(benchmark::State& state) {
+  static const server::http::HandlerInfoIndex kTestHandlerInfoIndex;
+  static constexpr server::request::HttpRequestConfig kTestRequestConfig{
+      /*.max_url_size = */ 8192,
+      /*.max_request_size = */ 1024 * 1024,
+      /*.max_headers_size = */ 65536,
+      /*.parse_args_from_body = */ false,
+      /*.testing_mode = */ true,  // non default value
+      /*.decompress_request = */ false,
+  };
+  static server::net::ParserStats test_stats;
+  static server::request::ResponseDataAccounter test_accounter;
+
+  server::http::HttpRequestParser parser(
+      kTestHandlerInfoIndex, kTestRequestConfig,
+      [](std::shared_ptr<server::request::RequestBase>&& request) {
+        benchmark::DoNotOptimize(request);
+      },
+      test_stats, test_accounter);
+
+  allocations_count = 0;
+  is_counting_allocations = true;
+  for ([[maybe_unused]] auto _ : state) {
+    parser.Parse(kHttpRequestData.data(), kHttpRequestData.size());
+  }
+  is_counting_allocations = false;
+
+  state.counters["allocs/request"] =
+      benchmark::Counter(static_cast<double>(allocations_count),
+                         benchmark::Counter::kAvgIterations);
+}
+
 }  // namespace
+
 BENCHMARK(http_request_constructor_url_decode)
     ->RangeMultiplier(2)
     ->Range(1, 1024);
+BENCHMARK(http_request_constructor_allocations);
 
 USERVER_NAMESPACE_END
@@ -15,4 +15,9 @@ TEST(HttpRequestConstructor, DecodeUrlPlus) {
   EXPECT_EQ("Some String", http::parser::UrlDecode(str));
 }
 
+TEST(HttpRequestConstructor, DecodeUrlMixed) {
+  std::string str = "%41bc+%64e%66++gh%2B";
+  EXPECT_EQ("Abc def  gh+", http::parser::UrlDecode(str));
+}
+
 USERVER_NAMESPACE_END
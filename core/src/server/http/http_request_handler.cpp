@@ -2,7 +2,11 @@
 
 #include <chrono>
 #include <stdexcept>
+#include <utility>
 
+#include <fmt/format.h>
+
+#include <congestion_control/adaptive_concurrency_limiter.hpp>
 #include <server/handlers/http_handler_base_statistics.hpp>
 #include <server/handlers/http_server_settings.hpp>
 #include <server/request/task_inherited_request_impl.hpp>
@@ -10,6 +14,7 @@
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/task/task_base.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/logging/component.hpp>
 #include <userver/server/http/http_response.hpp>
@@ -32,6 +37,8 @@ engine::TaskWithResult<void> StartFailsafeTask(
   static handlers::HttpRequestStatistics dummy_statistics;
 
   http_request.SetHttpHandlerStatistics(dummy_statistics);
+  // The handler does not read the streamed body, the connection drops it
+  http_request.GetBodyStream().Close();
 
   return engine::AsyncNoSpan([request = std::move(request), handler]() {
     request->SetTaskStartTime();
@@ -41,6 +48,28 @@ engine::TaskWithResult<void> StartFailsafeTask(
   });
 }
 
+// Lets the connection drop the rest of the streamed request body once the
+// handler is done, even if the task was cancelled before the start
+class RequestBodyStreamCloser final {
+ public:
+  explicit RequestBodyStreamCloser(const HttpRequestImpl& request)
+      : body_stream_(request.GetBodyStream().IsStreamed()
+                         ? &request.GetBodyStream()
+                         : nullptr) {}
+
+  RequestBodyStreamCloser(RequestBodyStreamCloser&& other) noexcept
+      : body_stream_(std::exchange(other.body_stream_, nullptr)) {}
+
+  RequestBodyStreamCloser& operator=(RequestBodyStreamCloser&&) = delete;
+
+  ~RequestBodyStreamCloser() {
+    if (body_stream_) body_stream_->Close();
+  }
+
+ private:
+  RequestBodyStream* body_stream_;
+};
+
 }  // namespace
 
 HttpRequestHandler::HttpRequestHandler(
@@ -103,6 +132,10 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(
 
   auto* task_processor = http_request.GetTaskProcessor();
   const auto* handler = http_request.GetHttpHandler();
+  if (task_processor && run_on_connection_task_processor_) {
+    // Called by the connection task
+    task_processor = &engine::current_task::GetTaskProcessor();
+  }
   if (!task_processor || !handler) {
     // No handler found, response status is already set
     // by HttpRequestConstructor::CheckStatus
@@ -129,7 +162,7 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(
     const auto& delta = config_var.max_time_delta;
 
     auto status = HttpStatus::kTooManyRequests;
-    if (cc_enabled_tp_ > std::chrono::steady_clock::now() - delta) {
+    if (cc_enabled_tp_ > utils::datetime::SteadyCoarseClock::now() - delta) {
       status = config_var.initial_status_code;
       metrics_->GetMetric(kCcStatusCodeIsCustom) = 1;
     } else {
@@ -154,6 +187,31 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(
     return StartFailsafeTask(std::move(request));
   }
 
+  std::optional<
+      USERVER_NAMESPACE::congestion_control::AdaptiveConcurrencyLimiter::Token>
+      concurrency_token;
+  if (auto* limiter = handler->GetConcurrencyLimiter();
+      limiter && throttling_enabled) {
+    concurrency_token = limiter->TryAcquire();
+    if (!concurrency_token) {
+      SetThrottleReason(http_response,
+                        fmt::format("reached adaptive concurrency limit={}",
+                                    limiter->GetLimit()),
+                        std::string{USERVER_NAMESPACE::http::headers::
+                                        ratelimit_reason::kAdaptiveConcurrency});
+
+      http_response.SetStatus(HttpStatus::kTooManyRequests);
+      http_response.SetReady();
+
+      LOG_LIMITED_WARNING()
+          << "Request throttled (adaptive concurrency limit of the handler), "
+          << "limit=" << limiter->GetLimit()
+          << ", url=" << http_request.GetUrl();
+
+      return StartFailsafeTask(std::move(request));
+    }
+  }
+
   // config::operator[] && is forbidden, so this
   const auto get_config_stream_api_enabled = [this] {
     const auto config = config_source_.GetSnapshot();
@@ -164,7 +222,13 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(
     http_response.SetStreamBody();
   }
 
-  auto payload = [request = std::move(request), handler] {
+  // The connection keeps the request alive until the task is done
+  RequestBodyStreamCloser body_stream_closer{http_request};
+
+  auto payload = [request = std::move(request), handler,
+                  concurrency_token = std::move(concurrency_token),
+                  body_stream_closer =
+                      std::move(body_stream_closer)]() mutable {
     server::request::kTaskInheritedRequest.Set(
         std::static_pointer_cast<HttpRequestImpl>(request));
 
@@ -176,6 +240,8 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(
     const auto now = std::chrono::steady_clock::now();
     request->SetResponseNotifyTime(now);
     request->GetResponse().SetReady(now);
+
+    if (concurrency_token) concurrency_token->Finish();
   };
 
   if (!is_monitor_ && throttling_enabled) {
@@ -218,10 +284,15 @@ void HttpRequestHandler::SetNewRequestHook(NewRequestHook hook) {
   new_request_hook_ = std::move(hook);
 }
 
+void HttpRequestHandler::SetRunOnConnectionTaskProcessor(bool value) {
+  UASSERT_MSG(!add_handler_disabled_, "server is already started");
+  run_on_connection_task_processor_ = value;
+}
+
 void HttpRequestHandler::SetRpsRatelimit(std::optional<size_t> rps) {
   if (rps) {
     if (rate_limit_.IsUnbounded()) {
-      cc_enabled_tp_ = std::chrono::steady_clock::now();
+      cc_enabled_tp_ = utils::datetime::SteadyCoarseClock::now();
       metrics_->GetMetric(kCcStatusCodeIsCustom) = 0;
     }
 
@@ -9,6 +9,7 @@
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/server/handlers/handler_base.hpp>
 #include <userver/server/request/request_base.hpp>
+#include <userver/utils/datetime/steady_coarse_clock.hpp>
 #include <userver/utils/statistics/metrics_storage.hpp>
 #include <userver/utils/token_bucket.hpp>
 
@@ -30,6 +31,10 @@ class HttpRequestHandler final : public RequestHandlerBase {
       std::function<void(std::shared_ptr<request::RequestBase>)>;
   void SetNewRequestHook(NewRequestHook hook);
 
+  // Run the handlers on the task processor of the connection instead of
+  // the task processors of the handlers
+  void SetRunOnConnectionTaskProcessor(bool value);
+
   engine::TaskWithResult<void> StartRequestTask(
       std::shared_ptr<request::RequestBase> request) const override;
 
@@ -64,9 +69,10 @@ class HttpRequestHandler final : public RequestHandlerBase {
   const bool is_monitor_;
   const std::string server_name_;
   NewRequestHook new_request_hook_;
+  bool run_on_connection_task_processor_{false};
   mutable utils::TokenBucket rate_limit_;
   std::atomic<HttpStatus> cc_status_code_{HttpStatus::kTooManyRequests};
-  std::chrono::steady_clock::time_point cc_enabled_tp_;
+  utils::datetime::SteadyCoarseClock::time_point cc_enabled_tp_;
   utils::statistics::MetricsStoragePtr metrics_;
   dynamic_config::Source config_source_;
 };
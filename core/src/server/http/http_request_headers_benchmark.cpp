@@ -40,6 +40,16 @@ void http_request_headers_insert(benchmark::State& state) {
   }
 }
 
+void http_request_headers_copy(benchmark::State& state) {
+  server::http::HttpRequest::HeadersMap map;
+  for (int i = 0; i < state.range(0); i++) map[kHeadersArray[i]] = "1";
+
+  for ([[maybe_unused]] auto _ : state) {
+    auto copy = map;
+    benchmark::DoNotOptimize(copy);
+  }
+}
+
 void http_request_headers_get(benchmark::State& state) {
   server::http::HttpRequest::HeadersMap map;
   for (const auto& header : kHeadersArray) map[header] = "1";
@@ -56,6 +66,10 @@ BENCHMARK(http_request_headers_insert)
     ->RangeMultiplier(2)
     ->Range(1, kHeadersCount);
 
+BENCHMARK(http_request_headers_copy)
+    ->RangeMultiplier(2)
+    ->Range(1, kHeadersCount);
+
 BENCHMARK(http_request_headers_get);
 
 USERVER_NAMESPACE_END
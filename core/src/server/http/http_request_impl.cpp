@@ -7,6 +7,7 @@
 #include <userver/http/parser/http_request_parse_args.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/logger.hpp>
+#include <userver/server/handlers/http_handler_base.hpp>
 #include <userver/utils/datetime.hpp>
 #include <userver/utils/encoding/tskv.hpp>
 
@@ -302,6 +303,39 @@ void HttpRequestImpl::AccountResponseTime() {
       finish_send_response_time_ - start_time_);
   request_statistics_->ForMethod(GetMethod())
       .Account(handlers::HttpRequestStatisticsEntry{timing});
+  if (request_stages_statistics_) {
+    request_stages_statistics_->Account(GetStageTimings());
+  }
+}
+
+request::RequestStageTimings HttpRequestImpl::GetStageTimings() const {
+  using request::RequestStage;
+
+  request::RequestStageTimings timings;
+  timings.Set(RequestStage::kAccept, connection_accept_time_,
+              connection_start_time_);
+  timings.Set(RequestStage::kTlsHandshake, connection_start_time_,
+              connection_ready_time_);
+  timings.Set(RequestStage::kRead, start_time_, parse_finish_time_);
+  timings.Set(RequestStage::kDispatch, parse_finish_time_, task_create_time_);
+  timings.Set(RequestStage::kQueue, task_create_time_, task_start_time_);
+  if (handler_start_time_ != std::chrono::steady_clock::time_point{}) {
+    timings.Add(RequestStage::kMiddlewares, task_start_time_,
+                handler_start_time_);
+    timings.Add(RequestStage::kMiddlewares, handler_finish_time_,
+                response_notify_time_);
+    timings.Set(RequestStage::kHandler, handler_start_time_,
+                handler_finish_time_);
+  } else {
+    // A middleware has responded without calling the handler
+    timings.Set(RequestStage::kMiddlewares, task_start_time_,
+                response_notify_time_);
+  }
+  timings.Set(RequestStage::kResponseQueue, response_notify_time_,
+              start_send_response_time_);
+  timings.Set(RequestStage::kSend, start_send_response_time_,
+              finish_send_response_time_);
+  return timings;
 }
 
 void HttpRequestImpl::MarkAsInternalServerError() const {
@@ -332,6 +366,11 @@ void HttpRequestImpl::SetHttpHandlerStatistics(
   request_statistics_ = &stats;
 }
 
+void HttpRequestImpl::SetRequestStagesStatistics(
+    handlers::HttpRequestStagesStatistics* stats) {
+  request_stages_statistics_ = stats;
+}
+
 void HttpRequestImpl::WriteAccessLogs(
     const logging::LoggerPtr& logger_access,
     const logging::LoggerPtr& logger_access_tskv,
@@ -339,20 +378,24 @@ void HttpRequestImpl::WriteAccessLogs(
   if (!logger_access && !logger_access_tskv) return;
 
   const auto tp = utils::datetime::WallCoarseClock::now();
-  WriteAccessLog(logger_access, tp, remote_address);
-  WriteAccessTskvLog(logger_access_tskv, tp, remote_address);
+  const auto stages =
+      handler_ && handler_->GetConfig().request_stages_access_log
+          ? GetStageTimings().ToString()
+          : std::string{};
+  WriteAccessLog(logger_access, tp, remote_address, stages);
+  WriteAccessTskvLog(logger_access_tskv, tp, remote_address, stages);
 }
 
 void HttpRequestImpl::WriteAccessLog(
     const logging::LoggerPtr& logger_access,
     utils::datetime::WallCoarseClock::time_point tp,
-    const std::string& remote_address) const {
+    const std::string& remote_address, std::string_view stages) const {
   if (!logger_access) return;
 
   logger_access->Log(
       logging::Level::kInfo,
       fmt::format(
-          R"([{}] {} {} "{} {} HTTP/{}.{}" {} "{}" "{}" "{}" {:0.6f} - {} {:0.6f})",
+          R"([{}] {} {} "{} {} HTTP/{}.{}" {} "{}" "{}" "{}" {:0.6f} - {} {:0.6f}{}{})",
           utils::datetime::LocalTimezoneTimestring(tp,
                                                    "%Y-%m-%d %H:%M:%E6S %Ez"),
           EscapeForAccessLog(GetHost()), EscapeForAccessLog(remote_address),
@@ -362,13 +405,14 @@ void HttpRequestImpl::WriteAccessLog(
           EscapeForAccessLog(GetHeader("Referer")),
           EscapeForAccessLog(GetHeader("User-Agent")),
           EscapeForAccessLog(GetHeader("Cookie")), GetRequestTime().count(),
-          GetResponse().BytesSent(), GetResponseTime().count()));
+          GetResponse().BytesSent(), GetResponseTime().count(),
+          stages.empty() ? "" : " ", stages));
 }
 
 void HttpRequestImpl::WriteAccessTskvLog(
     const logging::LoggerPtr& logger_access_tskv,
     utils::datetime::WallCoarseClock::time_point tp,
-    const std::string& remote_address) const {
+    const std::string& remote_address, std::string_view stages) const {
   if (!logger_access_tskv) return;
 
   logger_access_tskv->Log(
@@ -391,7 +435,8 @@ void HttpRequestImpl::WriteAccessTskvLog(
                   "\tremote_addr={}"
                   "\trequest_time={:0.3f}"
                   "\tupstream_response_time={:0.3f}"
-                  "\trequest_body={}",
+                  "\trequest_body={}"
+                  "{}{}",
                   utils::datetime::LocalTimezoneTimestring(
                       tp, "timestamp=%Y-%m-%dT%H:%M:%S\ttimezone=%Ez"),
                   static_cast<int>(response_.GetStatus()), GetHttpMajor(),
@@ -408,7 +453,8 @@ void HttpRequestImpl::WriteAccessTskvLog(
                   EscapeForAccessTskvLog(GetHost()),
                   EscapeForAccessTskvLog(remote_address),
                   GetRequestTime().count(), GetResponseTime().count(),
-                  EscapeForAccessTskvLog(RequestBody())));
+                  EscapeForAccessTskvLog(RequestBody()),
+                  stages.empty() ? "" : "\trequest_stages=", stages));
 }
 
 }  // namespace server::http
@@ -6,10 +6,12 @@
 #include <unordered_map>
 #include <vector>
 
+#include <server/request/request_stages.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 
 #include <userver/server/http/http_method.hpp>
 #include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_request_body_stream.hpp>
 #include <userver/server/http/http_response.hpp>
 #include <userver/server/request/request_base.hpp>
 #include <userver/utils/datetime/wall_coarse_clock.hpp>
@@ -21,6 +23,7 @@ USERVER_NAMESPACE_BEGIN
 namespace server {
 namespace handlers {
 class HttpRequestStatistics;
+class HttpRequestStagesStatistics;
 class HttpHandlerBase;
 }  // namespace handlers
 
@@ -85,6 +88,7 @@ class HttpRequestImpl final : public request::RequestBase {
   const std::string& RequestBody() const { return request_body_; }
   void SetRequestBody(std::string body);
   void ParseArgsFromBody();
+  RequestBodyStream& GetBodyStream() const { return body_stream_; }
   void SetResponseStatus(HttpStatus status) const {
     response_.SetStatus(status);
   }
@@ -114,11 +118,15 @@ class HttpRequestImpl final : public request::RequestBase {
 
   void WriteAccessLog(const logging::LoggerPtr& logger_access,
                       utils::datetime::WallCoarseClock::time_point tp,
-                      const std::string& remote_address) const;
+                      const std::string& remote_address,
+                      std::string_view stages) const;
 
   void WriteAccessTskvLog(const logging::LoggerPtr& logger_access_tskv,
                           utils::datetime::WallCoarseClock::time_point tp,
-                          const std::string& remote_address) const;
+                          const std::string& remote_address,
+                          std::string_view stages) const;
+
+  request::RequestStageTimings GetStageTimings() const;
 
   void SetPathArgs(std::vector<std::pair<std::string, std::string>> args);
 
@@ -136,6 +144,8 @@ class HttpRequestImpl final : public request::RequestBase {
 
   void SetHttpHandlerStatistics(handlers::HttpRequestStatistics&);
 
+  void SetRequestStagesStatistics(handlers::HttpRequestStagesStatistics*);
+
   friend class HttpRequestConstructor;
 
  private:
@@ -145,6 +155,7 @@ class HttpRequestImpl final : public request::RequestBase {
   std::string url_;
   std::string request_path_;
   std::string request_body_;
+  mutable RequestBodyStream body_stream_{request_body_};
   std::string path_suffix_;
   utils::impl::TransparentMap<std::string, std::vector<std::string>,
                               utils::StrCaseHash>
@@ -164,6 +175,7 @@ class HttpRequestImpl final : public request::RequestBase {
   engine::TaskProcessor* task_processor_{nullptr};
   const handlers::HttpHandlerBase* handler_{nullptr};
   handlers::HttpRequestStatistics* request_statistics_{nullptr};
+  handlers::HttpRequestStagesStatistics* request_stages_statistics_{nullptr};
 };
 
 }  // namespace http
@@ -53,10 +53,12 @@ HttpRequestParser::HttpRequestParser(
     const HandlerInfoIndex& handler_info_index,
     const request::HttpRequestConfig& request_config,
     OnNewRequestCb&& on_new_request_cb, net::ParserStats& stats,
-    request::ResponseDataAccounter& data_accounter)
+    request::ResponseDataAccounter& data_accounter,
+    OnNewRequestCb&& on_streamed_request_cb)
     : handler_info_index_(handler_info_index),
       request_constructor_config_{request_config},
       on_new_request_cb_(std::move(on_new_request_cb)),
+      on_streamed_request_cb_(std::move(on_streamed_request_cb)),
       stats_(stats),
       data_accounter_(data_accounter) {
   llhttp_init(&parser_, HTTP_REQUEST, &parser_settings);
@@ -182,6 +184,20 @@ int HttpRequestParser::OnHeadersCompleteImpl(llhttp_t* p) {
     return -1;
   }
   LOG_TRACE() << "headers complete";
+
+  const bool has_body =
+      (p->flags & F_CHUNKED) != 0 ||
+      ((p->flags & F_CONTENT_LENGTH) != 0 && p->content_length != 0);
+  if (on_streamed_request_cb_ && has_body) {
+    try {
+      if (auto request = request_constructor_->FinalizeHeaders()) {
+        on_streamed_request_cb_(std::move(request));
+      }
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "can't start the streamed request: " << ex;
+      return -1;
+    }
+  }
   return 0;
 }
 
@@ -204,6 +220,7 @@ int HttpRequestParser::OnMessageCompleteImpl(llhttp_t* p) {
     return -1;  // error
   }
   request_constructor_->SetIsFinal(!llhttp_should_keep_alive(p));
+  request_constructor_->SetIsMessageComplete();
   if (!CheckUrlComplete(p)) return -1;
   LOG_TRACE() << "message complete";
   if (!FinalizeRequest()) return -1;
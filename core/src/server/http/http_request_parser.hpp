@@ -23,10 +23,14 @@ class HttpRequestParser final : public request::RequestParser {
   using OnNewRequestCb =
       std::function<void(std::shared_ptr<request::RequestBase>&&)>;
 
+  // `on_streamed_request_cb` is called right after the headers of the
+  // requests to the handlers that read the body as a stream. Such requests are
+  // passed to `on_new_request_cb` once more after the end of the body.
   HttpRequestParser(const HandlerInfoIndex& handler_info_index,
                     const request::HttpRequestConfig& request_config,
                     OnNewRequestCb&& on_new_request_cb, net::ParserStats& stats,
-                    request::ResponseDataAccounter& data_accounter);
+                    request::ResponseDataAccounter& data_accounter,
+                    OnNewRequestCb&& on_streamed_request_cb = {});
 
   HttpRequestParser(HttpRequestParser&&) = delete;
   HttpRequestParser& operator=(HttpRequestParser&&) = delete;
@@ -63,6 +67,7 @@ class HttpRequestParser final : public request::RequestParser {
   bool url_complete_ = false;
 
   OnNewRequestCb on_new_request_cb_;
+  OnNewRequestCb on_streamed_request_cb_;
 
   llhttp_t parser_{};
   std::optional<HttpRequestConstructor> request_constructor_;
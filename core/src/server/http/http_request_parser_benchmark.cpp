@@ -107,10 +107,36 @@ void http_request_parser_parse_benchmark_many_headers(benchmark::State& state) {
   }
 }
 
+void http_request_parser_parse_benchmark_browser_headers(
+    benchmark::State& state) {
+  auto parser = CreateBenchmarkParser(
+      [](std::shared_ptr<server::request::RequestBase>&&) {});
+
+  // Long values are scanned by the vectorized paths of the parser
+  const std::string_view http_request_data =
+      "GET /api/v1/profile HTTP/1.1\r\n"
+      "Host: www.example.com\r\n"
+      "User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, "
+      "like Gecko) Chrome/120.0.0.0 Safari/537.36\r\n"
+      "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,image/"
+      "avif,image/webp,*/*;q=0.8\r\n"
+      "Accept-Language: en-US,en;q=0.9,ru;q=0.8\r\n"
+      "Accept-Encoding: gzip, deflate, br\r\n"
+      "Referer: https://www.example.com/some/long/path/to/the/previous/page\r\n"
+      "Cookie: session=0123456789abcdef0123456789abcdef; theme=dark; "
+      "tracking=ffffffffffffffffffffffffffffffffffffffff\r\n"
+      "X-Request-Id: 4e1cc9b0d5a44e8a8c8d7f3e9e2a1b6c\r\n\r\n";
+
+  for ([[maybe_unused]] auto _ : state) {
+    parser.Parse(http_request_data.data(), http_request_data.size());
+  }
+}
+
 BENCHMARK(http_request_parser_parse_benchmark_small);
 BENCHMARK(http_request_parser_parse_benchmark_middle);
 BENCHMARK(http_request_parser_parse_benchmark_large_url);
 BENCHMARK(http_request_parser_parse_benchmark_large_body);
 BENCHMARK(http_request_parser_parse_benchmark_many_headers);
+BENCHMARK(http_request_parser_parse_benchmark_browser_headers);
 
 USERVER_NAMESPACE_END
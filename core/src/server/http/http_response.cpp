@@ -1,6 +1,7 @@
 #include <userver/server/http/http_response.hpp>
 
 #include <array>
+#include <optional>
 
 #include <cctz/time_zone.h>
 #include <fmt/compile.h>
@@ -89,6 +90,20 @@ bool IsBodyForbiddenForStatus(server::http::HttpStatus status) {
          (static_cast<int>(status) >= 100 && static_cast<int>(status) < 200);
 }
 
+// HTTP/2 requires lowercase names and forbids the connection-specific headers
+std::optional<std::string> ToHttp2HeaderName(std::string_view name) {
+  std::string result{name};
+  for (auto& c : result) {
+    if (c >= 'A' && c <= 'Z') c = c - 'A' + 'a';
+  }
+  if (result == "connection" || result == "keep-alive" ||
+      result == "proxy-connection" || result == "transfer-encoding" ||
+      result == "upgrade" || result == "content-length") {
+    return std::nullopt;
+  }
+  return result;
+}
+
 void AppendToCharArray(char*& data, const std::string_view what) {
   std::memcpy(data, what.begin(), what.size());
   data += what.size();
@@ -256,6 +271,13 @@ const Cookie& HttpResponse::GetCookie(std::string_view cookie_name) const {
   return cookies_.at(cookie_name.data());
 }
 
+void HttpResponse::SetSharedData(std::shared_ptr<const void> owner,
+                                 std::string_view data) {
+  UASSERT(owner || data.empty());
+  shared_data_owner_ = std::move(owner);
+  shared_data_ = data;
+}
+
 void HttpResponse::SetHeadersEnd() { headers_end_.Send(); }
 
 bool HttpResponse::WaitForHeadersEnd() { return headers_end_.WaitForEvent(); }
@@ -331,7 +353,7 @@ std::size_t HttpResponse::SetBodyNotStreamed(
     USERVER_NAMESPACE::http::headers::HeadersString& header) {
   const bool is_body_forbidden = IsBodyForbiddenForStatus(status_);
   const bool is_head_request = request_.GetMethod() == HttpMethod::kHead;
-  const auto& data = GetData();
+  const auto data = GetBodyToSend();
 
   if (!is_body_forbidden) {
     impl::OutputHeader(header, USERVER_NAMESPACE::http::headers::kContentLength,
@@ -390,11 +412,17 @@ std::size_t HttpResponse::SetBodyStreamed(
       continue;
     }
 
-    auto size = first_chunk_processed
-                    ? fmt::format("\r\n{:x}\r\n", body_part.size())
-                    : fmt::format("{:x}\r\n", body_part.size());
+    // CRLF, up to 16 hex digits, CRLF
+    std::array<char, 20> size;
+    const auto* const size_end =
+        first_chunk_processed
+            ? fmt::format_to(size.data(), FMT_COMPILE("\r\n{:x}\r\n"),
+                             body_part.size())
+            : fmt::format_to(size.data(), FMT_COMPILE("{:x}\r\n"),
+                             body_part.size());
     sent_bytes += socket.WriteAll(
-        {{size.data(), size.size()}, {body_part.data(), body_part.size()}},
+        {{size.data(), static_cast<std::size_t>(size_end - size.data())},
+         {body_part.data(), body_part.size()}},
         engine::Deadline{});
 
     first_chunk_processed = true;
@@ -412,6 +440,67 @@ std::size_t HttpResponse::SetBodyStreamed(
   return sent_bytes;
 }
 
+std::string_view HttpResponse::GetBodyToSend() const {
+  const auto& data = GetData();
+  if (data.empty() && shared_data_owner_) return shared_data_;
+  return data;
+}
+
+void HttpResponse::ReadStreamedBodyToData() {
+  if (!IsBodyStreamed() || !GetData().empty() || !body_stream_) return;
+
+  std::string body;
+  std::string body_part;
+  while (body_stream_->Pop(body_part)) body.append(body_part);
+
+  body_stream_producer_.reset();
+  body_stream_.reset();
+  SetData(std::move(body));
+}
+
+std::string_view HttpResponse::PrepareHttp2Response(
+    std::vector<std::pair<std::string, std::string>>& headers) {
+  const bool is_body_forbidden = IsBodyForbiddenForStatus(status_);
+  const bool is_head_request = request_.GetMethod() == HttpMethod::kHead;
+  const auto data = GetBodyToSend();
+
+  headers.reserve(headers_.size() + cookies_.size() + 4);
+  headers.emplace_back(":status", fmt::format(FMT_COMPILE("{}"),
+                                              static_cast<int>(status_)));
+
+  const auto end = headers_.end();
+  if (headers_.find(USERVER_NAMESPACE::http::headers::kDate) == end) {
+    headers.emplace_back("date", impl::GetCachedDate());
+  }
+  if (headers_.find(USERVER_NAMESPACE::http::headers::kContentType) == end) {
+    headers.emplace_back("content-type", kDefaultContentType);
+  }
+  for (const auto& [name, value] : headers_) {
+    if (auto http2_name = ToHttp2HeaderName(name)) {
+      headers.emplace_back(std::move(*http2_name), value);
+    }
+  }
+  for (const auto& cookie : cookies_) {
+    USERVER_NAMESPACE::http::headers::HeadersString value;
+    cookie.second.AppendToString(value);
+    headers.emplace_back("set-cookie", std::string{value.data(), value.size()});
+  }
+  if (!is_body_forbidden) {
+    headers.emplace_back("content-length",
+                         fmt::format(FMT_COMPILE("{}"), data.size()));
+  }
+
+  if (is_body_forbidden && !data.empty()) {
+    LOG_LIMITED_WARNING()
+        << "Non-empty body provided for response with HTTP code "
+        << static_cast<int>(status_)
+        << " which does not allow one, it will be dropped";
+  }
+
+  if (is_head_request || is_body_forbidden) return {};
+  return data;
+}
+
 void SetThrottleReason(http::HttpResponse& http_response,
                        std::string log_reason, std::string http_header_reason) {
   http_response.SetHeader(
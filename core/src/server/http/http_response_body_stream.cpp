@@ -1,7 +1,10 @@
 #include <userver/server/http/http_response_body_stream.hpp>
 
+#include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <server/middlewares/compression.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::http {
@@ -12,10 +15,30 @@ ResponseBodyStream::ResponseBodyStream(
     : queue_producer_(std::move(queue_producer)),
       http_response_(http_response) {}
 
+ResponseBodyStream::~ResponseBodyStream() {
+  if (!compressor_ || !headers_ended_) return;
+
+  // Ends the zstd frame before the end of the body
+  try {
+    auto trailer = compressor_->Finish();
+    if (!trailer.empty()) {
+      [[maybe_unused]] const auto success =
+          queue_producer_.Push(std::move(trailer), engine::Deadline{});
+    }
+  } catch (const std::exception& e) {
+    LOG_ERROR() << "Failed to finish the compressed response body: " << e;
+  }
+}
+
 void ResponseBodyStream::PushBodyChunk(std::string&& chunk,
                                        engine::Deadline deadline) {
   UASSERT_MSG(headers_ended_,
               "SetEndOfHeaders() was not called before PushBodyChunk()");
+  if (compressor_) {
+    auto compressed = compressor_->Compress(chunk);
+    compressed += compressor_->Flush();
+    chunk = std::move(compressed);
+  }
   const auto success = queue_producer_.Push(std::move(chunk), deadline);
   UASSERT(success);
 }
@@ -43,6 +66,14 @@ void ResponseBodyStream::SetStatusCode(HttpStatus status) {
   http_response_.SetStatus(status);
 }
 
+void ResponseBodyStream::SetZstdCompression(int level) {
+  UASSERT_MSG(!headers_ended_,
+              "SetZstdCompression() must be called before SetEndOfHeaders()");
+  compressor_ = std::make_unique<compression::zstd::Compressor>(level);
+  http_response_.SetContentEncoding("zstd");
+  middlewares::AddVaryAcceptEncoding(http_response_);
+}
+
 }  // namespace server::http
 
 USERVER_NAMESPACE_END
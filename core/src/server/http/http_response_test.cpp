@@ -1,3 +1,4 @@
+#include <memory>
 #include <string_view>
 #include <vector>
 
@@ -46,6 +47,63 @@ UTEST(HttpResponse, Smoke) {
             fmt::format("\r\n\r\n{}", kBody));
 }
 
+UTEST(HttpResponse, SharedData) {
+  const auto test_deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  server::request::ResponseDataAccounter accounter;
+  server::http::HttpRequestImpl request{accounter};
+  server::http::HttpResponse response{request, accounter};
+
+  const auto body = std::make_shared<const std::string>("shared data");
+  response.SetSharedData(body, *body);
+  EXPECT_TRUE(response.GetData().empty());
+
+  auto [server, client] =
+      internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+  auto send_task = engine::AsyncNoSpan(
+      [](auto&& response, auto&& socket) { response.SendResponse(socket); },
+      std::ref(response), std::move(server));
+
+  std::vector<char> buffer(4096, '\0');
+  const auto reply_size =
+      client.RecvAll(buffer.data(), buffer.size(), test_deadline);
+
+  std::string_view reply{buffer.data(), reply_size};
+  const auto expected_content_length = fmt::format(
+      "\r\n{}: {}\r\n", http::headers::kContentLength, body->size());
+  EXPECT_TRUE(reply.find(expected_content_length) != std::string_view::npos);
+  EXPECT_EQ(reply.substr(reply.size() - body->size()), *body);
+}
+
+UTEST(HttpResponse, DataOverridesSharedData) {
+  const auto test_deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  server::request::ResponseDataAccounter accounter;
+  server::http::HttpRequestImpl request{accounter};
+  server::http::HttpResponse response{request, accounter};
+
+  const auto body = std::make_shared<const std::string>("shared data");
+  response.SetSharedData(body, *body);
+  constexpr std::string_view kError = "error";
+  response.SetData(std::string{kError});
+
+  auto [server, client] =
+      internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+  auto send_task = engine::AsyncNoSpan(
+      [](auto&& response, auto&& socket) { response.SendResponse(socket); },
+      std::ref(response), std::move(server));
+
+  std::vector<char> buffer(4096, '\0');
+  const auto reply_size =
+      client.RecvAll(buffer.data(), buffer.size(), test_deadline);
+
+  std::string_view reply{buffer.data(), reply_size};
+  EXPECT_EQ(reply.find(*body), std::string_view::npos);
+  EXPECT_EQ(reply.substr(reply.size() - kError.size()), kError);
+}
+
 UTEST(HttpResponse, AccounterLifetimeIfNotSent) {
   auto accounter = std::make_unique<server::request::ResponseDataAccounter>();
   const server::http::HttpRequestImpl request{*accounter};
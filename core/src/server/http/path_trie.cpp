@@ -0,0 +1,19 @@
+#include <server/http/path_trie.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+void SplitPathBySlash(std::string_view path, PathSegments& segments) {
+  segments.clear();
+  while (true) {
+    const auto pos = path.find('/');
+    segments.push_back(path.substr(0, pos));
+    if (pos == std::string_view::npos) break;
+    path.remove_prefix(pos + 1);
+  }
+}
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <boost/container/small_vector.hpp>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/impl/transparent_hash.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+/// Request path split by '/', the views point into the path
+using PathSegments = boost::container::small_vector<std::string_view, 16>;
+
+void SplitPathBySlash(std::string_view path, PathSegments& segments);
+
+/// @brief Trie over the '/'-separated segments of path templates.
+///
+/// A template segment is either fixed, or a wildcard (`{name}`), or the
+/// trailing `*` that matches any suffix of at least one segment. The request
+/// path is matched in a single depth-first pass that prefers a fixed segment
+/// to a wildcard and a wildcard to `*` at every position, and the longest
+/// `*` prefix among the `*` routes.
+template <typename Payload>
+class PathTrie final {
+ public:
+  struct MatchResult {
+    const Payload* payload{nullptr};
+    /// The first segment matched by `*`, if the route ends with it
+    std::optional<std::size_t> any_suffix_start;
+  };
+
+  /// Returns the payload of the template, default constructed for a new one
+  Payload& Insert(std::string_view path_template) {
+    PathSegments segments;
+    SplitPathBySlash(path_template, segments);
+
+    Node* node = &root_;
+    for (std::size_t i = 0; i < segments.size(); ++i) {
+      const auto segment = segments[i];
+      if (i + 1 == segments.size() && segment == kAnySuffix) {
+        return Emplace(node->any_suffix);
+      }
+      if (IsWildcard(segment)) {
+        if (!node->wildcard) node->wildcard = std::make_unique<Node>();
+        node = node->wildcard.get();
+      } else {
+        auto& next = node->fixed[std::string{segment}];
+        if (!next) next = std::make_unique<Node>();
+        node = next.get();
+      }
+    }
+    return Emplace(node->payload);
+  }
+
+  /// @brief Matches the split request path. The matched payloads are passed
+  /// to `accept` until it returns true, e.g. for the allowed HTTP method.
+  template <typename Accept>
+  MatchResult Match(const PathSegments& segments, Accept&& accept) const {
+    MatchResult result;
+    Match(root_, segments, 0, accept, result);
+    return result;
+  }
+
+ private:
+  static constexpr std::string_view kAnySuffix = "*";
+
+  struct Node {
+    utils::impl::TransparentMap<std::string, std::unique_ptr<Node>> fixed;
+    std::unique_ptr<Node> wildcard;
+    std::optional<Payload> payload;
+    std::optional<Payload> any_suffix;
+  };
+
+  static bool IsWildcard(std::string_view segment) {
+    return segment.find('{') != std::string_view::npos ||
+           segment.find('}') != std::string_view::npos;
+  }
+
+  static Payload& Emplace(std::optional<Payload>& payload) {
+    if (!payload) payload.emplace();
+    return *payload;
+  }
+
+  template <typename Accept>
+  static bool Match(const Node& node, const PathSegments& segments,
+                    std::size_t depth, Accept& accept, MatchResult& result) {
+    if (depth == segments.size()) {
+      if (node.payload && accept(*node.payload)) {
+        result.payload = &*node.payload;
+        return true;
+      }
+      return false;
+    }
+
+    const auto* fixed =
+        utils::impl::FindTransparentOrNullptr(node.fixed, segments[depth]);
+    if (fixed && Match(**fixed, segments, depth + 1, accept, result)) {
+      return true;
+    }
+    if (node.wildcard &&
+        Match(*node.wildcard, segments, depth + 1, accept, result)) {
+      return true;
+    }
+    if (node.any_suffix && accept(*node.any_suffix)) {
+      result.payload = &*node.any_suffix;
+      result.any_suffix_start = depth;
+      return true;
+    }
+    return false;
+  }
+
+  Node root_;
+};
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,73 @@
+#include <server/http/path_trie.hpp>
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr int kServicesCount = 100;
+
+// 5 routes per service
+server::http::impl::PathTrie<int> MakeRoutes() {
+  server::http::impl::PathTrie<int> trie;
+  int route = 0;
+  for (int i = 0; i < kServicesCount; ++i) {
+    trie.Insert(fmt::format("/v1/service{}/items/{{id}}", i)) = route++;
+    trie.Insert(fmt::format("/v1/service{}/items/{{id}}/tags/{{tag}}", i)) =
+        route++;
+    trie.Insert(fmt::format("/v1/service{}/{{kind}}/list", i)) = route++;
+    trie.Insert(fmt::format("/v2/{{tenant}}/service{}/items/{{id}}", i)) =
+        route++;
+    trie.Insert(fmt::format("/v1/service{}/static/*", i)) = route++;
+  }
+  return trie;
+}
+
+void Match(benchmark::State& state, std::vector<std::string> paths) {
+  const auto trie = MakeRoutes();
+  server::http::impl::PathSegments segments;
+  std::size_t i = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    server::http::impl::SplitPathBySlash(paths[i++ % paths.size()], segments);
+    benchmark::DoNotOptimize(
+        trie.Match(segments, [](int) { return true; }).payload);
+  }
+}
+
+std::vector<std::string> MakePaths(std::string_view pattern) {
+  std::vector<std::string> paths;
+  for (int i = 0; i < kServicesCount; ++i) {
+    paths.push_back(fmt::format(fmt::runtime(pattern), i));
+  }
+  return paths;
+}
+
+}  // namespace
+
+void path_trie_match_wildcard(benchmark::State& state) {
+  Match(state, MakePaths("/v1/service{}/items/12345/tags/red"));
+}
+
+void path_trie_match_leading_wildcard(benchmark::State& state) {
+  Match(state, MakePaths("/v2/tenant42/service{}/items/12345"));
+}
+
+void path_trie_match_any_suffix(benchmark::State& state) {
+  Match(state, MakePaths("/v1/service{}/static/css/main.css"));
+}
+
+void path_trie_match_not_found(benchmark::State& state) {
+  Match(state, MakePaths("/v3/service{}/items/12345"));
+}
+
+BENCHMARK(path_trie_match_wildcard);
+BENCHMARK(path_trie_match_leading_wildcard);
+BENCHMARK(path_trie_match_any_suffix);
+BENCHMARK(path_trie_match_not_found);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,83 @@
+#include <server/http/path_trie.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Trie = server::http::impl::PathTrie<int>;
+
+struct Matched {
+  int route{-1};
+  std::optional<std::size_t> any_suffix_start;
+};
+
+Matched Match(const Trie& trie, std::string_view path,
+              int rejected_route = -1) {
+  server::http::impl::PathSegments segments;
+  server::http::impl::SplitPathBySlash(path, segments);
+  const auto result = trie.Match(segments, [rejected_route](int route) {
+    return route != rejected_route;
+  });
+  if (!result.payload) return {};
+  return {*result.payload, result.any_suffix_start};
+}
+
+}  // namespace
+
+TEST(PathTrie, Split) {
+  server::http::impl::PathSegments segments;
+  server::http::impl::SplitPathBySlash("/a//b/", segments);
+  EXPECT_EQ(segments.size(), 5);
+  EXPECT_EQ(segments[0], "");
+  EXPECT_EQ(segments[1], "a");
+  EXPECT_EQ(segments[2], "");
+  EXPECT_EQ(segments[3], "b");
+  EXPECT_EQ(segments[4], "");
+}
+
+TEST(PathTrie, FixedBeforeWildcard) {
+  Trie trie;
+  trie.Insert("/a/{x}") = 1;
+  trie.Insert("/{x}/b") = 2;
+  trie.Insert("/{x}/{y}") = 3;
+
+  EXPECT_EQ(Match(trie, "/a/b").route, 1);
+  EXPECT_EQ(Match(trie, "/c/b").route, 2);
+  EXPECT_EQ(Match(trie, "/c/d").route, 3);
+  EXPECT_EQ(Match(trie, "/c/").route, 3);
+  EXPECT_EQ(Match(trie, "/c").route, -1);
+  EXPECT_EQ(Match(trie, "/c/d/e").route, -1);
+
+  // backtracks to the next candidate if the route is not accepted
+  EXPECT_EQ(Match(trie, "/a/b", 1).route, 2);
+}
+
+TEST(PathTrie, AnySuffix) {
+  Trie trie;
+  trie.Insert("/a/*") = 1;
+  trie.Insert("/a/b/*") = 2;
+  trie.Insert("/a/{x}/c") = 3;
+
+  EXPECT_EQ(Match(trie, "/a").route, -1);
+  EXPECT_EQ(Match(trie, "/a/").route, 1);
+  EXPECT_EQ(Match(trie, "/a/").any_suffix_start, 2);
+  EXPECT_EQ(Match(trie, "/a/d/e").route, 1);
+  EXPECT_EQ(Match(trie, "/a/b/e").route, 2);
+  EXPECT_EQ(Match(trie, "/a/b/e").any_suffix_start, 3);
+  EXPECT_EQ(Match(trie, "/a/d/c").route, 3);
+  EXPECT_FALSE(Match(trie, "/a/d/c").any_suffix_start);
+  EXPECT_EQ(Match(trie, "/a/d/c", 3).route, 1);
+  // the fixed segment wins at the first difference
+  EXPECT_EQ(Match(trie, "/a/b/c").route, 2);
+}
+
+TEST(PathTrie, SameTemplate) {
+  Trie trie;
+  trie.Insert("/a/{x}") = 1;
+  EXPECT_EQ(trie.Insert("/a/{y}"), 1);
+  EXPECT_EQ(trie.Insert("/a/*"), 0);
+}
+
+USERVER_NAMESPACE_END
@@ -2,7 +2,7 @@
 
 #include <server/request/internal_request_context.hpp>
 
-#include <userver/baggage/baggage.hpp>
+#include <userver/baggage/baggage_manager.hpp>
 #include <userver/baggage/baggage_settings.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/logging/log.hpp>
@@ -20,12 +20,9 @@ void SetUpBaggage(const http::HttpRequest& http_request,
         http_request.GetHeader(USERVER_NAMESPACE::http::headers::kXBaggage);
     if (!baggage_header.empty()) {
       LOG_DEBUG() << "Got baggage header: " << baggage_header;
-      const auto& baggage_settings = config_snapshot[baggage::kBaggageSettings];
-      auto baggage = baggage::TryMakeBaggage(std::move(baggage_header),
-                                             baggage_settings.allowed_keys);
-      if (baggage) {
-        baggage::kInheritedBaggage.Set(std::move(*baggage));
-      }
+      // Parsed only if an outgoing request needs it
+      baggage::BaggageManager::SetRawBaggage(std::move(baggage_header),
+                                             config_snapshot);
     }
   }
 }
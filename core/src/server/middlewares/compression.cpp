@@ -0,0 +1,202 @@
+#include <server/middlewares/compression.hpp>
+
+#include <compression/gzip.hpp>
+#include <userver/compression/zstd.hpp>
+
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/server/handlers/http_handler_base.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/tracing/scope_time.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+namespace {
+
+constexpr int kGzipDefaultLevel = 6;
+constexpr int kZstdDefaultLevel = 3;
+
+// Qualities are kept in thousandths, as the grammar allows 3 digits at most
+constexpr int kMaxQuality = 1000;
+constexpr int kNoQuality = -1;
+
+std::string_view TrimSpaces(std::string_view value) {
+  constexpr std::string_view kSpaces = " \t";
+  const auto begin = value.find_first_not_of(kSpaces);
+  if (begin == std::string_view::npos) return {};
+  const auto end = value.find_last_not_of(kSpaces);
+  return value.substr(begin, end - begin + 1);
+}
+
+// Returns the next item of a `separator` delimited list, consuming it
+std::string_view PopItem(std::string_view& list, char separator) {
+  const auto pos = list.find(separator);
+  const auto item = list.substr(0, pos);
+  list = pos == std::string_view::npos ? std::string_view{}
+                                       : list.substr(pos + 1);
+  return TrimSpaces(item);
+}
+
+// RFC 9110, 12.4.2:
+// qvalue = ( "0" [ "." 0*3DIGIT ] ) / ( "1" [ "." 0*3("0") ] )
+int ParseQuality(std::string_view value) {
+  if (value.empty() || (value[0] != '0' && value[0] != '1')) return kNoQuality;
+
+  int quality = (value[0] - '0') * kMaxQuality;
+  if (value.size() == 1) return quality;
+  if (value[1] != '.' || value.size() > 5) return kNoQuality;
+
+  int scale = kMaxQuality / 10;
+  for (const char c : value.substr(2)) {
+    if (c < '0' || c > '9') return kNoQuality;
+    quality += (c - '0') * scale;
+    scale /= 10;
+  }
+  return quality > kMaxQuality ? kNoQuality : quality;
+}
+
+}  // namespace
+
+std::string_view ToString(ResponseEncoding encoding) {
+  switch (encoding) {
+    case ResponseEncoding::kGzip:
+      return "gzip";
+    case ResponseEncoding::kZstd:
+      return "zstd";
+  }
+
+  UINVARIANT(false, "Unexpected response encoding");
+}
+
+std::optional<ResponseEncoding> NegotiateResponseEncoding(
+    std::string_view accept_encoding) {
+  int gzip_quality = kNoQuality;
+  int zstd_quality = kNoQuality;
+  int any_quality = kNoQuality;
+
+  while (!accept_encoding.empty()) {
+    auto params = PopItem(accept_encoding, ',');
+    const auto coding = PopItem(params, ';');
+
+    int quality = kMaxQuality;
+    while (!params.empty()) {
+      const auto param = PopItem(params, ';');
+      if (param.size() >= 2 && (param[0] == 'q' || param[0] == 'Q') &&
+          param[1] == '=') {
+        quality = ParseQuality(TrimSpaces(param.substr(2)));
+      }
+    }
+    if (quality == kNoQuality) continue;
+
+    const utils::StrIcaseEqual equal;
+    if (equal(coding, "zstd")) {
+      zstd_quality = quality;
+    } else if (equal(coding, "gzip") || equal(coding, "x-gzip")) {
+      gzip_quality = quality;
+    } else if (coding == "*") {
+      any_quality = quality;
+    }
+  }
+
+  if (zstd_quality == kNoQuality) zstd_quality = any_quality;
+  if (gzip_quality == kNoQuality) gzip_quality = any_quality;
+
+  if (zstd_quality > 0 && zstd_quality >= gzip_quality) {
+    return ResponseEncoding::kZstd;
+  }
+  if (gzip_quality > 0) return ResponseEncoding::kGzip;
+  return std::nullopt;
+}
+
+std::string CompressResponseBody(std::string_view data,
+                                 ResponseEncoding encoding,
+                                 std::optional<int> level) {
+  switch (encoding) {
+    case ResponseEncoding::kGzip:
+      return compression::gzip::Compress(data,
+                                         level.value_or(kGzipDefaultLevel));
+    case ResponseEncoding::kZstd:
+      return compression::zstd::Compress(data,
+                                         level.value_or(kZstdDefaultLevel));
+  }
+
+  UINVARIANT(false, "Unexpected response encoding");
+}
+
+void AddVaryAcceptEncoding(http::HttpResponse& response) {
+  constexpr std::string_view kAcceptEncoding = "Accept-Encoding";
+
+  const auto& vary =
+      response.GetHeader(USERVER_NAMESPACE::http::headers::kVary);
+  if (vary.empty()) {
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kVary,
+                       std::string{kAcceptEncoding});
+    return;
+  }
+
+  auto values = std::string_view{vary};
+  while (!values.empty()) {
+    const auto value = PopItem(values, ',');
+    if (value == "*" || utils::StrIcaseEqual{}(value, kAcceptEncoding)) return;
+  }
+  response.SetHeader(USERVER_NAMESPACE::http::headers::kVary,
+                     fmt::format("{}, {}", vary, kAcceptEncoding));
+}
+
+Compression::Compression(const handlers::HttpHandlerBase& handler)
+    : compress_response_{handler.GetConfig().compress_response},
+      min_size_{handler.GetConfig().response_compression_min_size},
+      level_{handler.GetConfig().response_compression_level} {}
+
+bool Compression::IsApplicable(const handlers::HttpHandlerBase& handler) {
+  return handler.GetConfig().compress_response;
+}
+
+void Compression::HandleRequest(http::HttpRequest& request,
+                                request::RequestContext& context) const {
+  Next(request, context);
+
+  if (compress_response_) CompressResponse(request);
+}
+
+void Compression::CompressResponse(http::HttpRequest& request) const {
+  auto& response = request.GetHttpResponse();
+  // Streamed bodies and the bodies shared with SetSharedData() are not seen
+  // here, the handler is responsible for them
+  if (response.IsBodyStreamed()) return;
+
+  const auto& data = response.GetData();
+  if (data.size() < min_size_ ||
+      response.HasHeader(USERVER_NAMESPACE::http::headers::kContentEncoding)) {
+    return;
+  }
+
+  AddVaryAcceptEncoding(response);
+
+  const auto encoding = NegotiateResponseEncoding(
+      request.GetHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding));
+  if (!encoding) return;
+
+  const auto scope_time = tracing::ScopeTime::CreateOptionalScopeTime(
+      "http_compress_response_body");
+
+  try {
+    auto compressed = CompressResponseBody(data, *encoding, level_);
+    // Incompressible data is sent as is
+    if (compressed.size() >= data.size()) return;
+
+    response.SetData(std::move(compressed));
+    response.SetContentEncoding(std::string{ToString(*encoding)});
+  } catch (const std::exception& e) {
+    LOG_LIMITED_WARNING() << "Failed to compress the response body: " << e;
+  }
+}
+
+}  // namespace server::middlewares
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <userver/server/middlewares/builtin.hpp>
+#include <userver/server/middlewares/http_middleware_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+class HttpResponse;
+}
+
+namespace server::middlewares {
+
+enum class ResponseEncoding {
+  kGzip,
+  kZstd,
+};
+
+/// Returns the value of `Content-Encoding` for the encoding
+std::string_view ToString(ResponseEncoding encoding);
+
+/// Picks the supported encoding with the highest `q` from the `Accept-Encoding`
+/// header value, zstd wins the ties. Returns std::nullopt if the client does
+/// not accept any of them.
+std::optional<ResponseEncoding> NegotiateResponseEncoding(
+    std::string_view accept_encoding);
+
+/// Compresses `data` with `level`, or with the default level of the encoding
+/// @throws compression::CompressionError
+std::string CompressResponseBody(std::string_view data,
+                                 ResponseEncoding encoding,
+                                 std::optional<int> level);
+
+/// Tells the caches that the response depends on `Accept-Encoding`
+void AddVaryAcceptEncoding(http::HttpResponse& response);
+
+class Compression final : public HttpMiddlewareBase {
+ public:
+  static constexpr std::string_view kName = builtin::kCompression;
+
+  explicit Compression(const handlers::HttpHandlerBase&);
+
+  static bool IsApplicable(const handlers::HttpHandlerBase& handler);
+
+ private:
+  void HandleRequest(http::HttpRequest& request,
+                     request::RequestContext& context) const override;
+
+  void CompressResponse(http::HttpRequest& request) const;
+
+  const bool compress_response_;
+  const std::size_t min_size_;
+  const std::optional<int> level_;
+};
+
+using CompressionFactory = SimpleHttpMiddlewareFactory<Compression>;
+
+}  // namespace server::middlewares
+
+USERVER_NAMESPACE_END
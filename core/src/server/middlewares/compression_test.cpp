@@ -0,0 +1,67 @@
+#include <server/middlewares/compression.hpp>
+
+#include <gtest/gtest.h>
+
+#include <compression/gzip.hpp>
+#include <userver/compression/zstd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::middlewares::NegotiateResponseEncoding;
+using server::middlewares::ResponseEncoding;
+
+}  // namespace
+
+TEST(ResponseCompression, Negotiate) {
+  EXPECT_EQ(NegotiateResponseEncoding(""), std::nullopt);
+  EXPECT_EQ(NegotiateResponseEncoding("identity"), std::nullopt);
+  EXPECT_EQ(NegotiateResponseEncoding("br"), std::nullopt);
+
+  EXPECT_EQ(NegotiateResponseEncoding("gzip"), ResponseEncoding::kGzip);
+  EXPECT_EQ(NegotiateResponseEncoding("GZip"), ResponseEncoding::kGzip);
+  EXPECT_EQ(NegotiateResponseEncoding("x-gzip"), ResponseEncoding::kGzip);
+  EXPECT_EQ(NegotiateResponseEncoding("zstd"), ResponseEncoding::kZstd);
+
+  // zstd wins the ties
+  EXPECT_EQ(NegotiateResponseEncoding("gzip, deflate, br, zstd"),
+            ResponseEncoding::kZstd);
+  EXPECT_EQ(NegotiateResponseEncoding("*"), ResponseEncoding::kZstd);
+}
+
+TEST(ResponseCompression, NegotiateQuality) {
+  EXPECT_EQ(NegotiateResponseEncoding("gzip;q=1.0, zstd;q=0.5"),
+            ResponseEncoding::kGzip);
+  EXPECT_EQ(NegotiateResponseEncoding("gzip ; q=0.001 , zstd ; Q=0.002"),
+            ResponseEncoding::kZstd);
+  EXPECT_EQ(NegotiateResponseEncoding("zstd;q=0, gzip"),
+            ResponseEncoding::kGzip);
+  EXPECT_EQ(NegotiateResponseEncoding("zstd;q=0, gzip;q=0"), std::nullopt);
+
+  // Explicit codings take precedence over the wildcard
+  EXPECT_EQ(NegotiateResponseEncoding("*;q=0.1, gzip;q=0.5"),
+            ResponseEncoding::kGzip);
+  EXPECT_EQ(NegotiateResponseEncoding("*;q=0, gzip"), ResponseEncoding::kGzip);
+  EXPECT_EQ(NegotiateResponseEncoding("*;q=0"), std::nullopt);
+
+  // Malformed qualities are ignored
+  EXPECT_EQ(NegotiateResponseEncoding("zstd;q=2, gzip;q=0.1"),
+            ResponseEncoding::kGzip);
+  EXPECT_EQ(NegotiateResponseEncoding("zstd;q=0.0001"), std::nullopt);
+  EXPECT_EQ(NegotiateResponseEncoding("zstd;q=abc"), std::nullopt);
+}
+
+TEST(ResponseCompression, CompressBody) {
+  const std::string body(4096, 'a');
+
+  const auto gzipped = server::middlewares::CompressResponseBody(
+      body, ResponseEncoding::kGzip, std::nullopt);
+  EXPECT_EQ(compression::gzip::Decompress(gzipped, body.size()), body);
+
+  const auto zstd_compressed = server::middlewares::CompressResponseBody(
+      body, ResponseEncoding::kZstd, 1);
+  EXPECT_EQ(compression::zstd::Decompress(zstd_compressed, body.size()), body);
+}
+
+USERVER_NAMESPACE_END
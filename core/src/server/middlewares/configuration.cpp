@@ -8,6 +8,7 @@
 
 #include <server/middlewares/auth.hpp>
 #include <server/middlewares/baggage.hpp>
+#include <server/middlewares/compression.hpp>
 #include <server/middlewares/deadline_propagation.hpp>
 #include <server/middlewares/decompression.hpp>
 #include <server/middlewares/exceptions_handling.hpp>
@@ -40,6 +41,9 @@ MiddlewaresList DefaultPipeline() {
       std::string{builtin::kRateLimit},
       std::string{builtin::kBaggage},
       std::string{builtin::kAuth},
+      // Compresses whatever the handler or the exceptions handling below put
+      // into the response
+      std::string{builtin::kCompression},
       std::string{builtin::kDecompression},
 
       // Transforms CustomHandlerException into response as specified by the
@@ -66,6 +70,7 @@ components::ComponentList DefaultMiddlewareComponents() {
       .Append<RateLimitFactory>()
       .Append<AuthFactory>()
       .Append<DeadlinePropagationFactory>()
+      .Append<CompressionFactory>()
       .Append<DecompressionFactory>()
       .Append<SetAcceptEncodingFactory>()
       .Append<ExceptionsHandlingFactory>()
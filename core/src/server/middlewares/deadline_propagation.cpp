@@ -1,5 +1,6 @@
 #include <server/middlewares/deadline_propagation.hpp>
 
+#include <engine/task/task_context.hpp>
 #include <server/handlers/http_server_settings.hpp>
 #include <server/request/internal_request_context.hpp>
 
@@ -171,6 +172,8 @@ void DeadlinePropagation::SetupInheritedDeadline(
   const auto deadline =
       engine::Deadline::FromTimePoint(request.GetStartTime() + *timeout);
   inherited_data.deadline = deadline;
+  // Orders the task and its subtasks with `earliest-deadline-first`
+  engine::current_task::GetCurrentTaskContext().SetRequestDeadline(deadline);
 
   if (deadline.IsSurelyReachedApprox()) {
     HandleDeadlineExpired(request, dp_scope,
@@ -7,6 +7,7 @@
 #include <userver/server/handlers/exceptions.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
 #include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_request_body_stream.hpp>
 #include <userver/tracing/scope_time.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
 #include <userver/utils/scope_guard.hpp>
@@ -29,6 +30,10 @@ Decompression::Decompression(const handlers::HttpHandlerBase& handler)
           handler.GetConfig().request_config.parse_args_from_body},
       handler_{handler} {}
 
+bool Decompression::IsApplicable(const handlers::HttpHandlerBase& handler) {
+  return GetDecompressRequestFromHandlerSettings(handler);
+}
+
 void Decompression::HandleRequest(http::HttpRequest& request,
                                   request::RequestContext& context) const {
   if (DecompressRequestBody(request)) {
@@ -53,7 +58,15 @@ bool Decompression::DecompressRequestBody(http::HttpRequest& request) const {
   try {
     using FunctionPtr = std::string (*)(std::string_view, std::size_t);
     FunctionPtr function_ptr = nullptr;
-    if (content_encoding == "gzip") {
+    auto& body_stream = request.GetBodyStream();
+    if (body_stream.IsStreamed()) {
+      // The parts are decompressed while the handler reads them, gzip has no
+      // streaming decompressor yet
+      if (content_encoding == "zstd") {
+        body_stream.SetZstdDecompression(max_request_size_);
+        return true;
+      }
+    } else if (content_encoding == "gzip") {
       function_ptr = &compression::gzip::Decompress;
     } else if (content_encoding == "zstd") {
       function_ptr = &compression::zstd::Decompress;
@@ -89,6 +102,10 @@ bool Decompression::DecompressRequestBody(http::HttpRequest& request) const {
 SetAcceptEncoding::SetAcceptEncoding(const handlers::HttpHandlerBase& handler)
     : decompress_request_{GetDecompressRequestFromHandlerSettings(handler)} {}
 
+bool SetAcceptEncoding::IsApplicable(const handlers::HttpHandlerBase& handler) {
+  return GetDecompressRequestFromHandlerSettings(handler);
+}
+
 void SetAcceptEncoding::HandleRequest(http::HttpRequest& request,
                                       request::RequestContext& context) const {
   const utils::ScopeGuard set_accept_encoding_scope{[this, &request] {
@@ -22,6 +22,8 @@ class Decompression final : public HttpMiddlewareBase {
 
   explicit Decompression(const handlers::HttpHandlerBase&);
 
+  static bool IsApplicable(const handlers::HttpHandlerBase& handler);
+
  private:
   void HandleRequest(http::HttpRequest& request,
                      request::RequestContext& context) const override;
@@ -44,6 +46,8 @@ class SetAcceptEncoding final : public HttpMiddlewareBase {
 
   explicit SetAcceptEncoding(const handlers::HttpHandlerBase&);
 
+  static bool IsApplicable(const handlers::HttpHandlerBase& handler);
+
  private:
   void HandleRequest(http::HttpRequest& request,
                      request::RequestContext& context) const override;
@@ -18,15 +18,20 @@ HeadersPropagator::HeadersPropagator(const handlers::HttpHandlerBase&,
 
 void HeadersPropagator::HandleRequest(http::HttpRequest& request,
                                       request::RequestContext& context) const {
-  USERVER_NAMESPACE::server::request::HeadersToPropagate headers_to_propagate;
+  std::vector<std::pair<std::string, std::string>> headers_to_propagate;
+  headers_to_propagate.reserve(headers_.size());
   for (const auto& header_name : headers_) {
     if (!request.HasHeader(header_name)) {
       continue;
     }
-    headers_to_propagate.emplace(header_name, request.GetHeader(header_name));
+    headers_to_propagate.emplace_back(header_name,
+                                      request.GetHeader(header_name));
+  }
+  // The map is only built if an outgoing request needs it
+  if (!headers_to_propagate.empty()) {
+    USERVER_NAMESPACE::server::request::SetTaskInheritedRawHeaders(
+        std::move(headers_to_propagate));
   }
-  USERVER_NAMESPACE::server::request::SetTaskInheritedHeaders(
-      headers_to_propagate);
   Next(request, context);
 }
 HeadersPropagatorFactory::HeadersPropagatorFactory(
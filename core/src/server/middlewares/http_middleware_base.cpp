@@ -1,6 +1,7 @@
 #include <userver/server/middlewares/http_middleware_base.hpp>
 
 #include <userver/components/component_config.hpp>
+#include <userver/tracing/scope_time.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/yaml_config/impl/validate_static_config.hpp>
 
@@ -15,7 +16,19 @@ HttpMiddlewareBase::~HttpMiddlewareBase() = default;
 void HttpMiddlewareBase::Next(http::HttpRequest& request,
                               request::RequestContext& context) const {
   UASSERT(next_);
-  next_->HandleRequest(request, context);
+  next_->Invoke(request, context);
+}
+
+void HttpMiddlewareBase::Invoke(http::HttpRequest& request,
+                                request::RequestContext& context) const {
+  if (scope_time_name_.empty()) {
+    HandleRequest(request, context);
+    return;
+  }
+
+  const auto scope_time =
+      tracing::ScopeTime::CreateOptionalScopeTime(scope_time_name_);
+  HandleRequest(request, context);
 }
 
 HttpMiddlewareFactoryBase::HttpMiddlewareFactoryBase(
@@ -30,6 +43,8 @@ std::unique_ptr<HttpMiddlewareBase> HttpMiddlewareFactoryBase::CreateChecked(
     yaml_config::impl::Validate(middleware_config, GetMiddlewareConfigSchema());
   }
 
+  if (!IsApplicable(handler, middleware_config)) return nullptr;
+
   return Create(handler, std::move(middleware_config));
 }
 
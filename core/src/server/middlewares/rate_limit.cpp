@@ -28,6 +28,12 @@ RateLimit::RateLimit(const handlers::HttpHandlerBase& handler)
   }
 }
 
+bool RateLimit::IsApplicable(const handlers::HttpHandlerBase& handler) {
+  const auto& config = handler.GetConfig();
+  return config.max_requests_per_second.has_value() ||
+         config.max_requests_in_flight.has_value();
+}
+
 void RateLimit::HandleRequest(http::HttpRequest& request,
                               request::RequestContext& context) const {
   if (CheckRateLimit(request)) {
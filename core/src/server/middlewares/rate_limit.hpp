@@ -20,6 +20,8 @@ class RateLimit final : public HttpMiddlewareBase {
 
   explicit RateLimit(const handlers::HttpHandlerBase&);
 
+  static bool IsApplicable(const handlers::HttpHandlerBase& handler);
+
  private:
   void HandleRequest(http::HttpRequest& request,
                      request::RequestContext& context) const override;
@@ -1,15 +1,26 @@
 #include "connection.hpp"
 
+#include <algorithm>
 #include <array>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
 #include <system_error>
+#include <unordered_map>
 #include <vector>
 
+#include <server/http/http2_session.hpp>
 #include <server/http/request_handler_base.hpp>
+#include <server/net/read_buffer_pool.hpp>
 
+#include <userver/concurrent/background_task_storage.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/exception.hpp>
 #include <userver/engine/io/exception.hpp>
 #include <userver/engine/io/tls_wrapper.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_use_event.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/engine/wait_any.hpp>
 #include <userver/logging/log.hpp>
@@ -21,6 +32,82 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+// Gathers the serialized responses of pipelined requests to send them with
+// a single write
+class ResponseBatch final : public engine::io::RwBase {
+ public:
+  bool IsEmpty() const noexcept { return data_.empty(); }
+
+  void Flush(engine::io::WritableBase& socket) {
+    const auto sent = socket.WriteAll(data_.data(), data_.size(), {});
+    if (sent != data_.size()) {
+      throw engine::io::IoException("Connection closed by peer");
+    }
+  }
+
+  void Clear() noexcept { data_.clear(); }
+
+  bool IsValid() const override { return true; }
+
+  bool WaitReadable(engine::Deadline) override {
+    ThrowWriteOnly();
+  }
+
+  size_t ReadSome(void*, size_t, engine::Deadline) override {
+    ThrowWriteOnly();
+  }
+
+  size_t ReadAll(void*, size_t, engine::Deadline) override {
+    ThrowWriteOnly();
+  }
+
+  bool WaitWriteable(engine::Deadline) override { return true; }
+
+  size_t WriteAll(const void* buf, size_t len, engine::Deadline) override {
+    data_.append(static_cast<const char*>(buf), len);
+    return len;
+  }
+
+  size_t WriteAll(std::initializer_list<engine::io::IoData> list,
+                  engine::Deadline) override {
+    size_t result = 0;
+    for (const auto& io_data : list) {
+      data_.append(static_cast<const char*>(io_data.data), io_data.len);
+      result += io_data.len;
+    }
+    return result;
+  }
+
+ private:
+  [[noreturn]] static void ThrowWriteOnly() {
+    throw std::logic_error("ResponseBatch is write only");
+  }
+
+  std::string data_;
+};
+
+// Only the connection task does the socket I/O, as TLS does not allow reading
+// and writing concurrently. The streams are completed by their own tasks that
+// submit the responses into the session and wake up the connection task.
+struct Connection::Http2State final {
+  void NotifyOutput() {
+    if (output_event) {
+      std::exchange(output_event, nullptr)->Send();
+    } else {
+      has_output = true;
+    }
+  }
+
+  engine::Mutex mutex;
+  // Handlers of the streams that are waiting for a response
+  std::unordered_map<std::int32_t, engine::TaskCancellationToken> streams;
+  std::optional<http::Http2Session> session;
+  engine::SingleUseEvent* output_event{nullptr};
+  bool has_output{false};
+  bool is_closed{false};
+  concurrent::BackgroundTaskStorageCore tasks;
+};
+
 Connection::Connection(
     const ConnectionConfig& config,
     const request::HttpRequestConfig& handler_defaults_config,
@@ -44,10 +131,32 @@ Connection::Connection(
   ++stats_->connections_created;
 }
 
+void Connection::SetConnectionTimes(
+    std::chrono::steady_clock::time_point accept_time,
+    std::chrono::steady_clock::time_point start_time,
+    std::chrono::steady_clock::time_point tls_ready_time) {
+  accept_time_ = accept_time;
+  start_time_ = start_time;
+  tls_ready_time_ = tls_ready_time;
+}
+
+void Connection::AttachConnectionTimes(request::RequestBase& request) {
+  if (accept_time_ == std::chrono::steady_clock::time_point{}) return;
+  request.SetConnectionTimes(accept_time_, start_time_, tls_ready_time_);
+  // Only the first request waits for the connection setup
+  accept_time_ = {};
+}
+
 void Connection::Process() {
   LOG_TRACE() << "Starting socket listener for fd " << Fd();
 
-  ListenForRequests();
+  const auto is_http2 = DetectHttp2();
+  if (is_http2 == true) {
+    ListenForHttp2Requests();
+  } else if (is_http2 == false) {
+    ListenForRequests();
+    if (streamed_request_) AbortStreamedRequest();
+  }
 
   Shutdown();
 }
@@ -68,6 +177,8 @@ void Connection::Shutdown() noexcept {
               << Fd();
 
   peer_socket_.reset();
+  pending_data_size_ = 0;
+  ReleaseReadBuffer();
 
   --stats_->active_connections;
   ++stats_->connections_closed;
@@ -81,17 +192,20 @@ void Connection::ListenForRequests() noexcept {
 
     http::HttpRequestParser request_parser(
         request_handler_.GetHandlerInfoIndex(), handler_defaults_config_,
-        [&pending_requests](RequestBasePtr&& request_ptr) {
+        [this, &pending_requests](RequestBasePtr&& request_ptr) {
+          AttachConnectionTimes(*request_ptr);
           pending_requests.push_back(std::move(request_ptr));
         },
-        stats_->parser_stats, data_accounter_);
+        stats_->parser_stats, data_accounter_,
+        [this](RequestBasePtr&& request_ptr) {
+          AttachConnectionTimes(*request_ptr);
+          StartStreamedRequest(std::move(request_ptr));
+        });
 
-    pending_data_.resize(config_.in_buffer_size);
     while (is_accepting_requests_) {
       auto deadline = engine::Deadline::FromDuration(config_.keepalive_timeout);
 
       if (pending_data_size_ == 0) {
-        bool is_readable = true;
         // If we didn't fill the buffer in the previous loop iteration we almost
         // certainly will hit EWOULDBLOCK on the subsequent recv syscall from
         // peer_socket_.RecvSome, which will fall back to event-loop waiting
@@ -101,11 +215,12 @@ void Connection::ListenForRequests() noexcept {
         // 2. notify event-loop about read interest
         // 3. recv (return some data)
         //
-        // So instead we just do 2. and 3., shaving off a whole recv syscall
-        if (pending_data_size_ != pending_data_.size()) {
-          is_readable = peer_socket_->WaitReadable(deadline);
-        }
+        // So instead we just do 2. and 3., shaving off a whole recv syscall.
+        // The read buffer is not held during the wait.
+        ReleaseReadBuffer();
+        const bool is_readable = peer_socket_->WaitReadable(deadline);
 
+        AcquireReadBuffer();
         pending_data_size_ =
             is_readable ? peer_socket_->ReadSome(pending_data_.data(),
                                                  pending_data_.size(), deadline)
@@ -136,9 +251,15 @@ void Connection::ListenForRequests() noexcept {
         should_stop_accepting_requests = true;
       }
       pending_data_size_ = 0;
+      ReleaseReadBuffer();
 
-      for (auto&& request : pending_requests) {
-        ProcessRequest(std::move(request));
+      if (config_.max_concurrent_pipelined_requests > 1 &&
+          pending_requests.size() > 1) {
+        ProcessPipelinedRequests(pending_requests);
+      } else {
+        for (auto&& request : pending_requests) {
+          ProcessRequest(std::move(request));
+        }
       }
       pending_requests.resize(0);
       if (should_stop_accepting_requests) is_accepting_requests_ = false;
@@ -164,14 +285,50 @@ void Connection::ListenForRequests() noexcept {
   }
 }
 
+std::optional<bool> Connection::DetectHttp2() noexcept {
+  if (!config_.http2_enabled) return false;
+
+  auto* tls_socket = dynamic_cast<engine::io::TlsWrapper*>(peer_socket_.get());
+  if (tls_socket) {
+    return tls_socket->GetAlpnProtocol() == http::kHttp2AlpnProtocol;
+  }
+
+  // Prior knowledge: HTTP/2 clients start with the connection preface, while
+  // HTTP/1 requests differ from it in the first bytes
+  const auto preface = http::kHttp2Preface;
+  try {
+    const auto deadline =
+        engine::Deadline::FromDuration(config_.keepalive_timeout);
+    AcquireReadBuffer();
+    while (pending_data_size_ < preface.size()) {
+      const auto size = peer_socket_->ReadSome(
+          pending_data_.data() + pending_data_size_,
+          pending_data_.size() - pending_data_size_, deadline);
+      if (!size) {
+        LOG_TRACE() << "Peer " << Getpeername() << " on fd " << Fd()
+                    << " closed connection";
+        return std::nullopt;
+      }
+      pending_data_size_ += size;
+
+      const std::string_view received{
+          pending_data_.data(), std::min(pending_data_size_, preface.size())};
+      if (preface.substr(0, received.size()) != received) return false;
+    }
+  } catch (const std::exception& ex) {
+    LOG_DEBUG() << "Error while receiving from peer " << Getpeername()
+                << " on fd " << Fd() << ": " << ex;
+    return std::nullopt;
+  }
+  return true;
+}
+
 void Connection::ProcessRequest(
     std::shared_ptr<request::RequestBase>&& request_ptr) {
   if (request_ptr->IsFinal()) {
     is_accepting_requests_ = false;
   }
 
-  stats_->active_request_count.Add(1);
-
   auto task = HandleQueueItem(request_ptr);
   SendResponse(*request_ptr);
 
@@ -179,7 +336,69 @@ void Connection::ProcessRequest(
     request_ptr->DoUpgrade(std::move(peer_socket_), std::move(remote_address_));
 }
 
+void Connection::ProcessPipelinedRequests(
+    std::vector<std::shared_ptr<request::RequestBase>>& requests) {
+  const auto concurrency = config_.max_concurrent_pipelined_requests;
+  ResponseBatch batch;
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(std::min(requests.size(), concurrency));
+
+  for (std::size_t begin = 0; begin < requests.size(); begin += concurrency) {
+    const auto end = std::min(requests.size(), begin + concurrency);
+    tasks.clear();
+    for (auto i = begin; i < end; ++i) {
+      if (requests[i]->IsFinal()) is_accepting_requests_ = false;
+      tasks.push_back(StartRequestTask(requests[i]));
+    }
+
+    for (auto i = begin; i < end; ++i) {
+      auto& request = *requests[i];
+      auto& request_task = tasks[i - begin];
+
+      // Whatever is already done goes out in a single write before waiting
+      const bool is_streamed = request.GetResponse().IsBodyStreamed();
+      if (is_streamed || !request_task.IsFinished()) FlushResponses(batch);
+
+      if (engine::current_task::IsCancelRequested()) {
+        request_task.SyncCancel();
+        is_response_chain_valid_ = false;
+      } else {
+        WaitForRequestTask(requests[i], request_task);
+      }
+
+      if (is_streamed) {
+        SendResponse(request);
+      } else {
+        SendResponse(request, batch);
+      }
+
+      if (request.IsUpgradeWebsocket()) {
+        FlushResponses(batch);
+        request.DoUpgrade(std::move(peer_socket_), std::move(remote_address_));
+      }
+    }
+  }
+  FlushResponses(batch);
+}
+
+void Connection::FlushResponses(ResponseBatch& batch) noexcept {
+  if (batch.IsEmpty()) return;
+
+  // The responses are already accounted as sent, a failure only breaks
+  // the rest of the chain
+  if (is_response_chain_valid_ && peer_socket_) {
+    try {
+      batch.Flush(*peer_socket_);
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "I/O error while sending data: " << ex;
+      is_response_chain_valid_ = false;
+    }
+  }
+  batch.Clear();
+}
+
 bool Connection::ReadSome() {
+  AcquireReadBuffer();
   if (pending_data_size_ == pending_data_.size()) return true;
 
   try {
@@ -200,9 +419,59 @@ bool Connection::ReadSome() {
   return true;
 }
 
+void Connection::AcquireReadBuffer() {
+  if (pending_data_.empty()) {
+    pending_data_ = ReadBufferPool::Acquire(config_.in_buffer_size);
+  }
+}
+
+void Connection::ReleaseReadBuffer() noexcept {
+  UASSERT(pending_data_size_ == 0);
+  ReadBufferPool::Release(std::move(pending_data_));
+  // Frees the buffer if the pool did not take it
+  pending_data_ = {};
+}
+
+// The handler reads the body while the connection receives it. The request
+// is passed to the parser callback once more after the end of the body, so
+// its response is sent in order after the responses to the preceding requests.
+void Connection::StartStreamedRequest(
+    std::shared_ptr<request::RequestBase>&& request) {
+  UASSERT(!streamed_request_);
+  stats_->active_request_count.Add(1);
+  streamed_request_task_.emplace(request_handler_.StartRequestTask(request));
+  streamed_request_ = std::move(request);
+}
+
+void Connection::AbortStreamedRequest() noexcept {
+  LOG_DEBUG() << "Cancelling request due to the connection closed before the "
+                 "end of the request body";
+  auto request = std::move(streamed_request_);
+  auto request_task = StartRequestTask(request);
+  request_task.SyncCancel();
+
+  request->SetStartSendResponseTime();
+  request->GetResponse().SetSendFailed(std::chrono::steady_clock::now());
+  FinishResponse(*request);
+}
+
+engine::TaskWithResult<void> Connection::StartRequestTask(
+    const std::shared_ptr<request::RequestBase>& request) {
+  if (request == streamed_request_) {
+    // Was started right after the request headers
+    streamed_request_.reset();
+    auto request_task = std::move(*streamed_request_task_);
+    streamed_request_task_.reset();
+    return request_task;
+  }
+
+  stats_->active_request_count.Add(1);
+  return request_handler_.StartRequestTask(request);
+}
+
 engine::TaskWithResult<void> Connection::HandleQueueItem(
     const std::shared_ptr<request::RequestBase>& request) noexcept {
-  auto request_task = request_handler_.StartRequestTask(request);
+  auto request_task = StartRequestTask(request);
 
   if (engine::current_task::IsCancelRequested()) {
     // We could've packed all remaining requests into a vector and cancel them
@@ -213,6 +482,13 @@ engine::TaskWithResult<void> Connection::HandleQueueItem(
     return request_task;  // avoids throwing and catching exception down below
   }
 
+  WaitForRequestTask(request, request_task);
+  return request_task;
+}
+
+void Connection::WaitForRequestTask(
+    const std::shared_ptr<request::RequestBase>& request,
+    engine::TaskWithResult<void>& request_task) noexcept {
   try {
     auto& response = request->GetResponse();
     if (response.IsBodyStreamed()) {
@@ -267,17 +543,28 @@ engine::TaskWithResult<void> Connection::HandleQueueItem(
     LOG_WARNING() << "Request failed with unhandled exception: " << e;
     request->MarkAsInternalServerError();
   }
-  return request_task;
 }
 
 void Connection::SendResponse(request::RequestBase& request) {
+  if (peer_socket_) {
+    SendResponse(request, *peer_socket_);
+  } else {
+    // The socket was handed over by a websocket upgrade
+    request.SetStartSendResponseTime();
+    request.GetResponse().SetSendFailed(std::chrono::steady_clock::now());
+    FinishResponse(request);
+  }
+}
+
+void Connection::SendResponse(request::RequestBase& request,
+                              engine::io::RwBase& socket) {
   auto& response = request.GetResponse();
   UASSERT(!response.IsSent());
   request.SetStartSendResponseTime();
-  if (is_response_chain_valid_ && peer_socket_) {
+  if (is_response_chain_valid_) {
     try {
       // Might be a stream reading or a fully constructed response
-      response.SendResponse(*peer_socket_);
+      response.SendResponse(socket);
     } catch (const engine::io::IoSystemError& ex) {
       // working with raw values because std::errc compares error_category
       // default_error_category() fixed only in GCC 9.1 (PR libstdc++/60555)
@@ -294,6 +581,10 @@ void Connection::SendResponse(request::RequestBase& request) {
   } else {
     response.SetSendFailed(std::chrono::steady_clock::now());
   }
+  FinishResponse(request);
+}
+
+void Connection::FinishResponse(request::RequestBase& request) {
   request.SetFinishSendResponseTime();
   stats_->active_request_count.Subtract(1);
   stats_->requests_processed_count.Add(1);
@@ -302,6 +593,201 @@ void Connection::SendResponse(request::RequestBase& request) {
                           request_handler_.LoggerAccessTskv(), peer_name_);
 }
 
+void Connection::ListenForHttp2Requests() noexcept {
+  LOG_TRACE() << "Serving HTTP/2 for fd " << Fd();
+  Http2State state;
+
+  try {
+    state.session.emplace(
+        http::Http2Config{config_.http2_max_concurrent_streams},
+        request_handler_.GetHandlerInfoIndex(), handler_defaults_config_,
+        [this, &state](std::int32_t stream_id,
+                       std::shared_ptr<request::RequestBase>&& request) {
+          StartHttp2Stream(state, stream_id, std::move(request));
+        },
+        [this, &state](std::int32_t stream_id,
+                       std::shared_ptr<request::RequestBase>&& request,
+                       bool is_sent) {
+          if (request) {
+            FinishHttp2Stream(*request, is_sent);
+            return;
+          }
+          const auto it = state.streams.find(stream_id);
+          if (it != state.streams.end()) {
+            LOG_DEBUG() << "Cancelling request due to reset stream";
+            it->second.RequestCancel();
+            state.streams.erase(it);
+          }
+        },
+        stats_->parser_stats, data_accounter_);
+
+    std::string output;
+    while (true) {
+      if (pending_data_size_ != 0) {
+        std::lock_guard lock(state.mutex);
+        if (!state.session->Parse(pending_data_.data(), pending_data_size_)) {
+          LOG_DEBUG() << "Malformed HTTP/2 frames from " << Getpeername()
+                      << " on fd " << Fd();
+        }
+        pending_data_size_ = 0;
+        ReleaseReadBuffer();
+      }
+
+      bool is_alive = true;
+      {
+        std::lock_guard lock(state.mutex);
+        state.session->CollectOutput(output);
+        state.has_output = false;
+        is_alive = state.session->IsAlive();
+      }
+      if (!output.empty()) {
+        const auto sent =
+            peer_socket_->WriteAll(output.data(), output.size(), {});
+        if (sent != output.size()) break;
+        output.clear();
+        // The responses completed during the write are picked up right away
+        continue;
+      }
+      if (!is_alive) break;
+
+      engine::SingleUseEvent output_event;
+      {
+        std::lock_guard lock(state.mutex);
+        if (state.has_output) continue;
+        state.output_event = &output_event;
+      }
+
+      engine::io::ReadableBase& peer_read = *peer_socket_;
+      const auto ready = engine::WaitAnyUntil(
+          engine::Deadline::FromDuration(config_.keepalive_timeout), peer_read,
+          output_event);
+
+      bool is_idle = false;
+      {
+        std::lock_guard lock(state.mutex);
+        // No one sends the event after this point
+        state.output_event = nullptr;
+        is_idle = state.streams.empty();
+      }
+
+      if (!ready) {
+        if (engine::current_task::ShouldCancel()) break;
+        if (is_idle) {
+          LOG_INFO() << "Closing idle connection on timeout";
+          break;
+        }
+        continue;
+      }
+      if (*ready != 0) continue;
+
+      AcquireReadBuffer();
+      pending_data_size_ = peer_socket_->ReadSome(
+          pending_data_.data(), pending_data_.size(),
+          engine::Deadline::FromDuration(config_.keepalive_timeout));
+      if (!pending_data_size_) {
+        LOG_TRACE() << "Peer " << Getpeername() << " on fd " << Fd()
+                    << " closed connection";
+        break;
+      }
+    }
+  } catch (const engine::io::IoTimeout&) {
+    LOG_INFO() << "Closing idle connection on timeout";
+  } catch (const engine::io::IoCancelled&) {
+    LOG_TRACE() << "engine::io::IoCancelled thrown in ListenForHttp2Requests()";
+  } catch (const engine::io::IoSystemError& ex) {
+    auto log_level =
+        ex.Code().value() == static_cast<int>(std::errc::connection_reset)
+            ? logging::Level::kInfo
+            : logging::Level::kError;
+    LOG(log_level) << "I/O error on HTTP/2 connection with peer "
+                   << Getpeername() << " on fd " << Fd() << ": " << ex;
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "Error on HTTP/2 connection with peer " << Getpeername()
+                << " on fd " << Fd() << ": " << ex;
+  }
+
+  {
+    std::lock_guard lock(state.mutex);
+    state.is_closed = true;
+    for (auto& [stream_id, token] : state.streams) token.RequestCancel();
+  }
+  state.tasks.CancelAndWait();
+  // Accounts the responses that have not been sent completely
+  state.session.reset();
+}
+
+void Connection::StartHttp2Stream(
+    Http2State& state, std::int32_t stream_id,
+    std::shared_ptr<request::RequestBase>&& request) {
+  AttachConnectionTimes(*request);
+  auto request_task = request_handler_.StartRequestTask(request);
+  engine::TaskCancellationToken token{request_task};
+  auto completer = engine::AsyncNoSpan(
+      [this, &state, stream_id, request = std::move(request),
+       request_task = std::move(request_task)]() mutable {
+        CompleteHttp2Stream(state, stream_id, std::move(request),
+                            request_task);
+      });
+  stats_->active_request_count.Add(1);
+  // The completer waits for the lock that is held by the caller
+  state.streams.emplace(stream_id, std::move(token));
+  state.tasks.Detach(std::move(completer));
+}
+
+void Connection::CompleteHttp2Stream(
+    Http2State& state, std::int32_t stream_id,
+    std::shared_ptr<request::RequestBase>&& request,
+    engine::TaskWithResult<void>& request_task) noexcept {
+  try {
+    auto& response = request->GetResponse();
+    if (response.IsBodyStreamed()) {
+      response.WaitForHeadersEnd();
+      http::Http2Session::PrepareResponse(*request);
+    }
+    request_task.Get();
+  } catch (const engine::TaskCancelledException& e) {
+    auto reason = e.Reason();
+    auto lvl = reason == engine::TaskCancellationReason::kUserRequest
+                   ? logging::Level::kWarning
+                   : logging::Level::kError;
+    LOG_LIMITED(lvl) << "Handler task was cancelled with reason: "
+                     << ToString(reason);
+    auto& response = request->GetResponse();
+    if (!response.IsReady()) {
+      response.SetReady();
+      response.SetStatusServiceUnavailable();
+    }
+  } catch (const engine::WaitInterruptedException&) {
+    LOG_DEBUG() << "Request processing interrupted";
+  } catch (const std::exception& e) {
+    LOG_WARNING() << "Request failed with unhandled exception: " << e;
+    request->MarkAsInternalServerError();
+  }
+
+  std::lock_guard lock(state.mutex);
+  request->SetStartSendResponseTime();
+  if (state.is_closed || state.streams.erase(stream_id) == 0) {
+    FinishHttp2Stream(*request, false);
+    return;
+  }
+
+  try {
+    state.session->SubmitResponse(stream_id, std::shared_ptr{request});
+    state.NotifyOutput();
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "Error while sending data: " << ex;
+    FinishHttp2Stream(*request, false);
+  }
+}
+
+void Connection::FinishHttp2Stream(request::RequestBase& request,
+                                   bool is_sent) {
+  if (!is_sent) {
+    request.GetResponse().SetSendFailed(std::chrono::steady_clock::now());
+  }
+  FinishResponse(request);
+}
+
 std::string Connection::Getpeername() const { return peer_name_; }
 
 }  // namespace server::net
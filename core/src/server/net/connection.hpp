@@ -1,7 +1,11 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include <server/http/http_request_parser.hpp>
 #include <server/http/request_handler_base.hpp>
@@ -17,6 +21,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+class ResponseBatch;
+
 class Connection final {
  public:
   enum class Type { kRequest, kMonitor };
@@ -29,6 +35,12 @@ class Connection final {
              std::shared_ptr<Stats> stats,
              request::ResponseDataAccounter& data_accounter);
 
+  // The times are attached to the first request of the connection, for the
+  // request stages statistics. `tls_ready_time` is zero for non-TLS sockets.
+  void SetConnectionTimes(std::chrono::steady_clock::time_point accept_time,
+                          std::chrono::steady_clock::time_point start_time,
+                          std::chrono::steady_clock::time_point tls_ready_time);
+
   void Process();
 
   int Fd() const;
@@ -36,19 +48,50 @@ class Connection final {
  private:
   void Shutdown() noexcept;
 
+  void AttachConnectionTimes(request::RequestBase& request);
+
   bool IsRequestTasksEmpty() const noexcept;
 
+  // Returns std::nullopt if the connection is closed before the first bytes
+  std::optional<bool> DetectHttp2() noexcept;
+
   void ListenForRequests() noexcept;
   void ProcessRequest(std::shared_ptr<request::RequestBase>&& request_ptr);
-
+  void ProcessPipelinedRequests(
+      std::vector<std::shared_ptr<request::RequestBase>>& requests);
+  void StartStreamedRequest(std::shared_ptr<request::RequestBase>&& request);
+  void AbortStreamedRequest() noexcept;
+  void FlushResponses(ResponseBatch& batch) noexcept;
+
+  struct Http2State;
+  void ListenForHttp2Requests() noexcept;
+  void StartHttp2Stream(Http2State& state, std::int32_t stream_id,
+                        std::shared_ptr<request::RequestBase>&& request);
+  void CompleteHttp2Stream(Http2State& state, std::int32_t stream_id,
+                           std::shared_ptr<request::RequestBase>&& request,
+                           engine::TaskWithResult<void>& request_task) noexcept;
+  void FinishHttp2Stream(request::RequestBase& request, bool is_sent);
+
+  engine::TaskWithResult<void> StartRequestTask(
+      const std::shared_ptr<request::RequestBase>& request);
   engine::TaskWithResult<void> HandleQueueItem(
       const std::shared_ptr<request::RequestBase>& request) noexcept;
+  void WaitForRequestTask(const std::shared_ptr<request::RequestBase>& request,
+                          engine::TaskWithResult<void>& request_task) noexcept;
   void SendResponse(request::RequestBase& request);
+  void SendResponse(request::RequestBase& request, engine::io::RwBase& socket);
+  void FinishResponse(request::RequestBase& request);
 
   std::string Getpeername() const;
 
   bool ReadSome();
 
+  // The read buffer is borrowed from a per-thread pool only while there is
+  // data to read. TLS keeps the partially received records in the TlsWrapper,
+  // so the buffer is returned for the idle waits on TLS connections too.
+  void AcquireReadBuffer();
+  void ReleaseReadBuffer() noexcept;
+
   const ConnectionConfig& config_;
   const request::HttpRequestConfig& handler_defaults_config_;
   std::unique_ptr<engine::io::RwBase> peer_socket_;
@@ -59,9 +102,17 @@ class Connection final {
   engine::io::Sockaddr remote_address_;
   std::string peer_name_;
 
+  std::chrono::steady_clock::time_point accept_time_{};
+  std::chrono::steady_clock::time_point start_time_{};
+  std::chrono::steady_clock::time_point tls_ready_time_{};
+
   std::vector<char> pending_data_{};
   size_t pending_data_size_{0};
 
+  // The request which handler reads the body while it is being received
+  std::shared_ptr<request::RequestBase> streamed_request_;
+  std::optional<engine::TaskWithResult<void>> streamed_request_task_;
+
   bool is_accepting_requests_{true};
   bool is_response_chain_valid_{true};
 };
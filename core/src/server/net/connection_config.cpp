@@ -1,5 +1,7 @@
 #include <server/net/connection_config.hpp>
 
+#include <stdexcept>
+
 #include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -15,9 +17,22 @@ ConnectionConfig Parse(const yaml_config::YamlConfig& value,
   config.requests_queue_size_threshold =
       value["requests_queue_size_threshold"].As<size_t>(
           config.requests_queue_size_threshold);
+  config.max_concurrent_pipelined_requests =
+      value["max_concurrent_pipelined_requests"].As<size_t>(
+          config.max_concurrent_pipelined_requests);
+  if (config.max_concurrent_pipelined_requests == 0) {
+    throw std::runtime_error(
+        "max_concurrent_pipelined_requests must be positive in " +
+        value.GetPath());
+  }
   config.keepalive_timeout =
       value["keepalive_timeout"].As<std::chrono::seconds>(
           config.keepalive_timeout);
+  config.http2_enabled =
+      value["http2_enabled"].As<bool>(config.http2_enabled);
+  config.http2_max_concurrent_streams =
+      value["http2_max_concurrent_streams"].As<std::uint32_t>(
+          config.http2_max_concurrent_streams);
 
   if (!value["stream_close_check_delay"].IsMissing()) {
     config.abort_check_delay = utils::StringToDuration(
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -21,6 +22,13 @@ struct ConnectionConfig {
   size_t requests_queue_size_threshold = 100;
   std::chrono::seconds keepalive_timeout{10 * 60};
   std::chrono::milliseconds abort_check_delay{kDefaultAbortCheckDelay};
+  // How many pipelined HTTP/1.1 requests of a connection are handled
+  // concurrently, the responses are still sent in order
+  size_t max_concurrent_pipelined_requests = 1;
+  // HTTP/2 is negotiated with ALPN over TLS and is detected by the connection
+  // preface (prior knowledge) over plain TCP
+  bool http2_enabled = false;
+  std::uint32_t http2_max_concurrent_streams = 100;
 };
 
 ConnectionConfig Parse(const yaml_config::YamlConfig& value,
@@ -1,5 +1,10 @@
 #include <server/net/connection.hpp>
 
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+
 #include <fmt/format.h>
 
 #include <server/handlers/http_handler_base_statistics.hpp>
@@ -81,9 +86,11 @@ enum class ConnectionHeader {
 
 clients::http::ResponseFuture CreateRequest(
     clients::http::Client& http_client, engine::io::Socket& request_socket,
-    ConnectionHeader header = ConnectionHeader::kKeepAlive) {
+    ConnectionHeader header = ConnectionHeader::kKeepAlive,
+    clients::http::HttpVersion version = clients::http::HttpVersion::k11) {
   auto ret = http_client.CreateRequest()
                  .get(HttpConnectionUriFromSocket(request_socket))
+                 .http_version(version)
                  .retry(1)
                  .timeout(std::chrono::milliseconds(100));
   if (header == ConnectionHeader::kClose) {
@@ -98,6 +105,12 @@ net::ListenerConfig CreateConfig() {
   return config;
 }
 
+net::ListenerConfig CreateHttp2Config() {
+  auto config = CreateConfig();
+  config.connection_config.http2_enabled = true;
+  return config;
+}
+
 }  // namespace
 
 UTEST(ServerNetConnection, EarlyCancel) {
@@ -323,4 +336,130 @@ UTEST(ServerNetConnection, CancelMultipleInFlight) {
   FAIL() << "Failed to simulate cancellation of multiple requests";
 }
 
+UTEST(ServerNetConnection, PipelinedConcurrently) {
+  constexpr std::size_t kRequests = 10;
+  constexpr std::string_view kRequest = "GET / HTTP/1.1\r\nHost: test\r\n\r\n";
+  constexpr std::string_view kStatusLine = "HTTP/1.1 404";
+
+  net::ListenerConfig config = CreateConfig();
+  config.connection_config.max_concurrent_pipelined_requests = 4;
+  auto request_socket = net::CreateSocket(config);
+  const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  auto addr = engine::io::Sockaddr::MakeLoopbackAddress();
+  addr.SetPort(request_socket.Getsockname().Port());
+  engine::io::Socket client{addr.Domain(), engine::io::SocketType::kStream};
+  client.Connect(addr, deadline);
+
+  auto peer = request_socket.Accept(deadline);
+  ASSERT_TRUE(peer.IsValid());
+  auto stats = std::make_shared<net::Stats>();
+  server::request::ResponseDataAccounter data_accounter;
+  TestHttprequestHandler handler;
+
+  std::string requests;
+  for (std::size_t i = 0; i < kRequests; ++i) requests += kRequest;
+  ASSERT_EQ(client.SendAll(requests.data(), requests.size(), deadline),
+            requests.size());
+
+  auto task = engine::AsyncNoSpan([&] {
+    net::Connection connection(
+        config.connection_config, config.handler_defaults,
+        std::make_unique<engine::io::Socket>(std::move(peer)), {}, handler,
+        stats, data_accounter);
+
+    connection.Process();
+  });
+
+  std::string responses;
+  std::size_t responses_count = 0;
+  while (responses_count < kRequests) {
+    std::array<char, 4096> buf{};
+    const auto size = client.RecvSome(buf.data(), buf.size(), deadline);
+    ASSERT_NE(size, 0u);
+    responses.append(buf.data(), size);
+
+    responses_count = 0;
+    for (auto pos = responses.find(kStatusLine); pos != std::string::npos;
+         pos = responses.find(kStatusLine, pos + 1)) {
+      ++responses_count;
+    }
+  }
+  EXPECT_EQ(responses_count, kRequests);
+  EXPECT_EQ(handler.asyncs_finished, kRequests);
+
+  task.RequestCancel();
+  task.WaitFor(utest::kMaxTestWaitTime);
+  EXPECT_TRUE(task.IsFinished());
+}
+
+UTEST(ServerNetConnection, Http2PriorKnowledge) {
+  net::ListenerConfig config = CreateHttp2Config();
+  auto request_socket = net::CreateSocket(config);
+
+  auto http_client_ptr = utest::CreateHttpClient();
+  http_client_ptr->SetMaxHostConnections(1);
+
+  auto peer = engine::AsyncNoSpan([&request_socket] {
+    return request_socket.Accept(Deadline::FromDuration(kAcceptTimeout));
+  });
+  auto stats = std::make_shared<net::Stats>();
+  server::request::ResponseDataAccounter data_accounter;
+  TestHttprequestHandler handler;
+
+  std::vector<clients::http::ResponseFuture> requests;
+  for (int i = 0; i < 3; ++i) {
+    requests.push_back(CreateRequest(
+        *http_client_ptr, request_socket, ConnectionHeader::kKeepAlive,
+        clients::http::HttpVersion::k2PriorKnowledge));
+  }
+
+  auto task = engine::AsyncNoSpan([&] {
+    net::Connection connection(
+        config.connection_config, config.handler_defaults,
+        std::make_unique<engine::io::Socket>(peer.Get()), {}, handler, stats,
+        data_accounter);
+
+    connection.Process();
+  });
+
+  for (auto& request : requests) {
+    EXPECT_EQ(request.Get()->status_code(), 404);
+  }
+  EXPECT_EQ(handler.asyncs_finished, requests.size());
+
+  task.RequestCancel();
+  task.WaitFor(utest::kMaxTestWaitTime);
+  EXPECT_TRUE(task.IsFinished());
+}
+
+UTEST(ServerNetConnection, Http2EnabledAcceptsHttp1) {
+  net::ListenerConfig config = CreateHttp2Config();
+  auto request_socket = net::CreateSocket(config);
+
+  auto http_client_ptr = utest::CreateHttpClient();
+  auto request =
+      CreateRequest(*http_client_ptr, request_socket, ConnectionHeader::kClose);
+
+  auto peer = request_socket.Accept(Deadline::FromDuration(kAcceptTimeout));
+  ASSERT_TRUE(peer.IsValid());
+  auto stats = std::make_shared<net::Stats>();
+  server::request::ResponseDataAccounter data_accounter;
+  TestHttprequestHandler handler;
+
+  auto task = engine::AsyncNoSpan([&] {
+    net::Connection connection(
+        config.connection_config, config.handler_defaults,
+        std::make_unique<engine::io::Socket>(std::move(peer)), {}, handler,
+        stats, data_accounter);
+
+    connection.Process();
+  });
+  EXPECT_EQ(request.Get()->status_code(), 404);
+
+  task.RequestCancel();
+  task.WaitFor(utest::kMaxTestWaitTime);
+  EXPECT_TRUE(task.IsFinished());
+}
+
 USERVER_NAMESPACE_END
@@ -1,6 +1,16 @@
 #include "create_socket.hpp"
 
+#include <sys/socket.h>
+#ifdef __linux__
+#include <linux/filter.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
 #include <string>
+#include <thread>
 
 #include <fmt/format.h>
 #include <boost/filesystem/operations.hpp>
@@ -9,6 +19,8 @@
 #include <userver/fs/blocking/read.hpp>
 #include <userver/fs/blocking/write.hpp>
 #include <userver/net/blocking/get_addr_info.hpp>
+#include <userver/utils/assert.hpp>
+#include <utils/check_syscall.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -63,6 +75,47 @@ engine::io::Socket CreateIpv6Socket(const std::string& address, uint16_t port,
   return socket;
 }
 
+void SetIncomingCpu(engine::io::Socket& socket, std::size_t shard_index) {
+#ifdef SO_INCOMING_CPU
+  const auto cpus = std::max(std::thread::hardware_concurrency(), 1u);
+  socket.SetOption(SOL_SOCKET, SO_INCOMING_CPU,
+                   static_cast<int>(shard_index % cpus));
+#else
+  (void)socket;
+  (void)shard_index;
+  throw std::runtime_error(
+      "shards_steering 'incoming-cpu' is not supported on this platform");
+#endif
+}
+
+// The program selects the socket index in the reuseport group, which is
+// the order of the shards creation
+void AttachCpuBpf(engine::io::Socket& socket, std::size_t shard_count) {
+#ifdef SO_ATTACH_REUSEPORT_CBPF
+  std::array<sock_filter, 3> code{{
+      // A = the current CPU
+      {BPF_LD | BPF_W | BPF_ABS, 0, 0,
+       static_cast<std::uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+      // A = A % shard_count
+      {BPF_ALU | BPF_MOD | BPF_K, 0, 0,
+       static_cast<std::uint32_t>(shard_count)},
+      // return A
+      {BPF_RET | BPF_A, 0, 0, 0},
+  }};
+  const sock_fprog program{static_cast<unsigned short>(code.size()),
+                           code.data()};
+  utils::CheckSyscall(
+      ::setsockopt(socket.Fd(), SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &program,
+                   sizeof(program)),
+      "attaching a reuseport BPF program, fd={}", socket.Fd());
+#else
+  (void)socket;
+  (void)shard_count;
+  throw std::runtime_error(
+      "shards_steering 'bpf-cpu' is not supported on this platform");
+#endif
+}
+
 }  // namespace
 
 engine::io::Socket CreateSocket(const ListenerConfig& config) {
@@ -72,6 +125,26 @@ engine::io::Socket CreateSocket(const ListenerConfig& config) {
     return CreateUnixSocket(config.unix_socket_path, config.backlog);
 }
 
+engine::io::Socket CreateSocket(const ListenerConfig& config,
+                                std::size_t shard_index,
+                                std::size_t shard_count) {
+  UASSERT(shard_index < shard_count);
+  auto socket = CreateSocket(config);
+  if (!config.unix_socket_path.empty()) return socket;
+
+  switch (config.shards_steering) {
+    case ShardsSteering::kNone:
+      break;
+    case ShardsSteering::kIncomingCpu:
+      SetIncomingCpu(socket, shard_index);
+      break;
+    case ShardsSteering::kBpfCpu:
+      AttachCpuBpf(socket, shard_count);
+      break;
+  }
+  return socket;
+}
+
 }  // namespace server::net
 
 USERVER_NAMESPACE_END
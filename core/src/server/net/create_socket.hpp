@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 #include <server/net/listener_config.hpp>
 #include <userver/engine/io/socket.hpp>
 
@@ -9,6 +11,12 @@ namespace server::net {
 
 engine::io::Socket CreateSocket(const ListenerConfig& config);
 
+// Creates the SO_REUSEPORT socket of a listener shard and sets up
+// the config.shards_steering
+engine::io::Socket CreateSocket(const ListenerConfig& config,
+                                std::size_t shard_index,
+                                std::size_t shard_count);
+
 }  // namespace server::net
 
 USERVER_NAMESPACE_END
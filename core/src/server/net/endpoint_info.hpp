@@ -2,6 +2,8 @@
 
 #include <atomic>
 
+#include <userver/engine/io/tls_server_sessions.hpp>
+
 #include <server/http/http_request_handler.hpp>
 #include <server/net/connection.hpp>
 #include <server/net/listener_config.hpp>
@@ -18,6 +20,8 @@ struct EndpointInfo {
   const ListenerConfig& listener_config;
   http::HttpRequestHandler& request_handler;
   Connection::Type connection_type{Connection::Type::kRequest};
+  // Shared by the TLS listeners of the server, nullptr without TLS
+  const engine::io::TlsServerSessions* tls_sessions{nullptr};
 
   std::atomic<size_t> connection_count{0};
 };
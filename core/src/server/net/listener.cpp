@@ -9,10 +9,13 @@ namespace server::net {
 
 Listener::Listener(std::shared_ptr<EndpointInfo> endpoint_info,
                    engine::TaskProcessor& task_processor,
-                   request::ResponseDataAccounter& data_accounter)
+                   request::ResponseDataAccounter& data_accounter,
+                   std::size_t shard_index, std::size_t shard_count)
     : task_processor_(&task_processor),
       endpoint_info_(std::move(endpoint_info)),
-      data_accounter_(&data_accounter) {}
+      data_accounter_(&data_accounter),
+      shard_index_(shard_index),
+      shard_count_(shard_count) {}
 
 Listener::~Listener() {
   if (!impl_) return;
@@ -24,7 +27,8 @@ Listener::~Listener() {
 
 void Listener::Start() {
   impl_ = std::make_unique<ListenerImpl>(*task_processor_, endpoint_info_,
-                                         *data_accounter_);
+                                         *data_accounter_, shard_index_,
+                                         shard_count_);
 }
 
 StatsAggregation Listener::GetStats() const {
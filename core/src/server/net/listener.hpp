@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
 
 #include <userver/engine/task/task_processor_fwd.hpp>
@@ -16,7 +17,8 @@ class Listener final {
  public:
   Listener(std::shared_ptr<EndpointInfo> endpoint_info,
            engine::TaskProcessor& task_processor,
-           request::ResponseDataAccounter& data_accounter);
+           request::ResponseDataAccounter& data_accounter,
+           std::size_t shard_index, std::size_t shard_count);
   ~Listener();
 
   Listener(const Listener&) = delete;
@@ -32,6 +34,8 @@ class Listener final {
   engine::TaskProcessor* task_processor_;
   std::shared_ptr<EndpointInfo> endpoint_info_;
   request::ResponseDataAccounter* data_accounter_;
+  std::size_t shard_index_;
+  std::size_t shard_count_;
 
   std::unique_ptr<ListenerImpl> impl_;
 };
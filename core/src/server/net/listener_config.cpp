@@ -23,8 +23,23 @@ ListenerConfig Parse(const yaml_config::YamlConfig& value,
   config.max_connections =
       value["max_connections"].As<size_t>(config.max_connections);
   config.shards = value["shards"].As<std::optional<size_t>>(config.shards);
-  config.task_processor = value["task_processor"].As<std::string>();
   config.backlog = value["backlog"].As<int>(config.backlog);
+  config.thread_per_core =
+      value["thread_per_core"].As<bool>(config.thread_per_core);
+  // Not used by the thread_per_core listeners
+  config.task_processor =
+      config.thread_per_core ? value["task_processor"].As<std::string>("")
+                             : value["task_processor"].As<std::string>();
+
+  const auto steering = value["shards_steering"].As<std::string>("none");
+  if (steering == "incoming-cpu") {
+    config.shards_steering = ShardsSteering::kIncomingCpu;
+  } else if (steering == "bpf-cpu") {
+    config.shards_steering = ShardsSteering::kBpfCpu;
+  } else if (steering != "none") {
+    throw std::runtime_error("Invalid shards_steering value '" + steering +
+                             "' in " + value.GetPath());
+  }
 
   if (config.port != 0 && !config.unix_socket_path.empty())
     throw std::runtime_error(
@@ -64,6 +79,13 @@ ListenerConfig Parse(const yaml_config::YamlConfig& value,
         crypto::Certificate::LoadFromString(contents));
   }
 
+  config.tls_kernel_offload = value["tls"]["kernel-offload"].As<bool>(false);
+  config.tls_session_cache_size = value["tls"]["session-cache-size"].As<size_t>(
+      config.tls_session_cache_size);
+  config.tls_session_timeout =
+      value["tls"]["session-timeout"].As<std::chrono::seconds>(
+          config.tls_session_timeout);
+
   return config;
 }
 
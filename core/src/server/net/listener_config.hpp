@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <optional>
 
@@ -14,6 +15,17 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+// How the kernel distributes the connections between the SO_REUSEPORT sockets
+// of the listener shards
+enum class ShardsSteering {
+  // By the hash of the connection addresses
+  kNone,
+  // A shard prefers the connections received on its CPU (SO_INCOMING_CPU)
+  kIncomingCpu,
+  // A reuseport BPF program picks the shard by the receiving CPU
+  kBpfCpu,
+};
+
 struct ListenerConfig {
   ConnectionConfig connection_config;
   request::HttpRequestConfig handler_defaults;
@@ -23,7 +35,11 @@ struct ListenerConfig {
   int backlog = 1024;  // truncated to net.core.somaxconn
   size_t max_connections = 32768;
   std::optional<size_t> shards;
+  ShardsSteering shards_steering = ShardsSteering::kNone;
   std::string task_processor;
+  // A shard per single-threaded task processor that runs the connections and
+  // the handlers of the shard
+  bool thread_per_core{false};
 
   bool tls{false};
   crypto::Certificate tls_cert;
@@ -31,6 +47,9 @@ struct ListenerConfig {
   std::string tls_private_key_passphrase_name;
   crypto::PrivateKey tls_private_key;
   std::vector<crypto::Certificate> tls_certificate_authorities;
+  bool tls_kernel_offload{false};
+  size_t tls_session_cache_size{20480};
+  std::chrono::seconds tls_session_timeout{300};
 };
 
 ListenerConfig Parse(const yaml_config::YamlConfig& value,
@@ -7,7 +7,9 @@
 #include <stdexcept>
 #include <string>
 #include <system_error>
+#include <vector>
 
+#include <server/http/http2_session.hpp>
 #include <server/net/create_socket.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/io/exception.hpp>
@@ -24,9 +26,18 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+namespace {
+
+const std::vector<std::string> kHttp2AlpnProtocols{
+    std::string{http::kHttp2AlpnProtocol}, "http/1.1"};
+const std::vector<std::string> kNoAlpnProtocols{};
+
+}  // namespace
+
 ListenerImpl::ListenerImpl(engine::TaskProcessor& task_processor,
                            std::shared_ptr<EndpointInfo> endpoint_info,
-                           request::ResponseDataAccounter& data_accounter)
+                           request::ResponseDataAccounter& data_accounter,
+                           std::size_t shard_index, std::size_t shard_count)
     : task_processor_(task_processor),
       endpoint_info_(std::move(endpoint_info)),
       stats_(std::make_shared<Stats>()),
@@ -48,7 +59,8 @@ ListenerImpl::ListenerImpl(engine::TaskProcessor& task_processor,
               }
             }
           },
-          CreateSocket(endpoint_info_->listener_config))) {}
+          CreateSocket(endpoint_info_->listener_config, shard_index,
+                       shard_count))) {}
 
 ListenerImpl::~ListenerImpl() {
   LOG_TRACE() << "Stopping socket listener task";
@@ -64,6 +76,7 @@ StatsAggregation ListenerImpl::GetStats() const {
 
 void ListenerImpl::AcceptConnection(engine::io::Socket& request_socket) {
   auto peer_socket = request_socket.Accept({});
+  const auto accept_time = std::chrono::steady_clock::now();
 
   const auto new_connection_count = ++endpoint_info_->connection_count;
   utils::FastScopeGuard guard{
@@ -84,13 +97,16 @@ void ListenerImpl::AcceptConnection(engine::io::Socket& request_socket) {
   // as reopening it is CPU consuming
   connections_.Detach(engine::CriticalAsyncNoSpan(
       task_processor_,
-      [this](auto peer_socket, auto /*guard*/) {
-        ProcessConnection(std::move(peer_socket));
+      [this, accept_time](auto peer_socket, auto /*guard*/) {
+        ProcessConnection(std::move(peer_socket), accept_time);
       },
       std::move(peer_socket), std::move(guard)));
 }
 
-void ListenerImpl::ProcessConnection(engine::io::Socket peer_socket) {
+void ListenerImpl::ProcessConnection(
+    engine::io::Socket peer_socket,
+    std::chrono::steady_clock::time_point accept_time) {
+  const auto start_time = std::chrono::steady_clock::now();
   if (peer_socket.Getsockname().Domain() == engine::io::AddrDomain::kInet6 ||
       peer_socket.Getsockname().Domain() == engine::io::AddrDomain::kInet)
     peer_socket.SetOption(IPPROTO_TCP, TCP_NODELAY, 1);
@@ -99,13 +115,20 @@ void ListenerImpl::ProcessConnection(engine::io::Socket peer_socket) {
 
   LOG_TRACE() << "Creating connection for fd " << fd;
   std::unique_ptr<engine::io::RwBase> socket;
+  std::chrono::steady_clock::time_point tls_ready_time{};
   auto remote_address = peer_socket.Getpeername();
   if (endpoint_info_->listener_config.tls) {
     const auto& config = endpoint_info_->listener_config;
     socket = std::make_unique<engine::io::TlsWrapper>(
         engine::io::TlsWrapper::StartTlsServer(
             std::move(peer_socket), config.tls_cert, config.tls_private_key, {},
-            config.tls_certificate_authorities));
+            config.tls_certificate_authorities,
+            config.connection_config.http2_enabled ? kHttp2AlpnProtocols
+                                                   : kNoAlpnProtocols,
+            config.tls_kernel_offload ? engine::io::TlsOffload::kKernel
+                                      : engine::io::TlsOffload::kNone,
+            endpoint_info_->tls_sessions));
+    tls_ready_time = std::chrono::steady_clock::now();
   } else {
     socket = std::make_unique<engine::io::Socket>(std::move(peer_socket));
   }
@@ -115,6 +138,7 @@ void ListenerImpl::ProcessConnection(engine::io::Socket peer_socket) {
                             std::move(socket), std::move(remote_address),
                             endpoint_info_->request_handler, stats_,
                             data_accounter_);
+  connection_ptr.SetConnectionTimes(accept_time, start_time, tls_ready_time);
 
   LOG_TRACE() << "Start connection processing for fd " << fd;
   connection_ptr.Process();
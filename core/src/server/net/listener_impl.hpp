@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <memory>
 
 #include <userver/concurrent/background_task_storage.hpp>
@@ -19,14 +21,16 @@ class ListenerImpl final {
  public:
   ListenerImpl(engine::TaskProcessor& task_processor,
                std::shared_ptr<EndpointInfo> endpoint_info,
-               request::ResponseDataAccounter& data_accounter);
+               request::ResponseDataAccounter& data_accounter,
+               std::size_t shard_index, std::size_t shard_count);
   ~ListenerImpl();
 
   StatsAggregation GetStats() const;
 
  private:
   void AcceptConnection(engine::io::Socket& request_socket);
-  void ProcessConnection(engine::io::Socket peer_socket);
+  void ProcessConnection(engine::io::Socket peer_socket,
+                         std::chrono::steady_clock::time_point accept_time);
 
   engine::TaskProcessor& task_processor_;
   std::shared_ptr<EndpointInfo> endpoint_info_;
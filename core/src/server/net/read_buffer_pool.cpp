@@ -0,0 +1,69 @@
+#include "read_buffer_pool.hpp"
+
+#include <utility>
+
+#include <userver/compiler/thread_local.hpp>
+#include <userver/concurrent/striped_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::net {
+
+namespace {
+
+// Bounds the memory a thread keeps after a spike of concurrent reads
+constexpr std::size_t kMaxPooledBuffersPerThread = 64;
+
+concurrent::StripedCounter pooled_bytes;
+concurrent::StripedCounter borrowed_bytes;
+
+compiler::ThreadLocal local_pool = [] {
+  std::vector<std::vector<char>> pool;
+  // Release() does not allocate
+  pool.reserve(kMaxPooledBuffersPerThread);
+  return pool;
+};
+
+}  // namespace
+
+std::vector<char> ReadBufferPool::Acquire(std::size_t size) {
+  std::vector<char> buffer;
+  {
+    auto pool = local_pool.Use();
+    if (!pool->empty()) {
+      buffer = std::move(pool->back());
+      pool->pop_back();
+      pooled_bytes.Subtract(buffer.capacity());
+    }
+  }
+
+  // The buffers of the listeners with different in_buffer_size are reused too
+  if (buffer.size() != size) {
+    buffer.resize(size);
+    buffer.shrink_to_fit();
+  }
+  borrowed_bytes.Add(buffer.capacity());
+  return buffer;
+}
+
+void ReadBufferPool::Release(std::vector<char>&& buffer) noexcept {
+  if (buffer.empty()) return;
+  borrowed_bytes.Subtract(buffer.capacity());
+
+  auto pool = local_pool.Use();
+  if (pool->size() >= kMaxPooledBuffersPerThread) return;
+  pooled_bytes.Add(buffer.capacity());
+  pool->push_back(std::move(buffer));
+}
+
+std::size_t ReadBufferPool::GetPooledBytes() noexcept {
+  return pooled_bytes.NonNegativeRead();
+}
+
+std::size_t ReadBufferPool::GetBorrowedBytes() noexcept {
+  return borrowed_bytes.NonNegativeRead();
+}
+
+}  // namespace server::net
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::net {
+
+// The read buffers of the connections are borrowed from a per-thread pool
+// while there is data to read and are returned for the idle waits, so that
+// idle keep-alive connections hold no buffer memory.
+class ReadBufferPool final {
+ public:
+  static std::vector<char> Acquire(std::size_t size);
+  static void Release(std::vector<char>&& buffer) noexcept;
+
+  // Memory of the buffers held by the pools of all the threads
+  static std::size_t GetPooledBytes() noexcept;
+  // Memory of the buffers borrowed by the connections
+  static std::size_t GetBorrowedBytes() noexcept;
+};
+
+}  // namespace server::net
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,35 @@
+#include <server/net/read_buffer_pool.hpp>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace net = server::net;
+
+UTEST(ReadBufferPool, Reuse) {
+  const auto pooled_before = net::ReadBufferPool::GetPooledBytes();
+  const auto borrowed_before = net::ReadBufferPool::GetBorrowedBytes();
+
+  auto buffer = net::ReadBufferPool::Acquire(1024);
+  EXPECT_EQ(buffer.size(), 1024);
+  EXPECT_EQ(net::ReadBufferPool::GetBorrowedBytes(),
+            borrowed_before + buffer.capacity());
+  const auto* const data = buffer.data();
+
+  net::ReadBufferPool::Release(std::move(buffer));
+  EXPECT_EQ(net::ReadBufferPool::GetBorrowedBytes(), borrowed_before);
+  EXPECT_GE(net::ReadBufferPool::GetPooledBytes(), pooled_before + 1024);
+
+  // The same thread gets the same memory back
+  buffer = net::ReadBufferPool::Acquire(1024);
+  EXPECT_EQ(buffer.data(), data);
+  EXPECT_EQ(net::ReadBufferPool::GetPooledBytes(), pooled_before);
+
+  // Buffers of another size are reused too
+  net::ReadBufferPool::Release(std::move(buffer));
+  buffer = net::ReadBufferPool::Acquire(16);
+  EXPECT_EQ(buffer.size(), 16);
+  net::ReadBufferPool::Release(std::move(buffer));
+}
+
+USERVER_NAMESPACE_END
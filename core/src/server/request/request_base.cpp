@@ -8,6 +8,19 @@ RequestBase::RequestBase() : start_time_(std::chrono::steady_clock::now()) {}
 
 RequestBase::~RequestBase() = default;
 
+void RequestBase::SetConnectionTimes(
+    std::chrono::steady_clock::time_point accept_time,
+    std::chrono::steady_clock::time_point start_time,
+    std::chrono::steady_clock::time_point ready_time) {
+  connection_accept_time_ = accept_time;
+  connection_start_time_ = start_time;
+  connection_ready_time_ = ready_time;
+}
+
+void RequestBase::SetParseFinishTime() {
+  parse_finish_time_ = std::chrono::steady_clock::now();
+}
+
 void RequestBase::SetTaskCreateTime() {
   task_create_time_ = std::chrono::steady_clock::now();
 }
@@ -16,6 +29,14 @@ void RequestBase::SetTaskStartTime() {
   task_start_time_ = std::chrono::steady_clock::now();
 }
 
+void RequestBase::SetHandlerStartTime() {
+  handler_start_time_ = std::chrono::steady_clock::now();
+}
+
+void RequestBase::SetHandlerFinishTime() {
+  handler_finish_time_ = std::chrono::steady_clock::now();
+}
+
 void RequestBase::SetResponseNotifyTime() {
   SetResponseNotifyTime(std::chrono::steady_clock::now());
 }
@@ -0,0 +1,81 @@
+#include <server/request/request_stages.hpp>
+
+#include <iterator>
+
+#include <fmt/format.h>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::request {
+
+std::string_view ToString(RequestStage stage) {
+  switch (stage) {
+    case RequestStage::kAccept:
+      return "accept";
+    case RequestStage::kTlsHandshake:
+      return "tls-handshake";
+    case RequestStage::kRead:
+      return "read";
+    case RequestStage::kDispatch:
+      return "dispatch";
+    case RequestStage::kQueue:
+      return "queue";
+    case RequestStage::kMiddlewares:
+      return "middlewares";
+    case RequestStage::kHandler:
+      return "handler";
+    case RequestStage::kResponseQueue:
+      return "response-queue";
+    case RequestStage::kSend:
+      return "send";
+  }
+
+  UINVARIANT(false, "Unexpected request stage");
+}
+
+namespace {
+
+// Zero time points mark the stages that did not happen
+bool IsKnownInterval(std::chrono::steady_clock::time_point begin,
+                     std::chrono::steady_clock::time_point end) noexcept {
+  return begin != std::chrono::steady_clock::time_point{} &&
+         end != std::chrono::steady_clock::time_point{} && begin <= end;
+}
+
+}  // namespace
+
+void RequestStageTimings::Set(
+    RequestStage stage, std::chrono::steady_clock::time_point begin,
+    std::chrono::steady_clock::time_point end) noexcept {
+  if (!IsKnownInterval(begin, end)) return;
+  durations_[static_cast<std::size_t>(stage)] = end - begin;
+}
+
+void RequestStageTimings::Add(
+    RequestStage stage, std::chrono::steady_clock::time_point begin,
+    std::chrono::steady_clock::time_point end) noexcept {
+  if (!IsKnownInterval(begin, end)) return;
+  auto& duration = durations_[static_cast<std::size_t>(stage)];
+  duration = duration.value_or(Duration{}) + (end - begin);
+}
+
+std::string RequestStageTimings::ToString() const {
+  fmt::memory_buffer buffer;
+  for (std::size_t i = 0; i < kRequestStagesCount; ++i) {
+    const auto& duration = durations_[i];
+    if (!duration) continue;
+    if (buffer.size() != 0) buffer.push_back(',');
+    fmt::format_to(
+        std::back_inserter(buffer), "{}:{}",
+        request::ToString(static_cast<RequestStage>(i)),
+        std::chrono::duration_cast<std::chrono::microseconds>(*duration)
+            .count());
+  }
+  return fmt::to_string(buffer);
+}
+
+}  // namespace server::request
+
+USERVER_NAMESPACE_END
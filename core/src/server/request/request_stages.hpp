@@ -0,0 +1,72 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::request {
+
+/// The stages of the request processing, in their order
+enum class RequestStage {
+  // From the accept() of the connection to the start of its processing, only
+  // for the first request of a connection
+  kAccept,
+  // TLS handshake, only for the first request of a TLS connection
+  kTlsHandshake,
+  // From the first parsed byte of the request to the end of its parsing,
+  // including the waiting for the rest of the request from the network
+  kRead,
+  // From the end of parsing to the start of the handler task, includes the
+  // throttling checks
+  kDispatch,
+  // Waiting for a worker in the task processor queue
+  kQueue,
+  // Middlewares before and after the handler
+  kMiddlewares,
+  // The handler itself, including the response body serialization
+  kHandler,
+  // From the response readiness to the start of sending, e.g. waiting for the
+  // responses of the previous pipelined requests
+  kResponseQueue,
+  // Sending the response
+  kSend,
+};
+
+inline constexpr std::size_t kRequestStagesCount =
+    static_cast<std::size_t>(RequestStage::kSend) + 1;
+
+std::string_view ToString(RequestStage stage);
+
+/// Durations of the request stages, std::nullopt for the stages the request
+/// did not go through
+class RequestStageTimings final {
+ public:
+  using Duration = std::chrono::steady_clock::duration;
+
+  const std::optional<Duration>& operator[](RequestStage stage) const noexcept {
+    return durations_[static_cast<std::size_t>(stage)];
+  }
+
+  /// Sets the stage duration if both time points are known and ordered
+  void Set(RequestStage stage, std::chrono::steady_clock::time_point begin,
+           std::chrono::steady_clock::time_point end) noexcept;
+
+  /// Adds to the duration of the stage, with the same rules as Set()
+  void Add(RequestStage stage, std::chrono::steady_clock::time_point begin,
+           std::chrono::steady_clock::time_point end) noexcept;
+
+  /// Formats the known stages in microseconds, e.g. "read:12,queue:3,..."
+  std::string ToString() const;
+
+ private:
+  std::array<std::optional<Duration>, kRequestStagesCount> durations_{};
+};
+
+}  // namespace server::request
+
+USERVER_NAMESPACE_END
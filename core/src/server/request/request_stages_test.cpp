@@ -0,0 +1,56 @@
+#include <server/request/request_stages.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::request::RequestStage;
+using server::request::RequestStageTimings;
+
+const auto kBase =
+    std::chrono::steady_clock::time_point{} + std::chrono::hours{1};
+
+}  // namespace
+
+TEST(RequestStageTimings, Set) {
+  RequestStageTimings timings;
+  EXPECT_FALSE(timings[RequestStage::kQueue]);
+  EXPECT_EQ(timings.ToString(), "");
+
+  timings.Set(RequestStage::kQueue, kBase,
+              kBase + std::chrono::microseconds{5});
+  timings.Set(RequestStage::kRead, kBase, kBase + std::chrono::milliseconds{2});
+  ASSERT_TRUE(timings[RequestStage::kQueue]);
+  EXPECT_EQ(*timings[RequestStage::kQueue], std::chrono::microseconds{5});
+  EXPECT_EQ(timings.ToString(), "read:2000,queue:5");
+}
+
+TEST(RequestStageTimings, UnknownStages) {
+  RequestStageTimings timings;
+  const std::chrono::steady_clock::time_point unset{};
+  timings.Set(RequestStage::kAccept, unset, kBase);
+  timings.Set(RequestStage::kTlsHandshake, kBase, unset);
+  timings.Set(RequestStage::kSend, kBase + std::chrono::seconds{1}, kBase);
+  EXPECT_FALSE(timings[RequestStage::kAccept]);
+  EXPECT_FALSE(timings[RequestStage::kTlsHandshake]);
+  EXPECT_FALSE(timings[RequestStage::kSend]);
+  EXPECT_EQ(timings.ToString(), "");
+}
+
+TEST(RequestStageTimings, Add) {
+  RequestStageTimings timings;
+  const std::chrono::steady_clock::time_point unset{};
+  timings.Add(RequestStage::kMiddlewares, kBase,
+              kBase + std::chrono::microseconds{3});
+  timings.Add(RequestStage::kMiddlewares, unset, kBase);
+  timings.Add(RequestStage::kMiddlewares, kBase,
+              kBase + std::chrono::microseconds{4});
+  ASSERT_TRUE(timings[RequestStage::kMiddlewares]);
+  EXPECT_EQ(*timings[RequestStage::kMiddlewares],
+            std::chrono::microseconds{7});
+  EXPECT_EQ(timings.ToString(), "middlewares:7");
+}
+
+USERVER_NAMESPACE_END
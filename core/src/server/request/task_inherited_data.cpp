@@ -1,5 +1,7 @@
 #include <userver/server/request/task_inherited_data.hpp>
 
+#include <engine/task/task_context.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::request {
@@ -54,11 +56,14 @@ DeadlinePropagationBlocker::DeadlinePropagationBlocker()
     auto patched = old_value_;
     patched.deadline = {};
     kTaskInheritedData.Set(std::move(patched));
+    engine::current_task::GetCurrentTaskContext().SetRequestDeadline({});
   }
 }
 
 DeadlinePropagationBlocker::~DeadlinePropagationBlocker() {
   if (old_value_.deadline.IsReachable()) {
+    engine::current_task::GetCurrentTaskContext().SetRequestDeadline(
+        old_value_.deadline);
     kTaskInheritedData.Set(std::move(old_value_));
   }
 }
@@ -1,5 +1,7 @@
 #include <userver/server/request/task_inherited_headers.hpp>
 
+#include <mutex>
+
 #include <userver/engine/task/inherited_variable.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -7,8 +9,35 @@ USERVER_NAMESPACE_BEGIN
 namespace server::request {
 
 namespace {
-inline engine::TaskInheritedVariable<server::request::HeadersToPropagate>
-    kTaskInheritedHeaders;
+
+using RawHeaders = std::vector<std::pair<std::string, std::string>>;
+
+// Builds the HeadersToPropagate from the raw headers on the first access
+class LazyHeaders final {
+ public:
+  explicit LazyHeaders(HeadersToPropagate headers)
+      : headers_(std::move(headers)) {}
+
+  explicit LazyHeaders(RawHeaders raw_headers)
+      : raw_headers_(std::move(raw_headers)) {}
+
+  const HeadersToPropagate& Get() const {
+    std::call_once(build_once_, [this] {
+      for (auto& [name, value] : raw_headers_) {
+        headers_.emplace(std::move(name), std::move(value));
+      }
+      raw_headers_.clear();
+    });
+    return headers_;
+  }
+
+ private:
+  mutable RawHeaders raw_headers_;
+  mutable std::once_flag build_once_;
+  mutable HeadersToPropagate headers_;
+};
+
+inline engine::TaskInheritedVariable<LazyHeaders> kTaskInheritedHeaders;
 const server::request::HeadersToPropagate kEmptyHeaders;
 }  // namespace
 
@@ -18,11 +47,15 @@ GetTaskInheritedHeaders() {
   if (headers_ptr == nullptr) {
     return kEmptyHeaders;
   }
-  return *headers_ptr;
+  return headers_ptr->Get();
 }
 
 void SetTaskInheritedHeaders(HeadersToPropagate headers) {
-  kTaskInheritedHeaders.Set(std::move(headers));
+  kTaskInheritedHeaders.Emplace(std::move(headers));
+}
+
+void SetTaskInheritedRawHeaders(RawHeaders headers) {
+  kTaskInheritedHeaders.Emplace(std::move(headers));
 }
 
 }  // namespace server::request
@@ -3,6 +3,8 @@
 #include <atomic>
 #include <shared_mutex>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
@@ -14,10 +16,14 @@
 #include <server/http/http_request_impl.hpp>
 #include <server/net/endpoint_info.hpp>
 #include <server/net/listener.hpp>
+#include <server/net/read_buffer_pool.hpp>
 #include <server/net/stats.hpp>
 #include <server/pph_config.hpp>
 #include <server/requests_view.hpp>
 #include <server/server_config.hpp>
+#include <server/tls_ticket_keys_config.hpp>
+#include <userver/components/single_threaded_task_processors.hpp>
+#include <userver/engine/io/tls_server_sessions.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/server/middlewares/configuration.hpp>
 
@@ -31,7 +37,8 @@ struct PortInfo final {
   void Init(const ServerConfig& config,
             const net::ListenerConfig& listener_config,
             const components::ComponentContext& component_context,
-            bool is_monitor);
+            bool is_monitor,
+            const engine::io::TlsServerSessions* tls_sessions);
 
   void Start();
 
@@ -48,26 +55,52 @@ struct PortInfo final {
 void PortInfo::Init(const ServerConfig& config,
                     const net::ListenerConfig& listener_config,
                     const components::ComponentContext& component_context,
-                    bool is_monitor) {
+                    bool is_monitor,
+                    const engine::io::TlsServerSessions* tls_sessions) {
   LOG_DEBUG() << "Creating listener" << (is_monitor ? " (monitor)" : "");
 
-  engine::TaskProcessor& task_processor =
-      component_context.GetTaskProcessor(listener_config.task_processor);
-
   request_handler_.emplace(component_context, config.logger_access,
                            config.logger_access_tskv, is_monitor,
                            config.server_name);
 
   endpoint_info_ =
       std::make_shared<net::EndpointInfo>(listener_config, *request_handler_);
+  if (listener_config.tls) endpoint_info_->tls_sessions = tls_sessions;
+
+  if (listener_config.thread_per_core) {
+    // Nothing is shared between the shards on the request path: a connection
+    // is accepted, parsed and handled on the task processor of its shard
+    auto& pool =
+        component_context
+            .FindComponent<components::SingleThreadedTaskProcessors>()
+            .GetPool();
+    if (listener_config.shards && *listener_config.shards != pool.GetSize()) {
+      throw std::runtime_error(
+          "'shards' must be equal to the count of the single-threaded task "
+          "processors for a 'thread_per_core' listener");
+    }
+    request_handler_->SetRunOnConnectionTaskProcessor(true);
+
+    listeners_.reserve(pool.GetSize());
+    for (size_t i = 0; i < pool.GetSize(); ++i) {
+      listeners_.emplace_back(endpoint_info_, pool.At(i), data_accounter_, i,
+                              pool.GetSize());
+    }
+    return;
+  }
+
+  engine::TaskProcessor& task_processor =
+      component_context.GetTaskProcessor(listener_config.task_processor);
 
   const auto& event_thread_pool = task_processor.EventThreadPool();
-  size_t listener_shards = listener_config.shards ? *listener_config.shards
-                                                  : event_thread_pool.GetSize();
+  const size_t listener_shards = listener_config.shards
+                                     ? *listener_config.shards
+                                     : event_thread_pool.GetSize();
 
   listeners_.reserve(listener_shards);
-  while (listener_shards--) {
-    listeners_.emplace_back(endpoint_info_, task_processor, data_accounter_);
+  for (size_t i = 0; i < listener_shards; ++i) {
+    listeners_.emplace_back(endpoint_info_, task_processor, data_accounter_, i,
+                            listener_shards);
   }
 }
 
@@ -117,6 +150,7 @@ class ServerImpl final {
   std::chrono::milliseconds GetAvgRequestTimeMs() const;
   const http::HttpRequestHandler& GetHttpRequestHandler(bool is_monitor) const;
   net::StatsAggregation GetServerStats() const;
+  std::vector<net::StatsAggregation> GetListenerShardsStats() const;
   const ServerConfig& GetServerConfig() const { return config_; }
   const std::vector<std::string>& GetMiddlewares() const;
 
@@ -127,7 +161,17 @@ class ServerImpl final {
   void SetRpsRatelimit(std::optional<size_t> rps);
   std::uint64_t GetTotalRequests() const;
 
+  const engine::io::TlsServerSessions* GetTlsSessions() const {
+    return tls_sessions_ ? &*tls_sessions_ : nullptr;
+  }
+
  private:
+  void OnSecdistUpdate(const storages::secdist::SecdistConfig& secdist);
+
+  // Shared by the TLS listeners, outlives them
+  std::optional<engine::io::TlsServerSessions> tls_sessions_;
+  concurrent::AsyncEventSubscriberScope secdist_subscriber_;
+
   PortInfo main_port_info_;
   PortInfo monitor_port_info_;
 
@@ -163,14 +207,36 @@ ServerImpl::ServerImpl(ServerConfig config,
     }
   }
 
-  main_port_info_.Init(config_, config_.listener, component_context, false);
+  const auto* tls_listener =
+      config_.listener.tls ? &config_.listener
+      : config_.monitor_listener && config_.monitor_listener->tls
+          ? &*config_.monitor_listener
+          : nullptr;
+  if (tls_listener) {
+    tls_sessions_.emplace(engine::io::TlsServerSessions::Settings{
+        tls_listener->tls_session_cache_size,
+        tls_listener->tls_session_timeout});
+    // Invalid keys on start are fatal, later they are only logged
+    tls_sessions_->SetTicketKeys(
+        secdist.Get<TlsTicketKeysConfig>().GetTicketKeys());
+
+    auto* secdist_component =
+        component_context.FindComponentOptional<components::Secdist>();
+    if (secdist_component) {
+      secdist_subscriber_ = secdist_component->GetStorage().UpdateAndListen(
+          this, "server_tls_ticket_keys", &ServerImpl::OnSecdistUpdate);
+    }
+  }
+
+  main_port_info_.Init(config_, config_.listener, component_context, false,
+                       GetTlsSessions());
   if (config_.max_response_size_in_flight) {
     main_port_info_.data_accounter_.SetMaxLevel(
         *config_.max_response_size_in_flight);
   }
   if (config_.monitor_listener) {
     monitor_port_info_.Init(config_, *config_.monitor_listener,
-                            component_context, true);
+                            component_context, true, GetTlsSessions());
   }
 
   middlewares_ = component_context
@@ -181,7 +247,23 @@ ServerImpl::ServerImpl(ServerConfig config,
   LOG_INFO() << "Server is created, listening for incoming connections.";
 }
 
-ServerImpl::~ServerImpl() { Stop(); }
+ServerImpl::~ServerImpl() {
+  Stop();
+  secdist_subscriber_.Unsubscribe();
+}
+
+void ServerImpl::OnSecdistUpdate(
+    const storages::secdist::SecdistConfig& secdist) {
+  UASSERT(tls_sessions_);
+  try {
+    tls_sessions_->SetTicketKeys(
+        secdist.Get<TlsTicketKeysConfig>().GetTicketKeys());
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "Failed to update the TLS session ticket keys, keeping the "
+                   "previous ones: "
+                << ex;
+  }
+}
 
 void ServerImpl::StartPortInfos() {
   UASSERT(main_port_info_.request_handler_);
@@ -278,6 +360,19 @@ net::StatsAggregation ServerImpl::GetServerStats() const {
   return summary;
 }
 
+std::vector<net::StatsAggregation> ServerImpl::GetListenerShardsStats() const {
+  std::vector<net::StatsAggregation> result;
+
+  std::shared_lock lock{on_stop_mutex_};
+  if (is_stopping_) return result;
+  result.reserve(main_port_info_.listeners_.size());
+  for (const auto& listener : main_port_info_.listeners_) {
+    result.push_back(listener.GetStats());
+  }
+
+  return result;
+}
+
 const std::vector<std::string>& ServerImpl::GetMiddlewares() const {
   return middlewares_;
 }
@@ -358,12 +453,43 @@ void Server::WriteMonitorData(utils::statistics::Writer& writer) const {
     conn_stats["closed"] = server_stats.connections_closed;
   }
 
+  if (auto shards_stats = writer["listener-shards"]) {
+    const auto shards = pimpl->GetListenerShardsStats();
+    for (std::size_t i = 0; i < shards.size(); ++i) {
+      const auto shard = std::to_string(i);
+      const utils::statistics::LabelView label{"listener_shard", shard};
+      shards_stats["active"].ValueWithLabels(shards[i].active_connections,
+                                             label);
+      shards_stats["opened"].ValueWithLabels(shards[i].connections_created,
+                                             label);
+      shards_stats["closed"].ValueWithLabels(shards[i].connections_closed,
+                                             label);
+    }
+  }
+
+  if (auto buffers_stats = writer["read-buffers"]) {
+    buffers_stats["borrowed-bytes"] = net::ReadBufferPool::GetBorrowedBytes();
+    buffers_stats["pooled-bytes"] = net::ReadBufferPool::GetPooledBytes();
+  }
+
   if (auto request_stats = writer["requests"]) {
     request_stats["active"] = server_stats.active_request_count;
     request_stats["avg-lifetime-ms"] = pimpl->GetAvgRequestTimeMs().count();
     request_stats["processed"] = server_stats.requests_processed_count;
     request_stats["parsing"] = server_stats.parser_stats.parsing_request_count;
   }
+
+  const auto* tls_sessions = pimpl->GetTlsSessions();
+  if (!tls_sessions) return;
+  if (auto tls_stats = writer["tls"]) {
+    const auto stats = tls_sessions->GetStats();
+    tls_stats["handshakes"]["resumed"] = stats.resumed_handshakes;
+    tls_stats["handshakes"]["full"] = stats.full_handshakes;
+    tls_stats["session-cache"]["hits"] = stats.cache_hits;
+    tls_stats["session-cache"]["misses"] = stats.cache_misses;
+    tls_stats["session-cache"]["size"] = stats.cached_sessions;
+    tls_stats["unknown-ticket-keys"] = stats.unknown_ticket_keys;
+  }
 }
 
 void Server::WriteTotalHandlerStatistics(
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <userver/crypto/base64.hpp>
+#include <userver/engine/io/tls_server_sessions.hpp>
+#include <userver/formats/json/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server {
+
+// The ticket keys of the TLS listeners from the secdist
+// 'tls_session_ticket_keys' entry: base64 encoded keys, the first one encrypts
+// the new tickets
+class TlsTicketKeysConfig final {
+ public:
+  using TicketKey = engine::io::TlsServerSessions::TicketKey;
+
+  explicit TlsTicketKeysConfig(const formats::json::Value& doc) {
+    const auto encoded_keys =
+        doc["tls_session_ticket_keys"].As<std::vector<std::string>>({});
+    keys_.reserve(encoded_keys.size());
+    for (const auto& encoded_key : encoded_keys) {
+      keys_.emplace_back(crypto::base64::Base64Decode(encoded_key));
+    }
+  }
+
+  const std::vector<TicketKey>& GetTicketKeys() const { return keys_; }
+
+ private:
+  std::vector<TicketKey> keys_;
+};
+
+}  // namespace server
+
+USERVER_NAMESPACE_END
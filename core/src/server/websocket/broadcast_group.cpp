@@ -0,0 +1,192 @@
+#include <userver/server/websocket/broadcast_group.hpp>
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/io/exception.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket {
+
+struct BroadcastGroup::Member final {
+  explicit Member(WebSocketConnection& connection) : connection(connection) {}
+
+  WebSocketConnection& connection;
+  concurrent::Variable<std::deque<PreparedMessage>, std::mutex> queue;
+  engine::SingleConsumerEvent event;
+  // no more messages are enqueued, the connection is closed or failed
+  std::atomic<bool> stopped{false};
+  std::atomic<bool> close_requested{false};
+  engine::TaskWithResult<void> sender;
+};
+
+struct BroadcastGroup::Impl final {
+  explicit Impl(const BroadcastGroupConfig& config) : config(config) {}
+
+  // Returns false if the member need not be woken up
+  bool Enqueue(Member& member, const PreparedMessage& message);
+
+  void SendQueued(Member& member);
+
+  const BroadcastGroupConfig config;
+  concurrent::Variable<
+      std::unordered_map<std::uint64_t, std::shared_ptr<Member>>>
+      members;
+  std::atomic<std::uint64_t> next_id{0};
+
+  utils::statistics::RateCounter broadcasts;
+  utils::statistics::RateCounter sent;
+  utils::statistics::RateCounter dropped;
+  utils::statistics::RateCounter slow_consumers_closed;
+  utils::statistics::RateCounter send_errors;
+};
+
+bool BroadcastGroup::Impl::Enqueue(Member& member,
+                                   const PreparedMessage& message) {
+  auto queue = member.queue.Lock();
+  if (queue->size() < config.max_queue_size) {
+    queue->push_back(message);
+    return true;
+  }
+
+  switch (config.slow_consumer_policy) {
+    case SlowConsumerPolicy::kDropNewest:
+      ++dropped;
+      return false;
+    case SlowConsumerPolicy::kDropOldest:
+      ++dropped;
+      queue->pop_front();
+      queue->push_back(message);
+      return true;
+    case SlowConsumerPolicy::kClose:
+      dropped += utils::statistics::Rate{queue->size() + 1};
+      ++slow_consumers_closed;
+      queue->clear();
+      member.stopped = true;
+      member.close_requested = true;
+      return true;
+  }
+  UINVARIANT(false, "Unexpected slow consumer policy");
+}
+
+void BroadcastGroup::Impl::SendQueued(Member& member) {
+  std::deque<PreparedMessage> batch;
+  try {
+    while (member.event.WaitForEvent()) {
+      if (member.close_requested) {
+        member.connection.Close(CloseStatus::kPolicyViolation);
+        return;
+      }
+
+      {
+        auto queue = member.queue.Lock();
+        batch.swap(*queue);
+      }
+      for (const auto& message : batch) {
+        member.connection.SendPrepared(message);
+        ++sent;
+      }
+      batch.clear();
+    }
+  } catch (const engine::io::IoException& e) {
+    LOG_INFO() << "Failed to send a broadcast message to "
+               << member.connection.RemoteAddr().PrimaryAddressString()
+               << ": " << e;
+    ++send_errors;
+    member.stopped = true;
+  }
+}
+
+BroadcastGroup::Membership::Membership(std::shared_ptr<Impl> group,
+                                       std::uint64_t id,
+                                       std::shared_ptr<Member> member)
+    : group_(std::move(group)), id_(id), member_(std::move(member)) {}
+
+BroadcastGroup::Membership::Membership(Membership&&) noexcept = default;
+
+BroadcastGroup::Membership& BroadcastGroup::Membership::operator=(
+    Membership&& other) noexcept {
+  if (this == &other) return *this;
+  Leave();
+  group_ = std::move(other.group_);
+  id_ = other.id_;
+  member_ = std::move(other.member_);
+  return *this;
+}
+
+BroadcastGroup::Membership::~Membership() { Leave(); }
+
+void BroadcastGroup::Membership::Leave() noexcept {
+  if (!group_) return;
+
+  {
+    auto members = group_->members.Lock();
+    members->erase(id_);
+  }
+  member_->stopped = true;
+  // The connection must not be used after the membership is over
+  member_->sender.SyncCancel();
+  group_.reset();
+  member_.reset();
+}
+
+BroadcastGroup::BroadcastGroup(const BroadcastGroupConfig& config)
+    : impl_(std::make_shared<Impl>(config)) {
+  UINVARIANT(config.max_queue_size > 0, "max_queue_size must be positive");
+}
+
+BroadcastGroup::~BroadcastGroup() = default;
+
+BroadcastGroup::Membership BroadcastGroup::Join(
+    WebSocketConnection& connection) {
+  auto member = std::make_shared<Member>(connection);
+  member->sender = engine::AsyncNoSpan(
+      [&group = *impl_, &member = *member] { group.SendQueued(member); });
+
+  const auto id = impl_->next_id++;
+  {
+    auto members = impl_->members.Lock();
+    members->emplace(id, member);
+  }
+  return Membership{impl_, id, std::move(member)};
+}
+
+void BroadcastGroup::Broadcast(const PreparedMessage& message) {
+  ++impl_->broadcasts;
+
+  auto members = impl_->members.Lock();
+  for (const auto& [id, member] : *members) {
+    if (member->stopped) continue;
+    if (impl_->Enqueue(*member, message)) member->event.Send();
+  }
+}
+
+std::size_t BroadcastGroup::GetMembersCount() const {
+  const auto members = impl_->members.Lock();
+  return members->size();
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const BroadcastGroup& group) {
+  const auto& impl = *group.impl_;
+  writer["members"] = group.GetMembersCount();
+  writer["broadcasts"] = impl.broadcasts;
+  writer["sent"] = impl.sent;
+  writer["dropped"] = impl.dropped;
+  writer["slow-consumers-closed"] = impl.slow_consumers_closed;
+  writer["send-errors"] = impl.send_errors;
+}
+
+}  // namespace server::websocket
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,117 @@
+#include <userver/server/websocket/broadcast_group.hpp>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace ws = server::websocket;
+
+class FakeConnection final : public ws::WebSocketConnection {
+ public:
+  void Recv(ws::Message&) override {}
+  void Send(const ws::Message&) override {}
+  void SendText(std::string_view) override {}
+
+  void SendPrepared(const ws::PreparedMessage& message) override {
+    sent.push_back(message.GetPayloadSize());
+  }
+
+  void Close(ws::CloseStatus status_code) override {
+    close_status = status_code;
+  }
+
+  const engine::io::Sockaddr& RemoteAddr() const override { return addr_; }
+  void AddFinalTags(tracing::Span&) const override {}
+  void AddStatistics(ws::Statistics&) const override {}
+
+  std::vector<std::size_t> sent;
+  std::optional<ws::CloseStatus> close_status;
+
+ protected:
+  void DoSendBinary(utils::span<const std::byte>) override {}
+
+ private:
+  engine::io::Sockaddr addr_;
+};
+
+ws::PreparedMessage MakeMessage(std::size_t size) {
+  return ws::PreparedMessage{std::string(size, 'x'), true, ws::Config{}};
+}
+
+template <typename Predicate>
+void WaitFor(Predicate predicate) {
+  while (!predicate()) engine::Yield();
+}
+
+std::vector<std::size_t> BroadcastToSlowConsumer(ws::SlowConsumerPolicy policy,
+                                                 FakeConnection& connection) {
+  ws::BroadcastGroup group{{2, policy}};
+  const auto membership = group.Join(connection);
+
+  // The member task does not get to run until the broadcasts are done
+  for (std::size_t size = 1; size <= 5; ++size) {
+    group.Broadcast(MakeMessage(size));
+  }
+  engine::Yield();
+  engine::Yield();
+  return connection.sent;
+}
+
+}  // namespace
+
+UTEST(WebsocketBroadcastGroup, SendsToAllMembers) {
+  ws::BroadcastGroup group;
+  std::vector<FakeConnection> connections(3);
+  std::vector<ws::BroadcastGroup::Membership> memberships;
+  for (auto& connection : connections) {
+    memberships.push_back(group.Join(connection));
+  }
+  EXPECT_EQ(group.GetMembersCount(), 3);
+
+  group.Broadcast(MakeMessage(1));
+  group.Broadcast(MakeMessage(2));
+  for (const auto& connection : connections) {
+    WaitFor([&connection] { return connection.sent.size() == 2; });
+    EXPECT_EQ(connection.sent, (std::vector<std::size_t>{1, 2}));
+  }
+
+  memberships.pop_back();
+  EXPECT_EQ(group.GetMembersCount(), 2);
+
+  group.Broadcast(MakeMessage(3));
+  WaitFor([&] { return connections[0].sent.size() == 3; });
+  WaitFor([&] { return connections[1].sent.size() == 3; });
+  engine::Yield();
+  EXPECT_EQ(connections[2].sent.size(), 2);
+}
+
+UTEST(WebsocketBroadcastGroup, DropNewest) {
+  FakeConnection connection;
+  EXPECT_EQ(
+      BroadcastToSlowConsumer(ws::SlowConsumerPolicy::kDropNewest, connection),
+      (std::vector<std::size_t>{1, 2}));
+}
+
+UTEST(WebsocketBroadcastGroup, DropOldest) {
+  FakeConnection connection;
+  EXPECT_EQ(
+      BroadcastToSlowConsumer(ws::SlowConsumerPolicy::kDropOldest, connection),
+      (std::vector<std::size_t>{4, 5}));
+}
+
+UTEST(WebsocketBroadcastGroup, CloseSlowConsumer) {
+  FakeConnection connection;
+  EXPECT_TRUE(
+      BroadcastToSlowConsumer(ws::SlowConsumerPolicy::kClose, connection)
+          .empty());
+  EXPECT_EQ(connection.close_status, ws::CloseStatus::kPolicyViolation);
+}
+
+USERVER_NAMESPACE_END
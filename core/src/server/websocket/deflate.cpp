@@ -0,0 +1,204 @@
+#include <server/websocket/deflate.hpp>
+
+#include <algorithm>
+#include <charconv>
+
+#include <fmt/format.h>
+
+#include <userver/compression/error.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket::impl {
+
+namespace {
+
+constexpr std::string_view kExtensionName = "permessage-deflate";
+constexpr std::string_view kFlushTail{"\x00\x00\xff\xff", 4};
+constexpr std::size_t kMinChunkSize = 1024;
+
+// raw deflate of zlib does not support the 256 bytes window
+constexpr int kMinWindowBits = 9;
+
+std::string_view TrimView(std::string_view str) {
+  while (!str.empty() && utils::text::IsAsciiSpace(str.front())) {
+    str.remove_prefix(1);
+  }
+  while (!str.empty() && utils::text::IsAsciiSpace(str.back())) {
+    str.remove_suffix(1);
+  }
+  return str;
+}
+
+std::optional<int> ParseWindowBits(std::string_view value) {
+  value = TrimView(value);
+  if (value.size() >= 2 && value.front() == '"' && value.back() == '"') {
+    value = value.substr(1, value.size() - 2);
+  }
+  int bits = 0;
+  const auto [ptr, ec] =
+      std::from_chars(value.data(), value.data() + value.size(), bits);
+  if (ec != std::errc{} || ptr != value.data() + value.size()) {
+    return std::nullopt;
+  }
+  if (bits < kMinWindowBits || bits > kMaxDeflateWindowBits) {
+    return std::nullopt;
+  }
+  return bits;
+}
+
+std::optional<DeflateParams> ParseOffer(std::string_view offer,
+                                        const DeflateConfig& config) {
+  const auto params = utils::text::SplitIntoStringViewVector(offer, ";");
+  if (params.empty() || TrimView(params.front()) != kExtensionName) {
+    return std::nullopt;
+  }
+
+  DeflateParams result;
+  result.server_no_context_takeover = config.server_no_context_takeover;
+  result.client_no_context_takeover = config.client_no_context_takeover;
+  for (std::size_t i = 1; i < params.size(); ++i) {
+    const auto param = TrimView(params[i]);
+    const auto eq_pos = param.find('=');
+    const auto name = TrimView(param.substr(0, eq_pos));
+    const auto value = eq_pos == std::string_view::npos
+                           ? std::string_view{}
+                           : param.substr(eq_pos + 1);
+
+    if (name == "server_no_context_takeover" && value.empty()) {
+      result.server_no_context_takeover = true;
+    } else if (name == "client_no_context_takeover" && value.empty()) {
+      result.client_no_context_takeover = true;
+    } else if (name == "server_max_window_bits") {
+      const auto bits = ParseWindowBits(value);
+      if (!bits) return std::nullopt;
+      result.server_max_window_bits = *bits;
+    } else if (name == "client_max_window_bits") {
+      // The client window does not matter for the decompression with the
+      // maximum window, the parameter is only validated
+      if (!value.empty() && !ParseWindowBits(value)) return std::nullopt;
+    } else {
+      return std::nullopt;
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+std::optional<DeflateParams> NegotiateDeflate(std::string_view extensions,
+                                              const DeflateConfig& config) {
+  if (!config.enabled) return std::nullopt;
+
+  for (const auto offer :
+       utils::text::SplitIntoStringViewVector(extensions, ",")) {
+    auto params = ParseOffer(offer, config);
+    if (params) return params;
+  }
+  return std::nullopt;
+}
+
+std::string MakeDeflateResponse(const DeflateParams& params) {
+  std::string result{kExtensionName};
+  if (params.server_no_context_takeover) {
+    result += "; server_no_context_takeover";
+  }
+  if (params.client_no_context_takeover) {
+    result += "; client_no_context_takeover";
+  }
+  if (params.server_max_window_bits != kMaxDeflateWindowBits) {
+    result += fmt::format("; server_max_window_bits={}",
+                          params.server_max_window_bits);
+  }
+  return result;
+}
+
+Deflater::Deflater(int level, int window_bits) {
+  // negative window bits stand for the raw deflate without zlib header
+  if (deflateInit2(&stream_, level, Z_DEFLATED, -window_bits, 8,
+                   Z_DEFAULT_STRATEGY) != Z_OK) {
+    throw compression::CompressionError(
+        fmt::format("Failed to initialize deflate: {}",
+                    stream_.msg ? stream_.msg : "unknown error"));
+  }
+}
+
+Deflater::~Deflater() { deflateEnd(&stream_); }
+
+void Deflater::Compress(utils::span<const std::byte> data, std::string& out) {
+  out.clear();
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  stream_.next_in =
+      reinterpret_cast<Bytef*>(const_cast<std::byte*>(data.data()));
+  stream_.avail_in = data.size();
+
+  do {
+    const auto offset = out.size();
+    out.resize(offset + std::max(data.size() / 2, kMinChunkSize));
+    stream_.next_out = reinterpret_cast<Bytef*>(out.data() + offset);
+    stream_.avail_out = out.size() - offset;
+
+    const auto ret = deflate(&stream_, Z_SYNC_FLUSH);
+    out.resize(out.size() - stream_.avail_out);
+    if (ret != Z_OK && ret != Z_BUF_ERROR) {
+      throw compression::CompressionError(
+          fmt::format("Deflate failed: {}",
+                      stream_.msg ? stream_.msg : "unknown error"));
+    }
+  } while (stream_.avail_out == 0);
+
+  UASSERT(utils::text::EndsWith(out, kFlushTail));
+  out.resize(out.size() - kFlushTail.size());
+}
+
+void Deflater::Reset() { deflateReset(&stream_); }
+
+Inflater::Inflater() {
+  if (inflateInit2(&stream_, -kMaxDeflateWindowBits) != Z_OK) {
+    throw compression::DecompressionError(
+        fmt::format("Failed to initialize inflate: {}",
+                    stream_.msg ? stream_.msg : "unknown error"));
+  }
+}
+
+Inflater::~Inflater() { inflateEnd(&stream_); }
+
+void Inflater::Decompress(std::string& data, std::string& out,
+                          std::size_t max_size) {
+  data.append(kFlushTail);
+  out.clear();
+  stream_.next_in = reinterpret_cast<Bytef*>(data.data());
+  stream_.avail_in = data.size();
+
+  while (true) {
+    const auto offset = out.size();
+    if (offset > max_size) throw compression::TooBigError();
+    out.resize(std::min(offset + std::max(data.size() * 2, kMinChunkSize),
+                        max_size + 1));
+    stream_.next_out = reinterpret_cast<Bytef*>(out.data() + offset);
+    stream_.avail_out = out.size() - offset;
+
+    const auto ret = inflate(&stream_, Z_SYNC_FLUSH);
+    out.resize(out.size() - stream_.avail_out);
+    if (ret == Z_STREAM_END) {
+      // The client has finished the deflate stream with the final block
+      inflateReset(&stream_);
+      break;
+    }
+    if (ret != Z_OK && ret != Z_BUF_ERROR) {
+      throw compression::ErrWithCode(stream_.msg ? stream_.msg
+                                                 : "inflate error");
+    }
+    if (stream_.avail_in == 0 && stream_.avail_out != 0) break;
+  }
+
+  if (out.size() > max_size) throw compression::TooBigError();
+}
+
+void Inflater::Reset() { inflateReset(&stream_); }
+
+}  // namespace server::websocket::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <zlib.h>
+
+#include <userver/server/websocket/server.hpp>
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket::impl {
+
+constexpr inline int kMaxDeflateWindowBits = 15;
+
+/// permessage-deflate parameters agreed on during the handshake, see
+/// https://datatracker.ietf.org/doc/html/rfc7692#section-7.1
+struct DeflateParams final {
+  bool server_no_context_takeover = false;
+  bool client_no_context_takeover = false;
+  int server_max_window_bits = kMaxDeflateWindowBits;
+};
+
+/// Picks the first acceptable permessage-deflate offer of the
+/// Sec-WebSocket-Extensions request header, if any
+std::optional<DeflateParams> NegotiateDeflate(std::string_view extensions,
+                                              const DeflateConfig& config);
+
+/// Sec-WebSocket-Extensions response header value for the agreed parameters
+std::string MakeDeflateResponse(const DeflateParams& params);
+
+/// Compresses the messages of a single direction, keeping the compression
+/// context between them until reset
+class Deflater final {
+ public:
+  Deflater(int level, int window_bits);
+  ~Deflater();
+
+  Deflater(Deflater&&) = delete;
+  Deflater& operator=(Deflater&&) = delete;
+
+  /// Compresses the message payload into `out` without the trailing
+  /// 0x00 0x00 0xff 0xff of the flushed block
+  /// @throws compression::CompressionError
+  void Compress(utils::span<const std::byte> data, std::string& out);
+
+  /// Drops the compression context
+  void Reset();
+
+ private:
+  z_stream stream_{};
+};
+
+/// Decompresses the messages of a single direction, keeping the
+/// decompression context between them until reset
+class Inflater final {
+ public:
+  Inflater();
+  ~Inflater();
+
+  Inflater(Inflater&&) = delete;
+  Inflater& operator=(Inflater&&) = delete;
+
+  /// Decompresses the message payload into `out`, the payload is appended
+  /// with the 0x00 0x00 0xff 0xff of the flushed block.
+  /// @throws compression::TooBigError if the result exceeds `max_size`
+  /// @throws compression::DecompressionError
+  void Decompress(std::string& data, std::string& out, std::size_t max_size);
+
+  /// Drops the decompression context
+  void Reset();
+
+ private:
+  z_stream stream_{};
+};
+
+}  // namespace server::websocket::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,101 @@
+#include <server/websocket/deflate.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <userver/compression/error.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace ws = server::websocket;
+
+utils::span<const std::byte> AsBytes(std::string_view data) {
+  return utils::as_bytes(utils::span<const char>(data.data(), data.size()));
+}
+
+ws::DeflateConfig EnabledConfig() {
+  ws::DeflateConfig config;
+  config.enabled = true;
+  return config;
+}
+
+}  // namespace
+
+TEST(WebsocketDeflate, InflateWithContextTakeover) {
+  // https://datatracker.ietf.org/doc/html/rfc7692#section-7.2.3.2
+  ws::impl::Inflater inflater;
+  std::string out;
+
+  std::string first{"\xf2\x48\xcd\xc9\xc9\x07\x00", 7};
+  inflater.Decompress(first, out, 100);
+  EXPECT_EQ(out, "Hello");
+
+  std::string second{"\xf2\x00\x11\x00\x00", 5};
+  inflater.Decompress(second, out, 100);
+  EXPECT_EQ(out, "Hello");
+}
+
+TEST(WebsocketDeflate, InflateTooBig) {
+  ws::impl::Inflater inflater;
+  std::string out;
+
+  std::string data{"\xf2\x48\xcd\xc9\xc9\x07\x00", 7};
+  EXPECT_THROW(inflater.Decompress(data, out, 4), compression::TooBigError);
+}
+
+TEST(WebsocketDeflate, RoundTrip) {
+  ws::impl::Deflater deflater{1, ws::impl::kMaxDeflateWindowBits};
+  ws::impl::Inflater inflater;
+  std::string compressed;
+  std::string out;
+
+  deflater.Compress(AsBytes("Hello"), compressed);
+  EXPECT_EQ(compressed, std::string_view("\xf2\x48\xcd\xc9\xc9\x07\x00", 7));
+  inflater.Decompress(compressed, out, 100);
+  EXPECT_EQ(out, "Hello");
+
+  const std::string big(10000, 'x');
+  for (int i = 0; i < 3; ++i) {
+    deflater.Compress(AsBytes(big), compressed);
+    EXPECT_LT(compressed.size(), big.size() / 10);
+    inflater.Decompress(compressed, out, big.size());
+  }
+  EXPECT_EQ(out, big);
+}
+
+TEST(WebsocketDeflate, Negotiate) {
+  EXPECT_FALSE(ws::impl::NegotiateDeflate("permessage-deflate", {}));
+  EXPECT_FALSE(
+      ws::impl::NegotiateDeflate("x-webkit-deflate-frame", EnabledConfig()));
+
+  auto params = ws::impl::NegotiateDeflate(
+      "permessage-deflate; client_max_window_bits", EnabledConfig());
+  ASSERT_TRUE(params);
+  EXPECT_EQ(ws::impl::MakeDeflateResponse(*params), "permessage-deflate");
+
+  // the first acceptable offer is picked
+  params = ws::impl::NegotiateDeflate(
+      "permessage-deflate; server_max_window_bits=8, "
+      "permessage-deflate; server_max_window_bits=\"10\"; "
+      "server_no_context_takeover",
+      EnabledConfig());
+  ASSERT_TRUE(params);
+  EXPECT_EQ(ws::impl::MakeDeflateResponse(*params),
+            "permessage-deflate; server_no_context_takeover; "
+            "server_max_window_bits=10");
+
+  auto config = EnabledConfig();
+  config.client_no_context_takeover = true;
+  params = ws::impl::NegotiateDeflate("permessage-deflate", config);
+  ASSERT_TRUE(params);
+  EXPECT_EQ(ws::impl::MakeDeflateResponse(*params),
+            "permessage-deflate; client_no_context_takeover");
+
+  EXPECT_FALSE(ws::impl::NegotiateDeflate("permessage-deflate; unknown",
+                                          EnabledConfig()));
+}
+
+USERVER_NAMESPACE_END
@@ -61,7 +61,7 @@ namespace frames {
 
 boost::container::small_vector<char, impl::kMaxFrameHeaderSize> DataFrameHeader(
     utils::span<const std::byte> data, bool is_text,
-    Continuation is_continuation, Final is_final) {
+    Continuation is_continuation, Final is_final, Compressed is_compressed) {
   boost::container::small_vector<char, impl::kMaxFrameHeaderSize> frame;
 
   frame.resize(sizeof(WSHeader));
@@ -73,7 +73,11 @@ boost::container::small_vector<char, impl::kMaxFrameHeaderSize> DataFrameHeader(
   hdr->bytes = 0;
   hdr->bits.fin = is_final == Final::kYes ? 1 : 0;
   hdr->bits.opcode = is_text ? kText : kBinary;
-  if (is_continuation == Continuation::kYes) hdr->bits.opcode = kContinuation;
+  if (is_continuation == Continuation::kYes) {
+    hdr->bits.opcode = kContinuation;
+  } else if (is_compressed == Compressed::kYes) {
+    hdr->bits.reserved = kReservedCompressed;
+  }
 
   if (data.size() <= 125) {
     hdr->bits.payloadLen = data.size();
@@ -89,6 +93,28 @@ boost::container::small_vector<char, impl::kMaxFrameHeaderSize> DataFrameHeader(
   return frame;
 }
 
+void AppendDataFrames(std::string& out, utils::span<const std::byte> data,
+                      bool is_text, unsigned fragment_size,
+                      Compressed is_compressed) {
+  const auto append = [&out](utils::span<const char> header,
+                             utils::span<const std::byte> payload) {
+    out.append(header.data(), header.size());
+    out.append(reinterpret_cast<const char*>(payload.data()), payload.size());
+  };
+
+  auto continuation = Continuation::kNo;
+  while (data.size() > fragment_size && fragment_size > 0) {
+    append(DataFrameHeader(data.first(fragment_size), is_text, continuation,
+                           Final::kNo, is_compressed),
+           data.first(fragment_size));
+    continuation = Continuation::kYes;
+    data = data.last(data.size() - fragment_size);
+  }
+  append(DataFrameHeader(data, is_text, continuation, Final::kYes,
+                         is_compressed),
+         data);
+}
+
 std::string CloseFrame(CloseStatusInt status_code) {
   std::string frame;
   frame.resize(sizeof(WSHeader) + sizeof(status_code));
@@ -159,6 +185,19 @@ CloseStatus ReadWSFrame(FrameParserState& frame, engine::io::ReadableBase& io,
 
   const bool isDataFrame =
       (hdr.bits.opcode & (kText | kBinary)) || hdr.bits.opcode == kContinuation;
+
+  if (hdr.bits.reserved) {
+    // Only the first frame of a message may be marked as compressed
+    const bool is_first_data_frame =
+        hdr.bits.opcode == kText || hdr.bits.opcode == kBinary;
+    if (hdr.bits.reserved != kReservedCompressed || !frame.deflate_allowed ||
+        !is_first_data_frame) {
+      return CloseStatus::kProtocolError;
+    }
+  }
+  if (hdr.bits.opcode == kText || hdr.bits.opcode == kBinary) {
+    frame.is_compressed = hdr.bits.reserved == kReservedCompressed;
+  }
   if (hdr.bits.payloadLen <= 125) {
     payload_len = hdr.bits.payloadLen;
   } else if (hdr.bits.payloadLen == 126) {
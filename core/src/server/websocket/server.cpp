@@ -1,6 +1,7 @@
 #include <userver/server/websocket/server.hpp>
 
 #include <userver/components/component.hpp>
+#include <userver/compression/error.hpp>
 #include <userver/engine/mutex.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/async.hpp>
@@ -31,14 +32,65 @@ utils::span<const std::byte> MakeBinarySpan(utils::span<const char> span) {
 
 }  // namespace
 
+DeflateConfig Parse(const yaml_config::YamlConfig& config,
+                    formats::parse::To<DeflateConfig>) {
+  DeflateConfig result;
+  result.enabled = config["enabled"].As<bool>(result.enabled);
+  result.server_no_context_takeover =
+      config["server-no-context-takeover"].As<bool>(
+          result.server_no_context_takeover);
+  result.client_no_context_takeover =
+      config["client-no-context-takeover"].As<bool>(
+          result.client_no_context_takeover);
+  result.compression_level =
+      config["compression-level"].As<int>(result.compression_level);
+  result.min_compress_size =
+      config["min-compress-size"].As<unsigned>(result.min_compress_size);
+  return result;
+}
+
 Config Parse(const yaml_config::YamlConfig& config,
              formats::parse::To<Config>) {
   return {
       config["max-remote-payload"].As<unsigned>(65536),
       config["fragment-size"].As<unsigned>(65536),
+      config["permessage-deflate"].As<DeflateConfig>(DeflateConfig{}),
   };
 }
 
+struct PreparedMessage::Frames final {
+  std::size_t payload_size{0};
+  std::string frames;
+  // compressed with the maximum window and without the previous context
+  std::optional<std::string> compressed_frames;
+};
+
+PreparedMessage::PreparedMessage(std::string_view data, bool is_text,
+                                 const Config& config) {
+  auto frames = std::make_shared<Frames>();
+  frames->payload_size = data.size();
+  impl::frames::AppendDataFrames(frames->frames, MakeBinarySpan(data), is_text,
+                                 config.fragment_size,
+                                 impl::frames::Compressed::kNo);
+
+  if (config.deflate.enabled &&
+      data.size() >= config.deflate.min_compress_size) {
+    impl::Deflater deflater{config.deflate.compression_level,
+                            impl::kMaxDeflateWindowBits};
+    std::string compressed;
+    deflater.Compress(MakeBinarySpan(data), compressed);
+    frames->compressed_frames.emplace();
+    impl::frames::AppendDataFrames(
+        *frames->compressed_frames, MakeBinarySpan(compressed), is_text,
+        config.fragment_size, impl::frames::Compressed::kYes);
+  }
+  frames_ = std::move(frames);
+}
+
+std::size_t PreparedMessage::GetPayloadSize() const noexcept {
+  return frames_->payload_size;
+}
+
 class WebSocketConnectionImpl final : public WebSocketConnection {
  public:
  private:
@@ -64,11 +116,30 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
 
   Config config;
 
+  // permessage-deflate state, the deflater is guarded by write_mutex_
+  // and the inflater is used by the Recv() task only
+  const std::optional<impl::DeflateParams> deflate_params_;
+  std::optional<impl::Deflater> deflater_;
+  std::string deflate_buffer_;
+  std::optional<impl::Inflater> inflater_;
+  std::string inflate_buffer_;
+
  public:
   WebSocketConnectionImpl(std::unique_ptr<engine::io::RwBase> io_,
                           const engine::io::Sockaddr& remote_addr,
-                          const Config& server_config)
-      : io(std::move(io_)), remote_addr_(remote_addr), config(server_config) {}
+                          const Config& server_config,
+                          const std::optional<impl::DeflateParams>& deflate)
+      : io(std::move(io_)),
+        remote_addr_(remote_addr),
+        config(server_config),
+        deflate_params_(deflate) {
+    if (deflate_params_) {
+      deflater_.emplace(config.deflate.compression_level,
+                        deflate_params_->server_max_window_bits);
+      inflater_.emplace();
+      frame_.deflate_allowed = true;
+    }
+  }
 
   ~WebSocketConnectionImpl() override {
     LOG_TRACE() << "Websocket connection closed";
@@ -93,13 +164,22 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
       SendExactly(*io, close_frame, {});
     } else if (!message.data.empty()) {
       utils::span<const std::byte> data_to_send{message.data};
+      auto compressed = impl::frames::Compressed::kNo;
+      if (deflater_ &&
+          data_to_send.size() >= config.deflate.min_compress_size) {
+        deflater_->Compress(data_to_send, deflate_buffer_);
+        if (deflate_params_->server_no_context_takeover) deflater_->Reset();
+        data_to_send = MakeBinarySpan(deflate_buffer_);
+        compressed = impl::frames::Compressed::kYes;
+      }
+
       auto continuation = impl::frames::Continuation::kNo;
       while (data_to_send.size() > config.fragment_size &&
              config.fragment_size > 0) {
         const auto data_frame_header = impl::frames::DataFrameHeader(
             data_to_send.first(config.fragment_size),
             message.opcode == impl::WSOpcodes::kText, continuation,
-            impl::frames::Final::kNo);
+            impl::frames::Final::kNo, compressed);
         SendExactly(*io, data_frame_header,
                     data_to_send.first(config.fragment_size));
         continuation = impl::frames::Continuation::kYes;
@@ -108,11 +188,34 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
       }
       const auto data_frame_header = impl::frames::DataFrameHeader(
           data_to_send, message.opcode == impl::WSOpcodes::kText, continuation,
-          impl::frames::Final::kYes);
+          impl::frames::Final::kYes, compressed);
       SendExactly(*io, data_frame_header, data_to_send);
     }
   }
 
+  void SendPrepared(const PreparedMessage& message) override {
+    const auto& frames = *message.frames_;
+    stats_.msg_sent++;
+    stats_.bytes_sent += frames.payload_size;
+
+    const std::unique_lock lock(write_mutex_);
+
+    LOG_TRACE() << "Write prepared message " << frames.payload_size
+                << " bytes";
+    // The prepared message is compressed with the maximum window, which the
+    // client may have not agreed on
+    if (deflater_ && frames.compressed_frames &&
+        deflate_params_->server_max_window_bits ==
+            impl::kMaxDeflateWindowBits) {
+      // The next messages must not refer to the data the prepared message
+      // was compressed without
+      deflater_->Reset();
+      SendExactly(*io, *frames.compressed_frames, {});
+    } else {
+      SendExactly(*io, frames.frames, {});
+    }
+  }
+
   void Send(const Message& message) override {
     MessageExtended mext{
         MakeBinarySpan(message.data),
@@ -175,6 +278,17 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
         }
         if (frame_.waiting_continuation) continue;
 
+        if (frame_.is_compressed) {
+          const auto inflate_status = Inflate(msg);
+          if (inflate_status != CloseStatus::kNone) {
+            MessageExtended close_msg{
+                {}, impl::WSOpcodes::kClose, inflate_status};
+            SendExtended(close_msg);
+            msg = CloseMessage(inflate_status);
+            return;
+          }
+        }
+
         msg.is_text = frame_.is_text;
         stats_.msg_recv++;
         stats_.bytes_recv += msg.data.size();
@@ -186,6 +300,24 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
     }
   }
 
+  CloseStatus Inflate(Message& msg) {
+    UASSERT(inflater_);
+    // The compressed payload goes to the buffer, and the previous buffer
+    // memory is reused for the decompressed one
+    std::swap(msg.data, inflate_buffer_);
+    try {
+      inflater_->Decompress(inflate_buffer_, msg.data,
+                            config.max_remote_payload);
+    } catch (const compression::TooBigError&) {
+      return CloseStatus::kTooBigData;
+    } catch (const compression::DecompressionError& e) {
+      LOG_TRACE() << "Failed to decompress the message: " << e;
+      return CloseStatus::kProtocolError;
+    }
+    if (deflate_params_->client_no_context_takeover) inflater_->Reset();
+    return CloseStatus::kNone;
+  }
+
   void Close(CloseStatus status_code) override {
     Send(CloseMessage(status_code));
   }
@@ -217,10 +349,22 @@ WebSocketConnection::~WebSocketConnection() = default;
 std::shared_ptr<WebSocketConnection> MakeWebSocket(
     std::unique_ptr<engine::io::RwBase>&& socket,
     engine::io::Sockaddr&& peer_name, const Config& config) {
+  return impl::MakeWebSocket(std::move(socket), std::move(peer_name), config,
+                             std::nullopt);
+}
+
+namespace impl {
+
+std::shared_ptr<WebSocketConnection> MakeWebSocket(
+    std::unique_ptr<engine::io::RwBase>&& socket,
+    engine::io::Sockaddr&& peer_name, const Config& config,
+    const std::optional<DeflateParams>& deflate) {
   return std::make_shared<WebSocketConnectionImpl>(
-      std::move(socket), std::move(peer_name), config);
+      std::move(socket), std::move(peer_name), config, deflate);
 }
 
+}  // namespace impl
+
 }  // namespace server::websocket
 
 USERVER_NAMESPACE_END
@@ -73,14 +73,23 @@ std::string WebsocketHandlerBase::HandleRequestThrow(
   response.SetHeader(USERVER_NAMESPACE::http::headers::kWebsocketAccept,
                      websocket::impl::WebsocketSecAnswer(secWebsocketKey));
 
+  auto deflate_params = websocket::impl::NegotiateDeflate(
+      request.GetHeader(USERVER_NAMESPACE::http::headers::kWebsocketExtensions),
+      config_.deflate);
+  if (deflate_params) {
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kWebsocketExtensions,
+                       websocket::impl::MakeDeflateResponse(*deflate_params));
+  }
+
   request.SetUpgradeWebsocket(
       [context = std::make_shared<server::request::RequestContext>(
            std::move(context)),
+       deflate_params,
        this](std::unique_ptr<engine::io::RwBase> socket,
              engine::io::Sockaddr&& peer_name) {
         tracing::Span span("ws/" + HandlerName());
-        auto ws = websocket::MakeWebSocket(std::move(socket),
-                                           std::move(peer_name), config_);
+        auto ws = websocket::impl::MakeWebSocket(
+            std::move(socket), std::move(peer_name), config_, deflate_params);
         try {
           Handle(*ws, *context);
         } catch (const std::exception& e) {
@@ -93,6 +102,11 @@ std::string WebsocketHandlerBase::HandleRequestThrow(
   return "";
 }
 
+PreparedMessage WebsocketHandlerBase::PrepareMessage(std::string_view data,
+                                                     bool is_text) const {
+  return PreparedMessage{data, is_text, config_};
+}
+
 void WebsocketHandlerBase::WriteMetrics(
     utils::statistics::Writer& writer) const {
   writer["msg"]["sent"] = stats_.msg_sent.load();
@@ -116,6 +130,34 @@ properties:
         type: integer
         description: max output fragment size
         defaultDescription: 65536
+    permessage-deflate:
+        type: object
+        description: permessage-deflate extension settings
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: agree on the extension if the client offers it
+                defaultDescription: false
+            server-no-context-takeover:
+                type: boolean
+                description: do not keep the compression context between the sent messages
+                defaultDescription: false
+            client-no-context-takeover:
+                type: boolean
+                description: ask the client not to keep the compression context between its messages
+                defaultDescription: false
+            compression-level:
+                type: integer
+                description: zlib compression level
+                defaultDescription: 1
+                minimum: 1
+                maximum: 9
+            min-compress-size:
+                type: integer
+                description: the smaller messages are sent uncompressed
+                defaultDescription: 256
+                minimum: 0
 )");
 }
 
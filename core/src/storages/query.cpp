@@ -19,6 +19,8 @@ const std::optional<Query::Name>& Query::GetName() const { return name_; }
 
 const std::string& Query::Statement() const { return statement_; }
 
+Query::LogMode Query::GetLogMode() const { return log_mode_; }
+
 void Query::FillSpanTags(tracing::Span& span) const {
   switch (log_mode_) {
     case LogMode::kFull:
@@ -1,10 +1,14 @@
 #include <userver/tracing/component.hpp>
 
 #include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
 #include <userver/logging/component.hpp>
 #include <userver/tracing/tracer.hpp>
+#include <userver/utils/statistics/writer.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
+#include <tracing/tail_sampling.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace components {
@@ -36,6 +40,27 @@ Tracer::Tracer(const ComponentConfig& config, const ComponentContext& context) {
   } else {
     throw std::runtime_error("Tracer type is not supported: " + tracer_type);
   }
+
+  const auto tail_sampling =
+      config["tail-sampling"]
+          .As<std::optional<tracing::impl::TailSamplingConfig>>();
+  if (tail_sampling) {
+    LOG_INFO() << "Tail-based trace sampling enabled.";
+    auto* const statistics_storage =
+        context.FindComponentOptional<components::StatisticsStorage>();
+    if (statistics_storage) {
+      statistics_holder_ = statistics_storage->GetStorage().RegisterWriter(
+          "tracing.tail-sampling", [](utils::statistics::Writer& writer) {
+            writer = tracing::impl::GetTailSamplingStatistics();
+          });
+    }
+  }
+  tracing::impl::SetTailSamplingConfig(tail_sampling);
+}
+
+Tracer::~Tracer() {
+  statistics_holder_.Unregister();
+  tracing::impl::SetTailSamplingConfig(std::nullopt);
 }
 
 yaml_config::Schema Tracer::GetStaticConfigSchema() {
@@ -52,6 +77,34 @@ properties:
         type: string
         description: type of the tracer to trace, currently supported only 'native'
         defaultDescription: 'native'
+    tail-sampling:
+        type: object
+        description: if exists, the span records of each trace are kept in memory until the root span finishes, and the whole trace is written only if it is slow, has an error or wins a random sample
+        additionalProperties: false
+        properties:
+            latency-threshold:
+                type: string
+                description: the traces with the root span at least that long are kept
+                defaultDescription: 500ms
+            sample-probability:
+                type: number
+                description: the share of the fast traces without errors to keep, in [0, 1]
+                defaultDescription: 0.01
+                minimum: 0
+                maximum: 1
+            max-spans-per-trace:
+                type: integer
+                description: a trace with more spans is written out as is
+                defaultDescription: 256
+                minimum: 1
+            max-bytes-per-trace:
+                type: integer
+                description: a trace with larger records is written out as is
+                defaultDescription: 262144
+            max-total-bytes:
+                type: integer
+                description: while the buffered traces use that much memory, the new traces are written out as is
+                defaultDescription: 67108864
 )");
 }
 
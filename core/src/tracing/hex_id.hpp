@@ -0,0 +1,103 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include <userver/utils/encoding/hex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+/// @brief A trace or span id that is either a generated number of `Words`
+/// 64-bit words or an arbitrary string received from the outside.
+///
+/// Generated ids are only formatted as hex on the first GetString() call, and
+/// copying them does not allocate. GetString() may be called concurrently.
+template <std::size_t Words>
+class HexId final {
+ public:
+  using Value = std::array<std::uint64_t, Words>;
+
+  HexId() noexcept : state_(State::kText) {}
+
+  explicit HexId(const Value& value) noexcept
+      : value_(value), state_(State::kValue) {}
+
+  explicit HexId(std::string&& text) noexcept
+      : text_(std::move(text)), state_(State::kText) {}
+
+  HexId(const HexId& other) { CopyFrom(other); }
+
+  HexId& operator=(const HexId& other) {
+    if (this != &other) CopyFrom(other);
+    return *this;
+  }
+
+  HexId& operator=(std::string&& text) noexcept {
+    text_ = std::move(text);
+    state_.store(State::kText, std::memory_order_relaxed);
+    return *this;
+  }
+
+  bool IsEmpty() const noexcept {
+    return state_.load(std::memory_order_acquire) == State::kText &&
+           text_.empty();
+  }
+
+  const std::string& GetString() const {
+    auto state = state_.load(std::memory_order_acquire);
+    if (state == State::kValue &&
+        state_.compare_exchange_strong(state, State::kFormatting,
+                                       std::memory_order_acquire)) {
+      utils::encoding::ToHex(
+          std::string_view{reinterpret_cast<const char*>(value_.data()),
+                           sizeof(value_)},
+          text_);
+      state_.store(State::kText, std::memory_order_release);
+      return text_;
+    }
+
+    // Another thread formats the value, it takes a few nanoseconds
+    while (state != State::kText) {
+      state = state_.load(std::memory_order_acquire);
+    }
+    return text_;
+  }
+
+  std::string Release() && {
+    GetString();
+    return std::move(text_);
+  }
+
+ private:
+  enum class State : std::uint8_t {
+    kValue,
+    kFormatting,
+    kText,
+  };
+
+  void CopyFrom(const HexId& other) {
+    if (other.state_.load(std::memory_order_acquire) == State::kValue) {
+      value_ = other.value_;
+      state_.store(State::kValue, std::memory_order_relaxed);
+    } else {
+      text_ = other.GetString();
+      state_.store(State::kText, std::memory_order_relaxed);
+    }
+  }
+
+  Value value_{};
+  mutable std::string text_;
+  mutable std::atomic<State> state_;
+};
+
+using SpanId = HexId<1>;
+using TraceId = HexId<2>;
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,8 @@
 #include <tracing/span_impl.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <type_traits>
 
 #include <fmt/compile.h>
@@ -7,12 +10,15 @@
 
 #include <engine/task/task_context.hpp>
 #include <logging/log_helper_impl.hpp>
+#include <userver/compiler/thread_local.hpp>
 #include <userver/engine/task/local_variable.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/tags.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/boost_uuid4.hpp>
 #include <userver/utils/encoding/hex.hpp>
 #include <userver/utils/rand.hpp>
 #include <userver/utils/uuid4.hpp>
@@ -61,12 +67,53 @@ TsBuffer StartTsToString(std::chrono::system_clock::time_point start) {
 // Maintain coro-local span stack to identify "current span" in O(1).
 engine::TaskLocalVariable<SpanStack> task_local_spans;
 
-std::string GenerateSpanId() {
+constexpr std::size_t kMaxCachedImplStorages = 16;
+
+struct ImplStorageCache final {
+  ImplStorageCache() = default;
+  ImplStorageCache(ImplStorageCache&&) = delete;
+  ImplStorageCache& operator=(ImplStorageCache&&) = delete;
+
+  ~ImplStorageCache() {
+    for (std::size_t i = 0; i < size; ++i) {
+      ::operator delete(storages[i]);
+    }
+  }
+
+  std::array<void*, kMaxCachedImplStorages> storages{};
+  std::size_t size{0};
+};
+
+compiler::ThreadLocal local_impl_storage_cache = [] {
+  return ImplStorageCache{};
+};
+
+impl::SpanId GenerateSpanId() {
   std::uniform_int_distribution<std::uint64_t> dist;
-  const auto random_value = utils::WithDefaultRandom(dist);
+  return impl::SpanId{impl::SpanId::Value{utils::WithDefaultRandom(dist)}};
+}
+
+// Same as utils::generators::GenerateUuid(), but formatted only when needed
+impl::TraceId GenerateTraceId() {
+  const auto uuid = utils::generators::GenerateBoostUuid();
+  impl::TraceId::Value value;
+  static_assert(sizeof(value) == sizeof(uuid));
+  std::memcpy(value.data(), &*uuid.begin(), sizeof(value));
+  return impl::TraceId{value};
+}
 
-  static_assert(sizeof(random_value) == 8);
-  return utils::encoding::ToHex(&random_value, 8);
+bool IsErrorTag(std::string_view key, const logging::LogExtra::Value& value) {
+  if (key != kErrorFlag) return false;
+  // `true` is stored as an integer
+  return std::visit(
+      [](const auto& flag) {
+        if constexpr (std::is_arithmetic_v<std::decay_t<decltype(flag)>>) {
+          return flag != 0;
+        } else {
+          return flag == "true";
+        }
+      },
+      value);
 }
 
 }  // namespace
@@ -86,8 +133,7 @@ Span::Impl::Impl(TracerPtr tracer, std::string name, const Span::Impl* parent,
       tracer_(std::move(tracer)),
       start_system_time_(std::chrono::system_clock::now()),
       start_steady_time_(std::chrono::steady_clock::now()),
-      trace_id_(parent ? parent->GetTraceId()
-                       : utils::generators::GenerateUuid()),
+      trace_id_(parent ? parent->trace_id_ : GenerateTraceId()),
       span_id_(GenerateSpanId()),
       parent_id_(GetParentIdForLogging(parent)),
       reference_type_(reference_type),
@@ -95,23 +141,61 @@ Span::Impl::Impl(TracerPtr tracer, std::string name, const Span::Impl* parent,
   if (parent) {
     log_extra_inheritable_ = parent->log_extra_inheritable_;
     local_log_level_ = parent->local_log_level_;
+    trace_buffer_ = parent->trace_buffer_;
+  } else {
+    trace_buffer_ = impl::StartTraceBuffer();
+    is_trace_buffer_owner_ = static_cast<bool>(trace_buffer_);
+  }
+  if (const auto* context =
+          engine::current_task::GetCurrentTaskContextUnchecked()) {
+    task_context_ = context;
+    wait_times_at_start_ = context->GetWaitTimes();
+    cpu_time_at_start_ = context->GetCpuTime();
   }
 }
 
 Span::Impl::~Impl() {
-  if (!ShouldLog()) {
-    return;
+  if (ShouldLog()) {
+    const DetachLocalSpansScope ignore_local_span;
+    auto& logger = logging::GetDefaultLogger();
+
+    if (!trace_buffer_) {
+      std::move(*this).LogInto(logger);
+    } else {
+      if (log_level_ >= logging::Level::kError) trace_buffer_->MarkError();
+
+      switch (trace_buffer_->GetAction()) {
+        case impl::TraceBuffer::Action::kBuffer: {
+          impl::TraceBufferLogger buffer_logger{logger, *trace_buffer_};
+          std::move(*this).LogInto(buffer_logger);
+          break;
+        }
+        case impl::TraceBuffer::Action::kLog:
+          std::move(*this).LogInto(logger);
+          break;
+        case impl::TraceBuffer::Action::kDrop:
+          break;
+      }
+    }
   }
 
-  {
-    const DetachLocalSpansScope ignore_local_span;
-    logging::LogHelper lh{logging::GetDefaultLogger(), log_level_,
-                          source_location_};
-    lh.MarkAsTrace(logging::LogHelper::InternalTag{});
-    std::move(*this).PutIntoLogger(lh.GetTagWriterAfterText({}));
+  if (is_trace_buffer_owner_ && trace_buffer_) {
+    try {
+      trace_buffer_->Finish(
+          logging::GetDefaultLogger(),
+          std::chrono::steady_clock::now() - start_steady_time_);
+    } catch (const std::exception& e) {
+      UASSERT_MSG(false, e.what());
+    }
   }
 }
 
+void Span::Impl::LogInto(logging::impl::LoggerBase& logger) && {
+  logging::LogHelper lh{logger, log_level_, source_location_};
+  lh.MarkAsTrace(logging::LogHelper::InternalTag{});
+  std::move(*this).PutIntoLogger(lh.GetTagWriterAfterText({}));
+}
+
 void Span::Impl::PutIntoLogger(logging::impl::TagWriter writer) && {
   const auto steady_now = std::chrono::steady_clock::now();
   const auto duration = steady_now - start_steady_time_;
@@ -129,6 +213,7 @@ void Span::Impl::PutIntoLogger(logging::impl::TagWriter writer) && {
   writer.PutTag(kTimeUnitsTag, "ms");
   writer.PutTag(kStartTimestampTag, timestamp_buffer.ToStringView());
 
+  AccountTaskTimes();
   time_storage_.MergeInto(writer);
 
   if (log_extra_local_) {
@@ -141,6 +226,27 @@ void Span::Impl::PutIntoLogger(logging::impl::TagWriter writer) && {
   LogOpenTracing();
 }
 
+void Span::Impl::AccountTaskTimes() {
+  // The span may be finished by another task
+  if (!task_context_ ||
+      task_context_ != engine::current_task::GetCurrentTaskContextUnchecked()) {
+    return;
+  }
+
+  const auto& wait_times = task_context_->GetWaitTimes();
+  for (std::size_t i = 0; i < engine::impl::kWaitKindCount; ++i) {
+    const auto wait_time = wait_times[i] - wait_times_at_start_[i];
+    if (wait_time.count() == 0) continue;
+
+    const auto kind = static_cast<engine::impl::WaitKind>(i);
+    time_storage_.PushLap(fmt::format(FMT_COMPILE("wait_{}"), ToString(kind)),
+                          wait_time);
+  }
+
+  const auto cpu_time = task_context_->GetCpuTime() - cpu_time_at_start_;
+  if (cpu_time.count() != 0) time_storage_.PushLap("cpu", cpu_time);
+}
+
 void Span::Impl::LogTo(logging::impl::TagWriter writer) {
   writer.ExtendLogExtra(log_extra_inheritable_);
   tracer_->LogSpanContextTo(*this, writer);
@@ -153,11 +259,11 @@ void Span::Impl::AttachToCoroStack() {
   task_local_spans->push_back(*this);
 }
 
-std::string Span::Impl::GetParentIdForLogging(const Span::Impl* parent) {
+impl::SpanId Span::Impl::GetParentIdForLogging(const Span::Impl* parent) {
   if (!parent) return {};
 
   if (!parent->is_linked()) {
-    return parent->GetSpanId();
+    return parent->span_id_;
   }
 
   const auto* spans_ptr = task_local_spans.GetOptional();
@@ -170,9 +276,9 @@ std::string Span::Impl::GetParentIdForLogging(const Span::Impl* parent) {
   // orphaned. It's still possible for chaining to break in case parent span
   // becomes non-loggable after child span is created, but that we can't control
   for (auto current = spans_ptr->iterator_to(*parent);; --current) {
-    if (current->GetParentId().empty() /* won't find better candidate */ ||
+    if (!current->HasParentId() /* won't find better candidate */ ||
         current->ShouldLog()) {
-      return current->GetSpanId();
+      return current->span_id_;
     }
     if (current == spans_ptr->begin()) break;
   }
@@ -189,9 +295,31 @@ bool Span::Impl::ShouldLog() const {
          local_log_level_.value_or(logging::Level::kTrace) <= log_level_;
 }
 
+void* AllocateImplStorage() {
+  {
+    auto cache = local_impl_storage_cache.Use();
+    if (cache->size != 0) {
+      return cache->storages[--cache->size];
+    }
+  }
+  return ::operator new(sizeof(Span::Impl));
+}
+
+void DeallocateImplStorage(void* storage) noexcept {
+  {
+    auto cache = local_impl_storage_cache.Use();
+    if (cache->size != kMaxCachedImplStorages) {
+      cache->storages[cache->size++] = storage;
+      return;
+    }
+  }
+  ::operator delete(storage);
+}
+
 void Span::OptionalDeleter::operator()(Span::Impl* impl) const noexcept {
   if (do_delete) {
-    std::default_delete<Impl>{}(impl);
+    impl->~Impl();
+    DeallocateImplStorage(impl);
   }
 }
 
@@ -222,7 +350,7 @@ Span::Span(std::string name, ReferenceType reference_type,
                           source_location),
              Span::OptionalDeleter{OptionalDeleter::ShouldDelete()}) {
   AttachToCoroStack();
-  if (pimpl_->GetParentId().empty()) {
+  if (!pimpl_->HasParentId()) {
     SetLink(utils::generators::GenerateUuid());
   }
   pimpl_->span_ = this;
@@ -315,6 +443,9 @@ tracing::ScopeTime Span::CreateScopeTime(std::string name) {
 
 void Span::AddNonInheritableTag(std::string key,
                                 logging::LogExtra::Value value) {
+  if (pimpl_->trace_buffer_ && IsErrorTag(key, value)) {
+    pimpl_->trace_buffer_->MarkError();
+  }
   if (!pimpl_->log_extra_local_) pimpl_->log_extra_local_.emplace();
   pimpl_->log_extra_local_->Extend(std::move(key), std::move(value));
 }
@@ -340,6 +471,9 @@ std::optional<logging::Level> Span::GetLocalLogLevel() const {
 }
 
 void Span::AddTag(std::string key, logging::LogExtra::Value value) {
+  if (pimpl_->trace_buffer_ && IsErrorTag(key, value)) {
+    pimpl_->trace_buffer_->MarkError();
+  }
   pimpl_->log_extra_inheritable_.Extend(std::move(key), std::move(value));
 }
 
@@ -423,6 +557,19 @@ const Span::Impl* GetParentSpanImpl() {
   return !spans_ptr || spans_ptr->empty() ? nullptr : &spans_ptr->back();
 }
 
+std::size_t CopyRootSpanNameOfCurrentTask(utils::span<char> buffer) noexcept {
+  auto* const context = engine::current_task::GetCurrentTaskContextUnchecked();
+  if (!context || !context->HasLocalStorage()) return 0;
+
+  const auto* spans_ptr = task_local_spans.GetOptional();
+  if (!spans_ptr || spans_ptr->empty()) return 0;
+
+  const auto& name = spans_ptr->front().GetName();
+  const auto size = std::min(name.size(), buffer.size());
+  std::copy_n(name.data(), size, buffer.data());
+  return size;
+}
+
 DetachLocalSpansScope::DetachLocalSpansScope() noexcept {
   if (engine::current_task::IsTaskProcessorThread()) {
     if (auto* const spans_ptr = task_local_spans.GetOptional()) {
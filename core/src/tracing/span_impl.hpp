@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <list>
+#include <new>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -17,11 +18,19 @@
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/impl/source_location.hpp>
+#include <userver/utils/span.hpp>
 
+#include <engine/task/wait_kind.hpp>
+#include <tracing/hex_id.hpp>
+#include <tracing/tail_sampling.hpp>
 #include <tracing/time_storage.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
+namespace engine::impl {
+class TaskContext;
+}  // namespace engine::impl
+
 namespace tracing {
 
 inline const std::string kLinkTag = "link";
@@ -51,23 +60,31 @@ class Span::Impl
   // Log this Span specifically
   void PutIntoLogger(logging::impl::TagWriter writer) &&;
 
+  // Write the record of this Span into `logger`
+  void LogInto(logging::impl::LoggerBase& logger) &&;
+
   // Add the context of this Span a non-Span-specific log record
   void LogTo(logging::impl::TagWriter writer);
 
-  const std::string& GetTraceId() const& noexcept { return trace_id_; }
-  const std::string& GetSpanId() const& noexcept { return span_id_; }
-  const std::string& GetParentId() const& noexcept { return parent_id_; }
+  const std::string& GetTraceId() const& { return trace_id_.GetString(); }
+  const std::string& GetSpanId() const& { return span_id_.GetString(); }
+  const std::string& GetParentId() const& { return parent_id_.GetString(); }
 
-  std::string GetTraceId() && noexcept { return std::move(trace_id_); }
-  std::string GetSpanId() && noexcept { return std::move(span_id_); }
-  std::string GetParentId() && noexcept { return std::move(parent_id_); }
+  std::string GetTraceId() && { return std::move(trace_id_).Release(); }
+  std::string GetSpanId() && { return std::move(span_id_).Release(); }
+  std::string GetParentId() && { return std::move(parent_id_).Release(); }
 
   void SetTraceId(std::string&& id) noexcept { trace_id_ = std::move(id); }
   void SetSpanId(std::string&& id) noexcept { span_id_ = std::move(id); }
   void SetParentId(std::string&& id) noexcept { parent_id_ = std::move(id); }
 
+  // Does not format the id, unlike GetParentId().empty()
+  bool HasParentId() const noexcept { return !parent_id_.IsEmpty(); }
+
   ReferenceType GetReferenceType() const noexcept { return reference_type_; }
 
+  const std::string& GetName() const noexcept { return name_; }
+
   void DetachFromCoroStack();
   void AttachToCoroStack();
 
@@ -77,9 +94,13 @@ class Span::Impl
   static void AddOpentracingTags(formats::json::StringBuilder& output,
                                  const logging::LogExtra& input);
 
-  static std::string GetParentIdForLogging(const Span::Impl* parent);
+  static impl::SpanId GetParentIdForLogging(const Span::Impl* parent);
   bool ShouldLog() const;
 
+  // Adds the time the task has spent waiting and running on CPU since the
+  // span creation to the time storage
+  void AccountTaskTimes();
+
   const std::string name_;
   const bool is_no_log_span_;
   logging::Level log_level_;
@@ -96,12 +117,21 @@ class Span::Impl
   const std::chrono::system_clock::time_point start_system_time_;
   const std::chrono::steady_clock::time_point start_steady_time_;
 
-  std::string trace_id_;
-  std::string span_id_;
-  std::string parent_id_;
+  impl::TraceId trace_id_;
+  impl::SpanId span_id_;
+  impl::SpanId parent_id_;
   const ReferenceType reference_type_;
   utils::impl::SourceLocation source_location_;
 
+  // Shared by all the spans of a trace if tail sampling is enabled
+  std::shared_ptr<impl::TraceBuffer> trace_buffer_;
+  bool is_trace_buffer_owner_{false};
+
+  // The wait and CPU times of the task at the span creation
+  const engine::impl::TaskContext* task_context_{nullptr};
+  engine::impl::WaitTimes wait_times_at_start_{};
+  std::chrono::nanoseconds cpu_time_at_start_{0};
+
   friend class Span;
   friend class SpanBuilder;
   friend class TagScope;
@@ -115,9 +145,27 @@ using SpanStack =
 
 const Span::Impl* GetParentSpanImpl();
 
+// Copies the name of the outermost span of the current task into `buffer`,
+// truncating it to the buffer size, and returns the copied size. Does not
+// allocate or lock, so it may be called from a signal handler that has
+// interrupted the task. The result is unreliable if the task was interrupted
+// in the middle of a span creation or destruction.
+std::size_t CopyRootSpanNameOfCurrentTask(utils::span<char> buffer) noexcept;
+
+// Span::Impl is large and is created for every Span, so the storage for it is
+// reused through a small per-thread cache instead of going to the allocator.
+void* AllocateImplStorage();
+void DeallocateImplStorage(void* storage) noexcept;
+
 template <typename... Args>
 Span::Impl* AllocateImpl(Args&&... args) {
-  return new Span::Impl(std::forward<Args>(args)...);
+  void* const storage = AllocateImplStorage();
+  try {
+    return new (storage) Span::Impl(std::forward<Args>(args)...);
+  } catch (...) {
+    DeallocateImplStorage(storage);
+    throw;
+  }
 }
 
 class DetachLocalSpansScope final {
@@ -104,9 +104,9 @@ void Span::Impl::DoLogOpenTracing(logging::impl::TagWriter writer) const {
   if (tracer_) {
     writer.PutTag(jaeger::kServiceName, tracer_->GetServiceName());
   }
-  writer.PutTag(jaeger::kTraceId, trace_id_);
-  writer.PutTag(jaeger::kParentId, parent_id_);
-  writer.PutTag(jaeger::kSpanId, span_id_);
+  writer.PutTag(jaeger::kTraceId, GetTraceId());
+  writer.PutTag(jaeger::kParentId, GetParentId());
+  writer.PutTag(jaeger::kSpanId, GetSpanId());
   writer.PutTag(jaeger::kStartTime, start_time);
   writer.PutTag(jaeger::kStartTimeMillis, start_time / 1000);
   writer.PutTag(jaeger::kDuration, duration_microseconds);
@@ -1,6 +1,7 @@
 #include <fmt/format.h>
 #include <gmock/gmock.h>
 
+#include <engine/task/task_processor.hpp>
 #include <logging/log_helper_impl.hpp>
 #include <logging/logging_test.hpp>
 #include <tracing/no_log_spans.hpp>
@@ -297,6 +298,43 @@ UTEST_F(Span, ScopeTimeDoesntOverrideTotalTime) {
   EXPECT_LE(xxx_time.value() + kSleepMs, total_time.value());
 }
 
+UTEST_F(Span, WaitTimes) {
+  auto& task_processor = engine::current_task::GetTaskProcessor();
+  engine::TaskProcessorSettings settings;
+  settings.profiler_wait_time_accounting = true;
+  task_processor.SetSettings(settings);
+
+  {
+    tracing::Span span("span_name");
+    engine::SleepFor(std::chrono::milliseconds{1});
+  }
+  task_processor.SetSettings({});
+
+  logging::LogFlush();
+  EXPECT_THAT(GetStreamString(), HasSubstr("wait_sleep_time="));
+  EXPECT_THAT(GetStreamString(), Not(HasSubstr("wait_mutex_time=")));
+}
+
+UTEST_F(Span, CpuTime) {
+  auto& task_processor = engine::current_task::GetTaskProcessor();
+  engine::TaskProcessorSettings settings;
+  settings.profiler_cpu_time_accounting = true;
+  task_processor.SetSettings(settings);
+  engine::Yield();
+
+  {
+    tracing::Span span("span_name");
+    const auto until =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds{1};
+    while (std::chrono::steady_clock::now() < until) {
+    }
+  }
+  task_processor.SetSettings({});
+
+  logging::LogFlush();
+  EXPECT_THAT(GetStreamString(), HasSubstr("cpu_time="));
+}
+
 UTEST_F(Span, GetElapsedTime) {
   tracing::Span span("span_name");
   auto st = span.CreateScopeTime("xxx");
@@ -687,6 +725,26 @@ UTEST_F(Span, SetLogLevelDoesntBreakGenealogyMultiSkip) {
   }
 }
 
+UTEST_F(Span, GeneratedIds) {
+  tracing::Span root_span("root_span");
+  EXPECT_EQ(root_span.GetTraceId().size(), 32);
+  EXPECT_EQ(root_span.GetSpanId().size(), 16);
+  EXPECT_EQ(root_span.GetTraceId().find_first_not_of("0123456789abcdef"),
+            std::string::npos);
+  EXPECT_EQ(root_span.GetSpanId().find_first_not_of("0123456789abcdef"),
+            std::string::npos);
+  EXPECT_EQ(root_span.GetParentId(), "");
+
+  tracing::Span child_span("child_span");
+  EXPECT_EQ(child_span.GetTraceId(), root_span.GetTraceId());
+  EXPECT_EQ(child_span.GetParentId(), root_span.GetSpanId());
+  EXPECT_NE(child_span.GetSpanId(), root_span.GetSpanId());
+
+  logging::LogFlush();
+  EXPECT_THAT(GetStreamString(),
+              HasSubstr(fmt::format("trace_id={}", root_span.GetTraceId())));
+}
+
 UTEST_F(Span, MakeSpanWithParentIdTraceIdLink) {
   std::string trace_id = "1234567890-trace-id";
   std::string parent_id = "1234567890-parent-id";
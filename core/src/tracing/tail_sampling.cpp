@@ -0,0 +1,220 @@
+#include <tracing/tail_sampling.hpp>
+
+#include <random>
+#include <stdexcept>
+
+#include <userver/logging/impl/tag_writer.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+namespace {
+
+auto& GlobalConfig() {
+  static rcu::Variable<std::optional<TailSamplingConfig>> config{};
+  return config;
+}
+
+TailSamplingStatistics& GlobalStatistics() noexcept {
+  static TailSamplingStatistics stats;
+  return stats;
+}
+
+}  // namespace
+
+TailSamplingConfig Parse(const yaml_config::YamlConfig& value,
+                         formats::parse::To<TailSamplingConfig>) {
+  TailSamplingConfig config;
+  config.latency_threshold =
+      value["latency-threshold"].As<std::chrono::milliseconds>(
+          config.latency_threshold);
+  config.sample_probability =
+      value["sample-probability"].As<double>(config.sample_probability);
+  config.max_spans_per_trace =
+      value["max-spans-per-trace"].As<std::size_t>(config.max_spans_per_trace);
+  config.max_bytes_per_trace =
+      value["max-bytes-per-trace"].As<std::size_t>(config.max_bytes_per_trace);
+  config.max_total_bytes =
+      value["max-total-bytes"].As<std::size_t>(config.max_total_bytes);
+
+  if (config.sample_probability < 0 || config.sample_probability > 1) {
+    throw std::runtime_error(
+        "Invalid 'sample-probability' of tail sampling, expected a value in "
+        "[0, 1]");
+  }
+  return config;
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const TailSamplingStatistics& stats) {
+  writer["traces"]["kept"] = stats.traces_kept;
+  writer["traces"]["dropped"] = stats.traces_dropped;
+  writer["traces"]["overflowed"] = stats.traces_overflowed;
+  writer["traces"]["not_buffered"] = stats.traces_not_buffered;
+  writer["spans_dropped"] = stats.spans_dropped;
+  writer["buffered_bytes"] = stats.buffered_bytes.load();
+}
+
+void SetTailSamplingConfig(std::optional<TailSamplingConfig> config) {
+  GlobalConfig().Assign(std::move(config));
+}
+
+const TailSamplingStatistics& GetTailSamplingStatistics() noexcept {
+  return GlobalStatistics();
+}
+
+TraceBuffer::TraceBuffer(const TailSamplingConfig& config) : config_(config) {}
+
+TraceBuffer::~TraceBuffer() { ReleaseMemory(); }
+
+TraceBuffer::Action TraceBuffer::GetAction() const noexcept {
+  switch (state_.load()) {
+    case State::kBuffering:
+      return Action::kBuffer;
+    case State::kPassThrough:
+      return Action::kLog;
+    case State::kDropped:
+      return Action::kDrop;
+  }
+  UINVARIANT(false, "Unexpected trace buffer state");
+}
+
+void TraceBuffer::Add(logging::impl::LoggerBase& logger, logging::Level level,
+                      std::string_view record) {
+  auto& stats = GlobalStatistics();
+  std::string records;
+  std::vector<RecordInfo> infos;
+
+  {
+    std::unique_lock lock{mutex_};
+    switch (state_.load()) {
+      case State::kBuffering:
+        break;
+      case State::kPassThrough:
+        lock.unlock();
+        logger.Trace(level, record);
+        return;
+      case State::kDropped:
+        ++stats.spans_dropped;
+        return;
+    }
+
+    const bool fits =
+        infos_.size() < config_.max_spans_per_trace &&
+        records_.size() + record.size() <= config_.max_bytes_per_trace &&
+        static_cast<std::size_t>(stats.buffered_bytes.load()) +
+                record.size() <=
+            config_.max_total_bytes;
+    if (fits) {
+      records_.append(record);
+      infos_.push_back({level, record.size()});
+      accounted_bytes_ += record.size();
+      stats.buffered_bytes += record.size();
+      return;
+    }
+
+    // Too large to buffer, write out everything and stop sampling the trace
+    state_ = State::kPassThrough;
+    TakeRecords(records, infos);
+  }
+
+  ++stats.traces_overflowed;
+  WriteRecords(logger, records, infos);
+  logger.Trace(level, record);
+}
+
+void TraceBuffer::MarkError() noexcept { has_error_ = true; }
+
+void TraceBuffer::Finish(logging::impl::LoggerBase& logger,
+                         std::chrono::steady_clock::duration root_duration) {
+  auto& stats = GlobalStatistics();
+  const bool keep =
+      has_error_ || root_duration >= config_.latency_threshold ||
+      utils::WithDefaultRandom(
+          std::bernoulli_distribution{config_.sample_probability});
+
+  std::string records;
+  std::vector<RecordInfo> infos;
+  {
+    const std::lock_guard lock{mutex_};
+    // Already written out on overflow
+    if (state_ != State::kBuffering) return;
+
+    if (keep) {
+      state_ = State::kPassThrough;
+      TakeRecords(records, infos);
+    } else {
+      state_ = State::kDropped;
+      stats.spans_dropped += utils::statistics::Rate{infos_.size()};
+      ReleaseMemory();
+    }
+  }
+
+  ++(keep ? stats.traces_kept : stats.traces_dropped);
+  WriteRecords(logger, records, infos);
+}
+
+void TraceBuffer::TakeRecords(std::string& records,
+                              std::vector<RecordInfo>& infos) {
+  records = std::move(records_);
+  infos = std::move(infos_);
+  ReleaseMemory();
+}
+
+void TraceBuffer::WriteRecords(logging::impl::LoggerBase& logger,
+                               std::string_view records,
+                               const std::vector<RecordInfo>& infos) {
+  for (const auto& info : infos) {
+    logger.Trace(info.level, records.substr(0, info.size));
+    records.remove_prefix(info.size);
+  }
+}
+
+void TraceBuffer::ReleaseMemory() noexcept {
+  GlobalStatistics().buffered_bytes -= accounted_bytes_;
+  accounted_bytes_ = 0;
+  records_ = {};
+  infos_ = {};
+}
+
+std::shared_ptr<TraceBuffer> StartTraceBuffer() {
+  const auto config = GlobalConfig().Read();
+  if (!config->has_value()) return nullptr;
+
+  auto& stats = GlobalStatistics();
+  if (static_cast<std::size_t>(stats.buffered_bytes.load()) >=
+      (*config)->max_total_bytes) {
+    ++stats.traces_not_buffered;
+    return nullptr;
+  }
+  return std::make_shared<TraceBuffer>(**config);
+}
+
+TraceBufferLogger::TraceBufferLogger(logging::impl::LoggerBase& target,
+                                     TraceBuffer& buffer)
+    : LoggerBase(target.GetFormat()), target_(target), buffer_(buffer) {
+  SetLevel(logging::Level::kTrace);
+}
+
+void TraceBufferLogger::Log(logging::Level level, std::string_view msg) {
+  buffer_.Add(target_, level, msg);
+}
+
+void TraceBufferLogger::PrependCommonTags(
+    logging::impl::TagWriter writer) const {
+  target_.PrependCommonTags(writer);
+}
+
+bool TraceBufferLogger::SymbolizesDeferredStacktraces() const noexcept {
+  // The buffered records are written by the target as is
+  return target_.SymbolizesDeferredStacktraces();
+}
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
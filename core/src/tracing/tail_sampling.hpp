@@ -0,0 +1,146 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/formats/parse/to.hpp>
+#include <userver/logging/impl/logger_base.hpp>
+#include <userver/logging/level.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+struct TailSamplingConfig final {
+  // Traces with the root span at least that long are always kept
+  std::chrono::milliseconds latency_threshold{500};
+  // The share of the fast successful traces to keep
+  double sample_probability{0.01};
+  // A trace that exceeds any of the per-trace limits is written out as is
+  std::size_t max_spans_per_trace{256};
+  std::size_t max_bytes_per_trace{256 * 1024};
+  // New traces are not buffered while the buffered ones use that much memory
+  std::size_t max_total_bytes{64 * 1024 * 1024};
+};
+
+TailSamplingConfig Parse(const yaml_config::YamlConfig& value,
+                         formats::parse::To<TailSamplingConfig>);
+
+struct TailSamplingStatistics final {
+  utils::statistics::RateCounter traces_kept;
+  utils::statistics::RateCounter traces_dropped;
+  // Written out on reaching the per-trace or the total limits
+  utils::statistics::RateCounter traces_overflowed;
+  // Not buffered at all because of the total memory limit
+  utils::statistics::RateCounter traces_not_buffered;
+  utils::statistics::RateCounter spans_dropped;
+  std::atomic<std::int64_t> buffered_bytes{0};
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const TailSamplingStatistics& stats);
+
+/// Enables the tail-based sampling for the new traces, or disables it if
+/// `config` is empty
+void SetTailSamplingConfig(std::optional<TailSamplingConfig> config);
+
+const TailSamplingStatistics& GetTailSamplingStatistics() noexcept;
+
+/// @brief Keeps the rendered span records of a single trace until the root
+/// span finishes and decides whether the whole trace gets logged.
+///
+/// Shared by all the spans of the trace, the spans may finish concurrently in
+/// different tasks. Spans that finish after the decision are logged or
+/// dropped according to it.
+class TraceBuffer final {
+ public:
+  enum class Action {
+    kBuffer,
+    kLog,
+    kDrop,
+  };
+
+  explicit TraceBuffer(const TailSamplingConfig& config);
+  ~TraceBuffer();
+
+  TraceBuffer(TraceBuffer&&) = delete;
+  TraceBuffer& operator=(TraceBuffer&&) = delete;
+
+  /// Returns what to do with a finished span, to skip rendering the dropped
+  /// ones. A span rendered for kBuffer should still be passed to Add, as the
+  /// decision may have been made in the meantime.
+  Action GetAction() const noexcept;
+
+  /// Keeps the rendered span record, or writes it to `logger` if the trace is
+  /// already decided to be kept or has overflowed
+  void Add(logging::impl::LoggerBase& logger, logging::Level level,
+           std::string_view record);
+
+  void MarkError() noexcept;
+
+  /// Decides the trace fate on the root span finish and writes out the kept
+  /// records to `logger`
+  void Finish(logging::impl::LoggerBase& logger,
+              std::chrono::steady_clock::duration root_duration);
+
+ private:
+  enum class State : std::uint8_t {
+    kBuffering,
+    kPassThrough,
+    kDropped,
+  };
+
+  struct RecordInfo final {
+    logging::Level level;
+    std::size_t size;
+  };
+
+  // Moves the buffered records out, the caller should write them out
+  void TakeRecords(std::string& records, std::vector<RecordInfo>& infos);
+  void ReleaseMemory() noexcept;
+  static void WriteRecords(logging::impl::LoggerBase& logger,
+                           std::string_view records,
+                           const std::vector<RecordInfo>& infos);
+
+  const TailSamplingConfig config_;
+  std::atomic<State> state_{State::kBuffering};
+  std::atomic<bool> has_error_{false};
+
+  std::mutex mutex_;
+  std::string records_;
+  std::vector<RecordInfo> infos_;
+  std::size_t accounted_bytes_{0};
+};
+
+/// Starts a buffer for a new trace. Returns nullptr if tail sampling is
+/// disabled or the buffered traces have reached the total memory limit.
+std::shared_ptr<TraceBuffer> StartTraceBuffer();
+
+/// Forwards the records rendered by logging::LogHelper to a TraceBuffer
+class TraceBufferLogger final : public logging::impl::LoggerBase {
+ public:
+  TraceBufferLogger(logging::impl::LoggerBase& target, TraceBuffer& buffer);
+
+  void Log(logging::Level level, std::string_view msg) override;
+  void PrependCommonTags(logging::impl::TagWriter writer) const override;
+  bool SymbolizesDeferredStacktraces() const noexcept override;
+
+ private:
+  logging::impl::LoggerBase& target_;
+  TraceBuffer& buffer_;
+};
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,111 @@
+#include <tracing/tail_sampling.hpp>
+
+#include <optional>
+
+#include <gmock/gmock.h>
+
+#include <logging/logging_test.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/tracing/tags.hpp>
+#include <userver/utest/utest.hpp>
+
+using testing::HasSubstr;
+using testing::Not;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+tracing::impl::TailSamplingConfig MakeDroppingConfig() {
+  tracing::impl::TailSamplingConfig config;
+  config.latency_threshold = std::chrono::hours{1};
+  config.sample_probability = 0;
+  return config;
+}
+
+class TailSampling : public LoggingTest {
+ protected:
+  TailSampling() { tracing::impl::SetTailSamplingConfig(MakeDroppingConfig()); }
+
+  ~TailSampling() override { tracing::impl::SetTailSamplingConfig({}); }
+
+  std::string FlushedLogs() const {
+    logging::LogFlush();
+    return GetStreamString();
+  }
+};
+
+}  // namespace
+
+UTEST_F(TailSampling, DropsFastTrace) {
+  const auto& stats = tracing::impl::GetTailSamplingStatistics();
+  const auto dropped_before = stats.traces_dropped.Load();
+  {
+    auto root = tracing::Span::MakeRootSpan("root_span");
+    const auto child = root.CreateChild("child_span");
+  }
+
+  EXPECT_THAT(FlushedLogs(), Not(HasSubstr("root_span")));
+  EXPECT_THAT(FlushedLogs(), Not(HasSubstr("child_span")));
+  EXPECT_EQ(stats.traces_dropped.Load().value, dropped_before.value + 1);
+  EXPECT_EQ(stats.buffered_bytes.load(), 0);
+}
+
+UTEST_F(TailSampling, KeepsTraceWithError) {
+  {
+    auto root = tracing::Span::MakeRootSpan("root_span");
+    auto child = root.CreateChild("child_span");
+    child.AddTag(tracing::kErrorFlag, true);
+  }
+
+  EXPECT_THAT(FlushedLogs(), HasSubstr("stopwatch_name=root_span"));
+  EXPECT_THAT(FlushedLogs(), HasSubstr("stopwatch_name=child_span"));
+}
+
+UTEST_F(TailSampling, KeepsSlowTrace) {
+  auto config = MakeDroppingConfig();
+  config.latency_threshold = std::chrono::milliseconds{0};
+  tracing::impl::SetTailSamplingConfig(config);
+
+  {
+    auto root = tracing::Span::MakeRootSpan("root_span");
+    const auto child = root.CreateChild("child_span");
+  }
+
+  EXPECT_THAT(FlushedLogs(), HasSubstr("stopwatch_name=root_span"));
+  EXPECT_THAT(FlushedLogs(), HasSubstr("stopwatch_name=child_span"));
+}
+
+UTEST_F(TailSampling, WritesOutOnOverflow) {
+  auto config = MakeDroppingConfig();
+  config.max_spans_per_trace = 1;
+  tracing::impl::SetTailSamplingConfig(config);
+
+  auto root = tracing::Span::MakeRootSpan("root_span");
+  { const auto child = root.CreateChild("child_span_1"); }
+  EXPECT_THAT(FlushedLogs(), Not(HasSubstr("child_span_1")));
+
+  { const auto child = root.CreateChild("child_span_2"); }
+  EXPECT_THAT(FlushedLogs(), HasSubstr("stopwatch_name=child_span_1"));
+  EXPECT_THAT(FlushedLogs(), HasSubstr("stopwatch_name=child_span_2"));
+}
+
+UTEST_F(TailSampling, LateSpanFollowsDecision) {
+  std::optional<tracing::Span> child;
+  {
+    auto root = tracing::Span::MakeRootSpan("root_span");
+    child.emplace(root.CreateChild("child_span"));
+  }
+  child.reset();
+
+  EXPECT_THAT(FlushedLogs(), Not(HasSubstr("child_span")));
+}
+
+UTEST_F(TailSampling, Disabled) {
+  tracing::impl::SetTailSamplingConfig({});
+  { const auto root = tracing::Span::MakeRootSpan("root_span"); }
+
+  EXPECT_THAT(FlushedLogs(), HasSubstr("stopwatch_name=root_span"));
+}
+
+USERVER_NAMESPACE_END
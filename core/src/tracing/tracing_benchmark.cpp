@@ -2,6 +2,7 @@
 
 #include <userver/engine/run_standalone.hpp>
 #include <userver/logging/null_logger.hpp>
+#include <userver/tracing/span.hpp>
 #include <userver/tracing/tracer.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -33,6 +34,18 @@ void tracing_happy_log(benchmark::State& state) {
 }
 BENCHMARK(tracing_happy_log);
 
+void tracing_child_ctr(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    tracing::Span root_span{"root"};
+
+    for ([[maybe_unused]] auto _ : state) {
+      tracing::Span span{"child"};
+      benchmark::DoNotOptimize(span);
+    }
+  });
+}
+BENCHMARK(tracing_child_ctr);
+
 tracing::Span GetSpanWithOpentracingHttpTags(tracing::TracerPtr tracer) {
   auto span = tracer->CreateSpanWithoutParent("name");
   span.AddTag("meta_code", 200);
@@ -1,5 +1,7 @@
 #include <userver/utils/async.hpp>
 
+#include <baggage/raw_baggage.hpp>
+#include <engine/task/task_context.hpp>
 #include <tracing/span_impl.hpp>
 #include <userver/baggage/baggage_manager.hpp>
 #include <userver/engine/task/inherited_variable.hpp>
@@ -27,6 +29,8 @@ SpanWrapCall::Impl::Impl(std::string&& name, InheritVariables inherit_variables)
   } else {
     baggage::kInheritedBaggage.InheritTo(
         storage_, engine::impl::task_local::InternalTag{});
+    baggage::impl::kInheritedRawBaggage.InheritTo(
+        storage_, engine::impl::task_local::InternalTag{});
   }
 }
 
@@ -42,6 +46,20 @@ void SpanWrapCall::DoBeforeInvoke() {
 
 SpanWrapCall::~SpanWrapCall() = default;
 
+RequestDeadlineBlocker::RequestDeadlineBlocker() noexcept {
+  auto* const context = engine::current_task::GetCurrentTaskContextUnchecked();
+  if (!context) return;
+  old_deadline_ = context->GetRequestDeadline();
+  if (old_deadline_.IsReachable()) context->SetRequestDeadline({});
+}
+
+RequestDeadlineBlocker::~RequestDeadlineBlocker() {
+  if (old_deadline_.IsReachable()) {
+    engine::current_task::GetCurrentTaskContext().SetRequestDeadline(
+        old_deadline_);
+  }
+}
+
 }  // namespace utils::impl
 
 USERVER_NAMESPACE_END
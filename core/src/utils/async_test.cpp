@@ -6,7 +6,10 @@
 #include <boost/range/numeric.hpp>
 
 #include <userver/concurrent/variable.hpp>
+#include <userver/engine/get_all.hpp>
+#include <userver/engine/task/inherited_variable.hpp>
 #include <userver/engine/task/task_with_result.hpp>
+#include <userver/tracing/span.hpp>
 #include <userver/utest/utest.hpp>
 
 #include <engine/ev/thread_control.hpp>
@@ -74,6 +77,29 @@ UTEST(UtilsAsync, FromNonWorkerThread) {
 
 namespace {
 
+engine::TaskInheritedVariable<std::string> kBatchVariable;
+
+}  // namespace
+
+UTEST_MT(UtilsAsync, AsyncBatch, 4) {
+  tracing::Span span("parent");
+  kBatchVariable.Set("inherited");
+
+  constexpr std::size_t kCount = 50;
+  auto tasks = utils::AsyncBatch("batch", kCount, [](std::size_t index) {
+    EXPECT_EQ(kBatchVariable.Get(), "inherited");
+    return tracing::Span::CurrentSpan().GetParentId() + std::to_string(index);
+  });
+  ASSERT_EQ(tasks.size(), kCount);
+
+  const auto results = engine::GetAll(tasks);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    EXPECT_EQ(results[i], span.GetSpanId() + std::to_string(i));
+  }
+}
+
+namespace {
+
 using Request = int;
 using Response = int;
 
@@ -6,6 +6,14 @@
 #include <cerrno>
 #endif
 
+#include <sys/types.h>
+
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+#include <fmt/format.h>
+
 #include <userver/utils/thread_name.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -36,6 +44,19 @@ std::error_code MallCtl(const char* name) {
   return MakeErrorCode(rc);
 }
 
+template <typename T>
+std::error_code MallCtlRead(const char* name, T& value) {
+  size_t size = sizeof(value);
+  int rc = mallctl(name, &value, &size, nullptr, 0);
+  return MakeErrorCode(rc);
+}
+
+std::error_code ReadArenaStat(unsigned arena_index, std::string_view stat,
+                              std::size_t& value) {
+  const auto name = fmt::format("stats.arenas.{}.{}", arena_index, stat);
+  return MallCtlRead(name.c_str(), value);
+}
+
 void MallocStatPrintCb(void* data, const char* msg) {
   auto* s = static_cast<std::string*>(data);
   *s += msg;
@@ -68,6 +89,63 @@ std::error_code StopBgThreads() {
   return MallCtl<bool>("background_thread", false);
 }
 
+std::error_code CreateArena(unsigned& arena_index) {
+  return MallCtlRead("arenas.create", arena_index);
+}
+
+std::error_code SetArenaDirtyDecay(unsigned arena_index,
+                                   std::chrono::milliseconds decay) {
+  const auto name = fmt::format("arena.{}.dirty_decay_ms", arena_index);
+  return MallCtl<ssize_t>(name.c_str(), decay.count());
+}
+
+std::error_code SetArenaMuzzyDecay(unsigned arena_index,
+                                   std::chrono::milliseconds decay) {
+  const auto name = fmt::format("arena.{}.muzzy_decay_ms", arena_index);
+  return MallCtl<ssize_t>(name.c_str(), decay.count());
+}
+
+std::error_code BindThreadToArena(unsigned arena_index) {
+  return MallCtl<unsigned>("thread.arena", arena_index);
+}
+
+std::error_code SetThreadTcacheEnabled(bool enabled) {
+  return MallCtl<bool>("thread.tcache.enabled", enabled);
+}
+
+std::error_code GetArenaStats(unsigned arena_index, ArenaStats& stats) {
+  // The stats are cached by jemalloc until the epoch is advanced
+  if (auto ec = MallCtl<std::uint64_t>("epoch", 1)) return ec;
+
+  std::size_t page_size = 0;
+  if (auto ec = MallCtlRead("arenas.page", page_size)) return ec;
+
+  std::size_t small_allocated = 0;
+  std::size_t large_allocated = 0;
+  std::size_t active_pages = 0;
+  std::size_t dirty_pages = 0;
+  std::size_t muzzy_pages = 0;
+  ArenaStats result;
+  for (auto [stat, value] : {
+           std::pair{"small.allocated", &small_allocated},
+           std::pair{"large.allocated", &large_allocated},
+           std::pair{"pactive", &active_pages},
+           std::pair{"pdirty", &dirty_pages},
+           std::pair{"pmuzzy", &muzzy_pages},
+           std::pair{"mapped", &result.mapped_bytes},
+           std::pair{"resident", &result.resident_bytes},
+       }) {
+    if (auto ec = ReadArenaStat(arena_index, stat, *value)) return ec;
+  }
+
+  result.allocated_bytes = small_allocated + large_allocated;
+  result.active_bytes = active_pages * page_size;
+  result.dirty_bytes = dirty_pages * page_size;
+  result.muzzy_bytes = muzzy_pages * page_size;
+  stats = result;
+  return {};
+}
+
 }  // namespace utils::jemalloc
 
 USERVER_NAMESPACE_END
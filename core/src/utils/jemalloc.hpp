@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <string>
 #include <system_error>
 
@@ -22,6 +24,36 @@ std::error_code EnableBgThreads();
 // blocking
 std::error_code StopBgThreads();
 
+/// Memory of a single arena, as of the last stats refresh
+struct ArenaStats {
+  // small and large allocations in use
+  std::size_t allocated_bytes{0};
+  // pages with allocations in use
+  std::size_t active_bytes{0};
+  // unused pages not yet returned to the OS
+  std::size_t dirty_bytes{0};
+  std::size_t muzzy_bytes{0};
+  std::size_t mapped_bytes{0};
+  std::size_t resident_bytes{0};
+};
+
+/// Creates a new arena, the automatic arenas are not affected
+std::error_code CreateArena(unsigned& arena_index);
+
+std::error_code SetArenaDirtyDecay(unsigned arena_index,
+                                   std::chrono::milliseconds decay);
+
+std::error_code SetArenaMuzzyDecay(unsigned arena_index,
+                                   std::chrono::milliseconds decay);
+
+/// Makes the current thread allocate from the arena
+std::error_code BindThreadToArena(unsigned arena_index);
+
+std::error_code SetThreadTcacheEnabled(bool enabled);
+
+/// Refreshes the jemalloc stats and reads the ones of the arena
+std::error_code GetArenaStats(unsigned arena_index, ArenaStats& stats);
+
 }  // namespace utils::jemalloc
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,139 @@
+#include <utils/numa.hpp>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+#include <string>
+
+#include <boost/filesystem/operations.hpp>
+#include <fmt/format.h>
+
+#include <userver/fs/blocking/read.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/text_light.hpp>
+#include <utils/check_syscall.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::numa {
+
+namespace {
+
+constexpr std::string_view kSysfsNodesDir = "/sys/devices/system/node";
+constexpr std::string_view kNodePrefix = "node";
+
+thread_local std::size_t current_thread_node = 0;
+
+std::size_t ParseNumber(std::string_view str, std::string_view cpu_list) {
+  std::size_t result = 0;
+  const auto [ptr, ec] =
+      std::from_chars(str.data(), str.data() + str.size(), result);
+  if (ec != std::errc{} || ptr != str.data() + str.size() || str.empty()) {
+    throw std::runtime_error(
+        fmt::format("Invalid CPU list '{}': '{}' is not a number", cpu_list,
+                    str));
+  }
+  return result;
+}
+
+std::vector<Node> ReadTopology() {
+  std::vector<Node> nodes;
+
+  boost::system::error_code ec;
+  boost::filesystem::directory_iterator it{std::string{kSysfsNodesDir}, ec};
+  if (!ec) {
+    for (; it != boost::filesystem::directory_iterator{}; it.increment(ec)) {
+      if (ec) break;
+      const auto name = it->path().filename().string();
+      if (!utils::text::StartsWith(name, kNodePrefix)) continue;
+
+      std::size_t id = 0;
+      const std::string_view id_str =
+          std::string_view{name}.substr(kNodePrefix.size());
+      const auto [ptr, id_ec] =
+          std::from_chars(id_str.data(), id_str.data() + id_str.size(), id);
+      if (id_ec != std::errc{} || ptr != id_str.data() + id_str.size()) {
+        continue;
+      }
+
+      try {
+        auto cpu_list =
+            fs::blocking::ReadFileContents((it->path() / "cpulist").string());
+        auto cpus = ParseCpuList(utils::text::Trim(std::move(cpu_list)));
+        if (!cpus.empty()) nodes.push_back({id, std::move(cpus)});
+      } catch (const std::exception& ex) {
+        LOG_WARNING() << "Failed to read CPUs of NUMA node " << id << ": "
+                      << ex;
+      }
+    }
+  }
+
+  if (nodes.empty()) return {Node{}};
+
+  std::sort(nodes.begin(), nodes.end(),
+            [](const Node& lhs, const Node& rhs) { return lhs.id < rhs.id; });
+  return nodes;
+}
+
+}  // namespace
+
+std::vector<std::size_t> ParseCpuList(std::string_view cpu_list) {
+  std::vector<std::size_t> cpus;
+
+  std::string_view rest = cpu_list;
+  while (!rest.empty()) {
+    const auto comma = rest.find(',');
+    const auto range = rest.substr(0, comma);
+    rest = (comma == std::string_view::npos) ? std::string_view{}
+                                             : rest.substr(comma + 1);
+
+    const auto dash = range.find('-');
+    if (dash == std::string_view::npos) {
+      cpus.push_back(ParseNumber(range, cpu_list));
+      continue;
+    }
+
+    const auto first = ParseNumber(range.substr(0, dash), cpu_list);
+    const auto last = ParseNumber(range.substr(dash + 1), cpu_list);
+    if (first > last) {
+      throw std::runtime_error(
+          fmt::format("Invalid CPU list '{}': bad range '{}'", cpu_list, range));
+    }
+    for (auto cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+  }
+
+  return cpus;
+}
+
+const std::vector<Node>& GetTopology() {
+  static const auto kTopology = ReadTopology();
+  return kTopology;
+}
+
+void SetCurrentThreadNode(std::size_t node) noexcept {
+  current_thread_node = node;
+}
+
+std::size_t GetCurrentThreadNode() noexcept { return current_thread_node; }
+
+void SetCurrentThreadAffinity(const std::vector<std::size_t>& cpus) {
+  if (cpus.empty()) return;
+
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (const auto cpu : cpus) {
+    if (cpu < CPU_SETSIZE) CPU_SET(cpu, &set);
+  }
+  utils::CheckSyscall(::sched_setaffinity(0, sizeof(set), &set),
+                      "setting thread CPU affinity");
+#endif
+}
+
+}  // namespace utils::numa
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::numa {
+
+struct Node final {
+  std::size_t id{0};
+  std::vector<std::size_t> cpus;
+};
+
+// Parses the Linux CPU list format, e.g. "0-3,8,10-11".
+// @throws std::runtime_error on invalid input
+std::vector<std::size_t> ParseCpuList(std::string_view cpu_list);
+
+// Reads the NUMA topology of the machine from sysfs. Nodes without CPUs are
+// skipped. Returns a single node without CPUs if the topology is unknown.
+const std::vector<Node>& GetTopology();
+
+// Remembers the index of the node in GetTopology() the current thread works
+// on, e.g. to keep the thread's memory on that node.
+void SetCurrentThreadNode(std::size_t node) noexcept;
+
+// Returns the index of the node in GetTopology() the current thread works on,
+// 0 if SetCurrentThreadNode was not called.
+std::size_t GetCurrentThreadNode() noexcept;
+
+// Restricts the current thread to the specified CPUs. No-op on an empty list
+// and on platforms without CPU affinity support.
+// @throws std::system_error
+void SetCurrentThreadAffinity(const std::vector<std::size_t>& cpus);
+
+}  // namespace utils::numa
+
+USERVER_NAMESPACE_END
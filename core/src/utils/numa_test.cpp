@@ -0,0 +1,51 @@
+#include <utils/numa.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thread>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(Numa, ParseCpuList) {
+  using utils::numa::ParseCpuList;
+
+  EXPECT_THAT(ParseCpuList(""), testing::IsEmpty());
+  EXPECT_THAT(ParseCpuList("0"), testing::ElementsAre(0));
+  EXPECT_THAT(ParseCpuList("0-3"), testing::ElementsAre(0, 1, 2, 3));
+  EXPECT_THAT(ParseCpuList("0-1,8,10-11"),
+              testing::ElementsAre(0, 1, 8, 10, 11));
+}
+
+TEST(Numa, ParseCpuListInvalid) {
+  using utils::numa::ParseCpuList;
+
+  EXPECT_THROW(ParseCpuList("a"), std::runtime_error);
+  EXPECT_THROW(ParseCpuList("1-"), std::runtime_error);
+  EXPECT_THROW(ParseCpuList("3-1"), std::runtime_error);
+  EXPECT_THROW(ParseCpuList("1,,2"), std::runtime_error);
+}
+
+TEST(Numa, Topology) {
+  const auto& topology = utils::numa::GetTopology();
+  ASSERT_FALSE(topology.empty());
+
+  for (std::size_t i = 1; i < topology.size(); ++i) {
+    EXPECT_LT(topology[i - 1].id, topology[i].id);
+    EXPECT_FALSE(topology[i].cpus.empty());
+  }
+}
+
+TEST(Numa, CurrentThreadNode) {
+  std::thread([] {
+    EXPECT_EQ(utils::numa::GetCurrentThreadNode(), 0);
+    utils::numa::SetCurrentThreadNode(1);
+    EXPECT_EQ(utils::numa::GetCurrentThreadNode(), 1);
+  }).join();
+
+  std::thread([] {
+    EXPECT_EQ(utils::numa::GetCurrentThreadNode(), 0);
+  }).join();
+}
+
+USERVER_NAMESPACE_END
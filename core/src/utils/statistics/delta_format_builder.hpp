@@ -0,0 +1,34 @@
+#pragma once
+
+#include <mutex>
+
+#include <userver/utils/statistics/metrics_delta.hpp>
+#include <userver/utils/statistics/storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics::impl {
+
+// Forwards to `out` only the metrics that changed since the previous visit
+// with the same `delta`. Forgets the metrics that were not visited on
+// destruction.
+class DeltaFormatBuilder final : public BaseFormatBuilder {
+ public:
+  DeltaFormatBuilder(BaseFormatBuilder& out, MetricsDelta& delta);
+
+  DeltaFormatBuilder(DeltaFormatBuilder&&) = delete;
+  DeltaFormatBuilder& operator=(DeltaFormatBuilder&&) = delete;
+  ~DeltaFormatBuilder() override;
+
+  void HandleMetric(std::string_view path, LabelsSpan labels,
+                    const MetricValue& value) override;
+
+ private:
+  BaseFormatBuilder& out_;
+  MetricsDelta& delta_;
+  std::unique_lock<engine::Mutex> lock_;
+};
+
+}  // namespace utils::statistics::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,175 @@
+#include <userver/utils/statistics/hdr_histogram.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+#include <concurrent/impl/interference_shield.hpp>
+#include <concurrent/impl/rseq.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/impl/histogram_bucket.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace impl::hdr_histogram {
+
+constexpr std::size_t kCountersPerLine =
+    concurrent::impl::kDestructiveInterferenceSize /
+    sizeof(std::atomic<std::uint64_t>);
+
+// Counters of different CPUs never share a cache line.
+struct alignas(concurrent::impl::kDestructiveInterferenceSize)
+    CounterLine final {
+  std::atomic<std::uint64_t> counters[kCountersPerLine]{};
+};
+
+}  // namespace impl::hdr_histogram
+
+using impl::hdr_histogram::CounterLine;
+using impl::hdr_histogram::kCountersPerLine;
+
+namespace {
+
+constexpr std::size_t kMantissaBits = 52;
+constexpr std::size_t kMaxPrecisionBits = 10;
+
+std::uint64_t ToBits(double value) noexcept {
+  std::uint64_t bits{};
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+double FromBits(std::uint64_t bits) noexcept {
+  double value{};
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+// For positive doubles, the bits grow monotonically with the value, and the
+// exponent with the highest mantissa bits form a log-linear bucket number.
+// Subtracting 1 makes the bucket borders fall into the lower bucket, so the
+// bucket `key` contains (FromBits(key << shift), FromBits((key + 1) << shift)].
+std::uint64_t GetKey(double positive_value, std::size_t shift) noexcept {
+  return (ToBits(positive_value) - 1) >> shift;
+}
+
+double GetUpperBound(std::uint64_t key, std::size_t shift) noexcept {
+  return FromBits((key + 1) << shift);
+}
+
+std::size_t GetShardCount() noexcept {
+#ifdef USERVER_IMPL_HAS_RSEQ
+  return std::max(concurrent::impl::GetRseqArraySize(), std::size_t{1});
+#else
+  return 1;
+#endif
+}
+
+std::size_t GetCurrentShard() noexcept {
+#ifdef USERVER_IMPL_HAS_RSEQ
+  const auto cpu_id = rseq_cpu_start();
+  if (concurrent::impl::IsCpuIdValid(cpu_id)) return cpu_id;
+#endif
+  return 0;
+}
+
+}  // namespace
+
+HdrHistogram::HdrHistogram(double lowest_bound, double highest_bound,
+                           std::size_t precision_bits)
+    : shift_(kMantissaBits - precision_bits),
+      lowest_key_(0),
+      lines_per_shard_(0),
+      shard_count_(GetShardCount()) {
+  UINVARIANT(std::isnormal(lowest_bound) && lowest_bound > 0,
+             "HdrHistogram lowest bound must be positive");
+  UINVARIANT(std::isfinite(highest_bound) && lowest_bound <= highest_bound,
+             "HdrHistogram highest bound must not be less than the lowest one");
+  UINVARIANT(precision_bits <= kMaxPrecisionBits,
+             "HdrHistogram precision is too high");
+
+  lowest_key_ = GetKey(lowest_bound, shift_);
+  const auto highest_key = GetKey(highest_bound, shift_);
+  upper_bounds_.reserve(highest_key - lowest_key_ + 1);
+  for (auto key = lowest_key_; key <= highest_key; ++key) {
+    upper_bounds_.push_back(GetUpperBound(key, shift_));
+  }
+
+  // +1 for the "infinity" bucket
+  lines_per_shard_ =
+      (upper_bounds_.size() + 1 + kCountersPerLine - 1) / kCountersPerLine;
+  lines_ = std::make_unique<CounterLine[]>(lines_per_shard_ * shard_count_);
+}
+
+HdrHistogram::HdrHistogram(HdrHistogram&&) noexcept = default;
+
+HdrHistogram& HdrHistogram::operator=(HdrHistogram&&) noexcept = default;
+
+HdrHistogram::~HdrHistogram() = default;
+
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void HdrHistogram::Account(double value, std::uint64_t count) noexcept {
+  std::size_t index = 0;
+  if (value > 0) {
+    const auto key = GetKey(value, shift_);
+    // Also sends +inf and the values above the last bound to "infinity".
+    index = key <= lowest_key_
+                ? 0
+                : std::min<std::uint64_t>(key - lowest_key_,
+                                          upper_bounds_.size());
+  }
+
+  auto* const shard = &lines_[GetCurrentShard() * lines_per_shard_];
+  shard[index / kCountersPerLine]
+      .counters[index % kCountersPerLine]
+      .fetch_add(count, std::memory_order_relaxed);
+}
+
+Histogram HdrHistogram::Collect() const {
+  const auto bucket_count = upper_bounds_.size();
+  const auto buckets =
+      std::make_unique<impl::histogram::Bucket[]>(bucket_count + 1);
+  impl::histogram::CopyBounds(buckets.get(), upper_bounds_);
+
+  for (std::size_t shard = 0; shard < shard_count_; ++shard) {
+    const auto* const lines = &lines_[shard * lines_per_shard_];
+    for (std::size_t index = 0; index <= bucket_count; ++index) {
+      const auto value = lines[index / kCountersPerLine]
+                             .counters[index % kCountersPerLine]
+                             .load(std::memory_order_relaxed);
+      // 0th Bucket is the "infinity" one
+      auto& bucket = buckets[index == bucket_count ? 0 : index + 1];
+      bucket.counter.store(
+          bucket.counter.load(std::memory_order_relaxed) + value,
+          std::memory_order_relaxed);
+    }
+  }
+
+  return Histogram{impl::histogram::MakeView(buckets.get())};
+}
+
+std::size_t HdrHistogram::GetBucketCount() const noexcept {
+  return upper_bounds_.size();
+}
+
+void ResetMetric(HdrHistogram& histogram) noexcept {
+  const auto line_count = histogram.lines_per_shard_ * histogram.shard_count_;
+  for (std::size_t i = 0; i < line_count; ++i) {
+    for (auto& counter : histogram.lines_[i].counters) {
+      counter.store(0, std::memory_order_relaxed);
+    }
+  }
+}
+
+void DumpMetric(Writer& writer, const HdrHistogram& histogram) {
+  const auto collected = histogram.Collect();
+  writer = collected.GetView();
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,115 @@
+#include <userver/utils/statistics/hdr_histogram.hpp>
+
+#include <limits>
+#include <string>
+
+#include <userver/engine/async.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/fmt.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kThreads = 4;
+
+std::string ToString(const utils::statistics::HdrHistogram& histogram) {
+  const auto collected = histogram.Collect();
+  return fmt::to_string(collected.GetView());
+}
+
+}  // namespace
+
+UTEST(StatisticsHdrHistogram, Bounds) {
+  const utils::statistics::HdrHistogram histogram{1, 8, 1};
+  EXPECT_EQ(histogram.GetBucketCount(), 7);
+  EXPECT_EQ(ToString(histogram),
+            "[1]=0,[1.5]=0,[2]=0,[3]=0,[4]=0,[6]=0,[8]=0,[inf]=0");
+}
+
+UTEST(StatisticsHdrHistogram, BoundsRoundedUp) {
+  const utils::statistics::HdrHistogram histogram{1.1, 7, 1};
+  EXPECT_EQ(ToString(histogram),
+            "[1.5]=0,[2]=0,[3]=0,[4]=0,[6]=0,[8]=0,[inf]=0");
+}
+
+UTEST(StatisticsHdrHistogram, Account) {
+  utils::statistics::HdrHistogram histogram{1, 8, 1};
+  histogram.Account(-1);
+  histogram.Account(0);
+  histogram.Account(1);
+  histogram.Account(1.2);
+  histogram.Account(3);
+  histogram.Account(5, 2);
+  histogram.Account(8);
+  histogram.Account(9);
+  histogram.Account(std::numeric_limits<double>::infinity());
+
+  EXPECT_EQ(ToString(histogram),
+            "[1]=3,[1.5]=1,[2]=0,[3]=1,[4]=0,[6]=2,[8]=1,[inf]=2");
+}
+
+UTEST(StatisticsHdrHistogram, RelativeError) {
+  constexpr std::size_t kPrecisionBits = 4;
+  const utils::statistics::HdrHistogram histogram{1e-3, 1e3, kPrecisionBits};
+  const auto histogram_copy = histogram.Collect();
+  const auto view = histogram_copy.GetView();
+
+  ASSERT_GT(view.GetBucketCount(), 1);
+  EXPECT_LE(view.GetUpperBoundAt(0) * (1 - 1.0 / (1 << kPrecisionBits)), 1e-3);
+  EXPECT_GE(view.GetUpperBoundAt(view.GetBucketCount() - 1), 1e3);
+  for (std::size_t i = 1; i < view.GetBucketCount(); ++i) {
+    EXPECT_LE(view.GetUpperBoundAt(i) / view.GetUpperBoundAt(i - 1),
+              1 + 1.0 / (1 << kPrecisionBits));
+  }
+}
+
+UTEST(StatisticsHdrHistogram, Sample) {
+  /// [sample]
+  utils::statistics::Storage storage;
+
+  // Buckets from 1ms to 8ms, 2 buckets per a power of two
+  utils::statistics::HdrHistogram timings_ms{1, 8, 1};
+
+  auto statistics_holder = storage.RegisterWriter(
+      "test", [&](utils::statistics::Writer& writer) { writer = timings_ms; });
+
+  timings_ms.Account(0.5);
+  timings_ms.Account(2.5);
+  timings_ms.Account(100);
+
+  const utils::statistics::Snapshot snapshot{storage};
+  EXPECT_EQ(fmt::to_string(snapshot.SingleMetric("test")),
+            "[1]=1,[1.5]=0,[2]=0,[3]=1,[4]=0,[6]=0,[8]=0,[inf]=1");
+  /// [sample]
+}
+
+UTEST(StatisticsHdrHistogram, Reset) {
+  utils::statistics::HdrHistogram histogram{1, 8, 1};
+  histogram.Account(3, 10);
+  ResetMetric(histogram);
+  const auto collected = histogram.Collect();
+  EXPECT_EQ(collected.GetView().GetTotalCount(), 0);
+}
+
+UTEST_MT(StatisticsHdrHistogram, Concurrent, kThreads) {
+  constexpr std::size_t kIterations = 10000;
+  utils::statistics::HdrHistogram histogram{1, 1024, 3};
+
+  auto tasks = utils::GenerateFixedArray(kThreads, [&](std::size_t) {
+    return engine::AsyncNoSpan([&] {
+      for (std::size_t i = 0; i < kIterations; ++i) {
+        histogram.Account(i % 2048);
+      }
+    });
+  });
+  for (auto& task : tasks) task.Get();
+
+  const auto collected = histogram.Collect();
+  EXPECT_EQ(collected.GetView().GetTotalCount(), kThreads * kIterations);
+}
+
+USERVER_NAMESPACE_END
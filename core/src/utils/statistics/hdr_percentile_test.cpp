@@ -0,0 +1,133 @@
+#include <userver/utils/statistics/hdr_percentile.hpp>
+
+#include <thread>
+#include <vector>
+
+#include <userver/utils/mock_now.hpp>
+#include <userver/utils/statistics/recent_timings.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Percentile = utils::statistics::HdrPercentile<6, 22>;
+
+}  // namespace
+
+static_assert(utils::statistics::kHasWriterSupport<Percentile>);
+static_assert(
+    utils::statistics::kHasWriterSupport<utils::statistics::RecentTimings>);
+static_assert(utils::statistics::kHasWriterSupport<
+              utils::statistics::StripedRecentTimings>);
+static_assert(Percentile::kBuckets == 576);
+
+TEST(HdrPercentile, Zero) {
+  const Percentile p;
+
+  EXPECT_EQ(0U, p.GetPercentile(0));
+  EXPECT_EQ(0U, p.GetPercentile(50));
+  EXPECT_EQ(0U, p.GetPercentile(100));
+}
+
+TEST(HdrPercentile, Exact) {
+  Percentile p;
+
+  for (int i = 0; i < 64; i++) p.Account(i);
+
+  EXPECT_EQ(64U, p.Count());
+  EXPECT_EQ(0U, p.GetPercentile(0));
+  EXPECT_EQ(32U, p.GetPercentile(50));
+  EXPECT_EQ(63U, p.GetPercentile(100));
+  EXPECT_EQ(63U, p.GetPercentile(200));
+}
+
+TEST(HdrPercentile, RelativeError) {
+  for (std::size_t value = 1; value < (std::size_t{1} << 22);
+       value = value * 5 / 4 + 1) {
+    Percentile p;
+    p.Account(value);
+
+    const auto result = p.GetPercentile(50);
+    EXPECT_GE(result, value);
+    EXPECT_LE(result - value, value / 32) << value;
+  }
+}
+
+TEST(HdrPercentile, Overflow) {
+  Percentile p;
+
+  p.Account(std::size_t{1} << 22);
+  p.Account(std::size_t{1} << 40);
+
+  EXPECT_EQ((std::size_t{1} << 22) - 1, p.GetPercentile(0));
+  EXPECT_EQ((std::size_t{1} << 22) - 1, p.GetPercentile(100));
+}
+
+TEST(HdrPercentile, AddAndReset) {
+  Percentile first;
+  Percentile second;
+  for (int i = 0; i < 90; i++) first.Account(1);
+  for (int i = 0; i < 10; i++) second.Account(1000);
+
+  first.Add(second);
+  EXPECT_EQ(100U, first.Count());
+  EXPECT_EQ(1U, first.GetPercentile(50));
+  EXPECT_EQ(1007U, first.GetPercentile(95));
+
+  const Percentile copy = first;
+  EXPECT_EQ(100U, copy.Count());
+
+  first.Reset();
+  EXPECT_EQ(0U, first.Count());
+  EXPECT_EQ(0U, first.GetPercentile(100));
+  EXPECT_EQ(1007U, copy.GetPercentile(100));
+}
+
+TEST(RecentTimings, Lazy) {
+  utils::datetime::MockNowSet({});
+  utils::statistics::RecentTimings timings;
+  EXPECT_EQ(0U, timings.GetStatsForPeriod().Count());
+
+  timings.Account(std::chrono::milliseconds{10});
+  timings.Account(std::chrono::milliseconds{-1});
+  // The current epoch is not reported
+  EXPECT_EQ(0U, timings.GetStatsForPeriod().Count());
+
+  utils::datetime::MockSleep(std::chrono::seconds{5});
+  const auto stats = timings.GetStatsForPeriod();
+  EXPECT_EQ(2U, stats.Count());
+  EXPECT_EQ(0U, stats.GetPercentile(0));
+  EXPECT_EQ(10U, stats.GetPercentile(100));
+
+  ResetMetric(timings);
+  EXPECT_EQ(0U, timings.GetStatsForPeriod().Count());
+}
+
+TEST(StripedRecentTimings, SumsStripes) {
+  utils::datetime::MockNowSet({});
+  utils::statistics::StripedRecentTimings timings;
+  EXPECT_EQ(0U, timings.GetStatsForPeriod().Count());
+
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < 4; ++i) {
+    threads.emplace_back([&timings, i] {
+      for (std::size_t j = 0; j < 100; ++j) {
+        timings.Account(std::chrono::milliseconds{i * 100 + j});
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  utils::datetime::MockSleep(std::chrono::seconds{5});
+  const auto stats = timings.GetStatsForPeriod();
+  EXPECT_EQ(400U, stats.Count());
+  EXPECT_EQ(0U, stats.GetPercentile(0));
+  EXPECT_EQ(399U, stats.GetPercentile(100));
+
+  ResetMetric(timings);
+  EXPECT_EQ(0U, timings.GetStatsForPeriod().Count());
+}
+
+USERVER_NAMESPACE_END
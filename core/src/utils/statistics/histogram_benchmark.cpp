@@ -1,3 +1,4 @@
+#include <userver/utils/statistics/hdr_histogram.hpp>
 #include <userver/utils/statistics/histogram.hpp>
 
 #include <benchmark/benchmark.h>
@@ -35,4 +36,51 @@ void HistogramAccount(benchmark::State& state) {
 // poorly (fixed).
 BENCHMARK(HistogramAccount)->DenseRange(10, 50, 10);
 
+void HdrHistogramAccount(benchmark::State& state) {
+  const auto precision_bits = static_cast<std::size_t>(state.range(0));
+  auto values_raw = std::vector<double>(1024);
+  for (auto& value : values_raw) {
+    value = utils::RandRange(0.0, 5000.0);
+  }
+  const auto values = Launder(std::move(values_raw));
+
+  utils::statistics::HdrHistogram histogram{1, 4096, precision_bits};
+
+  while (state.KeepRunningBatch(values.size())) {
+    for (const auto value : values) {
+      histogram.Account(value);
+    }
+  }
+}
+BENCHMARK(HdrHistogramAccount)->DenseRange(0, 4);
+
+namespace {
+
+// 48 buckets for both
+utils::statistics::Histogram gContendedHistogram{[] {
+  std::vector<double> bounds;
+  for (double bound = 1; bounds.size() < 48; bound *= 1.189) {
+    bounds.push_back(bound);
+  }
+  return bounds;
+}()};
+utils::statistics::HdrHistogram gContendedHdrHistogram{1, 4096, 2};
+
+}  // namespace
+
+template <typename HistogramType>
+void HistogramAccountContended(benchmark::State& state,
+                               HistogramType& histogram) {
+  double value = state.thread_index();
+  for ([[maybe_unused]] auto _ : state) {
+    histogram.Account(value);
+    value = value < 4000 ? value * 1.1 + 1 : 0;
+  }
+}
+BENCHMARK_CAPTURE(HistogramAccountContended, Histogram, gContendedHistogram)
+    ->ThreadRange(1, 16);
+BENCHMARK_CAPTURE(HistogramAccountContended, HdrHistogram,
+                  gContendedHdrHistogram)
+    ->ThreadRange(1, 16);
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,96 @@
+#include <userver/utils/statistics/metrics_delta.hpp>
+
+#include <functional>
+#include <string_view>
+
+#include <boost/container_hash/hash.hpp>
+
+#include <userver/utils/overloaded.hpp>
+#include <utils/statistics/delta_format_builder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace {
+
+std::uint64_t HashMetricId(std::string_view path, LabelsSpan labels) {
+  std::size_t hash = std::hash<std::string_view>{}(path);
+  for (const auto& label : labels) {
+    boost::hash_combine(hash, std::hash<std::string_view>{}(label.Name()));
+    boost::hash_combine(hash, std::hash<std::string_view>{}(label.Value()));
+  }
+  return hash;
+}
+
+std::uint64_t HashMetricValue(const MetricValue& value) {
+  std::size_t hash = 0;
+  value.Visit(utils::Overloaded{
+      [&hash](std::int64_t x) { boost::hash_combine(hash, x); },
+      [&hash](double x) { boost::hash_combine(hash, x); },
+      [&hash](Rate x) { boost::hash_combine(hash, x.value); },
+      [&hash](HistogramView x) {
+        const auto bucket_count = x.GetBucketCount();
+        boost::hash_combine(hash, bucket_count);
+        for (std::size_t i = 0; i < bucket_count; ++i) {
+          boost::hash_combine(hash, x.GetUpperBoundAt(i));
+          boost::hash_combine(hash, x.GetValueAt(i));
+        }
+        boost::hash_combine(hash, x.GetValueAtInf());
+      },
+  });
+  return hash;
+}
+
+}  // namespace
+
+MetricsDelta::MetricsDelta() = default;
+
+MetricsDelta::~MetricsDelta() = default;
+
+void MetricsDelta::Reset() {
+  const std::lock_guard lock{mutex_};
+  metrics_.clear();
+}
+
+namespace impl {
+
+DeltaFormatBuilder::DeltaFormatBuilder(BaseFormatBuilder& out,
+                                       MetricsDelta& delta)
+    : out_(out), delta_(delta), lock_(delta.mutex_) {
+  ++delta_.generation_;
+}
+
+DeltaFormatBuilder::~DeltaFormatBuilder() {
+  auto& metrics = delta_.metrics_;
+  for (auto it = metrics.begin(); it != metrics.end();) {
+    if (it->second.generation != delta_.generation_) {
+      it = metrics.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void DeltaFormatBuilder::HandleMetric(std::string_view path, LabelsSpan labels,
+                                      const MetricValue& value) {
+  const auto id_hash = HashMetricId(path, labels);
+  const auto value_hash = HashMetricValue(value);
+  auto& metrics = delta_.metrics_;
+
+  const auto it = metrics.find(id_hash);
+  if (it != metrics.end() && it->second.value_hash == value_hash) {
+    it->second.generation = delta_.generation_;
+    return;
+  }
+
+  out_.HandleMetric(path, labels, value);
+  metrics.insert_or_assign(
+      id_hash, MetricsDelta::MetricState{value_hash, delta_.generation_});
+}
+
+}  // namespace impl
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,88 @@
+#include <userver/utils/statistics/metrics_delta.hpp>
+
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class PathsCollector final : public utils::statistics::BaseFormatBuilder {
+ public:
+  void HandleMetric(std::string_view path, utils::statistics::LabelsSpan,
+                    const utils::statistics::MetricValue&) override {
+    paths.emplace_back(path);
+  }
+
+  std::vector<std::string> paths;
+};
+
+std::vector<std::string> GetPaths(
+    const utils::statistics::Storage& storage,
+    const utils::statistics::Request& request) {
+  PathsCollector collector;
+  storage.VisitMetrics(collector, request);
+  return std::move(collector.paths);
+}
+
+}  // namespace
+
+UTEST(MetricsDelta, OnlyChanged) {
+  utils::statistics::Storage storage;
+  std::int64_t changing = 1;
+  auto holder = storage.RegisterWriter(
+      "test", [&](utils::statistics::Writer& writer) {
+        writer["changing"] = changing;
+        writer["constant"] = 42;
+        writer["labeled"].ValueWithLabels(1, {"label", "a"});
+        writer["labeled"].ValueWithLabels(2, {"label", "b"});
+      });
+
+  utils::statistics::MetricsDelta delta;
+  const auto request = utils::statistics::Request{}.WithDelta(delta);
+
+  EXPECT_THAT(GetPaths(storage, request),
+              testing::ElementsAre("test.changing", "test.constant",
+                                   "test.labeled", "test.labeled"));
+  EXPECT_THAT(GetPaths(storage, request), testing::IsEmpty());
+
+  changing = 2;
+  EXPECT_THAT(GetPaths(storage, request),
+              testing::ElementsAre("test.changing"));
+
+  // Requests without the delta are not affected
+  EXPECT_EQ(GetPaths(storage, utils::statistics::Request{}).size(), 4);
+
+  delta.Reset();
+  EXPECT_EQ(GetPaths(storage, request).size(), 4);
+}
+
+UTEST(MetricsDelta, ReappearedMetric) {
+  utils::statistics::Storage storage;
+  bool write_optional = true;
+  auto holder = storage.RegisterWriter(
+      "test", [&](utils::statistics::Writer& writer) {
+        writer["constant"] = 1;
+        if (write_optional) writer["optional"] = 1;
+      });
+
+  utils::statistics::MetricsDelta delta;
+  const auto request = utils::statistics::Request{}.WithDelta(delta);
+
+  EXPECT_EQ(GetPaths(storage, request).size(), 2);
+
+  write_optional = false;
+  EXPECT_THAT(GetPaths(storage, request), testing::IsEmpty());
+
+  // The metric has been forgotten and is returned again
+  write_optional = true;
+  EXPECT_THAT(GetPaths(storage, request),
+              testing::ElementsAre("test.optional"));
+}
+
+USERVER_NAMESPACE_END
@@ -128,8 +128,8 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
       if (sep) {
         buf_.push_back(',');
       }
-      fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("{}=\""),
-                     impl::ToPrometheusLabel(label.Name()));
+      buf_.append(GetPrometheusLabel(label.Name()));
+      buf_.append(std::string_view{"=\""});
       const auto& value = label.Value();
       std::replace_copy(value.cbegin(), value.cend(), std::back_inserter(buf_),
                         '"', '\'');
@@ -138,6 +138,15 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
     }
   }
 
+  // There are few distinct label names, but many metrics with labels
+  const std::string& GetPrometheusLabel(std::string_view name) {
+    if (const auto* const converted =
+            utils::impl::FindTransparentOrNullptr(labels_, name)) {
+      return *converted;
+    }
+    return labels_.emplace(name, impl::ToPrometheusLabel(name)).first->second;
+  }
+
   void DumpLabels(utils::statistics::LabelsSpan labels) {
     buf_.push_back('{');
     DumpLabelsRaw(labels);
@@ -146,6 +155,7 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
 
   fmt::memory_buffer buf_;
   utils::impl::TransparentMap<std::string, std::string> metrics_;
+  utils::impl::TransparentMap<std::string, std::string> labels_;
 };
 
 }  // namespace
@@ -0,0 +1,88 @@
+#include <userver/utils/statistics/recent_timings.hpp>
+
+#include <memory>
+
+#include <concurrent/impl/rseq.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+RecentTimings::~RecentTimings() {
+  delete timings_.load(std::memory_order_acquire);
+}
+
+void RecentTimings::Account(std::chrono::milliseconds timing) noexcept {
+  GetOrCreateTimings().GetCurrentCounter().Account(
+      timing.count() > 0 ? static_cast<std::size_t>(timing.count()) : 0);
+}
+
+RecentTimings::Percentile RecentTimings::GetStatsForPeriod() const {
+  const auto* timings = timings_.load(std::memory_order_acquire);
+  if (!timings) return {};
+  return timings->GetStatsForPeriod();
+}
+
+RecentTimings::Timings& RecentTimings::GetOrCreateTimings() noexcept {
+  auto* timings = timings_.load(std::memory_order_acquire);
+  if (timings) return *timings;
+
+  auto new_timings = std::make_unique<Timings>();
+  if (timings_.compare_exchange_strong(timings, new_timings.get(),
+                                       std::memory_order_acq_rel)) {
+    return *new_timings.release();
+  }
+  // Lost the race, 'timings' is updated by compare_exchange_strong
+  return *timings;
+}
+
+void ResetMetric(RecentTimings& timings) noexcept {
+  auto* recent_period = timings.timings_.load(std::memory_order_acquire);
+  if (recent_period) recent_period->Reset();
+}
+
+void DumpMetric(Writer& writer, const RecentTimings& timings) {
+  writer = timings.GetStatsForPeriod();
+}
+
+namespace {
+
+std::size_t GetCurrentStripe() noexcept {
+#ifdef USERVER_IMPL_HAS_RSEQ
+  const auto cpu_id = rseq_cpu_start();
+  if (concurrent::impl::IsCpuIdValid(cpu_id)) {
+    return cpu_id % StripedRecentTimings::kMaxStripes;
+  }
+#endif
+  return 0;
+}
+
+}  // namespace
+
+StripedRecentTimings::~StripedRecentTimings() = default;
+
+void StripedRecentTimings::Account(std::chrono::milliseconds timing) noexcept {
+  stripes_[GetCurrentStripe()].Account(timing);
+}
+
+StripedRecentTimings::Percentile StripedRecentTimings::GetStatsForPeriod()
+    const {
+  Percentile result;
+  for (const auto& stripe : stripes_) {
+    result.Add(stripe.GetStatsForPeriod());
+  }
+  return result;
+}
+
+void ResetMetric(StripedRecentTimings& timings) noexcept {
+  for (auto& stripe : timings.stripes_) ResetMetric(stripe);
+}
+
+void DumpMetric(Writer& writer, const StripedRecentTimings& timings) {
+  writer = timings.GetStatsForPeriod();
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -9,6 +9,7 @@
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/text_light.hpp>
+#include <utils/statistics/delta_format_builder.hpp>
 #include <utils/statistics/value_builder_helpers.hpp>
 
 #include <utils/statistics/entry_impl.hpp>
@@ -86,12 +87,18 @@ Request Request::MakeWithPath(const std::string& path, AddLabels add_labels,
           std::move(add_labels)};
 }
 
+Request Request::WithDelta(MetricsDelta& delta) const {
+  return {prefix, prefix_match_type, require_labels, add_labels, &delta};
+}
+
 Request::Request(std::string prefix_in, PrefixMatch path_match_type_in,
-                 std::vector<Label> require_labels_in, AddLabels add_labels_in)
+                 std::vector<Label> require_labels_in, AddLabels add_labels_in,
+                 MetricsDelta* delta_in)
     : prefix(std::move(prefix_in)),
       prefix_match_type(path_match_type_in),
       require_labels(std::move(require_labels_in)),
-      add_labels(std::move(add_labels_in)) {}
+      add_labels(std::move(add_labels_in)),
+      delta(delta_in) {}
 
 BaseFormatBuilder::~BaseFormatBuilder() = default;
 
@@ -118,6 +125,17 @@ formats::json::Value Storage::GetAsJson() const {
 
 void Storage::VisitMetrics(BaseFormatBuilder& out,
                            const Request& request) const {
+  if (request.delta) {
+    impl::DeltaFormatBuilder delta_out{out, *request.delta};
+    DoVisitMetrics(delta_out, request);
+  } else {
+    DoVisitMetrics(out, request);
+  }
+}
+
+void Storage::DoVisitMetrics(BaseFormatBuilder& out,
+                             const Request& request) const {
+  bool has_extenders = false;
   {
     impl::WriterState state{out, request, {}, {}};
     for (const auto& [name, value] : request.add_labels) {
@@ -127,6 +145,7 @@ void Storage::VisitMetrics(BaseFormatBuilder& out,
     boost::container::small_vector<LabelView, 16> labels_vector;
 
     std::shared_lock lock(mutex_);
+    has_extenders = extenders_count_ != 0;
     for (const auto& entry : metrics_sources_) {
       if (!entry.writer) {
         continue;
@@ -157,7 +176,9 @@ void Storage::VisitMetrics(BaseFormatBuilder& out,
     }
   }
 
-  statistics::VisitMetrics(out, GetAsJson(), request);
+  if (has_extenders) {
+    statistics::VisitMetrics(out, GetAsJson(), request);
+  }
 }
 
 void Storage::StopRegisteringExtenders() { may_register_extenders_ = false; }
@@ -180,6 +201,7 @@ Entry Storage::DoRegisterExtender(impl::MetricsSource&& source) {
               "constructors");
 
   std::lock_guard lock(mutex_);
+  if (source.extender) ++extenders_count_;
   const auto res =
       metrics_sources_.insert(metrics_sources_.end(), std::move(source));
   return Entry(Entry::Impl{this, res});
@@ -195,6 +217,7 @@ void Storage::UnregisterExtender(
       CheckDataUsedByCallbackHasNotBeenDestroyedBeforeUnregistering(*iterator);
     }
   }
+  if (iterator->extender) --extenders_count_;
   metrics_sources_.erase(iterator);
 }
 
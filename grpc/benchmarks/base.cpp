@@ -96,6 +96,27 @@ void UnaryRPCPayloadRepeated(sample::ugrpc::UnitTestServiceClient& client) {
   }
 }
 
+void RunBatchOfUnaryRPC(benchmark::State& state,
+                        GrpcClientTest& client_factory) {
+  static constexpr std::size_t kBatchSize = 16;
+  auto clients = utils::GenerateFixedArray(kBatchSize, [&client_factory](auto) {
+    return client_factory.MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  });
+
+  for (auto _ : state) {
+    auto tasks = utils::GenerateFixedArray(kBatchSize, [&clients](auto i) {
+      return engine::AsyncNoSpan(UnaryRPCPayloadRepeated,
+                                 std::ref(clients[i]));
+    });
+    engine::GetAll(tasks);
+  }
+
+  state.counters["rps"] = benchmark::Counter(
+      static_cast<std::size_t>(state.iterations()) * kBatchSize *
+          kUnaryRPCPayloadRepeatedRepetitions,
+      benchmark::Counter::kIsRate);
+}
+
 void NewClientRepeated(GrpcClientTest& client_factory) {
   static constexpr std::size_t kRepetitions = 256;
   for (std::size_t i = 0; i < kRepetitions; ++i) {
@@ -140,31 +161,31 @@ void BatchOfUnaryRPC(benchmark::State& state) {
       engine::TaskProcessorPoolsConfig{10000, 100000, 256 * 1024ULL, 1, "ev",
                                        false},
       [&] {
-        static constexpr std::size_t kBatchSize = 16;
         GrpcClientTest client_factory;
-        auto clients =
-            utils::GenerateFixedArray(kBatchSize, [&client_factory](auto) {
-              return client_factory
-                  .MakeClient<sample::ugrpc::UnitTestServiceClient>();
-            });
+        RunBatchOfUnaryRPC(state, client_factory);
+      });
+}
 
-        for (auto _ : state) {
-          auto tasks =
-              utils::GenerateFixedArray(kBatchSize, [&clients](auto i) {
-                return engine::AsyncNoSpan(UnaryRPCPayloadRepeated,
-                                           std::ref(clients[i]));
-              });
-          engine::GetAll(tasks);
-        }
+BENCHMARK(BatchOfUnaryRPC)->DenseRange(1, 8)->Unit(benchmark::kMillisecond);
 
-        state.counters["rps"] = benchmark::Counter(
-            static_cast<std::size_t>(state.iterations()) * kBatchSize *
-                kUnaryRPCPayloadRepeatedRepetitions,
-            benchmark::Counter::kIsRate);
+// Compares the number of completion queues (and the threads polling them) on
+// a fixed number of task processor threads
+void BatchOfUnaryRPCCompletionQueues(benchmark::State& state) {
+  engine::RunStandalone(
+      state.range(0),
+      engine::TaskProcessorPoolsConfig{10000, 100000, 256 * 1024ULL, 1, "ev",
+                                       false},
+      [&] {
+        server::ServerConfig server_config;
+        server_config.completion_queue_num = static_cast<int>(state.range(1));
+        GrpcClientTest client_factory{std::move(server_config)};
+        RunBatchOfUnaryRPC(state, client_factory);
       });
 }
 
-BENCHMARK(BatchOfUnaryRPC)->DenseRange(1, 8)->Unit(benchmark::kMillisecond);
+BENCHMARK(BatchOfUnaryRPCCompletionQueues)
+    ->ArgsProduct({{2, 4, 8}, {1, 2, 4}})
+    ->Unit(benchmark::kMillisecond);
 
 void BatchOfUnaryRPCNewClient(benchmark::State& state) {
   engine::RunStandalone(
@@ -0,0 +1,37 @@
+#include <userver/ugrpc/impl/statistics.hpp>
+
+#include <chrono>
+
+#include <userver/utils/statistics/striped_rate_counter.hpp>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+utils::statistics::StripedRateCounter global_started;
+ugrpc::impl::MethodStatistics method_statistics{
+    ugrpc::impl::StatisticsDomain::kServer, global_started};
+
+}  // namespace
+
+// The statistics accounting of a single successful RPC, with all the threads
+// hammering on the same method
+void MethodStatisticsAccountRpc(benchmark::State& state) {
+  std::size_t i = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    method_statistics.AccountStarted();
+    method_statistics.AccountDeadlinePropagated();
+    method_statistics.AccountTiming(std::chrono::milliseconds{++i % 128});
+    method_statistics.AccountStatus(grpc::StatusCode::OK);
+  }
+
+  if (method_statistics.GetStarted() == 0) {
+    state.SkipWithError("Shouldn't happen");
+  }
+}
+
+BENCHMARK(MethodStatisticsAccountRpc)->ThreadRange(1, 32);
+
+USERVER_NAMESPACE_END
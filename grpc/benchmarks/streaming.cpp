@@ -0,0 +1,77 @@
+#include <chrono>
+#include <cstddef>
+
+#include <userver/engine/run_standalone.hpp>
+#include <userver/ugrpc/tests/service.hpp>
+#include <userver/ugrpc/write_batching.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc {
+
+namespace {
+
+constexpr int kMessagesPerStream = 1024;
+
+class StreamingService final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  explicit StreamingService(WriteBatchingConfig write_batching)
+      : write_batching_(write_batching) {}
+
+  void ReadMany(ReadManyCall& call,
+                sample::ugrpc::StreamGreetingRequest&& request) override {
+    call.SetWriteBatching(write_batching_);
+    sample::ugrpc::StreamGreetingResponse response;
+    response.set_name("tick");
+    for (int i = 0; i < request.number(); ++i) {
+      response.set_number(i);
+      call.Write(response);
+    }
+    call.Finish();
+  }
+
+ private:
+  const WriteBatchingConfig write_batching_;
+};
+
+}  // namespace
+
+// A stream of small messages, sent in the batches of state.range(0) messages
+void ServerStreamWriteBatching(benchmark::State& state) {
+  engine::RunStandalone(2, [&] {
+    const WriteBatchingConfig write_batching{
+        static_cast<std::size_t>(state.range(0)), std::chrono::milliseconds{1}};
+    tests::Service<StreamingService> service{std::in_place, write_batching};
+    auto client = service.MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+    sample::ugrpc::StreamGreetingRequest request;
+    request.set_number(kMessagesPerStream);
+
+    for ([[maybe_unused]] auto _ : state) {
+      auto stream = client.ReadMany(request);
+      sample::ugrpc::StreamGreetingResponse response;
+      int count = 0;
+      while (stream.Read(response)) ++count;
+      UINVARIANT(count == kMessagesPerStream, "Behavior broken");
+    }
+
+    state.counters["messages"] = benchmark::Counter(
+        static_cast<double>(state.iterations()) * kMessagesPerStream,
+        benchmark::Counter::kIsRate);
+  });
+}
+
+BENCHMARK(ServerStreamWriteBatching)
+    ->RangeMultiplier(4)
+    ->Range(1, 64)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace ugrpc
+
+USERVER_NAMESPACE_END
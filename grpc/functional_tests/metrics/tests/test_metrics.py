@@ -30,7 +30,7 @@ def _hide_metrics_values(metrics: typing.List[str]) -> typing.List[str]:
 
 def _rewrite_endpoint_label(metrics: typing.List[str]) -> typing.List[str]:
     return [
-        re.sub(r'endpoint=.*?,', 'endpoint=my_endpoint,', line, count=1)
+        re.sub(r'endpoint=[^,\t]*', 'endpoint=my_endpoint', line, count=1)
         for line in metrics
     ]
 
@@ -3,6 +3,7 @@
 /// @file userver/ugrpc/client/client_factory.hpp
 /// @brief @copybrief ugrpc::client::ClientFactory
 
+#include <atomic>
 #include <cstddef>
 
 #include <grpcpp/completion_queue.h>
@@ -14,12 +15,14 @@
 #include <userver/logging/level.hpp>
 #include <userver/storages/secdist/secdist.hpp>
 #include <userver/testsuite/grpc_control.hpp>
+#include <userver/utils/statistics/entry.hpp>
 #include <userver/utils/statistics/fwd.hpp>
 #include <userver/yaml_config/fwd.hpp>
 
 #include <userver/ugrpc/client/impl/channel_cache.hpp>
 #include <userver/ugrpc/client/impl/client_data.hpp>
 #include <userver/ugrpc/client/middlewares/base.hpp>
+#include <userver/ugrpc/impl/completion_queues.hpp>
 #include <userver/ugrpc/impl/statistics_storage.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -48,6 +51,11 @@ struct ClientFactorySettings final {
   /// Number of underlying channels that will be created for every client
   /// in this factory.
   std::size_t channel_count{1};
+
+  /// If not 0, calls are sent to the first channel with less calls in flight,
+  /// so that the rest of the `channel_count` channels are only connected under
+  /// load. By default each call goes to the least loaded channel.
+  std::size_t channel_max_concurrent_streams{0};
 };
 
 /// @ingroup userver_clients
@@ -64,6 +72,15 @@ class ClientFactory final {
                 testsuite::GrpcControl& testsuite_grpc,
                 dynamic_config::Source source);
 
+  /// @brief Spreads the created clients between the `queues` round-robin
+  ClientFactory(ClientFactorySettings&& settings,
+                engine::TaskProcessor& channel_task_processor,
+                MiddlewareFactories mws,
+                const ugrpc::impl::CompletionQueues& queues,
+                utils::statistics::Storage& statistics_storage,
+                testsuite::GrpcControl& testsuite_grpc,
+                dynamic_config::Source source);
+
   template <typename Client>
   Client MakeClient(const std::string& client_name,
                     const std::string& endpoint);
@@ -72,15 +89,19 @@ class ClientFactory final {
   impl::ChannelCache::Token GetChannel(const std::string& client_name,
                                        const std::string& endpoint);
 
+  grpc::CompletionQueue& GetNextQueue() noexcept;
+
   engine::TaskProcessor& channel_task_processor_;
   MiddlewareFactories mws_;
-  grpc::CompletionQueue& queue_;
+  const ugrpc::impl::CompletionQueues queues_;
+  std::atomic<std::size_t> next_queue_{0};
   impl::ChannelCache channel_cache_;
   std::unordered_map<std::string, std::unique_ptr<impl::ChannelCache>>
       client_channel_cache_;
   ugrpc::impl::StatisticsStorage client_statistics_storage_;
   const dynamic_config::Source config_source_;
   testsuite::GrpcControl& testsuite_grpc_;
+  utils::statistics::Entry channel_statistics_holder_;
 };
 
 template <typename Client>
@@ -90,7 +111,7 @@ Client ClientFactory::MakeClient(const std::string& client_name,
       client_name,
       endpoint,
       impl::InstantiateMiddlewares(mws_, client_name),
-      queue_,
+      GetNextQueue(),
       client_statistics_storage_,
       GetChannel(client_name, endpoint),
       config_source_,
@@ -4,6 +4,7 @@
 /// @brief @copybrief ugrpc::client::ClientFactoryComponent
 
 #include <userver/components/component_base.hpp>
+#include <userver/utils/statistics/entry.hpp>
 
 #include <userver/ugrpc/client/client_factory.hpp>
 #include <userver/ugrpc/client/queue_holder.hpp>
@@ -47,6 +48,9 @@ namespace ugrpc::client {
 /// auth-type | authentication method, see above | -
 /// default-service-config | default service config, see above | -
 /// channel-count | Number of underlying grpc::Channel objects | 1
+/// channel-max-concurrent-streams | calls in flight on a channel before the next channel is used, 0 to send each call to the least loaded channel | 0
+/// completion-queue-count | count of completion queues to create if there is no grpc-server component, 0 to pick a half of the available CPUs | 1
+/// pin-completion-queues | pin the threads polling the completion queues to disjoint groups of the available CPUs | false
 /// middlewares | middlewares names to use | []
 ///
 ///
@@ -69,6 +73,7 @@ class ClientFactoryComponent final : public components::ComponentBase {
 
  private:
   std::optional<QueueHolder> queue_;
+  utils::statistics::Entry queue_statistics_holder_;
   std::optional<ClientFactory> factory_;
 };
 
@@ -74,6 +74,17 @@ class GenericClient final {
           std::make_unique<grpc::ClientContext>(),
       const GenericOptions& options = {}) const;
 
+  /// @brief Initiate a `request stream -> response stream` RPC with the given
+  /// name.
+  ///
+  /// The call works with the methods of all four kinds: for the server a
+  /// unary call is a stream with exactly one message in each direction.
+  client::BidirectionalStream<grpc::ByteBuffer, grpc::ByteBuffer>
+  BidirectionalStream(std::string_view call_name,
+                      std::unique_ptr<grpc::ClientContext> context =
+                          std::make_unique<grpc::ClientContext>(),
+                      const GenericOptions& options = {}) const;
+
   /// @cond
   // For internal use only.
   explicit GenericClient(impl::ClientParams&&);
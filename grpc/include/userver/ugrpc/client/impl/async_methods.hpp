@@ -1,10 +1,12 @@
 #pragma once
 
 #include <atomic>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include <grpcpp/client_context.h>
 #include <grpcpp/completion_queue.h>
@@ -95,6 +97,14 @@ class RpcData final {
 
   void SetDeadlinePropagated() noexcept;
 
+  using FinishHook = std::function<void(grpc::StatusCode)>;
+
+  // The hooks are called once the RPC is finished with a status, the RPCs
+  // interrupted by network errors or cancelled do not get one
+  void AddFinishHook(FinishHook hook);
+
+  void RunFinishHooks(grpc::StatusCode code) noexcept;
+
   // please read comments for 'invocation_' private member on why
   // we use two different invocation types
   void EmplaceAsyncMethodInvocation();
@@ -146,6 +156,7 @@ class RpcData final {
   grpc::CompletionQueue& queue_;
   RpcConfigValues config_values_;
   const Middlewares& mws_;
+  ChannelInFlightGuard in_flight_;
 
   // This data is common for all types of grpc calls - unary and streaming
   // However, in unary call the call is finished as soon as grpc core
@@ -159,6 +170,7 @@ class RpcData final {
                FinishAsyncMethodInvocation>
       invocation_;
   grpc::Status status_;
+  std::vector<FinishHook> finish_hooks_;
 };
 
 class FutureImpl final {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -12,16 +13,37 @@
 
 #include <userver/concurrent/variable.hpp>
 #include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::client::impl {
 
+// Counts a call as in flight on one of the channels until destroyed
+class ChannelInFlightGuard final {
+ public:
+  ChannelInFlightGuard() noexcept = default;
+  explicit ChannelInFlightGuard(std::atomic<std::uint64_t>& in_flight) noexcept;
+
+  ChannelInFlightGuard(ChannelInFlightGuard&&) noexcept;
+  ChannelInFlightGuard& operator=(ChannelInFlightGuard&&) noexcept;
+  ~ChannelInFlightGuard();
+
+ private:
+  std::atomic<std::uint64_t>* in_flight_{nullptr};
+};
+
 class ChannelCache final {
  public:
+  // With `max_concurrent_streams == 0` each call goes to the least loaded
+  // channel. Otherwise a call goes to the first channel with less than
+  // `max_concurrent_streams` calls in flight, so that the rest of the channels
+  // are only connected once the load requires them.
   ChannelCache(std::shared_ptr<grpc::ChannelCredentials>&& credentials,
                const grpc::ChannelArguments& channel_args,
-               std::size_t channel_count);
+               std::size_t channel_count,
+               std::size_t max_concurrent_streams = 0);
 
   ~ChannelCache();
 
@@ -31,6 +53,9 @@ class ChannelCache final {
   // alive.
   Token Get(const std::string& endpoint);
 
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const ChannelCache& cache);
+
  private:
   struct CountedChannel final {
     CountedChannel(const std::string& endpoint,
@@ -39,6 +64,10 @@ class ChannelCache final {
                    std::size_t count);
 
     utils::FixedArray<std::shared_ptr<grpc::Channel>> channels;
+    utils::FixedArray<std::atomic<std::uint64_t>> in_flight;
+    // calls started while every channel had `max_concurrent_streams` calls in
+    // flight, such calls are likely to wait for a stream inside grpc-core
+    utils::statistics::RateCounter saturated_calls;
     std::uint64_t counter{0};
   };
 
@@ -47,6 +76,7 @@ class ChannelCache final {
   const std::shared_ptr<grpc::ChannelCredentials> credentials_;
   const grpc::ChannelArguments channel_args_;
   const std::size_t channel_count_;
+  const std::size_t max_concurrent_streams_;
   concurrent::Variable<Map> channels_;
 };
 
@@ -67,6 +97,15 @@ class ChannelCache::Token final {
   const std::shared_ptr<grpc::Channel>& GetChannel(std::size_t index) const
       noexcept;
 
+  struct ChannelPick final {
+    std::size_t index;
+    ChannelInFlightGuard in_flight;
+  };
+
+  // Picks a channel for a new call, see ChannelCache constructor for the
+  // policy. The call is counted as in flight until `in_flight` is destroyed.
+  ChannelPick PickChannel() const noexcept;
+
  private:
   ChannelCache* cache_{nullptr};
   const std::string* endpoint_{nullptr};
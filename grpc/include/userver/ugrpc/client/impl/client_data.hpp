@@ -15,7 +15,6 @@
 #include <userver/ugrpc/impl/static_metadata.hpp>
 #include <userver/ugrpc/impl/statistics.hpp>
 #include <userver/utils/fixed_array.hpp>
-#include <userver/utils/rand.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -66,10 +65,13 @@ class ClientData final {
   ClientData(const ClientData&) = delete;
   ClientData& operator=(const ClientData&) = delete;
 
+  /// Picks the stub of the least loaded channel, the call is counted as in
+  /// flight on the channel while `in_flight` is alive
   template <typename Service>
-  Stub<Service>& NextStub() const {
-    return *static_cast<Stub<Service>*>(
-        stubs_[utils::RandRange(stubs_.size())].get());
+  Stub<Service>& NextStub(ChannelInFlightGuard& in_flight) const {
+    auto pick = params_.channel_token.PickChannel();
+    in_flight = std::move(pick.in_flight);
+    return *static_cast<Stub<Service>*>(stubs_[pick.index].get());
   }
 
   grpc::CompletionQueue& GetQueue() const { return params_.queue; }
@@ -0,0 +1,65 @@
+#pragma once
+
+/// @file userver/ugrpc/client/middlewares/adaptive_throttling/component.hpp
+/// @brief @copybrief ugrpc::client::middlewares::adaptive_throttling::Component
+
+#include <memory>
+
+#include <userver/ugrpc/client/middlewares/base.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// Client-side adaptive throttling middleware
+namespace ugrpc::client::middlewares::adaptive_throttling {
+
+class MiddlewareFactory;
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief Component for gRPC client-side adaptive throttling, the calls are
+/// rejected locally while the server is overloaded, see
+/// congestion_control::ClientThrottler.
+///
+/// A call is accepted by the server unless it failed with a network error or
+/// with UNAVAILABLE, RESOURCE_EXHAUSTED or DEADLINE_EXCEEDED status. The calls
+/// rejected locally fail with ugrpc::client::UnavailableError.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// accepts-multiplier | calls are rejected locally once they exceed the accepted ones that many times | 2.0
+/// window | time the calls and the accepts are counted over | 60s
+
+// clang-format on
+
+class Component final : public MiddlewareComponentBase {
+ public:
+  /// @ingroup userver_component_names
+  /// @brief The default name of
+  /// ugrpc::client::middlewares::adaptive_throttling::Component
+  static constexpr std::string_view kName = "grpc-client-adaptive-throttling";
+
+  Component(const components::ComponentConfig& config,
+            const components::ComponentContext& context);
+
+  ~Component() override;
+
+  std::shared_ptr<const MiddlewareFactoryBase> GetMiddlewareFactory() override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  std::shared_ptr<MiddlewareFactory> factory_;
+  utils::statistics::Entry statistics_holder_;
+};
+
+}  // namespace ugrpc::client::middlewares::adaptive_throttling
+
+template <>
+inline constexpr bool components::kHasValidate<
+    ugrpc::client::middlewares::adaptive_throttling::Component> = true;
+
+USERVER_NAMESPACE_END
@@ -3,28 +3,47 @@
 /// @file userver/ugrpc/client/queue_holder.hpp
 /// @brief @copybrief ugrpc::client::QueueHolder
 
+#include <cstddef>
+
 #include <grpcpp/completion_queue.h>
 
+#include <userver/ugrpc/impl/completion_queues.hpp>
 #include <userver/utils/fast_pimpl.hpp>
+#include <userver/utils/statistics/fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::client {
 
-/// @brief Manages a gRPC completion queue, usable only in clients
+/// @brief Manages gRPC completion queues, usable only in clients
 class QueueHolder final {
  public:
   QueueHolder();
 
+  /// @param num count of completion queues, 0 picks a half of the available
+  /// CPUs
+  /// @param pin_threads pin the threads polling the queues to disjoint groups
+  /// of the available CPUs
+  QueueHolder(std::size_t num, bool pin_threads);
+
   QueueHolder(QueueHolder&&) = delete;
   QueueHolder& operator=(QueueHolder&&) = delete;
   ~QueueHolder();
 
   grpc::CompletionQueue& GetQueue();
 
+  /// @cond
+  // For internal use only
+  const ugrpc::impl::CompletionQueues& GetQueues() const;
+
+  // Writes per-queue statistics labeled with `grpc_queue`
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const QueueHolder& holder);
+  /// @endcond
+
  private:
   struct Impl;
-  utils::FastPimpl<Impl, 176, 16> impl_;
+  utils::FastPimpl<Impl, 48, 8> impl_;
 };
 
 }  // namespace ugrpc::client
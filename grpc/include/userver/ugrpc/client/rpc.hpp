@@ -24,6 +24,8 @@
 #include <userver/ugrpc/impl/deadline_timepoint.hpp>
 #include <userver/ugrpc/impl/internal_tag_fwd.hpp>
 #include <userver/ugrpc/impl/statistics_scope.hpp>
+#include <userver/ugrpc/impl/write_batcher.hpp>
+#include <userver/ugrpc/write_batching.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -272,6 +274,10 @@ class [[nodiscard]] OutputStream final : public CallAnyBase {
   /// @throws ugrpc::client::RpcCancelledError on task cancellation
   void WriteAndCheck(const Request& request);
 
+  /// @brief Lets gRPC send the next written messages in batches, see
+  /// @ref ugrpc::WriteBatchingConfig
+  void SetWriteBatching(const WriteBatchingConfig& config);
+
   /// @brief Complete the RPC successfully
   ///
   /// Should be called once all the data is written. The server will then
@@ -301,6 +307,7 @@ class [[nodiscard]] OutputStream final : public CallAnyBase {
  private:
   std::unique_ptr<Response> final_response_;
   impl::RawWriter<Request> stream_;
+  ugrpc::impl::WriteBatcher write_batcher_;
 };
 
 /// @brief Controls a request stream -> response stream RPC
@@ -382,6 +389,10 @@ class [[nodiscard]] BidirectionalStream final : public CallAnyBase {
   /// @throws ugrpc::client::RpcCancelledError on task cancellation
   void WriteAndCheck(const Request& request);
 
+  /// @brief Lets gRPC send the next written messages in batches, see
+  /// @ref ugrpc::WriteBatchingConfig
+  void SetWriteBatching(const WriteBatchingConfig& config);
+
   /// @brief Announce end-of-output to the server
   ///
   /// Should be called to notify the server and receive the final response(s).
@@ -405,6 +416,7 @@ class [[nodiscard]] BidirectionalStream final : public CallAnyBase {
 
  private:
   impl::RawReaderWriter<Request, Response> stream_;
+  ugrpc::impl::WriteBatcher write_batcher_;
 };
 
 // ========================== Implementation follows ==========================
@@ -560,24 +572,32 @@ OutputStream<Request, Response>::OutputStream(impl::CallParams&& params,
 
 template <typename Request, typename Response>
 bool OutputStream<Request, Response>::Write(const Request& request) {
-  // Don't buffer writes, otherwise in an event subscription scenario, events
-  // may never actually be delivered
-  grpc::WriteOptions write_options{};
+  // Don't buffer writes unless asked to, otherwise in an event subscription
+  // scenario, events may never actually be delivered
+  const auto write_options =
+      write_batcher_.PrepareWrite(GetData().GetStatsScope());
 
   return impl::Write(*stream_, request, write_options, GetData());
 }
 
 template <typename Request, typename Response>
 void OutputStream<Request, Response>::WriteAndCheck(const Request& request) {
-  // Don't buffer writes, otherwise in an event subscription scenario, events
-  // may never actually be delivered
-  grpc::WriteOptions write_options{};
+  // Don't buffer writes unless asked to, otherwise in an event subscription
+  // scenario, events may never actually be delivered
+  const auto write_options =
+      write_batcher_.PrepareWrite(GetData().GetStatsScope());
 
   if (!impl::Write(*stream_, request, write_options, GetData())) {
     impl::Finish(*stream_, GetData(), true);
   }
 }
 
+template <typename Request, typename Response>
+void OutputStream<Request, Response>::SetWriteBatching(
+    const WriteBatchingConfig& config) {
+  write_batcher_.SetConfig(config);
+}
+
 template <typename Request, typename Response>
 Response OutputStream<Request, Response>::Finish() {
   // gRPC does not implicitly call `WritesDone` in `Finish`,
@@ -585,6 +605,7 @@ Response OutputStream<Request, Response>::Finish() {
   if (!GetData().AreWritesFinished()) {
     impl::WritesDone(*stream_, GetData());
   }
+  write_batcher_.OnFlush(GetData().GetStatsScope());
 
   impl::Finish(*stream_, GetData(), true);
 
@@ -621,8 +642,10 @@ bool BidirectionalStream<Request, Response>::Read(Response& response) {
 
 template <typename Request, typename Response>
 bool BidirectionalStream<Request, Response>::Write(const Request& request) {
-  // Don't buffer writes, optimize for ping-pong-style interaction
-  grpc::WriteOptions write_options{};
+  // Don't buffer writes unless asked to, optimize for ping-pong-style
+  // interaction
+  const auto write_options =
+      write_batcher_.PrepareWrite(GetData().GetStatsScope());
 
   return impl::Write(*stream_, request, write_options, GetData());
 }
@@ -630,14 +653,23 @@ bool BidirectionalStream<Request, Response>::Write(const Request& request) {
 template <typename Request, typename Response>
 void BidirectionalStream<Request, Response>::WriteAndCheck(
     const Request& request) {
-  // Don't buffer writes, optimize for ping-pong-style interaction
-  grpc::WriteOptions write_options{};
+  // Don't buffer writes unless asked to, optimize for ping-pong-style
+  // interaction
+  const auto write_options =
+      write_batcher_.PrepareWrite(GetData().GetStatsScope());
 
   impl::WriteAndCheck(*stream_, request, write_options, GetData());
 }
 
+template <typename Request, typename Response>
+void BidirectionalStream<Request, Response>::SetWriteBatching(
+    const WriteBatchingConfig& config) {
+  write_batcher_.SetConfig(config);
+}
+
 template <typename Request, typename Response>
 bool BidirectionalStream<Request, Response>::WritesDone() {
+  write_batcher_.OnFlush(GetData().GetStatsScope());
   return impl::WritesDone(*stream_, GetData());
 }
 
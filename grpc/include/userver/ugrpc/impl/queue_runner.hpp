@@ -1,23 +1,54 @@
 #pragma once
 
+#include <cstddef>
+#include <vector>
+
 #include <grpcpp/completion_queue.h>
 
 #include <userver/engine/single_use_event.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::impl {
 
+struct QueueStatistics final {
+  QueueStatistics();
+
+  utils::statistics::RateCounter events;
+  // Time spent on dispatching an event to the awaiting task, in microseconds
+  utils::statistics::Histogram notify_timings;
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const QueueStatistics& stats);
+
 class QueueRunner final {
  public:
-  explicit QueueRunner(grpc::CompletionQueue& queue);
+  /// @param cpus if not empty, the polling thread is pinned to these CPUs
+  explicit QueueRunner(grpc::CompletionQueue& queue,
+                       std::vector<std::size_t> cpus = {});
   ~QueueRunner();
 
+  const QueueStatistics& GetStatistics() const noexcept { return statistics_; }
+
  private:
   grpc::CompletionQueue& queue_;
+  QueueStatistics statistics_;
   engine::SingleUseEvent completion_;
 };
 
+/// Resolves `completion-queue-count: 0` to a count that scales with the number
+/// of CPUs available to the process
+std::size_t ResolveQueueCount(std::size_t configured_count);
+
+/// Splits the CPUs available to the process into `queue_count` contiguous
+/// groups, one per completion queue thread. Returns empty groups if CPU
+/// affinity is not supported.
+std::vector<std::vector<std::size_t>> DistributeCpus(std::size_t queue_count);
+
 }  // namespace ugrpc::impl
 
 USERVER_NAMESPACE_END
@@ -12,16 +12,14 @@
 #include <userver/utils/statistics/fwd.hpp>
 #include <userver/utils/statistics/percentile.hpp>
 #include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/recent_timings.hpp>
 #include <userver/utils/statistics/recentperiod.hpp>
+#include <userver/utils/statistics/striped_rate_counter.hpp>
 
 #include <userver/ugrpc/impl/static_metadata.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
-namespace utils::statistics {
-class StripedRateCounter;
-}  // namespace utils::statistics
-
 namespace ugrpc::impl {
 
 enum class StatisticsDomain { kClient, kServer };
@@ -55,6 +53,9 @@ class MethodStatistics final {
 
   void AccountCancelled() noexcept;
 
+  // The number of messages sent by a single write, see WriteBatchingConfig
+  void AccountWriteBatch(std::size_t batch_size) noexcept;
+
   friend void DumpMetric(utils::statistics::Writer& writer,
                          const MethodStatistics& stats);
 
@@ -63,10 +64,15 @@ class MethodStatistics final {
   void MoveStartedTo(MethodStatistics& other) noexcept;
 
  private:
-  using Percentile =
-      utils::statistics::Percentile<2000, std::uint32_t, 256, 100>;
-  using Timings = utils::statistics::RecentPeriod<Percentile, Percentile>;
+  // Up to 64 exactly, then in the buckets of 8 up to 256
+  using BatchSizePercentile =
+      utils::statistics::Percentile<65, std::uint32_t, 24, 8>;
+  using BatchSizes =
+      utils::statistics::RecentPeriod<BatchSizePercentile, BatchSizePercentile>;
   using RateCounter = utils::statistics::RateCounter;
+  // The counters accounted for each RPC are hammered by all the workers on
+  // high-RPS methods, so they are striped per CPU and summed on scrape
+  using StripedRateCounter = utils::statistics::StripedRateCounter;
   // StatusCode enum cases have consecutive underlying values, starting from 0.
   // UNAUTHENTICATED currently has the largest value.
   static constexpr std::size_t kCodesCount =
@@ -75,16 +81,21 @@ class MethodStatistics final {
   const StatisticsDomain domain_;
   utils::statistics::StripedRateCounter& global_started_;
 
-  RateCounter started_{0};
+  StripedRateCounter started_;
   RateCounter started_renamed_{0};
-  std::array<RateCounter, kCodesCount> status_codes_{};
-  Timings timings_;
-  RateCounter network_errors_{0};
+  std::array<StripedRateCounter, kCodesCount> status_codes_{};
+  // Allocated on the first request, services and clients have many methods
+  // that are never called
+  utils::statistics::StripedRecentTimings timings_;
+  StripedRateCounter network_errors_;
   RateCounter internal_errors_{0};
-  RateCounter cancelled_{0};
+  StripedRateCounter cancelled_;
+
+  StripedRateCounter deadline_updated_;
+  StripedRateCounter deadline_cancelled_;
 
-  RateCounter deadline_updated_{0};
-  RateCounter deadline_cancelled_{0};
+  StripedRateCounter write_batches_;
+  BatchSizes write_batch_sizes_;
 };
 
 class ServiceStatistics final {
@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <optional>
 
 #include <grpcpp/support/status.h>
@@ -30,6 +31,8 @@ class RpcStatisticsScope final {
 
   void OnNetworkError();
 
+  void OnWriteBatch(std::size_t batch_size) noexcept;
+
   void Flush();
 
   // Not thread-safe with respect to Flush.
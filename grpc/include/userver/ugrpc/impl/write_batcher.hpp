@@ -0,0 +1,39 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+#include <grpcpp/impl/codegen/call_op_set.h>
+
+#include <userver/ugrpc/write_batching.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::impl {
+
+class RpcStatisticsScope;
+
+// Chooses the grpc::WriteOptions of the writes of a stream according to
+// WriteBatchingConfig. Not thread-safe.
+class WriteBatcher final {
+ public:
+  void SetConfig(const WriteBatchingConfig& config) noexcept;
+
+  // Returns the options for the next 'Write'
+  grpc::WriteOptions PrepareWrite(RpcStatisticsScope& statistics);
+
+  // Returns the options for 'WriteAndFinish', which sends the queued messages
+  grpc::WriteOptions PrepareLastWrite(RpcStatisticsScope& statistics) noexcept;
+
+  // The queued messages are sent by 'Finish' or 'WritesDone'
+  void OnFlush(RpcStatisticsScope& statistics) noexcept;
+
+ private:
+  WriteBatchingConfig config_;
+  std::size_t batch_size_{0};
+  std::chrono::steady_clock::time_point batch_start_;
+};
+
+}  // namespace ugrpc::impl
+
+USERVER_NAMESPACE_END
@@ -9,15 +9,37 @@
 
 #include <userver/formats/json.hpp>
 #include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/string_builder.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc {
 
 /// @brief Returns formats::json::Value representation of protobuf message
+///
+/// The conversion matches google::protobuf::util::MessageToJsonString with
+/// the fields without presence always printed. The message types are
+/// converted through the reflection data cached on the first use, the
+/// messages with the well-known types, groups or extensions fall back to
+/// google::protobuf::util.
 /// @throws SerializationError
 formats::json::Value MessageToJson(const google::protobuf::Message& message);
 
+/// @brief Writes JSON representation of protobuf message to the builder,
+/// same as MessageToJson
+/// @throws formats::json::Exception
+void MessageToJson(const google::protobuf::Message& message,
+                   formats::json::StringBuilder& sb);
+
+/// @brief Parses JSON representation of protobuf message, the reverse of
+/// MessageToJson
+///
+/// The message is cleared first. Both the JSON and the original field names
+/// are accepted, the unknown fields are an error.
+/// @throws formats::json::ParseException
+void JsonToMessage(const formats::json::Value& json,
+                   google::protobuf::Message& message);
+
 /// @brief Converts message to human readable string
 std::string ToString(const google::protobuf::Message& message);
 
@@ -0,0 +1,47 @@
+#pragma once
+
+/// @file userver/ugrpc/server/generic_proxy.hpp
+/// @brief @copybrief ugrpc::server::ProxyGenericCall
+
+#include <memory>
+
+#include <grpcpp/client_context.h>
+
+#include <userver/ugrpc/client/generic.hpp>
+#include <userver/ugrpc/server/generic_service_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server {
+
+/// @brief Forwards an RPC of any kind to `client` without parsing the
+/// messages.
+///
+/// Intended to be called from @ref GenericServiceBase::Handle of a proxy.
+///
+/// - the client metadata is appended to `context`, the deadline of `call` is
+///   used unless `context` has its own deadline;
+/// - the RPC is started downstream as a bidirectional stream with the same
+///   call name, which works for the methods of all four kinds;
+/// - the messages are passed as `grpc::ByteBuffer`, so the slices are shared
+///   and never copied;
+/// - the messages are forwarded in both directions concurrently, and the next
+///   message is not read until the previous one is written, so a slow reader
+///   on one side slows down the writer on the other side;
+/// - the initial and trailing metadata and the status of the downstream RPC
+///   are returned to the caller. If the downstream RPC fails without a status,
+///   `call` is finished with `UNAVAILABLE`.
+///
+/// Metadata to be added by the proxy itself can be put into `context` and
+/// into `call.GetContext()` before the call.
+///
+/// @throws ugrpc::server::RpcInterruptedError if `call` is broken
+void ProxyGenericCall(GenericServiceBase::Call& call,
+                      const client::GenericClient& client,
+                      std::unique_ptr<grpc::ClientContext> context =
+                          std::make_unique<grpc::ClientContext>(),
+                      const client::GenericOptions& options = {});
+
+}  // namespace ugrpc::server
+
+USERVER_NAMESPACE_END
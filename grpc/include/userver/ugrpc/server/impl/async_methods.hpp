@@ -58,6 +58,19 @@ void Finish(GrpcStream& stream, const grpc::Status& status,
   ThrowOnError(Wait(finish), call_name, "Finish");
 }
 
+// Starts the final operation of the RPC, the caller waits for `finish` later
+template <typename GrpcStream, typename Response>
+void StartFinish(GrpcStream& stream, const Response& response,
+                 const grpc::Status& status, AsyncMethodInvocation& finish) {
+  stream.Finish(response, status, finish.GetTag());
+}
+
+template <typename GrpcStream>
+void StartFinishWithError(GrpcStream& stream, const grpc::Status& status,
+                          AsyncMethodInvocation& finish) {
+  stream.FinishWithError(status, finish.GetTag());
+}
+
 template <typename GrpcStream>
 void Cancel(GrpcStream& stream, std::string_view call_name) noexcept {
   AsyncMethodInvocation cancel;
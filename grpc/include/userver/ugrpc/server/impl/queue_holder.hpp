@@ -6,6 +6,7 @@
 
 #include <userver/ugrpc/impl/completion_queues.hpp>
 #include <userver/utils/fast_pimpl.hpp>
+#include <userver/utils/statistics/fwd.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -17,7 +18,8 @@ namespace ugrpc::server::impl {
 /// instances are destroyed.
 class QueueHolder final {
  public:
-  explicit QueueHolder(std::size_t num, grpc::ServerBuilder& server_builder);
+  QueueHolder(std::size_t num, bool pin_threads,
+              grpc::ServerBuilder& server_builder);
 
   QueueHolder(QueueHolder&&) = delete;
   QueueHolder& operator=(QueueHolder&&) = delete;
@@ -29,6 +31,10 @@ class QueueHolder final {
 
   const ugrpc::impl::CompletionQueues& GetQueues();
 
+  /// Writes per-queue statistics labeled with `grpc_queue`
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const QueueHolder& holder);
+
  private:
   struct Impl;
   utils::FastPimpl<Impl, 48, 8> impl_;
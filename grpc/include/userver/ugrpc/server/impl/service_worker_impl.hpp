@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <exception>
 #include <functional>
@@ -9,6 +11,8 @@
 #include <type_traits>
 #include <utility>
 
+#include <google/protobuf/arena.h>
+#include <google/protobuf/message.h>
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/impl/service_type.h>
 #include <grpcpp/server_context.h>
@@ -20,6 +24,7 @@
 #include <userver/tracing/span.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
+#include <userver/utils/fixed_array.hpp>
 #include <userver/utils/impl/wait_token_storage.hpp>
 #include <userver/utils/lazy_prvalue.hpp>
 #include <userver/utils/statistics/entry.hpp>
@@ -75,6 +80,9 @@ struct ServiceData final {
   const ugrpc::impl::StaticServiceMetadata metadata;
   AsyncService<GrpcppService> async_service{metadata.method_full_names.size()};
   utils::impl::WaitTokenStorage wait_tokens;
+  // Recent request arena sizes per method, used as the next start block sizes
+  utils::FixedArray<std::atomic<std::size_t>> request_arena_sizes{
+      metadata.method_full_names.size(), std::size_t{0}};
   ugrpc::impl::ServiceStatistics& service_statistics{
       settings.statistics_storage.GetServiceStatistics(metadata, std::nullopt)};
 };
@@ -95,8 +103,44 @@ struct MethodData final {
       call_name.substr(service_data.metadata.service_full_name.size() + 1)};
   ugrpc::impl::MethodStatistics& statistics{
       service_data.service_statistics.GetMethodStatistics(method_id)};
+  std::atomic<std::size_t>& request_arena_size{
+      service_data.request_arena_sizes[method_id]};
 };
 
+template <typename InitialRequest>
+inline constexpr bool kIsArenaRequest =
+    std::is_base_of_v<google::protobuf::Message, InitialRequest>;
+
+inline constexpr std::size_t kMinRequestArenaBlockSize = 256;
+
+template <typename InitialRequest>
+std::optional<google::protobuf::Arena> MakeRequestArena(
+    std::size_t max_start_block_size, std::size_t recent_size) {
+  if constexpr (kIsArenaRequest<InitialRequest>) {
+    if (max_start_block_size != 0) {
+      google::protobuf::ArenaOptions options;
+      options.start_block_size =
+          std::clamp(recent_size, kMinRequestArenaBlockSize,
+                     std::max(max_start_block_size, kMinRequestArenaBlockSize));
+      options.max_block_size =
+          std::max(options.max_block_size, options.start_block_size);
+      return std::optional<google::protobuf::Arena>{std::in_place, options};
+    }
+  }
+  return std::optional<google::protobuf::Arena>{};
+}
+
+template <typename InitialRequest>
+InitialRequest& MakeInitialRequest(
+    std::optional<google::protobuf::Arena>& arena, InitialRequest& storage) {
+  if constexpr (kIsArenaRequest<InitialRequest>) {
+    if (arena) {
+      return *google::protobuf::Arena::Create<InitialRequest>(&*arena);
+    }
+  }
+  return storage;
+}
+
 template <typename GrpcppService, typename CallTraits>
 class CallData final {
  public:
@@ -151,6 +195,7 @@ class CallData final {
     ListenAsync(method_data_);
 
     HandleRpc();
+    UpdateRequestArenaSize();
   }
 
   static void ListenAsync(const MethodData<GrpcppService, CallTraits>& data) {
@@ -222,6 +267,16 @@ class CallData final {
     }
   }
 
+  void UpdateRequestArenaSize() noexcept {
+    if (!request_arena_) return;
+    // Decays slowly, so that a single small request does not shrink the
+    // arenas of the following large ones
+    const auto used = static_cast<std::size_t>(request_arena_->SpaceUsed());
+    auto& recent = method_data_.request_arena_size;
+    const auto old = recent.load(std::memory_order_relaxed);
+    recent.store(std::max(used, old - old / 8), std::memory_order_relaxed);
+  }
+
   // 'wait_token_' must be the first field, because its lifetime keeps
   // ServiceData alive during server shutdown.
   const utils::impl::WaitTokenStorage::Token wait_token_;
@@ -229,7 +284,15 @@ class CallData final {
   MethodData<GrpcppService, CallTraits> method_data_;
 
   typename CallTraits::ContextType context_{};
-  InitialRequest initial_request_{};
+  // The initial request is allocated on a per-call arena if
+  // ServiceConfig::request_arena_max_start_block_size is set
+  std::optional<google::protobuf::Arena> request_arena_{
+      MakeRequestArena<InitialRequest>(
+          method_data_.service_data.settings.request_arena_max_start_block_size,
+          method_data_.request_arena_size.load(std::memory_order_relaxed))};
+  InitialRequest initial_request_storage_{};
+  InitialRequest& initial_request_{
+      MakeInitialRequest(request_arena_, initial_request_storage_)};
   RawCall raw_responder_{&context_};
   ugrpc::impl::AsyncMethodInvocation prepare_;
   std::optional<tracing::InPlaceSpan> span_{};
@@ -13,10 +13,12 @@
 #include <userver/ugrpc/impl/internal_tag_fwd.hpp>
 #include <userver/ugrpc/impl/span.hpp>
 #include <userver/ugrpc/impl/statistics_scope.hpp>
+#include <userver/ugrpc/impl/write_batcher.hpp>
 #include <userver/ugrpc/server/exceptions.hpp>
 #include <userver/ugrpc/server/impl/async_methods.hpp>
 #include <userver/ugrpc/server/impl/call_params.hpp>
 #include <userver/ugrpc/server/middlewares/fwd.hpp>
+#include <userver/ugrpc/write_batching.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -131,6 +133,8 @@ class CallAnyBase {
 
   void ApplyResponseHook(google::protobuf::Message* response);
 
+  void WaitForDeferredFinish(impl::AsyncMethodInvocation& finish) noexcept;
+
  private:
   impl::CallParams params_;
   CallKind call_kind_;
@@ -140,6 +144,11 @@ class CallAnyBase {
 /// @brief Controls a single request -> single response RPC
 ///
 /// The RPC is cancelled on destruction unless `Finish` has been called.
+///
+/// `Finish` and `FinishWithError` do not wait for the response to be sent:
+/// the handler and the middlewares complete concurrently with the sending,
+/// which is awaited on destruction. Network errors of the final send are
+/// reported to logs and metrics instead of being thrown.
 template <typename Response>
 class UnaryCall final : public CallAnyBase {
  public:
@@ -148,7 +157,6 @@ class UnaryCall final : public CallAnyBase {
   /// `Finish` must not be called multiple times for the same RPC.
   ///
   /// @param response the single Response to send to the client
-  /// @throws ugrpc::server::RpcError on an RPC error
   void Finish(Response& response);
 
   /// @brief Complete the RPC successfully
@@ -156,7 +164,6 @@ class UnaryCall final : public CallAnyBase {
   /// `Finish` must not be called multiple times for the same RPC.
   ///
   /// @param response the single Response to send to the client
-  /// @throws ugrpc::server::RpcError on an RPC error
   void Finish(Response&& response);
 
   /// @brief Complete the RPC with an error
@@ -164,7 +171,6 @@ class UnaryCall final : public CallAnyBase {
   /// `Finish` must not be called multiple times for the same RPC.
   ///
   /// @param status error details
-  /// @throws ugrpc::server::RpcError on an RPC error
   void FinishWithError(const grpc::Status& status) override;
 
   /// For internal use only
@@ -179,6 +185,7 @@ class UnaryCall final : public CallAnyBase {
 
  private:
   impl::RawResponseWriter<Response>& stream_;
+  impl::AsyncMethodInvocation finish_;
   bool is_finished_{false};
 };
 
@@ -260,6 +267,10 @@ class OutputStream final : public CallAnyBase {
   /// @throws ugrpc::server::RpcError on an RPC error
   void Write(Response&& response);
 
+  /// @brief Lets gRPC send the next written messages in batches, see
+  /// @ref ugrpc::WriteBatchingConfig
+  void SetWriteBatching(const WriteBatchingConfig& config);
+
   /// @brief Complete the RPC successfully
   ///
   /// `Finish` must not be called multiple times.
@@ -310,6 +321,7 @@ class OutputStream final : public CallAnyBase {
 
   impl::RawWriter<Response>& stream_;
   State state_{State::kNew};
+  ugrpc::impl::WriteBatcher write_batcher_;
 };
 
 /// @brief Controls a request stream -> response stream RPC
@@ -343,6 +355,10 @@ class BidirectionalStream : public CallAnyBase {
   /// @throws ugrpc::server::RpcError on an RPC error
   void Write(Response&& response);
 
+  /// @brief Lets gRPC send the next written messages in batches, see
+  /// @ref ugrpc::WriteBatchingConfig
+  void SetWriteBatching(const WriteBatchingConfig& config);
+
   /// @brief Complete the RPC successfully
   ///
   /// `Finish` must not be called multiple times.
@@ -392,6 +408,7 @@ class BidirectionalStream : public CallAnyBase {
   impl::RawReaderWriter<Request, Response>& stream_;
   bool are_reads_done_{false};
   bool is_finished_{false};
+  ugrpc::impl::WriteBatcher write_batcher_;
 };
 
 // ========================== Implementation follows ==========================
@@ -408,6 +425,8 @@ UnaryCall<Response>::~UnaryCall() {
   if (!is_finished_) {
     impl::CancelWithError(stream_, GetCallName());
     LogFinish(impl::kUnknownErrorStatus);
+  } else {
+    WaitForDeferredFinish(finish_);
   }
 }
 
@@ -424,7 +443,7 @@ void UnaryCall<Response>::Finish(Response& response) {
   ApplyResponseHook(&response);
 
   LogFinish(grpc::Status::OK);
-  impl::Finish(stream_, response, grpc::Status::OK, GetCallName());
+  impl::StartFinish(stream_, response, grpc::Status::OK, finish_);
   GetStatistics().OnExplicitFinish(grpc::StatusCode::OK);
   ugrpc::impl::UpdateSpanWithStatus(GetSpan(), grpc::Status::OK);
 }
@@ -434,7 +453,7 @@ void UnaryCall<Response>::FinishWithError(const grpc::Status& status) {
   UINVARIANT(!is_finished_, "'FinishWithError' called on a finished call");
   is_finished_ = true;
   LogFinish(status);
-  impl::FinishWithError(stream_, status, GetCallName());
+  impl::StartFinishWithError(stream_, status, finish_);
   GetStatistics().OnExplicitFinish(status.error_code());
   ugrpc::impl::UpdateSpanWithStatus(GetSpan(), status);
 }
@@ -539,15 +558,21 @@ void OutputStream<Response>::Write(Response& response) {
   // streams
   impl::SendInitialMetadataIfNew(stream_, GetCallName(), state_);
 
-  // Don't buffer writes, otherwise in an event subscription scenario, events
-  // may never actually be delivered
-  grpc::WriteOptions write_options{};
+  // Don't buffer writes unless asked to, otherwise in an event subscription
+  // scenario, events may never actually be delivered
+  const auto write_options = write_batcher_.PrepareWrite(GetStatistics());
 
   ApplyResponseHook(&response);
 
   impl::Write(stream_, response, write_options, GetCallName());
 }
 
+template <typename Response>
+void OutputStream<Response>::SetWriteBatching(
+    const WriteBatchingConfig& config) {
+  write_batcher_.SetConfig(config);
+}
+
 template <typename Response>
 void OutputStream<Response>::Finish() {
   UINVARIANT(state_ != State::kFinished,
@@ -557,6 +582,7 @@ void OutputStream<Response>::Finish() {
   const auto& status = grpc::Status::OK;
   LogFinish(status);
   impl::Finish(stream_, status, GetCallName());
+  write_batcher_.OnFlush(GetStatistics());
   GetStatistics().OnExplicitFinish(grpc::StatusCode::OK);
   ugrpc::impl::UpdateSpanWithStatus(GetSpan(), status);
 }
@@ -569,6 +595,7 @@ void OutputStream<Response>::FinishWithError(const grpc::Status& status) {
   state_ = State::kFinished;
   LogFinish(status);
   impl::Finish(stream_, status, GetCallName());
+  write_batcher_.OnFlush(GetStatistics());
   GetStatistics().OnExplicitFinish(status.error_code());
   ugrpc::impl::UpdateSpanWithStatus(GetSpan(), status);
 }
@@ -584,9 +611,8 @@ void OutputStream<Response>::WriteAndFinish(Response& response) {
              "'WriteAndFinish' called on a finished stream");
   state_ = State::kFinished;
 
-  // Don't buffer writes, otherwise in an event subscription scenario, events
-  // may never actually be delivered
-  grpc::WriteOptions write_options{};
+  // Sends the messages queued by the previous writes as well
+  const auto write_options = write_batcher_.PrepareLastWrite(GetStatistics());
 
   const auto& status = grpc::Status::OK;
   LogFinish(status);
@@ -643,8 +669,9 @@ template <typename Request, typename Response>
 void BidirectionalStream<Request, Response>::Write(Response& response) {
   UINVARIANT(!is_finished_, "'Write' called on a finished stream");
 
-  // Don't buffer writes, optimize for ping-pong-style interaction
-  grpc::WriteOptions write_options{};
+  // Don't buffer writes unless asked to, optimize for ping-pong-style
+  // interaction
+  const auto write_options = write_batcher_.PrepareWrite(GetStatistics());
 
   if constexpr (std::is_base_of_v<google::protobuf::Message, Response>) {
     ApplyResponseHook(&response);
@@ -658,6 +685,12 @@ void BidirectionalStream<Request, Response>::Write(Response& response) {
   }
 }
 
+template <typename Request, typename Response>
+void BidirectionalStream<Request, Response>::SetWriteBatching(
+    const WriteBatchingConfig& config) {
+  write_batcher_.SetConfig(config);
+}
+
 template <typename Request, typename Response>
 void BidirectionalStream<Request, Response>::Finish() {
   UINVARIANT(!is_finished_, "'Finish' called on a finished stream");
@@ -666,6 +699,7 @@ void BidirectionalStream<Request, Response>::Finish() {
   const auto& status = grpc::Status::OK;
   LogFinish(status);
   impl::Finish(stream_, status, GetCallName());
+  write_batcher_.OnFlush(GetStatistics());
   GetStatistics().OnExplicitFinish(grpc::StatusCode::OK);
   ugrpc::impl::UpdateSpanWithStatus(GetSpan(), status);
 }
@@ -678,6 +712,7 @@ void BidirectionalStream<Request, Response>::FinishWithError(
   is_finished_ = true;
   LogFinish(status);
   impl::Finish(stream_, status, GetCallName());
+  write_batcher_.OnFlush(GetStatistics());
   GetStatistics().OnExplicitFinish(status.error_code());
   ugrpc::impl::UpdateSpanWithStatus(GetSpan(), status);
 }
@@ -694,8 +729,8 @@ void BidirectionalStream<Request, Response>::WriteAndFinish(
   UINVARIANT(!is_finished_, "'WriteAndFinish' called on a finished stream");
   is_finished_ = true;
 
-  // Don't buffer writes, optimize for ping-pong-style interaction
-  grpc::WriteOptions write_options{};
+  // Sends the messages queued by the previous writes as well
+  const auto write_options = write_batcher_.PrepareLastWrite(GetStatistics());
 
   const auto& status = grpc::Status::OK;
   LogFinish(status);
@@ -19,6 +19,7 @@
 #include <userver/utils/statistics/fwd.hpp>
 #include <userver/yaml_config/fwd.hpp>
 
+#include <userver/ugrpc/impl/completion_queues.hpp>
 #include <userver/ugrpc/impl/statistics.hpp>
 #include <userver/ugrpc/server/middlewares/fwd.hpp>
 #include <userver/ugrpc/server/service_base.hpp>
@@ -41,9 +42,13 @@ struct ServerConfig final {
   std::optional<std::string> unix_socket_path{std::nullopt};
 
   /// Number of completion queues to create. Should be ~2 times less than number
-  /// of worker threads for best RPS.
+  /// of worker threads for best RPS. `0` picks a half of the available CPUs.
   int completion_queue_num{2};
 
+  /// Pin the threads polling the completion queues to disjoint groups of the
+  /// available CPUs
+  bool pin_completion_queues{false};
+
   /// Optional grpc-core channel args
   /// @see https://grpc.github.io/grpc/core/group__grpc__arg__keys.html
   std::unordered_map<std::string, std::string> channel_args{};
@@ -98,6 +103,11 @@ class Server final
   /// usually no more than one instance per program.
   grpc::CompletionQueue& GetCompletionQueue() noexcept;
 
+  /// @returns all the completion queues of the server, clients may be spread
+  /// between them
+  /// @note See the notes for GetCompletionQueue
+  const ugrpc::impl::CompletionQueues& GetCompletionQueues() noexcept;
+
   /// @brief Start accepting requests
   /// @note Must be called at most once after all the services are registered
   void Start();
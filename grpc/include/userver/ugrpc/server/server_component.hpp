@@ -29,7 +29,8 @@ struct ServiceDefaults;
 /// access-tskv-logger | logger name for access-tskv.log | -
 /// port | the port to use for all gRPC services, or 0 to pick any available | -
 /// unix-socket-path | unix socket absolute path to listen to, instead of listening on `port` | -
-/// completion-queue-count | count of completion queues to create | 2
+/// completion-queue-count | count of completion queues to create, 0 to pick a half of the available CPUs | 2
+/// pin-completion-queues | pin the threads polling the completion queues to disjoint groups of the available CPUs | false
 /// channel-args | a map of channel arguments, see gRPC Core docs | {}
 /// native-log-level | min log level for the native gRPC library | 'error'
 /// enable-channelz | initialize service with runtime info about gRPC connections | false
@@ -3,6 +3,8 @@
 /// @file userver/ugrpc/server/service_base.hpp
 /// @brief @copybrief ugrpc::server::ServiceBase
 
+#include <cstddef>
+
 #include <userver/engine/task/task_processor_fwd.hpp>
 
 #include <userver/ugrpc/server/impl/service_worker.hpp>
@@ -19,6 +21,12 @@ struct ServiceConfig final {
 
   /// Server middlewares to use for the gRPC service.
   Middlewares middlewares;
+
+  /// If not 0, the initial request message of each RPC is allocated on a
+  /// per-call google::protobuf::Arena. The first arena block is sized after
+  /// the recent requests of the method, but not larger than this value.
+  /// @warning Moving out of an arena-allocated request copies it.
+  std::size_t request_arena_max_start_block_size{0};
 };
 
 /// @brief The type-erased base class for all gRPC service implementations
@@ -29,6 +29,7 @@ class GenericServiceBase;
 /// ---- | ----------- | -------------
 /// task-processor | the task processor to use for responses | taken from grpc-server.service-defaults
 /// middlewares | middleware component names to use for each RPC call, can be empty array ([]) | taken from grpc-server.service-defaults
+/// request-arena-max-start-block-size | if not 0, requests are allocated on a per-call protobuf arena with the first block sized after the recent requests, but not larger than this value in bytes | taken from grpc-server.service-defaults, or 0
 
 // clang-format on
 
@@ -0,0 +1,43 @@
+#pragma once
+
+/// @file userver/ugrpc/write_batching.hpp
+/// @brief @copybrief ugrpc::WriteBatchingConfig
+
+#include <chrono>
+#include <cstddef>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc {
+
+/// @brief Settings of the write batching of a stream, see
+/// `SetWriteBatching` of the server and client streams.
+///
+/// By default every `Write` is sent to the network on its own. With batching
+/// enabled, a `Write` only queues the message in gRPC (using
+/// `grpc::WriteOptions::set_buffer_hint`), and the queued messages are sent
+/// together with the write that completes the batch. A batch is complete when
+/// it has `max_batch_size` messages, or when the first message of the batch
+/// has waited for at least `max_delay`.
+///
+/// The messages of an incomplete batch are also sent when the stream is
+/// finished (or on `WritesDone` for the clients), or when the connection is
+/// written to by another RPC. `max_delay` is checked on `Write` only, so
+/// batching does not suit the streams that pause between the messages, or
+/// the ping-pong-style interactions, where the peer waits for a message that
+/// is queued.
+///
+/// The size of the sent batches is reported in the `write-batch-size`
+/// percentiles of the RPC metrics.
+struct WriteBatchingConfig final {
+  /// The maximum number of messages sent together. `0` and `1` disable the
+  /// batching.
+  std::size_t max_batch_size{1};
+
+  /// The maximum time the first message of a batch waits for the next writes.
+  std::chrono::microseconds max_delay{0};
+};
+
+}  // namespace ugrpc
+
+USERVER_NAMESPACE_END
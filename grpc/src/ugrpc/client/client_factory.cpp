@@ -8,6 +8,9 @@
 #include <userver/engine/async.hpp>
 #include <userver/logging/level_serialization.hpp>
 #include <userver/utils/algo.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
 #include <ugrpc/client/impl/client_factory_config.hpp>
@@ -26,13 +29,25 @@ ClientFactory::ClientFactory(ClientFactorySettings&& settings,
                              utils::statistics::Storage& statistics_storage,
                              testsuite::GrpcControl& testsuite_grpc,
                              dynamic_config::Source source)
+    : ClientFactory(std::move(settings), channel_task_processor, std::move(mws),
+                    ugrpc::impl::CompletionQueues{{&queue}},
+                    statistics_storage, testsuite_grpc, source) {}
+
+ClientFactory::ClientFactory(ClientFactorySettings&& settings,
+                             engine::TaskProcessor& channel_task_processor,
+                             MiddlewareFactories mws,
+                             const ugrpc::impl::CompletionQueues& queues,
+                             utils::statistics::Storage& statistics_storage,
+                             testsuite::GrpcControl& testsuite_grpc,
+                             dynamic_config::Source source)
     : channel_task_processor_(channel_task_processor),
       mws_(mws),
-      queue_(queue),
+      queues_(queues),
       channel_cache_(testsuite_grpc.IsTlsEnabled()
                          ? settings.credentials
                          : grpc::InsecureChannelCredentials(),
-                     settings.channel_args, settings.channel_count),
+                     settings.channel_args, settings.channel_count,
+                     settings.channel_max_concurrent_streams),
       client_statistics_storage_(statistics_storage,
                                  ugrpc::impl::StatisticsDomain::kClient),
       config_source_(source),
@@ -46,8 +61,17 @@ ClientFactory::ClientFactory(ClientFactorySettings&& settings,
         std::make_unique<impl::ChannelCache>(
             testsuite_grpc.IsTlsEnabled() ? creds
                                           : grpc::InsecureChannelCredentials(),
-            settings.channel_args, settings.channel_count));
+            settings.channel_args, settings.channel_count,
+            settings.channel_max_concurrent_streams));
   }
+
+  channel_statistics_holder_ = statistics_storage.RegisterWriter(
+      "grpc.client.channels", [this](utils::statistics::Writer& writer) {
+        DumpMetric(writer, channel_cache_);
+        for (const auto& [client_name, channel_cache] : client_channel_cache_) {
+          writer.ValueWithLabels(*channel_cache, {"grpc_client", client_name});
+        }
+      });
 }
 
 impl::ChannelCache::Token ClientFactory::GetChannel(
@@ -69,6 +93,12 @@ impl::ChannelCache::Token ClientFactory::GetChannel(
       .Get();
 }
 
+grpc::CompletionQueue& ClientFactory::GetNextQueue() noexcept {
+  UASSERT(!queues_.queues.empty());
+  const auto index = next_queue_.fetch_add(1, std::memory_order_relaxed);
+  return *queues_.queues[index % queues_.queues.size()];
+}
+
 }  // namespace ugrpc::client
 
 USERVER_NAMESPACE_END
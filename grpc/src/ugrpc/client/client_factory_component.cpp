@@ -6,6 +6,8 @@
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/storages/secdist/component.hpp>
 #include <userver/testsuite/testsuite_support.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 #include <ugrpc/client/impl/client_factory_config.hpp>
@@ -37,17 +39,23 @@ ClientFactoryComponent::ClientFactoryComponent(
   auto& task_processor =
       context.GetTaskProcessor(config["task-processor"].As<std::string>());
 
-  grpc::CompletionQueue* queue = nullptr;
+  auto& statistics_storage =
+      context.FindComponent<components::StatisticsStorage>().GetStorage();
+
+  const ugrpc::impl::CompletionQueues* queues = nullptr;
   if (auto* const server =
           context.FindComponentOptional<ugrpc::server::ServerComponent>()) {
-    queue = &server->GetServer().GetCompletionQueue();
+    queues = &server->GetServer().GetCompletionQueues();
   } else {
-    queue_.emplace();
-    queue = &queue_->GetQueue();
+    queue_.emplace(config["completion-queue-count"].As<std::size_t>(1),
+                   config["pin-completion-queues"].As<bool>(false));
+    queues = &queue_->GetQueues();
+    queue_statistics_holder_ = statistics_storage.RegisterWriter(
+        "grpc.client.completion-queues",
+        [this](utils::statistics::Writer& writer) {
+          DumpMetric(writer, *queue_);
+        });
   }
-
-  auto& statistics_storage =
-      context.FindComponent<components::StatisticsStorage>().GetStorage();
   const auto config_source =
       context.FindComponent<components::DynamicConfig>().GetSource();
 
@@ -65,7 +73,7 @@ ClientFactoryComponent::ClientFactoryComponent(
 
   const auto* secdist = GetSecdist(context);
   factory_.emplace(MakeFactorySettings(std::move(factory_config), secdist),
-                   task_processor, mws, *queue, statistics_storage,
+                   task_processor, mws, *queues, statistics_storage,
                    testsuite_grpc, config_source);
 }
 
@@ -119,6 +127,29 @@ properties:
         description: |
             Number of channels created for each endpoint.
         defaultDescription: 1
+    channel-max-concurrent-streams:
+        type: integer
+        description: |
+            calls in flight on a channel before the next channel of the
+            endpoint is used, so that the channels are only connected when
+            the load requires them. 0 sends each call to the least loaded
+            channel.
+        defaultDescription: 0
+        minimum: 0
+    completion-queue-count:
+        type: integer
+        description: |
+            completion queue count to create if there is no grpc-server
+            component, otherwise the clients are spread between the server
+            queues. 0 picks a half of the available CPUs.
+        defaultDescription: 1
+        minimum: 0
+    pin-completion-queues:
+        type: boolean
+        description: |
+            pin the threads polling the completion queues to disjoint groups of
+            the available CPUs, if there is no grpc-server component
+        defaultDescription: false
     middlewares:
         type: array
         items:
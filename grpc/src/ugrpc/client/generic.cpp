@@ -28,12 +28,14 @@ client::UnaryCall<grpc::ByteBuffer> GenericClient::UnaryCall(
     std::string_view call_name, const grpc::ByteBuffer& request,
     std::unique_ptr<grpc::ClientContext> context,
     const GenericOptions& generic_options) const {
-  auto& stub = impl_.NextStub<GenericStubService>();
+  impl::ChannelInFlightGuard in_flight;
+  auto& stub = impl_.NextStub<GenericStubService>(in_flight);
   auto grpcpp_call_name = utils::StrCat<grpc::string>("/", call_name);
   return {
       impl::CreateGenericCallParams(impl_, call_name, std::move(context),
                                     generic_options.qos,
-                                    generic_options.metrics_call_name),
+                                    generic_options.metrics_call_name,
+                                    std::move(in_flight)),
       [&stub, &grpcpp_call_name](grpc::ClientContext* context,
                                  const grpc::ByteBuffer& request,
                                  grpc::CompletionQueue* cq) {
@@ -43,6 +45,25 @@ client::UnaryCall<grpc::ByteBuffer> GenericClient::UnaryCall(
   };
 }
 
+client::BidirectionalStream<grpc::ByteBuffer, grpc::ByteBuffer>
+GenericClient::BidirectionalStream(
+    std::string_view call_name, std::unique_ptr<grpc::ClientContext> context,
+    const GenericOptions& generic_options) const {
+  impl::ChannelInFlightGuard in_flight;
+  auto& stub = impl_.NextStub<GenericStubService>(in_flight);
+  auto grpcpp_call_name = utils::StrCat<grpc::string>("/", call_name);
+  return {
+      impl::CreateGenericCallParams(impl_, call_name, std::move(context),
+                                    generic_options.qos,
+                                    generic_options.metrics_call_name,
+                                    std::move(in_flight)),
+      [&stub, &grpcpp_call_name](grpc::ClientContext* context,
+                                 grpc::CompletionQueue* cq) {
+        return stub.PrepareCall(context, grpcpp_call_name, cq);
+      },
+  };
+}
+
 }  // namespace ugrpc::client
 
 USERVER_NAMESPACE_END
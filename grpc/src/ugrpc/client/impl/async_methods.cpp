@@ -5,6 +5,7 @@
 
 #include <userver/dynamic_config/snapshot.hpp>
 #include <userver/engine/deadline.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/tracing/tags.hpp>
 #include <userver/utils/algo.hpp>
 #include <userver/utils/assert.hpp>
@@ -93,7 +94,8 @@ RpcData::RpcData(impl::CallParams&& params)
       stats_scope_(params.statistics),
       queue_(params.queue),
       config_values_(params.config),
-      mws_(params.mws) {
+      mws_(params.mws),
+      in_flight_(std::move(params.in_flight)) {
   UASSERT(context_);
   UASSERT(!client_name_.empty());
   SetupSpan(span_, *context_, call_name_.Get());
@@ -165,6 +167,7 @@ void RpcData::SetFinished() noexcept {
   UASSERT(context_);
   UINVARIANT(!is_finished_, "Tried to finish already finished call");
   is_finished_ = true;
+  in_flight_ = {};
 }
 
 bool RpcData::IsFinished() const noexcept {
@@ -178,6 +181,20 @@ void RpcData::SetDeadlinePropagated() noexcept {
   is_deadline_propagated_ = true;
 }
 
+void RpcData::AddFinishHook(FinishHook hook) {
+  finish_hooks_.push_back(std::move(hook));
+}
+
+void RpcData::RunFinishHooks(grpc::StatusCode code) noexcept {
+  for (const auto& hook : finish_hooks_) {
+    try {
+      hook(code);
+    } catch (const std::exception& ex) {
+      LOG_LIMITED_ERROR() << "gRPC client finish hook failed: " << ex;
+    }
+  }
+}
+
 bool RpcData::IsDeadlinePropagated() const noexcept {
   UASSERT(context_);
   return is_deadline_propagated_;
@@ -272,6 +289,7 @@ void ProcessFinishResult(RpcData& data,
               "by gRPC docs, see grpc::CompletionQueue::Next");
   data.GetStatsScope().OnExplicitFinish(status.error_code());
   data.GetStatsScope().Flush();
+  data.RunFinishHooks(status.error_code());
 
   if (!status.ok()) {
     SetStatusDetailsForSpan(data, status, parsed_gstatus.gstatus_string);
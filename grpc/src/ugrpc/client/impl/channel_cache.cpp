@@ -7,6 +7,8 @@
 #include <grpcpp/security/credentials.h>
 
 #include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 #include <ugrpc/impl/to_string.hpp>
 
@@ -14,6 +16,47 @@ USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::client::impl {
 
+namespace {
+
+struct ChannelLoadStatistics final {
+  std::uint64_t channels{0};
+  std::uint64_t active_channels{0};
+  std::uint64_t in_flight{0};
+  std::uint64_t max_channel_in_flight{0};
+  utils::statistics::Rate saturated_calls;
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ChannelLoadStatistics& stats) {
+  writer["channels"] = stats.channels;
+  writer["active-channels"] = stats.active_channels;
+  writer["in-flight"] = stats.in_flight;
+  writer["max-channel-in-flight"] = stats.max_channel_in_flight;
+  writer["saturated-calls"] = stats.saturated_calls;
+}
+
+}  // namespace
+
+ChannelInFlightGuard::ChannelInFlightGuard(
+    std::atomic<std::uint64_t>& in_flight) noexcept
+    : in_flight_(&in_flight) {
+  in_flight.fetch_add(1, std::memory_order_relaxed);
+}
+
+ChannelInFlightGuard::ChannelInFlightGuard(
+    ChannelInFlightGuard&& other) noexcept
+    : in_flight_(std::exchange(other.in_flight_, nullptr)) {}
+
+ChannelInFlightGuard& ChannelInFlightGuard::operator=(
+    ChannelInFlightGuard&& other) noexcept {
+  std::swap(in_flight_, other.in_flight_);
+  return *this;
+}
+
+ChannelInFlightGuard::~ChannelInFlightGuard() {
+  if (in_flight_) in_flight_->fetch_sub(1, std::memory_order_relaxed);
+}
+
 ChannelCache::Token::Token(ChannelCache& cache, const std::string& endpoint,
                            CountedChannel& counted_channel) noexcept
     : cache_(&cache), endpoint_(&endpoint), counted_channel_(&counted_channel) {
@@ -55,11 +98,42 @@ std::size_t ChannelCache::Token::GetChannelCount() const noexcept {
   return counted_channel_->channels.size();
 }
 
+ChannelCache::Token::ChannelPick ChannelCache::Token::PickChannel() const
+    noexcept {
+  UASSERT(cache_);
+  UASSERT(counted_channel_);
+  auto& in_flight = counted_channel_->in_flight;
+  const auto count = in_flight.size();
+  const auto max_streams = cache_->max_concurrent_streams_;
+
+  // Ties between the equally loaded channels are broken randomly, unless the
+  // channels are filled one by one
+  const std::size_t start = max_streams ? 0 : utils::RandRange(count);
+  std::size_t best = start;
+  auto best_load = in_flight[start].load(std::memory_order_relaxed);
+  for (std::size_t i = 1; i < count && (!max_streams || best_load >= max_streams);
+       ++i) {
+    const auto index = (start + i) % count;
+    const auto load = in_flight[index].load(std::memory_order_relaxed);
+    if (load < best_load) {
+      best = index;
+      best_load = load;
+    }
+  }
+
+  if (max_streams && best_load >= max_streams) {
+    ++counted_channel_->saturated_calls;
+  }
+  return {best, ChannelInFlightGuard{in_flight[best]}};
+}
+
 ChannelCache::CountedChannel::CountedChannel(
     const std::string& endpoint,
     const std::shared_ptr<grpc::ChannelCredentials>& credentials,
-    const grpc::ChannelArguments& channel_args, std::size_t count) {
+    const grpc::ChannelArguments& channel_args, std::size_t count)
+    : in_flight(count, 0) {
   const auto endpoint_string = ugrpc::impl::ToGrpcString(endpoint);
+  // grpc::Channel does not connect until the first call on it
   channels = utils::GenerateFixedArray(count, [&](std::size_t) {
     return grpc::CreateCustomChannel(endpoint_string, credentials,
                                      channel_args);
@@ -69,10 +143,12 @@ ChannelCache::CountedChannel::CountedChannel(
 
 ChannelCache::ChannelCache(
     std::shared_ptr<grpc::ChannelCredentials>&& credentials,
-    const grpc::ChannelArguments& channel_args, std::size_t channel_count)
+    const grpc::ChannelArguments& channel_args, std::size_t channel_count,
+    std::size_t max_concurrent_streams)
     : credentials_(std::move(credentials)),
       channel_args_(channel_args),
-      channel_count_(channel_count) {
+      channel_count_(channel_count),
+      max_concurrent_streams_(max_concurrent_streams) {
   UINVARIANT(channel_count > 0, "Channels count must be greater than zero");
 }
 
@@ -85,6 +161,23 @@ ChannelCache::Token ChannelCache::Get(const std::string& endpoint) {
   return {*this, it->first, it->second};
 }
 
+void DumpMetric(utils::statistics::Writer& writer, const ChannelCache& cache) {
+  const auto channels = cache.channels_.Lock();
+  for (const auto& [endpoint, counted_channel] : *channels) {
+    ChannelLoadStatistics stats;
+    stats.channels = counted_channel.channels.size();
+    for (const auto& channel_in_flight : counted_channel.in_flight) {
+      const auto load = channel_in_flight.load(std::memory_order_relaxed);
+      stats.in_flight += load;
+      stats.max_channel_in_flight = std::max(stats.max_channel_in_flight, load);
+      if (load != 0) ++stats.active_channels;
+    }
+    stats.saturated_calls = counted_channel.saturated_calls.Load();
+
+    writer.ValueWithLabels(stats, {"grpc_endpoint", endpoint});
+  }
+}
+
 }  // namespace ugrpc::client::impl
 
 USERVER_NAMESPACE_END
@@ -68,6 +68,9 @@ ClientFactoryConfig Parse(const yaml_config::YamlConfig& value,
       value["native-log-level"].As<logging::Level>(config.native_log_level);
   config.channel_count =
       value["channel-count"].As<std::size_t>(config.channel_count);
+  config.channel_max_concurrent_streams =
+      value["channel-max-concurrent-streams"].As<std::size_t>(
+          config.channel_max_concurrent_streams);
 
   return config;
 }
@@ -95,6 +98,7 @@ ClientFactorySettings MakeFactorySettings(
       config.channel_args,
       config.native_log_level,
       config.channel_count,
+      config.channel_max_concurrent_streams,
   };
 }
 
@@ -26,6 +26,10 @@ struct ClientFactoryConfig final {
   /// Number of underlying channels that will be created for every client
   /// in this factory.
   std::size_t channel_count{1};
+
+  /// Calls in flight on a channel before the next channel is used, 0 to
+  /// always pick the least loaded channel
+  std::size_t channel_max_concurrent_streams{0};
 };
 
 ClientFactoryConfig Parse(const yaml_config::YamlConfig& value,
@@ -0,0 +1,50 @@
+#include <userver/ugrpc/client/middlewares/adaptive_throttling/component.hpp>
+
+#include <ugrpc/client/middlewares/adaptive_throttling/middleware.hpp>
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client::middlewares::adaptive_throttling {
+
+Component::Component(const components::ComponentConfig& config,
+                     const components::ComponentContext& context)
+    : MiddlewareComponentBase(config, context),
+      factory_(std::make_shared<MiddlewareFactory>(
+          config.As<congestion_control::ClientThrottlerConfig>())) {
+  auto& storage =
+      context.FindComponent<components::StatisticsStorage>().GetStorage();
+  statistics_holder_ = storage.RegisterWriter(
+      "grpc.client.adaptive-throttling",
+      [this](utils::statistics::Writer& writer) { writer = *factory_; });
+}
+
+Component::~Component() { statistics_holder_.Unregister(); }
+
+std::shared_ptr<const MiddlewareFactoryBase> Component::GetMiddlewareFactory() {
+  return factory_;
+}
+
+yaml_config::Schema Component::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<MiddlewareComponentBase>(R"(
+type: object
+description: gRPC client middleware for client-side adaptive throttling
+additionalProperties: false
+properties:
+    accepts-multiplier:
+        type: number
+        description: calls are rejected locally once they exceed the accepted ones that many times
+        defaultDescription: 2.0
+    window:
+        type: string
+        description: time the calls and the accepts are counted over
+        defaultDescription: 60s
+)");
+}
+
+}  // namespace ugrpc::client::middlewares::adaptive_throttling
+
+USERVER_NAMESPACE_END
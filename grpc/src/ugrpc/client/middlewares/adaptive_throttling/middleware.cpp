@@ -0,0 +1,67 @@
+#include "middleware.hpp"
+
+#include <grpcpp/support/status.h>
+
+#include <userver/ugrpc/client/exceptions.hpp>
+#include <userver/ugrpc/client/impl/async_methods.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+#include <ugrpc/impl/internal_tag.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client::middlewares::adaptive_throttling {
+
+namespace {
+
+// The server fails the calls because of its overload
+bool IsOverloadStatus(grpc::StatusCode code) {
+  return code == grpc::StatusCode::UNAVAILABLE ||
+         code == grpc::StatusCode::RESOURCE_EXHAUSTED ||
+         code == grpc::StatusCode::DEADLINE_EXCEEDED;
+}
+
+}  // namespace
+
+Middleware::Middleware(
+    std::shared_ptr<congestion_control::ClientThrottler> throttler)
+    : throttler_(std::move(throttler)) {}
+
+void Middleware::Handle(MiddlewareCallContext& context) const {
+  auto& data = context.GetCall().GetData(ugrpc::impl::InternalTag{});
+  if (!throttler_->TryStart()) {
+    data.GetSpan().AddTag("rejected_by_adaptive_throttling", true);
+    throw UnavailableError(
+        data.GetCallName(),
+        grpc::Status{grpc::StatusCode::UNAVAILABLE,
+                     "adaptive throttling of an overloaded server"},
+        std::nullopt, std::nullopt);
+  }
+
+  data.AddFinishHook([throttler = throttler_](grpc::StatusCode code) {
+    if (!IsOverloadStatus(code)) throttler->AccountAccepted();
+  });
+  context.Next();
+}
+
+MiddlewareFactory::MiddlewareFactory(
+    const congestion_control::ClientThrottlerConfig& config)
+    : config_(config) {}
+
+std::shared_ptr<const MiddlewareBase> MiddlewareFactory::GetMiddleware(
+    std::string_view client_name) const {
+  auto throttler =
+      throttlers_.TryEmplace(std::string{client_name}, config_).value;
+  return std::make_shared<Middleware>(std::move(throttler));
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const MiddlewareFactory& factory) {
+  for (const auto& [client_name, throttler] : factory.throttlers_) {
+    writer.ValueWithLabels(*throttler, {"grpc_client", client_name});
+  }
+}
+
+}  // namespace ugrpc::client::middlewares::adaptive_throttling
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <userver/congestion_control/client_throttler.hpp>
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/ugrpc/client/middlewares/base.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client::middlewares::adaptive_throttling {
+
+/// @brief middleware rejecting the calls to an overloaded server locally
+class Middleware final : public MiddlewareBase {
+ public:
+  explicit Middleware(
+      std::shared_ptr<congestion_control::ClientThrottler> throttler);
+
+  void Handle(MiddlewareCallContext& context) const override;
+
+ private:
+  std::shared_ptr<congestion_control::ClientThrottler> throttler_;
+};
+
+/// @cond
+class MiddlewareFactory final : public MiddlewareFactoryBase {
+ public:
+  explicit MiddlewareFactory(
+      const congestion_control::ClientThrottlerConfig& config);
+
+  std::shared_ptr<const MiddlewareBase> GetMiddleware(
+      std::string_view client_name) const override;
+
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const MiddlewareFactory& factory);
+
+ private:
+  const congestion_control::ClientThrottlerConfig config_;
+  // The clients with the same name share the throttler
+  mutable rcu::RcuMap<std::string, congestion_control::ClientThrottler>
+      throttlers_;
+};
+/// @endcond
+
+}  // namespace ugrpc::client::middlewares::adaptive_throttling
+
+USERVER_NAMESPACE_END
@@ -1,21 +1,71 @@
 #include <userver/ugrpc/client/queue_holder.hpp>
 
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
 #include <userver/ugrpc/impl/queue_runner.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::client {
 
-struct QueueHolder::Impl final {
+namespace {
+
+struct QueueSubHolder final {
+  explicit QueueSubHolder(std::vector<std::size_t> cpus)
+      : queue_runner(queue, std::move(cpus)) {}
+
   grpc::CompletionQueue queue;
-  ugrpc::impl::QueueRunner queue_runner{queue};
+  ugrpc::impl::QueueRunner queue_runner;
+};
+
+utils::FixedArray<QueueSubHolder> MakeQueues(std::size_t num,
+                                             bool pin_threads) {
+  num = ugrpc::impl::ResolveQueueCount(num);
+  auto cpus = pin_threads ? ugrpc::impl::DistributeCpus(num)
+                          : std::vector<std::vector<std::size_t>>(num);
+  return utils::GenerateFixedArray(num, [&](std::size_t i) {
+    return QueueSubHolder(std::move(cpus[i]));
+  });
+}
+
+}  // namespace
+
+struct QueueHolder::Impl final {
+  Impl(std::size_t num, bool pin_threads)
+      : queue(MakeQueues(num, pin_threads)) {
+    for (auto& subholder : queue) queues.queues.push_back(&subholder.queue);
+  }
+
+  utils::FixedArray<QueueSubHolder> queue;
+  ugrpc::impl::CompletionQueues queues;
 };
 
-QueueHolder::QueueHolder() = default;
+QueueHolder::QueueHolder() : QueueHolder(1, false) {}
+
+QueueHolder::QueueHolder(std::size_t num, bool pin_threads)
+    : impl_(num, pin_threads) {}
 
 QueueHolder::~QueueHolder() = default;
 
-grpc::CompletionQueue& QueueHolder::GetQueue() { return impl_->queue; }
+grpc::CompletionQueue& QueueHolder::GetQueue() {
+  return *impl_->queues.queues[0];
+}
+
+const ugrpc::impl::CompletionQueues& QueueHolder::GetQueues() const {
+  return impl_->queues;
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const QueueHolder& holder) {
+  for (std::size_t i = 0; i < holder.impl_->queue.size(); ++i) {
+    writer.ValueWithLabels(holder.impl_->queue[i].queue_runner.GetStatistics(),
+                           {"grpc_queue", std::to_string(i)});
+  }
+}
 
 }  // namespace ugrpc::client
 
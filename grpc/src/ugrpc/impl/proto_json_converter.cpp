@@ -0,0 +1,668 @@
+#include <ugrpc/impl/proto_json_converter.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_set>
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include <userver/crypto/base64.hpp>
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/from_string.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::impl {
+
+namespace {
+
+using google::protobuf::Descriptor;
+using google::protobuf::EnumDescriptor;
+using google::protobuf::FieldDescriptor;
+using google::protobuf::Message;
+
+// Integers beyond 2^53 are not exactly representable as double
+constexpr double kMaxSafeInteger = 9007199254740992.0;
+
+bool IsWellKnownType(const google::protobuf::FileDescriptor& file) {
+  return std::string_view{file.name()}.rfind("google/protobuf/", 0) == 0;
+}
+
+bool HasPresence(const FieldDescriptor& field) {
+#if GOOGLE_PROTOBUF_VERSION >= 3012000
+  return field.has_presence();
+#else
+  return !field.is_repeated() &&
+         (field.message_type() || field.containing_oneof() ||
+          field.file()->syntax() ==
+              google::protobuf::FileDescriptor::SYNTAX_PROTO2);
+#endif
+}
+
+// Whether the fields of the message itself are handled by the converter
+bool IsSupported(const Descriptor& descriptor) {
+  if (IsWellKnownType(*descriptor.file())) return false;
+  if (descriptor.extension_range_count() > 0) return false;
+
+  for (int i = 0; i < descriptor.field_count(); ++i) {
+    const auto& field = *descriptor.field(i);
+    if (field.type() == FieldDescriptor::TYPE_GROUP) return false;
+    if (field.enum_type() && IsWellKnownType(*field.enum_type()->file())) {
+      return false;
+    }
+  }
+  return true;
+}
+
+class ConverterCache final {
+ public:
+  const MessageJsonConverter* Find(const Descriptor& descriptor) {
+    {
+      std::shared_lock lock(mutex_);
+      const auto it = converters_.find(&descriptor);
+      if (it != converters_.end()) return it->second.get();
+    }
+
+    std::lock_guard lock(mutex_);
+    return Build(descriptor);
+  }
+
+ private:
+  const MessageJsonConverter* Build(const Descriptor& root) {
+    const auto it = converters_.find(&root);
+    if (it != converters_.end()) return it->second.get();
+
+    // The message is only supported if all the nested ones are
+    std::vector<const Descriptor*> reachable{&root};
+    std::unordered_set<const Descriptor*> visited{&root};
+    for (std::size_t i = 0; i < reachable.size(); ++i) {
+      const auto& descriptor = *reachable[i];
+      if (!IsSupported(descriptor)) {
+        converters_.emplace(&root, nullptr);
+        return nullptr;
+      }
+      for (int j = 0; j < descriptor.field_count(); ++j) {
+        const auto* message_type = descriptor.field(j)->message_type();
+        if (message_type && visited.insert(message_type).second) {
+          reachable.push_back(message_type);
+        }
+      }
+    }
+
+    // The converters are linked after all of them are created, as the types
+    // may be recursive
+    std::vector<MessageJsonConverter*> created;
+    for (const auto* descriptor : reachable) {
+      auto& converter = converters_[descriptor];
+      if (converter) continue;
+      converter = std::make_unique<MessageJsonConverter>();
+      converter->descriptor = descriptor;
+      created.push_back(converter.get());
+    }
+    for (auto* converter : created) Link(*converter);
+
+    return converters_.at(&root).get();
+  }
+
+  void Link(MessageJsonConverter& converter) const {
+    const auto& descriptor = *converter.descriptor;
+    converter.fields.reserve(descriptor.field_count());
+    for (int i = 0; i < descriptor.field_count(); ++i) {
+      const auto& field = *descriptor.field(i);
+      const auto* message_type = field.message_type();
+      converter.fields.push_back(
+          {&field, std::string{field.json_name()}, HasPresence(field),
+           message_type ? converters_.at(message_type).get() : nullptr});
+    }
+
+    std::sort(converter.fields.begin(), converter.fields.end(),
+              [](const FieldJsonConverter& lhs, const FieldJsonConverter& rhs) {
+                return lhs.descriptor->number() < rhs.descriptor->number();
+              });
+
+    for (std::size_t i = 0; i < converter.fields.size(); ++i) {
+      const auto& field = converter.fields[i];
+      converter.field_indices.emplace(field.json_name, i);
+      converter.field_indices.emplace(std::string{field.descriptor->name()}, i);
+    }
+  }
+
+  std::shared_mutex mutex_;
+  // nullptr for the unsupported types
+  std::unordered_map<const Descriptor*, std::unique_ptr<MessageJsonConverter>>
+      converters_;
+};
+
+ConverterCache& GetConverterCache() {
+  static ConverterCache cache;
+  return cache;
+}
+
+class StringSink final {
+ public:
+  explicit StringSink(formats::json::StringBuilder& sb) : sb_(sb) {}
+
+  template <typename Func>
+  void Object(Func&& func) {
+    const formats::json::StringBuilder::ObjectGuard guard{sb_};
+    func();
+  }
+
+  template <typename Func>
+  void Array(Func&& func) {
+    const formats::json::StringBuilder::ArrayGuard guard{sb_};
+    func();
+  }
+
+  void Key(std::string_view key) { sb_.Key(key); }
+
+  void Write(bool value) { sb_.WriteBool(value); }
+  void Write(std::int64_t value) { sb_.WriteInt64(value); }
+  void Write(std::uint64_t value) { sb_.WriteUInt64(value); }
+  void Write(double value) { sb_.WriteDouble(value); }
+  void Write(std::string_view value) { sb_.WriteString(value); }
+
+ private:
+  formats::json::StringBuilder& sb_;
+};
+
+class ValueSink final {
+ public:
+  template <typename Func>
+  void Object(Func&& func) {
+    Nested(formats::common::Type::kObject, func);
+  }
+
+  template <typename Func>
+  void Array(Func&& func) {
+    Nested(formats::common::Type::kArray, func);
+  }
+
+  void Key(std::string_view key) { key_.assign(key); }
+
+  template <typename T>
+  void Write(T value) {
+    Put(formats::json::ValueBuilder{value});
+  }
+
+  formats::json::Value ExtractValue() { return result_.ExtractValue(); }
+
+ private:
+  template <typename Func>
+  void Nested(formats::common::Type type, Func& func) {
+    auto key = std::move(key_);
+    stack_.emplace_back(type);
+    func();
+    auto value = std::move(stack_.back());
+    stack_.pop_back();
+    key_ = std::move(key);
+    Put(std::move(value));
+  }
+
+  void Put(formats::json::ValueBuilder&& value) {
+    if (stack_.empty()) {
+      result_ = std::move(value);
+    } else if (stack_.back().IsObject()) {
+      stack_.back()[std::move(key_)] = std::move(value);
+    } else {
+      stack_.back().PushBack(std::move(value));
+    }
+  }
+
+  std::vector<formats::json::ValueBuilder> stack_;
+  std::string key_;
+  formats::json::ValueBuilder result_;
+};
+
+template <typename Sink>
+void WriteDouble(double value, Sink& sink) {
+  if (std::isnan(value)) {
+    sink.Write(std::string_view{"NaN"});
+  } else if (std::isinf(value)) {
+    sink.Write(std::string_view{value > 0 ? "Infinity" : "-Infinity"});
+  } else if (std::trunc(value) == value && std::abs(value) < kMaxSafeInteger) {
+    // Same as the protobuf, that prints 1.0 as 1
+    sink.Write(static_cast<std::int64_t>(value));
+  } else {
+    sink.Write(value);
+  }
+}
+
+template <typename Sink>
+void WriteFloat(float value, Sink& sink) {
+  if (!std::isfinite(value)) {
+    WriteDouble(value, sink);
+    return;
+  }
+  // The shortest representation of the float, e.g. 0.1 rather than
+  // 0.10000000149011612 of the double
+  const auto shortest = fmt::format(FMT_COMPILE("{}"), value);
+  WriteDouble(std::strtod(shortest.c_str(), nullptr), sink);
+}
+
+template <typename Sink>
+void WriteEnum(const EnumDescriptor& enum_type, int number, Sink& sink) {
+  const auto* value = enum_type.FindValueByNumber(number);
+  if (value) {
+    sink.Write(std::string_view{value->name()});
+  } else {
+    sink.Write(std::int64_t{number});
+  }
+}
+
+template <typename Sink>
+void WriteMessageImpl(const MessageJsonConverter& converter,
+                      const Message& message, Sink& sink);
+
+// `index` is -1 for the singular fields
+template <typename Sink>
+void WriteValue(const FieldJsonConverter& field, const Message& message,
+                int index, Sink& sink) {
+  const auto& reflection = *message.GetReflection();
+  const auto* descriptor = field.descriptor;
+  const bool is_repeated = index >= 0;
+
+  switch (descriptor->cpp_type()) {
+    case FieldDescriptor::CPPTYPE_INT32:
+      sink.Write(std::int64_t{
+          is_repeated ? reflection.GetRepeatedInt32(message, descriptor, index)
+                      : reflection.GetInt32(message, descriptor)});
+      return;
+    case FieldDescriptor::CPPTYPE_INT64:
+      sink.Write(std::string_view{std::to_string(
+          is_repeated ? reflection.GetRepeatedInt64(message, descriptor, index)
+                      : reflection.GetInt64(message, descriptor))});
+      return;
+    case FieldDescriptor::CPPTYPE_UINT32:
+      sink.Write(std::uint64_t{
+          is_repeated ? reflection.GetRepeatedUInt32(message, descriptor, index)
+                      : reflection.GetUInt32(message, descriptor)});
+      return;
+    case FieldDescriptor::CPPTYPE_UINT64:
+      sink.Write(std::string_view{std::to_string(
+          is_repeated
+              ? reflection.GetRepeatedUInt64(message, descriptor, index)
+              : reflection.GetUInt64(message, descriptor))});
+      return;
+    case FieldDescriptor::CPPTYPE_DOUBLE:
+      WriteDouble(
+          is_repeated ? reflection.GetRepeatedDouble(message, descriptor, index)
+                      : reflection.GetDouble(message, descriptor),
+          sink);
+      return;
+    case FieldDescriptor::CPPTYPE_FLOAT:
+      WriteFloat(
+          is_repeated ? reflection.GetRepeatedFloat(message, descriptor, index)
+                      : reflection.GetFloat(message, descriptor),
+          sink);
+      return;
+    case FieldDescriptor::CPPTYPE_BOOL:
+      sink.Write(is_repeated
+                     ? reflection.GetRepeatedBool(message, descriptor, index)
+                     : reflection.GetBool(message, descriptor));
+      return;
+    case FieldDescriptor::CPPTYPE_ENUM: {
+      const auto value =
+          is_repeated ? reflection.GetRepeatedEnumValue(message, descriptor,
+                                                        index)
+                      : reflection.GetEnumValue(message, descriptor);
+      WriteEnum(*descriptor->enum_type(), value, sink);
+      return;
+    }
+    case FieldDescriptor::CPPTYPE_STRING: {
+      std::string scratch;
+      const auto& value =
+          is_repeated ? reflection.GetRepeatedStringReference(
+                            message, descriptor, index, &scratch)
+                      : reflection.GetStringReference(message, descriptor,
+                                                      &scratch);
+      if (descriptor->type() == FieldDescriptor::TYPE_BYTES) {
+        sink.Write(std::string_view{crypto::base64::Base64Encode(value)});
+      } else {
+        sink.Write(std::string_view{value});
+      }
+      return;
+    }
+    case FieldDescriptor::CPPTYPE_MESSAGE: {
+      const auto& value =
+          is_repeated
+              ? reflection.GetRepeatedMessage(message, descriptor, index)
+              : reflection.GetMessage(message, descriptor);
+      WriteMessageImpl(*field.message, value, sink);
+      return;
+    }
+  }
+  UINVARIANT(false, "Unexpected protobuf field type");
+}
+
+std::string MapKeyToString(const Message& entry,
+                           const FieldDescriptor& descriptor) {
+  const auto& reflection = *entry.GetReflection();
+  switch (descriptor.cpp_type()) {
+    case FieldDescriptor::CPPTYPE_INT32:
+      return std::to_string(reflection.GetInt32(entry, &descriptor));
+    case FieldDescriptor::CPPTYPE_INT64:
+      return std::to_string(reflection.GetInt64(entry, &descriptor));
+    case FieldDescriptor::CPPTYPE_UINT32:
+      return std::to_string(reflection.GetUInt32(entry, &descriptor));
+    case FieldDescriptor::CPPTYPE_UINT64:
+      return std::to_string(reflection.GetUInt64(entry, &descriptor));
+    case FieldDescriptor::CPPTYPE_BOOL:
+      return reflection.GetBool(entry, &descriptor) ? "true" : "false";
+    case FieldDescriptor::CPPTYPE_STRING:
+      return reflection.GetString(entry, &descriptor);
+    default:
+      UINVARIANT(false, "Unexpected protobuf map key type");
+  }
+}
+
+template <typename Sink>
+void WriteMessageImpl(const MessageJsonConverter& converter,
+                      const Message& message, Sink& sink) {
+  const auto& reflection = *message.GetReflection();
+  sink.Object([&] {
+    for (const auto& field : converter.fields) {
+      const auto* descriptor = field.descriptor;
+
+      if (descriptor->is_map()) {
+        const auto& entry_converter = *field.message;
+        UASSERT(entry_converter.fields.size() == 2);
+        sink.Key(field.json_name);
+        sink.Object([&] {
+          const int size = reflection.FieldSize(message, descriptor);
+          for (int i = 0; i < size; ++i) {
+            const auto& entry =
+                reflection.GetRepeatedMessage(message, descriptor, i);
+            sink.Key(MapKeyToString(entry,
+                                    *entry_converter.fields[0].descriptor));
+            WriteValue(entry_converter.fields[1], entry, -1, sink);
+          }
+        });
+      } else if (descriptor->is_repeated()) {
+        sink.Key(field.json_name);
+        sink.Array([&] {
+          const int size = reflection.FieldSize(message, descriptor);
+          for (int i = 0; i < size; ++i) {
+            WriteValue(field, message, i, sink);
+          }
+        });
+      } else if (!field.has_presence ||
+                 reflection.HasField(message, descriptor)) {
+        sink.Key(field.json_name);
+        WriteValue(field, message, -1, sink);
+      }
+    }
+  });
+}
+
+[[noreturn]] void ThrowParseError(const FieldDescriptor& field,
+                                  std::string_view what) {
+  throw formats::json::ParseException(
+      fmt::format("Failed to parse field '{}' from JSON: {}",
+                  std::string_view{field.full_name()}, what));
+}
+
+template <typename T>
+T ParseInteger(const formats::json::Value& value) {
+  if (value.IsString()) return utils::FromString<T>(value.As<std::string>());
+  return value.As<T>();
+}
+
+template <typename T>
+T ParseFloating(const formats::json::Value& value) {
+  double result = 0;
+  if (value.IsString()) {
+    const auto str = value.As<std::string>();
+    if (str == "NaN") return std::numeric_limits<T>::quiet_NaN();
+    if (str == "Infinity") return std::numeric_limits<T>::infinity();
+    if (str == "-Infinity") return -std::numeric_limits<T>::infinity();
+    result = utils::FromString<double>(str);
+  } else {
+    result = value.As<double>();
+  }
+
+  if constexpr (std::is_same_v<T, float>) {
+    if (std::abs(result) > std::numeric_limits<float>::max()) {
+      throw std::out_of_range("float value is out of range");
+    }
+  }
+  return static_cast<T>(result);
+}
+
+int ParseEnum(const EnumDescriptor& enum_type,
+              const formats::json::Value& value) {
+  if (!value.IsString()) return value.As<int>();
+
+  const auto name = value.As<std::string>();
+  const auto* enum_value = enum_type.FindValueByName(name);
+  if (!enum_value) {
+    throw std::invalid_argument(fmt::format("unknown enum value '{}'", name));
+  }
+  return enum_value->number();
+}
+
+std::string ParseBytes(const std::string& encoded) {
+#ifndef USERVER_NO_CRYPTOPP_BASE64_URL
+  // The protobuf accepts both the standard and the URL alphabets
+  if (encoded.find_first_of("-_") != std::string::npos) {
+    return crypto::base64::Base64UrlDecode(encoded);
+  }
+#endif
+  return crypto::base64::Base64Decode(encoded);
+}
+
+void ParseMapKey(const FieldDescriptor& descriptor, const std::string& key,
+                 Message& entry) {
+  const auto& reflection = *entry.GetReflection();
+  switch (descriptor.cpp_type()) {
+    case FieldDescriptor::CPPTYPE_INT32:
+      reflection.SetInt32(&entry, &descriptor,
+                          utils::FromString<std::int32_t>(key));
+      return;
+    case FieldDescriptor::CPPTYPE_INT64:
+      reflection.SetInt64(&entry, &descriptor,
+                          utils::FromString<std::int64_t>(key));
+      return;
+    case FieldDescriptor::CPPTYPE_UINT32:
+      reflection.SetUInt32(&entry, &descriptor,
+                           utils::FromString<std::uint32_t>(key));
+      return;
+    case FieldDescriptor::CPPTYPE_UINT64:
+      reflection.SetUInt64(&entry, &descriptor,
+                           utils::FromString<std::uint64_t>(key));
+      return;
+    case FieldDescriptor::CPPTYPE_BOOL:
+      if (key != "true" && key != "false") {
+        throw std::invalid_argument(
+            fmt::format("invalid bool map key '{}'", key));
+      }
+      reflection.SetBool(&entry, &descriptor, key == "true");
+      return;
+    case FieldDescriptor::CPPTYPE_STRING:
+      reflection.SetString(&entry, &descriptor, key);
+      return;
+    default:
+      UINVARIANT(false, "Unexpected protobuf map key type");
+  }
+}
+
+void ParseMessageImpl(const MessageJsonConverter& converter,
+                      const formats::json::Value& json, Message& message);
+
+// Adds a new element to the repeated fields
+void ParseValue(const FieldJsonConverter& field,
+                const formats::json::Value& value, Message& message) {
+  const auto& reflection = *message.GetReflection();
+  const auto* descriptor = field.descriptor;
+  const bool add = descriptor->is_repeated();
+
+  switch (descriptor->cpp_type()) {
+    case FieldDescriptor::CPPTYPE_INT32: {
+      const auto parsed = ParseInteger<std::int32_t>(value);
+      add ? reflection.AddInt32(&message, descriptor, parsed)
+          : reflection.SetInt32(&message, descriptor, parsed);
+      return;
+    }
+    case FieldDescriptor::CPPTYPE_INT64: {
+      const auto parsed = ParseInteger<std::int64_t>(value);
+      add ? reflection.AddInt64(&message, descriptor, parsed)
+          : reflection.SetInt64(&message, descriptor, parsed);
+      return;
+    }
+    case FieldDescriptor::CPPTYPE_UINT32: {
+      const auto parsed = ParseInteger<std::uint32_t>(value);
+      add ? reflection.AddUInt32(&message, descriptor, parsed)
+          : reflection.SetUInt32(&message, descriptor, parsed);
+      return;
+    }
+    case FieldDescriptor::CPPTYPE_UINT64: {
+      const auto parsed = ParseInteger<std::uint64_t>(value);
+      add ? reflection.AddUInt64(&message, descriptor, parsed)
+          : reflection.SetUInt64(&message, descriptor, parsed);
+      return;
+    }
+    case FieldDescriptor::CPPTYPE_DOUBLE: {
+      const auto parsed = ParseFloating<double>(value);
+      add ? reflection.AddDouble(&message, descriptor, parsed)
+          : reflection.SetDouble(&message, descriptor, parsed);
+      return;
+    }
+    case FieldDescriptor::CPPTYPE_FLOAT: {
+      const auto parsed = ParseFloating<float>(value);
+      add ? reflection.AddFloat(&message, descriptor, parsed)
+          : reflection.SetFloat(&message, descriptor, parsed);
+      return;
+    }
+    case FieldDescriptor::CPPTYPE_BOOL: {
+      const auto parsed = value.As<bool>();
+      add ? reflection.AddBool(&message, descriptor, parsed)
+          : reflection.SetBool(&message, descriptor, parsed);
+      return;
+    }
+    case FieldDescriptor::CPPTYPE_ENUM: {
+      const auto parsed = ParseEnum(*descriptor->enum_type(), value);
+      add ? reflection.AddEnumValue(&message, descriptor, parsed)
+          : reflection.SetEnumValue(&message, descriptor, parsed);
+      return;
+    }
+    case FieldDescriptor::CPPTYPE_STRING: {
+      auto parsed = value.As<std::string>();
+      if (descriptor->type() == FieldDescriptor::TYPE_BYTES) {
+        parsed = ParseBytes(parsed);
+      }
+      add ? reflection.AddString(&message, descriptor, std::move(parsed))
+          : reflection.SetString(&message, descriptor, std::move(parsed));
+      return;
+    }
+    case FieldDescriptor::CPPTYPE_MESSAGE:
+      ParseMessageImpl(*field.message, value,
+                       add ? *reflection.AddMessage(&message, descriptor)
+                           : *reflection.MutableMessage(&message, descriptor));
+      return;
+  }
+  UINVARIANT(false, "Unexpected protobuf field type");
+}
+
+void ParseField(const FieldJsonConverter& field,
+                const formats::json::Value& value, Message& message) {
+  const auto& reflection = *message.GetReflection();
+  const auto* descriptor = field.descriptor;
+
+  if (value.IsNull()) {
+    reflection.ClearField(&message, descriptor);
+    return;
+  }
+
+  const auto* oneof = descriptor->containing_oneof();
+  if (oneof && reflection.HasOneof(message, oneof)) {
+    ThrowParseError(*descriptor, "another field of the oneof is already set");
+  }
+
+  if (descriptor->is_map()) {
+    const auto& entry_converter = *field.message;
+    UASSERT(entry_converter.fields.size() == 2);
+    value.CheckObject();
+    for (auto it = value.begin(); it != value.end(); ++it) {
+      auto& entry = *reflection.AddMessage(&message, descriptor);
+      ParseMapKey(*entry_converter.fields[0].descriptor, it.GetName(), entry);
+      ParseValue(entry_converter.fields[1], *it, entry);
+    }
+  } else if (descriptor->is_repeated()) {
+    value.CheckArrayOrNull();
+    for (const auto& item : value) ParseValue(field, item, message);
+  } else {
+    ParseValue(field, value, message);
+  }
+}
+
+void ParseMessageImpl(const MessageJsonConverter& converter,
+                      const formats::json::Value& json, Message& message) {
+  if (!json.IsObject()) {
+    throw formats::json::ParseException(
+        fmt::format("Failed to parse '{}' from JSON: expected an object",
+                    std::string_view{converter.descriptor->full_name()}));
+  }
+
+  for (auto it = json.begin(); it != json.end(); ++it) {
+    const auto name = it.GetName();
+    const auto* field = converter.FindField(name);
+    if (!field) {
+      throw formats::json::ParseException(
+          fmt::format("Failed to parse '{}' from JSON: unknown field '{}'",
+                      std::string_view{converter.descriptor->full_name()},
+                      name));
+    }
+
+    try {
+      ParseField(*field, *it, message);
+    } catch (const formats::json::ParseException&) {
+      throw;
+    } catch (const std::exception& ex) {
+      ThrowParseError(*field->descriptor, ex.what());
+    }
+  }
+}
+
+}  // namespace
+
+const FieldJsonConverter* MessageJsonConverter::FindField(
+    const std::string& name) const {
+  const auto it = field_indices.find(name);
+  return it == field_indices.end() ? nullptr : &fields[it->second];
+}
+
+const MessageJsonConverter* FindJsonConverter(const Descriptor& descriptor) {
+  return GetConverterCache().Find(descriptor);
+}
+
+void WriteMessage(const MessageJsonConverter& converter, const Message& message,
+                  formats::json::StringBuilder& sb) {
+  StringSink sink{sb};
+  WriteMessageImpl(converter, message, sink);
+}
+
+formats::json::Value WriteMessage(const MessageJsonConverter& converter,
+                                  const Message& message) {
+  ValueSink sink;
+  WriteMessageImpl(converter, message, sink);
+  return sink.ExtractValue();
+}
+
+void ParseMessage(const MessageJsonConverter& converter,
+                  const formats::json::Value& json, Message& message) {
+  ParseMessageImpl(converter, json, message);
+}
+
+}  // namespace ugrpc::impl
+
+USERVER_NAMESPACE_END
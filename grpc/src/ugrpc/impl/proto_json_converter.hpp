@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/message.h>
+
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/formats/json/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::impl {
+
+struct MessageJsonConverter;
+
+struct FieldJsonConverter final {
+  const google::protobuf::FieldDescriptor* descriptor{nullptr};
+  std::string json_name;
+  bool has_presence{false};
+  // Converter of the message or the map entry type, nullptr for scalars
+  const MessageJsonConverter* message{nullptr};
+};
+
+// Reflection data of a message type, prepared once for all the conversions.
+// The output matches google::protobuf::util::MessageToJsonString with the
+// fields without presence always printed.
+struct MessageJsonConverter final {
+  const FieldJsonConverter* FindField(const std::string& name) const;
+
+  const google::protobuf::Descriptor* descriptor{nullptr};
+  // Sorted by field number
+  std::vector<FieldJsonConverter> fields;
+  // Both JSON and original field names
+  std::unordered_map<std::string, std::size_t> field_indices;
+};
+
+// Returns nullptr for the messages that use the well-known types, groups or
+// extensions, those are left to google::protobuf::util
+const MessageJsonConverter* FindJsonConverter(
+    const google::protobuf::Descriptor& descriptor);
+
+void WriteMessage(const MessageJsonConverter& converter,
+                  const google::protobuf::Message& message,
+                  formats::json::StringBuilder& sb);
+
+formats::json::Value WriteMessage(const MessageJsonConverter& converter,
+                                  const google::protobuf::Message& message);
+
+// @throws formats::json::ParseException
+void ParseMessage(const MessageJsonConverter& converter,
+                  const formats::json::Value& json,
+                  google::protobuf::Message& message);
+
+}  // namespace ugrpc::impl
+
+USERVER_NAMESPACE_END
@@ -1,8 +1,17 @@
 #include <userver/ugrpc/impl/queue_runner.hpp>
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <thread>
 
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/writer.hpp>
 #include <userver/utils/thread_name.hpp>
 
 #include <userver/ugrpc/impl/async_method_invocation.hpp>
@@ -13,9 +22,43 @@ namespace ugrpc::impl {
 
 namespace {
 
+constexpr std::array<double, 7> kNotifyTimingsBoundsUs{1,  2,  5,  10,
+                                                       20, 50, 100};
+
+std::vector<std::size_t> GetAvailableCpus() {
+  std::vector<std::size_t> cpus;
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (::sched_getaffinity(0, sizeof(set), &set) == 0) {
+    for (std::size_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+    }
+  }
+#endif
+  return cpus;
+}
+
+void PinCurrentThread(const std::vector<std::size_t>& cpus) noexcept {
+#ifdef __linux__
+  if (cpus.empty()) return;
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (const auto cpu : cpus) CPU_SET(cpu, &set);
+  if (::sched_setaffinity(0, sizeof(set), &set) != 0) {
+    LOG_WARNING() << "Failed to pin the gRPC completion queue thread";
+  }
+#else
+  (void)cpus;
+#endif
+}
+
 void ProcessQueue(grpc::CompletionQueue& queue,
+                  const std::vector<std::size_t>& cpus,
+                  QueueStatistics& statistics,
                   engine::SingleUseEvent& completion) noexcept {
   utils::SetCurrentThreadName("grpc-queue");
+  PinCurrentThread(cpus);
 
   void* tag = nullptr;
   bool ok = false;
@@ -23,7 +66,14 @@ void ProcessQueue(grpc::CompletionQueue& queue,
   while (queue.Next(&tag, &ok)) {
     auto* call = static_cast<EventBase*>(tag);
     UASSERT(call != nullptr);
+
+    const auto start = std::chrono::steady_clock::now();
     call->Notify(ok);
+    const auto duration = std::chrono::steady_clock::now() - start;
+
+    ++statistics.events;
+    statistics.notify_timings.Account(
+        std::chrono::duration<double, std::micro>(duration).count());
   }
 
   completion.Send();
@@ -31,8 +81,20 @@ void ProcessQueue(grpc::CompletionQueue& queue,
 
 }  // namespace
 
-QueueRunner::QueueRunner(grpc::CompletionQueue& queue) : queue_(queue) {
-  std::thread([this] { ProcessQueue(queue_, completion_); }).detach();
+QueueStatistics::QueueStatistics() : notify_timings(kNotifyTimingsBoundsUs) {}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const QueueStatistics& stats) {
+  writer["events"] = stats.events;
+  writer["notify-timings"] = stats.notify_timings;
+}
+
+QueueRunner::QueueRunner(grpc::CompletionQueue& queue,
+                         std::vector<std::size_t> cpus)
+    : queue_(queue) {
+  std::thread([this, cpus = std::move(cpus)] {
+    ProcessQueue(queue_, cpus, statistics_, completion_);
+  }).detach();
 }
 
 QueueRunner::~QueueRunner() {
@@ -40,6 +102,31 @@ QueueRunner::~QueueRunner() {
   completion_.WaitNonCancellable();
 }
 
+std::size_t ResolveQueueCount(std::size_t configured_count) {
+  if (configured_count != 0) return configured_count;
+  auto cpu_count = GetAvailableCpus().size();
+  if (cpu_count == 0) cpu_count = std::thread::hardware_concurrency();
+  // ~2 times less than worker threads, see ServerConfig::completion_queue_num
+  return std::max(cpu_count / 2, std::size_t{1});
+}
+
+std::vector<std::vector<std::size_t>> DistributeCpus(std::size_t queue_count) {
+  UASSERT(queue_count != 0);
+  std::vector<std::vector<std::size_t>> result(queue_count);
+  const auto cpus = GetAvailableCpus();
+  if (cpus.empty()) return result;
+
+  for (std::size_t i = 0; i < queue_count; ++i) {
+    // with more queues than CPUs each queue gets a single CPU
+    auto begin = i * cpus.size() / queue_count;
+    const auto end = std::max((i + 1) * cpus.size() / queue_count, begin + 1);
+    begin = std::min(begin, cpus.size() - 1);
+    result[i].assign(cpus.begin() + begin,
+                     cpus.begin() + std::min(end, cpus.size()));
+  }
+  return result;
+}
+
 }  // namespace ugrpc::impl
 
 USERVER_NAMESPACE_END
@@ -4,7 +4,6 @@
 
 #include <userver/logging/log.hpp>
 #include <userver/utils/enumerate.hpp>
-#include <userver/utils/statistics/striped_rate_counter.hpp>
 #include <userver/utils/statistics/writer.hpp>
 #include <userver/utils/underlying_value.hpp>
 
@@ -70,7 +69,7 @@ void MethodStatistics::AccountStatus(grpc::StatusCode code) noexcept {
 
 void MethodStatistics::AccountTiming(
     std::chrono::milliseconds timing) noexcept {
-  timings_.GetCurrentCounter().Account(timing.count());
+  timings_.Account(timing);
 }
 
 void MethodStatistics::AccountNetworkError() noexcept { ++network_errors_; }
@@ -87,6 +86,11 @@ void MethodStatistics::AccountDeadlinePropagated() noexcept {
 
 void MethodStatistics::AccountCancelled() noexcept { ++cancelled_; }
 
+void MethodStatistics::AccountWriteBatch(std::size_t batch_size) noexcept {
+  ++write_batches_;
+  write_batch_sizes_.GetCurrentCounter().Account(batch_size);
+}
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const MethodStatistics& stats) {
   if (stats.domain_ == StatisticsDomain::kClient && !stats.started_.Load()) {
@@ -161,6 +165,11 @@ void DumpMetric(utils::statistics::Writer& writer,
       AsRateAndGauge{stats.deadline_updated_.Load()};
   writer["cancelled-by-deadline-propagation"] =
       AsRateAndGauge{deadline_cancelled_value};
+
+  // Only the streams with WriteBatchingConfig report the batches
+  if (stats.write_batches_.Load()) {
+    writer["write-batch-size"] = stats.write_batch_sizes_;
+  }
 }
 
 std::uint64_t MethodStatistics::GetStarted() const noexcept {
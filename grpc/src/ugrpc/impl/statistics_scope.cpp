@@ -24,6 +24,10 @@ void RpcStatisticsScope::OnNetworkError() {
   finish_kind_ = std::max(finish_kind_, FinishKind::kNetworkError);
 }
 
+void RpcStatisticsScope::OnWriteBatch(std::size_t batch_size) noexcept {
+  statistics_->AccountWriteBatch(batch_size);
+}
+
 void RpcStatisticsScope::OnCancelledByDeadlinePropagation() {
   finish_kind_ = std::max(finish_kind_, FinishKind::kDeadlinePropagation);
 }
@@ -0,0 +1,49 @@
+#include <userver/ugrpc/impl/write_batcher.hpp>
+
+#include <userver/ugrpc/impl/statistics_scope.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::impl {
+
+void WriteBatcher::SetConfig(const WriteBatchingConfig& config) noexcept {
+  config_ = config;
+}
+
+grpc::WriteOptions WriteBatcher::PrepareWrite(RpcStatisticsScope& statistics) {
+  grpc::WriteOptions options{};
+  if (config_.max_batch_size <= 1) return options;
+
+  const auto now = std::chrono::steady_clock::now();
+  if (batch_size_ == 0) batch_start_ = now;
+  ++batch_size_;
+
+  if (batch_size_ >= config_.max_batch_size ||
+      now - batch_start_ >= config_.max_delay) {
+    // This write sends the whole batch
+    statistics.OnWriteBatch(batch_size_);
+    batch_size_ = 0;
+  } else {
+    options.set_buffer_hint();
+  }
+  return options;
+}
+
+grpc::WriteOptions WriteBatcher::PrepareLastWrite(
+    RpcStatisticsScope& statistics) noexcept {
+  if (config_.max_batch_size > 1) {
+    ++batch_size_;
+    OnFlush(statistics);
+  }
+  return {};
+}
+
+void WriteBatcher::OnFlush(RpcStatisticsScope& statistics) noexcept {
+  if (batch_size_ == 0) return;
+  statistics.OnWriteBatch(batch_size_);
+  batch_size_ = 0;
+}
+
+}  // namespace ugrpc::impl
+
+USERVER_NAMESPACE_END
@@ -5,6 +5,8 @@
 
 #include <userver/utils/assert.hpp>
 
+#include <ugrpc/impl/proto_json_converter.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc {
@@ -23,14 +25,52 @@ const google::protobuf::util::JsonPrintOptions kOptions = []() {
 }  // namespace
 
 formats::json::Value MessageToJson(const google::protobuf::Message& message) {
+  const auto* converter = impl::FindJsonConverter(*message.GetDescriptor());
+  if (converter) return impl::WriteMessage(*converter, message);
+
   return formats::json::FromString(ToJsonString(message));
 }
 
+void MessageToJson(const google::protobuf::Message& message,
+                   formats::json::StringBuilder& sb) {
+  const auto* converter = impl::FindJsonConverter(*message.GetDescriptor());
+  if (converter) {
+    impl::WriteMessage(*converter, message, sb);
+  } else {
+    sb.WriteRawString(ToJsonString(message));
+  }
+}
+
+void JsonToMessage(const formats::json::Value& json,
+                   google::protobuf::Message& message) {
+  message.Clear();
+
+  const auto* converter = impl::FindJsonConverter(*message.GetDescriptor());
+  if (converter) {
+    impl::ParseMessage(*converter, json, message);
+    return;
+  }
+
+  const auto status = google::protobuf::util::JsonStringToMessage(
+      formats::json::ToString(json), &message);
+  if (!status.ok()) {
+    throw formats::json::ParseException(
+        "Cannot convert JSON to protobuf: " + status.ToString());
+  }
+}
+
 std::string ToString(const google::protobuf::Message& message) {
   return message.DebugString();
 }
 
 std::string ToJsonString(const google::protobuf::Message& message) {
+  const auto* converter = impl::FindJsonConverter(*message.GetDescriptor());
+  if (converter) {
+    formats::json::StringBuilder sb;
+    impl::WriteMessage(*converter, message, sb);
+    return sb.GetString();
+  }
+
   grpc::string result{};
 
   auto status =
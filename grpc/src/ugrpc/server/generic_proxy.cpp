@@ -0,0 +1,132 @@
+#include <userver/ugrpc/server/generic_proxy.hpp>
+
+#include <chrono>
+
+#include <grpcpp/server_context.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/ugrpc/client/exceptions.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server {
+
+namespace {
+
+using ClientStream =
+    client::BidirectionalStream<grpc::ByteBuffer, grpc::ByteBuffer>;
+
+grpc::string ToGrpcString(grpc::string_ref str) {
+  return {str.data(), str.size()};
+}
+
+void ProxyRequestMetadata(const grpc::ServerContext& server_context,
+                          grpc::ClientContext& client_context) {
+  for (const auto& [key, value] : server_context.client_metadata()) {
+    client_context.AddMetadata(ToGrpcString(key), ToGrpcString(value));
+  }
+
+  const auto kNoDeadline = std::chrono::system_clock::time_point::max();
+  if (client_context.deadline() == kNoDeadline &&
+      server_context.deadline() != kNoDeadline) {
+    client_context.set_deadline(server_context.deadline());
+  }
+}
+
+void ProxyInitialMetadata(const grpc::ClientContext& client_context,
+                          grpc::ServerContext& server_context) {
+  for (const auto& [key, value] : client_context.GetServerInitialMetadata()) {
+    server_context.AddInitialMetadata(ToGrpcString(key), ToGrpcString(value));
+  }
+}
+
+void ProxyTrailingMetadata(const grpc::ClientContext& client_context,
+                           grpc::ServerContext& server_context) {
+  for (const auto& [key, value] : client_context.GetServerTrailingMetadata()) {
+    server_context.AddTrailingMetadata(ToGrpcString(key), ToGrpcString(value));
+  }
+}
+
+void ProxyRequests(GenericServiceBase::Call& call, ClientStream& stream) {
+  grpc::ByteBuffer request;
+  while (call.Read(request)) {
+    // The downstream RPC is finished, its status is returned by 'Read'
+    if (!stream.Write(request)) return;
+  }
+
+  // Cancelled once the downstream RPC is finished, the reads are not done yet
+  if (engine::current_task::ShouldCancel()) return;
+
+  [[maybe_unused]] const bool writes_done = stream.WritesDone();
+}
+
+void ProxyResponses(GenericServiceBase::Call& call, ClientStream& stream,
+                    engine::TaskWithResult<void>& requests_task) {
+  bool is_initial_metadata_proxied = false;
+  const auto proxy_initial_metadata = [&] {
+    if (is_initial_metadata_proxied) return;
+    ProxyInitialMetadata(stream.GetContext(), call.GetContext());
+    is_initial_metadata_proxied = true;
+  };
+
+  try {
+    grpc::ByteBuffer response;
+    while (stream.Read(response)) {
+      proxy_initial_metadata();
+      call.Write(response);
+    }
+    if (engine::current_task::ShouldCancel()) {
+      throw client::RpcCancelledError(stream.GetCallName(), "Read");
+    }
+  } catch (const client::ErrorWithStatus& ex) {
+    requests_task.RequestCancel();
+    proxy_initial_metadata();
+    ProxyTrailingMetadata(stream.GetContext(), call.GetContext());
+    call.FinishWithError(ex.GetStatus());
+    return;
+  } catch (const client::RpcError& ex) {
+    requests_task.RequestCancel();
+    LOG_WARNING() << "Failed to proxy the RPC: " << ex;
+    call.FinishWithError(grpc::Status{grpc::StatusCode::UNAVAILABLE,
+                                      "Failed to proxy the RPC"});
+    return;
+  }
+
+  requests_task.RequestCancel();
+  proxy_initial_metadata();
+  ProxyTrailingMetadata(stream.GetContext(), call.GetContext());
+  call.Finish();
+}
+
+}  // namespace
+
+void ProxyGenericCall(GenericServiceBase::Call& call,
+                      const client::GenericClient& client,
+                      std::unique_ptr<grpc::ClientContext> context,
+                      const client::GenericOptions& options) {
+  UASSERT(context);
+  ProxyRequestMetadata(call.GetContext(), *context);
+
+  auto stream = client.BidirectionalStream(call.GetCallName(),
+                                           std::move(context), options);
+
+  auto requests_task = engine::CriticalAsyncNoSpan(
+      [&call, &stream] { ProxyRequests(call, stream); });
+
+  try {
+    ProxyResponses(call, stream, requests_task);
+  } catch (...) {
+    // Completes the 'Read' that 'requests_task' may be waiting for
+    call.GetContext().TryCancel();
+    throw;
+  }
+
+  requests_task.SyncCancel();
+}
+
+}  // namespace ugrpc::server
+
+USERVER_NAMESPACE_END
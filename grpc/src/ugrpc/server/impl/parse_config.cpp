@@ -17,6 +17,8 @@ namespace {
 
 constexpr std::string_view kTaskProcessorKey = "task-processor";
 constexpr std::string_view kMiddlewaresKey = "middlewares";
+constexpr std::string_view kRequestArenaKey =
+    "request-arena-max-start-block-size";
 
 template <typename ParserFunc>
 auto ParseOptional(const yaml_config::YamlConfig& service_field,
@@ -53,6 +55,12 @@ std::vector<std::string> ParseMiddlewares(
   return field.As<std::vector<std::string>>();
 }
 
+std::size_t ParseRequestArenaSize(
+    const yaml_config::YamlConfig& field,
+    const components::ComponentContext& /*context*/) {
+  return field.As<std::size_t>(0);
+}
+
 Middlewares FindMiddlewares(const std::vector<std::string>& names,
                             const components::ComponentContext& context) {
   return utils::AsContainer<Middlewares>(
@@ -72,6 +80,8 @@ ServiceDefaults ParseServiceDefaults(
                                        ParseTaskProcessor),
       /*middleware_names=*/
       ParseOptional(value[kMiddlewaresKey], context, ParseMiddlewares),
+      /*request_arena_max_start_block_size=*/
+      ParseOptional(value[kRequestArenaKey], context, ParseRequestArenaSize),
   };
 }
 
@@ -88,6 +98,10 @@ server::ServiceConfig ParseServiceConfig(
           MergeField(value[kMiddlewaresKey], defaults.middleware_names, context,
                      ParseMiddlewares),
           context),
+      /*request_arena_max_start_block_size=*/
+      MergeField(value[kRequestArenaKey],
+                 defaults.request_arena_max_start_block_size, context,
+                 ParseRequestArenaSize),
   };
 }
 
@@ -98,6 +112,8 @@ ServerConfig ParseServerConfig(const yaml_config::YamlConfig& value,
       value["unix-socket-path"].As<std::optional<std::string>>();
   config.port = value["port"].As<std::optional<int>>();
   config.completion_queue_num = value["completion-queue-count"].As<int>(2);
+  config.pin_completion_queues =
+      value["pin-completion-queues"].As<bool>(false);
   config.channel_args =
       value["channel-args"].As<decltype(config.channel_args)>({});
   config.native_log_level =
@@ -1,12 +1,15 @@
 #include <userver/ugrpc/server/impl/queue_holder.hpp>
 
+#include <string>
 #include <utility>
+#include <vector>
 
 #include <grpcpp/server_builder.h>
 
 #include <userver/ugrpc/impl/queue_runner.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -15,20 +18,29 @@ namespace ugrpc::server::impl {
 namespace {
 
 struct QueueSubHolder final {
-  explicit QueueSubHolder(std::unique_ptr<grpc::ServerCompletionQueue> queue)
-      : queue(std::move(queue)) {}
+  QueueSubHolder(std::unique_ptr<grpc::ServerCompletionQueue> queue,
+                 std::vector<std::size_t> cpus)
+      : queue(std::move(queue)), queue_runner(*this->queue, std::move(cpus)) {}
 
   std::unique_ptr<grpc::ServerCompletionQueue> queue;
-  ugrpc::impl::QueueRunner queue_runner{*queue};
+  ugrpc::impl::QueueRunner queue_runner;
 };
 
+utils::FixedArray<QueueSubHolder> MakeQueues(
+    std::size_t num, bool pin_threads, grpc::ServerBuilder& server_builder) {
+  auto cpus = pin_threads ? ugrpc::impl::DistributeCpus(num)
+                          : std::vector<std::vector<std::size_t>>(num);
+  return utils::GenerateFixedArray(num, [&](std::size_t i) {
+    return QueueSubHolder(server_builder.AddCompletionQueue(),
+                          std::move(cpus[i]));
+  });
+}
+
 }  // namespace
 
 struct QueueHolder::Impl final {
-  explicit Impl(std::size_t num, grpc::ServerBuilder& server_builder)
-      : queue(utils::GenerateFixedArray(num, [&server_builder](size_t) {
-          return QueueSubHolder(server_builder.AddCompletionQueue());
-        })) {
+  Impl(std::size_t num, bool pin_threads, grpc::ServerBuilder& server_builder)
+      : queue(MakeQueues(num, pin_threads, server_builder)) {
     for (auto& subholder : queue)
       queues.queues.push_back(subholder.queue.get());
   }
@@ -37,8 +49,9 @@ struct QueueHolder::Impl final {
   ugrpc::impl::CompletionQueues queues;
 };
 
-QueueHolder::QueueHolder(std::size_t num, grpc::ServerBuilder& server_builder)
-    : impl_(num, server_builder) {}
+QueueHolder::QueueHolder(std::size_t num, bool pin_threads,
+                         grpc::ServerBuilder& server_builder)
+    : impl_(num, pin_threads, server_builder) {}
 
 QueueHolder::~QueueHolder() = default;
 
@@ -52,6 +65,13 @@ const ugrpc::impl::CompletionQueues& QueueHolder::GetQueues() {
   return impl_->queues;
 }
 
+void DumpMetric(utils::statistics::Writer& writer, const QueueHolder& holder) {
+  for (std::size_t i = 0; i < holder.impl_->queue.size(); ++i) {
+    writer.ValueWithLabels(holder.impl_->queue[i].queue_runner.GetStatistics(),
+                           {"grpc_queue", std::to_string(i)});
+  }
+}
+
 }  // namespace ugrpc::server::impl
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -15,6 +16,7 @@ struct ServiceDefaults final {
   // using boost::optional to easily generalize to references
   boost::optional<engine::TaskProcessor&> task_processor;
   boost::optional<std::vector<std::string>> middleware_names;
+  boost::optional<std::size_t> request_arena_max_start_block_size;
 };
 
 }  // namespace ugrpc::server::impl
@@ -1,6 +1,6 @@
 #include "middleware.hpp"
 
-#include <userver/baggage/baggage.hpp>
+#include <userver/baggage/baggage_manager.hpp>
 #include <userver/baggage/baggage_settings.hpp>
 #include <userver/utils/algo.hpp>
 
@@ -17,23 +17,15 @@ void Middleware::Handle(MiddlewareCallContext& context) const {
   const auto& dynamic_config = context.GetInitialDynamicConfig();
 
   if (dynamic_config[USERVER_NAMESPACE::baggage::kBaggageEnabled]) {
-    const auto& baggage_settings =
-        dynamic_config[USERVER_NAMESPACE::baggage::kBaggageSettings];
-
     const auto& server_context = call.GetContext();
-
     const auto* baggage_header = utils::FindOrNullptr(
         server_context.client_metadata(), ugrpc::impl::kXBaggage);
 
     if (baggage_header) {
       LOG_DEBUG() << "Got baggage header: " << *baggage_header;
-
-      auto baggage = USERVER_NAMESPACE::baggage::TryMakeBaggage(
-          ugrpc::impl::ToString(*baggage_header),
-          baggage_settings.allowed_keys);
-      if (baggage) {
-        USERVER_NAMESPACE::baggage::kInheritedBaggage.Set(std::move(*baggage));
-      }
+      // Parsed only if an outgoing request needs it
+      USERVER_NAMESPACE::baggage::BaggageManager::SetRawBaggage(
+          ugrpc::impl::ToString(*baggage_header), dynamic_config);
     }
   }
 
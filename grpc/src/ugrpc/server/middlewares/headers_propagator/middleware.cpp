@@ -14,7 +14,8 @@ Middleware::Middleware(std::vector<std::string> headers)
 void Middleware::Handle(MiddlewareCallContext& context) const {
   auto& call = context.GetCall();
   const auto& server_context = call.GetContext();
-  USERVER_NAMESPACE::server::request::HeadersToPropagate headers_to_propagate;
+  std::vector<std::pair<std::string, std::string>> headers_to_propagate;
+  headers_to_propagate.reserve(headers_.size());
   for (const auto& header_name : headers_) {
     const auto* header_value = utils::FindOrNullptr(
         server_context.client_metadata(),
@@ -22,11 +23,14 @@ void Middleware::Handle(MiddlewareCallContext& context) const {
     if (!header_value) {
       continue;
     }
-    headers_to_propagate.emplace(header_name,
-                                 ugrpc::impl::ToString(*header_value));
+    headers_to_propagate.emplace_back(header_name,
+                                      ugrpc::impl::ToString(*header_value));
+  }
+  // The map is only built if an outgoing request needs it
+  if (!headers_to_propagate.empty()) {
+    USERVER_NAMESPACE::server::request::SetTaskInheritedRawHeaders(
+        std::move(headers_to_propagate));
   }
-  USERVER_NAMESPACE::server::request::SetTaskInheritedHeaders(
-      headers_to_propagate);
   context.Next();
 }
 
@@ -9,6 +9,7 @@
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/logger.hpp>
 #include <userver/ugrpc/impl/statistics_storage.hpp>
+#include <userver/ugrpc/server/impl/service_worker_impl.hpp>
 #include <userver/ugrpc/server/middlewares/base.hpp>
 #include <userver/ugrpc/status_codes.hpp>
 #include <userver/utils/algo.hpp>
@@ -167,6 +168,17 @@ void CallAnyBase::ApplyResponseHook(google::protobuf::Message* response) {
   }
 }
 
+void CallAnyBase::WaitForDeferredFinish(
+    impl::AsyncMethodInvocation& finish) noexcept {
+  if (!finish.IsBusy()) return;
+  if (impl::Wait(finish) == impl::AsyncMethodInvocation::WaitStatus::kOk) {
+    return;
+  }
+  impl::ReportNetworkError(RpcInterruptedError(params_.call_name, "Finish"),
+                           params_.call_name, params_.call_span,
+                           params_.statistics);
+}
+
 void CallAnyBase::RunMiddlewarePipeline(
     utils::impl::InternalTag, MiddlewareCallContext& md_call_context) {
   middleware_call_context_ = &md_call_context;
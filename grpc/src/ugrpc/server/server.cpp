@@ -16,12 +16,16 @@
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/entry.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 #include <ugrpc/impl/logging.hpp>
 #include <ugrpc/impl/to_string.hpp>
 #include <ugrpc/server/impl/generic_service_worker.hpp>
 #include <ugrpc/server/impl/parse_config.hpp>
 #include <userver/ugrpc/impl/deadline_timepoint.hpp>
+#include <userver/ugrpc/impl/queue_runner.hpp>
 #include <userver/ugrpc/impl/statistics_storage.hpp>
 #include <userver/ugrpc/server/impl/queue_holder.hpp>
 #include <userver/ugrpc/server/impl/service_worker.hpp>
@@ -89,6 +93,8 @@ class Server::Impl final {
 
   grpc::CompletionQueue& GetCompletionQueue() noexcept;
 
+  const ugrpc::impl::CompletionQueues& GetCompletionQueues() noexcept;
+
   void Start();
 
   int GetPort() const noexcept;
@@ -121,6 +127,7 @@ class Server::Impl final {
   std::vector<std::unique_ptr<impl::ServiceWorker>> service_workers_;
   std::vector<impl::GenericServiceWorker> generic_service_workers_;
   std::optional<impl::QueueHolder> queue_;
+  utils::statistics::Entry queue_statistics_holder_;
   std::unique_ptr<grpc::Server> server_;
   mutable engine::Mutex configuration_mutex_;
 
@@ -148,8 +155,14 @@ Server::Impl::Impl(ServerConfig&& config,
   }
   server_builder_.emplace();
   ApplyChannelArgs(*server_builder_, config);
-  queue_.emplace(static_cast<std::size_t>(config.completion_queue_num),
-                 std::ref(*server_builder_));
+  queue_.emplace(ugrpc::impl::ResolveQueueCount(
+                     static_cast<std::size_t>(config.completion_queue_num)),
+                 config.pin_completion_queues, std::ref(*server_builder_));
+  queue_statistics_holder_ = statistics_storage.RegisterWriter(
+      "grpc.server.completion-queues",
+      [this](utils::statistics::Writer& writer) {
+        if (queue_) DumpMetric(writer, *queue_);
+      });
 
   if (config.unix_socket_path) AddListeningUnixSocket(*config.unix_socket_path);
 
@@ -204,6 +217,7 @@ impl::ServiceSettings Server::Impl::MakeServiceSettings(
       std::move(config.middlewares),
       access_tskv_logger_,
       config_source_,
+      config.request_arena_max_start_block_size,
   };
 }
 
@@ -243,10 +257,15 @@ void Server::Impl::WithServerBuilder(SetupHook setup) {
 
 grpc::CompletionQueue& Server::Impl::GetCompletionQueue() noexcept {
   UASSERT(state_ == State::kConfiguration || state_ == State::kActive);
-  // TODO: https://st.yandex-team.ru/TAXICOMMON-7612
   return *queue_->GetQueues().queues[0];
 }
 
+const ugrpc::impl::CompletionQueues&
+Server::Impl::GetCompletionQueues() noexcept {
+  UASSERT(state_ == State::kConfiguration || state_ == State::kActive);
+  return queue_->GetQueues();
+}
+
 void Server::Impl::Start() {
   std::lock_guard lock(configuration_mutex_);
   UASSERT(state_ == State::kConfiguration);
@@ -282,6 +301,7 @@ void Server::Impl::Stop() noexcept {
   }
   service_workers_.clear();
   generic_service_workers_.clear();
+  queue_statistics_holder_.Unregister();
   queue_.reset();
   server_.reset();
 
@@ -363,6 +383,10 @@ grpc::CompletionQueue& Server::GetCompletionQueue() noexcept {
   return impl_->GetCompletionQueue();
 }
 
+const ugrpc::impl::CompletionQueues& Server::GetCompletionQueues() noexcept {
+  return impl_->GetCompletionQueues();
+}
+
 void Server::Start() { return impl_->Start(); }
 
 int Server::GetPort() const noexcept { return impl_->GetPort(); }
@@ -52,8 +52,14 @@ properties:
         type: integer
         description: |
             completion queue count to create. Should be ~2 times less than worker
-            threads for best RPS.
-        minimum: 1
+            threads for best RPS. 0 picks a half of the available CPUs.
+        minimum: 0
+    pin-completion-queues:
+        type: boolean
+        description: |
+            pin the threads polling the completion queues to disjoint groups of
+            the available CPUs
+        defaultDescription: false
     channel-args:
         type: object
         description: a map of channel arguments, see gRPC Core docs
@@ -94,6 +100,13 @@ properties:
                 items:
                     type: string
                     description: middleware component name
+            request-arena-max-start-block-size:
+                type: integer
+                minimum: 0
+                description: |
+                    allocate the request of each RPC on a protobuf arena with
+                    the first block sized after the recent requests, but not
+                    larger than this value in bytes; 0 disables arenas
 )");
 }
 
@@ -47,6 +47,14 @@ properties:
         items:
             type: string
             description: middleware component name
+    request-arena-max-start-block-size:
+        type: integer
+        minimum: 0
+        description: |
+            allocate the request of each RPC on a protobuf arena with the first
+            block sized after the recent requests, but not larger than this
+            value in bytes; 0 disables arenas
+        defaultDescription: uses grpc-server.service-defaults.request-arena-max-start-block-size
 )");
 }
 
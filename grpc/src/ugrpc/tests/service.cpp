@@ -63,7 +63,7 @@ void ServiceBase::StartServer(
   endpoint_ = fmt::format("[::1]:{}", server_.GetPort());
   client_factory_.emplace(std::move(client_factory_settings),
                           engine::current_task::GetTaskProcessor(),
-                          middleware_factories_, server_.GetCompletionQueue(),
+                          middleware_factories_, server_.GetCompletionQueues(),
                           statistics_storage_, testsuite_,
                           config_storage_.GetSource());
 }
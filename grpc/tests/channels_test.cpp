@@ -1,5 +1,8 @@
 #include <userver/ugrpc/client/channels.hpp>
 
+#include <set>
+#include <vector>
+
 #include <userver/dynamic_config/storage_mock.hpp>
 #include <userver/dynamic_config/test_helpers.hpp>
 #include <userver/engine/async.hpp>
@@ -11,6 +14,7 @@
 #include <userver/utils/statistics/storage.hpp>
 
 #include <userver/ugrpc/client/client_factory.hpp>
+#include <userver/ugrpc/client/impl/channel_cache.hpp>
 #include <userver/ugrpc/client/queue_holder.hpp>
 #include <userver/ugrpc/server/server.hpp>
 
@@ -106,4 +110,41 @@ UTEST_P_MT(GrpcChannels, TryWaitForConnected, 2) {
 INSTANTIATE_UTEST_SUITE_P(Basic, GrpcChannels,
                           ::testing::Values(std::size_t{1}, std::size_t{4}));
 
+UTEST(GrpcChannelCache, PickLeastLoaded) {
+  ugrpc::client::impl::ChannelCache cache{grpc::InsecureChannelCredentials(),
+                                          {}, 3};
+  const auto token = cache.Get("[::1]:1");
+
+  std::vector<ugrpc::client::impl::ChannelCache::Token::ChannelPick> picks;
+  std::set<std::size_t> used;
+  for (int i = 0; i < 3; ++i) {
+    picks.push_back(token.PickChannel());
+    used.insert(picks.back().index);
+  }
+  EXPECT_EQ(used.size(), 3);
+
+  const auto released = picks[1].index;
+  picks.erase(picks.begin() + 1);
+  EXPECT_EQ(token.PickChannel().index, released);
+}
+
+UTEST(GrpcChannelCache, PickFillFirst) {
+  ugrpc::client::impl::ChannelCache cache{grpc::InsecureChannelCredentials(),
+                                          {}, 3, 2};
+  const auto token = cache.Get("[::1]:1");
+
+  std::vector<ugrpc::client::impl::ChannelCache::Token::ChannelPick> picks;
+  for (const std::size_t expected_index : {0, 0, 1, 1, 2, 2}) {
+    picks.push_back(token.PickChannel());
+    EXPECT_EQ(picks.back().index, expected_index);
+  }
+
+  // all the channels are at the limit, the least loaded one is picked
+  picks.push_back(token.PickChannel());
+  EXPECT_EQ(picks.back().index, 0);
+
+  picks.erase(picks.begin() + 4);
+  EXPECT_EQ(token.PickChannel().index, 2);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,48 @@
+#include <userver/utest/utest.hpp>
+
+#include <set>
+
+#include <userver/ugrpc/client/queue_holder.hpp>
+#include <userver/ugrpc/impl/queue_runner.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(CompletionQueues, DistributeCpus) {
+  const auto all_cpus = ugrpc::impl::DistributeCpus(1);
+  ASSERT_EQ(all_cpus.size(), 1);
+  const auto cpu_count = all_cpus[0].size();
+
+  for (const std::size_t queue_count : {1, 2, 3, 7, 1000}) {
+    const auto groups = ugrpc::impl::DistributeCpus(queue_count);
+    ASSERT_EQ(groups.size(), queue_count);
+
+    std::set<std::size_t> seen;
+    std::size_t total = 0;
+    for (const auto& group : groups) {
+      if (cpu_count != 0) {
+        EXPECT_FALSE(group.empty());
+      }
+      seen.insert(group.begin(), group.end());
+      total += group.size();
+    }
+    EXPECT_EQ(seen.size(), cpu_count);
+    if (queue_count <= cpu_count) {
+      EXPECT_EQ(total, cpu_count);
+    }
+  }
+}
+
+TEST(CompletionQueues, ResolveQueueCount) {
+  EXPECT_EQ(ugrpc::impl::ResolveQueueCount(3), 3);
+  EXPECT_GE(ugrpc::impl::ResolveQueueCount(0), 1);
+}
+
+UTEST(CompletionQueues, ClientQueueHolder) {
+  ugrpc::client::QueueHolder holder{3, true};
+  const auto& queues = holder.GetQueues().queues;
+  ASSERT_EQ(queues.size(), 3);
+  EXPECT_EQ(&holder.GetQueue(), queues[0]);
+  EXPECT_EQ(std::set(queues.begin(), queues.end()).size(), 3);
+}
+
+USERVER_NAMESPACE_END
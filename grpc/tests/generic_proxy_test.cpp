@@ -0,0 +1,126 @@
+#include <userver/ugrpc/server/generic_proxy.hpp>
+
+#include <numeric>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/ugrpc/client/exceptions.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+#include <userver/utest/utest.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class UnitTestService final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    if (request.name().empty()) {
+      call.GetContext().AddTrailingMetadata("reason", "empty-name");
+      call.FinishWithError(grpc::Status{grpc::StatusCode::INVALID_ARGUMENT,
+                                        "The name is empty"});
+      return;
+    }
+    sample::ugrpc::GreetingResponse response;
+    response.set_name("Hello " + request.name());
+    call.Finish(response);
+  }
+
+  void Chat(ChatCall& call) override {
+    sample::ugrpc::StreamGreetingRequest request;
+    sample::ugrpc::StreamGreetingResponse response;
+    while (call.Read(request)) {
+      response.set_name("Hello " + request.name());
+      response.set_number(request.number());
+      call.Write(response);
+    }
+    call.Finish();
+  }
+};
+
+class ProxyService final : public ugrpc::server::GenericServiceBase {
+ public:
+  explicit ProxyService(ugrpc::client::GenericClient&& client)
+      : client_(std::move(client)) {}
+
+  void Handle(Call& call) override {
+    ugrpc::server::ProxyGenericCall(call, client_);
+  }
+
+ private:
+  ugrpc::client::GenericClient client_;
+};
+
+// The test server proxies all the RPCs to the backend server
+class GenericProxyTest : public ugrpc::tests::ServiceFixtureBase {
+ protected:
+  GenericProxyTest()
+      : proxy_service_(backend_.MakeClient<ugrpc::client::GenericClient>()) {
+    RegisterService(proxy_service_);
+    StartServer();
+  }
+
+  ~GenericProxyTest() override { StopServer(); }
+
+ private:
+  ugrpc::tests::Service<UnitTestService> backend_;
+  ProxyService proxy_service_;
+};
+
+}  // namespace
+
+UTEST_F(GenericProxyTest, UnaryCall) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+  sample::ugrpc::GreetingRequest request;
+  request.set_name("proxy");
+  EXPECT_EQ(client.SayHello(request).Finish().name(), "Hello proxy");
+}
+
+UTEST_F(GenericProxyTest, ErrorStatus) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+  auto call = client.SayHello(sample::ugrpc::GreetingRequest{});
+  UEXPECT_THROW_MSG(call.Finish(), ugrpc::client::InvalidArgumentError,
+                    "The name is empty");
+
+  const auto& metadata = call.GetContext().GetServerTrailingMetadata();
+  const auto it = metadata.find("reason");
+  ASSERT_NE(it, metadata.end());
+  EXPECT_EQ(it->second, "empty-name");
+}
+
+UTEST_F_MT(GenericProxyTest, BidirectionalStream, 2) {
+  constexpr int kMessagesCount = 200;
+
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  auto stream = client.Chat();
+
+  auto write_task = engine::AsyncNoSpan([&stream] {
+    sample::ugrpc::StreamGreetingRequest request;
+    request.set_name("proxy");
+    for (int i = 0; i < kMessagesCount; ++i) {
+      request.set_number(i);
+      if (!stream.Write(request)) return false;
+    }
+    return stream.WritesDone();
+  });
+
+  std::vector<int> numbers;
+  sample::ugrpc::StreamGreetingResponse response;
+  while (stream.Read(response)) {
+    EXPECT_EQ(response.name(), "Hello proxy");
+    numbers.push_back(response.number());
+  }
+  ASSERT_TRUE(write_task.Get());
+
+  std::vector<int> expected_numbers(kMessagesCount);
+  std::iota(expected_numbers.begin(), expected_numbers.end(), 0);
+  EXPECT_EQ(numbers, expected_numbers);
+}
+
+USERVER_NAMESPACE_END
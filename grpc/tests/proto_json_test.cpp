@@ -0,0 +1,177 @@
+#include <userver/ugrpc/proto_json.hpp>
+
+#include <cmath>
+
+#include <google/protobuf/util/json_util.h>
+
+#include <userver/utest/utest.hpp>
+
+#include <tests/proto_json.pb.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+formats::json::Value ProtobufToJson(const google::protobuf::Message& message) {
+  google::protobuf::util::JsonPrintOptions options;
+#if GOOGLE_PROTOBUF_VERSION >= 5026001
+  options.always_print_fields_with_no_presence = true;
+#else
+  options.always_print_primitive_fields = true;
+#endif
+  std::string result;
+  EXPECT_TRUE(
+      google::protobuf::util::MessageToJsonString(message, &result, options)
+          .ok());
+  return formats::json::FromString(result);
+}
+
+sample::ugrpc::JsonAllTypes MakeAllTypes() {
+  sample::ugrpc::JsonAllTypes message;
+  message.set_int32_value(-42);
+  message.set_int64_value(-9007199254740993);
+  message.set_uint32_value(4000000000);
+  message.set_uint64_value(18446744073709551615ULL);
+  message.set_sint32_value(-7);
+  message.set_fixed64_value(123);
+  message.set_double_value(0.1);
+  message.set_float_value(0.1F);
+  message.set_bool_value(true);
+  message.set_string_value("text \"quoted\"\n");
+  message.set_bytes_value(std::string{"\0\xff\x10", 3});
+  message.set_color(sample::ugrpc::JSON_COLOR_GREEN);
+  message.set_optional_value(0);
+  message.mutable_tree()->set_id(1);
+  message.mutable_tree()->add_children()->set_id(2);
+  message.add_strings("a");
+  message.add_strings("b");
+  message.add_trees()->set_id(3);
+  message.add_colors(sample::ugrpc::JSON_COLOR_RED);
+  message.add_colors(static_cast<sample::ugrpc::JsonColor>(42));
+  message.add_doubles(1.0);
+  message.add_doubles(-2.5);
+  message.add_doubles(1e300);
+  (*message.mutable_string_to_int64())["key"] = 5;
+  (*message.mutable_int32_to_tree())[-1].set_id(4);
+  (*message.mutable_bool_to_string())[true] = "yes";
+  message.mutable_choice_tree()->set_id(5);
+  return message;
+}
+
+}  // namespace
+
+TEST(ProtoJson, MatchesProtobuf) {
+  const auto message = MakeAllTypes();
+  const auto expected = ProtobufToJson(message);
+
+  EXPECT_EQ(ugrpc::MessageToJson(message), expected);
+  EXPECT_EQ(formats::json::FromString(ugrpc::ToJsonString(message)), expected);
+
+  formats::json::StringBuilder sb;
+  ugrpc::MessageToJson(message, sb);
+  EXPECT_EQ(formats::json::FromString(sb.GetString()), expected);
+}
+
+TEST(ProtoJson, DefaultsMatchProtobuf) {
+  const sample::ugrpc::JsonAllTypes message;
+  const auto json = ugrpc::MessageToJson(message);
+
+  EXPECT_EQ(json, ProtobufToJson(message));
+  EXPECT_FALSE(json.HasMember("optionalValue"));
+  EXPECT_FALSE(json.HasMember("tree"));
+  EXPECT_EQ(json["int64Value"].As<std::string>(), "0");
+  EXPECT_TRUE(json["strings"].IsEmpty());
+}
+
+TEST(ProtoJson, SpecialDoubles) {
+  sample::ugrpc::JsonAllTypes message;
+  message.add_doubles(std::nan(""));
+  message.add_doubles(HUGE_VAL);
+  message.add_doubles(-HUGE_VAL);
+
+  const auto json = ugrpc::MessageToJson(message);
+  EXPECT_EQ(json, ProtobufToJson(message));
+
+  sample::ugrpc::JsonAllTypes parsed;
+  ugrpc::JsonToMessage(json, parsed);
+  ASSERT_EQ(parsed.doubles_size(), 3);
+  EXPECT_TRUE(std::isnan(parsed.doubles(0)));
+  EXPECT_EQ(parsed.doubles(1), HUGE_VAL);
+  EXPECT_EQ(parsed.doubles(2), -HUGE_VAL);
+}
+
+TEST(ProtoJson, RoundTrip) {
+  const auto message = MakeAllTypes();
+
+  sample::ugrpc::JsonAllTypes parsed;
+  ugrpc::JsonToMessage(ugrpc::MessageToJson(message), parsed);
+  EXPECT_EQ(parsed.SerializeAsString(), message.SerializeAsString());
+}
+
+TEST(ProtoJson, ParseAlternativeForms) {
+  const auto json = formats::json::FromString(R"({
+    "int32_value": "12",
+    "int64Value": 34,
+    "floatValue": "Infinity",
+    "color": 1,
+    "bytesValue": "_-8",
+    "tree": null,
+    "choiceString": "x"
+  })");
+
+  sample::ugrpc::JsonAllTypes parsed;
+  parsed.set_string_value("cleared");
+  ugrpc::JsonToMessage(json, parsed);
+
+  EXPECT_EQ(parsed.int32_value(), 12);
+  EXPECT_EQ(parsed.int64_value(), 34);
+  EXPECT_EQ(parsed.float_value(), HUGE_VALF);
+  EXPECT_EQ(parsed.color(), sample::ugrpc::JSON_COLOR_RED);
+  EXPECT_EQ(parsed.bytes_value(), "\xff\xef");
+  EXPECT_FALSE(parsed.has_tree());
+  EXPECT_EQ(parsed.choice_string(), "x");
+  EXPECT_EQ(parsed.string_value(), "");
+}
+
+TEST(ProtoJson, ParseErrors) {
+  sample::ugrpc::JsonAllTypes parsed;
+  const auto parse = [&parsed](std::string_view json) {
+    ugrpc::JsonToMessage(formats::json::FromString(json), parsed);
+  };
+
+  UEXPECT_THROW(parse(R"({"unknown": 1})"), formats::json::ParseException);
+  UEXPECT_THROW(parse(R"({"int32Value": "abc"})"),
+                formats::json::ParseException);
+  UEXPECT_THROW(parse(R"({"int32Value": 3000000000})"),
+                formats::json::ParseException);
+  UEXPECT_THROW(parse(R"({"color": "JSON_COLOR_BLUE"})"),
+                formats::json::ParseException);
+  UEXPECT_THROW(parse(R"({"tree": {"id": []}})"),
+                formats::json::ParseException);
+  UEXPECT_THROW(parse(R"({"choiceString": "x", "choiceTree": {}})"),
+                formats::json::ParseException);
+  UEXPECT_THROW(parse(R"({"boolToString": {"yes": "no"}})"),
+                formats::json::ParseException);
+  UEXPECT_THROW(parse(R"([])"), formats::json::ParseException);
+}
+
+TEST(ProtoJson, WellKnownTypesFallback) {
+  sample::ugrpc::JsonWithTimestamp message;
+  message.set_name("name");
+  message.mutable_created_at()->set_seconds(1700000000);
+
+  const auto json = ugrpc::MessageToJson(message);
+  EXPECT_EQ(json, ProtobufToJson(message));
+  EXPECT_EQ(json["createdAt"].As<std::string>(), "2023-11-14T22:13:20Z");
+
+  sample::ugrpc::JsonWithTimestamp parsed;
+  ugrpc::JsonToMessage(json, parsed);
+  EXPECT_EQ(parsed.SerializeAsString(), message.SerializeAsString());
+
+  UEXPECT_THROW(
+      ugrpc::JsonToMessage(formats::json::FromString(R"({"unknown": 1})"),
+                           parsed),
+      formats::json::ParseException);
+}
+
+USERVER_NAMESPACE_END
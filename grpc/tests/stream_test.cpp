@@ -1,8 +1,10 @@
 #include <userver/utest/utest.hpp>
 
+#include <cstdint>
 #include <vector>
 
 #include <userver/engine/async.hpp>
+#include <userver/utils/mock_now.hpp>
 
 #include <tests/unit_test_client.usrv.pb.hpp>
 #include <tests/unit_test_service.usrv.pb.hpp>
@@ -24,6 +26,36 @@ class UnitTestServiceEcho final : public sample::ugrpc::UnitTestServiceBase {
   }
 };
 
+constexpr ugrpc::WriteBatchingConfig kWriteBatching{
+    16, std::chrono::seconds{10}};
+
+class UnitTestServiceBatching final
+    : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void ReadMany(ReadManyCall& call,
+                sample::ugrpc::StreamGreetingRequest&& request) override {
+    call.SetWriteBatching(kWriteBatching);
+    sample::ugrpc::StreamGreetingResponse response;
+    for (int i = 0; i < request.number(); ++i) {
+      response.set_number(i);
+      call.Write(response);
+    }
+    call.Finish();
+  }
+
+  void WriteMany(WriteManyCall& call) override {
+    sample::ugrpc::StreamGreetingRequest request;
+    sample::ugrpc::StreamGreetingResponse response;
+    int count = 0;
+    while (call.Read(request)) {
+      if (request.number() != count) break;
+      ++count;
+    }
+    response.set_number(count);
+    call.Finish(response);
+  }
+};
+
 }  // namespace
 
 using GrpcBidirectionalStream =
@@ -59,4 +91,50 @@ UTEST_F_MT(GrpcBidirectionalStream, BidirectionalStreamTest, 2) {
   ASSERT_EQ(responses.size(), kMessagesCount);
 }
 
+using GrpcWriteBatching = ugrpc::tests::ServiceFixture<UnitTestServiceBatching>;
+
+UTEST_F(GrpcWriteBatching, ServerStream) {
+  constexpr int kMessagesCount = 100;
+
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  sample::ugrpc::StreamGreetingRequest request;
+  request.set_number(kMessagesCount);
+  auto stream = client.ReadMany(request);
+
+  int count = 0;
+  sample::ugrpc::StreamGreetingResponse response;
+  while (stream.Read(response)) {
+    EXPECT_EQ(response.number(), count);
+    ++count;
+  }
+  EXPECT_EQ(count, kMessagesCount);
+
+  // Server writes metrics after Finish, after the client might have returned
+  // from Read.
+  GetServer().StopServing();
+  utils::datetime::MockSleep(std::chrono::seconds{6});
+
+  const auto stats = GetStatistics(
+      "grpc.server.by-destination",
+      {{"grpc_destination", "sample.ugrpc.UnitTestService/ReadMany"}});
+  EXPECT_EQ(
+      stats.SingleMetric("write-batch-size", {{"percentile", "p100"}}).AsInt(),
+      static_cast<std::int64_t>(kWriteBatching.max_batch_size));
+}
+
+UTEST_F(GrpcWriteBatching, ClientStream) {
+  constexpr int kMessagesCount = 100;
+
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  auto stream = client.WriteMany();
+  stream.SetWriteBatching(kWriteBatching);
+
+  sample::ugrpc::StreamGreetingRequest request;
+  for (int i = 0; i < kMessagesCount; ++i) {
+    request.set_number(i);
+    ASSERT_TRUE(stream.Write(request));
+  }
+  EXPECT_EQ(stream.Finish().number(), kMessagesCount);
+}
+
 USERVER_NAMESPACE_END
@@ -83,6 +83,22 @@ class ConsumerScope final {
   /// with successfully processed messages) come again, until callback succeeds
   void Start(Callback callback);
 
+  /// @brief Same as `ConsumerScope::Start`, but splits each polled batch by
+  /// topic partitions and processes the partitions concurrently.
+  ///
+  /// `callback` is invoked with the messages of a single partition, in the
+  /// order they were written to the partition. The next batch is polled once
+  /// all the partitions of the previous batch are processed.
+  ///
+  /// Unless `enable_auto_commit` is enabled, the offsets are committed
+  /// asynchronously after each successfully processed batch.
+  ///
+  /// @warning Do not call `ConsumerScope::AsyncCommit` from `callback`, as it
+  /// would commit the messages of partitions still being processed
+  /// @note If `callback` throws for any partition, the messages of the entire
+  /// batch come again, until all the partitions are processed successfully
+  void StartByPartition(Callback callback);
+
   /// @brief Revokes all topic partition consumer was subscribed on. Also closes
   /// the consumer, leaving the consumer balanced group.
   ///
@@ -111,6 +127,11 @@ class ConsumerScope final {
   /// `enable_auto_commit: true` in the static config. But read Kafka
   /// documentation carefully before to understand what auto commitment
   /// mechanism actually mean
+  ///
+  /// @note Unless `enable_auto_commit` is enabled, the offsets of the messages
+  /// of successfully processed batches are also committed when their
+  /// partitions are revoked from the consumer, either by a rebalance or by
+  /// `ConsumerScope::Stop`
   void AsyncCommit();
 
  private:
@@ -1,11 +1,18 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include <userver/engine/task/task.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/span.hpp>
 #include <userver/utils/statistics/writer.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -14,11 +21,36 @@ namespace kafka {
 
 namespace impl {
 
+class BatchDeliveryWaiter;
 class Configuration;
 class ProducerImpl;
 
 }  // namespace impl
 
+/// @brief Future of a message delivery returned by `Producer::SendBatch`.
+///
+/// All the futures of a batch share a single delivery state.
+class DeliveryFuture final {
+ public:
+  /// @brief Waits until the message is delivered.
+  /// @throws std::runtime_error if message is not delivered and acked by
+  /// Kafka Broker
+  /// @throws engine::WaitInterruptedException on cancellation
+  void Get() const;
+
+  /// @brief Returns whether the delivery result is available.
+  bool IsReady() const;
+
+ private:
+  friend class Producer;
+
+  DeliveryFuture(std::shared_ptr<impl::BatchDeliveryWaiter> batch,
+                 std::size_t index);
+
+  std::shared_ptr<impl::BatchDeliveryWaiter> batch_;
+  std::size_t index_;
+};
+
 /// @ingroup userver_clients
 ///
 /// @brief Apache Kafka Producer Client.
@@ -110,6 +142,29 @@ class Producer final {
       std::string topic_name, std::string key, std::string message,
       std::optional<std::uint32_t> partition = std::nullopt) const;
 
+  /// @brief Message sent by `Producer::SendBatch`.
+  struct BatchMessage final {
+    std::string_view key;
+    std::string_view message;
+    std::optional<std::uint32_t> partition{};
+  };
+
+  /// @brief Enqueues the messages to topic `topic_name` in one call and
+  /// returns the futures of their deliveries in the same order.
+  ///
+  /// No payload data is copied. The caller must keep the `message` data alive
+  /// until the corresponding delivery future is ready.
+  ///
+  /// Unlike `Producer::Send`, the deliveries are not retried by the library.
+  /// A message that could not be enqueued has its future ready with the
+  /// error.
+  ///
+  /// @warning if `enable_idempotence` option is enabled, do not use both
+  /// explicit partitions and Kafka-chosen ones
+  [[nodiscard]] std::vector<DeliveryFuture> SendBatch(
+      const std::string& topic_name,
+      utils::span<const BatchMessage> messages) const;
+
   /// @brief Dumps per topic messages produce statistics.
   /// @see impl/stats.hpp
   void DumpMetric(utils::statistics::Writer& writer) const;
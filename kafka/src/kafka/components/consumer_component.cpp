@@ -93,6 +93,22 @@ properties:
           - latest
           - end
           - error
+    partition_assignment_strategy:
+        type: string
+        description: |
+            how the topics partitions are distributed between
+            the consumers of the group.
+            `range,roundrobin` - eager rebalancing, all the partitions
+            of all the consumers are revoked and assigned again;
+            `cooperative-sticky` - incremental rebalancing, only the
+            partitions that move to another consumer are revoked,
+            the rest are consumed without a pause.
+            Note: all the consumers of a group must use the same
+            rebalancing protocol, do not mix them in one group
+        defaultDescription: range,roundrobin
+        enum:
+          - range,roundrobin
+          - cooperative-sticky
     max_batch_size:
         type: integer
         description: maximum batch size for one callback call
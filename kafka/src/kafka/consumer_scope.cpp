@@ -12,7 +12,13 @@ ConsumerScope::ConsumerScope(impl::Consumer& consumer) noexcept
 ConsumerScope::~ConsumerScope() { Stop(); }
 
 void ConsumerScope::Start(Callback callback) {
-  consumer_.StartMessageProcessing(std::move(callback));
+  consumer_.StartMessageProcessing(std::move(callback),
+                                   /*by_partition=*/false);
+}
+
+void ConsumerScope::StartByPartition(Callback callback) {
+  consumer_.StartMessageProcessing(std::move(callback),
+                                   /*by_partition=*/true);
 }
 
 void ConsumerScope::Stop() noexcept { consumer_.Stop(); }
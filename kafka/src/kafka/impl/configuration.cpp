@@ -43,6 +43,8 @@ constexpr std::string_view kGroupIdField = "group_id";
 constexpr std::string_view kEnvPodNameField = "env_pod_name";
 constexpr std::string_view kEnableAutoCommitField = "enable_auto_commit";
 constexpr std::string_view kAutoOffsetResetField = "auto_offset_reset";
+constexpr std::string_view kPartitionAssignmentStrategyField =
+    "partition_assignment_strategy";
 
 constexpr std::string_view kPodNameSubstr = "{pod_name}";
 
@@ -233,6 +235,9 @@ void Configuration::SetConsumerOptions(
                 config[kEnableAutoCommitField].As<std::string>("false"));
   ConfSetOption(conf_, "auto.offset.reset",
                 config[kAutoOffsetResetField].As<std::string>());
+  ConfSetOption(conf_, "partition.assignment.strategy",
+                config[kPartitionAssignmentStrategyField].As<std::string>(
+                    "range,roundrobin"));
 }
 
 void Configuration::SetProducerOptions(
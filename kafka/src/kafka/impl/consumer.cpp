@@ -1,7 +1,11 @@
 #include <kafka/impl/consumer.hpp>
 
+#include <algorithm>
 #include <string_view>
+#include <tuple>
+#include <vector>
 
+#include <userver/engine/get_all.hpp>
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/testsuite/testpoint.hpp>
 #include <userver/tracing/span.hpp>
@@ -29,7 +33,8 @@ Consumer::Consumer(std::unique_ptr<Configuration> configuration,
       enable_auto_commit_(enable_auto_commit),
       consumer_task_processor_(consumer_task_processor),
       main_task_processor_(main_task_processor),
-      consumer_(std::make_unique<ConsumerImpl>(std::move(configuration))) {}
+      consumer_(std::make_unique<ConsumerImpl>(std::move(configuration),
+                                            enable_auto_commit)) {}
 
 Consumer::~Consumer() {
   static constexpr std::string_view kErrShutdownFailed{
@@ -51,12 +56,13 @@ void Consumer::DumpMetric(utils::statistics::Writer& writer) const {
   USERVER_NAMESPACE::kafka::impl::DumpMetric(writer, consumer_->GetStats());
 }
 
-void Consumer::StartMessageProcessing(ConsumerScope::Callback callback) {
+void Consumer::StartMessageProcessing(ConsumerScope::Callback callback,
+                                      bool by_partition) {
   UINVARIANT(!processing_.exchange(true), "Message processing already started");
 
   poll_task_ = utils::Async(
       consumer_task_processor_, "consumer_polling",
-      [this, callback = std::move(callback)] {
+      [this, callback = std::move(callback), by_partition] {
         ExtendCurrentSpan();
 
         consumer_->Subscribe(topics_);
@@ -65,7 +71,8 @@ void Consumer::StartMessageProcessing(ConsumerScope::Callback callback) {
 
         while (!engine::current_task::ShouldCancel()) {
           auto polled_messages = consumer_->PollBatch(
-              max_batch_size_, engine::Deadline::FromDuration(poll_timeout));
+              max_batch_size_, engine::Deadline::FromDuration(poll_timeout),
+              /*group_by_partition=*/by_partition);
 
           if (polled_messages.empty() || engine::current_task::ShouldCancel()) {
             /// @note Message batch may be not empty. It may be polled by
@@ -74,13 +81,19 @@ void Consumer::StartMessageProcessing(ConsumerScope::Callback callback) {
           }
           TESTPOINT(fmt::format("tp_{}_polled", component_name_), {});
 
-          auto batch_processing_task =
-              utils::Async(main_task_processor_, "messages_processing",
-                           callback, utils::span{polled_messages});
           try {
-            batch_processing_task.Get();
+            if (by_partition) {
+              ProcessBatchByPartition(callback, utils::span{polled_messages});
+            } else {
+              utils::Async(main_task_processor_, "messages_processing",
+                           callback, utils::span{polled_messages})
+                  .Get();
+            }
 
             consumer_->AccountMessageBatchProcessingSucceeded(polled_messages);
+            if (by_partition && !enable_auto_commit_) {
+              consumer_->AsyncCommit();
+            }
             TESTPOINT(fmt::format("tp_{}", component_name_), {});
           } catch (const std::exception& e) {
             consumer_->AccountMessageBatchProcessingFailed(polled_messages);
@@ -108,6 +121,30 @@ void Consumer::StartMessageProcessing(ConsumerScope::Callback callback) {
       });
 }
 
+void Consumer::ProcessBatchByPartition(const ConsumerScope::Callback& callback,
+                                       MessageBatchView polled_messages) {
+  const auto partition_less = [](const Message& lhs, const Message& rhs) {
+    return std::make_tuple(std::string_view{lhs.GetTopic()},
+                           lhs.GetPartition()) <
+           std::make_tuple(std::string_view{rhs.GetTopic()},
+                           rhs.GetPartition());
+  };
+  UASSERT(std::is_sorted(polled_messages.begin(), polled_messages.end(),
+                         partition_less));
+
+  std::vector<engine::TaskWithResult<void>> partition_tasks;
+  for (auto begin = polled_messages.begin(); begin != polled_messages.end();) {
+    const auto end = std::upper_bound(begin, polled_messages.end(), *begin,
+                                      partition_less);
+    partition_tasks.push_back(
+        utils::Async(main_task_processor_, "partition_messages_processing",
+                     callback, MessageBatchView{begin, end}));
+    begin = end;
+  }
+
+  engine::GetAll(partition_tasks);
+}
+
 void Consumer::AsyncCommit() {
   UINVARIANT(processing_.load(), "Message processing is not currently started");
 
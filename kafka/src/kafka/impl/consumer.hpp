@@ -57,7 +57,15 @@ class Consumer final {
 
   /// @brief Subscribes for `topics_` and starts the `poll_task_`, in which
   /// periodically polls the message batches.
-  void StartMessageProcessing(ConsumerScope::Callback callback);
+  /// @param by_partition makes the partitions of each batch processed
+  /// concurrently
+  void StartMessageProcessing(ConsumerScope::Callback callback,
+                              bool by_partition);
+
+  /// @brief Processes the partitions of the batch grouped by
+  /// `ConsumerImpl::PollBatch` concurrently.
+  void ProcessBatchByPartition(const ConsumerScope::Callback& callback,
+                               MessageBatchView polled_messages);
 
   /// @brief Calls `poll_task_.SyncCancel()`
   void Stop() noexcept;
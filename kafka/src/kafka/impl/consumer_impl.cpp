@@ -1,6 +1,9 @@
 #include <kafka/impl/consumer_impl.hpp>
 
+#include <algorithm>
 #include <chrono>
+#include <string_view>
+#include <tuple>
 
 #include <userver/logging/log.hpp>
 #include <userver/testsuite/testpoint.hpp>
@@ -37,6 +40,11 @@ std::optional<std::chrono::milliseconds> RetrieveTimestamp(
   return std::chrono::milliseconds{timestamp};
 }
 
+std::tuple<std::string_view, std::int32_t> GetPartitionKey(
+    const rd_kafka_message_t* message) {
+  return {rd_kafka_topic_name(message->rkt), message->partition};
+}
+
 }  // namespace
 
 struct Message::Data final {
@@ -116,6 +124,22 @@ void OffsetCommitCallback(rd_kafka_t* consumer, rd_kafka_resp_err_t err,
       ->OffsetCommitCallbackProxy(err, committed_offsets);
 }
 
+using ErrorHolder =
+    std::unique_ptr<rd_kafka_error_t, decltype(&rd_kafka_error_destroy)>;
+
+utils::span<const rd_kafka_topic_partition_t> MakeSpan(
+    const rd_kafka_topic_partition_list_t* list) {
+  if (list == nullptr || list->cnt <= 0) {
+    return {};
+  }
+  return {list->elems, list->elems + static_cast<std::size_t>(list->cnt)};
+}
+
+bool IsCooperativeRebalance(rd_kafka_t* consumer) {
+  return std::string_view{rd_kafka_rebalance_protocol(consumer)} ==
+         "COOPERATIVE";
+}
+
 void PrintTopicPartitionsList(
     const rd_kafka_topic_partition_list_t* list,
     std::function<std::string(const rd_kafka_topic_partition_t&)> log,
@@ -179,12 +203,18 @@ ConsumerImpl::ConsumerHolder::ConsumerHolder(
 
   /// @note makes available to call `rd_kafka_consumer_poll`
   rd_kafka_poll_set_consumer(Handle());
+  queue_ = QueueHolder{rd_kafka_queue_get_consumer(Handle()),
+                       rd_kafka_queue_destroy};
 }
 
 rd_kafka_t* ConsumerImpl::ConsumerHolder::Handle() { return handle_.get(); }
 
+rd_kafka_queue_t* ConsumerImpl::ConsumerHolder::Queue() {
+  return queue_.get();
+}
+
 void ConsumerImpl::AssignPartitions(
-    const rd_kafka_topic_partition_list_t* partitions) {
+    const rd_kafka_topic_partition_list_t* partitions, bool incremental) {
   LOG_INFO() << "Assigning new partitions to consumer";
   PrintTopicPartitionsList(
       partitions, [](const rd_kafka_topic_partition_t& partition) {
@@ -192,18 +222,31 @@ void ConsumerImpl::AssignPartitions(
                            partition.partition, partition.topic);
       });
 
-  const auto assign_err = rd_kafka_assign(consumer_->Handle(), partitions);
-  if (assign_err != RD_KAFKA_RESP_ERR_NO_ERROR) {
-    LOG_ERROR() << fmt::format("Failed to assign partitions: {}",
-                               rd_kafka_err2str(assign_err));
-    return;
+  if (incremental) {
+    const ErrorHolder assign_err{
+        rd_kafka_incremental_assign(consumer_->Handle(), partitions),
+        &rd_kafka_error_destroy};
+    if (assign_err != nullptr) {
+      LOG_ERROR() << fmt::format(
+          "Failed to incrementally assign partitions: {}",
+          rd_kafka_error_string(assign_err.get()));
+      return;
+    }
+  } else {
+    const auto assign_err = rd_kafka_assign(consumer_->Handle(), partitions);
+    if (assign_err != RD_KAFKA_RESP_ERR_NO_ERROR) {
+      LOG_ERROR() << fmt::format("Failed to assign partitions: {}",
+                                 rd_kafka_err2str(assign_err));
+      return;
+    }
   }
+  stats_.rebalance.partitions_assigned += MakeSpan(partitions).size();
 
   LOG_INFO() << "Successfully assigned partitions";
 }
 
 void ConsumerImpl::RevokePartitions(
-    const rd_kafka_topic_partition_list_t* partitions) {
+    const rd_kafka_topic_partition_list_t* partitions, bool incremental) {
   LOG_INFO() << "Revoking existing partitions from consumer";
 
   PrintTopicPartitionsList(
@@ -212,16 +255,88 @@ void ConsumerImpl::RevokePartitions(
                            partition.partition, partition.topic);
       });
 
-  const auto revokation_err = rd_kafka_assign(consumer_->Handle(), nullptr);
-  if (revokation_err != RD_KAFKA_RESP_ERR_NO_ERROR) {
-    LOG_ERROR() << fmt::format("Failed to revoke partitions: {}",
-                               rd_kafka_err2str(revokation_err));
-    return;
+  if (!enable_auto_commit_) {
+    CommitProcessedOffsets(partitions);
+  }
+  ForgetProcessedOffsets(partitions);
+
+  if (incremental) {
+    const ErrorHolder revokation_err{
+        rd_kafka_incremental_unassign(consumer_->Handle(), partitions),
+        &rd_kafka_error_destroy};
+    if (revokation_err != nullptr) {
+      LOG_ERROR() << fmt::format(
+          "Failed to incrementally revoke partitions: {}",
+          rd_kafka_error_string(revokation_err.get()));
+      return;
+    }
+  } else {
+    const auto revokation_err = rd_kafka_assign(consumer_->Handle(), nullptr);
+    if (revokation_err != RD_KAFKA_RESP_ERR_NO_ERROR) {
+      LOG_ERROR() << fmt::format("Failed to revoke partitions: {}",
+                                 rd_kafka_err2str(revokation_err));
+      return;
+    }
   }
+  stats_.rebalance.partitions_revoked += MakeSpan(partitions).size();
 
   LOG_INFO() << "Successfully revoked partitions";
 }
 
+void ConsumerImpl::CommitProcessedOffsets(
+    const rd_kafka_topic_partition_list_t* partitions) {
+  const auto revoked = MakeSpan(partitions);
+
+  TopicPartitionsListHolder offsets{
+      rd_kafka_topic_partition_list_new(static_cast<int>(revoked.size())),
+      &rd_kafka_topic_partition_list_destroy};
+  for (const auto& partition : revoked) {
+    const auto it = processed_offsets_.find(std::make_tuple(
+        std::string_view{partition.topic}, partition.partition));
+    if (it != processed_offsets_.end()) {
+      rd_kafka_topic_partition_list_add(offsets.get(), partition.topic,
+                                        partition.partition)
+          ->offset = it->second;
+    }
+  }
+  if (offsets->cnt == 0) {
+    return;
+  }
+
+  LOG_INFO() << fmt::format(
+      "Committing processed messages offsets of {} revoked partitions",
+      offsets->cnt);
+  const auto commit_err =
+      rd_kafka_commit(consumer_->Handle(), offsets.get(), /*async=*/0);
+  if (commit_err != RD_KAFKA_RESP_ERR_NO_ERROR) {
+    LOG_WARNING() << fmt::format(
+        "Failed to commit offsets of revoked partitions: {}",
+        rd_kafka_err2str(commit_err));
+  }
+}
+
+void ConsumerImpl::ForgetProcessedOffsets(
+    const rd_kafka_topic_partition_list_t* partitions) {
+  for (const auto& partition : MakeSpan(partitions)) {
+    const auto it = processed_offsets_.find(std::make_tuple(
+        std::string_view{partition.topic}, partition.partition));
+    if (it != processed_offsets_.end()) {
+      processed_offsets_.erase(it);
+    }
+  }
+}
+
+void ConsumerImpl::AccountRebalanceFinished() {
+  if (!rebalance_start_) {
+    return;
+  }
+
+  const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - *rebalance_start_);
+  stats_.rebalance.duration_ms.GetCurrentCounter().Account(duration.count());
+  rebalance_start_.reset();
+}
+
 void ConsumerImpl::ErrorCallbackProxy(int error_code, const char* reason) {
   tracing::Span span{"error_callback"};
   span.AddTag("kafka_callback", "error_callback");
@@ -246,14 +361,23 @@ void ConsumerImpl::RebalanceCallbackProxy(
   LOG_INFO() << fmt::format("Consumer group rebalanced ('{}' protocol)",
                             rd_kafka_rebalance_protocol(consumer_->Handle()));
 
+  /// @note Rebalance starts with the revocation, if any partitions are moved
+  /// from the consumer, and ends with the assignment
+  if (!rebalance_start_) {
+    rebalance_start_ = std::chrono::steady_clock::now();
+    ++stats_.rebalance.rebalances_total;
+  }
+
+  const bool incremental = IsCooperativeRebalance(consumer_->Handle());
   switch (err) {
     case RD_KAFKA_RESP_ERR__ASSIGN_PARTITIONS:
-      AssignPartitions(partitions);
+      AssignPartitions(partitions, incremental);
+      AccountRebalanceFinished();
       CallTestpoints(partitions,
                      fmt::format("tp_{}_subscribed", component_name_));
       break;
     case RD_KAFKA_RESP_ERR__REVOKE_PARTITIONS:
-      RevokePartitions(partitions);
+      RevokePartitions(partitions, incremental);
       CallTestpoints(partitions, fmt::format("tp_{}_revoked", component_name_));
       break;
     default:
@@ -287,8 +411,10 @@ void ConsumerImpl::OffsetCommitCallbackProxy(
       /*skip_invalid_offsets=*/true);
 }
 
-ConsumerImpl::ConsumerImpl(std::unique_ptr<Configuration> configuration)
+ConsumerImpl::ConsumerImpl(std::unique_ptr<Configuration> configuration,
+                           bool enable_auto_commit)
     : component_name_(configuration->GetComponentName()),
+      enable_auto_commit_(enable_auto_commit),
       conf_([this, configuration = std::move(configuration)] {
         rd_kafka_conf_t* conf = configuration->Release();
         rd_kafka_conf_set_opaque(conf, this);
@@ -303,6 +429,8 @@ ConsumerImpl::~ConsumerImpl() = default;
 
 void ConsumerImpl::Subscribe(const std::vector<std::string>& topics) {
   consumer_.emplace(conf_.MakeConfCopy());
+  processed_offsets_.clear();
+  rebalance_start_.reset();
 
   TopicPartitionsListHolder topic_partitions_list{
       rd_kafka_topic_partition_list_new(topics.size()),
@@ -380,15 +508,60 @@ std::optional<Message> ConsumerImpl::PollMessage(engine::Deadline deadline) {
 }
 
 ConsumerImpl::MessageBatch ConsumerImpl::PollBatch(std::size_t max_batch_size,
-                                                   engine::Deadline deadline) {
+                                                   engine::Deadline deadline,
+                                                   bool group_by_partition) {
   MessageBatch batch;
+  if (deadline.IsReached() || max_batch_size == 0) {
+    return batch;
+  }
 
-  while (batch.size() < max_batch_size) {
-    auto message = PollMessage(deadline);
-    if (!message.has_value()) {
-      break;
+  const auto poll_timeout{std::chrono::duration_cast<std::chrono::milliseconds>(
+      deadline.TimeLeft())};
+
+  LOG_DEBUG() << fmt::format("Polling batch of {} messages for {}ms",
+                             max_batch_size, poll_timeout.count());
+
+  /// @note Blocks until `max_batch_size` messages are consumed or the timeout
+  /// expires. The polled messages are owned by the `Message` wrappers, so the
+  /// payloads are never copied
+  std::vector<rd_kafka_message_t*> raw_messages(max_batch_size, nullptr);
+  const auto polled = rd_kafka_consume_batch_queue(
+      consumer_->Queue(), static_cast<int>(poll_timeout.count()),
+      raw_messages.data(), raw_messages.size());
+  if (polled < 0) {
+    LOG_WARNING() << fmt::format("Failed to poll messages batch: {}",
+                                 rd_kafka_err2str(rd_kafka_last_error()));
+    return batch;
+  }
+  raw_messages.resize(polled);
+
+  if (group_by_partition) {
+    std::stable_sort(raw_messages.begin(), raw_messages.end(),
+                     [](const rd_kafka_message_t* lhs,
+                        const rd_kafka_message_t* rhs) {
+                       return GetPartitionKey(lhs) < GetPartitionKey(rhs);
+                     });
+  }
+
+  batch.reserve(polled);
+  for (auto* raw_message : raw_messages) {
+    MessageHolder message{raw_message, &rd_kafka_message_destroy};
+    if (message->err != RD_KAFKA_RESP_ERR_NO_ERROR) {
+      LOG_WARNING() << fmt::format("Consumed message with error: {}",
+                                   rd_kafka_err2str(message->err));
+      continue;
     }
-    batch.push_back(std::move(*message));
+
+    Message polled_message{Message::DataStorage{std::move(message)}};
+    AccountPolledMessageStat(polled_message);
+
+    LOG_INFO() << fmt::format(
+        "Message from kafka topic '{}' received by key '{}' with "
+        "partition {} by offset {}",
+        polled_message.GetTopic(), polled_message.GetKey(),
+        polled_message.GetPartition(), polled_message.GetOffset());
+
+    batch.push_back(std::move(polled_message));
   }
 
   if (!batch.empty()) {
@@ -425,6 +598,17 @@ void ConsumerImpl::AccountPolledMessageStat(const Message& polled_message) {
 }
 void ConsumerImpl::AccountMessageProcessingSucceeded(const Message& message) {
   ++GetTopicStats(message.GetTopic())->messages_counts.messages_success;
+
+  const auto next_offset = message.GetOffset() + 1;
+  const auto it = processed_offsets_.find(std::make_tuple(
+      std::string_view{message.GetTopic()}, message.GetPartition()));
+  if (it == processed_offsets_.end()) {
+    processed_offsets_.emplace(
+        std::make_tuple(message.GetTopic(), message.GetPartition()),
+        next_offset);
+  } else if (it->second < next_offset) {
+    it->second = next_offset;
+  }
 }
 
 void ConsumerImpl::AccountMessageBatchProcessingSucceeded(
@@ -1,6 +1,12 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
 #include <optional>
+#include <string>
+#include <tuple>
 #include <vector>
 
 #include <userver/engine/deadline.hpp>
@@ -25,7 +31,10 @@ class ConsumerImpl final {
   using MessageBatch = std::vector<Message>;
 
  public:
-  explicit ConsumerImpl(std::unique_ptr<Configuration> configuration);
+  /// @param enable_auto_commit disables the commit of processed messages
+  /// offsets on partitions revocation, as `librdkafka` commits them itself
+  ConsumerImpl(std::unique_ptr<Configuration> configuration,
+               bool enable_auto_commit);
 
   ~ConsumerImpl();
 
@@ -52,9 +61,14 @@ class ConsumerImpl final {
   /// @note Must be called periodically to maintain consumer group membership
   std::optional<Message> PollMessage(engine::Deadline deadline);
 
-  /// @brief Effectively calls `PollMessage` until `deadline` is reached
-  /// and no more than `max_batch_size` messages polled.
-  MessageBatch PollBatch(std::size_t max_batch_size, engine::Deadline deadline);
+  /// @brief Polls the messages in one `rd_kafka_consume_batch_queue` call
+  /// until `deadline` is reached or `max_batch_size` messages polled.
+  /// @param group_by_partition makes the messages of each topic partition
+  /// contiguous, ordered by topic and partition. The order of messages within
+  /// a partition is kept
+  /// @note Messages with errors are skipped
+  MessageBatch PollBatch(std::size_t max_batch_size, engine::Deadline deadline,
+                         bool group_by_partition = false);
 
   const Stats& GetStats() const;
 
@@ -67,15 +81,23 @@ class ConsumerImpl final {
 
   /// @brief Callback that is called on each group join/leave and topic
   /// partition update. Used as a dispatcher of rebalance events.
+  /// @note With `cooperative-sticky` partition assignment strategy the
+  /// rebalance is incremental: only the moved partitions are revoked and
+  /// assigned, the rest are consumed without a pause
   void RebalanceCallbackProxy(rd_kafka_resp_err_t err,
                               rd_kafka_topic_partition_list_s* partitions);
 
   /// @brief Assigns (subscribes) the `partitions` list to the current
-  /// consumer.
-  void AssignPartitions(const rd_kafka_topic_partition_list_s* partitions);
+  /// consumer. If `incremental`, the `partitions` are added to the current
+  /// assignment, otherwise they replace it.
+  void AssignPartitions(const rd_kafka_topic_partition_list_s* partitions,
+                        bool incremental);
 
-  /// @brief Revokes `partitions` from the current consumer.
-  void RevokePartitions(const rd_kafka_topic_partition_list_s* partitions);
+  /// @brief Commits the offsets of the processed messages of `partitions`
+  /// and revokes `partitions` from the current consumer. If not
+  /// `incremental`, the whole assignment is revoked.
+  void RevokePartitions(const rd_kafka_topic_partition_list_s* partitions,
+                        bool incremental);
 
   /// @brief Callback which is called after succeeded/failed commit.
   /// Currently, used for logging purposes.
@@ -88,10 +110,29 @@ class ConsumerImpl final {
 
   void AccountPolledMessageStat(const Message& polled_message);
 
+  /// @brief Synchronously commits the offsets of the successfully processed
+  /// messages of `partitions`, so that no processed messages come to the
+  /// consumer the partitions are moved to.
+  void CommitProcessedOffsets(
+      const rd_kafka_topic_partition_list_s* partitions);
+
+  void ForgetProcessedOffsets(
+      const rd_kafka_topic_partition_list_s* partitions);
+
+  void AccountRebalanceFinished();
+
  private:
   const std::string component_name_;
+  const bool enable_auto_commit_;
   Stats stats_;
 
+  /// Next offsets to commit for the partitions, by topic and partition.
+  /// Only accessed from the polling task and the rebalance callbacks,
+  /// that are called from the polling functions
+  std::map<std::tuple<std::string, std::int32_t>, std::int64_t, std::less<>>
+      processed_offsets_;
+  std::optional<std::chrono::steady_clock::time_point> rebalance_start_;
+
   class ConsumerHolder;
   class ConfHolder final {
     using HandleHolder =
@@ -129,10 +170,17 @@ class ConsumerImpl final {
 
     rd_kafka_t* Handle();
 
+    /// @brief Queue of the messages of all assigned partitions.
+    rd_kafka_queue_t* Queue();
+
    private:
     using HandleHolder =
         std::unique_ptr<rd_kafka_t, decltype(&rd_kafka_destroy)>;
+    using QueueHolder =
+        std::unique_ptr<rd_kafka_queue_t, decltype(&rd_kafka_queue_destroy)>;
     HandleHolder handle_{nullptr, rd_kafka_destroy};
+    // destroyed before the handle
+    QueueHolder queue_{nullptr, rd_kafka_queue_destroy};
   };
   std::optional<ConsumerHolder> consumer_;
 };
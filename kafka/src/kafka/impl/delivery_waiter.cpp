@@ -1,5 +1,11 @@
 #include <kafka/impl/delivery_waiter.hpp>
 
+#include <mutex>
+
+#include <userver/engine/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utils/assert.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace kafka::impl {
@@ -44,8 +50,56 @@ bool DeliveryWaiter::LastRetry() const {
   return current_retry_ == max_retries_;
 }
 
-void DeliveryWaiter::SetDeliveryResult(DeliveryResult delivery_result) {
+void DeliveryWaiter::Complete(DeliveryResult delivery_result) {
   wait_handle_.set_value(std::move(delivery_result));
+  delete this;
+}
+
+std::shared_ptr<BatchDeliveryWaiter> BatchDeliveryWaiter::Create(
+    std::size_t size) {
+  std::shared_ptr<BatchDeliveryWaiter> batch{new BatchDeliveryWaiter(size)};
+  if (size) batch->self_ = batch;
+  return batch;
+}
+
+BatchDeliveryWaiter::BatchDeliveryWaiter(std::size_t size) : pending_(size) {
+  slots_.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    slots_.emplace_back(*this);
+  }
+}
+
+DeliveryReceiver* BatchDeliveryWaiter::GetReceiver(std::size_t index) {
+  UASSERT(index < slots_.size());
+  return &slots_[index];
+}
+
+bool BatchDeliveryWaiter::IsReady(std::size_t index) const {
+  UASSERT(index < slots_.size());
+  const std::lock_guard lock{mutex_};
+  return slots_[index].result.has_value();
+}
+
+DeliveryResult BatchDeliveryWaiter::Wait(std::size_t index) const {
+  UASSERT(index < slots_.size());
+  std::unique_lock lock{mutex_};
+  const auto& result = slots_[index].result;
+  if (!delivered_.Wait(lock, [&result] { return result.has_value(); })) {
+    throw engine::WaitInterruptedException(
+        engine::current_task::CancellationReason());
+  }
+  return *result;
+}
+
+void BatchDeliveryWaiter::Slot::Complete(DeliveryResult delivery_result) {
+  // released after the mutex is unlocked, as it may destroy the batch
+  std::shared_ptr<BatchDeliveryWaiter> released;
+  {
+    const std::lock_guard lock{batch_->mutex_};
+    result.emplace(std::move(delivery_result));
+    if (--batch_->pending_ == 0) released = std::move(batch_->self_);
+  }
+  batch_->delivered_.NotifyAll();
 }
 
 }  // namespace kafka::impl
@@ -1,8 +1,14 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
 
+#include <userver/engine/condition_variable.hpp>
 #include <userver/engine/future.hpp>
+#include <userver/engine/mutex.hpp>
 
 #include <librdkafka/rdkafka.h>
 
@@ -31,19 +37,35 @@ class DeliveryResult {
   const std::optional<rd_kafka_msg_status_t> message_status_;
 };
 
+/// @brief Receiver of a message delivery report. The pointer to the receiver
+/// is passed to `librdkafka` as the message opaque
+class DeliveryReceiver {
+ public:
+  virtual bool FirstSend() const = 0;
+
+  virtual bool LastRetry() const = 0;
+
+  /// @brief Sets the delivery result and releases the receiver
+  virtual void Complete(DeliveryResult delivery_result) = 0;
+
+ protected:
+  ~DeliveryReceiver() = default;
+};
+
 /// @brief State for waiting delivery callback invoked after producer send
 /// called
-class DeliveryWaiter {
+class DeliveryWaiter final : public DeliveryReceiver {
  public:
   DeliveryWaiter(std::uint32_t current_retry, std::uint32_t max_retries);
 
   engine::Future<DeliveryResult> GetFuture();
 
-  bool FirstSend() const;
+  bool FirstSend() const override;
 
-  bool LastRetry() const;
+  bool LastRetry() const override;
 
-  void SetDeliveryResult(DeliveryResult delivery_result);
+  /// @brief Sets the delivery result and deletes the waiter
+  void Complete(DeliveryResult delivery_result) override;
 
  private:
   const std::uint32_t current_retry_;
@@ -52,6 +74,50 @@ class DeliveryWaiter {
   engine::Promise<DeliveryResult> wait_handle_;
 };
 
+/// @brief State for waiting the delivery callbacks of the messages sent in
+/// one batch.
+///
+/// The batch is kept alive until every message gets its delivery result.
+/// The messages of a batch are not retried.
+class BatchDeliveryWaiter final {
+ public:
+  static std::shared_ptr<BatchDeliveryWaiter> Create(std::size_t size);
+
+  /// @brief Receiver of the `index`-th message delivery report
+  DeliveryReceiver* GetReceiver(std::size_t index);
+
+  bool IsReady(std::size_t index) const;
+
+  /// @brief Waits for the delivery result of the `index`-th message
+  /// @throws engine::WaitInterruptedException on cancellation
+  DeliveryResult Wait(std::size_t index) const;
+
+ private:
+  class Slot final : public DeliveryReceiver {
+   public:
+    explicit Slot(BatchDeliveryWaiter& batch) : batch_(&batch) {}
+
+    bool FirstSend() const override { return true; }
+
+    bool LastRetry() const override { return true; }
+
+    void Complete(DeliveryResult delivery_result) override;
+
+    std::optional<DeliveryResult> result;
+
+   private:
+    BatchDeliveryWaiter* batch_;
+  };
+
+  explicit BatchDeliveryWaiter(std::size_t size);
+
+  mutable engine::Mutex mutex_;
+  mutable engine::ConditionVariable delivered_;
+  std::vector<Slot> slots_;
+  std::size_t pending_;
+  std::shared_ptr<BatchDeliveryWaiter> self_;
+};
+
 }  // namespace kafka::impl
 
 USERVER_NAMESPACE_END
@@ -8,7 +8,9 @@
 #include <kafka/impl/error_buffer.hpp>
 #include <kafka/impl/stats.hpp>
 
+#include <limits>
 #include <utility>
+#include <vector>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -16,6 +18,9 @@ namespace kafka::impl {
 
 namespace {
 
+using TopicHolder =
+    std::unique_ptr<rd_kafka_topic_t, decltype(&rd_kafka_topic_destroy)>;
+
 void ErrorCallback(rd_kafka_t* producer, int error_code, const char* reason,
                    void* opaque_ptr) {
   UASSERT(producer);
@@ -103,7 +108,7 @@ void ProducerImpl::DeliveryReportCallbackProxy(
 
   const char* topic_name = rd_kafka_topic_name(message->rkt);
 
-  auto* complete_handle = static_cast<DeliveryWaiter*>(message->_private);
+  auto* complete_handle = static_cast<DeliveryReceiver*>(message->_private);
 
   auto& topic_stats = stats_.topics_stats[topic_name];
   if (complete_handle->FirstSend()) {
@@ -138,8 +143,7 @@ void ProducerImpl::DeliveryReportCallbackProxy(
                                  topic_name, rd_kafka_err2str(message->err));
   }
 
-  complete_handle->SetDeliveryResult(std::move(delivery_result));
-  delete complete_handle;
+  complete_handle->Complete(std::move(delivery_result));
 }
 
 ProducerImpl::ProducerImpl(std::unique_ptr<Configuration> configuration)
@@ -228,7 +232,8 @@ DeliveryResult ProducerImpl::SendImpl(const std::string& topic_name,
       RD_KAFKA_V_VALUE(const_cast<char*>(message.data()), message.size()),
       RD_KAFKA_V_MSGFLAGS(0),
       RD_KAFKA_V_PARTITION(partition.value_or(RD_KAFKA_PARTITION_UA)),
-      RD_KAFKA_V_OPAQUE(waiter.release()), RD_KAFKA_V_END);
+      RD_KAFKA_V_OPAQUE(static_cast<DeliveryReceiver*>(waiter.release())),
+      RD_KAFKA_V_END);
   // NOLINTEND(clang-analyzer-cplusplus.NewDeleteLeaks,cppcoreguidelines-pro-type-const-cast)
 
 #ifdef __clang__
@@ -248,6 +253,71 @@ DeliveryResult ProducerImpl::SendImpl(const std::string& topic_name,
   return wait_handle.get();
 }
 
+std::shared_ptr<BatchDeliveryWaiter> ProducerImpl::SendBatch(
+    const std::string& topic_name,
+    utils::span<const Producer::BatchMessage> messages) const {
+  LOG_INFO() << fmt::format("Batch of {} messages to topic '{}' is requested "
+                            "to send",
+                            messages.size(), topic_name);
+
+  UINVARIANT(messages.size() <=
+                 static_cast<std::size_t>(std::numeric_limits<int>::max()),
+             "Too many messages in the batch");
+  auto batch = BatchDeliveryWaiter::Create(messages.size());
+  if (messages.empty()) return batch;
+
+  const TopicHolder topic{
+      rd_kafka_topic_new(producer_.Handle(), topic_name.c_str(), nullptr),
+      &rd_kafka_topic_destroy};
+  if (!topic) {
+    const auto error = rd_kafka_last_error();
+    LOG_WARNING() << fmt::format("Failed to create topic '{}' handle: {}",
+                                 topic_name, rd_kafka_err2str(error));
+    for (std::size_t i = 0; i < messages.size(); ++i) {
+      batch->GetReceiver(i)->Complete(DeliveryResult{error});
+    }
+    return batch;
+  }
+
+  /// As in `SendImpl`, 0 msgflags implies no payload copying, so the
+  /// payloads are referenced until the delivery reports.
+  /// `RD_KAFKA_MSG_F_PARTITION` makes `librdkafka` use the partition of
+  /// each message, the partitioner is used for `RD_KAFKA_PARTITION_UA`
+  std::vector<rd_kafka_message_t> native_messages(messages.size());
+  for (std::size_t i = 0; i < messages.size(); ++i) {
+    const auto& message = messages[i];
+    auto& native_message = native_messages[i];
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-const-cast)
+    native_message.payload = const_cast<char*>(message.message.data());
+    native_message.len = message.message.size();
+    native_message.key = const_cast<char*>(message.key.data());
+    native_message.key_len = message.key.size();
+    // NOLINTEND(cppcoreguidelines-pro-type-const-cast)
+    native_message.partition =
+        message.partition.value_or(RD_KAFKA_PARTITION_UA);
+    native_message._private = batch->GetReceiver(i);
+  }
+
+  const int enqueued = rd_kafka_produce_batch(
+      topic.get(), RD_KAFKA_PARTITION_UA, RD_KAFKA_MSG_F_PARTITION,
+      native_messages.data(), static_cast<int>(native_messages.size()));
+  if (static_cast<std::size_t>(enqueued) != native_messages.size()) {
+    LOG_WARNING() << fmt::format(
+        "Failed to enqueue {} of {} messages to Kafka local queue",
+        native_messages.size() - enqueued, native_messages.size());
+
+    /// delivery reports are invoked for the enqueued messages only
+    for (std::size_t i = 0; i < native_messages.size(); ++i) {
+      if (native_messages[i].err != RD_KAFKA_RESP_ERR_NO_ERROR) {
+        batch->GetReceiver(i)->Complete(
+            DeliveryResult{native_messages[i].err});
+      }
+    }
+  }
+
+  return batch;
+}
+
 const Stats& ProducerImpl::GetStats() const { return stats_; }
 
 }  // namespace kafka::impl
@@ -5,6 +5,9 @@
 #include <memory>
 #include <optional>
 
+#include <userver/kafka/producer.hpp>
+#include <userver/utils/span.hpp>
+
 #include <kafka/impl/delivery_waiter.hpp>
 #include <kafka/impl/stats.hpp>
 
@@ -29,6 +32,12 @@ class ProducerImpl final {
             std::string_view message, std::optional<std::uint32_t> partition,
             std::uint32_t max_retries) const;
 
+  /// @brief Enqueues the messages in one call without waiting for their
+  /// delivery.
+  std::shared_ptr<BatchDeliveryWaiter> SendBatch(
+      const std::string& topic_name,
+      utils::span<const Producer::BatchMessage> messages) const;
+
   /// @brief Polls for delivery events for `poll_timeout_` milliseconds
   void Poll(std::chrono::milliseconds poll_timeout) const;
 
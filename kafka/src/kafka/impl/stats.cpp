@@ -30,6 +30,17 @@ void DumpMetric(utils::statistics::Writer& writer, const Stats& stats) {
   }
   writer["connections_error"].ValueWithLabels(
       stats.connections_error.Load(), {kSolomonLabel, "component_name"});
+
+  if (auto rebalance = writer["rebalance"]) {
+    const auto duration =
+        stats.rebalance.duration_ms.GetStatsForPeriod().GetCurrent();
+    rebalance["rebalances_total"] = stats.rebalance.rebalances_total.Load();
+    rebalance["partitions_assigned"] =
+        stats.rebalance.partitions_assigned.Load();
+    rebalance["partitions_revoked"] = stats.rebalance.partitions_revoked.Load();
+    rebalance["avg_ms_duration"] = duration.average;
+    rebalance["max_ms_duration"] = duration.maximum;
+  }
 }
 
 }  // namespace kafka::impl
@@ -25,9 +25,20 @@ struct TopicStats final {
       avg_ms_spent_time;
 };
 
+struct RebalanceStats final {
+  utils::statistics::RelaxedCounter<uint64_t> rebalances_total = 0;
+  utils::statistics::RelaxedCounter<uint64_t> partitions_assigned = 0;
+  utils::statistics::RelaxedCounter<uint64_t> partitions_revoked = 0;
+  /// Time from the first rebalance callback to the end of the assignment
+  utils::statistics::RecentPeriod<MinMaxAvg, MinMaxAvg,
+                                  utils::datetime::SteadyClock>
+      duration_ms;
+};
+
 struct Stats final {
   rcu::RcuMap<std::string, TopicStats> topics_stats;
   utils::statistics::RelaxedCounter<uint64_t> connections_error = 0;
+  RebalanceStats rebalance;
 };
 
 void DumpMetric(utils::statistics::Writer& writer, const Stats& stats);
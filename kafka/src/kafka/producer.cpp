@@ -7,6 +7,7 @@
 #include <userver/utils/text_light.hpp>
 
 #include <kafka/impl/configuration.hpp>
+#include <kafka/impl/delivery_waiter.hpp>
 #include <kafka/impl/producer_impl.hpp>
 #include <kafka/impl/stats.hpp>
 
@@ -14,6 +15,20 @@ USERVER_NAMESPACE_BEGIN
 
 namespace kafka {
 
+DeliveryFuture::DeliveryFuture(std::shared_ptr<impl::BatchDeliveryWaiter> batch,
+                               std::size_t index)
+    : batch_(std::move(batch)), index_(index) {
+  UASSERT(batch_);
+}
+
+void DeliveryFuture::Get() const {
+  if (!batch_->Wait(index_).IsSuccess()) {
+    throw std::runtime_error{"Failed to deliver message of the batch"};
+  }
+}
+
+bool DeliveryFuture::IsReady() const { return batch_->IsReady(index_); }
+
 Producer::Producer(std::unique_ptr<impl::Configuration> configuration,
                    engine::TaskProcessor& producer_task_processor,
                    std::chrono::milliseconds poll_timeout,
@@ -99,6 +114,34 @@ engine::TaskWithResult<void> Producer::SendAsync(
       });
 }
 
+std::vector<DeliveryFuture> Producer::SendBatch(
+    const std::string& topic_name,
+    utils::span<const BatchMessage> messages) const {
+  InitProducerAndStartPollingIfFirstSend();
+
+  auto batch =
+      utils::Async(producer_task_processor_, "producer_send_batch",
+                   [this, &topic_name, messages] {
+                     ExtendCurrentSpan();
+
+                     auto result = producer_->SendBatch(topic_name, messages);
+
+                     for (const auto& message : messages) {
+                       SendToTestPoint(topic_name, message.key,
+                                       message.message);
+                     }
+                     return result;
+                   })
+          .Get();
+
+  std::vector<DeliveryFuture> futures;
+  futures.reserve(messages.size());
+  for (std::size_t i = 0; i < messages.size(); ++i) {
+    futures.push_back(DeliveryFuture{batch, i});
+  }
+  return futures;
+}
+
 void Producer::DumpMetric(utils::statistics::Writer& writer) const {
   if (!first_send_.load()) {
     impl::DumpMetric(writer, producer_->GetStats());
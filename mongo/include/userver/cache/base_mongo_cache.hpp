@@ -4,6 +4,10 @@
 /// @brief @copybrief components::MongoCache
 
 #include <chrono>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -15,6 +19,7 @@
 #include <userver/formats/bson/inline.hpp>
 #include <userver/formats/bson/value_builder.hpp>
 #include <userver/storages/mongo/collection.hpp>
+#include <userver/storages/mongo/exception.hpp>
 #include <userver/storages/mongo/operations.hpp>
 #include <userver/storages/mongo/options.hpp>
 #include <userver/tracing/span.hpp>
@@ -30,10 +35,16 @@ inline const std::string kFetchAndParseStage = "fetch_and_parse";
 inline constexpr std::chrono::milliseconds kCpuRelaxThreshold{10};
 inline constexpr std::chrono::milliseconds kCpuRelaxInterval{2};
 
+inline constexpr std::chrono::milliseconds kChangeStreamMaxAwaitTime{100};
+inline constexpr std::size_t kChangeStreamMaxEventsPerUpdate = 100'000;
+
 namespace impl {
 
 std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 
+// Hashable representation of a document `_id` of any type
+std::string GetMongoCacheDocumentId(const formats::bson::Value& id);
+
 }
 
 // clang-format off
@@ -47,6 +58,19 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 /// ### Avoiding memory leaks
 /// See components::CachingComponentBase
 ///
+/// ### Change streams
+/// With `kUseChangeStream` in traits incremental updates read the events of
+/// the collection change stream since the previous update, and apply them to
+/// the copy of the cache, including the deletions. No update field is needed
+/// then. The stream is resumed from the token stored on the previous update,
+/// the full update opens the stream before reading the collection.
+/// If the token is lost (e.g. it is not in the oplog anymore, or the cache was
+/// loaded from a dump) or the collection is dropped or renamed, the update is
+/// done as a full one.
+///
+/// The cache keeps the keys of the documents by their `_id` to apply the
+/// deletions, so it takes more memory. Change streams require a replica set.
+///
 /// ## Static options:
 /// All options of CachingComponentBase and
 /// Name | Description | Default value
@@ -111,6 +135,10 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 ///   // Whether update part of the cache even if failed to parse some documents
 ///   static constexpr bool kAreInvalidDocumentsSkipped = false;
 ///
+///   // Whether incremental updates apply the change stream of the collection
+///   // instead of querying the changed documents (optional, false by default)
+///   static constexpr bool kUseChangeStream = true;
+///
 ///   // Component to get the collections
 ///   using MongoCollectionsComponent = components::MongoCollections;
 /// };
@@ -151,10 +179,22 @@ class MongoCache
   std::unique_ptr<typename MongoCacheTraits::DataType> GetData(
       cache::UpdateType type);
 
+  using KeyType = typename MongoCacheTraits::DataType::key_type;
+  using KeysById = std::unordered_map<std::string, KeyType>;
+
+  storages::mongo::ChangeStream OpenChangeStream() const;
+
+  /// Returns false if the events can't be applied and a full update is needed
+  bool ApplyChangeStream(cache::UpdateStatisticsScope& stats_scope);
+
   const std::shared_ptr<CollectionsType> mongo_collections_;
   const storages::mongo::Collection* const mongo_collection_;
   const std::chrono::system_clock::duration correction_;
   std::size_t cpu_relax_iterations_{0};
+
+  // Change stream state of the current cache data
+  std::optional<formats::bson::Document> resume_token_;
+  KeysById keys_by_id_;
 };
 
 template <class MongoCacheTraits>
@@ -180,7 +220,8 @@ MongoCache<MongoCacheTraits>::MongoCache(const ComponentConfig& config,
           typename MongoCacheTraits::DataType>::GetAllowedUpdateTypes() ==
           cache::AllowedUpdateTypes::kFullAndIncremental &&
       !mongo_cache::impl::kHasUpdateFieldName<MongoCacheTraits> &&
-      !mongo_cache::impl::kHasFindOperation<MongoCacheTraits>) {
+      !mongo_cache::impl::kHasFindOperation<MongoCacheTraits> &&
+      !mongo_cache::impl::IsChangeStreamUsed<MongoCacheTraits>()) {
     throw std::logic_error(fmt::format(
         "Incremental update support is requested in config but no update field "
         "name is specified in traits of '{}' cache",
@@ -209,6 +250,27 @@ void MongoCache<MongoCacheTraits>::Update(
     cache::UpdateStatisticsScope& stats_scope) {
   namespace sm = storages::mongo;
 
+  constexpr bool kUseChangeStream =
+      mongo_cache::impl::IsChangeStreamUsed<MongoCacheTraits>();
+  [[maybe_unused]] std::optional<formats::bson::Document> resume_token;
+  [[maybe_unused]] KeysById keys_by_id;
+  if constexpr (kUseChangeStream) {
+    if (type == cache::UpdateType::kIncremental) {
+      if (ApplyChangeStream(stats_scope)) return;
+      type = cache::UpdateType::kFull;
+    }
+
+    // The changes made while the collection is read are applied again by the
+    // next incremental update, that leads to the same result
+    try {
+      resume_token = OpenChangeStream().GetResumeToken();
+    } catch (const sm::MongoException& e) {
+      LOG_ERROR() << "Failed to open change stream of cache "
+                  << MongoCacheTraits::kName
+                  << ", incremental updates will be full: " << e;
+    }
+  }
+
   const auto* collection = mongo_collection_;
   auto find_op = GetFindOperation(type, last_update, now, correction_);
   auto cursor = collection->Execute(find_op);
@@ -241,6 +303,9 @@ void MongoCache<MongoCacheTraits>::Update(
 
       if (type == cache::UpdateType::kIncremental ||
           new_cache->count(key) == 0) {
+        if constexpr (kUseChangeStream) {
+          keys_by_id.emplace(impl::GetMongoCacheDocumentId(doc["_id"]), key);
+        }
         (*new_cache)[key] = std::move(object);
       } else {
         LOG_LIMITED_ERROR() << "Found duplicate key for 2 items in cache "
@@ -271,7 +336,135 @@ void MongoCache<MongoCacheTraits>::Update(
 
   const auto size = new_cache->size();
   this->Set(std::move(new_cache));
+  if constexpr (kUseChangeStream) {
+    resume_token_ = std::move(resume_token);
+    keys_by_id_ = std::move(keys_by_id);
+  }
+  stats_scope.Finish(size);
+}
+
+template <class MongoCacheTraits>
+storages::mongo::ChangeStream MongoCache<MongoCacheTraits>::OpenChangeStream()
+    const {
+  namespace sm = storages::mongo;
+
+  sm::operations::Watch watch_op{formats::bson::MakeArray()};
+  watch_op.SetOption(sm::options::FullDocumentLookup{});
+  watch_op.SetOption(sm::options::MaxAwaitTime{kChangeStreamMaxAwaitTime});
+  if (resume_token_) {
+    watch_op.SetOption(sm::options::ResumeAfter{*resume_token_});
+  }
+  if (MongoCacheTraits::kIsSecondaryPreferred) {
+    watch_op.SetOption(sm::options::ReadPreference::kSecondaryPreferred);
+  }
+  return mongo_collection_->Execute(watch_op);
+}
+
+template <class MongoCacheTraits>
+bool MongoCache<MongoCacheTraits>::ApplyChangeStream(
+    cache::UpdateStatisticsScope& stats_scope) {
+  namespace sm = storages::mongo;
+
+  if (!resume_token_) {
+    LOG_INFO() << "No change stream resume token in cache "
+               << MongoCacheTraits::kName << ", doing full update";
+    return false;
+  }
+
+  std::vector<formats::bson::Document> events;
+  std::optional<formats::bson::Document> resume_token;
+  try {
+    auto stream = OpenChangeStream();
+    while (events.size() < kChangeStreamMaxEventsPerUpdate) {
+      auto event = stream.Next();
+      if (!event) break;
+      events.push_back(*std::move(event));
+    }
+    resume_token = stream.GetResumeToken();
+  } catch (const sm::MongoException& e) {
+    LOG_WARNING() << "Failed to resume change stream of cache "
+                  << MongoCacheTraits::kName << ", doing full update: " << e;
+    resume_token_.reset();
+    return false;
+  }
+  if (!resume_token && !events.empty()) {
+    resume_token = events.back()["_id"];
+  }
+
+  if (events.empty()) {
+    if (resume_token) resume_token_ = std::move(resume_token);
+    LOG_INFO() << "No changes in cache " << MongoCacheTraits::kName;
+    stats_scope.FinishNoChanges();
+    return true;
+  }
+
+  auto scope = tracing::Span::CurrentSpan().CreateScopeTime("copy_data");
+  auto new_cache = GetData(cache::UpdateType::kIncremental);
+  auto keys_by_id = keys_by_id_;
+
+  scope.Reset(kFetchAndParseStage);
+  for (const auto& event : events) {
+    stats_scope.IncreaseDocumentsReadCount(1);
+
+    const auto operation_type = event["operationType"].As<std::string>();
+    if (operation_type == "delete") {
+      const auto it = keys_by_id.find(
+          impl::GetMongoCacheDocumentId(event["documentKey"]["_id"]));
+      if (it != keys_by_id.end()) {
+        new_cache->erase(it->second);
+        keys_by_id.erase(it);
+      }
+      continue;
+    }
+    if (operation_type == "drop" || operation_type == "rename" ||
+        operation_type == "dropDatabase" || operation_type == "invalidate") {
+      LOG_WARNING() << "Change stream of cache " << MongoCacheTraits::kName
+                    << " got '" << operation_type
+                    << "' event, doing full update";
+      resume_token_.reset();
+      return false;
+    }
+    if (operation_type != "insert" && operation_type != "replace" &&
+        operation_type != "update") {
+      continue;
+    }
+
+    const auto full_document = event["fullDocument"];
+    if (full_document.IsMissing() || full_document.IsNull()) {
+      // The document was deleted after the update, a delete event follows
+      continue;
+    }
+
+    try {
+      auto object = DeserializeObject(full_document);
+      auto key = (object.*MongoCacheTraits::kKeyField);
+
+      const auto [it, inserted] = keys_by_id.emplace(
+          impl::GetMongoCacheDocumentId(event["documentKey"]["_id"]), key);
+      if (!inserted && it->second != key) {
+        new_cache->erase(it->second);
+        it->second = key;
+      }
+      (*new_cache)[key] = std::move(object);
+    } catch (const std::exception& e) {
+      LOG_LIMITED_ERROR() << "Failed to deserialize cache item of cache "
+                          << MongoCacheTraits::kName << ", _id="
+                          << full_document["_id"]
+                                 .template ConvertTo<std::string>()
+                          << ", what(): " << e;
+      stats_scope.IncreaseDocumentsParseFailures(1);
+
+      if (!MongoCacheTraits::kAreInvalidDocumentsSkipped) throw;
+    }
+  }
+  scope.Reset();
+
+  const auto size = new_cache->size();
+  this->Set(std::move(new_cache));
+  resume_token_ = std::move(resume_token);
+  keys_by_id_ = std::move(keys_by_id);
   stats_scope.Finish(size);
+  return true;
 }
 
 template <class MongoCacheTraits>
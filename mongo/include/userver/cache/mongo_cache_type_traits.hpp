@@ -94,6 +94,21 @@ template <typename T>
 inline constexpr bool kHasDefaultFindOperation =
     meta::kIsDetected<HasDefaultFindOperation, T>;
 
+template <typename T>
+using HasUseChangeStream = decltype(T::kUseChangeStream);
+template <typename T>
+inline constexpr bool kHasUseChangeStream =
+    meta::kIsDetected<HasUseChangeStream, T>;
+
+template <typename T>
+constexpr bool IsChangeStreamUsed() {
+  if constexpr (kHasUseChangeStream<T>) {
+    return T::kUseChangeStream;
+  } else {
+    return false;
+  }
+}
+
 template <typename T>
 using HasInvalidDocumentsSkipped = decltype(T::kAreInvalidDocumentsSkipped);
 template <typename T>
@@ -130,6 +145,13 @@ struct CheckTraits {
               bool>,
           "Mongo cache traits must specify kUseDefaultFindOperation as bool");
     }
+    if constexpr (kHasUseChangeStream<MongoCacheTraits>) {
+      static_assert(
+          std::is_same_v<
+              std::decay_t<decltype(MongoCacheTraits::kUseChangeStream)>,
+              bool>,
+          "Mongo cache traits must specify kUseChangeStream as bool");
+    }
   }
 
   static_assert(kHasCollectionsField<MongoCacheTraits>,
@@ -72,6 +72,15 @@ JsonString ToLegacyJsonString(const formats::bson::Document&);
 /// element is encoded as a JSON array, rather than a JSON document.
 JsonString ToArrayJsonString(const formats::bson::Value&);
 
+/// @brief SAX serialization of BSON into JSON.
+///
+/// Walks the BSON bytes and writes them directly into the builder, types are
+/// mapped the same way as in `ConvertTo<formats::json::Value>()`.
+void WriteToStream(const Value& value, json::StringBuilder& sw);
+
+/// @copydoc WriteToStream(const Value&, json::StringBuilder&)
+void WriteToStream(const Document& document, json::StringBuilder& sw);
+
 namespace impl {
 class JsonStringImpl;
 }  // namespace impl
@@ -13,6 +13,7 @@
 #include <userver/formats/bson/types.hpp>
 #include <userver/formats/common/items.hpp>
 #include <userver/formats/common/meta.hpp>
+#include <userver/formats/json_fwd.hpp>
 #include <userver/formats/parse/common.hpp>
 #include <userver/formats/parse/common_containers.hpp>
 
@@ -273,6 +274,8 @@ class Value {
   friend Timestamp Parse(const Value& value, parse::To<Timestamp>);
   friend Document Parse(const Value& value, parse::To<Document>);
 
+  friend void WriteToStream(const Value& value, json::StringBuilder& sw);
+
   impl::ValueImplPtr impl_;
 };
 
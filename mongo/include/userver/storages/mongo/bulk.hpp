@@ -76,7 +76,7 @@ class Bulk {
   friend class storages::mongo::impl::cdriver::CDriverCollectionImpl;
 
   class Impl;
-  static constexpr size_t kSize = 56;
+  static constexpr size_t kSize = 104;
   static constexpr size_t kAlignment = 8;
   // MAC_COMPAT: std::string size differs
   utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
@@ -0,0 +1,50 @@
+#pragma once
+
+/// @file userver/storages/mongo/change_stream.hpp
+/// @brief @copybrief storages::mongo::ChangeStream
+
+#include <memory>
+#include <optional>
+
+#include <userver/formats/bson/document.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+
+namespace impl {
+class ChangeStreamImpl;
+}  // namespace impl
+
+/// @brief MongoDB change stream, see storages::mongo::Collection::Watch
+///
+/// Holds a connection of the pool until destroyed.
+class ChangeStream {
+ public:
+  explicit ChangeStream(std::unique_ptr<impl::ChangeStreamImpl>&&);
+  ~ChangeStream();
+
+  ChangeStream(ChangeStream&&) noexcept;
+  ChangeStream& operator=(ChangeStream&&) noexcept;
+
+  /// @brief Returns the next change event, waiting for it for at most
+  /// options::MaxAwaitTime
+  /// @returns std::nullopt if no events came in time
+  /// @throws MongoException on errors, including the resume token that is
+  /// not in the oplog anymore
+  std::optional<formats::bson::Document> Next();
+
+  /// @brief Returns the token to resume the stream after the last returned
+  /// event, see options::ResumeAfter
+  ///
+  /// The token advances even if no events come, so that an idle stream
+  /// stays resumable.
+  std::optional<formats::bson::Document> GetResumeToken() const;
+
+ private:
+  std::unique_ptr<impl::ChangeStreamImpl> impl_;
+};
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
@@ -61,9 +61,11 @@ namespace components {
 /// idle_limit | limit for idle connections number | 64
 /// connecting_limit | limit for establishing connections number | 8
 /// local_threshold | latency window for instance selection | mongodb default
+/// latency_aware_reads | route secondary reads to the servers with the lowest observed latency within local_threshold | false
 /// max_replication_lag | replication lag limit for usable secondaries, min. 90s | -
 /// maintenance_period | pool maintenance period (idle connections pruning etc.) | 15s
 /// stats_verbosity | changes the granularity of reported metrics | 'terse'
+/// max_bulk_parallelism | limit of concurrently executed chunks of an unordered bulk operation | 1
 /// dns_resolver | server hostname resolver type (getaddrinfo or async) | 'async'
 ///
 /// `stats_verbosity` accepts one of the following values:
@@ -162,8 +164,10 @@ inline constexpr bool kHasValidate<Mongo> = true;
 /// idle_limit | limit for idle connections number (per database) | 64
 /// connecting_limit | limit for establishing connections number (per database) | 8
 /// local_threshold | latency window for instance selection | mongodb default
+/// latency_aware_reads | route secondary reads to the servers with the lowest observed latency within local_threshold | false
 /// max_replication_lag | replication lag limit for usable secondaries, min. 90s | -
 /// stats_verbosity | changes the granularity of reported metrics | 'terse'
+/// max_bulk_parallelism | limit of concurrently executed chunks of an unordered bulk operation | 1
 /// dns_resolver | server hostname resolver type (getaddrinfo or async) | 'async'
 ///
 /// `stats_verbosity` accepts one of the following values:
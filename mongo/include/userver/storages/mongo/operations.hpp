@@ -97,12 +97,13 @@ class Find {
   void SetOption(options::Tailable);
   void SetOption(const options::Comment&);
   void SetOption(const options::MaxServerTime&);
+  void SetOption(options::Prefetch);
 
  private:
   friend class storages::mongo::impl::cdriver::CDriverCollectionImpl;
 
   class Impl;
-  static constexpr size_t kSize = 96;
+  static constexpr size_t kSize = 112;
   static constexpr size_t kAlignment = 8;
   // MAC_COMPAT: std::string size differs
   utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
@@ -339,6 +340,38 @@ class Aggregate {
   utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
 };
 
+/// @brief Opens a change stream of the collection
+/// @see https://www.mongodb.com/docs/manual/changeStreams/
+class Watch {
+ public:
+  /// @param pipeline an array of aggregation stages applied to the events,
+  /// may be empty
+  explicit Watch(formats::bson::Value pipeline);
+  ~Watch();
+
+  Watch(const Watch&);
+  Watch(Watch&&) noexcept;
+  Watch& operator=(const Watch&);
+  Watch& operator=(Watch&&) noexcept;
+
+  void SetOption(const options::ReadPreference&);
+  void SetOption(options::ReadPreference::Mode);
+  void SetOption(options::ReadConcern);
+  void SetOption(const options::Comment&);
+  void SetOption(const options::ResumeAfter&);
+  void SetOption(options::FullDocumentLookup);
+  void SetOption(const options::MaxAwaitTime&);
+
+ private:
+  friend class storages::mongo::impl::cdriver::CDriverCollectionImpl;
+
+  class Impl;
+  static constexpr size_t kSize = 120;
+  static constexpr size_t kAlignment = 8;
+  // MAC_COMPAT: std::string size differs
+  utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
+};
+
 class Drop {
  public:
   Drop();
@@ -300,6 +300,58 @@ class MaxServerTime {
   std::chrono::milliseconds value_;
 };
 
+/// @brief Makes a cursor read the next batch in background while the current
+/// one is being processed
+///
+/// The size of the batches requested from the server is adjusted to the size
+/// of the documents, so that a batch takes about `max_batch_bytes`. Besides
+/// the buffers of the driver, at most two such batches are kept in memory.
+/// @warning Must not be combined with options::Tailable, as the cursor would
+/// wait for new documents in background.
+class Prefetch {
+ public:
+  /// Default memory limit of a prefetched batch
+  static constexpr size_t kDefaultMaxBatchBytes = 4 * 1024 * 1024;
+
+  explicit Prefetch(size_t max_batch_bytes = kDefaultMaxBatchBytes)
+      : max_batch_bytes_(max_batch_bytes) {}
+
+  size_t MaxBatchBytes() const { return max_batch_bytes_; }
+
+ private:
+  size_t max_batch_bytes_;
+};
+
+/// @brief Resumes a change stream after the event with the token
+/// @see storages::mongo::ChangeStream::GetResumeToken
+class ResumeAfter {
+ public:
+  explicit ResumeAfter(formats::bson::Document token)
+      : token_(std::move(token)) {}
+
+  const formats::bson::Document& Value() const { return token_; }
+
+ private:
+  formats::bson::Document token_;
+};
+
+/// @brief Makes the update events of a change stream contain the current
+/// version of the whole document in `fullDocument` field
+class FullDocumentLookup {};
+
+/// @brief Specifies how long the server waits for new change stream events
+/// before returning an empty batch
+class MaxAwaitTime {
+ public:
+  explicit MaxAwaitTime(const std::chrono::milliseconds& value)
+      : value_(value) {}
+
+  const std::chrono::milliseconds& Value() const { return value_; }
+
+ private:
+  std::chrono::milliseconds value_;
+};
+
 }  // namespace storages::mongo::options
 
 USERVER_NAMESPACE_END
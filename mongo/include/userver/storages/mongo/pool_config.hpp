@@ -68,6 +68,8 @@ struct PoolConfig final {
   static constexpr auto kDefaultMaintenancePeriod = std::chrono::seconds{15};
   /// Default application name
   static constexpr char kDefaultAppName[] = "userver";
+  /// Default limit of concurrently executed chunks of a bulk operation
+  static constexpr size_t kDefaultMaxBulkParallelism = 1;
 
   /// @throws InvalidConfigException if the config is invalid
   void Validate(const std::string& pool_id) const;
@@ -82,6 +84,8 @@ struct PoolConfig final {
   PoolSettings pool_settings{};
   /// Instance selection latency window override
   std::optional<std::chrono::milliseconds> local_threshold{};
+  /// Whether to route secondary reads by the observed server latencies
+  bool latency_aware_reads{false};
   /// Pool maintenance period
   std::chrono::milliseconds maintenance_period = kDefaultMaintenancePeriod;
 
@@ -95,6 +99,8 @@ struct PoolConfig final {
 
   /// Whether to write detailed stats
   StatsVerbosity stats_verbosity = StatsVerbosity::kTerse;
+  /// Limit of concurrently executed chunks of an unordered bulk operation
+  size_t max_bulk_parallelism = kDefaultMaxBulkParallelism;
 
   /// Congestion control config
   congestion_control::v2::LinearController::StaticConfig cc_config;
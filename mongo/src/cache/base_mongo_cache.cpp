@@ -1,6 +1,8 @@
 #include <userver/cache/base_mongo_cache.hpp>
 
 #include <userver/components/component_config.hpp>
+#include <userver/formats/bson/binary.hpp>
+#include <userver/formats/bson/inline.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -12,6 +14,10 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(
   return config["update-correction"].As<std::chrono::milliseconds>(0);
 }
 
+std::string GetMongoCacheDocumentId(const formats::bson::Value& id) {
+  return formats::bson::ToBinaryString(formats::bson::MakeDoc("_id", id));
+}
+
 std::string GetMongoCacheSchema() {
   return R"(
 type: object
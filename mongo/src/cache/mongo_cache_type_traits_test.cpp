@@ -71,8 +71,20 @@ TEST(CheckTraits, FindOperation) {
                IncorrectSignatureOfFindOperation>);
 }
 
+struct ChangeStreamMongoCacheTraits : CorrectMongoCacheTraits {
+  static constexpr bool kUseChangeStream = true;
+};
+
 TEST(CheckTraits, CorrectTraits) {
   mongo_cache::impl::CheckTraits<CorrectMongoCacheTraits>{};
+  mongo_cache::impl::CheckTraits<ChangeStreamMongoCacheTraits>{};
+}
+
+TEST(CheckTraits, ChangeStream) {
+  EXPECT_FALSE(
+      mongo_cache::impl::IsChangeStreamUsed<CorrectMongoCacheTraits>());
+  EXPECT_TRUE(
+      mongo_cache::impl::IsChangeStreamUsed<ChangeStreamMongoCacheTraits>());
 }
 
 USERVER_NAMESPACE_END
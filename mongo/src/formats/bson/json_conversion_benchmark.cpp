@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+
+#include <userver/formats/bson.hpp>
+#include <userver/formats/bson/serialize.hpp>
+#include <userver/formats/json.hpp>
+#include <userver/formats/json/string_builder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kJson = R"({
+  "_id": "999002_00611f99bab343948edbfb9a0ec7eb39",
+  "name": "******",
+  "class": ["minivan", "business"],
+  "park_boost": 9.99,
+  "requirements": {"nosmoking": true, "childseat_amount": 0, "ski": true},
+  "car": {
+    "raw_model": "Volkswagen Caddy",
+    "age": 2014,
+    "allowed_tariffs": ["2", "3", "4"],
+    "model_boost": {},
+    "price": 922183.3333333334
+  },
+  "score": {"base_total": 0.5773503, "complete_daily": [1, 2, 3, 4, 5]},
+  "updated_ts": 1553506333
+})";
+
+}  // namespace
+
+void BsonToJsonConvert(benchmark::State& state) {
+  const auto bson = formats::bson::FromJsonString(kJson);
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(
+        formats::json::ToString(bson.ConvertTo<formats::json::Value>()));
+  }
+}
+BENCHMARK(BsonToJsonConvert);
+
+void BsonToJsonWriteToStream(benchmark::State& state) {
+  const auto bson = formats::bson::FromJsonString(kJson);
+  for ([[maybe_unused]] auto _ : state) {
+    formats::json::StringBuilder sb;
+    WriteToStream(bson, sb);
+    benchmark::DoNotOptimize(sb.GetString());
+  }
+}
+BENCHMARK(BsonToJsonWriteToStream);
+
+void JsonToBsonConvert(benchmark::State& state) {
+  const auto json = formats::json::FromString(kJson);
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(json.ConvertTo<formats::bson::Value>());
+  }
+}
+BENCHMARK(JsonToBsonConvert);
+
+USERVER_NAMESPACE_END
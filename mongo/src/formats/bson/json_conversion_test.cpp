@@ -11,6 +11,7 @@
 
 #include <userver/formats/bson.hpp>
 #include <userver/formats/json.hpp>
+#include <userver/formats/json/string_builder.hpp>
 #include <userver/utest/utest.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -325,4 +326,71 @@ TEST(Convert, FromJson) {
   EXPECT_THAT(bson, BsonMatcher(bb.ExtractValue()));
 }
 
+TEST(Convert, WriteToStream) {
+  const auto tp = std::chrono::system_clock::time_point{
+      std::chrono::milliseconds{1554138241}};
+
+  fb::ValueBuilder bb = kSimpleDoc;
+  bb["simple_doc"] = kSimpleDoc;
+  bb["empty_doc"] = fb::MakeDoc();
+  bb["simple_array"] = kSimpleBsonArray;
+  bb["empty_array"] = fb::MakeArray();
+  bb["null"] = nullptr;
+  bb["bool"] = true;
+  bb["int32"] = int32_t{2};
+  bb["escaped\"string"] = "\n\"";
+  bb["time_point"] = tp;
+  bb["timestamp"] = fb::Timestamp(1554138241, 1);
+  bb["decimal"] = fb::Decimal128("1.5");
+  bb["oid"] = fb::Oid::MakeMinimalFor(tp);
+  bb["binary"] = fb::Binary("some_binary_data");
+  bb["min_key"] = fb::MinKey{};
+  bb["max_key"] = fb::MaxKey{};
+  bb["nested"]["array"].PushBack(kSimpleDoc);
+  const fb::Document doc = bb.ExtractValue();
+
+  fj::StringBuilder sb;
+  WriteToStream(doc, sb);
+  EXPECT_EQ(fj::FromString(sb.GetStringView()), doc.ConvertTo<fj::Value>());
+
+  fj::StringBuilder value_sb;
+  WriteToStream(doc["nested"], value_sb);
+  EXPECT_EQ(fj::FromString(value_sb.GetStringView()),
+            doc["nested"].ConvertTo<fj::Value>());
+
+  fj::StringBuilder missing_sb;
+  WriteToStream(doc["missing"], missing_sb);
+  EXPECT_EQ(missing_sb.GetStringView(), "null");
+}
+
+TEST(Convert, FromJsonTypes) {
+  const auto json = fj::FromString(R"({
+    "int": 1,
+    "int64": 5000000000,
+    "double": 1.5,
+    "string": "a\u0000b",
+    "null": null,
+    "array": [true, {"nested": [[], {}]}]
+  })");
+  const auto bson = json.ConvertTo<fb::Value>();
+
+  EXPECT_TRUE(bson["int"].IsInt32());
+  EXPECT_TRUE(bson["int64"].IsInt64());
+  EXPECT_TRUE(bson["double"].IsDouble());
+  EXPECT_EQ(bson["string"].As<std::string>(), std::string("a\0b", 3));
+  EXPECT_TRUE(bson["null"].IsNull());
+  EXPECT_TRUE(bson["array"][0].As<bool>());
+  EXPECT_TRUE(bson["array"][1]["nested"][0].IsArray());
+  EXPECT_TRUE(bson["array"][1]["nested"][1].IsDocument());
+  EXPECT_EQ(bson.ConvertTo<fj::Value>(), json);
+
+  const auto array = json["array"].ConvertTo<fb::Value>();
+  EXPECT_TRUE(array.IsArray());
+  EXPECT_EQ(array.ConvertTo<fj::Value>(), json["array"]);
+
+  EXPECT_THROW(
+      fj::FromString(R"({"a": [18446744073709551615]})").ConvertTo<fb::Value>(),
+      fb::BsonException);
+}
+
 USERVER_NAMESPACE_END
@@ -1,17 +1,24 @@
 #include <userver/formats/bson/serialize.hpp>
 
 #include <ostream>
+#include <type_traits>
+
+#include <fmt/format.h>
 
 #include <bson/bson.h>
 
 #include <userver/formats/bson/exception.hpp>
 #include <userver/formats/bson/value_builder.hpp>
 #include <userver/formats/common/conversion_stack.hpp>
+#include <userver/formats/common/validations.hpp>
+#include <userver/formats/json/exception.hpp>
 #include <userver/formats/json/inline.hpp>
+#include <userver/formats/json/string_builder.hpp>
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/logging/log_helper.hpp>
 #include <userver/utils/text.hpp>
 
+#include <formats/bson/int_utils.hpp>
 #include <formats/bson/value_impl.hpp>
 #include <formats/bson/wrappers.hpp>
 
@@ -60,10 +67,72 @@ json::Value Convert(const bson::Value& bson, parse::To<json::Value>) {
   return std::move(conversion_stack).GetParsed().ExtractValue();
 }
 
+namespace {
+
+void AppendJson(bson_t* doc, std::string_view key, const json::Value& json);
+
+void AppendJsonItems(bson_t* doc, const json::Value& json) {
+  if (json.IsArray()) {
+    bson::impl::ArrayIndexer indexer;
+    for (const auto& item : json) {
+      AppendJson(doc, indexer.GetKey(), item);
+      indexer.Advance();
+    }
+  } else {
+    for (auto it = json.begin(); it != json.end(); ++it) {
+      AppendJson(doc, it.GetNameView(), *it);
+    }
+  }
+}
+
+void AppendJson(bson_t* doc, std::string_view key, const json::Value& json) {
+  if (json.IsBool()) {
+    bson_append_bool(doc, key.data(), key.size(), json.As<bool>());
+  } else if (json.IsInt()) {
+    bson_append_int32(doc, key.data(), key.size(), json.As<int>());
+  } else if (json.IsInt64()) {
+    bson_append_int64(doc, key.data(), key.size(), json.As<int64_t>());
+  } else if (json.IsUInt64()) {
+    bson_append_int64(doc, key.data(), key.size(),
+                      bson::impl::ToInt64(json.As<uint64_t>()));
+  } else if (json.IsDouble()) {
+    bson_append_double(
+        doc, key.data(), key.size(),
+        common::ValidateFloat<bson::BsonException>(json.As<double>()));
+  } else if (json.IsString()) {
+    const auto str = json.As<std::string>();
+    bson_append_utf8(doc, key.data(), key.size(), str.data(), str.size());
+  } else if (json.IsNull()) {
+    bson_append_null(doc, key.data(), key.size());
+  } else if (json.IsArray()) {
+    bson::impl::SubarrayBson subarray(doc, key.data(), key.size());
+    AppendJsonItems(subarray.Get(), json);
+  } else if (json.IsObject()) {
+    bson::impl::SubdocBson subdoc(doc, key.data(), key.size());
+    AppendJsonItems(subdoc.Get(), json);
+  } else {
+    throw json::Exception(fmt::format(
+        "Failed to convert value at '{}' from JSON to BSON: unknown node type",
+        json.GetPath()));
+  }
+}
+
+}  // namespace
+
 bson::Value Convert(const json::Value& json, parse::To<bson::Value>) {
   if (json.IsMissing()) {
     return bson::ValueBuilder{common::Type::kNull}.ExtractValue();
   }
+  if (json.IsArray() || json.IsObject()) {
+    // Append the members right into the resulting BSON, without building
+    // intermediate bson::Value nodes
+    bson::impl::MutableBson result;
+    AppendJsonItems(result.Get(), json);
+    return bson::Value(std::make_shared<bson::impl::ValueImpl>(
+        result.Extract(), json.IsArray()
+                            ? bson::impl::ValueImpl::DocumentKind::kArray
+                            : bson::impl::ValueImpl::DocumentKind::kDocument));
+  }
   return formats::common::PerformMinimalFormatConversion<bson::Value>(json);
 }
 
@@ -120,8 +189,115 @@ char FirstNonWhitespace(std::string_view str) {
   return 0;
 }
 
+void WriteNativeToStream(const bson_value_t& value, const Value& root,
+                         json::StringBuilder& sw);
+
+template <bool IsArray>
+void WriteItemsToStream(const bson_value_t& value, const Value& root,
+                        json::StringBuilder& sw) {
+  using Guard = std::conditional_t<IsArray, json::StringBuilder::ArrayGuard,
+                                   json::StringBuilder::ObjectGuard>;
+  const Guard guard(sw);
+
+  bson_iter_t it;
+  if (!bson_iter_init_from_data(&it, value.value.v_doc.data,
+                                value.value.v_doc.data_len)) {
+    throw ParseException(fmt::format("malformed BSON at {}", root.GetPath()));
+  }
+  while (bson_iter_next(&it)) {
+    const std::string_view key(bson_iter_key(&it), bson_iter_key_len(&it));
+    const bson_value_t* item = bson_iter_value(&it);
+    if (!item) {
+      throw ParseException(
+          fmt::format("malformed BSON element at {}.{}", root.GetPath(), key));
+    }
+    if constexpr (!IsArray) sw.Key(key);
+    WriteNativeToStream(*item, root, sw);
+  }
+}
+
+void WriteNativeToStream(const bson_value_t& value, const Value& root,
+                         json::StringBuilder& sw) {
+  switch (value.value_type) {
+    case BSON_TYPE_BOOL:
+      sw.WriteBool(value.value.v_bool);
+      break;
+    case BSON_TYPE_INT32:
+      sw.WriteInt64(value.value.v_int32);
+      break;
+    case BSON_TYPE_INT64:
+      sw.WriteInt64(value.value.v_int64);
+      break;
+    case BSON_TYPE_DOUBLE:
+      sw.WriteDouble(value.value.v_double);
+      break;
+    case BSON_TYPE_TIMESTAMP:
+      sw.WriteInt64(value.value.v_timestamp.timestamp);
+      break;
+    case BSON_TYPE_UTF8:
+      sw.WriteString({value.value.v_utf8.str, value.value.v_utf8.len});
+      break;
+    case BSON_TYPE_DECIMAL128: {
+      char buffer[BSON_DECIMAL128_STRING];
+      bson_decimal128_to_string(&value.value.v_decimal128, buffer);
+      sw.WriteString(buffer);
+      break;
+    }
+    case BSON_TYPE_DATE_TIME:
+      json::WriteToStream(std::chrono::system_clock::time_point{
+                              std::chrono::milliseconds{value.value.v_datetime}},
+                          sw);
+      break;
+    case BSON_TYPE_OID: {
+      char buffer[25];
+      bson_oid_to_string(&value.value.v_oid, buffer);
+      sw.WriteString({buffer, sizeof(buffer) - 1});
+      break;
+    }
+    case BSON_TYPE_BINARY:
+      sw.WriteString({reinterpret_cast<const char*>(value.value.v_binary.data),
+                      value.value.v_binary.data_len});
+      break;
+    case BSON_TYPE_MINKEY: {
+      const json::StringBuilder::ObjectGuard guard(sw);
+      sw.Key("$minKey");
+      sw.WriteInt64(1);
+      break;
+    }
+    case BSON_TYPE_MAXKEY: {
+      const json::StringBuilder::ObjectGuard guard(sw);
+      sw.Key("$maxKey");
+      sw.WriteInt64(1);
+      break;
+    }
+    case BSON_TYPE_NULL:
+      sw.WriteNull();
+      break;
+    case BSON_TYPE_ARRAY:
+      WriteItemsToStream<true>(value, root, sw);
+      break;
+    case BSON_TYPE_DOCUMENT:
+      WriteItemsToStream<false>(value, root, sw);
+      break;
+    default:
+      throw ConversionException("Value type is unknown", root.GetPath());
+  }
+}
+
 }  // namespace
 
+void WriteToStream(const Value& value, json::StringBuilder& sw) {
+  if (value.IsMissing()) {
+    sw.WriteNull();
+    return;
+  }
+  WriteNativeToStream(*value.impl_->GetNative(), value, sw);
+}
+
+void WriteToStream(const Document& document, json::StringBuilder& sw) {
+  WriteToStream(static_cast<const Value&>(document), sw);
+}
+
 Document FromJsonString(std::string_view json) {
   if (FirstNonWhitespace(json) != '{') {
     throw ParseException("Error parsing BSON from JSON: not an object");
@@ -1,6 +1,9 @@
 #include <formats/bson/value_impl.hpp>
 
+#include <algorithm>
 #include <cstring>
+#include <string_view>
+#include <vector>
 
 #include <formats/bson/wrappers.hpp>
 
@@ -172,9 +175,81 @@ bool operator==(const bson_value_t& lhs, const bson_value_t& rhs) {
 
 class ValueImpl::EmplaceEnabler {};
 
+// Members of a document sorted by key. Allows looking up a few members
+// without building ParsedDocument with a ValueImpl for every member.
+class ValueImpl::MemberIndex {
+ public:
+  MemberIndex(const bson_value_t& document, const Path& path,
+              Value::DuplicateFieldsPolicy duplicate_fields_policy) {
+    ForEachValue(document.value.v_doc.data, document.value.v_doc.data_len,
+                 path, [this, &path](bson_iter_t* it) {
+                   std::string_view key(bson_iter_key(it),
+                                        bson_iter_key_len(it));
+                   const bson_value_t* iter_value = bson_iter_value(it);
+                   if (!iter_value) {
+                     throw ParseException(
+                         fmt::format("malformed BSON element at {}.{}",
+                                     path.ToStringView(), key));
+                   }
+                   members_.push_back({key, *iter_value});
+                 });
+
+    std::stable_sort(members_.begin(), members_.end(),
+                     [](const Member& lhs, const Member& rhs) {
+                       return lhs.key < rhs.key;
+                     });
+    const auto is_same_key = [](const Member& lhs, const Member& rhs) {
+      return lhs.key == rhs.key;
+    };
+    const auto duplicate_it =
+        std::adjacent_find(members_.begin(), members_.end(), is_same_key);
+    if (duplicate_it == members_.end()) return;
+
+    switch (duplicate_fields_policy) {
+      case Value::DuplicateFieldsPolicy::kForbid:
+        throw ParseException(fmt::format("duplicate key '{}' at {}",
+                                         duplicate_it->key,
+                                         path.ToStringView()));
+      case Value::DuplicateFieldsPolicy::kUseFirst:
+        members_.erase(
+            std::unique(members_.begin(), members_.end(), is_same_key),
+            members_.end());
+        break;
+      case Value::DuplicateFieldsPolicy::kUseLast:
+        std::reverse(members_.begin(), members_.end());
+        members_.erase(
+            std::unique(members_.begin(), members_.end(), is_same_key),
+            members_.end());
+        std::reverse(members_.begin(), members_.end());
+        break;
+    }
+  }
+
+  const bson_value_t* Find(std::string_view key) const {
+    const auto it = std::lower_bound(
+        members_.begin(), members_.end(), key,
+        [](const Member& member, std::string_view key) {
+          return member.key < key;
+        });
+    if (it == members_.end() || it->key != key) return nullptr;
+    return &it->value;
+  }
+
+ private:
+  struct Member {
+    std::string_view key;
+    bson_value_t value;
+  };
+
+  std::vector<Member> members_;
+};
+
 ValueImpl::ValueImpl() : bson_value_(kDefaultBsonValue) {}
 
-ValueImpl::~ValueImpl() { delete parsed_value_.load(); }
+ValueImpl::~ValueImpl() {
+  delete parsed_value_.load();
+  delete member_index_.load();
+}
 
 ValueImpl::ValueImpl(std::nullptr_t) : bson_value_(kDefaultBsonValue) {
   bson_value_.value_type = BSON_TYPE_NULL;
@@ -324,6 +399,8 @@ ValueImpl& ValueImpl::operator=(ValueImpl&& rhs) noexcept {
 
   delete parsed_value_.load();
   parsed_value_ = rhs.parsed_value_.exchange(nullptr);
+  delete member_index_.load();
+  member_index_ = rhs.member_index_.exchange(nullptr);
 
   duplicate_fields_policy_ = rhs.duplicate_fields_policy_;
   return *this;
@@ -357,6 +434,7 @@ bson_type_t ValueImpl::Type() const { return bson_value_.value_type; }
 void ValueImpl::SetDuplicateFieldsPolicy(Value::DuplicateFieldsPolicy policy) {
   if (duplicate_fields_policy_ != policy) {
     delete parsed_value_.exchange(nullptr);
+    delete member_index_.exchange(nullptr);
     duplicate_fields_policy_ = policy;
   }
 }
@@ -364,10 +442,16 @@ void ValueImpl::SetDuplicateFieldsPolicy(Value::DuplicateFieldsPolicy policy) {
 ValueImplPtr ValueImpl::operator[](const std::string& name) {
   if (!IsMissing() && !IsNull()) {
     CheckIsDocument();
-    EnsureParsed();
-    const auto& parsed_doc = std::get<ParsedDocument>(*parsed_value_.load());
-    auto it = parsed_doc.find(name);
-    if (it != parsed_doc.end()) return it->second;
+    if (const auto* parsed_ptr = parsed_value_.load()) {
+      const auto& parsed_doc = std::get<ParsedDocument>(*parsed_ptr);
+      auto it = parsed_doc.find(name);
+      if (it != parsed_doc.end()) return it->second;
+    } else if (const auto* member = EnsureIndexed().Find(name)) {
+      // only the requested member is materialized
+      return std::make_shared<ValueImpl>(EmplaceEnabler{}, storage_, path_,
+                                         *member, duplicate_fields_policy_,
+                                         name);
+    }
   }
   return std::make_shared<ValueImpl>(EmplaceEnabler{}, nullptr, path_,
                                      kDefaultBsonValue,
@@ -389,8 +473,10 @@ bool ValueImpl::HasMember(const std::string& name) {
   if (IsMissing() || IsNull()) return false;
 
   CheckIsDocument();
-  EnsureParsed();
-  return std::get<ParsedDocument>(*parsed_value_.load()).count(name);
+  if (const auto* parsed_ptr = parsed_value_.load()) {
+    return std::get<ParsedDocument>(*parsed_ptr).count(name);
+  }
+  return EnsureIndexed().Find(name) != nullptr;
 }
 
 ValueImplPtr ValueImpl::GetOrInsert(const std::string& key) {
@@ -675,6 +761,20 @@ void ValueImpl::EnsureParsed() {
   }
 }
 
+const ValueImpl::MemberIndex& ValueImpl::EnsureIndexed() {
+  if (const auto* index = member_index_.load()) return *index;
+
+  auto index = std::make_unique<MemberIndex>(bson_value_, path_,
+                                             duplicate_fields_policy_);
+  // Same as for parsed_value_, concurrent readers may build the index
+  // simultaneously, only the first one is stored.
+  MemberIndex* expected = nullptr;
+  if (member_index_.compare_exchange_strong(expected, index.get())) {
+    return *index.release();
+  }
+  return *expected;
+}
+
 void ValueImpl::SyncBsonValue() {
   // either primitive type or was never touched
   if (parsed_value_.load() == nullptr) return;
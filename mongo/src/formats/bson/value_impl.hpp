@@ -101,6 +101,9 @@ class ValueImpl {
 
  private:
   class EmplaceEnabler;
+  class MemberIndex;
+
+  const MemberIndex& EnsureIndexed();
 
  public:
   using Storage = std::variant<std::nullptr_t, BsonHolder, std::string>;
@@ -118,6 +121,8 @@ class ValueImpl {
   Path path_;
   bson_value_t bson_value_;
   std::atomic<ParsedValue*> parsed_value_{nullptr};
+  // Allows member lookups in unparsed documents
+  std::atomic<MemberIndex*> member_index_{nullptr};
   Value::DuplicateFieldsPolicy duplicate_fields_policy_{
       Value::DuplicateFieldsPolicy::kForbid};
 };
@@ -234,6 +234,55 @@ TEST(BsonValue, DuplicateFieldsUseLast) {
   EXPECT_EQ("third", doc_use_last["a"].As<std::string>());
 }
 
+TEST(BsonValue, LazyMemberAccess) {
+  const fb::Document doc =
+      fb::MakeDoc("doc", kDoc, "int", 1, "str", "string", "null", nullptr);
+
+  EXPECT_EQ(doc["doc"]["doc"]["d"].As<double>(), -1.25);
+  EXPECT_EQ(doc["str"].As<std::string>(), "string");
+  EXPECT_EQ(doc["doc"]["arr"][1].As<std::string>(), "elem");
+  EXPECT_EQ(doc["doc"]["arr"].GetPath(), "doc.arr");
+  EXPECT_TRUE(doc["null"].IsNull());
+  EXPECT_TRUE(doc["missing"].IsMissing());
+  EXPECT_TRUE(doc.HasMember("int"));
+  EXPECT_FALSE(doc.HasMember("in"));
+  EXPECT_FALSE(doc["doc"].HasMember("missing"));
+
+  // lookups before and after the full parse give the same results
+  std::size_t size = 0;
+  for ([[maybe_unused]] const auto& member : doc) ++size;
+  EXPECT_EQ(size, 4);
+  EXPECT_EQ(doc["int"].As<int>(), 1);
+  EXPECT_EQ(doc["doc"], kDoc);
+
+  fb::ValueBuilder builder(doc);
+  builder["int"] = 2;
+  builder["doc"]["added"] = true;
+  const auto modified = builder.ExtractValue();
+  EXPECT_EQ(modified["int"].As<int>(), 2);
+  EXPECT_TRUE(modified["doc"]["added"].As<bool>());
+  EXPECT_EQ(modified["str"].As<std::string>(), "string");
+  EXPECT_EQ(doc["int"].As<int>(), 1);
+}
+
+TEST(BsonValue, DuplicateFieldsLazyAccess) {
+  const auto duplicates = fb::MakeDoc("a", 1, "b", 2, "a", 3);
+
+  fb::Value doc_forbid = fb::MakeDoc("doc", duplicates)["doc"];
+  // duplicates are detected regardless of the requested member
+  UEXPECT_THROW(doc_forbid["b"], fb::ParseException);
+  UEXPECT_THROW(doc_forbid.HasMember("c"), fb::ParseException);
+
+  doc_forbid.SetDuplicateFieldsPolicy(
+      fb::Value::DuplicateFieldsPolicy::kUseLast);
+  EXPECT_EQ(doc_forbid["a"].As<int>(), 3);
+  EXPECT_EQ(doc_forbid["b"].As<int>(), 2);
+
+  doc_forbid.SetDuplicateFieldsPolicy(
+      fb::Value::DuplicateFieldsPolicy::kUseFirst);
+  EXPECT_EQ(doc_forbid["a"].As<int>(), 1);
+}
+
 TEST(BsonValue, Items) {
   for ([[maybe_unused]] const auto& [key, value] : Items(kDoc)) {
   }
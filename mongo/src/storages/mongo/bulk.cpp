@@ -13,12 +13,53 @@ USERVER_NAMESPACE_BEGIN
 namespace storages::mongo::operations {
 namespace {
 
-auto EnsureBulk(impl::cdriver::BulkOperationPtr& bulk_ptr, Bulk::Mode mode) {
-  if (!bulk_ptr) {
-    const bool is_ordered = (mode == Bulk::Mode::kOrdered);
-    bulk_ptr.reset(mongoc_bulk_operation_new(is_ordered));
+// Server defaults of maxWriteBatchSize and maxMessageSizeBytes
+constexpr size_t kMaxWriteBatchSize = 100'000;
+constexpr size_t kMaxMessageSizeBytes = 48'000'000;
+
+template <typename Impl>
+mongoc_bulk_operation_t* EnsureBulk(Impl& impl) {
+  if (!impl.bulk) {
+    const bool is_ordered = (impl.mode == Bulk::Mode::kOrdered);
+    impl.bulk.reset(mongoc_bulk_operation_new(is_ordered));
+    if (impl.write_concern) {
+      mongoc_bulk_operation_set_write_concern(impl.bulk.get(),
+                                              impl.write_concern.get());
+    }
   }
-  return bulk_ptr.get();
+  return impl.bulk.get();
+}
+
+// Unordered bulks start a new chunk once the sub-operation does not fit into
+// the server batch, so that the chunks may be executed concurrently
+template <typename Impl>
+mongoc_bulk_operation_t* PrepareAppend(Impl& impl, size_t subop_bytes) {
+  if (impl.mode == Bulk::Mode::kUnordered && impl.bulk_size &&
+      (impl.bulk_size >= kMaxWriteBatchSize ||
+       impl.bulk_bytes + subop_bytes > kMaxMessageSizeBytes)) {
+    impl.full_chunks.push_back({std::move(impl.bulk), impl.bulk_size});
+    impl.bulk_size = 0;
+    impl.bulk_bytes = 0;
+  }
+  return EnsureBulk(impl);
+}
+
+template <typename Impl>
+void AccountAppend(Impl& impl, size_t subop_bytes) {
+  ++impl.bulk_size;
+  impl.bulk_bytes += subop_bytes;
+}
+
+template <typename Impl>
+void SetWriteConcern(Impl& bulk_impl,
+                     impl::cdriver::WriteConcernPtr write_concern) {
+  bulk_impl.write_concern = std::move(write_concern);
+  for (auto& chunk : bulk_impl.full_chunks) {
+    mongoc_bulk_operation_set_write_concern(chunk.bulk.get(),
+                                            bulk_impl.write_concern.get());
+  }
+  mongoc_bulk_operation_set_write_concern(EnsureBulk(bulk_impl),
+                                          bulk_impl.write_concern.get());
 }
 
 }  // namespace
@@ -32,15 +73,11 @@ Bulk& Bulk::operator=(Bulk&&) noexcept = default;
 bool Bulk::IsEmpty() const { return !impl_->bulk; }
 
 void Bulk::SetOption(options::WriteConcern::Level level) {
-  mongoc_bulk_operation_set_write_concern(
-      EnsureBulk(impl_->bulk, impl_->mode),
-      impl::MakeCDriverWriteConcern(level).get());
+  SetWriteConcern(*impl_, impl::MakeCDriverWriteConcern(level));
 }
 
 void Bulk::SetOption(const options::WriteConcern& write_concern) {
-  mongoc_bulk_operation_set_write_concern(
-      EnsureBulk(impl_->bulk, impl_->mode),
-      impl::MakeCDriverWriteConcern(write_concern).get());
+  SetWriteConcern(*impl_, impl::MakeCDriverWriteConcern(write_concern));
 }
 
 void Bulk::SetOption(options::SuppressServerExceptions) {
@@ -50,11 +87,13 @@ void Bulk::SetOption(options::SuppressServerExceptions) {
 void Bulk::Append(const bulk_ops::InsertOne& insert_subop) {
   MongoError error;
   const bson_t* native_bson_ptr = insert_subop.impl_->document.GetBson().get();
+  const auto subop_bytes = native_bson_ptr->len;
   if (!mongoc_bulk_operation_insert_with_opts(
-          EnsureBulk(impl_->bulk, impl_->mode), native_bson_ptr, nullptr,
+          PrepareAppend(*impl_, subop_bytes), native_bson_ptr, nullptr,
           error.GetNative())) {
     error.Throw("Error appending insert to bulk");
   }
+  AccountAppend(*impl_, subop_bytes);
 }
 
 void Bulk::Append(const bulk_ops::ReplaceOne& replace_subop) {
@@ -63,12 +102,15 @@ void Bulk::Append(const bulk_ops::ReplaceOne& replace_subop) {
       replace_subop.impl_->selector.GetBson().get();
   const bson_t* native_replacement_bson_ptr =
       replace_subop.impl_->replacement.GetBson().get();
+  const auto subop_bytes =
+      native_selector_bson_ptr->len + native_replacement_bson_ptr->len;
   if (!mongoc_bulk_operation_replace_one_with_opts(
-          EnsureBulk(impl_->bulk, impl_->mode), native_selector_bson_ptr,
+          PrepareAppend(*impl_, subop_bytes), native_selector_bson_ptr,
           native_replacement_bson_ptr,
           impl::GetNative(replace_subop.impl_->options), error.GetNative())) {
     error.Throw("Error appending replace to bulk");
   }
+  AccountAppend(*impl_, subop_bytes);
 }
 
 void Bulk::Append(const bulk_ops::Update& update_subop) {
@@ -77,44 +119,47 @@ void Bulk::Append(const bulk_ops::Update& update_subop) {
       update_subop.impl_->selector.GetBson().get();
   const bson_t* native_update_bson_ptr =
       update_subop.impl_->update.GetBson().get();
+  const auto subop_bytes =
+      native_selector_bson_ptr->len + native_update_bson_ptr->len;
+  auto* bulk = PrepareAppend(*impl_, subop_bytes);
   bool has_succeeded = false;
   switch (update_subop.impl_->mode) {
     case bulk_ops::Update::Mode::kSingle:
       has_succeeded = mongoc_bulk_operation_update_one_with_opts(
-          EnsureBulk(impl_->bulk, impl_->mode), native_selector_bson_ptr,
-          native_update_bson_ptr, impl::GetNative(update_subop.impl_->options),
-          error.GetNative());
+          bulk, native_selector_bson_ptr, native_update_bson_ptr,
+          impl::GetNative(update_subop.impl_->options), error.GetNative());
       break;
 
     case bulk_ops::Update::Mode::kMulti:
       has_succeeded = mongoc_bulk_operation_update_many_with_opts(
-          EnsureBulk(impl_->bulk, impl_->mode), native_selector_bson_ptr,
-          native_update_bson_ptr, impl::GetNative(update_subop.impl_->options),
-          error.GetNative());
+          bulk, native_selector_bson_ptr, native_update_bson_ptr,
+          impl::GetNative(update_subop.impl_->options), error.GetNative());
       break;
   }
   if (!has_succeeded) error.Throw("Error appending update to bulk");
+  AccountAppend(*impl_, subop_bytes);
 }
 
 void Bulk::Append(const bulk_ops::Delete& delete_subop) {
   MongoError error;
   const bson_t* native_selector_bson_ptr =
       delete_subop.impl_->selector.GetBson().get();
+  const auto subop_bytes = native_selector_bson_ptr->len;
+  auto* bulk = PrepareAppend(*impl_, subop_bytes);
   bool has_succeeded = false;
   switch (delete_subop.impl_->mode) {
     case bulk_ops::Delete::Mode::kSingle:
       has_succeeded = mongoc_bulk_operation_remove_one_with_opts(
-          EnsureBulk(impl_->bulk, impl_->mode), native_selector_bson_ptr,
-          nullptr, error.GetNative());
+          bulk, native_selector_bson_ptr, nullptr, error.GetNative());
       break;
 
     case bulk_ops::Delete::Mode::kMulti:
       has_succeeded = mongoc_bulk_operation_remove_many_with_opts(
-          EnsureBulk(impl_->bulk, impl_->mode), native_selector_bson_ptr,
-          nullptr, error.GetNative());
+          bulk, native_selector_bson_ptr, nullptr, error.GetNative());
       break;
   }
   if (!has_succeeded) error.Throw("Error appending delete to bulk");
+  AccountAppend(*impl_, subop_bytes);
 }
 
 }  // namespace storages::mongo::operations
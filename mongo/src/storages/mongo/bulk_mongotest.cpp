@@ -277,4 +277,36 @@ UTEST_F(Bulk, Mixed) {
   EXPECT_TRUE(upserted_ids[5].IsOid());
 }
 
+UTEST_F(Bulk, UnorderedChunks) {
+  auto pool_config = MakeTestPoolConfig();
+  pool_config.max_bulk_parallelism = 2;
+  auto pool = MakePool({}, pool_config);
+  auto coll = pool.GetCollection("unordered_chunks");
+
+  // more than a single server batch
+  constexpr int kDocsCount = 100'001;
+  auto bulk =
+      coll.MakeUnorderedBulk(mongo::options::SuppressServerExceptions{});
+  for (int i = 0; i < kDocsCount; ++i) {
+    bulk.InsertOne(bson::MakeDoc("_id", i));
+  }
+  bulk.InsertOne(bson::MakeDoc("_id", 0));
+  bulk.UpdateOne(bson::MakeDoc("_id", kDocsCount),
+                 bson::MakeDoc("$set", bson::MakeDoc("x", 1)),
+                 mongo::options::Upsert{});
+  auto result = coll.Execute(std::move(bulk));
+
+  EXPECT_EQ(kDocsCount, result.InsertedCount());
+  EXPECT_EQ(1, result.UpsertedCount());
+  EXPECT_EQ(kDocsCount + 1, coll.Count({}));
+
+  auto errors = result.ServerErrors();
+  ASSERT_EQ(1, errors.size());
+  EXPECT_TRUE(errors.count(kDocsCount));
+
+  auto upserted_ids = result.UpsertedIds();
+  ASSERT_EQ(1, upserted_ids.size());
+  EXPECT_EQ(kDocsCount, upserted_ids[kDocsCount + 1].As<int>());
+}
+
 USERVER_NAMESPACE_END
@@ -1,20 +1,27 @@
 #include <storages/mongo/cdriver/collection_impl.hpp>
 
+#include <algorithm>
+#include <atomic>
+
 #include <bson/bson.h>
 #include <mongoc/mongoc.h>
 
 #include <userver/formats/bson/document.hpp>
 #include <userver/formats/bson/inline.hpp>
+#include <userver/formats/bson/value_builder.hpp>
 #include <userver/server/request/task_inherited_data.hpp>
 #include <userver/storages/mongo/exception.hpp>
 #include <userver/storages/mongo/mongo_error.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tags.hpp>
+#include <userver/engine/get_all.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/impl/userver_experiments.hpp>
 #include <userver/utils/text.hpp>
 
 #include <formats/bson/wrappers.hpp>
+#include <storages/mongo/cdriver/change_stream_impl.hpp>
 #include <storages/mongo/cdriver/cursor_impl.hpp>
 #include <storages/mongo/cdriver/pool_impl.hpp>
 #include <storages/mongo/cdriver/wrappers.hpp>
@@ -34,14 +41,68 @@ class WriteResultHelper {
  public:
   bson_t* GetNative() { return bson_.Get(); }
 
-  WriteResult Extract() {
-    return WriteResult(formats::bson::Document(bson_.Extract()));
+  WriteResult Extract() { return WriteResult(ExtractDocument()); }
+
+  formats::bson::Document ExtractDocument() {
+    return formats::bson::Document(bson_.Extract());
   }
 
  private:
   formats::bson::impl::UninitializedBson bson_;
 };
 
+// Sums the counters of the bulk chunk replies and shifts the indices of the
+// sub-operations by the chunk offsets
+formats::bson::Document MergeBulkReplies(
+    const std::vector<formats::bson::Document>& replies,
+    const std::vector<size_t>& offsets) {
+  UASSERT(replies.size() == offsets.size());
+  int64_t inserted = 0;
+  int64_t matched = 0;
+  int64_t modified = 0;
+  int64_t upserted = 0;
+  int64_t removed = 0;
+  formats::bson::ValueBuilder upserted_ids(formats::common::Type::kArray);
+  formats::bson::ValueBuilder write_errors(formats::common::Type::kArray);
+  formats::bson::ValueBuilder wc_errors(formats::common::Type::kArray);
+
+  const auto append_items = [](formats::bson::ValueBuilder& builder,
+                               const formats::bson::Value& items,
+                               std::optional<size_t> offset) {
+    if (items.IsMissing()) return;
+    for (const auto& item : items) {
+      formats::bson::ValueBuilder item_builder(item);
+      if (offset) {
+        item_builder["index"] =
+            static_cast<int64_t>(*offset + item["index"].As<size_t>());
+      }
+      builder.PushBack(std::move(item_builder));
+    }
+  };
+
+  for (size_t i = 0; i < replies.size(); ++i) {
+    const auto& reply = replies[i];
+    inserted += reply["nInserted"].As<int64_t>(0);
+    matched += reply["nMatched"].As<int64_t>(0);
+    modified += reply["nModified"].As<int64_t>(0);
+    upserted += reply["nUpserted"].As<int64_t>(0);
+    removed += reply["nRemoved"].As<int64_t>(0);
+    append_items(upserted_ids, reply["upserted"], offsets[i]);
+    append_items(write_errors, reply["writeErrors"], offsets[i]);
+    append_items(wc_errors, reply["writeConcernErrors"], std::nullopt);
+  }
+
+  return formats::bson::MakeDoc(                   //
+      "nInserted", inserted,                       //
+      "nMatched", matched,                         //
+      "nModified", modified,                       //
+      "nRemoved", removed,                         //
+      "nUpserted", upserted,                       //
+      "upserted", upserted_ids.ExtractValue(),     //
+      "writeErrors", write_errors.ExtractValue(),  //
+      "writeConcernErrors", wc_errors.ExtractValue());
+}
+
 std::optional<std::string> GetCurrentSpanLink() {
   auto* span = tracing::Span::CurrentSpanUnchecked();
   if (span) return span->GetLink();
@@ -261,14 +322,28 @@ Cursor CDriverCollectionImpl::Execute(const operations::Find& operation) const {
   if (!has_comment_option)
     SetLinkComment(impl::EnsureBuilder(options), has_comment_option);
 
+  // uasserted in ctor
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+  auto& pool = static_cast<cdriver::CDriverPoolImpl&>(*pool_impl_);
+  if (const auto server_id = pool.SelectServer(
+          context.client.get(), operation.impl_->read_prefs.Get())) {
+    impl::EnsureBuilder(options).Append("serverId",
+                                        static_cast<int64_t>(*server_id));
+  }
+
   const bson_t* native_filter_bson_ptr =
       operation.impl_->filter.GetBson().get();
   impl::cdriver::CursorPtr cdriver_cursor(mongoc_collection_find_with_opts(
       context.collection.get(), native_filter_bson_ptr,
       impl::GetNative(options), operation.impl_->read_prefs.Get()));
-  return Cursor(std::make_unique<impl::cdriver::CDriverCursorImpl>(
+  auto cursor = std::make_unique<impl::cdriver::CDriverCursorImpl>(
       std::move(context.client), std::move(cdriver_cursor),
-      std::move(context.stats)));
+      std::move(context.stats));
+  if (operation.impl_->prefetch_max_batch_bytes) {
+    return Cursor(std::make_unique<impl::cdriver::CDriverPrefetchCursorImpl>(
+        std::move(cursor), *operation.impl_->prefetch_max_batch_bytes));
+  }
+  return Cursor(std::move(cursor));
 }
 
 WriteResult CDriverCollectionImpl::Execute(
@@ -492,22 +567,53 @@ WriteResult CDriverCollectionImpl::Execute(
 WriteResult CDriverCollectionImpl::Execute(operations::Bulk&& operation) {
   if (operation.IsEmpty()) return {};
 
+  auto& chunks = operation.impl_->full_chunks;
+  if (chunks.empty()) {
+    return WriteResult(
+        ExecuteBulkChunk(operation, operation.impl_->bulk.get()));
+  }
+  chunks.push_back(
+      {std::move(operation.impl_->bulk), operation.impl_->bulk_size});
+
+  std::vector<formats::bson::Document> replies(chunks.size());
+  std::atomic<size_t> next_chunk{0};
+  const auto workers_count =
+      std::min(pool_impl_->GetMaxBulkParallelism(), chunks.size());
+  std::vector<engine::TaskWithResult<void>> workers;
+  workers.reserve(workers_count);
+  for (size_t i = 0; i < workers_count; ++i) {
+    workers.push_back(utils::Async("mongo_bulk_chunk", [&] {
+      for (auto idx = next_chunk++; idx < chunks.size(); idx = next_chunk++) {
+        replies[idx] = ExecuteBulkChunk(operation, chunks[idx].bulk.get());
+      }
+    }));
+  }
+  engine::GetAll(workers);
+
+  std::vector<size_t> offsets;
+  offsets.reserve(chunks.size());
+  size_t offset = 0;
+  for (const auto& chunk : chunks) {
+    offsets.push_back(offset);
+    offset += chunk.size;
+  }
+  return WriteResult(MergeBulkReplies(replies, offsets));
+}
+
+formats::bson::Document CDriverCollectionImpl::ExecuteBulkChunk(
+    const operations::Bulk& operation, mongoc_bulk_operation_t* bulk) {
   auto context = MakeRequestContext("mongo_bulk", operation);
 
-  UASSERT(operation.impl_->bulk);
-  mongoc_bulk_operation_set_database(operation.impl_->bulk.get(),
-                                     GetDatabaseName().c_str());
-  mongoc_bulk_operation_set_collection(operation.impl_->bulk.get(),
-                                       GetCollectionName().c_str());
+  UASSERT(bulk);
+  mongoc_bulk_operation_set_database(bulk, GetDatabaseName().c_str());
+  mongoc_bulk_operation_set_collection(bulk, GetCollectionName().c_str());
 
-  mongoc_bulk_operation_set_client(operation.impl_->bulk.get(),
-                                   context.client.get());
+  mongoc_bulk_operation_set_client(bulk, context.client.get());
 
   MongoError error;
   WriteResultHelper write_result;
   stats::OperationStopwatch stopwatch(std::move(context.stats));
-  if (mongoc_bulk_operation_execute(operation.impl_->bulk.get(),
-                                    write_result.GetNative(),
+  if (mongoc_bulk_operation_execute(bulk, write_result.GetNative(),
                                     error.GetNative())) {
     stopwatch.AccountSuccess();
   } else {
@@ -516,7 +622,7 @@ WriteResult CDriverCollectionImpl::Execute(operations::Bulk&& operation) {
       error.Throw("Error running bulk operation");
     }
   }
-  return write_result.Extract();
+  return write_result.ExtractDocument();
 }
 
 Cursor CDriverCollectionImpl::Execute(const operations::Aggregate& operation) {
@@ -538,6 +644,39 @@ Cursor CDriverCollectionImpl::Execute(const operations::Aggregate& operation) {
       std::move(context.stats)));
 }
 
+ChangeStream CDriverCollectionImpl::Execute(
+    const operations::Watch& operation) const {
+  auto context = MakeRequestContext("mongo_watch", operation);
+
+  auto options = operation.impl_->options;
+  bool has_comment_option = operation.impl_->has_comment_option;
+  if (!has_comment_option)
+    SetLinkComment(impl::EnsureBuilder(options), has_comment_option);
+
+  // Change stream takes the read preference of the collection
+  if (operation.impl_->read_prefs) {
+    mongoc_collection_set_read_prefs(context.collection.get(),
+                                     operation.impl_->read_prefs.Get());
+  }
+
+  auto pipeline_doc = operation.impl_->pipeline.GetInternalArrayDocument();
+  MongoError error;
+  stats::OperationStopwatch stopwatch(context.stats);
+  impl::cdriver::ChangeStreamPtr stream(
+      mongoc_collection_watch(context.collection.get(),
+                              pipeline_doc.GetBson().get(),
+                              impl::GetNative(options)));
+  if (mongoc_change_stream_error_document(stream.get(), error.GetNative(),
+                                          nullptr)) {
+    stopwatch.AccountError(error.GetKind());
+    error.Throw("Error opening change stream");
+  }
+  stopwatch.AccountSuccess();
+
+  return ChangeStream(std::make_unique<impl::cdriver::CDriverChangeStreamImpl>(
+      std::move(context.client), std::move(stream), std::move(context.stats)));
+}
+
 void CDriverCollectionImpl::Execute(const operations::Drop& operation) {
   auto context = MakeRequestContext("mongo_drop", operation);
 
@@ -40,6 +40,7 @@ class CDriverCollectionImpl : public CollectionImpl {
   WriteResult Execute(const operations::FindAndRemove&) override;
   WriteResult Execute(operations::Bulk&&) override;
   Cursor Execute(const operations::Aggregate&) override;
+  ChangeStream Execute(const operations::Watch&) const override;
   void Execute(const operations::Drop&) override;
 
  private:
@@ -49,6 +50,9 @@ class CDriverCollectionImpl : public CollectionImpl {
   RequestContext MakeRequestContext(std::string&& span_name,
                                     const stats::OperationKey& stats_key) const;
 
+  formats::bson::Document ExecuteBulkChunk(const operations::Bulk& operation,
+                                           mongoc_bulk_operation_t* bulk);
+
   template <typename Operation>
   RequestContext MakeRequestContext(std::string&& span_name,
                                     const Operation& operation) const;
@@ -1,5 +1,7 @@
 #include <storages/mongo/cdriver/cursor_impl.hpp>
 
+#include <algorithm>
+#include <limits>
 #include <stdexcept>
 
 #include <bson/bson.h>
@@ -7,6 +9,7 @@
 
 #include <userver/storages/mongo/mongo_error.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 
 #include <formats/bson/wrappers.hpp>
 
@@ -93,6 +96,69 @@ void CDriverCursorImpl::Next() {
   }
 }
 
+void CDriverCursorImpl::SetBatchSize(uint32_t batch_size) {
+  if (cursor_) mongoc_cursor_set_batch_size(cursor_.get(), batch_size);
+}
+
+CDriverPrefetchCursorImpl::CDriverPrefetchCursorImpl(
+    std::unique_ptr<CDriverCursorImpl> cursor, size_t max_batch_bytes)
+    : max_batch_bytes_(max_batch_bytes),
+      cursor_(std::move(cursor)),
+      batch_(ReadBatch()) {
+  StartPrefetch();
+}
+
+bool CDriverPrefetchCursorImpl::IsValid() const {
+  return batch_pos_ < batch_.size();
+}
+
+bool CDriverPrefetchCursorImpl::HasMore() const {
+  return batch_pos_ + 1 < batch_.size() || prefetch_task_.IsValid();
+}
+
+const formats::bson::Document& CDriverPrefetchCursorImpl::Current() const {
+  if (!IsValid()) throw std::logic_error("Reading from invalid cursor");
+  return batch_[batch_pos_];
+}
+
+void CDriverPrefetchCursorImpl::Next() {
+  if (!IsValid()) throw std::logic_error("Advancing cursor past the end");
+
+  if (++batch_pos_ < batch_.size()) return;
+
+  batch_.clear();
+  batch_pos_ = 0;
+  if (prefetch_task_.IsValid()) {
+    batch_ = prefetch_task_.Get();
+    StartPrefetch();
+  }
+}
+
+std::vector<formats::bson::Document> CDriverPrefetchCursorImpl::ReadBatch() {
+  std::vector<formats::bson::Document> batch;
+  size_t batch_bytes = 0;
+  while (cursor_->IsValid() && batch_bytes < max_batch_bytes_) {
+    batch.push_back(cursor_->Current());
+    batch_bytes += batch.back().GetBson()->len;
+    cursor_->Next();
+  }
+
+  if (!batch.empty()) {
+    // request about max_batch_bytes of documents of the average size next time
+    const auto average_bytes = std::max<size_t>(batch_bytes / batch.size(), 1);
+    cursor_->SetBatchSize(static_cast<uint32_t>(std::clamp<size_t>(
+        max_batch_bytes_ / average_bytes, 1,
+        std::numeric_limits<int32_t>::max())));
+  }
+  return batch;
+}
+
+void CDriverPrefetchCursorImpl::StartPrefetch() {
+  if (!cursor_->IsValid()) return;
+  prefetch_task_ =
+      utils::Async("mongo_cursor_prefetch", [this] { return ReadBatch(); });
+}
+
 }  // namespace storages::mongo::impl::cdriver
 
 USERVER_NAMESPACE_END
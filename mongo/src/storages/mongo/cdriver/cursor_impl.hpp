@@ -2,7 +2,9 @@
 
 #include <memory>
 #include <optional>
+#include <vector>
 
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/formats/bson/document.hpp>
 
 #include <storages/mongo/cdriver/pool_impl.hpp>
@@ -27,6 +29,9 @@ class CDriverCursorImpl final : public CursorImpl {
   const formats::bson::Document& Current() const override;
   void Next() override;
 
+  /// Sets the number of documents requested by the following getMore
+  void SetBatchSize(uint32_t batch_size);
+
  private:
   std::optional<formats::bson::Document> current_;
   cdriver::CDriverPoolImpl::BoundClientPtr client_;
@@ -34,6 +39,31 @@ class CDriverCursorImpl final : public CursorImpl {
   const std::shared_ptr<stats::OperationStatisticsItem> find_stats_;
 };
 
+/// Reads the documents of the next batch in background while the current
+/// batch is being processed, see options::Prefetch
+class CDriverPrefetchCursorImpl final : public CursorImpl {
+ public:
+  CDriverPrefetchCursorImpl(std::unique_ptr<CDriverCursorImpl> cursor,
+                            size_t max_batch_bytes);
+
+  bool IsValid() const override;
+  bool HasMore() const override;
+
+  const formats::bson::Document& Current() const override;
+  void Next() override;
+
+ private:
+  std::vector<formats::bson::Document> ReadBatch();
+  void StartPrefetch();
+
+  const size_t max_batch_bytes_;
+  std::unique_ptr<CDriverCursorImpl> cursor_;
+  std::vector<formats::bson::Document> batch_;
+  size_t batch_pos_{0};
+  // Must be destroyed before the cursor it reads from
+  engine::TaskWithResult<std::vector<formats::bson::Document>> prefetch_task_;
+};
+
 }  // namespace storages::mongo::impl::cdriver
 
 USERVER_NAMESPACE_END
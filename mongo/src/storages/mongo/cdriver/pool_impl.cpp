@@ -1,6 +1,9 @@
 #include <storages/mongo/cdriver/pool_impl.hpp>
 
+#include <algorithm>
 #include <limits>
+#include <string_view>
+#include <vector>
 
 #include <bson/bson.h>
 #include <fmt/chrono.h>
@@ -14,7 +17,9 @@
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tags.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 #include <userver/utils/impl/userver_experiments.hpp>
+#include <userver/utils/rand.hpp>
 #include <userver/utils/traceful_exception.hpp>
 
 #include <storages/mongo/cdriver/async_stream.hpp>
@@ -140,6 +145,59 @@ mongoc_ssl_opt_t MakeSslOpt(const mongoc_uri_t* uri) {
   return ssl_opt;
 }
 
+stats::PoolStatistics& GetPoolStatistics(void* context) {
+  UASSERT(context);
+  return *static_cast<stats::PoolStatistics*>(context);
+}
+
+void OnCommandStarted(const mongoc_apm_command_started_t* event) {
+  try {
+    auto& servers =
+        GetPoolStatistics(mongoc_apm_command_started_get_context(event))
+            .servers;
+    servers[mongoc_apm_command_started_get_host(event)->host_and_port]
+        ->AccountStarted();
+  } catch (const std::exception&) {
+    // ignore
+  }
+}
+
+void OnCommandSucceeded(const mongoc_apm_command_succeeded_t* event) {
+  try {
+    auto& servers =
+        GetPoolStatistics(mongoc_apm_command_succeeded_get_context(event))
+            .servers;
+    servers[mongoc_apm_command_succeeded_get_host(event)->host_and_port]
+        ->AccountFinished(std::chrono::microseconds{
+                              mongoc_apm_command_succeeded_get_duration(event)},
+                          /*is_error=*/false);
+  } catch (const std::exception&) {
+    // ignore
+  }
+}
+
+void OnCommandFailed(const mongoc_apm_command_failed_t* event) {
+  try {
+    auto& servers =
+        GetPoolStatistics(mongoc_apm_command_failed_get_context(event))
+            .servers;
+    servers[mongoc_apm_command_failed_get_host(event)->host_and_port]
+        ->AccountFinished(std::chrono::microseconds{
+                              mongoc_apm_command_failed_get_duration(event)},
+                          /*is_error=*/true);
+  } catch (const std::exception&) {
+    // ignore
+  }
+}
+
+ApmCallbacksPtr MakeApmCallbacks() {
+  ApmCallbacksPtr callbacks(mongoc_apm_callbacks_new());
+  mongoc_apm_set_command_started_cb(callbacks.get(), &OnCommandStarted);
+  mongoc_apm_set_command_succeeded_cb(callbacks.get(), &OnCommandSucceeded);
+  mongoc_apm_set_command_failed_cb(callbacks.get(), &OnCommandFailed);
+  return callbacks;
+}
+
 std::string MakeQueueDeadlineMessage(
     std::optional<engine::Deadline::Duration> inherited_timeout) {
   if (!inherited_timeout) return {};
@@ -176,6 +234,8 @@ CDriverPoolImpl::CDriverPoolImpl(std::string id, const std::string& uri_string,
     : PoolImpl(std::move(id), config, config_source),
       app_name_(config.app_name),
       init_data_{dns_resolver, {}},
+      apm_callbacks_(MakeApmCallbacks()),
+      latency_aware_reads_(config.latency_aware_reads),
       max_size_(config.pool_settings.max_size),
       idle_limit_(config.pool_settings.idle_limit),
       queue_timeout_(config.queue_timeout),
@@ -195,6 +255,8 @@ CDriverPoolImpl::CDriverPoolImpl(std::string id, const std::string& uri_string,
         << Id() << "' must include database name";
   }
   default_database_ = uri_database;
+  local_threshold_ = std::chrono::milliseconds{
+      mongoc_uri_get_local_threshold_option(uri_.get())};
 
   init_data_.ssl_opt = MakeSslOpt(uri_.get());
 
@@ -282,6 +344,79 @@ void CDriverPoolImpl::Ping() {
   ping_sw.AccountSuccess();
 }
 
+std::optional<uint32_t> CDriverPoolImpl::SelectServer(
+    mongoc_client_t* client, const mongoc_read_prefs_t* read_prefs) {
+  if (!latency_aware_reads_) return std::nullopt;
+
+  if (!read_prefs) read_prefs = mongoc_client_get_read_prefs(client);
+  const auto mode = mongoc_read_prefs_get_mode(read_prefs);
+  if (mode == MONGOC_READ_PRIMARY || mode == MONGOC_READ_PRIMARY_PREFERRED) {
+    return std::nullopt;
+  }
+  if (!bson_empty(mongoc_read_prefs_get_tags(read_prefs)) ||
+      mongoc_read_prefs_get_max_staleness_seconds(read_prefs) !=
+          MONGOC_NO_MAX_STALENESS) {
+    return std::nullopt;
+  }
+
+  struct Candidate {
+    uint32_t server_id;
+    std::chrono::microseconds latency;
+    int64_t in_flight;
+  };
+  std::vector<Candidate> candidates;
+  {
+    size_t count = 0;
+    auto** descriptions = mongoc_client_get_server_descriptions(client, &count);
+    const utils::FastScopeGuard descriptions_guard(
+        [descriptions, count]() noexcept {
+          mongoc_server_descriptions_destroy_all(descriptions, count);
+        });
+
+    auto& servers = GetStatistics().servers;
+    for (size_t i = 0; i < count; ++i) {
+      const std::string_view type =
+          mongoc_server_description_type(descriptions[i]);
+      if (type != "RSSecondary" &&
+          (type != "RSPrimary" || mode != MONGOC_READ_NEAREST)) {
+        continue;
+      }
+
+      // servers without commands yet are probed first
+      Candidate candidate{mongoc_server_description_id(descriptions[i]),
+                          std::chrono::microseconds{0}, 0};
+      if (const auto server_stats = servers.Get(
+              mongoc_server_description_host(descriptions[i])->host_and_port)) {
+        candidate.latency = server_stats->GetLatency().value_or(
+            std::chrono::microseconds{0});
+        candidate.in_flight = server_stats->in_flight.load();
+      }
+      candidates.push_back(candidate);
+    }
+  }
+  if (candidates.empty()) return std::nullopt;
+
+  const auto min_latency =
+      std::min_element(candidates.begin(), candidates.end(),
+                       [](const Candidate& lhs, const Candidate& rhs) {
+                         return lhs.latency < rhs.latency;
+                       })
+          ->latency;
+
+  // random start to spread the ties
+  const auto start = utils::RandRange(candidates.size());
+  const Candidate* selected = nullptr;
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    const auto& candidate = candidates[(start + i) % candidates.size()];
+    if (candidate.latency > min_latency + local_threshold_) continue;
+    if (!selected || candidate.in_flight < selected->in_flight) {
+      selected = &candidate;
+    }
+  }
+  UASSERT(selected);
+  return selected->server_id;
+}
+
 CDriverPoolImpl::BoundClientPtr CDriverPoolImpl::Acquire() {
   const stats::ConnectionWaitStopwatch conn_wait_sw(GetStatistics().pool);
   return {Pop(), ClientPusher(this)};
@@ -372,6 +507,8 @@ mongoc_client_t* CDriverPoolImpl::Create() {
   mongoc_client_set_error_api(client.get(), MONGOC_ERROR_API_VERSION_2);
   mongoc_client_set_stream_initiator(client.get(), &MakeAsyncStream,
                                      &init_data_);
+  mongoc_client_set_apm_callbacks(client.get(), apm_callbacks_.get(),
+                                  &GetStatistics());
 #if MONGOC_CHECK_VERSION(1, 26, 0)
   mongoc_client_set_usleep_impl(client.get(), &MongocCoroFrieldlyUsleep,
                                 nullptr);
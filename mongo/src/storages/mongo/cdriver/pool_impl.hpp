@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <optional>
 
 #include <mongoc/mongoc.h>
 #include <boost/lockfree/queue.hpp>
@@ -56,6 +57,16 @@ class CDriverPoolImpl final : public PoolImpl {
 
   void SetPoolSettings(const PoolSettings& pool_settings) override;
 
+  /// @brief Selects the server for a read by the observed latencies.
+  ///
+  /// Returns the id of the least loaded server among the ones eligible for
+  /// the read preference whose latency is within the local threshold of the
+  /// fastest one. Returns nullopt if the selection is left to the driver:
+  /// latency aware reads are disabled, the read preference involves
+  /// the primary, tags or max staleness, or no eligible server is known.
+  std::optional<uint32_t> SelectServer(mongoc_client_t* client,
+                                       const mongoc_read_prefs_t* read_prefs);
+
  private:
   mongoc_client_t* Pop();
   void Push(mongoc_client_t*) noexcept;
@@ -70,6 +81,9 @@ class CDriverPoolImpl final : public PoolImpl {
   std::string default_database_;
   UriPtr uri_;
   AsyncStreamInitiatorData init_data_;
+  ApmCallbacksPtr apm_callbacks_;
+  const bool latency_aware_reads_;
+  std::chrono::microseconds local_threshold_{0};
 
   std::atomic<size_t> max_size_;
   std::atomic<size_t> idle_limit_;
@@ -18,6 +18,14 @@ class GlobalInitializer {
   static void LogInitWarningsOnce();
 };
 
+struct ApmCallbacksDeleter {
+  void operator()(mongoc_apm_callbacks_t* callbacks) const noexcept {
+    mongoc_apm_callbacks_destroy(callbacks);
+  }
+};
+using ApmCallbacksPtr =
+    std::unique_ptr<mongoc_apm_callbacks_t, ApmCallbacksDeleter>;
+
 struct BulkOperationDeleter {
   void operator()(mongoc_bulk_operation_t* bulk) const noexcept {
     mongoc_bulk_operation_destroy(bulk);
@@ -26,6 +34,14 @@ struct BulkOperationDeleter {
 using BulkOperationPtr =
     std::unique_ptr<mongoc_bulk_operation_t, BulkOperationDeleter>;
 
+struct ChangeStreamDeleter {
+  void operator()(mongoc_change_stream_t* stream) const noexcept {
+    mongoc_change_stream_destroy(stream);
+  }
+};
+using ChangeStreamPtr =
+    std::unique_ptr<mongoc_change_stream_t, ChangeStreamDeleter>;
+
 struct ClientDeleter {
   void operator()(mongoc_client_t* client) const noexcept {
     mongoc_client_destroy(client);
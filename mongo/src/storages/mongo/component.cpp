@@ -169,6 +169,10 @@ properties:
         type: string
         description: latency window for instance selection
         defaultDescription: mongodb default
+    latency_aware_reads:
+        type: boolean
+        description: route secondary reads to the servers with the lowest observed latency within local_threshold
+        defaultDescription: false
     max_replication_lag:
         type: string
         description: replication lag limit for usable secondaries, min. 90s
@@ -179,6 +183,11 @@ properties:
         enum:
           - terse
           - full
+    max_bulk_parallelism:
+        type: integer
+        description: limit of concurrently executed chunks of an unordered bulk operation
+        defaultDescription: 1
+        minimum: 1
     dns_resolver:
         type: string
         description: server hostname resolver type (getaddrinfo or async)
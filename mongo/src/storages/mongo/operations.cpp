@@ -311,6 +311,14 @@ void Find::SetOption(const options::MaxServerTime& max_server_time) {
   AppendMaxServerTime(impl_->max_server_time, max_server_time);
 }
 
+void Find::SetOption(options::Prefetch prefetch) {
+  if (!prefetch.MaxBatchBytes()) {
+    throw InvalidQueryArgumentException(
+        "Prefetch batch size must be positive");
+  }
+  impl_->prefetch_max_batch_bytes = prefetch.MaxBatchBytes();
+}
+
 InsertOne::InsertOne(formats::bson::Document document)
     : impl_(std::move(document)) {}
 
@@ -647,6 +655,54 @@ void Aggregate::SetOption(const options::MaxServerTime& max_server_time) {
   AppendMaxServerTime(impl_->max_server_time, max_server_time);
 }
 
+Watch::Watch(formats::bson::Value pipeline) : impl_(std::move(pipeline)) {
+  if (!impl_->pipeline.IsArray()) {
+    throw InvalidQueryArgumentException(
+        "Change stream pipeline is not an array");
+  }
+}
+
+Watch::~Watch() = default;
+
+Watch::Watch(const Watch& other) = default;
+Watch::Watch(Watch&&) noexcept = default;
+Watch& Watch::operator=(const Watch& rhs) = default;
+Watch& Watch::operator=(Watch&&) noexcept = default;
+
+void Watch::SetOption(const options::ReadPreference& read_prefs) {
+  impl_->read_prefs = MakeCDriverReadPrefs(read_prefs);
+}
+
+void Watch::SetOption(options::ReadPreference::Mode mode) {
+  impl_->read_prefs = MakeCDriverReadPrefs(mode);
+}
+
+void Watch::SetOption(options::ReadConcern level) {
+  AppendReadConcern(impl::EnsureBuilder(impl_->options), level);
+}
+
+void Watch::SetOption(const options::Comment& comment) {
+  AppendComment(impl::EnsureBuilder(impl_->options), impl_->has_comment_option,
+                comment);
+}
+
+void Watch::SetOption(const options::ResumeAfter& resume_after) {
+  impl::EnsureBuilder(impl_->options)
+      .Append("resumeAfter", resume_after.Value());
+}
+
+void Watch::SetOption(options::FullDocumentLookup) {
+  impl::EnsureBuilder(impl_->options).Append("fullDocument", "updateLookup");
+}
+
+void Watch::SetOption(const options::MaxAwaitTime& max_await_time) {
+  if (max_await_time.Value().count() < 0) {
+    throw InvalidQueryArgumentException("Negative max await time");
+  }
+  impl::EnsureBuilder(impl_->options)
+      .Append("maxAwaitTimeMS", max_await_time.Value().count());
+}
+
 Drop::Drop() = default;
 Drop::~Drop() = default;
 
@@ -54,6 +54,7 @@ class Find::Impl {
   std::optional<formats::bson::impl::BsonBuilder> options;
   bool has_comment_option{false};
   std::chrono::milliseconds max_server_time{kNoMaxServerTime};
+  std::optional<size_t> prefetch_max_batch_bytes;
 };
 
 class InsertOne::Impl {
@@ -147,10 +148,22 @@ class Bulk::Impl {
  public:
   explicit Impl(Mode mode_) : mode(mode_) {}
 
+  struct Chunk {
+    impl::cdriver::BulkOperationPtr bulk;
+    size_t size{0};
+  };
+
   impl::cdriver::BulkOperationPtr bulk;
   stats::OperationKey op_key{stats::OpType::kBulk};
   Mode mode;
   bool should_throw{true};
+
+  // Unordered bulks are split into chunks of at most a server batch each,
+  // `bulk` is the last one being filled
+  std::vector<Chunk> full_chunks;
+  size_t bulk_size{0};
+  size_t bulk_bytes{0};
+  impl::cdriver::WriteConcernPtr write_concern;
 };
 
 class Aggregate::Impl {
@@ -166,6 +179,18 @@ class Aggregate::Impl {
   std::chrono::milliseconds max_server_time{kNoMaxServerTime};
 };
 
+class Watch::Impl {
+ public:
+  explicit Impl(formats::bson::Value pipeline_)
+      : pipeline(std::move(pipeline_)) {}
+
+  formats::bson::Value pipeline;
+  impl::cdriver::ReadPrefsPtr read_prefs;
+  stats::OperationKey op_key{stats::OpType::kWatch};
+  std::optional<formats::bson::impl::BsonBuilder> options;
+  bool has_comment_option{false};
+};
+
 class Drop::Impl {
  public:
   Impl() = default;
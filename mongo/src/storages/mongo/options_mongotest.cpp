@@ -673,6 +673,26 @@ UTEST_F(Options, DefaultMaxServerTime) {
       {}, mongo::options::MaxServerTime{utest::kMaxTestWaitTime}));
 }
 
+UTEST_F(Options, Prefetch) {
+  auto coll = GetDefaultPool().GetCollection("prefetch");
+
+  constexpr int kDocsCount = 1000;
+  for (int i = 0; i < kDocsCount; ++i) coll.InsertOne(bson::MakeDoc("x", i));
+
+  // a few documents per batch
+  auto cursor = coll.Find(
+      {}, mongo::options::Sort{}.By("x", mongo::options::Sort::kAscending),
+      mongo::options::Prefetch{100});
+  int expected = 0;
+  for (const auto& doc : cursor) {
+    EXPECT_EQ(expected++, doc["x"].As<int>());
+  }
+  EXPECT_EQ(kDocsCount, expected);
+
+  UEXPECT_THROW(coll.Find({}, mongo::options::Prefetch{0}),
+                mongo::InvalidQueryArgumentException);
+}
+
 // Note: make sure to call SetTimeout on WriteConcern::kMajority, otherwise
 // the default timeout of 1 second will lead to the test being flaky.
 UTEST_F(Options, WriteConcern) {
@@ -99,6 +99,8 @@ PoolConfig Parse(const yaml_config::YamlConfig& config,
       result.queue_timeout);
   result.local_threshold =
       config["local_threshold"].As<std::optional<std::chrono::milliseconds>>();
+  result.latency_aware_reads =
+      config["latency_aware_reads"].As<bool>(result.latency_aware_reads);
   result.maintenance_period =
       config["maintenance_period"].As<std::chrono::milliseconds>(
           result.maintenance_period);
@@ -109,6 +111,8 @@ PoolConfig Parse(const yaml_config::YamlConfig& config,
       config["driver"].As<PoolConfig::DriverImpl>(result.driver_impl);
   result.stats_verbosity =
       config["stats_verbosity"].As<StatsVerbosity>(result.stats_verbosity);
+  result.max_bulk_parallelism =
+      config["max_bulk_parallelism"].As<size_t>(result.max_bulk_parallelism);
   result.cc_config =
       config["congestion_control"]
           .As<congestion_control::v2::LinearController::StaticConfig>();
@@ -150,6 +154,11 @@ void PoolConfig::Validate(const std::string& pool_id) const {
 
   pool_settings.Validate(pool_id);
 
+  if (!max_bulk_parallelism) {
+    throw InvalidConfigException("invalid max bulk parallelism in ")
+        << pool_id << " pool config";
+  }
+
   if (!IsValidAppName(app_name)) {
     throw InvalidConfigException("Invalid appname in ")
         << pool_id << " pool config";
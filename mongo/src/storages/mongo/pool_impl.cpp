@@ -12,6 +12,7 @@ PoolImpl::PoolImpl(std::string&& id, const PoolConfig& static_config,
                    dynamic_config::Source config_source)
     : id_(std::move(id)),
       stats_verbosity_(static_config.stats_verbosity),
+      max_bulk_parallelism_(static_config.max_bulk_parallelism),
       config_source_(config_source),
       cc_sensor_(*this),
       cc_limiter_(*this),
@@ -55,6 +56,10 @@ dynamic_config::Snapshot PoolImpl::GetConfig() const {
 
 StatsVerbosity PoolImpl::GetStatsVerbosity() const { return stats_verbosity_; }
 
+size_t PoolImpl::GetMaxBulkParallelism() const {
+  return max_bulk_parallelism_;
+}
+
 }  // namespace storages::mongo::impl
 
 USERVER_NAMESPACE_END
@@ -28,6 +28,7 @@ class PoolImpl {
   stats::PoolStatistics& GetStatistics();
   dynamic_config::Snapshot GetConfig() const;
   StatsVerbosity GetStatsVerbosity() const;
+  size_t GetMaxBulkParallelism() const;
 
   virtual const std::string& DefaultDatabaseName() const = 0;
 
@@ -49,6 +50,7 @@ class PoolImpl {
 
   const std::string id_;
   const StatsVerbosity stats_verbosity_;
+  const size_t max_bulk_parallelism_;
   dynamic_config::Source config_source_;
   stats::PoolStatistics statistics_;
 
@@ -1,6 +1,7 @@
 #include <userver/utest/utest.hpp>
 
 #include <chrono>
+#include <iterator>
 #include <string>
 #include <vector>
 
@@ -14,6 +15,7 @@
 #include <userver/formats/bson/inline.hpp>
 #include <userver/storages/mongo/collection.hpp>
 #include <userver/storages/mongo/exception.hpp>
+#include <userver/storages/mongo/options.hpp>
 #include <userver/storages/mongo/pool.hpp>
 #include <userver/storages/mongo/pool_config.hpp>
 
@@ -96,6 +98,20 @@ UTEST_F(Pool, Limits) {
   UEXPECT_THROW(second_find.Get(), mongo::MongoException);
 }
 
+UTEST_F(Pool, LatencyAwareReads) {
+  auto config = MakeTestPoolConfig();
+  config.latency_aware_reads = true;
+  auto pool = MakePool({}, config);
+  auto coll = pool.GetCollection("test");
+
+  UEXPECT_NO_THROW(coll.InsertOne(formats::bson::MakeDoc("_id", 1)));
+  for (auto mode : {mongo::options::ReadPreference::kNearest,
+                    mongo::options::ReadPreference::kSecondaryPreferred}) {
+    auto cursor = coll.Find({}, mode);
+    EXPECT_EQ(1, std::distance(cursor.begin(), cursor.end()));
+  }
+}
+
 UTEST_F(Pool, ListCollectionNames) {
   static const std::string kCollAName = "list_test_a";
   static const std::string kCollBName = "list_test_b";
@@ -1,5 +1,6 @@
 #include <storages/mongo/stats.hpp>
 
+#include <algorithm>
 #include <exception>
 #include <tuple>
 
@@ -45,6 +46,9 @@ auto GetMilliseconds(const std::chrono::duration<Rep, Period>& duration) {
       .count();
 }
 
+// The weight of a new sample in the moving average of the server latency
+constexpr int64_t kLatencyDecay = 8;
+
 }  // namespace
 
 void OperationStatisticsItem::Account(ErrorType error_type) noexcept {
@@ -139,6 +143,8 @@ std::string_view ToString(OpType type) {
       return "bulk";
     case Type::kAggregate:
       return "aggregate";
+    case Type::kWatch:
+      return "watch";
     case Type::kDrop:
       return "drop";
   }
@@ -150,6 +156,36 @@ bool OperationKey::operator==(const OperationKey& other) const noexcept {
   return op_type == other.op_type;
 }
 
+void ServerStatistics::AccountStarted() noexcept {
+  in_flight.fetch_add(1, std::memory_order_relaxed);
+}
+
+void ServerStatistics::AccountFinished(std::chrono::microseconds duration,
+                                       bool is_error) noexcept {
+  in_flight.fetch_sub(1, std::memory_order_relaxed);
+  ++requests;
+  if (is_error) {
+    ++errors;
+    return;
+  }
+
+  const auto sample = std::max<int64_t>(duration.count(), 0);
+  auto latency = latency_us.load(std::memory_order_relaxed);
+  int64_t new_latency = 0;
+  do {
+    new_latency =
+        latency < 0 ? sample : latency + (sample - latency) / kLatencyDecay;
+  } while (!latency_us.compare_exchange_weak(latency, new_latency,
+                                             std::memory_order_relaxed));
+}
+
+std::optional<std::chrono::microseconds> ServerStatistics::GetLatency()
+    const noexcept {
+  const auto latency = latency_us.load(std::memory_order_relaxed);
+  if (latency < 0) return std::nullopt;
+  return std::chrono::microseconds{latency};
+}
+
 PoolConnectStatistics::PoolConnectStatistics()
     : ping(utils::MakeSharedRef<OperationStatisticsItem>()) {}
 
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <functional>
+#include <optional>
 #include <string>
 
 #include <userver/congestion_control/controllers/v2.hpp>
@@ -74,6 +76,7 @@ enum class OpType {
   kCountApprox,
   kFind,
   kAggregate,
+  kWatch,
 
   kWriteMin,
   kInsertOne = kWriteMin,
@@ -116,11 +119,27 @@ struct PoolConnectStatistics {
   AggregatedTimingsPercentile queue_wait_timings_agg;
 };
 
+/// Statistics of the commands sent to a single server
+struct ServerStatistics final {
+  void AccountStarted() noexcept;
+  void AccountFinished(std::chrono::microseconds duration,
+                       bool is_error) noexcept;
+
+  /// Exponentially weighted moving average of the command durations
+  std::optional<std::chrono::microseconds> GetLatency() const noexcept;
+
+  Counter requests;
+  Counter errors;
+  std::atomic<int64_t> in_flight{0};
+  std::atomic<int64_t> latency_us{-1};
+};
+
 struct PoolStatistics {
   PoolStatistics() : pool(utils::MakeSharedRef<PoolConnectStatistics>()) {}
 
   utils::SharedRef<PoolConnectStatistics> pool;
   rcu::RcuMap<std::string, CollectionStatistics> collections;
+  rcu::RcuMap<std::string, ServerStatistics> servers;
   congestion_control::v2::Stats congestion_control;
 };
 
@@ -154,9 +154,25 @@ void DumpMetric(utils::statistics::Writer& writer,
   writer["queue-wait-timings-1min"] = conn_stats.queue_wait_timings_agg;
 }
 
+void DumpMetric(utils::statistics::Writer& writer,
+                const ServerStatistics& server_stats) {
+  writer["requests"] = server_stats.requests;
+  writer["errors"] = server_stats.errors;
+  writer["in-flight"] = server_stats.in_flight.load();
+  if (const auto latency = server_stats.GetLatency()) {
+    writer["latency-ewma-us"] = latency->count();
+  }
+}
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const PoolStatistics& pool_stats, StatsVerbosity verbosity) {
   writer["pool"] = *pool_stats.pool;
+  if (auto servers_writer = writer["servers"]) {
+    for (const auto& [server, server_stats] : pool_stats.servers) {
+      UASSERT(server_stats);
+      servers_writer.ValueWithLabels(*server_stats, {"mongo_server", server});
+    }
+  }
   writer["congestion-control"] = pool_stats.congestion_control;
 
   CombinedCollectionStats pool_overall;
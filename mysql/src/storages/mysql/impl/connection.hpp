@@ -38,6 +38,7 @@ class Connection final {
              const settings::EndpointInfo& endpoint_info,
              const settings::AuthSettings& auth_settings,
              const settings::ConnectionSettings& connection_settings,
+             StatementsCacheStatistics& statements_stats,
              engine::Deadline deadline);
   ~Connection();
 
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <cstdint>
+
 #include <userver/cache/lru_map.hpp>
+#include <userver/utils/statistics/relaxed_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
 #include <userver/utils/str_icase.hpp>
 
 #include <storages/mysql/impl/statement.hpp>
@@ -11,9 +15,21 @@ namespace storages::mysql::impl {
 
 class Connection;
 
+struct StatementsCacheStatistics final {
+  using Counter = utils::statistics::RelaxedCounter<std::uint64_t>;
+
+  Counter hits{};
+  Counter misses{};
+  Counter evictions{};
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const StatementsCacheStatistics& stats);
+
 class StatementsCache final {
  public:
-  StatementsCache(Connection& connection, std::size_t capacity);
+  StatementsCache(Connection& connection, std::size_t capacity,
+                  StatementsCacheStatistics& stats);
   ~StatementsCache();
 
   Statement& PrepareStatement(const std::string& statement,
@@ -21,6 +37,7 @@ class StatementsCache final {
 
  private:
   Connection& connection_;
+  StatementsCacheStatistics& stats_;
 
   cache::LruMap<std::string, Statement, utils::StrIcaseHash,
                 utils::StrIcaseEqual>
@@ -50,6 +50,8 @@ void Pool::Release(ConnectionUniquePtr connection) {
 void Pool::WriteStatistics(utils::statistics::Writer& writer) const {
   writer.ValueWithLabels(stats_,
                          {{"mysql_instance", settings_.endpoint_info.host}});
+  writer["statements-cache"].ValueWithLabels(
+      statements_stats_, {{"mysql_instance", settings_.endpoint_info.host}});
 }
 
 Pool::Pool(clients::dns::Resolver& resolver,
@@ -72,7 +74,7 @@ Pool::ConnectionUniquePtr Pool::DoCreateConnection(engine::Deadline deadline) {
   try {
     auto connection_ptr = std::make_unique<impl::Connection>(
         resolver_, settings_.endpoint_info, settings_.auth_settings,
-        settings_.connection_settings, deadline);
+        settings_.connection_settings, statements_stats_, deadline);
     monitor_.AccountSuccess();
 
     return connection_ptr;
@@ -10,6 +10,7 @@
 
 #include <userver/drivers/impl/connection_pool_base.hpp>
 
+#include <storages/mysql/impl/statements_cache.hpp>
 #include <storages/mysql/infra/connection_ptr.hpp>
 #include <storages/mysql/infra/statistics.hpp>
 #include <storages/mysql/settings/settings.hpp>
@@ -84,6 +85,7 @@ class Pool final
   const settings::PoolSettings settings_;
 
   PoolConnectionStatistics stats_{};
+  impl::StatementsCacheStatistics statements_stats_{};
 
   PoolMonitor monitor_;
 };
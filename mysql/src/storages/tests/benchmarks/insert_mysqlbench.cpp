@@ -104,6 +104,38 @@ void batch_insert(benchmark::State& state) {
 }
 BENCHMARK(batch_insert)->Range(1000, 100'000);
 
+void bulk_insert_throughput(benchmark::State& state) {
+  engine::RunStandalone([&state] {
+    tests::ClusterWrapper cluster{};
+
+    struct Row final {
+      std::int32_t id{};
+      std::int64_t counter{};
+      std::string value;
+    };
+    std::vector<Row> rows_to_insert;
+    rows_to_insert.reserve(state.range(0));
+    for (int i = 0; i < state.range(0); ++i) {
+      rows_to_insert.push_back({i, i * 2, "some string of a moderate length"});
+    }
+
+    tests::TmpTable table{
+        cluster, "Id INT NOT NULL, Counter BIGINT NOT NULL, Value TEXT"};
+    const auto query =
+        table.FormatWithTableName("INSERT INTO {} VALUES(?, ?, ?)");
+
+    for (auto _ : state) {
+      cluster->ExecuteBulk(ClusterHostType::kPrimary, query, rows_to_insert);
+
+      state.PauseTiming();
+      table.DefaultExecute("TRUNCATE TABLE {}");
+      state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  });
+}
+BENCHMARK(bulk_insert_throughput)->RangeMultiplier(10)->Range(100, 100'000);
+
 }  // namespace storages::mysql::benches
 
 USERVER_NAMESPACE_END
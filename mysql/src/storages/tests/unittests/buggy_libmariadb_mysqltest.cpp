@@ -17,11 +17,12 @@ UTEST(Libmariadb, CONC622) {
   const settings::AuthSettings auth_settings{};  // doesn't matter
   const settings::ConnectionSettings connection_settings{
       1, false, false, settings::IpMode::kIpV4};
+  impl::StatementsCacheStatistics statements_stats;
 
   const auto try_connect = [&] {
     return impl::Connection{
         resolver, endpoint_info, auth_settings, connection_settings,
-        engine::Deadline::FromDuration(std::chrono::milliseconds{200})};
+        statements_stats, engine::Deadline::FromDuration(std::chrono::milliseconds{200})};
   };
 
   EXPECT_THROW(try_connect(), MySQLException);
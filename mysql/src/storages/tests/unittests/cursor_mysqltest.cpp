@@ -1,4 +1,7 @@
 #include <userver/utest/utest.hpp>
+
+#include <userver/engine/sleep.hpp>
+
 #include "../utils_mysqltest.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -47,6 +50,73 @@ UTEST(Cursor, Works) {
   EXPECT_EQ(db_rows, rows_to_insert);
 }
 
+UTEST(Cursor, ManyBatches) {
+  ClusterWrapper cluster{};
+  TmpTable table{cluster, "Id INT NOT NULL, Value TEXT NOT NULL"};
+
+  constexpr std::size_t rows_count = 1000;
+  std::vector<Row> rows_to_insert;
+  rows_to_insert.reserve(rows_count);
+  for (std::size_t i = 0; i < rows_count; ++i) {
+    rows_to_insert.push_back(
+        {static_cast<std::int32_t>(i), utils::generators::GenerateUuid()});
+  }
+  cluster->ExecuteBulk(
+      ClusterHostType::kPrimary,
+      table.FormatWithTableName("INSERT INTO {}(Id, Value) VALUES(?, ?)"),
+      rows_to_insert);
+
+  std::vector<Row> db_rows;
+  db_rows.reserve(rows_count);
+
+  cluster
+      ->GetCursor<Row>(
+          ClusterHostType::kPrimary, 64,
+          table.FormatWithTableName("SELECT Id, Value FROM {} ORDER BY Id"))
+      .ForEach(
+          [&db_rows](Row&& row) {
+            // give the prefetch a chance to run concurrently
+            engine::Yield();
+            db_rows.push_back(std::move(row));
+          },
+          cluster.GetDeadline());
+  EXPECT_EQ(db_rows, rows_to_insert);
+}
+
+UTEST(Cursor, CallbackThrows) {
+  ClusterWrapper cluster{};
+  TmpTable table{cluster, "Id INT NOT NULL, Value TEXT NOT NULL"};
+
+  constexpr std::size_t rows_count = 100;
+  std::vector<Row> rows_to_insert;
+  rows_to_insert.reserve(rows_count);
+  for (std::size_t i = 0; i < rows_count; ++i) {
+    rows_to_insert.push_back(
+        {static_cast<std::int32_t>(i), utils::generators::GenerateUuid()});
+  }
+  cluster->ExecuteBulk(
+      ClusterHostType::kPrimary,
+      table.FormatWithTableName("INSERT INTO {}(Id, Value) VALUES(?, ?)"),
+      rows_to_insert);
+
+  std::size_t rows_seen = 0;
+  EXPECT_ANY_THROW(
+      cluster
+          ->GetCursor<Row>(
+              ClusterHostType::kPrimary, 10,
+              table.FormatWithTableName("SELECT Id, Value FROM {}"))
+          .ForEach(
+              [&rows_seen](Row&&) {
+                if (++rows_seen == 15) throw std::runtime_error{"oops"};
+              },
+              cluster.GetDeadline()));
+  EXPECT_EQ(rows_seen, 15);
+
+  const auto db_rows =
+      table.DefaultExecute("SELECT Id, Value FROM {}").AsVector<Row>();
+  EXPECT_EQ(db_rows, rows_to_insert);
+}
+
 // https://bugs.mysql.com/bug.php?id=109380
 UTEST(Cursor, StatementReuseWorks) {
   ClusterWrapper cluster{};
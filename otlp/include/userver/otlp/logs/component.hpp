@@ -29,8 +29,16 @@ class Logger;
 /// endpoint | URI of otel collector (e.g. 127.0.0.1:4317) | -
 /// max-queue-size | Maximum async queue size | 65535
 /// max-batch-delay | Maximum batch delay | 100ms
+/// max-batch-size | Maximum number of logs and spans in a batch, a full batch is sent without waiting for max-batch-delay | 512
 /// service-name | Service name | unknown_service
 /// attributes | Extra attributes for OTLP, object of key/value strings | -
+///
+/// Logs and spans are sent to the collector as OTLP protobuf messages
+/// in batches, the gRPC channel is kept open between the batches.
+///
+/// The component exports the statistics of the default logger with
+/// `logger.otlp.*` metrics: the number of exported records by kind, dropped
+/// spans, export requests and export errors.
 
 // clang-format on
 class LoggerComponent final : public components::RawComponentBase {
@@ -0,0 +1,70 @@
+#pragma once
+
+/// @file userver/otlp/metrics/component.hpp
+/// @brief @copybrief otlp::MetricsExporterComponent
+
+#include <memory>
+#include <string_view>
+
+#include <userver/components/component_fwd.hpp>
+#include <userver/components/raw_component_base.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+class MetricsExporter;
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief Component that periodically pushes the metrics of
+/// components::StatisticsStorage to an OTLP collector.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// endpoint | URI of otel collector (e.g. 127.0.0.1:4317) | -
+/// period | Period of the metrics push | 10s
+/// timeout | Timeout of a single export request | 5s
+/// max-points-per-request | Maximum number of data points in a single export request | 1000
+/// max-points-per-push | Maximum number of data points sent in a single push, the rest are dropped | 100000
+/// compression | Whether to compress the requests with gzip | true
+/// drop-labels | Labels to remove from the metrics, the metrics that become identical are summed up | []
+/// service-name | Service name | unknown_service
+/// extra-attributes | Extra resource attributes for OTLP, object of key/value strings | -
+///
+/// Rates are sent as cumulative monotonic sums, integers and floats as gauges,
+/// histograms as cumulative explicit-bounds histograms. Dropping
+/// high-cardinality labels (e.g. `http_path`) with `drop-labels` reduces the
+/// amount of data points before they leave the service.
+///
+/// The pushes are never run concurrently. A push stops at the first failed
+/// request, the unsent points are counted as dropped and are recovered by the
+/// next push, as all the values are cumulative.
+///
+/// The component exports its own statistics with `otlp.metrics_exporter.*`
+/// metrics.
+
+// clang-format on
+class MetricsExporterComponent final : public components::RawComponentBase {
+ public:
+  static constexpr std::string_view kName = "otlp-metrics-exporter";
+
+  MetricsExporterComponent(const components::ComponentConfig&,
+                           const components::ComponentContext&);
+
+  ~MetricsExporterComponent();
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  std::unique_ptr<MetricsExporter> exporter_;
+  utils::statistics::Entry statistics_holder_;
+};
+
+}  // namespace otlp
+
+USERVER_NAMESPACE_END
@@ -41,6 +41,8 @@ LoggerComponent::LoggerComponent(const components::ComponentConfig& config,
   logger_config.max_queue_size = config["max-queue-size"].As<size_t>(65535);
   logger_config.max_batch_delay =
       config["max-batch-delay"].As<std::chrono::milliseconds>(100);
+  logger_config.max_batch_size =
+      config["max-batch-size"].As<std::size_t>(512);
   logger_config.service_name =
       config["service-name"].As<std::string>("unknown_service");
   logger_config.log_level =
@@ -74,6 +76,7 @@ LoggerComponent::LoggerComponent(const components::ComponentConfig& config,
         "logger", [this](utils::statistics::Writer& writer) {
           writer.ValueWithLabels(logger_->GetStatistics(),
                                  {"logger", "default"});
+          writer["otlp"] = logger_->GetExportStatistics();
         });
   }
 }
@@ -108,6 +111,10 @@ properties:
     max-batch-delay:
         type: string
         description: max delay between send batches (e.g. 100ms or 1s)
+    max-batch-size:
+        type: integer
+        description: max number of logs and spans in a single send batch
+        minimum: 1
     service-name:
         type: string
         description: service name
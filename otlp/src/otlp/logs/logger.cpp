@@ -51,10 +51,25 @@ void Logger::Stop() noexcept {
   sender_task_ = {};
 }
 
+void DumpMetric(utils::statistics::Writer& writer,
+                const ExportStatistics& stats) {
+  writer["exported"].ValueWithLabels(stats.exported_logs, {"kind", "log"});
+  writer["exported"].ValueWithLabels(stats.exported_spans, {"kind", "span"});
+  writer["dropped_spans"] = stats.dropped_spans;
+  writer["requests"] = stats.export_requests;
+  writer["errors"] = stats.export_errors;
+}
+
 const logging::impl::LogStatistics& Logger::GetStatistics() const {
+  stats_.queue_size.store(queue_->GetSizeApproximate(),
+                          std::memory_order_relaxed);
   return stats_;
 }
 
+const ExportStatistics& Logger::GetExportStatistics() const {
+  return export_stats_;
+}
+
 void Logger::PrependCommonTags(logging::impl::TagWriter writer) const {
   logging::impl::default_::PrependCommonTags(writer);
 }
@@ -166,6 +181,7 @@ void Logger::Trace(logging::Level, std::string_view msg) {
   auto ok = queue_producer_.PushNoblock(std::move(span));
   if (!ok) {
     ++stats_.dropped;
+    ++export_stats_.dropped_spans;
   }
 }
 
@@ -187,31 +203,58 @@ void Logger::SendingLoop(Queue::Consumer& consumer, LogClient& log_client,
   auto scope_spans = resource_spans->add_scope_spans();
   FillAttributes(*resource_spans->mutable_resource());
 
+  // The requests are reused across the batches: clearing a repeated field
+  // keeps the element objects, so the records of the next batch are moved
+  // into the already allocated messages.
   Action action{};
   while (consumer.Pop(action)) {
-    scope_logs->clear_log_records();
-    scope_spans->clear_spans();
-
     auto deadline = engine::Deadline::FromDuration(config_.max_batch_delay);
 
     do {
       std::visit(
           utils::Overloaded{
-              [&scope_spans](
-                  const opentelemetry::proto::trace::v1::Span& action) {
-                auto span = scope_spans->add_spans();
-                *span = action;
+              [&scope_spans](opentelemetry::proto::trace::v1::Span& action) {
+                *scope_spans->add_spans() = std::move(action);
               },
-              [&scope_logs](
-                  const opentelemetry::proto::logs::v1::LogRecord& action) {
-                auto log_records = scope_logs->add_log_records();
-                *log_records = action;
+              [&scope_logs](opentelemetry::proto::logs::v1::LogRecord& action) {
+                *scope_logs->add_log_records() = std::move(action);
               }},
           action);
+
+      if (static_cast<std::size_t>(scope_logs->log_records_size() +
+                                   scope_spans->spans_size()) >=
+          config_.max_batch_size) {
+        SendBatch(log_request, log_client, trace_request, trace_client);
+      }
     } while (consumer.Pop(action, deadline));
 
+    SendBatch(log_request, log_client, trace_request, trace_client);
+  }
+}
+
+void Logger::SendBatch(
+    opentelemetry::proto::collector::logs::v1::ExportLogsServiceRequest&
+        log_request,
+    LogClient& log_client,
+    opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest&
+        trace_request,
+    TraceClient& trace_client) {
+  auto* scope_logs =
+      log_request.mutable_resource_logs(0)->mutable_scope_logs(0);
+  if (scope_logs->log_records_size() != 0) {
     DoLog(log_request, log_client);
+    export_stats_.exported_logs += utils::statistics::Rate{
+        static_cast<std::uint64_t>(scope_logs->log_records_size())};
+    scope_logs->clear_log_records();
+  }
+
+  auto* scope_spans =
+      trace_request.mutable_resource_spans(0)->mutable_scope_spans(0);
+  if (scope_spans->spans_size() != 0) {
     DoTrace(trace_request, trace_client);
+    export_stats_.exported_spans += utils::statistics::Rate{
+        static_cast<std::uint64_t>(scope_spans->spans_size())};
+    scope_spans->clear_spans();
   }
 }
 
@@ -246,6 +289,7 @@ void Logger::DoLog(
     const opentelemetry::proto::collector::logs::v1::ExportLogsServiceRequest&
         request,
     LogClient& client) {
+  ++export_stats_.export_requests;
   try {
     auto call = client.Export(request);
     auto response = call.Finish();
@@ -253,16 +297,17 @@ void Logger::DoLog(
     std::cerr << "Stopping OTLP sender task\n";
     throw;
   } catch (const std::exception& e) {
+    ++export_stats_.export_errors;
     std::cerr << "Failed to write down OTLP log(s): " << e.what()
               << typeid(e).name() << "\n";
   }
-  // TODO: count exceptions
 }
 
 void Logger::DoTrace(
     const opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest&
         request,
     TraceClient& trace_client) {
+  ++export_stats_.export_requests;
   try {
     auto call = trace_client.Export(request);
     auto response = call.Finish();
@@ -270,10 +315,10 @@ void Logger::DoTrace(
     std::cerr << "Stopping OTLP sender task\n";
     throw;
   } catch (const std::exception& e) {
+    ++export_stats_.export_errors;
     std::cerr << "Failed to write down OTLP trace(s): " << e.what()
               << typeid(e).name() << "\n";
   }
-  // TODO: count exceptions
 }
 
 std::string_view Logger::MapAttribute(std::string_view attr) const {
@@ -10,6 +10,8 @@
 #include <userver/engine/task/task.hpp>
 #include <userver/logging/impl/log_stats.hpp>
 #include <userver/logging/impl/logger_base.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -18,6 +20,7 @@ namespace otlp {
 struct LoggerConfig {
   size_t max_queue_size{10000};
   std::chrono::milliseconds max_batch_delay{};
+  size_t max_batch_size{512};
 
   std::string service_name;
   std::unordered_map<std::string, std::string> extra_attributes;
@@ -25,6 +28,17 @@ struct LoggerConfig {
   logging::Level log_level{logging::Level::kInfo};
 };
 
+struct ExportStatistics final {
+  utils::statistics::RateCounter exported_logs{};
+  utils::statistics::RateCounter exported_spans{};
+  utils::statistics::RateCounter dropped_spans{};
+  utils::statistics::RateCounter export_requests{};
+  utils::statistics::RateCounter export_errors{};
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ExportStatistics& stats);
+
 class Logger final : public logging::impl::LoggerBase {
  public:
   using LogClient =
@@ -47,6 +61,8 @@ class Logger final : public logging::impl::LoggerBase {
 
   const logging::impl::LogStatistics& GetStatistics() const;
 
+  const ExportStatistics& GetExportStatistics() const;
+
  protected:
   bool DoShouldLog(logging::Level level) const noexcept override;
 
@@ -58,6 +74,14 @@ class Logger final : public logging::impl::LoggerBase {
   void SendingLoop(Queue::Consumer& consumer, LogClient& log_client,
                    TraceClient& trace_client);
 
+  void SendBatch(
+      opentelemetry::proto::collector::logs::v1::ExportLogsServiceRequest&
+          log_request,
+      LogClient& log_client,
+      opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest&
+          trace_request,
+      TraceClient& trace_client);
+
   void FillAttributes(::opentelemetry::proto::resource::v1::Resource& resource);
 
   void DoLog(
@@ -71,7 +95,8 @@ class Logger final : public logging::impl::LoggerBase {
 
   std::string_view MapAttribute(std::string_view attr) const;
 
-  logging::impl::LogStatistics stats_;
+  mutable logging::impl::LogStatistics stats_;
+  ExportStatistics export_stats_;
   const LoggerConfig config_;
   std::shared_ptr<Queue> queue_;
   Queue::MultiProducer queue_producer_;
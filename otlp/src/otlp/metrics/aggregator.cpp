@@ -0,0 +1,194 @@
+#include "aggregator.hpp"
+
+#include <algorithm>
+
+#include <userver/utils/overloaded.hpp>
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+namespace {
+
+namespace metrics_proto = opentelemetry::proto::metrics::v1;
+
+std::vector<double> GetBounds(utils::statistics::HistogramView view) {
+  std::vector<double> bounds;
+  bounds.reserve(view.GetBucketCount());
+  for (std::size_t i = 0; i < view.GetBucketCount(); ++i) {
+    bounds.push_back(view.GetUpperBoundAt(i));
+  }
+  return bounds;
+}
+
+bool HasSameBounds(utils::statistics::HistogramView lhs,
+                   utils::statistics::HistogramView rhs) {
+  if (lhs.GetBucketCount() != rhs.GetBucketCount()) return false;
+  for (std::size_t i = 0; i < lhs.GetBucketCount(); ++i) {
+    if (lhs.GetUpperBoundAt(i) != rhs.GetUpperBoundAt(i)) return false;
+  }
+  return true;
+}
+
+template <typename DataPoint>
+void FillPoint(DataPoint& point,
+               const std::vector<std::pair<std::string, std::string>>& labels,
+               const MetricsTimestamps& timestamps) {
+  for (const auto& [name, value] : labels) {
+    auto* attribute = point.add_attributes();
+    attribute->set_key(name);
+    attribute->mutable_value()->set_string_value(value);
+  }
+  point.set_start_time_unix_nano(timestamps.start_time_unix_nano);
+  point.set_time_unix_nano(timestamps.time_unix_nano);
+}
+
+}  // namespace
+
+MetricsAggregator::MetricsAggregator(
+    std::unordered_set<std::string> drop_labels)
+    : drop_labels_(std::move(drop_labels)) {}
+
+MetricsAggregator::~MetricsAggregator() = default;
+
+void MetricsAggregator::HandleMetric(
+    std::string_view path, utils::statistics::LabelsSpan labels,
+    const utils::statistics::MetricValue& value) {
+  labels_buffer_.clear();
+  for (const auto& label : labels) {
+    std::string name{label.Name()};
+    if (drop_labels_.count(name)) continue;
+    labels_buffer_.emplace_back(std::move(name), std::string{label.Value()});
+  }
+  std::sort(labels_buffer_.begin(), labels_buffer_.end());
+
+  Key key{std::string{path}, labels_buffer_};
+  const auto it = metrics_.find(key);
+  if (it == metrics_.end()) {
+    value.Visit(utils::Overloaded{
+        [&](utils::statistics::HistogramView view) {
+          utils::statistics::HistogramAggregator histogram{GetBounds(view)};
+          histogram.Add(view);
+          metrics_.emplace(std::move(key), std::move(histogram));
+        },
+        [&](auto raw) { metrics_.emplace(std::move(key), raw); },
+    });
+    return;
+  }
+
+  auto& aggregated = it->second;
+  const bool added = value.Visit(utils::Overloaded{
+      [&](utils::statistics::HistogramView view) {
+        auto* histogram =
+            std::get_if<utils::statistics::HistogramAggregator>(&aggregated);
+        if (!histogram || !HasSameBounds(histogram->GetView(), view)) {
+          return false;
+        }
+        histogram->Add(view);
+        return true;
+      },
+      [&](auto raw) {
+        auto* sum = std::get_if<decltype(raw)>(&aggregated);
+        if (!sum) return false;
+        *sum += raw;
+        return true;
+      },
+  });
+  if (!added) ++skipped_;
+}
+
+std::size_t MetricsAggregator::GetPointCount() const noexcept {
+  return metrics_.size();
+}
+
+std::size_t MetricsAggregator::GetSkippedCount() const noexcept {
+  return skipped_;
+}
+
+std::vector<MetricsAggregator::Request> MetricsAggregator::Build(
+    const opentelemetry::proto::resource::v1::Resource& resource,
+    std::size_t max_points_per_request,
+    const MetricsTimestamps& timestamps) const {
+  max_points_per_request = std::max(max_points_per_request, std::size_t{1});
+
+  std::vector<Request> result;
+  result.reserve((metrics_.size() + max_points_per_request - 1) /
+                 max_points_per_request);
+
+  metrics_proto::ScopeMetrics* scope = nullptr;
+  metrics_proto::Metric* metric = nullptr;
+  std::size_t metric_kind = std::variant_npos;
+  std::size_t points = 0;
+
+  for (const auto& [key, value] : metrics_) {
+    const auto& [path, labels] = key;
+
+    if (!scope || points == max_points_per_request) {
+      auto* resource_metrics = result.emplace_back().add_resource_metrics();
+      *resource_metrics->mutable_resource() = resource;
+      scope = resource_metrics->add_scope_metrics();
+      scope->mutable_scope()->set_name("userver");
+      metric = nullptr;
+      points = 0;
+    }
+
+    // Data points of the same metric are adjacent in the ordered map.
+    if (!metric || metric->name() != path || metric_kind != value.index()) {
+      metric = scope->add_metrics();
+      metric->set_name(path);
+      metric_kind = value.index();
+    }
+
+    std::visit(
+        utils::Overloaded{
+            [&](std::int64_t raw) {
+              auto* point = metric->mutable_gauge()->add_data_points();
+              FillPoint(*point, labels, timestamps);
+              point->set_as_int(raw);
+            },
+            [&](double raw) {
+              auto* point = metric->mutable_gauge()->add_data_points();
+              FillPoint(*point, labels, timestamps);
+              point->set_as_double(raw);
+            },
+            [&](utils::statistics::Rate raw) {
+              auto* sum = metric->mutable_sum();
+              sum->set_aggregation_temporality(
+                  metrics_proto::AGGREGATION_TEMPORALITY_CUMULATIVE);
+              sum->set_is_monotonic(true);
+              auto* point = sum->add_data_points();
+              FillPoint(*point, labels, timestamps);
+              point->set_as_int(static_cast<std::int64_t>(raw.value));
+            },
+            [&](const utils::statistics::HistogramAggregator& raw) {
+              auto* histogram = metric->mutable_histogram();
+              histogram->set_aggregation_temporality(
+                  metrics_proto::AGGREGATION_TEMPORALITY_CUMULATIVE);
+              auto* point = histogram->add_data_points();
+              FillPoint(*point, labels, timestamps);
+
+              const auto view = raw.GetView();
+              for (std::size_t i = 0; i < view.GetBucketCount(); ++i) {
+                point->add_explicit_bounds(view.GetUpperBoundAt(i));
+                point->add_bucket_counts(view.GetValueAt(i));
+              }
+              point->add_bucket_counts(view.GetValueAtInf());
+              point->set_count(view.GetTotalCount());
+            },
+        },
+        value);
+    ++points;
+  }
+
+  return result;
+}
+
+void MetricsAggregator::Clear() noexcept {
+  metrics_.clear();
+  skipped_ = 0;
+}
+
+}  // namespace otlp
+
+USERVER_NAMESPACE_END
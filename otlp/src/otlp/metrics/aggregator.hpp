@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <opentelemetry/proto/collector/metrics/v1/metrics_service.pb.h>
+
+#include <userver/utils/statistics/histogram_aggregator.hpp>
+#include <userver/utils/statistics/storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+struct MetricsTimestamps final {
+  std::uint64_t start_time_unix_nano{0};
+  std::uint64_t time_unix_nano{0};
+};
+
+/// Collects the metrics of utils::statistics::Storage, drops the configured
+/// labels and sums up the metrics that became identical, then converts them
+/// into OTLP requests.
+///
+/// Rates are exported as cumulative monotonic sums, integers and floats as
+/// gauges, histograms as cumulative explicit-bounds histograms. Metrics that
+/// cannot be summed up (e.g. histograms with different bounds) are skipped.
+class MetricsAggregator final : public utils::statistics::BaseFormatBuilder {
+ public:
+  using Request =
+      opentelemetry::proto::collector::metrics::v1::ExportMetricsServiceRequest;
+
+  explicit MetricsAggregator(std::unordered_set<std::string> drop_labels);
+
+  MetricsAggregator(MetricsAggregator&&) = delete;
+  MetricsAggregator& operator=(MetricsAggregator&&) = delete;
+  ~MetricsAggregator() override;
+
+  void HandleMetric(std::string_view path, utils::statistics::LabelsSpan labels,
+                    const utils::statistics::MetricValue& value) override;
+
+  /// Returns the number of data points after the aggregation.
+  std::size_t GetPointCount() const noexcept;
+
+  /// Returns the number of metrics that could not be aggregated.
+  std::size_t GetSkippedCount() const noexcept;
+
+  /// Converts the aggregated metrics into requests of at most
+  /// `max_points_per_request` data points each. `resource` is copied
+  /// into each request.
+  std::vector<Request> Build(
+      const opentelemetry::proto::resource::v1::Resource& resource,
+      std::size_t max_points_per_request,
+      const MetricsTimestamps& timestamps) const;
+
+  /// Forgets the aggregated metrics, keeping the dropped labels.
+  void Clear() noexcept;
+
+ private:
+  using Labels = std::vector<std::pair<std::string, std::string>>;
+  using Key = std::pair<std::string, Labels>;
+  using Value =
+      std::variant<std::int64_t, double, utils::statistics::Rate,
+                   utils::statistics::HistogramAggregator>;
+
+  const std::unordered_set<std::string> drop_labels_;
+  std::map<Key, Value> metrics_;
+  std::size_t skipped_{0};
+  Labels labels_buffer_;
+};
+
+}  // namespace otlp
+
+USERVER_NAMESPACE_END
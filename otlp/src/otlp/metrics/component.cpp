@@ -0,0 +1,110 @@
+#include <userver/otlp/metrics/component.hpp>
+
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/ugrpc/client/client_factory_component.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include "exporter.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+MetricsExporterComponent::MetricsExporterComponent(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context) {
+  auto& client_factory =
+      context.FindComponent<ugrpc::client::ClientFactoryComponent>()
+          .GetFactory();
+  auto& storage =
+      context.FindComponent<components::StatisticsStorage>().GetStorage();
+
+  auto client = client_factory.MakeClient<MetricsExporter::Client>(
+      "otlp-metrics-exporter", config["endpoint"].As<std::string>());
+
+  MetricsExporterConfig exporter_config;
+  exporter_config.period =
+      config["period"].As<std::chrono::milliseconds>(std::chrono::seconds{10});
+  exporter_config.timeout =
+      config["timeout"].As<std::chrono::milliseconds>(std::chrono::seconds{5});
+  exporter_config.max_points_per_request =
+      config["max-points-per-request"].As<std::size_t>(1000);
+  exporter_config.max_points_per_push =
+      config["max-points-per-push"].As<std::size_t>(100000);
+  exporter_config.compression = config["compression"].As<bool>(true);
+  exporter_config.service_name =
+      config["service-name"].As<std::string>("unknown_service");
+  exporter_config.extra_attributes =
+      config["extra-attributes"]
+          .As<std::unordered_map<std::string, std::string>>({});
+  exporter_config.drop_labels =
+      config["drop-labels"].As<std::unordered_set<std::string>>({});
+
+  exporter_ = std::make_unique<MetricsExporter>(std::move(client), storage,
+                                                std::move(exporter_config));
+
+  statistics_holder_ = storage.RegisterWriter(
+      "otlp.metrics_exporter", [this](utils::statistics::Writer& writer) {
+        writer = exporter_->GetStatistics();
+      });
+
+  exporter_->Start();
+}
+
+MetricsExporterComponent::~MetricsExporterComponent() {
+  exporter_->Stop();
+  statistics_holder_.Unregister();
+}
+
+yaml_config::Schema MetricsExporterComponent::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<components::RawComponentBase>(R"(
+type: object
+description: >
+    OpenTelemetry metrics push exporter component
+additionalProperties: false
+properties:
+    endpoint:
+        type: string
+        description: >
+            Hostname:port of otel collector (gRPC).
+    period:
+        type: string
+        description: period of the metrics push (e.g. 10s)
+    timeout:
+        type: string
+        description: timeout of a single export request (e.g. 5s)
+    max-points-per-request:
+        type: integer
+        description: max number of data points in a single export request
+        minimum: 1
+    max-points-per-push:
+        type: integer
+        description: max number of data points sent in a single push
+        minimum: 1
+    compression:
+        type: boolean
+        description: whether to compress the requests with gzip
+    drop-labels:
+        type: array
+        description: labels to remove before the aggregation
+        items:
+            type: string
+            description: label name
+    service-name:
+        type: string
+        description: service name
+    extra-attributes:
+        type: object
+        description: extra OTLP resource attributes
+        properties: {}
+        additionalProperties:
+            type: string
+            description: attribute value
+)");
+}
+
+}  // namespace otlp
+
+USERVER_NAMESPACE_END
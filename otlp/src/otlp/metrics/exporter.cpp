@@ -0,0 +1,172 @@
+#include "exporter.hpp"
+
+#include <algorithm>
+
+#include <grpcpp/client_context.h>
+
+#include <userver/logging/log.hpp>
+#include <userver/ugrpc/client/exceptions.hpp>
+
+#include "aggregator.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+namespace {
+
+constexpr std::string_view kTelemetrySdkLanguage = "telemetry.sdk.language";
+constexpr std::string_view kTelemetrySdkName = "telemetry.sdk.name";
+constexpr std::string_view kServiceName = "service.name";
+
+std::uint64_t NowUnixNano() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+std::size_t CountPoints(const MetricsAggregator::Request& request) {
+  std::size_t points = 0;
+  for (const auto& resource_metrics : request.resource_metrics()) {
+    for (const auto& scope_metrics : resource_metrics.scope_metrics()) {
+      for (const auto& metric : scope_metrics.metrics()) {
+        points += metric.gauge().data_points_size() +
+                  metric.sum().data_points_size() +
+                  metric.histogram().data_points_size();
+      }
+    }
+  }
+  return points;
+}
+
+}  // namespace
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const MetricsExportStatistics& stats) {
+  writer["pushes"] = stats.pushes;
+  writer["requests"] = stats.export_requests;
+  writer["errors"] = stats.export_errors;
+  writer["points"].ValueWithLabels(stats.exported_points,
+                                   {"kind", "exported"});
+  writer["points"].ValueWithLabels(stats.dropped_points, {"kind", "dropped"});
+  writer["points"].ValueWithLabels(stats.skipped_points, {"kind", "skipped"});
+}
+
+MetricsExporter::MetricsExporter(Client client,
+                                 const utils::statistics::Storage& storage,
+                                 MetricsExporterConfig&& config)
+    : client_(std::move(client)),
+      storage_(storage),
+      config_(std::move(config)),
+      start_time_unix_nano_(NowUnixNano()) {}
+
+MetricsExporter::~MetricsExporter() { Stop(); }
+
+void MetricsExporter::Start() {
+  task_.Start("otlp-metrics-exporter", config_.period, [this] { Push(); });
+}
+
+void MetricsExporter::Stop() noexcept { task_.Stop(); }
+
+void MetricsExporter::Push() {
+  ++stats_.pushes;
+
+  MetricsAggregator aggregator{config_.drop_labels};
+  storage_.VisitMetrics(aggregator);
+  stats_.skipped_points +=
+      utils::statistics::Rate{aggregator.GetSkippedCount()};
+
+  ::opentelemetry::proto::resource::v1::Resource resource;
+  FillResource(resource);
+  const auto requests =
+      aggregator.Build(resource, config_.max_points_per_request,
+                       {start_time_unix_nano_, NowUnixNano()});
+
+  // The values are cumulative, so the points that were not sent are
+  // recovered by the next push. Stop at the first error not to pile up
+  // the load on a struggling collector.
+  std::size_t sent_points = 0;
+  bool failed = false;
+  for (const auto& request : requests) {
+    const auto points = CountPoints(request);
+    if (failed || sent_points + points > config_.max_points_per_push) {
+      stats_.dropped_points += utils::statistics::Rate{points};
+      continue;
+    }
+
+    if (DoExport(request)) {
+      stats_.exported_points += utils::statistics::Rate{points};
+      sent_points += points;
+    } else {
+      stats_.dropped_points += utils::statistics::Rate{points};
+      failed = true;
+    }
+  }
+}
+
+const MetricsExportStatistics& MetricsExporter::GetStatistics() const {
+  return stats_;
+}
+
+bool MetricsExporter::DoExport(
+    const opentelemetry::proto::collector::metrics::v1::
+        ExportMetricsServiceRequest& request) {
+  ++stats_.export_requests;
+
+  auto context = std::make_unique<grpc::ClientContext>();
+  if (config_.compression) {
+    context->set_compression_algorithm(GRPC_COMPRESS_GZIP);
+  }
+  ugrpc::client::Qos qos;
+  qos.timeout = config_.timeout;
+
+  try {
+    auto call = client_.Export(request, std::move(context), qos);
+    auto response = call.Finish();
+    if (response.has_partial_success() &&
+        response.partial_success().rejected_data_points() > 0) {
+      LOG_LIMITED_WARNING()
+          << "OTLP collector rejected "
+          << response.partial_success().rejected_data_points()
+          << " metric points: " << response.partial_success().error_message();
+    }
+    return true;
+  } catch (const ugrpc::client::RpcCancelledError&) {
+    throw;
+  } catch (const std::exception& e) {
+    ++stats_.export_errors;
+    LOG_LIMITED_WARNING() << "Failed to export OTLP metrics: " << e;
+    return false;
+  }
+}
+
+void MetricsExporter::FillResource(
+    ::opentelemetry::proto::resource::v1::Resource& resource) {
+  {
+    auto* attr = resource.add_attributes();
+    attr->set_key(std::string{kTelemetrySdkLanguage});
+    attr->mutable_value()->set_string_value("cpp");
+  }
+
+  {
+    auto* attr = resource.add_attributes();
+    attr->set_key(std::string{kTelemetrySdkName});
+    attr->mutable_value()->set_string_value("userver");
+  }
+
+  {
+    auto* attr = resource.add_attributes();
+    attr->set_key(std::string{kServiceName});
+    attr->mutable_value()->set_string_value(config_.service_name);
+  }
+
+  for (const auto& [key, value] : config_.extra_attributes) {
+    auto* attr = resource.add_attributes();
+    attr->set_key(key);
+    attr->mutable_value()->set_string_value(value);
+  }
+}
+
+}  // namespace otlp
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <opentelemetry/proto/collector/metrics/v1/metrics_service_client.usrv.pb.hpp>
+
+#include <userver/utils/periodic_task.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+struct MetricsExporterConfig {
+  std::chrono::milliseconds period{10000};
+  std::chrono::milliseconds timeout{5000};
+  std::size_t max_points_per_request{1000};
+  std::size_t max_points_per_push{100000};
+  bool compression{true};
+
+  std::string service_name;
+  std::unordered_map<std::string, std::string> extra_attributes;
+  std::unordered_set<std::string> drop_labels;
+};
+
+struct MetricsExportStatistics final {
+  utils::statistics::RateCounter pushes{};
+  utils::statistics::RateCounter export_requests{};
+  utils::statistics::RateCounter export_errors{};
+  utils::statistics::RateCounter exported_points{};
+  utils::statistics::RateCounter dropped_points{};
+  utils::statistics::RateCounter skipped_points{};
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const MetricsExportStatistics& stats);
+
+class MetricsExporter final {
+ public:
+  using Client =
+      opentelemetry::proto::collector::metrics::v1::MetricsServiceClient;
+
+  MetricsExporter(Client client, const utils::statistics::Storage& storage,
+                  MetricsExporterConfig&& config);
+
+  ~MetricsExporter();
+
+  void Start();
+
+  void Stop() noexcept;
+
+  /// Collects and sends the metrics once.
+  void Push();
+
+  const MetricsExportStatistics& GetStatistics() const;
+
+ private:
+  bool DoExport(
+      const opentelemetry::proto::collector::metrics::v1::
+          ExportMetricsServiceRequest& request);
+
+  void FillResource(::opentelemetry::proto::resource::v1::Resource& resource);
+
+  Client client_;
+  const utils::statistics::Storage& storage_;
+  const MetricsExporterConfig config_;
+  const std::uint64_t start_time_unix_nano_;
+  MetricsExportStatistics stats_;
+  utils::PeriodicTask task_;
+};
+
+}  // namespace otlp
+
+USERVER_NAMESPACE_END
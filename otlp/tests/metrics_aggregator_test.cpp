@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include <otlp/metrics/aggregator.hpp>
+
+#include <userver/utils/statistics/histogram.hpp>
+#include <userver/utils/statistics/labels.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace metrics_proto = opentelemetry::proto::metrics::v1;
+
+constexpr otlp::MetricsTimestamps kTimestamps{10, 20};
+
+std::vector<otlp::MetricsAggregator::Request> Build(
+    const otlp::MetricsAggregator& aggregator,
+    std::size_t max_points_per_request = 100) {
+  return aggregator.Build({}, max_points_per_request, kTimestamps);
+}
+
+const metrics_proto::ScopeMetrics& GetScope(
+    const otlp::MetricsAggregator::Request& request) {
+  return request.resource_metrics(0).scope_metrics(0);
+}
+
+}  // namespace
+
+TEST(OtlpMetricsAggregator, DropLabels) {
+  otlp::MetricsAggregator aggregator{{"host"}};
+  aggregator.HandleMetric("requests", {{"host", "a"}, {"method", "GET"}},
+                          utils::statistics::Rate{1});
+  aggregator.HandleMetric("requests", {{"method", "GET"}, {"host", "b"}},
+                          utils::statistics::Rate{2});
+  aggregator.HandleMetric("requests", {{"host", "a"}, {"method", "POST"}},
+                          utils::statistics::Rate{4});
+  EXPECT_EQ(aggregator.GetPointCount(), 2);
+  EXPECT_EQ(aggregator.GetSkippedCount(), 0);
+
+  const auto requests = Build(aggregator);
+  ASSERT_EQ(requests.size(), 1);
+  const auto& scope = GetScope(requests[0]);
+  ASSERT_EQ(scope.metrics_size(), 1);
+
+  const auto& metric = scope.metrics(0);
+  EXPECT_EQ(metric.name(), "requests");
+  ASSERT_TRUE(metric.has_sum());
+  EXPECT_TRUE(metric.sum().is_monotonic());
+  EXPECT_EQ(metric.sum().aggregation_temporality(),
+            metrics_proto::AGGREGATION_TEMPORALITY_CUMULATIVE);
+  ASSERT_EQ(metric.sum().data_points_size(), 2);
+
+  const auto& get = metric.sum().data_points(0);
+  EXPECT_EQ(get.as_int(), 3);
+  ASSERT_EQ(get.attributes_size(), 1);
+  EXPECT_EQ(get.attributes(0).key(), "method");
+  EXPECT_EQ(get.attributes(0).value().string_value(), "GET");
+  EXPECT_EQ(get.start_time_unix_nano(), 10);
+  EXPECT_EQ(get.time_unix_nano(), 20);
+
+  EXPECT_EQ(metric.sum().data_points(1).as_int(), 4);
+}
+
+TEST(OtlpMetricsAggregator, Gauges) {
+  otlp::MetricsAggregator aggregator{{"shard"}};
+  aggregator.HandleMetric("connections", {{"shard", "1"}}, std::int64_t{5});
+  aggregator.HandleMetric("connections", {{"shard", "2"}}, std::int64_t{7});
+  aggregator.HandleMetric("load", {{"shard", "1"}}, 0.5);
+  aggregator.HandleMetric("load", {{"shard", "2"}}, 0.25);
+  // Type mismatch
+  aggregator.HandleMetric("load", {{"shard", "2"}}, std::int64_t{1});
+  EXPECT_EQ(aggregator.GetSkippedCount(), 1);
+
+  const auto requests = Build(aggregator);
+  ASSERT_EQ(requests.size(), 1);
+  const auto& scope = GetScope(requests[0]);
+  ASSERT_EQ(scope.metrics_size(), 2);
+  EXPECT_EQ(scope.metrics(0).gauge().data_points(0).as_int(), 12);
+  EXPECT_EQ(scope.metrics(1).gauge().data_points(0).as_double(), 0.75);
+}
+
+TEST(OtlpMetricsAggregator, Histograms) {
+  otlp::MetricsAggregator aggregator{{"shard"}};
+  const double bounds[] = {1, 2};
+  const double other_bounds[] = {1, 3};
+
+  utils::statistics::Histogram histogram1{bounds};
+  histogram1.Account(1);
+  histogram1.Account(5);
+  utils::statistics::Histogram histogram2{bounds};
+  histogram2.Account(2, 3);
+  utils::statistics::Histogram other{other_bounds};
+
+  aggregator.HandleMetric("timings", {{"shard", "1"}}, histogram1.GetView());
+  aggregator.HandleMetric("timings", {{"shard", "2"}}, histogram2.GetView());
+  aggregator.HandleMetric("timings", {{"shard", "2"}}, other.GetView());
+  EXPECT_EQ(aggregator.GetSkippedCount(), 1);
+
+  const auto requests = Build(aggregator);
+  ASSERT_EQ(requests.size(), 1);
+  const auto& metric = GetScope(requests[0]).metrics(0);
+  ASSERT_TRUE(metric.has_histogram());
+  const auto& point = metric.histogram().data_points(0);
+  EXPECT_EQ(point.count(), 5);
+  ASSERT_EQ(point.explicit_bounds_size(), 2);
+  EXPECT_EQ(point.explicit_bounds(1), 2);
+  ASSERT_EQ(point.bucket_counts_size(), 3);
+  EXPECT_EQ(point.bucket_counts(0), 1);
+  EXPECT_EQ(point.bucket_counts(1), 3);
+  EXPECT_EQ(point.bucket_counts(2), 1);
+}
+
+TEST(OtlpMetricsAggregator, SplitRequests) {
+  otlp::MetricsAggregator aggregator{{}};
+  for (int i = 0; i < 5; ++i) {
+    const std::string value = std::to_string(i);
+    aggregator.HandleMetric("metric", {{"id", value}}, std::int64_t{i});
+  }
+
+  const auto requests = Build(aggregator, 2);
+  ASSERT_EQ(requests.size(), 3);
+  EXPECT_EQ(GetScope(requests[0]).metrics(0).gauge().data_points_size(), 2);
+  EXPECT_EQ(GetScope(requests[1]).metrics(0).gauge().data_points_size(), 2);
+  EXPECT_EQ(GetScope(requests[2]).metrics(0).gauge().data_points_size(), 1);
+  EXPECT_EQ(GetScope(requests[2]).metrics(0).name(), "metric");
+}
+
+USERVER_NAMESPACE_END
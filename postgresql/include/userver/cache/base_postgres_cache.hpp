@@ -6,7 +6,10 @@
 #include <userver/cache/base_postgres_cache_fwd.hpp>
 
 #include <chrono>
+#include <functional>
 #include <map>
+#include <optional>
+#include <string>
 #include <string_view>
 #include <type_traits>
 #include <unordered_map>
@@ -23,9 +26,11 @@
 #include <userver/storages/postgres/io/chrono.hpp>
 
 #include <userver/compiler/demangle.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/cpu_relax.hpp>
 #include <userver/utils/meta.hpp>
 #include <userver/utils/void_t.hpp>
@@ -66,6 +71,30 @@ namespace components {
 /// incremental-update-op-timeout | timeout for an incremental update | 1s
 /// update-correction | incremental update window adjustment | - (0 for caches with defined GetLastKnownUpdated)
 /// chunk-size | number of rows to request from PostgreSQL via portals, 0 to fetch all rows in one request without portals | 1000
+/// chunk-prefetch | fetch the next chunk while the current one is parsed, at most two chunks are kept in memory | true
+/// listen-channel | PostgreSQL channel to LISTEN on, every NOTIFY on it triggers an update of the cache | -
+///
+/// ### Updates on NOTIFY
+///
+/// If `listen-channel` is set, the cache holds a connection per shard that
+/// LISTENs on the channel. A notification triggers an incremental update (a
+/// full one for caches without incremental updates) via
+/// cache::CacheUpdateTrait::InvalidateAsync, so a burst of notifications
+/// results in a single update. The periodic updates are still performed, they
+/// pick up the changes if a notification was lost, e.g. while reconnecting.
+///
+/// A trigger on the cached table could be used to send the notifications:
+/// @code{.sql}
+/// CREATE FUNCTION notify_my_cache() RETURNS trigger AS $$
+/// BEGIN
+///   PERFORM pg_notify('my_cache', '');
+///   RETURN NULL;
+/// END;
+/// $$ LANGUAGE plpgsql;
+///
+/// CREATE TRIGGER my_cache_notify AFTER INSERT OR UPDATE OR DELETE ON my_table
+///   FOR EACH STATEMENT EXECUTE FUNCTION notify_my_cache();
+/// @endcode
 ///
 /// @section pg_cc_cache_policy Cache policy
 ///
@@ -368,6 +397,13 @@ inline constexpr std::string_view kFetchStage = "fetch";
 inline constexpr std::string_view kParseStage = "parse";
 
 inline constexpr std::size_t kDefaultChunkSize = 1000;
+
+// Subscribes to `channel` and calls `on_notify` on every notification until
+// the current task is cancelled, resubscribes on errors
+void ListenNotifications(storages::postgres::Cluster& cluster,
+                         const std::string& channel,
+                         std::string_view cache_name,
+                         const std::function<void()>& on_notify);
 }  // namespace pg_cache::detail
 
 /// @ingroup userver_components
@@ -425,14 +461,20 @@ class PostgreCache final
 
   std::chrono::milliseconds ParseCorrection(const ComponentConfig& config);
 
+  void StartListening();
+  void StopListening() noexcept;
+
   std::vector<storages::postgres::ClusterPtr> clusters_;
 
   const std::chrono::system_clock::duration correction_;
   const std::chrono::milliseconds full_update_timeout_;
   const std::chrono::milliseconds incremental_update_timeout_;
   const std::size_t chunk_size_;
+  const bool chunk_prefetch_;
+  const std::optional<std::string> listen_channel_;
   std::size_t cpu_relax_iterations_parse_{0};
   std::size_t cpu_relax_iterations_copy_{0};
+  std::vector<engine::TaskWithResult<void>> listen_tasks_;
 };
 
 template <typename PostgreCachePolicy>
@@ -450,7 +492,10 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config,
           config["incremental-update-op-timeout"].As<std::chrono::milliseconds>(
               pg_cache::detail::kDefaultIncrementalUpdateTimeout)},
       chunk_size_{config["chunk-size"].As<size_t>(
-          pg_cache::detail::kDefaultChunkSize)} {
+          pg_cache::detail::kDefaultChunkSize)},
+      chunk_prefetch_{config["chunk-prefetch"].As<bool>(true)},
+      listen_channel_{
+          config["listen-channel"].As<std::optional<std::string>>()} {
   UINVARIANT(
       !chunk_size_ || storages::postgres::Portal::IsSupportedByDriver(),
       "Either set 'chunk-size' to 0, or enable PostgreSQL portals by building "
@@ -488,13 +533,39 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config,
              << GetDeltaQuery().Statement() << "`";
 
   this->StartPeriodicUpdates();
+  StartListening();
 }
 
 template <typename PostgreCachePolicy>
 PostgreCache<PostgreCachePolicy>::~PostgreCache() {
+  StopListening();
   this->StopPeriodicUpdates();
 }
 
+template <typename PostgreCachePolicy>
+void PostgreCache<PostgreCachePolicy>::StartListening() {
+  if (!listen_channel_) return;
+
+  listen_tasks_.reserve(clusters_.size());
+  for (const auto& cluster : clusters_) {
+    listen_tasks_.push_back(utils::CriticalAsync(
+        fmt::format("pg-cache-listen/{}", kName), [this, cluster] {
+          pg_cache::detail::ListenNotifications(
+              *cluster, *listen_channel_, kName, [this] {
+                this->InvalidateAsync(kIncrementalUpdates
+                                          ? cache::UpdateType::kIncremental
+                                          : cache::UpdateType::kFull);
+              });
+        }));
+  }
+}
+
+template <typename PostgreCachePolicy>
+void PostgreCache<PostgreCachePolicy>::StopListening() noexcept {
+  for (auto& task : listen_tasks_) task.SyncCancel();
+  listen_tasks_.clear();
+}
+
 template <typename PostgreCachePolicy>
 storages::postgres::Query PostgreCache<PostgreCachePolicy>::GetAllQuery() {
   storages::postgres::Query query = PolicyCheckerType::GetQuery();
@@ -584,10 +655,18 @@ void PostgreCache<PostgreCachePolicy>::Update(
           pg::CommandControl{timeout, pg_cache::detail::kStatementTimeoutOff});
       auto portal =
           trx.MakePortal(query, GetLastUpdated(last_update, *data_cache));
-      while (portal) {
+      // The portal must not be touched while the next chunk is being fetched
+      engine::TaskWithResult<pg::ResultSet> next_chunk;
+      while (next_chunk.IsValid() || portal) {
         scope.Reset(std::string{pg_cache::detail::kFetchStage});
-        auto res = portal.Fetch(chunk_size_);
+        auto res = next_chunk.IsValid() ? next_chunk.Get()
+                                        : portal.Fetch(chunk_size_);
         stats_scope.IncreaseDocumentsReadCount(res.Size());
+        if (chunk_prefetch_ && portal) {
+          next_chunk = utils::Async("pg_cache_fetch_chunk", [this, &portal] {
+            return portal.Fetch(chunk_size_);
+          });
+        }
 
         scope.Reset(std::string{pg_cache::detail::kParseStage});
         CacheResults(res, data_cache, stats_scope, scope);
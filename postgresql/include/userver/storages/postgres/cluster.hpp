@@ -4,6 +4,7 @@
 /// @brief @copybrief storages::postgres::Cluster
 
 #include <memory>
+#include <optional>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/dynamic_config/source.hpp>
@@ -157,6 +158,17 @@ class Cluster {
   /// @throws ClusterUnavailable if no hosts are available
   Transaction Begin(std::string name, ClusterHostTypeFlags,
                     const TransactionOptions&);
+
+  /// Start a read-only transaction that sees the writes up to `min_lsn`.
+  ///
+  /// Only the slaves of the requested type that have replayed WAL up to
+  /// `min_lsn` as of the last topology check are used. If there are none,
+  /// the transaction is started on master. `min_lsn` is usually obtained with
+  /// Transaction::CommitWithLsn, kUnknownLsn imposes no restrictions.
+  /// If the transaction is RW, only master connection can be used.
+  /// @throws ClusterUnavailable if no hosts are available
+  Transaction Begin(ClusterHostTypeFlags, Lsn min_lsn,
+                    const TransactionOptions&, OptionalCommandControl = {});
   /// @}
 
   /// Start a query queue with specified host selection rules and timeout for
@@ -170,6 +182,13 @@ class Cluster {
 
   /// @name Single-statement query in an auto-commit transaction
   /// @{
+  ///
+  /// With a non-zero `pipelined_connections` in PoolSettings, concurrent
+  /// single statements to the same host are not given a connection each, but
+  /// are batched into libpq pipelines executed on that many connections. The
+  /// mode requires pipelining and prepared statements to be enabled in
+  /// ConnectionSettings, otherwise the batched statements are executed one
+  /// by one.
 
   /// @brief Execute a statement at host of specified type.
   /// @note You must specify at least one role from ClusterHostType here
@@ -194,6 +213,20 @@ class Cluster {
   ResultSet Execute(ClusterHostTypeFlags, OptionalCommandControl,
                     const Query& query, const Args&... args);
 
+  /// @brief Execute a statement at a host that has replayed WAL up to
+  /// `min_lsn`, see Begin for the host selection.
+  /// @note You must specify at least one role from ClusterHostType here
+  template <typename... Args>
+  ResultSet Execute(ClusterHostTypeFlags, Lsn min_lsn, const Query& query,
+                    const Args&... args);
+
+  /// @brief Execute a statement at a host that has replayed WAL up to
+  /// `min_lsn` with specified command control settings.
+  /// @note You must specify at least one role from ClusterHostType here
+  template <typename... Args>
+  ResultSet Execute(ClusterHostTypeFlags, Lsn min_lsn, OptionalCommandControl,
+                    const Query& query, const Args&... args);
+
   /// @brief Execute a statement with stored arguments and specified host
   /// selection rules.
   ResultSet Execute(ClusterHostTypeFlags flags, const Query& query,
@@ -240,7 +273,13 @@ class Cluster {
   void SetStatementMetricsSettings(const StatementMetricsSettings& settings);
 
  private:
-  detail::NonTransaction Start(ClusterHostTypeFlags, OptionalCommandControl);
+  detail::NonTransaction Start(ClusterHostTypeFlags, Lsn min_lsn,
+                               OptionalCommandControl);
+
+  /// Returns std::nullopt if pipelined execution is disabled for the host
+  std::optional<ResultSet> TryExecutePipelined(
+      ClusterHostTypeFlags, Lsn min_lsn, OptionalCommandControl,
+      const Query& query, detail::QueryParametersWriter params_writer);
 
   OptionalCommandControl GetQueryCmdCtl(const std::string& query_name) const;
   OptionalCommandControl GetHandlersCmdCtl(
@@ -259,11 +298,34 @@ template <typename... Args>
 ResultSet Cluster::Execute(ClusterHostTypeFlags flags,
                            OptionalCommandControl statement_cmd_ctl,
                            const Query& query, const Args&... args) {
+  return Execute(flags, kUnknownLsn, statement_cmd_ctl, query, args...);
+}
+
+template <typename... Args>
+ResultSet Cluster::Execute(ClusterHostTypeFlags flags, Lsn min_lsn,
+                           const Query& query, const Args&... args) {
+  return Execute(flags, min_lsn, OptionalCommandControl{}, query, args...);
+}
+
+template <typename... Args>
+ResultSet Cluster::Execute(ClusterHostTypeFlags flags, Lsn min_lsn,
+                           OptionalCommandControl statement_cmd_ctl,
+                           const Query& query, const Args&... args) {
   if (!statement_cmd_ctl && query.GetName()) {
     statement_cmd_ctl = GetQueryCmdCtl(query.GetName()->GetUnderlying());
   }
   statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
-  auto ntrx = Start(flags, statement_cmd_ctl);
+  {
+    detail::StaticQueryParameters<sizeof...(args)> params;
+    const auto params_writer = [&params, &args...](const UserTypes& types) {
+      params.Write(types, args...);
+      return detail::QueryParameters{params};
+    };
+    auto result = TryExecutePipelined(flags, min_lsn, statement_cmd_ctl, query,
+                                      params_writer);
+    if (result) return std::move(*result);
+  }
+  auto ntrx = Start(flags, min_lsn, statement_cmd_ctl);
   return ntrx.Execute(statement_cmd_ctl, query, args...);
 }
 
@@ -3,9 +3,11 @@
 /// @file userver/storages/postgres/cluster_types.hpp
 /// @brief Cluster properties
 
+#include <cstdint>
 #include <string>
 
 #include <userver/utils/flags.hpp>
+#include <userver/utils/strong_typedef.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -67,6 +69,18 @@ struct ClusterHostTypeHash {
   }
 };
 
+/// @brief Position in the write-ahead log of the cluster.
+///
+/// Obtained from Transaction::CommitWithLsn, it is used as a read-your-writes
+/// token: statements that carry it are executed only on the hosts that have
+/// replayed the log up to this position.
+using Lsn = USERVER_NAMESPACE::utils::StrongTypedef<struct LsnTag, uint64_t>;
+
+/// Unknown position, imposes no restrictions on the host selection
+constexpr Lsn kUnknownLsn{0};
+
+logging::LogHelper& operator<<(logging::LogHelper& lh, Lsn lsn);
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
@@ -128,11 +128,15 @@ namespace components {
 /// ignore_unused_query_params| disable check for not-NULL query params that are not used in query          | false
 /// monitoring-dbalias      | name of the database for monitorings                                          | calculated from dbalias or dbconnection options
 /// max_prepared_cache_size | prepared statements cache size limit                                          | 200
+/// prepared-statements-warmup | number of the most executed statements of the pool to prepare in a single batch on new connections | 0
 /// max_statement_metrics   | limit of exported metrics for named statements                                | 0
 /// min_pool_size           | number of connections created initially                                       | 4
 /// max_pool_size           | maximum number of created connections for "connlimit_mode: manual"            | 15
 /// max_queue_size          | maximum number of clients waiting for a connection                            | 200
 /// connecting_limit        | limit for concurrent establishing connections number per pool (0 - unlimited) | 0
+/// pipelined_connections   | number of connections per pool that concurrent single statements are pipelined into (0 - disabled), requires `pipeline_enabled` | 0
+/// adaptive_pool_size      | grow the pool above min_pool_size ahead of demand when clients wait for connections, shrink it back at low load; the pool never exceeds the max connections set by max_pool_size, connlimit_mode and congestion control | false
+/// critical_reserved_connections | number of connections that only the queries with storages::postgres::QueryPriority::kCritical may take; at most a half of the max connections is reserved | 0
 /// connlimit_mode          | max_connections setup mode (manual or auto), also see @ref scripts/docs/en/userver/pg_connlimit_mode_auto.md | auto
 /// error-injection         | artificial error injection settings, error_injection::Settings                | --
 
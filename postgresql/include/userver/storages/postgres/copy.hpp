@@ -0,0 +1,196 @@
+#pragma once
+
+/// @file userver/storages/postgres/copy.hpp
+/// @brief @copybrief storages::postgres::CopyOutStream
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <userver/compiler/demangle.hpp>
+#include <userver/utils/function_ref.hpp>
+
+#include <userver/storages/postgres/detail/connection_ptr.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/io/field_buffer.hpp>
+#include <userver/storages/postgres/io/row_types.hpp>
+#include <userver/storages/postgres/io/supported_types.hpp>
+#include <userver/storages/postgres/io/user_types.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/postgres_fwd.hpp>
+#include <userver/storages/postgres/query.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace detail {
+
+/// Rows are sent to the server in CopyData messages of about this size
+inline constexpr std::size_t kCopyInChunkSize = 64 * 1024;
+
+/// Appends encoded rows to the buffer, returns false after the last row
+using CopyInChunkWriter =
+    USERVER_NAMESPACE::utils::function_ref<bool(std::vector<char>& buffer)>;
+
+/// Binary COPY file header, with no flags and no header extension
+void WriteCopyHeader(std::vector<char>& buffer);
+
+/// Binary COPY file trailer
+void WriteCopyTrailer(std::vector<char>& buffer);
+
+/// Encodes a row as a binary COPY tuple. Fields of a row type are written as
+/// separate columns, any other type is written as a single column.
+template <typename T>
+void WriteCopyRow(const UserTypes& types, std::vector<char>& buffer,
+                  const T& row) {
+  if constexpr (io::traits::kIsRowType<T>) {
+    using RowType = io::RowType<T>;
+    io::WriteBuffer(types, buffer, static_cast<Smallint>(RowType::size));
+    std::apply(
+        [&types, &buffer](const auto&... fields) {
+          (io::WriteRawBinary(types, buffer, fields), ...);
+        },
+        RowType::GetTuple(row));
+  } else {
+    io::WriteBuffer(types, buffer, Smallint{1});
+    io::WriteRawBinary(types, buffer, row);
+  }
+}
+
+/// Reads the data rows of a running `COPY ... TO STDOUT (FORMAT binary)`.
+/// Not-consumed rows are discarded on destruction.
+class CopyOutReader {
+ public:
+  CopyOutReader(const ConnectionPtr& conn, const Query& query,
+                OptionalCommandControl statement_cmd_ctl);
+
+  CopyOutReader(CopyOutReader&&) noexcept;
+  CopyOutReader& operator=(CopyOutReader&&) = delete;
+
+  CopyOutReader(const CopyOutReader&) = delete;
+  CopyOutReader& operator=(const CopyOutReader&) = delete;
+
+  ~CopyOutReader();
+
+  /// Points the `row` to the next tuple, the buffer is valid until the next
+  /// call. Returns false after the last tuple.
+  bool ReadRow(io::FieldBuffer& row);
+
+  const UserTypes& GetUserTypes() const;
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> pimpl_;
+};
+
+}  // namespace detail
+
+/// @brief Rows of a `COPY ... TO STDOUT` streamed from the server.
+///
+/// Obtained via storages::postgres::Transaction::CopyOut. Rows are parsed into
+/// `T` as they arrive, the same way storages::postgres::TypedResultSet does
+/// it: a row type gets a field per column, any other type expects a single
+/// column. The binary COPY format does not carry column types, so they are not
+/// checked against `T`.
+///
+/// The stream can be iterated only once and must not outlive the transaction.
+/// The transaction cannot be used for other queries until all the rows are
+/// read or the stream is destroyed.
+template <typename T,
+          typename ExtractionTag = typename io::traits::ExtractionTag<T>::type>
+class CopyOutStream {
+  static_assert(std::is_same_v<ExtractionTag, RowTag> ||
+                    std::is_same_v<ExtractionTag, FieldTag>,
+                "Unexpected extraction tag");
+
+ public:
+  class Iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = T;
+    using reference = T&;
+    using pointer = T*;
+
+    Iterator() = default;
+
+    reference operator*() const { return stream_->row_; }
+    pointer operator->() const { return &stream_->row_; }
+
+    Iterator& operator++() {
+      if (!stream_->ReadNext()) stream_ = nullptr;
+      return *this;
+    }
+    void operator++(int) { ++*this; }
+
+    bool operator==(const Iterator& rhs) const {
+      return stream_ == rhs.stream_;
+    }
+    bool operator!=(const Iterator& rhs) const { return !(*this == rhs); }
+
+   private:
+    friend class CopyOutStream;
+
+    explicit Iterator(CopyOutStream* stream) : stream_{stream} {}
+
+    CopyOutStream* stream_{nullptr};
+  };
+
+  /// @cond
+  explicit CopyOutStream(detail::CopyOutReader&& reader)
+      : reader_{std::move(reader)} {}
+  /// @endcond
+
+  /// Reads the first row
+  Iterator begin() { return Iterator{ReadNext() ? this : nullptr}; }
+  Iterator end() { return {}; }
+
+ private:
+  bool ReadNext() {
+    io::FieldBuffer buffer;
+    if (!reader_.ReadRow(buffer)) return false;
+
+    const auto& categories = reader_.GetUserTypes().GetTypeBufferCategories();
+    Smallint field_count{0};
+    buffer.Read(field_count, io::BufferCategory::kPlainBuffer);
+    if constexpr (std::is_same_v<ExtractionTag, RowTag>) {
+      using RowType = io::RowType<T>;
+      if (field_count != static_cast<Smallint>(RowType::size)) {
+        throw InvalidTupleSizeRequested(field_count, RowType::size);
+      }
+      std::apply(
+          [&buffer, &categories](auto&&... fields) {
+            (ReadField(buffer, categories, fields), ...);
+          },
+          RowType::GetTuple(row_));
+    } else {
+      if (field_count != 1) {
+        throw NonSingleColumnResultSet(field_count, compiler::GetTypeName<T>(),
+                                       "CopyOut");
+      }
+      ReadField(buffer, categories, row_);
+    }
+    if (buffer.length != 0) {
+      throw InvalidBinaryBuffer{"Unexpected data after the COPY tuple fields"};
+    }
+    return true;
+  }
+
+  template <typename U>
+  static void ReadField(io::FieldBuffer& buffer,
+                        const io::TypeBufferCategory& categories, U& value) {
+    buffer.ReadRaw(value, categories, io::traits::kTypeBufferCategory<U>);
+  }
+
+  detail::CopyOutReader reader_;
+  T row_{};
+};
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -10,6 +10,8 @@
 
 #include <userver/storages/postgres/null.hpp>
 
+#include <userver/utils/function_ref.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres::detail {
@@ -217,6 +219,11 @@ class DynamicQueryParameters {
   IntList param_formats;
 };
 
+/// Writes the query parameters with the user types of the connection that is
+/// going to execute the query
+using QueryParametersWriter =
+    USERVER_NAMESPACE::utils::function_ref<QueryParameters(const UserTypes&)>;
+
 }  // namespace storages::postgres::detail
 
 USERVER_NAMESPACE_END
@@ -52,6 +52,7 @@ namespace storages::postgres {
 /// autostart      | if true, start automatically after component load | false
 /// task-processor | the name of the TaskProcessor for running DoWork | main-task-processor
 /// testsuite-support | Enable testsuite support | false
+/// batching       | acquire and prolong the lock in a single query with the other batching distlocks of the same cluster and table | false
 ///
 /// ## Migration example
 ///
@@ -3,6 +3,8 @@
 /// @file userver/storages/postgres/dist_lock_strategy.hpp
 /// @brief @copybrief storages::postgres::DistLockStrategy
 
+#include <memory>
+
 #include <userver/dist_lock/dist_lock_settings.hpp>
 #include <userver/dist_lock/dist_lock_strategy.hpp>
 #include <userver/engine/deadline.hpp>
@@ -11,14 +13,32 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace dist_lock {
+class AcquireBatcher;
+}  // namespace dist_lock
+
 namespace storages::postgres {
 
-/// Postgres distributed locking strategy
+/// Whether the DistLockStrategy acquires and prolongs its lock together with
+/// the other locks of the same cluster and table
+enum class DistLockBatching {
+  kDisabled,  ///< a query per lock acquisition
+  kEnabled,   ///< a single query for the concurrent acquisitions
+};
+
+/// @brief Postgres distributed locking strategy
+///
+/// With DistLockBatching::kEnabled the strategies of a cluster and table
+/// share a dist_lock::AcquireBatcher, so that the dist-locked workers of a
+/// service prolong all of their locks with a single query per interval.
 class DistLockStrategy final : public dist_lock::DistLockStrategyBase {
  public:
   DistLockStrategy(ClusterPtr cluster, const std::string& table,
                    const std::string& lock_name,
-                   const dist_lock::DistLockSettings& settings);
+                   const dist_lock::DistLockSettings& settings,
+                   DistLockBatching batching = DistLockBatching::kDisabled);
+
+  ~DistLockStrategy() override;
 
   void Acquire(std::chrono::milliseconds lock_ttl,
                const std::string& locker_id) override;
@@ -31,9 +51,11 @@ class DistLockStrategy final : public dist_lock::DistLockStrategyBase {
   ClusterPtr cluster_;
   rcu::Variable<CommandControl> cc_;
   const std::string acquire_query_;
+  const std::string batch_acquire_query_;
   const std::string release_query_;
   const std::string lock_name_;
   const std::string owner_prefix_;
+  const std::shared_ptr<dist_lock::AcquireBatcher> batcher_;
 };
 
 }  // namespace storages::postgres
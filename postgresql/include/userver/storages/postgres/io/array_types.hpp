@@ -6,8 +6,13 @@
 /// @ingroup userver_postgres_parse_and_format
 
 #include <array>
+#include <functional>
 #include <iterator>
+#include <numeric>
 #include <set>
+#include <string>
+#include <string_view>
+#include <type_traits>
 #include <unordered_set>
 #include <vector>
 
@@ -297,6 +302,8 @@ struct ArrayBinaryFormatter : BufferFormatterBase<Container> {
     // Write element type oid
     io::WriteBuffer(types, buffer, static_cast<Integer>(elem_type_oid));
     Dimensions dims = GetDimensions();
+    // Avoid reallocations while the elements are appended one by one
+    buffer.reserve(buffer.size() + GetSizeHint(dims));
     // Write data per dimension
     WriteDimensionData(types, buffer, dims);
     // Write flat elements
@@ -324,6 +331,27 @@ struct ArrayBinaryFormatter : BufferFormatterBase<Container> {
       return dims;
     }
   }
+  // Size of the dimension data and the elements, exact for arithmetic and
+  // string elements, lower bound for the others
+  std::size_t GetSizeHint(const Dimensions& dims) const {
+    static constexpr auto size_len = sizeof(Integer);
+    std::size_t size = dimensions * 2 * size_len;
+    const auto elements = std::accumulate(
+        dims.begin(), dims.end(), std::size_t{1}, std::multiplies<>{});
+    if constexpr (std::is_arithmetic_v<ElementType>) {
+      size += elements * (size_len + sizeof(ElementType));
+    } else if constexpr (dimensions == 1 &&
+                         (std::is_same_v<ElementType, std::string> ||
+                          std::is_same_v<ElementType, std::string_view>)) {
+      for (const auto& element : this->value) {
+        size += size_len + element.size();
+      }
+    } else {
+      size += elements * size_len;
+    }
+    return size;
+  }
+
   template <typename Buffer>
   void WriteDimensionData(const UserTypes& types, Buffer& buffer,
                           const Dimensions& dims) const {
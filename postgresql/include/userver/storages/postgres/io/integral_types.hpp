@@ -81,11 +81,10 @@ struct IntegralBinaryFormatter {
   explicit IntegralBinaryFormatter(T val) : value{val} {}
   template <typename Buffer>
   void operator()(const UserTypes&, Buffer& buf) const {
-    buf.reserve(buf.size() + size);
     auto tmp = boost::endian::native_to_big(static_cast<BySizeType>(value));
     const char* p = reinterpret_cast<char const*>(&tmp);
     const char* e = p + size;
-    std::copy(p, e, std::back_inserter(buf));
+    buf.insert(buf.end(), p, e);
   }
 
   /// Write the value to char buffer, the buffer MUST be already resized
@@ -82,6 +82,17 @@ constexpr inline bool operator==(const TransactionOptions& lhs,
 }
 const std::string& BeginStatement(const TransactionOptions&);
 
+/// @brief Priority of a query waiting for a connection of an exhausted pool
+///
+/// The released connections go to the waiters of the highest priority first.
+/// Only kCritical queries may take the connections reserved by
+/// `critical_reserved_connections` of storages::postgres::PoolSettings.
+enum class QueryPriority {
+  kCritical,    ///< user-facing queries that must not starve
+  kNormal,      ///< the default priority
+  kBackground,  ///< cache updates, batch jobs and other background work
+};
+
 /// A structure to control timeouts for PosrgreSQL queries
 ///
 /// There are two parameters, `execute` and `statement`.
@@ -108,27 +119,38 @@ const std::string& BeginStatement(const TransactionOptions&);
 ///
 /// In case of a timeout, either back-end or overall, the client gets an
 /// exception and the driver tries to clean up the connection for further reuse.
+///
+/// `priority` orders the queries waiting for a connection when the pool is
+/// exhausted, see storages::postgres::QueryPriority.
 struct CommandControl {
   /// Overall timeout for a command being executed
   TimeoutDuration execute{};
   /// PostgreSQL server-side timeout
   TimeoutDuration statement{};
+  /// Priority of waiting for a connection
+  QueryPriority priority{QueryPriority::kNormal};
 
-  constexpr CommandControl(TimeoutDuration execute, TimeoutDuration statement)
-      : execute(execute), statement(statement) {}
+  constexpr CommandControl(TimeoutDuration execute, TimeoutDuration statement,
+                           QueryPriority priority = QueryPriority::kNormal)
+      : execute(execute), statement(statement), priority(priority) {}
 
   constexpr CommandControl WithExecuteTimeout(TimeoutDuration n) const
       noexcept {
-    return {n, statement};
+    return {n, statement, priority};
   }
 
   constexpr CommandControl WithStatementTimeout(TimeoutDuration s) const
       noexcept {
-    return {execute, s};
+    return {execute, s, priority};
+  }
+
+  constexpr CommandControl WithPriority(QueryPriority p) const noexcept {
+    return {execute, statement, p};
   }
 
   bool operator==(const CommandControl& rhs) const {
-    return execute == rhs.execute && statement == rhs.statement;
+    return execute == rhs.execute && statement == rhs.statement &&
+           priority == rhs.priority;
   }
 
   bool operator!=(const CommandControl& rhs) const { return !(*this == rhs); }
@@ -187,10 +209,25 @@ struct PoolSettings {
   /// Limits number of concurrent establishing connections (0 - unlimited)
   std::size_t connecting_limit{kDefaultConnectingLimit};
 
+  /// Number of connections that concurrent single statements are pipelined
+  /// into (0 - every statement takes a connection of its own)
+  std::size_t pipelined_connections{0};
+
+  /// Grow the pool above `min_size` ahead of demand when clients wait for
+  /// connections, shrink it back when the load drops
+  bool adaptive_size{false};
+
+  /// Number of connections that only QueryPriority::kCritical queries may
+  /// take, at most a half of the max connections is reserved
+  std::size_t critical_reserved_connections{0};
+
   bool operator==(const PoolSettings& rhs) const {
     return min_size == rhs.min_size && max_size == rhs.max_size &&
            max_queue_size == rhs.max_queue_size &&
-           connecting_limit == rhs.connecting_limit;
+           connecting_limit == rhs.connecting_limit &&
+           pipelined_connections == rhs.pipelined_connections &&
+           adaptive_size == rhs.adaptive_size &&
+           critical_reserved_connections == rhs.critical_reserved_connections;
   }
 };
 
@@ -259,12 +296,17 @@ struct ConnectionSettings {
   /// Execute discard all after establishing a new connection
   DiscardOnConnectOptions discard_on_connect = kDiscardAll;
 
+  /// Prepare this many most executed statements of the pool on new
+  /// connections, 0 to prepare statements on the first use only
+  std::size_t prepared_statements_warmup = 0;
+
   /// Helps keep track of the changes in settings
   SettingsVersion version{0U};
 
   bool operator==(const ConnectionSettings& rhs) const {
     return !RequiresConnectionReset(rhs) &&
-           recent_errors_threshold == rhs.recent_errors_threshold;
+           recent_errors_threshold == rhs.recent_errors_threshold &&
+           prepared_statements_warmup == rhs.prepared_statements_warmup;
   }
 
   bool operator!=(const ConnectionSettings& rhs) const {
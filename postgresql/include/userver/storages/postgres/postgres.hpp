@@ -44,9 +44,15 @@
 /// - Ability to manually control network roundtrips via
 ///   storages::postgres::QueryQueue to gain maximum efficiency
 ///   in case of multiple unrelated select statements;
+/// - Optional batching of concurrent single statements into shared pipelines
+///   on a few connections, see `pipelined_connections` of
+///   components::Postgres;
 /// - Mapping PostgreSQL user types to C++ types;
 /// - Transaction error injection via pytest_userver.sql.RegisteredTrx;
 /// - LISTEN/NOTIFY support via storages::postgres::Cluster::Listen();
+/// - Binary COPY for bulk load and export via
+///   storages::postgres::Transaction::CopyIn() and
+///   storages::postgres::Transaction::CopyOut();
 /// - @ref scripts/docs/en/userver/deadline_propagation.md .
 ///
 /// @section toc More information
@@ -11,6 +11,7 @@
 #include <type_traits>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -173,6 +174,18 @@ namespace storages::postgres {
 ///
 /// @todo Interface for copying a ResultSet to an output iterator.
 ///
+/// @par Extracting columns
+///
+/// Large result sets of plain columns (e.g. full cache loads) can be extracted
+/// column by column into vectors. Non-null columns of `bool`, integral and
+/// floating point types are decoded in a tight loop without the per-field type
+/// dispatch, other types are extracted field by field.
+///
+/// @code
+/// auto ids = result.AsColumn<Bigint>(0);
+/// auto [ids, names] = result.AsColumns<Bigint, std::string>();
+/// @endcode
+///
 /// @par Non-select query results
 ///
 /// @todo Process non-select result and provide interface. Do the docs.
@@ -711,12 +724,50 @@ class ResultSet {
   std::optional<T> AsOptionalSingleRow(RowTag) const;
   template <typename T>
   std::optional<T> AsOptionalSingleRow(FieldTag) const;
+
+  /// @brief Extract a single column into a vector.
+  /// Non-null columns of `bool`, integral and floating point types are decoded
+  /// in a tight loop, other types are extracted field by field.
+  /// @throws FieldIndexOutOfBounds if the index is out of bounds
+  /// @throws FieldValueIsNull if the column contains `null` and the C++ type is
+  /// not nullable
+  template <typename T>
+  std::vector<T> AsColumn(size_type field_index) const;
+
+  /// @brief Extract all the columns into a struct of vectors, one per column.
+  /// @throws InvalidTupleSizeRequested if the number of the columns does not
+  /// match the number of the types
+  template <typename... T>
+  std::tuple<std::vector<T>...> AsColumns() const;
   //@}
  private:
   friend class detail::ConnectionImpl;
   void FillBufferCategories(const UserTypes& types);
   void SetBufferCategoriesFrom(const ResultSet&);
 
+  template <typename... T, std::size_t... Indexes>
+  std::tuple<std::vector<T>...> DoAsColumns(
+      std::index_sequence<Indexes...>) const;
+
+  void CheckFieldIndex(size_type field_index) const;
+
+  //@{
+  /** @name Columnar decoding of fixed-width types */
+  /// Returns false if the column is not of a matching fixed-width type
+  bool ReadFixedWidthColumn(size_type field_index,
+                            std::vector<Smallint>& column) const;
+  bool ReadFixedWidthColumn(size_type field_index,
+                            std::vector<Integer>& column) const;
+  bool ReadFixedWidthColumn(size_type field_index,
+                            std::vector<Bigint>& column) const;
+  bool ReadFixedWidthColumn(size_type field_index,
+                            std::vector<float>& column) const;
+  bool ReadFixedWidthColumn(size_type field_index,
+                            std::vector<double>& column) const;
+  bool ReadFixedWidthColumn(size_type field_index,
+                            std::vector<bool>& column) const;
+  //@}
+
   template <typename T, typename Tag>
   friend class TypedResultSet;
   friend class ConnectionImpl;
@@ -1052,6 +1103,50 @@ std::optional<T> ResultSet::AsOptionalSingleRow(FieldTag) const {
   return IsEmpty() ? std::nullopt : std::optional<T>{AsSingleRow<T>(kFieldTag)};
 }
 
+namespace detail {
+
+template <typename T>
+inline constexpr bool kIsFixedWidthColumnType =
+    std::is_same_v<T, Smallint> || std::is_same_v<T, Integer> ||
+    std::is_same_v<T, Bigint> || std::is_same_v<T, float> ||
+    std::is_same_v<T, double> || std::is_same_v<T, bool>;
+
+}  // namespace detail
+
+template <typename T>
+std::vector<T> ResultSet::AsColumn(size_type field_index) const {
+  detail::AssertSaneTypeToDeserialize<T>();
+  CheckFieldIndex(field_index);
+
+  std::vector<T> column;
+  if constexpr (detail::kIsFixedWidthColumnType<T>) {
+    if (ReadFixedWidthColumn(field_index, column)) return column;
+  }
+
+  const auto size = Size();
+  column.reserve(size);
+  for (size_type row = 0; row < size; ++row) {
+    T value{};
+    FieldView{*pimpl_, row, field_index}.To(value);
+    column.push_back(std::move(value));
+  }
+  return column;
+}
+
+template <typename... T>
+std::tuple<std::vector<T>...> ResultSet::AsColumns() const {
+  if (FieldCount() != sizeof...(T)) {
+    throw InvalidTupleSizeRequested(FieldCount(), sizeof...(T));
+  }
+  return DoAsColumns<T...>(std::index_sequence_for<T...>{});
+}
+
+template <typename... T, std::size_t... Indexes>
+std::tuple<std::vector<T>...> ResultSet::DoAsColumns(
+    std::index_sequence<Indexes...>) const {
+  return {AsColumn<T>(Indexes)...};
+}
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
@@ -3,9 +3,15 @@
 /// @file userver/storages/postgres/transaction.hpp
 /// @brief Transactions
 
+#include <cstddef>
+#include <iterator>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
+#include <userver/storages/postgres/cluster_types.hpp>
+#include <userver/storages/postgres/copy.hpp>
 #include <userver/storages/postgres/detail/connection_ptr.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
@@ -290,6 +296,56 @@ class Transaction {
   Portal MakePortal(OptionalCommandControl statement_cmd_ctl,
                     const Query& query, const ParameterStore& store);
 
+  /// Bulk load rows into a table with `COPY ... FROM STDIN` in the binary
+  /// format, which is much faster than inserting them with statements.
+  ///
+  /// Fields of a row type element are written to the `columns` in their
+  /// order, any other element fills a single column. Empty `columns` stand for
+  /// all the columns of the table. Rows are encoded and sent to the server in
+  /// chunks as the `rows` are iterated. The execute timeout limits the whole
+  /// operation.
+  ///
+  /// Statistics and per-query command controls use the `copy_in.<table>`
+  /// statement name.
+  ///
+  /// @returns the number of copied rows
+  template <typename Container>
+  std::size_t CopyIn(std::string_view table,
+                     const std::vector<std::string>& columns,
+                     const Container& rows) {
+    return CopyIn(OptionalCommandControl{}, table, columns, rows);
+  }
+
+  /// Bulk load rows into a table with `COPY ... FROM STDIN` in the binary
+  /// format with per-statement command control.
+  template <typename Container>
+  std::size_t CopyIn(OptionalCommandControl statement_cmd_ctl,
+                     std::string_view table,
+                     const std::vector<std::string>& columns,
+                     const Container& rows);
+
+  /// Export rows of a query with `COPY (query) TO STDOUT` in the binary
+  /// format. The rows are parsed into `T` as they arrive, see
+  /// storages::postgres::CopyOutStream.
+  ///
+  /// COPY does not accept statement parameters. The execute timeout applies
+  /// to the start of the query and then to every received row.
+  template <typename T, typename ExtractionTag =
+                            typename io::traits::ExtractionTag<T>::type>
+  CopyOutStream<T, ExtractionTag> CopyOut(const Query& query) {
+    return CopyOut<T, ExtractionTag>(OptionalCommandControl{}, query);
+  }
+
+  /// Export rows of a query with `COPY (query) TO STDOUT` in the binary
+  /// format with per-statement command control.
+  template <typename T, typename ExtractionTag =
+                            typename io::traits::ExtractionTag<T>::type>
+  CopyOutStream<T, ExtractionTag> CopyOut(
+      OptionalCommandControl statement_cmd_ctl, const Query& query) {
+    return CopyOutStream<T, ExtractionTag>{
+        MakeCopyOutReader(query, std::move(statement_cmd_ctl))};
+  }
+
   /// Set a connection parameter
   /// https://www.postgresql.org/docs/current/sql-set.html
   /// The parameter is set for this transaction only
@@ -301,6 +357,17 @@ class Transaction {
   /// After Commit or Rollback is called, the transaction is not usable any
   /// more.
   void Commit();
+  /// Commit the transaction and return the current WAL position of the host
+  ///
+  /// The position is a read-your-writes token for Cluster::Begin and
+  /// Cluster::Execute: the statements that carry it see the changes of this
+  /// transaction even when executed on a slave.
+  /// Suspends coroutine until command complete.
+  /// After Commit or Rollback is called, the transaction is not usable any
+  /// more.
+  /// @throws if the position cannot be obtained, the transaction is
+  /// committed nonetheless
+  Lsn CommitWithLsn();
   /// Rollback the transaction
   /// Suspends coroutine until command complete.
   /// After Commit or Rollback is called, the transaction is not usable any
@@ -318,6 +385,15 @@ class Transaction {
                     const detail::QueryParameters& params,
                     OptionalCommandControl statement_cmd_ctl);
 
+  std::size_t DoCopyIn(std::string_view table,
+                       const std::vector<std::string>& columns,
+                       detail::CopyInChunkWriter write_rows,
+                       OptionalCommandControl statement_cmd_ctl);
+  detail::CopyOutReader MakeCopyOutReader(
+      const Query& query, OptionalCommandControl statement_cmd_ctl);
+
+  detail::ConnectionPtr DoCommit();
+
   const UserTypes& GetConnectionUserTypes() const;
 
   std::string name_;
@@ -364,6 +440,24 @@ void Transaction::ExecuteDecomposeBulk(OptionalCommandControl statement_cmd_ctl,
       });
 }
 
+template <typename Container>
+std::size_t Transaction::CopyIn(OptionalCommandControl statement_cmd_ctl,
+                                std::string_view table,
+                                const std::vector<std::string>& columns,
+                                const Container& rows) {
+  const auto& types = GetConnectionUserTypes();
+  auto it = std::begin(rows);
+  const auto end = std::end(rows);
+  auto write_rows = [&types, &it, &end](std::vector<char>& buffer) {
+    while (it != end && buffer.size() < detail::kCopyInChunkSize) {
+      detail::WriteCopyRow(types, buffer, *it);
+      ++it;
+    }
+    return it != end;
+  };
+  return DoCopyIn(table, columns, write_rows, std::move(statement_cmd_ctl));
+}
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
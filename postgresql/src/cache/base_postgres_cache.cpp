@@ -1,9 +1,57 @@
 #include <userver/cache/base_postgres_cache.hpp>
 
+#include <userver/engine/sleep.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/notify.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
+namespace pg_cache::detail {
+
+namespace {
+
+// WaitNotify is restarted with this timeout to check for the cancellation
+constexpr std::chrono::seconds kNotifyWaitTimeout{5};
+constexpr std::chrono::seconds kListenRetryInterval{1};
+
+}  // namespace
+
+void ListenNotifications(storages::postgres::Cluster& cluster,
+                         const std::string& channel,
+                         std::string_view cache_name,
+                         const std::function<void()>& on_notify) {
+  bool resubscribed = false;
+  while (!engine::current_task::ShouldCancel()) {
+    try {
+      auto scope = cluster.Listen(channel);
+      LOG_INFO() << "Cache " << cache_name << " listens on channel '"
+                 << channel << "'";
+      // Notifications sent while there was no subscription are lost
+      if (resubscribed) on_notify();
+      resubscribed = true;
+
+      while (!engine::current_task::ShouldCancel()) {
+        try {
+          scope.WaitNotify(engine::Deadline::FromDuration(kNotifyWaitTimeout));
+        } catch (const storages::postgres::ConnectionTimeoutError&) {
+          continue;
+        }
+        on_notify();
+      }
+    } catch (const std::exception& e) {
+      if (engine::current_task::ShouldCancel()) break;
+      LOG_WARNING() << "Cache " << cache_name
+                    << " failed to listen on channel '" << channel
+                    << "', retrying: " << e;
+      resubscribed = true;
+      engine::InterruptibleSleepFor(kListenRetryInterval);
+    }
+  }
+}
+
+}  // namespace pg_cache::detail
+
 namespace components::impl {
 
 std::string GetPostgreCacheSchema() {
@@ -28,6 +76,14 @@ properties:
         type: integer
         description: number of rows to request from PostgreSQL, 0 to fetch all rows in one request
         defaultDescription: 1000
+    chunk-prefetch:
+        type: boolean
+        description: fetch the next chunk while the current one is parsed
+        defaultDescription: true
+    listen-channel:
+        type: string
+        description: PostgreSQL channel to LISTEN on, every NOTIFY on it triggers an update of the cache
+        defaultDescription: ""
     pgcomponent:
         type: string
         description: PostgreSQL component name
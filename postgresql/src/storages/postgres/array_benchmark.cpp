@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <storages/postgres/tests/test_buffers.hpp>
+#include <userver/storages/postgres/io/array_types.hpp>
+#include <userver/storages/postgres/io/string_types.hpp>
+#include <userver/storages/postgres/io/user_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace pg = storages::postgres;
+namespace io = pg::io;
+
+const pg::UserTypes types;
+
+struct Row {
+  int id{};
+  std::string value;
+};
+
+void ArrayArgs(benchmark::internal::Benchmark* b) {
+  b->RangeMultiplier(10)->Range(10, 10'000);
+}
+
+void PgIntArrayBinaryFormat(benchmark::State& state) {
+  const std::vector<int> array(state.range(0), 42);
+  pg::test::Buffer buffer;
+  for (auto _ : state) {
+    io::WriteBuffer(types, buffer, array);
+    benchmark::DoNotOptimize(buffer.data());
+    buffer = {};
+  }
+}
+
+void PgStringArrayBinaryFormat(benchmark::State& state) {
+  const std::vector<std::string> array(state.range(0), std::string(20, 'x'));
+  pg::test::Buffer buffer;
+  for (auto _ : state) {
+    io::WriteBuffer(types, buffer, array);
+    benchmark::DoNotOptimize(buffer.data());
+    buffer = {};
+  }
+}
+
+// Column arrays of the rows, as sent for `unnest($1::int[], $2::text[])`
+void PgDecomposedRowsBinaryFormat(benchmark::State& state) {
+  const std::vector<Row> rows(state.range(0), Row{42, std::string(20, 'x')});
+  pg::test::Buffer ids;
+  pg::test::Buffer values;
+  for (auto _ : state) {
+    io::SplitContainerByColumns(rows, rows.size())
+        .Perform([&ids, &values](const auto& id_column,
+                                 const auto& value_column) {
+          io::WriteBuffer(types, ids, id_column);
+          io::WriteBuffer(types, values, value_column);
+        });
+    benchmark::DoNotOptimize(ids.data());
+    benchmark::DoNotOptimize(values.data());
+    ids = {};
+    values = {};
+  }
+}
+
+BENCHMARK(PgIntArrayBinaryFormat)->Apply(ArrayArgs);
+BENCHMARK(PgStringArrayBinaryFormat)->Apply(ArrayArgs);
+BENCHMARK(PgDecomposedRowsBinaryFormat)->Apply(ArrayArgs);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
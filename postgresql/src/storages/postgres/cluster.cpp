@@ -35,7 +35,7 @@ Transaction Cluster::Begin(const TransactionOptions& options,
 Transaction Cluster::Begin(ClusterHostTypeFlags flags,
                            const TransactionOptions& options,
                            OptionalCommandControl cmd_ctl) {
-  return pimpl_->Begin(flags, options, GetHandlersCmdCtl(cmd_ctl));
+  return Begin(flags, kUnknownLsn, options, cmd_ctl);
 }
 
 Transaction Cluster::Begin(std::string name,
@@ -45,12 +45,18 @@ Transaction Cluster::Begin(std::string name,
 
 Transaction Cluster::Begin(std::string name, ClusterHostTypeFlags flags,
                            const TransactionOptions& options) {
-  auto trx =
-      pimpl_->Begin(flags, options, GetHandlersCmdCtl(GetQueryCmdCtl(name)));
+  auto trx = pimpl_->Begin(flags, kUnknownLsn, options,
+                           GetHandlersCmdCtl(GetQueryCmdCtl(name)));
   trx.SetName(std::move(name));
   return trx;
 }
 
+Transaction Cluster::Begin(ClusterHostTypeFlags flags, Lsn min_lsn,
+                           const TransactionOptions& options,
+                           OptionalCommandControl cmd_ctl) {
+  return pimpl_->Begin(flags, min_lsn, options, GetHandlersCmdCtl(cmd_ctl));
+}
+
 NotifyScope Cluster::Listen(std::string_view channel,
                             OptionalCommandControl cmd_ctl) {
   return pimpl_->Listen(channel, cmd_ctl);
@@ -107,8 +113,16 @@ void Cluster::SetStatementMetricsSettings(
 }
 
 detail::NonTransaction Cluster::Start(ClusterHostTypeFlags flags,
+                                      Lsn min_lsn,
                                       OptionalCommandControl cmd_ctl) {
-  return pimpl_->Start(flags, cmd_ctl);
+  return pimpl_->Start(flags, min_lsn, cmd_ctl);
+}
+
+std::optional<ResultSet> Cluster::TryExecutePipelined(
+    ClusterHostTypeFlags flags, Lsn min_lsn, OptionalCommandControl cmd_ctl,
+    const Query& query, detail::QueryParametersWriter params_writer) {
+  return pimpl_->TryExecutePipelined(flags, min_lsn, cmd_ctl, query,
+                                     params_writer);
 }
 
 OptionalCommandControl Cluster::GetQueryCmdCtl(
@@ -133,7 +147,13 @@ ResultSet Cluster::Execute(ClusterHostTypeFlags flags,
     statement_cmd_ctl = GetQueryCmdCtl(query.GetName()->GetUnderlying());
   }
   statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
-  auto ntrx = Start(flags, statement_cmd_ctl);
+  const auto params_writer = [&store](const UserTypes&) {
+    return detail::QueryParameters{store.GetInternalData()};
+  };
+  auto result = TryExecutePipelined(flags, kUnknownLsn, statement_cmd_ctl,
+                                    query, params_writer);
+  if (result) return std::move(*result);
+  auto ntrx = Start(flags, kUnknownLsn, statement_cmd_ctl);
   return ntrx.Execute(statement_cmd_ctl, query.Statement(), store);
 }
 
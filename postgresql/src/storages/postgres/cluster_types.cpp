@@ -67,6 +67,13 @@ logging::LogHelper& operator<<(logging::LogHelper& os,
   return os << ToString(flags);
 }
 
+logging::LogHelper& operator<<(logging::LogHelper& lh, Lsn lsn) {
+  lh << logging::HexShort{lsn.GetUnderlying() >> 32};
+  lh << '/';
+  lh << logging::HexShort{lsn.GetUnderlying() & 0xFFFFFFFF};
+  return lh;
+}
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
@@ -281,6 +281,10 @@ properties:
         type: integer
         description: prepared statements cache size limit
         defaultDescription: 5000
+    prepared-statements-warmup:
+        type: integer
+        description: number of the most executed statements of the pool to prepare on new connections
+        defaultDescription: 0
     max_statement_metrics:
         type: integer
         description: limit of exported metrics for named statements
@@ -322,6 +326,18 @@ properties:
         type: integer
         description: limit for concurrent establishing connections number per pool (0 - unlimited)
         defaultDescription: 0
+    pipelined_connections:
+        type: integer
+        description: number of connections per pool that concurrent single statements are pipelined into (0 - disabled)
+        defaultDescription: 0
+    adaptive_pool_size:
+        type: boolean
+        description: grow the pool above min_pool_size when clients wait for connections and shrink it back at low load
+        defaultDescription: false
+    critical_reserved_connections:
+        type: integer
+        description: number of connections that only the queries with the critical priority may take, at most a half of max connections
+        defaultDescription: 0
     connlimit_mode:
         type: string
         enum:
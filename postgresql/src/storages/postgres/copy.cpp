@@ -0,0 +1,143 @@
+#include <userver/storages/postgres/copy.hpp>
+
+#include <string_view>
+
+#include <fmt/format.h>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/detail/statement_stats.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+using namespace std::string_view_literals;
+
+constexpr auto kCopySignature = "PGCOPY\n\377\r\n\0"sv;
+constexpr std::size_t kCopyHeaderSize =
+    kCopySignature.size() + 2 * sizeof(Integer);
+// field count of -1
+constexpr auto kCopyTrailer = "\377\377"sv;
+
+template <typename T>
+T ReadInteger(std::string_view& data) {
+  if (data.size() < sizeof(T)) {
+    throw InvalidBinaryBuffer{"COPY data is too short"};
+  }
+  T value{};
+  io::FieldBuffer buffer{false, io::BufferCategory::kPlainBuffer, sizeof(T),
+                         reinterpret_cast<const std::uint8_t*>(data.data())};
+  io::ReadBuffer(buffer, value);
+  data.remove_prefix(sizeof(T));
+  return value;
+}
+
+void SkipCopyHeader(std::string_view& data) {
+  if (data.substr(0, kCopySignature.size()) != kCopySignature) {
+    throw InvalidBinaryBuffer{"Invalid binary COPY signature"};
+  }
+  data.remove_prefix(kCopySignature.size());
+  const auto flags = ReadInteger<Integer>(data);
+  // bits 0-15 are reserved for format-critical flags
+  if (flags & 0xFFFF) {
+    throw InvalidBinaryBuffer{
+        fmt::format("Unsupported binary COPY flags {:#x}", flags)};
+  }
+  const auto extension_size = ReadInteger<Integer>(data);
+  if (extension_size < 0 ||
+      data.size() < static_cast<std::size_t>(extension_size)) {
+    throw InvalidBinaryBuffer{"Invalid binary COPY header extension"};
+  }
+  data.remove_prefix(extension_size);
+}
+
+Query MakeCopyOutQuery(const Query& query) {
+  return Query{fmt::format("COPY ({}) TO STDOUT (FORMAT binary)",
+                           query.Statement()),
+               query.GetName(), query.GetLogMode()};
+}
+
+}  // namespace
+
+void WriteCopyHeader(std::vector<char>& buffer) {
+  buffer.reserve(buffer.size() + kCopyHeaderSize);
+  buffer.insert(buffer.end(), kCopySignature.begin(), kCopySignature.end());
+  // zero flags and header extension length
+  buffer.insert(buffer.end(), 2 * sizeof(Integer), '\0');
+}
+
+void WriteCopyTrailer(std::vector<char>& buffer) {
+  buffer.insert(buffer.end(), kCopyTrailer.begin(), kCopyTrailer.end());
+}
+
+struct CopyOutReader::Impl {
+  Impl(const ConnectionPtr& conn_ptr, const Query& source_query)
+      : conn{conn_ptr.get()},
+        query{MakeCopyOutQuery(source_query)},
+        stats{query, conn_ptr} {}
+
+  Connection* conn;
+  const Query query;
+  StatementStats stats;
+  std::string data;
+  bool header_read{false};
+  bool finished{false};
+};
+
+CopyOutReader::CopyOutReader(const ConnectionPtr& conn, const Query& query,
+                             OptionalCommandControl statement_cmd_ctl)
+    : pimpl_{std::make_unique<Impl>(conn, query)} {
+  try {
+    pimpl_->conn->CopyOutStart(pimpl_->query, std::move(statement_cmd_ctl));
+  } catch (const std::exception&) {
+    pimpl_->stats.AccountStatementError();
+    throw;
+  }
+}
+
+CopyOutReader::CopyOutReader(CopyOutReader&&) noexcept = default;
+
+CopyOutReader::~CopyOutReader() {
+  if (pimpl_ && !pimpl_->finished) {
+    pimpl_->conn->CopyOutDiscard();
+    pimpl_->stats.AccountStatementExecution();
+  }
+}
+
+bool CopyOutReader::ReadRow(io::FieldBuffer& row) {
+  auto& impl = *pimpl_;
+  if (impl.finished) return false;
+  try {
+    while (impl.conn->CopyOutRead(impl.data)) {
+      std::string_view data = impl.data;
+      if (!impl.header_read) {
+        SkipCopyHeader(data);
+        impl.header_read = true;
+      }
+      // the trailer is followed by the end of data
+      if (data.empty() || data == kCopyTrailer) continue;
+      row = io::FieldBuffer{false, io::BufferCategory::kPlainBuffer,
+                            data.size(),
+                            reinterpret_cast<const std::uint8_t*>(data.data())};
+      return true;
+    }
+    impl.finished = true;
+    impl.stats.AccountStatementExecution();
+    return false;
+  } catch (const std::exception&) {
+    impl.finished = true;
+    impl.stats.AccountStatementError();
+    impl.conn->CopyOutDiscard();
+    throw;
+  }
+}
+
+const UserTypes& CopyOutReader::GetUserTypes() const {
+  return pimpl_->conn->GetUserTypes();
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -20,6 +20,9 @@ namespace storages::postgres::detail {
 
 namespace {
 
+constexpr ClusterHostTypeFlags kSlaveRolesMask{ClusterHostType::kSyncSlave,
+                                               ClusterHostType::kSlave};
+
 ClusterHostType Fallback(ClusterHostType ht) {
   switch (ht) {
     case ClusterHostType::kMaster:
@@ -252,7 +255,47 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
   return host_pools_.at(dsn_index);
 }
 
-Transaction ClusterImpl::Begin(ClusterHostTypeFlags flags,
+ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(ClusterHostTypeFlags flags,
+                                                     Lsn min_lsn) {
+  const auto role_flags = flags & kClusterHostRolesMask;
+  if (min_lsn == kUnknownLsn || !(role_flags & kSlaveRolesMask)) {
+    return FindPool(flags);
+  }
+
+  // Slave list also contains sync slaves
+  const auto slave_role = (role_flags & ClusterHostType::kSlave)
+                              ? ClusterHostType::kSlave
+                              : ClusterHostType::kSyncSlave;
+  topology::TopologyBase::DsnIndices caught_up_dsn_indices;
+  {
+    auto dsn_indices_by_type = topology_->GetDsnIndicesByType();
+    auto dsn_lsns = topology_->GetDsnLsns();
+    const auto dsn_indices_it = dsn_indices_by_type->find(slave_role);
+    if (dsn_indices_it != dsn_indices_by_type->end()) {
+      for (const auto dsn_index : dsn_indices_it->second) {
+        UASSERT(dsn_index < dsn_lsns->size());
+        if ((*dsn_lsns)[dsn_index] >= min_lsn) {
+          caught_up_dsn_indices.push_back(dsn_index);
+        }
+      }
+    }
+  }
+
+  if (caught_up_dsn_indices.empty()) {
+    LOG_DEBUG() << "No " << slave_role << " has replayed WAL up to "
+                << min_lsn << ", falling back to " << ClusterHostType::kMaster;
+    return FindPool(ClusterHostType::kMaster |
+                    flags.Clear(kClusterHostRolesMask));
+  }
+  LOG_TRACE() << "Starting transaction on " << slave_role
+              << " that has replayed WAL up to " << min_lsn;
+  const auto dsn_index =
+      SelectDsnIndex(caught_up_dsn_indices, flags, rr_host_idx_);
+  UASSERT(dsn_index < host_pools_.size());
+  return host_pools_.at(dsn_index);
+}
+
+Transaction ClusterImpl::Begin(ClusterHostTypeFlags flags, Lsn min_lsn,
                                const TransactionOptions& options,
                                OptionalCommandControl cmd_ctl) {
   LOG_TRACE() << "Requested transaction on " << flags;
@@ -267,17 +310,28 @@ Transaction ClusterImpl::Begin(ClusterHostTypeFlags flags,
     }
     flags = ClusterHostType::kMaster | flags.Clear(kClusterHostRolesMask);
   }
-  return FindPool(flags)->Begin(options, cmd_ctl);
+  return FindPool(flags, min_lsn)->Begin(options, cmd_ctl);
 }
 
-NonTransaction ClusterImpl::Start(ClusterHostTypeFlags flags,
+NonTransaction ClusterImpl::Start(ClusterHostTypeFlags flags, Lsn min_lsn,
                                   OptionalCommandControl cmd_ctl) {
   if (!(flags & kClusterHostRolesMask)) {
     throw LogicError(
         "Host role must be specified for execution of a single statement");
   }
   LOG_TRACE() << "Requested single statement on " << flags;
-  return FindPool(flags)->Start(cmd_ctl);
+  return FindPool(flags, min_lsn)->Start(cmd_ctl);
+}
+
+std::optional<ResultSet> ClusterImpl::TryExecutePipelined(
+    ClusterHostTypeFlags flags, Lsn min_lsn, OptionalCommandControl cmd_ctl,
+    const Query& query, QueryParametersWriter params_writer) {
+  if (!(flags & kClusterHostRolesMask)) {
+    throw LogicError(
+        "Host role must be specified for execution of a single statement");
+  }
+  return FindPool(flags, min_lsn)
+      ->TryExecutePipelined(cmd_ctl, query, params_writer);
 }
 
 NotifyScope ClusterImpl::Listen(std::string_view channel,
@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
@@ -43,10 +44,15 @@ class ClusterImpl {
 
   ClusterStatisticsPtr GetStatistics() const;
 
-  Transaction Begin(ClusterHostTypeFlags, const TransactionOptions&,
-                    OptionalCommandControl);
+  Transaction Begin(ClusterHostTypeFlags, Lsn min_lsn,
+                    const TransactionOptions&, OptionalCommandControl);
 
-  NonTransaction Start(ClusterHostTypeFlags, OptionalCommandControl);
+  NonTransaction Start(ClusterHostTypeFlags, Lsn min_lsn,
+                       OptionalCommandControl);
+
+  std::optional<ResultSet> TryExecutePipelined(
+      ClusterHostTypeFlags, Lsn min_lsn, OptionalCommandControl,
+      const Query& query, QueryParametersWriter params_writer);
 
   NotifyScope Listen(std::string_view channel, OptionalCommandControl);
 
@@ -84,6 +90,9 @@ class ClusterImpl {
   using ConnectionPoolPtr = std::shared_ptr<ConnectionPool>;
 
   ConnectionPoolPtr FindPool(ClusterHostTypeFlags);
+  /// Prefers the slaves that have replayed WAL up to `min_lsn`, falls back
+  /// to master if there are none
+  ConnectionPoolPtr FindPool(ClusterHostTypeFlags, Lsn min_lsn);
 
   DefaultCommandControls default_cmd_ctls_;
   rcu::Variable<ClusterSettings> cluster_settings_;
@@ -23,14 +23,14 @@ std::unique_ptr<Connection> Connection::Connect(
     ConnectionSettings settings, const DefaultCommandControls& default_cmd_ctls,
     const testsuite::PostgresControl& testsuite_pg_ctl,
     const error_injection::Settings& ei_settings,
-    engine::SemaphoreLock&& size_lock) {
+    engine::SemaphoreLock&& size_lock, HotStatements* hot_statements) {
   std::unique_ptr<Connection> conn(new Connection());
 
   const auto deadline = engine::Deadline::FromDuration(std::max(
       kMinConnectTimeout, default_cmd_ctls.GetDefaultCmdCtl().execute));
   conn->pimpl_ = std::make_unique<ConnectionImpl>(
       bg_task_processor, bg_task_storage, id, settings, default_cmd_ctls,
-      testsuite_pg_ctl, ei_settings, std::move(size_lock));
+      testsuite_pg_ctl, ei_settings, std::move(size_lock), hot_statements);
   if (resolver) {
     try {
       conn->pimpl_->AsyncConnect(ResolveDsnHostaddrs(dsn, *resolver, deadline),
@@ -141,6 +141,11 @@ std::vector<ResultSet> Connection::GatherPipeline(
   return pimpl_->GatherPipeline(timeout, descriptions);
 }
 
+std::vector<PipelineResult> Connection::GatherPipelineResults(
+    TimeoutDuration timeout, const std::vector<ResultSet>& descriptions) {
+  return pimpl_->GatherPipelineResults(timeout, descriptions);
+}
+
 ResultSet Connection::Execute(const Query& query, const ParameterStore& store) {
   return Execute(query, detail::QueryParameters{store.GetInternalData()});
 }
@@ -167,6 +172,25 @@ ResultSet Connection::PortalExecute(StatementId statement_id,
                                std::move(statement_cmd_ctl));
 }
 
+ResultSet Connection::CopyIn(std::string_view table,
+                             const std::vector<std::string>& columns,
+                             CopyInChunkWriter write_chunk,
+                             OptionalCommandControl statement_cmd_ctl) {
+  return pimpl_->CopyIn(table, columns, write_chunk,
+                        std::move(statement_cmd_ctl));
+}
+
+void Connection::CopyOutStart(const Query& query,
+                              OptionalCommandControl statement_cmd_ctl) {
+  pimpl_->CopyOutStart(query, std::move(statement_cmd_ctl));
+}
+
+bool Connection::CopyOutRead(std::string& data) {
+  return pimpl_->CopyOutRead(data);
+}
+
+void Connection::CopyOutDiscard() { pimpl_->CopyOutDiscard(); }
+
 void Connection::CancelAndCleanup(TimeoutDuration timeout) {
   pimpl_->CancelAndCleanup(timeout);
 }
@@ -2,7 +2,11 @@
 
 #include <atomic>
 #include <chrono>
+#include <exception>
 #include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/concurrent/background_task_storage_fwd.hpp>
@@ -13,6 +17,7 @@
 #include <userver/utils/statistics/min_max_avg.hpp>
 #include <userver/utils/strong_typedef.hpp>
 
+#include <userver/storages/postgres/copy.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
 #include <userver/storages/postgres/dsn.hpp>
@@ -39,6 +44,10 @@ enum class ConnectionState {
 namespace detail {
 
 class ConnectionImpl;
+class HotStatements;
+
+/// Result of a pipelined query, either the result set or the query error
+using PipelineResult = std::variant<ResultSet, std::exception_ptr>;
 
 /// @brief PostreSQL connection class
 /// Handles connecting to Postgres, sending commands, processing command results
@@ -130,6 +139,7 @@ class Connection {
   /// @param testsuite_pg_ctl operation parameters customizer for testsuite
   /// @param ei_settings error injection settings
   /// @param size_guard structure to track the size of owning connection pool
+  /// @param hot_statements execution counters of the owning connection pool
   /// @throws ConnectionFailed, ConnectionTimeoutError
   // clang-format on
   static std::unique_ptr<Connection> Connect(
@@ -140,7 +150,8 @@ class Connection {
       const DefaultCommandControls& default_cmd_ctls,
       const testsuite::PostgresControl& testsuite_pg_ctl,
       const error_injection::Settings& ei_settings,
-      engine::SemaphoreLock&& size_lock = engine::SemaphoreLock{});
+      engine::SemaphoreLock&& size_lock = engine::SemaphoreLock{},
+      HotStatements* hot_statements = nullptr);
 
   /// Close the connection
   /// TODO When called from another thread/coroutine will wait for current
@@ -227,6 +238,9 @@ class Connection {
   std::vector<ResultSet> GatherPipeline(
       TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
 
+  std::vector<PipelineResult> GatherPipelineResults(
+      TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
+
   template <typename... T>
   ResultSet Execute(const Query& query, const T&... args) {
     detail::StaticQueryParameters<sizeof...(args)> params;
@@ -254,6 +268,23 @@ class Connection {
   ResultSet PortalExecute(StatementId, const std::string& portal_name,
                           std::uint32_t n_rows, OptionalCommandControl);
 
+  /// Runs `COPY table (columns) FROM STDIN (FORMAT binary)`, `write_chunk` is
+  /// called until it returns false and each chunk it writes is sent to the
+  /// server as is.
+  ResultSet CopyIn(std::string_view table,
+                   const std::vector<std::string>& columns,
+                   CopyInChunkWriter write_chunk, OptionalCommandControl);
+
+  /// Starts a `COPY ... TO STDOUT` statement. Until CopyOutRead returns false
+  /// or CopyOutDiscard is called the connection is busy.
+  void CopyOutStart(const Query& query, OptionalCommandControl);
+  /// Replaces the `data` with the next data row of the COPY, returns false
+  /// after the statement is complete.
+  bool CopyOutRead(std::string& data);
+  /// Reads and drops the rest of the COPY data. Marks the connection as broken
+  /// if that fails.
+  void CopyOutDiscard();
+
   /// Send cancel to the database backend
   /// Try to return connection to idle state discarding all results.
   /// If there is a transaction in progress - roll it back.
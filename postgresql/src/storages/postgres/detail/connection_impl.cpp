@@ -25,6 +25,8 @@ using USERVER_NAMESPACE::utils::RandRange;
 using USERVER_NAMESPACE::utils::ScopeGuard;
 using USERVER_NAMESPACE::utils::datetime::SteadyNow;
 using USERVER_NAMESPACE::utils::text::ICaseStartsWith;
+using USERVER_NAMESPACE::utils::text::Join;
+using USERVER_NAMESPACE::utils::text::Split;
 
 namespace storages::postgres::detail {
 
@@ -34,6 +36,8 @@ constexpr std::string_view kStatementTimeoutParameter = "statement_timeout";
 constexpr std::string_view kStatementVacuum = "vacuum";
 constexpr std::string_view kStatementListen = "listen {}";
 constexpr std::string_view kStatementUnlisten = "unlisten {}";
+constexpr std::string_view kStatementCopyIn =
+    "COPY {}{} FROM STDIN (FORMAT binary)";
 
 const Query kSetConfigQuery{fmt::format("SELECT set_config($1, $2, $3) as {}",
                                         kSetConfigQueryResultName)};
@@ -184,7 +188,7 @@ ConnectionImpl::ConnectionImpl(
     ConnectionSettings settings, const DefaultCommandControls& default_cmd_ctls,
     const testsuite::PostgresControl& testsuite_pg_ctl,
     const error_injection::Settings& ei_settings,
-    engine::SemaphoreLock&& size_lock)
+    engine::SemaphoreLock&& size_lock, HotStatements* hot_statements)
     : uuid_{USERVER_NAMESPACE::utils::generators::GenerateUuid()},
       conn_wrapper_{bg_task_processor, bg_task_storage, id,
                     std::move(size_lock)},
@@ -192,7 +196,9 @@ ConnectionImpl::ConnectionImpl(
       settings_{settings},
       default_cmd_ctls_(default_cmd_ctls),
       testsuite_pg_ctl_{testsuite_pg_ctl},
-      ei_settings_(ei_settings) {
+      ei_settings_(ei_settings),
+      hot_statements_{settings.prepared_statements_warmup ? hot_statements
+                                                          : nullptr} {
   if (settings_.max_prepared_cache_size == 0) {
     throw InvalidConfig("max_prepared_cache_size is 0");
   }
@@ -241,6 +247,7 @@ void ConnectionImpl::AsyncConnect(const Dsn& dsn, engine::Deadline deadline) {
   if (settings_.pipeline_mode == PipelineMode::kEnabled) {
     conn_wrapper_.EnterPipelineMode();
   }
+  WarmUpPreparedStatements(deadline, scope);
 }
 
 void ConnectionImpl::Close() { conn_wrapper_.Close().Wait(); }
@@ -509,6 +516,116 @@ ResultSet ConnectionImpl::PortalExecute(
                     count_execute, span, scope, &prepared_info->description);
 }
 
+ResultSet ConnectionImpl::CopyIn(std::string_view table,
+                                 const std::vector<std::string>& columns,
+                                 CopyInChunkWriter write_chunk,
+                                 OptionalCommandControl statement_cmd_ctl) {
+  const Query query{MakeCopyInStatement(table, columns)};
+  const auto network_timeout = ExecuteTimeout(statement_cmd_ctl);
+  const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(network_timeout);
+  CheckBusy();
+  SetStatementTimeout(std::move(statement_cmd_ctl));
+  CheckDeadlineReached(deadline);
+
+  auto span = MakeQuerySpan(query, {network_timeout, GetStatementTimeout()});
+  auto scope = span.CreateScopeTime();
+  CountExecute count_execute(stats_);
+  ScopeGuard copy_guard{[this] { FinishCopy(); }};
+  StartCopy(query, deadline, span, scope);
+
+  scope.Reset(scopes::kCopy);
+  try {
+    std::vector<char> buffer;
+    buffer.reserve(kCopyInChunkSize);
+    bool has_more = true;
+    while (has_more) {
+      buffer.clear();
+      has_more = write_chunk(buffer);
+      if (!buffer.empty()) {
+        conn_wrapper_.PutCopyData({buffer.data(), buffer.size()}, deadline);
+      }
+    }
+    conn_wrapper_.PutCopyEnd(deadline);
+  } catch (const std::exception& e) {
+    span.AddTag(tracing::kErrorFlag, true);
+    try {
+      // the server fails the COPY and the connection remains usable
+      conn_wrapper_.PutCopyEnd(deadline, e.what());
+      conn_wrapper_.DiscardInput(deadline);
+    } catch (const std::exception& abort_error) {
+      LOG_LIMITED_WARNING() << "Failed to abort COPY FROM STDIN: "
+                            << abort_error;
+      MarkAsBroken();
+    }
+    throw;
+  }
+
+  return WaitResult(query.Statement(), deadline, network_timeout,
+                    count_execute, span, scope, nullptr);
+}
+
+void ConnectionImpl::CopyOutStart(const Query& query,
+                                  OptionalCommandControl statement_cmd_ctl) {
+  const auto network_timeout = ExecuteTimeout(statement_cmd_ctl);
+  const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(network_timeout);
+  CheckBusy();
+  SetStatementTimeout(std::move(statement_cmd_ctl));
+  CheckDeadlineReached(deadline);
+
+  auto span = MakeQuerySpan(query, {network_timeout, GetStatementTimeout()});
+  auto scope = span.CreateScopeTime();
+  ++stats_.execute_total;
+  copy_out_.emplace(CopyOutState{query, network_timeout, SteadyClock::now()});
+  try {
+    StartCopy(query, deadline, span, scope);
+  } catch (const std::exception&) {
+    FinishCopyOut(false);
+    throw;
+  }
+}
+
+bool ConnectionImpl::CopyOutRead(std::string& data) {
+  UINVARIANT(copy_out_, "No COPY TO STDOUT is in progress");
+  // every data row gets the whole network timeout
+  const auto deadline =
+      testsuite_pg_ctl_.MakeExecuteDeadline(copy_out_->network_timeout);
+  try {
+    if (conn_wrapper_.GetCopyData(data, deadline)) return true;
+  } catch (const std::exception& e) {
+    if (dynamic_cast<const ConnectionTimeoutError*>(&e)) {
+      ++stats_.execute_timeout;
+    }
+    // there is no way to leave the COPY state in the middle of the data
+    MarkAsBroken();
+    FinishCopyOut(false);
+    throw;
+  }
+
+  auto span = MakeQuerySpan(
+      copy_out_->query, {copy_out_->network_timeout, GetStatementTimeout()});
+  auto scope = span.CreateScopeTime();
+  try {
+    conn_wrapper_.WaitResult(deadline, scope, nullptr);
+  } catch (const std::exception&) {
+    span.AddTag(tracing::kErrorFlag, true);
+    FinishCopyOut(false);
+    throw;
+  }
+  FinishCopyOut(true);
+  return false;
+}
+
+void ConnectionImpl::CopyOutDiscard() {
+  if (!copy_out_) return;
+  try {
+    std::string data;
+    while (CopyOutRead(data)) {
+    }
+  } catch (const std::exception& e) {
+    LOG_LIMITED_WARNING() << "Failed to discard COPY TO STDOUT data: " << e;
+  }
+}
+
 void ConnectionImpl::Listen(std::string_view channel,
                             OptionalCommandControl cmd_ctl) {
   ExecuteCommandNoPrepare(
@@ -724,6 +841,7 @@ const ConnectionImpl::PreparedStatementInfo& ConnectionImpl::DoPrepareStatement(
   if (statement_info) {
     if (statement_info->description.pimpl_) {
       LOG_TRACE() << "Query " << statement << " is already prepared.";
+      CountExecution(*statement_info);
       return *statement_info;
     } else {
       LOG_DEBUG() << "Found prepared but not described statement";
@@ -793,9 +911,98 @@ const ConnectionImpl::PreparedStatementInfo& ConnectionImpl::DoPrepareStatement(
 
   ++stats_.parse_total;
 
+  if (hot_statements_ && !statement_info->hot_statement) {
+    statement_info->hot_statement =
+        hot_statements_->Register(query_id, statement, params);
+  }
+  CountExecution(*statement_info);
   return *statement_info;
 }
 
+void ConnectionImpl::CountExecution(PreparedStatementInfo& info) {
+  if (info.hot_statement) {
+    info.hot_statement->executions.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void ConnectionImpl::WarmUpPreparedStatements(engine::Deadline deadline,
+                                              tracing::ScopeTime& scope) {
+  if (!hot_statements_ || !ArePreparedStatementsEnabled()) return;
+  const auto statements = hot_statements_->GetMostExecuted(std::min(
+      settings_.prepared_statements_warmup, settings_.max_prepared_cache_size));
+  if (statements.empty()) return;
+
+  scope.Reset(scopes::kWarmUpPrepared);
+  struct ParamTypes {
+    std::size_t Size() const { return types.size(); }
+    const Oid* ParamTypesBuffer() const { return types.data(); }
+    static const char* const* ParamBuffers() { return nullptr; }
+    static const int* ParamLengthsBuffer() { return nullptr; }
+    static const int* ParamFormatsBuffer() { return nullptr; }
+
+    const std::vector<Oid>& types;
+  };
+
+  std::size_t prepared = 0;
+  try {
+    if (!IsPipelineActive()) {
+      for (const auto& hot_statement : statements) {
+        ParamTypes param_types{hot_statement->param_types};
+        const QueryParameters params{param_types};
+        DoPrepareStatement(hot_statement->statement, params, deadline,
+                           tracing::Span::CurrentSpan(), scope);
+        ++prepared;
+      }
+    } else {
+      // All the statements are prepared and described in a single pipeline,
+      // a failed statement aborts the rest of them
+      std::vector<std::string> statement_names;
+      statement_names.reserve(statements.size());
+      for (const auto& hot_statement : statements) {
+        ParamTypes param_types{hot_statement->param_types};
+        const QueryParameters params{param_types};
+        const auto query_hash = QueryHash(hot_statement->statement, params);
+        statement_names.push_back("q" + std::to_string(query_hash) + "_" +
+                                  uuid_);
+        conn_wrapper_.SendPrepare(statement_names.back(),
+                                  hot_statement->statement, params, scope);
+        conn_wrapper_.SendDescribePrepared(statement_names.back(), scope);
+      }
+
+      auto results = conn_wrapper_.GatherPipelineResults(
+          deadline, std::vector<const PGresult*>(2 * statements.size()));
+      // Every statement gets a prepare and a describe result until the first
+      // failed one
+      for (std::size_t i = 0; 2 * i + 1 < results.size(); ++i) {
+        auto* description = std::get_if<ResultSet>(&results[2 * i + 1]);
+        if (!std::holds_alternative<ResultSet>(results[2 * i]) ||
+            !description) {
+          break;
+        }
+        FillBufferCategories(*description);
+        description->GetRowDescription().CheckBinaryFormat(db_types_);
+
+        const auto& hot_statement = statements[i];
+        ParamTypes param_types{hot_statement->param_types};
+        const Connection::StatementId query_id{
+            QueryHash(hot_statement->statement, QueryParameters{param_types})};
+        prepared_.Put(query_id,
+                      {query_id, hot_statement->statement, statement_names[i],
+                       std::move(*description), hot_statement});
+        ++stats_.parse_total;
+        ++prepared;
+      }
+    }
+  } catch (const std::exception& e) {
+    if (IsBroken()) throw;
+    LOG_LIMITED_WARNING() << "Failed to prepare the most executed statements "
+                             "on a new connection: "
+                          << e;
+  }
+  LOG_DEBUG() << "Prepared " << prepared << " of " << statements.size()
+              << " most executed statements on a new connection";
+}
+
 void ConnectionImpl::DiscardOldPreparedStatements(engine::Deadline deadline) {
   // do not try to do anything in transaction as it may already be broken
   if (is_discard_prepared_pending_ && !IsInTransaction()) {
@@ -906,18 +1113,28 @@ std::vector<ResultSet> ConnectionImpl::GatherPipeline(
   const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(timeout);
   CheckDeadlineReached(deadline);
 
-  std::vector<const PGresult*> native_descriptions(descriptions.size(),
-                                                   nullptr);
-  if (IsOmitDescribeInExecuteEnabled()) {
-    for (std::size_t i = 0; i < descriptions.size(); ++i) {
-      native_descriptions[i] = descriptions[i].pimpl_->handle_.get();
-    }
+  auto result = conn_wrapper_.GatherPipeline(
+      deadline, GetNativeDescriptions(descriptions));
+
+  for (auto& single_result : result) {
+    FillBufferCategories(single_result);
   }
 
-  auto result = conn_wrapper_.GatherPipeline(deadline, native_descriptions);
+  return result;
+}
+
+std::vector<PipelineResult> ConnectionImpl::GatherPipelineResults(
+    TimeoutDuration timeout, const std::vector<ResultSet>& descriptions) {
+  const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(timeout);
+  CheckDeadlineReached(deadline);
+
+  auto result = conn_wrapper_.GatherPipelineResults(
+      deadline, GetNativeDescriptions(descriptions));
 
   for (auto& single_result : result) {
-    FillBufferCategories(single_result);
+    if (auto* result_set = std::get_if<ResultSet>(&single_result)) {
+      FillBufferCategories(*result_set);
+    }
   }
 
   return result;
@@ -1094,6 +1311,63 @@ ResultSet ConnectionImpl::WaitResult(const std::string& statement,
   }
 }
 
+std::string ConnectionImpl::MakeCopyInStatement(
+    std::string_view table, const std::vector<std::string>& columns) {
+  std::vector<std::string> escaped_table;
+  for (const auto& part : Split(table, ".")) {
+    escaped_table.push_back(conn_wrapper_.EscapeIdentifier(part));
+  }
+  std::vector<std::string> escaped_columns;
+  escaped_columns.reserve(columns.size());
+  for (const auto& column : columns) {
+    escaped_columns.push_back(conn_wrapper_.EscapeIdentifier(column));
+  }
+  return fmt::format(
+      kStatementCopyIn, Join(escaped_table, "."),
+      columns.empty() ? "" : fmt::format(" ({})", Join(escaped_columns, ", ")));
+}
+
+void ConnectionImpl::StartCopy(const Query& query, engine::Deadline deadline,
+                               tracing::Span& span,
+                               tracing::ScopeTime& scope) {
+  try {
+    if (IsPipelineActive()) {
+      // libpq does not allow COPY in pipeline mode, the commands that are
+      // already in the pipeline are completed first
+      conn_wrapper_.WaitResult(deadline, scope, nullptr);
+      conn_wrapper_.ExitPipelineMode();
+      restore_pipeline_after_copy_ = true;
+    }
+    conn_wrapper_.SendQuery(query.Statement(), scope);
+    conn_wrapper_.WaitCopyStart(deadline, scope);
+  } catch (const std::exception&) {
+    span.AddTag(tracing::kErrorFlag, true);
+    throw;
+  }
+}
+
+void ConnectionImpl::FinishCopy() {
+  if (!std::exchange(restore_pipeline_after_copy_, false) || IsBroken()) {
+    return;
+  }
+  try {
+    conn_wrapper_.EnterPipelineMode();
+  } catch (const std::exception& e) {
+    LOG_LIMITED_WARNING() << "Failed to restore pipeline mode after COPY: "
+                          << e;
+    MarkAsBroken();
+  }
+}
+
+void ConnectionImpl::FinishCopyOut(bool completed) {
+  const auto now = SteadyClock::now();
+  if (!completed) ++stats_.error_execute_total;
+  stats_.sum_query_duration += now - copy_out_->start_time;
+  stats_.last_execute_finish = now;
+  copy_out_.reset();
+  FinishCopy();
+}
+
 void ConnectionImpl::Cancel() { conn_wrapper_.Cancel().Wait(); }
 
 void ConnectionImpl::ReportStatement(const std::string& name) {
@@ -1119,6 +1393,18 @@ bool ConnectionImpl::IsOmitDescribeInExecuteEnabled() const {
   return settings_.omit_describe_mode == OmitDescribeInExecuteMode::kEnabled;
 }
 
+std::vector<const PGresult*> ConnectionImpl::GetNativeDescriptions(
+    const std::vector<ResultSet>& descriptions) const {
+  std::vector<const PGresult*> native_descriptions(descriptions.size(),
+                                                   nullptr);
+  if (IsOmitDescribeInExecuteEnabled()) {
+    for (std::size_t i = 0; i < descriptions.size(); ++i) {
+      native_descriptions[i] = descriptions[i].pimpl_->handle_.get();
+    }
+  }
+  return native_descriptions;
+}
+
 }  // namespace storages::postgres::detail
 
 USERVER_NAMESPACE_END
@@ -6,6 +6,7 @@
 #include <string_view>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <userver/cache/lru_map.hpp>
 #include <userver/concurrent/background_task_storage_fwd.hpp>
@@ -19,6 +20,7 @@
 
 #include <storages/postgres/default_command_controls.hpp>
 #include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/detail/hot_statements.hpp>
 #include <storages/postgres/detail/pg_connection_wrapper.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
@@ -37,6 +39,7 @@ class ConnectionImpl {
     std::string statement;
     std::string statement_name;
     ResultSet description{nullptr};
+    HotStatements::StatementPtr hot_statement{};
   };
 
   ConnectionImpl(engine::TaskProcessor& bg_task_processor,
@@ -45,7 +48,8 @@ class ConnectionImpl {
                  const DefaultCommandControls& default_cmd_ctls,
                  const testsuite::PostgresControl& testsuite_pg_ctl,
                  const error_injection::Settings& ei_settings,
-                 engine::SemaphoreLock&& size_lock);
+                 engine::SemaphoreLock&& size_lock,
+                 HotStatements* hot_statements);
 
   void AsyncConnect(const Dsn& dsn, engine::Deadline deadline);
   void Close();
@@ -88,6 +92,8 @@ class ConnectionImpl {
                        const ResultSet& description, tracing::ScopeTime& scope);
   std::vector<ResultSet> GatherPipeline(
       TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
+  std::vector<PipelineResult> GatherPipelineResults(
+      TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
 
   void Begin(const TransactionOptions& options,
              SteadyClock::time_point trx_start_time,
@@ -107,6 +113,16 @@ class ConnectionImpl {
                           const std::string& portal_name, std::uint32_t n_rows,
                           OptionalCommandControl statement_cmd_ctl);
 
+  ResultSet CopyIn(std::string_view table,
+                   const std::vector<std::string>& columns,
+                   CopyInChunkWriter write_chunk,
+                   OptionalCommandControl statement_cmd_ctl);
+
+  void CopyOutStart(const Query& query,
+                    OptionalCommandControl statement_cmd_ctl);
+  bool CopyOutRead(std::string& data);
+  void CopyOutDiscard();
+
   void Listen(std::string_view channel, OptionalCommandControl);
   void Unlisten(std::string_view channel, OptionalCommandControl);
   Notification WaitNotify(engine::Deadline deadline);
@@ -132,6 +148,12 @@ class ConnectionImpl {
 
   struct ResetTransactionCommandControl;
 
+  struct CopyOutState {
+    Query query;
+    TimeoutDuration network_timeout;
+    SteadyClock::time_point start_time;
+  };
+
   void CheckBusy() const;
   void CheckDeadlineReached(const engine::Deadline& deadline);
   tracing::Span MakeQuerySpan(const Query& query,
@@ -154,6 +176,9 @@ class ConnectionImpl {
       const std::string& statement, const detail::QueryParameters& params,
       engine::Deadline deadline, tracing::Span& span,
       tracing::ScopeTime& scope);
+  void CountExecution(PreparedStatementInfo& info);
+  void WarmUpPreparedStatements(engine::Deadline deadline,
+                                tracing::ScopeTime& scope);
   void DiscardOldPreparedStatements(engine::Deadline deadline);
   void DiscardPreparedStatement(const PreparedStatementInfo& info,
                                 engine::Deadline deadline);
@@ -189,12 +214,22 @@ class ConnectionImpl {
                        tracing::Span& span, tracing::ScopeTime& scope,
                        const ResultSet* description_ptr);
 
+  std::string MakeCopyInStatement(std::string_view table,
+                                  const std::vector<std::string>& columns);
+  void StartCopy(const Query& query, engine::Deadline deadline,
+                 tracing::Span& span, tracing::ScopeTime& scope);
+  void FinishCopy();
+  void FinishCopyOut(bool completed);
+
   void Cancel();
 
   void ReportStatement(const std::string& name);
 
   bool IsOmitDescribeInExecuteEnabled() const;
 
+  std::vector<const PGresult*> GetNativeDescriptions(
+      const std::vector<ResultSet>& descriptions) const;
+
   const std::string uuid_;
   Connection::Statistics stats_;
   PGConnectionWrapper conn_wrapper_;
@@ -211,7 +246,10 @@ class ConnectionImpl {
   testsuite::PostgresControl testsuite_pg_ctl_;
   OptionalCommandControl transaction_cmd_ctl_;
   TimeoutDuration current_statement_timeout_{};
+  std::optional<CopyOutState> copy_out_;
+  bool restore_pipeline_after_copy_ = false;
   const error_injection::Settings ei_settings_;
+  HotStatements* const hot_statements_;
 
   std::unordered_set<std::string> statements_reported_;
   engine::Mutex statements_mutex_;
@@ -0,0 +1,71 @@
+#include <storages/postgres/detail/hot_statements.hpp>
+
+#include <algorithm>
+#include <mutex>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+std::uint64_t GetExecutions(const HotStatements::StatementPtr& statement) {
+  return statement->executions.load(std::memory_order_relaxed);
+}
+
+}  // namespace
+
+HotStatements::Statement::Statement(std::string statement,
+                                    std::vector<Oid> param_types)
+    : statement{std::move(statement)}, param_types{std::move(param_types)} {}
+
+HotStatements::HotStatements(std::size_t max_size) : max_size_{max_size} {}
+
+HotStatements::StatementPtr HotStatements::Register(
+    Connection::StatementId id, const std::string& statement,
+    const QueryParameters& params) {
+  const std::lock_guard lock{mutex_};
+  if (auto it = statements_.find(id); it != statements_.end()) {
+    return it->second;
+  }
+  if (!max_size_) return {};
+
+  if (statements_.size() >= max_size_) {
+    const auto least_executed =
+        std::min_element(statements_.begin(), statements_.end(),
+                         [](const auto& a, const auto& b) {
+                           return GetExecutions(a.second) <
+                                  GetExecutions(b.second);
+                         });
+    statements_.erase(least_executed);
+  }
+  const auto* types = params.ParamTypesBuffer();
+  auto result = std::make_shared<Statement>(
+      statement, std::vector<Oid>(types, types + params.Size()));
+  statements_.emplace(id, result);
+  return result;
+}
+
+std::vector<HotStatements::StatementPtr> HotStatements::GetMostExecuted(
+    std::size_t count) const {
+  std::vector<StatementPtr> result;
+  {
+    const std::lock_guard lock{mutex_};
+    result.reserve(statements_.size());
+    for (const auto& [id, statement] : statements_) {
+      if (GetExecutions(statement) > 0) result.push_back(statement);
+    }
+  }
+
+  count = std::min(count, result.size());
+  std::partial_sort(result.begin(), result.begin() + count, result.end(),
+                    [](const StatementPtr& a, const StatementPtr& b) {
+                      return GetExecutions(a) > GetExecutions(b);
+                    });
+  result.resize(count);
+  return result;
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
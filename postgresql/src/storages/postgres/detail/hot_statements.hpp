@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/engine/mutex.hpp>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// @brief Pool-wide execution counters of the prepared statements.
+///
+/// Connections register the statements they prepare and count their
+/// executions. New connections of the pool prepare the most executed
+/// statements in advance.
+class HotStatements final {
+ public:
+  struct Statement final {
+    Statement(std::string statement, std::vector<Oid> param_types);
+
+    const std::string statement;
+    const std::vector<Oid> param_types;
+    std::atomic<std::uint64_t> executions{0};
+  };
+  using StatementPtr = std::shared_ptr<Statement>;
+
+  /// When full, the least executed statement is replaced by a new one
+  explicit HotStatements(std::size_t max_size);
+
+  /// Returns the counter of the statement, registers it if needed
+  StatementPtr Register(Connection::StatementId id,
+                        const std::string& statement,
+                        const QueryParameters& params);
+
+  /// Returns up to `count` most executed statements, the most executed first
+  std::vector<StatementPtr> GetMostExecuted(std::size_t count) const;
+
+ private:
+  const std::size_t max_size_;
+  mutable engine::Mutex mutex_;
+  std::unordered_map<Connection::StatementId, StatementPtr> statements_;
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
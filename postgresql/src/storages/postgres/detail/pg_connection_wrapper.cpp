@@ -581,6 +581,21 @@ Notification PGConnectionWrapper::WaitNotify(Deadline deadline) {
 }
 
 std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
+    Deadline deadline, const std::vector<const PGresult*>& descriptions) {
+  auto results = GatherPipelineResults(deadline, descriptions);
+
+  std::vector<ResultSet> result{};
+  result.reserve(results.size());
+  for (auto& single_result : results) {
+    if (auto* error = std::get_if<std::exception_ptr>(&single_result)) {
+      std::rethrow_exception(*error);
+    }
+    result.push_back(std::get<ResultSet>(std::move(single_result)));
+  }
+  return result;
+}
+
+std::vector<PipelineResult> PGConnectionWrapper::GatherPipelineResults(
     [[maybe_unused]] Deadline deadline,
     const std::vector<const PGresult*>& descriptions) {
   UASSERT(!descriptions.empty());
@@ -590,7 +605,7 @@ std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
 #else
   Flush(deadline);
 
-  std::vector<ResultSet> result{};
+  std::vector<PipelineResult> result{};
   const PGresult* current_description = descriptions.front();
 
   std::size_t null_res_counter{0};
@@ -626,7 +641,14 @@ std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
                std::string_view{first_field_name} == kSetConfigQueryResultName;
       }();
       if (!is_set_config_response) {
-        result.push_back(MakeResult(std::move(handle)));
+        try {
+          result.emplace_back(MakeResult(std::move(handle)));
+        } catch (const std::exception&) {
+          // Every query is followed by a sync, so a failed query does not
+          // abort the following ones, unless the connection is lost.
+          if (IsBroken() || PQstatus(conn_) == CONNECTION_BAD) throw;
+          result.emplace_back(std::current_exception());
+        }
       }
     }
 
@@ -645,6 +667,89 @@ std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
 #endif
 }
 
+void PGConnectionWrapper::WaitCopyStart(Deadline deadline,
+                                        tracing::ScopeTime& scope) {
+  scope.Reset(scopes::kLibpqWaitResult);
+  Flush(deadline);
+  auto handle = MakeResultHandle(ReadResult(deadline, nullptr));
+  if (handle) {
+    const auto status = PQresultStatus(handle.get());
+    if (status == PGRES_COPY_IN || status == PGRES_COPY_OUT) return;
+    if (status == PGRES_COPY_BOTH) MakeResult(std::move(handle));
+  }
+  // Not a COPY or the statement failed, read the rest of the results to make
+  // the connection idle again
+  while (auto* pg_res = ReadResult(deadline, nullptr)) {
+    handle = MakeResultHandle(pg_res);
+  }
+  MakeResult(std::move(handle));
+  throw LogicError{"Statement is neither COPY FROM STDIN nor COPY TO STDOUT"};
+}
+
+void PGConnectionWrapper::PutCopyData(std::string_view data,
+                                      Deadline deadline) {
+  const auto size = static_cast<int>(data.size());
+  auto put_res = PQputCopyData(conn_, data.data(), size);
+  if (put_res == 0) {
+    // libpq buffers are full in non-blocking mode
+    Flush(deadline);
+    put_res = PQputCopyData(conn_, data.data(), size);
+  }
+  if (put_res != 1) {
+    HandleSocketPostClose();
+    throw CommandError(std::string{"PQputCopyData execution error: "} +
+                       PQerrorMessage(conn_));
+  }
+  Flush(deadline);
+  UpdateLastUse();
+}
+
+void PGConnectionWrapper::PutCopyEnd(Deadline deadline,
+                                     const char* error_message) {
+  auto put_res = PQputCopyEnd(conn_, error_message);
+  if (put_res == 0) {
+    Flush(deadline);
+    put_res = PQputCopyEnd(conn_, error_message);
+  }
+  if (put_res != 1) {
+    HandleSocketPostClose();
+    throw CommandError(std::string{"PQputCopyEnd execution error: "} +
+                       PQerrorMessage(conn_));
+  }
+  Flush(deadline);
+  UpdateLastUse();
+}
+
+bool PGConnectionWrapper::GetCopyData(std::string& data, Deadline deadline) {
+  while (true) {
+    char* buffer = nullptr;
+    const auto get_res = PQgetCopyData(conn_, &buffer, /*async=*/1);
+    if (get_res > 0) {
+      const std::unique_ptr<char, decltype(&PQfreemem)> holder{buffer,
+                                                               &PQfreemem};
+      data.assign(buffer, get_res);
+      return true;
+    }
+    if (get_res == -1) return false;
+    if (get_res < -1) {
+      HandleSocketPostClose();
+      throw CommandError(std::string{"PQgetCopyData execution error: "} +
+                         PQerrorMessage(conn_));
+    }
+    if (!WaitSocketReadable(deadline)) {
+      if (engine::current_task::ShouldCancel()) {
+        throw ConnectionInterrupted("Task cancelled while reading COPY data");
+      }
+      PGCW_LOG_LIMITED_WARNING()
+          << "Timeout while reading COPY data from PostgreSQL connection "
+             "socket";
+      throw ConnectionTimeoutError("Timed out while reading COPY data");
+    }
+    CheckError<CommandError>("PQconsumeInput", PQconsumeInput(conn_));
+    UpdateLastUse();
+  }
+}
+
 void PGConnectionWrapper::DiscardInput(Deadline deadline) {
   Flush(deadline);
   auto handle = MakeResultHandle(nullptr);
@@ -708,9 +813,12 @@ ResultSet PGConnectionWrapper::MakeResult(ResultHandle&& handle) {
     case PGRES_COPY_OUT:
     case PGRES_COPY_BOTH:
       PGCW_LOG_LIMITED_ERROR()
-          << "PostgreSQL COPY command invoked which is not implemented"
+          << "PostgreSQL COPY command invoked via Execute, use "
+             "Transaction::CopyIn or Transaction::CopyOut instead"
           << logging::LogExtra::Stacktrace();
-      CloseWithError(NotImplemented{"Copy is not implemented"});
+      CloseWithError(NotImplemented{
+          "Copy is only supported via Transaction::CopyIn and "
+          "Transaction::CopyOut"});
     case PGRES_BAD_RESPONSE:
       CloseWithError(ConnectionError{"Failed to parse server response"});
     case PGRES_NONFATAL_ERROR: {
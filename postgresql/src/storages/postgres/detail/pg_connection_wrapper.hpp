@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <string>
 #include <string_view>
 
 #include <libpq-fe.h>
@@ -117,6 +118,30 @@ class PGConnectionWrapper {
   std::vector<ResultSet> GatherPipeline(
       Deadline deadline, const std::vector<const PGresult*>& descriptions);
 
+  /// @brief Gather the results of a pipeline where every query is followed by
+  /// a sync. A failed query does not prevent reading the results of the
+  /// following ones, its error is returned in place of the result.
+  std::vector<PipelineResult> GatherPipelineResults(
+      Deadline deadline, const std::vector<const PGresult*>& descriptions);
+
+  /// @brief Wait for the server to switch into COPY IN or COPY OUT state after
+  /// a COPY statement was sent.
+  /// Throws the statement error if the server did not start copying.
+  void WaitCopyStart(Deadline deadline, tracing::ScopeTime&);
+
+  /// @brief Wrapper for PQputCopyData
+  void PutCopyData(std::string_view data, Deadline deadline);
+
+  /// @brief Wrapper for PQputCopyEnd, a non-null `error_message` makes the
+  /// server fail the COPY command
+  void PutCopyEnd(Deadline deadline, const char* error_message = nullptr);
+
+  /// @brief Wrapper for PQgetCopyData
+  /// Replaces the `data` with the next COPY OUT data row, returns false when
+  /// the server finished sending data. The final result of the COPY command
+  /// should be then obtained via WaitResult.
+  bool GetCopyData(std::string& data, Deadline deadline);
+
   /// Consume input from connection
   void ConsumeInput(Deadline deadline, const PGresult* description);
 
@@ -0,0 +1,269 @@
+#include <storages/postgres/detail/pipeline_batcher.hpp>
+
+#include <algorithm>
+#include <mutex>
+
+#include <fmt/format.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/future.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/scope_guard.hpp>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/detail/pool.hpp>
+#include <storages/postgres/detail/statement_stats.hpp>
+#include <storages/postgres/detail/tracing_tags.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+// Bounds the latency a long queue adds to the statements of a single batch
+constexpr std::size_t kMaxBatchSize = 64;
+
+}  // namespace
+
+struct PipelineBatcher::Request {
+  const Query& query;
+  QueryParametersWriter params_writer;
+  CommandControl cc;
+  engine::Promise<ResultSet> promise{};
+};
+
+PipelineBatcher::PipelineBatcher(
+    ConnectionPool& pool, const testsuite::PostgresControl& testsuite_pg_ctl,
+    std::size_t max_workers, std::size_t max_queue_size)
+    : pool_{pool},
+      testsuite_pg_ctl_{testsuite_pg_ctl},
+      max_workers_{max_workers},
+      max_queue_size_{max_queue_size} {}
+
+PipelineBatcher::~PipelineBatcher() { Stop(); }
+
+void PipelineBatcher::SetLimits(std::size_t max_workers,
+                                std::size_t max_queue_size) {
+  {
+    const std::lock_guard lock{mutex_};
+    max_workers_ = max_workers;
+    max_queue_size_ = max_queue_size;
+  }
+  // Lets the surplus workers exit
+  requests_available_.NotifyAll();
+}
+
+ResultSet PipelineBatcher::Execute(const Query& query,
+                                   QueryParametersWriter params_writer,
+                                   CommandControl cc) {
+  StatementStats stats{query, pool_.GetStatementStatsStorage()};
+  Request request{query, params_writer, cc};
+  auto future = request.promise.get_future();
+  {
+    const std::lock_guard lock{mutex_};
+    if (is_stopped_) {
+      throw PoolError("Pipelined execution is stopped");
+    }
+    if (requests_.size() >= max_queue_size_) {
+      throw PoolError("Pipelined execution queue size exceeded");
+    }
+    requests_.push_back(&request);
+    if (idle_workers_ == 0 && workers_ < max_workers_) {
+      ++workers_;
+      worker_tasks_.Detach(
+          engine::CriticalAsyncNoSpan([this] { RunWorker(); }));
+    }
+  }
+  requests_available_.NotifyOne();
+
+  if (future.wait() != engine::FutureStatus::kReady) {
+    {
+      const std::lock_guard lock{mutex_};
+      const auto it = std::find(requests_.begin(), requests_.end(), &request);
+      if (it != requests_.end()) {
+        requests_.erase(it);
+        stats.AccountStatementError();
+        throw PoolError(
+            "Task was cancelled while waiting for pipelined execution");
+      }
+    }
+    // The request is being executed by a worker that references the query
+    // and the parameters, wait for it regardless of the cancellation
+    const engine::TaskCancellationBlocker block_cancel;
+    [[maybe_unused]] const auto status = future.wait();
+  }
+
+  try {
+    auto result = future.get();
+    stats.AccountStatementExecution();
+    return result;
+  } catch (const std::exception&) {
+    stats.AccountStatementError();
+    throw;
+  }
+}
+
+void PipelineBatcher::Stop() {
+  {
+    const std::lock_guard lock{mutex_};
+    is_stopped_ = true;
+  }
+  worker_tasks_.CancelAndWait();
+
+  std::deque<Request*> requests;
+  {
+    const std::lock_guard lock{mutex_};
+    requests.swap(requests_);
+  }
+  for (auto* request : requests) {
+    SetError(request, std::make_exception_ptr(
+                          PoolError("Pipelined execution is stopped")));
+  }
+}
+
+void PipelineBatcher::RunWorker() {
+  std::vector<Request*> batch;
+  while (true) {
+    {
+      std::unique_lock lock{mutex_};
+      ++idle_workers_;
+      const bool has_requests = requests_available_.Wait(lock, [this] {
+        return !requests_.empty() || workers_ > max_workers_;
+      });
+      --idle_workers_;
+      if (!has_requests || requests_.empty()) {
+        --workers_;
+        return;
+      }
+
+      const auto batch_size = std::min(requests_.size(), kMaxBatchSize);
+      batch.assign(requests_.begin(), requests_.begin() + batch_size);
+      requests_.erase(requests_.begin(), requests_.begin() + batch_size);
+    }
+    ExecuteBatch(batch);
+  }
+}
+
+void PipelineBatcher::ExecuteBatch(std::vector<Request*>& batch) {
+  UASSERT(!batch.empty());
+  auto timeout = batch.front()->cc.execute;
+  auto priority = batch.front()->cc.priority;
+  for (const auto* request : batch) {
+    timeout = std::max(timeout, request->cc.execute);
+    // The batch waits for a connection with its most important request
+    priority = std::min(priority, request->cc.priority);
+  }
+
+  try {
+    auto conn = pool_.Acquire(testsuite_pg_ctl_.MakeExecuteDeadline(timeout),
+                              priority);
+    conn->Start(SteadyClock::now());
+    const USERVER_NAMESPACE::utils::ScopeGuard finish_guard{
+        [&conn] { conn->Finish(); }};
+
+    if (conn->IsPipelineActive() && conn->ArePreparedStatementsEnabled()) {
+      ExecutePipeline(conn, batch, timeout);
+    } else {
+      ExecuteOneByOne(conn, batch);
+    }
+  } catch (const std::exception&) {
+    for (auto*& request : batch) {
+      if (request) SetError(request, std::current_exception());
+    }
+  }
+}
+
+void PipelineBatcher::ExecutePipeline(ConnectionPtr& conn,
+                                      std::vector<Request*>& batch,
+                                      TimeoutDuration timeout) {
+  std::vector<std::size_t> queued;
+  std::vector<QueryParameters> params;
+  std::vector<std::string> statement_names;
+  std::vector<ResultSet> descriptions;
+  queued.reserve(batch.size());
+  params.reserve(batch.size());
+  statement_names.reserve(batch.size());
+  descriptions.reserve(batch.size());
+
+  for (std::size_t i = 0; i < batch.size(); ++i) {
+    auto& request = batch[i];
+    try {
+      auto query_params = request->params_writer(conn->GetUserTypes());
+      auto prepared_statement_meta = conn->PrepareStatement(
+          request->query, query_params, request->cc.execute);
+      params.push_back(query_params);
+      statement_names.push_back(
+          std::move(prepared_statement_meta.statement_name));
+      descriptions.push_back(std::move(prepared_statement_meta.description));
+      queued.push_back(i);
+    } catch (const std::exception&) {
+      SetError(request, std::current_exception());
+    }
+  }
+  if (queued.empty()) return;
+
+  tracing::Span span{scopes::kPipelinedBatch};
+  span.AddTag("pg_batch_size", queued.size());
+  auto scope = span.CreateScopeTime();
+  for (std::size_t i = 0; i < queued.size(); ++i) {
+    const CommandControl cc{
+        timeout /* .execute, used for SetStatementTimeout deadline */,
+        batch[queued[i]]->cc.statement /* .statement, used as expected */};
+    conn->AddIntoPipeline(cc, statement_names[i], params[i], descriptions[i],
+                          scope);
+  }
+
+  auto results = conn->GatherPipelineResults(timeout, descriptions);
+  if (results.size() != queued.size()) {
+    throw RuntimeError{
+        fmt::format("Pipelined batch results count mismatch: expected {}, "
+                    "got {}",
+                    queued.size(), results.size())};
+  }
+  for (std::size_t i = 0; i < queued.size(); ++i) {
+    auto& request = batch[queued[i]];
+    if (auto* error = std::get_if<std::exception_ptr>(&results[i])) {
+      SetError(request, *error);
+    } else {
+      SetResult(request, std::get<ResultSet>(std::move(results[i])));
+    }
+  }
+}
+
+void PipelineBatcher::ExecuteOneByOne(ConnectionPtr& conn,
+                                      std::vector<Request*>& batch) {
+  for (auto& request : batch) {
+    try {
+      auto result = conn->Execute(
+          request->query, request->params_writer(conn->GetUserTypes()),
+          OptionalCommandControl{request->cc});
+      SetResult(request, std::move(result));
+    } catch (const std::exception&) {
+      // A broken connection fails the rest of the batch
+      if (conn->IsBroken()) throw;
+      SetError(request, std::current_exception());
+    }
+  }
+}
+
+void PipelineBatcher::SetResult(Request*& request, ResultSet&& result) {
+  // The request is owned by the waiting task and may be gone right after
+  // the promise is fulfilled
+  auto promise = std::move(request->promise);
+  request = nullptr;
+  promise.set_value(std::move(result));
+}
+
+void PipelineBatcher::SetError(Request*& request, std::exception_ptr error) {
+  auto promise = std::move(request->promise);
+  request = nullptr;
+  promise.set_exception(std::move(error));
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
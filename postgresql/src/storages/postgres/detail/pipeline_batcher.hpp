@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <vector>
+
+#include <userver/concurrent/background_task_storage.hpp>
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/testsuite/postgres_control.hpp>
+
+#include <userver/storages/postgres/detail/connection_ptr.hpp>
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+class ConnectionPool;
+
+/// @brief Multiplexes concurrent single statements into pipelines.
+///
+/// Statements are queued and picked up in batches by a limited number of
+/// workers. A worker acquires a connection from the pool and executes the
+/// whole batch as a single pipeline, every statement in its own implicit
+/// transaction, so a failed statement does not affect the others.
+class PipelineBatcher final {
+ public:
+  PipelineBatcher(ConnectionPool& pool,
+                  const testsuite::PostgresControl& testsuite_pg_ctl,
+                  std::size_t max_workers, std::size_t max_queue_size);
+  ~PipelineBatcher();
+
+  PipelineBatcher(const PipelineBatcher&) = delete;
+  PipelineBatcher& operator=(const PipelineBatcher&) = delete;
+
+  /// Sets the maximum number of concurrently executed batches and the maximum
+  /// number of statements waiting for execution
+  void SetLimits(std::size_t max_workers, std::size_t max_queue_size);
+
+  /// @brief Executes the statement as a part of some batch.
+  ///
+  /// Suspends until the statement is executed. The parameters are written by
+  /// the worker with the user types of the connection it uses.
+  /// @throws PoolError if the queue is full or the task is cancelled before
+  /// the statement is picked up by a worker
+  ResultSet Execute(const Query& query, QueryParametersWriter params_writer,
+                    CommandControl cc);
+
+  /// Stops the workers and fails the statements still waiting for execution
+  void Stop();
+
+ private:
+  struct Request;
+
+  void RunWorker();
+  void ExecuteBatch(std::vector<Request*>& batch);
+  void ExecutePipeline(ConnectionPtr& conn, std::vector<Request*>& batch,
+                       TimeoutDuration timeout);
+  void ExecuteOneByOne(ConnectionPtr& conn, std::vector<Request*>& batch);
+
+  static void SetResult(Request*& request, ResultSet&& result);
+  static void SetError(Request*& request, std::exception_ptr error);
+
+  ConnectionPool& pool_;
+  const testsuite::PostgresControl& testsuite_pg_ctl_;
+
+  engine::Mutex mutex_;
+  engine::ConditionVariable requests_available_;
+  std::deque<Request*> requests_;
+  std::size_t workers_{0};
+  std::size_t idle_workers_{0};
+  std::size_t max_workers_;
+  std::size_t max_queue_size_;
+  bool is_stopped_{false};
+
+  concurrent::BackgroundTaskStorageCore worker_tasks_;
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -33,6 +33,11 @@ constexpr std::chrono::seconds kCancelPeriod{1};
 constexpr std::chrono::seconds kCleanupTimeout{2};
 
 constexpr std::chrono::seconds kMaintainInterval{30};
+constexpr const char* kAdjustSizeTaskName = "pg_adjust_pool_size";
+constexpr std::chrono::seconds kAdjustSizeInterval{1};
+// Acquisition wait time over the period makes the pool grow
+constexpr std::chrono::seconds kAdjustSizeWaitPeriod{5};
+constexpr std::size_t kAdjustSizeWaitThresholdMs = 5;
 constexpr std::chrono::seconds kMaxIdleDuration{15};
 constexpr const char* kMaintainTaskName = "pg_maintain";
 
@@ -42,6 +47,9 @@ constexpr auto kPendingConnectsMax{1};
 // Max idle connections that can be dropped in one run of maintenance task
 constexpr auto kIdleDropLimit = 1;
 
+// Max statements which executions are counted for the connections warmup
+constexpr std::size_t kHotStatementsMaxSize = 1000;
+
 // Practically unlimited number on concurrent establishing connections
 constexpr auto kUnlimitedConnecting = std::numeric_limits<std::size_t>::max();
 
@@ -95,12 +103,14 @@ ConnectionPool::ConnectionPool(
                                 ? settings.connecting_limit
                                 : kUnlimitedConnecting},
       wait_count_{0},
+      critical_reserved_connections_{settings.critical_reserved_connections},
       default_cmd_ctls_(default_cmd_ctls),
       testsuite_pg_ctl_{testsuite_pg_ctl},
       ei_settings_(std::move(ei_settings)),
       cancel_limit_{std::max(std::size_t{1}, settings.max_size / kCancelRatio),
                     {1, kCancelPeriod}},
       sts_{statement_metrics_settings},
+      hot_statements_{kHotStatementsMaxSize},
       config_source_(config_source),
       cc_sensor_(*this),
       cc_limiter_(*this),
@@ -108,13 +118,17 @@ ConnectionPool::ConnectionPool(
                      stats_.congestion_control, cc_config, config_source,
                      [](const dynamic_config::Snapshot& config) {
                        return config[kCcConfig];
-                     }) {
+                     }),
+      pipeline_batcher_{*this, testsuite_pg_ctl_,
+                        settings.pipelined_connections,
+                        settings.max_queue_size} {
   if (kCcExperiment.IsEnabled()) {
     cc_controller_.Start();
   }
 }
 
 ConnectionPool::~ConnectionPool() {
+  pipeline_batcher_.Stop();
   StopMaintainTask();
   StopConnectTasks();
   Clear();
@@ -208,13 +222,14 @@ void ConnectionPool::Init(InitMode mode) {
   StartMaintainTask();
 }
 
-ConnectionPtr ConnectionPool::Acquire(engine::Deadline deadline) {
+ConnectionPtr ConnectionPool::Acquire(engine::Deadline deadline,
+                                      QueryPriority priority) {
   // Obtain smart pointer first to prolong lifetime of this object
   auto shared_this = shared_from_this();
 
   auto config = GetConfigSource().GetSnapshot();
   CheckDeadlineIsExpired(config);
-  ConnectionPtr connection{Pop(deadline), std::move(shared_this)};
+  ConnectionPtr connection{Pop(deadline, priority), std::move(shared_this)};
   ++stats_.connection.used;
   CheckDeadlineIsExpired(config);
 
@@ -278,6 +293,10 @@ void ConnectionPool::Release(Connection* connection) {
   if (!connection->IsConnected() || connection->IsBroken()) {
     DeleteBrokenConnection(connection);
   } else if (connection->IsIdle()) {
+    // The connection is not used since now, so that the waiters woken up by
+    // Push do not see it in the critical reserve
+    dg.Dismiss();
+    --stats_.connection.used;
     Push(connection);
   } else {
     // Connection cleanup is done asynchronously while returning control to
@@ -313,7 +332,7 @@ Transaction ConnectionPool::Begin(const TransactionOptions& options,
   const auto trx_start_time = detail::SteadyClock::now();
   const auto deadline =
       testsuite_pg_ctl_.MakeExecuteDeadline(GetExecuteTimeout(trx_cmd_ctl));
-  auto conn = Acquire(deadline);
+  auto conn = Acquire(deadline, GetPriority(trx_cmd_ctl));
   UASSERT(conn);
   return Transaction{std::move(conn), options, trx_cmd_ctl, trx_start_time};
 }
@@ -322,16 +341,28 @@ NonTransaction ConnectionPool::Start(OptionalCommandControl cmd_ctl) {
   const auto start_time = detail::SteadyClock::now();
   const auto deadline =
       testsuite_pg_ctl_.MakeExecuteDeadline(GetExecuteTimeout(cmd_ctl));
-  auto conn = Acquire(deadline);
+  auto conn = Acquire(deadline, GetPriority(cmd_ctl));
   UASSERT(conn);
   return NonTransaction{std::move(conn), start_time};
 }
 
+std::optional<ResultSet> ConnectionPool::TryExecutePipelined(
+    OptionalCommandControl cmd_ctl, const Query& query,
+    QueryParametersWriter params_writer) {
+  {
+    const auto settings = settings_.Read();
+    if (settings->pipelined_connections == 0) return std::nullopt;
+  }
+  return pipeline_batcher_.Execute(
+      query, params_writer,
+      cmd_ctl ? *cmd_ctl : GetDefaultCommandControl());
+}
+
 NotifyScope ConnectionPool::Listen(std::string_view channel,
                                    OptionalCommandControl cmd_ctl) {
   const auto deadline =
       testsuite_pg_ctl_.MakeExecuteDeadline(GetExecuteTimeout(cmd_ctl));
-  auto conn = Acquire(deadline);
+  auto conn = Acquire(deadline, GetPriority(cmd_ctl));
   UASSERT(conn);
   return NotifyScope{std::move(conn), channel, cmd_ctl};
 }
@@ -343,6 +374,13 @@ TimeoutDuration ConnectionPool::GetExecuteTimeout(
   return GetDefaultCommandControl().execute;
 }
 
+QueryPriority ConnectionPool::GetPriority(
+    OptionalCommandControl cmd_ctl) const {
+  if (cmd_ctl) return cmd_ctl->priority;
+
+  return GetDefaultCommandControl().priority;
+}
+
 CommandControl ConnectionPool::GetDefaultCommandControl() const {
   return default_cmd_ctls_.GetDefaultCmdCtl();
 }
@@ -363,6 +401,14 @@ void ConnectionPool::SetSettings(const PoolSettings& settings) {
                                           ? settings.connecting_limit
                                           : kUnlimitedConnecting);
 
+  critical_reserved_connections_ = settings.critical_reserved_connections;
+
+  if (reader->pipelined_connections != settings.pipelined_connections ||
+      reader->max_queue_size != settings.max_queue_size) {
+    pipeline_batcher_.SetLimits(settings.pipelined_connections,
+                                settings.max_queue_size);
+  }
+
   auto writer = settings_.StartWrite();
   *writer = settings;
   writer->max_size = max_connections;
@@ -423,7 +469,7 @@ bool ConnectionPool::DoConnect(engine::SemaphoreLock size_lock) {
     connection = Connection::Connect(
         dsn_, resolver_, bg_task_processor_, close_task_storage_, conn_id,
         *conn_settings, default_cmd_ctls_, testsuite_pg_ctl_, ei_settings_,
-        std::move(size_lock));
+        std::move(size_lock), &hot_statements_);
   } catch (const ConnectionTimeoutError&) {
     // No problem if it's connection error
     ++stats_.connection.error_timeout;
@@ -471,9 +517,55 @@ void ConnectionPool::TryCreateConnectionAsync() {
 void ConnectionPool::CheckMinPoolSizeUnderflow() {
   auto settings = settings_.Read();
   auto count = size_semaphore_.UsedApprox();
-  if (count < settings->min_size) {
+  const auto min_size = GetMinSize(*settings);
+  if (count < min_size) {
     LOG_DEBUG() << "Current pool size is less than min_size (" << count << " < "
-                << settings->min_size << "). Create new connection.";
+                << min_size << "). Create new connection.";
+    TryCreateConnectionAsync();
+  }
+}
+
+std::size_t ConnectionPool::GetMinSize(const PoolSettings& settings) const {
+  if (!settings.adaptive_size) return settings.min_size;
+  return std::max(settings.min_size, adaptive_min_size_.load());
+}
+
+void ConnectionPool::AdjustSize() {
+  auto settings = settings_.Read();
+  if (!settings->adaptive_size) {
+    adaptive_min_size_ = 0;
+    return;
+  }
+
+  // The capacity accounts for max_pool_size, connlimit mode and congestion
+  // control
+  const auto max_size = size_semaphore_.GetCapacity();
+  const auto size = size_semaphore_.UsedApprox();
+  const auto old_min_size =
+      std::min(std::max(adaptive_min_size_.load(), settings->min_size),
+               max_size);
+  const auto wait_ms =
+      stats_.acquire_percentile.GetStatsForPeriod(kAdjustSizeWaitPeriod, true)
+          .GetPercentile(95);
+
+  auto min_size = old_min_size;
+  if (wait_count_ > 0 || wait_ms >= kAdjustSizeWaitThresholdMs) {
+    // Grow by a quarter to get ahead of the rising demand
+    min_size = std::min(max_size, std::max(min_size, size) +
+                                      std::max(std::size_t{1}, size / 4));
+  } else if (wait_ms == 0 && min_size > settings->min_size) {
+    // Shrink slowly, idle connections above the bound are dropped by the
+    // maintenance task
+    --min_size;
+  }
+  adaptive_min_size_ = min_size;
+
+  if (min_size != old_min_size) {
+    LOG_DEBUG() << "Adaptive min pool size of " << DsnCutPassword(dsn_)
+                << " changed from " << old_min_size << " to " << min_size
+                << ", acquisition wait p95 " << wait_ms << "ms";
+  }
+  for (auto count = size; count < min_size; ++count) {
     TryCreateConnectionAsync();
   }
 }
@@ -499,7 +591,7 @@ void ConnectionPool::Push(Connection* connection) {
   }
 
   if (queue_.push(connection)) {
-    conn_available_.NotifyOne();
+    NotifyWaiter();
   } else {
     // TODO Reflect this as a statistics error
     LOG_WARNING() << "Couldn't push connection back to the pool. Deleting...";
@@ -507,7 +599,8 @@ void ConnectionPool::Push(Connection* connection) {
   }
 }
 
-Connection* ConnectionPool::Pop(engine::Deadline deadline) {
+Connection* ConnectionPool::Pop(engine::Deadline deadline,
+                                QueryPriority priority) {
   if (engine::current_task::ShouldCancel()) {
     throw PoolError("Task was cancelled before trying to get a connection");
   }
@@ -519,7 +612,7 @@ Connection* ConnectionPool::Pop(engine::Deadline deadline) {
   Stopwatch st{stats_.acquire_percentile};
   Connection* connection = nullptr;
   auto conn_settings = conn_settings_.Read();
-  while (queue_.pop(connection)) {
+  while (CanTakeConnection(priority) && queue_.pop(connection)) {
     if (connection->GetSettings().version < conn_settings->version) {
       DropOutdatedConnection(connection);
       continue;
@@ -544,13 +637,21 @@ Connection* ConnectionPool::Pop(engine::Deadline deadline) {
   TryCreateConnectionAsync();
 
   {
+    const SizeGuard priority_wg(
+        priority_wait_count_[static_cast<std::size_t>(priority)]);
     std::unique_lock<engine::Mutex> lock{wait_mutex_};
-    // Wait for a connection
-    if (conn_available_.WaitUntil(lock, deadline,
-                                  [&] { return queue_.pop(connection); })) {
+    // Wait for a connection. A waiter with the deadline reached gives the
+    // connection up to the others instead of taking it.
+    if (conn_available_[static_cast<std::size_t>(priority)].WaitUntil(
+            lock, deadline, [&] {
+              return !deadline.IsReached() && CanTakeConnection(priority) &&
+                     queue_.pop(connection);
+            })) {
       return connection;
     }
   }
+  // The wake-up could have been meant for this waiter, pass it on
+  NotifyWaiter();
 
   if (engine::current_task::ShouldCancel()) {
     throw PoolError("Task was cancelled while waiting for connection");
@@ -567,6 +668,31 @@ Connection* ConnectionPool::Pop(engine::Deadline deadline) {
       db_name_);
 }
 
+bool ConnectionPool::CanTakeConnection(QueryPriority priority) const {
+  const auto index = static_cast<std::size_t>(priority);
+  for (std::size_t i = 0; i < index; ++i) {
+    if (priority_wait_count_[i].load(std::memory_order_relaxed) > 0) {
+      return false;
+    }
+  }
+  if (priority == QueryPriority::kCritical) return true;
+
+  const auto capacity = size_semaphore_.GetCapacity();
+  const auto reserved = std::min(
+      critical_reserved_connections_.load(std::memory_order_relaxed),
+      capacity / 2);
+  return reserved == 0 || stats_.connection.used.Load() + reserved < capacity;
+}
+
+void ConnectionPool::NotifyWaiter() {
+  for (std::size_t i = 0; i < kPrioritiesCount; ++i) {
+    if (priority_wait_count_[i].load(std::memory_order_relaxed) > 0) {
+      conn_available_[i].NotifyOne();
+      return;
+    }
+  }
+}
+
 void ConnectionPool::Clear() {
   Connection* connection = nullptr;
   while (queue_.pop(connection)) {
@@ -678,7 +804,7 @@ void ConnectionPool::MaintainConnections() {
         break;
       }
       stale_connection = conn->GetIdleDuration() >= kMaxIdleDuration;
-      if (count > settings->min_size && drop_left > 0) {
+      if (count > GetMinSize(*settings) && drop_left > 0) {
         --drop_left;
         --stats_.connection.used;
         LOG_DEBUG() << "Drop idle connection to `" << DsnCutPassword(dsn_)
@@ -711,9 +837,17 @@ void ConnectionPool::StartMaintainTask() {
 
   ping_task_.Start(kMaintainTaskName, {kMaintainInterval, Flags::kStrong},
                    [this] { MaintainConnections(); });
+  // Runs often, so its spans are not logged by default
+  size_task_.Start(
+      kAdjustSizeTaskName,
+      {kAdjustSizeInterval, Flags::kStrong, logging::Level::kDebug},
+      [this] { AdjustSize(); });
 }
 
-void ConnectionPool::StopMaintainTask() { ping_task_.Stop(); }
+void ConnectionPool::StopMaintainTask() {
+  size_task_.Stop();
+  ping_task_.Stop();
+}
 
 void ConnectionPool::StopConnectTasks() {
   const auto task_count = connect_task_storage_.ActiveTasksApprox();
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include <boost/lockfree/queue.hpp>
@@ -31,7 +33,9 @@
 #include <userver/storages/postgres/transaction.hpp>
 
 #include <storages/postgres/detail/connection.hpp>
+#include <storages/postgres/detail/hot_statements.hpp>
 #include <storages/postgres/detail/pg_impl_types.hpp>
+#include <storages/postgres/detail/pipeline_batcher.hpp>
 #include <storages/postgres/detail/size_guard.hpp>
 #include <storages/postgres/detail/statement_stats_storage.hpp>
 
@@ -68,7 +72,8 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
       const congestion_control::v2::LinearController::StaticConfig& cc_config,
       dynamic_config::Source config_source);
 
-  [[nodiscard]] ConnectionPtr Acquire(engine::Deadline);
+  [[nodiscard]] ConnectionPtr Acquire(
+      engine::Deadline, QueryPriority priority = QueryPriority::kNormal);
   void Release(Connection* connection);
 
   const InstanceStatistics& GetStatistics() const;
@@ -77,6 +82,12 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
 
   [[nodiscard]] NonTransaction Start(OptionalCommandControl cmd_ctl = {});
 
+  /// Executes a single statement in a pipeline shared with other concurrent
+  /// statements, returns std::nullopt if pipelined execution is disabled
+  std::optional<ResultSet> TryExecutePipelined(
+      OptionalCommandControl cmd_ctl, const Query& query,
+      QueryParametersWriter params_writer);
+
   NotifyScope Listen(std::string_view channel,
                      OptionalCommandControl cmd_ctl = {});
 
@@ -99,18 +110,26 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
  private:
   using SizeGuard = postgres::SizeGuard<std::atomic<size_t>>;
 
+  static constexpr std::size_t kPrioritiesCount =
+      static_cast<std::size_t>(QueryPriority::kBackground) + 1;
+
   void Init(InitMode mode);
 
   TimeoutDuration GetExecuteTimeout(OptionalCommandControl) const;
+  QueryPriority GetPriority(OptionalCommandControl) const;
 
   [[nodiscard]] engine::TaskWithResult<bool> Connect(engine::SemaphoreLock);
   bool DoConnect(engine::SemaphoreLock);
 
   void TryCreateConnectionAsync();
   void CheckMinPoolSizeUnderflow();
+  std::size_t GetMinSize(const PoolSettings& settings) const;
+  void AdjustSize();
 
   void Push(Connection* connection);
-  Connection* Pop(engine::Deadline);
+  Connection* Pop(engine::Deadline, QueryPriority);
+  bool CanTakeConnection(QueryPriority) const;
+  void NotifyWaiter();
 
   void Clear();
 
@@ -143,18 +162,25 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   concurrent::BackgroundTaskStorageCore connect_task_storage_;
   concurrent::BackgroundTaskStorageCore close_task_storage_;
   USERVER_NAMESPACE::utils::PeriodicTask ping_task_;
+  USERVER_NAMESPACE::utils::PeriodicTask size_task_;
+  // Lower bound of the pool size set by the adaptive sizing
+  std::atomic<std::size_t> adaptive_min_size_{0};
   engine::Mutex wait_mutex_;
-  engine::ConditionVariable conn_available_;
+  // A released connection wakes up a waiter of the highest waiting priority
+  std::array<engine::ConditionVariable, kPrioritiesCount> conn_available_;
   boost::lockfree::queue<Connection*> queue_;
   engine::Semaphore size_semaphore_;
   engine::Semaphore connecting_semaphore_;
   std::atomic<size_t> wait_count_;
+  std::array<std::atomic<size_t>, kPrioritiesCount> priority_wait_count_{};
+  std::atomic<size_t> critical_reserved_connections_{0};
   DefaultCommandControls default_cmd_ctls_;
   testsuite::PostgresControl testsuite_pg_ctl_;
   const error_injection::Settings ei_settings_;
   RecentCounter recent_conn_errors_;
   USERVER_NAMESPACE::utils::TokenBucket cancel_limit_;
   detail::StatementStatsStorage sts_;
+  HotStatements hot_statements_;
   dynamic_config::Source config_source_;
 
   // Congestion control stuff
@@ -162,6 +188,8 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   cc::Limiter cc_limiter_;
   congestion_control::v2::LinearController cc_controller_;
   std::atomic<std::size_t> cc_max_connections_{0};
+
+  PipelineBatcher pipeline_batcher_;
 };
 
 }  // namespace storages::postgres::detail
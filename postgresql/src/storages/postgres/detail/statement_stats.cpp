@@ -12,6 +12,10 @@ StatementStats::StatementStats(const Query& query, const ConnectionPtr& conn)
       sts_{conn.GetStatementStatsStorage()},
       start_{sts_ != nullptr ? Now() : SteadyClock::time_point{}} {}
 
+StatementStats::StatementStats(const Query& query,
+                               const StatementStatsStorage& sts)
+    : query_{query}, sts_{&sts}, start_{Now()} {}
+
 void StatementStats::AccountStatementExecution() {
   AccountImpl(StatementStatsStorage::ExecutionResult::kSuccess);
 }
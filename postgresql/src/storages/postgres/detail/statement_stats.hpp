@@ -14,6 +14,7 @@ class StatementStatsStorage;
 class StatementStats final {
  public:
   StatementStats(const Query& query, const ConnectionPtr& conn);
+  StatementStats(const Query& query, const StatementStatsStorage& sts);
 
   void AccountStatementExecution();
   void AccountStatementError();
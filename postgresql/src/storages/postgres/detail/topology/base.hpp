@@ -26,6 +26,7 @@ class TopologyBase {
   using DsnIndices = std::vector<DsnIndex>;
   using DsnIndicesByType =
       std::unordered_map<ClusterHostType, DsnIndices, ClusterHostTypeHash>;
+  using DsnLsns = std::vector<Lsn>;
 
   TopologyBase(engine::TaskProcessor& bg_task_processor, DsnList dsns,
                clients::dns::Resolver* resolver,
@@ -48,6 +49,10 @@ class TopologyBase {
   /// Currently accessible hosts
   virtual rcu::ReadablePtr<DsnIndices> GetAliveDsnIndices() const = 0;
 
+  /// WAL positions of the hosts as of the last check, for each DSN in DsnList.
+  /// Replay position for slaves, kUnknownLsn if not known.
+  virtual rcu::ReadablePtr<DsnLsns> GetDsnLsns() const = 0;
+
   // Returns statistics for each DSN in DsnList
   virtual const std::vector<decltype(InstanceStatistics::topology)>&
   GetDsnStatistics() const = 0;
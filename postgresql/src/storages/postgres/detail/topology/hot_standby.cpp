@@ -11,7 +11,6 @@
 #include <fmt/format.h>
 
 #include <storages/postgres/detail/connection.hpp>
-#include <storages/postgres/internal_pg_types.hpp>
 #include <storages/postgres/io/pg_type_parsers.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/task/task_with_result.hpp>
@@ -162,6 +161,10 @@ rcu::ReadablePtr<TopologyBase::DsnIndices> HotStandby::GetAliveDsnIndices()
   return alive_dsn_indices_.Read();
 }
 
+rcu::ReadablePtr<TopologyBase::DsnLsns> HotStandby::GetDsnLsns() const {
+  return dsn_lsns_.Read();
+}
+
 const std::vector<decltype(InstanceStatistics::topology)>&
 HotStandby::GetDsnStatistics() const {
   return dsn_stats_;
@@ -280,8 +283,14 @@ void HotStandby::RunDiscovery() {
       dsn_indices_by_type[ClusterHostType::kSlave].push_back(idx);
     }
   }
+
+  DsnLsns dsn_lsns;
+  dsn_lsns.reserve(host_states_.size());
+  for (const auto& state : host_states_) dsn_lsns.push_back(state.wal_lsn);
+
   dsn_indices_by_type_.Assign(std::move(dsn_indices_by_type));
   alive_dsn_indices_.Assign(std::move(alive_dsn_indices));
+  dsn_lsns_.Assign(std::move(dsn_lsns));
 }
 
 void HotStandby::RunCheck(DsnIndex idx) {
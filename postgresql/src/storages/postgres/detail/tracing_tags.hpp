@@ -16,10 +16,16 @@ const std::string kGetConnectData = "pg_get_conn_data";
 const std::string kQuery = "pg_query";
 /// Prepare query, driver level
 const std::string kPrepare = "pg_prepare";
+/// Prepare the most executed statements of the pool after connecting
+const std::string kWarmUpPrepared = "pg_warm_up_prepared";
 /// Bind portal, driver level
 const std::string kBind = "pg_bind";
 /// Execute query, driver level
 const std::string kExec = "pg_exec";
+/// Send COPY FROM STDIN data, driver level
+const std::string kCopy = "pg_copy";
+/// Execute a batch of single statements in a pipeline, driver level
+const std::string kPipelinedBatch = "pg_pipelined_batch";
 
 // libpq stages
 /// libpq async connect stage
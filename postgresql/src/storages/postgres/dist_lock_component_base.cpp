@@ -36,8 +36,12 @@ DistLockComponentBase::DistLockComponentBase(
       component_config["restart-delay"].As<std::chrono::milliseconds>(
           settings.worker_func_restart_delay);
 
-  auto strategy = std::make_shared<DistLockStrategy>(std::move(cluster), table,
-                                                     lock_name, settings);
+  const auto batching = component_config["batching"].As<bool>(false)
+                            ? DistLockBatching::kEnabled
+                            : DistLockBatching::kDisabled;
+
+  auto strategy = std::make_shared<DistLockStrategy>(
+      std::move(cluster), table, lock_name, settings, batching);
 
   auto task_processor_name =
       component_config["task-processor"].As<std::optional<std::string>>();
@@ -130,6 +134,10 @@ properties:
         type: boolean
         description: Enable testsuite support
         defaultDescription: false
+    batching:
+        type: boolean
+        description: acquire and prolong the lock in a single query with the other batching distlocks of the same cluster and table
+        defaultDescription: false
 )");
 }
 
@@ -1,8 +1,15 @@
 #include <userver/storages/postgres/dist_lock_strategy.hpp>
 
+#include <map>
+#include <mutex>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
 #include <fmt/compile.h>
 #include <fmt/format.h>
 
+#include <userver/dist_lock/acquire_batcher.hpp>
 #include <userver/hostinfo/blocking/get_hostname.hpp>
 #include <userver/storages/postgres/cluster.hpp>
 
@@ -27,6 +34,23 @@ std::string MakeAcquireQuery(const std::string& table) {
   return fmt::format(FMT_COMPILE(kAcquireQueryFmt), table);
 }
 
+// keys - $1
+// owners - $2
+// timeouts in seconds - $3
+std::string MakeBatchAcquireQuery(const std::string& table) {
+  static constexpr auto kBatchAcquireQueryFmt = R"(
+    INSERT INTO {} AS t (key, owner, expiration_time)
+    SELECT v.key, v.owner, current_timestamp + make_interval(secs => v.timeout)
+    FROM UNNEST($1::text[], $2::text[], $3::double precision[])
+    AS v(key, owner, timeout)
+    ON CONFLICT (key) DO UPDATE
+    SET owner = excluded.owner, expiration_time = excluded.expiration_time
+    WHERE (t.owner = excluded.owner) OR
+    (t.expiration_time <= current_timestamp) RETURNING t.key;
+)";
+  return fmt::format(FMT_COMPILE(kBatchAcquireQueryFmt), table);
+}
+
 // key - $1
 // owner - $2
 std::string MakeReleaseQuery(const std::string& table) {
@@ -43,17 +67,47 @@ std::string MakeOwnerId(const std::string& prefix, const std::string& locker) {
   return fmt::format(FMT_COMPILE("{}:{}"), prefix, locker);
 }
 
+// Gives enough time to the lockers woken up by the previous batch to join
+constexpr std::chrono::milliseconds kBatchWindow{10};
+
+std::shared_ptr<dist_lock::AcquireBatcher> GetSharedBatcher(
+    const ClusterPtr& cluster, const std::string& table) {
+  using Key = std::pair<const Cluster*, std::string>;
+  static std::mutex mutex;
+  static std::map<Key, std::weak_ptr<dist_lock::AcquireBatcher>> batchers;
+
+  std::lock_guard lock(mutex);
+  for (auto it = batchers.begin(); it != batchers.end();) {
+    it = it->second.expired() ? batchers.erase(it) : std::next(it);
+  }
+
+  auto& weak_batcher = batchers[Key{cluster.get(), table}];
+  auto batcher = weak_batcher.lock();
+  if (!batcher) {
+    batcher = std::make_shared<dist_lock::AcquireBatcher>(kBatchWindow);
+    weak_batcher = batcher;
+  }
+  return batcher;
+}
+
 }  // namespace
 
 DistLockStrategy::DistLockStrategy(ClusterPtr cluster, const std::string& table,
                                    const std::string& lock_name,
-                                   const dist_lock::DistLockSettings& settings)
+                                   const dist_lock::DistLockSettings& settings,
+                                   DistLockBatching batching)
     : cluster_(std::move(cluster)),
       cc_(settings.forced_stop_margin, settings.forced_stop_margin),
       acquire_query_(MakeAcquireQuery(table)),
+      batch_acquire_query_(MakeBatchAcquireQuery(table)),
       release_query_(MakeReleaseQuery(table)),
       lock_name_(lock_name),
-      owner_prefix_(hostinfo::blocking::GetRealHostName()) {}
+      owner_prefix_(hostinfo::blocking::GetRealHostName()),
+      batcher_(batching == DistLockBatching::kEnabled
+                   ? GetSharedBatcher(cluster_, table)
+                   : nullptr) {}
+
+DistLockStrategy::~DistLockStrategy() = default;
 
 void DistLockStrategy::UpdateCommandControl(CommandControl cc) {
   auto cc_ptr = cc_.StartWrite();
@@ -65,6 +119,31 @@ void DistLockStrategy::Acquire(std::chrono::milliseconds lock_ttl,
                                const std::string& locker_id) {
   double timeout_seconds = lock_ttl.count() / 1000.0;
   auto cc_ptr = cc_.Read();
+
+  if (batcher_) {
+    batcher_->Acquire(
+        {lock_name_, MakeOwnerId(owner_prefix_, locker_id), lock_ttl},
+        [this, &cc_ptr](const std::vector<dist_lock::AcquireRequest>& batch) {
+          std::vector<std::string> keys;
+          std::vector<std::string> owners;
+          std::vector<double> timeouts;
+          keys.reserve(batch.size());
+          owners.reserve(batch.size());
+          timeouts.reserve(batch.size());
+          for (const auto& request : batch) {
+            keys.push_back(request.lock_name);
+            owners.push_back(request.owner);
+            timeouts.push_back(request.lock_ttl.count() / 1000.0);
+          }
+
+          auto result =
+              cluster_->Execute(ClusterHostType::kMaster, *cc_ptr,
+                                batch_acquire_query_, keys, owners, timeouts);
+          return result.AsContainer<std::unordered_set<std::string>>();
+        });
+    return;
+  }
+
   auto result = cluster_->Execute(
       ClusterHostType::kMaster, *cc_ptr, acquire_query_, lock_name_,
       MakeOwnerId(owner_prefix_, locker_id), timeout_seconds);
@@ -1,6 +1,7 @@
 #include <benchmark/benchmark.h>
 
 #include <limits>
+#include <vector>
 
 #include <storages/postgres/detail/connection.hpp>
 
@@ -53,6 +54,34 @@ BENCHMARK_F(PgConnection, Int64Roundtrip)(benchmark::State& state) {
   });
 }
 
+constexpr auto kColumnQuery = "select i::bigint from generate_series(1, $1) i";
+
+void Int64ColumnArgs(benchmark::internal::Benchmark* b) {
+  b->RangeMultiplier(10)->Range(100, 100'000);
+}
+
+BENCHMARK_DEFINE_F(PgConnection, Int64ColumnByRows)(benchmark::State& state) {
+  RunStandalone(state, [this, &state] {
+    const auto res = GetConnection().Execute(
+        kColumnQuery, static_cast<std::int64_t>(state.range(0)));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(res.AsContainer<std::vector<std::int64_t>>());
+    }
+  });
+}
+BENCHMARK_REGISTER_F(PgConnection, Int64ColumnByRows)->Apply(Int64ColumnArgs);
+
+BENCHMARK_DEFINE_F(PgConnection, Int64Column)(benchmark::State& state) {
+  RunStandalone(state, [this, &state] {
+    const auto res = GetConnection().Execute(
+        kColumnQuery, static_cast<std::int64_t>(state.range(0)));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(res.AsColumn<std::int64_t>(0));
+    }
+  });
+}
+BENCHMARK_REGISTER_F(PgConnection, Int64Column)->Apply(Int64ColumnArgs);
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -1,7 +1,7 @@
 #pragma once
 
-#include <storages/postgres/internal_pg_types.hpp>
 #include <userver/compiler/demangle.hpp>
+#include <userver/storages/postgres/cluster_types.hpp>
 #include <userver/storages/postgres/io/buffer_io.hpp>
 #include <userver/storages/postgres/io/buffer_io_base.hpp>
 
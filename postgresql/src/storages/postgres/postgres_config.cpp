@@ -10,6 +10,17 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres {
 
+QueryPriority Parse(const formats::json::Value& elem,
+                    formats::parse::To<QueryPriority>) {
+  const auto priority = elem.As<std::string>();
+  if (priority == "critical") return QueryPriority::kCritical;
+  if (priority == "normal") return QueryPriority::kNormal;
+  if (priority == "background") return QueryPriority::kBackground;
+  throw InvalidConfig{"Invalid priority `" + priority +
+                      "` in postgres CommandControl. The priority must be one "
+                      "of critical, normal, background."};
+}
+
 CommandControl Parse(const formats::json::Value& elem,
                      formats::parse::To<CommandControl>) {
   CommandControl result{components::Postgres::kDefaultCommandControl};
@@ -31,6 +42,8 @@ CommandControl Parse(const formats::json::Value& elem,
                             "` in postgres CommandControl. The timeout must be "
                             "greater than 0."};
       }
+    } else if (name == "priority") {
+      result.priority = it->As<QueryPriority>();
     } else {
       LOG_WARNING() << "Unknown parameter " << name << " in PostgreSQL config";
     }
@@ -58,6 +71,9 @@ ConnectionSettings ParseConnectionSettings(const ConfigType& config) {
       config["max-prepared-cache-size"].template As<size_t>(
           config["max_prepared_cache_size"].template As<size_t>(
               kDefaultMaxPreparedCacheSize));
+  settings.prepared_statements_warmup =
+      config["prepared-statements-warmup"].template As<size_t>(
+          settings.prepared_statements_warmup);
   settings.ignore_unused_query_params =
       config["ignore-unused-query-params"].template As<bool>(
           config["ignore_unused_query_params"].template As<bool>(false))
@@ -116,11 +132,22 @@ PoolSettings ParsePoolSettings(const ConfigType& config) {
       config["max_queue_size"].template As<size_t>(result.max_queue_size);
   result.connecting_limit =
       config["connecting_limit"].template As<size_t>(result.connecting_limit);
+  result.pipelined_connections =
+      config["pipelined_connections"].template As<size_t>(
+          result.pipelined_connections);
+  result.adaptive_size =
+      config["adaptive_pool_size"].template As<bool>(result.adaptive_size);
+  result.critical_reserved_connections =
+      config["critical_reserved_connections"].template As<size_t>(
+          result.critical_reserved_connections);
 
   if (result.max_size == 0)
     throw InvalidConfig{"max_pool_size must be greater than 0"};
   if (result.max_size < result.min_size)
     throw InvalidConfig{"max_pool_size cannot be less than min_pool_size"};
+  if (result.critical_reserved_connections >= result.max_size)
+    throw InvalidConfig{
+        "critical_reserved_connections must be less than max_pool_size"};
 
   return result;
 }
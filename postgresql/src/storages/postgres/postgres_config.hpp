@@ -10,6 +10,9 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres {
 
+QueryPriority Parse(const formats::json::Value& elem,
+                    formats::parse::To<QueryPriority>);
+
 CommandControl Parse(const formats::json::Value& elem,
                      formats::parse::To<CommandControl>);
 
@@ -1,7 +1,10 @@
 #include <userver/storages/postgres/result_set.hpp>
 
+#include <cstdint>
+#include <cstring>
 #include <string_view>
 
+#include <boost/endian/conversion.hpp>
 #include <fmt/format.h>
 
 #include <storages/postgres/detail/result_wrapper.hpp>
@@ -33,6 +36,131 @@ constexpr std::string_view kUnknownTypeErrorMessageTemplate =
     "the type and probably altering a table was run while service up, the only "
     "way to fix this is to restart the service.";
 
+// Fixed-width values are scattered over the PGresult. They are gathered into
+// a contiguous buffer first, so that the byte order is converted by a separate
+// plain loop the compiler can vectorize.
+template <typename T, typename Raw>
+void GatherColumn(const detail::ResultWrapper& res, std::size_t field_index,
+                  Raw* out) {
+  auto* handle = res.handle_.get();
+  const auto col = static_cast<int>(field_index);
+  const auto rows = static_cast<int>(res.RowCount());
+  for (int row = 0; row < rows; ++row) {
+    if (PQgetisnull(handle, row, col)) {
+      throw FieldValueIsNull{field_index, res.GetFieldName(field_index), T{}};
+    }
+    const auto length = static_cast<std::size_t>(PQgetlength(handle, row, col));
+    if (length != sizeof(Raw)) {
+      throw InvalidInputBufferSize{
+          length, fmt::format("for a column of {} byte values", sizeof(Raw))};
+    }
+    std::memcpy(out + row, PQgetvalue(handle, row, col), sizeof(Raw));
+  }
+}
+
+template <typename Raw>
+void BigToNative(Raw* data, std::size_t size) {
+  for (std::size_t i = 0; i < size; ++i) {
+    data[i] = boost::endian::big_to_native(data[i]);
+  }
+}
+
+template <typename T, typename Raw>
+void DecodeColumn(const detail::ResultWrapper& res, std::size_t field_index,
+                  std::vector<T>& column) {
+  const auto size = res.RowCount();
+  if constexpr (std::is_integral_v<T> && sizeof(T) == sizeof(Raw)) {
+    // a signed integer may be accessed via its unsigned counterpart
+    column.resize(size);
+    auto* data = reinterpret_cast<Raw*>(column.data());
+    GatherColumn<T>(res, field_index, data);
+    BigToNative(data, size);
+  } else {
+    std::vector<Raw> raw(size);
+    GatherColumn<T>(res, field_index, raw.data());
+    BigToNative(raw.data(), size);
+    column.resize(size);
+    for (std::size_t i = 0; i < size; ++i) {
+      if constexpr (std::is_floating_point_v<T>) {
+        std::conditional_t<sizeof(Raw) == sizeof(float), float, double> value{};
+        std::memcpy(&value, &raw[i], sizeof(Raw));
+        column[i] = static_cast<T>(value);
+      } else {
+        using Signed = std::make_signed_t<Raw>;
+        column[i] = static_cast<T>(static_cast<Signed>(raw[i]));
+      }
+    }
+  }
+}
+
+// The width of the values is checked the same way the binary parsers do it
+std::size_t GetColumnWidth(const detail::ResultWrapper& res,
+                           std::size_t field_index) {
+  auto* handle = res.handle_.get();
+  const auto col = static_cast<int>(field_index);
+  if (PQfformat(handle, col) != io::kPgBinaryDataFormat) return 0;
+  return PQgetlength(handle, 0, col);
+}
+
+template <typename T>
+bool ReadIntegralColumn(const detail::ResultWrapper& res,
+                        std::size_t field_index, std::vector<T>& column) {
+  if (res.RowCount() == 0) return true;
+  switch (GetColumnWidth(res, field_index)) {
+    case 2:
+      DecodeColumn<T, std::uint16_t>(res, field_index, column);
+      return true;
+    case 4:
+      DecodeColumn<T, std::uint32_t>(res, field_index, column);
+      return true;
+    case 8:
+      DecodeColumn<T, std::uint64_t>(res, field_index, column);
+      return true;
+    default:
+      return false;
+  }
+}
+
+template <typename T>
+bool ReadFloatingPointColumn(const detail::ResultWrapper& res,
+                             std::size_t field_index, std::vector<T>& column) {
+  if (res.RowCount() == 0) return true;
+  switch (GetColumnWidth(res, field_index)) {
+    case 4:
+      DecodeColumn<T, std::uint32_t>(res, field_index, column);
+      return true;
+    case 8:
+      DecodeColumn<T, std::uint64_t>(res, field_index, column);
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool ReadBoolColumn(const detail::ResultWrapper& res, std::size_t field_index,
+                    std::vector<bool>& column) {
+  const auto size = res.RowCount();
+  if (size == 0) return true;
+  if (GetColumnWidth(res, field_index) != 1) return false;
+
+  auto* handle = res.handle_.get();
+  const auto col = static_cast<int>(field_index);
+  column.resize(size);
+  for (std::size_t row = 0; row < size; ++row) {
+    if (PQgetisnull(handle, row, col)) {
+      throw FieldValueIsNull{field_index, res.GetFieldName(field_index),
+                             false};
+    }
+    if (PQgetlength(handle, row, col) != 1) {
+      throw InvalidInputBufferSize{
+          static_cast<std::size_t>(PQgetlength(handle, row, col)),
+          "for boolean type"};
+    }
+    column[row] = *PQgetvalue(handle, row, col) != 0;
+  }
+  return true;
+}
+
 }  // namespace
 
 //----------------------------------------------------------------------------
@@ -252,6 +380,42 @@ void ResultSet::SetBufferCategoriesFrom(const ResultSet& dsc) {
   pimpl_->SetTypeBufferCategories(*dsc.pimpl_);
 }
 
+void ResultSet::CheckFieldIndex(size_type field_index) const {
+  if (field_index >= FieldCount()) {
+    throw FieldIndexOutOfBounds{field_index};
+  }
+}
+
+bool ResultSet::ReadFixedWidthColumn(size_type field_index,
+                                     std::vector<Smallint>& column) const {
+  return ReadIntegralColumn(*pimpl_, field_index, column);
+}
+
+bool ResultSet::ReadFixedWidthColumn(size_type field_index,
+                                     std::vector<Integer>& column) const {
+  return ReadIntegralColumn(*pimpl_, field_index, column);
+}
+
+bool ResultSet::ReadFixedWidthColumn(size_type field_index,
+                                     std::vector<Bigint>& column) const {
+  return ReadIntegralColumn(*pimpl_, field_index, column);
+}
+
+bool ResultSet::ReadFixedWidthColumn(size_type field_index,
+                                     std::vector<float>& column) const {
+  return ReadFloatingPointColumn(*pimpl_, field_index, column);
+}
+
+bool ResultSet::ReadFixedWidthColumn(size_type field_index,
+                                     std::vector<double>& column) const {
+  return ReadFloatingPointColumn(*pimpl_, field_index, column);
+}
+
+bool ResultSet::ReadFixedWidthColumn(size_type field_index,
+                                     std::vector<bool>& column) const {
+  return ReadBoolColumn(*pimpl_, field_index, column);
+}
+
 Row::size_type Row::IndexOfName(const std::string& name) const {
   return res_->IndexOfName(name);
 }
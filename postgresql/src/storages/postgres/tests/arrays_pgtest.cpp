@@ -401,6 +401,19 @@ TEST(PostgreIO, Arrays) {
   }
 }
 
+TEST(PostgreIO, ArraysBufferReserve) {
+  // The buffer is reserved for all the elements at once
+  const std::vector<int> ints(1000, 42);
+  pg::test::Buffer buffer;
+  io::WriteBuffer(types, buffer, ints);
+  EXPECT_EQ(buffer.capacity(), buffer.size());
+
+  const std::vector<std::string> strings(1000, "value");
+  buffer = {};
+  io::WriteBuffer(types, buffer, strings);
+  EXPECT_EQ(buffer.capacity(), buffer.size());
+}
+
 TEST(PostgreIO, ArraysSet) {
   const pg::io::TypeBufferCategory categories = GetTestTypeCategories();
   {
@@ -10,6 +10,7 @@
 #include <userver/storages/postgres/cluster.hpp>
 #include <userver/storages/postgres/dsn.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
+#include <userver/utils/async.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -45,12 +46,15 @@ void CheckRwTransaction(pg::Transaction trx) {
 pg::Cluster CreateCluster(
     const pg::DsnList& dsns, engine::TaskProcessor& bg_task_processor,
     size_t max_size, testsuite::TestsuiteTasks& testsuite_tasks,
-    pg::ConnectionSettings conn_settings = kCachePreparedStatements) {
+    pg::ConnectionSettings conn_settings = kCachePreparedStatements,
+    size_t pipelined_connections = 0) {
   auto source = dynamic_config::GetDefaultSource();
+  pg::PoolSettings pool_settings{0, max_size, max_size};
+  pool_settings.pipelined_connections = pipelined_connections;
   return pg::Cluster(dsns, nullptr, bg_task_processor,
                      {{},
                       {utest::kMaxTestWaitTime},
-                      {0, max_size, max_size},
+                      pool_settings,
                       conn_settings,
                       storages::postgres::InitMode::kAsync,
                       "",
@@ -262,6 +266,31 @@ UTEST_F(PostgreCluster, SingleQuery) {
   EXPECT_EQ(1, res.Size());
 }
 
+UTEST_F(PostgreCluster, ReadYourWrites) {
+  testsuite::TestsuiteTasks testsuite_tasks{true};
+  auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 1,
+                               testsuite_tasks);
+
+  auto trx = cluster.Begin(pg::ClusterHostType::kMaster, pg::Transaction::RW);
+  trx.Execute("select 1");
+  const auto lsn = trx.CommitWithLsn();
+  EXPECT_NE(lsn, pg::kUnknownLsn);
+
+  CheckRoTransaction(
+      cluster.Begin(pg::ClusterHostType::kSlave, lsn, pg::Transaction::RO));
+  CheckRoTransaction(
+      cluster.Begin({pg::ClusterHostType::kSlave, pg::ClusterHostType::kMaster},
+                    lsn, pg::Transaction::RO));
+  CheckRoTransaction(cluster.Begin(pg::ClusterHostType::kSyncSlave,
+                                   pg::Lsn{~0ULL}, pg::Transaction::RO));
+
+  pg::ResultSet res{nullptr};
+  UEXPECT_NO_THROW(
+      res = cluster.Execute(pg::ClusterHostType::kSlave, lsn, "select 1"));
+  EXPECT_EQ(1, res.Size());
+  UEXPECT_THROW(cluster.Execute({}, lsn, "select 1"), pg::LogicError);
+}
+
 UTEST_F(PostgreCluster, HostSelectionSingleQuery) {
   testsuite::TestsuiteTasks testsuite_tasks{true};
   auto cluster = CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 1,
@@ -399,6 +428,39 @@ UTEST_F(PostgreCluster, NonTransactionExecuteWithParameterStoreMove) {
   }
 }
 
+UTEST_F(PostgreCluster, PipelinedExecute) {
+  constexpr int kStatementsCount = 50;
+
+  testsuite::TestsuiteTasks testsuite_tasks{true};
+  auto cluster =
+      CreateCluster(GetDsnListFromEnv(), GetTaskProcessor(), 2,
+                    testsuite_tasks, kPipelineEnabled, /*pipelined=*/1);
+
+  std::vector<engine::TaskWithResult<int>> tasks;
+  tasks.reserve(kStatementsCount);
+  for (int i = 0; i < kStatementsCount; ++i) {
+    tasks.push_back(utils::Async("pipelined", [&cluster, i] {
+      return cluster.Execute(pg::ClusterHostType::kMaster, "select $1", i)
+          .AsSingleRow<int>();
+    }));
+  }
+
+  // a failed statement does not affect the others in the same batch
+  UEXPECT_THROW(cluster.Execute(pg::ClusterHostType::kMaster, "select 1 / $1",
+                                0),
+                pg::DataException);
+
+  for (int i = 0; i < kStatementsCount; ++i) {
+    EXPECT_EQ(tasks[i].Get(), i);
+  }
+
+  pg::ParameterStore store;
+  store.PushBack(42);
+  EXPECT_EQ(cluster.Execute(pg::ClusterHostType::kMaster, "select $1", store)
+                .AsSingleRow<int>(),
+            42);
+}
+
 UTEST_F(PostgreCluster, ListenNotify) {
   constexpr auto kListenChannel = std::string_view{"foo"};
   constexpr auto kNotifyPayload = std::string_view{"bar"};
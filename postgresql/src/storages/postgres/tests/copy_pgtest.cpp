@@ -0,0 +1,123 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <userver/storages/postgres/copy.hpp>
+#include <userver/storages/postgres/transaction.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+struct CopyRow final {
+  int id{};
+  std::string value;
+  std::optional<double> score;
+};
+
+std::vector<CopyRow> MakeRows(int count) {
+  std::vector<CopyRow> rows;
+  rows.reserve(count);
+  for (int i = 0; i < count; ++i) {
+    rows.push_back({i, std::string(i % 100, 'x'),
+                    i % 3 ? std::optional<double>{i / 2.0} : std::nullopt});
+  }
+  return rows;
+}
+
+}  // namespace
+
+UTEST_P(PostgreConnection, CopyInCopyOut) {
+  CheckConnection(GetConn());
+
+  GetConn()->Execute(
+      "create temporary table copy_test(id integer, value text, score "
+      "double precision)");
+
+  // several chunks of CopyData
+  const auto rows = MakeRows(10000);
+  pg::Transaction trx{std::move(GetConn())};
+  EXPECT_EQ(trx.CopyIn("copy_test", {"id", "value", "score"}, rows),
+            rows.size());
+  const auto count = trx.Execute("select count(*) from copy_test");
+  EXPECT_EQ(count.Front().As<pg::Bigint>(pg::kFieldTag), rows.size());
+
+  std::size_t index = 0;
+  for (const auto& row :
+       trx.CopyOut<CopyRow>("select id, value, score from copy_test "
+                            "order by id")) {
+    ASSERT_LT(index, rows.size());
+    EXPECT_EQ(row.id, rows[index].id);
+    EXPECT_EQ(row.value, rows[index].value);
+    EXPECT_EQ(row.score, rows[index].score);
+    ++index;
+  }
+  EXPECT_EQ(index, rows.size());
+
+  std::vector<int> ids;
+  for (auto id : trx.CopyOut<int>("select id from copy_test where id < 3 "
+                                  "order by id")) {
+    ids.push_back(id);
+  }
+  EXPECT_EQ(ids, (std::vector<int>{0, 1, 2}));
+
+  trx.Commit();
+}
+
+UTEST_P(PostgreConnection, CopyInEmptyAndColumns) {
+  CheckConnection(GetConn());
+
+  GetConn()->Execute(
+      "create temporary table copy_test(id integer, value text default "
+      "'default')");
+
+  pg::Transaction trx{std::move(GetConn())};
+  EXPECT_EQ(trx.CopyIn("copy_test", {}, std::vector<CopyRow>{}), 0u);
+  EXPECT_EQ(trx.CopyIn("pg_temp.copy_test", {"id"}, std::vector<int>{1, 2}),
+            2u);
+  const auto count =
+      trx.Execute("select count(*) from copy_test where value = 'default'");
+  EXPECT_EQ(count.Front().As<pg::Bigint>(pg::kFieldTag), 2);
+  trx.Commit();
+}
+
+UTEST_P(PostgreConnection, CopyErrors) {
+  CheckConnection(GetConn());
+
+  GetConn()->Execute(
+      "create temporary table copy_test(id integer primary key, value text)");
+
+  pg::Transaction trx{std::move(GetConn())};
+  trx.CopyIn("copy_test", {"id", "value"},
+             std::vector<std::tuple<int, std::string>>{{1, "a"}, {2, "b"}});
+
+  using WrongRow = std::tuple<int, std::string, int>;
+  const auto read_wrong_rows = [&trx] {
+    for (const auto& row :
+         trx.CopyOut<WrongRow>("select id, value from copy_test")) {
+      (void)row;
+    }
+  };
+  UEXPECT_THROW(read_wrong_rows(), pg::InvalidTupleSizeRequested);
+
+  {
+    // the rest of the data of an abandoned stream is discarded
+    auto stream = trx.CopyOut<int>("select id from copy_test order by id");
+    EXPECT_EQ(*stream.begin(), 1);
+  }
+  const auto count = trx.Execute("select count(*) from copy_test");
+  EXPECT_EQ(count.Front().As<pg::Bigint>(pg::kFieldTag), 2);
+
+  trx.Execute("savepoint copy_savepoint");
+  UEXPECT_THROW(trx.CopyIn("copy_test", {"id"}, std::vector<int>{3, 3}),
+                pg::UniqueViolation);
+  UEXPECT_NO_THROW(trx.Execute("rollback to savepoint copy_savepoint"));
+  trx.Commit();
+}
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,8 @@
 #include <storages/postgres/tests/util_pgtest.hpp>
 
+#include <mutex>
+#include <vector>
+
 #include <userver/utest/utest.hpp>
 
 #include <userver/engine/async.hpp>
@@ -146,6 +149,60 @@ UTEST_P(PostgrePool, BlockWaitingOnAvailableConnection) {
   CheckConnection(std::move(conn));
 }
 
+UTEST_P(PostgrePool, PriorityWaiters) {
+  auto pool = pg::detail::ConnectionPool::Create(
+      GetDsnFromEnv(), nullptr, GetTaskProcessor(), "", GetParam(), {1, 1, 10},
+      kCachePreparedStatements, {}, GetTestCmdCtls(), {}, {}, {},
+      dynamic_config::GetDefaultSource());
+  pg::detail::ConnectionPtr conn(nullptr);
+  UASSERT_NO_THROW(conn = pool->Acquire(MakeDeadline()));
+
+  engine::Mutex order_mutex;
+  std::vector<pg::QueryPriority> order;
+  const auto acquire = [&](pg::QueryPriority priority) {
+    return engine::AsyncNoSpan([&, priority] {
+      auto conn = pool->Acquire(MakeDeadline(), priority);
+      const std::lock_guard lock{order_mutex};
+      order.push_back(priority);
+    });
+  };
+
+  // The background waiter comes first, but is served last
+  auto background = acquire(pg::QueryPriority::kBackground);
+  engine::SleepFor(std::chrono::milliseconds{10});
+  auto critical = acquire(pg::QueryPriority::kCritical);
+  engine::SleepFor(std::chrono::milliseconds{10});
+
+  conn = pg::detail::ConnectionPtr(nullptr);
+  UEXPECT_NO_THROW(critical.Get());
+  UEXPECT_NO_THROW(background.Get());
+  EXPECT_EQ(order, (std::vector{pg::QueryPriority::kCritical,
+                                pg::QueryPriority::kBackground}));
+}
+
+UTEST_P(PostgrePool, CriticalReservedConnections) {
+  pg::PoolSettings settings{2, 2, 10};
+  settings.critical_reserved_connections = 1;
+  auto pool = pg::detail::ConnectionPool::Create(
+      GetDsnFromEnv(), nullptr, GetTaskProcessor(), "", GetParam(), settings,
+      kCachePreparedStatements, {}, GetTestCmdCtls(), {}, {}, {},
+      dynamic_config::GetDefaultSource());
+
+  pg::detail::ConnectionPtr normal(nullptr);
+  UASSERT_NO_THROW(normal = pool->Acquire(MakeDeadline()));
+  UEXPECT_THROW(pg::detail::ConnectionPtr conn = pool->Acquire(
+                    engine::Deadline::FromDuration(
+                        std::chrono::milliseconds{50})),
+                pg::PoolError)
+      << "The last connection is reserved for the critical queries";
+
+  pg::detail::ConnectionPtr critical(nullptr);
+  UEXPECT_NO_THROW(
+      critical = pool->Acquire(MakeDeadline(), pg::QueryPriority::kCritical));
+  CheckConnection(std::move(critical));
+  CheckConnection(std::move(normal));
+}
+
 UTEST_P(PostgrePool, PoolInitialSizeExceedMaxSize) {
   UEXPECT_THROW(
       pg::detail::ConnectionPool::Create(
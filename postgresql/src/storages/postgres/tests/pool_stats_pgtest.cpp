@@ -285,6 +285,35 @@ UTEST_F(PostgrePoolStats, MaxPreparedCacheSize) {
             conn_settings.max_prepared_cache_size);
 }
 
+
+UTEST_F(PostgrePoolStats, PreparedStatementsWarmup) {
+  pg::ConnectionSettings conn_settings;
+  conn_settings.prepared_statements_warmup = 10;
+
+  auto pool = pg::detail::ConnectionPool::Create(
+      GetDsnFromEnv(), nullptr, GetTaskProcessor(), "",
+      storages::postgres::InitMode::kAsync, {1, 10, 10}, conn_settings, {},
+      GetTestCmdCtls(), {}, {}, {}, dynamic_config::GetDefaultSource());
+
+  auto conn = pg::detail::ConnectionPtr{nullptr};
+  UASSERT_NO_THROW(conn = pool->Acquire(MakeDeadline()));
+  CheckConnection(conn);
+  for (int i = 0; i < 3; ++i) {
+    UEXPECT_NO_THROW(conn->Execute("select 1"));
+    UEXPECT_NO_THROW(conn->Execute("select $1", i));
+  }
+
+  // the first connection is busy, so a new one is created
+  auto new_conn = pg::detail::ConnectionPtr{nullptr};
+  UASSERT_NO_THROW(new_conn = pool->Acquire(MakeDeadline()));
+  CheckConnection(new_conn);
+  [[maybe_unused]] const auto connect_stats = new_conn->GetStatsAndReset();
+
+  UEXPECT_NO_THROW(new_conn->Execute("select 1"));
+  UEXPECT_NO_THROW(new_conn->Execute("select $1", 42));
+  EXPECT_EQ(new_conn->GetStatsAndReset().parse_total, 0);
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,9 @@
 #include <storages/postgres/tests/util_pgtest.hpp>
 
+#include <optional>
+#include <string>
+#include <vector>
+
 #include <userver/storages/postgres/result_set.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -147,4 +151,45 @@ UTEST_P(PostgreConnection, ResultAsOptionalSingleRow) {
   UEXPECT_THROW(res.AsOptionalSingleRow<int>(), pg::NonSingleRowResultSet);
 }
 
+UTEST_P(PostgreConnection, ResultAsColumns) {
+  CheckConnection(GetConn());
+
+  pg::ResultSet res{nullptr};
+  UEXPECT_NO_THROW(
+      res = GetConn()->Execute(
+          "select i::smallint, i::integer, i::bigint, i::real, "
+          "i::double precision, i % 2 = 0, i::text "
+          "from generate_series(-5, 1000) i"));
+  ASSERT_EQ(1006, res.Size());
+
+  const auto [smallints, integers, bigints, reals, doubles, bools, texts] =
+      res.AsColumns<pg::Smallint, pg::Integer, pg::Bigint, float, double, bool,
+                    std::string>();
+  for (std::size_t i = 0; i < res.Size(); ++i) {
+    const int expected = static_cast<int>(i) - 5;
+    EXPECT_EQ(expected, smallints[i]);
+    EXPECT_EQ(expected, integers[i]);
+    EXPECT_EQ(expected, bigints[i]);
+    EXPECT_EQ(expected, reals[i]);
+    EXPECT_EQ(expected, doubles[i]);
+    EXPECT_EQ(expected % 2 == 0, bools[i]);
+    EXPECT_EQ(std::to_string(expected), texts[i]);
+  }
+
+  // column type width differs from the C++ type
+  EXPECT_EQ(res.AsColumn<pg::Bigint>(0), res.AsColumn<pg::Bigint>(2));
+  EXPECT_EQ(res.AsColumn<double>(3), res.AsColumn<double>(4));
+
+  UEXPECT_THROW(res.AsColumn<int>(7), pg::FieldIndexOutOfBounds);
+  UEXPECT_THROW((res.AsColumns<int, int>()), pg::InvalidTupleSizeRequested);
+
+  UEXPECT_NO_THROW(res = GetConn()->Execute("select 1 union all select null"));
+  UEXPECT_THROW(res.AsColumn<int>(0), pg::FieldValueIsNull);
+  EXPECT_EQ((std::vector<std::optional<int>>{1, std::nullopt}),
+            res.AsColumn<std::optional<int>>(0));
+
+  UEXPECT_NO_THROW(res = GetConn()->Execute("select 1 where false"));
+  EXPECT_TRUE(res.AsColumn<int>(0).empty());
+}
+
 USERVER_NAMESPACE_END
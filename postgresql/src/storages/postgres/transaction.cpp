@@ -1,11 +1,16 @@
 #include <userver/storages/postgres/transaction.hpp>
 
+#include <utility>
+
 #include <storages/postgres/deadline.hpp>
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/detail/statement_stats.hpp>
+#include <storages/postgres/io/pg_type_parsers.hpp>
 #include <userver/storages/postgres/exceptions.hpp>
 #include <userver/testsuite/testpoint.hpp>
 
+#include <fmt/format.h>
+
 #include <userver/logging/log.hpp>
 #include <userver/utils/uuid4.hpp>
 
@@ -13,6 +18,14 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::postgres {
 
+namespace {
+
+constexpr int kWalLsnMinVersion = 100000;
+const std::string kCurrentWalLsn = "SELECT pg_current_wal_lsn()";
+const std::string kCurrentXlogLocation = "SELECT pg_current_xlog_location()";
+
+}  // namespace
+
 Transaction::Transaction(detail::ConnectionPtr&& conn,
                          const TransactionOptions& options,
                          OptionalCommandControl trx_cmd_ctl,
@@ -105,6 +118,62 @@ Portal Transaction::MakePortal(const PortalName& portal_name,
                 std::move(statement_cmd_ctl)};
 }
 
+std::size_t Transaction::DoCopyIn(std::string_view table,
+                                  const std::vector<std::string>& columns,
+                                  detail::CopyInChunkWriter write_rows,
+                                  OptionalCommandControl statement_cmd_ctl) {
+  if (!conn_) {
+    LOG_LIMITED_ERROR() << "CopyIn called after transaction finished"
+                        << logging::LogExtra::Stacktrace();
+    throw NotInTransaction("Transaction handle is not valid");
+  }
+  // only names the statement for statistics and command controls
+  const Query stats_query{std::string{},
+                          Query::Name{fmt::format("copy_in.{}", table)}};
+  if (!statement_cmd_ctl) {
+    statement_cmd_ctl = conn_->GetQueryCmdCtl(stats_query.GetName());
+  }
+  auto source = conn_.GetConfigSource();
+  if (source) CheckDeadlineIsExpired(source->GetSnapshot());
+
+  bool header_written = false;
+  auto write_chunk = [&header_written, write_rows](std::vector<char>& buffer) {
+    if (!std::exchange(header_written, true)) {
+      detail::WriteCopyHeader(buffer);
+    }
+    const auto has_more = write_rows(buffer);
+    if (!has_more) detail::WriteCopyTrailer(buffer);
+    return has_more;
+  };
+
+  detail::StatementStats stats{stats_query, conn_};
+  try {
+    auto res = conn_->CopyIn(table, columns, write_chunk,
+                             std::move(statement_cmd_ctl));
+    stats.AccountStatementExecution();
+    return res.RowsAffected();
+  } catch (const std::exception&) {
+    stats.AccountStatementError();
+    throw;
+  }
+}
+
+detail::CopyOutReader Transaction::MakeCopyOutReader(
+    const Query& query, OptionalCommandControl statement_cmd_ctl) {
+  if (!conn_) {
+    LOG_LIMITED_ERROR() << "CopyOut called after transaction finished"
+                        << logging::LogExtra::Stacktrace();
+    throw NotInTransaction("Transaction handle is not valid");
+  }
+  if (!statement_cmd_ctl) {
+    statement_cmd_ctl = conn_->GetQueryCmdCtl(query.GetName());
+  }
+  auto source = conn_.GetConfigSource();
+  if (source) CheckDeadlineIsExpired(source->GetSnapshot());
+
+  return detail::CopyOutReader{conn_, query, std::move(statement_cmd_ctl)};
+}
+
 void Transaction::SetParameter(const std::string& param_name,
                                const std::string& value) {
   if (!conn_) {
@@ -116,7 +185,18 @@ void Transaction::SetParameter(const std::string& param_name,
                       detail::Connection::ParameterScope::kTransaction);
 }
 
-void Transaction::Commit() {
+void Transaction::Commit() { DoCommit(); }
+
+Lsn Transaction::CommitWithLsn() {
+  auto conn = DoCommit();
+  const auto& statement = conn->GetServerVersion() >= kWalLsnMinVersion
+                              ? kCurrentWalLsn
+                              : kCurrentXlogLocation;
+  const auto res = conn->Execute(statement);
+  return res.Front().As<Lsn>();
+}
+
+detail::ConnectionPtr Transaction::DoCommit() {
   if (conn_) {
     if (!name_.empty()) {
       TESTPOINT_CALLBACK(
@@ -133,7 +213,7 @@ void Transaction::Commit() {
     conn_->Commit();
     // in case of exception inside commit let it fly and don't release the
     // connection holder to allow for rolling back later
-    conn_ = detail::ConnectionPtr{nullptr};
+    return std::exchange(conn_, detail::ConnectionPtr{nullptr});
   } else {
     LOG_LIMITED_ERROR() << "Commit after transaction finished"
                         << logging::LogExtra::Stacktrace();
@@ -4,6 +4,8 @@
 /// @brief Publisher interface for the broker.
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <userver/utils/fast_pimpl.hpp>
 
@@ -77,6 +79,12 @@ class ReliableChannel final : IReliableChannelInterface {
                     deadline);
   }
 
+  /// @copydoc Client::PublishReliableBatch
+  void PublishReliableBatch(const Exchange& exchange,
+                            const std::string& routing_key,
+                            const std::vector<std::string>& messages,
+                            MessageType type, engine::Deadline deadline);
+
  private:
   utils::FastPimpl<ConnectionPtr, 32, 8> impl_;
 };
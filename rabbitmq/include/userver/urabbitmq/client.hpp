@@ -101,6 +101,24 @@ class Client : public std::enable_shared_from_this<Client>,
                     deadline);
   }
 
+  /// @brief Publish the messages to an exchange and await confirmation from
+  /// the broker for all of them.
+  ///
+  /// The messages are published back to back over a single connection
+  /// without waiting for the confirms in between, so this is much faster than
+  /// publishing them one by one. Throws if any of the messages is not
+  /// confirmed; some of the messages might be delivered in that case.
+  ///
+  /// @param exchange the exchange to publish to
+  /// @param routing_key the routing key
+  /// @param messages the messages to send
+  /// @param type the type of the messages
+  /// @param deadline execution deadline
+  void PublishReliableBatch(const Exchange& exchange,
+                            const std::string& routing_key,
+                            const std::vector<std::string>& messages,
+                            MessageType type, engine::Deadline deadline);
+
   /// @brief Get a reliable publisher interface for the broker
   /// (publisher-confirms)
   ///
@@ -6,6 +6,7 @@
 #include <memory>
 
 #include <userver/utils/periodic_task.hpp>
+#include <userver/utils/statistics/fwd.hpp>
 
 #include <userver/urabbitmq/consumer_settings.hpp>
 
@@ -16,6 +17,10 @@ namespace urabbitmq {
 class Client;
 class ConsumerBaseImpl;
 
+namespace statistics {
+struct ConsumerStatistics;
+}
+
 /// @ingroup userver_base_classes
 ///
 /// @brief Base class for your consumers.
@@ -56,6 +61,10 @@ class ConsumerBase {
   /// otherwise it's UB.
   void Stop();
 
+  /// Write consumer statistics: processed and failed messages, processing
+  /// timings and the current prefetch count
+  void WriteStatistics(utils::statistics::Writer& writer) const;
+
  protected:
   /// @brief You may override this method in derived class and implement
   /// message handling logic. By default it does nothing.
@@ -80,6 +89,7 @@ class ConsumerBase {
  private:
   std::shared_ptr<Client> client_;
   const ConsumerSettings settings_;
+  std::unique_ptr<statistics::ConsumerStatistics> stats_;
 
   std::unique_ptr<ConsumerBaseImpl> impl_;
   utils::PeriodicTask monitor_{};
@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <userver/components/component_base.hpp>
+#include <userver/utils/statistics/entry.hpp>
 #include <userver/urabbitmq/typedefs.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -38,6 +39,9 @@ namespace urabbitmq {
 /// rabbit_name      | Name of the RabbitMQ component to use for consumption
 /// queue            | Name of the queue to consume from
 /// prefetch_count   | prefetch_count for the consumer, limits the amount of in-flight messages
+/// max_prefetch_count | if greater than prefetch_count, prefetch is tuned between them from the processing latency and throughput | 0
+/// ack_batch_size   | acks of that many processed messages are sent at once | 1
+/// ack_batch_interval | pending acks are sent at least that often | 100ms
 ///
 // clang-format on
 class ConsumerComponentBase : public components::ComponentBase {
@@ -77,6 +81,7 @@ class ConsumerComponentBase : public components::ComponentBase {
   // This is actually just a subclass of `ConsumerBase`
   class Impl;
   std::unique_ptr<Impl> impl_;
+  utils::statistics::Entry statistics_holder_;
 };
 
 }  // namespace urabbitmq
@@ -3,7 +3,9 @@
 /// @file userver/urabbitmq/consumer_settings.hpp
 /// @brief Consumer settings.
 
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 
 #include <userver/urabbitmq/typedefs.hpp>
 
@@ -24,6 +26,19 @@ struct ConsumerSettings final {
   /// Settings this value to 1 basically makes a consumer synchronous, which
   /// could be of use for some workloads
   std::uint16_t prefetch_count;
+
+  /// If greater than `prefetch_count`, the limit for unacked messages is tuned
+  /// between the two: it follows twice the number of messages processed
+  /// concurrently on average, as observed from the processing latency and
+  /// throughput
+  std::uint16_t max_prefetch_count{0};
+
+  /// Acks of that many processed messages are sent at once, acknowledging
+  /// all the messages up to the latest one; 1 acks every message separately
+  std::uint16_t ack_batch_size{1};
+
+  /// Pending acks are sent at least that often if `ack_batch_size` > 1
+  std::chrono::milliseconds ack_batch_interval{100};
 };
 
 }  // namespace urabbitmq
@@ -1,5 +1,6 @@
 #include "utils_rmqtest.hpp"
 
+#include <algorithm>
 #include <optional>
 
 #include <userver/engine/sleep.hpp>
@@ -113,6 +114,34 @@ UTEST(Consumer, ConsumeWorks) {
   EXPECT_EQ(consumed[0], message);
 }
 
+UTEST(Consumer, ReliableBatchWorks) {
+  ClientWrapper client{};
+  client.SetupRmqEntities();
+  const urabbitmq::ConsumerSettings settings{client.GetQueue(), 10};
+
+  std::vector<std::string> messages;
+  for (size_t i = 0; i < 1000; ++i) {
+    messages.push_back(std::to_string(i));
+  }
+  client->PublishReliableBatch(client.GetExchange(), client.GetRoutingKey(),
+                               messages, urabbitmq::MessageType::kTransient,
+                               client.GetDeadline());
+  // an empty batch is confirmed right away
+  client->PublishReliableBatch(client.GetExchange(), client.GetRoutingKey(),
+                               {}, urabbitmq::MessageType::kTransient,
+                               client.GetDeadline());
+
+  Consumer consumer{client.Get(), settings};
+  consumer.ExpectConsume(messages.size());
+
+  consumer.Start();
+  auto consumed = consumer.Wait();
+
+  std::sort(consumed.begin(), consumed.end());
+  std::sort(messages.begin(), messages.end());
+  EXPECT_EQ(consumed, messages);
+}
+
 UTEST(Consumer, BasicGetWorks) {
   ClientWrapper client{};
   client.SetupRmqEntities();
@@ -1,9 +1,14 @@
 #include "consumer_base_impl.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <mutex>
 #include <string>
 
 #include <fmt/format.h>
 
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/engine/task/task.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
@@ -12,6 +17,7 @@
 #include <urabbitmq/connection.hpp>
 #include <urabbitmq/impl/amqp_channel.hpp>
 #include <urabbitmq/impl/deferred_wrapper.hpp>
+#include <urabbitmq/statistics/consumer_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -20,26 +26,32 @@ namespace urabbitmq {
 namespace {
 
 constexpr std::chrono::milliseconds kStartTimeout{2000};
+constexpr std::chrono::seconds kPrefetchTuneInterval{1};
 
 }  // namespace
 
 ConsumerBaseImpl::ConsumerBaseImpl(ConnectionPtr&& connection,
-                                   const ConsumerSettings& settings)
+                                   const ConsumerSettings& settings,
+                                   statistics::ConsumerStatistics& stats)
     : dispatcher_{engine::current_task::GetTaskProcessor()},
       queue_name_{settings.queue.GetUnderlying()},
+      settings_{settings},
       prefetch_count_{settings.prefetch_count},
+      stats_{stats},
       connection_ptr_{std::move(connection)},
       channel_{connection_ptr_->GetChannel()} {
   // We take ownership of the connection, because if it remains pooled
   // things get messy with lifetimes and callbacks
   connection_ptr_.Adopt();
+  stats_.prefetch_count = prefetch_count_;
 }
 
 ConsumerBaseImpl::~ConsumerBaseImpl() { Stop(); }
 
 void ConsumerBaseImpl::Start(DispatchCallback cb) {
   const auto start_deadline = engine::Deadline::FromDuration(kStartTimeout);
-  channel_.SetQos(prefetch_count_, start_deadline);
+  const bool tune_prefetch = settings_.max_prefetch_count > prefetch_count_;
+  channel_.SetQos(prefetch_count_, tune_prefetch, start_deadline);
 
   dispatch_callback_ = std::move(cb);
 
@@ -65,6 +77,10 @@ void ConsumerBaseImpl::Start(DispatchCallback cb) {
       },
       start_deadline);
 
+  if (settings_.ack_batch_size > 1 || tune_prefetch) {
+    bts_.Detach(engine::AsyncNoSpan(dispatcher_, [this] { RunMaintenance(); }));
+  }
+
   LOG_INFO() << "Started a consumer for '" << queue_name_ << "' queue";
 }
 
@@ -79,6 +95,12 @@ void ConsumerBaseImpl::Stop() {
   // Cancel all the active dispatched tasks
   bts_.CancelAndWait();
 
+  try {
+    FlushAcks();
+  } catch (const std::exception&) {
+    // Not acked messages will be requeued by RabbitMQ
+  }
+
   // Destroy the connection: at this point all the remaining tasks are stopped,
   // consumer is either stopped or in unknown state - that could happen if we
   // didn't receive onSuccess callback yet.
@@ -109,6 +131,7 @@ void ConsumerBaseImpl::OnMessage(const AMQP::Message& message,
        parent_span_id = std::move(parent_span_id), delivery_tag]() mutable {
         auto span = tracing::Span::MakeSpan(std::move(span_name), trace_id,
                                             {parent_span_id});
+        const auto start = std::chrono::steady_clock::now();
         bool success = false;
         try {
           dispatch_callback_(std::move(consumed));
@@ -118,12 +141,27 @@ void ConsumerBaseImpl::OnMessage(const AMQP::Message& message,
                       << "; would requeue";
         }
 
+        const auto processing_time =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start);
+        stats_.processing_timings.Account(processing_time.count() / 1000.0);
+        ++(success ? stats_.processed : stats_.failed);
+        ++processed_count_;
+        processing_time_us_ += processing_time.count();
+
+        const bool batch_acks = settings_.ack_batch_size > 1;
         try {
           if (success) {
-            channel_.Ack(delivery_tag, {});
+            if (batch_acks) {
+              Settle(delivery_tag, true);
+            } else {
+              channel_.Ack(delivery_tag, {});
+            }
             channel_.AccountMessageConsumed();
           } else {
+            // Rejected right away, so that the batched acks never cover it
             channel_.Reject(delivery_tag, true, {});
+            if (batch_acks) Settle(delivery_tag, false);
           }
         } catch (const std::exception& ex) {
           LOG_WARNING()
@@ -133,6 +171,88 @@ void ConsumerBaseImpl::OnMessage(const AMQP::Message& message,
       }));
 }
 
+void ConsumerBaseImpl::Settle(uint64_t delivery_tag, bool success) {
+  {
+    std::lock_guard lock{ack_mutex_};
+    auto& state = ack_state_;
+    if (delivery_tag != state.settled_up_to + 1) {
+      state.settled_out_of_order.emplace(delivery_tag, success);
+      return;
+    }
+
+    state.settled_up_to = delivery_tag;
+    if (success) ++state.ackable;
+    auto& out_of_order = state.settled_out_of_order;
+    for (auto it = out_of_order.begin();
+         it != out_of_order.end() && it->first == state.settled_up_to + 1;
+         it = out_of_order.erase(it)) {
+      state.settled_up_to = it->first;
+      if (it->second) ++state.ackable;
+    }
+
+    if (state.ackable < settings_.ack_batch_size) return;
+  }
+
+  FlushAcks();
+}
+
+void ConsumerBaseImpl::FlushAcks() {
+  std::lock_guard lock{ack_mutex_};
+  if (!ack_state_.ackable) return;
+
+  channel_.AckMultiple(ack_state_.settled_up_to, {});
+  ack_state_.ackable = 0;
+}
+
+void ConsumerBaseImpl::RunMaintenance() {
+  const auto interval = settings_.ack_batch_size > 1
+                            ? std::min<std::chrono::milliseconds>(
+                                  settings_.ack_batch_interval,
+                                  kPrefetchTuneInterval)
+                            : kPrefetchTuneInterval;
+  auto last_tune = std::chrono::steady_clock::now();
+
+  while (!engine::current_task::ShouldCancel()) {
+    engine::InterruptibleSleepFor(interval);
+    try {
+      FlushAcks();
+
+      const auto now = std::chrono::steady_clock::now();
+      if (now - last_tune >= kPrefetchTuneInterval) {
+        TunePrefetch(std::chrono::duration_cast<std::chrono::milliseconds>(
+            now - last_tune));
+        last_tune = now;
+      }
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "Consumer maintenance failed: " << ex;
+    }
+  }
+}
+
+void ConsumerBaseImpl::TunePrefetch(std::chrono::milliseconds interval) {
+  if (settings_.max_prefetch_count <= settings_.prefetch_count) return;
+
+  const auto processed = processed_count_.exchange(0);
+  const auto processing_time_us = processing_time_us_.exchange(0);
+  // Keep the prefetch if there was nothing to process
+  if (!processed || interval.count() <= 0) return;
+
+  // Little's law: the average number of the messages processed concurrently
+  const auto concurrency = static_cast<double>(processing_time_us) /
+                           (interval.count() * 1000.0);
+  const auto target = static_cast<uint16_t>(
+      std::clamp(std::ceil(concurrency * 2),
+                 static_cast<double>(settings_.prefetch_count),
+                 static_cast<double>(settings_.max_prefetch_count)));
+  if (target == prefetch_count_) return;
+
+  channel_.SetQos(target, true, engine::Deadline::FromDuration(kStartTimeout));
+  LOG_DEBUG() << "Prefetch for '" << queue_name_ << "' queue is tuned from "
+              << prefetch_count_ << " to " << target;
+  prefetch_count_ = target;
+  stats_.prefetch_count = target;
+}
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <atomic>
+#include <map>
 
 #include <userver/concurrent/background_task_storage.hpp>
+#include <userver/engine/mutex.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 
 #include <urabbitmq/connection_ptr.hpp>
@@ -19,10 +21,15 @@ namespace impl {
 class AmqpChannel;
 }
 
+namespace statistics {
+struct ConsumerStatistics;
+}
+
 class ConsumerBaseImpl final {
  public:
   ConsumerBaseImpl(ConnectionPtr&& connection,
-                   const ConsumerSettings& settings);
+                   const ConsumerSettings& settings,
+                   statistics::ConsumerStatistics& stats);
   ~ConsumerBaseImpl();
 
   using DispatchCallback = std::function<void(ConsumedMessage)>;
@@ -35,9 +42,33 @@ class ConsumerBaseImpl final {
   void OnMessage(const AMQP::Message& message, uint64_t delivery_tag);
   void Stop();
 
+  // Batched acks: the acks are sent with `multiple` flag for the longest
+  // prefix of delivery tags that are all processed
+  void Settle(uint64_t delivery_tag, bool success);
+  void FlushAcks();
+  void RunMaintenance();
+  void TunePrefetch(std::chrono::milliseconds interval);
+
   engine::TaskProcessor& dispatcher_;
   const std::string queue_name_;
+  const ConsumerSettings settings_;
   uint16_t prefetch_count_;
+  statistics::ConsumerStatistics& stats_;
+
+  struct AckState final {
+    // all the messages up to this tag are processed
+    uint64_t settled_up_to{0};
+    // processed messages after a gap, with the processing results
+    std::map<uint64_t, bool> settled_out_of_order;
+    // successfully processed messages not acked yet
+    std::size_t ackable{0};
+  };
+  engine::Mutex ack_mutex_;
+  AckState ack_state_;
+
+  // accounted since the last prefetch tuning
+  std::atomic<uint64_t> processed_count_{0};
+  std::atomic<uint64_t> processing_time_us_{0};
 
   ConnectionPtr connection_ptr_;
   impl::AmqpChannel& channel_;
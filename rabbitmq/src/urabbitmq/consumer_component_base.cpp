@@ -4,6 +4,7 @@
 
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 #include <userver/urabbitmq/component.hpp>
@@ -18,8 +19,16 @@ ConsumerSettings Parse(const yaml_config::YamlConfig& config,
   ConsumerSettings settings;
   settings.queue = Queue{config["queue"].As<std::string>()};
   settings.prefetch_count = config["prefetch_count"].As<uint16_t>();
+  settings.max_prefetch_count = config["max_prefetch_count"].As<uint16_t>(
+      settings.max_prefetch_count);
+  settings.ack_batch_size =
+      config["ack_batch_size"].As<uint16_t>(settings.ack_batch_size);
+  settings.ack_batch_interval =
+      config["ack_batch_interval"].As<std::chrono::milliseconds>(
+          settings.ack_batch_interval);
 
   UINVARIANT(settings.prefetch_count > 0, "prefetch_count is set to zero");
+  UINVARIANT(settings.ack_batch_size > 0, "ack_batch_size is set to zero");
 
   return settings;
 }
@@ -60,9 +69,20 @@ ConsumerComponentBase::ConsumerComponentBase(
               .FindComponent<components::RabbitMQ>(
                   config["rabbit_name"].As<std::string>())
               .GetClient(),
-          config.As<ConsumerSettings>())} {}
+          config.As<ConsumerSettings>())} {
+  auto& statistics_storage =
+      context.FindComponent<components::StatisticsStorage>();
+  statistics_holder_ = statistics_storage.GetStorage().RegisterWriter(
+      "rabbitmq.consumer",
+      [this](utils::statistics::Writer& writer) {
+        impl_->WriteStatistics(writer);
+      },
+      {{"rabbitmq_consumer", config.Name()}});
+}
 
-ConsumerComponentBase::~ConsumerComponentBase() = default;
+ConsumerComponentBase::~ConsumerComponentBase() {
+  statistics_holder_.Unregister();
+}
 
 void ConsumerComponentBase::OnAllComponentsLoaded() { impl_->Start(this); }
 
@@ -83,6 +103,18 @@ properties:
     prefetch_count:
         type: integer
         description: prefetch_count for the consumer
+    max_prefetch_count:
+        type: integer
+        description: if greater than prefetch_count, prefetch is tuned between them from the processing latency and throughput
+        defaultDescription: 0
+    ack_batch_size:
+        type: integer
+        description: acks of that many processed messages are sent at once
+        defaultDescription: 1
+    ack_batch_interval:
+        type: string
+        description: pending acks are sent at least that often
+        defaultDescription: 100ms
 )");
 }
 
@@ -1,5 +1,6 @@
 #include "amqp_channel.hpp"
 
+#include <atomic>
 #include <optional>
 
 #include <userver/engine/task/task.hpp>
@@ -187,6 +188,13 @@ void AmqpChannel::Ack(uint64_t delivery_tag, engine::Deadline deadline) {
   channel->ack(delivery_tag);
 }
 
+void AmqpChannel::AckMultiple(uint64_t delivery_tag,
+                              engine::Deadline deadline) {
+  // No way to acknowledge success, no way to handle synchronous errors
+  auto channel = conn_.GetChannel(deadline);
+  channel->ack(delivery_tag, AMQP::multiple);
+}
+
 void AmqpChannel::Reject(uint64_t delivery_tag, bool requeue,
                          engine::Deadline deadline) {
   // No way to acknowledge success, no way to handle synchronous errors
@@ -194,12 +202,13 @@ void AmqpChannel::Reject(uint64_t delivery_tag, bool requeue,
   channel->reject(delivery_tag, requeue ? AMQP::requeue : 0);
 }
 
-void AmqpChannel::SetQos(uint16_t prefetch_count, engine::Deadline deadline) {
+void AmqpChannel::SetQos(uint16_t prefetch_count, bool global,
+                         engine::Deadline deadline) {
   auto deferred = DeferredWrapper::Create();
 
   {
     auto channel = conn_.GetChannel(deadline);
-    deferred->Wrap(channel->setQos(prefetch_count));
+    deferred->Wrap(channel->setQos(prefetch_count, global));
   }
 
   deferred->Wait(deadline);
@@ -261,6 +270,43 @@ ResponseAwaiter AmqpReliableChannel::Publish(const Exchange& exchange,
   return awaiter;
 }
 
+ResponseAwaiter AmqpReliableChannel::PublishBatch(
+    const Exchange& exchange, const std::string& routing_key,
+    const std::vector<std::string>& messages, MessageType type,
+    engine::Deadline deadline) {
+  // The whole batch takes a single in-flight request slot: the messages are
+  // published back to back and the confirms are matched by delivery tags
+  auto awaiter = conn_.GetAwaiter(deadline);
+  if (messages.empty()) {
+    awaiter.GetWrapper()->Ok();
+    return awaiter;
+  }
+
+  const auto headers = CreateHeaders();
+  auto pending = std::make_shared<std::atomic<std::size_t>>(messages.size());
+
+  {
+    auto reliable = conn_.GetReliableChannel(deadline);
+
+    for (const auto& message : messages) {
+      AMQP::Envelope envelope{message.data(), message.size()};
+      envelope.setPersistent(type == MessageType::kPersistent);
+      envelope.setHeaders(headers);
+
+      reliable->publish(exchange.GetUnderlying(), routing_key, envelope)
+          .onAck([this, pending, deferred = awaiter.GetWrapper()] {
+            AccountMessagePublished();
+            if (--*pending == 0) deferred->Ok();
+          })
+          .onError([deferred = awaiter.GetWrapper()](const char* error) {
+            deferred->Fail(error);
+          });
+    }
+  }
+
+  return awaiter;
+}
+
 void AmqpReliableChannel::AccountMessagePublished() {
   conn_.GetStatistics().AccountMessagePublished();
 }
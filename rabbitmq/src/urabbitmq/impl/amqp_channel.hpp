@@ -2,6 +2,8 @@
 
 #include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/utils/assert.hpp>
@@ -59,9 +61,14 @@ class AmqpChannel final {
 
   void Ack(uint64_t delivery_tag, engine::Deadline deadline);
 
+  // Acknowledges all the messages up to delivery_tag
+  void AckMultiple(uint64_t delivery_tag, engine::Deadline deadline);
+
   void Reject(uint64_t delivery_tag, bool requeue, engine::Deadline deadline);
 
-  void SetQos(uint16_t prefetch_count, engine::Deadline deadline);
+  // Global QoS limits the whole channel and may be changed for the running
+  // consumers, the per-consumer one applies to the consumers set up later
+  void SetQos(uint16_t prefetch_count, bool global, engine::Deadline deadline);
 
   using ErrorCb = std::function<void(const char*)>;
   using SuccessCb = std::function<void(const std::string&)>;
@@ -90,6 +97,11 @@ class AmqpReliableChannel final {
                           const std::string& message, MessageType type,
                           engine::Deadline deadline);
 
+  ResponseAwaiter PublishBatch(const Exchange& exchange,
+                               const std::string& routing_key,
+                               const std::vector<std::string>& messages,
+                               MessageType type, engine::Deadline deadline);
+
  private:
   void AccountMessagePublished();
 
@@ -0,0 +1,27 @@
+#include "consumer_statistics.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace urabbitmq::statistics {
+
+namespace {
+
+constexpr double kProcessingTimingsBounds[] = {
+    1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000};
+
+}  // namespace
+
+ConsumerStatistics::ConsumerStatistics()
+    : processing_timings(kProcessingTimingsBounds) {}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ConsumerStatistics& stats) {
+  writer["processed"] = stats.processed;
+  writer["failed"] = stats.failed;
+  writer["processing-timings"] = stats.processing_timings;
+  writer["prefetch-count"] = std::uint64_t{stats.prefetch_count.load()};
+}
+
+}  // namespace urabbitmq::statistics
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include <userver/utils/statistics/histogram.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace urabbitmq::statistics {
+
+struct ConsumerStatistics final {
+  ConsumerStatistics();
+
+  utils::statistics::RateCounter processed;
+  utils::statistics::RateCounter failed;
+  // processing time of the messages, in milliseconds
+  utils::statistics::Histogram processing_timings;
+  std::atomic<std::uint16_t> prefetch_count{0};
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ConsumerStatistics& stats);
+
+}  // namespace urabbitmq::statistics
+
+USERVER_NAMESPACE_END
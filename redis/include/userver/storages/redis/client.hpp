@@ -247,9 +247,13 @@ class Client {
   virtual RequestLtrim Ltrim(std::string key, int64_t start, int64_t stop,
                              const CommandControl& command_control) = 0;
 
+  /// Keys of different shards (hash slots in cluster mode) are requested in
+  /// parallel, the values are returned in the order of the keys
   virtual RequestMget Mget(std::vector<std::string> keys,
                            const CommandControl& command_control) = 0;
 
+  /// Keys of different shards (hash slots in cluster mode) are set by
+  /// separate commands, so the whole update is not atomic
   virtual RequestMset Mset(
       std::vector<std::pair<std::string, std::string>> key_values,
       const CommandControl& command_control) = 0;
@@ -480,6 +484,16 @@ class Client {
 
   RequestScan Scan(size_t shard, const CommandControl& command_control);
 
+  /// @brief Scans the keys of all the shards.
+  ///
+  /// Up to `max_parallel_shards` shards are scanned concurrently: their
+  /// first pages are requested right away and every shard requests its next
+  /// page as soon as the previous one arrives. The keys are returned shard
+  /// by shard in the order of the shards. The client must outlive the
+  /// request.
+  RequestScan ScanAllShards(ScanOptions options, size_t max_parallel_shards,
+                            const CommandControl& command_control);
+
   RequestHscan Hscan(std::string key, const CommandControl& command_control);
 
   RequestSscan Sscan(std::string key, const CommandControl& command_control);
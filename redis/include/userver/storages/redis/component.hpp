@@ -29,6 +29,8 @@ namespace storages {}
 /// Redis client
 namespace storages::redis {
 class Client;
+class HotKeys;
+class NearCache;
 class SubscribeClient;
 class SubscribeClientImpl;
 }  // namespace storages::redis
@@ -64,6 +66,11 @@ namespace components {
 /// groups.[].db | name to refer to the cluster in components::Redis::GetClient() | -
 /// groups.[].sharding_strategy | one of RedisCluster, KeyShardCrc32, KeyShardTaximeterCrc32 or KeyShardGpsStorageDriver | "KeyShardTaximeterCrc32"
 /// groups.[].allow_reads_from_master | allows read requests from master instance | false
+/// groups.[].near_cache_max_size | maximum number of GET replies cached on the client side, 0 disables the cache | 0
+/// groups.[].near_cache_ttl | maximum time a cached GET reply is served without asking the server | 1s
+/// groups.[].hot_keys_sample_rate | one of that many single-key reads is sampled to detect hot keys, 0 disables the detection | 0
+/// groups.[].hot_keys_threshold | number of recently sampled reads that makes a key hot; reads of hot keys also go to the master | 100
+/// groups.[].hot_keys_allow_stale_reads | allows the reads of hot keys forced to master to go to replicas | false
 /// subscribe_groups | array of redis clusters to work with in subscribe mode | -
 /// subscribe_groups.[].config_name | key name in secdist with options for this cluster | -
 /// subscribe_groups.[].db | name to refer to the cluster in components::Redis::GetSubscribeClient() | -
@@ -163,6 +170,10 @@ class Redis : public ComponentBase {
   std::unordered_map<std::string,
                      std::shared_ptr<storages::redis::SubscribeClientImpl>>
       subscribe_clients_;
+  std::unordered_map<std::string, std::shared_ptr<storages::redis::NearCache>>
+      near_caches_;
+  std::unordered_map<std::string, std::shared_ptr<storages::redis::HotKeys>>
+      hot_keys_;
 
   dynamic_config::Source config_;
   concurrent::AsyncEventSubscriberScope config_subscription_;
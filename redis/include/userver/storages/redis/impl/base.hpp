@@ -113,11 +113,15 @@ struct CommandsBufferingSettings {
   bool buffering_enabled{false};
   size_t commands_buffering_threshold{0};
   std::chrono::microseconds watch_command_timer_interval{0};
+  /// Buffered commands are sent without waiting for the timer once their
+  /// arguments take that many bytes, 0 means no limit
+  size_t commands_buffering_max_bytes{0};
 
   constexpr bool operator==(const CommandsBufferingSettings& o) const {
     return buffering_enabled == o.buffering_enabled &&
            commands_buffering_threshold == o.commands_buffering_threshold &&
-           watch_command_timer_interval == o.watch_command_timer_interval;
+           watch_command_timer_interval == o.watch_command_timer_interval &&
+           commands_buffering_max_bytes == o.commands_buffering_max_bytes;
   }
 };
 
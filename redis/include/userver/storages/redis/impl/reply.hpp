@@ -243,6 +243,8 @@ class Reply final {
   Reply(std::string cmd, redisReply* redis_reply, ReplyStatus status,
         std::string status_string);
   Reply(std::string cmd, ReplyData&& data);
+  Reply(std::string cmd, ReplyData&& data, ReplyStatus status,
+        std::string status_string);
 
   std::string server;
   ServerId server_id;
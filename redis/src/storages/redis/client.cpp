@@ -1,11 +1,82 @@
 #include <userver/storages/redis/client.hpp>
 
+#include <deque>
+#include <optional>
+
 #include <storages/redis/impl/sentinel.hpp>
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::redis {
 
+namespace {
+
+class RequestScanAllShardsData final
+    : public RequestScanDataBase<ScanTag::kScan> {
+ public:
+  RequestScanAllShardsData(Client& client, ScanOptions options,
+                           size_t max_parallel_shards,
+                           const CommandControl& command_control)
+      : client_(client),
+        options_(std::move(options)),
+        command_control_(command_control),
+        shards_count_(client_.ShardsCount()) {
+    UINVARIANT(max_parallel_shards > 0, "max_parallel_shards must be positive");
+    while (next_shard_ < shards_count_ && scans_.size() < max_parallel_shards) {
+      StartNextShard();
+    }
+  }
+
+  ReplyElem Get() override {
+    auto& it = GetIterator();
+    auto result = std::move(*it);
+    ++it;
+    return result;
+  }
+
+  ReplyElem& Current() override { return *GetIterator(); }
+
+  bool Eof() override {
+    while (!scans_.empty()) {
+      if (!current_) {
+        scans_.front().SetRequestDescription(request_description_);
+        current_ = scans_.front().begin();
+      }
+      if (*current_ != scans_.front().end()) return false;
+
+      // the shard is done, the window moves to the next one
+      current_.reset();
+      scans_.pop_front();
+      if (next_shard_ < shards_count_) StartNextShard();
+    }
+    return true;
+  }
+
+ private:
+  void StartNextShard() {
+    scans_.push_back(client_.Scan(next_shard_++, options_, command_control_));
+  }
+
+  RequestScan::Iterator& GetIterator() {
+    if (Eof()) {
+      throw RequestScan::GetAfterEofException("Trying to read after eof");
+    }
+    return *current_;
+  }
+
+  Client& client_;
+  const ScanOptions options_;
+  const CommandControl command_control_;
+  const size_t shards_count_;
+  size_t next_shard_{0};
+  // ScanRequest is neither copied nor moved while iterated
+  std::deque<RequestScan> scans_;
+  std::optional<RequestScan::Iterator> current_;
+};
+
+}  // namespace
+
 std::string CreateTmpKey(const std::string& key, std::string prefix) {
   return USERVER_NAMESPACE::redis::Sentinel::CreateTmpKey(key,
                                                           std::move(prefix));
@@ -44,6 +115,13 @@ ScanRequest<ScanTag::kScan> Client::Scan(
   return Scan(shard, {}, command_control);
 }
 
+RequestScan Client::ScanAllShards(ScanOptions options,
+                                  size_t max_parallel_shards,
+                                  const CommandControl& command_control) {
+  return RequestScan(std::make_unique<RequestScanAllShardsData>(
+      *this, std::move(options), max_parallel_shards, command_control));
+}
+
 ScanRequest<ScanTag::kHscan> Client::Hscan(
     std::string key, const CommandControl& command_control) {
   return Hscan(std::move(key), {}, command_control);
@@ -103,14 +103,39 @@ UTEST_F(RedisClusterClientTest, DISABLED_MgetCrossSlot) {
   }
 
   {
-    auto req = client->Mget({MakeKey(idx[0]), MakeKey(idx[1])}, kDefaultCc);
-    UASSERT_THROW(req.Get(), redis::ParseReplyException);
+    auto req = client->Mget({MakeKey(idx[1]), "missing", MakeKey(idx[0])},
+                            kDefaultCc);
+    auto reply = req.Get();
+    ASSERT_EQ(reply.size(), 3);
+    EXPECT_EQ(reply[0], std::to_string(add + idx[1]));
+    EXPECT_FALSE(reply[1]);
+    EXPECT_EQ(reply[2], std::to_string(add + idx[0]));
   }
 
-  for (unsigned long i : idx) {
-    auto req = client->Del(MakeKey(i), kDefaultCc);
-    EXPECT_EQ(req.Get(), 1);
+  const std::vector<std::string> keys{MakeKey(idx[0]), MakeKey(idx[1])};
+  EXPECT_EQ(client->Exists(keys, kDefaultCc).Get(), 2);
+  EXPECT_EQ(client->Del(keys, kDefaultCc).Get(), 2);
+}
+
+UTEST_F(RedisClusterClientTest, DISABLED_MsetCrossSlot) {
+  auto client = GetClient();
+
+  const size_t kNumKeys = 10;
+  std::vector<std::pair<std::string, std::string>> key_values;
+  std::vector<std::string> keys;
+  for (size_t i = 0; i < kNumKeys; ++i) {
+    key_values.emplace_back(MakeKey(i), std::to_string(i));
+    keys.push_back(MakeKey(i));
   }
+  UASSERT_NO_THROW(client->Mset(key_values, kDefaultCc).Get());
+
+  auto reply = client->Mget(keys, kDefaultCc).Get();
+  ASSERT_EQ(reply.size(), kNumKeys);
+  for (size_t i = 0; i < kNumKeys; ++i) {
+    EXPECT_EQ(reply[i], std::to_string(i));
+  }
+
+  EXPECT_EQ(client->Del(std::move(keys), kDefaultCc).Get(), kNumKeys);
 }
 
 UTEST_F(RedisClusterClientTest, DISABLED_Transaction) {
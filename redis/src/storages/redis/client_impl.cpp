@@ -1,10 +1,15 @@
 #include "client_impl.hpp"
 
+#include <unordered_map>
+
+#include <userver/storages/redis/impl/keyshard.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/trivial_map.hpp>
 
 #include <storages/redis/impl/sentinel.hpp>
 
 #include "impl/command_control_impl.hpp"
+#include "request_data_impl.hpp"
 #include "request_impl.hpp"
 #include "transaction_impl.hpp"
 
@@ -27,6 +32,51 @@ const std::string kScanCommandName<ScanTag::kHscan> = "hscan";
 template <>
 const std::string kScanCommandName<ScanTag::kZscan> = "zscan";
 
+// Reads of a single key passed as the first argument
+constexpr utils::TrivialSet kKeyReadCommands = [](auto selector) {
+  return selector()
+      .Case("exists")
+      .Case("get")
+      .Case("getrange")
+      .Case("hexists")
+      .Case("hget")
+      .Case("hgetall")
+      .Case("hkeys")
+      .Case("hlen")
+      .Case("hmget")
+      .Case("hvals")
+      .Case("lindex")
+      .Case("llen")
+      .Case("lrange")
+      .Case("scard")
+      .Case("sismember")
+      .Case("smembers")
+      .Case("srandmember")
+      .Case("strlen")
+      .Case("ttl")
+      .Case("type")
+      .Case("zcard")
+      .Case("zcount")
+      .Case("zrange")
+      .Case("zrangebyscore")
+      .Case("zscore");
+};
+
+const std::string* GetReadKey(const USERVER_NAMESPACE::redis::CmdArgs& args) {
+  if (args.args.size() != 1) return nullptr;
+  const auto& command = args.args.front();
+  if (command.size() < 2 || !kKeyReadCommands.Contains(command.front())) {
+    return nullptr;
+  }
+  return &command[1];
+}
+
+const std::string& GetKey(const std::string& key) { return key; }
+
+const std::string& GetKey(const std::pair<std::string, std::string>& kv) {
+  return kv.first;
+}
+
 void DoCheckShard(size_t shard, std::optional<size_t> force_shard_idx) {
   if (force_shard_idx && *force_shard_idx != shard)
     throw USERVER_NAMESPACE::redis::InvalidArgumentException(
@@ -39,8 +89,12 @@ void DoCheckShard(size_t shard, std::optional<size_t> force_shard_idx) {
 
 ClientImpl::ClientImpl(
     std::shared_ptr<USERVER_NAMESPACE::redis::Sentinel> sentinel,
-    std::optional<size_t> force_shard_idx)
-    : redis_client_(std::move(sentinel)), force_shard_idx_(force_shard_idx) {}
+    std::optional<size_t> force_shard_idx,
+    std::shared_ptr<NearCache> near_cache, std::shared_ptr<HotKeys> hot_keys)
+    : redis_client_(std::move(sentinel)),
+      force_shard_idx_(force_shard_idx),
+      near_cache_(std::move(near_cache)),
+      hot_keys_(std::move(hot_keys)) {}
 
 void ClientImpl::WaitConnectedOnce(
     USERVER_NAMESPACE::redis::RedisWaitConnected wait_connected) {
@@ -61,13 +115,16 @@ const std::string& ClientImpl::GetAnyKeyForShard(size_t shard_idx) const {
 }
 
 std::shared_ptr<Client> ClientImpl::GetClientForShard(size_t shard_idx) {
-  return std::make_shared<ClientImpl>(redis_client_, shard_idx);
+  return std::make_shared<ClientImpl>(redis_client_, shard_idx, near_cache_,
+                                      hot_keys_);
 }
 
 std::optional<size_t> ClientImpl::GetForcedShardIdx() const {
   return force_shard_idx_;
 }
 
+const NearCache* ClientImpl::GetNearCache() const { return near_cache_.get(); }
+
 Request<ScanReplyTmpl<ScanTag::kScan>> ClientImpl::MakeScanRequestNoKey(
     size_t shard, ScanReply::Cursor cursor, ScanOptions options,
     const CommandControl& command_control) {
@@ -94,6 +151,7 @@ Request<ScanReplyTmpl<scan_tag>> ClientImpl::MakeScanRequestWithKey(
 RequestAppend ClientImpl::Append(std::string key, std::string value,
                                  const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
+  InvalidateNearCache(key, shard);
   return CreateRequest<RequestAppend>(
       MakeRequest(CmdArgs{"append", std::move(key), std::move(value)}, shard,
                   true, GetCommandControl(command_control)));
@@ -121,6 +179,7 @@ RequestDbsize ClientImpl::Dbsize(size_t shard,
 RequestDel ClientImpl::Del(std::string key,
                            const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
+  InvalidateNearCache(key, shard);
   return CreateRequest<RequestDel>(
       MakeRequest(CmdArgs{"del", std::move(key)}, shard, true,
                   GetCommandControl(command_control)));
@@ -130,15 +189,14 @@ RequestDel ClientImpl::Del(std::vector<std::string> keys,
                            const CommandControl& command_control) {
   if (keys.empty())
     return CreateDummyRequest<RequestDel>(std::make_shared<Reply>("del", 0));
-  auto shard = ShardByKey(keys.at(0), command_control);
-  return CreateRequest<RequestDel>(
-      MakeRequest(CmdArgs{"del", std::move(keys)}, shard, true,
-                  GetCommandControl(command_control)));
+  return MakeSplitRequest<RequestDel>("del", std::move(keys), true,
+                                      command_control);
 }
 
 RequestUnlink ClientImpl::Unlink(std::string key,
                                  const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
+  InvalidateNearCache(key, shard);
   return CreateRequest<RequestUnlink>(
       MakeRequest(CmdArgs{"unlink", std::move(key)}, shard, true,
                   GetCommandControl(command_control)));
@@ -149,10 +207,8 @@ RequestUnlink ClientImpl::Unlink(std::vector<std::string> keys,
   if (keys.empty())
     return CreateDummyRequest<RequestUnlink>(
         std::make_shared<Reply>("unlink", 0));
-  auto shard = ShardByKey(keys.at(0), command_control);
-  return CreateRequest<RequestUnlink>(
-      MakeRequest(CmdArgs{"unlink", std::move(keys)}, shard, true,
-                  GetCommandControl(command_control)));
+  return MakeSplitRequest<RequestUnlink>("unlink", std::move(keys), true,
+                                         command_control);
 }
 
 RequestEvalCommon ClientImpl::EvalCommon(
@@ -160,6 +216,7 @@ RequestEvalCommon ClientImpl::EvalCommon(
     std::vector<std::string> args, const CommandControl& command_control) {
   UASSERT(!keys.empty());
   auto shard = ShardByKey(keys.at(0), command_control);
+  InvalidateNearCache(keys, shard);
   size_t keys_size = keys.size();
   return CreateRequest<RequestEvalCommon>(
       MakeRequest(CmdArgs{"eval", std::move(script), keys_size, std::move(keys),
@@ -172,6 +229,7 @@ RequestEvalShaCommon ClientImpl::EvalShaCommon(
     std::vector<std::string> args, const CommandControl& command_control) {
   UASSERT(!keys.empty());
   auto shard = ShardByKey(keys.at(0), command_control);
+  InvalidateNearCache(keys, shard);
   size_t keys_size = keys.size();
   return CreateRequest<RequestEvalShaCommon>(
       MakeRequest(CmdArgs{"evalsha", std::move(script_hash), keys_size,
@@ -199,15 +257,14 @@ RequestExists ClientImpl::Exists(std::vector<std::string> keys,
   if (keys.empty())
     return CreateDummyRequest<RequestExists>(
         std::make_shared<Reply>("exists", 0));
-  auto shard = ShardByKey(keys.at(0), command_control);
-  return CreateRequest<RequestExists>(
-      MakeRequest(CmdArgs{"exists", std::move(keys)}, shard, false,
-                  GetCommandControl(command_control)));
+  return MakeSplitRequest<RequestExists>("exists", std::move(keys), false,
+                                         command_control);
 }
 
 RequestExpire ClientImpl::Expire(std::string key, std::chrono::seconds ttl,
                                  const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
+  InvalidateNearCache(key, shard);
   return CreateRequest<RequestExpire>(
       MakeRequest(CmdArgs{"expire", std::move(key), ttl.count()}, shard, true,
                   GetCommandControl(command_control)));
@@ -290,14 +347,31 @@ RequestGeosearch ClientImpl::Geosearch(
 RequestGet ClientImpl::Get(std::string key,
                            const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
-  return CreateRequest<RequestGet>(
-      MakeRequest(CmdArgs{"get", std::move(key)}, shard, false,
+  if (!near_cache_) {
+    return CreateRequest<RequestGet>(
+        MakeRequest(CmdArgs{"get", std::move(key)}, shard, false,
+                    GetCommandControl(command_control)));
+  }
+
+  if (auto value = near_cache_->Get(key, shard)) {
+    return CreateDummyRequest<RequestGet>(
+        std::make_shared<USERVER_NAMESPACE::redis::Reply>(
+            "get", *value ? USERVER_NAMESPACE::redis::ReplyData(**value)
+                          : USERVER_NAMESPACE::redis::ReplyData::CreateNil()));
+  }
+  const auto ticket = near_cache_->GetTicket(key);
+  auto request = std::make_unique<
+      RequestDataImpl<std::optional<std::string>, std::optional<std::string>>>(
+      MakeRequest(CmdArgs{"get", key}, shard, false,
                   GetCommandControl(command_control)));
+  return RequestGet(std::make_unique<NearCacheGetRequestData>(
+      std::move(request), near_cache_, std::move(key), ticket));
 }
 
 RequestGetset ClientImpl::Getset(std::string key, std::string value,
                                  const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
+  InvalidateNearCache(key, shard);
   return CreateRequest<RequestGetset>(
       MakeRequest(CmdArgs{"getset", std::move(key), std::move(value)}, shard,
                   true, GetCommandControl(command_control)));
@@ -439,6 +513,7 @@ RequestHvals ClientImpl::Hvals(std::string key,
 RequestIncr ClientImpl::Incr(std::string key,
                              const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
+  InvalidateNearCache(key, shard);
   return CreateRequest<RequestIncr>(
       MakeRequest(CmdArgs{"incr", std::move(key)}, shard, true,
                   GetCommandControl(command_control)));
@@ -531,21 +606,9 @@ RequestMget ClientImpl::Mget(std::vector<std::string> keys,
   if (keys.empty())
     return CreateDummyRequest<RequestMget>(
         std::make_shared<Reply>("mget", ReplyData::Array{}));
-  const auto shard = ShardByKey(keys.at(0), command_control);
-  auto max_chunk_size = CommandControlImpl{command_control}.chunk_size;
-  if (max_chunk_size == 0) {
-    max_chunk_size = keys.size();
-  }
-  auto make_request = [this, shard,
-                       cc = GetCommandControl(command_control)](auto keys) {
-    return MakeRequest(CmdArgs{"mget", std::move(keys)}, shard, false, cc);
-  };
-  if (max_chunk_size >= keys.size()) {
-    return CreateRequest<RequestMget>(make_request(std::move(keys)));
-  }
-  return CreateAggregateRequest<RequestMget>(MakeRequestChunks(
-      max_chunk_size, std::move(keys),
-      [&make_request](auto keys) { return make_request(std::move(keys)); }));
+  return MakeSplitRequest<RequestMget>(
+      "mget", std::move(keys), false, command_control,
+      CommandControlImpl{command_control}.chunk_size);
 }
 
 RequestMset ClientImpl::Mset(
@@ -555,10 +618,8 @@ RequestMset ClientImpl::Mset(
     return CreateDummyRequest<RequestMset>(
         std::make_shared<USERVER_NAMESPACE::redis::Reply>(
             "mset", USERVER_NAMESPACE::redis::ReplyData::CreateStatus("OK")));
-  auto shard = ShardByKey(key_values.at(0).first, command_control);
-  return CreateRequest<RequestMset>(
-      MakeRequest(CmdArgs{"mset", std::move(key_values)}, shard, true,
-                  GetCommandControl(command_control)));
+  return MakeSplitRequest<RequestMset>("mset", std::move(key_values), true,
+                                       command_control);
 }
 
 TransactionPtr ClientImpl::Multi() {
@@ -581,6 +642,7 @@ RequestPexpire ClientImpl::Pexpire(std::string key,
                                    std::chrono::milliseconds ttl,
                                    const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
+  InvalidateNearCache(key, shard);
   return CreateRequest<RequestPexpire>(
       MakeRequest(CmdArgs{"pexpire", std::move(key), ttl.count()}, shard, true,
                   GetCommandControl(command_control)));
@@ -631,6 +693,8 @@ RequestRename ClientImpl::Rename(std::string key, std::string new_key,
     throw USERVER_NAMESPACE::redis::InvalidArgumentException(
         "shard of key != shard of new_key (" + std::to_string(shard) +
         " != " + std::to_string(new_shard) + ')');
+  InvalidateNearCache(key, shard);
+  InvalidateNearCache(new_key, shard);
   return CreateRequest<RequestRename>(
       MakeRequest(CmdArgs{"rename", std::move(key), std::move(new_key)}, shard,
                   true, GetCommandControl(command_control)));
@@ -717,6 +781,7 @@ RequestScard ClientImpl::Scard(std::string key,
 RequestSet ClientImpl::Set(std::string key, std::string value,
                            const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
+  InvalidateNearCache(key, shard);
   return CreateRequest<RequestSet>(
       MakeRequest(CmdArgs{"set", std::move(key), std::move(value)}, shard, true,
                   GetCommandControl(command_control)));
@@ -726,6 +791,7 @@ RequestSet ClientImpl::Set(std::string key, std::string value,
                            std::chrono::milliseconds ttl,
                            const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
+  InvalidateNearCache(key, shard);
   return CreateRequest<RequestSet>(MakeRequest(
       CmdArgs{"set", std::move(key), std::move(value), "PX", ttl.count()},
       shard, true, GetCommandControl(command_control)));
@@ -734,6 +800,7 @@ RequestSet ClientImpl::Set(std::string key, std::string value,
 RequestSetIfExist ClientImpl::SetIfExist(
     std::string key, std::string value, const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
+  InvalidateNearCache(key, shard);
   return CreateRequest<RequestSetIfExist>(
       MakeRequest(CmdArgs{"set", std::move(key), std::move(value), "XX"}, shard,
                   true, GetCommandControl(command_control)));
@@ -743,6 +810,7 @@ RequestSetIfExist ClientImpl::SetIfExist(
     std::string key, std::string value, std::chrono::milliseconds ttl,
     const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
+  InvalidateNearCache(key, shard);
   return CreateRequest<RequestSetIfExist>(MakeRequest(
       CmdArgs{"set", std::move(key), std::move(value), "PX", ttl.count(), "XX"},
       shard, true, GetCommandControl(command_control)));
@@ -751,6 +819,7 @@ RequestSetIfExist ClientImpl::SetIfExist(
 RequestSetIfNotExist ClientImpl::SetIfNotExist(
     std::string key, std::string value, const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
+  InvalidateNearCache(key, shard);
   return CreateRequest<RequestSetIfExist>(
       MakeRequest(CmdArgs{"set", std::move(key), std::move(value), "NX"}, shard,
                   true, GetCommandControl(command_control)));
@@ -760,6 +829,7 @@ RequestSetIfNotExist ClientImpl::SetIfNotExist(
     std::string key, std::string value, std::chrono::milliseconds ttl,
     const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
+  InvalidateNearCache(key, shard);
   return CreateRequest<RequestSetIfExist>(MakeRequest(
       CmdArgs{"set", std::move(key), std::move(value), "PX", ttl.count(), "NX"},
       shard, true, GetCommandControl(command_control)));
@@ -769,6 +839,7 @@ RequestSetex ClientImpl::Setex(std::string key, std::chrono::seconds seconds,
                                std::string value,
                                const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
+  InvalidateNearCache(key, shard);
   return CreateRequest<RequestSetex>(MakeRequest(
       CmdArgs{"setex", std::move(key), seconds.count(), std::move(value)},
       shard, true, GetCommandControl(command_control)));
@@ -1106,6 +1177,14 @@ RequestZscore ClientImpl::Zscore(std::string key, std::string member,
 USERVER_NAMESPACE::redis::Request ClientImpl::MakeRequest(
     CmdArgs&& args, size_t shard, bool master,
     const CommandControl& command_control, size_t replies_to_skip) {
+  if (hot_keys_ && !master) {
+    const auto* key = GetReadKey(args);
+    if (key && hot_keys_->AccountRead(*key, shard)) {
+      return redis_client_->MakeRequest(
+          std::move(args), shard, master,
+          hot_keys_->AdjustCommandControl(command_control), replies_to_skip);
+    }
+  }
   return redis_client_->MakeRequest(std::move(args), shard, master,
                                     command_control, replies_to_skip);
 }
@@ -1150,6 +1229,83 @@ void ClientImpl::CheckShard(size_t shard, const CommandControl& cc) const {
   DoCheckShard(shard, cc.force_shard_idx);
 }
 
+template <typename T>
+std::vector<ClientImpl::KeysGroup> ClientImpl::GroupKeys(
+    const std::vector<T>& args, const CommandControl& cc,
+    size_t max_chunk_size) const {
+  if (max_chunk_size == 0) max_chunk_size = args.size();
+  const bool is_shard_forced = force_shard_idx_ || cc.force_shard_idx;
+  const bool is_cluster_mode = redis_client_->IsInClusterMode();
+
+  std::vector<KeysGroup> groups;
+  // the last group of every shard or hash slot
+  std::unordered_map<size_t, size_t> last_groups;
+  for (size_t i = 0; i < args.size(); ++i) {
+    const auto& key = GetKey(args[i]);
+    size_t group_id = 0;
+    if (!is_shard_forced) {
+      group_id = is_cluster_mode ? USERVER_NAMESPACE::redis::HashSlot(key)
+                                 : ShardByKey(key);
+    }
+    auto [it, inserted] = last_groups.try_emplace(group_id, groups.size());
+    if (inserted || groups[it->second].positions.size() >= max_chunk_size) {
+      it->second = groups.size();
+      groups.push_back({ShardByKey(key, cc), {}});
+    }
+    groups[it->second].positions.push_back(i);
+  }
+  return groups;
+}
+
+template <typename Request, typename T>
+Request ClientImpl::MakeSplitRequest(std::string command,
+                                     std::vector<T>&& args, bool master,
+                                     const CommandControl& command_control,
+                                     size_t max_chunk_size) {
+  auto groups = GroupKeys(args, command_control, max_chunk_size);
+  // only the writes are sent to masters
+  if (master) {
+    for (const auto& group : groups) {
+      for (auto position : group.positions) {
+        InvalidateNearCache(GetKey(args[position]), group.shard);
+      }
+    }
+  }
+
+  const auto cc = GetCommandControl(command_control);
+  if (groups.size() == 1) {
+    return CreateRequest<Request>(
+        MakeRequest(CmdArgs{std::move(command), std::move(args)},
+                    groups.front().shard, master, cc));
+  }
+
+  std::vector<USERVER_NAMESPACE::redis::Request> requests;
+  std::vector<std::vector<size_t>> positions;
+  requests.reserve(groups.size());
+  positions.reserve(groups.size());
+  for (auto& group : groups) {
+    std::vector<T> group_args;
+    group_args.reserve(group.positions.size());
+    for (auto position : group.positions) {
+      group_args.push_back(std::move(args[position]));
+    }
+    requests.push_back(MakeRequest(CmdArgs{command, std::move(group_args)},
+                                   group.shard, master, cc));
+    positions.push_back(std::move(group.positions));
+  }
+  return CreateSplitRequest<Request>(std::move(requests), std::move(positions),
+                                     args.size());
+}
+
+void ClientImpl::InvalidateNearCache(const std::string& key, size_t shard) {
+  if (near_cache_) near_cache_->Invalidate(key, shard);
+}
+
+void ClientImpl::InvalidateNearCache(const std::vector<std::string>& keys,
+                                     size_t shard) {
+  if (near_cache_) near_cache_->Invalidate(keys, shard);
+}
+
 template Request<ScanReplyTmpl<ScanTag::kSscan>>
 ClientImpl::MakeScanRequestWithKey(
     std::string key, size_t shard,
@@ -13,6 +13,8 @@
 #include <userver/storages/redis/client.hpp>
 #include <userver/storages/redis/transaction.hpp>
 
+#include "hot_keys.hpp"
+#include "near_cache.hpp"
 #include "scan_reply.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -31,7 +33,9 @@ class ClientImpl final : public Client,
  public:
   explicit ClientImpl(
       std::shared_ptr<USERVER_NAMESPACE::redis::Sentinel> sentinel,
-      std::optional<size_t> force_shard_idx = std::nullopt);
+      std::optional<size_t> force_shard_idx = std::nullopt,
+      std::shared_ptr<NearCache> near_cache = nullptr,
+      std::shared_ptr<HotKeys> hot_keys = nullptr);
 
   void WaitConnectedOnce(
       USERVER_NAMESPACE::redis::RedisWaitConnected wait_connected) override;
@@ -47,6 +51,9 @@ class ClientImpl final : public Client,
 
   std::optional<size_t> GetForcedShardIdx() const;
 
+  /// Returns nullptr if the near cache is disabled
+  const NearCache* GetNearCache() const;
+
   Request<ScanReplyTmpl<ScanTag::kScan>> MakeScanRequestNoKey(
       size_t shard, ScanReply::Cursor cursor, ScanOptions options,
       const CommandControl& command_control);
@@ -449,23 +456,23 @@ class ClientImpl final : public Client,
       CmdArgs&& args, size_t shard, bool master,
       const CommandControl& command_control, size_t replies_to_skip = 0);
 
-  template <typename T, typename Func>
-  auto MakeRequestChunks(size_t max_chunk_size, std::vector<T>&& args,
-                         Func&& func) {
-    std::vector<USERVER_NAMESPACE::redis::Request> requests;
+  struct KeysGroup {
+    size_t shard;
+    std::vector<size_t> positions;
+  };
 
-    auto chunk_size = static_cast<std::ptrdiff_t>(max_chunk_size);
-    // NOLINTNEXTLINE(readability-qualified-auto)
-    for (auto it = args.begin(); it < args.end(); it += chunk_size) {
-      chunk_size = std::min(chunk_size, args.end() - it);
-      std::vector<T> args_chunk;
-      args_chunk.reserve(chunk_size);
-      std::move(it, it + chunk_size, std::back_inserter(args_chunk));
-      requests.push_back(func(std::move(args_chunk)));
-    }
+  /// Groups the keys by shard, or by hash slot in cluster mode, into chunks
+  /// of at most `max_chunk_size` keys (0 means no limit)
+  template <typename T>
+  std::vector<KeysGroup> GroupKeys(const std::vector<T>& args,
+                                   const CommandControl& cc,
+                                   size_t max_chunk_size) const;
 
-    return requests;
-  }
+  /// Sends a multi-key command per group of keys in parallel
+  template <typename Request, typename T>
+  Request MakeSplitRequest(std::string command, std::vector<T>&& args,
+                           bool master, const CommandControl& command_control,
+                           size_t max_chunk_size = 0);
 
   CommandControl GetCommandControl(const CommandControl& cc) const;
 
@@ -477,9 +484,14 @@ class ClientImpl final : public Client,
 
   void CheckShard(size_t shard, const CommandControl& cc) const;
 
+  void InvalidateNearCache(const std::string& key, size_t shard);
+  void InvalidateNearCache(const std::vector<std::string>& keys, size_t shard);
+
   std::shared_ptr<USERVER_NAMESPACE::redis::Sentinel> redis_client_;
   std::atomic<int> publish_shard_{0};
   const std::optional<size_t> force_shard_idx_;
+  const std::shared_ptr<NearCache> near_cache_;
+  const std::shared_ptr<HotKeys> hot_keys_;
 };
 
 }  // namespace storages::redis
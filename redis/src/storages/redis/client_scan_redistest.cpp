@@ -146,4 +146,20 @@ TYPED_UTEST(RedisClientScanTest, Scan) {
   EXPECT_EQ(actual, expected);
 }
 
+UTEST_F(RedisClientTest, ScanAllShards) {
+  auto client = GetClient();
+  for (int i = 0; i < 100; i++)
+    client->Set("key:" + std::to_string(i), "value", {}).Get();
+
+  storages::redis::ScanOptions options{
+      storages::redis::ScanOptionsBase::Count(10)};
+  auto actual = client->ScanAllShards(options, 2, {}).GetAll();
+  auto expected = client->Scan(0, options, {}).GetAll();
+  std::sort(actual.begin(), actual.end());
+  std::sort(expected.begin(), expected.end());
+
+  EXPECT_EQ(actual.size(), 100);
+  EXPECT_EQ(actual, expected);
+}
+
 USERVER_NAMESPACE_END
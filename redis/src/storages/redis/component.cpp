@@ -1,5 +1,6 @@
 #include <userver/storages/redis/component.hpp>
 
+#include <chrono>
 #include <stdexcept>
 #include <vector>
 
@@ -29,6 +30,8 @@
 #include <storages/redis/impl/subscribe_sentinel.hpp>
 
 #include "client_impl.hpp"
+#include "hot_keys.hpp"
+#include "near_cache.hpp"
 #include "redis_secdist.hpp"
 #include "subscribe_client_impl.hpp"
 #include "userver/storages/redis/impl/base.hpp"
@@ -65,6 +68,8 @@ struct RedisGroup {
   std::string config_name;
   std::string sharding_strategy;
   bool allow_reads_from_master{false};
+  storages::redis::NearCacheSettings near_cache;
+  storages::redis::HotKeysSettings hot_keys;
 };
 
 RedisGroup Parse(const yaml_config::YamlConfig& value,
@@ -75,6 +80,17 @@ RedisGroup Parse(const yaml_config::YamlConfig& value,
   config.sharding_strategy = value["sharding_strategy"].As<std::string>("");
   config.allow_reads_from_master =
       value["allow_reads_from_master"].As<bool>(false);
+  config.near_cache.max_size =
+      value["near_cache_max_size"].As<size_t>(config.near_cache.max_size);
+  config.near_cache.ttl = value["near_cache_ttl"].As<std::chrono::milliseconds>(
+      config.near_cache.ttl);
+  config.hot_keys.sample_rate =
+      value["hot_keys_sample_rate"].As<size_t>(config.hot_keys.sample_rate);
+  config.hot_keys.threshold =
+      value["hot_keys_threshold"].As<std::uint32_t>(config.hot_keys.threshold);
+  config.hot_keys.allow_stale_reads =
+      value["hot_keys_allow_stale_reads"].As<bool>(
+          config.hot_keys.allow_stale_reads);
   return config;
 }
 
@@ -219,8 +235,20 @@ void Redis::Connect(const ComponentConfig& config,
         cc, testsuite_redis_control);
     if (sentinel) {
       sentinels_.emplace(redis_group.db, sentinel);
-      const auto& client =
-          std::make_shared<storages::redis::ClientImpl>(sentinel);
+      std::shared_ptr<storages::redis::NearCache> near_cache;
+      if (redis_group.near_cache.max_size > 0) {
+        near_cache = std::make_shared<storages::redis::NearCache>(
+            redis_group.near_cache);
+        near_caches_.emplace(redis_group.db, near_cache);
+      }
+      std::shared_ptr<storages::redis::HotKeys> hot_keys;
+      if (redis_group.hot_keys.sample_rate > 0) {
+        hot_keys =
+            std::make_shared<storages::redis::HotKeys>(redis_group.hot_keys);
+        hot_keys_.emplace(redis_group.db, hot_keys);
+      }
+      const auto& client = std::make_shared<storages::redis::ClientImpl>(
+          sentinel, std::nullopt, std::move(near_cache), std::move(hot_keys));
       clients_.emplace(redis_group.db, client);
     } else {
       LOG_WARNING() << "skip redis client for " << redis_group.db;
@@ -279,6 +307,12 @@ void Redis::WriteStatistics(utils::statistics::Writer& writer) {
     writer.ValueWithLabels(redis->GetStatistics(*settings),
                            {"redis_database", name});
   }
+  for (const auto& [name, near_cache] : near_caches_) {
+    writer["near_cache"].ValueWithLabels(*near_cache, {"redis_database", name});
+  }
+  for (const auto& [name, hot_keys] : hot_keys_) {
+    writer["hot_keys"].ValueWithLabels(*hot_keys, {"redis_database", name});
+  }
   auto threads_writer = writer["ev_threads"]["cpu_load_percent"];
   threads_writer.ValueWithLabels(*thread_pools_->GetRedisThreadPool(), {});
   threads_writer.ValueWithLabels(thread_pools_->GetSentinelThreadPool(), {});
@@ -378,6 +412,29 @@ properties:
                     type: boolean
                     description: allows read requests from master instance
                     defaultDescription: false
+                near_cache_max_size:
+                    type: integer
+                    description: maximum number of GET replies cached on the client side, 0 disables the cache
+                    defaultDescription: 0
+                    minimum: 0
+                near_cache_ttl:
+                    type: string
+                    description: maximum time a cached GET reply is served without asking the server
+                    defaultDescription: 1s
+                hot_keys_sample_rate:
+                    type: integer
+                    description: one of that many single-key reads is sampled to detect hot keys, 0 disables the detection
+                    defaultDescription: 0
+                    minimum: 0
+                hot_keys_threshold:
+                    type: integer
+                    description: number of recently sampled reads that makes a key hot
+                    defaultDescription: 100
+                    minimum: 1
+                hot_keys_allow_stale_reads:
+                    type: boolean
+                    description: allows the reads of hot keys forced to master to go to replicas
+                    defaultDescription: false
     metrics_level:
         type: string
         description: set metrics detail level
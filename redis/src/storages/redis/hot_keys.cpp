@@ -0,0 +1,125 @@
+#include <storages/redis/hot_keys.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+namespace {
+
+// The number of samples of a shard between the halvings of its counters
+constexpr std::uint64_t kDecaySamples = 8192;
+
+// The number of hot keys reported per shard
+constexpr std::size_t kReportSize = 16;
+
+}  // namespace
+
+HotKeys::HotKeys(const HotKeysSettings& settings) : settings_(settings) {}
+
+bool HotKeys::AccountRead(const std::string& key, std::size_t shard) {
+  if (!settings_.sample_rate) return false;
+
+  const auto shard_ptr = shards_[shard];
+  const auto hash = std::hash<std::string>{}(key);
+  thread_local std::size_t reads = 0;
+  const auto estimate = ++reads % settings_.sample_rate == 0
+                            ? Sample(*shard_ptr, key, hash)
+                            : Estimate(*shard_ptr, hash);
+  if (estimate < settings_.threshold) return false;
+
+  shard_ptr->hot_reads.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+CommandControl HotKeys::AdjustCommandControl(CommandControl cc) const {
+  cc.allow_reads_from_master = true;
+  if (settings_.allow_stale_reads) cc.force_request_to_master = false;
+  return cc;
+}
+
+std::uint32_t HotKeys::Sample(Shard& shard, const std::string& key,
+                              std::size_t hash) const {
+  const std::size_t step = (hash >> (sizeof(hash) * 4)) | 1;
+  auto estimate = std::numeric_limits<std::uint32_t>::max();
+  for (std::size_t row = 0; row < kDepth; ++row) {
+    auto& counter = shard.counters[row * kWidth + (hash + row * step) % kWidth];
+    estimate =
+        std::min(estimate, counter.fetch_add(1, std::memory_order_relaxed) + 1);
+  }
+
+  if (shard.samples.fetch_add(1, std::memory_order_relaxed) % kDecaySamples ==
+      kDecaySamples - 1) {
+    Decay(shard);
+  }
+  if (estimate >= settings_.threshold) Report(shard, key, estimate);
+  return estimate;
+}
+
+std::uint32_t HotKeys::Estimate(const Shard& shard, std::size_t hash) const {
+  const std::size_t step = (hash >> (sizeof(hash) * 4)) | 1;
+  auto estimate = std::numeric_limits<std::uint32_t>::max();
+  for (std::size_t row = 0; row < kDepth; ++row) {
+    const auto& counter =
+        shard.counters[row * kWidth + (hash + row * step) % kWidth];
+    estimate = std::min(estimate, counter.load(std::memory_order_relaxed));
+  }
+  return estimate;
+}
+
+void HotKeys::Report(Shard& shard, const std::string& key,
+                     std::uint32_t estimate) const {
+  auto report = shard.report.Lock();
+  if (auto it = report->find(key); it != report->end()) {
+    it->second = estimate;
+    return;
+  }
+  if (report->size() >= kReportSize) {
+    const auto coldest = std::min_element(
+        report->begin(), report->end(),
+        [](const auto& a, const auto& b) { return a.second < b.second; });
+    if (coldest->second >= estimate) return;
+    report->erase(coldest);
+  }
+  report->emplace(key, estimate);
+}
+
+void HotKeys::Decay(Shard& shard) const {
+  for (auto& counter : shard.counters) {
+    counter.store(counter.load(std::memory_order_relaxed) / 2,
+                  std::memory_order_relaxed);
+  }
+
+  auto report = shard.report.Lock();
+  for (auto it = report->begin(); it != report->end();) {
+    it->second /= 2;
+    if (it->second < settings_.threshold) {
+      it = report->erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const HotKeys& hot_keys) {
+  for (const auto& [shard, stats] : hot_keys.shards_) {
+    const auto shard_label = std::to_string(shard);
+    writer["reads"].ValueWithLabels(stats->hot_reads.load(),
+                                    {"redis_shard", shard_label});
+    const auto report = stats->report.Lock();
+    for (const auto& [key, estimate] : *report) {
+      writer["sampled_reads"].ValueWithLabels(
+          std::uint64_t{estimate},
+          {{"redis_shard", shard_label}, {"redis_key", key}});
+    }
+  }
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
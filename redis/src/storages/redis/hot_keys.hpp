@@ -0,0 +1,74 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <userver/concurrent/variable.hpp>
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/storages/redis/command_options.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+struct HotKeysSettings {
+  /// One of that many reads is sampled, 0 disables the detection
+  std::size_t sample_rate{0};
+  /// A key is hot once that many of its reads are sampled recently
+  std::uint32_t threshold{100};
+  /// Allows the reads of hot keys forced to master to go to replicas
+  bool allow_stale_reads{false};
+};
+
+/// @brief Detects the hot keys of every shard.
+///
+/// Sampled reads are counted in a count-min sketch per shard. The counters
+/// are halved every few thousand samples, so a key stops being hot once it
+/// is not read that often.
+class HotKeys final {
+ public:
+  explicit HotKeys(const HotKeysSettings& settings);
+
+  /// Accounts a read of the key, returns true if the key is hot
+  bool AccountRead(const std::string& key, std::size_t shard);
+
+  /// Spreads the reads of a hot key over the replicas and the master
+  CommandControl AdjustCommandControl(CommandControl cc) const;
+
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const HotKeys& hot_keys);
+
+ private:
+  static constexpr std::size_t kDepth = 4;
+  static constexpr std::size_t kWidth = 1024;
+
+  struct Shard {
+    std::array<std::atomic<std::uint32_t>, kDepth * kWidth> counters{};
+    std::atomic<std::uint64_t> samples{0};
+    std::atomic<std::uint64_t> hot_reads{0};
+    // the most read hot keys with their estimated sampled reads
+    concurrent::Variable<std::unordered_map<std::string, std::uint32_t>,
+                         std::mutex>
+        report;
+  };
+
+  std::uint32_t Sample(Shard& shard, const std::string& key,
+                       std::size_t hash) const;
+  std::uint32_t Estimate(const Shard& shard, std::size_t hash) const;
+  void Report(Shard& shard, const std::string& key,
+              std::uint32_t estimate) const;
+  void Decay(Shard& shard) const;
+
+  const HotKeysSettings settings_;
+  mutable rcu::RcuMap<std::size_t, Shard> shards_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,45 @@
+#include <storages/redis/hot_keys.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(HotKeys, Disabled) {
+  storages::redis::HotKeys hot_keys{{}};
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_FALSE(hot_keys.AccountRead("key", 0));
+  }
+}
+
+TEST(HotKeys, Threshold) {
+  storages::redis::HotKeysSettings settings;
+  settings.sample_rate = 1;
+  settings.threshold = 10;
+  storages::redis::HotKeys hot_keys{settings};
+
+  for (int i = 1; i < 10; ++i) {
+    EXPECT_FALSE(hot_keys.AccountRead("hot", 0));
+  }
+  EXPECT_TRUE(hot_keys.AccountRead("hot", 0));
+  EXPECT_FALSE(hot_keys.AccountRead("cold", 0));
+  // shards are accounted separately
+  EXPECT_FALSE(hot_keys.AccountRead("hot", 1));
+}
+
+TEST(HotKeys, AdjustCommandControl) {
+  storages::redis::HotKeysSettings settings;
+  storages::redis::CommandControl cc;
+  cc.force_request_to_master = true;
+
+  const auto adjusted =
+      storages::redis::HotKeys{settings}.AdjustCommandControl(cc);
+  EXPECT_TRUE(adjusted.allow_reads_from_master);
+  EXPECT_TRUE(adjusted.force_request_to_master);
+
+  settings.allow_stale_reads = true;
+  const auto stale =
+      storages::redis::HotKeys{settings}.AdjustCommandControl(cc);
+  EXPECT_FALSE(stale.force_request_to_master);
+}
+
+USERVER_NAMESPACE_END
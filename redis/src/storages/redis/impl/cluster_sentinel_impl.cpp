@@ -4,12 +4,12 @@
 
 #include <fmt/format.h>
 #include <boost/container_hash/hash.hpp>
-#include <boost/crc.hpp>
 
 #include <userver/concurrent/variable.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/rcu/rcu.hpp>
 #include <userver/storages/redis/exception.hpp>
+#include <userver/storages/redis/impl/keyshard.hpp>
 #include <userver/storages/redis/impl/redis_state.hpp>
 #include <userver/storages/redis/impl/reply.hpp>
 #include <userver/utils/algo.hpp>
@@ -34,6 +34,9 @@ namespace {
 const auto kProcessCreationInterval = std::chrono::seconds(3);
 const auto kDeleteNodesCheckInterval = std::chrono::seconds(60);
 const auto kDeleteNodeInterval = std::chrono::seconds(600);
+// The slot map is fixed in place on MOVED, so the redirect storms of
+// resharding request the full topology update at most that often
+const auto kMovedTopologyUpdateInterval = std::chrono::milliseconds(500);
 
 bool CheckQuorum(size_t requests_sent, size_t responses_parsed) {
   const size_t quorum = requests_sent / 2 + 1;
@@ -64,15 +67,6 @@ using NodesAddressesSet =
     std::unordered_set<NodeAddresses, NodeAddressesHasher>;
 using HostPort = std::string;
 
-size_t HashSlot(const std::string& key) {
-  size_t start = 0;
-  size_t len = 0;
-  GetRedisKey(key, &start, &len);
-  return std::for_each(key.data() + start, key.data() + start + len,
-                       boost::crc_optimal<16, 0x1021>())() &
-         0x3fff;
-}
-
 std::string ParseMovedShard(const std::string& err_string) {
   static const auto kUnknownShard = std::string("");
   size_t pos = err_string.find(' ');  // skip "MOVED" or "ASK"
@@ -94,6 +88,24 @@ std::string ParseMovedShard(const std::string& err_string) {
   return err_string.substr(pos, colon_pos - pos) + ":" + std::to_string(port);
 }
 
+std::optional<uint16_t> ParseMovedSlot(const std::string& err_string) {
+  // "MOVED <slot> <host>:<port>"
+  const size_t pos = err_string.find(' ');
+  if (pos == std::string::npos) return std::nullopt;
+  const auto end = err_string.find(' ', pos + 1);
+  if (end == std::string::npos) return std::nullopt;
+  std::size_t slot = 0;
+  try {
+    slot = std::stoul(err_string.substr(pos + 1, end - (pos + 1)));
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "exception in " << __func__ << "(\"" << err_string
+                  << "\") " << ex.what();
+    return std::nullopt;
+  }
+  if (slot >= kClusterHashSlots) return std::nullopt;
+  return static_cast<uint16_t>(slot);
+}
+
 struct CommandSpecialPrinter {
   const CommandPtr& command;
 };
@@ -299,6 +311,13 @@ class ClusterTopologyHolder
 
   void SendUpdateClusterTopology() { update_topology_watch_.Send(); }
 
+  /// Points the slot to the new shard right away and requests the full
+  /// topology update in background, coalescing the requests of a redirect
+  /// storm
+  void ProcessMovedRedirect(const std::string& error);
+
+  void AccountAskRedirect() { ++ask_redirects_; }
+
   std::shared_ptr<Redis> GetRedisInstance(const HostPort& host_port) const {
     const auto connection = nodes_.Get(host_port);
     if (connection) {
@@ -439,6 +458,11 @@ class ClusterTopologyHolder
               StdMutexRcuMapTraits<std::string, std::string>>
       ip_by_fqdn_;
 
+  utils::statistics::RateCounter moved_redirects_{0};
+  utils::statistics::RateCounter ask_redirects_{0};
+  std::atomic<utils::datetime::SteadyCoarseClock::rep>
+      last_moved_topology_update_{0};
+
   static std::atomic<size_t> cluster_slots_call_counter_;
 };
 
@@ -746,7 +770,8 @@ void ClusterTopologyHolder::UpdateClusterTopology() {
         /// Run in ev_thread because topology_.Assign can free some old
         /// topologies with their related redis connections, and these
         /// connections must be freed on "sentinel" thread.
-        ev_thread_.RunInEvLoopAsync([this, topology{std::move(topology)}] {
+        ev_thread_.RunInEvLoopAsync([this,
+                                     topology{std::move(topology)}]() mutable {
           try {
             const auto new_shards_count = topology.GetShardsCount();
             topology_.Assign(std::move(topology));
@@ -764,6 +789,34 @@ void ClusterTopologyHolder::UpdateClusterTopology() {
       });
 }
 
+void ClusterTopologyHolder::ProcessMovedRedirect(const std::string& error) {
+  ++moved_redirects_;
+
+  const auto slot = ParseMovedSlot(error);
+  const auto host_port = ParseMovedShard(error);
+  if (slot && !host_port.empty()) {
+    const auto topology = GetTopology();
+    if (const auto shard = topology->GetShardByHostPort(host_port)) {
+      topology->MoveSlot(*slot, *shard);
+    }
+  }
+
+  const auto now = utils::datetime::SteadyCoarseClock::now()
+                       .time_since_epoch()
+                       .count();
+  auto last = last_moved_topology_update_.load(std::memory_order_relaxed);
+  const auto interval =
+      std::chrono::duration_cast<utils::datetime::SteadyCoarseClock::duration>(
+          kMovedTopologyUpdateInterval)
+          .count();
+  if (now - last < interval) return;
+  if (!last_moved_topology_update_.compare_exchange_strong(
+          last, now, std::memory_order_relaxed)) {
+    return;
+  }
+  SendUpdateClusterTopology();
+}
+
 void ClusterTopologyHolder::GetStatistics(
     SentinelStatistics& stats, const MetricsSettings& settings) const {
   if (sentinels_) {
@@ -775,6 +828,8 @@ void ClusterTopologyHolder::GetStatistics(
       cluster_slots_call_counter_.load(std::memory_order_relaxed)};
   stats.internal.cluster_topology_updates = utils::statistics::Rate{
       current_topology_version_.load(std::memory_order_relaxed)};
+  stats.internal.cluster_moved_redirects = moved_redirects_.Load();
+  stats.internal.cluster_ask_redirects = ask_redirects_.Load();
 
   auto topology = GetTopology();
   topology->GetStatistics(settings, stats);
@@ -912,7 +967,9 @@ void ClusterSentinelImpl::AsyncCommand(const SentinelCommand& scommand,
                       << " shard: " << shard
                       << " movedto:" << ParseMovedShard(reply->data.GetError())
                       << " args:" << args;
-          this->topology_holder_->SendUpdateClusterTopology();
+          this->topology_holder_->ProcessMovedRedirect(reply->data.GetError());
+        } else if (error_ask) {
+          this->topology_holder_->AccountAskRedirect();
         }
         const bool retry_to_master =
             !master && reply->data.IsNil() &&
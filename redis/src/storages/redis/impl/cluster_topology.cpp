@@ -66,7 +66,7 @@ ClusterTopology::ClusterTopology(
     for (const auto& info : infos_) {
       for (const auto& interval : info.slot_intervals) {
         for (size_t i = interval.slot_min; i <= interval.slot_max; ++i) {
-          slot_to_shard_[i] = shard_index;
+          (*slot_to_shard_)[i].store(shard_index, std::memory_order_relaxed);
         }
       }
       ++shard_index;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <memory>
 #include <optional>
@@ -9,6 +10,7 @@
 
 #include <userver/rcu/rcu_map.hpp>
 #include <userver/storages/redis/impl/base.hpp>
+#include <userver/utils/assert.hpp>
 
 #include <storages/redis/impl/cluster_shard.hpp>
 #include <storages/redis/impl/sentinel_impl.hpp>
@@ -34,9 +36,7 @@ class ClusterTopology {
 
   ClusterTopology() = default;
   ClusterTopology(ClusterTopology&&) = default;
-  ClusterTopology(const ClusterTopology&) = default;
   ClusterTopology& operator=(ClusterTopology&&) = default;
-  ClusterTopology& operator=(const ClusterTopology&) = default;
 
   ClusterTopology(
       size_t version, std::chrono::steady_clock::time_point timestamp,
@@ -46,7 +46,15 @@ class ClusterTopology {
   ~ClusterTopology();
 
   size_t GetShardIndexBySlot(uint16_t slot) const {
-    return slot_to_shard_.at(slot);
+    return slot_to_shard_->at(slot).load(std::memory_order_relaxed);
+  }
+
+  /// Points the slot to the shard from a MOVED reply in place, without
+  /// waiting for the next topology. Lock-free, safe to call on a topology that
+  /// is being read concurrently.
+  void MoveSlot(uint16_t slot, size_t shard) const {
+    UASSERT(shard < GetShardsCount());
+    slot_to_shard_->at(slot).store(shard, std::memory_order_relaxed);
   }
 
   std::optional<size_t> GetShardByHostPort(const std::string& host_port) const {
@@ -91,7 +99,11 @@ class ClusterTopology {
  private:
   ClusterShardHostInfos infos_;
   Password password_;
-  std::array<uint16_t, kClusterHashSlots> slot_to_shard_{};
+  // Updated in place by MOVED replies. Kept on heap as the atomics are not
+  // movable.
+  std::unique_ptr<std::array<std::atomic<uint16_t>, kClusterHashSlots>>
+      slot_to_shard_{std::make_unique<
+          std::array<std::atomic<uint16_t>, kClusterHashSlots>>()};
 
   /// Special "Shard" containing all instances of cluster, master - is 0-shard
   /// master.
@@ -82,4 +82,18 @@ TEST(KeyShardTaximeterCrc32, Multithreads) {
   EXPECT_EQ(kCount, counts[key_shard.ShardByKey(kKey)]);
 }
 
+// The sharding must not change between releases, otherwise the data stored in
+// Redis would be looked up on the wrong shards
+TEST(KeyShard, StableValues) {
+  EXPECT_EQ(redis::HashSlot("foo"), 12182);
+  EXPECT_EQ(redis::HashSlot("{user1000}.following"),
+            redis::HashSlot("user1000"));
+
+  const redis::KeyShardCrc32 key_shard(kShards);
+  EXPECT_EQ(key_shard.ShardByKey("somekey"), 2714070577 % kShards);
+  EXPECT_EQ(key_shard.ShardByKey("{user1000}.following"),
+            key_shard.ShardByKey("user1000"));
+  EXPECT_EQ(key_shard.ShardByKey("user1000"), 6);
+}
+
 USERVER_NAMESPACE_END
@@ -27,6 +27,8 @@
 #include <storages/redis/impl/ev_wrapper.hpp>
 #include <storages/redis/impl/redis_info.hpp>
 #include <storages/redis/impl/redis_stats.hpp>
+#include <storages/redis/impl/reply_reader.hpp>
+#include <storages/redis/impl/resp.hpp>
 #include <storages/redis/impl/tcp_socket.hpp>
 #include <userver/storages/redis/impl/reply.hpp>
 
@@ -274,8 +276,10 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   std::string server_;
   Password password_{std::string()};
   std::atomic<size_t> commands_size_ = 0;
+  std::atomic<size_t> commands_bytes_ = 0;
   size_t sent_count_ = 0;
   size_t cmd_counter_ = 0;
+  std::string command_buffer_;
   std::unordered_map<size_t, std::unique_ptr<SingleCommand>> reply_privdata_;
   std::unordered_map<const ev_timer*, size_t> reply_privdata_rev_;
   bool subscriber_ = false;
@@ -481,6 +485,7 @@ bool Redis::RedisImpl::Connect(const std::string& host, int port,
     context_ = nullptr;
     return false;
   }
+  UseMovableReplies(context_->c.reader);
 
   ev_thread_control_.RunInEvLoopBlocking([this, &host]() {
     bool err = false;
@@ -605,10 +610,15 @@ bool Redis::RedisImpl::AsyncCommand(const CommandPtr& command) {
   LOG_DEBUG() << "AsyncCommand for server_id=" << GetServerId().GetId()
               << " server=" << GetServerId().GetDescription()
               << " cmd=" << command->args;
+  size_t bytes = 0;
+  for (const auto& args : command->args.args) {
+    for (const auto& arg : args) bytes += arg.size();
+  }
   {
     std::lock_guard<std::mutex> lock(command_mutex_);
     if (destroying_) return false;
     ++commands_size_;
+    commands_bytes_ += bytes;
     commands_.push_back(command);
   }
   ev_thread_control_.Send(watch_command_);
@@ -872,6 +882,7 @@ void Redis::RedisImpl::FreeCommands() {
           "Disconnecting, killing commands still waiting in send queue");
     }
   }
+  commands_bytes_ = 0;
 
   for (auto& info : reply_privdata_) {
     ev_thread_control_.Stop(info.second->timer);
@@ -901,7 +912,10 @@ void Redis::RedisImpl::OnNewCommandImpl() {
   if (WatchCommandTimerEnabled(*commands_buffering_settings) &&
       (!commands_buffering_settings->commands_buffering_threshold ||
        commands_size_.load() <
-           commands_buffering_settings->commands_buffering_threshold)) {
+           commands_buffering_settings->commands_buffering_threshold) &&
+      (!commands_buffering_settings->commands_buffering_max_bytes ||
+       commands_bytes_.load() <
+           commands_buffering_settings->commands_buffering_max_bytes)) {
     if (!std::exchange(watch_command_timer_started_, true)) {
       // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
       ev_timer_set(
@@ -937,9 +951,15 @@ void Redis::RedisImpl::CommandLoopImpl() {
   {
     std::lock_guard<std::mutex> lock(command_mutex_);
     commands_size_ -= commands_.size();
+    commands_bytes_ = 0;
     std::swap(commands_, commands);
   }
   LOG_TRACE() << "commands size=" << commands.size();
+  if (commands.empty()) return;
+  // hiredis appends the commands to the output buffer of the connection and
+  // writes it once the event loop polls the socket, so the whole batch goes
+  // out in a single write
+  statistics_.AccountBatchSent(commands.size());
   for (auto& command : commands) {
     ProcessCommand(command);
   }
@@ -1131,9 +1151,9 @@ void Redis::RedisImpl::OnRedisReplyImpl(redisReply* redis_reply, void* privdata,
   ev_thread_control_.Stop(data->second->timer);
   pcommand = data->second.get();
 
-  auto reply = std::make_shared<Reply>(pcommand->cmd, redis_reply,
-                                       NativeToReplyStatus(status),
-                                       errstr ? errstr : "");
+  auto reply = std::make_shared<Reply>(
+      pcommand->cmd, ExtractReplyData(redis_reply), NativeToReplyStatus(status),
+      errstr ? errstr : "");
 
   // After 'subscribe x' + 'unsubscribe x' + 'subscribe x' requests
   // 'unsubscribe' reply can be received as a reply to the second subscribe
@@ -1205,29 +1225,22 @@ void Redis::RedisImpl::ProcessCommand(const CommandPtr& command) {
                  << "' command" << log_extra_;
     }
 
-    std::vector<const char*> argv;
-    std::vector<size_t> argv_len;
-
-    argv.reserve(argc);
-    argv_len.reserve(argc);
-
-    for (const auto& arg : args) {
-      argv.push_back(arg.data());
-      argv_len.push_back(arg.size());
-    }
-
     {
       if (command->asking && (!multi || IsMultiCommand(args))) {
-        static const char* asking = "ASKING";
-        static const size_t asking_len = strlen(asking);
-        redisAsyncCommandArgv(context_, nullptr, nullptr, 1, &asking,
-                              &asking_len);
+        redisAsyncFormattedCommand(context_, nullptr, nullptr,
+                                   kRespAskingCommand.data(),
+                                   kRespAskingCommand.size());
       }
-      if (redisAsyncCommandArgv(context_, OnRedisReply,
-                                reinterpret_cast<void*>(cmd_counter_), argc,
-                                argv.data(), argv_len.data()) != REDIS_OK) {
+      // hiredis copies the formatted command into its output buffer
+      command_buffer_.clear();
+      AppendRespCommand(command_buffer_, args);
+      if (redisAsyncFormattedCommand(context_, OnRedisReply,
+                                     reinterpret_cast<void*>(cmd_counter_),
+                                     command_buffer_.data(),
+                                     command_buffer_.size()) != REDIS_OK) {
         LOG_ERROR() << log_extra_
-                    << "redisAsyncCommandArgv() failed on command " << args[0];
+                    << "redisAsyncFormattedCommand() failed on command "
+                    << args[0];
         InvokeCommandError(command, args[0], ReplyStatus::kOtherError);
         continue;
       }
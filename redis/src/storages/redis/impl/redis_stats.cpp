@@ -165,6 +165,10 @@ void Statistics::AccountCommandSent(const CommandPtr& cmd) {
   }
 }
 
+void Statistics::AccountBatchSent(size_t commands_count) {
+  batch_size_percentile.GetCurrentCounter().Account(commands_count);
+}
+
 void Statistics::AccountReplyReceived(const ReplyPtr& reply,
                                       const CommandPtr& cmd) {
   reply_size_percentile.GetCurrentCounter().Account(reply->data.GetSize());
@@ -211,6 +215,7 @@ void DumpMetric(utils::statistics::Writer& writer,
 
   if (stats.settings.IsRequestSizesEnabled()) {
     writer["request_sizes"] = stats.request_size_percentile;
+    writer["batch_sizes"] = stats.batch_size_percentile;
   }
   if (stats.settings.IsReplySizesEnabled()) {
     writer["reply_sizes"] = stats.reply_size_percentile;
@@ -295,6 +300,11 @@ void DumpMetric(utils::statistics::Writer& writer,
         stats.internal.cluster_topology_checks.Load();
     writer["cluster_topology_updates.v2"] =
         stats.internal.cluster_topology_updates.Load();
+    writer["cluster_redirects"].ValueWithLabels(
+        stats.internal.cluster_moved_redirects.Load(),
+        {"redis_redirect", "moved"});
+    writer["cluster_redirects"].ValueWithLabels(
+        stats.internal.cluster_ask_redirects.Load(), {"redis_redirect", "ask"});
   }
 
   ConnStateStatistic conn_stat_masters;
@@ -273,6 +273,13 @@ Reply::Reply(std::string cmd, redisReply* redis_reply, ReplyStatus status,
 Reply::Reply(std::string cmd, ReplyData&& data)
     : cmd(std::move(cmd)), data(std::move(data)), status(ReplyStatus::kOk) {}
 
+Reply::Reply(std::string cmd, ReplyData&& data, ReplyStatus status,
+             std::string status_string)
+    : cmd(std::move(cmd)),
+      data(std::move(data)),
+      status(status),
+      status_string(std::move(status_string)) {}
+
 bool Reply::IsOk() const { return status == ReplyStatus::kOk; }
 
 bool Reply::IsLoggableError() const {
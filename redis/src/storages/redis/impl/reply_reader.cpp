@@ -0,0 +1,155 @@
+#include <storages/redis/impl/reply_reader.hpp>
+
+#include <string>
+#include <vector>
+
+#include <hiredis/hiredis.h>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+namespace {
+
+#if HIREDIS_MAJOR >= 1
+using ElementsCount = size_t;
+#else
+using ElementsCount = int;
+#endif
+
+// `str` and `element` point into the storages, so that the reader fills the
+// strings that are later moved out of the reply without copying
+struct MovableReply final : redisReply {
+  std::string str_storage;
+  std::vector<redisReply*> element_storage;
+};
+
+void* LinkToParent(const redisReadTask* task, MovableReply* reply) {
+  if (task->parent) {
+    auto* parent = static_cast<redisReply*>(task->parent->obj);
+    UASSERT(static_cast<size_t>(task->idx) < parent->elements);
+    parent->element[task->idx] = reply;
+  }
+  return reply;
+}
+
+MovableReply* CreateReply(const redisReadTask* task) {
+  auto* reply = new MovableReply{};
+  reply->type = task->type;
+  return reply;
+}
+
+void SetString(MovableReply& reply, const char* str, size_t len) {
+  reply.str_storage.assign(str, len);
+  reply.str = reply.str_storage.data();
+  reply.len = len;
+}
+
+void* CreateString(const redisReadTask* task, char* str, size_t len) {
+  auto* reply = CreateReply(task);
+  SetString(*reply, str, len);
+  return LinkToParent(task, reply);
+}
+
+void* CreateArray(const redisReadTask* task, ElementsCount elements) {
+  auto* reply = CreateReply(task);
+  reply->element_storage.assign(elements, nullptr);
+  reply->element = reply->element_storage.data();
+  reply->elements = elements;
+  return LinkToParent(task, reply);
+}
+
+void* CreateInteger(const redisReadTask* task, long long value) {
+  auto* reply = CreateReply(task);
+  reply->integer = value;
+  return LinkToParent(task, reply);
+}
+
+#if HIREDIS_MAJOR >= 1
+void* CreateDouble(const redisReadTask* task, double value, char* str,
+                   size_t len) {
+  auto* reply = CreateReply(task);
+  reply->dval = value;
+  SetString(*reply, str, len);
+  return LinkToParent(task, reply);
+}
+
+void* CreateBool(const redisReadTask* task, int value) {
+  auto* reply = CreateReply(task);
+  reply->integer = value != 0;
+  return LinkToParent(task, reply);
+}
+#endif
+
+void* CreateNil(const redisReadTask* task) {
+  return LinkToParent(task, CreateReply(task));
+}
+
+void FreeObject(void* ptr) {
+  auto* reply = static_cast<MovableReply*>(static_cast<redisReply*>(ptr));
+  for (auto* element : reply->element_storage) {
+    // elements are missing if the reply is freed on a protocol error
+    if (element) FreeObject(element);
+  }
+  delete reply;
+}
+
+redisReplyObjectFunctions MakeReplyObjectFunctions() {
+  redisReplyObjectFunctions functions{};
+  functions.createString = &CreateString;
+  functions.createArray = &CreateArray;
+  functions.createInteger = &CreateInteger;
+#if HIREDIS_MAJOR >= 1
+  functions.createDouble = &CreateDouble;
+  functions.createBool = &CreateBool;
+#endif
+  functions.createNil = &CreateNil;
+  functions.freeObject = &FreeObject;
+  return functions;
+}
+
+std::string ExtractString(MovableReply& reply) {
+  auto result = std::move(reply.str_storage);
+  reply.str_storage.clear();
+  reply.str = reply.str_storage.data();
+  reply.len = 0;
+  return result;
+}
+
+}  // namespace
+
+void UseMovableReplies(redisReader* reader) {
+  static redisReplyObjectFunctions functions = MakeReplyObjectFunctions();
+  reader->fn = &functions;
+}
+
+ReplyData ExtractReplyData(redisReply* reply) {
+  if (!reply) return ReplyData{static_cast<const redisReply*>(nullptr)};
+
+  auto& movable_reply = static_cast<MovableReply&>(*reply);
+  switch (reply->type) {
+    case REDIS_REPLY_STRING:
+      return ReplyData{ExtractString(movable_reply)};
+    case REDIS_REPLY_STATUS:
+      return ReplyData::CreateStatus(ExtractString(movable_reply));
+    case REDIS_REPLY_ERROR:
+      return ReplyData::CreateError(ExtractString(movable_reply));
+    case REDIS_REPLY_ARRAY: {
+      ReplyData::Array array;
+      array.reserve(movable_reply.element_storage.size());
+      for (auto* element : movable_reply.element_storage) {
+        array.push_back(ExtractReplyData(element));
+      }
+      return ReplyData{std::move(array)};
+    }
+    default:
+      // nothing to move out of the integers and nils
+      return ReplyData{reply};
+  }
+}
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <userver/storages/redis/impl/reply.hpp>
+
+struct redisReader;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+/// @brief Makes the reader keep the strings of the replies in std::string.
+///
+/// Must be called before the reader creates any reply. The replies of such
+/// a reader may be passed to ExtractReplyData() only.
+void UseMovableReplies(redisReader* reader);
+
+/// Moves the strings of the reply created by a reader set up with
+/// UseMovableReplies() into ReplyData, leaving them empty in the reply
+ReplyData ExtractReplyData(redisReply* reply);
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
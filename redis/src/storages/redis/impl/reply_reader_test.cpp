@@ -0,0 +1,79 @@
+#include <storages/redis/impl/reply_reader.hpp>
+
+#include <memory>
+#include <string_view>
+
+#include <hiredis/hiredis.h>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class MovableReplyReader {
+ public:
+  MovableReplyReader() : reader_(redisReaderCreate(), &redisReaderFree) {
+    redis::UseMovableReplies(reader_.get());
+  }
+
+  redis::ReplyData Read(std::string_view data) {
+    EXPECT_EQ(redisReaderFeed(reader_.get(), data.data(), data.size()),
+              REDIS_OK);
+    void* reply = nullptr;
+    EXPECT_EQ(redisReaderGetReply(reader_.get(), &reply), REDIS_OK);
+    auto result = redis::ExtractReplyData(static_cast<redisReply*>(reply));
+    if (reply) reader_->fn->freeObject(reply);
+    return result;
+  }
+
+ private:
+  std::unique_ptr<redisReader, decltype(&redisReaderFree)> reader_;
+};
+
+}  // namespace
+
+TEST(ReplyReader, Scalars) {
+  MovableReplyReader reader;
+
+  auto string = reader.Read("$5\r\nvalue\r\n");
+  ASSERT_TRUE(string.IsString());
+  EXPECT_EQ(string.GetString(), "value");
+
+  auto status = reader.Read("+OK\r\n");
+  ASSERT_TRUE(status.IsStatus());
+  EXPECT_EQ(status.GetStatus(), "OK");
+
+  auto error = reader.Read("-ERR wrong type\r\n");
+  ASSERT_TRUE(error.IsError());
+  EXPECT_EQ(error.GetError(), "ERR wrong type");
+
+  auto integer = reader.Read(":42\r\n");
+  ASSERT_TRUE(integer.IsInt());
+  EXPECT_EQ(integer.GetInt(), 42);
+
+  EXPECT_TRUE(reader.Read("$-1\r\n").IsNil());
+}
+
+TEST(ReplyReader, NestedArrays) {
+  MovableReplyReader reader;
+
+  // split in the middle of the reply
+  EXPECT_EQ(reader.Read("*3\r\n$3\r\nfoo\r\n*2\r\n:1\r\n$").GetType(),
+            redis::ReplyData::Type::kNoReply);
+  auto array = reader.Read("-1\r\n*0\r\n");
+  ASSERT_TRUE(array.IsArray());
+  ASSERT_EQ(array.GetArray().size(), 3);
+  EXPECT_EQ(array.GetArray()[0].GetString(), "foo");
+
+  const auto& nested = array.GetArray()[1];
+  ASSERT_TRUE(nested.IsArray());
+  ASSERT_EQ(nested.GetArray().size(), 2);
+  EXPECT_EQ(nested.GetArray()[0].GetInt(), 1);
+  EXPECT_TRUE(nested.GetArray()[1].IsNil());
+
+  ASSERT_TRUE(array.GetArray()[2].IsArray());
+  EXPECT_TRUE(array.GetArray()[2].GetArray().empty());
+}
+
+USERVER_NAMESPACE_END
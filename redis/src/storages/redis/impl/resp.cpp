@@ -0,0 +1,42 @@
+#include <storages/redis/impl/resp.hpp>
+
+#include <charconv>
+#include <limits>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+namespace {
+
+constexpr std::size_t kMaxDigits = std::numeric_limits<size_t>::digits10 + 1;
+// prefix, digits and CRLF
+constexpr std::size_t kMaxHeaderSize = 1 + kMaxDigits + 2;
+
+void AppendHeader(std::string& buffer, char prefix, std::size_t size) {
+  char header[kMaxHeaderSize];
+  header[0] = prefix;
+  auto* end = std::to_chars(header + 1, header + kMaxHeaderSize, size).ptr;
+  *end++ = '\r';
+  *end++ = '\n';
+  buffer.append(header, end);
+}
+
+}  // namespace
+
+void AppendRespCommand(std::string& buffer, const CmdArgs::CmdArgsArray& args) {
+  std::size_t size = kMaxHeaderSize;
+  for (const auto& arg : args) size += kMaxHeaderSize + arg.size() + 2;
+  buffer.reserve(buffer.size() + size);
+
+  AppendHeader(buffer, '*', args.size());
+  for (const auto& arg : args) {
+    AppendHeader(buffer, '$', arg.size());
+    buffer.append(arg);
+    buffer.append("\r\n");
+  }
+}
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include <userver/storages/redis/impl/base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+/// The ASKING command in RESP
+inline constexpr std::string_view kRespAskingCommand =
+    "*1\r\n$6\r\nASKING\r\n";
+
+/// Appends the command to the buffer as a RESP array of bulk strings
+void AppendRespCommand(std::string& buffer, const CmdArgs::CmdArgsArray& args);
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
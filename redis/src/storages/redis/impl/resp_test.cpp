@@ -0,0 +1,23 @@
+#include <storages/redis/impl/resp.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(Resp, AppendCommand) {
+  std::string buffer{redis::kRespAskingCommand};
+  redis::AppendRespCommand(buffer, {"set", "key", std::string(12, 'x')});
+  redis::AppendRespCommand(buffer, {"get", ""});
+  EXPECT_EQ(buffer,
+            "*1\r\n$6\r\nASKING\r\n"
+            "*3\r\n$3\r\nset\r\n$3\r\nkey\r\n$12\r\nxxxxxxxxxxxx\r\n"
+            "*2\r\n$3\r\nget\r\n$0\r\n\r\n");
+}
+
+TEST(Resp, AppendBinaryArgument) {
+  std::string buffer;
+  redis::AppendRespCommand(buffer, {"set", std::string("a\0\r\n", 4)});
+  EXPECT_EQ(buffer, std::string("*2\r\n$3\r\nset\r\n$4\r\na\0\r\n\r\n", 23));
+}
+
+USERVER_NAMESPACE_END
@@ -20,6 +20,7 @@
 #include <userver/storages/redis/impl/wait_connected_mode.hpp>
 
 #include <storages/redis/impl/redis_stats.hpp>
+#include <storages/redis/impl/shared_message.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -179,10 +180,10 @@ class Sentinel {
       const std::shared_ptr<CommandControl>& cc);
 
   using UserMessageCallback = std::function<Outcome(
-      const std::string& channel, const std::string& message)>;
+      const std::string& channel, const SharedMessage& message)>;
   using UserPmessageCallback = std::function<Outcome(
       const std::string& pattern, const std::string& channel,
-      const std::string& message)>;
+      const SharedMessage& message)>;
 
   using MessageCallback =
       std::function<void(ServerId server_id, const std::string& channel,
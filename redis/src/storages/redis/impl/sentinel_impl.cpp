@@ -4,8 +4,6 @@
 #include <sstream>
 #include <thread>
 
-#include <boost/crc.hpp>
-
 #include <fmt/format.h>
 
 #include <hiredis/hiredis.h>
@@ -941,15 +939,6 @@ size_t SentinelImpl::ParseMovedShard(const std::string& err_string) {
   return shard_info_.GetShard(host, port);
 }
 
-size_t SentinelImpl::HashSlot(const std::string& key) {
-  size_t start = 0;
-  size_t len = 0;
-  GetRedisKey(key, &start, &len);
-  return std::for_each(key.data() + start, key.data() + start + len,
-                       boost::crc_optimal<16, 0x1021>())() &
-         0x3fff;
-}
-
 SentinelImpl::SlotInfo::SlotInfo() {
   for (size_t i = 0; i < kClusterHashSlots; ++i) {
     slot_to_shard_[i] = kUnknownShard;
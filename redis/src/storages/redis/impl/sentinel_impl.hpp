@@ -242,8 +242,6 @@ class SentinelImpl : public SentinelImplBase {
                   std::vector<std::shared_ptr<Shard>>& shard_objects,
                   const ReadyChangeCallback& ready_callback);
 
-  static size_t HashSlot(const std::string& key);
-
   void ProcessWaitingCommands();
 
   Sentinel& sentinel_obj_;
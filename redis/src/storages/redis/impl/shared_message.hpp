@@ -0,0 +1,35 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace redis {
+
+/// @brief Immutable payload of a pub/sub message.
+///
+/// A message is copied once and then shared by all the local subscribers of
+/// its channel instead of being copied into every subscription queue.
+class SharedMessage final {
+ public:
+  SharedMessage() = default;
+
+  explicit SharedMessage(std::string message)
+      : message_(std::make_shared<const std::string>(std::move(message))) {}
+
+  const std::string& Get() const {
+    static const std::string kEmpty;
+    return message_ ? *message_ : kEmpty;
+  }
+
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  operator const std::string&() const { return Get(); }
+
+ private:
+  std::shared_ptr<const std::string> message_;
+};
+
+}  // namespace redis
+
+USERVER_NAMESPACE_END
@@ -454,9 +454,10 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<
   try {
     const std::lock_guard<std::mutex> lock(mutex_);
     auto& m = callback_map_.at(channel);
+    const SharedMessage shared_message{message};
     for (const auto& it : m.callbacks) {
       try {
-        const auto result = it.second(channel, message);
+        const auto result = it.second(channel, shared_message);
         switch (result) {
           case SubscribedCallbackOutcome::kOk:
             break;  // do nothing
@@ -489,9 +490,10 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<
   try {
     const std::lock_guard<std::mutex> lock(mutex_);
     auto& m = pattern_callback_map_.at(pattern);
+    const SharedMessage shared_message{message};
     for (const auto& it : m.callbacks) {
       try {
-        const auto result = it.second(pattern, channel, message);
+        const auto result = it.second(pattern, channel, shared_message);
         switch (result) {
           case SubscribedCallbackOutcome::kOk:
             break;  // do nothing
@@ -523,9 +525,10 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<
   try {
     const std::lock_guard<std::mutex> lock(mutex_);
     auto& m = sharded_callback_map_.at(channel);
+    const SharedMessage shared_message{message};
     for (const auto& it : m.callbacks) {
       try {
-        const auto result = it.second(channel, message);
+        const auto result = it.second(channel, shared_message);
         switch (result) {
           case SubscribedCallbackOutcome::kOk:
             break;  // do nothing
@@ -0,0 +1,94 @@
+#include <storages/redis/near_cache.hpp>
+
+#include <algorithm>
+#include <functional>
+
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+namespace {
+
+constexpr std::size_t kCacheWays = 16;
+
+}  // namespace
+
+NearCache::NearCache(const NearCacheSettings& settings)
+    : cache_(kCacheWays, std::max<std::size_t>(settings.max_size / kCacheWays,
+                                               1)) {
+  cache_.SetMaxLifetime(settings.ttl);
+  cache_.SetAdmission(cache::LruCacheAdmission::kTinyLfu);
+}
+
+std::optional<NearCache::Value> NearCache::Get(const std::string& key,
+                                               std::size_t shard) {
+  auto value = cache_.GetOptionalNoUpdate(key);
+  auto& stats = *shard_statistics_[shard];
+  ++(value ? stats.hits : stats.misses);
+  return value;
+}
+
+NearCache::Ticket NearCache::GetTicket(const std::string& key) const {
+  return GetGeneration(key).load();
+}
+
+void NearCache::Put(const std::string& key, Value value, Ticket ticket) {
+  const auto& generation = GetGeneration(key);
+  if (generation.load() != ticket) return;
+  cache_.Put(key, std::move(value));
+  // The key could have been written while the value was being stored
+  if (generation.load() != ticket) cache_.InvalidateByKey(key);
+}
+
+void NearCache::Invalidate(const std::string& key, std::size_t shard) {
+  ++GetGeneration(key);
+  cache_.InvalidateByKey(key);
+  ++shard_statistics_[shard]->invalidations;
+}
+
+void NearCache::Invalidate(const std::vector<std::string>& keys,
+                           std::size_t shard) {
+  for (const auto& key : keys) Invalidate(key, shard);
+}
+
+std::atomic<NearCache::Ticket>& NearCache::GetGeneration(
+    const std::string& key) {
+  return generations_[std::hash<std::string>{}(key) % kGenerationStripes];
+}
+
+const std::atomic<NearCache::Ticket>& NearCache::GetGeneration(
+    const std::string& key) const {
+  return generations_[std::hash<std::string>{}(key) % kGenerationStripes];
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const NearCache& near_cache) {
+  std::uint64_t hits = 0;
+  std::uint64_t misses = 0;
+  std::uint64_t invalidations = 0;
+  for (const auto& [shard, stats] : near_cache.shard_statistics_) {
+    const auto shard_hits = stats->hits.load();
+    const auto shard_misses = stats->misses.load();
+    const auto shard_invalidations = stats->invalidations.load();
+    auto shard_writer = writer["by_shard"];
+    shard_writer["hits"].ValueWithLabels(
+        shard_hits, {"redis_shard", std::to_string(shard)});
+    shard_writer["misses"].ValueWithLabels(
+        shard_misses, {"redis_shard", std::to_string(shard)});
+    shard_writer["invalidations"].ValueWithLabels(
+        shard_invalidations, {"redis_shard", std::to_string(shard)});
+    hits += shard_hits;
+    misses += shard_misses;
+    invalidations += shard_invalidations;
+  }
+  writer["hits"] = hits;
+  writer["misses"] = misses;
+  writer["invalidations"] = invalidations;
+  writer["size"] = near_cache.cache_.GetSizeApproximate();
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/cache/expirable_lru_cache.hpp>
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+struct NearCacheSettings {
+  /// Maximum number of cached keys, 0 disables the cache
+  std::size_t max_size{0};
+  /// Maximum time a value is served without asking the server
+  std::chrono::milliseconds ttl{1000};
+};
+
+/// @brief Client-side cache of GET replies.
+///
+/// A value is served from the cache for at most `ttl`. Writes through the
+/// same client invalidate the written keys, writes from other clients are
+/// seen once the value expires. New keys are admitted by TinyLFU, so a pass
+/// over cold keys does not evict the hot ones.
+class NearCache final {
+ public:
+  using Value = std::optional<std::string>;
+  /// Write generation of a key, taken before the read is sent
+  using Ticket = std::uint64_t;
+
+  explicit NearCache(const NearCacheSettings& settings);
+
+  /// Returns the cached value, accounts a hit or a miss for the shard
+  std::optional<Value> Get(const std::string& key, std::size_t shard);
+
+  Ticket GetTicket(const std::string& key) const;
+
+  /// Stores the value read with the ticket, unless the key has been written
+  /// since the ticket was taken
+  void Put(const std::string& key, Value value, Ticket ticket);
+
+  /// Must be called before a write to the key is sent
+  void Invalidate(const std::string& key, std::size_t shard);
+  void Invalidate(const std::vector<std::string>& keys, std::size_t shard);
+
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const NearCache& near_cache);
+
+ private:
+  struct ShardStatistics {
+    std::atomic<std::uint64_t> hits{0};
+    std::atomic<std::uint64_t> misses{0};
+    std::atomic<std::uint64_t> invalidations{0};
+  };
+
+  static constexpr std::size_t kGenerationStripes = 64;
+
+  std::atomic<Ticket>& GetGeneration(const std::string& key);
+  const std::atomic<Ticket>& GetGeneration(const std::string& key) const;
+
+  cache::ExpirableLruCache<std::string, Value> cache_;
+  std::array<std::atomic<Ticket>, kGenerationStripes> generations_{};
+  mutable rcu::RcuMap<std::size_t, ShardStatistics> shard_statistics_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,46 @@
+#include <storages/redis/near_cache.hpp>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+storages::redis::NearCacheSettings MakeSettings() {
+  storages::redis::NearCacheSettings settings;
+  settings.max_size = 128;
+  settings.ttl = std::chrono::hours{1};
+  return settings;
+}
+
+}  // namespace
+
+UTEST(NearCache, PutGet) {
+  storages::redis::NearCache cache{MakeSettings()};
+  EXPECT_EQ(cache.Get("key", 0), std::nullopt);
+
+  cache.Put("key", "value", cache.GetTicket("key"));
+  cache.Put("nil", std::nullopt, cache.GetTicket("nil"));
+  EXPECT_EQ(cache.Get("key", 0),
+            std::make_optional(std::optional<std::string>{"value"}));
+  EXPECT_EQ(cache.Get("nil", 0),
+            std::make_optional(std::optional<std::string>{}));
+}
+
+UTEST(NearCache, Invalidate) {
+  storages::redis::NearCache cache{MakeSettings()};
+  cache.Put("key", "value", cache.GetTicket("key"));
+  cache.Invalidate("key", 0);
+  EXPECT_EQ(cache.Get("key", 0), std::nullopt);
+}
+
+UTEST(NearCache, StaleTicket) {
+  storages::redis::NearCache cache{MakeSettings()};
+  const auto ticket = cache.GetTicket("key");
+  // the key is written while the read is in flight
+  cache.Invalidate("key", 0);
+  cache.Put("key", "stale", ticket);
+  EXPECT_EQ(cache.Get("key", 0), std::nullopt);
+}
+
+USERVER_NAMESPACE_END
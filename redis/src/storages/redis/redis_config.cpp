@@ -93,6 +93,8 @@ USERVER_NAMESPACE::redis::CommandsBufferingSettings Parse(
       elem["commands_buffering_threshold"].As<size_t>(0);
   result.watch_command_timer_interval = std::chrono::microseconds(
       elem["watch_command_timer_interval_us"].As<size_t>());
+  result.commands_buffering_max_bytes =
+      elem["commands_buffering_max_bytes"].As<size_t>(0);
   return result;
 }
 
@@ -2,16 +2,20 @@
 
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include <userver/storages/redis/impl/base.hpp>
 #include <userver/storages/redis/impl/request.hpp>
 #include <userver/utils/assert.hpp>
 
 #include <userver/storages/redis/client.hpp>
+#include <userver/storages/redis/exception.hpp>
 #include <userver/storages/redis/parse_reply.hpp>
 #include <userver/storages/redis/request_data_base.hpp>
 
 #include "client_impl.hpp"
+#include "near_cache.hpp"
 #include "scan_reply.hpp"
 
 USERVER_NAMESPACE_BEGIN
@@ -77,13 +81,22 @@ class RequestDataImpl final : public RequestDataImplBase,
   }
 };
 
+/// Reassembles the replies of a multi-key command split by shards
 template <typename Result, typename ReplyType>
-class AggregateRequestDataImpl final : public RequestDataBase<ReplyType> {
+class SplitRequestDataImpl final : public RequestDataBase<ReplyType> {
   using RequestDataPtr = std::unique_ptr<RequestDataBase<ReplyType>>;
 
  public:
-  explicit AggregateRequestDataImpl(std::vector<RequestDataPtr>&& requests)
-      : requests_(std::move(requests)) {}
+  /// `positions[i]` are the positions of the keys of `requests[i]` among the
+  /// keys of the command
+  SplitRequestDataImpl(std::vector<RequestDataPtr>&& requests,
+                       std::vector<std::vector<size_t>>&& positions,
+                       size_t keys_count)
+      : requests_(std::move(requests)),
+        positions_(std::move(positions)),
+        keys_count_(keys_count) {
+    UASSERT(requests_.size() == positions_.size());
+  }
 
   void Wait() override {
     for (auto& request : requests_) {
@@ -92,12 +105,32 @@ class AggregateRequestDataImpl final : public RequestDataBase<ReplyType> {
   }
 
   ReplyType Get(const std::string& request_description) override {
-    std::vector<typename ReplyType::value_type> result;
-    for (auto& request : requests_) {
-      auto data = request->Get(request_description);
-      std::move(data.begin(), data.end(), std::back_inserter(result));
+    if constexpr (std::is_void_v<ReplyType>) {
+      for (auto& request : requests_) {
+        request->Get(request_description);
+      }
+    } else if constexpr (std::is_arithmetic_v<ReplyType>) {
+      ReplyType result{};
+      for (auto& request : requests_) {
+        result += request->Get(request_description);
+      }
+      return result;
+    } else {
+      ReplyType result(keys_count_);
+      for (size_t i = 0; i < requests_.size(); ++i) {
+        auto data = requests_[i]->Get(request_description);
+        if (data.size() != positions_[i].size()) {
+          throw USERVER_NAMESPACE::redis::ParseReplyException(
+              "Unexpected reply size " + std::to_string(data.size()) +
+              " != " + std::to_string(positions_[i].size()) +
+              ", request_description: " + request_description);
+        }
+        for (size_t j = 0; j < data.size(); ++j) {
+          result[positions_[i][j]] = std::move(data[j]);
+        }
+      }
+      return result;
     }
-    return result;
   }
 
   ReplyPtr GetRaw() override {
@@ -112,6 +145,8 @@ class AggregateRequestDataImpl final : public RequestDataBase<ReplyType> {
 
  private:
   std::vector<RequestDataPtr> requests_;
+  std::vector<std::vector<size_t>> positions_;
+  size_t keys_count_;
 };
 
 template <typename Result, typename ReplyType>
@@ -137,6 +172,43 @@ class DummyRequestDataImpl final : public RequestDataBase<ReplyType> {
   ReplyPtr reply_;
 };
 
+/// Stores the GET reply in the near cache once it is received
+class NearCacheGetRequestData final
+    : public RequestDataBase<std::optional<std::string>> {
+  using RequestDataPtr =
+      std::unique_ptr<RequestDataBase<std::optional<std::string>>>;
+
+ public:
+  NearCacheGetRequestData(RequestDataPtr&& request,
+                          std::shared_ptr<NearCache> near_cache,
+                          std::string key, NearCache::Ticket ticket)
+      : request_(std::move(request)),
+        near_cache_(std::move(near_cache)),
+        key_(std::move(key)),
+        ticket_(ticket) {}
+
+  void Wait() override { request_->Wait(); }
+
+  std::optional<std::string> Get(
+      const std::string& request_description) override {
+    auto result = request_->Get(request_description);
+    near_cache_->Put(key_, result, ticket_);
+    return result;
+  }
+
+  ReplyPtr GetRaw() override { return request_->GetRaw(); }
+
+  engine::impl::ContextAccessor* TryGetContextAccessor() noexcept override {
+    return request_->TryGetContextAccessor();
+  }
+
+ private:
+  RequestDataPtr request_;
+  std::shared_ptr<NearCache> near_cache_;
+  std::string key_;
+  NearCache::Ticket ticket_;
+};
+
 template <ScanTag scan_tag>
 class RequestScanData final : public RequestScanDataBase<scan_tag> {
  public:
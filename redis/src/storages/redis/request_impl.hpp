@@ -20,8 +20,9 @@ Request<Result, ReplyType> CreateRequest(
 }
 
 template <typename Result, typename ReplyType = Result>
-Request<Result, ReplyType> CreateAggregateRequest(
+Request<Result, ReplyType> CreateSplitRequest(
     std::vector<USERVER_NAMESPACE::redis::Request>&& requests,
+    std::vector<std::vector<size_t>>&& positions, size_t keys_count,
     Request<Result, ReplyType>* /* for ADL */) {
   std::vector<std::unique_ptr<RequestDataBase<ReplyType>>> req_data;
   req_data.reserve(requests.size());
@@ -30,8 +31,8 @@ Request<Result, ReplyType> CreateAggregateRequest(
         std::move(request)));
   }
   return Request<Result, ReplyType>(
-      std::make_unique<AggregateRequestDataImpl<Result, ReplyType>>(
-          std::move(req_data)));
+      std::make_unique<SplitRequestDataImpl<Result, ReplyType>>(
+          std::move(req_data), std::move(positions), keys_count));
 }
 
 template <typename Result, typename ReplyType = Result>
@@ -51,10 +52,12 @@ Request CreateRequest(USERVER_NAMESPACE::redis::Request&& request) {
 }
 
 template <typename Request>
-Request CreateAggregateRequest(
-    std::vector<USERVER_NAMESPACE::redis::Request>&& requests) {
+Request CreateSplitRequest(
+    std::vector<USERVER_NAMESPACE::redis::Request>&& requests,
+    std::vector<std::vector<size_t>>&& positions, size_t keys_count) {
   Request* tmp = nullptr;
-  return impl::CreateAggregateRequest(std::move(requests), tmp);
+  return impl::CreateSplitRequest(std::move(requests), std::move(positions),
+                                  keys_count, tmp);
 }
 
 template <typename Request>
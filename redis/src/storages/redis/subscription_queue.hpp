@@ -11,27 +11,30 @@ USERVER_NAMESPACE_BEGIN
 namespace storages::redis {
 
 struct ChannelSubscriptionQueueItem {
-  std::string message;
+  USERVER_NAMESPACE::redis::SharedMessage message;
 
   ChannelSubscriptionQueueItem() = default;
-  explicit ChannelSubscriptionQueueItem(std::string message)
+  explicit ChannelSubscriptionQueueItem(
+      USERVER_NAMESPACE::redis::SharedMessage message)
       : message(std::move(message)) {}
 };
 
 struct PatternSubscriptionQueueItem {
   std::string channel;
-  std::string message;
+  USERVER_NAMESPACE::redis::SharedMessage message;
 
   PatternSubscriptionQueueItem() = default;
-  PatternSubscriptionQueueItem(std::string channel, std::string message)
+  PatternSubscriptionQueueItem(std::string channel,
+                               USERVER_NAMESPACE::redis::SharedMessage message)
       : channel(std::move(channel)), message(std::move(message)) {}
 };
 
 struct ShardedSubscriptionQueueItem {
-  std::string message;
+  USERVER_NAMESPACE::redis::SharedMessage message;
 
   ShardedSubscriptionQueueItem() = default;
-  explicit ShardedSubscriptionQueueItem(std::string message)
+  explicit ShardedSubscriptionQueueItem(
+      USERVER_NAMESPACE::redis::SharedMessage message)
       : message(std::move(message)) {}
 };
 
@@ -3,10 +3,15 @@
 /// @file userver/storages/rocks/client.hpp
 /// @brief @copybrief storages::rocks::Client
 
+#include <cstddef>
+#include <memory>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include <rocksdb/db.h>
+#include <rocksdb/write_batch.h>
 
 #include <userver/engine/task/task_processor_fwd.hpp>
 
@@ -29,9 +34,14 @@ class Client final {
    * @param db_path The path to the RocksDB database.
    * @param blocking_task_processor - task processor to execute blocking FS
    * operations
+   * @param group_writes - whether to group the concurrent single-key writes
+   * into one WriteBatch, so that many of them share one WAL write
    */
   Client(const std::string& db_path,
-         engine::TaskProcessor& blocking_task_processor);
+         engine::TaskProcessor& blocking_task_processor,
+         bool group_writes = false);
+
+  ~Client();
 
   /**
    * @brief Puts a record into the database.
@@ -55,6 +65,33 @@ class Client final {
    */
   void Delete(std::string_view key);
 
+  /**
+   * @brief Retrieves the values of several records from the database.
+   *
+   * @param keys The keys of the records.
+   * @returns The values in the order of the keys, empty for the missing keys.
+   */
+  std::vector<std::string> MultiGet(const std::vector<std::string_view>& keys);
+
+  /**
+   * @brief Applies all the puts and deletes of the batch atomically.
+   *
+   * @param batch The batch of the updates.
+   */
+  void Write(rocksdb::WriteBatch& batch);
+
+  /**
+   * @brief Retrieves the records with the keys in [begin, end) in the order
+   * of the keys.
+   *
+   * @param begin The first key of the range.
+   * @param end The key after the range, empty for no upper bound.
+   * @param limit The maximum number of records to retrieve.
+   */
+  std::vector<std::pair<std::string, std::string>> Scan(std::string_view begin,
+                                                        std::string_view end,
+                                                        std::size_t limit);
+
   /**
    * Checks the status of an operation and handles any errors based on the given
    * method name.
@@ -65,8 +102,11 @@ class Client final {
   void CheckStatus(rocksdb::Status status, std::string_view method_name);
 
  private:
+  class WriteGroup;
+
   std::unique_ptr<rocksdb::DB> db_;
   engine::TaskProcessor& blocking_task_processor_;
+  std::unique_ptr<WriteGroup> write_group_;
 };
 }  // namespace storages::rocks
 
@@ -23,6 +23,7 @@ namespace storages::rocks {
 /// ---------------------------------- | ------------------------------------------------ | ---------------
 /// task-processor                     | name of the task processor to run the blocking file operations | -
 /// db-path                            | path to database file                            | -
+/// group-writes                       | whether to group the concurrent single-key writes into one WriteBatch | false
 
 // clang-format on
 
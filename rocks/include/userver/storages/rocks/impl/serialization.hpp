@@ -0,0 +1,60 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks::impl {
+
+/// A `dump::Writer` that appends to a string buffer
+class StringWriter final : public dump::Writer {
+ public:
+  void Finish() override;
+
+  std::string Extract() &&;
+
+ private:
+  void WriteRaw(std::string_view data) override;
+
+  std::string data_;
+};
+
+/// A `dump::Reader` that reads from a string buffer
+class StringReader final : public dump::Reader {
+ public:
+  explicit StringReader(std::string data);
+
+  void Finish() override;
+
+ private:
+  std::string_view ReadRaw(std::size_t max_size) override;
+
+  std::string data_;
+  std::string_view unread_data_;
+};
+
+/// Serializes the value in the format of the cache dumps
+template <typename T>
+std::string Serialize(const T& value) {
+  StringWriter writer;
+  writer.Write(value);
+  return std::move(writer).Extract();
+}
+
+/// Deserializes the value written by Serialize
+template <typename T>
+T Deserialize(std::string data) {
+  StringReader reader{std::move(data)};
+  T value = reader.Read<T>();
+  reader.Finish();
+  return value;
+}
+
+}  // namespace storages::rocks::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,142 @@
+#pragma once
+
+/// @file userver/storages/rocks/persistent_lru_cache_component.hpp
+/// @brief @copybrief storages::rocks::PersistentLruCacheComponent
+
+#include <chrono>
+#include <functional>
+#include <string>
+
+#include <userver/cache/lru_cache_component_base.hpp>
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/dump/common.hpp>
+#include <userver/dump/meta.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/rocks/client.hpp>
+#include <userver/storages/rocks/component.hpp>
+#include <userver/storages/rocks/impl/serialization.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks {
+
+// clang-format off
+
+/// @ingroup userver_components userver_base_classes
+///
+/// @brief Base class for LRU-cache components with a second tier in RocksDB
+///
+/// Works as cache::LruCacheComponent, but the values obtained from
+/// DoGetByKeyFromSource are also written into RocksDB. The values missing in
+/// memory, e.g. the evicted ones or all of them after a restart, are looked
+/// up in RocksDB before calling DoGetByKeyFromSource. The keys and the values
+/// are stored in the format of the cache dumps, so they must be dumpable.
+///
+/// The values stored in RocksDB expire after the static `lifetime` of the
+/// cache, the dynamic config does not affect them.
+///
+/// ## Static options:
+/// All the options of cache::LruCacheComponent and
+///
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// rocks-component | name of the storages::rocks::Component to keep the values in | --
+
+// clang-format on
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename Equal = std::equal_to<Key>>
+class PersistentLruCacheComponent
+    : public cache::LruCacheComponent<Key, Value, Hash, Equal> {
+ public:
+  PersistentLruCacheComponent(const components::ComponentConfig&,
+                              const components::ComponentContext&);
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ protected:
+  /// Override to fetch the values missing both in memory and in RocksDB
+  virtual Value DoGetByKeyFromSource(const Key& key) = 0;
+
+ private:
+  static_assert(dump::kIsDumpable<Key> && dump::kIsDumpable<Value>,
+                "The keys and the values of a persistent cache must be "
+                "dumpable");
+
+  Value DoGetByKey(const Key& key) final;
+
+  const std::string name_;
+  const std::chrono::milliseconds lifetime_;
+  const ClientPtr client_;
+};
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+PersistentLruCacheComponent<Key, Value, Hash, Equal>::
+    PersistentLruCacheComponent(const components::ComponentConfig& config,
+                                const components::ComponentContext& context)
+    : cache::LruCacheComponent<Key, Value, Hash, Equal>(config, context),
+      name_(components::GetCurrentComponentName(config)),
+      lifetime_(config["lifetime"].As<std::chrono::milliseconds>(0)),
+      client_(context
+                  .FindComponent<Component>(
+                      config["rocks-component"].As<std::string>())
+                  .MakeClient()) {}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+Value PersistentLruCacheComponent<Key, Value, Hash, Equal>::DoGetByKey(
+    const Key& key) {
+  // the caches may share a database, so the keys are prefixed with the name
+  const auto db_key = name_ + '/' + impl::Serialize(key);
+
+  auto data = client_->Get(db_key);
+  if (!data.empty()) {
+    try {
+      impl::StringReader reader{std::move(data)};
+      const auto updated = reader.Read<std::chrono::system_clock::time_point>();
+      auto value = reader.Read<Value>();
+      reader.Finish();
+      if (lifetime_.count() == 0 ||
+          utils::datetime::Now() - updated < lifetime_) {
+        return value;
+      }
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "Failed to read a value from RocksDB, cache=" << name_
+                    << ": " << ex;
+    }
+  }
+
+  auto value = DoGetByKeyFromSource(key);
+
+  try {
+    impl::StringWriter writer;
+    writer.Write(utils::datetime::Now());
+    writer.Write(value);
+    client_->Put(db_key, std::move(writer).Extract());
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "Failed to write a value into RocksDB, cache=" << name_
+                  << ": " << ex;
+  }
+
+  return value;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+yaml_config::Schema
+PersistentLruCacheComponent<Key, Value, Hash, Equal>::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<
+      cache::LruCacheComponent<Key, Value, Hash, Equal>>(R"(
+type: object
+description: LRU-cache component with a second tier in RocksDB
+additionalProperties: false
+properties:
+    rocks-component:
+        type: string
+        description: name of the storages::rocks::Component to keep the values in
+)");
+}
+
+}  // namespace storages::rocks
+
+USERVER_NAMESPACE_END
@@ -1,7 +1,13 @@
 #include <userver/storages/rocks/client.hpp>
 
+#include <exception>
+#include <optional>
+
 #include <fmt/format.h>
 
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/future.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/storages/rocks/exception.hpp>
 #include <userver/utils/async.hpp>
 
@@ -9,8 +15,96 @@ USERVER_NAMESPACE_BEGIN
 
 namespace storages::rocks {
 
+namespace {
+
+// The maximum number of the single-key writes grouped into one batch
+constexpr std::size_t kMaxWriteGroupSize = 1024;
+
+}  // namespace
+
+/// Groups the single-key writes of many coroutines into one WriteBatch, the
+/// writes that arrive while a batch is written go to the next one
+class Client::WriteGroup final {
+ public:
+  WriteGroup(rocksdb::DB& db, engine::TaskProcessor& task_processor)
+      : queue_(Queue::Create()),
+        producer_(queue_->GetMultiProducer()),
+        writer_task_(engine::CriticalAsyncNoSpan(
+            task_processor, [&db, consumer = queue_->GetConsumer()] {
+              Run(db, consumer);
+            })) {}
+
+  ~WriteGroup() {
+    // the writer finishes once the queue is drained and has no producers
+    producer_.reset();
+    writer_task_.Wait();
+  }
+
+  void Put(std::string_view key, std::string_view value) {
+    Write(Request{key, value, false, {}});
+  }
+
+  void Delete(std::string_view key) { Write(Request{key, {}, true, {}}); }
+
+ private:
+  struct Request final {
+    // point into the arguments of the waiting caller
+    std::string_view key;
+    std::string_view value;
+    bool is_delete{false};
+    engine::Promise<void> promise;
+  };
+
+  using Queue = concurrent::NonFifoMpscQueue<Request>;
+
+  void Write(Request&& request) {
+    auto future = request.promise.get_future();
+    if (!producer_->Push(std::move(request))) {
+      throw RequestFailedException("Write", "the client is shut down");
+    }
+    future.get();
+  }
+
+  static void Run(rocksdb::DB& db, const Queue::Consumer& consumer) {
+    std::vector<Request> group;
+    Request request;
+    while (consumer.Pop(request)) {
+      group.push_back(std::move(request));
+      while (group.size() < kMaxWriteGroupSize &&
+             consumer.PopNoblock(request)) {
+        group.push_back(std::move(request));
+      }
+
+      rocksdb::WriteBatch batch;
+      for (const auto& item : group) {
+        if (item.is_delete) {
+          batch.Delete(item.key);
+        } else {
+          batch.Put(item.key, item.value);
+        }
+      }
+
+      const auto status = db.Write(rocksdb::WriteOptions(), &batch);
+      for (auto& item : group) {
+        if (status.ok()) {
+          item.promise.set_value();
+        } else {
+          item.promise.set_exception(std::make_exception_ptr(
+              RequestFailedException("Write", status.ToString())));
+        }
+      }
+      group.clear();
+    }
+  }
+
+  std::shared_ptr<Queue> queue_;
+  std::optional<Queue::MultiProducer> producer_;
+  engine::TaskWithResult<void> writer_task_;
+};
+
 Client::Client(const std::string& db_path,
-               engine::TaskProcessor& blocking_task_processor)
+               engine::TaskProcessor& blocking_task_processor,
+               bool group_writes)
     : blocking_task_processor_(blocking_task_processor) {
   rocksdb::Options options;
   options.create_if_missing = true;
@@ -19,9 +113,20 @@ Client::Client(const std::string& db_path,
   rocksdb::Status status = rocksdb::DB::Open(options, db_path, &db);
   db_.reset(db);
   CheckStatus(status, "Create client");
+
+  if (group_writes) {
+    write_group_ = std::make_unique<WriteGroup>(*db_, blocking_task_processor_);
+  }
 }
 
+Client::~Client() = default;
+
 void Client::Put(std::string_view key, std::string_view value) {
+  if (write_group_) {
+    write_group_->Put(key, value);
+    return;
+  }
+
   engine::AsyncNoSpan(blocking_task_processor_, [this, key, value] {
     rocksdb::Status status = db_->Put(rocksdb::WriteOptions(), key, value);
     CheckStatus(status, "Put");
@@ -41,6 +146,11 @@ std::string Client::Get(std::string_view key) {
 }
 
 void Client::Delete(std::string_view key) {
+  if (write_group_) {
+    write_group_->Delete(key);
+    return;
+  }
+
   return engine::AsyncNoSpan(blocking_task_processor_,
                              [this, key] {
                                rocksdb::Status status =
@@ -50,6 +160,55 @@ void Client::Delete(std::string_view key) {
       .Get();
 }
 
+std::vector<std::string> Client::MultiGet(
+    const std::vector<std::string_view>& keys) {
+  return engine::AsyncNoSpan(
+             blocking_task_processor_,
+             [this, &keys] {
+               const std::vector<rocksdb::Slice> slices(keys.begin(),
+                                                        keys.end());
+               std::vector<std::string> values;
+               const auto statuses =
+                   db_->MultiGet(rocksdb::ReadOptions(), slices, &values);
+               for (std::size_t i = 0; i < statuses.size(); ++i) {
+                 CheckStatus(statuses[i], "MultiGet");
+                 if (statuses[i].IsNotFound()) values[i].clear();
+               }
+               return values;
+             })
+      .Get();
+}
+
+void Client::Write(rocksdb::WriteBatch& batch) {
+  engine::AsyncNoSpan(blocking_task_processor_, [this, &batch] {
+    rocksdb::Status status = db_->Write(rocksdb::WriteOptions(), &batch);
+    CheckStatus(status, "Write");
+  }).Get();
+}
+
+std::vector<std::pair<std::string, std::string>> Client::Scan(
+    std::string_view begin, std::string_view end, std::size_t limit) {
+  return engine::AsyncNoSpan(
+             blocking_task_processor_,
+             [this, begin, end, limit] {
+               const rocksdb::Slice upper_bound{end};
+               rocksdb::ReadOptions options;
+               if (!end.empty()) options.iterate_upper_bound = &upper_bound;
+
+               std::vector<std::pair<std::string, std::string>> result;
+               const std::unique_ptr<rocksdb::Iterator> it{
+                   db_->NewIterator(options)};
+               for (it->Seek(begin); it->Valid() && result.size() < limit;
+                    it->Next()) {
+                 result.emplace_back(it->key().ToString(),
+                                     it->value().ToString());
+               }
+               CheckStatus(it->status(), "Scan");
+               return result;
+             })
+      .Get();
+}
+
 void Client::CheckStatus(rocksdb::Status status, std::string_view method_name) {
   if (!status.ok() && !status.IsNotFound()) {
     throw USERVER_NAMESPACE::storages::rocks::RequestFailedException(
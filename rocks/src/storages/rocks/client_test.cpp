@@ -25,6 +25,50 @@ UTEST(Rocks, CheckCRUD) {
   EXPECT_EQ("", res);
 }
 
+UTEST(Rocks, Batches) {
+  storages::rocks::Client client{"/tmp/rocksdb_batches_example",
+                                 engine::current_task::GetTaskProcessor()};
+
+  rocksdb::WriteBatch batch;
+  batch.Put("batch_a", "1");
+  batch.Put("batch_b", "2");
+  batch.Put("batch_c", "3");
+  batch.Delete("batch_d");
+  client.Write(batch);
+
+  const auto values = client.MultiGet({"batch_a", "batch_d", "batch_c"});
+  EXPECT_EQ(values, (std::vector<std::string>{"1", "", "3"}));
+
+  const auto records = client.Scan("batch_b", "batch_d", 10);
+  ASSERT_EQ(records.size(), 2);
+  EXPECT_EQ(records[0].first, "batch_b");
+  EXPECT_EQ(records[1].second, "3");
+
+  EXPECT_EQ(client.Scan("batch_a", {}, 1).size(), 1);
+}
+
+UTEST_MT(Rocks, GroupedWrites, 4) {
+  storages::rocks::Client client{"/tmp/rocksdb_grouped_example",
+                                 engine::current_task::GetTaskProcessor(),
+                                 true};
+
+  constexpr int kTasks = 16;
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (int i = 0; i < kTasks; ++i) {
+    tasks.push_back(utils::Async("put", [&client, i] {
+      const auto key = "grouped_" + std::to_string(i);
+      client.Put(key, std::to_string(i));
+      if (i % 2) client.Delete(key);
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+
+  for (int i = 0; i < kTasks; ++i) {
+    EXPECT_EQ(client.Get("grouped_" + std::to_string(i)),
+              i % 2 ? "" : std::to_string(i));
+  }
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -15,7 +15,8 @@ Component::Component(const components::ComponentConfig& config,
       client_ptr_(std::make_shared<storages::rocks::Client>(
           config["db-path"].As<std::string>(),
           context.GetTaskProcessor(
-              config["task-processor"].As<std::string>()))) {}
+              config["task-processor"].As<std::string>()),
+          config["group-writes"].As<bool>(false))) {}
 
 storages::rocks::ClientPtr Component::MakeClient() { return client_ptr_; }
 
@@ -31,6 +32,12 @@ properties:
     db-path:
         type: string
         description: path to database file
+    group-writes:
+        type: boolean
+        description: |
+            whether to group the concurrent single-key writes into one
+            WriteBatch
+        defaultDescription: false
 )");
 }
 }  // namespace storages::rocks
@@ -0,0 +1,40 @@
+#include <userver/storages/rocks/impl/serialization.hpp>
+
+#include <algorithm>
+
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::rocks::impl {
+
+void StringWriter::Finish() {
+  // nothing to do
+}
+
+std::string StringWriter::Extract() && { return std::move(data_); }
+
+void StringWriter::WriteRaw(std::string_view data) { data_.append(data); }
+
+StringReader::StringReader(std::string data)
+    : data_(std::move(data)), unread_data_(data_) {}
+
+void StringReader::Finish() {
+  if (!unread_data_.empty()) {
+    throw dump::Error(fmt::format(
+        "Unexpected extra data at the end of the value: size={}, "
+        "unread-size={}",
+        data_.size(), unread_data_.size()));
+  }
+}
+
+std::string_view StringReader::ReadRaw(std::size_t max_size) {
+  const auto result_size = std::min(max_size, unread_data_.size());
+  const auto result = unread_data_.substr(0, result_size);
+  unread_data_ = unread_data_.substr(result_size);
+  return result;
+}
+
+}  // namespace storages::rocks::impl
+
+USERVER_NAMESPACE_END
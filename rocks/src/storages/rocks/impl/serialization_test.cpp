@@ -0,0 +1,28 @@
+#include <userver/storages/rocks/impl/serialization.hpp>
+
+#include <map>
+
+#include <userver/dump/common_containers.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace impl = storages::rocks::impl;
+
+TEST(RocksSerialization, RoundTrip) {
+  const std::map<std::string, int> value{{"a", 1}, {"b", 2}};
+  EXPECT_EQ(impl::Deserialize<decltype(value)>(impl::Serialize(value)),
+            value);
+  EXPECT_EQ(impl::Deserialize<std::string>(impl::Serialize(std::string{})),
+            "");
+}
+
+TEST(RocksSerialization, ExtraData) {
+  EXPECT_THROW(impl::Deserialize<int>(impl::Serialize(1) + "x"), dump::Error);
+}
+
+}  // namespace
+
+USERVER_NAMESPACE_END
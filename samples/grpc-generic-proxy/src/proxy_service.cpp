@@ -2,43 +2,14 @@
 
 #include <grpcpp/client_context.h>
 #include <grpcpp/server_context.h>
-#include <grpcpp/support/byte_buffer.h>
 
 #include <userver/components/component.hpp>
-#include <userver/ugrpc/byte_buffer_utils.hpp>
 #include <userver/ugrpc/client/generic.hpp>
 #include <userver/ugrpc/client/simple_client_component.hpp>
+#include <userver/ugrpc/server/generic_proxy.hpp>
 
 namespace samples {
 
-namespace {
-
-grpc::string ToGrpcString(grpc::string_ref str) {
-  return {str.data(), str.size()};
-}
-
-void ProxyRequestMetadata(const grpc::ServerContext& server_context,
-                          grpc::ClientContext& client_context) {
-  // Proxy all client (request) metadata,
-  // add some custom metadata as well.
-  for (const auto& [key, value] : server_context.client_metadata()) {
-    client_context.AddMetadata(ToGrpcString(key), ToGrpcString(value));
-  }
-  client_context.AddMetadata("proxy-name", "grpc-generic-proxy");
-}
-
-void ProxyTrailingResponseMetadata(const grpc::ClientContext& client_context,
-                                   grpc::ServerContext& server_context) {
-  // Proxy all server (response) trailing metadata,
-  // add some custom metadata as well.
-  for (const auto& [key, value] : client_context.GetServerTrailingMetadata()) {
-    server_context.AddTrailingMetadata(ToGrpcString(key), ToGrpcString(value));
-  }
-  server_context.AddTrailingMetadata("proxy-name", "grpc-generic-proxy");
-}
-
-}  // namespace
-
 ProxyService::ProxyService(const components::ComponentConfig& config,
                            const components::ComponentContext& context)
     : ugrpc::server::GenericServiceBase::Component(config, context),
@@ -48,7 +19,7 @@ ProxyService::ProxyService(const components::ComponentConfig& config,
                   .GetClient()) {}
 
 void ProxyService::Handle(Call& call) {
-  // In this example we proxy any unary RPC to client_, adding some metadata.
+  // In this example we proxy any RPC to client_, adding some metadata.
 
   // By default, generic service metrics are written with labels corresponding
   // to the fake 'Generic/Generic' call name.
@@ -57,59 +28,25 @@ void ProxyService::Handle(Call& call) {
   // Read docs on ugrpc::server::GenericServiceBase for details.
   call.SetMetricsCallName(call.GetCallName());
 
-  grpc::ByteBuffer request_bytes;
-  // Read might throw on a broken RPC, just rethrow then.
-  if (!call.Read(request_bytes)) {
-    // The client has already called WritesDone.
-    // We expect exactly 1 request, so that's an error for us.
-    call.FinishWithError(grpc::Status{grpc::StatusCode::INVALID_ARGUMENT,
-                                      "Expected exactly 1 request, given: 0"});
-    return;
-  }
-
-  grpc::ByteBuffer ignored_request_bytes;
-  // Wait until the client calls WritesDone before proceeding so that we know
-  // that no misuse will occur later. For unary RPCs, clients will essentially
-  // call WritesDone implicitly.
-  if (call.Read(ignored_request_bytes)) {
-    call.FinishWithError(
-        grpc::Status{grpc::StatusCode::INVALID_ARGUMENT,
-                     "Expected exactly 1 request, given: at least 2"});
-    return;
-  }
-
+  // All client (request) metadata is proxied, add some custom metadata
+  // as well.
   auto client_context = std::make_unique<grpc::ClientContext>();
-  ProxyRequestMetadata(call.GetContext(), *client_context);
+  client_context->AddMetadata("proxy-name", "grpc-generic-proxy");
+
+  // All server (response) trailing metadata is proxied, add some custom
+  // metadata as well.
+  call.GetContext().AddTrailingMetadata("proxy-name", "grpc-generic-proxy");
 
+  // Requests and responses are forwarded as soon as they arrive, so streaming
+  // RPCs are proxied without buffering. Errors returned from client_ are
+  // proxied as well.
+  //
   // Deadline propagation will work, as we've registered the DP middleware
   // in the config of grpc-server component.
   // Optionally, we can set an additional timeout using GenericOptions::qos.
-  auto client_rpc = client_.UnaryCall(call.GetCallName(), request_bytes,
-                                      std::move(client_context));
-
-  grpc::ByteBuffer response_bytes;
-  try {
-    response_bytes = client_rpc.Finish();
-  } catch (const ugrpc::client::ErrorWithStatus& ex) {
-    // Proxy the error returned from client.
-    ProxyTrailingResponseMetadata(client_rpc.GetContext(), call.GetContext());
-    call.FinishWithError(ex.GetStatus());
-    return;
-  } catch (const ugrpc::client::RpcError& ex) {
-    // Either the upstream client has cancelled our server RPC, or a network
-    // failure has occurred, or the deadline has expired. See:
-    // * ugrpc::client::RpcInterruptedError
-    // * ugrpc::client::RpcCancelledError
-    LOG_WARNING() << "Client RPC has failed: " << ex;
-    call.FinishWithError(grpc::Status{grpc::StatusCode::UNAVAILABLE,
-                                      "Failed to proxy the request"});
-    return;
-  }
-
-  ProxyTrailingResponseMetadata(client_rpc.GetContext(), call.GetContext());
-
-  // WriteAndFinish might throw on a broken RPC, just rethrow then.
-  call.WriteAndFinish(response_bytes);
+  //
+  // ProxyGenericCall might throw on a broken RPC, just rethrow then.
+  ugrpc::server::ProxyGenericCall(call, client_, std::move(client_context));
 }
 
 }  // namespace samples
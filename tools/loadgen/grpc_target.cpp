@@ -0,0 +1,69 @@
+#include "target.hpp"
+
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/slice.h>
+
+#include <userver/dynamic_config/test_helpers.hpp>
+#include <userver/engine/task/task_base.hpp>
+#include <userver/testsuite/grpc_control.hpp>
+#include <userver/ugrpc/client/client_factory.hpp>
+#include <userver/ugrpc/client/generic.hpp>
+#include <userver/ugrpc/client/queue_holder.hpp>
+#include <userver/utils/statistics/storage.hpp>
+
+#include <userver/utest/using_namespace_userver.hpp>
+
+namespace loadgen {
+
+namespace {
+
+ugrpc::client::ClientFactorySettings MakeClientFactorySettings(
+    const GrpcTargetConfig& config) {
+  ugrpc::client::ClientFactorySettings settings;
+  settings.channel_count = config.channels;
+  return settings;
+}
+
+class GrpcTarget final : public Target {
+ public:
+  explicit GrpcTarget(const GrpcTargetConfig& config)
+      : method_(config.method),
+        timeout_(config.timeout),
+        queue_holder_(config.completion_queues, false),
+        client_factory_(MakeClientFactorySettings(config),
+                        engine::current_task::GetTaskProcessor(), {},
+                        queue_holder_.GetQueue(), statistics_storage_,
+                        testsuite_grpc_, dynamic_config::GetDefaultSource()),
+        client_(client_factory_.MakeClient<ugrpc::client::GenericClient>(
+            "loadgen", config.endpoint)) {
+    grpc::Slice slice{config.request};
+    request_ = grpc::ByteBuffer{&slice, 1};
+  }
+
+  void Call() const override {
+    auto context = std::make_unique<grpc::ClientContext>();
+    context->set_deadline(std::chrono::system_clock::now() + timeout_);
+
+    auto call = client_.UnaryCall(method_, request_, std::move(context));
+    call.Finish();
+  }
+
+ private:
+  const std::string method_;
+  const std::chrono::milliseconds timeout_;
+  grpc::ByteBuffer request_;
+
+  utils::statistics::Storage statistics_storage_;
+  testsuite::GrpcControl testsuite_grpc_;
+  ugrpc::client::QueueHolder queue_holder_;
+  ugrpc::client::ClientFactory client_factory_;
+  ugrpc::client::GenericClient client_;
+};
+
+}  // namespace
+
+std::unique_ptr<Target> MakeGrpcTarget(const GrpcTargetConfig& config) {
+  return std::make_unique<GrpcTarget>(config);
+}
+
+}  // namespace loadgen
@@ -0,0 +1,76 @@
+#include "target.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/clients/http/request_template.hpp>
+#include <userver/engine/task/task_base.hpp>
+#include <userver/http/common_headers.hpp>
+
+#include <userver/utest/using_namespace_userver.hpp>
+
+namespace loadgen {
+
+namespace {
+
+namespace http = clients::http;
+
+http::HttpMethod ParseMethod(const std::string& method) {
+  if (method == "GET") return http::HttpMethod::kGet;
+  if (method == "POST") return http::HttpMethod::kPost;
+  if (method == "PUT") return http::HttpMethod::kPut;
+  if (method == "PATCH") return http::HttpMethod::kPatch;
+  if (method == "DELETE") return http::HttpMethod::kDelete;
+  if (method == "HEAD") return http::HttpMethod::kHead;
+  throw std::runtime_error(fmt::format("Unknown HTTP method '{}'", method));
+}
+
+class HttpTarget final : public Target {
+ public:
+  explicit HttpTarget(const HttpTargetConfig& config)
+      : client_({"loadgen", config.io_threads},
+                engine::current_task::GetTaskProcessor(),
+                std::vector<utils::NotNull<http::Plugin*>>{}),
+        body_(config.body.empty()
+                  ? nullptr
+                  : std::make_shared<const std::string>(config.body)) {
+    client_.SetMultiplexingEnabled(config.http2);
+
+    request_template_.method(ParseMethod(config.method))
+        .url(config.url)
+        .timeout(config.timeout)
+        .retry(1)
+        .http_version(config.http2 ? http::HttpVersion::k2PriorKnowledge
+                                   : http::HttpVersion::k11);
+    if (!config.content_type.empty()) {
+      request_template_.headers(
+          {{USERVER_NAMESPACE::http::headers::kContentType,
+            config.content_type}});
+    }
+  }
+
+  void Call() const override {
+    auto request = client_.CreateRequest();
+    request.ApplyTemplate(request_template_);
+    if (body_) request.data(body_);
+
+    const auto response = request.perform();
+    response->raise_for_status();
+  }
+
+ private:
+  mutable http::Client client_;
+  http::RequestTemplate request_template_;
+  const std::shared_ptr<const std::string> body_;
+};
+
+}  // namespace
+
+std::unique_ptr<Target> MakeHttpTarget(const HttpTargetConfig& config) {
+  return std::make_unique<HttpTarget>(config);
+}
+
+}  // namespace loadgen
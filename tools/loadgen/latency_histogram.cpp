@@ -0,0 +1,159 @@
+#include "latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+
+#include <fmt/format.h>
+
+namespace loadgen {
+
+namespace {
+
+constexpr int kTicksPerHalfDistance = 5;
+constexpr double kMicrosecondsPerUnit = 1000.0;
+
+void UpdateMax(std::atomic<std::uint64_t>& max, std::uint64_t value) noexcept {
+  auto current = max.load(std::memory_order_relaxed);
+  while (current < value && !max.compare_exchange_weak(
+                                current, value, std::memory_order_relaxed)) {
+  }
+}
+
+}  // namespace
+
+LatencyHistogram::LatencyHistogram(std::chrono::microseconds max_value)
+    : max_value_(std::max<std::int64_t>(max_value.count(), 1)),
+      buckets_count_(GetIndex(max_value_) + 1),
+      buckets_(std::make_unique<std::atomic<std::uint64_t>[]>(buckets_count_)) {
+  for (std::size_t i = 0; i < buckets_count_; ++i) {
+    buckets_[i].store(0, std::memory_order_relaxed);
+  }
+}
+
+void LatencyHistogram::Record(std::chrono::microseconds value) noexcept {
+  const auto clamped = std::min<std::uint64_t>(
+      std::max<std::int64_t>(value.count(), 0), max_value_);
+  buckets_[GetIndex(clamped)].fetch_add(1, std::memory_order_relaxed);
+  total_count_.fetch_add(1, std::memory_order_relaxed);
+  total_sum_.fetch_add(clamped, std::memory_order_relaxed);
+  UpdateMax(max_, clamped);
+}
+
+std::uint64_t LatencyHistogram::GetTotalCount() const noexcept {
+  return total_count_.load(std::memory_order_relaxed);
+}
+
+std::chrono::microseconds LatencyHistogram::GetValueAtPercentile(
+    double percentile) const {
+  if (GetTotalCount() == 0) return std::chrono::microseconds{0};
+  const auto value =
+      GetHighestEquivalentValue(GetIndexAtPercentile(percentile));
+  return std::chrono::microseconds{
+      std::min(value, max_.load(std::memory_order_relaxed))};
+}
+
+std::chrono::microseconds LatencyHistogram::GetMax() const noexcept {
+  return std::chrono::microseconds{max_.load(std::memory_order_relaxed)};
+}
+
+double LatencyHistogram::GetMeanMicroseconds() const noexcept {
+  const auto count = GetTotalCount();
+  if (count == 0) return 0;
+  return static_cast<double>(total_sum_.load(std::memory_order_relaxed)) /
+         static_cast<double>(count);
+}
+
+void LatencyHistogram::WritePercentiles(std::ostream& out) const {
+  const auto total = GetTotalCount();
+  const auto max = max_.load(std::memory_order_relaxed);
+  const auto to_units = [max](std::uint64_t value) {
+    return static_cast<double>(std::min(value, max)) / kMicrosecondsPerUnit;
+  };
+
+  out << fmt::format("{:>12} {:>14} {:>10} {:>14}\n\n", "Value", "Percentile",
+                     "TotalCount", "1/(1-Percentile)");
+
+  double percentile = 0;
+  while (total != 0 && percentile < 100 &&
+         (100 - percentile) / 100 * static_cast<double>(total) >= 1) {
+    const auto index = GetIndexAtPercentile(percentile);
+    const auto fraction = percentile / 100;
+    out << fmt::format("{:12.3f} {:2.12f} {:10d} {:14.2f}\n",
+                       to_units(GetHighestEquivalentValue(index)), fraction,
+                       GetCountUpTo(index), 1 / (1 - fraction));
+
+    // Same steps as HdrHistogram: the closer to 100%, the smaller the step
+    const auto half_distance = std::pow(
+        2, std::floor(std::log2(100 / (100 - percentile))) + 1);
+    percentile += 100 / (kTicksPerHalfDistance * half_distance);
+  }
+  if (total != 0) {
+    out << fmt::format("{:12.3f} {:2.12f} {:10d}\n", to_units(max), 1.0,
+                       total);
+  }
+
+  double mean = 0;
+  double variance = 0;
+  if (total != 0) {
+    for (std::size_t i = 0; i < buckets_count_; ++i) {
+      const auto count = buckets_[i].load(std::memory_order_relaxed);
+      mean += to_units(GetHighestEquivalentValue(i)) * count;
+    }
+    mean /= total;
+    for (std::size_t i = 0; i < buckets_count_; ++i) {
+      const auto count = buckets_[i].load(std::memory_order_relaxed);
+      const auto deviation = to_units(GetHighestEquivalentValue(i)) - mean;
+      variance += deviation * deviation * count;
+    }
+    variance /= total;
+  }
+
+  out << fmt::format("#[Mean    = {:12.3f}, StdDeviation   = {:12.3f}]\n",
+                     mean, std::sqrt(variance));
+  out << fmt::format("#[Max     = {:12.3f}, Total count    = {:12d}]\n",
+                     to_units(max), total);
+  out << fmt::format("#[Buckets = {:12d}, SubBuckets     = {:12d}]\n",
+                     buckets_count_ >> kSubBits, std::size_t{1} << kSubBits);
+}
+
+std::size_t LatencyHistogram::GetIndex(std::uint64_t value) noexcept {
+  if (value < (std::uint64_t{2} << kSubBits)) return value;
+  const int exponent = 63 - __builtin_clzll(value);
+  const int shift = exponent - kSubBits;
+  return (static_cast<std::size_t>(shift) << kSubBits) + (value >> shift);
+}
+
+std::uint64_t LatencyHistogram::GetHighestEquivalentValue(
+    std::size_t index) noexcept {
+  if (index < (std::size_t{2} << kSubBits)) return index;
+  const auto shift = (index >> kSubBits) - 1;
+  const auto mantissa = index - (shift << kSubBits);
+  return ((static_cast<std::uint64_t>(mantissa) + 1) << shift) - 1;
+}
+
+std::uint64_t LatencyHistogram::GetCountUpTo(std::size_t index) const noexcept {
+  std::uint64_t count = 0;
+  for (std::size_t i = 0; i <= index; ++i) {
+    count += buckets_[i].load(std::memory_order_relaxed);
+  }
+  return count;
+}
+
+std::size_t LatencyHistogram::GetIndexAtPercentile(
+    double percentile) const noexcept {
+  const auto total = GetTotalCount();
+  const auto target = std::clamp<std::uint64_t>(
+      static_cast<std::uint64_t>(
+          std::ceil(std::clamp(percentile, 0.0, 100.0) / 100 * total)),
+      1, total);
+
+  std::uint64_t count = 0;
+  for (std::size_t i = 0; i < buckets_count_; ++i) {
+    count += buckets_[i].load(std::memory_order_relaxed);
+    if (count >= target) return i;
+  }
+  return buckets_count_ - 1;
+}
+
+}  // namespace loadgen
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+
+namespace loadgen {
+
+/// Latency histogram with the HdrHistogram bucketing: values up to
+/// 2^(kSubBits + 1) microseconds are stored exactly, larger values with a
+/// relative error below 1 / 2^kSubBits. Recording is lock-free and may be done
+/// concurrently.
+class LatencyHistogram final {
+ public:
+  /// Larger values are accounted as `max_value`
+  explicit LatencyHistogram(std::chrono::microseconds max_value);
+
+  void Record(std::chrono::microseconds value) noexcept;
+
+  std::uint64_t GetTotalCount() const noexcept;
+
+  /// @param percentile in [0, 100]
+  std::chrono::microseconds GetValueAtPercentile(double percentile) const;
+
+  std::chrono::microseconds GetMax() const noexcept;
+
+  double GetMeanMicroseconds() const noexcept;
+
+  /// Writes the percentile distribution in the HdrHistogram text (.hgrm)
+  /// format, values are in milliseconds
+  void WritePercentiles(std::ostream& out) const;
+
+ private:
+  static constexpr int kSubBits = 7;
+
+  static std::size_t GetIndex(std::uint64_t value) noexcept;
+  static std::uint64_t GetHighestEquivalentValue(std::size_t index) noexcept;
+
+  std::uint64_t GetCountUpTo(std::size_t index) const noexcept;
+  std::size_t GetIndexAtPercentile(double percentile) const noexcept;
+
+  const std::uint64_t max_value_;
+  const std::size_t buckets_count_;
+  std::unique_ptr<std::atomic<std::uint64_t>[]> buckets_;
+  std::atomic<std::uint64_t> total_count_{0};
+  std::atomic<std::uint64_t> total_sum_{0};
+  std::atomic<std::uint64_t> max_{0};
+};
+
+}  // namespace loadgen
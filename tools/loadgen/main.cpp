@@ -0,0 +1,237 @@
+// Open-loop load generator for HTTP and gRPC services.
+//
+// Requests are started at a fixed rate that does not depend on the response
+// times, and latencies are measured from the scheduled start of a request.
+// The report is written as an HdrHistogram percentile distribution (.hgrm)
+// and, optionally, as a JSON summary for the tools/loadgen/run_samples.py
+// benchmark suite.
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+
+#include <boost/program_options.hpp>
+
+#include <userver/engine/run_standalone.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/logging/logger.hpp>
+
+#include <userver/utest/using_namespace_userver.hpp>
+
+#include "open_loop.hpp"
+#include "target.hpp"
+
+namespace {
+
+constexpr std::chrono::seconds kMaxLatency{60};
+
+struct Config {
+  std::string log_level = "error";
+  std::size_t worker_threads = 1;
+
+  std::optional<loadgen::HttpTargetConfig> http;
+  std::optional<loadgen::GrpcTargetConfig> grpc;
+  loadgen::OpenLoopSettings open_loop;
+
+  std::string hgrm_file;
+  std::string json_file;
+};
+
+std::string ReadFile(const std::string& path) {
+  std::ifstream infile(path, std::ios::binary);
+  if (!infile.is_open()) {
+    std::cerr << "failed to open " << path << std::endl;
+    exit(1);
+  }
+  return {std::istreambuf_iterator<char>(infile),
+          std::istreambuf_iterator<char>()};
+}
+
+Config ParseConfig(int argc, char* argv[]) {
+  namespace po = boost::program_options;
+
+  Config config;
+  std::string url;
+  std::string http_method = "GET";
+  std::string body_file;
+  std::string content_type;
+  bool http2 = false;
+  std::string grpc_endpoint;
+  std::string grpc_method;
+  std::string grpc_request_file;
+  std::size_t io_threads = 1;
+  std::size_t grpc_channels = 1;
+  long timeout_ms = 1000;
+  double duration_s = 10;
+  double warmup_s = 1;
+
+  po::options_description desc("Allowed options");
+  desc.add_options()("help,h", "produce help message")(
+      "log-level",
+      po::value(&config.log_level)->default_value(config.log_level),
+      "log level (trace, debug, info, warning, error)")(
+      "worker-threads",
+      po::value(&config.worker_threads)->default_value(config.worker_threads),
+      "worker thread count")(
+      "io-threads", po::value(&io_threads)->default_value(io_threads),
+      "HTTP client io threads or gRPC completion queues count")(
+      "url", po::value(&url), "HTTP URL to load")(
+      "method", po::value(&http_method)->default_value(http_method),
+      "HTTP method")("body-file", po::value(&body_file),
+                     "file with the HTTP request body")(
+      "content-type", po::value(&content_type), "HTTP Content-Type header")(
+      "http2", po::bool_switch(&http2), "use HTTP/2 with prior knowledge")(
+      "grpc-endpoint", po::value(&grpc_endpoint),
+      "gRPC endpoint to load, e.g. [::1]:8091")(
+      "grpc-method", po::value(&grpc_method),
+      "gRPC method as full.path.to.TheService/MethodName")(
+      "grpc-request-file", po::value(&grpc_request_file),
+      "file with the serialized gRPC request message")(
+      "grpc-channels", po::value(&grpc_channels)->default_value(grpc_channels),
+      "gRPC channels count")(
+      "rate,r",
+      po::value(&config.open_loop.rate)->default_value(config.open_loop.rate),
+      "requests per second")(
+      "duration,d", po::value(&duration_s)->default_value(duration_s),
+      "test duration in seconds, including the warmup")(
+      "warmup", po::value(&warmup_s)->default_value(warmup_s),
+      "warmup in seconds, the requests of the warmup are not accounted")(
+      "max-in-flight",
+      po::value(&config.open_loop.max_in_flight)
+          ->default_value(config.open_loop.max_in_flight),
+      "maximum requests in flight, the excess requests are dropped")(
+      "timeout,t", po::value(&timeout_ms)->default_value(timeout_ms),
+      "request timeout in ms")(
+      "hgrm-file", po::value(&config.hgrm_file),
+      "file for the HdrHistogram percentile distribution, stdout by default")(
+      "json-file", po::value(&config.json_file),
+      "file for the JSON summary");
+
+  po::variables_map vm;
+  po::store(po::parse_command_line(argc, argv, desc), vm);
+  po::notify(vm);
+
+  if (vm.count("help")) {
+    std::cout << desc << std::endl;
+    exit(0);
+  }
+
+  if (url.empty() == grpc_endpoint.empty()) {
+    std::cerr << "exactly one of --url and --grpc-endpoint must be set"
+              << std::endl;
+    std::cout << desc << std::endl;
+    exit(1);
+  }
+  if (config.open_loop.rate <= 0 || warmup_s < 0 || duration_s <= warmup_s) {
+    std::cerr << "rate must be positive and duration must exceed warmup"
+              << std::endl;
+    exit(1);
+  }
+
+  const std::chrono::milliseconds timeout{timeout_ms};
+  config.open_loop.duration =
+      std::chrono::milliseconds{static_cast<long>(duration_s * 1000)};
+  config.open_loop.warmup =
+      std::chrono::milliseconds{static_cast<long>(warmup_s * 1000)};
+
+  if (!url.empty()) {
+    auto& http = config.http.emplace();
+    http.url = url;
+    http.method = http_method;
+    if (!body_file.empty()) http.body = ReadFile(body_file);
+    http.content_type = content_type;
+    http.timeout = timeout;
+    http.io_threads = io_threads;
+    http.http2 = http2;
+  } else {
+    if (grpc_method.empty()) {
+      std::cerr << "--grpc-method is required for gRPC" << std::endl;
+      exit(1);
+    }
+    auto& grpc = config.grpc.emplace();
+    grpc.endpoint = grpc_endpoint;
+    grpc.method = grpc_method;
+    if (!grpc_request_file.empty()) grpc.request = ReadFile(grpc_request_file);
+    grpc.timeout = timeout;
+    grpc.channels = grpc_channels;
+    grpc.completion_queues = io_threads;
+  }
+
+  return config;
+}
+
+double ToMilliseconds(std::chrono::microseconds value) {
+  return static_cast<double>(value.count()) / 1000;
+}
+
+void WriteJsonSummary(const Config& config,
+                      const loadgen::OpenLoopStats& stats) {
+  const auto& latencies = stats.latencies;
+  const auto elapsed_s = static_cast<double>(stats.elapsed.count()) / 1e6;
+
+  formats::json::ValueBuilder summary;
+  summary["rate"] = config.open_loop.rate;
+  summary["elapsed_s"] = elapsed_s;
+  summary["succeeded"] = stats.succeeded.load();
+  summary["failed"] = stats.failed.load();
+  summary["dropped"] = stats.dropped.load();
+  summary["throughput"] =
+      elapsed_s > 0 ? static_cast<double>(stats.succeeded.load()) / elapsed_s
+                    : 0.0;
+  summary["mean_ms"] = latencies.GetMeanMicroseconds() / 1000;
+  summary["p50_ms"] = ToMilliseconds(latencies.GetValueAtPercentile(50));
+  summary["p90_ms"] = ToMilliseconds(latencies.GetValueAtPercentile(90));
+  summary["p99_ms"] = ToMilliseconds(latencies.GetValueAtPercentile(99));
+  summary["p999_ms"] = ToMilliseconds(latencies.GetValueAtPercentile(99.9));
+  summary["max_ms"] = ToMilliseconds(latencies.GetMax());
+
+  std::ofstream out(config.json_file);
+  out << formats::json::ToString(summary.ExtractValue()) << std::endl;
+}
+
+std::unique_ptr<loadgen::Target> MakeTarget(const Config& config) {
+  if (config.http) return loadgen::MakeHttpTarget(*config.http);
+#ifdef USERVER_LOADGEN_GRPC
+  return loadgen::MakeGrpcTarget(*config.grpc);
+#else
+  throw std::runtime_error("loadgen is built without gRPC support");
+#endif
+}
+
+void DoWork(const Config& config, loadgen::OpenLoopStats& stats) {
+  const auto target = MakeTarget(config);
+  loadgen::RunOpenLoop(
+      config.open_loop, [&target] { target->Call(); }, stats);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const Config config = ParseConfig(argc, argv);
+
+  auto logger = logging::MakeStderrLogger(
+      "default", logging::Format::kTskv,
+      logging::LevelFromString(config.log_level));
+  logging::DefaultLoggerGuard guard{logger};
+
+  loadgen::OpenLoopStats stats{kMaxLatency};
+  engine::RunStandalone(config.worker_threads,
+                        [&] { DoWork(config, stats); });
+
+  if (config.hgrm_file.empty()) {
+    stats.latencies.WritePercentiles(std::cout);
+  } else {
+    std::ofstream out(config.hgrm_file);
+    stats.latencies.WritePercentiles(out);
+  }
+  if (!config.json_file.empty()) WriteJsonSummary(config, stats);
+
+  std::cerr << "succeeded=" << stats.succeeded << " failed=" << stats.failed
+            << " dropped=" << stats.dropped << " p99="
+            << ToMilliseconds(stats.latencies.GetValueAtPercentile(99))
+            << "ms" << std::endl;
+}
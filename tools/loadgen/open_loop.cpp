@@ -0,0 +1,64 @@
+#include "open_loop.hpp"
+
+#include <exception>
+
+#include <userver/concurrent/background_task_storage.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task_base.hpp>
+#include <userver/logging/log.hpp>
+
+#include <userver/utest/using_namespace_userver.hpp>
+
+namespace loadgen {
+
+void RunOpenLoop(const OpenLoopSettings& settings,
+                 const std::function<void()>& call, OpenLoopStats& stats) {
+  using Clock = std::chrono::steady_clock;
+
+  const std::chrono::duration<double> period{1 / settings.rate};
+  const auto start = Clock::now();
+  const auto measure_start = start + settings.warmup;
+  const auto stop = start + settings.duration;
+
+  concurrent::BackgroundTaskStorageCore tasks;
+  auto& task_processor = engine::current_task::GetTaskProcessor();
+
+  for (std::uint64_t i = 0;; ++i) {
+    // The schedule does not depend on the responses, a late start is not
+    // compensated by shifting the rest of the requests
+    const auto scheduled =
+        start + std::chrono::duration_cast<Clock::duration>(period * i);
+    if (scheduled >= stop) break;
+    engine::SleepUntil(scheduled);
+
+    const bool is_measured = scheduled >= measure_start;
+    if (tasks.ActiveTasksApprox() >= settings.max_in_flight) {
+      if (is_measured) ++stats.dropped;
+      continue;
+    }
+
+    tasks.Detach(engine::AsyncNoSpan(
+        task_processor, [&call, &stats, scheduled, is_measured] {
+          bool is_ok = true;
+          try {
+            call();
+          } catch (const std::exception& ex) {
+            LOG_INFO() << "Request failed: " << ex;
+            is_ok = false;
+          }
+          if (!is_measured) return;
+
+          stats.latencies.Record(
+              std::chrono::duration_cast<std::chrono::microseconds>(
+                  Clock::now() - scheduled));
+          ++(is_ok ? stats.succeeded : stats.failed);
+        }));
+  }
+
+  tasks.CloseAndWaitDebug();
+  stats.elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+      Clock::now() - measure_start);
+}
+
+}  // namespace loadgen
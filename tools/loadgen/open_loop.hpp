@@ -0,0 +1,45 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
+#include "latency_histogram.hpp"
+
+namespace loadgen {
+
+struct OpenLoopSettings final {
+  /// Requests per second, the requests are started at a fixed rate
+  /// regardless of the responses
+  double rate{100};
+  std::chrono::milliseconds duration{std::chrono::seconds{10}};
+  /// Requests started during the warmup are not accounted
+  std::chrono::milliseconds warmup{std::chrono::seconds{1}};
+  /// Requests that would exceed the limit are not sent and are counted as
+  /// dropped
+  std::int64_t max_in_flight{10000};
+};
+
+struct OpenLoopStats final {
+  explicit OpenLoopStats(std::chrono::microseconds max_latency)
+      : latencies(max_latency) {}
+
+  /// Measured from the moment the request was scheduled to be sent, so
+  /// a stalled target accounts the whole wait of the queued requests, not
+  /// only the time of a single request (no coordinated omission)
+  LatencyHistogram latencies;
+  std::atomic<std::uint64_t> succeeded{0};
+  std::atomic<std::uint64_t> failed{0};
+  std::atomic<std::uint64_t> dropped{0};
+  /// Time from the end of the warmup to the completion of the last request
+  std::chrono::microseconds elapsed{0};
+};
+
+/// Calls `call` in separate coroutines of the current task processor at the
+/// `settings.rate` until `settings.duration` passes, then waits for the calls
+/// in flight. `call` reports errors by throwing.
+void RunOpenLoop(const OpenLoopSettings& settings,
+                 const std::function<void()>& call, OpenLoopStats& stats);
+
+}  // namespace loadgen
@@ -0,0 +1,303 @@
+#!/usr/bin/env python3
+"""
+End-to-end latency benchmark of the userver samples.
+
+Starts each sample service with a fixed worker thread count, loads it with
+the open-loop `loadgen` tool at a fixed rate, and collects the JSON summaries
+into a single results file. With `--baseline` the results are compared with
+a previous run and the script fails on throughput or p99 latency
+regressions.
+
+Usage:
+    run_samples.py --loadgen ./loadgen \
+        --hello-service ./userver-samples-hello_service \
+        --output-dir ./loadgen-results
+"""
+
+import argparse
+import json
+import os
+import pathlib
+import signal
+import socket
+import subprocess
+import sys
+import time
+import urllib.request
+
+import yaml
+
+SAMPLES_DIR = pathlib.Path(__file__).resolve().parents[2] / 'samples'
+
+# Serialized `samples.api.GreetingRequest{name: "userver"}`
+GREETING_REQUEST = bytes.fromhex('0a0775736572766572')
+
+
+class Sample:
+    def __init__(self, name, config_dir, port, loadgen_args, prepare=None):
+        self.name = name
+        self.config_dir = config_dir
+        self.port = port
+        self.loadgen_args = loadgen_args
+        self.prepare = prepare
+
+    def make_config(self, worker_threads, options):
+        with open(SAMPLES_DIR / self.config_dir / 'static_config.yaml') as inp:
+            config = yaml.safe_load(inp)
+
+        manager = config['components_manager']
+        processors = manager['task_processors']
+        processors['main-task-processor']['worker_threads'] = worker_threads
+
+        components = manager['components']
+        components['logging']['loggers']['default']['level'] = 'error'
+        self.patch_components(components, options)
+        return config
+
+    def patch_components(self, components, options):
+        pass
+
+
+class HelloSample(Sample):
+    def __init__(self):
+        super().__init__(
+            'hello_service',
+            'hello_service',
+            port=8080,
+            loadgen_args=['--url', 'http://localhost:8080/hello'],
+        )
+
+
+class GrpcSample(Sample):
+    GRPC_PORT = 8091
+
+    def __init__(self, request_file):
+        super().__init__(
+            'grpc_service',
+            'grpc_service',
+            port=self.GRPC_PORT,
+            loadgen_args=[
+                '--grpc-endpoint',
+                f'[::1]:{self.GRPC_PORT}',
+                '--grpc-method',
+                'samples.api.GreeterService/SayHello',
+                '--grpc-request-file',
+                str(request_file),
+            ],
+        )
+
+    def patch_components(self, components, options):
+        server = components['grpc-server']
+        server.pop('port#fallback', None)
+        server['port'] = self.GRPC_PORT
+
+
+class PostgresSample(Sample):
+    URL = 'http://localhost:8087/v1/key-value?key=loadgen'
+
+    def __init__(self):
+        super().__init__(
+            'postgres_service',
+            'postgres_service',
+            port=8087,
+            loadgen_args=['--url', self.URL],
+            prepare=self.insert_key,
+        )
+
+    def patch_components(self, components, options):
+        database = components['key-value-database']
+        database['dbconnection'] = options.postgres_dsn
+
+    def insert_key(self):
+        request = urllib.request.Request(self.URL + '&value=1', method='POST')
+        with urllib.request.urlopen(request, timeout=5):
+            pass
+
+
+def wait_for_port(port, process, timeout):
+    deadline = time.monotonic() + timeout
+    while time.monotonic() < deadline:
+        if process.poll() is not None:
+            raise RuntimeError(f'service exited with code {process.returncode}')
+        try:
+            with socket.create_connection(('localhost', port), timeout=0.5):
+                return
+        except OSError:
+            time.sleep(0.1)
+    raise RuntimeError(f'service did not open port {port} in {timeout}s')
+
+
+def stop_service(process):
+    if process.poll() is not None:
+        return
+    process.send_signal(signal.SIGTERM)
+    try:
+        process.wait(timeout=30)
+    except subprocess.TimeoutExpired:
+        process.kill()
+        process.wait()
+
+
+def run_sample(sample, binary, worker_threads, options, work_dir):
+    run_name = f'{sample.name}-{worker_threads}'
+    config_path = work_dir / f'{run_name}.yaml'
+    with open(config_path, 'w') as out:
+        yaml.safe_dump(sample.make_config(worker_threads, options), out)
+
+    json_path = work_dir / f'{run_name}.json'
+    hgrm_path = work_dir / f'{run_name}.hgrm'
+    log_path = work_dir / f'{run_name}.log'
+
+    with open(log_path, 'w') as log:
+        service = subprocess.Popen(
+            [binary, '--config', str(config_path)],
+            stdout=log,
+            stderr=subprocess.STDOUT,
+        )
+        try:
+            wait_for_port(sample.port, service, options.startup_timeout)
+            if sample.prepare:
+                sample.prepare()
+
+            command = [
+                options.loadgen,
+                *sample.loadgen_args,
+                '--rate',
+                str(options.rate),
+                '--duration',
+                str(options.duration),
+                '--warmup',
+                str(options.warmup),
+                '--worker-threads',
+                str(options.loadgen_threads),
+                '--json-file',
+                str(json_path),
+                '--hgrm-file',
+                str(hgrm_path),
+            ]
+            print(f'running {run_name}: {" ".join(command)}', file=sys.stderr)
+            subprocess.run(command, check=True)
+        finally:
+            stop_service(service)
+
+    with open(json_path) as inp:
+        summary = json.load(inp)
+    summary['sample'] = sample.name
+    summary['worker_threads'] = worker_threads
+    return run_name, summary
+
+
+def compare(results, baseline, tolerance):
+    regressions = []
+    for run_name, current in sorted(results.items()):
+        previous = baseline.get(run_name)
+        if previous is None:
+            continue
+
+        min_throughput = previous['throughput'] * (1 - tolerance)
+        if current['throughput'] < min_throughput:
+            regressions.append(
+                f'{run_name}: throughput {current["throughput"]:.1f} < '
+                f'{previous["throughput"]:.1f} rps',
+            )
+
+        max_p99 = previous['p99_ms'] * (1 + tolerance)
+        if current['p99_ms'] > max_p99:
+            regressions.append(
+                f'{run_name}: p99 {current["p99_ms"]:.3f} > '
+                f'{previous["p99_ms"]:.3f} ms',
+            )
+    return regressions
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description='Open-loop latency benchmark of the userver samples',
+    )
+    parser.add_argument('--loadgen', required=True, help='loadgen binary')
+    parser.add_argument('--hello-service', help='hello_service sample binary')
+    parser.add_argument('--grpc-service', help='grpc_service sample binary')
+    parser.add_argument(
+        '--postgres-service', help='postgres_service sample binary',
+    )
+    parser.add_argument(
+        '--postgres-dsn',
+        help='PostgreSQL DSN for postgres_service, the sample is skipped '
+        'without it',
+    )
+    parser.add_argument(
+        '--worker-threads',
+        type=int,
+        nargs='+',
+        default=[2, 4],
+        help='main-task-processor worker_threads values of the services',
+    )
+    parser.add_argument('--loadgen-threads', type=int, default=2)
+    parser.add_argument('--rate', type=float, default=2000)
+    parser.add_argument('--duration', type=float, default=15)
+    parser.add_argument('--warmup', type=float, default=3)
+    parser.add_argument('--startup-timeout', type=float, default=30)
+    parser.add_argument(
+        '--output-dir', type=pathlib.Path, default=pathlib.Path('loadgen'),
+    )
+    parser.add_argument(
+        '--baseline', type=pathlib.Path, help='results.json of a previous run',
+    )
+    parser.add_argument(
+        '--tolerance',
+        type=float,
+        default=0.1,
+        help='allowed relative regression against the baseline',
+    )
+    return parser.parse_args()
+
+
+def main():
+    options = parse_args()
+    options.output_dir.mkdir(parents=True, exist_ok=True)
+
+    request_file = options.output_dir / 'greeting_request.bin'
+    request_file.write_bytes(GREETING_REQUEST)
+
+    samples = []
+    if options.hello_service:
+        samples.append((HelloSample(), options.hello_service))
+    if options.grpc_service:
+        samples.append((GrpcSample(request_file), options.grpc_service))
+    if options.postgres_service and options.postgres_dsn:
+        samples.append((PostgresSample(), options.postgres_service))
+    if not samples:
+        print('no sample binaries are given', file=sys.stderr)
+        return 1
+
+    results = {}
+    for sample, binary in samples:
+        for worker_threads in options.worker_threads:
+            run_name, summary = run_sample(
+                sample,
+                os.path.abspath(binary),
+                worker_threads,
+                options,
+                options.output_dir,
+            )
+            results[run_name] = summary
+
+    results_path = options.output_dir / 'results.json'
+    with open(results_path, 'w') as out:
+        json.dump(results, out, indent=2, sort_keys=True)
+    print(f'results are written to {results_path}', file=sys.stderr)
+
+    if options.baseline:
+        with open(options.baseline) as inp:
+            baseline = json.load(inp)
+        regressions = compare(results, baseline, options.tolerance)
+        for regression in regressions:
+            print(f'REGRESSION {regression}', file=sys.stderr)
+        if regressions:
+            return 1
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
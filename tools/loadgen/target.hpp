@@ -0,0 +1,46 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace loadgen {
+
+struct HttpTargetConfig final {
+  std::string url;
+  std::string method{"GET"};
+  std::string body;
+  std::string content_type;
+  std::chrono::milliseconds timeout{1000};
+  std::size_t io_threads{1};
+  bool http2{false};
+};
+
+struct GrpcTargetConfig final {
+  std::string endpoint;
+  /// In the `full.path.to.TheService/MethodName` format
+  std::string method;
+  /// Serialized request message
+  std::string request;
+  std::chrono::milliseconds timeout{1000};
+  std::size_t channels{1};
+  std::size_t completion_queues{1};
+};
+
+/// A service under load. Created and called in a coroutine.
+class Target {
+ public:
+  virtual ~Target() = default;
+
+  /// Performs a single request, throws on errors and non-successful
+  /// responses. Called concurrently.
+  virtual void Call() const = 0;
+};
+
+std::unique_ptr<Target> MakeHttpTarget(const HttpTargetConfig& config);
+
+/// Only available with USERVER_FEATURE_GRPC
+std::unique_ptr<Target> MakeGrpcTarget(const GrpcTargetConfig& config);
+
+}  // namespace loadgen
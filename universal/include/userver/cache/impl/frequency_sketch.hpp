@@ -0,0 +1,190 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+/// Approximate access frequencies for the TinyLFU admission policy.
+///
+/// A count-min sketch of saturating counters with a doorkeeper bitmap in
+/// front of it: the first access of an item only sets its doorkeeper bit.
+/// After `10 * capacity` increments all the counters are halved and the
+/// doorkeeper is cleared, so the old popularity fades out.
+///
+/// Thread safe. All the operations are relaxed atomics, concurrent increments
+/// may get lost, which is fine for an estimate. The counters of the popular
+/// items saturate quickly, so the hot keys are not written to on each access.
+template <typename T, typename Hash = std::hash<T>>
+class FrequencySketch final {
+ public:
+  static constexpr std::uint8_t kMaxFrequency = 15;
+
+  explicit FrequencySketch(std::size_t capacity, const Hash& hash = Hash());
+
+  /// Records an access to the item
+  void Increment(const T& item) noexcept;
+
+  /// Returns the estimated number of accesses in the recent period,
+  /// at most `kMaxFrequency + 1`
+  std::uint8_t Estimate(const T& item) const noexcept;
+
+  /// Forgets everything
+  void Clear() noexcept;
+
+ private:
+  static constexpr std::size_t kDepth = 4;
+  static constexpr std::size_t kBitsPerWord = 64;
+  // Keeps the collisions rare for the small caches
+  static constexpr std::size_t kMinWidth = 256;
+
+  using Indices = std::array<std::size_t, kDepth>;
+
+  std::uint64_t GetHash(const T& item) const noexcept;
+  Indices GetIndices(std::uint64_t hash) const noexcept;
+  std::atomic<std::uint64_t>& GetDoorkeeperWord(
+      std::uint64_t hash) const noexcept;
+  static std::uint64_t GetDoorkeeperBit(std::uint64_t hash) noexcept;
+
+  void Reset() noexcept;
+
+  const Hash hash_;
+  const std::size_t width_;
+  const std::size_t sample_size_;
+  const std::unique_ptr<std::atomic<std::uint8_t>[]> counters_;
+  const std::unique_ptr<std::atomic<std::uint64_t>[]> doorkeeper_;
+  std::atomic<std::size_t> additions_{0};
+  std::atomic<bool> is_resetting_{false};
+};
+
+template <typename T, typename Hash>
+FrequencySketch<T, Hash>::FrequencySketch(std::size_t capacity,
+                                          const Hash& hash)
+    : hash_(hash),
+      width_([capacity] {
+        std::size_t width = kMinWidth;
+        while (width < capacity) width *= 2;
+        return width;
+      }()),
+      sample_size_(10 * width_),
+      counters_(
+          std::make_unique<std::atomic<std::uint8_t>[]>(kDepth * width_)),
+      doorkeeper_(std::make_unique<std::atomic<std::uint64_t>[]>(
+          width_ / kBitsPerWord)) {
+  Clear();
+}
+
+template <typename T, typename Hash>
+void FrequencySketch<T, Hash>::Increment(const T& item) noexcept {
+  const auto hash = GetHash(item);
+
+  auto& word = GetDoorkeeperWord(hash);
+  const auto bit = GetDoorkeeperBit(hash);
+  if ((word.load(std::memory_order_relaxed) & bit) == 0) {
+    word.fetch_or(bit, std::memory_order_relaxed);
+  } else {
+    const auto indices = GetIndices(hash);
+    std::uint8_t min = kMaxFrequency;
+    for (const auto index : indices) {
+      min = std::min(min, counters_[index].load(std::memory_order_relaxed));
+    }
+    // Saturated items are only read from
+    if (min == kMaxFrequency) return;
+
+    // Conservative update: only the smallest counters grow
+    for (const auto index : indices) {
+      if (counters_[index].load(std::memory_order_relaxed) == min) {
+        counters_[index].store(min + 1, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  if (additions_.fetch_add(1, std::memory_order_relaxed) + 1 >= sample_size_) {
+    Reset();
+  }
+}
+
+template <typename T, typename Hash>
+std::uint8_t FrequencySketch<T, Hash>::Estimate(const T& item) const noexcept {
+  const auto hash = GetHash(item);
+
+  std::uint8_t min = kMaxFrequency;
+  for (const auto index : GetIndices(hash)) {
+    min = std::min(min, counters_[index].load(std::memory_order_relaxed));
+  }
+
+  const auto& word = GetDoorkeeperWord(hash);
+  const bool in_doorkeeper =
+      (word.load(std::memory_order_relaxed) & GetDoorkeeperBit(hash)) != 0;
+  return min + (in_doorkeeper ? 1 : 0);
+}
+
+template <typename T, typename Hash>
+void FrequencySketch<T, Hash>::Clear() noexcept {
+  for (std::size_t i = 0; i < kDepth * width_; ++i) {
+    counters_[i].store(0, std::memory_order_relaxed);
+  }
+  for (std::size_t i = 0; i < width_ / kBitsPerWord; ++i) {
+    doorkeeper_[i].store(0, std::memory_order_relaxed);
+  }
+  additions_.store(0, std::memory_order_relaxed);
+}
+
+template <typename T, typename Hash>
+std::uint64_t FrequencySketch<T, Hash>::GetHash(const T& item) const noexcept {
+  // The user hash may be an identity, spread it over all the bits
+  auto hash = static_cast<std::uint64_t>(hash_(item));
+  hash *= 0x9E3779B97F4A7C15ULL;
+  return hash ^ (hash >> 29);
+}
+
+template <typename T, typename Hash>
+typename FrequencySketch<T, Hash>::Indices
+FrequencySketch<T, Hash>::GetIndices(std::uint64_t hash) const noexcept {
+  // Double hashing, see utils::FilterBloom
+  const auto step = (hash >> 32) | 1;
+  Indices indices{};
+  for (std::size_t i = 0; i < kDepth; ++i) {
+    indices[i] = i * width_ + ((hash + i * step) & (width_ - 1));
+  }
+  return indices;
+}
+
+template <typename T, typename Hash>
+std::atomic<std::uint64_t>& FrequencySketch<T, Hash>::GetDoorkeeperWord(
+    std::uint64_t hash) const noexcept {
+  return doorkeeper_[(hash >> 6) & (width_ / kBitsPerWord - 1)];
+}
+
+template <typename T, typename Hash>
+std::uint64_t FrequencySketch<T, Hash>::GetDoorkeeperBit(
+    std::uint64_t hash) noexcept {
+  return std::uint64_t{1} << (hash & (kBitsPerWord - 1));
+}
+
+template <typename T, typename Hash>
+void FrequencySketch<T, Hash>::Reset() noexcept {
+  if (is_resetting_.exchange(true, std::memory_order_acquire)) return;
+
+  for (std::size_t i = 0; i < kDepth * width_; ++i) {
+    const auto value = counters_[i].load(std::memory_order_relaxed);
+    counters_[i].store(value / 2, std::memory_order_relaxed);
+  }
+  for (std::size_t i = 0; i < width_ / kBitsPerWord; ++i) {
+    doorkeeper_[i].store(0, std::memory_order_relaxed);
+  }
+  additions_.store(sample_size_ / 2, std::memory_order_relaxed);
+
+  is_resetting_.store(false, std::memory_order_release);
+}
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
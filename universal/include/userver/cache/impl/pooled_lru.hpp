@@ -0,0 +1,465 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+// LRU with the items stored in the slots of a pool, linked by indices, and an
+// open-addressing index. The slots are allocated in chunks and reused after
+// the eviction and erasure, so the LRU does not allocate once it is full.
+// The items never move in memory, so the values need not be movable unless
+// Put() is used.
+template <typename T, typename U, typename Hash = std::hash<T>,
+          typename Equal = std::equal_to<T>>
+class PooledLru final {
+ public:
+  explicit PooledLru(std::size_t max_size, const Hash& hash,
+                     const Equal& equal);
+
+  PooledLru(PooledLru&& other) noexcept;
+  PooledLru& operator=(PooledLru&& other) noexcept;
+
+  PooledLru(const PooledLru&) = delete;
+  PooledLru& operator=(const PooledLru&) = delete;
+
+  ~PooledLru() { Clear(); }
+
+  bool Put(const T& key, U value);
+
+  template <typename... Args>
+  U* Emplace(const T& key, Args&&... args);
+
+  void Erase(const T& key);
+
+  U* Get(const T& key);
+
+  const T* GetLeastUsedKey() const;
+
+  U* GetLeastUsedValue();
+
+  void SetMaxSize(std::size_t new_max_size);
+
+  void Clear() noexcept;
+
+  template <typename Function>
+  void VisitAll(Function&& func) const;
+
+  template <typename Function>
+  void VisitAll(Function&& func);
+
+  std::size_t GetSize() const noexcept { return size_; }
+
+  std::size_t GetCapacity() const noexcept { return max_size_; }
+
+ private:
+  using Index = std::uint32_t;
+  static constexpr Index kNoIndex = std::numeric_limits<Index>::max();
+  static constexpr std::size_t kMaxChunkShift = 6;
+
+  struct Entry final {
+    template <typename... Args>
+    explicit Entry(const T& key, Args&&... args)
+        : key(key), value(std::forward<Args>(args)...) {}
+
+    T key;
+    U value;
+  };
+
+  struct Slot final {
+    std::optional<Entry> entry;
+    std::size_t hash{0};
+    // LRU list while the slot is used, the free list otherwise
+    Index prev{kNoIndex};
+    Index next{kNoIndex};
+  };
+
+  static std::size_t GetIndexSize(std::size_t max_size) noexcept;
+
+  Slot& GetSlot(Index slot_index) noexcept;
+  const Slot& GetSlot(Index slot_index) const noexcept;
+
+  // The position of the key in index_, or std::nullopt
+  std::optional<std::size_t> FindPosition(const T& key,
+                                          std::size_t hash) const;
+  std::size_t FindPosition(Index slot_index) const noexcept;
+
+  template <typename... Args>
+  U& Add(const T& key, std::size_t hash, Args&&... args);
+
+  Index AllocateSlot();
+  void RemoveAt(std::size_t position) noexcept;
+  void InsertIntoIndex(Index slot_index) noexcept;
+  void EraseFromIndex(std::size_t position) noexcept;
+
+  void LinkAsMostRecent(Index slot_index) noexcept;
+  void Unlink(Index slot_index) noexcept;
+  void MarkRecentlyUsed(Index slot_index) noexcept;
+
+  Hash hash_;
+  Equal equal_;
+  std::size_t max_size_;
+  std::size_t size_{0};
+
+  std::vector<std::unique_ptr<Slot[]>> chunks_;
+  std::size_t chunk_shift_{0};
+  Index allocated_slots_{0};
+  Index free_slots_{kNoIndex};
+
+  // Least and most recently used slots
+  Index head_{kNoIndex};
+  Index tail_{kNoIndex};
+
+  // Slot indices, kNoIndex for the empty positions. Linear probing, at most
+  // a half is used.
+  std::vector<Index> index_;
+};
+
+template <typename T, typename U, typename Hash, typename Equal>
+PooledLru<T, U, Hash, Equal>::PooledLru(std::size_t max_size, const Hash& hash,
+                                        const Equal& equal)
+    : hash_(hash),
+      equal_(equal),
+      max_size_(max_size ? max_size : 1),
+      index_(GetIndexSize(max_size_), kNoIndex) {
+  UASSERT(max_size > 0);
+  UINVARIANT(max_size_ < kNoIndex / 2, "LRU max size is too big");
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+PooledLru<T, U, Hash, Equal>::PooledLru(PooledLru&& other) noexcept
+    : hash_(other.hash_),
+      equal_(other.equal_),
+      max_size_(other.max_size_),
+      size_(std::exchange(other.size_, 0)),
+      chunks_(std::move(other.chunks_)),
+      chunk_shift_(other.chunk_shift_),
+      allocated_slots_(std::exchange(other.allocated_slots_, 0)),
+      free_slots_(std::exchange(other.free_slots_, kNoIndex)),
+      head_(std::exchange(other.head_, kNoIndex)),
+      tail_(std::exchange(other.tail_, kNoIndex)),
+      index_(std::move(other.index_)) {
+  other.chunks_.clear();
+  other.index_.assign(GetIndexSize(other.max_size_), kNoIndex);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+PooledLru<T, U, Hash, Equal>& PooledLru<T, U, Hash, Equal>::operator=(
+    PooledLru&& other) noexcept {
+  if (this == &other) return *this;
+
+  Clear();
+  hash_ = other.hash_;
+  equal_ = other.equal_;
+  max_size_ = other.max_size_;
+  size_ = std::exchange(other.size_, 0);
+  chunks_ = std::move(other.chunks_);
+  chunk_shift_ = other.chunk_shift_;
+  allocated_slots_ = std::exchange(other.allocated_slots_, 0);
+  free_slots_ = std::exchange(other.free_slots_, kNoIndex);
+  head_ = std::exchange(other.head_, kNoIndex);
+  tail_ = std::exchange(other.tail_, kNoIndex);
+  index_ = std::move(other.index_);
+
+  other.chunks_.clear();
+  other.index_.assign(GetIndexSize(other.max_size_), kNoIndex);
+  return *this;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+bool PooledLru<T, U, Hash, Equal>::Put(const T& key, U value) {
+  const auto hash = hash_(key);
+  if (const auto position = FindPosition(key, hash)) {
+    const auto slot_index = index_[*position];
+    GetSlot(slot_index).entry->value = std::move(value);
+    MarkRecentlyUsed(slot_index);
+    return false;
+  }
+
+  Add(key, hash, std::move(value));
+  return true;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename... Args>
+U* PooledLru<T, U, Hash, Equal>::Emplace(const T& key, Args&&... args) {
+  const auto hash = hash_(key);
+  if (const auto position = FindPosition(key, hash)) {
+    const auto slot_index = index_[*position];
+    MarkRecentlyUsed(slot_index);
+    return &GetSlot(slot_index).entry->value;
+  }
+
+  return &Add(key, hash, std::forward<Args>(args)...);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void PooledLru<T, U, Hash, Equal>::Erase(const T& key) {
+  if (const auto position = FindPosition(key, hash_(key))) {
+    RemoveAt(*position);
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+U* PooledLru<T, U, Hash, Equal>::Get(const T& key) {
+  const auto position = FindPosition(key, hash_(key));
+  if (!position) return nullptr;
+
+  const auto slot_index = index_[*position];
+  MarkRecentlyUsed(slot_index);
+  return &GetSlot(slot_index).entry->value;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+const T* PooledLru<T, U, Hash, Equal>::GetLeastUsedKey() const {
+  if (head_ == kNoIndex) return nullptr;
+  return &GetSlot(head_).entry->key;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+U* PooledLru<T, U, Hash, Equal>::GetLeastUsedValue() {
+  if (head_ == kNoIndex) return nullptr;
+  return &GetSlot(head_).entry->value;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void PooledLru<T, U, Hash, Equal>::SetMaxSize(std::size_t new_max_size) {
+  UASSERT(new_max_size > 0);
+  if (!new_max_size) ++new_max_size;
+  UINVARIANT(new_max_size < kNoIndex / 2, "LRU max size is too big");
+
+  while (size_ > new_max_size) {
+    RemoveAt(FindPosition(head_));
+  }
+  max_size_ = new_max_size;
+
+  const auto index_size = GetIndexSize(max_size_);
+  if (index_size == index_.size()) return;
+
+  // The slots stay where they are, only the index is rebuilt
+  index_.assign(index_size, kNoIndex);
+  for (auto slot_index = head_; slot_index != kNoIndex;
+       slot_index = GetSlot(slot_index).next) {
+    InsertIntoIndex(slot_index);
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void PooledLru<T, U, Hash, Equal>::Clear() noexcept {
+  if (size_ == 0) return;
+
+  for (auto slot_index = head_; slot_index != kNoIndex;) {
+    auto& slot = GetSlot(slot_index);
+    slot.entry.reset();
+    slot_index = std::exchange(slot.next, kNoIndex);
+    slot.prev = kNoIndex;
+  }
+
+  // All the allocated slots are empty, they are handed out in order again
+  allocated_slots_ = 0;
+  free_slots_ = kNoIndex;
+  head_ = kNoIndex;
+  tail_ = kNoIndex;
+  size_ = 0;
+  index_.assign(index_.size(), kNoIndex);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename Function>
+void PooledLru<T, U, Hash, Equal>::VisitAll(Function&& func) const {
+  for (auto slot_index = head_; slot_index != kNoIndex;) {
+    const auto& slot = GetSlot(slot_index);
+    slot_index = slot.next;
+    func(slot.entry->key, slot.entry->value);
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename Function>
+void PooledLru<T, U, Hash, Equal>::VisitAll(Function&& func) {
+  for (auto slot_index = head_; slot_index != kNoIndex;) {
+    auto& slot = GetSlot(slot_index);
+    slot_index = slot.next;
+    func(std::as_const(slot.entry->key), slot.entry->value);
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::size_t PooledLru<T, U, Hash, Equal>::GetIndexSize(
+    std::size_t max_size) noexcept {
+  std::size_t index_size = 8;
+  while (index_size < max_size * 2) index_size *= 2;
+  return index_size;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+typename PooledLru<T, U, Hash, Equal>::Slot&
+PooledLru<T, U, Hash, Equal>::GetSlot(Index slot_index) noexcept {
+  const auto chunk_mask = (std::size_t{1} << chunk_shift_) - 1;
+  return chunks_[slot_index >> chunk_shift_][slot_index & chunk_mask];
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+const typename PooledLru<T, U, Hash, Equal>::Slot&
+PooledLru<T, U, Hash, Equal>::GetSlot(Index slot_index) const noexcept {
+  const auto chunk_mask = (std::size_t{1} << chunk_shift_) - 1;
+  return chunks_[slot_index >> chunk_shift_][slot_index & chunk_mask];
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::optional<std::size_t> PooledLru<T, U, Hash, Equal>::FindPosition(
+    const T& key, std::size_t hash) const {
+  const auto mask = index_.size() - 1;
+  for (auto position = hash & mask;; position = (position + 1) & mask) {
+    const auto slot_index = index_[position];
+    if (slot_index == kNoIndex) return std::nullopt;
+
+    const auto& slot = GetSlot(slot_index);
+    if (slot.hash == hash && equal_(slot.entry->key, key)) return position;
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::size_t PooledLru<T, U, Hash, Equal>::FindPosition(
+    Index slot_index) const noexcept {
+  const auto mask = index_.size() - 1;
+  auto position = GetSlot(slot_index).hash & mask;
+  while (index_[position] != slot_index) {
+    UASSERT(index_[position] != kNoIndex);
+    position = (position + 1) & mask;
+  }
+  return position;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename... Args>
+U& PooledLru<T, U, Hash, Equal>::Add(const T& key, std::size_t hash,
+                                     Args&&... args) {
+  if (size_ >= max_size_) {
+    RemoveAt(FindPosition(head_));
+  }
+
+  const auto slot_index = AllocateSlot();
+  auto& slot = GetSlot(slot_index);
+  try {
+    slot.entry.emplace(key, std::forward<Args>(args)...);
+  } catch (...) {
+    slot.next = std::exchange(free_slots_, slot_index);
+    throw;
+  }
+  slot.hash = hash;
+
+  InsertIntoIndex(slot_index);
+  LinkAsMostRecent(slot_index);
+  ++size_;
+  return slot.entry->value;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+typename PooledLru<T, U, Hash, Equal>::Index
+PooledLru<T, U, Hash, Equal>::AllocateSlot() {
+  if (free_slots_ != kNoIndex) {
+    return std::exchange(free_slots_, GetSlot(free_slots_).next);
+  }
+
+  if (chunks_.empty()) {
+    // Small LRUs do not allocate the slots they can never use
+    chunk_shift_ = 0;
+    while (chunk_shift_ < kMaxChunkShift &&
+           (std::size_t{1} << chunk_shift_) < max_size_) {
+      ++chunk_shift_;
+    }
+  }
+
+  if ((allocated_slots_ >> chunk_shift_) == chunks_.size()) {
+    chunks_.push_back(std::make_unique<Slot[]>(std::size_t{1} << chunk_shift_));
+  }
+  return allocated_slots_++;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void PooledLru<T, U, Hash, Equal>::RemoveAt(std::size_t position) noexcept {
+  const auto slot_index = index_[position];
+  EraseFromIndex(position);
+  Unlink(slot_index);
+
+  auto& slot = GetSlot(slot_index);
+  slot.entry.reset();
+  slot.next = std::exchange(free_slots_, slot_index);
+  --size_;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void PooledLru<T, U, Hash, Equal>::InsertIntoIndex(Index slot_index) noexcept {
+  const auto mask = index_.size() - 1;
+  auto position = GetSlot(slot_index).hash & mask;
+  while (index_[position] != kNoIndex) position = (position + 1) & mask;
+  index_[position] = slot_index;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void PooledLru<T, U, Hash, Equal>::EraseFromIndex(
+    std::size_t position) noexcept {
+  // Backward shift deletion, so that the lookups need no tombstones
+  const auto mask = index_.size() - 1;
+  auto hole = position;
+  for (auto next = (hole + 1) & mask; index_[next] != kNoIndex;
+       next = (next + 1) & mask) {
+    const auto home = GetSlot(index_[next]).hash & mask;
+    // Move the item into the hole unless its probe sequence starts after it
+    if (((hole - home) & mask) < ((next - home) & mask)) {
+      index_[hole] = index_[next];
+      hole = next;
+    }
+  }
+  index_[hole] = kNoIndex;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void PooledLru<T, U, Hash, Equal>::LinkAsMostRecent(Index slot_index) noexcept {
+  auto& slot = GetSlot(slot_index);
+  slot.prev = tail_;
+  slot.next = kNoIndex;
+  if (tail_ != kNoIndex) {
+    GetSlot(tail_).next = slot_index;
+  } else {
+    head_ = slot_index;
+  }
+  tail_ = slot_index;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void PooledLru<T, U, Hash, Equal>::Unlink(Index slot_index) noexcept {
+  auto& slot = GetSlot(slot_index);
+  if (slot.prev != kNoIndex) {
+    GetSlot(slot.prev).next = slot.next;
+  } else {
+    head_ = slot.next;
+  }
+  if (slot.next != kNoIndex) {
+    GetSlot(slot.next).prev = slot.prev;
+  } else {
+    tail_ = slot.prev;
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void PooledLru<T, U, Hash, Equal>::MarkRecentlyUsed(Index slot_index) noexcept {
+  if (slot_index == tail_) return;
+  Unlink(slot_index);
+  LinkAsMostRecent(slot_index);
+}
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
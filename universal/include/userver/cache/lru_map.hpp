@@ -3,7 +3,7 @@
 /// @file userver/cache/lru_map.hpp
 /// @brief @copybrief cache::LruMap
 
-#include <userver/cache/impl/lru.hpp>
+#include <userver/cache/impl/pooled_lru.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -60,6 +60,11 @@ class LruMap final {
   /// @warning Returned pointer may be freed on the next map access!
   U* GetLeastUsed() { return impl_.GetLeastUsedValue(); }
 
+  /// Returns pointer to the key of the least recently used value;
+  /// returns nullptr if LRU is empty.
+  /// @warning Returned pointer may be freed on the next map access!
+  const T* GetLeastUsedKey() const { return impl_.GetLeastUsedKey(); }
+
   /// Sets the max size of the LRU, truncates values if new_max_size < GetSize()
   void SetMaxSize(size_t new_max_size) {
     return impl_.SetMaxSize(new_max_size);
@@ -85,7 +90,7 @@ class LruMap final {
   std::size_t GetCapacity() const { return impl_.GetCapacity(); }
 
  private:
-  impl::LruBase<T, U, Hash, Equal> impl_;
+  impl::PooledLru<T, U, Hash, Equal> impl_;
 };
 
 }  // namespace cache
@@ -4,6 +4,7 @@
 /// @brief @copybrief cache::LruSet
 
 #include <userver/cache/impl/lru.hpp>
+#include <userver/cache/impl/pooled_lru.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -41,7 +42,7 @@ class LruSet final {
   }
 
   /// Removes all the elements
-  void Invalidate() { return impl_.Invalidate(); }
+  void Invalidate() { return impl_.Clear(); }
 
   /// Call Function(const T&) for all items
   template <typename Function>
@@ -58,7 +59,7 @@ class LruSet final {
   const T* GetLeastUsed() { return impl_.GetLeastUsedKey(); }
 
  private:
-  impl::LruBase<T, impl::EmptyPlaceholder, Hash, Equal> impl_;
+  impl::PooledLru<T, impl::EmptyPlaceholder, Hash, Equal> impl_;
 };
 
 }  // namespace cache
@@ -1,17 +1,146 @@
 #pragma once
 
+#include <cstddef>
+#include <memory>
+#include <string>
 #include <string_view>
 
 #include <userver/compression/error.hpp>
 
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+
 USERVER_NAMESPACE_BEGIN
 
 namespace compression::zstd {
 
+namespace impl {
+
+struct CompressionContextDeleter final {
+  void operator()(ZSTD_CCtx_s* context) const noexcept;
+};
+
+struct DecompressionContextDeleter final {
+  void operator()(ZSTD_DCtx_s* context) const noexcept;
+};
+
+}  // namespace impl
+
+/// @brief A dictionary for compressing many small payloads of the same kind,
+/// e.g. JSON documents with the same schema. The dictionary is usually trained
+/// with `zstd --train` on the samples of the payloads.
+///
+/// The same dictionary must be used for compression and decompression. The
+/// object is immutable and may be shared between threads.
+class Dictionary final {
+ public:
+  /// Loads the dictionary, the compression is done with `level`.
+  /// @throws CompressionError
+  Dictionary(std::string_view content, int level);
+
+  Dictionary(Dictionary&&) noexcept;
+  Dictionary& operator=(Dictionary&&) noexcept;
+  ~Dictionary();
+
+  /// Returns the ID of the dictionary stored in the frames, 0 for a
+  /// dictionary that was not trained.
+  unsigned GetId() const noexcept;
+
+ private:
+  friend class Compressor;
+  friend class Decompressor;
+  friend std::string Compress(std::string_view, const Dictionary&, bool);
+  friend std::string Decompress(std::string_view, size_t, const Dictionary&);
+
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 /// Decompresses the string.
 /// @throws DecompressionError
 std::string Decompress(std::string_view compressed, size_t max_size);
 
+/// Decompresses the string compressed with the `dictionary`.
+/// @throws DecompressionError
+std::string Decompress(std::string_view compressed, size_t max_size,
+                       const Dictionary& dictionary);
+
+/// Compresses the string with the `level` from 1 (fastest) to 22, or with
+/// a negative level for even faster compression.
+/// With `with_checksum` the frame stores a checksum of the data, which is
+/// verified by Decompress.
+/// @throws CompressionError
+std::string Compress(std::string_view data, int level,
+                     bool with_checksum = false);
+
+/// Compresses the string with the `dictionary` and its level.
+/// @throws CompressionError
+std::string Compress(std::string_view data, const Dictionary& dictionary,
+                     bool with_checksum = false);
+
+/// @brief Compresses the data passed in parts into a single zstd frame.
+///
+/// The compression context and its buffers are reused between the parts.
+class Compressor final {
+ public:
+  /// @throws CompressionError
+  explicit Compressor(int level, bool with_checksum = false);
+
+  /// The `dictionary` must outlive the compressor.
+  /// @throws CompressionError
+  explicit Compressor(const Dictionary& dictionary, bool with_checksum = false);
+
+  Compressor(Compressor&&) noexcept = default;
+  Compressor& operator=(Compressor&&) noexcept = default;
+  ~Compressor() = default;
+
+  /// Compresses the next part of the data. The compressor may buffer the
+  /// data, so the result may lag behind the input.
+  /// @throws CompressionError
+  std::string Compress(std::string_view data);
+
+  /// Returns the data buffered in the compressor, so that the receiver is
+  /// able to decompress everything passed so far.
+  /// @throws CompressionError
+  std::string Flush();
+
+  /// Ends the frame. The next call to Compress starts a new frame.
+  /// @throws CompressionError
+  std::string Finish();
+
+ private:
+  std::unique_ptr<ZSTD_CCtx_s, impl::CompressionContextDeleter> context_;
+};
+
+/// @brief Decompresses the data received in parts.
+class Decompressor final {
+ public:
+  /// `max_size` limits the total size of the decompressed data.
+  /// @throws DecompressionError
+  explicit Decompressor(size_t max_size);
+
+  /// The `dictionary` must outlive the decompressor.
+  /// @throws DecompressionError
+  Decompressor(size_t max_size, const Dictionary& dictionary);
+
+  Decompressor(Decompressor&&) noexcept = default;
+  Decompressor& operator=(Decompressor&&) noexcept = default;
+  ~Decompressor() = default;
+
+  /// Decompresses the next part of the compressed data.
+  /// @throws DecompressionError, TooBigError
+  std::string Decompress(std::string_view compressed);
+
+  /// Returns true if the data passed so far ends with a complete frame.
+  bool IsFrameComplete() const noexcept { return frame_complete_; }
+
+ private:
+  std::unique_ptr<ZSTD_DCtx_s, impl::DecompressionContextDeleter> context_;
+  size_t max_size_;
+  size_t total_size_{0};
+  bool frame_complete_{false};
+};
+
 }  // namespace compression::zstd
 
 USERVER_NAMESPACE_END
@@ -4,6 +4,8 @@
 /// @brief @copybrief crypto::hash
 /// @ingroup userver_universal
 
+#include <initializer_list>
+#include <string>
 #include <string_view>
 
 USERVER_NAMESPACE_BEGIN
@@ -29,30 +31,60 @@ std::string Blake2b128(std::string_view data,
 std::string Sha1(std::string_view data,
                  OutputEncoding encoding = OutputEncoding::kHex);
 
+/// @brief Calculates SHA-1 of the concatenated `data` parts without
+/// copying them into a single buffer
+/// @see Sha1
+std::string Sha1Parts(std::initializer_list<std::string_view> data,
+                      OutputEncoding encoding = OutputEncoding::kHex);
+
 /// @brief Calculates SHA-224, output format depends from encoding param
 /// @param encoding result could be returned as binary string or encoded
 /// @throws CryptoException internal library exception
 std::string Sha224(std::string_view data,
                    OutputEncoding encoding = OutputEncoding::kHex);
 
+/// @brief Calculates SHA-224 of the concatenated `data` parts without
+/// copying them into a single buffer
+/// @see Sha224
+std::string Sha224Parts(std::initializer_list<std::string_view> data,
+                        OutputEncoding encoding = OutputEncoding::kHex);
+
 /// @brief Calculates SHA-256, output format depends from encoding param
 /// @param encoding result could be returned as binary string or encoded
 /// @throws CryptoException internal library exception
 std::string Sha256(std::string_view data,
                    OutputEncoding encoding = OutputEncoding::kHex);
 
+/// @brief Calculates SHA-256 of the concatenated `data` parts without
+/// copying them into a single buffer
+/// @see Sha256
+std::string Sha256Parts(std::initializer_list<std::string_view> data,
+                        OutputEncoding encoding = OutputEncoding::kHex);
+
 /// @brief Calculates SHA-384, output format depends from encoding param
 /// @param encoding result could be returned as binary string or encoded
 /// @throws CryptoException internal library exception
 std::string Sha384(std::string_view data,
                    OutputEncoding encoding = OutputEncoding::kHex);
 
+/// @brief Calculates SHA-384 of the concatenated `data` parts without
+/// copying them into a single buffer
+/// @see Sha384
+std::string Sha384Parts(std::initializer_list<std::string_view> data,
+                        OutputEncoding encoding = OutputEncoding::kHex);
+
 /// @brief Calculates SHA-512, output format depends from encoding param
 /// @param encoding result could be returned as binary string or encoded
 /// @throws CryptoException internal library exception
 std::string Sha512(std::string_view data,
                    OutputEncoding encoding = OutputEncoding::kHex);
 
+/// @brief Calculates SHA-512 of the concatenated `data` parts without
+/// copying them into a single buffer
+/// @see Sha512
+std::string Sha512Parts(std::initializer_list<std::string_view> data,
+                        OutputEncoding encoding = OutputEncoding::kHex);
+
 /// @brief Calculates HMAC (using SHA-1 hash), encodes result with `encoding`
 /// algorithm
 /// @param key HMAC key
@@ -62,6 +94,13 @@ std::string Sha512(std::string_view data,
 std::string HmacSha1(std::string_view key, std::string_view message,
                      OutputEncoding encoding = OutputEncoding::kHex);
 
+/// @brief Calculates HMAC of the concatenated `message` parts without
+/// copying them into a single buffer
+/// @see HmacSha1
+std::string HmacSha1Parts(std::string_view key,
+                          std::initializer_list<std::string_view> message,
+                          OutputEncoding encoding = OutputEncoding::kHex);
+
 /// @brief Calculates HMAC (using SHA-256 hash), encodes result with `encoding`
 /// algorithm
 /// @param key HMAC key
@@ -71,6 +110,13 @@ std::string HmacSha1(std::string_view key, std::string_view message,
 std::string HmacSha256(std::string_view key, std::string_view message,
                        OutputEncoding encoding = OutputEncoding::kHex);
 
+/// @brief Calculates HMAC of the concatenated `message` parts without
+/// copying them into a single buffer
+/// @see HmacSha256
+std::string HmacSha256Parts(std::string_view key,
+                            std::initializer_list<std::string_view> message,
+                            OutputEncoding encoding = OutputEncoding::kHex);
+
 /// @brief Calculates HMAC (using SHA-384 hash), encodes result with `encoding`
 /// algorithm
 /// @param key HMAC key
@@ -80,6 +126,13 @@ std::string HmacSha256(std::string_view key, std::string_view message,
 std::string HmacSha384(std::string_view key, std::string_view message,
                        OutputEncoding encoding = OutputEncoding::kHex);
 
+/// @brief Calculates HMAC of the concatenated `message` parts without
+/// copying them into a single buffer
+/// @see HmacSha384
+std::string HmacSha384Parts(std::string_view key,
+                            std::initializer_list<std::string_view> message,
+                            OutputEncoding encoding = OutputEncoding::kHex);
+
 /// @brief Calculates HMAC (using SHA-512 hash), encodes result with `encoding`
 /// algorithm
 /// @param key HMAC key
@@ -89,6 +142,13 @@ std::string HmacSha384(std::string_view key, std::string_view message,
 std::string HmacSha512(std::string_view key, std::string_view message,
                        OutputEncoding encoding = OutputEncoding::kHex);
 
+/// @brief Calculates HMAC of the concatenated `message` parts without
+/// copying them into a single buffer
+/// @see HmacSha512
+std::string HmacSha512Parts(std::string_view key,
+                            std::initializer_list<std::string_view> message,
+                            OutputEncoding encoding = OutputEncoding::kHex);
+
 /// Broken cryptographic hashes, must not be used except for compatibility
 namespace weak {
 
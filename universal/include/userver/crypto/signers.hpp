@@ -81,6 +81,9 @@ class DsaSigner final : public Signer {
 
  private:
   PrivateKey pkey_;
+  // Contexts initialized with the key once, each operation works on a copy
+  std::shared_ptr<EVP_MD_CTX> digest_ctx_;
+  std::shared_ptr<EVP_PKEY_CTX> pkey_ctx_;
 };
 
 /// @name Outputs RSASSA signature using SHA-2 and PKCS1 padding.
@@ -87,6 +87,9 @@ class DsaVerifier final : public Verifier {
 
  private:
   PublicKey pkey_;
+  // Contexts initialized with the key once, each operation works on a copy
+  std::shared_ptr<EVP_MD_CTX> digest_ctx_;
+  std::shared_ptr<EVP_PKEY_CTX> pkey_ctx_;
 };
 
 /// @name Verifies RSASSA signature using SHA-2 and PKCS1 padding.
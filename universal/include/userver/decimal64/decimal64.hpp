@@ -934,6 +934,11 @@ constexpr bool IsSpace(CharT c) {
   return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v';
 }
 
+template <typename CharT>
+constexpr bool IsDigit(CharT c) {
+  return c >= '0' && c <= '9';
+}
+
 template <typename CharT, typename Traits>
 class StringCharSequence {
  public:
@@ -1256,6 +1261,46 @@ template <int Prec, typename RoundPolicy, typename CharSequence>
           0};
 }
 
+/// Parses the plain decimals like "-123.45" with at most `Prec` fractional
+/// digits. Returns std::nullopt for anything else, including the inputs that
+/// the general Parse accepts or rejects with an error.
+template <int Prec, typename RoundPolicy>
+[[nodiscard]] constexpr std::optional<Decimal<Prec, RoundPolicy>> ParsePlain(
+    std::string_view input) {
+  std::size_t position = 0;
+  const bool is_negative = !input.empty() && input[0] == '-';
+  if (is_negative) ++position;
+
+  const auto before_begin = position;
+  int64_t before = 0;
+  for (; position < input.size() && IsDigit(input[position]); ++position) {
+    if (position - before_begin == kMaxDecimalDigits) return std::nullopt;
+    before = 10 * before + (input[position] - '0');
+  }
+  if (position == before_begin || before >= kMaxInt64 / kPow10<Prec>) {
+    return std::nullopt;
+  }
+
+  int64_t after = 0;
+  int after_digit_count = 0;
+  if (position < input.size() && input[position] == '.') {
+    ++position;
+    for (; position < input.size() && IsDigit(input[position]); ++position) {
+      if (after_digit_count == Prec) return std::nullopt;
+      after = 10 * after + (input[position] - '0');
+      ++after_digit_count;
+    }
+    if (after_digit_count == 0) return std::nullopt;
+  }
+  if (position != input.size()) return std::nullopt;
+
+  if (is_negative) {
+    before = -before;
+    after = -after;
+  }
+  return FromUnpacked<Prec, RoundPolicy>(before, after, after_digit_count);
+}
+
 std::string GetErrorMessage(std::string_view source, std::string_view path,
                             size_t position, ParseErrorCode reason);
 
@@ -1270,6 +1315,10 @@ std::string ToString(int64_t before, int64_t after, int precision,
 
 template <int Prec, typename RoundPolicy>
 constexpr Decimal<Prec, RoundPolicy>::Decimal(std::string_view value) {
+  if (const auto plain = impl::ParsePlain<Prec, RoundPolicy>(value)) {
+    *this = *plain;
+    return;
+  }
   const auto result = impl::Parse<Prec, RoundPolicy>(
       impl::StringCharSequence(value), impl::ParseOptions::kNone);
 
@@ -1283,6 +1332,9 @@ constexpr Decimal<Prec, RoundPolicy>::Decimal(std::string_view value) {
 template <int Prec, typename RoundPolicy>
 constexpr Decimal<Prec, RoundPolicy>
 Decimal<Prec, RoundPolicy>::FromStringPermissive(std::string_view input) {
+  if (const auto plain = impl::ParsePlain<Prec, RoundPolicy>(input)) {
+    return *plain;
+  }
   const auto result = impl::Parse<Prec, RoundPolicy>(
       impl::StringCharSequence(input),
       {impl::ParseOptions::kAllowSpaces, impl::ParseOptions::kAllowBoundaryDot,
@@ -1415,6 +1467,9 @@ std::enable_if_t<formats::common::kIsFormatValue<Value>,
 Parse(const Value& value, formats::parse::To<Decimal<Prec, RoundPolicy>>) {
   const std::string input = value.template As<std::string>();
 
+  if (const auto plain = impl::ParsePlain<Prec, RoundPolicy>(input)) {
+    return *plain;
+  }
   const auto result = impl::Parse<Prec, RoundPolicy>(
       impl::StringCharSequence(std::string_view{input}),
       impl::ParseOptions::kNone);
@@ -4,6 +4,7 @@
 /// @brief Include-all header for JSON support
 /// @ingroup userver_universal
 
+#include <userver/formats/json/arena.hpp>
 #include <userver/formats/json/exception.hpp>
 #include <userver/formats/json/inline.hpp>
 #include <userver/formats/json/iterator.hpp>
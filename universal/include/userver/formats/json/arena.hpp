@@ -0,0 +1,77 @@
+#pragma once
+
+/// @file userver/formats/json/arena.hpp
+/// @brief @copybrief formats::json::Arena
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+class Value;
+class ValueBuilder;
+
+namespace impl {
+class ArenaStorage;
+}  // namespace impl
+
+// clang-format off
+
+/// @ingroup userver_universal userver_containers userver_formats
+///
+/// @brief Monotonic memory arena for formats::json documents.
+///
+/// Strings, arrays and objects of a document that is parsed by
+/// formats::json::FromStringInArena(std::string_view, Arena&) or is built by a
+/// formats::json::ValueBuilder constructed from an Arena are allocated from a
+/// few big memory blocks of the arena. The blocks are released all at once
+/// when the Arena and all the documents in it are destroyed, destruction of
+/// such documents does not visit their nodes.
+///
+/// Memory of the removed and overwritten nodes is not reused, so the arena
+/// suits short-living documents, like a parsed request or a response being
+/// built. Copies and moves of a ValueBuilder or of a Value in arena are
+/// allocated from the same arena, formats::json::Value::Clone() makes a
+/// document in heap.
+///
+/// Nodes assigned to a document in arena from a document in heap or in
+/// another arena are copied rather than moved, so build the subdocuments in
+/// the same arena.
+///
+/// Documents of an Arena must not be modified concurrently, reading them is
+/// thread-safe.
+///
+/// ## Example usage:
+///
+/// @snippet formats/json/arena_test.cpp  Sample formats::json::Arena usage
+
+// clang-format on
+
+class Arena final {
+ public:
+  static constexpr std::size_t kDefaultBlockSize = 4096;
+
+  /// @param block_size size of the first memory block, the following blocks
+  /// are bigger. Memory is allocated on the first use.
+  explicit Arena(std::size_t block_size = kDefaultBlockSize);
+
+  Arena(Arena&&) noexcept;
+  Arena& operator=(Arena&&) noexcept;
+  ~Arena();
+
+  /// Returns the size of the memory blocks allocated by the arena
+  std::size_t GetAllocatedBytes() const noexcept;
+
+ private:
+  friend class ValueBuilder;
+  friend Value FromStringInArena(std::string_view doc, Arena& arena);
+
+  std::shared_ptr<impl::ArenaStorage> storage_;
+};
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
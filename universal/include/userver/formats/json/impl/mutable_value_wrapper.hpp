@@ -39,6 +39,9 @@ class MutableValueWrapper {
   std::string GetPath() const;
   formats::json::Value ExtractValue() &&;
 
+  // nullptr for the documents in heap
+  const std::shared_ptr<ArenaStorage>& GetArena() const noexcept;
+
   void OnMembersChange();
 
  private:
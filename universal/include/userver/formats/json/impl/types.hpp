@@ -25,11 +25,14 @@ using formats::common::Type;
 class Value;
 
 namespace impl {
+class Allocator;
+class ArenaStorage;
+
 // rapidjson integration
 using UTF8 = ::rapidjson::UTF8<char>;
-using Value = ::rapidjson::GenericValue<UTF8, ::rapidjson::CrtAllocator>;
-using Document = ::rapidjson::GenericDocument<UTF8, ::rapidjson::CrtAllocator,
-                                              ::rapidjson::CrtAllocator>;
+using Value = ::rapidjson::GenericValue<UTF8, Allocator>;
+using Document =
+    ::rapidjson::GenericDocument<UTF8, Allocator, ::rapidjson::CrtAllocator>;
 
 class VersionedValuePtr final {
  public:
@@ -40,6 +43,10 @@ class VersionedValuePtr final {
   template <typename... Args>
   static VersionedValuePtr Create(Args&&... args);
 
+  // Creates a null value that allocates its nodes from the `arena`, or from
+  // heap if `arena` is nullptr
+  static VersionedValuePtr CreateInArena(std::shared_ptr<ArenaStorage> arena);
+
   VersionedValuePtr(const VersionedValuePtr&) = default;
   VersionedValuePtr(VersionedValuePtr&&) = default;
   VersionedValuePtr& operator=(const VersionedValuePtr&) = default;
@@ -61,6 +68,9 @@ class VersionedValuePtr final {
   size_t Version() const;
   void BumpVersion();
 
+  // nullptr for the documents in heap
+  const std::shared_ptr<ArenaStorage>& GetArena() const noexcept;
+
  private:
   struct Data;
 
@@ -6,6 +6,7 @@
 #include <iterator>
 #include <optional>
 #include <string>
+#include <string_view>
 
 #include <userver/formats/common/iterator_direction.hpp>
 
@@ -50,6 +51,17 @@ class Iterator final {
     static_assert(Direction == common::IteratorDirection::kForward,
                   "Reverse iterator should be used only on arrays or null, "
                   "they do not have GetName()");
+    return std::string{GetNameImpl()};
+  }
+
+  /// @brief Returns name of the referenced field without copying it. The
+  /// view is valid while the iterated value is alive.
+  /// @throws `TypeMismatchException` if iterated value is not an object
+  template <typename T = void>
+  std::string_view GetNameView() const {
+    static_assert(Direction == common::IteratorDirection::kForward,
+                  "Reverse iterator should be used only on arrays or null, "
+                  "they do not have GetNameView()");
     return GetNameImpl();
   }
 
@@ -58,7 +70,7 @@ class Iterator final {
   size_t GetIndex() const;
 
  private:
-  std::string GetNameImpl() const;
+  std::string_view GetNameImpl() const;
   Iterator(ContainerType&& container, int type, int pos) noexcept;
 
   void UpdateValue() const;
@@ -4,13 +4,16 @@
 /// @brief Parsers and serializers to/from string and stream
 
 #include <iosfwd>
+#include <string>
 #include <string_view>
 
 #include <fmt/format.h>
 
+#include <userver/formats/json/arena.hpp>
 #include <userver/formats/json/value.hpp>
 #include <userver/utils/fast_pimpl.hpp>
 #include <userver/utils/fmt_compat.hpp>
+#include <userver/utils/function_ref.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -27,9 +30,23 @@ constexpr inline std::size_t kDepthParseLimit = 128;
 /// Parse JSON from string
 formats::json::Value FromString(std::string_view doc);
 
+/// @brief Parse JSON from string into the `arena`
+/// @see formats::json::Arena
+formats::json::Value FromStringInArena(std::string_view doc, Arena& arena);
+
 /// Parse JSON from stream
 formats::json::Value FromStream(std::istream& is);
 
+/// @brief Parse JSON from a sequence of chunks without joining them into
+/// a contiguous string.
+///
+/// `next_chunk` must replace the contents of its argument with the next chunk
+/// and return `false` when there are no more chunks. The same buffer is
+/// reused for all the chunks. Suits clients::http::StreamedResponse::ReadChunk:
+/// @snippet clients/http/client_test.cpp  HTTP Client - stream JSON
+formats::json::Value FromChunks(
+    utils::function_ref<bool(std::string& chunk)> next_chunk);
+
 /// Serialize JSON to stream
 void Serialize(const formats::json::Value& doc, std::ostream& os);
 
@@ -16,6 +16,7 @@
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/json/string_builder_fwd.hpp>
 #include <userver/formats/parse/common.hpp>
+#include <userver/utils/function_ref.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -38,6 +39,7 @@ impl::Value MakeJsonStringViewValue(std::string_view view);
 class ValueBuilder;
 struct PrettyFormat;
 class Schema;
+class Arena;
 
 namespace parser {
 class JsonValueParser;
@@ -323,7 +325,10 @@ class Value final {
   friend std::string Parse(const Value& value, parse::To<std::string>);
 
   friend formats::json::Value FromString(std::string_view);
+  friend formats::json::Value FromStringInArena(std::string_view, Arena&);
   friend formats::json::Value FromStream(std::istream&);
+  friend formats::json::Value FromChunks(
+      utils::function_ref<bool(std::string&)>);
   friend void Serialize(const formats::json::Value&, std::ostream&);
   friend std::string ToString(const formats::json::Value&);
   friend std::string ToStableString(const formats::json::Value&);
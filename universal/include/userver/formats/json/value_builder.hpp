@@ -9,6 +9,7 @@
 
 #include <userver/formats/common/meta.hpp>
 #include <userver/formats/common/transfer_tag.hpp>
+#include <userver/formats/json/arena.hpp>
 #include <userver/formats/json/impl/mutable_value_wrapper.hpp>
 #include <userver/formats/json/value.hpp>
 #include <userver/utils/strong_typedef.hpp>
@@ -55,6 +56,11 @@ class ValueBuilder final {
   /// Constructs a valueBuilder that holds default value for provided `type`.
   ValueBuilder(formats::common::Type type);
 
+  /// @brief Constructs a ValueBuilder that allocates the document from the
+  /// `arena` and holds default value for provided `type`.
+  /// @see formats::json::Arena
+  explicit ValueBuilder(Arena& arena, Type type = Type::kNull);
+
   /// @brief Transfers the `ValueBuilder` object
   /// @see formats::common::TransferTag for the transfer semantics
   ValueBuilder(common::TransferTag, ValueBuilder&&) noexcept;
@@ -186,7 +192,7 @@ class ValueBuilder final {
   explicit ValueBuilder(impl::MutableValueWrapper) noexcept;
 
   static void Copy(impl::Value& to, const ValueBuilder& from);
-  static void Move(impl::Value& to, ValueBuilder&& from);
+  void Move(impl::Value& to, ValueBuilder&& from);
 
   impl::Value& AddMember(std::string_view key, CheckMemberExists);
 
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <userver/formats/yaml/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::yaml::impl {
+
+// Binary representation of a parsed YAML document, that is loaded without
+// running the YAML parser. `source` is the text the `doc` was parsed from, the
+// snapshot remembers its hash. Line and column marks are not preserved.
+std::string ToBinarySnapshot(const Value& doc, std::string_view source);
+
+// Returns std::nullopt if the snapshot is malformed or was made from another
+// `source`.
+std::optional<Value> FromBinarySnapshot(std::string_view snapshot,
+                                        std::string_view source);
+
+// Same as formats::yaml::FromString, but reuses the snapshot of `doc` from the
+// `snapshot_dir` or stores it there for the next time. Failures to read or to
+// write the snapshot are logged and otherwise ignored.
+Value FromStringWithSnapshot(const std::string& doc,
+                             const std::string& snapshot_dir);
+
+}  // namespace formats::yaml::impl
+
+USERVER_NAMESPACE_END
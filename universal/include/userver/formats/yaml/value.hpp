@@ -19,6 +19,10 @@ namespace formats::yaml {
 
 class ValueBuilder;
 
+namespace impl {
+class SnapshotAccess;
+}  // namespace impl
+
 /// @ingroup userver_universal userver_containers userver_formats
 ///
 /// @brief Non-mutable YAML value representation.
@@ -280,6 +284,7 @@ class Value final {
 
   friend class Iterator<IterTraits>;
   friend class ValueBuilder;
+  friend class impl::SnapshotAccess;
 
   friend bool Parse(const Value& value, parse::To<bool>);
   friend int64_t Parse(const Value& value, parse::To<int64_t>);
@@ -120,6 +120,8 @@ inline constexpr PredefinedHeader kSetCookie{"Set-Cookie"};
 inline constexpr PredefinedHeader kWebsocketKey{"Sec-WebSocket-Key"};
 inline constexpr PredefinedHeader kWebsocketAccept{"Sec-WebSocket-Accept"};
 inline constexpr PredefinedHeader kWebsocketVersion{"Sec-WebSocket-Version"};
+inline constexpr PredefinedHeader kWebsocketExtensions{
+    "Sec-WebSocket-Extensions"};
 /// @}
 
 /// @name Extra headers
@@ -193,6 +195,8 @@ inline constexpr std::string_view kMaxPendingResponses{
     "too-many-pending-responses"};
 inline constexpr std::string_view kGlobal{"global-ratelimit"};
 inline constexpr std::string_view kInFlight{"max-requests-in-flight"};
+inline constexpr std::string_view kAdaptiveConcurrency{
+    "adaptive-concurrency-limit"};
 }  // namespace ratelimit_reason
 /// @}
 
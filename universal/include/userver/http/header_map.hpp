@@ -34,7 +34,9 @@ class Map;
 /// * if an insertion took place, iterators/pointers are invalidated;
 /// * successful erase invalidates the iterator being erased and `begin` (it's
 /// implemented via swap and pop_back idiom, and `begin` is actually an `rbegin`
-/// of underlying vector).
+/// of underlying vector);
+/// * since the first few headers are stored inline, a move invalidates
+/// the iterators/pointers of the moved-from map.
 class HeaderMap final {
  public:
   /// Iterator
@@ -269,7 +271,7 @@ class HeaderMap final {
   template <std::size_t Size>
   [[noreturn]] static void ReportMisuse();
 
-  utils::FastPimpl<header_map::Map, 272, 8> impl_;
+  utils::FastPimpl<header_map::Map, 1296, 8> impl_;
 };
 
 template <typename InputIt>
@@ -357,8 +359,7 @@ class HeaderMap::Iterator final {
   // The underlying iterator is a reversed one to do not invalidate
   // end() on erase - end() is actually an rbegin() of underlying storage and is
   // only invalidated on reallocation.
-  using UnderlyingIterator =
-      std::vector<header_map::MapEntry>::reverse_iterator;
+  using UnderlyingIterator = std::reverse_iterator<header_map::MapEntry*>;
 
   Iterator();
   explicit Iterator(UnderlyingIterator it);
@@ -402,7 +403,7 @@ class HeaderMap::ConstIterator final {
   // end() on erase - end() is actually an rbegin() of underlying storage and is
   // only invalidated on reallocation.
   using UnderlyingIterator =
-      std::vector<header_map::MapEntry>::const_reverse_iterator;
+      std::reverse_iterator<const header_map::MapEntry*>;
 
   ConstIterator();
   explicit ConstIterator(UnderlyingIterator it);
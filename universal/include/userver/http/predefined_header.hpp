@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+#include <cstring>
 #include <string>
 #include <string_view>
 
@@ -26,18 +28,41 @@ namespace impl {
 // P.S. The hasher is "unsafe" in hash-flood sense.
 struct UnsafeConstexprHasher final {
   constexpr std::size_t operator()(std::string_view str) const noexcept {
+    return Hash(str, [](const char* data, std::size_t n) constexpr noexcept {
+      return LoadN(data, n);
+    });
+  }
+
+  // Same value as operator(), but the input is read by whole words instead of
+  // byte by byte. For the runtime hashing of the header names.
+  std::size_t HashRuntime(std::string_view str) const noexcept {
+    return Hash(str, [](const char* data, std::size_t n) noexcept {
+      std::uint64_t result = kDeliberatelyBrokenLowercaseMask >> (8 * (8 - n));
+      std::uint64_t bytes = 0;
+      std::memcpy(&bytes, data, n);
+      return result | bytes;
+    });
+  }
+
+ private:
+  static constexpr std::uint64_t kDeliberatelyBrokenLowercaseMask =
+      0x2020202020202020UL;
+
+  template <typename Loader>
+  constexpr std::size_t Hash(std::string_view str,
+                             Loader loader) const noexcept {
     constexpr std::uint64_t mul = (0xc6a4a793UL << 32UL) + 0x5bd1e995UL;
 
     std::uint64_t hash = seed_ ^ (str.size() * mul);
     while (str.size() >= 8) {
-      const std::uint64_t data = ShiftMix(Load8(str.data()) * mul) * mul;
+      const std::uint64_t data = ShiftMix(loader(str.data(), 8) * mul) * mul;
       hash ^= data;
       hash *= mul;
 
       str = str.substr(8);
     }
     if (!str.empty()) {
-      const std::uint64_t data = LoadN(str.data(), str.size());
+      const std::uint64_t data = loader(str.data(), str.size());
       hash ^= data;
       hash *= mul;
     }
@@ -47,15 +72,10 @@ struct UnsafeConstexprHasher final {
     return hash;
   }
 
- private:
   static constexpr inline std::uint64_t ShiftMix(std::uint64_t v) noexcept {
     return v ^ (v >> 47);
   }
 
-  static constexpr inline std::uint64_t Load8(const char* data) noexcept {
-    return LoadN(data, 8);
-  }
-
   static constexpr inline std::uint64_t LoadN(const char* data,
                                               std::size_t n) noexcept {
     // Although lowercase and uppercase ASCII are indeed 32 (0x20) apart,
@@ -64,9 +84,6 @@ struct UnsafeConstexprHasher final {
     // However, for expected input (lower/upper-case ASCII letters + dashes)
     // this just works, and against malicious
     // input we defend by falling back to case-insensitive SipHash.
-    constexpr std::uint64_t kDeliberatelyBrokenLowercaseMask =
-        0x2020202020202020UL;
-
     std::uint64_t result = kDeliberatelyBrokenLowercaseMask >> (8 * (8 - n));
     for (std::size_t i = 0; i < n; ++i) {
       const std::uint8_t c = data[i];
@@ -10,7 +10,16 @@ USERVER_NAMESPACE_BEGIN
 namespace logging {
 
 /// Log formats
-enum class Format { kTskv, kLtsv, kRaw };
+enum class Format {
+  kTskv,
+  kLtsv,
+  kRaw,
+  /// A JSON object per line, all the tag values are JSON strings
+  kJson,
+  /// Length-prefixed records with typed fields. The escaping and the number
+  /// formatting are deferred to the logger's consumer task.
+  kBinary,
+};
 
 /// Parse Format enum from string
 Format FormatFromString(std::string_view format_str);
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
+#include <memory>
 
 #include <userver/logging/format.hpp>
 #include <userver/logging/level.hpp>
@@ -10,6 +12,7 @@ USERVER_NAMESPACE_BEGIN
 namespace logging::impl {
 
 class TagWriter;
+class LogSampler;
 
 /// Base logger class
 class LoggerBase {
@@ -43,6 +46,16 @@ class LoggerBase {
 
   virtual void ForwardTo(LoggerBase* logger_to);
 
+  /// Whether the logger symbolizes the stacktraces of LogExtra::Stacktrace()
+  /// itself, off the logging coroutine. Otherwise they are symbolized while
+  /// the record is formed.
+  virtual bool SymbolizesDeferredStacktraces() const noexcept;
+
+  /// Enables sampling of the noisy log locations once a level exceeds
+  /// `records_per_second`. Should be called before the logger is used.
+  void SetSamplingBudget(std::size_t records_per_second);
+  LogSampler* GetSampler() const noexcept;
+
  protected:
   virtual bool DoShouldLog(Level level) const noexcept;
 
@@ -50,6 +63,7 @@ class LoggerBase {
   const Format format_;
   std::atomic<Level> level_{Level::kNone};
   std::atomic<Level> flush_level_{Level::kWarning};
+  std::unique_ptr<LogSampler> sampler_;
 };
 
 bool ShouldLogNoSpan(const LoggerBase& logger, Level level) noexcept;
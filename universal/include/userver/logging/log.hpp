@@ -10,6 +10,7 @@
 #include <userver/logging/level.hpp>
 #include <userver/logging/log_filepath.hpp>
 #include <userver/logging/log_helper.hpp>
+#include <userver/utils/datetime/steady_coarse_clock.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -104,7 +105,8 @@ class RateLimitData {
  public:
   uint64_t count_since_reset = 0;
   uint64_t dropped_count = 0;
-  std::chrono::steady_clock::time_point last_reset_time{};
+  // Reset intervals are in seconds, so the coarse clock is precise enough
+  utils::datetime::SteadyCoarseClock::time_point last_reset_time{};
 };
 
 // Represents a single rate limit usage
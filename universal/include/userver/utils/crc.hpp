@@ -0,0 +1,37 @@
+#pragma once
+
+/// @file userver/utils/crc.hpp
+/// @brief Cyclic redundancy checks
+/// @ingroup userver_universal
+
+#include <cstdint>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+/// @brief CRC-32 (ISO-HDLC, as in zlib and boost::crc_32_type)
+///
+/// Uses the ARMv8 CRC32 instructions when built with them enabled and the
+/// slicing-by-8 tables otherwise.
+///
+/// `crc` is the result for the preceding data, it allows computing the
+/// checksum of the data split into parts.
+std::uint32_t Crc32(std::string_view data, std::uint32_t crc = 0) noexcept;
+
+/// @brief CRC-32C (Castagnoli, as in iSCSI, ext4 and many storage formats)
+///
+/// Uses the SSE4.2 or ARMv8 CRC32 instructions when built with them enabled
+/// and the slicing-by-8 tables otherwise.
+///
+/// @warning The results differ from utils::Crc32, so the values already
+/// stored or used for sharding can not be migrated to this function.
+std::uint32_t Crc32c(std::string_view data, std::uint32_t crc = 0) noexcept;
+
+/// @brief CRC-16/XMODEM, the one used by Redis Cluster for the key hash slots
+std::uint16_t Crc16(std::string_view data, std::uint16_t crc = 0) noexcept;
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
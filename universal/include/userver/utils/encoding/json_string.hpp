@@ -0,0 +1,117 @@
+#pragma once
+
+/// @file userver/utils/encoding/json_string.hpp
+/// @brief Encoders for JSON string contents
+/// @ingroup userver_universal
+
+#include <cstddef>
+#include <string_view>
+
+#include <userver/utils/encoding/tskv.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::encoding {
+
+/// @brief Escapes a single char according to the JSON string rules, without
+/// the surrounding quotes.
+/// @returns The iterator to after the inserted chars.
+template <typename OutIter>
+OutIter EncodeJsonString(OutIter destination, char ch);
+
+/// @brief Escapes `str` according to the JSON string rules, without
+/// the surrounding quotes. Bytes >= 0x80 are copied as is, so UTF-8 stays
+/// UTF-8. Uses SIMD to skip over the parts that need no escaping.
+/// @note New contents are appended at the end of `container`. Some extra memory
+/// is reserved as necessary.
+/// @tparam Container must be continuous and support at least the following
+/// operations: 1) `c.data()` 2) `c.size()` 3) `c.resize(new_size)`
+template <typename Container>
+void EncodeJsonString(Container& container, std::string_view str);
+
+// ==================== Implementation follows ====================
+
+template <typename OutIter>
+inline OutIter EncodeJsonString(OutIter destination, char ch) {
+  const auto append = [&destination](char ch) { *(destination++) = ch; };
+
+  switch (ch) {
+    case '"':
+    case '\\':
+      append('\\');
+      append(ch);
+      break;
+    case '\n':
+      append('\\');
+      append('n');
+      break;
+    case '\r':
+      append('\\');
+      append('r');
+      break;
+    case '\t':
+      append('\\');
+      append('t');
+      break;
+    case '\b':
+      append('\\');
+      append('b');
+      break;
+    case '\f':
+      append('\\');
+      append('f');
+      break;
+    default:
+      if (static_cast<unsigned char>(ch) < 0x20) {
+        constexpr std::string_view kHexDigits = "0123456789abcdef";
+        append('\\');
+        append('u');
+        append('0');
+        append('0');
+        append(kHexDigits[static_cast<unsigned char>(ch) >> 4]);
+        append(kHexDigits[static_cast<unsigned char>(ch) & 0xf]);
+      } else {
+        append(ch);
+      }
+      break;
+  }
+  return destination;
+}
+
+namespace impl::json {
+
+struct JsonStringRules final {
+  // "\u001f"
+  static constexpr std::size_t kMaxEncodedCharSize = 6;
+
+  template <typename Encoder>
+  static bool MayNeedEscaping(typename Encoder::Block block,
+                              std::size_t offset, std::size_t count) noexcept {
+    return Encoder::MayNeedJsonEscaping(block, offset, count);
+  }
+
+  static char* EncodeChar(char* destination, char ch) noexcept {
+    return encoding::EncodeJsonString(destination, ch);
+  }
+};
+
+}  // namespace impl::json
+
+template <typename Container>
+void EncodeJsonString(Container& container, std::string_view str) {
+  using Encoder = impl::tskv::SystemEncoder;
+  using Rules = impl::json::JsonStringRules;
+
+  const auto old_size = container.size();
+  container.resize(old_size + str.size() * Rules::kMaxEncodedCharSize +
+                   impl::tskv::PaddingSize<Encoder>());
+  impl::tskv::BufferPtr<Encoder> buffer_ptr{container.data() + old_size};
+
+  buffer_ptr = impl::tskv::EncodeValue<Encoder, Rules>(buffer_ptr, str);
+
+  container.resize(buffer_ptr.current - container.data());
+}
+
+}  // namespace utils::encoding
+
+USERVER_NAMESPACE_END
@@ -197,6 +197,18 @@ struct EncoderStd final {
     }
     return false;
   }
+
+  USERVER_IMPL_FORCE_INLINE static bool MayNeedJsonEscaping(
+      Block block, std::size_t offset, std::size_t count) noexcept {
+    char buffer[kBlockSize]{};
+    std::memcpy(&buffer, &block, sizeof(block));
+    for (const char c : std::string_view(buffer + offset, count)) {
+      if (static_cast<unsigned char>(c) < 0x20 || c == '"' || c == '\\') {
+        return true;
+      }
+    }
+    return false;
+  }
 };
 
 #ifdef __SSE2__
@@ -234,6 +246,21 @@ struct EncoderSse2 {
                static_cast<std::uint32_t>(may_need_escaping_mask) >>
                offset << (32 - count)) != 0;
   }
+
+  USERVER_IMPL_FORCE_INLINE static bool MayNeedJsonEscaping(
+      Block block, std::size_t offset, std::size_t count) noexcept {
+    // 'char c' needs JSON escaping iff (unsigned)c < 0x20 || c == '"' ||
+    // c == '\\'. The unsigned comparison is done via min_epu8.
+    const auto is_control = _mm_cmpeq_epi8(
+        _mm_min_epu8(block, _mm_set1_epi8(0x1f)), block);
+    const auto needs_escaping_mask = _mm_movemask_epi8(
+        _mm_or_si128(is_control,
+                     _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('"')),
+                                  _mm_cmpeq_epi8(block, _mm_set1_epi8('\\')))));
+    return static_cast<std::uint32_t>(
+               static_cast<std::uint32_t>(needs_escaping_mask) >>
+               offset << (32 - count)) != 0;
+  }
 };
 #endif
 
@@ -286,6 +313,20 @@ struct EncoderAvx2 final {
                static_cast<std::uint32_t>(may_need_escaping_mask) >>
                offset << (32 - count)) != 0;
   }
+
+  USERVER_IMPL_FORCE_INLINE static bool MayNeedJsonEscaping(
+      Block block, std::size_t offset, std::size_t count) noexcept {
+    // See EncoderSse2::MayNeedJsonEscaping
+    const auto is_control = _mm256_cmpeq_epi8(
+        _mm256_min_epu8(block, _mm256_set1_epi8(0x1f)), block);
+    const auto needs_escaping_mask = _mm256_movemask_epi8(_mm256_or_si256(
+        is_control,
+        _mm256_or_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8('"')),
+                        _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\\')))));
+    return static_cast<std::uint32_t>(
+               static_cast<std::uint32_t>(needs_escaping_mask) >>
+               offset << (32 - count)) != 0;
+  }
 };
 #endif
 
@@ -312,6 +353,22 @@ struct BufferPtr final {
   char* current{nullptr};
 };
 
+// Escaping rules for the values, the block pipeline below is shared
+// with other encodings, see utils/encoding/json_string.hpp
+struct TskvValueRules final {
+  template <typename Encoder>
+  USERVER_IMPL_FORCE_INLINE static bool MayNeedEscaping(
+      typename Encoder::Block block, std::size_t offset,
+      std::size_t count) noexcept {
+    return Encoder::MayNeedValueEscaping(block, offset, count);
+  }
+
+  USERVER_IMPL_FORCE_INLINE static char* EncodeChar(char* destination,
+                                                    char ch) noexcept {
+    return encoding::EncodeTskv(destination, ch, EncodeTskvMode::kValue);
+  }
+};
+
 template <typename Encoder>
 USERVER_IMPL_FORCE_INLINE BufferPtr<Encoder> AppendBlock(
     BufferPtr<Encoder> destination, typename Encoder::Block block,
@@ -323,17 +380,16 @@ USERVER_IMPL_FORCE_INLINE BufferPtr<Encoder> AppendBlock(
 }
 
 // noinline to avoid code duplication for a cold path
-template <typename Encoder>
+template <typename Encoder, typename Rules = TskvValueRules>
 [[nodiscard]] __attribute__((noinline)) BufferPtr<Encoder> EncodeValueEach(
     BufferPtr<Encoder> destination, std::string_view str) {
   for (const char c : str) {
-    destination.current =
-        encoding::EncodeTskv(destination.current, c, EncodeTskvMode::kValue);
+    destination.current = Rules::EncodeChar(destination.current, c);
   }
   return destination;
 }
 
-template <typename Encoder>
+template <typename Encoder, typename Rules = TskvValueRules>
 [[nodiscard]] USERVER_IMPL_FORCE_INLINE BufferPtr<Encoder> EncodeValueBlock(
     BufferPtr<Encoder> destination, const char* block, std::size_t offset,
     std::size_t count) {
@@ -342,10 +398,10 @@ template <typename Encoder>
   block = AssumeAligned<Encoder::kBlockSize>(block);
   const auto block_contents = Encoder::LoadBlock(block);
 
-  if (__builtin_expect(
-          Encoder::MayNeedValueEscaping(block_contents, offset, count),
-          false)) {
-    destination = tskv::EncodeValueEach(
+  if (__builtin_expect(Rules::template MayNeedEscaping<Encoder>(
+                           block_contents, offset, count),
+                       false)) {
+    destination = tskv::EncodeValueEach<Encoder, Rules>(
         destination, std::string_view(block + offset, count));
   } else {
     // happy path: the whole block does not need escaping
@@ -356,7 +412,7 @@ template <typename Encoder>
 }
 
 // BufferPtr must be passed around by value to avoid aliasing issues.
-template <typename Encoder>
+template <typename Encoder, typename Rules = TskvValueRules>
 [[nodiscard]] __attribute__((noinline)) BufferPtr<Encoder> EncodeValue(
     BufferPtr<Encoder> destination, std::string_view str) {
   if (str.empty()) return destination;
@@ -367,8 +423,8 @@ template <typename Encoder>
   const auto first_block_count =
       std::min(Encoder::kBlockSize - first_block_offset, str.size());
 
-  destination = tskv::EncodeValueBlock(destination, first_block,
-                                       first_block_offset, first_block_count);
+  destination = tskv::EncodeValueBlock<Encoder, Rules>(
+      destination, first_block, first_block_offset, first_block_count);
 
   const char* const last_block =
       AlignDown<Encoder::kBlockSize>(str.data() + str.size());
@@ -376,15 +432,15 @@ template <typename Encoder>
   if (last_block != first_block) {
     for (const char* current_block = first_block + Encoder::kBlockSize;
          current_block < last_block; current_block += Encoder::kBlockSize) {
-      destination = tskv::EncodeValueBlock(destination, current_block, 0,
-                                           Encoder::kBlockSize);
+      destination = tskv::EncodeValueBlock<Encoder, Rules>(
+          destination, current_block, 0, Encoder::kBlockSize);
     }
 
     const auto last_block_count =
         static_cast<std::size_t>(str.data() + str.size() - last_block);
     if (last_block_count != 0) {
-      destination =
-          tskv::EncodeValueBlock(destination, last_block, 0, last_block_count);
+      destination = tskv::EncodeValueBlock<Encoder, Rules>(
+          destination, last_block, 0, last_block_count);
     }
   }
 
@@ -0,0 +1,214 @@
+#pragma once
+
+/// @file userver/utils/impl/perfect_hash.hpp
+/// @brief @copybrief utils::impl::PerfectHashIndex
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::impl {
+
+inline constexpr std::uint64_t kPerfectHashMul = 0x9e3779b97f4a7c15;
+
+constexpr std::uint64_t PerfectHashMix(std::uint64_t value) noexcept {
+  value ^= value >> 32;
+  value *= 0xd6e8feb86659fd93;
+  value ^= value >> 32;
+  return value;
+}
+
+// Lowercases the ASCII letters in all the 8 bytes at once
+constexpr std::uint64_t LowercaseAscii8(std::uint64_t word) noexcept {
+  constexpr std::uint64_t kOnes = 0x0101010101010101;
+  const auto heptets = word & (kOnes * 0x7f);
+  const auto above_z = heptets + kOnes * (0x7f - 'Z');
+  const auto from_a = heptets + kOnes * (0x80 - 'A');
+  const auto is_upper = ~word & (from_a ^ above_z) & (kOnes * 0x80);
+  return word | (is_upper >> 2);
+}
+
+constexpr std::uint32_t LoadByte(const char* data) noexcept {
+  return static_cast<unsigned char>(*data);
+}
+
+// Compilers turn it into a single load on little-endian platforms
+constexpr std::uint32_t LoadLittleEndian32(const char* data) noexcept {
+  return LoadByte(data) | (LoadByte(data + 1) << 8) |
+         (LoadByte(data + 2) << 16) | (LoadByte(data + 3) << 24);
+}
+
+constexpr std::uint64_t LoadLittleEndian64(const char* data) noexcept {
+  return LoadLittleEndian32(data) |
+         (std::uint64_t{LoadLittleEndian32(data + 4)} << 32);
+}
+
+constexpr std::uint64_t PerfectHashRound(std::uint64_t hash,
+                                         std::uint64_t word) noexcept {
+  hash = (hash ^ LowercaseAscii8(word)) * kPerfectHashMul;
+  return hash ^ (hash >> 32);
+}
+
+// ASCII case insensitive, so that the same index serves both the exact and
+// the case insensitive search. The tails are read with overlapping loads of
+// a fixed size, strings of up to 8 chars never collide.
+constexpr std::uint64_t PerfectHashICase(std::string_view value) noexcept {
+  const auto size = value.size();
+  std::uint64_t hash = size * kPerfectHashMul;
+
+  const char* const data = value.data();
+
+  if (size > 8) {
+    for (std::size_t pos = 0; size - pos > 8; pos += 8) {
+      hash = PerfectHashRound(hash, LoadLittleEndian64(data + pos));
+    }
+    hash = PerfectHashRound(hash, LoadLittleEndian64(data + size - 8));
+  } else if (size >= 4) {
+    hash = PerfectHashRound(
+        hash, LoadLittleEndian32(data) |
+                  (std::uint64_t{LoadLittleEndian32(data + size - 4)} << 32));
+  } else if (size != 0) {
+    hash = PerfectHashRound(hash, LoadByte(data) |
+                                      (LoadByte(data + size / 2) << 8) |
+                                      (LoadByte(data + size - 1) << 16));
+  }
+
+  return PerfectHashMix(hash);
+}
+
+/// @brief Perfect hash index over `Size` strings that is built at compile
+/// time with the "hash and displace" algorithm.
+///
+/// The keys are split into small buckets by their hash, then the buckets
+/// starting from the biggest ones get a "pilot" value each, such that all
+/// the keys of the bucket get free slots in a table of 2-4 times the number of
+/// keys. A lookup takes a single hash computation and two array accesses.
+///
+/// The index does not store the keys, FindCandidate returns the index of
+/// the only key that could be equal to the searched value, the caller should
+/// compare them. The empty slots hold a value not less than `Size`, so
+/// a missing key costs no additional branch.
+///
+/// Keys that differ only in the letter case, or have colliding 64 bit hashes,
+/// make the index invalid and the caller should fall back to another search.
+/// For duplicate keys the first one is found.
+template <std::size_t Size>
+class PerfectHashIndex final {
+ public:
+  static_assert(Size < 0xffff, "Too many keys");
+
+  constexpr explicit PerfectHashIndex(
+      const std::array<std::string_view, Size>& keys) noexcept {
+    for (auto& slot : slots_) slot = kEmptySlot;
+
+    std::array<std::uint64_t, Size> hashes{};
+    std::array<bool, Size> is_duplicate{};
+    std::array<std::size_t, kBucketsCount> bucket_sizes{};
+    std::size_t max_bucket_size = 0;
+    for (std::size_t i = 0; i < Size; ++i) {
+      hashes[i] = PerfectHashICase(keys[i]);
+      for (std::size_t j = 0; j < i; ++j) {
+        if (is_duplicate[j] || hashes[j] != hashes[i]) continue;
+        if (keys[j] != keys[i]) return;
+        is_duplicate[i] = true;
+        break;
+      }
+      if (is_duplicate[i]) continue;
+
+      auto& bucket_size = bucket_sizes[GetBucket(hashes[i])];
+      ++bucket_size;
+      if (bucket_size > max_bucket_size) max_bucket_size = bucket_size;
+    }
+
+    for (auto size = max_bucket_size; size > 0; --size) {
+      for (std::size_t bucket = 0; bucket < kBucketsCount; ++bucket) {
+        if (bucket_sizes[bucket] != size) continue;
+        if (!PlaceBucket(bucket, hashes, is_duplicate)) return;
+      }
+    }
+
+    is_valid_ = true;
+  }
+
+  /// Returns false if the keys could not be indexed
+  constexpr bool IsValid() const noexcept { return is_valid_; }
+
+  /// Returns the index of the only key that may be equal to `value`, ignoring
+  /// the ASCII letter case, or a value not less than `Size` if there is none.
+  constexpr std::size_t FindCandidate(std::string_view value) const noexcept {
+    const auto hash = PerfectHashICase(value);
+    return slots_[GetSlot(hash, pilots_[GetBucket(hash)])];
+  }
+
+ private:
+  static constexpr std::size_t kBucketsCount = Size / 4 + 1;
+
+  static constexpr std::size_t MakeSlotsCount() noexcept {
+    std::size_t count = 1;
+    while (count < Size * 2) count *= 2;
+    return count;
+  }
+
+  static constexpr std::size_t kSlotsCount = MakeSlotsCount();
+  static constexpr std::uint64_t kSlotMul = 0xd6e8feb86659fd93;
+  static constexpr std::size_t kSlotShift = [] {
+    std::size_t shift = 64;
+    for (auto count = kSlotsCount; count > 1; count /= 2) --shift;
+    return shift;
+  }();
+  static constexpr std::uint16_t kEmptySlot = 0xffff;
+
+  static constexpr std::size_t GetBucket(std::uint64_t hash) noexcept {
+    return ((hash >> 32) * kBucketsCount) >> 32;
+  }
+
+  static constexpr std::size_t GetSlot(std::uint64_t hash,
+                                       std::uint16_t pilot) noexcept {
+    // Multiply-shift takes the high bits, which depend on all the bits of
+    // the hash and the pilot
+    return ((hash ^ (pilot * kPerfectHashMul)) * kSlotMul) >> kSlotShift;
+  }
+
+  constexpr bool PlaceBucket(
+      std::size_t bucket, const std::array<std::uint64_t, Size>& hashes,
+      const std::array<bool, Size>& is_duplicate) noexcept {
+    std::array<std::size_t, Size> keys{};
+    std::size_t keys_count = 0;
+    for (std::size_t i = 0; i < Size; ++i) {
+      if (!is_duplicate[i] && GetBucket(hashes[i]) == bucket) {
+        keys[keys_count++] = i;
+      }
+    }
+
+    for (std::uint16_t pilot = 0; pilot != kEmptySlot; ++pilot) {
+      std::size_t placed = 0;
+      for (; placed < keys_count; ++placed) {
+        auto& slot = slots_[GetSlot(hashes[keys[placed]], pilot)];
+        if (slot != kEmptySlot) break;
+        slot = static_cast<std::uint16_t>(keys[placed]);
+      }
+
+      if (placed == keys_count) {
+        pilots_[bucket] = pilot;
+        return true;
+      }
+
+      for (std::size_t i = 0; i < placed; ++i) {
+        slots_[GetSlot(hashes[keys[i]], pilot)] = kEmptySlot;
+      }
+    }
+
+    return false;
+  }
+
+  std::array<std::uint16_t, kBucketsCount> pilots_{};
+  std::array<std::uint16_t, kSlotsCount> slots_{};
+  bool is_valid_{false};
+};
+
+}  // namespace utils::impl
+
+USERVER_NAMESPACE_END
@@ -4,6 +4,8 @@
 /// @brief @copybrief utils::regex
 
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include <userver/utils/fast_pimpl.hpp>
 
@@ -13,14 +15,33 @@ namespace utils {
 
 class match_results;
 
+/// @brief The engine that compiles and matches a utils::regex
+enum class RegexEngine {
+  /// boost::regex with the Perl syntax, backtracking. The matching time may
+  /// grow exponentially with the input length for some patterns
+  kBoost,
+
+  /// RE2 automata, the matching time is linear in the input length. Supports
+  /// the RE2 syntax, which has no backreferences and lookarounds; `^` and `$`
+  /// match only at the text boundaries. Falls back to kBoost if userver is
+  /// built without USERVER_FEATURE_RE2
+  kLinear,
+};
+
 /// @ingroup userver_universal userver_containers
 ///
 /// @brief Small alias for boost::regex / std::regex without huge includes
+///
+/// Copies share the compiled pattern, so a regex may be compiled once and
+/// cached, e.g. in a component or in a static variable.
 class regex final {
  public:
   regex();
   explicit regex(std::string_view pattern);
 
+  /// @throws std::runtime_error if the pattern is invalid for the engine
+  regex(std::string_view pattern, RegexEngine engine);
+
   ~regex();
 
   regex(const regex&);
@@ -33,9 +54,13 @@ class regex final {
 
   std::string str() const;
 
+  /// The engine that actually matches the pattern, i.e. kBoost for a kLinear
+  /// regex if userver is built without RE2
+  RegexEngine GetEngine() const noexcept;
+
  private:
   struct Impl;
-  utils::FastPimpl<Impl, 16, 8> impl_;
+  utils::FastPimpl<Impl, 32, 8> impl_;
 
   friend class match_results;
   friend bool regex_match(std::string_view str, const regex& pattern);
@@ -66,7 +91,7 @@ class match_results final {
 
  private:
   struct Impl;
-  utils::FastPimpl<Impl, 80, 8> impl_;
+  utils::FastPimpl<Impl, 104, 8> impl_;
 
   friend bool regex_match(std::string_view str, const regex& pattern);
   friend bool regex_match(std::string_view str, match_results& m,
@@ -99,6 +124,45 @@ bool regex_search(std::string_view str, const regex& pattern);
 std::string regex_replace(std::string_view str, const regex& pattern,
                           std::string_view repl);
 
+/// @ingroup userver_universal userver_containers
+///
+/// @brief A set of regular expressions that are searched for in the input
+/// at once
+///
+/// With USERVER_FEATURE_RE2 the patterns are compiled into a single RE2::Set
+/// automaton with the RegexEngine::kLinear syntax, and the input is scanned
+/// once regardless of the number of the patterns. Otherwise each of the
+/// patterns is searched for with boost::regex.
+///
+/// Copies share the compiled automaton.
+class RegexSet final {
+ public:
+  /// @throws std::runtime_error if any of the patterns is invalid
+  explicit RegexSet(const std::vector<std::string>& patterns);
+
+  ~RegexSet();
+
+  RegexSet(const RegexSet&);
+  RegexSet(RegexSet&&) noexcept;
+
+  RegexSet& operator=(const RegexSet&);
+  RegexSet& operator=(RegexSet&&) noexcept;
+
+  /// @returns the ascending indices of the patterns that match anywhere in
+  /// `str`
+  std::vector<std::size_t> Search(std::string_view str) const;
+
+  /// @returns true if any of the patterns matches anywhere in `str`
+  bool SearchAny(std::string_view str) const;
+
+  /// @returns the number of the patterns
+  std::size_t size() const noexcept;
+
+ private:
+  struct Impl;
+  utils::FastPimpl<Impl, 48, 8> impl_;
+};
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
@@ -3,6 +3,7 @@
 /// @file userver/utils/trivial_map.hpp
 /// @brief Bidirectional map|sets over string literals or other trivial types.
 
+#include <array>
 #include <cstddef>
 #include <optional>
 #include <string>
@@ -15,6 +16,7 @@
 
 #include <userver/compiler/demangle.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/impl/perfect_hash.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -414,7 +416,7 @@ class CaseCounter final {
     return *this;
   }
 
-  template <typename T, typename U>
+  template <typename T, typename U = void>
   constexpr CaseCounter& Type() {
     return *this;
   }
@@ -576,6 +578,141 @@ class CaseFirstIndexer final {
   std::size_t index_ = 0;
 };
 
+template <typename First, typename Second, std::size_t Size>
+class CaseCollector final {
+ public:
+  constexpr CaseCollector& Case(First first, Second second) noexcept {
+    firsts[index_] = first;
+    seconds[index_] = second;
+    ++index_;
+    return *this;
+  }
+
+  template <typename T, typename U>
+  constexpr CaseCollector& Type() {
+    return *this;
+  }
+
+  std::array<First, Size> firsts{};
+  std::array<Second, Size> seconds{};
+
+ private:
+  std::size_t index_{0};
+};
+
+template <typename First, std::size_t Size>
+class CaseCollector<First, void, Size> final {
+ public:
+  constexpr CaseCollector& Case(First first) noexcept {
+    firsts[index_] = first;
+    ++index_;
+    return *this;
+  }
+
+  template <typename T, typename U = void>
+  constexpr CaseCollector& Type() {
+    return *this;
+  }
+
+  std::array<First, Size> firsts{};
+
+ private:
+  std::size_t index_{0};
+};
+
+// Maps with fewer cases are searched by comparing the keys one by one, which
+// is as fast as hashing for them, see trivial_map_benchmark.cpp
+inline constexpr std::size_t kTrivialMapHashThreshold = 64;
+
+struct CaseCounterFactory final {
+  constexpr CaseCounter operator()() const noexcept { return CaseCounter{}; }
+};
+
+// Number of cases of the mapping function that could be looked into at
+// compile time, or 0. That requires the function to be default constructible,
+// which lambdas are not before C++20, and the Case parameters to be constant.
+template <typename BuilderFunc, typename Enabled = void>
+inline constexpr std::size_t kConstexprCasesCount = 0;
+
+template <typename BuilderFunc>
+inline constexpr std::size_t kConstexprCasesCount<
+    BuilderFunc,
+    std::enable_if_t<(BuilderFunc{}(CaseCounterFactory{}).Extract(), true)>> =
+    BuilderFunc{}(CaseCounterFactory{}).Extract();
+
+// Cases of a big map copied into arrays along with the perfect hash indexes
+// for the string keys, all computed at compile time. The Find* functions
+// return the index of the matching case or kSize if there is none.
+template <typename BuilderFunc, typename First, typename Second>
+struct TrivialMapHashed final {
+  static constexpr std::size_t kSize = kConstexprCasesCount<BuilderFunc>;
+
+  static constexpr CaseCollector<First, Second, kSize> kCases = BuilderFunc{}(
+      []() { return CaseCollector<First, Second, kSize>{}; });
+
+  static constexpr PerfectHashIndex<kSize> kFirstIndex{kCases.firsts};
+  static constexpr PerfectHashIndex<kSize> kSecondIndex{kCases.seconds};
+
+  template <typename T>
+  static constexpr bool CanFindFirst() noexcept {
+    if constexpr (std::is_same_v<First, std::string_view> &&
+                  std::is_convertible_v<T, std::string_view> &&
+                  kSize >= kTrivialMapHashThreshold) {
+      return kFirstIndex.IsValid();
+    } else {
+      return false;
+    }
+  }
+
+  template <typename T>
+  static constexpr bool CanFindSecond() noexcept {
+    if constexpr (std::is_same_v<Second, std::string_view> &&
+                  std::is_convertible_v<T, std::string_view> &&
+                  kSize >= kTrivialMapHashThreshold) {
+      return kSecondIndex.IsValid();
+    } else {
+      return false;
+    }
+  }
+
+  static constexpr std::size_t FindFirst(std::string_view value) noexcept {
+    const auto index = kFirstIndex.FindCandidate(value);
+    if (index >= kSize || kCases.firsts[index] != value) return kSize;
+    return index;
+  }
+
+  static constexpr std::size_t FindFirstICase(
+      std::string_view value) noexcept {
+    const auto index = kFirstIndex.FindCandidate(value);
+    if (index >= kSize || !ICaseEqual(kCases.firsts[index], value)) {
+      return kSize;
+    }
+    return index;
+  }
+
+  static constexpr std::size_t FindSecond(std::string_view value) noexcept {
+    const auto index = kSecondIndex.FindCandidate(value);
+    if (index >= kSize || kCases.seconds[index] != value) return kSize;
+    return index;
+  }
+
+  static constexpr std::size_t FindSecondICase(
+      std::string_view value) noexcept {
+    const auto index = kSecondIndex.FindCandidate(value);
+    if (index >= kSize || !ICaseEqual(kCases.seconds[index], value)) {
+      return kSize;
+    }
+    return index;
+  }
+
+ private:
+  static constexpr bool ICaseEqual(std::string_view lowercase,
+                                   std::string_view value) noexcept {
+    return lowercase.size() == value.size() &&
+           ICaseEqualLowercase(lowercase, value);
+  }
+};
+
 }  // namespace impl
 
 /// @ingroup userver_universal userver_containers
@@ -598,6 +735,13 @@ class CaseFirstIndexer final {
 /// The same story with integral or enum mappings - compiler optimizes them
 /// into a switch and it usually takes O(1) to find the match.
 ///
+/// Maps and sets with 64 or more string keys, like the ones generated for
+/// big enums, are searched with a perfect hash that is computed at compile
+/// time. It requires the Case parameters to be constants and the mapping
+/// function to be default constructible, which is the case for
+/// utils::MakeTrivialBiMap, utils::MakeTrivialSet and for the lambdas in C++20;
+/// the lambdas in C++17 are always searched by comparing the keys.
+///
 /// @snippet universal/src/utils/trivial_map_test.cpp  sample bidir bimap
 ///
 /// Empty map:
@@ -638,15 +782,29 @@ class TrivialBiMap final {
   }
 
   constexpr std::optional<Second> TryFindByFirst(First value) const noexcept {
-    return func_(
-               [value]() { return impl::SwitchByFirst<First, Second>{value}; })
-        .Extract();
+    if constexpr (Hashed::template CanFindFirst<First>()) {
+      const auto index = Hashed::FindFirst(value);
+      if (index == Hashed::kSize) return std::nullopt;
+      return Hashed::kCases.seconds[index];
+    } else {
+      return func_([value]() {
+               return impl::SwitchByFirst<First, Second>{value};
+             })
+          .Extract();
+    }
   }
 
   constexpr std::optional<First> TryFindBySecond(Second value) const noexcept {
-    return func_(
-               [value]() { return impl::SwitchBySecond<First, Second>{value}; })
-        .Extract();
+    if constexpr (Hashed::template CanFindSecond<Second>()) {
+      const auto index = Hashed::FindSecond(value);
+      if (index == Hashed::kSize) return std::nullopt;
+      return Hashed::kCases.firsts[index];
+    } else {
+      return func_([value]() {
+               return impl::SwitchBySecond<First, Second>{value};
+             })
+          .Extract();
+    }
   }
 
   template <class T>
@@ -668,8 +826,15 @@ class TrivialBiMap final {
   /// string literal.
   constexpr std::optional<Second> TryFindICaseByFirst(
       std::string_view value) const noexcept {
-    return func_([value]() { return impl::SwitchByFirstICase<Second>{value}; })
-        .Extract();
+    if constexpr (Hashed::template CanFindFirst<std::string_view>()) {
+      const auto index = Hashed::FindFirstICase(value);
+      if (index == Hashed::kSize) return std::nullopt;
+      return Hashed::kCases.seconds[index];
+    } else {
+      return func_(
+                 [value]() { return impl::SwitchByFirstICase<Second>{value}; })
+          .Extract();
+    }
   }
 
   /// @brief Case insensitive search for value.
@@ -678,8 +843,15 @@ class TrivialBiMap final {
   /// string literal.
   constexpr std::optional<First> TryFindICaseBySecond(
       std::string_view value) const noexcept {
-    return func_([value]() { return impl::SwitchBySecondICase<First>{value}; })
-        .Extract();
+    if constexpr (Hashed::template CanFindSecond<std::string_view>()) {
+      const auto index = Hashed::FindSecondICase(value);
+      if (index == Hashed::kSize) return std::nullopt;
+      return Hashed::kCases.firsts[index];
+    } else {
+      return func_(
+                 [value]() { return impl::SwitchBySecondICase<First>{value}; })
+          .Extract();
+    }
   }
 
   /// @brief Case insensitive search for value that calls either
@@ -795,6 +967,8 @@ class TrivialBiMap final {
   constexpr iterator cend() const { return end(); }
 
  private:
+  using Hashed = impl::TrivialMapHashed<BuilderFunc, First, Second>;
+
   const BuilderFunc func_;
 };
 
@@ -826,17 +1000,26 @@ class TrivialSet final {
   }
 
   constexpr bool Contains(First value) const noexcept {
-    return func_(
-               [value]() { return impl::SwitchByFirst<First, Second>{value}; })
-        .Extract();
+    if constexpr (Hashed::template CanFindFirst<First>()) {
+      return Hashed::FindFirst(value) != Hashed::kSize;
+    } else {
+      return func_([value]() {
+               return impl::SwitchByFirst<First, Second>{value};
+             })
+          .Extract();
+    }
   }
 
   constexpr bool ContainsICase(std::string_view value) const noexcept {
     static_assert(std::is_convertible_v<First, std::string_view>,
                   "ContainsICase works only with std::string_view");
 
-    return func_([value]() { return impl::SwitchByFirstICase<void>{value}; })
-        .Extract();
+    if constexpr (Hashed::template CanFindFirst<std::string_view>()) {
+      return Hashed::FindFirstICase(value) != Hashed::kSize;
+    } else {
+      return func_([value]() { return impl::SwitchByFirstICase<void>{value}; })
+          .Extract();
+    }
   }
 
   constexpr std::size_t size() const noexcept {
@@ -855,10 +1038,19 @@ class TrivialSet final {
   /// Returns index of the value in Case parameters or std::nullopt if no such
   /// value.
   constexpr std::optional<std::size_t> GetIndex(First value) const {
-    return func_([value]() { return impl::CaseFirstIndexer{value}; }).Extract();
+    if constexpr (Hashed::template CanFindFirst<First>()) {
+      const auto index = Hashed::FindFirst(value);
+      if (index == Hashed::kSize) return std::nullopt;
+      return index;
+    } else {
+      return func_([value]() { return impl::CaseFirstIndexer{value}; })
+          .Extract();
+    }
   }
 
  private:
+  using Hashed = impl::TrivialMapHashed<BuilderFunc, First, Second>;
+
   const BuilderFunc func_;
 };
 
@@ -0,0 +1,55 @@
+#include <userver/cache/impl/frequency_sketch.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+using Sketch = cache::impl::FrequencySketch<std::string>;
+
+TEST(FrequencySketch, Estimate) {
+  Sketch sketch(100);
+  EXPECT_EQ(sketch.Estimate("a"), 0);
+
+  sketch.Increment("a");
+  EXPECT_EQ(sketch.Estimate("a"), 1);
+
+  for (int i = 0; i < 5; ++i) sketch.Increment("a");
+  EXPECT_EQ(sketch.Estimate("a"), 6);
+
+  sketch.Increment("b");
+  EXPECT_EQ(sketch.Estimate("b"), 1);
+  EXPECT_EQ(sketch.Estimate("a"), 6);
+}
+
+TEST(FrequencySketch, Saturates) {
+  Sketch sketch(100);
+  for (int i = 0; i < 100; ++i) sketch.Increment("a");
+  EXPECT_EQ(sketch.Estimate("a"), Sketch::kMaxFrequency + 1);
+}
+
+TEST(FrequencySketch, Ages) {
+  constexpr std::size_t kCapacity = 256;
+  Sketch sketch(kCapacity);
+  for (int i = 0; i < 10; ++i) sketch.Increment("hot");
+  EXPECT_EQ(sketch.Estimate("hot"), 10);
+
+  // After 10 * kCapacity increments the old frequencies are halved
+  for (std::size_t i = 0; i < 4 * kCapacity; ++i) {
+    const auto key = std::to_string(i);
+    for (int j = 0; j < 3; ++j) sketch.Increment(key);
+  }
+  EXPECT_LT(sketch.Estimate("hot"), 10);
+  EXPECT_GT(sketch.Estimate("hot"), 0);
+}
+
+TEST(FrequencySketch, Clear) {
+  Sketch sketch(100);
+  sketch.Increment("a");
+  sketch.Increment("a");
+  sketch.Clear();
+  EXPECT_EQ(sketch.Estimate("a"), 0);
+}
+
+USERVER_NAMESPACE_END
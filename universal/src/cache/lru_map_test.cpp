@@ -28,6 +28,10 @@ struct NotMovable {
 
   int value;
 };
+
+struct CollidingHash {
+  std::size_t operator()(int value) const noexcept { return value % 3; }
+};
 }  // namespace
 
 using Lru = cache::LruMap<int, int>;
@@ -186,11 +190,14 @@ TEST(Lru, Emplace) {
 TEST(Lru, GetLeastUsed) {
   Lru cache{2};
   EXPECT_EQ(cache.GetLeastUsed(), nullptr);
+  EXPECT_EQ(cache.GetLeastUsedKey(), nullptr);
   cache.Put(1, 10);
   cache.Put(2, 20);
   EXPECT_EQ(*cache.GetLeastUsed(), 10);
+  EXPECT_EQ(*cache.GetLeastUsedKey(), 1);
   cache.Get(1);
   EXPECT_EQ(*cache.GetLeastUsed(), 20);
+  EXPECT_EQ(*cache.GetLeastUsedKey(), 2);
 }
 
 TEST(Lru, Movable) {
@@ -213,4 +220,54 @@ TEST(Lru, NotMovable) {
   EXPECT_EQ(cache.GetLeastUsed()->value, 4);
 }
 
+TEST(Lru, EraseWithCollisions) {
+  cache::LruMap<int, int, CollidingHash> cache(10);
+
+  for (int i = 0; i < 10; ++i) {
+    cache.Put(i, i * 10);
+  }
+  for (int i = 0; i < 10; i += 2) {
+    cache.Erase(i);
+  }
+  EXPECT_EQ(cache.GetSize(), 5);
+  for (int i = 0; i < 10; ++i) {
+    auto* value = cache.Get(i);
+    if (i % 2) {
+      ASSERT_NE(value, nullptr);
+      EXPECT_EQ(*value, i * 10);
+    } else {
+      EXPECT_EQ(value, nullptr);
+    }
+  }
+
+  for (int i = 10; i < 20; ++i) {
+    cache.Put(i, i * 10);
+  }
+  EXPECT_EQ(cache.GetSize(), 10);
+  EXPECT_EQ(*cache.GetLeastUsedKey(), 10);
+  for (int i = 10; i < 20; ++i) {
+    EXPECT_EQ(cache.GetOr(i, -1), i * 10);
+  }
+}
+
+TEST(Lru, MoveAndReuse) {
+  cache::LruMap<int, NotMovable> cache{2};
+  cache.Emplace(1, 2);
+  cache.Emplace(3, 4);
+
+  auto other = std::move(cache);
+  EXPECT_EQ(other.GetSize(), 2);
+  EXPECT_EQ(other.Get(1)->value, 2);
+
+  // NOLINTNEXTLINE(bugprone-use-after-move)
+  EXPECT_EQ(cache.GetSize(), 0);
+  cache.Emplace(5, 6);
+  EXPECT_EQ(cache.Get(5)->value, 6);
+
+  other.Clear();
+  EXPECT_EQ(other.GetSize(), 0);
+  other.Emplace(7, 8);
+  EXPECT_EQ(other.GetLeastUsed()->value, 8);
+}
+
 USERVER_NAMESPACE_END
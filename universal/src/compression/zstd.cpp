@@ -1,70 +1,187 @@
 #include <userver/compression/zstd.hpp>
 
+#include <memory>
+
 #include <zstd.h>
 #include <zstd_errors.h>
 
+#include <userver/compiler/thread_local.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace compression::zstd {
 
+namespace impl {
+
+void CompressionContextDeleter::operator()(ZSTD_CCtx* context) const noexcept {
+  ZSTD_freeCCtx(context);
+}
+
+void DecompressionContextDeleter::operator()(
+    ZSTD_DCtx* context) const noexcept {
+  ZSTD_freeDCtx(context);
+}
+
+}  // namespace impl
+
 namespace {
-// The same size as in ZSTD_DStreamOutSize();
-const size_t kDecompressBufferSize = ZSTD_DStreamOutSize();
-}  // namespace
 
-std::string DecompressStream(std::string_view compressed, size_t max_size) {
-  std::string decompressed;
-  std::string buf(kDecompressBufferSize, '\0');
+using CompressionContext =
+    std::unique_ptr<ZSTD_CCtx, impl::CompressionContextDeleter>;
+using DecompressionContext =
+    std::unique_ptr<ZSTD_DCtx, impl::DecompressionContextDeleter>;
 
-  auto* stream = ZSTD_createDStream();
-  if (stream == nullptr) {
-    throw std::runtime_error("Couldn't create ZSTD decompression stream");
+// The contexts keep their buffers between the calls
+compiler::ThreadLocal local_compression_context = [] {
+  return CompressionContext{};
+};
+compiler::ThreadLocal local_decompression_context = [] {
+  return DecompressionContext{};
+};
+
+void ThrowIfCompressionError(std::size_t ret) {
+  if (ZSTD_isError(ret)) {
+    throw CompressionError(
+        fmt::format("Compression failed: {}", ZSTD_getErrorName(ret)));
   }
-  auto stream_del = [](ZSTD_DStream* ptr) { ZSTD_freeDStream(ptr); };
-  auto stream_guard =
-      std::unique_ptr<ZSTD_DStream, decltype(stream_del)>(stream, stream_del);
-
-  {
-    const auto err_code = ZSTD_DCtx_reset(
-        stream, ZSTD_ResetDirective::ZSTD_reset_session_and_parameters);
-    if (ZSTD_isError(err_code)) {
-      throw ErrWithCode(ZSTD_getErrorName(err_code));
-    }
+}
+
+void ThrowIfDecompressionError(std::size_t ret) {
+  if (ZSTD_isError(ret)) throw ErrWithCode(ZSTD_getErrorName(ret));
+}
+
+CompressionContext MakeCompressionContext() {
+  CompressionContext context{ZSTD_createCCtx()};
+  if (!context) {
+    throw CompressionError("Couldn't create ZSTD compression context");
+  }
+  return context;
+}
+
+DecompressionContext MakeDecompressionContext() {
+  DecompressionContext context{ZSTD_createDCtx()};
+  if (!context) {
+    throw DecompressionError("Couldn't create ZSTD decompression context");
   }
+  return context;
+}
 
-  for (size_t cur_pos(0); cur_pos < compressed.size();) {
-    ZSTD_inBuffer input{
-        compressed.data() + cur_pos,
-        std::min(kDecompressBufferSize, compressed.size() - cur_pos), 0};
+ZSTD_CCtx& GetLocalCompressionContext(CompressionContext& context) {
+  if (!context) context = MakeCompressionContext();
+  ZSTD_CCtx_reset(context.get(), ZSTD_reset_session_and_parameters);
+  return *context;
+}
 
-    while (input.pos < input.size) {
-      ZSTD_outBuffer output{buf.data(), buf.size(), 0};
+ZSTD_DCtx& GetLocalDecompressionContext(DecompressionContext& context) {
+  if (!context) context = MakeDecompressionContext();
+  ZSTD_DCtx_reset(context.get(), ZSTD_reset_session_and_parameters);
+  return *context;
+}
 
-      if (const auto ret = ZSTD_decompressStream(stream, &output, &input);
-          ZSTD_isError(ret)) {
-        throw ErrWithCode(ZSTD_getErrorName(ret));
-      }
+std::string CompressStream(ZSTD_CCtx& context, std::string_view data,
+                           ZSTD_EndDirective directive) {
+  std::string compressed;
+  ZSTD_inBuffer input{data.data(), data.size(), 0};
+  const auto chunk_size = ZSTD_CStreamOutSize();
+
+  while (true) {
+    const auto old_size = compressed.size();
+    compressed.resize(old_size + chunk_size);
+    ZSTD_outBuffer output{compressed.data() + old_size, chunk_size, 0};
+
+    const auto remaining =
+        ZSTD_compressStream2(&context, &output, &input, directive);
+    ThrowIfCompressionError(remaining);
+    compressed.resize(old_size + output.pos);
+
+    const bool done = directive == ZSTD_e_continue ? input.pos == input.size
+                                                   : remaining == 0;
+    if (done) break;
+  }
+
+  return compressed;
+}
+
+// Appends the decompressed data to `decompressed`. Returns true if
+// the `compressed` ends with a complete frame.
+bool DecompressStream(ZSTD_DCtx& context, std::string_view compressed,
+                      std::string& decompressed, std::size_t max_size) {
+  const auto chunk_size = ZSTD_DStreamOutSize();
+  ZSTD_inBuffer input{compressed.data(), compressed.size(), 0};
+
+  std::size_t ret = 0;
+  // The decompressor may hold the data that did not fit into the output
+  // buffer, it is flushed once the output buffer is not filled completely
+  bool output_full = true;
+  while (input.pos < input.size || output_full) {
+    const auto old_size = decompressed.size();
+    decompressed.resize(old_size + chunk_size);
+    ZSTD_outBuffer output{decompressed.data() + old_size, chunk_size, 0};
+
+    ret = ZSTD_decompressStream(&context, &output, &input);
+    ThrowIfDecompressionError(ret);
+    decompressed.resize(old_size + output.pos);
+
+    if (decompressed.size() > max_size) throw TooBigError();
+    output_full = output.pos == output.size;
+  }
+
+  return ret == 0;
+}
+
+}  // namespace
 
-      decompressed.append(static_cast<char*>(output.dst), output.pos);
+struct Dictionary::Impl final {
+  struct CDictDeleter final {
+    void operator()(ZSTD_CDict* dictionary) const noexcept {
+      ZSTD_freeCDict(dictionary);
     }
+  };
 
-    if (decompressed.size() > max_size) {
-      throw TooBigError();
+  struct DDictDeleter final {
+    void operator()(ZSTD_DDict* dictionary) const noexcept {
+      ZSTD_freeDDict(dictionary);
     }
+  };
 
-    cur_pos += input.size;
+  std::unique_ptr<ZSTD_CDict, CDictDeleter> compression;
+  std::unique_ptr<ZSTD_DDict, DDictDeleter> decompression;
+};
+
+Dictionary::Dictionary(std::string_view content, int level)
+    : impl_(std::make_unique<Impl>()) {
+  impl_->compression.reset(
+      ZSTD_createCDict(content.data(), content.size(), level));
+  impl_->decompression.reset(
+      ZSTD_createDDict(content.data(), content.size()));
+  if (!impl_->compression || !impl_->decompression) {
+    throw CompressionError("Couldn't load ZSTD dictionary");
   }
+}
 
-  return decompressed;
+Dictionary::Dictionary(Dictionary&&) noexcept = default;
+
+Dictionary& Dictionary::operator=(Dictionary&&) noexcept = default;
+
+Dictionary::~Dictionary() = default;
+
+unsigned Dictionary::GetId() const noexcept {
+  return ZSTD_getDictID_fromDDict(impl_->decompression.get());
 }
 
 std::string Decompress(std::string_view compressed, size_t max_size) {
   const auto decompressed_size =
       ZSTD_getFrameContentSize(compressed.data(), compressed.size());
 
+  auto context = local_decompression_context.Use();
+  auto& dctx = GetLocalDecompressionContext(*context);
+
   switch (decompressed_size) {
-    case ZSTD_CONTENTSIZE_UNKNOWN:
-      return DecompressStream(compressed, max_size);
+    case ZSTD_CONTENTSIZE_UNKNOWN: {
+      std::string decompressed;
+      DecompressStream(dctx, compressed, decompressed, max_size);
+      return decompressed;
+    }
     case ZSTD_CONTENTSIZE_ERROR:
       throw std::runtime_error("Error while getting size");
     default:
@@ -74,13 +191,102 @@ std::string Decompress(std::string_view compressed, size_t max_size) {
   }
 
   std::string decompressed(decompressed_size, '\0');
-  if (const auto ret =
-          ZSTD_decompress(decompressed.data(), decompressed.capacity(),
+  const auto ret =
+      ZSTD_decompressDCtx(&dctx, decompressed.data(), decompressed.size(),
                           compressed.data(), compressed.size());
-      ZSTD_isError(ret)) {
-    throw ErrWithCode(ZSTD_getErrorName(ret));
+  ThrowIfDecompressionError(ret);
+
+  return decompressed;
+}
+
+std::string Decompress(std::string_view compressed, size_t max_size,
+                       const Dictionary& dictionary) {
+  auto context = local_decompression_context.Use();
+  auto& dctx = GetLocalDecompressionContext(*context);
+  ThrowIfDecompressionError(
+      ZSTD_DCtx_refDDict(&dctx, dictionary.impl_->decompression.get()));
+
+  std::string decompressed;
+  if (!DecompressStream(dctx, compressed, decompressed, max_size)) {
+    throw DecompressionError("Decompression failed: truncated frame");
   }
+  return decompressed;
+}
+
+std::string Compress(std::string_view data, int level, bool with_checksum) {
+  auto context = local_compression_context.Use();
+  auto& cctx = GetLocalCompressionContext(*context);
+  ZSTD_CCtx_setParameter(&cctx, ZSTD_c_compressionLevel, level);
+  ZSTD_CCtx_setParameter(&cctx, ZSTD_c_checksumFlag, with_checksum ? 1 : 0);
+
+  std::string compressed(ZSTD_compressBound(data.size()), '\0');
+  const auto size = ZSTD_compress2(&cctx, compressed.data(), compressed.size(),
+                                   data.data(), data.size());
+  ThrowIfCompressionError(size);
+
+  compressed.resize(size);
+  return compressed;
+}
+
+std::string Compress(std::string_view data, const Dictionary& dictionary,
+                     bool with_checksum) {
+  auto context = local_compression_context.Use();
+  auto& cctx = GetLocalCompressionContext(*context);
+  ThrowIfCompressionError(
+      ZSTD_CCtx_refCDict(&cctx, dictionary.impl_->compression.get()));
+  ZSTD_CCtx_setParameter(&cctx, ZSTD_c_checksumFlag, with_checksum ? 1 : 0);
+
+  std::string compressed(ZSTD_compressBound(data.size()), '\0');
+  const auto size = ZSTD_compress2(&cctx, compressed.data(), compressed.size(),
+                                   data.data(), data.size());
+  ThrowIfCompressionError(size);
+
+  compressed.resize(size);
+  return compressed;
+}
 
+Compressor::Compressor(int level, bool with_checksum)
+    : context_(MakeCompressionContext()) {
+  ThrowIfCompressionError(ZSTD_CCtx_setParameter(
+      context_.get(), ZSTD_c_compressionLevel, level));
+  ThrowIfCompressionError(ZSTD_CCtx_setParameter(
+      context_.get(), ZSTD_c_checksumFlag, with_checksum ? 1 : 0));
+}
+
+Compressor::Compressor(const Dictionary& dictionary, bool with_checksum)
+    : context_(MakeCompressionContext()) {
+  ThrowIfCompressionError(ZSTD_CCtx_refCDict(
+      context_.get(), dictionary.impl_->compression.get()));
+  ThrowIfCompressionError(ZSTD_CCtx_setParameter(
+      context_.get(), ZSTD_c_checksumFlag, with_checksum ? 1 : 0));
+}
+
+std::string Compressor::Compress(std::string_view data) {
+  return CompressStream(*context_, data, ZSTD_e_continue);
+}
+
+std::string Compressor::Flush() {
+  return CompressStream(*context_, {}, ZSTD_e_flush);
+}
+
+std::string Compressor::Finish() {
+  return CompressStream(*context_, {}, ZSTD_e_end);
+}
+
+Decompressor::Decompressor(size_t max_size)
+    : context_(MakeDecompressionContext()), max_size_(max_size) {}
+
+Decompressor::Decompressor(size_t max_size, const Dictionary& dictionary)
+    : Decompressor(max_size) {
+  ThrowIfDecompressionError(ZSTD_DCtx_refDDict(
+      context_.get(), dictionary.impl_->decompression.get()));
+}
+
+std::string Decompressor::Decompress(std::string_view compressed) {
+  std::string decompressed;
+  frame_complete_ = DecompressStream(*context_, compressed, decompressed,
+                                     max_size_ - total_size_);
+  total_size_ += decompressed.size();
   return decompressed;
 }
 
@@ -47,4 +47,37 @@ static void ZstdDecompress(benchmark::State& state) {
 }
 BENCHMARK(ZstdDecompress)->RangeMultiplier(2)->Range(1 << 10, 1 << 15);
 
+static void ZstdCompress(benchmark::State& state) {
+  const auto data = GenerateRandomData(state.range(0));
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(
+        compression::zstd::Compress(data, static_cast<int>(state.range(1))));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(ZstdCompress)
+    ->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 15, 2), {1, 3}});
+
+static void ZstdCompressSmallJson(benchmark::State& state) {
+  const std::string json =
+      R"({"id":"a3f1","status":"active","created_at":"2023-01-01T00:00:00Z",)"
+      R"("tags":["first","second"],"owner":{"name":"user","role":"admin"}})";
+  std::string samples;
+  for (int i = 0; i < 16; ++i) samples += json;
+  const compression::zstd::Dictionary dictionary{samples, 3};
+  const bool with_dictionary = state.range(0);
+
+  std::size_t compressed_size = 0;
+  for ([[maybe_unused]] auto _ : state) {
+    const auto compressed =
+        with_dictionary ? compression::zstd::Compress(json, dictionary)
+                        : compression::zstd::Compress(json, 3);
+    compressed_size = compressed.size();
+  }
+  state.counters["ratio"] =
+      static_cast<double>(json.size()) / static_cast<double>(compressed_size);
+}
+BENCHMARK(ZstdCompressSmallJson)->Arg(false)->Arg(true);
+
 USERVER_NAMESPACE_END
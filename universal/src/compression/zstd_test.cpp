@@ -65,4 +65,119 @@ TEST(Zstd, TestOverflow) {
       compression::TooBigError);
 }
 
+TEST(Zstd, CompressRoundTrip) {
+  constexpr std::size_t kSize = 16'000;
+  const std::string str(kSize, 'a');
+
+  const auto compressed = compression::zstd::Compress(str, 3);
+  EXPECT_LT(compressed.size(), str.size());
+
+  EXPECT_EQ(compression::zstd::Decompress(compressed, kSize), str);
+}
+
+TEST(Zstd, CompressEmpty) {
+  const auto compressed = compression::zstd::Compress({}, 3);
+  EXPECT_EQ(compression::zstd::Decompress(compressed, 0), "");
+}
+
+TEST(Zstd, CompressWithChecksum) {
+  const std::string str(16'000, 'a');
+
+  auto compressed = compression::zstd::Compress(str, 3, true);
+  EXPECT_GT(compressed.size(), compression::zstd::Compress(str, 3).size());
+  EXPECT_EQ(compression::zstd::Decompress(compressed, str.size()), str);
+
+  // The checksum is stored at the end of the frame
+  compressed.back() ^= 1;
+  EXPECT_THROW(compression::zstd::Decompress(compressed, str.size()),
+               compression::DecompressionError);
+}
+
+namespace {
+
+const std::string kJsonSample =
+    R"({"id":"a3f1","status":"active","created_at":"2023-01-01T00:00:00Z",)"
+    R"("tags":["first","second"],"owner":{"name":"user","role":"admin"}})";
+
+std::string MakeDictionaryContent() {
+  std::string content;
+  for (int i = 0; i < 16; ++i) content += kJsonSample;
+  return content;
+}
+
+}  // namespace
+
+TEST(Zstd, Dictionary) {
+  const compression::zstd::Dictionary dictionary{MakeDictionaryContent(), 3};
+  // Raw content dictionaries have no ID
+  EXPECT_EQ(dictionary.GetId(), 0);
+
+  const auto compressed = compression::zstd::Compress(kJsonSample, dictionary);
+  EXPECT_LT(compressed.size() * 3,
+            compression::zstd::Compress(kJsonSample, 3).size());
+
+  EXPECT_EQ(compression::zstd::Decompress(compressed, kJsonSample.size(),
+                                          dictionary),
+            kJsonSample);
+  EXPECT_THROW(compression::zstd::Decompress(
+                   compressed, kJsonSample.size() - 1, dictionary),
+               compression::TooBigError);
+  EXPECT_THROW(compression::zstd::Decompress(
+                   compressed.substr(0, compressed.size() - 1),
+                   kJsonSample.size(), dictionary),
+               compression::DecompressionError);
+
+  // The one-shot contexts do not keep the dictionary
+  const auto plain = compression::zstd::Compress(kJsonSample, 3);
+  EXPECT_EQ(compression::zstd::Decompress(plain, kJsonSample.size()),
+            kJsonSample);
+}
+
+TEST(Zstd, Stream) {
+  std::string data;
+  for (int i = 0; i < 1000; ++i) data += kJsonSample;
+
+  compression::zstd::Compressor compressor{3, true};
+  compression::zstd::Decompressor decompressor{data.size()};
+
+  std::string decompressed;
+  const std::string_view view = data;
+  for (std::size_t pos = 0; pos < view.size(); pos += 10'000) {
+    auto compressed = compressor.Compress(view.substr(pos, 10'000));
+    compressed += compressor.Flush();
+    // Everything passed so far is available after the flush
+    decompressed += decompressor.Decompress(compressed);
+    EXPECT_EQ(decompressed, view.substr(0, pos + 10'000));
+    EXPECT_FALSE(decompressor.IsFrameComplete());
+  }
+  decompressed += decompressor.Decompress(compressor.Finish());
+  EXPECT_TRUE(decompressor.IsFrameComplete());
+  EXPECT_EQ(decompressed, data);
+}
+
+TEST(Zstd, StreamTooBig) {
+  const std::string data(100'000, 'a');
+  compression::zstd::Compressor compressor{1};
+  auto compressed = compressor.Compress(data);
+  compressed += compressor.Finish();
+
+  compression::zstd::Decompressor decompressor{data.size() - 1};
+  EXPECT_THROW(decompressor.Decompress(compressed), compression::TooBigError);
+}
+
+TEST(Zstd, StreamDictionary) {
+  const compression::zstd::Dictionary dictionary{MakeDictionaryContent(), 3};
+
+  compression::zstd::Compressor compressor{dictionary};
+  auto compressed = compressor.Compress(kJsonSample);
+  compressed += compressor.Finish();
+  EXPECT_EQ(compression::zstd::Decompress(compressed, kJsonSample.size(),
+                                          dictionary),
+            kJsonSample);
+
+  compression::zstd::Decompressor decompressor{kJsonSample.size(), dictionary};
+  EXPECT_EQ(decompressor.Decompress(compressed), kJsonSample);
+  EXPECT_TRUE(decompressor.IsFrameComplete());
+}
+
 USERVER_NAMESPACE_END
@@ -1,11 +1,11 @@
 #include <userver/crypto/base64.hpp>
 
-#include <cryptopp/base64.h>
+#include <array>
+#include <cstdint>
+#include <string>
 
-#include <userver/crypto/exception.hpp>
-
-#ifdef CRYPTOPP_NO_GLOBAL_BYTE
-using CryptoPP::byte;
+#ifdef __SSSE3__
+#include <tmmintrin.h>
 #endif
 
 USERVER_NAMESPACE_BEGIN
@@ -14,53 +14,175 @@ namespace crypto::base64 {
 
 namespace {
 
-template <typename Base64Encoder>
-std::string Base64Encode(std::string_view data, Pad pad) {
-  std::string response;
-  try {
-    Base64Encoder encoder(new CryptoPP::StringSink(response));
-    CryptoPP::AlgorithmParameters params =
-        CryptoPP::MakeParameters(CryptoPP::Name::Pad(), Pad::kWith == pad)(
-            CryptoPP::Name::InsertLineBreaks(), false);
-    encoder.IsolatedInitialize(params);
-    encoder.PutMessageEnd(reinterpret_cast<const byte*>(data.data()),
-                          data.size());
-  } catch (const CryptoPP::Exception& exc) {
-    throw crypto::CryptoException(exc.what());
+constexpr std::string_view kAlphabet =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+constexpr std::string_view kUrlAlphabet =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+static_assert(kAlphabet.size() == 64 && kUrlAlphabet.size() == 64);
+
+constexpr char kPadChar = '=';
+constexpr std::uint8_t kInvalid = 0xff;
+
+using DecodeTable = std::array<std::uint8_t, 256>;
+
+constexpr DecodeTable MakeDecodeTable(std::string_view alphabet) {
+  DecodeTable table{};
+  for (auto& value : table) value = kInvalid;
+  for (std::size_t i = 0; i < alphabet.size(); ++i) {
+    table[static_cast<unsigned char>(alphabet[i])] =
+        static_cast<std::uint8_t>(i);
   }
-  return response;
+  return table;
 }
 
-template <typename Base64Decoder>
-std::string Base64Decode(std::string_view data) {
-  std::string response;
-  try {
-    Base64Decoder decoder(new CryptoPP::StringSink(response));
-    decoder.PutMessageEnd(reinterpret_cast<const byte*>(data.data()),
-                          data.size());
-  } catch (const CryptoPP::Exception& exc) {
-    throw crypto::CryptoException(exc.what());
+constexpr DecodeTable kDecodeTable = MakeDecodeTable(kAlphabet);
+constexpr DecodeTable kUrlDecodeTable = MakeDecodeTable(kUrlAlphabet);
+
+#ifdef __SSSE3__
+// Encodes 12 bytes out of the 16 loaded into 16 chars, see
+// http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html
+__m128i EncodeBlock(__m128i input, __m128i shift_lut) {
+  // Each 32-bit lane gets the 3 bytes of its 4 chars: b1, b0, b2, b1
+  input = _mm_shuffle_epi8(
+      input, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+
+  // Moves the 6-bit indices into the separate bytes of the lane
+  const auto t0 = _mm_and_si128(input, _mm_set1_epi32(0x0fc0fc00));
+  const auto t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+  const auto t2 = _mm_and_si128(input, _mm_set1_epi32(0x003f03f0));
+  const auto t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+  const auto indices = _mm_or_si128(t1, t3);
+
+  // Maps the index ranges to the offsets of the chars:
+  // 0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12
+  auto ranges = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+  const auto is_upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+  ranges = _mm_or_si128(ranges, _mm_and_si128(is_upper, _mm_set1_epi8(13)));
+  return _mm_add_epi8(_mm_shuffle_epi8(shift_lut, ranges), indices);
+}
+
+__m128i MakeShiftLut(std::string_view alphabet) {
+  return _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                       '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                       '0' - 52, static_cast<char>(alphabet[62] - 62),
+                       static_cast<char>(alphabet[63] - 63), 'A', 0, 0);
+}
+#endif
+
+std::string Encode(std::string_view data, Pad pad, std::string_view alphabet) {
+  std::string result;
+  result.resize((data.size() + 2) / 3 * 4);
+
+  const auto* first = reinterpret_cast<const unsigned char*>(data.data());
+  const auto* const last = first + data.size();
+  auto* dst = result.data();
+
+#ifdef __SSSE3__
+  const auto shift_lut = MakeShiftLut(alphabet);
+  // 16 bytes are loaded, while 12 of them are encoded
+  while (last - first >= 16) {
+    const auto input =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst),
+                     EncodeBlock(input, shift_lut));
+    first += 12;
+    dst += 16;
+  }
+#endif
+
+  while (last - first >= 3) {
+    const std::uint32_t value = (first[0] << 16) | (first[1] << 8) | first[2];
+    dst[0] = alphabet[value >> 18];
+    dst[1] = alphabet[(value >> 12) & 0x3f];
+    dst[2] = alphabet[(value >> 6) & 0x3f];
+    dst[3] = alphabet[value & 0x3f];
+    first += 3;
+    dst += 4;
   }
-  return response;
+
+  if (last - first == 1) {
+    const std::uint32_t value = first[0] << 16;
+    *dst++ = alphabet[value >> 18];
+    *dst++ = alphabet[(value >> 12) & 0x3f];
+    if (pad == Pad::kWith) {
+      *dst++ = kPadChar;
+      *dst++ = kPadChar;
+    }
+  } else if (last - first == 2) {
+    const std::uint32_t value = (first[0] << 16) | (first[1] << 8);
+    *dst++ = alphabet[value >> 18];
+    *dst++ = alphabet[(value >> 12) & 0x3f];
+    *dst++ = alphabet[(value >> 6) & 0x3f];
+    if (pad == Pad::kWith) *dst++ = kPadChar;
+  }
+
+  result.resize(dst - result.data());
+  return result;
+}
+
+// The chars out of the alphabet, including the padding, are skipped. The bits
+// that do not make a whole byte at the end are dropped.
+std::string Decode(std::string_view data, const DecodeTable& table) {
+  std::string result;
+  result.resize(data.size() / 4 * 3 + 3);
+
+  const auto* first = reinterpret_cast<const unsigned char*>(data.data());
+  const auto* const last = first + data.size();
+  auto* dst = result.data();
+
+  std::uint32_t bits = 0;
+  unsigned bits_count = 0;
+  while (first != last) {
+    if (bits_count == 0 && last - first >= 4) {
+      const std::uint32_t a = table[first[0]];
+      const std::uint32_t b = table[first[1]];
+      const std::uint32_t c = table[first[2]];
+      const std::uint32_t d = table[first[3]];
+      // Any invalid char has the high bits set
+      if (((a | b | c | d) & 0xc0) == 0) {
+        const auto value = (a << 18) | (b << 12) | (c << 6) | d;
+        dst[0] = static_cast<char>(value >> 16);
+        dst[1] = static_cast<char>(value >> 8);
+        dst[2] = static_cast<char>(value);
+        first += 4;
+        dst += 3;
+        continue;
+      }
+    }
+
+    const auto value = table[*first++];
+    if (value == kInvalid) continue;
+
+    bits = (bits << 6) | value;
+    bits_count += 6;
+    if (bits_count >= 8) {
+      bits_count -= 8;
+      *dst++ = static_cast<char>(bits >> bits_count);
+      bits &= (1u << bits_count) - 1;
+    }
+  }
+
+  result.resize(dst - result.data());
+  return result;
 }
 
 }  // namespace
 
 std::string Base64Encode(std::string_view data, Pad pad) {
-  return Base64Encode<CryptoPP::Base64Encoder>(data, pad);
+  return Encode(data, pad, kAlphabet);
 }
 
 std::string Base64Decode(std::string_view data) {
-  return Base64Decode<CryptoPP::Base64Decoder>(data);
+  return Decode(data, kDecodeTable);
 }
 
 #ifndef USERVER_NO_CRYPTOPP_BASE64_URL
 std::string Base64UrlEncode(std::string_view data, Pad pad) {
-  return Base64Encode<CryptoPP::Base64URLEncoder>(data, pad);
+  return Encode(data, pad, kUrlAlphabet);
 }
 
 std::string Base64UrlDecode(std::string_view data) {
-  return Base64Decode<CryptoPP::Base64URLDecoder>(data);
+  return Decode(data, kUrlDecodeTable);
 }
 #endif
 
@@ -0,0 +1,41 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <userver/crypto/base64.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string GenerateSource(std::size_t size) {
+  std::string source;
+  source.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    source.push_back(static_cast<char>(i * 37 + 11));
+  }
+  return source;
+}
+
+}  // namespace
+
+void base64_encode(benchmark::State& state) {
+  const auto source = GenerateSource(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(crypto::base64::Base64Encode(source));
+  }
+  state.SetBytesProcessed(state.iterations() * source.size());
+}
+BENCHMARK(base64_encode)->RangeMultiplier(4)->Range(16, 64 * 1024);
+
+void base64_decode(benchmark::State& state) {
+  const auto encoded =
+      crypto::base64::Base64Encode(GenerateSource(state.range(0)));
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(crypto::base64::Base64Decode(encoded));
+  }
+  state.SetBytesProcessed(state.iterations() * encoded.size());
+}
+BENCHMARK(base64_decode)->RangeMultiplier(4)->Range(16, 64 * 1024);
+
+USERVER_NAMESPACE_END
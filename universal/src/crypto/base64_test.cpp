@@ -17,6 +17,34 @@ TEST(Crypto, Base64) {
   EXPECT_EQ("U/8=", crypto::base64::Base64Encode("S\xff"));
 }
 
+TEST(Crypto, Base64RoundTrip) {
+  // Covers the blocks of the vectorized encoding and the tails
+  std::string data;
+  for (int size = 0; size < 100; ++size) {
+    const auto encoded = crypto::base64::Base64Encode(data);
+    EXPECT_EQ(encoded.size(), (data.size() + 2) / 3 * 4);
+    EXPECT_EQ(data, crypto::base64::Base64Decode(encoded));
+    EXPECT_EQ(data, crypto::base64::Base64Decode(crypto::base64::Base64Encode(
+                        data, crypto::base64::Pad::kWithout)));
+    data += static_cast<char>(size * 37 + 11);
+  }
+
+  EXPECT_EQ("AAECAwQFBgcICQoLDA0ODxAREhMUFRYXGBkaGxwdHh8gISIjJCUmJygp",
+            crypto::base64::Base64Encode(std::string_view{
+                "\x00\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d"
+                "\x0e\x0f\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1a\x1b"
+                "\x1c\x1d\x1e\x1f\x20\x21\x22\x23\x24\x25\x26\x27\x28\x29",
+                42}));
+
+  std::string high_chars;
+  std::string high_chars_encoded;
+  for (int i = 0; i < 6; ++i) {
+    high_chars += "\xfb\xef\xbe\xff\xff\xff";
+    high_chars_encoded += "++++////";
+  }
+  EXPECT_EQ(high_chars_encoded, crypto::base64::Base64Encode(high_chars));
+}
+
 #ifndef USERVER_NO_CRYPTOPP_BASE64_URL
 TEST(Crypto, Base64Url) {
   EXPECT_EQ("U_8=", crypto::base64::Base64UrlEncode("S\xff"));
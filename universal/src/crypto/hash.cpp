@@ -1,6 +1,7 @@
 #include <userver/crypto/hash.hpp>
 
 #include <array>
+#include <initializer_list>
 
 #include <cryptopp/base64.h>
 #ifndef USERVER_NO_CRYPTOPP_BLAKE2
@@ -55,39 +56,37 @@ std::string EncodeArray(const byte* ptr, size_t length,
   return response;
 }
 
-std::string EncodeString(std::string_view data,
-                         crypto::hash::OutputEncoding encoding) {
-  return EncodeArray(reinterpret_cast<const byte*>(data.data()), data.size(),
-                     encoding);
-}
-
 template <typename HashAlgorithm>
-std::string CalculateHmac(std::string_view key, std::string_view data,
+std::string CalculateHmac(std::string_view key,
+                          std::initializer_list<std::string_view> data,
                           crypto::hash::OutputEncoding encoding) {
-  std::string mac;
-
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init): performance
+  std::array<byte, HashAlgorithm::DIGESTSIZE> mac;
   try {
     CryptoPP::HMAC<HashAlgorithm> hmac(
         reinterpret_cast<const byte*>(key.data()), key.size());
-    CryptoPP::StringSource ss_key(
-        reinterpret_cast<const byte*>(data.data()), data.size(), true,
-        new CryptoPP::HashFilter(hmac, new CryptoPP::StringSink(mac)));
+    for (const auto part : data) {
+      hmac.Update(reinterpret_cast<const byte*>(part.data()), part.size());
+    }
+    hmac.Final(mac.data());
   } catch (const CryptoPP::Exception& exc) {
     throw crypto::CryptoException(exc.what());
   }
 
-  return EncodeString(mac, encoding);
+  return EncodeArray(mac.data(), mac.size(), encoding);
 }
 
 template <typename HashAlgorithm>
-std::string CalculateHash(std::string_view data,
+std::string CalculateHash(std::initializer_list<std::string_view> data,
                           crypto::hash::OutputEncoding encoding) {
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init): performance
   std::array<byte, HashAlgorithm::DIGESTSIZE> digest;
   try {
     HashAlgorithm hash;
-    hash.CalculateDigest(
-        digest.data(), reinterpret_cast<const byte*>(data.data()), data.size());
+    for (const auto part : data) {
+      hash.Update(reinterpret_cast<const byte*>(part.data()), part.size());
+    }
+    hash.Final(digest.data());
   } catch (const CryptoPP::Exception& exc) {
     throw crypto::CryptoException(exc.what());
   }
@@ -101,54 +100,103 @@ namespace crypto::hash {
 
 #ifndef USERVER_NO_CRYPTOPP_BLAKE2
 std::string Blake2b128(std::string_view data, OutputEncoding encoding) {
-  return CalculateHash<AlgoBlake2b128>(data, encoding);
+  return CalculateHash<AlgoBlake2b128>({data}, encoding);
 }
 #endif
 
 std::string Sha1(std::string_view data, OutputEncoding encoding) {
+  return CalculateHash<CryptoPP::SHA1>({data}, encoding);
+}
+
+std::string Sha1Parts(std::initializer_list<std::string_view> data,
+                      OutputEncoding encoding) {
   return CalculateHash<CryptoPP::SHA1>(data, encoding);
 }
 
 std::string Sha224(std::string_view data, OutputEncoding encoding) {
+  return CalculateHash<CryptoPP::SHA224>({data}, encoding);
+}
+
+std::string Sha224Parts(std::initializer_list<std::string_view> data,
+                        OutputEncoding encoding) {
   return CalculateHash<CryptoPP::SHA224>(data, encoding);
 }
 
 std::string Sha256(std::string_view data, OutputEncoding encoding) {
+  return CalculateHash<CryptoPP::SHA256>({data}, encoding);
+}
+
+std::string Sha256Parts(std::initializer_list<std::string_view> data,
+                        OutputEncoding encoding) {
   return CalculateHash<CryptoPP::SHA256>(data, encoding);
 }
 
 std::string Sha384(std::string_view data, OutputEncoding encoding) {
+  return CalculateHash<CryptoPP::SHA384>({data}, encoding);
+}
+
+std::string Sha384Parts(std::initializer_list<std::string_view> data,
+                        OutputEncoding encoding) {
   return CalculateHash<CryptoPP::SHA384>(data, encoding);
 }
 
 std::string Sha512(std::string_view data, OutputEncoding encoding) {
+  return CalculateHash<CryptoPP::SHA512>({data}, encoding);
+}
+
+std::string Sha512Parts(std::initializer_list<std::string_view> data,
+                        OutputEncoding encoding) {
   return CalculateHash<CryptoPP::SHA512>(data, encoding);
 }
 
 std::string HmacSha512(std::string_view key, std::string_view message,
                        OutputEncoding encoding) {
+  return CalculateHmac<CryptoPP::SHA512>(key, {message}, encoding);
+}
+
+std::string HmacSha512Parts(std::string_view key,
+                            std::initializer_list<std::string_view> message,
+                            OutputEncoding encoding) {
   return CalculateHmac<CryptoPP::SHA512>(key, message, encoding);
 }
 
 std::string HmacSha384(std::string_view key, std::string_view message,
                        OutputEncoding encoding) {
+  return CalculateHmac<CryptoPP::SHA384>(key, {message}, encoding);
+}
+
+std::string HmacSha384Parts(std::string_view key,
+                            std::initializer_list<std::string_view> message,
+                            OutputEncoding encoding) {
   return CalculateHmac<CryptoPP::SHA384>(key, message, encoding);
 }
 
 std::string HmacSha256(std::string_view key, std::string_view message,
                        OutputEncoding encoding) {
+  return CalculateHmac<CryptoPP::SHA256>(key, {message}, encoding);
+}
+
+std::string HmacSha256Parts(std::string_view key,
+                            std::initializer_list<std::string_view> message,
+                            OutputEncoding encoding) {
   return CalculateHmac<CryptoPP::SHA256>(key, message, encoding);
 }
 
 std::string HmacSha1(std::string_view key, std::string_view message,
                      OutputEncoding encoding) {
+  return CalculateHmac<CryptoPP::SHA1>(key, {message}, encoding);
+}
+
+std::string HmacSha1Parts(std::string_view key,
+                          std::initializer_list<std::string_view> message,
+                          OutputEncoding encoding) {
   return CalculateHmac<CryptoPP::SHA1>(key, message, encoding);
 }
 
 namespace weak {
 
 std::string Md5(std::string_view data, OutputEncoding encoding) {
-  return CalculateHash<CryptoPP::Weak::MD5>(data, encoding);
+  return CalculateHash<CryptoPP::Weak::MD5>({data}, encoding);
 }
 
 }  // namespace weak
@@ -94,6 +94,27 @@ TEST(Crypto, Hmac) {
                                crypto::hash::OutputEncoding::kHex));
 }
 
+TEST(Crypto, HashParts) {
+  EXPECT_EQ(crypto::hash::Sha1Parts({"te", "", "st"}),
+            crypto::hash::Sha1("test"));
+  EXPECT_EQ(crypto::hash::Sha224Parts({"te", "st"}),
+            crypto::hash::Sha224("test"));
+  EXPECT_EQ(crypto::hash::Sha256Parts({"t", "es", "t\n"}),
+            crypto::hash::Sha256("test\n"));
+  EXPECT_EQ(crypto::hash::Sha384Parts({"test"}), crypto::hash::Sha384("test"));
+  EXPECT_EQ(crypto::hash::Sha512Parts({"te", "st"}),
+            crypto::hash::Sha512("test"));
+
+  EXPECT_EQ(crypto::hash::HmacSha1Parts("test", {"te", "st"}),
+            crypto::hash::HmacSha1("test", "test"));
+  EXPECT_EQ(crypto::hash::HmacSha256Parts("test", {"", "test", ""}),
+            crypto::hash::HmacSha256("test", "test"));
+  EXPECT_EQ(crypto::hash::HmacSha384Parts("secret", {}),
+            crypto::hash::HmacSha384("secret", ""));
+  EXPECT_EQ(crypto::hash::HmacSha512Parts("test", {"t", "e", "s", "t"}),
+            crypto::hash::HmacSha512("test", "test"));
+}
+
 #ifndef USERVER_NO_CRYPTOPP_BLAKE2
 TEST(Crypto, Blake2b128) {
   EXPECT_EQ("e9a804b2e527fd3601d2ffc0bb023cd6",
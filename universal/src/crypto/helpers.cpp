@@ -44,6 +44,14 @@ int CurveNidByDigestSize(DigestSize bits) {
   UINVARIANT(false, "Unexpected DigestSize");
 }
 
+void FreeMdCtx(EVP_MD_CTX* ctx) {
+#if OPENSSL_VERSION_NUMBER >= 0x010100000L
+  EVP_MD_CTX_free(ctx);
+#else
+  EVP_MD_CTX_destroy(ctx);
+#endif
+}
+
 }  // namespace
 std::string FormatSslError(std::string message) {
   bool first = true;
@@ -80,29 +88,41 @@ EvpMdCtx::EvpMdCtx()
   }
 }
 
-EvpMdCtx::~EvpMdCtx() {
-  if (ctx_) {
-#if OPENSSL_VERSION_NUMBER >= 0x010100000L
-    EVP_MD_CTX_free(ctx_);
-#else
-    EVP_MD_CTX_destroy(ctx_);
-#endif
+EvpMdCtx::EvpMdCtx(const EVP_MD_CTX& initialized) : EvpMdCtx() {
+  if (1 != EVP_MD_CTX_copy_ex(ctx_, &initialized)) {
+    throw CryptoException(FormatSslError("Failed to copy EVP_MD_CTX"));
   }
 }
 
+EvpMdCtx::~EvpMdCtx() {
+  if (ctx_) FreeMdCtx(ctx_);
+}
+
 EvpMdCtx::EvpMdCtx(EvpMdCtx&& other) noexcept
     : ctx_(std::exchange(other.ctx_, nullptr)) {}
 
-decltype(&crypto::hash::HmacSha256) GetHmacFuncByEnum(DigestSize bits) {
+std::shared_ptr<EVP_MD_CTX> EvpMdCtx::Share() && {
+  return {std::exchange(ctx_, nullptr), &FreeMdCtx};
+}
+
+EvpPkeyCtxPtr DupPkeyCtx(EVP_PKEY_CTX& initialized) {
+  EvpPkeyCtxPtr ctx{EVP_PKEY_CTX_dup(&initialized), EVP_PKEY_CTX_free};
+  if (!ctx) {
+    throw CryptoException(FormatSslError("Failed to copy EVP_PKEY_CTX"));
+  }
+  return ctx;
+}
+
+HmacFunc GetHmacFuncByEnum(DigestSize bits) {
   switch (bits) {
     case DigestSize::k160:
-      return crypto::hash::HmacSha1;
+      return crypto::hash::HmacSha1Parts;
     case DigestSize::k256:
-      return crypto::hash::HmacSha256;
+      return crypto::hash::HmacSha256Parts;
     case DigestSize::k384:
-      return crypto::hash::HmacSha384;
+      return crypto::hash::HmacSha384Parts;
     case DigestSize::k512:
-      return crypto::hash::HmacSha512;
+      return crypto::hash::HmacSha512Parts;
   }
 
   UINVARIANT(false, "Unexpected DigestSize");
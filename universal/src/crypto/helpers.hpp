@@ -1,5 +1,6 @@
 #pragma once
 
+#include <initializer_list>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -19,6 +20,9 @@ std::string FormatSslError(std::string message);
 class EvpMdCtx {
  public:
   EvpMdCtx();
+  /// Copies the initialized context, including its key context. It is much
+  /// cheaper than initializing a new one with the key.
+  explicit EvpMdCtx(const EVP_MD_CTX& initialized);
   ~EvpMdCtx();
 
   EvpMdCtx(const EvpMdCtx&) = delete;
@@ -26,10 +30,20 @@ class EvpMdCtx {
 
   EVP_MD_CTX* Get() { return ctx_; }
 
+  /// Transfers the ownership of the context, e.g. to keep it in an object
+  /// as a prototype for the operations
+  std::shared_ptr<EVP_MD_CTX> Share() &&;
+
  private:
   EVP_MD_CTX* ctx_;
 };
 
+using EvpPkeyCtxPtr =
+    std::unique_ptr<EVP_PKEY_CTX, decltype(&EVP_PKEY_CTX_free)>;
+
+/// Copies the initialized key context, an exception is thrown on failure
+EvpPkeyCtxPtr DupPkeyCtx(EVP_PKEY_CTX& initialized);
+
 constexpr size_t GetDigestLength(DigestSize digest_size) {
   size_t bits = 0;
   switch (digest_size) {
@@ -49,7 +63,11 @@ constexpr size_t GetDigestLength(DigestSize digest_size) {
   return (bits + CHAR_BIT - 1) / CHAR_BIT;
 }
 
-decltype(&crypto::hash::HmacSha256) GetHmacFuncByEnum(DigestSize bits);
+using HmacFunc = std::string (*)(std::string_view,
+                                 std::initializer_list<std::string_view>,
+                                 hash::OutputEncoding);
+
+HmacFunc GetHmacFuncByEnum(DigestSize bits);
 const EVP_MD* GetShaMdByEnum(DigestSize bits);
 
 std::string InitListToString(std::initializer_list<std::string_view> data);
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
 #include <string_view>
+#include <thread>
+#include <vector>
 
 #include <userver/crypto/base64.hpp>
 #include <userver/crypto/hash.hpp>
@@ -350,6 +352,33 @@ TEST(Crypto, SignatureEs256) {
                    crypto::hash::Sha256("test"), crypto::hash::Sha512("test"));
 }
 
+TEST(Crypto, SignatureConcurrentUse) {
+  // The key contexts are shared between the copies and the threads
+  const crypto::SignerEs256 signer{ecdsa256v1_priv_key};
+  const crypto::VerifierEs256 verifier{ecdsa256v1_pub_key};
+  const crypto::SignerPs256 pss_signer{rsa2048_priv_key};
+  const crypto::VerifierPs256 pss_verifier{rsa2048_pub_key};
+  const auto digest = utils::encoding::FromHex(crypto::hash::Sha256("test"));
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&, signer_copy = signer] {
+      for (int j = 0; j < 20; ++j) {
+        const auto signature = signer_copy.Sign({"te", "st"});
+        EXPECT_NO_THROW(verifier.Verify({"test"}, signature));
+        EXPECT_NO_THROW(verifier.VerifyDigest(digest, signature));
+        EXPECT_THROW(verifier.Verify({"tests"}, signature),
+                     crypto::VerificationError);
+        EXPECT_NO_THROW(verifier.Verify({"test"}, signer.SignDigest(digest)));
+
+        EXPECT_NO_THROW(
+            pss_verifier.Verify({"test"}, pss_signer.Sign({"test"})));
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+}
+
 TEST(Crypto, SignatureEs512) {
   TestDsaSignature(crypto::SignerEs512{ecdsa521p1_priv_key},
                    crypto::VerifierEs512{ecdsa521p1_pub_key},
@@ -129,18 +129,7 @@ template <DigestSize bits>
 std::string HmacShaSigner<bits>::Sign(
     std::initializer_list<std::string_view> data) const {
   const auto hmac = GetHmacFuncByEnum(bits);
-
-  if (data.size() <= 1) {
-    std::string_view single_value{};
-    if (data.size()) {
-      single_value = *data.begin();
-    }
-
-    return hmac(secret_, single_value, crypto::hash::OutputEncoding::kBinary);
-  }
-
-  return hmac(secret_, InitListToString(data),
-              crypto::hash::OutputEncoding::kBinary);
+  return hmac(secret_, data, crypto::hash::OutputEncoding::kBinary);
 }
 
 template class HmacShaSigner<DigestSize::k160>;
@@ -171,22 +160,41 @@ DsaSigner<type, bits>::DsaSigner(const std::string& key,
       throw SignError("Non-RSA key supplied for " + Name() + " signer");
     }
   }
-}
 
-template <DsaType type, DigestSize bits>
-std::string DsaSigner<type, bits>::Sign(
-    std::initializer_list<std::string_view> data) const {
   EvpMdCtx ctx;
   EVP_PKEY_CTX* pkey_ctx = nullptr;  // non-owning
   if (1 != EVP_DigestSignInit(ctx.Get(), &pkey_ctx, GetShaMdByEnum(bits),
                               nullptr, pkey_.GetNative())) {
     throw SignError(FormatSslError("Failed to sign: EVP_DigestSignInit"));
   }
-
   if constexpr (type == DsaType::kRsaPss) {
     SetupJwaRsaPssPadding(pkey_ctx, bits);
   }
+  digest_ctx_ = std::move(ctx).Share();
+
+  if constexpr (type != DsaType::kRsaPss) {
+    pkey_ctx_.reset(EVP_PKEY_CTX_new(pkey_.GetNative(), nullptr),
+                    EVP_PKEY_CTX_free);
+    if (!pkey_ctx_) {
+      throw SignError(
+          FormatSslError("Failed to sign digest: EVP_PKEY_CTX_new"));
+    }
+    if (1 != EVP_PKEY_sign_init(pkey_ctx_.get())) {
+      throw SignError(
+          FormatSslError("Failed to sign digest: EVP_PKEY_sign_init"));
+    }
+    if (EVP_PKEY_CTX_set_signature_md(pkey_ctx_.get(), GetShaMdByEnum(bits)) <=
+        0) {
+      throw SignError(FormatSslError(
+          "Failed to sign digest: EVP_PKEY_CTX_set_signature_md"));
+    }
+  }
+}
 
+template <DsaType type, DigestSize bits>
+std::string DsaSigner<type, bits>::Sign(
+    std::initializer_list<std::string_view> data) const {
+  EvpMdCtx ctx{*digest_ctx_};
   for (const auto& part : data) {
     if (1 != EVP_DigestSignUpdate(ctx.Get(), part.data(), part.size())) {
       throw SignError(FormatSslError("Failed to sign: EVP_DigestSignUpdate"));
@@ -224,20 +232,8 @@ std::string DsaSigner<type, bits>::SignDigest(std::string_view digest) const {
     throw SignError("Invalid digest size for " + Name() + " signer");
   }
 
-  const std::unique_ptr<EVP_PKEY_CTX, decltype(&EVP_PKEY_CTX_free)> pkey_ctx(
-      EVP_PKEY_CTX_new(pkey_.GetNative(), nullptr), EVP_PKEY_CTX_free);
-  if (!pkey_ctx) {
-    throw SignError(FormatSslError("Failed to sign digest: EVP_PKEY_CTX_new"));
-  }
-  if (1 != EVP_PKEY_sign_init(pkey_ctx.get())) {
-    throw SignError(
-        FormatSslError("Failed to sign digest: EVP_PKEY_sign_init"));
-  }
-  if (EVP_PKEY_CTX_set_signature_md(pkey_ctx.get(), GetShaMdByEnum(bits)) <=
-      0) {
-    throw SignError(
-        FormatSslError("Failed to sign digest: EVP_PKEY_CTX_set_signature_md"));
-  }
+  UASSERT(pkey_ctx_);
+  const auto pkey_ctx = DupPkeyCtx(*pkey_ctx_);
 
   size_t siglen = 0;
   if (1 != EVP_PKEY_sign(pkey_ctx.get(), nullptr, &siglen,
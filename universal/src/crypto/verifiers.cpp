@@ -123,19 +123,8 @@ template <DigestSize bits>
 void HmacShaVerifier<bits>::Verify(std::initializer_list<std::string_view> data,
                                    std::string_view raw_signature) const {
   const auto hmac = GetHmacFuncByEnum(bits);
-  std::string signature;
-  if (data.size() <= 1) {
-    std::string_view single_value{};
-    if (data.size() == 1) {
-      single_value = *data.begin();
-    }
-
-    signature =
-        hmac(secret_, single_value, crypto::hash::OutputEncoding::kBinary);
-  } else {
-    signature = hmac(secret_, InitListToString(data),
-                     crypto::hash::OutputEncoding::kBinary);
-  }
+  const auto signature =
+      hmac(secret_, data, crypto::hash::OutputEncoding::kBinary);
 
   if (raw_signature != signature) {
     throw VerificationError("Invalid signature");
@@ -171,16 +160,7 @@ DsaVerifier<type, bits>::DsaVerifier(PublicKey pubkey)
                               " verifier");
     }
   }
-}
-
-template <DsaType type, DigestSize bits>
-DsaVerifier<type, bits>::DsaVerifier(std::string_view key)
-    : DsaVerifier{PublicKey::LoadFromString(key)} {}
 
-template <DsaType type, DigestSize bits>
-void DsaVerifier<type, bits>::Verify(
-    std::initializer_list<std::string_view> data,
-    std::string_view raw_signature) const {
   EvpMdCtx ctx;
   EVP_PKEY_CTX* pkey_ctx = nullptr;
   if (1 != EVP_DigestVerifyInit(ctx.Get(), &pkey_ctx, GetShaMdByEnum(bits),
@@ -188,11 +168,39 @@ void DsaVerifier<type, bits>::Verify(
     throw VerificationError(
         FormatSslError("Failed to verify: EVP_DigestVerifyInit"));
   }
-
   if constexpr (type == DsaType::kRsaPss) {
     SetupJwaRsaPssPadding(pkey_ctx, bits);
   }
+  digest_ctx_ = std::move(ctx).Share();
+
+  if constexpr (type != DsaType::kRsaPss) {
+    pkey_ctx_.reset(EVP_PKEY_CTX_new(pkey_.GetNative(), nullptr),
+                    EVP_PKEY_CTX_free);
+    if (!pkey_ctx_) {
+      throw VerificationError(
+          FormatSslError("Failed to verify digest: EVP_PKEY_CTX_new"));
+    }
+    if (1 != EVP_PKEY_verify_init(pkey_ctx_.get())) {
+      throw VerificationError(
+          FormatSslError("Failed to verify digest: EVP_PKEY_verify_init"));
+    }
+    if (EVP_PKEY_CTX_set_signature_md(pkey_ctx_.get(), GetShaMdByEnum(bits)) <=
+        0) {
+      throw VerificationError(FormatSslError(
+          "Failed to verify digest: EVP_PKEY_CTX_set_signature_md"));
+    }
+  }
+}
 
+template <DsaType type, DigestSize bits>
+DsaVerifier<type, bits>::DsaVerifier(std::string_view key)
+    : DsaVerifier{PublicKey::LoadFromString(key)} {}
+
+template <DsaType type, DigestSize bits>
+void DsaVerifier<type, bits>::Verify(
+    std::initializer_list<std::string_view> data,
+    std::string_view raw_signature) const {
+  EvpMdCtx ctx{*digest_ctx_};
   for (const auto& part : data) {
     if (1 != EVP_DigestVerifyUpdate(ctx.Get(), part.data(), part.size())) {
       throw VerificationError(
@@ -229,21 +237,8 @@ void DsaVerifier<type, bits>::VerifyDigest(
     throw VerificationError("Invalid digest size for " + Name() + " verifier");
   }
 
-  std::unique_ptr<EVP_PKEY_CTX, decltype(&EVP_PKEY_CTX_free)> pkey_ctx(
-      EVP_PKEY_CTX_new(pkey_.GetNative(), nullptr), EVP_PKEY_CTX_free);
-  if (!pkey_ctx) {
-    throw VerificationError(
-        FormatSslError("Failed to verify digest: EVP_PKEY_CTX_new"));
-  }
-  if (1 != EVP_PKEY_verify_init(pkey_ctx.get())) {
-    throw VerificationError(
-        FormatSslError("Failed to verify digest: EVP_PKEY_verify_init"));
-  }
-  if (EVP_PKEY_CTX_set_signature_md(pkey_ctx.get(), GetShaMdByEnum(bits)) <=
-      0) {
-    throw VerificationError(
-        FormatSslError("Failed to sign digest: EVP_PKEY_CTX_set_signature_md"));
-  }
+  UASSERT(pkey_ctx_);
+  const auto pkey_ctx = DupPkeyCtx(*pkey_ctx_);
 
   int verification_result = -1;
   if constexpr (type == DsaType::kEc) {
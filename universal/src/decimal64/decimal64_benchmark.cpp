@@ -0,0 +1,43 @@
+#include <userver/decimal64/decimal64.hpp>
+
+#include <string_view>
+
+#include <benchmark/benchmark.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Dec4 = decimal64::Decimal<4>;
+
+constexpr std::string_view kPlain = "-12345.6789";
+
+}  // namespace
+
+void Decimal64FromString(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(Dec4{kPlain});
+  }
+}
+BENCHMARK(Decimal64FromString);
+
+// The general parser, that is used for the inputs like "+1" or " 1"
+void Decimal64FromStringGeneral(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(
+        decimal64::impl::Parse<4, decimal64::DefRoundPolicy>(
+            decimal64::impl::StringCharSequence(kPlain),
+            decimal64::impl::ParseOptions::kNone));
+  }
+}
+BENCHMARK(Decimal64FromStringGeneral);
+
+void Decimal64ToString(benchmark::State& state) {
+  const Dec4 value{kPlain};
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(ToString(value));
+  }
+}
+BENCHMARK(Decimal64ToString);
+
+USERVER_NAMESPACE_END
@@ -259,4 +259,26 @@ TEST(Decimal64, RoundPolicies) {
   EXPECT_EQ(Down::FromStringPermissive("-0.000099999999999999"), Down{0});
 }
 
+TEST(Decimal64, PlainFastPath) {
+  for (const std::string_view input :
+       {"0", "-0", "10", "007", "-12.5", "12345678987654.3210", "0.0001",
+        "999999999999999999", "1234567898765432.1012", "123.45678", "+1",
+        "1.", ".1", "-.1", " 1", "1 ", "1e5", "--1", "-", "", "1.2.3"}) {
+    const auto general = decimal64::impl::Parse<4, decimal64::DefRoundPolicy>(
+        decimal64::impl::StringCharSequence(input),
+        decimal64::impl::ParseOptions::kNone);
+    const auto plain =
+        decimal64::impl::ParsePlain<4, decimal64::DefRoundPolicy>(input);
+    if (plain) {
+      ASSERT_FALSE(general.error) << input;
+      EXPECT_EQ(*plain, general.decimal) << input;
+    }
+  }
+
+  EXPECT_TRUE((decimal64::impl::ParsePlain<4, decimal64::DefRoundPolicy>(
+      "-12345678987654.3210")));
+  EXPECT_FALSE((decimal64::impl::ParsePlain<4, decimal64::DefRoundPolicy>(
+      "+12345678987654.3210")));
+}
+
 USERVER_NAMESPACE_END
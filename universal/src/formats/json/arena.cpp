@@ -0,0 +1,24 @@
+#include <userver/formats/json/arena.hpp>
+
+#include <formats/json/impl/allocator.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+Arena::Arena(std::size_t block_size)
+    : storage_(std::make_shared<impl::ArenaStorage>(block_size)) {}
+
+Arena::Arena(Arena&&) noexcept = default;
+
+Arena& Arena::operator=(Arena&&) noexcept = default;
+
+Arena::~Arena() = default;
+
+std::size_t Arena::GetAllocatedBytes() const noexcept {
+  return storage_ ? storage_->GetAllocatedBytes() : 0;
+}
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
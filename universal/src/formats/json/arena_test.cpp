@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include <userver/formats/json/arena.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kDoc = R"({
+  "string": "a string that does not fit into the value itself",
+  "array": [1, 2.5, "another long string of the array", {"key": null}],
+  "object": {"nested": {"deeper": [true, false]}}
+})";
+
+}  // namespace
+
+TEST(JsonArena, ExampleUsage) {
+  /// [Sample formats::json::Arena usage]
+  // #include <userver/formats/json.hpp>
+  formats::json::Arena arena;
+
+  const auto request =
+      formats::json::FromStringInArena(R"({"id": 42})", arena);
+
+  formats::json::ValueBuilder builder{arena, formats::json::Type::kObject};
+  builder["id"] = request["id"];
+  builder["items"].PushBack("a long string allocated from the arena");
+  const auto response = builder.ExtractValue();
+  /// [Sample formats::json::Arena usage]
+
+  EXPECT_EQ(response["id"].As<int>(), 42);
+  EXPECT_EQ(response["items"][0].As<std::string>(),
+            "a long string allocated from the arena");
+  EXPECT_GT(arena.GetAllocatedBytes(), 0);
+}
+
+TEST(JsonArena, Parse) {
+  formats::json::Arena arena;
+  const auto json = formats::json::FromStringInArena(kDoc, arena);
+
+  EXPECT_EQ(json, formats::json::FromString(kDoc));
+  EXPECT_EQ(json["array"][2].As<std::string>(),
+            "another long string of the array");
+  EXPECT_EQ(arena.GetAllocatedBytes(), formats::json::Arena::kDefaultBlockSize);
+}
+
+TEST(JsonArena, ParseErrors) {
+  formats::json::Arena arena;
+  EXPECT_THROW(formats::json::FromStringInArena("", arena),
+               formats::json::ParseException);
+  EXPECT_THROW(formats::json::FromStringInArena(R"({"a": [1, 2})", arena),
+               formats::json::ParseException);
+  EXPECT_THROW(formats::json::FromStringInArena(R"({"a": 1, "a": 2})", arena),
+               formats::json::ParseException);
+}
+
+TEST(JsonArena, Modify) {
+  formats::json::Arena arena{16};
+  formats::json::ValueBuilder builder{arena};
+
+  for (int i = 0; i < 1000; ++i) {
+    builder["array"].PushBack("long string number " + std::to_string(i));
+  }
+  builder["array"].Resize(10);
+  builder["object"]["key"] = "a long string that is going to be replaced";
+  builder["object"]["key"] = 1;
+  builder["object"]["other"] = builder["array"];
+  builder.Remove("array");
+
+  const auto json = builder.ExtractValue();
+  EXPECT_FALSE(json.HasMember("array"));
+  EXPECT_EQ(json["object"]["key"].As<int>(), 1);
+  ASSERT_EQ(json["object"]["other"].GetSize(), 10);
+  EXPECT_EQ(json["object"]["other"][9].As<std::string>(),
+            "long string number 9");
+}
+
+TEST(JsonArena, OutlivesArena) {
+  formats::json::Value json;
+  {
+    formats::json::Arena arena;
+    json = formats::json::FromStringInArena(kDoc, arena);
+  }
+  EXPECT_EQ(json, formats::json::FromString(kDoc));
+
+  formats::json::ValueBuilder builder{json};
+  builder["string"] = "the nodes of the builder are in the arena of json";
+  const auto modified = builder.ExtractValue();
+  EXPECT_EQ(modified["array"], json["array"]);
+  EXPECT_NE(modified["string"], json["string"]);
+}
+
+TEST(JsonArena, MixedDocuments) {
+  formats::json::Arena arena;
+  formats::json::Arena other_arena;
+  formats::json::ValueBuilder builder{arena, formats::json::Type::kObject};
+
+  // Nodes of other documents are copied into the arena
+  formats::json::ValueBuilder heap_builder{formats::json::FromString(kDoc)};
+  builder["from_heap"] = std::move(heap_builder);
+  builder["from_other_arena"] =
+      formats::json::FromStringInArena(kDoc, other_arena);
+  builder["array"].PushBack(
+      formats::json::ValueBuilder{other_arena, formats::json::Type::kArray});
+
+  formats::json::ValueBuilder result_in_heap;
+  result_in_heap["from_arena"] = builder;
+  result_in_heap["moved_from_arena"] = std::move(builder);
+  const auto json = result_in_heap.ExtractValue();
+
+  EXPECT_EQ(json["from_arena"]["from_heap"], formats::json::FromString(kDoc));
+  EXPECT_EQ(json["moved_from_arena"]["from_other_arena"],
+            formats::json::FromString(kDoc));
+  EXPECT_TRUE(json["moved_from_arena"]["array"][0].IsArray());
+}
+
+USERVER_NAMESPACE_END
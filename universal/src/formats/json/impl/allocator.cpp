@@ -0,0 +1,137 @@
+#include <formats/json/impl/allocator.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <utility>
+
+#include <userver/compiler/thread_local.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+namespace {
+
+// rapidjson aligns its MemoryPoolAllocator allocations the same way
+constexpr std::size_t kAlignment = 8;
+constexpr std::size_t kMaxBlockSize = 1 << 20;
+
+constexpr std::size_t AlignUp(std::size_t size) noexcept {
+  return (size + kAlignment - 1) & ~(kAlignment - 1);
+}
+
+compiler::ThreadLocal local_arena = [] {
+  return static_cast<ArenaStorage*>(nullptr);
+};
+
+ArenaStorage* GetCurrentArena() noexcept {
+  auto arena = local_arena.Use();
+  return *arena;
+}
+
+}  // namespace
+
+ArenaStorage::ArenaStorage(std::size_t block_size)
+    : next_block_size_(AlignUp(std::max(block_size, kAlignment))) {}
+
+ArenaStorage::~ArenaStorage() = default;
+
+void* ArenaStorage::Allocate(std::size_t size) {
+  size = AlignUp(size);
+  if (static_cast<std::size_t>(end_ - current_) < size) AddBlock(size);
+
+  last_allocation_ = current_;
+  current_ += size;
+  return last_allocation_;
+}
+
+void* ArenaStorage::Reallocate(void* ptr, std::size_t old_size,
+                               std::size_t new_size) {
+  if (!ptr) return Allocate(new_size);
+
+  if (ptr == last_allocation_ &&
+      static_cast<std::size_t>(end_ - last_allocation_) >= AlignUp(new_size)) {
+    current_ = last_allocation_ + AlignUp(new_size);
+    return ptr;
+  }
+  if (new_size <= old_size) return ptr;
+
+  auto* result = Allocate(new_size);
+  std::memcpy(result, ptr, old_size);
+  return result;
+}
+
+bool ArenaStorage::Contains(const void* ptr) const noexcept {
+  const auto* byte = static_cast<const char*>(ptr);
+  const std::less<const char*> less;
+  // The latest blocks are the biggest ones
+  return std::any_of(blocks_.rbegin(), blocks_.rend(), [&](const Block& block) {
+    return !less(byte, block.data.get()) &&
+           less(byte, block.data.get() + block.size);
+  });
+}
+
+std::size_t ArenaStorage::GetAllocatedBytes() const noexcept {
+  std::size_t result = 0;
+  for (const auto& block : blocks_) result += block.size;
+  return result;
+}
+
+void ArenaStorage::AddBlock(std::size_t min_size) {
+  const auto size = std::max(next_block_size_, min_size);
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+  blocks_.push_back({std::make_unique<char[]>(size), size});
+  next_block_size_ = std::min(next_block_size_ * 2, kMaxBlockSize);
+
+  current_ = blocks_.back().data.get();
+  end_ = current_ + size;
+  last_allocation_ = nullptr;
+}
+
+void* Allocator::Malloc(std::size_t size) {
+  // behavior of malloc(0) is implementation defined
+  if (!size) return nullptr;
+
+  auto* arena = GetCurrentArena();
+  if (arena) return arena->Allocate(size);
+  return std::malloc(size);
+}
+
+void* Allocator::Realloc(void* original_ptr, std::size_t original_size,
+                         std::size_t new_size) {
+  if (!new_size) {
+    Free(original_ptr);
+    return nullptr;
+  }
+
+  auto* arena = GetCurrentArena();
+  if (arena && (!original_ptr || arena->Contains(original_ptr))) {
+    return arena->Reallocate(original_ptr, original_size, new_size);
+  }
+  UASSERT_MSG(!arena, "Heap memory in a document of arena");
+  return std::realloc(original_ptr, new_size);
+}
+
+void Allocator::Free(void* ptr) noexcept {
+  auto* arena = GetCurrentArena();
+  // Arena memory is released all at once with the arena
+  if (arena && arena->Contains(ptr)) return;
+  std::free(ptr);
+}
+
+ArenaScope::ArenaScope(ArenaStorage* arena) noexcept {
+  auto current_arena = local_arena.Use();
+  previous_ = std::exchange(*current_arena, arena);
+}
+
+ArenaScope::~ArenaScope() {
+  auto current_arena = local_arena.Use();
+  *current_arena = previous_;
+}
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+// Monotonic memory of formats::json::Arena. Memory is allocated from a few big
+// blocks and is released only when the ArenaStorage is destroyed.
+class ArenaStorage final {
+ public:
+  explicit ArenaStorage(std::size_t block_size);
+
+  ArenaStorage(ArenaStorage&&) = delete;
+  ArenaStorage& operator=(ArenaStorage&&) = delete;
+  ~ArenaStorage();
+
+  void* Allocate(std::size_t size);
+
+  // The last allocation is resized in place if the current block has enough
+  // space, which makes growing arrays and strings cheap
+  void* Reallocate(void* ptr, std::size_t old_size, std::size_t new_size);
+
+  bool Contains(const void* ptr) const noexcept;
+
+  std::size_t GetAllocatedBytes() const noexcept;
+
+ private:
+  struct Block {
+    std::unique_ptr<char[]> data;
+    std::size_t size;
+  };
+
+  void AddBlock(std::size_t min_size);
+
+  std::size_t next_block_size_;
+  std::vector<Block> blocks_;
+  char* current_{nullptr};
+  char* end_{nullptr};
+  char* last_allocation_{nullptr};
+};
+
+// rapidjson allocator of formats::json documents. Uses the arena of the
+// ArenaScope that is active in the current thread, or heap if there is none.
+//
+// The memory of the arena is never freed by the allocator, so the documents
+// in arena must not be destroyed node by node, see VersionedValuePtr::Data.
+class Allocator final {
+ public:
+  static constexpr bool kNeedFree = true;
+
+  void* Malloc(std::size_t size);
+  void* Realloc(void* original_ptr, std::size_t original_size,
+                std::size_t new_size);
+  static void Free(void* ptr) noexcept;
+
+  bool operator==(const Allocator&) const noexcept { return true; }
+  bool operator!=(const Allocator&) const noexcept { return false; }
+};
+
+// Makes impl::Allocator use the `arena` (or heap if it is nullptr) until the
+// end of the scope. Every modification of a document should be done in the
+// scope of the document arena. Must not be held across coroutine switches.
+class ArenaScope final {
+ public:
+  explicit ArenaScope(ArenaStorage* arena) noexcept;
+
+  ArenaScope(ArenaScope&&) = delete;
+  ArenaScope& operator=(ArenaScope&&) = delete;
+  ~ArenaScope();
+
+ private:
+  ArenaStorage* previous_;
+};
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
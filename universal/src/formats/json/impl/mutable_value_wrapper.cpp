@@ -118,6 +118,11 @@ formats::json::Value MutableValueWrapper::ExtractValue() && {
   return std::move(impl_->value);
 }
 
+const std::shared_ptr<ArenaStorage>& MutableValueWrapper::GetArena()
+    const noexcept {
+  return impl_->value.holder_.GetArena();
+}
+
 void MutableValueWrapper::OnMembersChange() {
   UASSERT(impl_->value.holder_.Version() == impl_->current_version);
   impl_->value.holder_.BumpVersion();
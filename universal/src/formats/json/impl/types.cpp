@@ -10,13 +10,19 @@ VersionedValuePtr::Data::Data(Document&& doc)
     : Data(static_cast<Value&&>(doc)) {
   static_assert(
       // NOLINTNEXTLINE(misc-redundant-expression)
-      std::is_same_v<::rapidjson::CrtAllocator, Value::AllocatorType> &&
-          std::is_same_v<::rapidjson::CrtAllocator, Document::AllocatorType>,
-      "Both Document and Value must use CrtAllocator for the fast move");
+      std::is_same_v<Allocator, Value::AllocatorType> &&
+          std::is_same_v<Allocator, Document::AllocatorType>,
+      "Both Document and Value must use the same allocator for the fast move");
 }
 
 VersionedValuePtr::VersionedValuePtr() noexcept = default;
 
+VersionedValuePtr VersionedValuePtr::CreateInArena(
+    std::shared_ptr<ArenaStorage> arena) {
+  if (!arena) return Create();
+  return VersionedValuePtr{std::make_shared<Data>(std::move(arena))};
+}
+
 VersionedValuePtr::VersionedValuePtr(std::shared_ptr<Data>&& data) noexcept
     : data_(std::move(data)) {}
 
@@ -52,6 +58,12 @@ size_t VersionedValuePtr::Version() const {
 
 void VersionedValuePtr::BumpVersion() { ++data_->version; }
 
+const std::shared_ptr<ArenaStorage>& VersionedValuePtr::GetArena()
+    const noexcept {
+  static const std::shared_ptr<ArenaStorage> kNoArena;
+  return data_ ? data_->arena : kNoArena;
+}
+
 }  // namespace formats::json::impl
 
 USERVER_NAMESPACE_END
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <atomic>
+#include <memory>
 
 #include <rapidjson/document.h>
 
+#include <formats/json/impl/allocator.hpp>
 #include <userver/formats/json/impl/types.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -18,10 +20,21 @@ struct VersionedValuePtr::Data {
   // https://github.com/Tencent/rapidjson/issues/387
   explicit Data(Document&&);
 
-  ~Data() = default;
+  explicit Data(std::shared_ptr<ArenaStorage>&& arena_storage)
+      : native(), arena(std::move(arena_storage)) {}
+
+  ~Data() {
+    // Nodes of a document in arena are released all at once with the arena
+    if (!arena) native.~Value();
+  }
 
   // native rapidjson value
-  Value native;
+  union {
+    Value native;
+  };
+
+  // nullptr for the documents in heap
+  const std::shared_ptr<ArenaStorage> arena;
 
   // version of internal rapidjson structures (member arrays)
   // used in ValueBuilder to avoid UAF, ignored in read-only Value
@@ -0,0 +1,125 @@
+#include <formats/json/impl/writer.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#if defined(RAPIDJSON_SSE2) || defined(RAPIDJSON_SSE42)
+#include <emmintrin.h>
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+namespace {
+
+// Same escapes as in rapidjson::Writer::WriteString: 0 for characters that
+// are written as is, 'u' for \u00XX and the escaped character otherwise
+constexpr std::array<char, 256> kEscapes = []() {
+  std::array<char, 256> escapes{};
+  for (std::size_t c = 0; c < 0x20; ++c) escapes[c] = 'u';
+  escapes['\b'] = 'b';
+  escapes['\t'] = 't';
+  escapes['\n'] = 'n';
+  escapes['\f'] = 'f';
+  escapes['\r'] = 'r';
+  escapes['"'] = '"';
+  escapes['\\'] = '\\';
+  return escapes;
+}();
+
+constexpr char kHexDigits[] = "0123456789ABCDEF";
+
+bool NeedsEscaping(char c) {
+  return kEscapes[static_cast<unsigned char>(c)] != 0;
+}
+
+#if defined(RAPIDJSON_SSE2) || defined(RAPIDJSON_SSE42)
+
+constexpr std::size_t kBlockSize = 16;
+
+// Returns whether one of the kBlockSize characters at `p` needs escaping
+bool BlockNeedsEscaping(const char* p) {
+  const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+  const __m128i quotes = _mm_cmpeq_epi8(block, _mm_set1_epi8('"'));
+  const __m128i slashes = _mm_cmpeq_epi8(block, _mm_set1_epi8('\\'));
+  // c < 0x20 <=> max(c, 0x1F) == 0x1F
+  const __m128i controls = _mm_cmpeq_epi8(
+      _mm_max_epu8(block, _mm_set1_epi8(0x1F)), _mm_set1_epi8(0x1F));
+  return _mm_movemask_epi8(
+             _mm_or_si128(_mm_or_si128(quotes, slashes), controls)) != 0;
+}
+
+#else
+
+constexpr std::size_t kBlockSize = sizeof(std::uint64_t);
+
+constexpr std::uint64_t kOnes = ~std::uint64_t{0} / 0xFF;
+constexpr std::uint64_t kHighBits = kOnes * 0x80;
+
+constexpr std::uint64_t HasZeroByte(std::uint64_t x) {
+  return (x - kOnes) & ~x & kHighBits;
+}
+
+// Returns whether one of the kBlockSize characters at `p` needs escaping
+bool BlockNeedsEscaping(const char* p) {
+  std::uint64_t block{};
+  std::memcpy(&block, p, sizeof(block));
+  const auto controls = (block - kOnes * 0x20) & ~block & kHighBits;
+  return (controls | HasZeroByte(block ^ (kOnes * '"')) |
+          HasZeroByte(block ^ (kOnes * '\\'))) != 0;
+}
+
+#endif
+
+const char* FindEscaped(const char* p, const char* end) {
+  while (static_cast<std::size_t>(end - p) >= kBlockSize) {
+    if (BlockNeedsEscaping(p)) break;
+    p += kBlockSize;
+  }
+  while (p != end && !NeedsEscaping(*p)) ++p;
+  return p;
+}
+
+void WriteEscaped(rapidjson::StringBuffer& buffer, char c) {
+  const auto escape = kEscapes[static_cast<unsigned char>(c)];
+  if (escape != 'u') {
+    char* out = buffer.Push(2);
+    out[0] = '\\';
+    out[1] = escape;
+    return;
+  }
+
+  const auto code = static_cast<unsigned char>(c);
+  char* out = buffer.Push(6);
+  std::memcpy(out, "\\u00", 4);
+  out[4] = kHexDigits[code >> 4];
+  out[5] = kHexDigits[code & 0xF];
+}
+
+}  // namespace
+
+void WriteEscapedString(rapidjson::StringBuffer& buffer, std::string_view str) {
+  buffer.Reserve(str.size() + 2);
+  buffer.PutUnsafe('"');
+
+  const char* p = str.data();
+  const char* const end = p + str.size();
+  while (true) {
+    const char* const escaped = FindEscaped(p, end);
+    if (escaped != p) {
+      std::memcpy(buffer.Push(escaped - p), p, escaped - p);
+    }
+    if (escaped == end) break;
+
+    WriteEscaped(buffer, *escaped);
+    p = escaped + 1;
+  }
+
+  buffer.Put('"');
+}
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
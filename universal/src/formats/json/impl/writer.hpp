@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string_view>
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+/// Writes `str` as a quoted and escaped JSON string, the same way as
+/// rapidjson::Writer does. Runs of characters that need no escaping are
+/// found a register at a time and copied as a whole.
+void WriteEscapedString(rapidjson::StringBuffer& buffer, std::string_view str);
+
+/// rapidjson::Writer that writes strings and keys with WriteEscapedString.
+/// The output is the same as of rapidjson::Writer.
+class Writer final : public rapidjson::Writer<rapidjson::StringBuffer> {
+ public:
+  using Base = rapidjson::Writer<rapidjson::StringBuffer>;
+
+  explicit Writer(rapidjson::StringBuffer& buffer) : Base(buffer) {}
+
+  bool String(const Ch* str, rapidjson::SizeType length, bool = false) {
+    Prefix(rapidjson::kStringType);
+    WriteEscapedString(*os_, std::string_view{str, length});
+    return EndValue(true);
+  }
+
+  bool Key(const Ch* str, rapidjson::SizeType length, bool copy = false) {
+    return String(str, length, copy);
+  }
+};
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
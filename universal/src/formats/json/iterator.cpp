@@ -123,11 +123,10 @@ bool Iterator<Traits, Direction>::operator!=(
 }
 
 template <typename Traits, IteratorDirection Direction>
-std::string Iterator<Traits, Direction>::GetNameImpl() const {
+std::string_view Iterator<Traits, Direction>::GetNameImpl() const {
   if (type_ == impl::Type::objectValue) {
     const auto& key = GetValue(container_).value_ptr_->MemberBegin()[pos_].name;
-    return std::string(key.GetString(),
-                       key.GetString() + key.GetStringLength());
+    return std::string_view{key.GetString(), key.GetStringLength()};
   }
   throw TypeMismatchException(type_, impl::Type::objectValue,
                               GetValue(container_).GetPath());
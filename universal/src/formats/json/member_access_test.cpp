@@ -122,4 +122,13 @@ TEST_F(FormatsJsonSpecificMemberAccess,
   }
 }
 
+TEST_F(FormatsJsonSpecificMemberAccess, IteratorNameView) {
+  for (auto it = doc_.begin(); it != doc_.end(); ++it) {
+    EXPECT_EQ(it.GetNameView(), it.GetName());
+    EXPECT_EQ(doc_[it.GetNameView()], *it);
+  }
+
+  EXPECT_THROW(doc_["key4"].begin().GetNameView(), TypeMismatchException);
+}
+
 USERVER_NAMESPACE_END
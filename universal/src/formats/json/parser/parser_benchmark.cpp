@@ -100,6 +100,27 @@ void JsonParseValueSax(benchmark::State& state) {
 }
 BENCHMARK(JsonParseValueSax)->RangeMultiplier(2)->Range(1, 16);
 
+std::string BuildStrings(size_t len) {
+  std::string r = "[";
+  for (size_t i = 0; i < len; i++) {
+    if (i > 0) r += ',';
+    r += fmt::format(R"({{"id": "{:032}", "text": "{}"}})", i,
+                     std::string(64, 'x'));
+  }
+  r += ']';
+  return r;
+}
+
+void JsonParseStringsDom(benchmark::State& state) {
+  const auto input = BuildStrings(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    const auto res = formats::json::FromString(input);
+    benchmark::DoNotOptimize(res);
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(JsonParseStringsDom)->RangeMultiplier(4)->Range(4, 1024);
+
 namespace {
 
 struct SomeValue final {
@@ -4,6 +4,7 @@
 #include <rapidjson/schema.h>
 
 #include <formats/json/impl/accept.hpp>
+#include <formats/json/impl/allocator.hpp>
 #include <userver/formats/json/impl/types.hpp>
 #include <userver/formats/json/value.hpp>
 #include <userver/utils/assert.hpp>
@@ -24,11 +25,11 @@ std::string ToStdString(const impl::Value& value) {
 namespace impl {
 
 using SchemaDocument =
-    rapidjson::GenericSchemaDocument<impl::Value, rapidjson::CrtAllocator>;
+    rapidjson::GenericSchemaDocument<impl::Value, impl::Allocator>;
 
 using SchemaValidator = rapidjson::GenericSchemaValidator<
     impl::SchemaDocument, rapidjson::BaseReaderHandler<impl::UTF8, void>,
-    rapidjson::CrtAllocator>;
+    impl::Allocator>;
 
 }  // namespace impl
 
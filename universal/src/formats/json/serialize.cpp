@@ -2,7 +2,9 @@
 
 #include <algorithm>
 #include <array>
+#include <cstring>
 #include <fstream>
+#include <limits>
 #include <memory>
 #include <string_view>
 #include <vector>
@@ -16,8 +18,11 @@
 #include <rapidjson/writer.h>
 
 #include <formats/json/impl/accept.hpp>
+#include <formats/json/impl/allocator.hpp>
 #include <formats/json/impl/json_tree.hpp>
 #include <formats/json/impl/types_impl.hpp>
+#include <formats/json/impl/writer.hpp>
+#include <userver/formats/json/arena.hpp>
 #include <userver/formats/json/exception.hpp>
 #include <userver/formats/json/value.hpp>
 #include <userver/logging/log.hpp>
@@ -29,7 +34,43 @@ namespace formats::json {
 
 namespace {
 
-::rapidjson::CrtAllocator g_allocator;
+impl::Allocator g_allocator;
+
+constexpr unsigned kParseFlags = rapidjson::kParseDefaultFlags |
+                                 rapidjson::kParseIterativeFlag |
+                                 rapidjson::kParseFullPrecisionFlag;
+
+#if defined(RAPIDJSON_SSE2) || defined(RAPIDJSON_SSE42) || \
+    defined(RAPIDJSON_NEON)
+// rapidjson scans strings with SIMD only in null-terminated input. Copying
+// a document is much cheaper than scanning its strings byte by byte, unless
+// the document is small.
+constexpr std::size_t kNullTerminatedParseMinSize = 1024;
+#else
+constexpr std::size_t kNullTerminatedParseMinSize =
+    std::numeric_limits<std::size_t>::max();
+#endif
+
+constexpr std::size_t kSimdPadding = 16;
+
+rapidjson::ParseResult Parse(impl::Document& json, std::string_view doc) {
+  if (doc.size() < kNullTerminatedParseMinSize) {
+    return json.Parse<kParseFlags>(doc.data(), doc.size());
+  }
+
+  // SIMD loads are aligned and never cross a page boundary, but they read past
+  // the terminating null. Padding keeps them inside of the allocation, which
+  // is required for sanitizers.
+  std::string buffer(doc.size() + kSimdPadding, '\0');
+  std::memcpy(buffer.data(), doc.data(), doc.size());
+  rapidjson::StringStream stream{buffer.c_str()};
+  rapidjson::ParseResult ok = json.ParseStream<kParseFlags>(stream);
+  if (ok && stream.Tell() != doc.size()) {
+    // Embedded '\0' is taken for the end of the document
+    ok.Set(rapidjson::kParseErrorDocumentRootNotSingular, stream.Tell());
+  }
+  return ok;
+}
 
 std::string_view AsStringView(const impl::Value& jval) {
   return {jval.GetString(), jval.GetStringLength()};
@@ -95,24 +136,70 @@ void CheckKeyUniqueness(const impl::Value* root) {
   }
 }
 
+// rapidjson input stream over the chunks, see FromChunks
+class ChunksStream final {
+ public:
+  using Ch = char;
+
+  explicit ChunksStream(utils::function_ref<bool(std::string&)> next_chunk)
+      : next_chunk_(next_chunk) {
+    Fetch();
+  }
+
+  Ch Peek() const { return pos_ < chunk_.size() ? chunk_[pos_] : '\0'; }
+
+  Ch Take() {
+    if (pos_ == chunk_.size()) return '\0';
+    const Ch c = chunk_[pos_++];
+    ++offset_;
+    if (pos_ == chunk_.size()) Fetch();
+    return c;
+  }
+
+  std::size_t Tell() const { return offset_; }
+
+  // Write operations are not used by rapidjson::Reader for input streams
+  Ch* PutBegin() {
+    UASSERT(false);
+    return nullptr;
+  }
+  void Put(Ch) { UASSERT(false); }
+  void Flush() { UASSERT(false); }
+  std::size_t PutEnd(Ch*) {
+    UASSERT(false);
+    return 0;
+  }
+
+ private:
+  void Fetch() {
+    pos_ = 0;
+    do {
+      chunk_.clear();
+      if (!next_chunk_(chunk_)) {
+        chunk_.clear();
+        return;
+      }
+    } while (chunk_.empty());
+  }
+
+  utils::function_ref<bool(std::string&)> next_chunk_;
+  std::string chunk_;
+  std::size_t pos_{0};
+  std::size_t offset_{0};
+};
+
 impl::VersionedValuePtr EnsureValid(impl::Document&& json) {
   CheckKeyUniqueness(&json);
 
   return impl::VersionedValuePtr::Create(std::move(json));
 }
 
-}  // namespace
-
-Value FromString(std::string_view doc) {
+void ParseString(impl::Document& json, std::string_view doc) {
   if (doc.empty()) {
     throw ParseException("JSON document is empty");
   }
 
-  impl::Document json{&g_allocator};
-  rapidjson::ParseResult ok =
-      json.Parse<rapidjson::kParseDefaultFlags |
-                 rapidjson::kParseIterativeFlag |
-                 rapidjson::kParseFullPrecisionFlag>(doc.data(), doc.size());
+  const rapidjson::ParseResult ok = Parse(json, doc);
   if (!ok) {
     const auto offset = ok.Offset();
     const auto line = 1 + std::count(doc.begin(), doc.begin() + offset, '\n');
@@ -125,10 +212,27 @@ Value FromString(std::string_view doc) {
         fmt::format("JSON parse error at line {} column {}: {}", line, column,
                     rapidjson::GetParseError_En(ok.Code())));
   }
+}
+
+}  // namespace
 
+Value FromString(std::string_view doc) {
+  impl::Document json{&g_allocator};
+  ParseString(json, doc);
   return Value{EnsureValid(std::move(json))};
 }
 
+Value FromStringInArena(std::string_view doc, Arena& arena) {
+  const impl::ArenaScope scope{arena.storage_.get()};
+  impl::Document json{&g_allocator};
+  ParseString(json, doc);
+  CheckKeyUniqueness(&json);
+
+  auto root = impl::VersionedValuePtr::CreateInArena(arena.storage_);
+  *root = std::move(static_cast<impl::Value&>(json));
+  return Value{std::move(root)};
+}
+
 Value FromStream(std::istream& is) {
   if (!is) {
     throw BadStreamException(is);
@@ -136,10 +240,20 @@ Value FromStream(std::istream& is) {
 
   rapidjson::IStreamWrapper in(is);
   impl::Document json{&g_allocator};
-  rapidjson::ParseResult ok =
-      json.ParseStream<rapidjson::kParseDefaultFlags |
-                       rapidjson::kParseIterativeFlag |
-                       rapidjson::kParseFullPrecisionFlag>(in);
+  const rapidjson::ParseResult ok = json.ParseStream<kParseFlags>(in);
+  if (!ok) {
+    throw ParseException(fmt::format("JSON parse error at offset {}: {}",
+                                     ok.Offset(),
+                                     rapidjson::GetParseError_En(ok.Code())));
+  }
+
+  return Value{EnsureValid(std::move(json))};
+}
+
+Value FromChunks(utils::function_ref<bool(std::string& chunk)> next_chunk) {
+  ChunksStream in{next_chunk};
+  impl::Document json{&g_allocator};
+  const rapidjson::ParseResult ok = json.ParseStream<kParseFlags>(in);
   if (!ok) {
     throw ParseException(fmt::format("JSON parse error at offset {}: {}",
                                      ok.Offset(),
@@ -160,7 +274,7 @@ void Serialize(const Value& doc, std::ostream& os) {
 
 std::string ToString(const Value& doc) {
   rapidjson::StringBuffer buffer;
-  rapidjson::Writer writer(buffer);
+  impl::Writer writer(buffer);
   AcceptNoRecursion(doc.GetNative(), writer);
   return std::string{buffer.GetString(), buffer.GetLength()};
 }
@@ -174,7 +288,7 @@ std::string ToStableString(Value&& doc) {
     Value value = std::move(doc);
 
     rapidjson::StringBuffer buffer;
-    rapidjson::Writer writer(buffer);
+    impl::Writer writer(buffer);
     AcceptNoRecursion<ObjectProcessing::kInplaceSorting>(value.GetNative(),
                                                          writer);
     return std::string{buffer.GetString(), buffer.GetLength()};
@@ -194,7 +308,7 @@ std::string ToPrettyString(const formats::json::Value& doc,
 
 logging::LogHelper& operator<<(logging::LogHelper& lh, const Value& doc) {
   rapidjson::StringBuffer buffer;
-  rapidjson::Writer writer(buffer);
+  impl::Writer writer(buffer);
   AcceptNoRecursion(doc.GetNative(), writer);
   return lh << std::string_view{buffer.GetString(), buffer.GetLength()};
 }
@@ -220,7 +334,7 @@ struct StringBuffer::Impl final {
 };
 
 StringBuffer::StringBuffer(const formats::json::Value& value) {
-  rapidjson::Writer writer(pimpl_->buffer);
+  Writer writer(pimpl_->buffer);
   AcceptNoRecursion(value.GetNative(), writer);
 }
 
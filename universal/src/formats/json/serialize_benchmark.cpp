@@ -1175,6 +1175,44 @@ void DeepWidthJson(benchmark::State& state) {
   }
 }
 
+// DeepWidthJson parsed into an arena, the arena is created for each document
+void DeepWidthJsonArena(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    formats::json::Arena arena;
+    auto json = formats::json::FromStringInArena(str_deep_width_json, arena);
+    benchmark::DoNotOptimize(json);
+  }
+}
+
+void BuildJson(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    formats::json::ValueBuilder builder{formats::json::Type::kObject};
+    for (int i = 0; i < 100; ++i) {
+      auto item = builder["items"][std::to_string(i)];
+      item["name"] = "name of the item that is long enough";
+      item["values"].PushBack(i);
+      item["values"].PushBack(i + 1);
+    }
+    auto json = builder.ExtractValue();
+    benchmark::DoNotOptimize(json);
+  }
+}
+
+void BuildJsonArena(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    formats::json::Arena arena;
+    formats::json::ValueBuilder builder{arena, formats::json::Type::kObject};
+    for (int i = 0; i < 100; ++i) {
+      auto item = builder["items"][std::to_string(i)];
+      item["name"] = "name of the item that is long enough";
+      item["values"].PushBack(i);
+      item["values"].PushBack(i + 1);
+    }
+    auto json = builder.ExtractValue();
+    benchmark::DoNotOptimize(json);
+  }
+}
+
 BENCHMARK(SmallJson);
 
 BENCHMARK(MiddleJson);
@@ -1185,6 +1223,12 @@ BENCHMARK(DeepJson);
 
 BENCHMARK(DeepWidthJson);
 
+BENCHMARK(DeepWidthJsonArena);
+
+BENCHMARK(BuildJson);
+
+BENCHMARK(BuildJsonArena);
+
 namespace {
 
 struct InnerObject final {
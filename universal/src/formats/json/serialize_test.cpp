@@ -3,12 +3,15 @@
 #include <map>
 
 #include <boost/range/adaptor/reversed.hpp>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
 
 #include <formats/common/serialize_test.hpp>
 #include <userver/formats/json/exception.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/formats/parse/common_containers.hpp>
+#include <userver/utest/assert_macros.hpp>
 #include <userver/utils/fmt_compat.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -68,6 +71,34 @@ TEST(FormatsJson, ParseErrorLineColumnValidation) {
                        "line 2 column 12");
 }
 
+TEST(FormatsJson, FromStringLarge) {
+  const std::string long_string(4096, 'a');
+  const auto json = formats::json::FromString(
+      R"({"long": ")" + long_string + R"(", "escaped": "a\"b\u00e9", "n": 1})");
+
+  EXPECT_EQ(json["long"].As<std::string>(), long_string);
+  EXPECT_EQ(json["escaped"].As<std::string>(), "a\"b\xc3\xa9");
+  EXPECT_EQ(json["n"].As<int>(), 1);
+}
+
+TEST(FormatsJson, FromStringLargeErrors) {
+  const std::string long_string(4096, 'a');
+  const std::string doc = R"({"long": ")" + long_string + R"("})";
+
+#if defined(RAPIDJSON_SSE2) || defined(RAPIDJSON_SSE42) || \
+    defined(RAPIDJSON_NEON)
+  // Large documents are parsed as null-terminated strings only with SIMD
+  auto with_null = doc;
+  with_null += '\0';
+  with_null += "{}";
+  UEXPECT_THROW(formats::json::FromString(with_null),
+                formats::json::ParseException);
+#endif
+
+  const std::string with_new_line = R"({"long": ")" + long_string + "\n\"}";
+  TestExceptionMessage(with_new_line.c_str(), "line 1 column 4107");
+}
+
 TEST(FormatsJson, ParseFromBadFile) {
   using formats::json::blocking::FromFile;
   using ParseException = formats::json::Value::ParseException;
@@ -83,6 +114,75 @@ TEST(FormatsJson, ParseFromBadFile) {
   }
 }
 
+TEST(FormatsJson, FromChunks) {
+  constexpr std::string_view kJson =
+      R"({"key": "value", "array": [1, 2.5, true, null], "nested": {}})";
+
+  for (std::size_t chunk_size = 1; chunk_size <= kJson.size(); ++chunk_size) {
+    std::size_t pos = 0;
+    const auto json = formats::json::FromChunks([&](std::string& chunk) {
+      if (pos == kJson.size()) return false;
+      chunk.assign(kJson.substr(pos, chunk_size));
+      pos += chunk.size();
+      return true;
+    });
+    EXPECT_EQ(json, formats::json::FromString(kJson)) << chunk_size;
+  }
+}
+
+TEST(FormatsJson, FromChunksEmptyChunks) {
+  std::vector<std::string> chunks{"", "[1,", "", "", "2]", ""};
+  auto it = chunks.begin();
+  const auto json = formats::json::FromChunks([&](std::string& chunk) {
+    if (it == chunks.end()) return false;
+    chunk = *it++;
+    return true;
+  });
+  EXPECT_EQ(json, formats::json::FromString("[1,2]"));
+}
+
+TEST(FormatsJson, FromChunksErrors) {
+  using ParseException = formats::json::Value::ParseException;
+
+  const auto no_chunks = [](std::string&) { return false; };
+  UEXPECT_THROW(formats::json::FromChunks(no_chunks), ParseException);
+
+  bool done = false;
+  const auto truncated = [&](std::string& chunk) {
+    if (done) return false;
+    chunk = R"({"key":)";
+    done = true;
+    return true;
+  };
+  UEXPECT_THROW(formats::json::FromChunks(truncated), ParseException);
+}
+
+TEST(FormatsJson, ToStringEscaping) {
+  std::string all_chars;
+  for (int c = 0; c < 256; ++c) all_chars += static_cast<char>(c);
+  const std::string plain = "a long string without escaped characters";
+
+  // Escaped characters at every position of the blocks of a SIMD scan
+  for (std::size_t size = 0; size < 40; ++size) {
+    for (std::size_t pos = 0; pos < all_chars.size(); ++pos) {
+      const auto str = plain.substr(0, size) + all_chars.substr(pos, 3) +
+                       plain.substr(0, size % 17);
+
+      rapidjson::StringBuffer buffer;
+      rapidjson::Writer writer{buffer};
+      writer.StartObject();
+      writer.Key(str.data(), str.size());
+      writer.String(str.data(), str.size());
+      writer.EndObject();
+
+      formats::json::ValueBuilder builder;
+      builder[str] = str;
+      ASSERT_EQ(formats::json::ToString(builder.ExtractValue()),
+                std::string_view(buffer.GetString(), buffer.GetLength()));
+    }
+  }
+}
+
 class FmtFormatterParameterized : public testing::TestWithParam<std::string> {};
 
 TEST_P(FmtFormatterParameterized, FormatsJsonFmt) {
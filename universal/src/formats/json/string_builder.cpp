@@ -5,9 +5,9 @@
 
 #include <rapidjson/document.h>
 #include <rapidjson/stringbuffer.h>
-#include <rapidjson/writer.h>
 
 #include <formats/json/impl/accept.hpp>
+#include <formats/json/impl/writer.hpp>
 #include <userver/formats/common/validations.hpp>
 #include <userver/formats/json/impl/types.hpp>
 #include <userver/formats/json/value.hpp>
@@ -20,7 +20,7 @@ namespace formats::json {
 
 struct StringBuilder::Impl {
   rapidjson::StringBuffer buffer;
-  rapidjson::Writer<rapidjson::StringBuffer> writer{buffer};
+  impl::Writer writer{buffer};
 
   Impl() = default;
 };
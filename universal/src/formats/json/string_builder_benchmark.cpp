@@ -1,3 +1,5 @@
+#include <string>
+
 #include <benchmark/benchmark.h>
 
 #include <userver/formats/json/string_builder.hpp>
@@ -74,4 +76,17 @@ void JsonStringBuilder(benchmark::State& state) {
 }
 BENCHMARK(JsonStringBuilder)->RangeMultiplier(4)->Range(1, 1024);
 
+void JsonStringBuilderStrings(benchmark::State& state) {
+  const std::string value(state.range(0), 'a');
+  for ([[maybe_unused]] auto _ : state) {
+    StringBuilder sw;
+    {
+      StringBuilder::ArrayGuard guard(sw);
+      for (int i = 0; i < 100; ++i) sw.WriteString(value);
+    }
+    benchmark::DoNotOptimize(sw.GetStringView());
+  }
+}
+BENCHMARK(JsonStringBuilderStrings)->RangeMultiplier(4)->Range(4, 4096);
+
 USERVER_NAMESPACE_END
@@ -35,7 +35,7 @@ static_assert(std::numeric_limits<double>::digits <
               "Your compiler provides unusually large double, please contact "
               "userver support chat");
 
-::rapidjson::CrtAllocator g_allocator;
+impl::Allocator g_allocator;
 
 template <typename T>
 auto CheckedNotTooNegative(T x, const Value& value) {
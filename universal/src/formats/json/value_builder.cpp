@@ -34,19 +34,33 @@ rapidjson::Type ToNativeType(Type type) {
   }
 }
 
-::rapidjson::CrtAllocator g_allocator;
+impl::Allocator g_allocator;
+
+// Nodes of a document must be allocated from the arena of its root
+impl::ArenaScope MakeArenaScope(const impl::MutableValueWrapper& value) {
+  return impl::ArenaScope{value.GetArena().get()};
+}
 
 }  // namespace
 
 ValueBuilder::ValueBuilder(Type type)
     : value_(impl::VersionedValuePtr::Create(ToNativeType(type))) {}
 
-ValueBuilder::ValueBuilder(const ValueBuilder& other) {
+ValueBuilder::ValueBuilder(Arena& arena, Type type)
+    : value_(impl::VersionedValuePtr::CreateInArena(arena.storage_)) {
+  value_->GetNative() = impl::Value{ToNativeType(type)};
+}
+
+ValueBuilder::ValueBuilder(const ValueBuilder& other)
+    : value_(impl::VersionedValuePtr::CreateInArena(other.value_.GetArena())) {
+  const auto scope = MakeArenaScope(value_);
   Copy(value_->GetNative(), other);
 }
 
 // NOLINTNEXTLINE(performance-noexcept-move-constructor)
-ValueBuilder::ValueBuilder(ValueBuilder&& other) {
+ValueBuilder::ValueBuilder(ValueBuilder&& other)
+    : value_(impl::VersionedValuePtr::CreateInArena(other.value_.GetArena())) {
+  const auto scope = MakeArenaScope(value_);
   Move(value_->GetNative(), std::move(other));
 }
 
@@ -96,6 +110,7 @@ ValueBuilder& ValueBuilder::operator=(const ValueBuilder& other) {
   if ((value_->IsArray() || value_->IsObject()) && value_->GetSize() != 0) {
     value_.OnMembersChange();
   }
+  const auto scope = MakeArenaScope(value_);
   Copy(value_->GetNative(), other);
   return *this;
 }
@@ -105,19 +120,24 @@ ValueBuilder& ValueBuilder::operator=(ValueBuilder&& other) {
   if ((value_->IsArray() || value_->IsObject()) && value_->GetSize() != 0) {
     value_.OnMembersChange();
   }
+  const auto scope = MakeArenaScope(value_);
   Move(value_->GetNative(), std::move(other));
   return *this;
 }
 
-ValueBuilder::ValueBuilder(const formats::json::Value& other) {
+ValueBuilder::ValueBuilder(const formats::json::Value& other)
+    : value_(impl::VersionedValuePtr::CreateInArena(other.holder_.GetArena())) {
   // As we have new native object created,
   // we fill it with the copy from other's native object.
+  const auto scope = MakeArenaScope(value_);
   value_->GetNative().CopyFrom(other.GetNative(), g_allocator);
 }
 
-ValueBuilder::ValueBuilder(formats::json::Value&& other) {
+ValueBuilder::ValueBuilder(formats::json::Value&& other)
+    : value_(impl::VersionedValuePtr::CreateInArena(other.holder_.GetArena())) {
   // As we have new native object created,
   // we fill it with the other's native object.
+  const auto scope = MakeArenaScope(value_);
   if (other.IsUniqueReference())
     value_->GetNative() = std::move(other.GetNative());
   else
@@ -136,6 +156,7 @@ ValueBuilder::ValueBuilder(common::TransferTag, ValueBuilder&& value) noexcept
     : value_(std::move(value.value_)) {}
 
 ValueBuilder ValueBuilder::operator[](std::string key) {
+  const auto scope = MakeArenaScope(value_);
   auto& member = AddMember(key, CheckMemberExists::kYes);
   return ValueBuilder{value_.WrapMember(std::move(key), member)};
 }
@@ -146,11 +167,13 @@ ValueBuilder ValueBuilder::operator[](std::size_t index) {
 }
 
 void ValueBuilder::EmplaceNocheck(std::string_view key, ValueBuilder value) {
+  const auto scope = MakeArenaScope(value_);
   Move(AddMember(key, CheckMemberExists::kNo), std::move(value));
 }
 
 void ValueBuilder::Remove(std::string_view key) {
   value_->CheckObject();
+  const auto scope = MakeArenaScope(value_);
   if (value_->GetNative().RemoveMember(impl::MakeJsonStringViewValue(key))) {
     value_.OnMembersChange();
   }
@@ -196,6 +219,7 @@ std::string ValueBuilder::GetPath() const { return value_->GetPath(); }
 
 void ValueBuilder::Resize(std::size_t size) {
   value_->CheckArrayOrNull();
+  const auto scope = MakeArenaScope(value_);
   auto& native = value_->GetNative();
 
   if (native.IsNull()) native.SetArray();
@@ -218,6 +242,7 @@ void ValueBuilder::Resize(std::size_t size) {
 
 void ValueBuilder::PushBack(ValueBuilder&& bld) {
   value_->CheckArrayOrNull();
+  const auto scope = MakeArenaScope(value_);
   auto& native = value_->GetNative();
   if (native.IsNull()) {
     native.SetArray();
@@ -232,7 +257,7 @@ void ValueBuilder::PushBack(ValueBuilder&& bld) {
     }
   };
 
-  if (bld.value_->IsRoot()) {
+  if (bld.value_->IsRoot() && bld.value_.GetArena() == value_.GetArena()) {
     // PushBack is moving value via RawAssign
     checked_push_back(bld.value_->GetNative());
   } else {
@@ -254,7 +279,8 @@ void ValueBuilder::Copy(impl::Value& to, const ValueBuilder& from) {
 }
 
 void ValueBuilder::Move(impl::Value& to, ValueBuilder&& from) {
-  if (from.value_->IsRoot()) {
+  // Nodes of another arena or of heap are not adopted by the document
+  if (from.value_->IsRoot() && from.value_.GetArena() == value_.GetArena()) {
     to = std::move(from.value_->GetNative());
   } else {
     Copy(to, from);
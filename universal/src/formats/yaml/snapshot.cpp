@@ -0,0 +1,253 @@
+#include <userver/formats/yaml/impl/snapshot.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+#include <fmt/format.h>
+#include <yaml-cpp/yaml.h>
+
+#include <userver/formats/yaml/serialize.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::yaml::impl {
+
+class SnapshotAccess final {
+ public:
+  static const YAML::Node& GetNative(const Value& value) {
+    return value.GetNative();
+  }
+
+  static Value MakeRoot(const YAML::Node& node) { return Value(node); }
+};
+
+namespace {
+
+constexpr std::string_view kMagic = "USRVYAML";
+constexpr std::uint32_t kFormatVersion = 1;
+constexpr auto kSnapshotPerms = boost::filesystem::perms::owner_read |
+                                boost::filesystem::perms::owner_write;
+
+enum class NodeKind : std::uint8_t {
+  kNull = 0,
+  kScalar = 1,
+  kSequence = 2,
+  kMap = 3,
+};
+
+struct MalformedSnapshot {};
+
+std::uint64_t HashSource(std::string_view source) {
+  return std::hash<std::string_view>{}(source);
+}
+
+class SnapshotWriter final {
+ public:
+  explicit SnapshotWriter(std::string& out) : out_(out) {}
+
+  template <typename T>
+  void WriteFixed(T value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    out_.append(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
+
+  void WriteSize(std::size_t size) {
+    // LEB128, most of the sizes fit into a single byte
+    while (size >= 0x80) {
+      out_.push_back(static_cast<char>((size & 0x7F) | 0x80));
+      size >>= 7;
+    }
+    out_.push_back(static_cast<char>(size));
+  }
+
+  void WriteString(std::string_view str) {
+    WriteSize(str.size());
+    out_.append(str);
+  }
+
+  void WriteNode(const YAML::Node& node) {
+    switch (node.Type()) {
+      case YAML::NodeType::Undefined:
+      case YAML::NodeType::Null:
+        WriteHeader(NodeKind::kNull, node);
+        break;
+      case YAML::NodeType::Scalar:
+        WriteHeader(NodeKind::kScalar, node);
+        WriteString(node.Scalar());
+        break;
+      case YAML::NodeType::Sequence:
+        WriteHeader(NodeKind::kSequence, node);
+        WriteFixed(static_cast<std::uint8_t>(node.Style()));
+        WriteSize(node.size());
+        for (const auto& item : node) WriteNode(item);
+        break;
+      case YAML::NodeType::Map:
+        WriteHeader(NodeKind::kMap, node);
+        WriteFixed(static_cast<std::uint8_t>(node.Style()));
+        WriteSize(node.size());
+        for (const auto& item : node) {
+          WriteNode(item.first);
+          WriteNode(item.second);
+        }
+        break;
+    }
+  }
+
+ private:
+  void WriteHeader(NodeKind kind, const YAML::Node& node) {
+    WriteFixed(kind);
+    WriteString(node.Tag());
+  }
+
+  std::string& out_;
+};
+
+class SnapshotReader final {
+ public:
+  explicit SnapshotReader(std::string_view data) : data_(data) {}
+
+  bool IsEnd() const noexcept { return data_.empty(); }
+
+  template <typename T>
+  T ReadFixed() {
+    static_assert(std::is_trivially_copyable_v<T>);
+    T value;
+    std::memcpy(&value, ReadBytes(sizeof(value)).data(), sizeof(value));
+    return value;
+  }
+
+  std::size_t ReadSize() {
+    std::size_t size = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      const auto byte = ReadFixed<std::uint8_t>();
+      size |= static_cast<std::size_t>(byte & 0x7F) << shift;
+      if (!(byte & 0x80)) return size;
+    }
+    throw MalformedSnapshot{};
+  }
+
+  std::string_view ReadBytes(std::size_t size) {
+    if (size > data_.size()) throw MalformedSnapshot{};
+    const auto result = data_.substr(0, size);
+    data_.remove_prefix(size);
+    return result;
+  }
+
+  std::string_view ReadString() { return ReadBytes(ReadSize()); }
+
+  YAML::Node ReadNode() {
+    const auto kind = ReadFixed<NodeKind>();
+    const std::string tag{ReadString()};
+
+    YAML::Node node;
+    switch (kind) {
+      case NodeKind::kNull:
+        node = YAML::Node(YAML::NodeType::Null);
+        break;
+      case NodeKind::kScalar:
+        node = YAML::Node(std::string{ReadString()});
+        break;
+      case NodeKind::kSequence: {
+        node = YAML::Node(YAML::NodeType::Sequence);
+        ReadStyle(node);
+        const auto size = ReadSize();
+        for (std::size_t i = 0; i < size; ++i) node.push_back(ReadNode());
+        break;
+      }
+      case NodeKind::kMap: {
+        node = YAML::Node(YAML::NodeType::Map);
+        ReadStyle(node);
+        const auto size = ReadSize();
+        for (std::size_t i = 0; i < size; ++i) {
+          auto key = ReadNode();
+          // force_insert keeps the parsed order and does not search the map
+          node.force_insert(key, ReadNode());
+        }
+        break;
+      }
+      default:
+        throw MalformedSnapshot{};
+    }
+    node.SetTag(tag);
+    return node;
+  }
+
+ private:
+  void ReadStyle(YAML::Node& node) {
+    // keeps flow collections in flow style when the config is dumped back
+    const auto style = ReadFixed<std::uint8_t>();
+    if (style > YAML::EmitterStyle::Flow) throw MalformedSnapshot{};
+    node.SetStyle(static_cast<YAML::EmitterStyle::value>(style));
+  }
+
+  std::string_view data_;
+};
+
+}  // namespace
+
+std::string ToBinarySnapshot(const Value& doc, std::string_view source) {
+  std::string result;
+  SnapshotWriter writer{result};
+  result.append(kMagic);
+  writer.WriteFixed(kFormatVersion);
+  writer.WriteFixed(HashSource(source));
+  writer.WriteFixed(static_cast<std::uint64_t>(source.size()));
+  writer.WriteNode(SnapshotAccess::GetNative(doc));
+  return result;
+}
+
+std::optional<Value> FromBinarySnapshot(std::string_view snapshot,
+                                        std::string_view source) {
+  try {
+    SnapshotReader reader{snapshot};
+    if (reader.ReadBytes(kMagic.size()) != kMagic ||
+        reader.ReadFixed<std::uint32_t>() != kFormatVersion ||
+        reader.ReadFixed<std::uint64_t>() != HashSource(source) ||
+        reader.ReadFixed<std::uint64_t>() != source.size()) {
+      return std::nullopt;
+    }
+
+    auto root = reader.ReadNode();
+    if (!reader.IsEnd()) return std::nullopt;
+    return SnapshotAccess::MakeRoot(root);
+  } catch (const MalformedSnapshot&) {
+    return std::nullopt;
+  }
+}
+
+Value FromStringWithSnapshot(const std::string& doc,
+                             const std::string& snapshot_dir) {
+  const auto path = fmt::format("{}/{:016x}.yaml.snapshot", snapshot_dir,
+                                HashSource(doc));
+  try {
+    if (fs::blocking::FileExists(path)) {
+      auto value =
+          FromBinarySnapshot(fs::blocking::ReadFileContents(path), doc);
+      if (value) return std::move(*value);
+      LOG_WARNING() << "Ignoring stale YAML snapshot '" << path << '\'';
+    }
+  } catch (const std::exception& e) {
+    LOG_WARNING() << "Failed to read YAML snapshot '" << path
+                  << "': " << e.what();
+  }
+
+  auto value = FromString(doc);
+  try {
+    fs::blocking::CreateDirectories(snapshot_dir);
+    fs::blocking::RewriteFileContentsAtomically(
+        path, ToBinarySnapshot(value, doc), kSnapshotPerms);
+  } catch (const std::exception& e) {
+    LOG_WARNING() << "Failed to write YAML snapshot '" << path
+                  << "': " << e.what();
+  }
+  return value;
+}
+
+}  // namespace formats::yaml::impl
+
+USERVER_NAMESPACE_END
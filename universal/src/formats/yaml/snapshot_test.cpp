@@ -0,0 +1,126 @@
+#include <userver/formats/yaml/impl/snapshot.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/formats/yaml/serialize.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/utest/assert_macros.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace impl = formats::yaml::impl;
+
+const std::string kDoc = R"(
+components_manager:
+    task_processors:
+        main-task-processor:
+            worker_threads: $worker_threads
+            worker_threads#fallback: 4
+    components:
+        server:
+            listener: {port: 8080, connection: {in_buffer_size: 32768}}
+        logging:
+            loggers:
+                default: {file_path: '@stderr', level: "debug"}
+    list: [1, 2.5, ~, true, "quoted", 'single', -3]
+    empty_map: {}
+    empty_list: []
+    tagged: !my_tag value
+    tagged_null: !my_tag
+    null_value:
+    multiline: |
+        first line
+        second line
+    unicode: "éè"
+config_vars: /etc/service/config_vars.yaml
+)";
+
+void ExpectSameNodes(const formats::yaml::Value& expected,
+                     const formats::yaml::Value& actual) {
+  ASSERT_EQ(expected.GetTag(), actual.GetTag()) << actual.GetPath();
+  ASSERT_EQ(expected.IsNull(), actual.IsNull()) << actual.GetPath();
+  ASSERT_EQ(expected.IsArray(), actual.IsArray()) << actual.GetPath();
+  ASSERT_EQ(expected.IsObject(), actual.IsObject()) << actual.GetPath();
+  if (expected.IsArray() || expected.IsObject()) {
+    ASSERT_EQ(expected.GetSize(), actual.GetSize()) << actual.GetPath();
+    for (auto it = expected.begin(), other = actual.begin();
+         it != expected.end(); ++it, ++other) {
+      if (expected.IsObject()) {
+        ASSERT_EQ(it.GetName(), other.GetName()) << actual.GetPath();
+      }
+      ExpectSameNodes(*it, *other);
+    }
+  } else if (!expected.IsNull()) {
+    ASSERT_EQ(expected.As<std::string>(), actual.As<std::string>())
+        << actual.GetPath();
+  }
+}
+
+}  // namespace
+
+TEST(FormatsYamlSnapshot, Roundtrip) {
+  const auto expected = formats::yaml::FromString(kDoc);
+  const auto snapshot = impl::ToBinarySnapshot(expected, kDoc);
+  const auto actual = impl::FromBinarySnapshot(snapshot, kDoc);
+  ASSERT_TRUE(actual);
+
+  ExpectSameNodes(expected, *actual);
+  EXPECT_EQ(formats::yaml::ToString(expected),
+            formats::yaml::ToString(*actual));
+  EXPECT_TRUE(actual->IsRoot());
+
+  const auto manager = (*actual)["components_manager"];
+  EXPECT_EQ(manager["list"][1].As<double>(), 2.5);
+  EXPECT_TRUE(manager["list"][3].As<bool>());
+  EXPECT_EQ(manager["list"][6].As<int>(), -3);
+  EXPECT_EQ(manager["multiline"].As<std::string>(),
+            "first line\nsecond line\n");
+  EXPECT_EQ(manager["list"][4].GetPath(), "components_manager.list[4]");
+}
+
+TEST(FormatsYamlSnapshot, Scalars) {
+  for (const std::string doc : {"42", "~", "''", "!tag"}) {
+    const auto expected = formats::yaml::FromString(doc);
+    const auto actual =
+        impl::FromBinarySnapshot(impl::ToBinarySnapshot(expected, doc), doc);
+    ASSERT_TRUE(actual) << doc;
+    ExpectSameNodes(expected, *actual);
+  }
+}
+
+TEST(FormatsYamlSnapshot, Invalid) {
+  const auto snapshot =
+      impl::ToBinarySnapshot(formats::yaml::FromString(kDoc), kDoc);
+
+  EXPECT_FALSE(impl::FromBinarySnapshot(snapshot, kDoc + ' '));
+  EXPECT_FALSE(impl::FromBinarySnapshot("", kDoc));
+  EXPECT_FALSE(impl::FromBinarySnapshot(snapshot + 'x', kDoc));
+  for (std::size_t size = 0; size < snapshot.size(); ++size) {
+    EXPECT_FALSE(impl::FromBinarySnapshot(snapshot.substr(0, size), kDoc));
+  }
+}
+
+TEST(FormatsYamlSnapshot, Cache) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto snapshot_dir = dir.GetPath() + "/snapshots";
+
+  const auto parsed = impl::FromStringWithSnapshot(kDoc, snapshot_dir);
+  ExpectSameNodes(formats::yaml::FromString(kDoc), parsed);
+
+  const auto cached = impl::FromStringWithSnapshot(kDoc, snapshot_dir);
+  ExpectSameNodes(parsed, cached);
+
+  const std::string other_doc = "other: doc";
+  EXPECT_EQ(impl::FromStringWithSnapshot(other_doc, snapshot_dir)["other"]
+                .As<std::string>(),
+            "doc");
+
+  UEXPECT_THROW(impl::FromStringWithSnapshot("{", snapshot_dir),
+                formats::yaml::ParseException);
+}
+
+USERVER_NAMESPACE_END
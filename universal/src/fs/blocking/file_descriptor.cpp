@@ -1,5 +1,7 @@
 #include <userver/fs/blocking/file_descriptor.hpp>
 
+#include <fs/blocking/open_flags.hpp>
+
 #include <fcntl.h>
 
 #include <sys/stat.h>
@@ -18,7 +20,7 @@ USERVER_NAMESPACE_BEGIN
 
 namespace fs::blocking {
 
-namespace {
+namespace impl {
 
 int ToNative(OpenMode flags) {
   int result = 0;
@@ -66,6 +68,10 @@ int ToNative(OpenMode flags) {
   return result;
 }
 
+}  // namespace impl
+
+namespace {
+
 auto GetFileStats(int fd) {
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
   struct ::stat result;
@@ -83,7 +89,7 @@ FileDescriptor FileDescriptor::Open(const std::string& path, OpenMode flags,
                                     boost::filesystem::perms perms) {
   UASSERT(!path.empty());
   const auto fd = utils::CheckSyscall(
-      ::open(path.c_str(), ToNative(flags), perms), "opening file '{}'", path);
+      ::open(path.c_str(), impl::ToNative(flags), perms), "opening file '{}'", path);
   return FileDescriptor{fd};
 }
 
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <userver/fs/blocking/open_mode.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace fs::blocking::impl {
+
+// Returns the flags of ::open for the mode, O_CLOEXEC included
+int ToNative(OpenMode flags);
+
+}  // namespace fs::blocking::impl
+
+USERVER_NAMESPACE_END
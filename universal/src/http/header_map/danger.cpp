@@ -49,7 +49,7 @@ std::size_t Danger::SafeHash(std::string_view key) const noexcept {
 }
 
 std::size_t Danger::UnsafeHash(std::string_view key) noexcept {
-  return http::headers::impl::UnsafeConstexprHasher{}(key);
+  return http::headers::impl::UnsafeConstexprHasher{}.HashRuntime(key);
 }
 
 }  // namespace http::headers::header_map
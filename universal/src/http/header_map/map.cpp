@@ -291,9 +291,6 @@ void Map::ReserveOne() {
       const auto new_raw_capacity = kOnStackPositionsCount;
       mask_ = new_raw_capacity - 1;
       positions_.assign(new_raw_capacity, Pos::None());
-      // Wild guess, but we definitely don't want to reserve too much here,
-      // because HeaderMap with just a few headers is a pretty common scenario.
-      entries_.reserve(kOnStackPositionsCount / 2);
     } else {
       const auto raw_capacity = positions_.size();
       Grow(raw_capacity * 2);
@@ -326,7 +323,7 @@ void Map::Rebuild() {
 
   positions_.assign(positions_.size(), Pos::None());
 
-  std::vector<MapEntry> entries;
+  decltype(entries_) entries;
   std::swap(entries_, entries);
   entries_.reserve(entries.size());
 
@@ -385,28 +382,28 @@ Traits::HeaderIndex Map::InsertEntry(std::string&& key, std::string&& value) {
 Map::ConstIterator Map::Find(std::string_view key) const noexcept {
   const auto pos = DoFind(key, HashKey(key), 0);
 
-  return pos.IsSome() ? ToReverseIterator(entries_.cbegin() + pos.entries_index)
+  return pos.IsSome() ? ToReverseIterator(entries_.data() + pos.entries_index)
                       : End();
 }
 
 Map::Iterator Map::Find(std::string_view key) noexcept {
   const auto pos = DoFind(key, HashKey(key), 0);
 
-  return pos.IsSome() ? ToReverseIterator(entries_.begin() + pos.entries_index)
+  return pos.IsSome() ? ToReverseIterator(entries_.data() + pos.entries_index)
                       : End();
 }
 
 Map::ConstIterator Map::Find(const PredefinedHeader& header) const noexcept {
   const auto pos = DoFind(header.name, HashKey(header), header.header_index);
 
-  return pos.IsSome() ? ToReverseIterator(entries_.cbegin() + pos.entries_index)
+  return pos.IsSome() ? ToReverseIterator(entries_.data() + pos.entries_index)
                       : End();
 }
 
 Map::Iterator Map::Find(const PredefinedHeader& header) noexcept {
   const auto pos = DoFind(header.name, HashKey(header), header.header_index);
 
-  return pos.IsSome() ? ToReverseIterator(entries_.begin() + pos.entries_index)
+  return pos.IsSome() ? ToReverseIterator(entries_.data() + pos.entries_index)
                       : End();
 }
 
@@ -563,7 +560,7 @@ Map::Iterator Map::DoInsertOrModify(
   const auto resulting_positions_idx =
       ProbeLoop(DesiredPos(mask_, hash), inserter);
   return ToReverseIterator(
-      entries_.begin() + positions_[resulting_positions_idx].GetEntriesIndex());
+      entries_.data() + positions_[resulting_positions_idx].GetEntriesIndex());
 }
 
 Map::Iterator Map::Erase(std::string_view key) {
@@ -636,7 +633,7 @@ Map::Iterator Map::DoErase(std::string_view key, Traits::HashValue hash) {
   // our "begin" is reversed, so if we deleted the last element from the
   // entries vector, we return "Begin", which is actually a rbegin.
   return entries_index < entries_.size()
-             ? ToReverseIterator(entries_.begin() + entries_index)
+             ? ToReverseIterator(entries_.data() + entries_index)
              : Begin();
 }
 
@@ -667,11 +664,17 @@ std::size_t Map::DoRobinhoodAtPosition(std::size_t idx, Pos old_pos) {
   return num_displaced;
 }
 
-Map::Iterator Map::Begin() noexcept { return entries_.rbegin(); }
-Map::ConstIterator Map::Begin() const noexcept { return entries_.crbegin(); }
+Map::Iterator Map::Begin() noexcept {
+  return Iterator{entries_.data() + entries_.size()};
+}
+Map::ConstIterator Map::Begin() const noexcept {
+  return ConstIterator{entries_.data() + entries_.size()};
+}
 
-Map::Iterator Map::End() noexcept { return entries_.rend(); }
-Map::ConstIterator Map::End() const noexcept { return entries_.crend(); }
+Map::Iterator Map::End() noexcept { return Iterator{entries_.data()}; }
+Map::ConstIterator Map::End() const noexcept {
+  return ConstIterator{entries_.data()};
+}
 
 bool Map::operator==(const Map& other) const noexcept {
   if (Size() != other.Size()) {
@@ -723,15 +726,13 @@ void Map::OutputInHttpFormat(HeadersString& buffer) const {
   UASSERT(buffer.size() == old_buffer_size + amount_to_add);
 }
 
-inline Map::Iterator Map::ToReverseIterator(
-    std::vector<MapEntry>::iterator it) {
+inline Map::Iterator Map::ToReverseIterator(MapEntry* it) {
   static_assert(!std::is_same_v<Iterator, decltype(it)>);
 
   return Iterator{++it /* ++ because reversed */};
 }
 
-Map::ConstIterator Map::ToReverseIterator(
-    std::vector<MapEntry>::const_iterator it) {
+Map::ConstIterator Map::ToReverseIterator(const MapEntry* it) {
   static_assert(!std::is_same_v<ConstIterator, decltype(it)>);
 
   return ConstIterator{++it /* ++ because reversed */};
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <vector>
+#include <iterator>
 
 #include <boost/container/small_vector.hpp>
 
@@ -58,8 +58,8 @@ class MaybeOwnedKey final {
 
 class Map final {
  public:
-  using Iterator = std::vector<MapEntry>::reverse_iterator;
-  using ConstIterator = std::vector<MapEntry>::const_reverse_iterator;
+  using Iterator = std::reverse_iterator<MapEntry*>;
+  using ConstIterator = std::reverse_iterator<const MapEntry*>;
 
   Map();
 
@@ -134,9 +134,8 @@ class Map final {
                             InsertOrModifyOccupiedAction occupied_action);
   Iterator DoErase(std::string_view key, Traits::HashValue hash);
 
-  static Iterator ToReverseIterator(std::vector<MapEntry>::iterator it);
-  static ConstIterator ToReverseIterator(
-      std::vector<MapEntry>::const_iterator it);
+  static Iterator ToReverseIterator(MapEntry* it);
+  static ConstIterator ToReverseIterator(const MapEntry* it);
 
   static bool AreValuesICaseEqual(std::string_view lhs,
                                   std::string_view rhs) noexcept;
@@ -149,10 +148,13 @@ class Map final {
   }
 
   static constexpr std::size_t kOnStackPositionsCount = 32;
+  // Typical requests and responses have fewer headers, so the map does not
+  // allocate for them
+  static constexpr std::size_t kOnStackEntriesCount = 16;
 
   Traits::Size mask_{0};
   boost::container::small_vector<Pos, kOnStackPositionsCount> positions_;
-  std::vector<MapEntry> entries_;
+  boost::container::small_vector<MapEntry, kOnStackEntriesCount> entries_;
   Danger danger_;
 };
 
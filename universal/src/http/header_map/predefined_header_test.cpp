@@ -27,6 +27,17 @@ TEST(HeaderMapHasher, SameAtCompileTimeAndRuntime) {
   const auto runtime_hash = impl::UnsafeConstexprHasher{}(header_name);
 
   EXPECT_EQ(compile_time_hash, runtime_hash);
+  EXPECT_EQ(compile_time_hash, danger.HashKey(header_name));
+}
+
+TEST(HeaderMapHasher, SameWordAndByteLoads) {
+  const impl::UnsafeConstexprHasher hasher{};
+  const std::string_view data = "X-Some-Very-Long-Header-Name-For-Hashing";
+
+  for (std::size_t size = 0; size <= data.size(); ++size) {
+    const auto name = data.substr(0, size);
+    EXPECT_EQ(hasher(name), hasher.HashRuntime(name)) << name;
+  }
 }
 
 TEST(PredefinedHeader, IsFormattable) {
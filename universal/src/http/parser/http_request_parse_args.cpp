@@ -27,8 +27,18 @@ std::string UrlDecode(std::string_view url) {
   }
 
   std::string res;
+  // The decoded string is never longer than the input
+  res.reserve(url.size());
   for (const char* ptr = data; ptr < data_end; ++ptr) {
-    if (*ptr == '%') {
+    if (*ptr != '%' && *ptr != '+') {
+      // Copy the run of the plain chars at once
+      const char* run_end = ptr + 1;
+      while (run_end < data_end && *run_end != '%' && *run_end != '+') {
+        ++run_end;
+      }
+      res.append(ptr, run_end);
+      ptr = run_end - 1;
+    } else if (*ptr == '%') {
       if (ptr + 2 < data_end &&
           utils::encoding::FromHex({ptr + 1, 2}, res) == 2) {
         ptr += 2;
@@ -47,10 +57,8 @@ std::string UrlDecode(std::string_view url) {
                                  "\' in input '" + std::move(data_short) +
                                  '\'');
       }
-    } else if (*ptr == '+') {
-      res += ' ';
     } else {
-      res += *ptr;
+      res += ' ';
     }
   }
   return res;
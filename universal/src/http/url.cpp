@@ -1,6 +1,11 @@
 #include <userver/http/url.hpp>
 
 #include <array>
+#include <cstring>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 #include <utils/impl/internal_tag.hpp>
 
@@ -12,36 +17,58 @@ namespace {
 
 const std::string_view kSchemaSeparator = "://";
 
+constexpr std::array<bool, 256> MakeUnescapedTable() {
+  std::array<bool, 256> table{};
+  for (int c = '0'; c <= '9'; ++c) table[c] = true;
+  for (int c = 'a'; c <= 'z'; ++c) table[c] = true;
+  for (int c = 'A'; c <= 'Z'; ++c) table[c] = true;
+  for (const char c : std::string_view{"-_.!~*()'"}) {
+    table[static_cast<unsigned char>(c)] = true;
+  }
+  return table;
+}
+
+constexpr auto kUnescaped = MakeUnescapedTable();
+constexpr std::string_view kUpperXdigits = "0123456789ABCDEF";
+
 void UrlEncodeTo(std::string_view input_string, std::string& result) {
-  for (char symbol : input_string) {
-    if (isalnum(symbol)) {
-      result.append(1, symbol);
-      continue;
-    }
-    switch (symbol) {
-      case '-':
-      case '_':
-      case '.':
-      case '!':
-      case '~':
-      case '*':
-      case '(':
-      case ')':
-      case '\'':
-        result.append(1, symbol);
-        break;
-      default:
-        std::array<char, 3> bytes = {'%', 0, 0};
-        bytes[1] = (symbol & 0xF0) / 16;
-        bytes[1] += (bytes[1] > 9) ? 'A' - 10 : '0';
-        bytes[2] = symbol & 0x0F;
-        bytes[2] += (bytes[2] > 9) ? 'A' - 10 : '0';
-        result.append(bytes.data(), bytes.size());
-        break;
+  const char* first = input_string.data();
+  const char* const last = first + input_string.size();
+  while (first != last) {
+    // The runs of the chars that are kept as is are appended at once
+    const char* run_end = first;
+    while (run_end != last &&
+           kUnescaped[static_cast<unsigned char>(*run_end)]) {
+      ++run_end;
     }
+    result.append(first, run_end);
+    if (run_end == last) break;
+
+    const auto symbol = static_cast<unsigned char>(*run_end);
+    const std::array<char, 3> bytes = {'%', kUpperXdigits[symbol >> 4],
+                                       kUpperXdigits[symbol & 0x0F]};
+    result.append(bytes.data(), bytes.size());
+    first = run_end + 1;
   }
 }
 
+// Returns the first '%' or '+' in the range, or `last`
+const char* FindEscaped(const char* first, const char* last) {
+#ifdef __SSE2__
+  const auto percents = _mm_set1_epi8('%');
+  const auto pluses = _mm_set1_epi8('+');
+  while (last - first >= 16) {
+    const auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+    const auto mask = _mm_movemask_epi8(_mm_or_si128(
+        _mm_cmpeq_epi8(chars, percents), _mm_cmpeq_epi8(chars, pluses)));
+    if (mask != 0) return first + __builtin_ctz(mask);
+    first += 16;
+  }
+#endif
+  while (first != last && *first != '%' && *first != '+') ++first;
+  return first;
+}
+
 }  // namespace
 
 std::string UrlEncode(std::string_view input_string) {
@@ -201,31 +228,36 @@ namespace impl {
 
 std::string UrlDecode(utils::impl::InternalTag, std::string_view range) {
   std::string result;
-  result.reserve(range.size() / 3);
-
-  for (const char *i = range.begin(), *end = range.end(); i != end; ++i) {
-    switch (*i) {
-      case '+':
-        result.append(1, ' ');
-        break;
-      case '%':
-        if (std::distance(i, end) > 2) {
-          char f = *(i + 1);
-          char s = *(i + 2);
-          int digit = (f >= 'A' ? ((f & 0xDF) - 'A') + 10 : (f - '0')) * 16;
-          digit += (s >= 'A') ? ((s & 0xDF) - 'A') + 10 : (s - '0');
-          result.append(1, static_cast<char>(digit));
-          i += 2;
-        } else {
-          result.append(1, '%');
-        }
-        break;
-      default:
-        result.append(1, (*i));
-        break;
+  result.resize(range.size());
+  char* dst = result.data();
+
+  const char* i = range.data();
+  const char* const end = i + range.size();
+  while (i != end) {
+    // The runs of the chars that are kept as is are copied at once
+    const char* const escaped = FindEscaped(i, end);
+    std::memcpy(dst, i, escaped - i);
+    dst += escaped - i;
+    i = escaped;
+    if (i == end) break;
+
+    if (*i == '+') {
+      *dst++ = ' ';
+      ++i;
+    } else if (std::distance(i, end) > 2) {
+      char f = *(i + 1);
+      char s = *(i + 2);
+      int digit = (f >= 'A' ? ((f & 0xDF) - 'A') + 10 : (f - '0')) * 16;
+      digit += (s >= 'A') ? ((s & 0xDF) - 'A') + 10 : (s - '0');
+      *dst++ = static_cast<char>(digit);
+      i += 3;
+    } else {
+      *dst++ = '%';
+      ++i;
     }
   }
 
+  result.resize(dst - result.data());
   return result;
 }
 
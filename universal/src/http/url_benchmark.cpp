@@ -40,4 +40,27 @@ void make_query(benchmark::State& state) {
 }
 BENCHMARK(make_query)->RangeMultiplier(2)->Range(1, 256);
 
+void url_encode(benchmark::State& state) {
+  // A typical query argument, mostly unescaped with a few escapes
+  std::string source;
+  while (source.size() < static_cast<std::size_t>(state.range(0))) {
+    source += "some_value-123 /";
+  }
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(http::UrlEncode(source));
+  }
+}
+BENCHMARK(url_encode)->RangeMultiplier(4)->Range(16, 4096);
+
+void url_decode(benchmark::State& state) {
+  std::string source;
+  while (source.size() < static_cast<std::size_t>(state.range(0))) {
+    source += "some_value-123+%2F";
+  }
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(http::UrlDecode(source));
+  }
+}
+BENCHMARK(url_decode)->RangeMultiplier(4)->Range(16, 4096);
+
 USERVER_NAMESPACE_END
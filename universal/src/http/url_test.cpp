@@ -57,6 +57,25 @@ TEST(UrlDecode, Invalid) {
   EXPECT_EQ("Q11", UrlDecode(str));
 }
 
+TEST(UrlDecode, Long) {
+  // The escapes fall at the different positions of the 16-byte blocks
+  std::string decoded;
+  std::string str;
+  for (int i = 0; i < 100; ++i) {
+    decoded += std::string(i % 19, 'a') + " /+";
+    str += std::string(i % 19, 'a') + "+%2F%2b";
+  }
+  EXPECT_EQ(decoded, UrlDecode(str));
+  EXPECT_EQ(decoded + "%", UrlDecode(str + "%"));
+}
+
+TEST(UrlEncode, RoundTrip) {
+  std::string str;
+  for (int i = 0; i < 256; ++i) str += static_cast<char>(i);
+  str += str;
+  EXPECT_EQ(str, UrlDecode(UrlEncode(str)));
+}
+
 TEST(MakeUrl, InitializerList) {
   EXPECT_EQ("path?a=b&c=d", http::MakeUrl("path", {{"a", "b"}, {"c", "d"}}));
 }
@@ -0,0 +1,112 @@
+#include <logging/binary_record.hpp>
+
+#include <cstring>
+#include <stdexcept>
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include <logging/timestamp.hpp>
+#include <userver/utils/encoding/tskv.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl::binary {
+
+namespace {
+
+class Reader final {
+ public:
+  explicit Reader(std::string_view data) noexcept : data_(data) {}
+
+  bool IsEmpty() const noexcept { return data_.empty(); }
+
+  template <typename T>
+  T Read() {
+    T value{};
+    std::memcpy(&value, ReadBytes(sizeof(T)).data(), sizeof(T));
+    return value;
+  }
+
+  std::string_view ReadBytes(std::size_t size) {
+    if (data_.size() < size) {
+      throw std::runtime_error("Truncated binary log record");
+    }
+    const auto result = data_.substr(0, size);
+    data_.remove_prefix(size);
+    return result;
+  }
+
+ private:
+  std::string_view data_;
+};
+
+void AppendKey(std::string& out, std::string_view key) {
+  out.push_back(utils::encoding::kTskvPairsSeparator);
+  if (utils::encoding::ShouldKeyBeEscaped(key)) {
+    utils::encoding::EncodeTskv(
+        out, key, utils::encoding::EncodeTskvMode::kKeyReplacePeriod);
+  } else {
+    out.append(key);
+  }
+  out.push_back(utils::encoding::kTskvKeyValueSeparator);
+}
+
+}  // namespace
+
+std::size_t AppendAsTskv(std::string_view data, std::string& out) {
+  Reader size_reader{data};
+  const auto size = size_reader.Read<std::uint32_t>();
+  Reader reader{size_reader.ReadBytes(size)};
+
+  if (reader.Read<std::uint8_t>() != kVersion) {
+    throw std::runtime_error("Unknown binary log record version");
+  }
+  const auto level = static_cast<Level>(reader.Read<std::uint8_t>());
+  const TimePoint time{std::chrono::microseconds{reader.Read<std::int64_t>()}};
+
+  auto appender = std::back_inserter(out);
+  fmt::format_to(appender, FMT_COMPILE("tskv\ttimestamp={}.{:06}\tlevel={}"),
+                 GetTimeString(time).ToStringView(),
+                 GetFractionalMicroseconds(time), ToUpperCaseString(level));
+
+  while (!reader.IsEmpty()) {
+    switch (static_cast<ItemType>(reader.Read<std::uint8_t>())) {
+      case ItemType::kKey:
+        AppendKey(out, reader.ReadBytes(reader.Read<std::uint16_t>()));
+        break;
+      case ItemType::kString:
+        utils::encoding::EncodeTskv(
+            out, reader.ReadBytes(reader.Read<std::uint32_t>()),
+            utils::encoding::EncodeTskvMode::kValue);
+        break;
+      case ItemType::kSigned:
+        fmt::format_to(appender, FMT_COMPILE("{}"),
+                       reader.Read<std::int64_t>());
+        break;
+      case ItemType::kUnsigned:
+        fmt::format_to(appender, FMT_COMPILE("{}"),
+                       reader.Read<std::uint64_t>());
+        break;
+      case ItemType::kFloat:
+        fmt::format_to(appender, FMT_COMPILE("{}"), reader.Read<float>());
+        break;
+      case ItemType::kDouble:
+        fmt::format_to(appender, FMT_COMPILE("{}"), reader.Read<double>());
+        break;
+      case ItemType::kBoolean:
+        fmt::format_to(appender, FMT_COMPILE("{}"),
+                       reader.Read<std::uint8_t>() != 0);
+        break;
+      default:
+        throw std::runtime_error("Unknown item type in binary log record");
+    }
+  }
+
+  out.push_back('\n');
+  return kSizePrefixSize + size;
+}
+
+}  // namespace logging::impl::binary
+
+USERVER_NAMESPACE_END
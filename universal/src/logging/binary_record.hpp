@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include <userver/logging/level.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// Records of logging::Format::kBinary.
+///
+/// A record is a header followed by a sequence of items, all integers are in
+/// the native byte order:
+///
+///   u32 size of the rest of the record
+///   u8  kVersion
+///   u8  logging::Level
+///   i64 microseconds since the UNIX epoch
+///   items...
+///
+/// Each item starts with an u8 ItemType. kKey is followed by an u16 length
+/// and the unescaped key, it starts a new tag. kString is followed by an u32
+/// length and the raw bytes. Numbers and booleans are stored as is. A tag
+/// value is the concatenation of all the items after its key.
+namespace logging::impl::binary {
+
+inline constexpr std::uint8_t kVersion = 1;
+
+enum class ItemType : std::uint8_t {
+  kKey = 1,
+  kString = 2,
+  kSigned = 3,
+  kUnsigned = 4,
+  kFloat = 5,
+  kDouble = 6,
+  kBoolean = 7,
+};
+
+inline constexpr std::size_t kSizePrefixSize = sizeof(std::uint32_t);
+inline constexpr std::size_t kHeaderSize =
+    kSizePrefixSize + 2 * sizeof(std::uint8_t) + sizeof(std::int64_t);
+
+/// @brief Renders the record at the beginning of `data` as a TSKV line,
+/// the same as logging::Format::kTskv would produce, and appends it to `out`.
+/// @returns the size of the consumed record, for reading records one by one
+/// from a file
+/// @throws std::runtime_error if the record is truncated or malformed
+std::size_t AppendAsTskv(std::string_view data, std::string& out);
+
+}  // namespace logging::impl::binary
+
+USERVER_NAMESPACE_END
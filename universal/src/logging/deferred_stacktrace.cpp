@@ -0,0 +1,101 @@
+#include <logging/deferred_stacktrace.hpp>
+
+#include <charconv>
+#include <cstdint>
+
+#include <boost/stacktrace.hpp>
+
+#include <userver/utils/encoding/json_string.hpp>
+#include <userver/utils/encoding/tskv.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::stacktrace_cache::impl {
+
+namespace {
+
+constexpr std::string_view kDeferredBegin = "<userver-stacktrace:";
+constexpr char kDeferredEnd = '>';
+
+std::vector<boost::stacktrace::frame> ParseFrames(std::string_view addresses) {
+  std::vector<boost::stacktrace::frame> frames;
+  const auto* position = addresses.data();
+  const auto* const end = addresses.data() + addresses.size();
+  while (position < end) {
+    std::uintptr_t address = 0;
+    const auto [next, ec] = std::from_chars(position, end, address, 16);
+    if (ec != std::errc{}) break;
+
+    frames.emplace_back(
+        reinterpret_cast<boost::stacktrace::frame::native_frame_ptr_t>(
+            address));
+    position = next + 1;  // skip the space
+  }
+  return frames;
+}
+
+}  // namespace
+
+std::string MakeDeferredStacktrace(const boost::stacktrace::stacktrace& st) {
+  if (!IsStacktraceEnabled()) {
+    return "<unknown>";
+  }
+
+  std::string result;
+  result.reserve(kDeferredBegin.size() + 17 * st.size() + 1);
+  result += kDeferredBegin;
+  for (const auto& frame : st) {
+    if (result.size() != kDeferredBegin.size()) result += ' ';
+
+    char buffer[2 * sizeof(std::uintptr_t)];
+    const auto [end, ec] = std::to_chars(
+        std::begin(buffer), std::end(buffer),
+        reinterpret_cast<std::uintptr_t>(frame.address()), 16);
+    result.append(std::begin(buffer), end);
+  }
+  result += kDeferredEnd;
+  return result;
+}
+
+bool IsDeferredStacktrace(std::string_view value) noexcept {
+  return value.size() > kDeferredBegin.size() &&
+         value.substr(0, kDeferredBegin.size()) == kDeferredBegin &&
+         value.back() == kDeferredEnd;
+}
+
+std::string SymbolizeDeferredStacktrace(std::string_view value) {
+  value.remove_prefix(kDeferredBegin.size());
+  value.remove_suffix(1);
+  return FramesToString(ParseFrames(value));
+}
+
+bool SymbolizeDeferredStacktraces(std::string_view record, Format format,
+                                  std::string& out) {
+  auto begin = record.find(kDeferredBegin);
+  if (begin == std::string_view::npos) return false;
+
+  out.clear();
+  while (begin != std::string_view::npos) {
+    const auto end = record.find(kDeferredEnd, begin);
+    if (end == std::string_view::npos) break;
+
+    out.append(record.substr(0, begin));
+    const auto symbolized =
+        SymbolizeDeferredStacktrace(record.substr(begin, end + 1 - begin));
+    if (format == Format::kJson) {
+      utils::encoding::EncodeJsonString(out, symbolized);
+    } else {
+      utils::encoding::EncodeTskv(out, symbolized,
+                                  utils::encoding::EncodeTskvMode::kValue);
+    }
+
+    record.remove_prefix(end + 1);
+    begin = record.find(kDeferredBegin);
+  }
+  out.append(record);
+  return true;
+}
+
+}  // namespace logging::stacktrace_cache::impl
+
+USERVER_NAMESPACE_END
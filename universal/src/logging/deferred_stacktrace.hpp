@@ -0,0 +1,45 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <boost/stacktrace/stacktrace_fwd.hpp>
+
+#include <userver/logging/format.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// Stacktraces that are captured as raw frame addresses on the logging
+/// coroutine and are symbolized later, by the logger task or when the record
+/// is rendered for a logger that cannot do that.
+///
+/// A deferred stacktrace is a LogExtra string value of the form
+/// `<userver-stacktrace:hex-address hex-address ...>`, it needs no escaping
+/// in any logging::Format.
+namespace logging::stacktrace_cache::impl {
+
+/// Formats the frames the same way as stacktrace_cache::to_string does
+std::string FramesToString(const std::vector<boost::stacktrace::frame>& frames);
+
+bool IsStacktraceEnabled() noexcept;
+
+/// Returns a deferred stacktrace, or `<unknown>` if stacktraces are disabled
+std::string MakeDeferredStacktrace(const boost::stacktrace::stacktrace& st);
+
+bool IsDeferredStacktrace(std::string_view value) noexcept;
+
+/// Returns the symbolized stacktrace for a deferred one
+std::string SymbolizeDeferredStacktrace(std::string_view value);
+
+/// Replaces the deferred stacktraces in a rendered record of `format` with
+/// the escaped symbolized ones. kBinary records should be rendered as TSKV
+/// beforehand.
+/// @returns `false` and leaves `out` untouched if there were no deferred
+/// stacktraces in the record
+bool SymbolizeDeferredStacktraces(std::string_view record, Format format,
+                                  std::string& out);
+
+}  // namespace logging::stacktrace_cache::impl
+
+USERVER_NAMESPACE_END
@@ -2,6 +2,8 @@
 
 #include <userver/logging/impl/tag_writer.hpp>
 
+#include <logging/log_sampler.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
@@ -34,6 +36,16 @@ bool LoggerBase::ShouldFlush(Level level) const {
 
 void LoggerBase::ForwardTo(LoggerBase*) {}
 
+bool LoggerBase::SymbolizesDeferredStacktraces() const noexcept {
+  return false;
+}
+
+void LoggerBase::SetSamplingBudget(std::size_t records_per_second) {
+  sampler_ = std::make_unique<LogSampler>(records_per_second);
+}
+
+LogSampler* LoggerBase::GetSampler() const noexcept { return sampler_.get(); }
+
 bool LoggerBase::DoShouldLog(Level /*level*/) const noexcept { return true; }
 
 bool ShouldLogNoSpan(const LoggerBase& logger, Level level) noexcept {
@@ -3,6 +3,7 @@
 #include <utility>
 
 #include <logging/dynamic_debug.hpp>
+#include <logging/log_sampler.hpp>
 #include <logging/rate_limit.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/null_logger.hpp>
@@ -112,7 +113,7 @@ RateLimiter::RateLimiter(RateLimitData& data, Level level) noexcept
     }
 
     const auto reset_interval = impl::GetLogLimitedInterval();
-    const auto now = std::chrono::steady_clock::now();
+    const auto now = utils::datetime::SteadyCoarseClock::now();
 
     if (now - data.last_reset_time >= reset_interval) {
       data.count_since_reset = 0;
@@ -155,7 +156,11 @@ bool StaticLogEntry::ShouldNotLog(logging::LoggerRef logger,
   const bool force_disabled = level < state.force_disabled_level_plus_one;
   const bool force_enabled =
       level >= state.force_enabled_level && level != logging::Level::kNone;
-  return (!LoggerShouldLog(logger, level) || force_disabled) && !force_enabled;
+  if (force_enabled) return false;
+  if (!LoggerShouldLog(logger, level) || force_disabled) return true;
+
+  auto* const sampler = logger.GetSampler();
+  return sampler && sampler->ShouldDrop(logger, content, level);
 }
 
 bool StaticLogEntry::ShouldNotLog(const logging::LoggerPtr& logger,
@@ -4,9 +4,9 @@
 
 #include <boost/stacktrace.hpp>
 
+#include <logging/deferred_stacktrace.hpp>
 #include <userver/logging/level.hpp>
 #include <userver/logging/log.hpp>
-#include <userver/logging/stacktrace_cache.hpp>
 #include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -22,13 +22,16 @@ void ExtendLogExtraWithStacktrace(
     LogExtra& log_extra, const boost::stacktrace::stacktrace& trace,
     utils::Flags<LogExtraStacktraceFlags> flags) noexcept {
   try {
-    log_extra.Extend(kTraceKey,
-                     (flags & LogExtraStacktraceFlags::kNoCache)
-                         ? boost::stacktrace::to_string(trace)
-                         : stacktrace_cache::to_string(trace),
-                     (flags & LogExtraStacktraceFlags::kFrozen)
-                         ? LogExtra::ExtendType::kFrozen
-                         : LogExtra::ExtendType::kNormal);
+    // The cached stacktraces are symbolized by the logger, see
+    // LoggerBase::SymbolizesDeferredStacktraces
+    log_extra.Extend(
+        kTraceKey,
+        (flags & LogExtraStacktraceFlags::kNoCache)
+            ? boost::stacktrace::to_string(trace)
+            : stacktrace_cache::impl::MakeDeferredStacktrace(trace),
+        (flags & LogExtraStacktraceFlags::kFrozen)
+            ? LogExtra::ExtendType::kFrozen
+            : LogExtra::ExtendType::kNormal);
   } catch (const std::exception& e) {
     UASSERT_MSG(false, e.what());
   }
@@ -8,6 +8,7 @@
 #include <fmt/compile.h>
 #include <boost/exception/diagnostic_information.hpp>
 
+#include <logging/deferred_stacktrace.hpp>
 #include <logging/log_extra_stacktrace.hpp>
 #include <logging/log_helper_impl.hpp>
 #include <userver/compiler/demangle.hpp>
@@ -324,34 +325,38 @@ LogHelper& LogHelper::operator<<(LogExtra&& extra) noexcept {
 }
 
 LogHelper& LogHelper::operator<<(const LogExtra::Value& value) noexcept {
+  const auto* string = std::get_if<std::string>(&value);
+  if (string && stacktrace_cache::impl::IsDeferredStacktrace(*string)) {
+    try {
+      if (pimpl_->ShouldDeferStacktraces()) {
+        PutRaw(*string);
+      } else {
+        Put(stacktrace_cache::impl::SymbolizeDeferredStacktrace(*string));
+      }
+    } catch (...) {
+      InternalLoggingError("Failed to log a stacktrace");
+    }
+    return *this;
+  }
+
   std::visit([this](const auto& unwrapped) { *this << unwrapped; }, value);
   return *this;
 }
 
 void LogHelper::PutFloatingPoint(float value) {
-  fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()),
-                 FMT_COMPILE("{}"), value);
+  pimpl_->PutFloatingPoint(value);
 }
 void LogHelper::PutFloatingPoint(double value) {
-  fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()),
-                 FMT_COMPILE("{}"), value);
+  pimpl_->PutFloatingPoint(value);
 }
 void LogHelper::PutFloatingPoint(long double value) {
-  fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()),
-                 FMT_COMPILE("{}"), value);
+  pimpl_->PutFloatingPoint(value);
 }
 void LogHelper::PutUnsigned(unsigned long long value) {
-  fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()),
-                 FMT_COMPILE("{}"), value);
-}
-void LogHelper::PutSigned(long long value) {
-  fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()),
-                 FMT_COMPILE("{}"), value);
-}
-void LogHelper::PutBoolean(bool value) {
-  fmt::format_to(fmt::appender(pimpl_->GetBufferForRawValuePart()),
-                 FMT_COMPILE("{}"), value);
+  pimpl_->PutUnsigned(value);
 }
+void LogHelper::PutSigned(long long value) { pimpl_->PutSigned(value); }
+void LogHelper::PutBoolean(bool value) { pimpl_->PutBoolean(value); }
 
 LogHelper& LogHelper::operator<<(Hex hex) noexcept {
   try {
@@ -1,15 +1,17 @@
 #include "log_helper_impl.hpp"
 
 #include <array>
+#include <cstring>
+#include <limits>
 
-#include <fmt/chrono.h>
 #include <fmt/compile.h>
 #include <fmt/format.h>
 
+#include <logging/timestamp.hpp>
 #include <userver/compiler/impl/constexpr.hpp>
-#include <userver/compiler/thread_local.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/encoding/json_string.hpp>
 #include <userver/utils/encoding/tskv.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -25,50 +27,19 @@ char GetSeparatorFromLogger(LoggerRef logger) {
       return '=';
     case Format::kLtsv:
       return ':';
+    case Format::kJson:
+    case Format::kBinary:
+      return '\0';
   }
 
   UINVARIANT(false, "Invalid logging::Format enum value");
 }
 
-using TimePoint = std::chrono::system_clock::time_point;
-
-auto FractionalMicroseconds(TimePoint time) noexcept {
-  return std::chrono::time_point_cast<std::chrono::microseconds>(time)
-             .time_since_epoch()
-             .count() %
-         1'000'000;
-}
-
-using SecondsTimePoint =
-    std::chrono::time_point<TimePoint::clock, std::chrono::seconds>;
-constexpr std::string_view kTimeTemplate = "0000-00-00T00:00:00";
-
-struct TimeString final {
-  char data[kTimeTemplate.size()]{};
-
-  std::string_view ToStringView() const noexcept {
-    return {data, std::size(data)};
-  }
-};
-
-struct CachedTime final {
-  SecondsTimePoint time{};
-  TimeString string{};
-};
-
-compiler::ThreadLocal local_cached_time = [] { return CachedTime{}; };
-
-TimeString GetCurrentTimeString(TimePoint now) noexcept {
-  auto cached_time = local_cached_time.Use();
-
-  const auto rounded_now =
-      std::chrono::time_point_cast<std::chrono::seconds>(now);
-  if (rounded_now != cached_time->time) {
-    fmt::format_to(cached_time->string.data, FMT_COMPILE("{:%FT%T}"),
-                   fmt::localtime(std::chrono::system_clock::to_time_t(now)));
-    cached_time->time = rounded_now;
-  }
-  return cached_time->string;
+template <typename T>
+void AppendBinary(LogBuffer& buffer, T value) {
+  const auto old_size = buffer.size();
+  buffer.resize(old_size + sizeof(T));
+  std::memcpy(buffer.data() + old_size, &value, sizeof(T));
 }
 
 }  // namespace
@@ -88,7 +59,9 @@ std::streamsize LogHelper::Impl::BufferStd::xsputn(const char_type* s,
 LogHelper::Impl::Impl(LoggerRef logger, Level level) noexcept
     : logger_(&logger),
       level_(std::max(level, logger_->GetLevel())),
-      key_value_separator_(GetSeparatorFromLogger(*logger_)) {
+      key_value_separator_(GetSeparatorFromLogger(*logger_)),
+      is_binary_(logger_->GetFormat() == Format::kBinary),
+      is_json_(logger_->GetFormat() == Format::kJson) {
   static_assert(sizeof(LogHelper::Impl) < 4096,
                 "Structures with size more than 4096 would consume at least "
                 "8KB memory in allocator.");
@@ -104,38 +77,71 @@ void LogHelper::Impl::PutMessageBegin() {
     case Format::kTskv: {
       constexpr std::string_view kTemplate =
           "tskv\ttimestamp=0000-00-00T00:00:00.000000\tlevel=";
-      const auto now = TimePoint::clock::now();
+      const auto now = impl::TimePoint::clock::now();
       const auto level_string = logging::ToUpperCaseString(level_);
       msg_.resize(kTemplate.size() + level_string.size());
       fmt::format_to(msg_.data(),
                      FMT_COMPILE("tskv\ttimestamp={}.{:06}\tlevel={}"),
-                     GetCurrentTimeString(now).ToStringView(),
-                     FractionalMicroseconds(now), level_string);
+                     impl::GetTimeString(now).ToStringView(),
+                     impl::GetFractionalMicroseconds(now), level_string);
       return;
     }
     case Format::kLtsv: {
       constexpr std::string_view kTemplate =
           "timestamp:0000-00-00T00:00:00.000000\tlevel:";
-      const auto now = TimePoint::clock::now();
+      const auto now = impl::TimePoint::clock::now();
       const auto level_string = logging::ToUpperCaseString(level_);
       msg_.resize(kTemplate.size() + level_string.size());
       fmt::format_to(msg_.data(), FMT_COMPILE("timestamp:{}.{:06}\tlevel:{}"),
-                     GetCurrentTimeString(now).ToStringView(),
-                     FractionalMicroseconds(now), level_string);
+                     impl::GetTimeString(now).ToStringView(),
+                     impl::GetFractionalMicroseconds(now), level_string);
       return;
     }
     case Format::kRaw: {
       msg_.append(std::string_view{"tskv"});
       return;
     }
+    case Format::kJson: {
+      constexpr std::string_view kTemplate =
+          R"({"timestamp":"0000-00-00T00:00:00.000000","level":"")";
+      const auto now = impl::TimePoint::clock::now();
+      const auto level_string = logging::ToUpperCaseString(level_);
+      msg_.resize(kTemplate.size() + level_string.size());
+      fmt::format_to(msg_.data(),
+                     FMT_COMPILE(R"({{"timestamp":"{}.{:06}","level":"{}")"),
+                     impl::GetTimeString(now).ToStringView(),
+                     impl::GetFractionalMicroseconds(now), level_string);
+      return;
+    }
+    case Format::kBinary: {
+      PutBinaryMessageBegin();
+      return;
+    }
   }
   UASSERT_MSG(false, "Invalid value of Format enum");
 }
 
-void LogHelper::Impl::PutMessageEnd() { msg_.push_back('\n'); }
+void LogHelper::Impl::PutMessageEnd() {
+  if (is_binary_) {
+    CloseBinaryStringPart();
+    const auto record_size = static_cast<std::uint32_t>(
+        msg_.size() - impl::binary::kSizePrefixSize);
+    std::memcpy(msg_.data(), &record_size, sizeof(record_size));
+    return;
+  }
+  if (is_json_) {
+    CloseJsonValue();
+    msg_.push_back('}');
+  }
+  msg_.push_back('\n');
+}
 
 void LogHelper::Impl::PutKey(std::string_view key) {
-  if (!utils::encoding::ShouldKeyBeEscaped(key)) {
+  if (is_binary_) {
+    PutBinaryKey(key);
+  } else if (is_json_) {
+    PutJsonKey(key);
+  } else if (!utils::encoding::ShouldKeyBeEscaped(key)) {
     PutRawKey(key);
   } else {
     UASSERT(!std::exchange(is_within_value_, true));
@@ -148,6 +154,14 @@ void LogHelper::Impl::PutKey(std::string_view key) {
 }
 
 void LogHelper::Impl::PutRawKey(std::string_view key) {
+  if (is_binary_) {
+    PutBinaryKey(key);
+    return;
+  }
+  if (is_json_) {
+    PutRawJsonKey(key);
+    return;
+  }
   UASSERT(!std::exchange(is_within_value_, true));
   CheckRepeatedKeys(key);
   const auto old_size = msg_.size();
@@ -162,27 +176,107 @@ void LogHelper::Impl::PutRawKey(std::string_view key) {
 
 void LogHelper::Impl::PutValuePart(std::string_view value) {
   UASSERT(is_within_value_);
+  if (is_binary_) {
+    // Escaping is deferred until the record is rendered
+    OpenBinaryStringPart();
+    msg_.append(value);
+    return;
+  }
+  if (is_json_) {
+    utils::encoding::EncodeJsonString(msg_, value);
+    return;
+  }
   utils::encoding::EncodeTskv(msg_, value,
                               utils::encoding::EncodeTskvMode::kValue);
 }
 
 void LogHelper::Impl::PutValuePart(char text_part) {
   UASSERT(is_within_value_);
+  if (is_binary_) {
+    OpenBinaryStringPart();
+    msg_.push_back(text_part);
+    return;
+  }
+  if (is_json_) {
+    utils::encoding::EncodeJsonString(fmt::appender(msg_), text_part);
+    return;
+  }
   utils::encoding::EncodeTskv(fmt::appender(msg_), text_part,
                               utils::encoding::EncodeTskvMode::kValue);
 }
 
-LogBuffer& LogHelper::Impl::GetBufferForRawValuePart() noexcept {
+LogBuffer& LogHelper::Impl::GetBufferForRawValuePart() {
   UASSERT(is_within_value_);
+  if (is_binary_) OpenBinaryStringPart();
   return msg_;
 }
 
+void LogHelper::Impl::PutSigned(long long value) {
+  if (is_binary_) {
+    PutBinaryItem(impl::binary::ItemType::kSigned, std::int64_t{value});
+    return;
+  }
+  fmt::format_to(fmt::appender(GetBufferForRawValuePart()), FMT_COMPILE("{}"),
+                 value);
+}
+
+void LogHelper::Impl::PutUnsigned(unsigned long long value) {
+  if (is_binary_) {
+    PutBinaryItem(impl::binary::ItemType::kUnsigned, std::uint64_t{value});
+    return;
+  }
+  fmt::format_to(fmt::appender(GetBufferForRawValuePart()), FMT_COMPILE("{}"),
+                 value);
+}
+
+void LogHelper::Impl::PutFloatingPoint(float value) {
+  if (is_binary_) {
+    PutBinaryItem(impl::binary::ItemType::kFloat, value);
+    return;
+  }
+  fmt::format_to(fmt::appender(GetBufferForRawValuePart()), FMT_COMPILE("{}"),
+                 value);
+}
+
+void LogHelper::Impl::PutFloatingPoint(double value) {
+  if (is_binary_) {
+    PutBinaryItem(impl::binary::ItemType::kDouble, value);
+    return;
+  }
+  fmt::format_to(fmt::appender(GetBufferForRawValuePart()), FMT_COMPILE("{}"),
+                 value);
+}
+
+void LogHelper::Impl::PutFloatingPoint(long double value) {
+  if (is_binary_) {
+    // The binary format has no extended precision
+    PutBinaryItem(impl::binary::ItemType::kDouble, static_cast<double>(value));
+    return;
+  }
+  fmt::format_to(fmt::appender(GetBufferForRawValuePart()), FMT_COMPILE("{}"),
+                 value);
+}
+
+void LogHelper::Impl::PutBoolean(bool value) {
+  if (is_binary_) {
+    PutBinaryItem(impl::binary::ItemType::kBoolean, std::uint8_t{value});
+    return;
+  }
+  fmt::format_to(fmt::appender(GetBufferForRawValuePart()), FMT_COMPILE("{}"),
+                 value);
+}
+
 void LogHelper::Impl::MarkValueEnd() noexcept {
   UASSERT(std::exchange(is_within_value_, false));
+  if (is_binary_) CloseBinaryStringPart();
 }
 
 void LogHelper::Impl::MarkAsTrace() noexcept { is_trace_ = true; }
 
+bool LogHelper::Impl::ShouldDeferStacktraces() const noexcept {
+  return logger_ && logger_->SymbolizesDeferredStacktraces();
+}
+
 void LogHelper::Impl::StartText() {
   PutRawKey("text");
   initial_length_ = msg_.size();
@@ -219,6 +313,88 @@ void LogHelper::Impl::CheckRepeatedKeys(
               fmt::format("Repeated tag in logs: '{}'", raw_key));
 }
 
+void LogHelper::Impl::PutJsonKey(std::string_view key) {
+  UASSERT(!std::exchange(is_within_value_, true));
+  CheckRepeatedKeys(key);
+  CloseJsonValue();
+  msg_.append(std::string_view{R"(,")"});
+  utils::encoding::EncodeJsonString(msg_, key);
+  msg_.append(std::string_view{R"(":")"});
+  is_json_value_open_ = true;
+}
+
+void LogHelper::Impl::PutRawJsonKey(std::string_view key) {
+  // TagKey only allows chars that need no escaping, see DoesTagNeedEscaping
+  constexpr std::string_view kKeyBegin = R"(,")";
+  constexpr std::string_view kKeyEnd = R"(":")";
+
+  UASSERT(!std::exchange(is_within_value_, true));
+  CheckRepeatedKeys(key);
+  CloseJsonValue();
+  const auto old_size = msg_.size();
+  msg_.resize(old_size + kKeyBegin.size() + key.size() + kKeyEnd.size());
+
+  auto* position = msg_.data() + old_size;
+  kKeyBegin.copy(position, kKeyBegin.size());
+  position += kKeyBegin.size();
+  key.copy(position, key.size());
+  position += key.size();
+  kKeyEnd.copy(position, kKeyEnd.size());
+  is_json_value_open_ = true;
+}
+
+void LogHelper::Impl::CloseJsonValue() {
+  // MarkValueEnd is noexcept, so the quote is put before the next key
+  if (std::exchange(is_json_value_open_, false)) msg_.push_back('"');
+}
+
+void LogHelper::Impl::PutBinaryMessageBegin() {
+  const auto now = std::chrono::system_clock::now();
+  const std::int64_t now_us =
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          now.time_since_epoch())
+          .count();
+
+  // The size is filled in PutMessageEnd
+  AppendBinary(msg_, std::uint32_t{0});
+  AppendBinary(msg_, impl::binary::kVersion);
+  AppendBinary(msg_, static_cast<std::uint8_t>(level_));
+  AppendBinary(msg_, now_us);
+  UASSERT(msg_.size() == impl::binary::kHeaderSize);
+}
+
+void LogHelper::Impl::PutBinaryKey(std::string_view key) {
+  UASSERT(!std::exchange(is_within_value_, true));
+  CheckRepeatedKeys(key);
+  UASSERT(key.size() <= std::numeric_limits<std::uint16_t>::max());
+  AppendBinary(msg_, impl::binary::ItemType::kKey);
+  AppendBinary(msg_, static_cast<std::uint16_t>(key.size()));
+  msg_.append(key);
+}
+
+void LogHelper::Impl::OpenBinaryStringPart() {
+  if (binary_string_part_begin_) return;
+  AppendBinary(msg_, impl::binary::ItemType::kString);
+  binary_string_part_begin_ = msg_.size();
+  AppendBinary(msg_, std::uint32_t{0});
+}
+
+void LogHelper::Impl::CloseBinaryStringPart() noexcept {
+  if (!binary_string_part_begin_) return;
+  const auto begin = *std::exchange(binary_string_part_begin_, std::nullopt);
+  const auto part_size =
+      static_cast<std::uint32_t>(msg_.size() - begin - sizeof(std::uint32_t));
+  std::memcpy(msg_.data() + begin, &part_size, sizeof(part_size));
+}
+
+template <typename T>
+void LogHelper::Impl::PutBinaryItem(impl::binary::ItemType type, T value) {
+  UASSERT(is_within_value_);
+  CloseBinaryStringPart();
+  AppendBinary(msg_, type);
+  AppendBinary(msg_, value);
+}
+
 }  // namespace logging
 
 USERVER_NAMESPACE_END
@@ -1,11 +1,13 @@
 #pragma once
 
+#include <cstdint>
 #include <optional>
 #include <ostream>
 #include <unordered_set>
 
 #include <fmt/format.h>
 
+#include <logging/binary_record.hpp>
 #include <userver/logging/level.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/logging/log_extra.hpp>
@@ -35,9 +37,20 @@ class LogHelper::Impl final {
 
   void PutValuePart(std::string_view value);
   void PutValuePart(char text_part);
-  LogBuffer& GetBufferForRawValuePart() noexcept;
+  LogBuffer& GetBufferForRawValuePart();
+
+  // Typed value parts, kept raw in Format::kBinary
+  void PutSigned(long long value);
+  void PutUnsigned(unsigned long long value);
+  void PutFloatingPoint(float value);
+  void PutFloatingPoint(double value);
+  void PutFloatingPoint(long double value);
+  void PutBoolean(bool value);
 
   bool IsWithinValue() const noexcept { return is_within_value_; }
+
+  // Whether the logger symbolizes the deferred stacktraces itself
+  bool ShouldDeferStacktraces() const noexcept;
   void MarkValueEnd() noexcept;
 
   LogExtra& GetLogExtra() { return extra_; }
@@ -80,15 +93,32 @@ class LogHelper::Impl final {
 
   void CheckRepeatedKeys(std::string_view raw_key);
 
+  void PutJsonKey(std::string_view key);
+  void PutRawJsonKey(std::string_view key);
+  void CloseJsonValue();
+
+  void PutBinaryMessageBegin();
+  void PutBinaryKey(std::string_view key);
+  void OpenBinaryStringPart();
+  void CloseBinaryStringPart() noexcept;
+  template <typename T>
+  void PutBinaryItem(impl::binary::ItemType type, T value);
+
   impl::LoggerBase* logger_;
   const Level level_;
   const char key_value_separator_;
+  const bool is_binary_;
+  const bool is_json_;
   LogBuffer msg_;
   std::optional<LazyInitedStream> lazy_stream_;
   LogExtra extra_;
   std::size_t initial_length_{0};
   bool is_within_value_{false};
   bool is_trace_{false};
+  // Format::kJson value quotes are closed lazily, see CloseJsonValue
+  bool is_json_value_open_{false};
+  // Position of the length of the unfinished kString item in Format::kBinary
+  std::optional<std::size_t> binary_string_part_begin_;
   std::optional<std::unordered_set<std::string>> debug_tag_keys_;
 };
 
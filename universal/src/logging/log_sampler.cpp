@@ -0,0 +1,128 @@
+#include <logging/log_sampler.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+#include <logging/dynamic_debug.hpp>
+#include <userver/logging/impl/logger_base.hpp>
+#include <userver/logging/log_helper.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/datetime.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+namespace {
+
+constexpr std::chrono::seconds kPeriod{1};
+
+// The share of the budget that a single location may use before it gets
+// sampled, so that a few noisy locations do not starve the rare ones
+constexpr std::uint64_t kFairShareDivisor = 16;
+
+// The period counters are reset without synchronizing with the concurrent
+// increments, a few records at the period boundary may be lost. That's fine
+// for the sampling purposes.
+std::uint64_t CountInPeriod(std::atomic<std::int64_t>& period,
+                            std::atomic<std::uint64_t>& count,
+                            std::int64_t current_period) noexcept {
+  auto seen_period = period.load(std::memory_order_relaxed);
+  if (seen_period != current_period &&
+      period.compare_exchange_strong(seen_period, current_period,
+                                     std::memory_order_relaxed)) {
+    count.store(0, std::memory_order_relaxed);
+  }
+  return count.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+std::uint64_t FloorPowerOf2(std::uint64_t n) noexcept {
+  UASSERT(n != 0);
+  return std::uint64_t{1} << (63 - __builtin_clzll(n));
+}
+
+}  // namespace
+
+LogSampler::LogSampler(std::size_t records_per_second)
+    : budget_(records_per_second),
+      fair_share_(std::max<std::uint64_t>(budget_ / kFairShareDivisor, 1)) {
+  UINVARIANT(budget_ > 0, "Log sampling budget must be positive");
+}
+
+bool LogSampler::ShouldDrop(LoggerBase& logger, const LogEntryContent& entry,
+                            Level level) noexcept {
+  const std::int64_t period =
+      utils::datetime::SteadyNow().time_since_epoch() / kPeriod;
+
+  auto seen_report_period = report_period_.load(std::memory_order_relaxed);
+  if (seen_report_period != period &&
+      report_period_.compare_exchange_strong(seen_report_period, period,
+                                             std::memory_order_relaxed)) {
+    ReportSuppressed(logger);
+  }
+
+  auto& level_records = levels_[static_cast<std::size_t>(level)];
+  const auto level_count =
+      CountInPeriod(level_records.period, level_records.count, period);
+
+  // Locations that did not fit into the table are never sampled
+  auto* const site = FindSite(entry);
+  if (!site) return false;
+
+  // Count the location even within the budget, to know the noisy ones as soon
+  // as the budget is exhausted
+  const auto site_count =
+      CountInPeriod(site->records.period, site->records.count, period);
+  if (level_count <= budget_ || site_count <= fair_share_) return false;
+
+  // Keep every stride-th record, the stride grows with the location volume.
+  // A location keeps about fair_share_ records per each doubling of volume.
+  const auto stride = FloorPowerOf2(site_count / fair_share_);
+  if (site_count % stride == 0) return false;
+
+  site->level.store(level, std::memory_order_relaxed);
+  site->suppressed.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+LogSampler::Site* LogSampler::FindSite(const LogEntryContent& entry) noexcept {
+  const auto hash = reinterpret_cast<std::uintptr_t>(&entry) /
+                    alignof(LogEntryContent);
+
+  for (std::size_t i = 0; i < kMaxProbes; ++i) {
+    auto& site = sites_[(hash + i) % kSitesCount];
+    const auto* site_entry = site.entry.load(std::memory_order_acquire);
+    if (site_entry == nullptr &&
+        site.entry.compare_exchange_strong(site_entry, &entry,
+                                           std::memory_order_acq_rel)) {
+      return &site;
+    }
+    if (site_entry == &entry) return &site;
+  }
+
+  return nullptr;
+}
+
+void LogSampler::ReportSuppressed(LoggerBase& logger) noexcept {
+  for (auto& site : sites_) {
+    const auto* entry = site.entry.load(std::memory_order_acquire);
+    if (!entry) continue;
+
+    const auto suppressed =
+        site.suppressed.exchange(0, std::memory_order_relaxed);
+    if (suppressed == 0) continue;
+
+    try {
+      LogHelper(logger, site.level.load(std::memory_order_relaxed))
+          << "suppressed " << suppressed << " records from " << entry->path
+          << ':' << entry->line;
+    } catch (const std::exception& e) {
+      UASSERT_MSG(false, e.what());
+    }
+  }
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <userver/logging/level.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging {
+
+struct LogEntryContent;
+
+namespace impl {
+
+class LoggerBase;
+
+/// Keeps the records of each level of a logger within a per-second budget.
+///
+/// While a level is within its budget, all of its records pass. Once the
+/// budget is exhausted, the log locations that produce more than a fair share
+/// of the budget are sampled down proportionally to their volume, while the
+/// rare locations still pass. The dropped records are reported once per period
+/// as "suppressed N records from file:line" records of the same level.
+class LogSampler final {
+ public:
+  explicit LogSampler(std::size_t records_per_second);
+
+  /// Returns true if the record from `entry` should be dropped
+  bool ShouldDrop(LoggerBase& logger, const LogEntryContent& entry,
+                  Level level) noexcept;
+
+ private:
+  struct Counter final {
+    std::atomic<std::int64_t> period{-1};
+    std::atomic<std::uint64_t> count{0};
+  };
+
+  struct Site final {
+    std::atomic<const LogEntryContent*> entry{nullptr};
+    Counter records;
+    std::atomic<std::uint64_t> suppressed{0};
+    std::atomic<Level> level{Level::kNone};
+  };
+
+  static constexpr std::size_t kSitesCount = 1024;
+  static constexpr std::size_t kMaxProbes = 16;
+
+  Site* FindSite(const LogEntryContent& entry) noexcept;
+  void ReportSuppressed(LoggerBase& logger) noexcept;
+
+  const std::uint64_t budget_;
+  const std::uint64_t fair_share_;
+  std::atomic<std::int64_t> report_period_{-1};
+  std::array<Counter, kLevelMax + 1> levels_{};
+  std::array<Site, kSitesCount> sites_{};
+};
+
+}  // namespace impl
+
+}  // namespace logging
+
+USERVER_NAMESPACE_END
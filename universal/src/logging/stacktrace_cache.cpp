@@ -1,14 +1,16 @@
 #include <userver/logging/stacktrace_cache.hpp>
 
+#include <array>
 #include <atomic>
-#include <unordered_map>
+#include <mutex>
+#include <vector>
 
 #include <fmt/format.h>
 #include <boost/functional/hash.hpp>
 #include <boost/stacktrace.hpp>
 
+#include <logging/deferred_stacktrace.hpp>
 #include <userver/cache/lru_map.hpp>
-#include <userver/compiler/thread_local.hpp>
 #include <userver/utils/assert.hpp>
 
 namespace std {
@@ -30,24 +32,48 @@ namespace {
 
 constexpr std::string_view kStartOfCoroutine = "utils::impl::WrappedCallImpl<";
 
+constexpr std::size_t kFrameNameCacheShards = 16;
+constexpr std::size_t kFrameNameCacheShardSize = 2048;
+
 std::atomic<bool> stacktrace_enabled{true};
 
-compiler::ThreadLocal local_frame_name_cache = [] {
-  return cache::LruMap<boost::stacktrace::frame, std::string>{10000};
+// Shared by all the threads, so that the logger task that symbolizes the
+// deferred stacktraces and the threads that symbolize in place reuse the names
+struct FrameNameCacheShard final {
+  std::mutex mutex;
+  cache::LruMap<boost::stacktrace::frame, std::string> names{
+      kFrameNameCacheShardSize};
 };
 
-const std::string& ToStringCachedFiltered(boost::stacktrace::frame frame) {
-  auto frame_name_cache = local_frame_name_cache.Use();
-  auto* ptr = frame_name_cache->Get(frame);
-  if (!ptr) {
-    auto name = boost::stacktrace::to_string(frame);
-    UASSERT(!name.empty());
-    if (name.find(kStartOfCoroutine) != std::string::npos) {
-      name = {};
+FrameNameCacheShard& GetFrameNameCacheShard(boost::stacktrace::frame frame) {
+  static std::array<FrameNameCacheShard, kFrameNameCacheShards> shards;
+  return shards[std::hash<boost::stacktrace::frame>{}(frame) %
+                kFrameNameCacheShards];
+}
+
+// Returns `false` for the frames of the coroutine start
+bool AppendCachedFiltered(boost::stacktrace::frame frame, std::string& out) {
+  auto& shard = GetFrameNameCacheShard(frame);
+  {
+    const std::lock_guard lock{shard.mutex};
+    if (const auto* name = shard.names.Get(frame)) {
+      out += *name;
+      return !name->empty();
     }
-    ptr = frame_name_cache->Emplace(frame, std::move(name));
   }
-  return *ptr;
+
+  // Symbolization is slow, do not block the shard
+  auto name = boost::stacktrace::to_string(frame);
+  UASSERT(!name.empty());
+  if (name.find(kStartOfCoroutine) != std::string::npos) {
+    name = {};
+  }
+  out += name;
+  const bool is_filtered_out = name.empty();
+
+  const std::lock_guard lock{shard.mutex};
+  shard.names.Put(frame, std::move(name));
+  return !is_filtered_out;
 }
 
 }  // namespace
@@ -56,21 +82,26 @@ std::string to_string(const boost::stacktrace::stacktrace& st) {
   if (!stacktrace_enabled.load()) {
     return "<unknown>";
   }
+  return impl::FramesToString(st.as_vector());
+}
+
+namespace impl {
 
+std::string FramesToString(
+    const std::vector<boost::stacktrace::frame>& frames) {
   std::string res;
-  res.reserve(200 * st.size());
+  res.reserve(200 * frames.size());
 
   size_t i = 0;
-  for (const auto frame : st) {
+  for (const auto frame : frames) {
     if (i < 10) {
       res += ' ';
     }
     res += fmt::to_string(i);
     res += '#';
     res += ' ';
-    const auto& filtered_frame_name = ToStringCachedFiltered(frame);
 
-    if (filtered_frame_name.empty()) {
+    if (!AppendCachedFiltered(frame, res)) {
       /* The rest is a long common stacktrace for a task w/ std::function,
        * WrappedCall, fiber, etc. Almost useless for service debugging.
        */
@@ -78,7 +109,6 @@ std::string to_string(const boost::stacktrace::stacktrace& st) {
       break;
     }
 
-    res += filtered_frame_name;
     res += '\n';
     i++;
   }
@@ -86,6 +116,10 @@ std::string to_string(const boost::stacktrace::stacktrace& st) {
   return res;
 }
 
+bool IsStacktraceEnabled() noexcept { return stacktrace_enabled.load(); }
+
+}  // namespace impl
+
 bool GlobalEnableStacktrace(bool enable) {
   return stacktrace_enabled.exchange(enable);
 }
@@ -0,0 +1,49 @@
+#include <logging/timestamp.hpp>
+
+#include <fmt/chrono.h>
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include <userver/compiler/thread_local.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+namespace {
+
+using SecondsTimePoint =
+    std::chrono::time_point<TimePoint::clock, std::chrono::seconds>;
+
+struct CachedTime final {
+  SecondsTimePoint time{};
+  TimeString string{};
+};
+
+compiler::ThreadLocal local_cached_time = [] { return CachedTime{}; };
+
+}  // namespace
+
+TimeString GetTimeString(TimePoint time) noexcept {
+  auto cached_time = local_cached_time.Use();
+
+  const auto rounded_time =
+      std::chrono::time_point_cast<std::chrono::seconds>(time);
+  if (rounded_time != cached_time->time) {
+    fmt::format_to(cached_time->string.data, FMT_COMPILE("{:%FT%T}"),
+                   fmt::localtime(std::chrono::system_clock::to_time_t(time)));
+    cached_time->time = rounded_time;
+  }
+  return cached_time->string;
+}
+
+long long GetFractionalMicroseconds(TimePoint time) noexcept {
+  return std::chrono::time_point_cast<std::chrono::microseconds>(time)
+             .time_since_epoch()
+             .count() %
+         1'000'000;
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <chrono>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+using TimePoint = std::chrono::system_clock::time_point;
+
+inline constexpr std::string_view kTimeTemplate = "0000-00-00T00:00:00";
+
+struct TimeString final {
+  char data[kTimeTemplate.size()]{};
+
+  std::string_view ToStringView() const noexcept {
+    return {data, std::size(data)};
+  }
+};
+
+/// Local time up to seconds, cached per thread for the last seen second
+TimeString GetTimeString(TimePoint time) noexcept;
+
+/// Microseconds part of the time, for printing after GetTimeString
+long long GetFractionalMicroseconds(TimePoint time) noexcept;
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
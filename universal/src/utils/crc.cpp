@@ -0,0 +1,153 @@
+#include <userver/utils/crc.hpp>
+
+#include <array>
+#include <cstring>
+
+#if defined(__SSE4_2__) && defined(__x86_64__)
+#include <nmmintrin.h>
+#endif
+
+#ifdef __ARM_FEATURE_CRC32
+#include <arm_acle.h>
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+namespace {
+
+// Reversed polynomials of the reflected CRC-32 variants
+constexpr std::uint32_t kCrc32Poly = 0xedb88320;
+constexpr std::uint32_t kCrc32cPoly = 0x82f63b78;
+
+constexpr std::uint16_t kCrc16Poly = 0x1021;
+
+using Crc32Tables = std::array<std::array<std::uint32_t, 256>, 8>;
+
+// tables[k][i] is the CRC of the byte i followed by k zero bytes, see
+// "A Systematic Approach to Building High Performance Software-Based CRC
+// Generators" by Kounavis and Berry
+constexpr Crc32Tables MakeCrc32Tables(std::uint32_t poly) {
+  Crc32Tables tables{};
+  for (std::uint32_t i = 0; i < 256; ++i) {
+    std::uint32_t crc = i;
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc >> 1) ^ ((crc & 1) ? poly : 0);
+    }
+    tables[0][i] = crc;
+  }
+  for (std::size_t k = 1; k < tables.size(); ++k) {
+    for (std::size_t i = 0; i < 256; ++i) {
+      const auto prev = tables[k - 1][i];
+      tables[k][i] = (prev >> 8) ^ tables[0][prev & 0xff];
+    }
+  }
+  return tables;
+}
+
+constexpr std::array<std::uint16_t, 256> MakeCrc16Table() {
+  std::array<std::uint16_t, 256> table{};
+  for (std::uint32_t i = 0; i < 256; ++i) {
+    std::uint32_t crc = i << 8;
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc << 1) ^ ((crc & 0x8000) ? kCrc16Poly : 0);
+    }
+    table[i] = static_cast<std::uint16_t>(crc);
+  }
+  return table;
+}
+
+#ifndef __ARM_FEATURE_CRC32
+constexpr Crc32Tables kCrc32Tables = MakeCrc32Tables(kCrc32Poly);
+#endif
+#if !defined(__ARM_FEATURE_CRC32) && \
+    !(defined(__SSE4_2__) && defined(__x86_64__))
+constexpr Crc32Tables kCrc32cTables = MakeCrc32Tables(kCrc32cPoly);
+#endif
+constexpr auto kCrc16Table = MakeCrc16Table();
+
+// Compilers turn it into a single load on little-endian platforms
+[[maybe_unused]] std::uint32_t LoadLittleEndian32(
+    const unsigned char* data) noexcept {
+  return std::uint32_t{data[0]} | (std::uint32_t{data[1]} << 8) |
+         (std::uint32_t{data[2]} << 16) | (std::uint32_t{data[3]} << 24);
+}
+
+[[maybe_unused]] std::uint64_t Load64(const unsigned char* data) noexcept {
+  std::uint64_t value;
+  std::memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+// Works with the inverted CRC value, the caller does the inversions
+[[maybe_unused]] std::uint32_t SoftwareCrc32(const Crc32Tables& tables,
+                                             std::string_view data,
+                                             std::uint32_t crc) noexcept {
+  const auto* first = reinterpret_cast<const unsigned char*>(data.data());
+  const auto* const last = first + data.size();
+
+  while (last - first >= 8) {
+    const auto low = crc ^ LoadLittleEndian32(first);
+    const auto high = LoadLittleEndian32(first + 4);
+    crc = tables[7][low & 0xff] ^ tables[6][(low >> 8) & 0xff] ^
+          tables[5][(low >> 16) & 0xff] ^ tables[4][low >> 24] ^
+          tables[3][high & 0xff] ^ tables[2][(high >> 8) & 0xff] ^
+          tables[1][(high >> 16) & 0xff] ^ tables[0][high >> 24];
+    first += 8;
+  }
+
+  for (; first != last; ++first) {
+    crc = (crc >> 8) ^ tables[0][(crc ^ *first) & 0xff];
+  }
+  return crc;
+}
+
+}  // namespace
+
+std::uint32_t Crc32(std::string_view data, std::uint32_t crc) noexcept {
+  crc = ~crc;
+#ifdef __ARM_FEATURE_CRC32
+  const auto* first = reinterpret_cast<const unsigned char*>(data.data());
+  const auto* const last = first + data.size();
+  for (; last - first >= 8; first += 8) crc = __crc32d(crc, Load64(first));
+  for (; first != last; ++first) crc = __crc32b(crc, *first);
+#else
+  crc = SoftwareCrc32(kCrc32Tables, data, crc);
+#endif
+  return ~crc;
+}
+
+std::uint32_t Crc32c(std::string_view data, std::uint32_t crc) noexcept {
+  crc = ~crc;
+#if defined(__SSE4_2__) && defined(__x86_64__)
+  const auto* first = reinterpret_cast<const unsigned char*>(data.data());
+  const auto* const last = first + data.size();
+  std::uint64_t crc64 = crc;
+  for (; last - first >= 8; first += 8) {
+    crc64 = _mm_crc32_u64(crc64, Load64(first));
+  }
+  crc = static_cast<std::uint32_t>(crc64);
+  for (; first != last; ++first) crc = _mm_crc32_u8(crc, *first);
+#elif defined(__ARM_FEATURE_CRC32)
+  const auto* first = reinterpret_cast<const unsigned char*>(data.data());
+  const auto* const last = first + data.size();
+  for (; last - first >= 8; first += 8) crc = __crc32cd(crc, Load64(first));
+  for (; first != last; ++first) crc = __crc32cb(crc, *first);
+#else
+  crc = SoftwareCrc32(kCrc32cTables, data, crc);
+#endif
+  return ~crc;
+}
+
+std::uint16_t Crc16(std::string_view data, std::uint16_t crc) noexcept {
+  for (const char c : data) {
+    const auto index = ((crc >> 8) ^ static_cast<unsigned char>(c)) & 0xff;
+    crc = static_cast<std::uint16_t>((crc << 8) ^ kCrc16Table[index]);
+  }
+  return crc;
+}
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
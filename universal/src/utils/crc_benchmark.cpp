@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <boost/crc.hpp>
+
+#include <userver/utils/crc.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string MakeData(std::size_t size) {
+  std::string result(size, '\0');
+  for (std::size_t i = 0; i < size; ++i) {
+    result[i] = static_cast<char>(i * 131);
+  }
+  return result;
+}
+
+}  // namespace
+
+void crc32(benchmark::State& state) {
+  const auto data = MakeData(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(utils::Crc32(data));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(crc32)->RangeMultiplier(4)->Range(8, 64 << 10);
+
+void crc32_boost(benchmark::State& state) {
+  const auto data = MakeData(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    boost::crc_32_type crc;
+    crc.process_bytes(data.data(), data.size());
+    benchmark::DoNotOptimize(crc.checksum());
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(crc32_boost)->RangeMultiplier(4)->Range(8, 64 << 10);
+
+void crc32c(benchmark::State& state) {
+  const auto data = MakeData(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(utils::Crc32c(data));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(crc32c)->RangeMultiplier(4)->Range(8, 64 << 10);
+
+void crc16(benchmark::State& state) {
+  const auto data = MakeData(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(utils::Crc16(data));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(crc16)->RangeMultiplier(4)->Range(8, 64 << 10);
+
+USERVER_NAMESPACE_END
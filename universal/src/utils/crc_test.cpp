@@ -0,0 +1,65 @@
+#include <userver/utils/crc.hpp>
+
+#include <string>
+
+#include <boost/crc.hpp>
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kCheckInput = "123456789";
+
+std::string MakeData(std::size_t size) {
+  std::string result(size, '\0');
+  for (std::size_t i = 0; i < size; ++i) {
+    result[i] = static_cast<char>(i * 131 + (i >> 3));
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(Crc, CheckValues) {
+  EXPECT_EQ(utils::Crc32(kCheckInput), 0xcbf43926);
+  EXPECT_EQ(utils::Crc32c(kCheckInput), 0xe3069283);
+  EXPECT_EQ(utils::Crc16(kCheckInput), 0x31c3);
+
+  EXPECT_EQ(utils::Crc32({}), 0);
+  EXPECT_EQ(utils::Crc32c({}), 0);
+  EXPECT_EQ(utils::Crc16({}), 0);
+}
+
+TEST(Crc, SameAsBoost) {
+  for (std::size_t size = 0; size < 100; ++size) {
+    const auto data = MakeData(size);
+
+    boost::crc_32_type crc32;
+    crc32.process_bytes(data.data(), data.size());
+    EXPECT_EQ(utils::Crc32(data), crc32.checksum()) << size;
+
+    boost::crc_optimal<32, 0x1edc6f41, 0xffffffff, 0xffffffff, true, true>
+        crc32c;
+    crc32c.process_bytes(data.data(), data.size());
+    EXPECT_EQ(utils::Crc32c(data), crc32c.checksum()) << size;
+
+    boost::crc_optimal<16, 0x1021> crc16;
+    crc16.process_bytes(data.data(), data.size());
+    EXPECT_EQ(utils::Crc16(data), crc16.checksum()) << size;
+  }
+}
+
+TEST(Crc, Continuation) {
+  const auto data = MakeData(1000);
+  const std::string_view view = data;
+  for (const std::size_t split : {0, 1, 7, 8, 9, 500, 1000}) {
+    const auto head = view.substr(0, split);
+    const auto tail = view.substr(split);
+    EXPECT_EQ(utils::Crc32(tail, utils::Crc32(head)), utils::Crc32(view));
+    EXPECT_EQ(utils::Crc32c(tail, utils::Crc32c(head)), utils::Crc32c(view));
+    EXPECT_EQ(utils::Crc16(tail, utils::Crc16(head)), utils::Crc16(view));
+  }
+}
+
+USERVER_NAMESPACE_END
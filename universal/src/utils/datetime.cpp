@@ -3,6 +3,7 @@
 #include <array>
 #include <ctime>
 #include <optional>
+#include <utility>
 
 #include <sys/param.h>
 
@@ -12,6 +13,7 @@
 
 #include <userver/utils/assert.hpp>
 #include <userver/utils/mock_now.hpp>
+#include <utils/datetime/fixed_format.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -63,12 +65,33 @@ std::optional<std::chrono::system_clock::time_point> OptionalStringtime(
   return {};
 }
 
+// The common ISO-8601 formats in UTC are handled without cctz, the other
+// formats and the non-canonical inputs go the general way
+std::optional<std::chrono::system_clock::time_point> FastStringtime(
+    const std::string& timestring, const std::string& timezone,
+    const std::string& format) {
+  if (timezone != kDefaultTimezone) return std::nullopt;
+  const auto* fixed_format = impl::FindFixedFormat(format);
+  if (!fixed_format) return std::nullopt;
+  return impl::ParseFixedFormat(timestring, *fixed_format);
+}
+
+std::optional<std::string> FastTimestring(
+    std::chrono::system_clock::time_point tp, const std::string& timezone,
+    const std::string& format) {
+  if (timezone != kDefaultTimezone) return std::nullopt;
+  const auto* fixed_format = impl::FindFixedFormat(format);
+  if (!fixed_format) return std::nullopt;
+  return impl::FormatFixedFormat(tp, *fixed_format);
+}
+
+const std::array<std::string, 3> kGuessFormats{{"%Y-%m-%dT%H:%M:%E*S%Ez",
+                                                "%Y-%m-%dT%H:%M:%E*S%z",
+                                                "%Y-%m-%dT%H:%M:%E*SZ"}};
+
 std::chrono::system_clock::time_point DoGuessStringtime(
     const std::string& timestring, const cctz::time_zone& timezone) {
-  static const std::array<std::string, 3> formats{{"%Y-%m-%dT%H:%M:%E*S%Ez",
-                                                   "%Y-%m-%dT%H:%M:%E*S%z",
-                                                   "%Y-%m-%dT%H:%M:%E*SZ"}};
-  for (const auto& format : formats) {
+  for (const auto& format : kGuessFormats) {
     const auto optional_tp = OptionalStringtime(timestring, timezone, format);
     if (optional_tp) {
       return *optional_tp;
@@ -113,12 +136,18 @@ bool IsTimeBetween(int hour, int min, int hour_from, int min_from, int hour_to,
 
 std::string Timestring(std::chrono::system_clock::time_point tp,
                        const std::string& timezone, const std::string& format) {
+  if (auto fast = FastTimestring(tp, timezone, format)) {
+    return std::move(*fast);
+  }
   return cctz::format(format, tp, GetTimezone(timezone));
 }
 
 std::optional<std::chrono::system_clock::time_point> OptionalStringtime(
     const std::string& timestring, const std::string& timezone,
     const std::string& format) {
+  if (const auto fast = FastStringtime(timestring, timezone, format)) {
+    return fast;
+  }
   auto tz = GetOptionalTimezone(timezone);
   if (!tz.has_value()) {
     return std::nullopt;
@@ -146,6 +175,9 @@ std::string LocalTimezoneTimestring(time_t timestamp,
 std::chrono::system_clock::time_point Stringtime(const std::string& timestring,
                                                  const std::string& timezone,
                                                  const std::string& format) {
+  if (const auto fast = FastStringtime(timestring, timezone, format)) {
+    return *fast;
+  }
   const auto optional_tp =
       OptionalStringtime(timestring, GetTimezone(timezone), format);
   if (!optional_tp) {
@@ -166,6 +198,11 @@ std::chrono::system_clock::time_point LocalTimezoneStringtime(
 
 std::chrono::system_clock::time_point GuessStringtime(
     const std::string& timestamp, const std::string& timezone) {
+  for (const auto& format : kGuessFormats) {
+    if (const auto fast = FastStringtime(timestamp, timezone, format)) {
+      return *fast;
+    }
+  }
   return DoGuessStringtime(timestamp, GetTimezone(timezone));
 }
 
@@ -0,0 +1,280 @@
+#include <utils/datetime/fixed_format.hpp>
+
+#include <array>
+#include <cstdint>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::datetime::impl {
+
+namespace {
+
+using Fraction = FixedFormat::Fraction;
+using Offset = FixedFormat::Offset;
+
+constexpr std::array kFixedFormats{
+    // kRfc3339Format
+    FixedFormat{"%Y-%m-%dT%H:%M:%E*S%Ez", Fraction::kAny, Offset::kExtended},
+    // kDefaultFormat
+    FixedFormat{"%Y-%m-%dT%H:%M:%E*S%z", Fraction::kAny, Offset::kBasic},
+    // kIsoFormat
+    FixedFormat{"%Y-%m-%dT%H:%M:%SZ", Fraction::kNone, Offset::kLiteralZ},
+    // kTaximeterFormat
+    FixedFormat{"%Y-%m-%dT%H:%M:%E6SZ", Fraction::kMicroseconds,
+                Offset::kLiteralZ},
+    // one of the GuessStringtime() formats
+    FixedFormat{"%Y-%m-%dT%H:%M:%E*SZ", Fraction::kAny, Offset::kLiteralZ},
+};
+
+// The range of the nanosecond system_clock, with a margin for the offsets
+constexpr std::int64_t kMinParsedYear = 1700;
+constexpr std::int64_t kMaxParsedYear = 2200;
+
+constexpr std::int64_t kSecondsPerDay = 24 * 60 * 60;
+constexpr int kNanosecondDigits = 9;
+
+// http://howardhinnant.github.io/date_algorithms.html#days_from_civil
+constexpr std::int64_t DaysFromCivil(std::int64_t y, unsigned m,
+                                     unsigned d) noexcept {
+  y -= m <= 2;
+  const std::int64_t era = (y >= 0 ? y : y - 399) / 400;
+  const auto yoe = static_cast<unsigned>(y - era * 400);
+  const unsigned doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+  const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + static_cast<std::int64_t>(doe) - 719468;
+}
+
+struct CivilDay final {
+  std::int64_t year;
+  unsigned month;
+  unsigned day;
+};
+
+// http://howardhinnant.github.io/date_algorithms.html#civil_from_days
+constexpr CivilDay CivilFromDays(std::int64_t z) noexcept {
+  z += 719468;
+  const std::int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+  const auto doe = static_cast<unsigned>(z - era * 146097);
+  const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  const unsigned mp = (5 * doy + 2) / 153;
+  const unsigned d = doy - (153 * mp + 2) / 5 + 1;
+  const unsigned m = mp < 10 ? mp + 3 : mp - 9;
+  return {static_cast<std::int64_t>(yoe) + era * 400 + (m <= 2), m, d};
+}
+
+static_assert(DaysFromCivil(1970, 1, 1) == 0);
+static_assert(CivilFromDays(DaysFromCivil(2000, 2, 29)).day == 29);
+
+constexpr unsigned DaysInMonth(std::int64_t year, unsigned month) noexcept {
+  constexpr unsigned kDays[] = {31, 28, 31, 30, 31, 30,
+                                31, 31, 30, 31, 30, 31};
+  const bool is_leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+  return kDays[month - 1] + (month == 2 && is_leap);
+}
+
+constexpr bool IsDigit(char c) noexcept { return c >= '0' && c <= '9'; }
+
+class Reader final {
+ public:
+  explicit Reader(std::string_view data) noexcept : data_(data) {}
+
+  // Reads exactly `digits` digits
+  bool ReadNumber(int digits, unsigned& value) noexcept {
+    if (data_.size() < static_cast<std::size_t>(digits)) return false;
+    value = 0;
+    for (int i = 0; i < digits; ++i) {
+      if (!IsDigit(data_[i])) return false;
+      value = value * 10 + (data_[i] - '0');
+    }
+    data_.remove_prefix(digits);
+    return true;
+  }
+
+  bool Skip(char c) noexcept {
+    if (data_.empty() || data_.front() != c) return false;
+    data_.remove_prefix(1);
+    return true;
+  }
+
+  bool Peek(char c) const noexcept { return !data_.empty() && data_[0] == c; }
+
+  bool IsEnd() const noexcept { return data_.empty(); }
+
+  // Reads the fractional digits, truncating them to nanoseconds
+  bool ReadFraction(Fraction fraction, unsigned& nanoseconds) noexcept {
+    nanoseconds = 0;
+    int digits = 0;
+    while (!data_.empty() && IsDigit(data_.front())) {
+      if (digits < kNanosecondDigits) {
+        nanoseconds = nanoseconds * 10 + (data_.front() - '0');
+      }
+      ++digits;
+      data_.remove_prefix(1);
+    }
+    if (digits == 0) return false;
+    if (fraction == Fraction::kMicroseconds && digits != 6) return false;
+    for (; digits < kNanosecondDigits; ++digits) nanoseconds *= 10;
+    return true;
+  }
+
+ private:
+  std::string_view data_;
+};
+
+std::optional<int> ReadOffset(Reader& reader, Offset offset) noexcept {
+  if (offset == Offset::kLiteralZ) {
+    if (!reader.Skip('Z')) return std::nullopt;
+    return 0;
+  }
+
+  if (reader.Skip('Z') || reader.Skip('z')) return 0;
+
+  int sign = 1;
+  if (reader.Skip('-')) {
+    sign = -1;
+  } else if (!reader.Skip('+')) {
+    return std::nullopt;
+  }
+
+  unsigned hours = 0;
+  unsigned minutes = 0;
+  if (!reader.ReadNumber(2, hours) || hours > 23) return std::nullopt;
+  if (!reader.IsEnd()) {
+    // %Ez takes both +hh:mm and +hhmm, %z only +hhmm
+    if (offset == Offset::kExtended) reader.Skip(':');
+    if (!reader.ReadNumber(2, minutes) || minutes > 59) return std::nullopt;
+  }
+  return sign * static_cast<int>(hours * 60 + minutes) * 60;
+}
+
+char* WriteDigits(char* out, unsigned value, int digits) noexcept {
+  for (int i = digits - 1; i >= 0; --i) {
+    out[i] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  }
+  return out + digits;
+}
+
+}  // namespace
+
+const FixedFormat* FindFixedFormat(std::string_view format) noexcept {
+  for (const auto& fixed_format : kFixedFormats) {
+    if (fixed_format.format == format) return &fixed_format;
+  }
+  return nullptr;
+}
+
+std::optional<std::chrono::system_clock::time_point> ParseFixedFormat(
+    std::string_view timestring, const FixedFormat& format) noexcept {
+  Reader reader{timestring};
+  unsigned year = 0;
+  unsigned month = 0;
+  unsigned day = 0;
+  unsigned hour = 0;
+  unsigned minute = 0;
+  unsigned second = 0;
+  unsigned nanoseconds = 0;
+  if (!reader.ReadNumber(4, year) || !reader.Skip('-') ||
+      !reader.ReadNumber(2, month) || !reader.Skip('-') ||
+      !reader.ReadNumber(2, day) || !reader.Skip('T') ||
+      !reader.ReadNumber(2, hour) || !reader.Skip(':') ||
+      !reader.ReadNumber(2, minute) || !reader.Skip(':') ||
+      !reader.ReadNumber(2, second)) {
+    return std::nullopt;
+  }
+
+  if (format.fraction == Fraction::kMicroseconds && !reader.Peek('.')) {
+    return std::nullopt;
+  }
+  if (format.fraction != Fraction::kNone && reader.Skip('.') &&
+      !reader.ReadFraction(format.fraction, nanoseconds)) {
+    return std::nullopt;
+  }
+
+  const auto offset = ReadOffset(reader, format.offset);
+  if (!offset || !reader.IsEnd()) return std::nullopt;
+
+  if (year < kMinParsedYear || year > kMaxParsedYear || month < 1 ||
+      month > 12 || day < 1 || day > DaysInMonth(year, month) || hour > 23 ||
+      minute > 59 || second > 59) {
+    return std::nullopt;
+  }
+
+  const auto seconds = DaysFromCivil(year, month, day) * kSecondsPerDay +
+                       hour * 3600 + minute * 60 + second - *offset;
+  return std::chrono::system_clock::time_point{
+      std::chrono::duration_cast<std::chrono::system_clock::duration>(
+          std::chrono::seconds{seconds} +
+          std::chrono::nanoseconds{nanoseconds})};
+}
+
+std::optional<std::string> FormatFixedFormat(
+    std::chrono::system_clock::time_point tp, const FixedFormat& format) {
+  const auto since_epoch = tp.time_since_epoch();
+  auto seconds = std::chrono::duration_cast<std::chrono::seconds>(since_epoch);
+  if (seconds > since_epoch) seconds -= std::chrono::seconds{1};
+  const auto nanoseconds = static_cast<unsigned>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(since_epoch -
+                                                           seconds)
+          .count());
+
+  auto days = seconds.count() / kSecondsPerDay;
+  auto signed_second_of_day = seconds.count() % kSecondsPerDay;
+  if (signed_second_of_day < 0) {
+    signed_second_of_day += kSecondsPerDay;
+    --days;
+  }
+  const auto second_of_day = static_cast<unsigned>(signed_second_of_day);
+  const auto civil = CivilFromDays(days);
+  if (civil.year < 1000 || civil.year > 9999) return std::nullopt;
+
+  // "YYYY-MM-DDTHH:MM:SS.nnnnnnnnn+00:00"
+  char buffer[35];
+  char* out = buffer;
+  out = WriteDigits(out, static_cast<unsigned>(civil.year), 4);
+  *out++ = '-';
+  out = WriteDigits(out, civil.month, 2);
+  *out++ = '-';
+  out = WriteDigits(out, civil.day, 2);
+  *out++ = 'T';
+  out = WriteDigits(out, second_of_day / 3600, 2);
+  *out++ = ':';
+  out = WriteDigits(out, second_of_day / 60 % 60, 2);
+  *out++ = ':';
+  out = WriteDigits(out, second_of_day % 60, 2);
+
+  switch (format.fraction) {
+    case Fraction::kNone:
+      break;
+    case Fraction::kMicroseconds:
+      *out++ = '.';
+      out = WriteDigits(out, nanoseconds / 1000, 6);
+      break;
+    case Fraction::kAny:
+      if (nanoseconds != 0) {
+        *out++ = '.';
+        out = WriteDigits(out, nanoseconds, kNanosecondDigits);
+        while (out[-1] == '0') --out;
+      }
+      break;
+  }
+
+  switch (format.offset) {
+    case Offset::kLiteralZ:
+      *out++ = 'Z';
+      break;
+    case Offset::kBasic:
+      for (const char c : {'+', '0', '0', '0', '0'}) *out++ = c;
+      break;
+    case Offset::kExtended:
+      for (const char c : {'+', '0', '0', ':', '0', '0'}) *out++ = c;
+      break;
+  }
+
+  return std::string(buffer, out);
+}
+
+}  // namespace utils::datetime::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::datetime::impl {
+
+// The ISO-8601 formats from utils/datetime.hpp that are parsed and formatted
+// without cctz. Only the UTC is supported.
+struct FixedFormat final {
+  enum class Fraction {
+    kNone,          // %S
+    kAny,           // %E*S
+    kMicroseconds,  // %E6S
+  };
+
+  enum class Offset {
+    kLiteralZ,  // Z
+    kBasic,     // %z
+    kExtended,  // %Ez
+  };
+
+  std::string_view format;
+  Fraction fraction;
+  Offset offset;
+};
+
+// Returns nullptr if `format` has no specialized implementation
+const FixedFormat* FindFixedFormat(std::string_view format) noexcept;
+
+// Returns std::nullopt for anything but the canonical form of the format, e.g.
+// for single digit fields, leap seconds or extra spaces. Those are left to
+// cctz, so that the results always match cctz::parse with the UTC timezone.
+std::optional<std::chrono::system_clock::time_point> ParseFixedFormat(
+    std::string_view timestring, const FixedFormat& format) noexcept;
+
+// Returns std::nullopt for the years outside of [1000, 9999]
+std::optional<std::string> FormatFixedFormat(
+    std::chrono::system_clock::time_point tp, const FixedFormat& format);
+
+}  // namespace utils::datetime::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,102 @@
+#include <utils/datetime/fixed_format.hpp>
+
+#include <cctz/time_zone.h>
+#include <gtest/gtest.h>
+
+#include <userver/utils/datetime.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kTimestrings[] = {
+    "2020-02-29T12:34:56.123456789+03:00",
+    "2020-02-29T12:34:56+0300",
+    "2020-02-29T12:34:56-03",
+    "2020-02-29T12:34:56Z",
+    "2020-02-29T12:34:56.000100Z",
+    "2020-02-29T12:34:56.1234567891234Z",
+    "1969-12-31T23:59:59.5Z",
+    "1970-01-01T00:00:00+00:00",
+    // not canonical or invalid
+    "2019-02-29T00:00:00Z",
+    "2020-01-01T24:00:00Z",
+    "2020-01-01T00:00:60Z",
+    "2020-1-01T00:00:00Z",
+    " 2020-01-01T00:00:00Z",
+    "2020-01-01T00:00:00Z ",
+    "2020-01-01T00:00:00.Z",
+    "2020-01-01T00:00:00+03:00:00",
+    "2020-01-01 00:00:00Z",
+    "9999-12-31T23:59:59Z",
+    "",
+};
+
+const std::string kFormats[] = {
+    utils::datetime::kRfc3339Format,
+    utils::datetime::kDefaultFormat,
+    utils::datetime::kIsoFormat,
+    utils::datetime::kTaximeterFormat,
+    "%Y-%m-%dT%H:%M:%E*SZ",
+};
+
+}  // namespace
+
+TEST(FixedFormat, ParseMatchesCctz) {
+  for (const auto& format : kFormats) {
+    const auto* fixed_format = utils::datetime::impl::FindFixedFormat(format);
+    ASSERT_TRUE(fixed_format) << format;
+
+    for (const auto timestring : kTimestrings) {
+      const auto fast =
+          utils::datetime::impl::ParseFixedFormat(timestring, *fixed_format);
+      if (!fast) continue;
+
+      std::chrono::system_clock::time_point expected;
+      ASSERT_TRUE(cctz::parse(format, std::string{timestring},
+                              cctz::utc_time_zone(), &expected))
+          << format << ' ' << timestring;
+      EXPECT_EQ(*fast, expected) << format << ' ' << timestring;
+    }
+  }
+}
+
+TEST(FixedFormat, FormatMatchesCctz) {
+  for (const auto& format : kFormats) {
+    const auto* fixed_format = utils::datetime::impl::FindFixedFormat(format);
+    ASSERT_TRUE(fixed_format) << format;
+
+    for (const auto tp : {
+             std::chrono::system_clock::time_point{},
+             std::chrono::system_clock::time_point{std::chrono::seconds{-1}},
+             std::chrono::system_clock::time_point{
+                 std::chrono::milliseconds{-1500}},
+             std::chrono::system_clock::time_point{
+                 std::chrono::microseconds{1582968896123456}},
+             std::chrono::system_clock::time_point{
+                 std::chrono::seconds{4102444800}},
+         }) {
+      const auto fast =
+          utils::datetime::impl::FormatFixedFormat(tp, *fixed_format);
+      ASSERT_TRUE(fast);
+      EXPECT_EQ(*fast, cctz::format(format, tp, cctz::utc_time_zone()));
+    }
+  }
+}
+
+TEST(FixedFormat, Stringtime) {
+  EXPECT_EQ(utils::datetime::Stringtime("2020-02-29T12:34:56.5+03:00", "UTC",
+                                        utils::datetime::kRfc3339Format),
+            utils::datetime::Stringtime("2020-02-29T09:34:56.5Z", "UTC",
+                                        "%Y-%m-%dT%H:%M:%E*SZ"));
+  // Non-canonical inputs are still handled by cctz
+  EXPECT_EQ(utils::datetime::Stringtime(" 2020-02-29T12:34:56+0300", "UTC",
+                                        utils::datetime::kDefaultFormat),
+            utils::datetime::Stringtime("2020-02-29T09:34:56Z", "UTC",
+                                        utils::datetime::kIsoFormat));
+  EXPECT_THROW(utils::datetime::Stringtime("2019-02-29T00:00:00Z", "UTC",
+                                           utils::datetime::kIsoFormat),
+               utils::datetime::DateParseError);
+}
+
+USERVER_NAMESPACE_END
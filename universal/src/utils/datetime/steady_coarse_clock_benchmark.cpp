@@ -1,6 +1,12 @@
 #include <userver/utils/datetime/steady_coarse_clock.hpp>
 
 #include <chrono>
+#include <ctime>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #include <benchmark/benchmark.h>
 
@@ -13,6 +19,21 @@ void steady_clock_benchmark(benchmark::State& state) {
 }
 BENCHMARK(steady_clock_benchmark);
 
+#if defined(__linux__)
+// What the clock would cost without vDSO, e.g. in some virtualized
+// environments with an unstable TSC
+void steady_clock_syscall_benchmark(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+    ::timespec tp;
+    benchmark::DoNotOptimize(
+        ::syscall(SYS_clock_gettime, CLOCK_MONOTONIC, &tp));
+    benchmark::DoNotOptimize(tp);
+  }
+}
+BENCHMARK(steady_clock_syscall_benchmark);
+#endif
+
 void steady_coarse_clock_benchmark(benchmark::State& state) {
   for ([[maybe_unused]] auto _ : state) {
     benchmark::DoNotOptimize(utils::datetime::SteadyCoarseClock::now());
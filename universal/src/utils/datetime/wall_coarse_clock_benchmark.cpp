@@ -1,6 +1,12 @@
 #include <userver/utils/datetime/wall_coarse_clock.hpp>
 
 #include <chrono>
+#include <ctime>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #include <benchmark/benchmark.h>
 
@@ -13,6 +19,20 @@ void wall_clock_benchmark(benchmark::State& state) {
 }
 BENCHMARK(wall_clock_benchmark);
 
+#if defined(__linux__)
+// clock_gettime() that bypasses the vDSO, for comparison
+void wall_clock_syscall_benchmark(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+    ::timespec tp;
+    benchmark::DoNotOptimize(
+        ::syscall(SYS_clock_gettime, CLOCK_REALTIME, &tp));
+    benchmark::DoNotOptimize(tp);
+  }
+}
+BENCHMARK(wall_clock_syscall_benchmark);
+#endif
+
 void wall_coarse_clock_benchmark(benchmark::State& state) {
   for ([[maybe_unused]] auto _ : state) {
     benchmark::DoNotOptimize(utils::datetime::WallCoarseClock::now());
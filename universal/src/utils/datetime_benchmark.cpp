@@ -0,0 +1,60 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <cctz/time_zone.h>
+
+#include <userver/utils/datetime.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+const std::string kTimestring = "2024-03-15T12:34:56.123456+03:00";
+
+}  // namespace
+
+void DatetimeStringtime(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(utils::datetime::Stringtime(
+        kTimestring, utils::datetime::kDefaultTimezone,
+        utils::datetime::kRfc3339Format));
+  }
+}
+BENCHMARK(DatetimeStringtime);
+
+// The general path of utils::datetime::Stringtime for comparison
+void DatetimeStringtimeCctz(benchmark::State& state) {
+  const auto& timezone = cctz::utc_time_zone();
+  for ([[maybe_unused]] auto _ : state) {
+    std::chrono::system_clock::time_point tp;
+    benchmark::DoNotOptimize(
+        cctz::parse(utils::datetime::kRfc3339Format, kTimestring, timezone,
+                    &tp));
+    benchmark::DoNotOptimize(tp);
+  }
+}
+BENCHMARK(DatetimeStringtimeCctz);
+
+void DatetimeTimestring(benchmark::State& state) {
+  const auto tp = utils::datetime::Stringtime(kTimestring);
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(utils::datetime::Timestring(
+        tp, utils::datetime::kDefaultTimezone,
+        utils::datetime::kRfc3339Format));
+  }
+}
+BENCHMARK(DatetimeTimestring);
+
+// The general path of utils::datetime::Timestring for comparison
+void DatetimeTimestringCctz(benchmark::State& state) {
+  const auto tp = utils::datetime::Stringtime(kTimestring);
+  const auto& timezone = cctz::utc_time_zone();
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(
+        cctz::format(utils::datetime::kRfc3339Format, tp, timezone));
+  }
+}
+BENCHMARK(DatetimeTimestringCctz);
+
+USERVER_NAMESPACE_END
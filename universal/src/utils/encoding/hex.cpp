@@ -1,10 +1,13 @@
 #include <userver/utils/encoding/hex.hpp>
 
+#include <cstdint>
 #include <stdexcept>
 #include <string_view>
 
 #ifdef __SSSE3__
 #include <tmmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
 #endif
 
 USERVER_NAMESPACE_BEGIN
@@ -164,6 +167,23 @@ void ToHex(std::string_view input, std::string& out) noexcept {
     first += 8;
     dst += 16;
   }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  const auto digits =
+      vld1q_u8(reinterpret_cast<const std::uint8_t*>(detail::kXdigits.data()));
+  const auto low_4_bits_mask = vdupq_n_u8(0xf);
+  while (last - first >= 16) {
+    const auto bytes = vld1q_u8(reinterpret_cast<const std::uint8_t*>(first));
+
+    // Looks up the digits of the high and the low 4 bits of each byte, the
+    // interleaving store puts them in order
+    uint8x16x2_t hex_digits;
+    hex_digits.val[0] = vqtbl1q_u8(digits, vshrq_n_u8(bytes, 4));
+    hex_digits.val[1] = vqtbl1q_u8(digits, vandq_u8(bytes, low_4_bits_mask));
+    vst2q_u8(reinterpret_cast<std::uint8_t*>(dst), hex_digits);
+
+    first += 16;
+    dst += 32;
+  }
 #endif
 
   while (first != last) {
@@ -0,0 +1,58 @@
+#include <userver/utils/encoding/json_string.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace std::string_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string EncodeEach(std::string_view str) {
+  std::string result;
+  for (const char c : str) {
+    utils::encoding::EncodeJsonString(std::back_inserter(result), c);
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(JsonString, Basic) {
+  std::string result;
+  utils::encoding::EncodeJsonString(result, "say \"hi\"\\\n\t\r\b\f\x01"s);
+  EXPECT_EQ(result, R"(say \"hi\"\\\n\t\r\b\f\u0001)");
+}
+
+TEST(JsonString, Utf8IsNotEscaped) {
+  std::string result;
+  utils::encoding::EncodeJsonString(result, "привет, 世界");
+  EXPECT_EQ(result, "привет, 世界");
+}
+
+TEST(JsonString, AllOffsetsAndSizes) {
+  // Exercise every block offset and the cut first and last blocks
+  std::string source;
+  for (int i = 0; i < 256; ++i) source.push_back(static_cast<char>(i));
+  source += source;
+
+  for (std::size_t offset = 0; offset < 64; ++offset) {
+    for (std::size_t size = 0; size + offset <= source.size(); size += 7) {
+      const std::string_view str{source.data() + offset, size};
+      std::string result;
+      utils::encoding::EncodeJsonString(result, str);
+      ASSERT_EQ(result, EncodeEach(str))
+          << "offset=" << offset << " size=" << size;
+    }
+  }
+}
+
+TEST(JsonString, AppendsToContainer) {
+  std::string result = "prefix:";
+  utils::encoding::EncodeJsonString(result, "a\"b");
+  EXPECT_EQ(result, R"(prefix:a\"b)");
+}
+
+USERVER_NAMESPACE_END
@@ -1,47 +1,173 @@
 #include <userver/utils/regex.hpp>
 
+#include <algorithm>
 #include <iterator>
+#include <memory>
+#include <stdexcept>
 
 #include <boost/regex.hpp>
+#include <fmt/format.h>
+
+#ifdef USERVER_FEATURE_RE2_ENABLED
+#include <re2/re2.h>
+#include <re2/set.h>
+#else
+namespace re2 {
+class RE2;
+}  // namespace re2
+#endif
 
 USERVER_NAMESPACE_BEGIN
 
 namespace utils {
 
+#ifdef USERVER_FEATURE_RE2_ENABLED
+namespace {
+
+re2::RE2::Options MakeRe2Options() {
+  re2::RE2::Options options;
+  // Errors are reported with exceptions instead
+  options.set_log_errors(false);
+  return options;
+}
+
+re2::StringPiece ToStringPiece(std::string_view str) noexcept {
+  return {str.data(), str.size()};
+}
+
+std::shared_ptr<const re2::RE2> CompileRe2(std::string_view pattern) {
+  auto result = std::make_shared<const re2::RE2>(ToStringPiece(pattern),
+                                                 MakeRe2Options());
+  if (!result->ok()) {
+    throw std::runtime_error(fmt::format("Invalid regex '{}': {}", pattern,
+                                         result->error()));
+  }
+  return result;
+}
+
+// Appends `repl` with $&, $n, ${n} and $$ substituted, as the Perl format
+// of boost::regex_replace does
+void AppendReplacement(std::string& res, std::string_view repl,
+                       const std::vector<re2::StringPiece>& groups) {
+  const auto append_group = [&](std::size_t group) {
+    if (group < groups.size() && groups[group].data()) {
+      res.append(groups[group].data(), groups[group].size());
+    }
+  };
+
+  for (std::size_t i = 0; i < repl.size(); ++i) {
+    if (repl[i] != '$' || i + 1 == repl.size()) {
+      res += repl[i];
+      continue;
+    }
+
+    const char next = repl[i + 1];
+    if (next == '$') {
+      res += '$';
+      ++i;
+    } else if (next == '&') {
+      append_group(0);
+      ++i;
+    } else if (next >= '0' && next <= '9') {
+      append_group(next - '0');
+      ++i;
+    } else if (next == '{') {
+      const auto close = repl.find('}', i + 2);
+      std::size_t group = 0;
+      bool is_number = close != std::string_view::npos && close != i + 2;
+      for (auto j = i + 2; is_number && j < close; ++j) {
+        is_number = repl[j] >= '0' && repl[j] <= '9';
+        group = group * 10 + (repl[j] - '0');
+      }
+      if (!is_number) {
+        res += repl[i];
+        continue;
+      }
+      append_group(group);
+      i = close;
+    } else {
+      res += repl[i];
+    }
+  }
+}
+
+}  // namespace
+#endif
+
 struct regex::Impl {
   boost::regex r;
+  std::shared_ptr<const re2::RE2> linear;
 
   Impl() = default;
   explicit Impl(std::string_view pattern) : r(pattern.begin(), pattern.end()) {}
+
+  Impl(std::string_view pattern, RegexEngine engine) {
+#ifdef USERVER_FEATURE_RE2_ENABLED
+    if (engine == RegexEngine::kLinear) {
+      linear = CompileRe2(pattern);
+      return;
+    }
+#else
+    static_cast<void>(engine);
+#endif
+    r.assign(pattern.begin(), pattern.end());
+  }
 };
 
 regex::regex() = default;
 
 regex::regex(std::string_view pattern) : impl_(regex::Impl(pattern)) {}
 
+regex::regex(std::string_view pattern, RegexEngine engine)
+    : impl_(regex::Impl(pattern, engine)) {}
+
 regex::~regex() = default;
 
 regex::regex(const regex&) = default;
 
-regex::regex(regex&& r) noexcept { impl_->r.swap(r.impl_->r); }
+regex::regex(regex&& r) noexcept {
+  impl_->r.swap(r.impl_->r);
+  impl_->linear.swap(r.impl_->linear);
+}
 
 regex& regex::operator=(const regex&) = default;
 
 regex& regex::operator=(regex&& r) noexcept {
   impl_->r.swap(r.impl_->r);
+  impl_->linear.swap(r.impl_->linear);
   return *this;
 }
 
 bool regex::operator==(const regex& other) const {
+#ifdef USERVER_FEATURE_RE2_ENABLED
+  if (impl_->linear || other.impl_->linear) {
+    return impl_->linear && other.impl_->linear &&
+           impl_->linear->pattern() == other.impl_->linear->pattern();
+  }
+#endif
   return impl_->r == other.impl_->r;
 }
 
-std::string regex::str() const { return impl_->r.str(); }
+std::string regex::str() const {
+#ifdef USERVER_FEATURE_RE2_ENABLED
+  if (impl_->linear) return impl_->linear->pattern();
+#endif
+  return impl_->r.str();
+}
+
+RegexEngine regex::GetEngine() const noexcept {
+  return impl_->linear ? RegexEngine::kLinear : RegexEngine::kBoost;
+}
 
 ////////////////////////////////////////////////////////////////
 
 struct match_results::Impl {
   boost::cmatch m;
+#ifdef USERVER_FEATURE_RE2_ENABLED
+  // Filled instead of `m` for the RegexEngine::kLinear patterns. The storage
+  // is reused by the subsequent matches.
+  std::vector<re2::StringPiece> groups;
+#endif
 
   Impl() = default;
 };
@@ -54,30 +180,91 @@ match_results::match_results(const match_results&) = default;
 
 match_results& match_results::operator=(const match_results&) = default;
 
-std::size_t match_results::size() const { return impl_->m.size(); }
+std::size_t match_results::size() const {
+#ifdef USERVER_FEATURE_RE2_ENABLED
+  if (!impl_->groups.empty()) return impl_->groups.size();
+#endif
+  return impl_->m.size();
+}
 
 std::string_view match_results::operator[](int sub) const {
+#ifdef USERVER_FEATURE_RE2_ENABLED
+  if (!impl_->groups.empty()) {
+    const auto& group = impl_->groups[sub];
+    return {group.data(), group.size()};
+  }
+#endif
   auto substr = impl_->m[sub];
   return {&*substr.begin(), static_cast<std::size_t>(substr.length())};
 }
 
 ////////////////////////////////////////////////////////////////
 
+#ifdef USERVER_FEATURE_RE2_ENABLED
+namespace {
+
+bool LinearMatch(std::string_view str, std::vector<re2::StringPiece>* groups,
+                 const re2::RE2& pattern, re2::RE2::Anchor anchor) {
+  if (!groups) {
+    return pattern.Match(ToStringPiece(str), 0, str.size(), anchor, nullptr,
+                         0);
+  }
+
+  const auto groups_count = 1 + pattern.NumberOfCapturingGroups();
+  groups->assign(groups_count, {});
+  const bool matched = pattern.Match(ToStringPiece(str), 0, str.size(), anchor,
+                                     groups->data(), groups_count);
+  if (!matched) {
+    // Mimic boost: a failed match has empty groups pointing to the input
+    groups->assign(groups_count, re2::StringPiece{str.data(), 0});
+  }
+  return matched;
+}
+
+}  // namespace
+#endif
+
 bool regex_match(std::string_view str, const regex& pattern) {
+#ifdef USERVER_FEATURE_RE2_ENABLED
+  if (pattern.impl_->linear) {
+    return LinearMatch(str, nullptr, *pattern.impl_->linear,
+                       re2::RE2::ANCHOR_BOTH);
+  }
+#endif
   return boost::regex_match(str.begin(), str.end(), pattern.impl_->r);
 }
 
 bool regex_match(std::string_view str, match_results& m, const regex& pattern) {
+#ifdef USERVER_FEATURE_RE2_ENABLED
+  if (pattern.impl_->linear) {
+    return LinearMatch(str, &m.impl_->groups, *pattern.impl_->linear,
+                       re2::RE2::ANCHOR_BOTH);
+  }
+  m.impl_->groups.clear();
+#endif
   return boost::regex_match(str.begin(), str.end(), m.impl_->m,
                             pattern.impl_->r);
 }
 
 bool regex_search(std::string_view str, const regex& pattern) {
+#ifdef USERVER_FEATURE_RE2_ENABLED
+  if (pattern.impl_->linear) {
+    return LinearMatch(str, nullptr, *pattern.impl_->linear,
+                       re2::RE2::UNANCHORED);
+  }
+#endif
   return boost::regex_search(str.begin(), str.end(), pattern.impl_->r);
 }
 
 bool regex_search(std::string_view str, match_results& m,
                   const regex& pattern) {
+#ifdef USERVER_FEATURE_RE2_ENABLED
+  if (pattern.impl_->linear) {
+    return LinearMatch(str, &m.impl_->groups, *pattern.impl_->linear,
+                       re2::RE2::UNANCHORED);
+  }
+  m.impl_->groups.clear();
+#endif
   return boost::regex_search(str.begin(), str.end(), m.impl_->m,
                              pattern.impl_->r);
 }
@@ -87,12 +274,124 @@ std::string regex_replace(std::string_view str, const regex& pattern,
   std::string res;
   res.reserve(str.size() + str.size() / 4);
 
+#ifdef USERVER_FEATURE_RE2_ENABLED
+  if (pattern.impl_->linear) {
+    const auto& re = *pattern.impl_->linear;
+    const auto text = ToStringPiece(str);
+    const auto groups_count = 1 + re.NumberOfCapturingGroups();
+    std::vector<re2::StringPiece> groups(groups_count);
+
+    std::size_t pos = 0;
+    while (pos <= str.size() &&
+           re.Match(text, pos, str.size(), re2::RE2::UNANCHORED, groups.data(),
+                    groups_count)) {
+      const auto match_begin =
+          static_cast<std::size_t>(groups[0].data() - str.data());
+      const auto match_end = match_begin + groups[0].size();
+      res.append(str.data() + pos, match_begin - pos);
+      AppendReplacement(res, repl, groups);
+
+      pos = match_end;
+      if (groups[0].empty()) {
+        // Step over a character to not find the same empty match again
+        if (pos < str.size()) res += str[pos];
+        ++pos;
+      }
+    }
+    if (pos < str.size()) res.append(str.data() + pos, str.size() - pos);
+    return res;
+  }
+#endif
+
   boost::regex_replace(std::back_inserter(res), str.begin(), str.end(),
                        pattern.impl_->r, repl);
 
   return res;
 }
 
+////////////////////////////////////////////////////////////////
+
+struct RegexSet::Impl {
+#ifdef USERVER_FEATURE_RE2_ENABLED
+  std::shared_ptr<const re2::RE2::Set> set;
+#else
+  std::vector<boost::regex> patterns;
+#endif
+  std::size_t size{0};
+
+  explicit Impl(const std::vector<std::string>& patterns);
+};
+
+RegexSet::Impl::Impl(const std::vector<std::string>& patterns_to_compile)
+    : size(patterns_to_compile.size()) {
+#ifdef USERVER_FEATURE_RE2_ENABLED
+  auto compiled = std::make_shared<re2::RE2::Set>(MakeRe2Options(),
+                                                  re2::RE2::UNANCHORED);
+  std::string error;
+  for (const auto& pattern : patterns_to_compile) {
+    if (compiled->Add(ToStringPiece(pattern), &error) < 0) {
+      throw std::runtime_error(
+          fmt::format("Invalid regex '{}': {}", pattern, error));
+    }
+  }
+  if (!compiled->Compile()) {
+    throw std::runtime_error("Failed to compile the regex set: out of memory");
+  }
+  set = std::move(compiled);
+#else
+  patterns.reserve(size);
+  for (const auto& pattern : patterns_to_compile) {
+    patterns.emplace_back(pattern);
+  }
+#endif
+}
+
+RegexSet::RegexSet(const std::vector<std::string>& patterns)
+    : impl_(Impl{patterns}) {}
+
+RegexSet::~RegexSet() = default;
+
+RegexSet::RegexSet(const RegexSet&) = default;
+
+RegexSet::RegexSet(RegexSet&&) noexcept = default;
+
+RegexSet& RegexSet::operator=(const RegexSet&) = default;
+
+RegexSet& RegexSet::operator=(RegexSet&&) noexcept = default;
+
+std::vector<std::size_t> RegexSet::Search(std::string_view str) const {
+  std::vector<std::size_t> result;
+#ifdef USERVER_FEATURE_RE2_ENABLED
+  if (impl_->size == 0) return result;
+
+  std::vector<int> matched;
+  impl_->set->Match(ToStringPiece(str), &matched);
+  result.assign(matched.begin(), matched.end());
+  std::sort(result.begin(), result.end());
+#else
+  for (std::size_t i = 0; i < impl_->patterns.size(); ++i) {
+    if (boost::regex_search(str.begin(), str.end(), impl_->patterns[i])) {
+      result.push_back(i);
+    }
+  }
+#endif
+  return result;
+}
+
+bool RegexSet::SearchAny(std::string_view str) const {
+#ifdef USERVER_FEATURE_RE2_ENABLED
+  return impl_->size != 0 && impl_->set->Match(ToStringPiece(str), nullptr);
+#else
+  return std::any_of(impl_->patterns.begin(), impl_->patterns.end(),
+                     [str](const boost::regex& pattern) {
+                       return boost::regex_search(str.begin(), str.end(),
+                                                  pattern);
+                     });
+#endif
+}
+
+std::size_t RegexSet::size() const noexcept { return impl_->size; }
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/utils/regex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kPath = "/v1/orders/1234567/items/890?lang=en";
+
+std::vector<std::string> GeneratePatterns(std::size_t count) {
+  std::vector<std::string> patterns;
+  patterns.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    patterns.push_back(fmt::format("^/v{}/[a-z]+/[0-9]+/items/[0-9]+$", i + 2));
+  }
+  return patterns;
+}
+
+utils::RegexEngine GetEngine(const benchmark::State& state) {
+  return state.range(0) ? utils::RegexEngine::kLinear
+                        : utils::RegexEngine::kBoost;
+}
+
+}  // namespace
+
+void RegexConstruct(benchmark::State& state) {
+  const auto engine = GetEngine(state);
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(
+        utils::regex{"^/v[0-9]+/([a-z]+)/([0-9]+)(/items/[0-9]+)?", engine});
+  }
+}
+BENCHMARK(RegexConstruct)->Arg(0)->Arg(1);
+
+void RegexSearch(benchmark::State& state) {
+  const utils::regex r{"([a-z]+)/([0-9]+)/items", GetEngine(state)};
+  utils::match_results m;
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(utils::regex_search(kPath, m, r));
+  }
+}
+BENCHMARK(RegexSearch)->Arg(0)->Arg(1);
+
+void RegexSearchEach(benchmark::State& state) {
+  std::vector<utils::regex> regexes;
+  for (const auto& pattern : GeneratePatterns(state.range(1))) {
+    regexes.emplace_back(pattern, GetEngine(state));
+  }
+
+  for ([[maybe_unused]] auto _ : state) {
+    for (const auto& r : regexes) {
+      benchmark::DoNotOptimize(utils::regex_search(kPath, r));
+    }
+  }
+}
+BENCHMARK(RegexSearchEach)->ArgsProduct({{0, 1}, {1, 8, 64}});
+
+void RegexSetSearch(benchmark::State& state) {
+  const utils::RegexSet set{GeneratePatterns(state.range(0))};
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(set.SearchAny(kPath));
+  }
+}
+BENCHMARK(RegexSetSearch)->Arg(1)->Arg(8)->Arg(64);
+
+USERVER_NAMESPACE_END
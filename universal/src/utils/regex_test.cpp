@@ -2,6 +2,8 @@
 
 #include <userver/utils/regex.hpp>
 
+#include <stdexcept>
+
 USERVER_NAMESPACE_BEGIN
 
 TEST(Regex, Ctors) {
@@ -76,4 +78,88 @@ TEST(Regex, MatchWithResult) {
   EXPECT_EQ(res, str);
 }
 
+TEST(Regex, LinearEngine) {
+  const utils::regex r("^([a-z])([0-9]+)", utils::RegexEngine::kLinear);
+  EXPECT_EQ(r.str(), "^([a-z])([0-9]+)");
+  EXPECT_EQ(r, utils::regex("^([a-z])([0-9]+)", utils::RegexEngine::kLinear));
+  if (r.GetEngine() == utils::RegexEngine::kLinear) {
+    EXPECT_FALSE(r == utils::regex("^([a-z])([0-9]+)"));
+  }
+
+  EXPECT_FALSE(utils::regex_match("a", r));
+  EXPECT_TRUE(utils::regex_match("a123", r));
+  EXPECT_FALSE(utils::regex_match("a123a", r));
+  EXPECT_TRUE(utils::regex_search("a123a", r));
+  EXPECT_FALSE(utils::regex_search("1a123", r));
+
+  utils::match_results m;
+  EXPECT_FALSE(utils::regex_search("", m, r));
+  ASSERT_EQ(m.size(), 3);
+  EXPECT_EQ(m[0], "");
+
+  EXPECT_TRUE(utils::regex_match("b42", m, r));
+  ASSERT_EQ(m.size(), 3);
+  EXPECT_EQ(m[0], "b42");
+  EXPECT_EQ(m[1], "b");
+  EXPECT_EQ(m[2], "42");
+
+  const utils::regex boost_regex("[0-9]");
+  EXPECT_TRUE(utils::regex_search("x1", m, boost_regex));
+  ASSERT_EQ(m.size(), 1);
+  EXPECT_EQ(m[0], "1");
+}
+
+TEST(Regex, LinearEngineReplace) {
+  const utils::regex r("([a-z])([0-9])", utils::RegexEngine::kLinear);
+  EXPECT_EQ(utils::regex_replace("", r, "R"), "");
+  EXPECT_EQ(utils::regex_replace("a1-b2-C3", r, "$2$1"), "1a-2b-C3");
+  EXPECT_EQ(utils::regex_replace("a1", r, "<$&|${2}|$$>"), "<a1|1|$>");
+
+  const utils::regex empty_match("x*", utils::RegexEngine::kLinear);
+  EXPECT_EQ(utils::regex_replace("abc", empty_match, "-"),
+            utils::regex_replace("abc", utils::regex("x*"), "-"));
+}
+
+TEST(Regex, LinearEngineIsLinear) {
+  // Catastrophic backtracking pattern for the backtracking engines
+  const utils::regex r("(a+)+$", utils::RegexEngine::kLinear);
+  const std::string input = std::string(100'000, 'a') + "b";
+  if (r.GetEngine() == utils::RegexEngine::kLinear) {
+    EXPECT_FALSE(utils::regex_search(input, r));
+  }
+  EXPECT_TRUE(utils::regex_search("aaa", r));
+}
+
+TEST(Regex, InvalidPattern) {
+  EXPECT_THROW(utils::regex("(", utils::RegexEngine::kLinear),
+               std::runtime_error);
+  EXPECT_THROW(utils::regex("(", utils::RegexEngine::kBoost),
+               std::runtime_error);
+}
+
+TEST(RegexSet, Search) {
+  const utils::RegexSet set({"^/v1/", "user", "[0-9]{3}$"});
+  EXPECT_EQ(set.size(), 3);
+
+  EXPECT_EQ(set.Search("/v1/user/123"), (std::vector<std::size_t>{0, 1, 2}));
+  EXPECT_EQ(set.Search("/v2/user/123"), (std::vector<std::size_t>{1, 2}));
+  EXPECT_EQ(set.Search("/v2/order/12"), std::vector<std::size_t>{});
+  EXPECT_TRUE(set.SearchAny("/v1/order"));
+  EXPECT_FALSE(set.SearchAny("/v2/order"));
+
+  const auto copy = set;
+  EXPECT_EQ(copy.Search("/v1/"), std::vector<std::size_t>{0});
+}
+
+TEST(RegexSet, Empty) {
+  const utils::RegexSet set({});
+  EXPECT_EQ(set.size(), 0);
+  EXPECT_EQ(set.Search("abc"), std::vector<std::size_t>{});
+  EXPECT_FALSE(set.SearchAny("abc"));
+}
+
+TEST(RegexSet, InvalidPattern) {
+  EXPECT_THROW(utils::RegexSet({"a", "("}), std::runtime_error);
+}
+
 USERVER_NAMESPACE_END
@@ -1,7 +1,9 @@
 #include <userver/utils/trivial_map.hpp>
 
+#include <array>
 #include <mutex>
 #include <optional>
+#include <string_view>
 #include <unordered_map>
 
 #include <benchmark/benchmark.h>
@@ -131,6 +133,71 @@ const auto kHugeUnorderedMapping = std::unordered_map<std::string_view, int>{
     {"aaaaaaaaaaaaaaaa_x9", 42},
 };
 
+// Big maps, like the ones generated for enums with hundreds of values
+constexpr std::size_t kBigSize = 256;
+constexpr std::size_t kBigKeyMaxSize = 32;
+
+constexpr auto kBigKeysStorage = [] {
+  constexpr std::string_view kPrefix = "x-generated-";
+  std::array<char, kBigSize * kBigKeyMaxSize> storage{};
+  for (std::size_t i = 0; i < kBigSize; ++i) {
+    auto* key = storage.data() + i * kBigKeyMaxSize;
+    for (std::size_t j = 0; j < kPrefix.size(); ++j) key[j] = kPrefix[j];
+    key += kPrefix.size();
+    // Keys of different lengths, as in real enums
+    for (std::size_t j = 0; j < i % 13; ++j) *key++ = 'a' + (i + j) % 26;
+    *key++ = '0' + i / 100;
+    *key++ = '0' + i / 10 % 10;
+    *key++ = '0' + i % 10;
+  }
+  return storage;
+}();
+
+constexpr auto kBigKeys = [] {
+  std::array<std::string_view, kBigSize> keys{};
+  for (std::size_t i = 0; i < kBigSize; ++i) {
+    std::string_view key{kBigKeysStorage.data() + i * kBigKeyMaxSize,
+                         kBigKeyMaxSize};
+    keys[i] = key.substr(0, key.find('\0'));
+  }
+  return keys;
+}();
+
+constexpr auto kBigValues = [] {
+  std::array<int, kBigSize> values{};
+  for (std::size_t i = 0; i < kBigSize; ++i) values[i] = static_cast<int>(i);
+  return values;
+}();
+
+// Searches with the perfect hash
+constexpr auto kBigTrivialBiMap =
+    utils::MakeTrivialBiMap<kBigKeys, kBigValues>();
+
+// Searches by comparing the keys one by one, as the small maps do
+std::optional<int> FindBigLinear(std::string_view key) {
+  return utils::impl::TrivialBiMapMultiCaseDispatch<kBigKeys, kBigValues>{}(
+             [key]() {
+               return utils::impl::SwitchByFirst<std::string_view, int>{key};
+             })
+      .Extract();
+}
+
+const auto kBigUnorderedMapping = [] {
+  std::unordered_map<std::string_view, int> mapping;
+  for (std::size_t i = 0; i < kBigSize; ++i) {
+    mapping.emplace(kBigKeys[i], kBigValues[i]);
+  }
+  return mapping;
+}();
+
+std::array<std::string_view, 16> MakeBigLookups() {
+  std::array<std::string_view, 16> lookups{};
+  for (std::size_t i = 0; i < lookups.size(); ++i) {
+    lookups[i] = MyLaunder(kBigKeys[i * kBigSize / lookups.size() + i]);
+  }
+  return lookups;
+}
+
 enum class Enum1 {
   C1,
   C2,
@@ -447,6 +514,39 @@ void MappingHugeUnorderedLast(benchmark::State& state) {
 }
 BENCHMARK(MappingHugeUnorderedLast);
 
+void MappingBigTrivialBiMap(benchmark::State& state) {
+  const auto lookups = MakeBigLookups();
+
+  for ([[maybe_unused]] auto _ : state) {
+    for (auto key : lookups) {
+      benchmark::DoNotOptimize(kBigTrivialBiMap.TryFind(key));
+    }
+  }
+}
+BENCHMARK(MappingBigTrivialBiMap);
+
+void MappingBigLinear(benchmark::State& state) {
+  const auto lookups = MakeBigLookups();
+
+  for ([[maybe_unused]] auto _ : state) {
+    for (auto key : lookups) {
+      benchmark::DoNotOptimize(FindBigLinear(key));
+    }
+  }
+}
+BENCHMARK(MappingBigLinear);
+
+void MappingBigUnordered(benchmark::State& state) {
+  const auto lookups = MakeBigLookups();
+
+  for ([[maybe_unused]] auto _ : state) {
+    for (auto key : lookups) {
+      benchmark::DoNotOptimize(kBigUnorderedMapping.find(key));
+    }
+  }
+}
+BENCHMARK(MappingBigUnordered);
+
 void MappingEnumsTrivialBiMap(benchmark::State& state) {
   const auto enum2 = Launder(Enum2::C7);
 
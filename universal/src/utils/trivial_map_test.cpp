@@ -341,6 +341,155 @@ TEST(TrivialBiMap, StringICase) {
       "\xf0\xe1\xf2\xf3\xf4\xf5\xf6\xf7\xf8\xf9\xfa\xfb\xfc\xfd\xfe\xff"));
 }
 
+constexpr std::string_view kHeaderNames[] = {
+    "accept",
+    "accept-charset",
+    "accept-encoding",
+    "accept-language",
+    "accept-ranges",
+    "access-control-allow-origin",
+    "age",
+    "allow",
+    "authorization",
+    "cache-control",
+    "connection",
+    "content-disposition",
+    "content-encoding",
+    "content-language",
+    "content-length",
+    "content-location",
+    "content-range",
+    "content-type",
+    "cookie",
+    "date",
+    "etag",
+    "expect",
+    "expires",
+    "from",
+    "host",
+    "if-match",
+    "if-modified-since",
+    "if-none-match",
+    "if-range",
+    "if-unmodified-since",
+    "last-modified",
+    "link",
+    "location",
+    "max-forwards",
+    "proxy-authenticate",
+    "proxy-authorization",
+    "range",
+    "referer",
+    "refresh",
+    "retry-after",
+    "server",
+    "set-cookie",
+    "strict-transport-security",
+    "transfer-encoding",
+    "user-agent",
+    "vary",
+    "via",
+    "www-authenticate",
+    "x-requested-with",
+    "alt-svc",
+    "content-security-policy",
+    "cross-origin-embedder-policy",
+    "cross-origin-opener-policy",
+    "cross-origin-resource-policy",
+    "dnt",
+    "early-data",
+    "forwarded",
+    "keep-alive",
+    "origin",
+    "permissions-policy",
+    "pragma",
+    "priority",
+    "referrer-policy",
+    "sec-fetch-dest",
+    "sec-fetch-mode",
+    "sec-fetch-site",
+    "sec-fetch-user",
+    "server-timing",
+    "te",
+    "timing-allow-origin",
+    "trailer",
+    "upgrade",
+    "upgrade-insecure-requests",
+    "warning",
+    "x-content-type-options",
+    "x-forwarded-for",
+    "x-forwarded-host",
+    "x-forwarded-proto",
+    "x-frame-options",
+    "etag",  // duplicates are allowed, the first one is found
+};
+
+constexpr int MakeHeaderIndex(std::size_t index) {
+  return static_cast<int>(index) * 10;
+}
+
+template <std::size_t... Indices>
+constexpr auto MakeHeaderIndices(std::index_sequence<Indices...>) {
+  return std::array<int, sizeof...(Indices)>{MakeHeaderIndex(Indices)...};
+}
+
+constexpr auto kHeaderIndices = MakeHeaderIndices(
+    std::make_index_sequence<std::size(kHeaderNames)>{});
+
+TEST(TrivialBiMap, Big) {
+  static constexpr auto kMap =
+      utils::MakeTrivialBiMap<kHeaderNames, kHeaderIndices>();
+  static_assert(kMap.size() >= utils::impl::kTrivialMapHashThreshold);
+
+  static_assert(kMap.TryFind("accept") == 0);
+  static_assert(kMap.TryFind("etag") == 200);
+  static_assert(kMap.TryFind(790) == "etag");
+
+  for (std::size_t i = 0; i + 1 < std::size(kHeaderNames); ++i) {
+    EXPECT_EQ(kMap.TryFind(kHeaderNames[i]), MakeHeaderIndex(i));
+    EXPECT_EQ(kMap.TryFind(MakeHeaderIndex(i)), kHeaderNames[i]);
+  }
+
+  EXPECT_EQ(kMap.TryFind(""), std::nullopt);
+  EXPECT_EQ(kMap.TryFind("Accept"), std::nullopt);
+  EXPECT_EQ(kMap.TryFind("accept "), std::nullopt);
+  EXPECT_EQ(kMap.TryFind("x-requested-without"), std::nullopt);
+  EXPECT_EQ(kMap.TryFind("x-frame-option"), std::nullopt);
+
+  EXPECT_EQ(kMap.TryFindICase("ACCEPT"), 0);
+  EXPECT_EQ(kMap.TryFindICase("Content-Type"), 170);
+  EXPECT_EQ(kMap.TryFindICase("X-Requested-With"), 480);
+  EXPECT_EQ(kMap.TryFindICase("X-Requested-Wit"), std::nullopt);
+  EXPECT_EQ(kMap.TryFindICase("X-Frame-Options"), 780);
+}
+
+TEST(TrivialBiMap, BigSet) {
+  static constexpr auto kSet = utils::MakeTrivialSet<kHeaderNames>();
+  static_assert(kSet.size() >= utils::impl::kTrivialMapHashThreshold);
+
+  for (std::size_t i = 0; i + 1 < std::size(kHeaderNames); ++i) {
+    EXPECT_EQ(kSet.GetIndex(kHeaderNames[i]), i);
+    EXPECT_TRUE(kSet.Contains(kHeaderNames[i]));
+  }
+  EXPECT_EQ(kSet.GetIndex("etag"), 20);
+
+  EXPECT_FALSE(kSet.Contains("Vary"));
+  EXPECT_TRUE(kSet.ContainsICase("Vary"));
+  EXPECT_FALSE(kSet.ContainsICase("Varyy"));
+  EXPECT_FALSE(kSet.ContainsICase("\xff\xfe"));
+}
+
+TEST(TrivialBiMap, PerfectHashIndex) {
+  static constexpr utils::impl::PerfectHashIndex<3> kIndex{
+      {"foo", "bar", "Baz"}};
+  static_assert(kIndex.IsValid());
+  static_assert(kIndex.FindCandidate("bar") == 1);
+  static_assert(kIndex.FindCandidate("BAZ") == 2);
+
+  // Keys that differ only in case are not supported
+  static_assert(!utils::impl::PerfectHashIndex<2>{{"foo", "FOO"}}.IsValid());
+}
+
 TEST(TrivialBiMap, GetIndex) {
   static constexpr utils::TrivialSet kNames = [](auto selector) {
     return selector().Case("foo").Case("bar").Case("baz");
@@ -350,6 +499,15 @@ TEST(TrivialBiMap, GetIndex) {
   EXPECT_EQ(kNames.GetIndex("aba"), std::nullopt);
 }
 
+TEST(TrivialBiMap, TypedSetSize) {
+  static constexpr utils::TrivialSet kNames = [](auto selector) {
+    return selector().template Type<std::string_view>().Case("foo").Case("bar");
+  };
+
+  static_assert(kNames.size() == 2);
+  EXPECT_EQ(kNames.GetIndex("bar"), 1);
+}
+
 TEST(TrivialBiMap, ConstexprIteration) {
   constexpr auto sum = []() {
     constexpr utils::TrivialBiMap kMap = [](auto selector) {
@@ -50,6 +50,7 @@ class Driver;
 /// databases.<dbname>.min_pool_size | minimum pool size for database with name <dbname> | 10
 /// databases.<dbname>.max_pool_size | maximum pool size for database with name <dbname> | 50
 /// databases.<dbname>.get_session_retry_limit | retries count to get session, every attempt with a get-session-timeout | 5
+/// databases.<dbname>.prewarm_sessions | sessions to create at start, limited by max_pool_size | 0
 /// databases.<dbname>.keep-in-query-cache | whether to use query cache | true
 /// databases.<dbname>.prefer_local_dc | prefer making requests to local DataCenter | false
 /// databases.<dbname>.aliases | list of alias names for this database | []
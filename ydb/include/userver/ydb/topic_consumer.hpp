@@ -0,0 +1,118 @@
+#pragma once
+
+/// @file userver/ydb/topic_consumer.hpp
+/// @brief @copybrief ydb::TopicConsumerScope
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <unordered_map>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/ydb/topic.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ydb {
+
+struct TopicConsumerSettings final {
+  /// Maximum events count fetched from the read session at once,
+  /// the read session chooses it if not specified
+  std::optional<std::size_t> max_events_count;
+
+  /// Maximum data events of a partition session waiting to be processed,
+  /// the reading is paused while the queue of any partition session is full
+  std::size_t max_partition_queue_size{16};
+};
+
+/// @brief RAII class that reads a topic and processes the data events of
+/// every partition session concurrently on a task processor.
+///
+/// The data events of a partition session are processed in the order they
+/// were read, each of them is committed once the callback returns. The
+/// partition sessions are confirmed to the server automatically.
+///
+/// Partition sessions lag, i.e. the messages not committed yet, is reported
+/// in metrics along with the processed messages and batches counts.
+///
+/// @note Must be placed as one of the last fields in the consumer component,
+/// as the callback usually captures `this`.
+class TopicConsumerScope final {
+ public:
+  /// @brief Callback that is invoked on each data event (a batch of
+  /// messages of a single partition).
+  /// @warning If callback throws, the batch is not committed and comes again
+  /// only after the partition session is restarted, e.g. by a new read
+  /// session. The batches of the same partition that are processed
+  /// successfully after that are not committed either, until then.
+  using Callback = std::function<void(
+      NYdb::NTopic::TReadSessionEvent::TDataReceivedEvent& event)>;
+
+  TopicConsumerScope(TopicReadSession&& read_session,
+                     engine::TaskProcessor& task_processor,
+                     TopicConsumerSettings settings = {});
+
+  /// @brief Stops the consumer (if not yet stopped).
+  ~TopicConsumerScope();
+
+  TopicConsumerScope(TopicConsumerScope&&) = delete;
+  TopicConsumerScope& operator=(TopicConsumerScope&&) = delete;
+
+  /// @brief Starts reading the topic and invoking `callback` for the data
+  /// events.
+  void Start(Callback callback);
+
+  /// @brief Stops reading the topic, the data events being processed are
+  /// cancelled. Called in the destructor automatically.
+  void Stop() noexcept;
+
+  /// @cond
+  // For internal use only.
+  struct Statistics final {
+    utils::statistics::RateCounter messages;
+    utils::statistics::RateCounter batches;
+    utils::statistics::RateCounter errors;
+  };
+  /// @endcond
+
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const TopicConsumerScope& consumer);
+
+ private:
+  using DataEvent = NYdb::NTopic::TReadSessionEvent::TDataReceivedEvent;
+  using Queue = concurrent::SpscQueue<std::optional<DataEvent>>;
+
+  struct PartitionSession final {
+    Queue::Producer producer;
+    engine::TaskWithResult<void> task;
+  };
+
+  void Read();
+  bool HandleEvent(NYdb::NTopic::TReadSessionEvent::TEvent& event);
+  void StartPartitionSession(std::uint64_t id);
+  void StopPartitionSession(std::uint64_t id);
+  void ProcessPartitionSession(Queue::Consumer consumer);
+  void UpdateLag(std::uint64_t id, std::uint64_t end_offset,
+                 std::uint64_t committed_offset);
+
+  TopicReadSession read_session_;
+  engine::TaskProcessor& task_processor_;
+  const TopicConsumerSettings settings_;
+  Callback callback_;
+  Statistics stats_;
+  // messages not committed yet by partition session id
+  concurrent::Variable<std::unordered_map<std::uint64_t, std::uint64_t>>
+      lags_;
+  // accessed from the reading task only
+  std::unordered_map<std::uint64_t, PartitionSession> partition_sessions_;
+  engine::TaskWithResult<void> read_task_;
+};
+
+}  // namespace ydb
+
+USERVER_NAMESPACE_END
@@ -247,6 +247,11 @@ properties:
                     minimum: 0
                     defaultDescription: 5
                     description: retries count to get session, every attempt with a get-session-timeout
+                prewarm_sessions:
+                    type: integer
+                    minimum: 0
+                    defaultDescription: 0
+                    description: sessions to create at start, limited by max_pool_size
                 keep-in-query-cache:
                     type: boolean
                     defaultDescription: true
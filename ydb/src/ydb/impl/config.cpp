@@ -42,6 +42,8 @@ TableSettings ParseTableSettings(const yaml_config::YamlConfig& dbconfig,
   result.get_session_retry_limit =
       dbconfig["get_session_retry_limit"].As<std::uint32_t>(
           result.get_session_retry_limit);
+  result.prewarm_sessions =
+      dbconfig["prewarm_sessions"].As<std::uint32_t>(result.prewarm_sessions);
   result.keep_in_query_cache =
       dbconfig["keep-in-query-cache"].As<bool>(result.keep_in_query_cache);
 
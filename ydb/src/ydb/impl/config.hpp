@@ -31,6 +31,7 @@ struct TableSettings {
   std::uint32_t min_pool_size{10};
   std::uint32_t max_pool_size{50};
   std::uint32_t get_session_retry_limit{5};
+  std::uint32_t prewarm_sessions{0};
   bool keep_in_query_cache{true};
   bool sync_start{true};
   std::optional<std::vector<double>> by_database_timings_buckets{};
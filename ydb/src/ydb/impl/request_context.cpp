@@ -147,6 +147,7 @@ RequestContext::RequestContext(TableClient& table_client_, const Query& query,
                                const utils::impl::SourceLocation& location)
     : table_client(table_client_),
       settings(settings),
+      stats(*table_client.stats_),
       initial_uncaught_exceptions(std::uncaught_exceptions()),
       stats_scope(*table_client.stats_, query),
       config_snapshot(table_client.config_source_.GetSnapshot()),
@@ -32,6 +32,7 @@ struct RequestContext final {
 
   TableClient& table_client;
   OperationSettings& settings;
+  Stats& stats;
   const int initial_uncaught_exceptions;
   StatsScope stats_scope;
   dynamic_config::Snapshot config_snapshot;
@@ -2,6 +2,9 @@
 
 #include <ydb-cpp-sdk/client/retry/retry.h>
 
+#include <optional>
+
+#include <userver/utils/datetime.hpp>
 #include <userver/utils/retry_budget.hpp>
 #include <userver/ydb/table.hpp>
 
@@ -42,10 +45,27 @@ auto RetryOperation(impl::RequestContext& request_context, Func&& func) {
 
   auto final_result = utils::MakeSharedRef<std::optional<ResultType>>();
 
+  // TTableClient& operations do not take a session from the pool
+  std::optional<std::chrono::steady_clock::time_point> start;
+  if constexpr (std::is_same_v<FuncArg, NYdb::NTable::TSession>) {
+    start = utils::datetime::SteadyNow();
+  }
+
   return request_context.table_client.GetNativeTableClient()
       .RetryOperation(
           [final_result, func = std::forward<Func>(func),
-           &retry_budget = retry_budget](FuncArg arg) mutable {
+           &retry_budget = retry_budget, &stats = request_context.stats,
+           start = std::move(start)](FuncArg arg) mutable {
+            // Only the first attempt is accounted, the retries also wait for
+            // the backoff
+            if (start) {
+              const auto wait_time = utils::datetime::SteadyNow() - *start;
+              stats.get_session_timings.Account(
+                  std::chrono::duration_cast<std::chrono::milliseconds>(
+                      wait_time)
+                      .count());
+              start.reset();
+            }
             // If `func` throws, `RetryOperation` will immediately rethrow
             // the exception without further retries.
             AsyncResultType result_future = func(std::forward<FuncArg>(arg));
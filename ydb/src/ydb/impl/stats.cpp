@@ -98,7 +98,8 @@ Stats::Stats(utils::span<const double> by_database_histogram_bounds,
           by_database_histogram_bounds)),
       by_query_histogram_bounds(
           utils::AsContainer<std::vector<double>>(by_query_histogram_bounds)),
-      unnamed_queries(by_database_histogram_bounds) {}
+      unnamed_queries(by_database_histogram_bounds),
+      get_session_timings(by_database_histogram_bounds) {}
 
 void DumpMetric(utils::statistics::Writer& writer, const Stats& stats) {
   {
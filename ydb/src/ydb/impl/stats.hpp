@@ -54,6 +54,8 @@ struct Stats final {
   const std::vector<double> by_query_histogram_bounds;
 
   StatsCounters unnamed_queries;
+  // time from the start of an operation until it gets a session
+  utils::statistics::Histogram get_session_timings;
   rcu::RcuMap<std::string, StatsCounters> by_query;
   rcu::RcuMap<std::string, StatsCounters> by_transaction;
 };
@@ -1,5 +1,8 @@
 #include <userver/ydb/table.hpp>
 
+#include <algorithm>
+#include <vector>
+
 #include <userver/engine/deadline.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
@@ -32,6 +35,31 @@ NYdb::NTable::TTxSettings PrepareTxSettings(const OperationSettings& settings) {
   }
 }
 
+// The sessions are held together, so that they are distinct, and go back to
+// the pool idle once released
+void PrewarmSessions(NYdb::NTable::TTableClient& table_client,
+                     std::uint32_t count) {
+  std::vector<NYdb::NTable::TAsyncCreateSessionResult> futures;
+  futures.reserve(count);
+  for (std::uint32_t i = 0; i < count; ++i) {
+    futures.push_back(table_client.GetSession());
+  }
+
+  std::vector<NYdb::NTable::TCreateSessionResult> sessions;
+  sessions.reserve(count);
+  for (auto& future : futures) {
+    auto result = impl::GetFutureValueUnchecked(std::move(future));
+    if (!result.IsSuccess()) {
+      LOG_WARNING() << fmt::format("Failed to prewarm a session: {}",
+                                   result.GetIssues().ToOneLineString());
+      continue;
+    }
+    sessions.push_back(std::move(result));
+  }
+  LOG_INFO() << "Prewarmed " << sessions.size() << " of " << count
+             << " sessions";
+}
+
 }  // namespace
 
 TableClient::TableClient(impl::TableSettings settings,
@@ -61,6 +89,10 @@ TableClient::TableClient(impl::TableSettings settings,
       driver_->GetNativeDriver(), client_config);
   scheme_client_ = std::make_unique<NYdb::NScheme::TSchemeClient>(
       driver_->GetNativeDriver(), client_config);
+  if (settings.prewarm_sessions) {
+    PrewarmSessions(*table_client_, std::min(settings.prewarm_sessions,
+                                             settings.max_pool_size));
+  }
   if (settings.sync_start) {
     LOG_DEBUG() << "Synchronously starting ydb client with name '"
                 << driver_->GetDbName() << "'";
@@ -342,6 +374,8 @@ void DumpMetric(utils::statistics::Writer& writer,
       table_client.table_client_->GetActiveSessionCount();
   writer["pool"]["max-size"] =
       table_client.table_client_->GetActiveSessionsLimit();
+  writer["pool"]["get-session-timings"] =
+      table_client.stats_->get_session_timings;
 }
 
 PreparedArgsBuilder TableClient::GetBuilder() const {
@@ -0,0 +1,176 @@
+#include <userver/ydb/topic_consumer.hpp>
+
+#include <fmt/format.h>
+
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/overloaded.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/ydb/exceptions.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ydb {
+
+TopicConsumerScope::TopicConsumerScope(TopicReadSession&& read_session,
+                                       engine::TaskProcessor& task_processor,
+                                       TopicConsumerSettings settings)
+    : read_session_(std::move(read_session)),
+      task_processor_(task_processor),
+      settings_(std::move(settings)) {}
+
+TopicConsumerScope::~TopicConsumerScope() { Stop(); }
+
+void TopicConsumerScope::Start(Callback callback) {
+  UINVARIANT(!read_task_.IsValid(), "Topic consumer is already started");
+  callback_ = std::move(callback);
+  read_task_ = utils::CriticalAsync(task_processor_, "ydb_topic_consumer",
+                                    [this] { Read(); });
+}
+
+void TopicConsumerScope::Stop() noexcept {
+  if (!read_task_.IsValid()) return;
+
+  read_task_.SyncCancel();
+  read_task_ = {};
+}
+
+void TopicConsumerScope::Read() {
+  try {
+    bool keep_reading = true;
+    while (keep_reading && !engine::current_task::ShouldCancel()) {
+      auto events = read_session_.GetEvents(settings_.max_events_count);
+      for (auto& event : events) {
+        keep_reading = HandleEvent(event) && keep_reading;
+      }
+    }
+  } catch (const OperationCancelledError&) {
+    // the consumer is stopped
+  } catch (const std::exception& ex) {
+    if (!engine::current_task::ShouldCancel()) {
+      LOG_ERROR() << "Topic consumer stopped reading: " << ex;
+    }
+  }
+
+  // Cancels the processing of the partition sessions
+  partition_sessions_.clear();
+}
+
+bool TopicConsumerScope::HandleEvent(
+    NYdb::NTopic::TReadSessionEvent::TEvent& event) {
+  using NYdb::NTopic::TReadSessionEvent;
+
+  return std::visit(
+      utils::Overloaded{
+          [this](TReadSessionEvent::TDataReceivedEvent& e) {
+            const auto id = e.GetPartitionSession()->GetPartitionSessionId();
+            const auto it = partition_sessions_.find(id);
+            if (it == partition_sessions_.end()) {
+              LOG_WARNING() << "Data for unknown partition session " << id;
+              return true;
+            }
+            // Waits while the partition session queue is full
+            it->second.producer.Push(std::optional{std::move(e)});
+            return true;
+          },
+          [this](TReadSessionEvent::TStartPartitionSessionEvent& e) {
+            const auto id = e.GetPartitionSession()->GetPartitionSessionId();
+            StartPartitionSession(id);
+            UpdateLag(id, e.GetEndOffset(), e.GetCommittedOffset());
+            e.Confirm();
+            return true;
+          },
+          [this](TReadSessionEvent::TStopPartitionSessionEvent& e) {
+            StopPartitionSession(
+                e.GetPartitionSession()->GetPartitionSessionId());
+            e.Confirm();
+            return true;
+          },
+          [this](TReadSessionEvent::TPartitionSessionClosedEvent& e) {
+            StopPartitionSession(
+                e.GetPartitionSession()->GetPartitionSessionId());
+            return true;
+          },
+          [this](TReadSessionEvent::TPartitionSessionStatusEvent& e) {
+            UpdateLag(e.GetPartitionSession()->GetPartitionSessionId(),
+                      e.GetEndOffset(), e.GetCommittedOffset());
+            return true;
+          },
+          [](NYdb::NTopic::TSessionClosedEvent& e) {
+            LOG_ERROR() << fmt::format("Topic read session is closed: {}",
+                                       e.DebugString());
+            return false;
+          },
+          [](auto&) {
+            // nothing to do for the rest of events
+            return true;
+          }},
+      event);
+}
+
+void TopicConsumerScope::StartPartitionSession(std::uint64_t id) {
+  auto queue = Queue::Create(settings_.max_partition_queue_size);
+  auto task = utils::Async(
+      task_processor_, "ydb_topic_partition_session",
+      [this, consumer = queue->GetConsumer()]() mutable {
+        ProcessPartitionSession(std::move(consumer));
+      });
+  partition_sessions_.insert_or_assign(
+      id, PartitionSession{queue->GetProducer(), std::move(task)});
+}
+
+void TopicConsumerScope::StopPartitionSession(std::uint64_t id) {
+  const auto it = partition_sessions_.find(id);
+  if (it == partition_sessions_.end()) return;
+
+  // The events already read are processed before the partition session is
+  // confirmed to stop
+  auto task = std::move(it->second.task);
+  partition_sessions_.erase(it);
+  task.Wait();
+  lags_.Lock()->erase(id);
+}
+
+void TopicConsumerScope::ProcessPartitionSession(Queue::Consumer consumer) {
+  std::optional<DataEvent> event;
+  while (consumer.Pop(event)) {
+    try {
+      callback_(*event);
+      event->Commit();
+      stats_.messages += event->GetMessagesCount();
+      ++stats_.batches;
+    } catch (const std::exception& ex) {
+      LOG_ERROR() << "Failed to process topic messages: " << ex;
+      ++stats_.errors;
+    }
+    event->GetPartitionSession()->RequestStatus();
+    event.reset();
+  }
+}
+
+void TopicConsumerScope::UpdateLag(std::uint64_t id, std::uint64_t end_offset,
+                                   std::uint64_t committed_offset) {
+  auto lags = lags_.Lock();
+  (*lags)[id] = end_offset > committed_offset ? end_offset - committed_offset
+                                              : 0;
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const TopicConsumerScope& consumer) {
+  writer["messages"] = consumer.stats_.messages;
+  writer["batches"] = consumer.stats_.batches;
+  writer["errors"] = consumer.stats_.errors;
+
+  std::uint64_t lag = 0;
+  {
+    const auto lags = consumer.lags_.Lock();
+    for (const auto& [id, partition_lag] : *lags) lag += partition_lag;
+  }
+  writer["lag"] = lag;
+}
+
+}  // namespace ydb
+
+USERVER_NAMESPACE_END
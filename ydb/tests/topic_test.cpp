@@ -1,8 +1,12 @@
 #include <userver/utest/utest.hpp>
 
+#include <atomic>
+
 #include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/utils/overloaded.hpp>
 #include <userver/ydb/impl/cast.hpp>
+#include <userver/ydb/topic_consumer.hpp>
 
 #include "test_utils.hpp"
 
@@ -149,6 +153,39 @@ UTEST_F(YdbTopicFixture, TopicReadSessionGetEvents) {
   DropConsumer(kTopicPath, kConsumerName);
 }
 
+UTEST_F(YdbTopicFixture, TopicConsumerScope) {
+  AddConsumer(kTopicPath, kConsumerName);
+
+  std::atomic<std::size_t> messages_count{0};
+  {
+    ydb::TopicConsumerScope consumer{
+        CreateReadSession(kTopicPath, kConsumerName),
+        engine::current_task::GetTaskProcessor()};
+    consumer.Start(
+        [&messages_count](
+            NYdb::NTopic::TReadSessionEvent::TDataReceivedEvent& event) {
+          messages_count += event.GetMessagesCount();
+        });
+
+    GetTableClient().ExecuteDataQuery(fmt::format(R"-(
+        INSERT INTO {} (key, value)
+        VALUES
+          (123, "qwe"),
+          (321, "xyz");
+      )-",
+                                                  kTable));
+
+    const auto deadline =
+        engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+    while (messages_count < 2 && !deadline.IsReached()) {
+      engine::SleepFor(std::chrono::milliseconds{10});
+    }
+  }
+  EXPECT_EQ(messages_count, 2);
+
+  DropConsumer(kTopicPath, kConsumerName);
+}
+
 UTEST_F(YdbTopicFixture, AlterTopic) {
   constexpr std::string_view consumer_name = "another_test_consumer";
 